@@ -515,7 +515,7 @@ Ax88179Reset (
 
   if (EFI_ERROR(Status)) goto err;
 
-  Val = 12; //AX88179_BULKIN_SIZE_INK - 1;
+  Val = AX88179_BULKIN_SIZE_INK - 2;
   Status =  Ax88179MacWrite (RXBINQSIZE,
                               0x01,
                               NicDevice,
@@ -17,6 +17,7 @@
 
 #include <IndustryStandard/Pci.h>
 
+#include <Library/AsixUsbTxLib.h>
 #include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
 #include <Library/DevicePathLib.h>
@@ -69,7 +70,11 @@
 #define USB_NETWORK_CLASS   0x09    ///<  USB Network class code
 #define USB_BUS_TIMEOUT     1000    ///<  USB timeout in milliseconds
 
-#define AX88179_BULKIN_SIZE_INK     2
+//
+// The bulk-in buffer must hold a complete aggregated transfer: the chip
+// is allowed to queue up to (RXBINQSIZE + 2) KB of frames into one burst.
+//
+#define AX88179_BULKIN_SIZE_INK     20
 #define AX88179_MAX_BULKIN_SIZE    (1024 * AX88179_BULKIN_SIZE_INK)
 #define AX88179_MAX_PKT_SIZE  2048
 
@@ -215,14 +220,13 @@ typedef struct {
 #pragma pack()
 
 /**
-  Receive and Transmit packet structure
+  Header preceding every frame in a bulk-out transfer
 **/
 #pragma pack(1)
-typedef struct _TX_PACKET {
-  UINT32  TxHdr1;
-  UINT32  TxHdr2;
-  UINT8   Data[AX88179_MAX_PKT_SIZE]; ///<  Received packet data
-} TX_PACKET;
+typedef struct _TX_HEADER {
+  UINT32  TxHdr1;                     ///<  Frame length
+  UINT32  TxHdr2;                     ///<  Large send MSS, unused
+} TX_HEADER;
 #pragma pack()
 
 #pragma pack(1)
@@ -279,14 +283,13 @@ typedef struct {
   UINT8                     *CurPktHdrOff;
   UINT8                     *CurPktOff;
 
-  TX_PACKET                 *TxTest;
+  ASIX_TX_QUEUE             TxQueue;
 
   INT8                      MulticastHash[8];
   EFI_MAC_ADDRESS           MAC;
 
   UINT16                    CurMediumStatus;
   UINT16                    CurRxControl;
-  VOID *                    TxBuffer;
 
   EFI_DEVICE_PATH_PROTOCOL  *MyDevPath;
   BOOLEAN                   Grub_f;
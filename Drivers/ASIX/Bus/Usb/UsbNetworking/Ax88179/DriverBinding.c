@@ -277,9 +277,7 @@ ERR:
     gBS->FreePool (NicDevice->BulkInbuf);
   }
 
-  if (NicDevice->TxTest != NULL) {
-    gBS->FreePool (NicDevice->TxTest);
-  }
+  AsixTxQueueFree (&NicDevice->TxQueue);
 
   if (NicDevice->MyDevPath != NULL) {
     gBS->FreePool (NicDevice->MyDevPath);
@@ -441,9 +439,7 @@ DriverStop (
         gBS->FreePool (NicDevice->BulkInbuf);
       }
 
-      if (NicDevice->TxTest != NULL) {
-        gBS->FreePool (NicDevice->TxTest);
-      }
+      AsixTxQueueFree (&NicDevice->TxQueue);
 
       if (NicDevice->MyDevPath != NULL) {
         gBS->FreePool (NicDevice->MyDevPath);
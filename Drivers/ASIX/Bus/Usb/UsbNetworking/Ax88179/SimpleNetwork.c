@@ -133,9 +133,13 @@ SN_GetStatus (
     //
     NicDevice = DEV_FROM_SIMPLE_NETWORK (SimpleNetwork);
 
-    if ((TxBuf != NULL) && (NicDevice->TxBuffer != NULL)) {
-      *TxBuf = NicDevice->TxBuffer;
-      NicDevice->TxBuffer = NULL;
+    if (TxBuf != NULL) {
+      //
+      // Send any frames still waiting for a batch so their buffers
+      // can be recycled
+      //
+      AsixTxQueueFlush (&NicDevice->TxQueue);
+      *TxBuf = AsixTxQueueGetCompleted (&NicDevice->TxQueue);
     }
 
     Mode = SimpleNetwork->Mode;
@@ -562,6 +566,11 @@ SN_Receive (
           return EFI_NOT_READY;
         }
 
+        //
+        //  Push out transmits queued since the last bulk-out
+        //
+        AsixTxQueueFlush (&NicDevice->TxQueue);
+
         //
         //  Attempt to do bulk in
         //
@@ -607,6 +616,15 @@ SN_Receive (
           NicDevice->CurPktHdrOff += 4;
           NicDevice->CurPktOff += (CurrentPktLen + 2 + 7) & 0xfff8;
           Status = EFI_SUCCESS;
+        } else if (!Valid && (CurrentPktLen <= AX88179_MAX_PKT_SIZE)) {
+          //
+          //  The chip flagged this frame but its length is sane, so step
+          //  over it rather than discarding the rest of the aggregate
+          //
+          NicDevice->PktCnt--;
+          NicDevice->CurPktHdrOff += 4;
+          NicDevice->CurPktOff += (CurrentPktLen + 2 + 7) & 0xfff8;
+          Status = EFI_NOT_READY;
         } else {
           NicDevice->PktCnt = 0;
           Status = EFI_NOT_READY;
@@ -892,6 +910,38 @@ SN_Reset (
   return Status;
 }
 
+/**
+  Write the bulk-out header preceding a frame.
+
+  @param [out] Header         Start of the 8 byte header
+  @param [in]  FrameLength    Length of the frame following the header
+
+**/
+STATIC
+VOID
+EFIAPI
+Ax88179WriteTxHeader (
+  OUT VOID   *Header,
+  IN  UINT16 FrameLength
+  )
+{
+  TX_HEADER *TxHdr;
+
+  TxHdr = Header;
+  TxHdr->TxHdr1 = FrameLength;
+  TxHdr->TxHdr2 = 0;
+}
+
+STATIC CONST ASIX_TX_FORMAT mAx88179TxFormat = {
+  sizeof (TX_HEADER),             // HeaderSize
+  sizeof (UINT32),                // FrameAlign
+  MIN_ETHERNET_PKT_SIZE,          // MinFrameSize
+  MAX_ETHERNET_PKT_SIZE + sizeof (ETHERNET_HEADER), // MaxFrameSize
+  0,                              // ZlpPacketSize
+  0,                              // ZlpPad
+  Ax88179WriteTxHeader            // WriteHeader
+};
+
 /**
   Initialize the simple network protocol.
 
@@ -953,7 +1003,7 @@ SN_Setup (
            0xff);
   Mode->IfType = NET_IFTYPE_ETHERNET;
   Mode->MacAddressChangeable = TRUE;
-  Mode->MultipleTxSupported = FALSE;
+  Mode->MultipleTxSupported = TRUE;
   Mode->MediaPresentSupported = TRUE;
   Mode->MediaPresent = FALSE;
   //
@@ -997,9 +1047,10 @@ SN_Setup (
     return Status;
   }
 
-  Status = gBS->AllocatePool (EfiBootServicesData,
-                               sizeof (TX_PACKET),
-                               (VOID **) &NicDevice->TxTest);
+  Status = AsixTxQueueInit (&NicDevice->TxQueue,
+                             NicDevice->UsbIo,
+                             BULK_OUT_ENDPOINT,
+                             &mAx88179TxFormat);
   if (EFI_ERROR (Status)) {
     gBS->FreePool (NicDevice->BulkInbuf);
   }
@@ -1071,7 +1122,7 @@ SN_Start (
       SetMem(&Mode->BroadcastAddress, PXE_HWADDR_LEN_ETHER, 0xff);
       Mode->IfType = NET_IFTYPE_ETHERNET;
       Mode->MacAddressChangeable = TRUE;
-      Mode->MultipleTxSupported = FALSE;
+      Mode->MultipleTxSupported = TRUE;
       Mode->MediaPresentSupported = TRUE;
       Mode->MediaPresent = FALSE;
 
@@ -1342,6 +1393,11 @@ SN_Shutdown (
 
       Status = Ax88179MacAddressGet (NicDevice, &Mode->PermanentAddress.Addr[0]);
       if (!EFI_ERROR (Status)) {
+        //
+        // Pending transmits are lost
+        //
+        AsixTxQueueReset (&NicDevice->TxQueue);
+
         //
         // Update the network state
         //
@@ -1423,10 +1479,7 @@ SN_Transmit (
   ETHERNET_HEADER         *Header;
   EFI_SIMPLE_NETWORK_MODE *Mode;
   NIC_DEVICE              *NicDevice;
-  EFI_USB_IO_PROTOCOL     *UsbIo;
   EFI_STATUS              Status;
-  UINTN                   TransferLength;
-  UINT32                  TransferStatus;
   UINT16                  Type = 0;
   EFI_TPL                 TplPrevious;
 
@@ -1467,16 +1520,24 @@ SN_Transmit (
           goto EXIT;
         }
         //
-        //  Copy the packet into the USB buffer
-        //
-        // Buffer starting with 14 bytes 0
-        CopyMem (&NicDevice->TxTest->Data[0], Buffer, BufferSize);
-        NicDevice->TxTest->TxHdr1 = (UINT32) BufferSize;
-        NicDevice->TxTest->TxHdr2 = 0;
-        //
-        //  Transmit the packet
+        //  Queue the packet for the next bulk-out, back-to-back transmits
+        //  leave in a single USB transfer
         //
-        Header = (ETHERNET_HEADER *) &NicDevice->TxTest->Data[0];
+        Status = AsixTxQueueFrame (&NicDevice->TxQueue,
+                                   Buffer,
+                                   BufferSize,
+                                   (UINT8 **) &Header);
+        if (EFI_ERROR (Status)) {
+          if ((EFI_TIMEOUT == Status) || (EFI_NOT_READY == Status)) {
+            Status = EFI_NOT_READY;
+          } else if (EFI_BAD_BUFFER_SIZE == Status) {
+            Status = EFI_INVALID_PARAMETER;
+          } else {
+            Status = EFI_DEVICE_ERROR;
+          }
+          goto EXIT;
+        }
+
         if (HeaderSize != 0) {
           if (DestAddr != NULL) {
             CopyMem (&Header->DestAddr, DestAddr, PXE_HWADDR_LEN_ETHER);
@@ -1494,37 +1555,6 @@ SN_Transmit (
           Type = (UINT16)((Type >> 8) | (Type << 8));
           Header->Type = Type;
         }
-
-        if (NicDevice->TxTest->TxHdr1 < MIN_ETHERNET_PKT_SIZE) {
-          NicDevice->TxTest->TxHdr1 = MIN_ETHERNET_PKT_SIZE;
-          ZeroMem (&NicDevice->TxTest->Data[BufferSize],
-                    MIN_ETHERNET_PKT_SIZE - BufferSize);
-        }
-
-        TransferLength = sizeof (NicDevice->TxTest->TxHdr1)
-                       + sizeof (NicDevice->TxTest->TxHdr2)
-                       + NicDevice->TxTest->TxHdr1;
-        //
-        //  Work around USB bus driver bug where a timeout set by receive
-        //  succeeds but the timeout expires immediately after, causing the
-        //  transmit operation to timeout.
-        //
-        UsbIo = NicDevice->UsbIo;
-        Status = UsbIo->UsbBulkTransfer (UsbIo,
-                                           BULK_OUT_ENDPOINT,
-                                           &NicDevice->TxTest->TxHdr1,
-                                           &TransferLength,
-                                           0xfffffffe,
-                                           &TransferStatus);
-
-        if (!EFI_ERROR(Status) && !EFI_ERROR(Status)) {
-          NicDevice->TxBuffer = Buffer;
-          Status = EFI_SUCCESS;
-        } else if (EFI_TIMEOUT == Status && EFI_USB_ERR_TIMEOUT == TransferStatus) {
-          Status = EFI_NOT_READY;
-        } else {
-          Status = EFI_DEVICE_ERROR;
-        }
       } else {
         //
         // No packets available.
@@ -17,6 +17,7 @@
 
 #include <IndustryStandard/Pci.h>
 
+#include <Library/AsixUsbTxLib.h>
 #include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
 #include <Library/DevicePathLib.h>
@@ -308,15 +309,13 @@ typedef struct {
 #pragma pack()
 
 /**
-  Receive and Transmit packet structure
+  Header preceding every frame in a bulk-out transfer
 **/
 #pragma pack(1)
-typedef struct _RX_TX_PACKET {
-  struct _RX_TX_PACKET * Next;        ///<  Next receive packet
+typedef struct _TX_HEADER {
   UINT16 Length;                      ///<  Packet length
   UINT16 LengthBar;                   ///<  Complement of the length
-  UINT8  Data[AX88772_MAX_PKT_SIZE];  ///<  Received packet data
-} RX_TX_PACKET;
+} TX_HEADER;
 #pragma pack()
 
 /**
@@ -355,7 +354,6 @@ typedef struct {
   BOOLEAN                   LinkUp;             ///<  Current link state
   UINTN                     PollCount;          ///<  Number of times the autonegotiation status was polled
   UINT16                    CurRxControl;
-  VOID                      *TxBuffer;
   //
   //  Receive buffer list
   //
@@ -364,7 +362,7 @@ typedef struct {
   UINT8                     *CurPktOff;
   UINT16                    PktCnt;
 
-  RX_TX_PACKET              *TxTest;
+  ASIX_TX_QUEUE             TxQueue;
 
   UINT8                     MulticastHash[8];
   EFI_MAC_ADDRESS           MAC;
@@ -289,9 +289,7 @@ ERR:
     gBS->FreePool (NicDevice->BulkInbuf);
   }
 
-  if (NicDevice->TxTest != NULL) {
-    gBS->FreePool (NicDevice->TxTest);
-  }
+  AsixTxQueueFree (&NicDevice->TxQueue);
 
   if (NicDevice->MyDevPath != NULL) {
     gBS->FreePool (NicDevice->MyDevPath);
@@ -454,9 +452,7 @@ DriverStop (
         gBS->FreePool (NicDevice->BulkInbuf);
       }
 
-      if (NicDevice->TxTest != NULL) {
-        gBS->FreePool (NicDevice->TxTest);
-      }
+      AsixTxQueueFree (&NicDevice->TxQueue);
 
       if (NicDevice->MyDevPath != NULL) {
         gBS->FreePool (NicDevice->MyDevPath);
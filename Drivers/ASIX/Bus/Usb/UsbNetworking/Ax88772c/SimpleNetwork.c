@@ -133,9 +133,13 @@ SN_GetStatus (
     //
     NicDevice = DEV_FROM_SIMPLE_NETWORK (SimpleNetwork);
 
-    if ((TxBuf != NULL) && (NicDevice->TxBuffer != NULL)) {
-      *TxBuf = NicDevice->TxBuffer;
-      NicDevice->TxBuffer = NULL;
+    if (TxBuf != NULL) {
+      //
+      // Send any frames still waiting for a batch so their buffers
+      // can be recycled
+      //
+      AsixTxQueueFlush (&NicDevice->TxQueue);
+      *TxBuf = AsixTxQueueGetCompleted (&NicDevice->TxQueue);
     }
 
     Mode = SimpleNetwork->Mode;
@@ -561,6 +565,11 @@ SN_Receive (
           return EFI_NOT_READY;
         }
 
+        //
+        //  Push out transmits queued since the last bulk-out
+        //
+        AsixTxQueueFlush (&NicDevice->TxQueue);
+
         //
         //  Attempt to receive a packet
         //
@@ -896,6 +905,38 @@ SN_Reset (
   return Status;
 }
 
+/**
+  Write the bulk-out header preceding a frame.
+
+  @param [out] Header         Start of the 4 byte header
+  @param [in]  FrameLength    Length of the frame following the header
+
+**/
+STATIC
+VOID
+EFIAPI
+Ax88772WriteTxHeader (
+  OUT VOID   *Header,
+  IN  UINT16 FrameLength
+  )
+{
+  TX_HEADER *TxHdr;
+
+  TxHdr = Header;
+  TxHdr->Length = FrameLength;
+  TxHdr->LengthBar = (UINT16) ~FrameLength;
+}
+
+STATIC CONST ASIX_TX_FORMAT mAx88772TxFormat = {
+  sizeof (TX_HEADER),             // HeaderSize
+  sizeof (UINT32),                // FrameAlign
+  MIN_ETHERNET_PKT_SIZE,          // MinFrameSize
+  MAX_ETHERNET_PKT_SIZE + sizeof (ETHERNET_HEADER), // MaxFrameSize
+  512,                            // ZlpPacketSize
+  0xffff0000,                     // ZlpPad
+  Ax88772WriteTxHeader            // WriteHeader
+};
+
 /**
   Initialize the simple network protocol.
 
@@ -962,7 +1003,7 @@ SN_Setup (
 
   Mode->IfType = NET_IFTYPE_ETHERNET;
   Mode->MacAddressChangeable = TRUE;
-  Mode->MultipleTxSupported = FALSE;
+  Mode->MultipleTxSupported = TRUE;
   Mode->MediaPresentSupported = TRUE;
   Mode->MediaPresent = FALSE;
 
@@ -1005,9 +1046,10 @@ SN_Setup (
     return Status;
   }
 
-  Status = gBS->AllocatePool (EfiBootServicesData,
-                                   sizeof (RX_TX_PACKET),
-                                   (VOID **) &NicDevice->TxTest);
+  Status = AsixTxQueueInit (&NicDevice->TxQueue,
+                             NicDevice->UsbIo,
+                             BULK_OUT_ENDPOINT,
+                             &mAx88772TxFormat);
 
   if (EFI_ERROR (Status)) {
     gBS->FreePool (NicDevice->BulkInbuf);
@@ -1086,7 +1128,7 @@ SN_Start (
       SetMem(&Mode->BroadcastAddress, PXE_HWADDR_LEN_ETHER, 0xff);
       Mode->IfType = NET_IFTYPE_ETHERNET;
       Mode->MacAddressChangeable = TRUE;
-      Mode->MultipleTxSupported = FALSE;
+      Mode->MultipleTxSupported = TRUE;
       Mode->MediaPresentSupported = TRUE;
       Mode->MediaPresent = FALSE;
 
@@ -1340,6 +1382,7 @@ SN_Shutdown (
   EFI_SIMPLE_NETWORK_MODE *Mode;
   UINT32                  RxFilter;
   EFI_STATUS              Status;
+  NIC_DEVICE              *NicDevice;
   EFI_TPL                 TplPrevious;
 
   TplPrevious = gBS->RaiseTPL(TPL_CALLBACK);
@@ -1360,6 +1403,12 @@ SN_Shutdown (
       Status = SN_Reset (SimpleNetwork, FALSE);
       Mode->ReceiveFilterSetting = RxFilter;
       if (!EFI_ERROR (Status)) {
+        //
+        // Pending transmits are lost
+        //
+        NicDevice = DEV_FROM_SIMPLE_NETWORK (SimpleNetwork);
+        AsixTxQueueReset (&NicDevice->TxQueue);
+
         //
         // Update the network state
         //
@@ -1441,10 +1490,7 @@ SN_Transmit (
   ETHERNET_HEADER         *Header;
   EFI_SIMPLE_NETWORK_MODE *Mode;
   NIC_DEVICE              *NicDevice;
-  EFI_USB_IO_PROTOCOL     *UsbIo;
   EFI_STATUS              Status;
-  UINTN                   TransferLength;
-  UINT32                  TransferStatus;
   UINT16                  Type;
   EFI_TPL                 TplPrevious;
 
@@ -1467,10 +1513,6 @@ SN_Transmit (
       //  Release the synchronization with Ax88772Timer
       //
       if (NicDevice->LinkUp && NicDevice->Complete) {
-        //
-        //  Copy the packet into the USB buffer
-        //
-
         if ((HeaderSize != 0) && (Mode->MediaHeaderSize != HeaderSize))  {
           Status = EFI_INVALID_PARAMETER;
           goto EXIT;
@@ -1492,13 +1534,30 @@ SN_Transmit (
           goto EXIT;
         }
 
-        CopyMem (&NicDevice->TxTest->Data[0], Buffer, BufferSize);
-        NicDevice->TxTest->Length = (UINT16) BufferSize;
-
+#if RXTHOU
+        if (NicDevice->RxBurst == 1)
+          NicDevice->RxBurst--;
+#endif
         //
-        //  Transmit the packet
+        //  Queue the packet for the next bulk-out, back-to-back transmits
+        //  leave in a single USB transfer
         //
-        Header = (ETHERNET_HEADER *) &NicDevice->TxTest->Data[0];
+        Status = AsixTxQueueFrame (&NicDevice->TxQueue,
+                                   Buffer,
+                                   BufferSize,
+                                   (UINT8 **) &Header);
+        if (EFI_ERROR (Status)) {
+          if (EFI_BAD_BUFFER_SIZE == Status) {
+            Status = EFI_INVALID_PARAMETER;
+          } else {
+            if (EFI_DEVICE_ERROR == Status) {
+              SN_Reset (SimpleNetwork, FALSE);
+            }
+            Status = EFI_NOT_READY;
+          }
+          goto EXIT;
+        }
+
         if (HeaderSize != 0) {
           if (DestAddr != NULL) {
             CopyMem (&Header->DestAddr, DestAddr, PXE_HWADDR_LEN_ETHER);
@@ -1511,53 +1570,11 @@ SN_Transmit (
           if (Protocol != NULL) {
             Type = *Protocol;
           } else {
-            Type = NicDevice->TxTest->Length;
+            Type = (UINT16) BufferSize;
           }
           Type = (UINT16)((Type >> 8) | (Type << 8));
           Header->Type = Type;
         }
-
-
-        if (NicDevice->TxTest->Length < MIN_ETHERNET_PKT_SIZE) {
-          NicDevice->TxTest->Length = MIN_ETHERNET_PKT_SIZE;
-          ZeroMem (&NicDevice->TxTest->Data[BufferSize],
-                    NicDevice->TxTest->Length - BufferSize);
-        }
-
-        NicDevice->TxTest->LengthBar = ~(NicDevice->TxTest->Length);
-        TransferLength = sizeof (NicDevice->TxTest->Length)
-                       + sizeof (NicDevice->TxTest->LengthBar)
-                       + NicDevice->TxTest->Length;
-
-        if (TransferLength % 512 == 0 || TransferLength % 1024 == 0)
-          TransferLength +=4;
-#if RXTHOU
-        if (NicDevice->RxBurst == 1)
-          NicDevice->RxBurst--;
-#endif
-        //
-        //  Work around USB bus driver bug where a timeout set by receive
-        //  succeeds but the timeout expires immediately after, causing the
-        //  transmit operation to timeout.
-        //
-        UsbIo = NicDevice->UsbIo;
-        Status = UsbIo->UsbBulkTransfer (UsbIo,
-                                           BULK_OUT_ENDPOINT,
-                                           &NicDevice->TxTest->Length,
-                                           &TransferLength,
-                                           0xfffffffe,
-                                           &TransferStatus);
-        if (EFI_SUCCESS == Status) {
-          Status = TransferStatus;
-        }
-        if (EFI_SUCCESS == Status && EFI_SUCCESS == TransferStatus) {
-          NicDevice->TxBuffer = Buffer;
-        } else {
-          if (EFI_DEVICE_ERROR == Status) {
-            SN_Reset (SimpleNetwork, FALSE);
-          }
-          Status = EFI_NOT_READY;
-        }
       } else {
         //
         // No packets available.
@@ -0,0 +1,179 @@
+/** @file
+  Batched bulk-out transmit path shared by the ASIX USB/Ethernet drivers.
+
+  The ASIX adapters accept several frames in a single bulk-out transfer as
+  long as every frame is preceded by its own chip specific header.  This
+  library collects back-to-back SNP transmits into one staging buffer,
+  sends them with a single UsbBulkTransfer() and hands the caller buffers
+  back through the SNP GetStatus() path once the batch has gone out.
+
+  Copyright (c) 2020, ARM Limited. All rights reserved.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef ASIX_USB_TX_LIB_H_
+#define ASIX_USB_TX_LIB_H_
+
+#include <Protocol/UsbIo.h>
+
+#define ASIX_TX_QUEUE_MAX_FRAMES  8   ///<  Frames coalesced into one bulk-out
+#define ASIX_TX_QUEUE_DEPTH       16  ///<  Caller buffers tracked until GetStatus()
+
+/**
+  Write the chip specific header that precedes a frame in a bulk-out transfer.
+
+  @param [out] Header         Start of the header, HeaderSize bytes long
+  @param [in]  FrameLength    Length of the frame following the header
+
+**/
+typedef
+VOID
+(EFIAPI *ASIX_TX_WRITE_HEADER) (
+  OUT VOID   *Header,
+  IN  UINT16 FrameLength
+  );
+
+/**
+  Description of the bulk-out framing used by a particular chip.
+**/
+typedef struct {
+  UINT16               HeaderSize;      ///<  Bytes of header in front of every frame
+  UINT16               FrameAlign;      ///<  Alignment of each header within the transfer
+  UINT16               MinFrameSize;    ///<  Frames are zero padded up to this size
+  UINT16               MaxFrameSize;    ///<  Largest frame the chip accepts
+  UINT16               ZlpPacketSize;   ///<  USB packet size needing a pad, 0 when not needed
+  UINT32               ZlpPad;          ///<  Pad appended instead of a zero length packet
+  ASIX_TX_WRITE_HEADER WriteHeader;     ///<  Header formatter
+} ASIX_TX_FORMAT;
+
+/**
+  Transmit queue state, embedded in the driver's NIC_DEVICE.
+**/
+typedef struct {
+  EFI_USB_IO_PROTOCOL  *UsbIo;          ///<  USB driver interface
+  UINT8                Endpoint;        ///<  Bulk-out endpoint address
+  CONST ASIX_TX_FORMAT *Format;         ///<  Chip framing
+
+  UINT8                *Buffer;         ///<  Staging buffer for the next bulk-out
+  UINTN                BufferSize;      ///<  Size of the staging buffer
+  UINTN                Used;            ///<  Bytes queued in the staging buffer
+  UINTN                Frames;          ///<  Frames queued in the staging buffer
+
+  VOID                 *TxBuf[ASIX_TX_QUEUE_DEPTH]; ///<  Caller buffers, oldest first
+  UINTN                Head;            ///<  Oldest buffer not yet returned
+  UINTN                Sent;            ///<  Oldest buffer not yet sent
+  UINTN                Tail;            ///<  Next free slot
+} ASIX_TX_QUEUE;
+
+/**
+  Allocate the staging buffer and initialize the transmit queue.
+
+  @param [out] Queue          Transmit queue to initialize
+  @param [in]  UsbIo          USB driver interface
+  @param [in]  Endpoint       Bulk-out endpoint address
+  @param [in]  Format         Chip framing, must stay valid while the queue is used
+
+  @retval EFI_SUCCESS           The queue is ready for use.
+  @retval EFI_INVALID_PARAMETER The framing description is not usable.
+  @retval EFI_OUT_OF_RESOURCES  The staging buffer could not be allocated.
+
+**/
+EFI_STATUS
+EFIAPI
+AsixTxQueueInit (
+  OUT ASIX_TX_QUEUE        *Queue,
+  IN  EFI_USB_IO_PROTOCOL  *UsbIo,
+  IN  UINT8                Endpoint,
+  IN  CONST ASIX_TX_FORMAT *Format
+  );
+
+/**
+  Release the staging buffer of a transmit queue.
+
+  @param [in] Queue           Transmit queue initialized by AsixTxQueueInit()
+
+**/
+VOID
+EFIAPI
+AsixTxQueueFree (
+  IN ASIX_TX_QUEUE *Queue
+  );
+
+/**
+  Forget all queued frames and all buffers waiting to be returned.
+
+  @param [in] Queue           Transmit queue
+
+**/
+VOID
+EFIAPI
+AsixTxQueueReset (
+  IN ASIX_TX_QUEUE *Queue
+  );
+
+/**
+  Append a frame to the next bulk-out transfer.
+
+  The frame is copied into the staging buffer, padded to the minimum frame
+  size and prefixed with its header.  When the staging buffer cannot take
+  the frame the frames already queued are sent first.
+
+  @param [in]  Queue          Transmit queue
+  @param [in]  TxBuf          Caller buffer, returned later by AsixTxQueueGetCompleted()
+  @param [in]  Length         Number of bytes in TxBuf
+  @param [out] Frame          Copy of the frame in the staging buffer, optional.
+                              The caller may still update the media header here.
+
+  @retval EFI_SUCCESS           The frame is queued.
+  @retval EFI_BAD_BUFFER_SIZE   The frame is larger than the chip accepts.
+  @retval EFI_NOT_READY         Too many buffers are waiting to be returned.
+  @retval Others                Sending the frames already queued failed, see
+                                AsixTxQueueFlush().
+
+**/
+EFI_STATUS
+EFIAPI
+AsixTxQueueFrame (
+  IN  ASIX_TX_QUEUE *Queue,
+  IN  VOID          *TxBuf,
+  IN  UINTN         Length,
+  OUT UINT8         **Frame OPTIONAL
+  );
+
+/**
+  Send the queued frames with a single bulk-out transfer.
+
+  The caller buffers of the batch become available through
+  AsixTxQueueGetCompleted() whether or not the transfer succeeded, a failed
+  batch is dropped just like a frame lost on the wire.
+
+  @param [in] Queue           Transmit queue
+
+  @retval EFI_SUCCESS         The frames were sent or nothing was queued.
+  @retval EFI_TIMEOUT         The adapter did not accept the transfer in time.
+  @retval EFI_DEVICE_ERROR    The transfer failed.
+
+**/
+EFI_STATUS
+EFIAPI
+AsixTxQueueFlush (
+  IN ASIX_TX_QUEUE *Queue
+  );
+
+/**
+  Return the oldest caller buffer whose frame has been sent.
+
+  @param [in] Queue           Transmit queue
+
+  @return The caller buffer, or NULL when no transmit has completed.
+
+**/
+VOID *
+EFIAPI
+AsixTxQueueGetCompleted (
+  IN ASIX_TX_QUEUE *Queue
+  );
+
+#endif  // ASIX_USB_TX_LIB_H_
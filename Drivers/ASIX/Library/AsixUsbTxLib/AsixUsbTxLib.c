@@ -0,0 +1,290 @@
+/** @file
+  Batched bulk-out transmit path shared by the ASIX USB/Ethernet drivers.
+
+  Copyright (c) 2020, ARM Limited. All rights reserved.
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+
+#include <Library/AsixUsbTxLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+
+//
+//  Work around USB bus driver bug where a timeout set by receive
+//  succeeds but the timeout expires immediately after, causing the
+//  transmit operation to timeout.
+//
+#define ASIX_TX_TIMEOUT   0xfffffffe
+
+/**
+  Allocate the staging buffer and initialize the transmit queue.
+
+  @param [out] Queue          Transmit queue to initialize
+  @param [in]  UsbIo          USB driver interface
+  @param [in]  Endpoint       Bulk-out endpoint address
+  @param [in]  Format         Chip framing, must stay valid while the queue is used
+
+  @retval EFI_SUCCESS           The queue is ready for use.
+  @retval EFI_INVALID_PARAMETER The framing description is not usable.
+  @retval EFI_OUT_OF_RESOURCES  The staging buffer could not be allocated.
+
+**/
+EFI_STATUS
+EFIAPI
+AsixTxQueueInit (
+  OUT ASIX_TX_QUEUE        *Queue,
+  IN  EFI_USB_IO_PROTOCOL  *UsbIo,
+  IN  UINT8                Endpoint,
+  IN  CONST ASIX_TX_FORMAT *Format
+  )
+{
+  if ((Queue == NULL) || (UsbIo == NULL) || (Format == NULL) ||
+      (Format->WriteHeader == NULL) || (Format->FrameAlign == 0) ||
+      ((Format->FrameAlign & (Format->FrameAlign - 1)) != 0) ||
+      (Format->MinFrameSize > Format->MaxFrameSize)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  ZeroMem (Queue, sizeof (ASIX_TX_QUEUE));
+  Queue->UsbIo = UsbIo;
+  Queue->Endpoint = Endpoint;
+  Queue->Format = Format;
+
+  //
+  // Room for a full batch of maximum size frames plus the pad that
+  // replaces a zero length packet.
+  //
+  Queue->BufferSize = ASIX_TX_QUEUE_MAX_FRAMES *
+                      ALIGN_VALUE (Format->HeaderSize + Format->MaxFrameSize,
+                                   Format->FrameAlign) +
+                      sizeof (Format->ZlpPad);
+  Queue->Buffer = AllocatePool (Queue->BufferSize);
+  if (Queue->Buffer == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Release the staging buffer of a transmit queue.
+
+  @param [in] Queue           Transmit queue initialized by AsixTxQueueInit()
+
+**/
+VOID
+EFIAPI
+AsixTxQueueFree (
+  IN ASIX_TX_QUEUE *Queue
+  )
+{
+  if (Queue->Buffer != NULL) {
+    FreePool (Queue->Buffer);
+    Queue->Buffer = NULL;
+  }
+  AsixTxQueueReset (Queue);
+}
+
+/**
+  Forget all queued frames and all buffers waiting to be returned.
+
+  @param [in] Queue           Transmit queue
+
+**/
+VOID
+EFIAPI
+AsixTxQueueReset (
+  IN ASIX_TX_QUEUE *Queue
+  )
+{
+  Queue->Used = 0;
+  Queue->Frames = 0;
+  Queue->Head = 0;
+  Queue->Sent = 0;
+  Queue->Tail = 0;
+}
+
+/**
+  Append a frame to the next bulk-out transfer.
+
+  The frame is copied into the staging buffer, padded to the minimum frame
+  size and prefixed with its header.  When the staging buffer cannot take
+  the frame the frames already queued are sent first.
+
+  @param [in]  Queue          Transmit queue
+  @param [in]  TxBuf          Caller buffer, returned later by AsixTxQueueGetCompleted()
+  @param [in]  Length         Number of bytes in TxBuf
+  @param [out] Frame          Copy of the frame in the staging buffer, optional.
+                              The caller may still update the media header here.
+
+  @retval EFI_SUCCESS           The frame is queued.
+  @retval EFI_BAD_BUFFER_SIZE   The frame is larger than the chip accepts.
+  @retval EFI_NOT_READY         Too many buffers are waiting to be returned.
+  @retval Others                Sending the frames already queued failed, see
+                                AsixTxQueueFlush().
+
+**/
+EFI_STATUS
+EFIAPI
+AsixTxQueueFrame (
+  IN  ASIX_TX_QUEUE *Queue,
+  IN  VOID          *TxBuf,
+  IN  UINTN         Length,
+  OUT UINT8         **Frame OPTIONAL
+  )
+{
+  CONST ASIX_TX_FORMAT *Format;
+  EFI_STATUS           Status;
+  UINTN                FrameLength;
+  UINTN                Offset;
+  UINT8                *Data;
+
+  Format = Queue->Format;
+  if (Length > Format->MaxFrameSize) {
+    return EFI_BAD_BUFFER_SIZE;
+  }
+
+  //
+  // Every queued frame holds on to its caller buffer until GetStatus()
+  // picks it up, so stop accepting frames when all slots are taken.
+  //
+  if (Queue->Tail - Queue->Head >= ASIX_TX_QUEUE_DEPTH) {
+    return EFI_NOT_READY;
+  }
+
+  FrameLength = MAX (Length, Format->MinFrameSize);
+  Offset = ALIGN_VALUE (Queue->Used, Format->FrameAlign);
+  if ((Queue->Frames == ASIX_TX_QUEUE_MAX_FRAMES) ||
+      (Offset + Format->HeaderSize + FrameLength >
+       Queue->BufferSize - sizeof (Format->ZlpPad))) {
+    Status = AsixTxQueueFlush (Queue);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+    Offset = 0;
+  }
+
+  //
+  // Fill the alignment gap behind the previous frame, the chip skips it.
+  //
+  ZeroMem (&Queue->Buffer[Queue->Used], Offset - Queue->Used);
+
+  Format->WriteHeader (&Queue->Buffer[Offset], (UINT16) FrameLength);
+  Data = &Queue->Buffer[Offset + Format->HeaderSize];
+  CopyMem (Data, TxBuf, Length);
+  if (FrameLength > Length) {
+    ZeroMem (&Data[Length], FrameLength - Length);
+  }
+
+  Queue->Used = Offset + Format->HeaderSize + FrameLength;
+  Queue->Frames++;
+  Queue->TxBuf[Queue->Tail % ASIX_TX_QUEUE_DEPTH] = TxBuf;
+  Queue->Tail++;
+
+  if (Frame != NULL) {
+    *Frame = Data;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Send the queued frames with a single bulk-out transfer.
+
+  The caller buffers of the batch become available through
+  AsixTxQueueGetCompleted() whether or not the transfer succeeded, a failed
+  batch is dropped just like a frame lost on the wire.
+
+  @param [in] Queue           Transmit queue
+
+  @retval EFI_SUCCESS         The frames were sent or nothing was queued.
+  @retval EFI_TIMEOUT         The adapter did not accept the transfer in time.
+  @retval EFI_DEVICE_ERROR    The transfer failed.
+
+**/
+EFI_STATUS
+EFIAPI
+AsixTxQueueFlush (
+  IN ASIX_TX_QUEUE *Queue
+  )
+{
+  CONST ASIX_TX_FORMAT *Format;
+  EFI_USB_IO_PROTOCOL  *UsbIo;
+  EFI_STATUS           Status;
+  UINTN                TransferLength;
+  UINT32               TransferStatus;
+
+  if (Queue->Frames == 0) {
+    return EFI_SUCCESS;
+  }
+
+  Format = Queue->Format;
+  TransferLength = Queue->Used;
+
+  //
+  // A transfer ending on a USB packet boundary would need a zero length
+  // packet to terminate it, append the pad the chip discards instead.
+  //
+  if ((Format->ZlpPacketSize != 0) &&
+      ((TransferLength % Format->ZlpPacketSize) == 0)) {
+    CopyMem (&Queue->Buffer[TransferLength], &Format->ZlpPad,
+      sizeof (Format->ZlpPad));
+    TransferLength += sizeof (Format->ZlpPad);
+  }
+
+  UsbIo = Queue->UsbIo;
+  TransferStatus = EFI_USB_NOERROR;
+  Status = UsbIo->UsbBulkTransfer (UsbIo,
+                                   Queue->Endpoint,
+                                   Queue->Buffer,
+                                   &TransferLength,
+                                   ASIX_TX_TIMEOUT,
+                                   &TransferStatus);
+  if (!EFI_ERROR (Status) && (TransferStatus != EFI_USB_NOERROR)) {
+    Status = EFI_DEVICE_ERROR;
+  } else if (EFI_ERROR (Status) && (Status != EFI_TIMEOUT)) {
+    Status = EFI_DEVICE_ERROR;
+  }
+
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_WARN, "%a: dropped %Lu frames, %r (0x%x)\n",
+      __FUNCTION__, (UINT64) Queue->Frames, Status, TransferStatus));
+  }
+
+  Queue->Sent = Queue->Tail;
+  Queue->Used = 0;
+  Queue->Frames = 0;
+
+  return Status;
+}
+
+/**
+  Return the oldest caller buffer whose frame has been sent.
+
+  @param [in] Queue           Transmit queue
+
+  @return The caller buffer, or NULL when no transmit has completed.
+
+**/
+VOID *
+EFIAPI
+AsixTxQueueGetCompleted (
+  IN ASIX_TX_QUEUE *Queue
+  )
+{
+  VOID *TxBuf;
+
+  if (Queue->Head == Queue->Sent) {
+    return NULL;
+  }
+
+  TxBuf = Queue->TxBuf[Queue->Head % ASIX_TX_QUEUE_DEPTH];
+  Queue->Head++;
+
+  return TxBuf;
+}
@@ -142,51 +142,6 @@ IsEdidChecksumCorrect (
   return (CalculatedChecksum == EdidChecksum);
 }
 
-/**
-Check if a particular video mode is in the Established Timings section of the EDID.
-
-@param  EDID        Pointer to the 128-byte EDID
-@param  hRes        Horizontal resolution
-@param  vRes        Vertical resolution
-@param  refresh     Refresh rate
-@retval TRUE        The requested mode is present in the Established Timings section
-
-**/
-STATIC BOOLEAN
-IsModeInEstablishedTimings (
-    IN CONST VOID *EDID,
-    IN UINT16 HRes,
-    IN UINT16 VRes,
-    IN UINT16 Refresh
-    )
-{
-  CONST struct Edid *pEDID = (CONST struct Edid *)EDID;
-  BOOLEAN ModeSupported;
-
-  ModeSupported = FALSE;
-
-  int EstByteNum;
-  int BitNum;
-  for (EstByteNum = 0; EstByteNum < EDID_NUMBER_OF_ESTABLISHED_TIMINGS_BYTES; EstByteNum++) {
-    for (BitNum = 0; BitNum < 8; BitNum++) {
-      if (pEDID->EstablishedTimings[EstByteNum] & (1 << BitNum)) { // The bit is set in the established timings of the EDID
-
-        if ((EstablishedTimings[EstByteNum][BitNum].HRes == HRes) && // The passed-in resolution matches the resolution represented by the set bit
-          (EstablishedTimings[EstByteNum][BitNum].VRes == VRes) &&
-          (EstablishedTimings[EstByteNum][BitNum].Refresh == Refresh)) {
-
-          ModeSupported = TRUE;
-          break;
-        }
-      }
-    }
-    if (ModeSupported == TRUE) {
-      break;
-    }
-  }
-  return ModeSupported;
-}
-
 /**
 Extract the resolutions and refresh rate from one of the entries in the Standard Timings section of the EDID.
 
@@ -337,9 +292,57 @@ ReadDetailedTiming (
 }
 
 /**
-Check if a particular video mode is in either the Established or Standard Timings section of the EDID.
+Collect the resolutions and refresh rates listed in the Established and Standard Timings sections of the EDID.
 
 @param  EDID        Pointer to the 128-byte EDID
+@param  Timings     Output - Array of EDID_MAX_LISTED_TIMINGS entries
+@retval             The number of timings stored in Timings
+
+**/
+STATIC UINTN
+ReadListedTimings (
+    IN CONST VOID *EDID,
+    OUT EDID_TIMING *Timings
+    )
+{
+  CONST struct Edid *pEDID = (CONST struct Edid *)EDID;
+  UINTN NumTimings;
+  UINT16 EdidHRes;
+  UINT16 EdidVRes;
+  UINT8 EdidRefresh;
+
+  NumTimings = 0;
+
+  int EstByteNum;
+  int BitNum;
+  for (EstByteNum = 0; EstByteNum < EDID_NUMBER_OF_ESTABLISHED_TIMINGS_BYTES; EstByteNum++) {
+    for (BitNum = 0; BitNum < 8; BitNum++) {
+      if ((pEDID->EstablishedTimings[EstByteNum] & (1 << BitNum)) && // The bit is set in the established timings of the EDID
+          (EstablishedTimings[EstByteNum][BitNum].HRes != 0)) {     // and stands for a defined timing
+        Timings[NumTimings++] = EstablishedTimings[EstByteNum][BitNum];
+      }
+    }
+  }
+
+  UINT8 i;
+  for (i = 0; i < EDID_NUMBER_OF_STANDARD_TIMINGS; i++) {
+    if (TRUE == ReadStandardTiming (EDID, i, &EdidHRes, &EdidVRes, &EdidRefresh)) {
+      Timings[NumTimings].HRes = EdidHRes;
+      Timings[NumTimings].VRes = EdidVRes;
+      Timings[NumTimings].Refresh = EdidRefresh;
+      NumTimings++;
+    }
+  }
+
+  ASSERT (NumTimings <= EDID_MAX_LISTED_TIMINGS);
+  return NumTimings;
+}
+
+/**
+Check if a particular video mode is one of the timings collected from the EDID.
+
+@param  Timings     Timings listed in the EDID
+@param  NumTimings  Number of entries in Timings
 @param  hRes        Horizontal resolution
 @param  vRes        Vertical resolution
 @param  refresh     Refresh rate
@@ -348,171 +351,134 @@ Check if a particular video mode is in either the Established or Standard Timing
 **/
 STATIC BOOLEAN
 IsModeInEdid (
-    IN CONST VOID *EDID,
+    IN CONST EDID_TIMING *Timings,
+    IN UINTN NumTimings,
     IN UINT16 HRes,
     IN UINT16 VRes,
     IN UINT16 Refresh
     )
 {
-  UINT16 EdidHRes;
-  UINT16 EdidVRes;
-  UINT8 EdidRefresh;
-  BOOLEAN ModeSupported;
-
-  ModeSupported = IsModeInEstablishedTimings (EDID, HRes, VRes, Refresh);
-
-  if (ModeSupported == FALSE) {
-    // Check if the mode is in the Standard Timings section of the EDID
-    UINT8 i;
-    for (i = 0; i < EDID_NUMBER_OF_STANDARD_TIMINGS; i++) {
-      if (TRUE == ReadStandardTiming (EDID, i, &EdidHRes, &EdidVRes, &EdidRefresh)) {
-        if ((HRes == EdidHRes) && (VRes == EdidVRes) && (Refresh == EdidRefresh)) {
-          ModeSupported = TRUE;
-          break;
-        }
-      }
+  UINTN i;
+  for (i = 0; i < NumTimings; i++) {
+    if ((Timings[i].HRes == HRes) && (Timings[i].VRes == VRes) && (Timings[i].Refresh == Refresh)) {
+      return TRUE;
     }
   }
-  return ModeSupported;
+  return FALSE;
 }
 
 /**
-Returns the (index)'th entry from the list of pre-calculated video timings that is also present in the EDID,
-or, video mode data corresponding to any detailed timings present in the EDID.
+Build the table of video modes offered through GOP from the active EDID, so that QueryMode and SetMode
+look a mode up by number instead of parsing the EDID again on every call.
+
+The table holds the pre-calculated video timings that are also present in the EDID, followed by the
+detailed timings present in the EDID. Without an EDID it holds all of the pre-calculated timings, and
+if none of the modes in the EDID are supported it falls back to a single 640x480@60Hz mode.
+
+@param  UsbDisplayLinkDev
 
-Like QueryVideoMode, finds the number (and contents) of video modes available by repeatedly calling this function
-with an increasing index value, until it returns FALSE
-@param  index       The caller wants the _index_'th video mode
-@param  EDID        Pointer to the 128-byte EDID
-@param  edidSize    Size in bytes of the EDID
-@param  videoMode   Video timings extracted from the modeData structure
-@retval EFI_SUCCESS The requested mode is present in the EDID
-@retval EFI_INVALID_PARAMETER The requested mode is not present in the EDID
 **/
-EFI_STATUS
-DlEdidGetSupportedVideoMode (
-    IN UINT32 Index,
-    IN CONST VOID *EDID,
-    IN UINT32 EdidSize,
-    OUT CONST struct VideoMode **VideoMode
+STATIC VOID
+BuildVideoModeTable (
+    IN OUT USB_DISPLAYLINK_DEV *UsbDisplayLinkDev
     )
 {
-  UINTN SupportedVideoModesFoundInEdid;
-  EFI_STATUS Status;
-
-  SupportedVideoModesFoundInEdid = 0;
-  Status = EFI_INVALID_PARAMETER;
-
-  // If we didn't manage to find an EDID earlier, just use one of the hard-coded video modes
-  if ((EDID == NULL) || (EdidSize != EDID_BLOCK_SIZE)) {
-    if (Index >= DlVideoModeGetNumSupportedVideoModes ()) {
-      return EFI_INVALID_PARAMETER;
-    }
-    else {
-      *VideoMode = DlVideoModeGetSupportedVideoMode (Index);
-      DEBUG ((DEBUG_WARN, "No monitor EDID loaded - returning mode from default list (%dx%d)\n", (*VideoMode)->HActive, (*VideoMode)->VActive));
-      return EFI_SUCCESS;
+  CONST VOID *EDID;
+  EDID_TIMING Timings[EDID_MAX_LISTED_TIMINGS];
+  UINTN NumTimings;
+  UINT32 NumModes;
+  UINT32 ModeNumber;
+
+  EDID = UsbDisplayLinkDev->EdidActive.Edid;
+  NumModes = 0;
+
+  // If we didn't manage to find an EDID, just use the hard-coded video modes
+  if ((EDID == NULL) || (UsbDisplayLinkDev->EdidActive.SizeOfEdid != EDID_BLOCK_SIZE)) {
+    for (ModeNumber = 0; ModeNumber < DlVideoModeGetNumSupportedVideoModes (); ModeNumber++) {
+      ASSERT (NumModes < DISPLAYLINK_MAX_VIDEO_MODES);
+      UsbDisplayLinkDev->VideoModes[NumModes++] = DlVideoModeGetSupportedVideoMode (ModeNumber);
     }
+    DEBUG ((DEBUG_WARN, "No monitor EDID loaded - using %d modes from default list\n", NumModes));
+    UsbDisplayLinkDev->NumVideoModes = NumModes;
+    return;
   }
 
-  UINT16 ModeNumber;
+  NumTimings = ReadListedTimings (EDID, Timings);
+
   for (ModeNumber = 0; ModeNumber < DlVideoModeGetNumSupportedVideoModes (); ModeNumber++) {
 
     CONST struct VideoMode *SupportedVideoMode = DlVideoModeGetSupportedVideoMode (ModeNumber);
     ASSERT (SupportedVideoMode);
 
-    if (IsModeInEdid (EDID, SupportedVideoMode->HActive, SupportedVideoMode->VActive, DISPLAYLINK_FIXED_VERTICAL_REFRESH_RATE)) {
-      if (Index == SupportedVideoModesFoundInEdid) {
-        *VideoMode = SupportedVideoMode;
-        Status = EFI_SUCCESS;
-        break;
-      }
-      SupportedVideoModesFoundInEdid++;
+    if (IsModeInEdid (Timings, NumTimings, SupportedVideoMode->HActive, SupportedVideoMode->VActive, DISPLAYLINK_FIXED_VERTICAL_REFRESH_RATE)) {
+      ASSERT (NumModes < DISPLAYLINK_MAX_VIDEO_MODES - DISPLAYLINK_MAX_DETAILED_MODES);
+      UsbDisplayLinkDev->VideoModes[NumModes++] = SupportedVideoMode;
     }
   }
 
-  if (EFI_ERROR (Status)) {
-    // Have a look in the detailed timings
-    UINTN DetailedTimingNumber;
-    STATIC struct VideoMode TmpVideoMode;
-    DetailedTimingNumber = Index - SupportedVideoModesFoundInEdid;
-
-    if (DetailedTimingNumber < EDID_NUMBER_OF_DETAILED_TIMINGS) {
-      if (ReadDetailedTiming (EDID, (UINT8)DetailedTimingNumber, &TmpVideoMode)) {
-        *VideoMode = &TmpVideoMode;
-        Status = EFI_SUCCESS;
-      }
+  // Then the detailed timings - ReadDetailedTiming returns the n'th valid one, so stop at the first miss
+  UINT8 DetailedTimingNumber;
+  for (DetailedTimingNumber = 0; DetailedTimingNumber < DISPLAYLINK_MAX_DETAILED_MODES; DetailedTimingNumber++) {
+    if (!ReadDetailedTiming (EDID, DetailedTimingNumber, &UsbDisplayLinkDev->DetailedVideoModes[DetailedTimingNumber])) {
+      break;
     }
+    UsbDisplayLinkDev->VideoModes[NumModes++] = &UsbDisplayLinkDev->DetailedVideoModes[DetailedTimingNumber];
   }
 
-  return Status;
+  // Special case - if we didn't find any matching video modes in the EDID, fall back to 640x480@60Hz
+  if (NumModes == 0) {
+    UsbDisplayLinkDev->VideoModes[NumModes++] = DlVideoModeGetSupportedVideoMode (0);
+    DEBUG ((DEBUG_WARN, "No video modes supported by driver found in monitor EDID received from DL device - falling back to %dx%d\n", UsbDisplayLinkDev->VideoModes[0]->HActive, UsbDisplayLinkDev->VideoModes[0]->VActive));
+  } else {
+    DEBUG ((DEBUG_INFO, "Found %d video modes supported by driver in monitor EDID.\n", NumModes));
+  }
+
+  UsbDisplayLinkDev->NumVideoModes = NumModes;
 }
 
 /**
- * Like GetSupportedEdidVideoMode, but will return a fallback fixed mode of 640x480@60Hz
- * for index 0 if no suitable modes found in EDID.
- * @param index
- * @param EDID
- * @param edidSize
- * @param videoMode
- * @return EFI_SUCCESS
- */
+Returns the (index)'th video mode offered by the device: one of the pre-calculated video timings that is
+also present in the EDID, or video mode data corresponding to one of the detailed timings in the EDID.
+The table is built once by DlReadEdid, so this is a direct lookup.
+
+@param  UsbDisplayLinkDev
+@param  index       The caller wants the _index_'th video mode
+@param  videoMode   Video timings extracted from the modeData structure
+@retval EFI_SUCCESS The requested mode is present in the EDID
+@retval EFI_INVALID_PARAMETER The requested mode is not present in the EDID
+**/
 EFI_STATUS
-DlEdidGetSupportedVideoModeWithFallback (
+DlEdidGetSupportedVideoMode (
+    IN USB_DISPLAYLINK_DEV *UsbDisplayLinkDev,
     IN UINT32 Index,
-    IN CONST VOID *EDID,
-    IN UINT32 EdidSize,
     OUT CONST struct VideoMode **VideoMode
     )
 {
-  EFI_STATUS Status;
-  Status = DlEdidGetSupportedVideoMode (Index, EDID, EdidSize, VideoMode);
-
-  if (EFI_ERROR (Status)) {
-    // Special case - if we didn't find any matching video modes in the EDID, fall back to 640x480@60Hz
-    if (Index == 0) {
-      *VideoMode = DlVideoModeGetSupportedVideoMode (0);
-      DEBUG ((DEBUG_WARN, "No video modes supported by driver found in monitor EDID received from DL device - falling back to %dx%d\n", (*VideoMode)->HActive, (*VideoMode)->VActive));
-      Status = EFI_SUCCESS;
-    }
+  if (Index >= UsbDisplayLinkDev->NumVideoModes) {
+    return EFI_INVALID_PARAMETER;
   }
 
-  return Status;
+  *VideoMode = UsbDisplayLinkDev->VideoModes[Index];
+  return EFI_SUCCESS;
 }
 
 /**
-Count the number of video modes that we have timing information for that are present in the EDID
-@param  EDID        Pointer to the 128-byte EDID
-@param  edidSize
+Count the number of video modes offered by the device
+@param  UsbDisplayLinkDev
 @retval             The number of modes in the EDID
 
 **/
 UINT32
 DlEdidGetNumSupportedModesInEdid (
-    IN CONST VOID *EDID,
-    IN UINT32 EdidSize
+    IN USB_DISPLAYLINK_DEV *UsbDisplayLinkDev
     )
 {
-  UINT32 MaxMode;
-
-  if ((EDID == NULL) || (EdidSize != EDID_BLOCK_SIZE)) {
-    return DlVideoModeGetNumSupportedVideoModes ();
-  }
-
-  for (MaxMode = 0; ; MaxMode++) {
-    CONST struct VideoMode *videoMode;
-    if (EFI_ERROR (DlEdidGetSupportedVideoMode (MaxMode, EDID, EdidSize, &videoMode))) {
-      break;
-    }
-  }
-  DEBUG ((DEBUG_INFO, "Found %d video modes supported by driver in monitor EDID.\n", MaxMode));
-  return MaxMode;
+  return UsbDisplayLinkDev->NumVideoModes;
 }
 
-
-
 /**
  * Read the EDID from the connected monitor, store it in the local data structure
+ * along with the table of video modes that it allows
  * @param UsbDisplayLinkDev
  * @retval EFI_OUT_OF_RESOURCES - Could not allocate memory
  * @retval EFI_SUCCESS
@@ -594,5 +560,8 @@ DlReadEdid (
   UsbDisplayLinkDev->EdidActive.SizeOfEdid = UsbDisplayLinkDev->EdidDiscovered.SizeOfEdid;
   UsbDisplayLinkDev->EdidActive.Edid = UsbDisplayLinkDev->EdidDiscovered.Edid;
 
+  // Parse it once, every later mode query is served from the table
+  BuildVideoModeTable (UsbDisplayLinkDev);
+
   return EFI_SUCCESS;
 }
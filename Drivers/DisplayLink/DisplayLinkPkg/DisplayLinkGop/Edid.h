@@ -17,6 +17,7 @@
 #define EDID_NUMBER_OF_ESTABLISHED_TIMINGS_BYTES  ((UINTN)3)
 #define EDID_NUMBER_OF_STANDARD_TIMINGS           ((UINTN)8)
 #define EDID_NUMBER_OF_DETAILED_TIMINGS           ((UINTN)4)
+#define EDID_MAX_LISTED_TIMINGS                   (EDID_NUMBER_OF_ESTABLISHED_TIMINGS_BYTES * 8 + EDID_NUMBER_OF_STANDARD_TIMINGS)
 
 
 typedef struct {
@@ -28,24 +29,14 @@ typedef struct {
 
 EFI_STATUS
 DlEdidGetSupportedVideoMode (
+    USB_DISPLAYLINK_DEV *UsbDisplayLinkDev,
     UINT32 ModeNumber,
-    CONST VOID *EDID,
-    UINT32 EdidSize,
-    CONST struct VideoMode **VideoMode
-    );
-
-EFI_STATUS
-DlEdidGetSupportedVideoModeWithFallback (
-    UINT32 ModeNumber,
-    CONST VOID *EDID,
-    UINT32 EdidSize,
     CONST struct VideoMode **VideoMode
     );
 
 UINT32
 DlEdidGetNumSupportedModesInEdid (
-    CONST VOID *EDID,
-    UINT32 EdidSize
+    USB_DISPLAYLINK_DEV *UsbDisplayLinkDev
     );
 
 EFI_STATUS
@@ -69,6 +69,108 @@ CheckBounds (
   return EFI_SUCCESS;
 }
 
+/**
+ * Area of the rectangle which would bound both A and B
+ * @param A
+ * @param B
+ * @return
+ */
+STATIC UINTN
+UnionArea (
+    IN CONST DISPLAYLINK_RECT* A,
+    IN CONST DISPLAYLINK_RECT* B
+    )
+{
+  return (MAX (A->X2, B->X2) - MIN (A->X1, B->X1)) * (MAX (A->Y2, B->Y2) - MIN (A->Y1, B->Y1));
+}
+
+/**
+ * Grow Dst so that it also bounds Src
+ * @param Dst
+ * @param Src
+ */
+STATIC VOID
+UnionRect (
+    IN OUT DISPLAYLINK_RECT* Dst,
+    IN CONST DISPLAYLINK_RECT* Src
+    )
+{
+  Dst->X1 = MIN (Dst->X1, Src->X1);
+  Dst->Y1 = MIN (Dst->Y1, Src->Y1);
+  Dst->X2 = MAX (Dst->X2, Src->X2);
+  Dst->Y2 = MAX (Dst->Y2, Src->Y2);
+}
+
+/**
+ * Record that an area of the screen has changed and needs to be sent in the next screen update.
+ * Overlapping or touching areas are merged, and once DISPLAYLINK_MAX_DIRTY_RECTS areas are tracked,
+ * a new area is merged into the one which grows the least by doing so.
+ * @param UsbDisplayLinkDev
+ * @param X
+ * @param Y
+ * @param Width
+ * @param Height
+ */
+STATIC VOID
+AddDirtyRect (
+    IN USB_DISPLAYLINK_DEV* UsbDisplayLinkDev,
+    IN UINTN X,
+    IN UINTN Y,
+    IN UINTN Width,
+    IN UINTN Height
+    )
+{
+  DISPLAYLINK_RECT* Rects;
+  DISPLAYLINK_RECT New;
+  UINTN Index;
+  UINTN Best;
+  UINTN Growth;
+  UINTN BestGrowth;
+  BOOLEAN Merged;
+
+  Rects = UsbDisplayLinkDev->DirtyRects;
+  New.X1 = X;
+  New.Y1 = Y;
+  New.X2 = X + Width;
+  New.Y2 = Y + Height;
+
+  // Absorb every tracked area which overlaps or touches the new one. Growing the new area may
+  // make it touch areas it didn't before, so keep going until nothing else can be absorbed.
+  do {
+    Merged = FALSE;
+    for (Index = 0; Index < UsbDisplayLinkDev->NumDirtyRects; Index++) {
+      if (Rects[Index].X1 <= New.X2 && New.X1 <= Rects[Index].X2 &&
+          Rects[Index].Y1 <= New.Y2 && New.Y1 <= Rects[Index].Y2) {
+        UnionRect (&New, &Rects[Index]);
+        Rects[Index] = Rects[--UsbDisplayLinkDev->NumDirtyRects];
+        Merged = TRUE;
+        break;
+      }
+    }
+  } while (Merged);
+
+  if (UsbDisplayLinkDev->NumDirtyRects < DISPLAYLINK_MAX_DIRTY_RECTS) {
+    Rects[UsbDisplayLinkDev->NumDirtyRects++] = New;
+    return;
+  }
+
+  // Out of slots: merge into the tracked area whose bounding box grows the least.
+  Best = 0;
+  BestGrowth = MAX_UINTN;
+  for (Index = 0; Index < UsbDisplayLinkDev->NumDirtyRects; Index++) {
+    Growth = UnionArea (&Rects[Index], &New) - (Rects[Index].X2 - Rects[Index].X1) * (Rects[Index].Y2 - Rects[Index].Y1);
+    if (Growth < BestGrowth) {
+      BestGrowth = Growth;
+      Best = Index;
+    }
+  }
+  UnionRect (&New, &Rects[Best]);
+  Rects[Best] = Rects[--UsbDisplayLinkDev->NumDirtyRects];
+
+  // The grown area may now overlap others, so add it again to merge those as well.
+  AddDirtyRect (UsbDisplayLinkDev, New.X1, New.Y1, New.X2 - New.X1, New.Y2 - New.Y1);
+}
+
 /**
  * Update the local copy of the Frame Buffer. This local copy is periodically transmitted to the
  * DisplayLink device (via DlGopSendScreenUpdate)
@@ -122,12 +224,7 @@ BuildBackBuffer (
   case EfiBltBufferToVideo:
   {
     // Update the store of the area of the screen that is "dirty" - that we need to send in the next screen update.
-    if (DestinationY < UsbDisplayLinkDev->LastY1) {
-      UsbDisplayLinkDev->LastY1 = DestinationY;
-    }
-    if ((DestinationY + Height) > UsbDisplayLinkDev->LastY2) {
-      UsbDisplayLinkDev->LastY2 = DestinationY + Height;
-    }
+    AddDirtyRect (UsbDisplayLinkDev, DestinationX, DestinationY, Width, Height);
 
     EFI_GRAPHICS_OUTPUT_BLT_PIXEL* Blt;
     EFI_GRAPHICS_OUTPUT_BLT_PIXEL* DstB;
@@ -146,6 +243,8 @@ BuildBackBuffer (
 
   case EfiBltVideoToVideo:
   {
+    AddDirtyRect (UsbDisplayLinkDev, DestinationX, DestinationY, Width, Height);
+
     EFI_GRAPHICS_OUTPUT_BLT_PIXEL* SrcB;
     EFI_GRAPHICS_OUTPUT_BLT_PIXEL* DstB;
     SrcB = UsbDisplayLinkDev->Screen + SourceY * PixelsPerScanLine + SourceX;
@@ -163,6 +262,8 @@ BuildBackBuffer (
 
   case EfiBltVideoFill:
   {
+    AddDirtyRect (UsbDisplayLinkDev, DestinationX, DestinationY, Width, Height);
+
     EFI_GRAPHICS_OUTPUT_BLT_PIXEL* DstB;
     DstB = UsbDisplayLinkDev->Screen + DestinationY * PixelsPerScanLine + DestinationX;
     for (H = 0; H < Height; H++) {
@@ -252,7 +353,12 @@ DlGopSendTestPattern (
 
 
 /**
- * Transfer the latest copy of the Blt buffer over USB to the DisplayLink device
+ * Transfer the latest copy of the Blt buffer over USB to the DisplayLink device.
+ *
+ * Screen and ScreenRgb act as two buffers: when a frame starts, the areas of Screen which have
+ * been BLTted to are converted into ScreenRgb, which is then sent DISPLAYLINK_FRAME_SLICE_LINES
+ * scanlines per call while further BLTs only touch Screen. UsbDisplayLinkDev->FrameInFlight is
+ * left set until the last slice of the frame has gone out.
  * @param UsbDisplayLinkDev
  * @return
  */
@@ -265,52 +371,69 @@ DlGopSendScreenUpdate (
   UINT32 USBStatus;
   Status = EFI_SUCCESS;
 
-  // If it has been a while since we sent an update, send a full screen.
-  // This allows us to update a hot-plugged monitor quickly.
-  if (UsbDisplayLinkDev->TimeSinceLastScreenUpdate > DISPLAYLINK_FULL_SCREEN_UPDATE_PERIOD) {
-    UsbDisplayLinkDev->LastY1 = 0;
-    UsbDisplayLinkDev->LastY2 = UsbDisplayLinkDev->GraphicsOutputProtocol.Mode->Info->HorizontalResolution - 1;
-  }
+  UINTN Width;
+  UINTN Height;
+  Width = UsbDisplayLinkDev->GraphicsOutputProtocol.Mode->Info->HorizontalResolution;
+  Height = UsbDisplayLinkDev->GraphicsOutputProtocol.Mode->Info->VerticalResolution;
 
-  // If there has been no BLT since the last update/poll, drop out quietly.
-  if (UsbDisplayLinkDev->LastY2 < UsbDisplayLinkDev->LastY1) {
-    UsbDisplayLinkDev->TimeSinceLastScreenUpdate += (DISPLAYLINK_SCREEN_UPDATE_TIMER_PERIOD / 1000);  // Convert us to ms
-    return EFI_SUCCESS;
-  }
+  if (!UsbDisplayLinkDev->FrameInFlight) {
+    // If it has been a while since we sent an update, send a full screen.
+    // This allows us to update a hot-plugged monitor quickly.
+    if (UsbDisplayLinkDev->TimeSinceLastScreenUpdate > DISPLAYLINK_FULL_SCREEN_UPDATE_PERIOD) {
+      AddDirtyRect (UsbDisplayLinkDev, 0, 0, Width, Height);
+    }
 
-  UsbDisplayLinkDev->TimeSinceLastScreenUpdate = 0;
+    // If there has been no BLT since the last update/poll, drop out quietly.
+    if (UsbDisplayLinkDev->NumDirtyRects == 0) {
+      UsbDisplayLinkDev->TimeSinceLastScreenUpdate += (DISPLAYLINK_SCREEN_UPDATE_TIMER_PERIOD / 1000);  // Convert us to ms
+      return EFI_SUCCESS;
+    }
+
+    UsbDisplayLinkDev->TimeSinceLastScreenUpdate = 0;
+  }
 
   EFI_TPL OriginalTPL = gBS->RaiseTPL (TPL_NOTIFY);
 
   UINTN DataLen;
-  UINTN Width;
-  UINTN Height;
   EFI_GRAPHICS_OUTPUT_BLT_PIXEL* SrcPtr;
   UINT8* DstPtr;
-  UINT8 DstBuffer[1920 * 3]; // Get rid of the magic numbers at some point
-                             // Could also use a buffer allocated at runtime to store the line, stored in the USB_DISPLAYLINK_DEV structure.
+  UINT8* LinePtr;
+  UINTN Index;
+  UINTN LinesSent;
   UINTN H;
+  UINTN W;
 
-  DataLen = UsbDisplayLinkDev->GraphicsOutputProtocol.Mode->Info->HorizontalResolution * 3; // Send 1 line @ 24 bits per pixel
-  Width = UsbDisplayLinkDev->GraphicsOutputProtocol.Mode->Info->HorizontalResolution;
-  Height = UsbDisplayLinkDev->GraphicsOutputProtocol.Mode->Info->VerticalResolution;
-  SrcPtr = UsbDisplayLinkDev->Screen;
-  DstPtr = DstBuffer;
-
-  for (H = 0; H < Height; H++) {
-    DstPtr = DstBuffer;
-
-    UINTN W;
-    for (W = 0; W < Width; W++) {
-      // Need to swap round the RGB values
-      DstPtr[0] = ((UINT8 *)SrcPtr)[2];
-      DstPtr[1] = ((UINT8 *)SrcPtr)[1];
-      DstPtr[2] = ((UINT8 *)SrcPtr)[0];
-      SrcPtr++;
-      DstPtr += 3;
+  DataLen = Width * 3; // Send 1 line @ 24 bits per pixel
+
+  if (!UsbDisplayLinkDev->FrameInFlight) {
+    // Only the areas which have been BLTted to need converting to the wire format; the rest of
+    // ScreenRgb is still current from previous updates.
+    for (Index = 0; Index < UsbDisplayLinkDev->NumDirtyRects; Index++) {
+      CONST DISPLAYLINK_RECT* Rect = &UsbDisplayLinkDev->DirtyRects[Index];
+      for (H = Rect->Y1; H < Rect->Y2; H++) {
+        SrcPtr = UsbDisplayLinkDev->Screen + H * Width + Rect->X1;
+        DstPtr = UsbDisplayLinkDev->ScreenRgb + (H * Width + Rect->X1) * 3;
+        for (W = Rect->X1; W < Rect->X2; W++) {
+          // Need to swap round the RGB values
+          DstPtr[0] = ((UINT8 *)SrcPtr)[2];
+          DstPtr[1] = ((UINT8 *)SrcPtr)[1];
+          DstPtr[2] = ((UINT8 *)SrcPtr)[0];
+          SrcPtr++;
+          DstPtr += 3;
+        }
+      }
     }
+    UsbDisplayLinkDev->NumDirtyRects = 0;
+    UsbDisplayLinkDev->FrameInFlight = TRUE;
+    UsbDisplayLinkDev->FrameLine = 0;
+  }
 
-    Status = DlUsbBulkWrite (UsbDisplayLinkDev, DstBuffer, DataLen, &USBStatus);
+  // The direct framebuffer interface has no way of addressing part of the screen: each bulk
+  // transfer is the next scanline of the frame, so the whole frame still has to go out.
+  LinePtr = UsbDisplayLinkDev->ScreenRgb + UsbDisplayLinkDev->FrameLine * DataLen;
+  for (LinesSent = 0; LinesSent < DISPLAYLINK_FRAME_SLICE_LINES && UsbDisplayLinkDev->FrameLine < Height; LinesSent++) {
+    H = UsbDisplayLinkDev->FrameLine;
+    Status = DlUsbBulkWrite (UsbDisplayLinkDev, LinePtr, DataLen, &USBStatus);
 
     // USBStatus values defined in usbio.h, e.g. EFI_USB_ERR_TIMEOUT 0x40
     if (EFI_ERROR (Status)) {
@@ -320,24 +443,27 @@ DlGopSendScreenUpdate (
     // Need an extra DlUsbBulkWrite if the data length is divisible by USB MaxPacketSize. This spare data will just get written into the (invisible) stride area.
     // Note that the API doesn't let us do a bulk write of 0.
     if ((DataLen & (UsbDisplayLinkDev->BulkOutEndpointDescriptor.MaxPacketSize - 1)) == 0) {
-      Status = DlUsbBulkWrite (UsbDisplayLinkDev, DstBuffer, 2, &USBStatus);
+      Status = DlUsbBulkWrite (UsbDisplayLinkDev, LinePtr, 2, &USBStatus);
       if (EFI_ERROR (Status)) {
         DEBUG ((DEBUG_ERROR, "Screen update - USB bulk transfer of pixel data failed. Line %d len %d, failure code %r USB status x%x\n", H, DataLen, Status, USBStatus));
         break;
       }
     }
+    LinePtr += DataLen;
+    UsbDisplayLinkDev->FrameLine++;
   }
 
-  if (!EFI_ERROR (Status)) {
-    // If we've successfully transmitted the frame, reset the values that store which area of the screen has been BLTted to.
-    // If we haven't succeeded, this will mean we'll try to resend it after the next poll period.
-    UsbDisplayLinkDev->LastY2 = 0;
-    UsbDisplayLinkDev->LastY1 = (UINTN)-1;
+  if (EFI_ERROR (Status)) {
+    // If we haven't succeeded, mark the screen dirty again so that we'll try to resend it after the next poll period.
+    AddDirtyRect (UsbDisplayLinkDev, 0, 0, Width, Height);
   }
 
-  // Payload with length of 1 to terminate the frame
-  // We need to do this even if we had an error, to indicate to the DL device that it should now expect a new frame.
-  DlUsbBulkWrite (UsbDisplayLinkDev, DstBuffer, 1, &USBStatus);
+  if (EFI_ERROR (Status) || UsbDisplayLinkDev->FrameLine == Height) {
+    // Payload with length of 1 to terminate the frame
+    // We need to do this even if we had an error, to indicate to the DL device that it should now expect a new frame.
+    DlUsbBulkWrite (UsbDisplayLinkDev, UsbDisplayLinkDev->ScreenRgb, 1, &USBStatus);
+    UsbDisplayLinkDev->FrameInFlight = FALSE;
+  }
 
   gBS->RestoreTPL (OriginalTPL);
 
@@ -404,7 +530,7 @@ DisplayLinkQueryMode (
   }
 
   // Get a video mode from the EDID
-  Status = DlEdidGetSupportedVideoModeWithFallback (ModeNumber, Dev->EdidActive.Edid, Dev->EdidActive.SizeOfEdid, &VideoMode);
+  Status = DlEdidGetSupportedVideoMode (Dev, ModeNumber, &VideoMode);
 
   if (!EFI_ERROR (Status)) {
 
@@ -455,7 +581,7 @@ DisplayLinkSetMode (
   Gop->Mode->Mode = GRAPHICS_OUTPUT_INVALID_MODE_NUMBER;
 
   // Get a video mode from the EDID
-  Status = DlEdidGetSupportedVideoModeWithFallback (ModeNumber, UsbDisplayLinkDev->EdidActive.Edid, UsbDisplayLinkDev->EdidActive.SizeOfEdid, &VideoMode);
+  Status = DlEdidGetSupportedVideoMode (UsbDisplayLinkDev, ModeNumber, &VideoMode);
 
   if (EFI_ERROR (Status)) {
     return Status;
@@ -476,13 +602,33 @@ DisplayLinkSetMode (
   if (UsbDisplayLinkDev->Screen != NULL) {
     FreePool (UsbDisplayLinkDev->Screen);
   }
+  if (UsbDisplayLinkDev->ScreenRgb != NULL) {
+    FreePool (UsbDisplayLinkDev->ScreenRgb);
+  }
+  // Forget any areas tracked for the previous mode - they may fall outside of the new one - and
+  // abandon any frame which was being sent in the old mode.
+  UsbDisplayLinkDev->NumDirtyRects = 0;
+  UsbDisplayLinkDev->FrameInFlight = FALSE;
 
   UsbDisplayLinkDev->Screen = (EFI_GRAPHICS_OUTPUT_BLT_PIXEL*)AllocateZeroPool (
     Gop->Mode->Info->HorizontalResolution *
     Gop->Mode->Info->VerticalResolution *
     sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL));
 
-  if (UsbDisplayLinkDev->Screen == NULL) {
+  // Back buffer in the format sent to the device: 24 bits per pixel
+  UsbDisplayLinkDev->ScreenRgb = (UINT8*)AllocateZeroPool (
+    Gop->Mode->Info->HorizontalResolution *
+    Gop->Mode->Info->VerticalResolution * 3);
+
+  if (UsbDisplayLinkDev->Screen == NULL || UsbDisplayLinkDev->ScreenRgb == NULL) {
+    if (UsbDisplayLinkDev->Screen != NULL) {
+      FreePool (UsbDisplayLinkDev->Screen);
+      UsbDisplayLinkDev->Screen = NULL;
+    }
+    if (UsbDisplayLinkDev->ScreenRgb != NULL) {
+      FreePool (UsbDisplayLinkDev->ScreenRgb);
+      UsbDisplayLinkDev->ScreenRgb = NULL;
+    }
     return EFI_OUT_OF_RESOURCES;
   }
 
@@ -496,6 +642,8 @@ DisplayLinkSetMode (
     Gop->Mode->Mode = GRAPHICS_OUTPUT_INVALID_MODE_NUMBER;
     FreePool (UsbDisplayLinkDev->Screen);
     UsbDisplayLinkDev->Screen = NULL;
+    FreePool (UsbDisplayLinkDev->ScreenRgb);
+    UsbDisplayLinkDev->ScreenRgb = NULL;
   } else {
     BuildBackBuffer (
       UsbDisplayLinkDev,
@@ -144,7 +144,7 @@ InitializeUsbDisplayLinkDevice (
     return EFI_OUT_OF_RESOURCES;
   }
 
-  Gop->Mode->MaxMode = MAX(1, DlEdidGetNumSupportedModesInEdid (UsbDisplayLinkDev->EdidActive.Edid, UsbDisplayLinkDev->EdidActive.SizeOfEdid));
+  Gop->Mode->MaxMode = MAX(1, DlEdidGetNumSupportedModesInEdid (UsbDisplayLinkDev));
 
   Gop->Mode->Mode = GRAPHICS_OUTPUT_INVALID_MODE_NUMBER;
   Gop->Mode->Info->Version = 0;
@@ -159,8 +159,8 @@ InitializeUsbDisplayLinkDevice (
   Gop->Mode->FrameBufferSize = 0;
 
   // Prevent DlGopSendScreenUpdate from running until we are sure that the video mode is set
-  UsbDisplayLinkDev->LastY2 = 0;
-  UsbDisplayLinkDev->LastY1 = (UINTN)-1;
+  UsbDisplayLinkDev->NumDirtyRects = 0;
+  UsbDisplayLinkDev->FrameInFlight = FALSE;
 
   return EFI_SUCCESS;
 }
@@ -528,32 +528,39 @@ DisplayLinkPeriodicTimer (
   DisplayLinkCopyFromPrimaryGopDevice (UsbDisplayLinkDev);
 #endif // COPY_PIXELS_FROM_PRIMARY_GOP_DEVICE
 
-  if (UsbDisplayLinkDev->ShowBandwidth) {
-    STATIC UINTN Count = 0;
+  // These only run between frames: the test pattern is a frame of its own, and the bandwidth counter
+  // counts screen update periods, not frame slices.
+  if (!UsbDisplayLinkDev->FrameInFlight) {
+    if (UsbDisplayLinkDev->ShowBandwidth) {
+      STATIC UINTN Count = 0;
 
-    if (Count++ % 50 == 0) {
-      DlGopPrintTextToScreen (&UsbDisplayLinkDev->GraphicsOutputProtocol, 32, 48, (CONST CHAR16*)L"  Bandwidth: %d MB/s    ", UsbDisplayLinkDev->DataSent * 10000000 / DISPLAYLINK_SCREEN_UPDATE_TIMER_PERIOD / 50 / 1024 / 1024);
-      UsbDisplayLinkDev->DataSent = 0;
+      if (Count++ % 50 == 0) {
+        DlGopPrintTextToScreen (&UsbDisplayLinkDev->GraphicsOutputProtocol, 32, 48, (CONST CHAR16*)L"  Bandwidth: %d MB/s    ", UsbDisplayLinkDev->DataSent * 10000000 / DISPLAYLINK_SCREEN_UPDATE_TIMER_PERIOD / 50 / 1024 / 1024);
+        UsbDisplayLinkDev->DataSent = 0;
+      }
     }
-  }
 
-  if (UsbDisplayLinkDev->ShowTestPattern)
-  {
-    if (UsbDisplayLinkDev->ShowTestPattern == 5) {
-      DlGopSendTestPattern (UsbDisplayLinkDev, 0);
-    } else if (UsbDisplayLinkDev->ShowTestPattern >= 10) {
-      DlGopSendTestPattern (UsbDisplayLinkDev, 1);
-      UsbDisplayLinkDev->ShowTestPattern = 0;
-    }
-    UsbDisplayLinkDev->ShowTestPattern++;
+    if (UsbDisplayLinkDev->ShowTestPattern)
+    {
+      if (UsbDisplayLinkDev->ShowTestPattern == 5) {
+        DlGopSendTestPattern (UsbDisplayLinkDev, 0);
+      } else if (UsbDisplayLinkDev->ShowTestPattern >= 10) {
+        DlGopSendTestPattern (UsbDisplayLinkDev, 1);
+        UsbDisplayLinkDev->ShowTestPattern = 0;
+      }
+      UsbDisplayLinkDev->ShowTestPattern++;
 
+    }
   }
 
-  // Send the latest version of the frame buffer to the DL device over USB
+  // Send the latest version of the frame buffer (or the next slice of it) to the DL device over USB
   DlGopSendScreenUpdate (UsbDisplayLinkDev);
 
-  // Restart the timer now we've finished
-  Status = gBS->SetTimer (UsbDisplayLinkDev->TimerEvent, TimerRelative, DISPLAYLINK_SCREEN_UPDATE_TIMER_PERIOD);
+  // Restart the timer now we've finished. Come back quickly if there is more of the frame to send.
+  Status = gBS->SetTimer (
+                  UsbDisplayLinkDev->TimerEvent,
+                  TimerRelative,
+                  UsbDisplayLinkDev->FrameInFlight ? DISPLAYLINK_FRAME_SLICE_TIMER_PERIOD : DISPLAYLINK_SCREEN_UPDATE_TIMER_PERIOD);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "Failed to create timer.\n"));
   }
@@ -1065,6 +1072,11 @@ UsbDisplayLinkDriverBindingStop (
     UsbDisplayLinkDev->Screen = NULL;
   }
 
+  if (UsbDisplayLinkDev->ScreenRgb != NULL) {
+    FreePool (UsbDisplayLinkDev->ScreenRgb);
+    UsbDisplayLinkDev->ScreenRgb = NULL;
+  }
+
   if (UsbDisplayLinkDev->GraphicsOutputProtocol.Mode) {
     if (UsbDisplayLinkDev->GraphicsOutputProtocol.Mode->Info) {
       FreePool (UsbDisplayLinkDev->GraphicsOutputProtocol.Mode->Info);
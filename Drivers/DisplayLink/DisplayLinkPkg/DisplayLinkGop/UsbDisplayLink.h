@@ -42,6 +42,11 @@
 #define DISPLAYLINK_SCREEN_UPDATE_TIMER_PERIOD  ((UINTN)1000000) // 0.1s in us
 #define DISPLAYLINK_FULL_SCREEN_UPDATE_PERIOD   ((UINTN)30000) // 3s in ticks
 
+// A frame is sent in slices of this many scanlines, one slice per timer tick, so that the boot
+// flow keeps running while a frame goes out. The next slice is due after the slice timer period.
+#define DISPLAYLINK_FRAME_SLICE_LINES           ((UINTN)64)
+#define DISPLAYLINK_FRAME_SLICE_TIMER_PERIOD    ((UINTN)10000) // 1ms in 100ns units
+
 #define DISPLAYLINK_FIXED_VERTICAL_REFRESH_RATE ((UINT16)60)
 
 // Requests to read values from the firmware
@@ -65,33 +70,24 @@ typedef struct {
 
 #define GRAPHICS_OUTPUT_INVALID_MODE_NUMBER 0xffff
 
+// Maximum number of separate areas of the screen tracked as changed between two screen updates.
+// Further changes are merged into the closest of these bounding boxes.
+#define DISPLAYLINK_MAX_DIRTY_RECTS 4
+
+// Size of the per-device table of video modes offered through GOP: the pre-calculated modes
+// also found in the monitor EDID, followed by the detailed timings of the EDID.
+#define DISPLAYLINK_MAX_DETAILED_MODES  ((UINTN)4)
+#define DISPLAYLINK_MAX_VIDEO_MODES     ((UINTN)24)
+
 /**
- *  Device instance of USB display.
+ *  Area of the screen which has changed since the last screen update. X2 and Y2 are exclusive.
  */
 typedef struct {
-  UINT64                        Signature;
-  EFI_HANDLE                    Handle;
-  EFI_USB_IO_PROTOCOL           *UsbIo;
-  EFI_USB_INTERFACE_DESCRIPTOR  InterfaceDescriptor;
-  EFI_USB_ENDPOINT_DESCRIPTOR   BulkOutEndpointDescriptor;
-  EFI_USB_ENDPOINT_DESCRIPTOR   BulkInEndpointDescriptor;
-  EFI_GRAPHICS_OUTPUT_PROTOCOL  GraphicsOutputProtocol;
-  EFI_EDID_DISCOVERED_PROTOCOL  EdidDiscovered;
-  EFI_EDID_ACTIVE_PROTOCOL      EdidActive;
-  EFI_UNICODE_STRING_TABLE      *ControllerNameTable;
-  EFI_GRAPHICS_OUTPUT_BLT_PIXEL *Screen;
-  UINTN                         DataSent;                       /** Debug - used to track the bandwidth */
-  EFI_EVENT                     TimerEvent;
-  EFI_EVENT                     DriverExitBootServicesEvent;
-  BOOLEAN                       ShowBandwidth;                 /** Debugging - show the bandwidth on the screen */
-  BOOLEAN                       ShowTestPattern;               /** Show a colourbar pattern instead of the BLTd contents of the framebuffer */
-  UINTN                         LastY1;                        /** Used to track if we can do a partial screen update */
-  UINTN                         LastY2;
-  UINTN                         LastWidth;
-  UINTN                         TimeSinceLastScreenUpdate;     /** Do a full screen update every (x) seconds */
-} USB_DISPLAYLINK_DEV;
-
-#define USB_DISPLAYLINK_DEV_SIGNATURE SIGNATURE_32 ('d', 'l', 'i', 'n')
+  UINTN                      X1;
+  UINTN                      Y1;
+  UINTN                      X2;
+  UINTN                      Y2;
+} DISPLAYLINK_RECT;
 
 struct VideoMode {
   UINT8  Reserved1;          /* Reserved - must be 0. */
@@ -124,6 +120,39 @@ struct VideoMode {
   UINT16 Reserved6;
 };
 
+/**
+ *  Device instance of USB display.
+ */
+typedef struct {
+  UINT64                        Signature;
+  EFI_HANDLE                    Handle;
+  EFI_USB_IO_PROTOCOL           *UsbIo;
+  EFI_USB_INTERFACE_DESCRIPTOR  InterfaceDescriptor;
+  EFI_USB_ENDPOINT_DESCRIPTOR   BulkOutEndpointDescriptor;
+  EFI_USB_ENDPOINT_DESCRIPTOR   BulkInEndpointDescriptor;
+  EFI_GRAPHICS_OUTPUT_PROTOCOL  GraphicsOutputProtocol;
+  EFI_EDID_DISCOVERED_PROTOCOL  EdidDiscovered;
+  EFI_EDID_ACTIVE_PROTOCOL      EdidActive;
+  CONST struct VideoMode        *VideoModes[DISPLAYLINK_MAX_VIDEO_MODES]; /** GOP mode number -> timings, built once from EdidActive */
+  UINT32                        NumVideoModes;
+  struct VideoMode              DetailedVideoModes[DISPLAYLINK_MAX_DETAILED_MODES]; /** Timings decoded from the EDID detailed timings */
+  EFI_UNICODE_STRING_TABLE      *ControllerNameTable;
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL *Screen;
+  UINT8                         *ScreenRgb;                     /** Copy of Screen in the 24bpp wire format, only converted where dirty */
+  UINTN                         DataSent;                       /** Debug - used to track the bandwidth */
+  EFI_EVENT                     TimerEvent;
+  EFI_EVENT                     DriverExitBootServicesEvent;
+  BOOLEAN                       ShowBandwidth;                 /** Debugging - show the bandwidth on the screen */
+  BOOLEAN                       ShowTestPattern;               /** Show a colourbar pattern instead of the BLTd contents of the framebuffer */
+  DISPLAYLINK_RECT              DirtyRects[DISPLAYLINK_MAX_DIRTY_RECTS]; /** Areas BLTted to since the last screen update */
+  UINTN                         NumDirtyRects;
+  BOOLEAN                       FrameInFlight;                 /** ScreenRgb is being sent; BLTs only go to Screen until it's done */
+  UINTN                         FrameLine;                     /** Next scanline of ScreenRgb to send */
+  UINTN                         TimeSinceLastScreenUpdate;     /** Do a full screen update every (x) seconds */
+} USB_DISPLAYLINK_DEV;
+
+#define USB_DISPLAYLINK_DEV_SIGNATURE SIGNATURE_32 ('d', 'l', 'i', 'n')
+
 #define USB_DISPLAYLINK_DEV_FROM_GRAPHICS_OUTPUT_PROTOCOL(a) \
   CR(a, USB_DISPLAYLINK_DEV, GraphicsOutputProtocol, USB_DISPLAYLINK_DEV_SIGNATURE)
 
@@ -7,12 +7,56 @@
 **/
 
 #include <Uefi.h>
+#include <Protocol/ShellParameters.h>
 #include <Library/BltLib.h>
 #include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
 #include <Library/UefiLib.h>
 #include <Library/UefiApplicationEntryPoint.h>
 #include <Library/UefiBootServicesTableLib.h>
 
+//
+// Each benchmark case is repeated until it has run for this long
+//
+#define BENCHMARK_MIN_TIME_US   100000
+
+//
+// Height of a GraphicsConsole text row, the unit the console scrolls by
+//
+#define BENCHMARK_TEXT_ROW      19
+
+typedef struct {
+  UINTN  Width;             // 0 means the full screen width
+  UINTN  Height;            // 0 means the full screen height
+} BENCHMARK_SIZE;
+
+typedef struct {
+  EFI_GRAPHICS_OUTPUT_BLT_OPERATION  Operation;
+  CHAR16                             *Name;
+} BENCHMARK_OPERATION;
+
+STATIC CONST BENCHMARK_SIZE  mBenchmarkSizes[] = {
+  { 1,   1   },
+  { 8,   19  },           // one text glyph
+  { 64,  64  },
+  { 256, 256 },
+  { 0,   16  },           // full width band
+  { 0,   0   }            // full screen
+};
+
+//
+// Offsets of the rectangle from the left edge of the screen, to show how
+// sensitive each path is to the alignment of the pixels it touches
+//
+STATIC CONST UINTN  mBenchmarkXOffsets[] = { 0, 1, 3 };
+
+STATIC CONST BENCHMARK_OPERATION  mBenchmarkOperations[] = {
+  { EfiBltVideoFill,        L"VideoFill"        },
+  { EfiBltVideoToBltBuffer, L"VideoToBltBuffer" },
+  { EfiBltBufferToVideo,    L"BufferToVideo"    },
+  { EfiBltVideoToVideo,     L"VideoToVideo"     }
+};
+
 
 UINT64
 ReadTimestamp (
@@ -233,10 +277,259 @@ TestColor (
 }
 
 
+/**
+  Work out how many timestamp ticks there are per second.
+
+  @return Timestamp frequency in Hz.
+
+**/
+UINT64
+GetTimestampFrequency (
+  VOID
+  )
+{
+  UINT64  Start;
+
+  Start = ReadTimestamp ();
+  gBS->Stall (BENCHMARK_MIN_TIME_US);
+  return DivU64x32 (
+           MultU64x32 (ReadTimestamp () - Start, 1000000),
+           BENCHMARK_MIN_TIME_US
+           );
+}
+
+
+/**
+  Time one Blt operation on one rectangle, and print the result as a CSV line.
+
+  Video to video copies move the rectangle up from the bottom of the screen,
+  so they overlap their source once the rectangle is over half the screen
+  high, like a console scroll does.
+
+  @param[in] Gop            The Graphics Output Protocol to benchmark.
+  @param[in] BltBuffer      Buffer the size of the screen, for the operations that need one.
+  @param[in] Operation      The operation to time.
+  @param[in] Name           Name of the operation, for the output.
+  @param[in] X              Left edge of the rectangle on the screen.
+  @param[in] Width          Width of the rectangle.
+  @param[in] Height         Height of the rectangle.
+  @param[in] SourceY        Where video to video copies are made from.
+  @param[in] Frequency      The timestamp frequency.
+
+**/
+VOID
+BenchmarkBlt (
+  IN EFI_GRAPHICS_OUTPUT_PROTOCOL       *Gop,
+  IN EFI_GRAPHICS_OUTPUT_BLT_PIXEL      *BltBuffer,
+  IN EFI_GRAPHICS_OUTPUT_BLT_OPERATION  Operation,
+  IN CHAR16                             *Name,
+  IN UINTN                              X,
+  IN UINTN                              Width,
+  IN UINTN                              Height,
+  IN UINTN                              SourceY,
+  IN UINT64                             Frequency
+  )
+{
+  EFI_STATUS                     Status;
+  UINTN                          Delta;
+  UINTN                          Iterations;
+  UINT64                         Start;
+  UINT64                         Elapsed;
+  UINT64                         MinElapsed;
+  UINT64                         PixelsPerSecond;
+  UINT64                         Microseconds;
+
+  Delta = Gop->Mode->Info->HorizontalResolution * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL);
+  MinElapsed = DivU64x32 (MultU64x32 (Frequency, BENCHMARK_MIN_TIME_US), 1000000);
+
+  Iterations = 0;
+  Start = ReadTimestamp ();
+  do {
+    Status = Gop->Blt (
+                    Gop,
+                    BltBuffer,
+                    Operation,
+                    (Operation == EfiBltVideoToVideo) ? X : 0,
+                    (Operation == EfiBltVideoToVideo) ? SourceY : 0,
+                    X,
+                    0,
+                    Width,
+                    Height,
+                    Delta
+                    );
+    if (EFI_ERROR (Status)) {
+      Print (L"%d,%d,%s,%d,%d,%d,error %r\n",
+        Gop->Mode->Info->HorizontalResolution, Gop->Mode->Info->VerticalResolution,
+        Name, Width, Height, X, Status);
+      return;
+    }
+    Iterations++;
+    Elapsed = ReadTimestamp () - Start;
+  } while (Elapsed < MinElapsed);
+
+  PixelsPerSecond = DivU64x64Remainder (
+                      MultU64x64 (MultU64x32 (Width * Height, (UINT32) Iterations), Frequency),
+                      Elapsed,
+                      NULL
+                      );
+  Microseconds = DivU64x64Remainder (MultU64x32 (Elapsed, 1000000), Frequency, NULL);
+
+  //
+  // Rates are printed in MPixel/s with two decimals
+  //
+  PixelsPerSecond = DivU64x32 (PixelsPerSecond, 10000);
+  Print (L"%d,%d,%s,%d,%d,%d,%d,%ld,%ld.%02ld\n",
+    Gop->Mode->Info->HorizontalResolution, Gop->Mode->Info->VerticalResolution,
+    Name, Width, Height, X, Iterations, Microseconds,
+    DivU64x32 (PixelsPerSecond, 100), ModU64x32 (PixelsPerSecond, 100));
+}
+
+
+/**
+  Time every Blt operation across the benchmark rectangle sizes and
+  alignments in the current mode.
+
+  @param[in] Gop            The Graphics Output Protocol to benchmark.
+  @param[in] Frequency      The timestamp frequency.
+
+  @retval EFI_SUCCESS           The benchmark ran.
+  @retval EFI_OUT_OF_RESOURCES  The Blt buffer couldn't be allocated.
+
+**/
+EFI_STATUS
+BenchmarkMode (
+  IN EFI_GRAPHICS_OUTPUT_PROTOCOL  *Gop,
+  IN UINT64                        Frequency
+  )
+{
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL  *BltBuffer;
+  UINTN                          ScreenWidth;
+  UINTN                          ScreenHeight;
+  UINTN                          Index;
+  UINTN                          SizeIndex;
+  UINTN                          OffsetIndex;
+  UINTN                          OperationIndex;
+  UINTN                          X;
+  UINTN                          Width;
+  UINTN                          Height;
+
+  ScreenWidth  = Gop->Mode->Info->HorizontalResolution;
+  ScreenHeight = Gop->Mode->Info->VerticalResolution;
+
+  BltBuffer = AllocatePool (ScreenWidth * ScreenHeight * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL));
+  if (BltBuffer == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+  for (Index = 0; Index < ScreenWidth * ScreenHeight; Index++) {
+    *(UINT32 *) &BltBuffer[Index] = (UINT32) (Index * 0x010203) & 0xffffff;
+  }
+
+  for (OperationIndex = 0; OperationIndex < ARRAY_SIZE (mBenchmarkOperations); OperationIndex++) {
+    for (SizeIndex = 0; SizeIndex < ARRAY_SIZE (mBenchmarkSizes); SizeIndex++) {
+      for (OffsetIndex = 0; OffsetIndex < ARRAY_SIZE (mBenchmarkXOffsets); OffsetIndex++) {
+        X      = mBenchmarkXOffsets[OffsetIndex];
+        Width  = (mBenchmarkSizes[SizeIndex].Width == 0) ? ScreenWidth : mBenchmarkSizes[SizeIndex].Width;
+        Height = (mBenchmarkSizes[SizeIndex].Height == 0) ? ScreenHeight : mBenchmarkSizes[SizeIndex].Height;
+        if (X + Width > ScreenWidth) {
+          //
+          // Full width rectangles can only be placed at the left edge
+          //
+          if (X != 0) {
+            continue;
+          }
+          Width = ScreenWidth;
+        }
+        Height = MIN (Height, ScreenHeight);
+
+        BenchmarkBlt (
+          Gop,
+          BltBuffer,
+          mBenchmarkOperations[OperationIndex].Operation,
+          mBenchmarkOperations[OperationIndex].Name,
+          X,
+          Width,
+          Height,
+          ScreenHeight - Height,
+          Frequency
+          );
+      }
+    }
+  }
+
+  //
+  // The case that matters most for console output: scrolling up by one text row
+  //
+  if (ScreenHeight > BENCHMARK_TEXT_ROW) {
+    BenchmarkBlt (
+      Gop,
+      BltBuffer,
+      EfiBltVideoToVideo,
+      L"Scroll",
+      0,
+      ScreenWidth,
+      ScreenHeight - BENCHMARK_TEXT_ROW,
+      BENCHMARK_TEXT_ROW,
+      Frequency
+      );
+  }
+
+  FreePool (BltBuffer);
+  return EFI_SUCCESS;
+}
+
+
+/**
+  Time the Blt operations of the console's Graphics Output Protocol and print
+  the results in CSV.
+
+  @param[in] Gop            The Graphics Output Protocol to benchmark.
+  @param[in] AllModes       Benchmark every mode rather than just the current one.
+
+  @retval EFI_SUCCESS       The benchmark ran.
+  @retval other             A mode couldn't be set, or memory couldn't be allocated.
+
+**/
+EFI_STATUS
+Benchmark (
+  IN EFI_GRAPHICS_OUTPUT_PROTOCOL  *Gop,
+  IN BOOLEAN                       AllModes
+  )
+{
+  EFI_STATUS                     Status;
+  UINT64                         Frequency;
+  UINT32                         OriginalMode;
+  UINT32                         Mode;
+
+  Frequency = GetTimestampFrequency ();
+  OriginalMode = Gop->Mode->Mode;
+
+  Print (L"ScreenWidth,ScreenHeight,Operation,Width,Height,X,Iterations,Microseconds,MPixelsPerSecond\n");
+
+  if (!AllModes) {
+    return BenchmarkMode (Gop, Frequency);
+  }
+
+  Status = EFI_SUCCESS;
+  for (Mode = 0; Mode < Gop->Mode->MaxMode && !EFI_ERROR (Status); Mode++) {
+    Status = Gop->SetMode (Gop, Mode);
+    if (!EFI_ERROR (Status)) {
+      Status = BenchmarkMode (Gop, Frequency);
+    }
+  }
+
+  Gop->SetMode (Gop, OriginalMode);
+  return Status;
+}
+
+
 /**
   The user Entry Point for Application. The user code starts with this function
   as the real entry point for the application.
 
+  Without arguments it draws the BltLib test patterns. With -b it benchmarks
+  the console's Graphics Output Protocol instead, and with -b -a it does so in
+  every mode the protocol supports.
+
   @param[in] ImageHandle    The firmware allocated handle for the EFI image.
   @param[in] SystemTable    A pointer to the EFI System Table.
 
@@ -253,6 +546,10 @@ UefiMain (
 {
   EFI_STATUS                     Status;
   EFI_GRAPHICS_OUTPUT_PROTOCOL   *Gop;
+  EFI_SHELL_PARAMETERS_PROTOCOL  *ShellParameters;
+  BOOLEAN                        RunBenchmark;
+  BOOLEAN                        AllModes;
+  UINTN                          Index;
 
   Status = gBS->HandleProtocol (
                   gST->ConsoleOutHandle,
@@ -263,6 +560,27 @@ UefiMain (
     return Status;
   }
 
+  RunBenchmark = FALSE;
+  AllModes     = FALSE;
+  Status = gBS->HandleProtocol (
+                  ImageHandle,
+                  &gEfiShellParametersProtocolGuid,
+                  (VOID **) &ShellParameters
+                  );
+  if (!EFI_ERROR (Status)) {
+    for (Index = 1; Index < ShellParameters->Argc; Index++) {
+      if (StrCmp (ShellParameters->Argv[Index], L"-b") == 0) {
+        RunBenchmark = TRUE;
+      } else if (StrCmp (ShellParameters->Argv[Index], L"-a") == 0) {
+        AllModes = TRUE;
+      }
+    }
+  }
+
+  if (RunBenchmark) {
+    return Benchmark (Gop, AllModes);
+  }
+
   Status = BltLibConfigure (
              (VOID*)(UINTN) Gop->Mode->FrameBufferBase,
              Gop->Mode->Info
@@ -386,11 +386,76 @@ Returns:
          Controller
          );
 
+  if (AtapiScsiPrivate->PrdTable != NULL) {
+    AtapiScsiPrivate->PciIo->Unmap (AtapiScsiPrivate->PciIo, AtapiScsiPrivate->PrdTableMapping);
+    AtapiScsiPrivate->PciIo->FreeBuffer (AtapiScsiPrivate->PciIo, PRD_TABLE_PAGES, AtapiScsiPrivate->PrdTable);
+  }
+
   gBS->FreePool (AtapiScsiPrivate);
 
   return EFI_SUCCESS;
 }
 
+STATIC
+EFI_STATUS
+AtapiPassThruAllocatePrdTable (
+  IN  ATAPI_SCSI_PASS_THRU_DEV     *AtapiScsiPrivate
+  )
+/*++
+
+Routine Description:
+  Allocates the PRD table used for bus master DMA. It is located below 4GB
+  and within one page, so it never crosses a 64KB boundary.
+
+Arguments:
+  AtapiScsiPrivate  - The pointer of ATAPI_SCSI_PASS_THRU_DEV
+
+Returns:
+  EFI_STATUS
+
+--*/
+{
+  EFI_STATUS            Status;
+  EFI_PCI_IO_PROTOCOL   *PciIo;
+  VOID                  *PrdTable;
+  UINTN                 Bytes;
+
+  PciIo = AtapiScsiPrivate->PciIo;
+
+  Status = PciIo->AllocateBuffer (
+                    PciIo,
+                    AllocateAnyPages,
+                    EfiBootServicesData,
+                    PRD_TABLE_PAGES,
+                    &PrdTable,
+                    0
+                    );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Bytes = EFI_PAGES_TO_SIZE (PRD_TABLE_PAGES);
+  Status = PciIo->Map (
+                    PciIo,
+                    EfiPciIoOperationBusMasterCommonBuffer,
+                    PrdTable,
+                    &Bytes,
+                    &AtapiScsiPrivate->PrdTableDeviceAddress,
+                    &AtapiScsiPrivate->PrdTableMapping
+                    );
+  if (EFI_ERROR (Status) || (Bytes != EFI_PAGES_TO_SIZE (PRD_TABLE_PAGES))) {
+    if (!EFI_ERROR (Status)) {
+      PciIo->Unmap (PciIo, AtapiScsiPrivate->PrdTableMapping);
+      Status = EFI_OUT_OF_RESOURCES;
+    }
+    PciIo->FreeBuffer (PciIo, PRD_TABLE_PAGES, PrdTable);
+    return Status;
+  }
+
+  AtapiScsiPrivate->PrdTable = PrdTable;
+  return EFI_SUCCESS;
+}
+
 EFI_STATUS
 RegisterAtapiScsiPassThru (
   IN EFI_DRIVER_BINDING_PROTOCOL  *This,
@@ -442,6 +507,15 @@ Returns:
 
   InitAtapiIoPortRegisters(AtapiScsiPrivate, IdeRegsBaseAddr);
 
+  //
+  // Allocate the PRD table used for bus master DMA, or fall back to PIO.
+  //
+  if (IdeRegsBaseAddr[IdePrimary].BusMasterBaseAddr != 0 &&
+      EFI_ERROR (AtapiPassThruAllocatePrdTable (AtapiScsiPrivate))) {
+    AtapiScsiPrivate->AtapiIoPortRegisters[IdePrimary].BusMasterBaseAddr   = 0;
+    AtapiScsiPrivate->AtapiIoPortRegisters[IdeSecondary].BusMasterBaseAddr = 0;
+  }
+
   //
   // Initialize the LatestTargetId to MAX_TARGET_ID.
   //
@@ -1617,6 +1691,19 @@ Returns:
     (UINT16) ((PciData.Device.Bar[3] & 0x0000fffc) + 2);
   }
 
+  //
+  // Bus master registers are in the IO BAR4, 8 bytes per channel
+  //
+  if ((PciData.Hdr.ClassCode[0] & IDE_BUS_MASTER_CAPABLE) != 0 &&
+      (PciData.Device.Bar[4] & BIT0) != 0 &&
+      (PciData.Device.Bar[4] & 0x0000fff0) != 0) {
+    IdeRegsBaseAddr[IdePrimary].BusMasterBaseAddr   = (UINT16) (PciData.Device.Bar[4] & 0x0000fff0);
+    IdeRegsBaseAddr[IdeSecondary].BusMasterBaseAddr = (UINT16) (IdeRegsBaseAddr[IdePrimary].BusMasterBaseAddr + 8);
+  } else {
+    IdeRegsBaseAddr[IdePrimary].BusMasterBaseAddr   = 0;
+    IdeRegsBaseAddr[IdeSecondary].BusMasterBaseAddr = 0;
+  }
+
   return EFI_SUCCESS;
 }
 
@@ -1671,6 +1758,8 @@ Returns:
 
     (*(UINT16 *) &RegisterPointer->Alt) = ControlBlockBaseAddr;
     RegisterPointer->DriveAddress = (UINT16) (ControlBlockBaseAddr + 0x01);
+
+    RegisterPointer->BusMasterBaseAddr = IdeRegsBaseAddr[IdeChannel].BusMasterBaseAddr;
   }
 
 }
@@ -2174,6 +2263,37 @@ Returns:
   UINT16      *CommandIndex;
   UINT8       Count;
   EFI_STATUS  Status;
+  UINTN       DeviceIndex;
+  VOID        *DmaMapping;
+
+  //
+  // Bulk data transfers use bus master DMA when the controller and the
+  // device allow it. DeviceIndex is the Target ID as seen by the caller.
+  //
+  DeviceIndex = Target;
+  if (AtapiScsiPrivate->IoPort == &AtapiScsiPrivate->AtapiIoPortRegisters[IdeSecondary]) {
+    DeviceIndex += 2;
+  }
+
+  DmaMapping = NULL;
+  if (AtapiScsiPrivate->IoPort->BusMasterBaseAddr != 0 &&
+      !AtapiScsiPrivate->DmaDisabled[DeviceIndex] &&
+      (Direction == DataIn || Direction == DataOut)) {
+    switch (PacketCommand[0]) {
+    case OP_READ_10:
+    case OP_READ_12:
+    case OP_READ_CD:
+    case OP_WRITE_10:
+    case OP_WRITE_12:
+    case OP_WRITE_AND_VERIFY:
+      if (EFI_ERROR (AtapiPassThruDmaPrepare (AtapiScsiPrivate, Buffer, *ByteCount, Direction, &DmaMapping))) {
+        DmaMapping = NULL;
+      }
+      break;
+    default:
+      break;
+    }
+  }
 
   //
   // Set all the command parameters by fill related registers.
@@ -2181,6 +2301,9 @@ Returns:
   //
   Status = StatusWaitForBSYClear (AtapiScsiPrivate, TimeoutInMicroSeconds);
   if (EFI_ERROR (Status)) {
+    if (DmaMapping != NULL) {
+      AtapiScsiPrivate->PciIo->Unmap (AtapiScsiPrivate->PciIo, DmaMapping);
+    }
     return EFI_DEVICE_ERROR;
   }
 
@@ -2202,6 +2325,9 @@ Returns:
   Status =  StatusDRQClear(AtapiScsiPrivate,  TimeoutInMicroSeconds);
 
   if (EFI_ERROR (Status)) {
+    if (DmaMapping != NULL) {
+      AtapiScsiPrivate->PciIo->Unmap (AtapiScsiPrivate->PciIo, DmaMapping);
+    }
     if (Status == EFI_ABORTED) {
       Status = EFI_DEVICE_ERROR;
     }
@@ -2210,12 +2336,12 @@ Returns:
   }
 
   //
-  // No OVL; No DMA (by setting feature register)
+  // No OVL; DMA only if the transfer was set up for it (by setting feature register)
   //
   WritePortB (
     AtapiScsiPrivate->PciIo,
     AtapiScsiPrivate->IoPort->Reg1.Feature,
-    0x00
+    (UINT8) ((DmaMapping != NULL) ? DMA : 0x00)
     );
 
   //
@@ -2260,6 +2386,9 @@ Returns:
   //
   Status = StatusDRQReady (AtapiScsiPrivate, TimeoutInMicroSeconds);
   if (EFI_ERROR (Status)) {
+    if (DmaMapping != NULL) {
+      AtapiScsiPrivate->PciIo->Unmap (AtapiScsiPrivate->PciIo, DmaMapping);
+    }
     if (Status == EFI_ABORTED) {
       Status = EFI_DEVICE_ERROR;
     }
@@ -2276,6 +2405,37 @@ Returns:
     WritePortW (AtapiScsiPrivate->PciIo, AtapiScsiPrivate->IoPort->Data, *CommandIndex);
   }
 
+  if (DmaMapping != NULL) {
+    Status = AtapiPassThruDmaReadWriteData (
+               AtapiScsiPrivate,
+               DmaMapping,
+               Direction,
+               TimeoutInMicroSeconds
+               );
+    if (Status != EFI_ABORTED) {
+      if (EFI_ERROR (Status)) {
+        *ByteCount = 0;
+      }
+      return Status;
+    }
+
+    //
+    // The bus master failed: stop using DMA with this device and retry
+    // the command with PIO.
+    //
+    DEBUG ((EFI_D_ERROR, "AtapiPacketCommand: bus master DMA failed, falling back to PIO\n"));
+    AtapiScsiPrivate->DmaDisabled[DeviceIndex] = TRUE;
+    return AtapiPacketCommand (
+             AtapiScsiPrivate,
+             Target,
+             PacketCommand,
+             Buffer,
+             ByteCount,
+             Direction,
+             TimeoutInMicroSeconds
+             );
+  }
+
   //
   // call AtapiPassThruPioReadWriteData() function to get
   // requested transfer data form device.
@@ -2416,6 +2576,243 @@ Arguments:
 }
 
 
+EFI_STATUS
+AtapiPassThruDmaPrepare (
+  ATAPI_SCSI_PASS_THRU_DEV  *AtapiScsiPrivate,
+  VOID                      *Buffer,
+  UINT32                    ByteCount,
+  DATA_DIRECTION            Direction,
+  VOID                      **Mapping
+  )
+/*++
+
+Routine Description:
+
+  Maps the data buffer and builds the PRD table of the current channel
+  for a bus master DMA transfer.
+
+Arguments:
+
+  AtapiScsiPrivate:   Private data structure for the specified channel.
+  Buffer:             Points to the transferred data.
+  ByteCount:          The size of the transfer.
+  Direction:          Indicates the data transfer direction.
+  Mapping:            Returns the mapping of Buffer.
+
+Returns:
+
+  EFI_UNSUPPORTED if the transfer cannot be done by DMA, the caller then
+  uses PIO.
+
+--*/
+{
+  EFI_STATUS            Status;
+  EFI_PCI_IO_PROTOCOL   *PciIo;
+  EFI_PHYSICAL_ADDRESS  DeviceAddress;
+  UINTN                 MappedBytes;
+  UINTN                 Index;
+  UINT32                Remaining;
+  UINT32                RegionSize;
+  UINT32                PrdTableAddr;
+  UINT16                BusMasterBase;
+
+  PciIo         = AtapiScsiPrivate->PciIo;
+  BusMasterBase = AtapiScsiPrivate->IoPort->BusMasterBaseAddr;
+
+  //
+  // The PRD entries describe an even number of bytes
+  //
+  if (Buffer == NULL || ByteCount == 0 || (ByteCount & 1) != 0 || BusMasterBase == 0) {
+    return EFI_UNSUPPORTED;
+  }
+
+  MappedBytes = ByteCount;
+  Status = PciIo->Map (
+                    PciIo,
+                    (Direction == DataIn) ? EfiPciIoOperationBusMasterWrite : EfiPciIoOperationBusMasterRead,
+                    Buffer,
+                    &MappedBytes,
+                    &DeviceAddress,
+                    Mapping
+                    );
+  if (EFI_ERROR (Status)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  //
+  // The bus master only addresses the first 4GB and needs the whole
+  // transfer in a single mapping
+  //
+  if (MappedBytes != ByteCount || (DeviceAddress + ByteCount) > SIZE_4GB) {
+    PciIo->Unmap (PciIo, *Mapping);
+    return EFI_UNSUPPORTED;
+  }
+
+  //
+  // A region may not cross a 64KB boundary
+  //
+  Remaining = ByteCount;
+  for (Index = 0; Remaining != 0; Index++) {
+    if (Index == PRD_TABLE_MAX_ENTRIES) {
+      PciIo->Unmap (PciIo, *Mapping);
+      return EFI_UNSUPPORTED;
+    }
+
+    RegionSize = PRD_MAX_REGION_SIZE - ((UINT32) DeviceAddress & (PRD_MAX_REGION_SIZE - 1));
+    if (RegionSize > Remaining) {
+      RegionSize = Remaining;
+    }
+
+    AtapiScsiPrivate->PrdTable[Index].RegionBaseAddr = (UINT32) DeviceAddress;
+    AtapiScsiPrivate->PrdTable[Index].ByteCount      = (UINT16) RegionSize;
+    AtapiScsiPrivate->PrdTable[Index].EndOfTable     = 0;
+
+    DeviceAddress += RegionSize;
+    Remaining     -= RegionSize;
+  }
+  AtapiScsiPrivate->PrdTable[Index - 1].EndOfTable = PRD_EOT;
+
+  //
+  // Program the descriptor table, the transfer direction and clear the
+  // status of the previous transfer
+  //
+  PrdTableAddr = (UINT32) AtapiScsiPrivate->PrdTableDeviceAddress;
+  PciIo->Io.Write (
+              PciIo,
+              EfiPciIoWidthUint32,
+              EFI_PCI_IO_PASS_THROUGH_BAR,
+              (UINT64) (BusMasterBase + BMID_OFFSET),
+              1,
+              &PrdTableAddr
+              );
+
+  WritePortB (
+    PciIo,
+    (UINT16) (BusMasterBase + BMIC_OFFSET),
+    (UINT8) ((Direction == DataIn) ? BMIC_NREAD : 0)
+    );
+
+  WritePortB (
+    PciIo,
+    (UINT16) (BusMasterBase + BMIS_OFFSET),
+    (UINT8) (ReadPortB (PciIo, (UINT16) (BusMasterBase + BMIS_OFFSET)) | BMIS_ERROR | BMIS_INTERRUPT)
+    );
+
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+AtapiPassThruDmaReadWriteData (
+  ATAPI_SCSI_PASS_THRU_DEV  *AtapiScsiPrivate,
+  VOID                      *Mapping,
+  DATA_DIRECTION            Direction,
+  UINT64                    TimeoutInMicroSeconds
+  )
+/*++
+
+Routine Description:
+
+  Runs the bus master DMA transfer prepared by AtapiPassThruDmaPrepare()
+  once the ATAPI command packet has been sent, and releases the mapping.
+
+Arguments:
+
+  AtapiScsiPrivate:   Private data structure for the specified channel.
+  Mapping:            The mapping returned by AtapiPassThruDmaPrepare().
+  Direction:          Indicates the data transfer direction.
+  TimeoutInMicroSeconds:
+                      The timeout, in micro second units, to use for the
+                      execution of this ATAPI command.
+                      A TimeoutInMicroSeconds value of 0 means that
+                      this function will wait indefinitely for the ATAPI
+                      command to execute.
+
+Returns:
+
+  EFI_ABORTED if the bus master reported an error or did not complete,
+  in which case the command may be retried with PIO.
+
+--*/
+{
+  EFI_STATUS            Status;
+  EFI_PCI_IO_PROTOCOL   *PciIo;
+  UINT64                Delay;
+  UINT8                 BusMasterStatus;
+  UINT8                 BusMasterCommand;
+  UINT16                BusMasterBase;
+
+  PciIo         = AtapiScsiPrivate->PciIo;
+  BusMasterBase = AtapiScsiPrivate->IoPort->BusMasterBaseAddr;
+
+  BusMasterCommand = (UINT8) ((Direction == DataIn) ? BMIC_NREAD : 0);
+
+  //
+  // Start the bus master
+  //
+  WritePortB (PciIo, (UINT16) (BusMasterBase + BMIC_OFFSET), (UINT8) (BusMasterCommand | BMIC_START));
+
+  if (TimeoutInMicroSeconds == 0) {
+    Delay = 2;
+  } else {
+    Delay = DivU64x32 (TimeoutInMicroSeconds, (UINT32) 30) + 1;
+  }
+
+  //
+  // The transfer is done when the device raises its interrupt, or when the
+  // bus master has gone idle
+  //
+  do {
+    BusMasterStatus = ReadPortB (PciIo, (UINT16) (BusMasterBase + BMIS_OFFSET));
+    if ((BusMasterStatus & (BMIS_ERROR | BMIS_INTERRUPT)) != 0 ||
+        (BusMasterStatus & BMIS_ACTIVE) == 0) {
+      break;
+    }
+
+    //
+    // Stall for 30 us
+    //
+    gBS->Stall (30);
+
+    //
+    // Loop infinitely if not meeting expected condition
+    //
+    if (TimeoutInMicroSeconds == 0) {
+      Delay = 2;
+    }
+
+    Delay--;
+  } while (Delay);
+
+  //
+  // Stop the bus master and clear its status
+  //
+  WritePortB (PciIo, (UINT16) (BusMasterBase + BMIC_OFFSET), BusMasterCommand);
+  WritePortB (
+    PciIo,
+    (UINT16) (BusMasterBase + BMIS_OFFSET),
+    (UINT8) (BusMasterStatus | BMIS_ERROR | BMIS_INTERRUPT)
+    );
+
+  PciIo->Unmap (PciIo, Mapping);
+
+  if (Delay == 0 || (BusMasterStatus & BMIS_ERROR) != 0) {
+    DEBUG ((EFI_D_ERROR, "AtapiPassThruDmaReadWriteData: bus master status %02x\n", BusMasterStatus));
+    StatusWaitForBSYClear (AtapiScsiPrivate, TimeoutInMicroSeconds);
+    return EFI_ABORTED;
+  }
+
+  Status = StatusWaitForBSYClear (AtapiScsiPrivate, TimeoutInMicroSeconds);
+  if (EFI_ERROR (Status)) {
+    return EFI_DEVICE_ERROR;
+  }
+
+  //
+  // read status register to check whether error happens.
+  //
+  return AtapiPassThruCheckErrorStatus (AtapiScsiPrivate);
+}
+
+
 UINT8
 ReadPortB (
   IN  EFI_PCI_IO_PROTOCOL   *PciIo,
@@ -68,6 +68,7 @@ typedef enum {
 #define IDE_PRIMARY_PROGRAMMABLE_INDICATOR    BIT1
 #define IDE_SECONDARY_OPERATING_MODE          BIT2
 #define IDE_SECONDARY_PROGRAMMABLE_INDICATOR  BIT3
+#define IDE_BUS_MASTER_CAPABLE                BIT7
 
 
 #define ATAPI_MAX_CHANNEL 2
@@ -86,8 +87,39 @@ typedef struct {
   IDE_CMD_OR_STATUS               Reg;
   IDE_AltStatus_OR_DeviceControl  Alt;
   UINT16                          DriveAddress;
+  UINT16                          BusMasterBaseAddr;  ///< 0 if bus master DMA is not available
 } IDE_BASE_REGISTERS;
 
+//
+// Bus Master IDE registers, offsets from the channel's bus master base
+//
+#define BMIC_OFFSET     0x00  ///< Bus Master IDE Command register
+#define BMIS_OFFSET     0x02  ///< Bus Master IDE Status register
+#define BMID_OFFSET     0x04  ///< Bus Master IDE Descriptor Table Pointer register
+
+#define BMIC_START      BIT0  ///< Start/Stop Bus Master
+#define BMIC_NREAD      BIT3  ///< Bus master writes to memory (device to host)
+
+#define BMIS_ACTIVE     BIT0  ///< Bus Master IDE Active
+#define BMIS_ERROR      BIT1  ///< Bus Master IDE Error
+#define BMIS_INTERRUPT  BIT2  ///< IDE Interrupt
+
+///
+/// Physical Region Descriptor
+///
+#pragma pack(1)
+typedef struct {
+  UINT32  RegionBaseAddr;
+  UINT16  ByteCount;        ///< 0 means 64KB
+  UINT16  EndOfTable;
+} ATAPI_PRD_ENTRY;
+#pragma pack()
+
+#define PRD_EOT                 BIT15
+#define PRD_MAX_REGION_SIZE     SIZE_64KB
+#define PRD_TABLE_PAGES         1
+#define PRD_TABLE_MAX_ENTRIES   (EFI_PAGES_TO_SIZE (PRD_TABLE_PAGES) / sizeof (ATAPI_PRD_ENTRY))
+
 #define ATAPI_SCSI_PASS_THRU_DEV_SIGNATURE  SIGNATURE_32 ('a', 's', 'p', 't')
 
 typedef struct {
@@ -104,6 +136,14 @@ typedef struct {
   IDE_BASE_REGISTERS               AtapiIoPortRegisters[2];
   UINT32                           LatestTargetId;
   UINT64                           LatestLun;
+  //
+  // Bus master DMA. The PRD table is shared by both channels as the
+  // commands are executed one at a time.
+  //
+  ATAPI_PRD_ENTRY                  *PrdTable;
+  EFI_PHYSICAL_ADDRESS             PrdTableDeviceAddress;
+  VOID                             *PrdTableMapping;
+  BOOLEAN                          DmaDisabled[MAX_TARGET_ID];
 } ATAPI_SCSI_PASS_THRU_DEV;
 
 //
@@ -112,6 +152,7 @@ typedef struct {
 typedef struct {
   UINT16  CommandBlockBaseAddr;
   UINT16  ControlBlockBaseAddr;
+  UINT16  BusMasterBaseAddr;
 } IDE_REGISTERS_BASE_ADDR;
 
 #define ATAPI_SCSI_PASS_THRU_DEV_FROM_THIS(a) \
@@ -1526,6 +1567,68 @@ Arguments:
 --*/
 ;
 
+EFI_STATUS
+AtapiPassThruDmaPrepare (
+  ATAPI_SCSI_PASS_THRU_DEV  *AtapiScsiPrivate,
+  VOID                      *Buffer,
+  UINT32                    ByteCount,
+  DATA_DIRECTION            Direction,
+  VOID                      **Mapping
+  )
+/*++
+
+Routine Description:
+
+  Maps the data buffer and builds the PRD table of the current channel
+  for a bus master DMA transfer.
+
+Arguments:
+
+  AtapiScsiPrivate:   Private data structure for the specified channel.
+  Buffer:             Points to the transferred data.
+  ByteCount:          The size of the transfer.
+  Direction:          Indicates the data transfer direction.
+  Mapping:            Returns the mapping of Buffer.
+
+Returns:
+
+  EFI_UNSUPPORTED if the transfer cannot be done by DMA, the caller then
+  uses PIO.
+
+--*/
+;
+
+EFI_STATUS
+AtapiPassThruDmaReadWriteData (
+  ATAPI_SCSI_PASS_THRU_DEV  *AtapiScsiPrivate,
+  VOID                      *Mapping,
+  DATA_DIRECTION            Direction,
+  UINT64                    TimeOutInMicroSeconds
+  )
+/*++
+
+Routine Description:
+
+  Runs the bus master DMA transfer prepared by AtapiPassThruDmaPrepare()
+  once the ATAPI command packet has been sent, and releases the mapping.
+
+Arguments:
+
+  AtapiScsiPrivate:   Private data structure for the specified channel.
+  Mapping:            The mapping returned by AtapiPassThruDmaPrepare().
+  Direction:          Indicates the data transfer direction.
+  TimeoutInMicroSeconds:
+                      The timeout, in micro second units, to use for the
+                      execution of this ATAPI command.
+
+Returns:
+
+  EFI_ABORTED if the bus master reported an error or did not complete,
+  in which case the command may be retried with PIO.
+
+--*/
+;
+
 EFI_STATUS
 AtapiPassThruCheckErrorStatus (
   ATAPI_SCSI_PASS_THRU_DEV        *AtapiScsiPrivate
@@ -231,10 +231,12 @@ ReadDataFromUsb (
   UINTN       ReadBufferSize;
   UINT8       *ReadBuffer;
   UINTN       Index;
+  UINTN       Offset;
+  UINTN       PacketEnd;
+  UINTN       MaxPacketSize;
+  UINTN       Free;
   EFI_TPL     Tpl;
-  UINT8       StatusBuffer[2]; // buffer to store the status bytes
 
-  ReadBufferSize = 512;
   ReadBuffer     = &(UsbSerialDevice->ReadBuffer[0]);
 
   if (UsbSerialDevice->Shutdown) {
@@ -243,6 +245,26 @@ ReadDataFromUsb (
 
   Tpl = gBS->RaiseTPL (TPL_NOTIFY);
 
+  //
+  // Only ask the device for as many packets as the internal buffer can take,
+  // anything else is left in the device FIFO (and throttled by flow control)
+  // rather than being dropped here.
+  //
+  MaxPacketSize = UsbSerialDevice->InEndpointDescriptor.MaxPacketSize;
+  if ((MaxPacketSize <= FTDI_STATUS_BYTES) ||
+      (MaxPacketSize > sizeof (UsbSerialDevice->ReadBuffer))) {
+    MaxPacketSize = sizeof (UsbSerialDevice->ReadBuffer);
+  }
+  Free = (UsbSerialDevice->DataBufferHead + SW_FIFO_DEPTH -
+          UsbSerialDevice->DataBufferTail - 1) % SW_FIFO_DEPTH;
+  ReadBufferSize = (Free / (MaxPacketSize - FTDI_STATUS_BYTES)) * MaxPacketSize;
+  if (ReadBufferSize > sizeof (UsbSerialDevice->ReadBuffer)) {
+    ReadBufferSize = sizeof (UsbSerialDevice->ReadBuffer);
+  }
+  if (ReadBufferSize == 0) {
+    goto ReturnData;
+  }
+
   Status = UsbSerialDataTransfer (
              UsbSerialDevice,
              EfiUsbDataIn,
@@ -260,35 +282,27 @@ ReadDataFromUsb (
   }
 
   //
-  // Store the status bytes in the status buffer
+  // The transfer may span several bulk packets, each of which starts with its
+  // own pair of status bytes. Update the status from every packet and store
+  // the payload that follows it in the internal buffer.
   //
-  for (Index = 0; Index < 2; Index++) {//only the first 2 bytes are status bytes
-    StatusBuffer[Index] = ReadBuffer[Index];
-  }
-  //
-  // update the statusvalue field of the usbserialdevice
-  //
-  Status = SetStatusInternal (UsbSerialDevice, StatusBuffer);
-  if (Status != EFI_SUCCESS) {
-  }
+  for (Offset = 0; Offset + FTDI_STATUS_BYTES <= ReadBufferSize; Offset += MaxPacketSize) {
+    SetStatusInternal (UsbSerialDevice, &ReadBuffer[Offset]);
 
-  //
-  // Store the read data in the read buffer, start at 2 to ignore status bytes
-  //
-  for (Index = 2; Index < ReadBufferSize; Index++) {
-    if (((UsbSerialDevice->DataBufferTail + 1) % SW_FIFO_DEPTH) == UsbSerialDevice->DataBufferHead) {
-      break;
+    PacketEnd = Offset + MaxPacketSize;
+    if (PacketEnd > ReadBufferSize) {
+      PacketEnd = ReadBufferSize;
     }
-    if (ReadBuffer[Index] == 0x00) {
-      //
-      // This is null, do not add
-      //
-    } else {
+    for (Index = Offset + FTDI_STATUS_BYTES; Index < PacketEnd; Index++) {
+      if (((UsbSerialDevice->DataBufferTail + 1) % SW_FIFO_DEPTH) == UsbSerialDevice->DataBufferHead) {
+        break;
+      }
       UsbSerialDevice->DataBuffer[UsbSerialDevice->DataBufferTail] = ReadBuffer[Index];
       UsbSerialDevice->DataBufferTail = (UsbSerialDevice->DataBufferTail + 1) % SW_FIFO_DEPTH;
     }
   }
 
+ReturnData:
   //
   // Read characters out of the buffer to satisfy caller's request.
   //
@@ -381,28 +395,23 @@ UsbSerialDriverCheckInput (
 
   UsbSerialDevice = (USB_SER_DEV*)Context;
 
+  //
+  // Keep draining the device into the internal buffer whenever there is room
+  // for it, so that data does not pile up in the small device FIFO (and get
+  // lost at high baud rates) while the consumer is busy.
+  // ReadDataFromUsb () does not issue a transfer when the buffer is full.
+  //
+  BufferSize = 0;
+  ReadDataFromUsb (UsbSerialDevice, &BufferSize, NULL);
   if (UsbSerialDevice->DataBufferHead == UsbSerialDevice->DataBufferTail) {
     //
-    // Data buffer is empty, try to read from device
+    // Data buffer still has no data, set the EFI_SERIAL_INPUT_BUFFER_EMPTY
+    // flag
     //
-    BufferSize = 0;
-    ReadDataFromUsb (UsbSerialDevice, &BufferSize, NULL);
-    if (UsbSerialDevice->DataBufferHead == UsbSerialDevice->DataBufferTail) {
-      //
-      // Data buffer still has no data, set the EFI_SERIAL_INPUT_BUFFER_EMPTY
-      // flag
-      //
-      UsbSerialDevice->ControlBits |= EFI_SERIAL_INPUT_BUFFER_EMPTY;
-    } else {
-      //
-      // Read has returned some data, clear the EFI_SERIAL_INPUT_BUFFER_EMPTY
-      // flag
-      //
-      UsbSerialDevice->ControlBits &= ~(EFI_SERIAL_INPUT_BUFFER_EMPTY);
-    }
+    UsbSerialDevice->ControlBits |= EFI_SERIAL_INPUT_BUFFER_EMPTY;
   } else {
     //
-    // Data buffer has data, no read attempt required
+    // Data buffer has data, clear the EFI_SERIAL_INPUT_BUFFER_EMPTY flag
     //
     UsbSerialDevice->ControlBits &= ~(EFI_SERIAL_INPUT_BUFFER_EMPTY);
   }
@@ -800,6 +809,90 @@ StatusError:
   }
 }
 
+/**
+  Internal function that performs a Usb Control Transfer to set the latency
+  timer of the Usb Serial Device.
+
+  @param  UsbIo[in]            Usb Io Protocol instance pointer
+  @param  LatencyTimer[in]     The latency timer value in ms
+
+  @retval EFI_SUCCESS          The latency timer was set on the device
+  @retval EFI_DEVICE_ERROR     The device is not functioning correctly
+
+**/
+EFI_STATUS
+EFIAPI
+SetLatencyTimerInternal (
+  IN EFI_USB_IO_PROTOCOL  *UsbIo,
+  IN UINT8                LatencyTimer
+  )
+{
+  EFI_STATUS              Status;
+  EFI_USB_DEVICE_REQUEST  DevReq;
+  UINT8                   ConfigurationValue;
+  UINT32                  ReturnValue;
+
+  DevReq.Request     = FTDI_COMMAND_SET_LATENCY_TIMER;
+  DevReq.RequestType = USB_REQ_TYPE_VENDOR;
+  DevReq.Value       = LatencyTimer;
+  DevReq.Index       = FTDI_PORT_IDENTIFIER;
+  DevReq.Length      = 0; // indicates that there is no data phase in this request
+
+  Status = UsbIo->UsbControlTransfer (
+                    UsbIo,
+                    &DevReq,
+                    EfiUsbDataOut,
+                    WDR_SHORT_TIMEOUT,
+                    &ConfigurationValue,
+                    1,
+                    &ReturnValue
+                    );
+  if (EFI_ERROR (Status)) {
+    return EFI_DEVICE_ERROR;
+  }
+  return EFI_SUCCESS;
+}
+
+/**
+  Programs the period of the input polling loop from the current baud rate, so
+  that at most FTDI_POLL_BYTES characters arrive between two polls.
+
+  @param  UsbSerialDevice[in]  Handle to the Usb Serial Device
+
+**/
+VOID
+UpdatePollingPeriod (
+  IN USB_SER_DEV  *UsbSerialDevice
+  )
+{
+  UINT32  BaudRate;
+  UINT32  Period;
+
+  if (UsbSerialDevice->PollingLoop == NULL) {
+    return;
+  }
+
+  //
+  // 10 bit times per character (start bit, 8 data bits and a stop bit)
+  //
+  BaudRate = (UINT32) UsbSerialDevice->LastSettings.BaudRate;
+  Period   = FTDI_POLL_MAX_PERIOD;
+  if (BaudRate != 0) {
+    Period = (FTDI_POLL_BYTES * 10 * 1000) / BaudRate;
+  }
+  if (Period < FTDI_POLL_MIN_PERIOD) {
+    Period = FTDI_POLL_MIN_PERIOD;
+  } else if (Period > FTDI_POLL_MAX_PERIOD) {
+    Period = FTDI_POLL_MAX_PERIOD;
+  }
+
+  gBS->SetTimer (
+         UsbSerialDevice->PollingLoop,
+         TimerPeriodic,
+         EFI_TIMER_PERIOD_MILLISECONDS (Period)
+         );
+}
+
 /**
   Sets the baud rate, receive FIFO depth, transmit/receice time out, parity,
   data bits, and stop bits on a serial device.
@@ -898,6 +991,8 @@ SetAttributesInternal (
   UsbSerialDevice->LastSettings.Timeout          = FTDI_TIMEOUT;
   UsbSerialDevice->LastSettings.ReceiveFifoDepth = FTDI_MAX_RECEIVE_FIFO_DEPTH;
 
+  UpdatePollingPeriod (UsbSerialDevice);
+
   if (Parity == DefaultParity) {
     UsbSerialDevice->LastSettings.Parity   = UsbSerialDevice->LastSettings.Parity;
     UsbSerialDevice->SerialIo.Mode->Parity = UsbSerialDevice->LastSettings.Parity;
@@ -1936,6 +2031,15 @@ UsbSerialDriverBindingStart (
 
   ASSERT_EFI_ERROR (Status);
 
+  //
+  // Ask the device to flush received data quickly instead of holding it for
+  // the default 16ms; failure only costs latency.
+  //
+  Status = SetLatencyTimerInternal (UsbIo, FTDI_LATENCY_TIMER);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((EFI_D_WARN, "FtdiUsbSerial: failed to set latency timer - %r\n", Status));
+  }
+
   //
   // Publish Serial GUID and protocol
   //
@@ -2006,14 +2110,9 @@ UsbSerialDriverBindingStart (
          &(UsbSerialDevice->PollingLoop)
          );
   //
-  // add code to set trigger time based on baud rate
-  // setting to 0.5s for now
+  // set the trigger time based on the baud rate
   //
-  gBS->SetTimer (
-         UsbSerialDevice->PollingLoop,
-         TimerPeriodic,
-         EFI_TIMER_PERIOD_MILLISECONDS (500)
-         );
+  UpdatePollingPeriod (UsbSerialDevice);
 
   //
   // Check if the remaining device path is null. If it is not null change the settings
@@ -156,6 +156,28 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 //
 #define FTDI_TIMEOUT       16
 
+//
+// FTDI latency timer in ms. The device flushes a short bulk-in packet once
+// this much time has passed since the last received character, so keeping
+// it low lets the polling loop below drain the device buffer promptly.
+//
+#define FTDI_LATENCY_TIMER  2
+
+//
+// Every bulk-in packet from the device starts with two modem/line status
+// bytes, followed by up to (MaxPacketSize - 2) bytes of received data.
+//
+#define FTDI_STATUS_BYTES   2
+
+//
+// Polling loop period. The period is derived from the baud rate so that the
+// device FIFO holds no more than FTDI_POLL_BYTES characters between polls,
+// clamped to [FTDI_POLL_MIN_PERIOD, FTDI_POLL_MAX_PERIOD] ms.
+//
+#define FTDI_POLL_BYTES       128
+#define FTDI_POLL_MIN_PERIOD  1
+#define FTDI_POLL_MAX_PERIOD  100
+
 //
 // FTDI FIFO depth
 //
@@ -170,7 +192,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 //
 // Max buffer size for USB transfers
 //
-#define SW_FIFO_DEPTH 1024
+#define SW_FIFO_DEPTH 4096
 
 //
 // struct to define a usb device as a vendor and product id pair
@@ -706,6 +706,153 @@ inw (
   return Data;
 }
 
+/**
+  Write a value of up to 24 bits into consecutive BitBLT engine registers.
+
+  @param  Private   Driver private data
+  @param  Register  First (least significant) register
+  @param  Value     Value to write
+  @param  Bytes     Number of registers to write
+
+**/
+STATIC
+VOID
+BitBltWrite (
+  CIRRUS_LOGIC_5430_PRIVATE_DATA  *Private,
+  UINT8                           Register,
+  UINTN                           Value,
+  UINTN                           Bytes
+  )
+{
+  UINTN Index;
+
+  for (Index = 0; Index < Bytes; Index++) {
+    outw (Private, GRAPH_ADDRESS_REGISTER, (UINT16) ((((Value >> (Index * 8)) & 0xff) << 8) | (Register + Index)));
+  }
+}
+
+/**
+  Program the geometry of a BitBLT, start it and wait for it to complete.
+  Width and Height are in bytes and lines; the engine takes them minus one.
+
+  @param  Private            Driver private data
+  @param  SourceOffset       Offset of the first source byte in video memory
+  @param  DestinationOffset  Offset of the first destination byte in video memory
+  @param  Width              Width of the rectangle
+  @param  Height             Height of the rectangle
+  @param  ScreenWidth        Pitch of both source and destination
+  @param  Mode               BLT_MODE value
+
+**/
+STATIC
+VOID
+BitBltRun (
+  CIRRUS_LOGIC_5430_PRIVATE_DATA  *Private,
+  UINTN                           SourceOffset,
+  UINTN                           DestinationOffset,
+  UINTN                           Width,
+  UINTN                           Height,
+  UINTN                           ScreenWidth,
+  UINT8                           Mode
+  )
+{
+  BitBltWrite (Private, BLT_WIDTH, Width - 1, 2);
+  BitBltWrite (Private, BLT_HEIGHT, Height - 1, 2);
+  BitBltWrite (Private, BLT_DEST_PITCH, ScreenWidth, 2);
+  BitBltWrite (Private, BLT_SRC_PITCH, ScreenWidth, 2);
+  BitBltWrite (Private, BLT_DEST_ADDRESS, DestinationOffset, 3);
+  BitBltWrite (Private, BLT_SRC_ADDRESS, SourceOffset, 3);
+  BitBltWrite (Private, BLT_WRITE_MASK, 0, 1);
+  BitBltWrite (Private, BLT_MODE, Mode, 1);
+  BitBltWrite (Private, BLT_ROP, BLT_ROP_SRC_COPY, 1);
+
+  BitBltWrite (Private, BLT_START_STATUS, BLT_STATUS_START, 1);
+
+  outb (Private, GRAPH_ADDRESS_REGISTER, BLT_START_STATUS);
+  while ((inb (Private, GRAPH_DATA_REGISTER) & BLT_STATUS_BUSY) == BLT_STATUS_BUSY)
+    ;
+}
+
+/**
+  Copy a rectangle of video memory with the BitBLT engine. Overlapping
+  rectangles are handled by running the copy backwards when the destination
+  comes after the source.
+
+  @param  Private            Driver private data
+  @param  SourceOffset       Offset of the top left source pixel
+  @param  DestinationOffset  Offset of the top left destination pixel
+  @param  Width              Width of the rectangle in pixels
+  @param  Height             Height of the rectangle in pixels
+  @param  ScreenWidth        Pixels per scan line
+
+**/
+VOID
+BitBltVideoToVideo (
+  CIRRUS_LOGIC_5430_PRIVATE_DATA  *Private,
+  UINTN                           SourceOffset,
+  UINTN                           DestinationOffset,
+  UINTN                           Width,
+  UINTN                           Height,
+  UINTN                           ScreenWidth
+  )
+{
+  UINTN LastPixel;
+
+  if (DestinationOffset > SourceOffset) {
+    LastPixel = (Height - 1) * ScreenWidth + Width - 1;
+    BitBltRun (Private, SourceOffset + LastPixel, DestinationOffset + LastPixel,
+      Width, Height, ScreenWidth, BLT_MODE_BACKWARDS);
+  } else {
+    BitBltRun (Private, SourceOffset, DestinationOffset,
+      Width, Height, ScreenWidth, 0);
+  }
+}
+
+/**
+  Fill a rectangle of video memory with a solid colour using the BitBLT
+  engine. Solid fill is a GD5436/46 extension, so on older parts nothing is
+  done and the caller has to fill the rectangle itself.
+
+  @param  Private            Driver private data
+  @param  Pixel              Colour to fill with
+  @param  DestinationOffset  Offset of the top left destination pixel
+  @param  Width              Width of the rectangle in pixels
+  @param  Height             Height of the rectangle in pixels
+  @param  ScreenWidth        Pixels per scan line
+
+  @retval TRUE   The rectangle was filled.
+  @retval FALSE  The engine can't do solid fills on this device.
+
+**/
+BOOLEAN
+BitBltVideoFill (
+  CIRRUS_LOGIC_5430_PRIVATE_DATA  *Private,
+  UINT8                           Pixel,
+  UINTN                           DestinationOffset,
+  UINTN                           Width,
+  UINTN                           Height,
+  UINTN                           ScreenWidth
+  )
+{
+  if (Private->DeviceId != CIRRUS_LOGIC_5446_DEVICE_ID) {
+    return FALSE;
+  }
+
+  BitBltWrite (Private, BLT_FG_COLOR, Pixel, 1);
+  BitBltWrite (Private, BLT_MODE_EXTENSIONS, BLT_MODE_EXT_SOLID_FILL, 1);
+
+  BitBltRun (Private, 0, DestinationOffset, Width, Height, ScreenWidth,
+    BLT_MODE_COLOR_EXPAND | BLT_MODE_PATTERN_COPY);
+
+  //
+  // The foreground colour register doubles as the VGA enable set/reset register
+  //
+  BitBltWrite (Private, BLT_FG_COLOR, 0, 1);
+  BitBltWrite (Private, BLT_MODE_EXTENSIONS, 0, 1);
+
+  return TRUE;
+}
+
 /**
   TODO: Add function description
 
@@ -836,6 +983,7 @@ InitializeGraphicsMode (
   // Read the PCI Configuration Header from the PCI Device
   //
   ASSERT_EFI_ERROR (Status);
+  Private->DeviceId = DeviceId;
 
   outw (Private, SEQ_ADDRESS_REGISTER, 0x1206);
   outw (Private, SEQ_ADDRESS_REGISTER, 0x0012);
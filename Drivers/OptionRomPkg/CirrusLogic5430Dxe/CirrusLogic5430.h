@@ -97,6 +97,7 @@ typedef struct {
   CIRRUS_LOGIC_5430_MODE_DATA           ModeData[CIRRUS_LOGIC_5430_MODE_COUNT];
   UINT8                                 *LineBuffer;
   BOOLEAN                               HardwareNeedsStarting;
+  UINT16                                DeviceId;
 } CIRRUS_LOGIC_5430_PRIVATE_DATA;
 
 ///
@@ -152,6 +153,30 @@ extern EFI_DRIVER_SUPPORTED_EFI_VERSION_PROTOCOL  gCirrusLogic5430DriverSupporte
 #define PALETTE_INDEX_REGISTER  0x3c8
 #define PALETTE_DATA_REGISTER   0x3c9
 
+//
+// BitBLT engine registers, accessed through GRAPH_ADDRESS_REGISTER
+//
+#define BLT_FG_COLOR            0x01
+#define BLT_WIDTH               0x20
+#define BLT_HEIGHT              0x22
+#define BLT_DEST_PITCH          0x24
+#define BLT_SRC_PITCH           0x26
+#define BLT_DEST_ADDRESS        0x28
+#define BLT_SRC_ADDRESS         0x2c
+#define BLT_WRITE_MASK          0x2f
+#define BLT_MODE                0x30
+#define BLT_START_STATUS        0x31
+#define BLT_ROP                 0x32
+#define BLT_MODE_EXTENSIONS     0x33
+
+#define BLT_MODE_BACKWARDS      0x01
+#define BLT_MODE_PATTERN_COPY   0x40
+#define BLT_MODE_COLOR_EXPAND   0x80
+#define BLT_STATUS_BUSY         0x01
+#define BLT_STATUS_START        0x02
+#define BLT_ROP_SRC_COPY        0x0d
+#define BLT_MODE_EXT_SOLID_FILL 0x04
+
 //
 // UGA Draw Hardware abstraction internal worker functions
 //
@@ -424,6 +449,26 @@ inw (
   UINTN                           Address
   );
 
+VOID
+BitBltVideoToVideo (
+  CIRRUS_LOGIC_5430_PRIVATE_DATA  *Private,
+  UINTN                           SourceOffset,
+  UINTN                           DestinationOffset,
+  UINTN                           Width,
+  UINTN                           Height,
+  UINTN                           ScreenWidth
+  );
+
+BOOLEAN
+BitBltVideoFill (
+  CIRRUS_LOGIC_5430_PRIVATE_DATA  *Private,
+  UINT8                           Pixel,
+  UINTN                           DestinationOffset,
+  UINTN                           Width,
+  UINTN                           Height,
+  UINTN                           ScreenWidth
+  );
+
 EFI_STATUS
 CirrusLogic5430VideoModeSetup (
   CIRRUS_LOGIC_5430_PRIVATE_DATA  *Private
@@ -338,42 +338,7 @@ Returns:
     SourceOffset  = (SourceY * Private->ModeData[CurrentMode].HorizontalResolution) + (SourceX);
     Offset        = (DestinationY * Private->ModeData[CurrentMode].HorizontalResolution) + (DestinationX);
 
-    outw (Private, GRAPH_ADDRESS_REGISTER, 0x0000);
-    outw (Private, GRAPH_ADDRESS_REGISTER, 0x0010);
-    outw (Private, GRAPH_ADDRESS_REGISTER, 0x0012);
-    outw (Private, GRAPH_ADDRESS_REGISTER, 0x0014);
-
-    outw (Private, GRAPH_ADDRESS_REGISTER, 0x0001);
-    outw (Private, GRAPH_ADDRESS_REGISTER, 0x0011);
-    outw (Private, GRAPH_ADDRESS_REGISTER, 0x0013);
-    outw (Private, GRAPH_ADDRESS_REGISTER, 0x0015);
-
-    outw (Private, GRAPH_ADDRESS_REGISTER, (UINT16) (((Width << 8) & 0xff00) | 0x20));
-    outw (Private, GRAPH_ADDRESS_REGISTER, (UINT16) ((Width & 0xff00) | 0x21));
-    outw (Private, GRAPH_ADDRESS_REGISTER, (UINT16) (((Height << 8) & 0xff00) | 0x22));
-    outw (Private, GRAPH_ADDRESS_REGISTER, (UINT16) ((Height & 0xff00) | 0x23));
-    outw (Private, GRAPH_ADDRESS_REGISTER, (UINT16) (((ScreenWidth << 8) & 0xff00) | 0x24));
-    outw (Private, GRAPH_ADDRESS_REGISTER, (UINT16) ((ScreenWidth & 0xff00) | 0x25));
-    outw (Private, GRAPH_ADDRESS_REGISTER, (UINT16) (((ScreenWidth << 8) & 0xff00) | 0x26));
-    outw (Private, GRAPH_ADDRESS_REGISTER, (UINT16) ((ScreenWidth & 0xff00) | 0x27));
-    outw (Private, GRAPH_ADDRESS_REGISTER, (UINT16) ((((Offset) << 8) & 0xff00) | 0x28));
-    outw (Private, GRAPH_ADDRESS_REGISTER, (UINT16) ((((Offset) >> 0) & 0xff00) | 0x29));
-    outw (Private, GRAPH_ADDRESS_REGISTER, (UINT16) ((((Offset) >> 8) & 0xff00) | 0x2a));
-    outw (Private, GRAPH_ADDRESS_REGISTER, (UINT16) ((((SourceOffset) << 8) & 0xff00) | 0x2c));
-    outw (Private, GRAPH_ADDRESS_REGISTER, (UINT16) ((((SourceOffset) >> 0) & 0xff00) | 0x2d));
-    outw (Private, GRAPH_ADDRESS_REGISTER, (UINT16) ((((SourceOffset) >> 8) & 0xff00) | 0x2e));
-    outw (Private, GRAPH_ADDRESS_REGISTER, 0x002f);
-    outw (Private, GRAPH_ADDRESS_REGISTER, 0x0030);
-    outw (Private, GRAPH_ADDRESS_REGISTER, 0x0d32);
-    outw (Private, GRAPH_ADDRESS_REGISTER, 0x0033);
-    outw (Private, GRAPH_ADDRESS_REGISTER, 0x0034);
-    outw (Private, GRAPH_ADDRESS_REGISTER, 0x0035);
-
-    outw (Private, GRAPH_ADDRESS_REGISTER, 0x0231);
-
-    outb (Private, GRAPH_ADDRESS_REGISTER, 0x31);
-    while ((inb (Private, GRAPH_DATA_REGISTER) & 0x01) == 0x01)
-      ;
+    BitBltVideoToVideo (Private, SourceOffset, Offset, Width, Height, ScreenWidth);
     break;
 
   case EfiBltVideoFill:
@@ -382,6 +347,14 @@ Returns:
     WidePixel = (Pixel << 8) | Pixel;
     WidePixel = (WidePixel << 16) | WidePixel;
 
+    //
+    // Perform hardware acceleration for solid fills where the device supports it
+    //
+    Offset = (DestinationY * Private->ModeData[CurrentMode].HorizontalResolution) + DestinationX;
+    if (BitBltVideoFill (Private, Pixel, Offset, Width, Height, Private->ModeData[CurrentMode].HorizontalResolution)) {
+      break;
+    }
+
     if (DestinationX == 0 && Width == Private->ModeData[CurrentMode].HorizontalResolution) {
       Offset = DestinationY * Private->ModeData[CurrentMode].HorizontalResolution;
       if (((Offset & 0x03) == 0) && (((Width * Height) & 0x03) == 0)) {
@@ -20,6 +20,31 @@
 
 #define I2C_BUS_SPEED           100  //100kbps
 
+//
+// Minimum duration of each bus phase, in microseconds, rounded up from the
+// I2C specification. Every phase is held exactly this long instead of one
+// worst case delay for all of them.
+//
+typedef struct {
+  UINT8    Low;          // tLOW, SCL low period
+  UINT8    High;         // tHIGH, SCL high period
+  UINT8    SetupStart;   // tSU;STA, repeated START setup time
+  UINT8    HoldStart;    // tHD;STA, START hold time
+  UINT8    SetupStop;    // tSU;STO, STOP setup time
+  UINT8    BusFree;      // tBUF, bus free time between STOP and START
+} I2C_TIMING;
+
+STATIC CONST I2C_TIMING  mI2cTiming[] = {
+  { 5, 4, 5, 4, 4, 5 },  // Standard mode, 100kbps
+  { 2, 1, 1, 1, 1, 2 }   // Fast mode, 400kbps
+};
+
+#if I2C_BUS_SPEED >= 400
+#define I2C_TIMING_MODE         (&mI2cTiming[1])
+#else
+#define I2C_TIMING_MODE         (&mI2cTiming[0])
+#endif
+
 /**
   PCI I/O byte write function.
 
@@ -89,7 +114,7 @@ I2cPinRead (
   )
 {
   I2cOutb (PciIo, SEQ_ADDRESS_REGISTER, I2C_CONTROL);
-  return (UINT8) ((I2cInb (PciIo, SEQ_DATA_REGISTER) >> Bit ) & 0xfe);
+  return (UINT8) ((I2cInb (PciIo, SEQ_DATA_REGISTER) >> Bit ) & 0x01);
 }
 
 
@@ -117,15 +142,60 @@ I2cPinWrite (
 }
 
 /**
-  Read/write delay acoording to I2C Bus Speed.
+  Hold the current bus state for the given number of microseconds.
+
+  @param  Time               Duration of the bus phase.
 
 **/
 VOID
 I2cDelay (
-  VOID
+  UINT8                  Time
+  )
+{
+  MicroSecondDelay (Time);
+}
+
+/**
+  Clock one bit onto the I2C bus.
+
+  @param  PciIo              The pointer to PCI_IO_PROTOCOL.
+  @param  Bit                The bit to send.
+
+**/
+VOID
+I2cSendBit (
+  EFI_PCI_IO_PROTOCOL    *PciIo,
+  UINT8                  Bit
+  )
+{
+  I2cPinWrite (PciIo, I2CDAT_OUT, Bit);
+  I2cPinWrite (PciIo, I2CCLK_OUT, 1);
+  I2cDelay (I2C_TIMING_MODE->High);
+  I2cPinWrite (PciIo, I2CCLK_OUT, 0);
+  I2cDelay (I2C_TIMING_MODE->Low);
+}
+
+/**
+  Clock one bit in from the I2C bus.
+
+  @param  PciIo              The pointer to PCI_IO_PROTOCOL.
+
+  Return the level of I2C Data Pin while the clock was high.
+**/
+UINT8
+I2cReceiveBit (
+  EFI_PCI_IO_PROTOCOL    *PciIo
   )
 {
-  MicroSecondDelay (1000 / I2C_BUS_SPEED);
+  UINT8                  Bit;
+
+  I2cPinWrite (PciIo, I2CCLK_OUT, 1);
+  I2cDelay (I2C_TIMING_MODE->High);
+  Bit = I2cPinRead (PciIo, I2CDAT_IN);
+  I2cPinWrite (PciIo, I2CCLK_OUT, 0);
+  I2cDelay (I2C_TIMING_MODE->Low);
+
+  return Bit;
 }
 
 /**
@@ -143,13 +213,10 @@ I2cSendByte (
 {
   UINTN                  Index;
   //
-  // Send byte data onto I2C Bus
+  // Send byte data onto I2C Bus, MSB first
   //
-  for (Index = 0; Index < 8; Index --) {
-    I2cPinWrite (PciIo, I2CDAT_OUT, (UINT8) (Data >> (7 - Index)));
-    I2cPinWrite (PciIo, I2CCLK_OUT, 1);
-    I2cDelay ();
-    I2cPinWrite (PciIo, I2CCLK_OUT, 0);
+  for (Index = 0; Index < 8; Index ++) {
+    I2cSendBit (PciIo, (UINT8) ((Data >> (7 - Index)) & 0x01));
   }
 }
 
@@ -170,14 +237,12 @@ I2cReceiveByte (
 
   Data = 0;
   //
-  // Read byte data from I2C Bus
+  // Release the data line and read byte data from I2C Bus
   //
-  for (Index = 0; Index < 8; Index --) {
-    I2cPinWrite (PciIo, I2CCLK_OUT, 1);
-    I2cDelay ();
+  I2cPinWrite (PciIo, I2CDAT_OUT, 1);
+  for (Index = 0; Index < 8; Index ++) {
     Data = (UINT8) (Data << 1);
-    Data = (UINT8) (Data | I2cPinRead (PciIo, I2CDAT_IN));
-    I2cPinWrite (PciIo, I2CCLK_OUT, 0);
+    Data = (UINT8) (Data | I2cReceiveBit (PciIo));
   }
 
   return Data;
@@ -195,38 +260,31 @@ I2cWaitAck (
   )
 {
   //
-  // Wait for ACK signal
+  // Release the data line, the slave pulls it low to acknowledge
   //
   I2cPinWrite (PciIo, I2CDAT_OUT, 1);
-  I2cPinWrite (PciIo, I2CCLK_OUT, 1);
-  I2cDelay ();
-  if (I2cPinRead (PciIo, I2CDAT_IN) == 0) {
-    I2cPinWrite (PciIo, I2CDAT_OUT, 1);
-    return TRUE;
-  } else {
-    return FALSE;
-  }
+  return (BOOLEAN) (I2cReceiveBit (PciIo) == 0);
 }
 
 /**
-  Send an ACK signal onto I2C Bus.
+  Send an ACK or NACK signal onto I2C Bus.
 
   @param  PciIo              The pointer to PCI_IO_PROTOCOL.
+  @param  Ack                TRUE to acknowledge, FALSE to end the read.
 
 **/
 VOID
 I2cSendAck (
-  EFI_PCI_IO_PROTOCOL    *PciIo
+  EFI_PCI_IO_PROTOCOL    *PciIo,
+  BOOLEAN                Ack
   )
 {
-  I2cPinWrite (PciIo, I2CCLK_OUT, 1);
-  I2cPinWrite (PciIo, I2CDAT_OUT, 1);
-  I2cPinWrite (PciIo, I2CDAT_OUT, 0);
-  I2cPinWrite (PciIo, I2CCLK_OUT, 0);
+  I2cSendBit (PciIo, (UINT8) (Ack ? 0 : 1));
 }
 
 /**
-  Start a I2C transfer on I2C Bus.
+  Start a I2C transfer on I2C Bus, or repeat the start condition if a
+  transfer is in progress.
 
   @param  PciIo              The pointer to PCI_IO_PROTOCOL.
 
@@ -237,15 +295,18 @@ I2cStart (
   )
 {
   //
-  // Init CLK and DAT pins
+  // Release DAT before CLK, so that a repeated start is not taken as a stop
   //
-  I2cPinWrite (PciIo, I2CCLK_OUT, 1);
   I2cPinWrite (PciIo, I2CDAT_OUT, 1);
+  I2cPinWrite (PciIo, I2CCLK_OUT, 1);
+  I2cDelay (I2C_TIMING_MODE->SetupStart);
   //
   // Start a I2C transfer, set SDA low from high, when SCL is high
   //
   I2cPinWrite (PciIo, I2CDAT_OUT, 0);
+  I2cDelay (I2C_TIMING_MODE->HoldStart);
   I2cPinWrite (PciIo, I2CCLK_OUT, 0);
+  I2cDelay (I2C_TIMING_MODE->Low);
 }
 
 /**
@@ -264,19 +325,60 @@ I2cStop (
   //
   I2cPinWrite (PciIo, I2CDAT_OUT, 0);
   I2cPinWrite (PciIo, I2CCLK_OUT, 1);
+  I2cDelay (I2C_TIMING_MODE->SetupStop);
   I2cPinWrite (PciIo, I2CDAT_OUT, 1);
+  I2cDelay (I2C_TIMING_MODE->BusFree);
 }
 
 /**
-  Read one byte data on I2C Bus.
+  Address a register on the slave device for reading.
+
+  @param  PciIo              The pointer to PCI_IO_PROTOCOL.
+  @param  DeviceAddress      Slave device's address.
+  @param  RegisterAddress    The register address on slave device.
+
+  @retval EFI_DEVICE_ERROR   The slave did not acknowledge, the bus is stopped.
+  @retval EFI_SUCCESS        The slave is ready to send data.
+
+**/
+EFI_STATUS
+I2cStartRead (
+  EFI_PCI_IO_PROTOCOL    *PciIo,
+  UINT8                  DeviceAddress,
+  UINT8                  RegisterAddress
+  )
+{
+  //
+  // Start I2C transfer, send slave address with enabling write flag and
+  // the register address, then repeat the start with enabling read flag
+  //
+  I2cStart (PciIo);
+  I2cSendByte (PciIo, (UINT8) (DeviceAddress & 0xfe));
+  if (I2cWaitAck (PciIo)) {
+    I2cSendByte (PciIo, RegisterAddress);
+    if (I2cWaitAck (PciIo)) {
+      I2cStart (PciIo);
+      I2cSendByte (PciIo, (UINT8) (DeviceAddress | 0x01));
+      if (I2cWaitAck (PciIo)) {
+        return EFI_SUCCESS;
+      }
+    }
+  }
+
+  I2cStop (PciIo);
+  return EFI_DEVICE_ERROR;
+}
+
+/**
+  Read consecutive bytes from the slave device in a single transfer.
 
-  Read one byte data from the slave device connectet to I2C Bus.
   If Data is NULL, then ASSERT().
 
   @param  PciIo              The pointer to PCI_IO_PROTOCOL.
   @param  DeviceAddress      Slave device's address.
-  @param  RegisterAddress    The register address on slave device.
-  @param  Data               The pointer to returned data if EFI_SUCCESS returned.
+  @param  RegisterAddress    The first register address on slave device.
+  @param  Length             The number of bytes to read.
+  @param  Data               The buffer for the returned data.
 
   @retval EFI_DEVICE_ERROR
   @retval EFI_SUCCESS
@@ -284,72 +386,62 @@ I2cStop (
 **/
 EFI_STATUS
 EFIAPI
-I2cReadByte (
+I2cReadBlock (
   EFI_PCI_IO_PROTOCOL    *PciIo,
   UINT8                  DeviceAddress,
   UINT8                  RegisterAddress,
+  UINTN                  Length,
   UINT8                  *Data
   )
 {
-  ASSERT (Data != NULL);
-
-  //
-  // Start I2C transfer
-  //
-  I2cStart (PciIo);
+  EFI_STATUS             Status;
+  UINTN                  Index;
 
-  //
-  // Send slave address with enabling write flag
-  //
-  I2cSendByte (PciIo, (UINT8) (DeviceAddress & 0xfe));
+  ASSERT (Data != NULL);
 
-  //
-  // Wait for ACK signal
-  //
-  if (I2cWaitAck (PciIo) == FALSE) {
-    return EFI_DEVICE_ERROR;
+  Status = I2cStartRead (PciIo, DeviceAddress, RegisterAddress);
+  if (EFI_ERROR (Status)) {
+    return Status;
   }
 
   //
-  // Send register address
+  // Acknowledge every byte but the last, which ends the read
   //
-  I2cSendByte (PciIo, RegisterAddress);
-
-  //
-  // Wait for ACK signal
-  //
-  if (I2cWaitAck (PciIo) == FALSE) {
-    return EFI_DEVICE_ERROR;
+  for (Index = 0; Index < Length; Index ++) {
+    Data[Index] = I2cReceiveByte (PciIo);
+    I2cSendAck (PciIo, (BOOLEAN) (Index < Length - 1));
   }
 
-  //
-  // Send slave address with enabling read flag
-  //
-  I2cSendByte (PciIo, (UINT8) (DeviceAddress | 0x01));
+  I2cStop (PciIo);
 
-  //
-  // Wait for ACK signal
-  //
-  if (I2cWaitAck (PciIo) == FALSE) {
-    return EFI_DEVICE_ERROR;
-  }
+  return EFI_SUCCESS;
+}
 
-  //
-  // Read byte data from I2C Bus
-  //
-  *Data = I2cReceiveByte (PciIo);
+/**
+  Read one byte data on I2C Bus.
 
-  //
-  // Send ACK signal onto I2C Bus
-  //
-  I2cSendAck (PciIo);
+  Read one byte data from the slave device connectet to I2C Bus.
+  If Data is NULL, then ASSERT().
 
-  //
-  // Stop a I2C transfer
-  //
-  I2cStop (PciIo);
+  @param  PciIo              The pointer to PCI_IO_PROTOCOL.
+  @param  DeviceAddress      Slave device's address.
+  @param  RegisterAddress    The register address on slave device.
+  @param  Data               The pointer to returned data if EFI_SUCCESS returned.
 
-  return EFI_SUCCESS;
+  @retval EFI_DEVICE_ERROR
+  @retval EFI_SUCCESS
+
+**/
+EFI_STATUS
+EFIAPI
+I2cReadByte (
+  EFI_PCI_IO_PROTOCOL    *PciIo,
+  UINT8                  DeviceAddress,
+  UINT8                  RegisterAddress,
+  UINT8                  *Data
+  )
+{
+  return I2cReadBlock (PciIo, DeviceAddress, RegisterAddress, 1, Data);
 }
 
 /**
@@ -388,6 +480,7 @@ I2cWriteByte (
   // Wait for ACK signal
   //
   if (I2cWaitAck (PciIo) == FALSE) {
+    I2cStop (PciIo);
     return EFI_DEVICE_ERROR;
   }
 
@@ -400,6 +493,7 @@ I2cWriteByte (
   // Wait for ACK signal
   //
   if (I2cWaitAck (PciIo) == FALSE) {
+    I2cStop (PciIo);
     return EFI_DEVICE_ERROR;
   }
 
@@ -412,6 +506,7 @@ I2cWriteByte (
   // Wait for ACK signal
   //
   if (I2cWaitAck (PciIo) == FALSE) {
+    I2cStop (PciIo);
     return EFI_DEVICE_ERROR;
   }
 
@@ -35,6 +35,31 @@ I2cReadByte (
   UINT8                  *Data
   );
 
+/**
+  Read consecutive bytes from the slave device in a single transfer.
+
+  If Data is NULL, then ASSERT().
+
+  @param  PciIo              The pointer to PCI_IO_PROTOCOL.
+  @param  DeviceAddress      Slave device's address.
+  @param  RegisterAddress    The first register address on slave device.
+  @param  Length             The number of bytes to read.
+  @param  Data               The buffer for the returned data.
+
+  @retval EFI_DEVICE_ERROR
+  @retval EFI_SUCCESS
+
+**/
+EFI_STATUS
+EFIAPI
+I2cReadBlock (
+  EFI_PCI_IO_PROTOCOL    *PciIo,
+  UINT8                  DeviceAddress,
+  UINT8                  RegisterAddress,
+  UINTN                  Length,
+  UINT8                  *Data
+  );
+
 /**
   Write one byte data onto I2C Bus.
 
@@ -112,18 +112,29 @@ ReadEdidData (
   UINT8             *ValidEdid;
   UINT64            Signature;
 
-  for (Index = 0; Index < EDID_BLOCK_SIZE * 2; Index ++) {
-    I2cReadByte (Private->PciIo, 0xa0, (UINT8)Index, &EdidData[Index]);
-  }
-
   //
-  // Search for the EDID signature
+  // The EDID nearly always starts at offset 0, so fetch one block over the
+  // slow I2C bus first and only read further when the signature is not there
   //
+  if (EFI_ERROR (I2cReadBlock (Private->PciIo, 0xa0, 0, EDID_BLOCK_SIZE, EdidData))) {
+    return EFI_UNSUPPORTED;
+  }
+
   ValidEdid = &EdidData[0];
   Signature = 0x00ffffffffffff00ull;
-  for (Index = 0; Index < EDID_BLOCK_SIZE * 2; Index ++, ValidEdid ++) {
-    if (CompareMem (ValidEdid, &Signature, 8) == 0) {
-      break;
+  Index     = 0;
+  if (CompareMem (ValidEdid, &Signature, 8) != 0) {
+    if (EFI_ERROR (I2cReadBlock (Private->PciIo, 0xa0, EDID_BLOCK_SIZE, EDID_BLOCK_SIZE, &EdidData[EDID_BLOCK_SIZE]))) {
+      return EFI_UNSUPPORTED;
+    }
+
+    //
+    // Search for the EDID signature
+    //
+    for (Index = 0; Index < EDID_BLOCK_SIZE * 2; Index ++, ValidEdid ++) {
+      if (CompareMem (ValidEdid, &Signature, 8) == 0) {
+        break;
+      }
     }
   }
 
@@ -392,17 +403,16 @@ CirrusLogic5430VideoModeSetup (
     // If EDID Override data doesn't exist or EFI_EDID_OVERRIDE_DONT_OVERRIDE returned,
     // read EDID information through I2C Bus
     //
-    if (ReadEdidData (Private, &EdidDiscoveredDataBlock, &EdidDiscoveredDataSize) == EFI_SUCCESS) {
+    Status = ReadEdidData (Private, &EdidDiscoveredDataBlock, &EdidDiscoveredDataSize);
+    if (Status == EFI_OUT_OF_RESOURCES) {
+      goto Done;
+    }
+    if (Status == EFI_SUCCESS) {
+      //
+      // ReadEdidData already returns a pool copy, publish it as is
+      //
       Private->EdidDiscovered.SizeOfEdid = (UINT32) EdidDiscoveredDataSize;
-     	Private->EdidDiscovered.Edid = (UINT8 *) AllocateCopyPool (
-                                                          EdidDiscoveredDataSize,
-                                                          EdidDiscoveredDataBlock
-     																										  );
-
-      if (NULL == Private->EdidDiscovered.Edid) {
-     	  Status = EFI_OUT_OF_RESOURCES;
-        goto Done;
-      }
+      Private->EdidDiscovered.Edid       = EdidDiscoveredDataBlock;
 
       EdidActiveDataSize  = Private->EdidDiscovered.SizeOfEdid;
       EdidActiveDataBlock = Private->EdidDiscovered.Edid;
@@ -423,16 +433,21 @@ CirrusLogic5430VideoModeSetup (
     //
     if (ParseEdidData ((UINT8 *) EdidActiveDataBlock, &ValidEdidTiming) == TRUE) {
       //
-      // Copy EDID Override Data to EDID Active Data
+      // The discovered EDID is shared with EDID Active, only EDID Override
+      // Data has to be copied since its buffer is freed below
       //
       Private->EdidActive.SizeOfEdid = (UINT32) EdidActiveDataSize;
-      Private->EdidActive.Edid = (UINT8 *) AllocateCopyPool (
-                                             EdidActiveDataSize,
-                                             EdidActiveDataBlock
-                                             );
-      if (NULL == Private->EdidActive.Edid) {
-   		  Status = EFI_OUT_OF_RESOURCES;
-        goto Done;
+      if (EdidActiveDataBlock == Private->EdidDiscovered.Edid) {
+        Private->EdidActive.Edid = EdidActiveDataBlock;
+      } else {
+        Private->EdidActive.Edid = (UINT8 *) AllocateCopyPool (
+                                               EdidActiveDataSize,
+                                               EdidActiveDataBlock
+                                               );
+        if (NULL == Private->EdidActive.Edid) {
+          Status = EFI_OUT_OF_RESOURCES;
+          goto Done;
+        }
       }
     }
   } else {
@@ -514,11 +529,12 @@ Done:
   if (EdidOverrideDataBlock != NULL) {
     FreePool (EdidOverrideDataBlock);
   }
-  if (Private->EdidDiscovered.Edid != NULL) {
-    FreePool (Private->EdidDiscovered.Edid);
+  if ((Private->EdidActive.Edid != NULL) &&
+      (Private->EdidActive.Edid != Private->EdidDiscovered.Edid)) {
+    FreePool (Private->EdidActive.Edid);
   }
   if (Private->EdidDiscovered.Edid != NULL) {
-    FreePool (Private->EdidActive.Edid);
+    FreePool (Private->EdidDiscovered.Edid);
   }
 
   return EFI_DEVICE_ERROR;
@@ -446,13 +446,20 @@ IssueCB (
 {
   UINT16  status;
 
+  //
+  // Chain the new CB first: the CU checks the suspend bit of a CB when it
+  // completes it, so a CU still working on the previous CB runs straight
+  // into this one and the resume below is only a safety net.
+  //
+  cmd_ptr->PrevTCBVirtualLinkPtr->cb_header.command &= ~(CmdSuspend | CmdIntr);
+  MemoryFence ();
+
   wait_for_cmd_done (AdapterInfo->ioaddr + SCBCmd);
 
   //
   // read the CU status, if it is idle, write the address of cb_ptr
   // in the scbpointer and issue a cu_start,
-  // if it is suspended, remove the suspend bit in the previous command
-  // block and issue a resume
+  // if it is active or suspended, issue a resume
   //
   // Ensure that the CU Active Status bit is not on from previous CBs.
   //
@@ -480,8 +487,6 @@ IssueCB (
     //
     // either active or suspended, give a resume
     //
-
-    cmd_ptr->PrevTCBVirtualLinkPtr->cb_header.command &= ~(CmdSuspend | CmdIntr);
     OutByte (AdapterInfo, CU_RESUME, AdapterInfo->ioaddr + SCBCmd);
   }
 
@@ -1684,6 +1689,7 @@ SetupReceiveQueues (
   //
   tail_ptr->cb_header.command = 0xC000;
   AdapterInfo->RFDTailPtr = tail_ptr;
+  AdapterInfo->RxRecycleCount = 0;
   return 0;
 }
 
@@ -1706,20 +1712,34 @@ Recycle_RFD (
   RxFD  *rx_ptr;
   RxFD  *tail_ptr;
   //
-  // change the EL bit and change the AdapterInfo->RxTailPtr
-  // rx_ptr is assumed to be the head of the Q
+  // rx_ptr is assumed to be the head of the Q, RFDs are recycled in ring
+  // order right behind the current tail.
   // AdapterInfo->rx_forwarded[rx_index] = FALSE;
   //
   rx_ptr                    = &AdapterInfo->rx_ring[rx_index];
-  tail_ptr                  = AdapterInfo->RFDTailPtr;
-  //
-  // set el_bit and suspend bit
-  //
-  rx_ptr->cb_header.command = 0xc000;
+  rx_ptr->cb_header.command = 0;
   rx_ptr->cb_header.status    = 0;
   rx_ptr->ActualCount         = 0;
   rx_ptr->forwarded           = FALSE;
+
+  //
+  // The RU stops at the EL bit of the current tail and never looks at the
+  // cleaned RFDs behind it, so they are only given back once a batch is
+  // ready, saving a tail update per received frame.
+  //
+  if (++AdapterInfo->RxRecycleCount < RX_RECYCLE_BATCH) {
+    return ;
+  }
+
+  //
+  // set el_bit and suspend bit on the last RFD of the batch and change the
+  // AdapterInfo->RFDTailPtr
+  //
+  tail_ptr                    = AdapterInfo->RFDTailPtr;
+  rx_ptr->cb_header.command   = 0xc000;
   AdapterInfo->RFDTailPtr     = rx_ptr;
+  AdapterInfo->RxRecycleCount = 0;
+  MemoryFence ();
   //
   // resetting the el_bit.
   //
@@ -14,6 +14,11 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define RX_BUFFER_COUNT 32
 #define TX_BUFFER_COUNT 32
 
+//
+// Number of RFDs recycled before the EL bit is moved to the new tail
+//
+#define RX_RECYCLE_BATCH 8
+
 #define PCI_VENDOR_ID_INTEL 0x8086
 #define PCI_DEVICE_ID_INTEL_82557 0x1229
 #define D100_VENDOR_ID   0x8086
@@ -612,6 +617,7 @@ typedef struct s_data_instance {
   UINT16 xmit_done_head;  // index into the xmit_done array
   UINT16 xmit_done_tail;  // where are we filling now (index into xmit_done)
   UINT16 cur_rx_ind;  // current RX Q head index
+  UINT16 RxRecycleCount;  // RFDs recycled but not yet given back to the RU
   UINT16 FreeCBCount;
 
   BOOLEAN in_interrupt;
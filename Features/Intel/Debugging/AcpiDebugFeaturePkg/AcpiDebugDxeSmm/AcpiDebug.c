@@ -50,6 +50,12 @@ typedef struct {
 
 #define MAX_BUFFER_SIZE     32
 
+//
+// Most messages one SMI prints, so that draining a full buffer does not
+// stretch a single SMI.
+//
+#define MAX_DRAIN_PER_SMI   64
+
 UINT32                      mBufferEnd = 0;
 ACPI_DEBUG_HEAD             *mAcpiDebug = NULL;
 
@@ -61,13 +67,15 @@ EFI_SMM_SYSTEM_TABLE2       *mSmst = NULL;
   @param[in] AcpiDebugAddress   Address of Acpi debug memory buffer.
   @param[in] BufferIndex        Index that starts after the Acpi Debug head.
   @param[in] BufferEnd          End of Acpi debug memory buffer.
+  @param[in] DrainThreshold     Pending message bytes that make ASL trigger the SMI.
 
 **/
 VOID
 PatchAndLoadAcpiTable (
   IN ACPI_DEBUG_HEAD            *AcpiDebugAddress,
   IN UINT32                     BufferIndex,
-  IN UINT32                     BufferEnd
+  IN UINT32                     BufferEnd,
+  IN UINT32                     DrainThreshold
   )
 {
   EFI_STATUS                    Status;
@@ -102,10 +110,10 @@ PatchAndLoadAcpiTable (
   //
 
   //
-  // Count pointer updates, so we can stop after all three pointers are patched.
+  // Count pointer updates, so we can stop after all four names are patched.
   //
   UpdateCounter = 1;
-  for (CurrPtr = (UINT8 *) TableHeader; CurrPtr <= ((UINT8 *) TableHeader + TableHeader->Length) && UpdateCounter < 4; CurrPtr++) {
+  for (CurrPtr = (UINT8 *) TableHeader; CurrPtr <= ((UINT8 *) TableHeader + TableHeader->Length) && UpdateCounter < 5; CurrPtr++) {
     Signature = (UINT32 *) (CurrPtr + 1);
     //
     // patch DPTR (address of Acpi debug memory buffer)
@@ -131,6 +139,14 @@ PatchAndLoadAcpiTable (
       NamePtr->Value  = BufferIndex;
       UpdateCounter++;
     }
+    //
+    // patch DTHR (pending message bytes that trigger the SMI to drain the buffer)
+    //
+    if ((*CurrPtr == AML_NAME_OP) && *Signature == SIGNATURE_32 ('D', 'T', 'H', 'R')) {
+      NamePtr = (NAME_LAYOUT *) CurrPtr;
+      NamePtr->Value  = DrainThreshold;
+      UpdateCounter++;
+    }
   }
 
   //
@@ -226,6 +242,7 @@ AcpiDebugEndOfDxeNotification (
 {
   UINT32        BufferSize;
   UINT32        BufferIndex;
+  UINT32        DrainThreshold;
 
   mAcpiDebug = (ACPI_DEBUG_HEAD *) (UINTN) AllocateAcpiDebugMemory (&BufferSize);
   if (mAcpiDebug != NULL) {
@@ -252,10 +269,18 @@ AcpiDebugEndOfDxeNotification (
     //
     BufferIndex += AD_SIZE;
 
+    //
+    // Drain at least every message and at the latest when half of the ring
+    // is pending, so ASL does not overrun messages not printed yet.
+    //
+    DrainThreshold = PcdGet32 (PcdAcpiDebugSmmDrainThreshold);
+    DrainThreshold = MIN (DrainThreshold, ((BufferSize - AD_SIZE) / 2) & ~(MAX_BUFFER_SIZE - 1));
+    DrainThreshold = MAX (DrainThreshold, MAX_BUFFER_SIZE);
+
     //
     // Patch and Load the SSDT ACPI Tables.
     //
-    PatchAndLoadAcpiTable (mAcpiDebug, BufferIndex, mBufferEnd);
+    PatchAndLoadAcpiTable (mAcpiDebug, BufferIndex, mBufferEnd, DrainThreshold);
 
     mAcpiDebug->Head = BufferIndex;
     mAcpiDebug->Tail = BufferIndex;
@@ -310,9 +335,80 @@ InitializeAcpiDebugDxe (
   return Status;
 }
 
+/**
+  Print the messages ASL queued since the last drain.
+
+  ASL is the only producer and only moves Tail, SMM is the only consumer
+  and only moves Head, so the ring needs no lock. At most MAX_DRAIN_PER_SMI
+  messages are printed, the rest is left for the next SMI.
+
+**/
+VOID
+AcpiDebugDrain (
+  VOID
+  )
+{
+  UINT8             Buffer[MAX_BUFFER_SIZE];
+  UINT32            BufferStart;
+  UINT32            Head;
+  UINT32            Tail;
+  UINTN             Count;
+
+  BufferStart = (UINT32) ((UINTN) mAcpiDebug + AD_SIZE);
+  Head = mAcpiDebug->Head;
+  Tail = mAcpiDebug->Tail;
+
+  //
+  // Validate the fields in mAcpiDebug to ensure there is no harm to SMI handler.
+  // mAcpiDebug is below 4GB and the start address of whole buffer.
+  //
+  if ((mAcpiDebug->BufferSize != (mBufferEnd - (UINT32) (UINTN) mAcpiDebug)) ||
+      (Head < BufferStart) || (Head > mBufferEnd) ||
+      (Tail < BufferStart) || (Tail > mBufferEnd)) {
+    //
+    // If some fields in mAcpiDebug are invaid, return directly.
+    //
+    return;
+  }
+
+  //
+  // Read the messages only after Tail, ASL stores Tail once the message is written.
+  //
+  MemoryFence ();
+
+  for (Count = 0; (Head != Tail) && (Count < MAX_DRAIN_PER_SMI); Count++) {
+    if (Head >= mBufferEnd) {
+      //
+      // We met end of buffer.
+      //
+      Head = BufferStart;
+      if (Head == Tail) {
+        break;
+      }
+    }
+
+    //
+    // skip NULL block
+    //
+    if (*(CHAR8 *) (UINTN) Head != '\0') {
+      ZeroMem (Buffer, MAX_BUFFER_SIZE);
+      AsciiStrnCpyS ((CHAR8 *) Buffer, MAX_BUFFER_SIZE, (CHAR8 *) (UINTN) Head, MAX_BUFFER_SIZE - 1);
+      DEBUG ((DEBUG_INFO | DEBUG_ERROR, "%a%a\n", Buffer, (BOOLEAN) mAcpiDebug->Truncate ? "..." : ""));
+    }
+    Head += MAX_BUFFER_SIZE;
+  }
+
+  if (Head >= mBufferEnd) {
+    Head = BufferStart;
+  }
+  mAcpiDebug->Head = Head;
+}
+
 /**
   Software SMI callback for ACPI Debug which is called from ACPI method.
 
+  ASL only triggers it once enough messages are pending to be worth an SMI.
+
   @param[in]      DispatchHandle    The unique handle assigned to this handler by SmiHandlerRegister().
   @param[in]      Context           Points to an optional handler context which was specified when the
                                     handler was registered.
@@ -332,84 +428,41 @@ AcpiDebugSmmCallback (
   IN OUT UINTN      *CommBufferSize
   )
 {
-  UINT8             Buffer[MAX_BUFFER_SIZE];
+  AcpiDebugDrain ();
 
-  //
-  // Validate the fields in mAcpiDebug to ensure there is no harm to SMI handler.
-  // mAcpiDebug is below 4GB and the start address of whole buffer.
-  //
-  if ((mAcpiDebug->BufferSize != (mBufferEnd - (UINT32) (UINTN) mAcpiDebug)) ||
-      (mAcpiDebug->Head < (UINT32) ((UINTN) mAcpiDebug + AD_SIZE)) ||
-      (mAcpiDebug->Head > mBufferEnd) ||
-      (mAcpiDebug->Tail < (UINT32) ((UINTN) mAcpiDebug + AD_SIZE)) ||
-      (mAcpiDebug->Tail > mBufferEnd)) {
-    //
-    // If some fields in mAcpiDebug are invaid, return directly.
-    //
-    return EFI_SUCCESS;
-  }
+  return EFI_SUCCESS;
+}
 
-  if (!(BOOLEAN)mAcpiDebug->Wrap && ((mAcpiDebug->Head >= (UINT32) ((UINTN) mAcpiDebug + AD_SIZE))
-    && (mAcpiDebug->Head < mAcpiDebug->Tail))){
-    //
-    // If curent ----- buffer + 020
-    //                 ...
-    //                 ... Head
-    //                 ... Data for SMM print
-    //                 ... Tail
-    //                 ... Vacant for ASL input
-    //           ----- buffer end
-    //
-    // skip NULL block
-    //
-    while ((*(CHAR8 *) (UINTN) mAcpiDebug->Head == '\0') && (mAcpiDebug->Head < mAcpiDebug->Tail)) {
-      mAcpiDebug->Head ++;
-    }
+/**
+  Root SMI handler for ACPI Debug, invoked on every SMI.
 
-    if (mAcpiDebug->Head < mAcpiDebug->Tail) {
-      ZeroMem (Buffer, MAX_BUFFER_SIZE);
-      AsciiStrnCpyS ((CHAR8 *) Buffer, MAX_BUFFER_SIZE, (CHAR8 *) (UINTN) mAcpiDebug->Head, MAX_BUFFER_SIZE - 1);
+  Draining here piggybacks on SMIs the platform takes anyway, so the
+  buffer is printed without ASL adding SMIs of its own.
 
-      DEBUG ((DEBUG_INFO | DEBUG_ERROR, "%a%a\n", Buffer, (BOOLEAN) mAcpiDebug->Truncate ? "..." : ""));
-      mAcpiDebug->Head += MAX_BUFFER_SIZE;
+  @param[in]      DispatchHandle    The unique handle assigned to this handler by SmiHandlerRegister().
+  @param[in]      Context           Points to an optional handler context which was specified when the
+                                    handler was registered.
+  @param[in, out] CommBuffer        A pointer to a collection of data in memory that will
+                                    be conveyed from a non-SMM environment into an SMM environment.
+  @param[in, out] CommBufferSize    The size of the CommBuffer.
 
-      if (mAcpiDebug->Head >= (mAcpiDebug->Tail)) {
-        //
-        // When head == tail, we do nothing in handler.
-        //
-        mAcpiDebug->Head = mAcpiDebug->Tail;
-      }
-    }
-  } else if ((BOOLEAN) mAcpiDebug->Wrap && ((mAcpiDebug->Head > mAcpiDebug->Tail)
-    && (mAcpiDebug->Head < (UINT32) ((UINTN) mAcpiDebug + mAcpiDebug->BufferSize)))){
-    //
-    // If curent ----- buffer + 020
-    //                 ... Tail
-    //                 ... Vacant for ASL input
-    //                 ... Head
-    //                 ... Data for SMM print
-    //           ----- buffer end
-    //
-    while ((*(CHAR8 *) (UINTN) mAcpiDebug->Head == '\0') && (mAcpiDebug->Head < (UINT32) ((UINTN) mAcpiDebug + mAcpiDebug->BufferSize))) {
-      mAcpiDebug->Head ++;
-    }
-    if (mAcpiDebug->Head < (UINT32) ((UINTN) mAcpiDebug + mAcpiDebug->BufferSize)){
-      ZeroMem (Buffer, MAX_BUFFER_SIZE);
-      AsciiStrnCpyS ((CHAR8 *) Buffer, MAX_BUFFER_SIZE, (CHAR8 *) (UINTN) mAcpiDebug->Head, MAX_BUFFER_SIZE - 1);
-      DEBUG ((DEBUG_INFO | DEBUG_ERROR, "%a%a\n", Buffer, (BOOLEAN) mAcpiDebug->Truncate ? "..." : ""));
-      mAcpiDebug->Head += MAX_BUFFER_SIZE;
-
-      if (mAcpiDebug->Head >= (UINT32) ((UINTN) mAcpiDebug + mAcpiDebug->BufferSize)) {
-        //
-        // We met end of buffer.
-        //
-        mAcpiDebug->Wrap = 0;
-        mAcpiDebug->Head = (UINT32) ((UINTN) mAcpiDebug + AD_SIZE);
-      }
-    }
+  @retval EFI_WARN_INTERRUPT_SOURCE_PENDING  The SMI source was not handled by this handler.
+
+**/
+EFI_STATUS
+EFIAPI
+AcpiDebugSmmRootHandler (
+  IN EFI_HANDLE     DispatchHandle,
+  IN CONST VOID     *Context,
+  IN OUT VOID       *CommBuffer,
+  IN OUT UINTN      *CommBufferSize
+  )
+{
+  if (mAcpiDebug->Head != mAcpiDebug->Tail) {
+    AcpiDebugDrain ();
   }
 
-  return EFI_SUCCESS;
+  return EFI_WARN_INTERRUPT_SOURCE_PENDING;
 }
 
 /**
@@ -434,6 +487,7 @@ AcpiDebugSmmEndOfDxeNotification (
   EFI_SMM_SW_DISPATCH2_PROTOCOL     *SwDispatch;
   EFI_SMM_SW_REGISTER_CONTEXT       SwContext;
   EFI_HANDLE                        SwHandle;
+  EFI_HANDLE                        RootHandle;
 
   AcpiDebugEndOfDxeNotification (NULL, NULL);
 
@@ -455,6 +509,12 @@ AcpiDebugSmmEndOfDxeNotification (
       return Status;
     }
 
+    Status = mSmst->SmiHandlerRegister (AcpiDebugSmmRootHandler, NULL, &RootHandle);
+    ASSERT_EFI_ERROR (Status);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+
     mAcpiDebug->SmiTrigger = (UINT8) SwContext.SwSmiInputValue;
     mAcpiDebug->SmmVersion = 1;
   }
@@ -11,16 +11,115 @@
 #include <Guid/EventGroup.h>
 #include <Library/PcdLib.h>
 #include <Library/DebugLib.h>
+#include <Library/UefiLib.h>
 #include <Library/ReportStatusCodeLib.h>
 #include <Protocol/ReportStatusCodeHandler.h>
 
 #include <Library/BeepMapLib.h>
 #include <Library/BeepLib.h>
 
+//
+// Beep patterns waiting to be played by the sequencer timer.
+//
+#define BEEP_QUEUE_SIZE           16
+
 EFI_RSC_HANDLER_PROTOCOL  *mBeepRscHandlerProtocol       = NULL;
 EFI_EVENT                 mBeepExitBootServicesEvent     = NULL;
 BOOLEAN                   mBeepRegistered                = FALSE;
 
+EFI_EVENT                 mBeepSequencerEvent            = NULL;
+UINT32                    mBeepQueue[BEEP_QUEUE_SIZE];
+UINTN                     mBeepQueueHead                 = 0;
+UINTN                     mBeepQueueCount                = 0;
+UINT32                    mBeepRemaining                 = 0;
+BOOLEAN                   mBeepPause                     = FALSE;
+
+/**
+  Play the next beep of the queued patterns.
+
+  Each timer tick plays a single beep, and one silent tick separates two
+  patterns so that they can still be told apart.
+
+  @param  Event         Event whose notification function is being invoked.
+  @param  Context       Pointer to the notification function's context, which is
+                        always zero in current implementation.
+
+**/
+VOID
+EFIAPI
+BeepSequencerTick (
+  IN EFI_EVENT        Event,
+  IN VOID             *Context
+  )
+{
+  EFI_TPL             OldTpl;
+  BOOLEAN             PlayBeep;
+
+  OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+  PlayBeep = FALSE;
+  if (mBeepRemaining != 0) {
+    mBeepRemaining--;
+    mBeepPause = (BOOLEAN) (mBeepRemaining == 0);
+    PlayBeep = TRUE;
+  } else if (mBeepPause) {
+    mBeepPause = FALSE;
+  } else if (mBeepQueueCount != 0) {
+    mBeepRemaining = mBeepQueue[mBeepQueueHead] - 1;
+    mBeepQueueHead = (mBeepQueueHead + 1) % BEEP_QUEUE_SIZE;
+    mBeepQueueCount--;
+    mBeepPause = (BOOLEAN) (mBeepRemaining == 0);
+    PlayBeep = TRUE;
+  } else {
+    gBS->SetTimer (mBeepSequencerEvent, TimerCancel, 0);
+  }
+  gBS->RestoreTPL (OldTpl);
+
+  if (PlayBeep) {
+    Beep (1);
+  }
+}
+
+/**
+  Queue a beep pattern for the sequencer.
+
+  @param  BeepValue     Beep count.
+
+  @retval TRUE          The pattern was queued and will be played asynchronously.
+  @retval FALSE         The pattern could not be queued.
+
+**/
+BOOLEAN
+QueueBeep (
+  IN UINT32           BeepValue
+  )
+{
+  EFI_TPL             OldTpl;
+  BOOLEAN             Idle;
+
+  if (mBeepSequencerEvent == NULL) {
+    return FALSE;
+  }
+
+  OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+  if (mBeepQueueCount == BEEP_QUEUE_SIZE) {
+    gBS->RestoreTPL (OldTpl);
+    return FALSE;
+  }
+  Idle = (BOOLEAN) ((mBeepQueueCount == 0) && (mBeepRemaining == 0) && !mBeepPause);
+  mBeepQueue[(mBeepQueueHead + mBeepQueueCount) % BEEP_QUEUE_SIZE] = BeepValue;
+  mBeepQueueCount++;
+  gBS->RestoreTPL (OldTpl);
+
+  if (Idle) {
+    gBS->SetTimer (
+           mBeepSequencerEvent,
+           TimerPeriodic,
+           EFI_TIMER_PERIOD_MILLISECONDS (PcdGet32 (PcdBeepSequencerInterval))
+           );
+  }
+  return TRUE;
+}
+
 /**
   Convert status code value to the times of beep.
 
@@ -57,7 +156,14 @@ BeepStatusCodeReportWorker (
 
   BeepValue = GetBeepValueFromStatusCode (CodeType, Value);
   if (BeepValue != 0) {
-    Beep (BeepValue);
+    //
+    // An unrecovered error may halt the system before the timer fires, so
+    // beep it right away.
+    //
+    if (((CodeType & EFI_STATUS_CODE_SEVERITY_MASK) == EFI_ERROR_UNRECOVERED) ||
+        !QueueBeep (BeepValue)) {
+      Beep (BeepValue);
+    }
   }
 
   return EFI_SUCCESS;
@@ -79,9 +185,30 @@ UnregisterBeepBootTimeHandlers (
   IN VOID             *Context
   )
 {
+  UINT32              Pending;
+
   if (mBeepRegistered) {
     mBeepRscHandlerProtocol->Unregister (BeepStatusCodeReportWorker);
   }
+
+  //
+  // Timers stop with boot services, play what is still queued.
+  //
+  if (mBeepSequencerEvent != NULL) {
+    gBS->CloseEvent (mBeepSequencerEvent);
+    mBeepSequencerEvent = NULL;
+
+    Pending = mBeepRemaining;
+    mBeepRemaining = 0;
+    if (Pending != 0) {
+      Beep (Pending);
+    }
+    while (mBeepQueueCount != 0) {
+      Beep (mBeepQueue[mBeepQueueHead]);
+      mBeepQueueHead = (mBeepQueueHead + 1) % BEEP_QUEUE_SIZE;
+      mBeepQueueCount--;
+    }
+  }
 }
 
 /**
@@ -151,6 +278,21 @@ RuntimeDxeBeepStatusCodeHandlerLibConstructor (
     return EFI_SUCCESS;
   }
 
+  //
+  // Beep patterns are played from a timer so that they do not stall the
+  // boot. Without the event, patterns are played synchronously.
+  //
+  Status = gBS->CreateEvent (
+                  EVT_TIMER | EVT_NOTIFY_SIGNAL,
+                  TPL_CALLBACK,
+                  BeepSequencerTick,
+                  NULL,
+                  &mBeepSequencerEvent
+                  );
+  if (EFI_ERROR (Status)) {
+    mBeepSequencerEvent = NULL;
+  }
+
   Status = gBS->LocateProtocol (
                   &gEfiRscHandlerProtocolGuid,
                   NULL,
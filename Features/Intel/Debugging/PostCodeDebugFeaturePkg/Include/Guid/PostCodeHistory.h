@@ -0,0 +1,47 @@
+/** @file
+  Layout of the post code history region.
+
+  The region holds two rings of timestamped post codes: one for the current
+  boot and one preserved from the previous boot. The platform reserves it at
+  PcdPostCodeHistoryBase so that its contents survive a warm reset.
+
+  Copyright (c) 2020, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef __POST_CODE_HISTORY_GUID_H__
+#define __POST_CODE_HISTORY_GUID_H__
+
+//
+// GUID of the HOB PEI produces once it started the history of this boot.
+// The HOB data is the UINT64 base address of the region.
+//
+#define POST_CODE_HISTORY_GUID \
+  { 0x5b0e4a53, 0x7f2c, 0x4c8e, { 0x9d, 0x61, 0x3a, 0xe8, 0x27, 0xb4, 0x0c, 0x95 } }
+
+#define POST_CODE_HISTORY_SIGNATURE  SIGNATURE_32 ('P', 'C', 'H', 'S')
+
+#define POST_CODE_HISTORY_RINGS      2
+
+typedef struct {
+  UINT64                    Timestamp;      ///< Performance counter value when the post code was emitted.
+  UINT32                    Value;          ///< Status code value the post code was mapped from.
+  UINT32                    PostCode;
+} POST_CODE_HISTORY_ENTRY;
+
+typedef struct {
+  UINT32                    Signature;
+  UINT32                    Capacity;       ///< Entries per ring.
+  UINT32                    Active;         ///< Ring recording the current boot.
+  UINT32                    Count[POST_CODE_HISTORY_RINGS];  ///< Entries recorded into each ring, may exceed Capacity.
+  UINT32                    Reserved;
+  UINT64                    TimerFrequency; ///< Performance counter frequency in Hz.
+  //
+  // POST_CODE_HISTORY_ENTRY  Ring[POST_CODE_HISTORY_RINGS][Capacity];
+  //
+} POST_CODE_HISTORY_HEADER;
+
+extern EFI_GUID gPostCodeHistoryGuid;
+
+#endif
@@ -0,0 +1,73 @@
+/** @file
+  This library class records every post code emitted into a timestamped
+  history that is kept across phases and preserved across warm resets.
+
+  Copyright (c) 2020, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef __POST_CODE_HISTORY_LIB__
+#define __POST_CODE_HISTORY_LIB__
+
+#include <Guid/PostCodeHistory.h>
+
+/**
+  Start the post code history of a new boot.
+
+  The ring of the previous boot is kept, the other ring is cleared and
+  records the current boot. A region without a valid header is initialized.
+
+  @retval RETURN_SUCCESS       The history of this boot was started.
+  @retval RETURN_UNSUPPORTED   No history region is configured.
+
+**/
+RETURN_STATUS
+EFIAPI
+PostCodeHistoryStartBoot (
+  VOID
+  );
+
+/**
+  Record a post code into the history of the current boot.
+
+  @param  PostCode         The post code emitted.
+  @param  Value            The status code value the post code was mapped from.
+
+**/
+VOID
+EFIAPI
+PostCodeHistoryRecord (
+  IN UINT32                         PostCode,
+  IN EFI_STATUS_CODE_VALUE          Value
+  );
+
+/**
+  Get recorded post codes, oldest first.
+
+  When more post codes were recorded than the ring holds, only the most
+  recent ones are available.
+
+  @param  LastBoot         TRUE to get the history of the previous boot,
+                           FALSE for the current boot.
+  @param  Buffer           Buffer receiving the entries.
+  @param  Count            On input the number of entries Buffer can hold.
+                           On output the number of entries returned.
+  @param  TimerFrequency   Optional, returns the frequency of the timestamps in Hz.
+
+  @retval RETURN_SUCCESS           The entries were returned.
+  @retval RETURN_UNSUPPORTED       No valid history region is configured.
+  @retval RETURN_BUFFER_TOO_SMALL  Buffer is too small, Count returns the
+                                   number of entries available.
+
+**/
+RETURN_STATUS
+EFIAPI
+PostCodeHistoryGetEntries (
+  IN     BOOLEAN                    LastBoot,
+  OUT    POST_CODE_HISTORY_ENTRY    *Buffer,
+  IN OUT UINTN                      *Count,
+  OUT    UINT64                     *TimerFrequency OPTIONAL
+  );
+
+#endif
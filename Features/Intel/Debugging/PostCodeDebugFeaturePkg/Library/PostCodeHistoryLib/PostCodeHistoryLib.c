@@ -0,0 +1,230 @@
+/** @file
+  PostCodeHistory implementation.
+
+  Copyright (c) 2020, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Base.h>
+#include <Uefi.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/PcdLib.h>
+#include <Library/TimerLib.h>
+#include <Library/PostCodeHistoryLib.h>
+
+/**
+  Get the number of entries per ring the configured region holds.
+
+  @return Entries per ring, 0 if no history region is configured.
+
+**/
+UINT32
+GetPostCodeHistoryCapacity (
+  VOID
+  )
+{
+  UINT32 Size;
+
+  if (PcdGet64 (PcdPostCodeHistoryBase) == 0) {
+    return 0;
+  }
+
+  Size = PcdGet32 (PcdPostCodeHistorySize);
+  if (Size <= sizeof (POST_CODE_HISTORY_HEADER)) {
+    return 0;
+  }
+
+  return (UINT32) ((Size - sizeof (POST_CODE_HISTORY_HEADER)) / (POST_CODE_HISTORY_RINGS * sizeof (POST_CODE_HISTORY_ENTRY)));
+}
+
+/**
+  Get the history region if it holds a valid header.
+
+  @return The history region, NULL if none is configured or it is not valid.
+
+**/
+POST_CODE_HISTORY_HEADER *
+GetPostCodeHistory (
+  VOID
+  )
+{
+  POST_CODE_HISTORY_HEADER *History;
+  UINT32                   Capacity;
+
+  Capacity = GetPostCodeHistoryCapacity ();
+  if (Capacity == 0) {
+    return NULL;
+  }
+
+  History = (POST_CODE_HISTORY_HEADER *) (UINTN) PcdGet64 (PcdPostCodeHistoryBase);
+  if ((History->Signature != POST_CODE_HISTORY_SIGNATURE) ||
+      (History->Capacity != Capacity) ||
+      (History->Active >= POST_CODE_HISTORY_RINGS)) {
+    return NULL;
+  }
+
+  return History;
+}
+
+/**
+  Get the first entry of a ring.
+
+  @param  History          The history region.
+  @param  Ring             The ring index.
+
+  @return The first entry of the ring.
+
+**/
+POST_CODE_HISTORY_ENTRY *
+GetPostCodeHistoryRing (
+  IN POST_CODE_HISTORY_HEADER *History,
+  IN UINT32                   Ring
+  )
+{
+  return (POST_CODE_HISTORY_ENTRY *) (History + 1) + (UINTN) Ring * History->Capacity;
+}
+
+/**
+  Start the post code history of a new boot.
+
+  The ring of the previous boot is kept, the other ring is cleared and
+  records the current boot. A region without a valid header is initialized.
+
+  @retval RETURN_SUCCESS       The history of this boot was started.
+  @retval RETURN_UNSUPPORTED   No history region is configured.
+
+**/
+RETURN_STATUS
+EFIAPI
+PostCodeHistoryStartBoot (
+  VOID
+  )
+{
+  POST_CODE_HISTORY_HEADER *History;
+  UINT32                   Capacity;
+
+  Capacity = GetPostCodeHistoryCapacity ();
+  if (Capacity == 0) {
+    return RETURN_UNSUPPORTED;
+  }
+
+  History = GetPostCodeHistory ();
+  if (History == NULL) {
+    //
+    // Cold boot, or the region was never used: nothing to preserve.
+    //
+    History = (POST_CODE_HISTORY_HEADER *) (UINTN) PcdGet64 (PcdPostCodeHistoryBase);
+    ZeroMem (History, sizeof (*History));
+    History->Signature = POST_CODE_HISTORY_SIGNATURE;
+    History->Capacity  = Capacity;
+  } else {
+    History->Active = (History->Active + 1) % POST_CODE_HISTORY_RINGS;
+  }
+
+  History->Count[History->Active] = 0;
+  History->TimerFrequency         = GetPerformanceCounterProperties (NULL, NULL);
+
+  return RETURN_SUCCESS;
+}
+
+/**
+  Record a post code into the history of the current boot.
+
+  @param  PostCode         The post code emitted.
+  @param  Value            The status code value the post code was mapped from.
+
+**/
+VOID
+EFIAPI
+PostCodeHistoryRecord (
+  IN UINT32                         PostCode,
+  IN EFI_STATUS_CODE_VALUE          Value
+  )
+{
+  POST_CODE_HISTORY_HEADER *History;
+  POST_CODE_HISTORY_ENTRY  *Entry;
+
+  History = GetPostCodeHistory ();
+  if (History == NULL) {
+    return;
+  }
+
+  Entry = GetPostCodeHistoryRing (History, History->Active) + History->Count[History->Active] % History->Capacity;
+  Entry->Timestamp = GetPerformanceCounter ();
+  Entry->Value     = Value;
+  Entry->PostCode  = PostCode;
+  History->Count[History->Active]++;
+}
+
+/**
+  Get recorded post codes, oldest first.
+
+  When more post codes were recorded than the ring holds, only the most
+  recent ones are available.
+
+  @param  LastBoot         TRUE to get the history of the previous boot,
+                           FALSE for the current boot.
+  @param  Buffer           Buffer receiving the entries.
+  @param  Count            On input the number of entries Buffer can hold.
+                           On output the number of entries returned.
+  @param  TimerFrequency   Optional, returns the frequency of the timestamps in Hz.
+
+  @retval RETURN_SUCCESS           The entries were returned.
+  @retval RETURN_UNSUPPORTED       No valid history region is configured.
+  @retval RETURN_BUFFER_TOO_SMALL  Buffer is too small, Count returns the
+                                   number of entries available.
+
+**/
+RETURN_STATUS
+EFIAPI
+PostCodeHistoryGetEntries (
+  IN     BOOLEAN                    LastBoot,
+  OUT    POST_CODE_HISTORY_ENTRY    *Buffer,
+  IN OUT UINTN                      *Count,
+  OUT    UINT64                     *TimerFrequency OPTIONAL
+  )
+{
+  POST_CODE_HISTORY_HEADER *History;
+  POST_CODE_HISTORY_ENTRY  *Ring;
+  UINT32                   RingIndex;
+  UINT32                   Recorded;
+  UINTN                    Available;
+  UINTN                    First;
+  UINTN                    Head;
+
+  History = GetPostCodeHistory ();
+  if (History == NULL) {
+    return RETURN_UNSUPPORTED;
+  }
+
+  RingIndex = History->Active;
+  if (LastBoot) {
+    RingIndex = (RingIndex + POST_CODE_HISTORY_RINGS - 1) % POST_CODE_HISTORY_RINGS;
+  }
+  Ring      = GetPostCodeHistoryRing (History, RingIndex);
+  Recorded  = History->Count[RingIndex];
+  Available = MIN (Recorded, History->Capacity);
+
+  if (*Count < Available) {
+    *Count = Available;
+    return RETURN_BUFFER_TOO_SMALL;
+  }
+
+  //
+  // Once the ring wrapped, the oldest entry is the one to be overwritten next.
+  //
+  First = (Recorded > History->Capacity) ? Recorded % History->Capacity : 0;
+  Head  = History->Capacity - First;
+  if (Head > Available) {
+    Head = Available;
+  }
+  CopyMem (Buffer, Ring + First, Head * sizeof (POST_CODE_HISTORY_ENTRY));
+  CopyMem (Buffer + Head, Ring, (Available - Head) * sizeof (POST_CODE_HISTORY_ENTRY));
+
+  *Count = Available;
+  if (TimerFrequency != NULL) {
+    *TimerFrequency = History->TimerFrequency;
+  }
+  return RETURN_SUCCESS;
+}
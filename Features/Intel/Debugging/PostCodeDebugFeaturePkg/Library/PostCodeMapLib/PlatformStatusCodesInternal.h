@@ -267,4 +267,18 @@ typedef struct{
 #define DXE_NO_CON_OUT                        (EFI_PERIPHERAL_LOCAL_CONSOLE | EFI_P_EC_NOT_DETECTED)
 #define DXE_NO_CON_IN                         (EFI_PERIPHERAL_KEYBOARD | EFI_P_EC_NOT_DETECTED)
 
+//
+// Status code maps, indexed by STATUS_CODE_TYPE () - 1. Each map ends with a {0, 0} entry.
+//
+#define POST_CODE_MAP_COUNT                   2
+
+extern STATUS_CODE_TO_DATA_MAP  *mPostCodeStatusCodesMap[POST_CODE_MAP_COUNT];
+
+//
+// Set by the sorting constructor of the instances whose data is writable. The maps
+// are then sorted by Value and mPostCodeMapEntries holds the entry count of each.
+//
+extern BOOLEAN                  mPostCodeMapSorted;
+extern UINTN                    mPostCodeMapEntries[POST_CODE_MAP_COUNT];
+
 #endif
@@ -143,7 +143,7 @@ STATUS_CODE_TO_DATA_MAP mPostCodeErrorMap[] = {
   {0,0}
 };
 
-STATUS_CODE_TO_DATA_MAP *mPostCodeStatusCodesMap[] = {
+STATUS_CODE_TO_DATA_MAP *mPostCodeStatusCodesMap[POST_CODE_MAP_COUNT] = {
   //#define EFI_PROGRESS_CODE 0x00000001
   mPostCodeProgressMap,
   //#define EFI_ERROR_CODE 0x00000002
@@ -151,6 +151,9 @@ STATUS_CODE_TO_DATA_MAP *mPostCodeStatusCodesMap[] = {
   //#define EFI_DEBUG_CODE 0x00000003
 };
 
+BOOLEAN mPostCodeMapSorted = FALSE;
+UINTN   mPostCodeMapEntries[POST_CODE_MAP_COUNT];
+
 /**
   Find the post code data from status code value.
 
@@ -175,6 +178,48 @@ FindPostCodeData (
   return 0;
 }
 
+/**
+  Find the post code data from status code value in a map sorted by value.
+
+  @param  Map              The sorted map used to find in.
+  @param  Entries          The number of entries in the map.
+  @param  Value            The status code value.
+
+  @return PostCode         0 for not found.
+
+**/
+UINT32
+FindPostCodeDataSorted (
+  IN STATUS_CODE_TO_DATA_MAP *Map,
+  IN UINTN                   Entries,
+  IN EFI_STATUS_CODE_VALUE   Value
+  )
+{
+  UINTN Low;
+  UINTN High;
+  UINTN Middle;
+
+  //
+  // Find the first entry not below Value, so duplicates resolve to the
+  // same entry the linear search would have found.
+  //
+  Low  = 0;
+  High = Entries;
+  while (Low < High) {
+    Middle = Low + (High - Low) / 2;
+    if (Map[Middle].Value < Value) {
+      Low = Middle + 1;
+    } else {
+      High = Middle;
+    }
+  }
+
+  if ((Low < Entries) && (Map[Low].Value == Value)) {
+    return Map[Low].Data;
+  }
+  return 0;
+}
+
 /**
   Get PostCode from status code type and value.
 
@@ -203,5 +248,13 @@ GetPostCodeFromStatusCode (
     return 0;
   }
 
+  if (mPostCodeMapSorted) {
+    return FindPostCodeDataSorted (
+             mPostCodeStatusCodesMap[CodeTypeIndex],
+             mPostCodeMapEntries[CodeTypeIndex],
+             Value
+             );
+  }
+
   return FindPostCodeData (mPostCodeStatusCodesMap[CodeTypeIndex], Value);
 }
@@ -0,0 +1,73 @@
+/** @file
+  Sort the PostCode maps for the instances whose data is writable.
+
+  PEI and SEC may run from flash and keep searching the maps linearly; DXE and
+  SMM sort them once here and look status codes up with a binary search.
+
+  Copyright (c) 2010 - 2020, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Base.h>
+#include <Uefi.h>
+
+#include "PlatformStatusCodesInternal.h"
+
+/**
+  Sort one map by status code value in place.
+
+  Insertion sort keeps entries with the same value in their original order.
+
+  @param  Map              The map to sort.
+
+  @return The number of entries in the map, not counting the {0, 0} terminator.
+
+**/
+UINTN
+SortPostCodeMap (
+  IN OUT STATUS_CODE_TO_DATA_MAP *Map
+  )
+{
+  UINTN                   Entries;
+  UINTN                   Index;
+  UINTN                   Position;
+  STATUS_CODE_TO_DATA_MAP Entry;
+
+  for (Entries = 0; Map[Entries].Value != 0; Entries++) {
+  }
+
+  for (Index = 1; Index < Entries; Index++) {
+    Entry    = Map[Index];
+    Position = Index;
+    while ((Position > 0) && (Map[Position - 1].Value > Entry.Value)) {
+      Map[Position] = Map[Position - 1];
+      Position--;
+    }
+    Map[Position] = Entry;
+  }
+
+  return Entries;
+}
+
+/**
+  Constructor function of DxeSmmPostCodeMapLib.
+
+  @retval RETURN_SUCCESS   The maps are sorted.
+
+**/
+RETURN_STATUS
+EFIAPI
+PostCodeMapLibSortConstructor (
+  VOID
+  )
+{
+  UINTN Index;
+
+  for (Index = 0; Index < POST_CODE_MAP_COUNT; Index++) {
+    mPostCodeMapEntries[Index] = SortPostCodeMap (mPostCodeStatusCodesMap[Index]);
+  }
+  mPostCodeMapSorted = TRUE;
+
+  return RETURN_SUCCESS;
+}
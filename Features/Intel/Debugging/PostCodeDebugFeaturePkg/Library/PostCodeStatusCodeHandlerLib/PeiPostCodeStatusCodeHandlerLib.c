@@ -11,10 +11,27 @@
 #include <Library/PcdLib.h>
 #include <Library/DebugLib.h>
 #include <Library/ReportStatusCodeLib.h>
+#include <Library/HobLib.h>
 #include <Ppi/ReportStatusCodeHandler.h>
+#include <Ppi/MemoryDiscovered.h>
 
 #include <Library/PostCodeMapLib.h>
 #include <Library/PostCodeLib.h>
+#include <Library/PostCodeHistoryLib.h>
+
+EFI_STATUS
+EFIAPI
+PostCodeHistoryMemoryDiscoveredNotify (
+  IN EFI_PEI_SERVICES           **PeiServices,
+  IN EFI_PEI_NOTIFY_DESCRIPTOR  *NotifyDescriptor,
+  IN VOID                       *Ppi
+  );
+
+EFI_PEI_NOTIFY_DESCRIPTOR mPostCodeHistoryNotifyList = {
+  (EFI_PEI_PPI_DESCRIPTOR_NOTIFY_CALLBACK | EFI_PEI_PPI_DESCRIPTOR_TERMINATE_LIST),
+  &gEfiPeiMemoryDiscoveredPpiGuid,
+  PostCodeHistoryMemoryDiscoveredNotify
+};
 
 /**
   Convert status code value and write data to post code.
@@ -56,11 +73,60 @@ PostCodeStatusCodeReportWorker (
   if (PostCodeValue != 0) {
     DEBUG ((EFI_D_INFO, "POSTCODE=<%02x>\n", PostCodeValue));
     PostCode (PostCodeValue);
+
+    //
+    // The history region is in memory, so it is only written once the
+    // history of this boot has been started after memory is discovered.
+    //
+    if (GetFirstGuidHob (&gPostCodeHistoryGuid) != NULL) {
+      PostCodeHistoryRecord (PostCodeValue, Value);
+    }
   }
 
   return EFI_SUCCESS;
 }
 
+/**
+  Start the post code history of this boot once permanent memory is available.
+
+  The history of the interrupted boot is kept on S3 resume, where the boot
+  continues rather than starts over.
+
+  @param  PeiServices       An indirect pointer to the EFI_PEI_SERVICES table published by the PEI Foundation.
+  @param  NotifyDescriptor  Address of the notification descriptor data structure.
+  @param  Ppi               Address of the PPI that was installed.
+
+  @retval EFI_SUCCESS       The history was started, or there is none.
+
+**/
+EFI_STATUS
+EFIAPI
+PostCodeHistoryMemoryDiscoveredNotify (
+  IN EFI_PEI_SERVICES           **PeiServices,
+  IN EFI_PEI_NOTIFY_DESCRIPTOR  *NotifyDescriptor,
+  IN VOID                       *Ppi
+  )
+{
+  EFI_STATUS                  Status;
+  EFI_BOOT_MODE               BootMode;
+  UINT64                      HistoryBase;
+
+  HistoryBase = PcdGet64 (PcdPostCodeHistoryBase);
+  if (HistoryBase == 0) {
+    return EFI_SUCCESS;
+  }
+
+  Status = PeiServicesGetBootMode (&BootMode);
+  if (EFI_ERROR (Status) || (BootMode != BOOT_ON_S3_RESUME)) {
+    if (RETURN_ERROR (PostCodeHistoryStartBoot ())) {
+      return EFI_SUCCESS;
+    }
+  }
+
+  BuildGuidDataHob (&gPostCodeHistoryGuid, &HistoryBase, sizeof (HistoryBase));
+  return EFI_SUCCESS;
+}
+
 /**
   Constructor function of PeiPostCodeStatusCodeHandlerLib.
 
@@ -98,5 +164,10 @@ PeiPostCodeStatusCodeHandlerLibConstructor (
   Status = RscHandlerPpi->Register (PostCodeStatusCodeReportWorker);
   ASSERT_EFI_ERROR (Status);
 
+  if (PcdGet64 (PcdPostCodeHistoryBase) != 0) {
+    Status = PeiServicesNotifyPpi (&mPostCodeHistoryNotifyList);
+    ASSERT_EFI_ERROR (Status);
+  }
+
   return RETURN_SUCCESS;
 }
@@ -17,6 +17,7 @@
 
 #include <Library/PostCodeMapLib.h>
 #include <Library/PostCodeLib.h>
+#include <Library/PostCodeHistoryLib.h>
 
 EFI_RSC_HANDLER_PROTOCOL  *mPostCodeRscHandlerProtocol       = NULL;
 EFI_EVENT                 mPostCodeExitBootServicesEvent     = NULL;
@@ -60,6 +61,7 @@ PostCodeStatusCodeReportWorker (
   if (PostCodeValue != 0) {
     DEBUG ((EFI_D_INFO, "POSTCODE=<%02x>\n", PostCodeValue));
     PostCode (PostCodeValue);
+    PostCodeHistoryRecord (PostCodeValue, Value);
   }
 
   return EFI_SUCCESS;
@@ -155,6 +157,14 @@ RuntimeDxePostCodeStatusCodeHandlerLibConstructor (
     return EFI_SUCCESS;
   }
 
+  //
+  // PEI starts the history of the boot once memory is discovered; start
+  // it here if the PEI handler did not.
+  //
+  if ((PcdGet64 (PcdPostCodeHistoryBase) != 0) && (GetFirstGuidHob (&gPostCodeHistoryGuid) == NULL)) {
+    PostCodeHistoryStartBoot ();
+  }
+
   Status = gBS->LocateProtocol (
                   &gEfiRscHandlerProtocolGuid,
                   NULL,
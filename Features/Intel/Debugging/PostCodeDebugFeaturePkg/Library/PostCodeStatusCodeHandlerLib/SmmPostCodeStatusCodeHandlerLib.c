@@ -16,6 +16,7 @@
 
 #include <Library/PostCodeLib.h>
 #include <Library/PostCodeMapLib.h>
+#include <Library/PostCodeHistoryLib.h>
 
 
 /**
@@ -56,6 +57,7 @@ PostCodeStatusCodeReportWorker (
   if (PostCodeValue != 0) {
     DEBUG ((EFI_D_INFO, "POSTCODE=<%02x>\n", PostCodeValue));
     PostCode (PostCodeValue);
+    PostCodeHistoryRecord (PostCodeValue, Value);
   }
 
   return EFI_SUCCESS;
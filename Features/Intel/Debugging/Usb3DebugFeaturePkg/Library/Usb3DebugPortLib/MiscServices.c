@@ -157,6 +157,10 @@ Usb3DebugPortPoll (
   VOID
   )
 {
+  //
+  // Push out any output still sitting in the write buffer
+  //
+  Usb3DbgFlush ();
   return FALSE;
 }
 
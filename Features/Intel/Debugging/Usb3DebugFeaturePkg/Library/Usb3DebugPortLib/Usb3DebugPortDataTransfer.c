@@ -213,6 +213,42 @@ IsTransferRingTrb (
   return FALSE;
 }
 
+/**
+  Advance the event ring dequeue pointer of the controller to the last entry
+  handled by software.
+
+  @param  Xhc             The XHCI Instance.
+
+**/
+VOID
+XhcUpdateEventRingDequeue (
+  IN  USB3_DEBUG_PORT_INSTANCE *Xhc
+  )
+{
+  UINT64                  XhcDequeue;
+  UINT32                  High;
+  UINT32                  Low;
+
+  //
+  // Advance event ring to last available entry
+  //
+  // Some 3rd party XHCI external cards don't support single 64-bytes width register access,
+  // So divide it to two 32-bytes width register access.
+  //
+  Low  = XhcReadDebugReg (Xhc, XHC_DC_DCERDP);
+  High = XhcReadDebugReg (Xhc, XHC_DC_DCERDP + 4);
+  XhcDequeue = (UINT64)(LShiftU64((UINT64)High, 32) | Low);
+
+  if ((XhcDequeue & (~0x0F)) != ((UINT64)(UINTN)Xhc->EventRing.EventRingDequeue & (~0x0F))) {
+    //
+    // Some 3rd party XHCI external cards don't support single 64-bytes width register access,
+    // So divide it to two 32-bytes width register access.
+    //
+    XhcWriteDebugReg (Xhc, XHC_DC_DCERDP, XHC_LOW_32BIT (Xhc->EventRing.EventRingDequeue));
+    XhcWriteDebugReg (Xhc, XHC_DC_DCERDP + 4, XHC_HIGH_32BIT (Xhc->EventRing.EventRingDequeue));
+  }
+}
+
 /**
   Check the URB's execution result and update the URB's
   result accordingly.
@@ -235,9 +271,6 @@ XhcCheckUrbResult (
   UINT8                   TRBType;
   EFI_STATUS              Status;
   URB                     *CheckedUrb;
-  UINT64                  XhcDequeue;
-  UINT32                  High;
-  UINT32                  Low;
 
   ASSERT ((Xhc != NULL) && (Urb != NULL));
 
@@ -342,24 +375,7 @@ XhcCheckUrbResult (
   }
 
 EXIT:
-  //
-  // Advance event ring to last available entry
-  //
-  // Some 3rd party XHCI external cards don't support single 64-bytes width register access,
-  // So divide it to two 32-bytes width register access.
-  //
-  Low  = XhcReadDebugReg (Xhc, XHC_DC_DCERDP);
-  High = XhcReadDebugReg (Xhc, XHC_DC_DCERDP + 4);
-  XhcDequeue = (UINT64)(LShiftU64((UINT64)High, 32) | Low);
-
-  if ((XhcDequeue & (~0x0F)) != ((UINT64)(UINTN)Xhc->EventRing.EventRingDequeue & (~0x0F))) {
-    //
-    // Some 3rd party XHCI external cards don't support single 64-bytes width register access,
-    // So divide it to two 32-bytes width register access.
-    //
-    XhcWriteDebugReg (Xhc, XHC_DC_DCERDP, XHC_LOW_32BIT (Xhc->EventRing.EventRingDequeue));
-    XhcWriteDebugReg (Xhc, XHC_DC_DCERDP + 4, XHC_HIGH_32BIT (Xhc->EventRing.EventRingDequeue));
-  }
+  XhcUpdateEventRingDequeue (Xhc);
 
   return Status;
 }
@@ -697,6 +713,198 @@ Usb3DebugIsAddressInSmram (
   return FALSE;
 }
 
+/**
+  Reap the completion events of the output URBs in flight.
+
+  Each output buffer fits in a single TRB, so a URB is complete once the event
+  of its last TRB has been seen. Events of other rings are dropped, which is
+  fine since IN transfers only run once all output has completed.
+
+  @param  Xhc                   The instance of debug device.
+
+**/
+VOID
+XhcCheckOutputResult (
+  IN USB3_DEBUG_PORT_INSTANCE   *Xhc
+  )
+{
+  EVT_TRB_TRANSFER              *EvtTrb;
+  EFI_PHYSICAL_ADDRESS          TrbPtr;
+  URB                           *Urb;
+  UINTN                         Index;
+  UINTN                         UrbIndex;
+
+  XhcSyncEventRing (Xhc, &Xhc->EventRing);
+
+  for (Index = 0; Index < Xhc->EventRing.TrbNumber; Index++) {
+    if (XhcCheckNewEvent (Xhc, &Xhc->EventRing, (TRB_TEMPLATE **) &EvtTrb) == EFI_NOT_READY) {
+      break;
+    }
+    if (EvtTrb->Type != TRB_TYPE_TRANS_EVENT) {
+      continue;
+    }
+
+    TrbPtr = (EFI_PHYSICAL_ADDRESS) (EvtTrb->TRBPtrLo | LShiftU64 ((UINT64) EvtTrb->TRBPtrHi, 32));
+    for (UrbIndex = 0; UrbIndex < XHC_DEBUG_PORT_OUT_BUFFER_NUMBER; UrbIndex++) {
+      Urb = &Xhc->OutUrb[UrbIndex];
+      if (!Urb->Finished && (Urb->TrbEnd == TrbPtr)) {
+        if ((EvtTrb->Completecode != TRB_COMPLETION_SUCCESS) &&
+            (EvtTrb->Completecode != TRB_COMPLETION_SHORT_PACKET)) {
+          Urb->Result |= EFI_USB_ERR_TIMEOUT;
+        }
+        Urb->Finished = TRUE;
+        break;
+      }
+    }
+  }
+
+  XhcUpdateEventRingDequeue (Xhc);
+}
+
+/**
+  Wait until an output URB, or all of them, have completed.
+
+  @param  Xhc                   The instance of debug device.
+  @param  Urb                   The output URB to wait for, or NULL to wait for
+                                all output URBs.
+
+  @retval EFI_SUCCESS           The output URBs have completed.
+  @retval EFI_DEVICE_ERROR      The debug host went away, the output URBs in
+                                flight were abandoned.
+
+**/
+EFI_STATUS
+XhcWaitOutput (
+  IN USB3_DEBUG_PORT_INSTANCE   *Xhc,
+  IN URB                        *Urb  OPTIONAL
+  )
+{
+  UINTN                         Index;
+  BOOLEAN                       Finished;
+
+  while (TRUE) {
+    XhcCheckOutputResult (Xhc);
+
+    Finished = TRUE;
+    for (Index = 0; Index < XHC_DEBUG_PORT_OUT_BUFFER_NUMBER; Index++) {
+      if (((Urb == NULL) || (Urb == &Xhc->OutUrb[Index])) && !Xhc->OutUrb[Index].Finished) {
+        Finished = FALSE;
+      }
+    }
+    if (Finished) {
+      return EFI_SUCCESS;
+    }
+
+    if ((XhcReadDebugReg (Xhc, XHC_DC_DCCTRL) & BIT0) == 0) {
+      //
+      // Debug host is gone, nothing in flight will complete
+      //
+      for (Index = 0; Index < XHC_DEBUG_PORT_OUT_BUFFER_NUMBER; Index++) {
+        Xhc->OutUrb[Index].Finished = TRUE;
+      }
+      return EFI_DEVICE_ERROR;
+    }
+    MicroSecondDelay (XHC_POLL_DELAY);
+  }
+}
+
+/**
+  Send the output accumulated in the current output buffer as a single bulk
+  transfer and move on to the next output buffer.
+
+  Unless PcdUsb3DebugPortAsyncWrite is TRUE, wait for the transfer to complete.
+
+  @param  Xhc                   The instance of debug device.
+
+  @retval EFI_SUCCESS           The accumulated output was sent or queued, or
+                                there was nothing to send.
+  @retval Others                The transfer failed and the output was dropped.
+
+**/
+EFI_STATUS
+XhcFlushOutput (
+  IN USB3_DEBUG_PORT_INSTANCE   *Xhc
+  )
+{
+  EFI_STATUS                    Status;
+  URB                           *Urb;
+
+  if (Xhc->OutDataLength == 0) {
+    return EFI_SUCCESS;
+  }
+
+  Urb          = &Xhc->OutUrb[Xhc->OutIndex];
+  Urb->DataLen = Xhc->OutDataLength;
+  Status = XhcCreateTransferTrb (Xhc, Urb);
+  ASSERT_EFI_ERROR (Status);
+  XhcRingDoorBell (Xhc, Urb);
+
+  Xhc->OutIndex      = (Xhc->OutIndex + 1) % XHC_DEBUG_PORT_OUT_BUFFER_NUMBER;
+  Xhc->OutDataLength = 0;
+
+  if (!FeaturePcdGet (PcdUsb3DebugPortAsyncWrite)) {
+    Status = XhcWaitOutput (Xhc, Urb);
+    if (!EFI_ERROR (Status) && (Urb->Result != EFI_USB_NOERROR)) {
+      Status = EFI_DEVICE_ERROR;
+    }
+  }
+  return Status;
+}
+
+/**
+  Accumulate output in the output buffers of the instance, sending a buffer
+  when it is full or when the output ends with a newline.
+
+  Completed transfers are reaped on the way, and a write only waits when the
+  next output buffer is still in flight.
+
+  @param  Xhc          The instance of debug device.
+  @param  Data         Data buffer. May be NULL if Length is 0.
+  @param  Length       On input, the data length; 0 only sends the output
+                       accumulated so far. On output, the number of bytes
+                       accepted.
+
+**/
+VOID
+XhcQueueOutput (
+  IN     USB3_DEBUG_PORT_INSTANCE   *Xhc,
+  IN     UINT8                      *Data,
+  IN OUT UINTN                      *Length
+  )
+{
+  UINTN                             Queued;
+  UINTN                             Bytes;
+  BOOLEAN                           Flush;
+  URB                               *Urb;
+
+  XhcCheckOutputResult (Xhc);
+
+  Flush  = (BOOLEAN) ((*Length == 0) || (Data[*Length - 1] == '\n'));
+  Queued = 0;
+  while (Queued < *Length) {
+    Urb = &Xhc->OutUrb[Xhc->OutIndex];
+    if (!Urb->Finished && EFI_ERROR (XhcWaitOutput (Xhc, Urb))) {
+      break;
+    }
+
+    Bytes = MIN (*Length - Queued, XHC_DEBUG_PORT_DATA_BUFFER_SIZE - Xhc->OutDataLength);
+    CopyMem ((UINT8 *)(UINTN) Urb->Data + Xhc->OutDataLength, Data + Queued, Bytes);
+    Xhc->OutDataLength += (UINT32) Bytes;
+    Queued             += Bytes;
+
+    if (Xhc->OutDataLength == XHC_DEBUG_PORT_DATA_BUFFER_SIZE) {
+      if (EFI_ERROR (XhcFlushOutput (Xhc))) {
+        break;
+      }
+    }
+  }
+
+  if (Flush) {
+    XhcFlushOutput (Xhc);
+  }
+  *Length = Queued;
+}
+
 /**
   Transfer data via XHC controller.
 
@@ -832,6 +1040,19 @@ Usb3DebugPortDataTransfer (
     }
   }
 
+  if (Direction == EfiUsbDataOut) {
+    XhcQueueOutput (Instance, Data, Length);
+    goto Done;
+  }
+
+  //
+  // Send pending output first, since the debug host expects it to come out
+  // in order, and let it complete so that XhcCheckUrbResult () does not
+  // swallow its completion events
+  //
+  XhcFlushOutput (Instance);
+  XhcWaitOutput (Instance, NULL);
+
   BytesToSend = 0;
   while (*Length > 0) {
     BytesToSend = ((*Length) > XHC_DEBUG_PORT_DATA_LENGTH) ? XHC_DEBUG_PORT_DATA_LENGTH : *Length;
@@ -890,3 +1111,18 @@ Usb3DbgOut (
 {
   Usb3DebugPortDataTransfer (Data, Length, EfiUsbDataOut);
 }
+
+/**
+  Send the output accumulated by Usb3DbgOut () over the USB3 debug cable.
+
+**/
+VOID
+Usb3DbgFlush (
+  VOID
+  )
+{
+  UINTN                                    Length;
+
+  Length = 0;
+  Usb3DebugPortDataTransfer (NULL, &Length, EfiUsbDataOut);
+}
@@ -525,6 +525,8 @@ InitializeUsb3DebugPort (
   CHAR8                           *TestString;
   UINTN                           Length;
   UINT32                          TransferResult;
+  UINT8                           *OutData;
+  UINTN                           Index;
 
   Bus      = Instance->PciBusNumber;
   Device   = Instance->PciDeviceNumber;
@@ -593,6 +595,18 @@ InitializeUsb3DebugPort (
   //
   Instance->Urb.Data = (EFI_PHYSICAL_ADDRESS) (UINTN) AllocateAlignBuffer (XHC_DEBUG_PORT_DATA_LENGTH);
 
+  //
+  // Init output buffers, all idle
+  //
+  OutData = AllocateAlignBuffer (XHC_DEBUG_PORT_DATA_BUFFER_SIZE * XHC_DEBUG_PORT_OUT_BUFFER_NUMBER);
+  ASSERT (OutData != NULL);
+  for (Index = 0; Index < XHC_DEBUG_PORT_OUT_BUFFER_NUMBER; Index++) {
+    Instance->OutUrb[Index].Signature = USB3_DEBUG_PORT_INSTANCE_SIGNATURE;
+    Instance->OutUrb[Index].Direction = EfiUsbDataOut;
+    Instance->OutUrb[Index].Data      = (EFI_PHYSICAL_ADDRESS) (UINTN) (OutData + Index * XHC_DEBUG_PORT_DATA_BUFFER_SIZE);
+    Instance->OutUrb[Index].Finished  = TRUE;
+  }
+
   //
   // Init DCDDI1 and DCDDI2
   //
@@ -146,6 +146,12 @@ Usb3MapDmaBuffers (
     XHC_DEBUG_PORT_DATA_LENGTH
     );
 
+  Usb3MapOneDmaBuffer (
+    PciIo,
+    Instance->OutUrb[0].Data,
+    XHC_DEBUG_PORT_DATA_BUFFER_SIZE * XHC_DEBUG_PORT_OUT_BUFFER_NUMBER
+    );
+
   Usb3MapOneDmaBuffer (
     PciIo,
     Instance->TransferRingIn.RingSeg0,
@@ -61,6 +61,20 @@
 //
 #define XHC_DEBUG_PORT_DATA_LENGTH   8
 
+//
+// Size of each output buffer. Output is accumulated in it and sent as one
+// bulk transfer when it fills up, when a write ends with a newline or when
+// Usb3DebugPortPoll () is called. It must fit in a single normal TRB.
+//
+#define XHC_DEBUG_PORT_DATA_BUFFER_SIZE  SIZE_4KB
+
+//
+// Number of output buffers. With PcdUsb3DebugPortAsyncWrite, up to this many
+// bulk transfers are left in flight on the OUT transfer ring, and a write
+// only waits when it needs a buffer that is still being sent.
+//
+#define XHC_DEBUG_PORT_OUT_BUFFER_NUMBER 4
+
 //
 // Indicate the timeout when data is transferred. 0 means infinite timeout.
 //
@@ -509,6 +523,18 @@ typedef struct _USB3_DEBUG_PORT_INSTANCE {
   // URB
   //
   URB                                     Urb;
+
+  //
+  // Output buffers, each described by the URB that sends it. A URB is idle
+  // when its Finished flag is set.
+  //
+  URB                                     OutUrb[XHC_DEBUG_PORT_OUT_BUFFER_NUMBER];
+
+  //
+  // Output buffer being filled and the number of bytes accumulated in it
+  //
+  UINT32                                  OutIndex;
+  UINT32                                  OutDataLength;
 } USB3_DEBUG_PORT_INSTANCE;
 
 #pragma pack()
@@ -715,6 +741,15 @@ Usb3DbgOut (
   IN OUT   UINTN                           *Length
   );
 
+/**
+  Send the output accumulated by Usb3DbgOut () over the USB3 debug cable.
+
+**/
+VOID
+Usb3DbgFlush (
+  VOID
+  );
+
 /**
   Receive data over the USB3 debug cable.
 
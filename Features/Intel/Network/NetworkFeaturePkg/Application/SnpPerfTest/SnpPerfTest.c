@@ -0,0 +1,793 @@
+/** @file
+  Simple Network Protocol throughput and latency benchmark.
+
+  Drives one EFI_SIMPLE_NETWORK_PROTOCOL instance with a stream of frames and
+  reports the achieved packet and bit rates, the performance counter ticks
+  spent per packet and a latency histogram of every Transmit(), Receive() and
+  GetStatus() call. This allows to compare network drivers on equal terms.
+
+  Two modes are supported:
+  - loopback: frames are sent to the station address of the interface, for use
+    with an external loopback plug or a switch port in loopback.
+  - peer: frames are broadcast, and any frame of the benchmark EtherType sent
+    back by a peer (for instance another instance of this application) is
+    counted as received.
+
+  Copyright (c) 2020, Intel Corporation. All rights reserved.<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+
+#include <Protocol/ShellParameters.h>
+#include <Protocol/SimpleNetwork.h>
+
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/TimerLib.h>
+#include <Library/UefiApplicationEntryPoint.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/UefiLib.h>
+
+//
+// IEEE 802 local experimental EtherType, used to recognize benchmark frames
+//
+#define SNP_PERF_ETHER_TYPE        0x88B5
+
+#define SNP_PERF_DEFAULT_COUNT     10000
+#define SNP_PERF_DEFAULT_SIZE      1514
+#define SNP_PERF_MIN_SIZE          60
+#define SNP_PERF_MAX_SIZE          1514
+#define SNP_PERF_RX_BUFFER_SIZE    2048
+
+//
+// Gap after the last transmit during which late frames are still collected
+//
+#define SNP_PERF_DRAIN_TIMEOUT_US  100000
+
+//
+// Latency histogram buckets, bucket N counts the calls which took less than
+// 2^N microseconds, the last one counts all the longer ones.
+//
+#define SNP_PERF_HISTOGRAM_BUCKETS 12
+
+typedef enum {
+  SnpPerfOpTransmit,
+  SnpPerfOpReceive,
+  SnpPerfOpGetStatus,
+  SnpPerfOpMax
+} SNP_PERF_OP;
+
+typedef struct {
+  UINT64  Calls;
+  UINT64  TotalNs;
+  UINT64  MinNs;
+  UINT64  MaxNs;
+  UINT64  Histogram[SNP_PERF_HISTOGRAM_BUCKETS];
+} SNP_PERF_OP_STATS;
+
+typedef struct {
+  EFI_SIMPLE_NETWORK_PROTOCOL *Snp;
+  BOOLEAN                     Loopback;
+  UINTN                       Count;
+  UINTN                       FrameSize;
+  UINT8                       *TxBuffers;
+  UINTN                       TxBufferCount;
+  UINT8                       *RxBuffer;
+  UINT64                      TxFrames;
+  UINT64                      TxRetries;
+  UINT64                      TxRecycled;
+  UINT64                      RxFrames;
+  UINT64                      RxBytes;
+  UINT64                      RxForeign;
+  SNP_PERF_OP_STATS           Ops[SnpPerfOpMax];
+} SNP_PERF_CONTEXT;
+
+STATIC CONST CHAR16 *mOpNames[SnpPerfOpMax] = {
+  L"Transmit",
+  L"Receive",
+  L"GetStatus"
+};
+
+/**
+  Print the command line usage of the application.
+
+**/
+STATIC
+VOID
+PrintUsage (
+  VOID
+  )
+{
+  Print (L"Usage: SnpPerfTest [-l] [-i <index>] [-n <count>] [-s <size>] [-m loopback|peer]\n");
+  Print (L"  -l         list the Simple Network Protocol instances\n");
+  Print (L"  -i index   instance to benchmark (default 0)\n");
+  Print (L"  -n count   number of frames to transmit (default %d)\n", SNP_PERF_DEFAULT_COUNT);
+  Print (L"  -s size    frame size including the media header, %d-%d (default %d)\n",
+    SNP_PERF_MIN_SIZE, SNP_PERF_MAX_SIZE, SNP_PERF_DEFAULT_SIZE);
+  Print (L"  -m mode    loopback: frames are addressed to this interface\n");
+  Print (L"             peer: frames are broadcast to a peer echoing them (default)\n");
+}
+
+/**
+  Account for one call in the statistics of an operation.
+
+  @param[in, out] Stats   Statistics of the operation.
+  @param[in]      Start   Performance counter value before the call.
+  @param[in]      End     Performance counter value after the call.
+
+**/
+STATIC
+VOID
+RecordCall (
+  IN OUT SNP_PERF_OP_STATS  *Stats,
+  IN     UINT64             Start,
+  IN     UINT64             End
+  )
+{
+  UINT64  Ns;
+  UINT64  Us;
+  UINTN   Bucket;
+
+  Ns = GetTimeInNanoSecond (End - Start);
+
+  if ((Stats->Calls == 0) || (Ns < Stats->MinNs)) {
+    Stats->MinNs = Ns;
+  }
+  if (Ns > Stats->MaxNs) {
+    Stats->MaxNs = Ns;
+  }
+  Stats->Calls++;
+  Stats->TotalNs += Ns;
+
+  Us = DivU64x32 (Ns, 1000);
+  for (Bucket = 0; Bucket < SNP_PERF_HISTOGRAM_BUCKETS - 1; Bucket++) {
+    if (Us < LShiftU64 (1, Bucket)) {
+      break;
+    }
+  }
+  Stats->Histogram[Bucket]++;
+}
+
+/**
+  Return the current value of the performance counter.
+
+  Hides the counting direction of the platform performance counter, so that
+  the difference of two consecutive values is always positive.
+
+  @return Monotonic performance counter value.
+
+**/
+STATIC
+UINT64
+ReadCounter (
+  VOID
+  )
+{
+  UINT64  StartValue;
+  UINT64  EndValue;
+  UINT64  Value;
+
+  GetPerformanceCounterProperties (&StartValue, &EndValue);
+  Value = GetPerformanceCounter ();
+
+  if (StartValue > EndValue) {
+    return StartValue - Value;
+  }
+
+  return Value;
+}
+
+/**
+  Recycle the transmit buffers reported as sent by the driver.
+
+  @param[in, out] Context   Benchmark context.
+
+  @retval  TRUE   At least one buffer was recycled.
+  @retval  FALSE  No buffer was recycled.
+
+**/
+STATIC
+BOOLEAN
+RecycleTxBuffers (
+  IN OUT SNP_PERF_CONTEXT *Context
+  )
+{
+  EFI_STATUS  Status;
+  UINT32      InterruptStatus;
+  VOID        *TxBuf;
+  UINT64      Start;
+  BOOLEAN     Recycled;
+
+  Recycled = FALSE;
+
+  do {
+    TxBuf = NULL;
+    Start = ReadCounter ();
+    Status = Context->Snp->GetStatus (Context->Snp, &InterruptStatus, &TxBuf);
+    RecordCall (&Context->Ops[SnpPerfOpGetStatus], Start, ReadCounter ());
+    if (EFI_ERROR (Status) || (TxBuf == NULL)) {
+      break;
+    }
+
+    Context->TxRecycled++;
+    Recycled = TRUE;
+  } while (TRUE);
+
+  return Recycled;
+}
+
+/**
+  Receive all the frames waiting in the driver.
+
+  @param[in, out] Context   Benchmark context.
+
+**/
+STATIC
+VOID
+ReceiveFrames (
+  IN OUT SNP_PERF_CONTEXT *Context
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       BufferSize;
+  UINT16      Protocol;
+  UINT64      Start;
+
+  do {
+    BufferSize = SNP_PERF_RX_BUFFER_SIZE;
+    Start = ReadCounter ();
+    Status = Context->Snp->Receive (Context->Snp, NULL, &BufferSize,
+                             Context->RxBuffer, NULL, NULL, &Protocol);
+    RecordCall (&Context->Ops[SnpPerfOpReceive], Start, ReadCounter ());
+    if (Status == EFI_NOT_READY) {
+      break;
+    }
+
+    if (EFI_ERROR (Status)) {
+      //
+      // Bad frames are dropped by the driver, keep going
+      //
+      if (Status == EFI_DEVICE_ERROR) {
+        continue;
+      }
+      break;
+    }
+
+    if (Protocol == SNP_PERF_ETHER_TYPE) {
+      Context->RxFrames++;
+      Context->RxBytes += BufferSize;
+    } else {
+      Context->RxForeign++;
+    }
+  } while (TRUE);
+}
+
+/**
+  Transmit one frame, waiting for a free transmit slot if needed.
+
+  @param[in, out] Context   Benchmark context.
+  @param[in]      Frame     Frame to transmit.
+
+  @retval  EFI_SUCCESS  The frame was queued for transmission.
+  @retval  Others       The driver failed the transmit.
+
+**/
+STATIC
+EFI_STATUS
+TransmitFrame (
+  IN OUT SNP_PERF_CONTEXT *Context,
+  IN     VOID             *Frame
+  )
+{
+  EFI_STATUS  Status;
+  UINT64      Start;
+
+  do {
+    Start = ReadCounter ();
+    Status = Context->Snp->Transmit (Context->Snp, 0, Context->FrameSize, Frame,
+                             NULL, NULL, NULL);
+    RecordCall (&Context->Ops[SnpPerfOpTransmit], Start, ReadCounter ());
+    if (Status != EFI_NOT_READY) {
+      return Status;
+    }
+
+    //
+    // Transmit ring full: give back the sent buffers and collect the
+    // received frames, otherwise a loopback would stall on the Rx side.
+    //
+    Context->TxRetries++;
+    RecycleTxBuffers (Context);
+    ReceiveFrames (Context);
+  } while (TRUE);
+}
+
+/**
+  Build the benchmark frames.
+
+  Several distinct buffers are used, as drivers may transmit straight from the
+  buffer they are given until it is recycled through GetStatus().
+
+  @param[in, out] Context   Benchmark context.
+
+  @retval  EFI_SUCCESS           The frames are ready.
+  @retval  EFI_OUT_OF_RESOURCES  Failed to allocate the buffers.
+
+**/
+STATIC
+EFI_STATUS
+BuildFrames (
+  IN OUT SNP_PERF_CONTEXT *Context
+  )
+{
+  EFI_SIMPLE_NETWORK_MODE *Mode;
+  UINT8                   *Frame;
+  UINTN                   Index;
+  UINTN                   Offset;
+
+  Mode = Context->Snp->Mode;
+
+  //
+  // The buffers are never modified once built, so queuing again a buffer
+  // the driver still holds is harmless.
+  //
+  Context->TxBufferCount = 64;
+  Context->TxBuffers = AllocatePool (Context->TxBufferCount * Context->FrameSize);
+  Context->RxBuffer = AllocatePool (SNP_PERF_RX_BUFFER_SIZE);
+  if ((Context->TxBuffers == NULL) || (Context->RxBuffer == NULL)) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  for (Index = 0; Index < Context->TxBufferCount; Index++) {
+    Frame = Context->TxBuffers + Index * Context->FrameSize;
+
+    if (Context->Loopback) {
+      CopyMem (Frame, &Mode->CurrentAddress, Mode->HwAddressSize);
+    } else {
+      CopyMem (Frame, &Mode->BroadcastAddress, Mode->HwAddressSize);
+    }
+    CopyMem (Frame + Mode->HwAddressSize, &Mode->CurrentAddress, Mode->HwAddressSize);
+    Offset = 2 * Mode->HwAddressSize;
+    Frame[Offset++] = (UINT8)(SNP_PERF_ETHER_TYPE >> 8);
+    Frame[Offset++] = (UINT8)SNP_PERF_ETHER_TYPE;
+
+    for (; Offset < Context->FrameSize; Offset++) {
+      Frame[Offset] = (UINT8)(Offset + Index);
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Print the statistics gathered for one operation.
+
+  @param[in]  OpName  Name of the operation.
+  @param[in]  Stats   Statistics of the operation.
+
+**/
+STATIC
+VOID
+PrintOpStats (
+  IN CONST CHAR16             *OpName,
+  IN CONST SNP_PERF_OP_STATS  *Stats
+  )
+{
+  UINTN Bucket;
+
+  if (Stats->Calls == 0) {
+    Print (L"%-10s no calls\n", OpName);
+    return;
+  }
+
+  Print (L"%-10s %ld calls, min %ld ns, avg %ld ns, max %ld ns\n",
+    OpName,
+    Stats->Calls,
+    Stats->MinNs,
+    DivU64x64Remainder (Stats->TotalNs, Stats->Calls, NULL),
+    Stats->MaxNs);
+
+  for (Bucket = 0; Bucket < SNP_PERF_HISTOGRAM_BUCKETS; Bucket++) {
+    if (Stats->Histogram[Bucket] == 0) {
+      continue;
+    }
+
+    if (Bucket < SNP_PERF_HISTOGRAM_BUCKETS - 1) {
+      Print (L"           < %5d us: %ld\n", 1 << Bucket, Stats->Histogram[Bucket]);
+    } else {
+      Print (L"          >= %5d us: %ld\n", 1 << (Bucket - 1), Stats->Histogram[Bucket]);
+    }
+  }
+}
+
+/**
+  Print the results of a benchmark run.
+
+  @param[in]  Context   Benchmark context.
+  @param[in]  Ticks     Performance counter ticks spent in the run.
+
+**/
+STATIC
+VOID
+PrintResults (
+  IN CONST SNP_PERF_CONTEXT *Context,
+  IN       UINT64           Ticks
+  )
+{
+  UINT64  ElapsedUs;
+  UINT64  Frequency;
+  UINTN   Op;
+
+  ElapsedUs = DivU64x32 (GetTimeInNanoSecond (Ticks), 1000);
+  if (ElapsedUs == 0) {
+    ElapsedUs = 1;
+  }
+  Frequency = GetPerformanceCounterProperties (NULL, NULL);
+
+  Print (L"\nElapsed: %ld us, counter frequency %ld Hz\n", ElapsedUs, Frequency);
+  Print (L"Tx: %ld frames, %ld pps, %ld Mb/s, %ld retries, %ld buffers recycled\n",
+    Context->TxFrames,
+    DivU64x64Remainder (MultU64x32 (Context->TxFrames, 1000000), ElapsedUs, NULL),
+    DivU64x64Remainder (MultU64x32 (Context->TxFrames, (UINT32)Context->FrameSize * 8), ElapsedUs, NULL),
+    Context->TxRetries,
+    Context->TxRecycled);
+  Print (L"Rx: %ld frames, %ld pps, %ld Mb/s, %ld foreign frames\n",
+    Context->RxFrames,
+    DivU64x64Remainder (MultU64x32 (Context->RxFrames, 1000000), ElapsedUs, NULL),
+    DivU64x64Remainder (MultU64x32 (Context->RxBytes, 8), ElapsedUs, NULL),
+    Context->RxForeign);
+
+  if (Context->TxFrames != 0) {
+    Print (L"Counter ticks per transmitted frame: %ld\n",
+      DivU64x64Remainder (Ticks, Context->TxFrames, NULL));
+  }
+
+  Print (L"\n");
+  for (Op = 0; Op < SnpPerfOpMax; Op++) {
+    PrintOpStats (mOpNames[Op], &Context->Ops[Op]);
+  }
+}
+
+/**
+  Run the benchmark on the selected interface.
+
+  @param[in, out] Context   Benchmark context.
+
+  @retval  EFI_SUCCESS  The benchmark completed.
+  @retval  Others       The interface could not be driven.
+
+**/
+STATIC
+EFI_STATUS
+RunBenchmark (
+  IN OUT SNP_PERF_CONTEXT *Context
+  )
+{
+  EFI_STATUS  Status;
+  UINT64      Start;
+  UINT64      End;
+  UINT64      DrainStart;
+  UINTN       Index;
+
+  Status = BuildFrames (Context);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  //
+  // Flush whatever is pending from a previous user of the interface
+  //
+  RecycleTxBuffers (Context);
+  ReceiveFrames (Context);
+  ZeroMem (Context->Ops, sizeof (Context->Ops));
+  Context->TxRecycled = 0;
+  Context->RxFrames = 0;
+  Context->RxBytes = 0;
+  Context->RxForeign = 0;
+
+  Start = ReadCounter ();
+
+  for (Index = 0; Index < Context->Count; Index++) {
+    Status = TransmitFrame (Context,
+               Context->TxBuffers + (Index % Context->TxBufferCount) * Context->FrameSize);
+    if (EFI_ERROR (Status)) {
+      Print (L"Transmit failed after %d frames: %r\n", Index, Status);
+      break;
+    }
+    Context->TxFrames++;
+
+    RecycleTxBuffers (Context);
+    ReceiveFrames (Context);
+  }
+
+  //
+  // Collect the frames still on their way back
+  //
+  DrainStart = ReadCounter ();
+  End = DrainStart;
+  while (DivU64x32 (GetTimeInNanoSecond (ReadCounter () - DrainStart), 1000) <
+         SNP_PERF_DRAIN_TIMEOUT_US) {
+    if (RecycleTxBuffers (Context)) {
+      End = ReadCounter ();
+    }
+    if ((Context->RxFrames < Context->TxFrames) || !Context->Loopback) {
+      ReceiveFrames (Context);
+      End = ReadCounter ();
+    }
+    if (Context->Loopback && (Context->RxFrames >= Context->TxFrames) &&
+        (Context->TxRecycled >= Context->TxFrames)) {
+      break;
+    }
+  }
+
+  PrintResults (Context, End - Start);
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Bring the interface to the initialized state.
+
+  @param[in]  Snp             Interface to use.
+  @param[out] StartedHere     Whether Start() was called by this function.
+  @param[out] InitializedHere Whether Initialize() was called by this function.
+
+  @retval  EFI_SUCCESS  The interface is initialized.
+  @retval  Others       The interface could not be initialized.
+
+**/
+STATIC
+EFI_STATUS
+PrepareInterface (
+  IN  EFI_SIMPLE_NETWORK_PROTOCOL *Snp,
+  OUT BOOLEAN                     *StartedHere,
+  OUT BOOLEAN                     *InitializedHere
+  )
+{
+  EFI_STATUS  Status;
+  UINT32      Filters;
+
+  *StartedHere = FALSE;
+  *InitializedHere = FALSE;
+
+  if (Snp->Mode->State == EfiSimpleNetworkStopped) {
+    Status = Snp->Start (Snp);
+    if (EFI_ERROR (Status)) {
+      Print (L"Start failed: %r\n", Status);
+      return Status;
+    }
+    *StartedHere = TRUE;
+  }
+
+  if (Snp->Mode->State == EfiSimpleNetworkStarted) {
+    Status = Snp->Initialize (Snp, 0, 0);
+    if (EFI_ERROR (Status)) {
+      Print (L"Initialize failed: %r\n", Status);
+      return Status;
+    }
+    *InitializedHere = TRUE;
+  }
+
+  Filters = EFI_SIMPLE_NETWORK_RECEIVE_UNICAST | EFI_SIMPLE_NETWORK_RECEIVE_BROADCAST;
+  Filters &= Snp->Mode->ReceiveFilterMask;
+  Status = Snp->ReceiveFilters (Snp, Filters, 0, FALSE, 0, NULL);
+  if (EFI_ERROR (Status)) {
+    Print (L"Warning: ReceiveFilters failed: %r\n", Status);
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Return the interface to the state it was found in.
+
+  @param[in]  Snp             Interface used.
+  @param[in]  StartedHere     Whether Start() was called by this application.
+  @param[in]  InitializedHere Whether Initialize() was called by this
+                              application.
+
+**/
+STATIC
+VOID
+RestoreInterface (
+  IN  EFI_SIMPLE_NETWORK_PROTOCOL *Snp,
+  IN  BOOLEAN                     StartedHere,
+  IN  BOOLEAN                     InitializedHere
+  )
+{
+  if (InitializedHere) {
+    Snp->Shutdown (Snp);
+  }
+  if (StartedHere) {
+    Snp->Stop (Snp);
+  }
+}
+
+/**
+  Print the available Simple Network Protocol instances.
+
+  @param[in]  Handles       Handles with the Simple Network Protocol.
+  @param[in]  HandleCount   Number of handles.
+
+**/
+STATIC
+VOID
+ListInterfaces (
+  IN EFI_HANDLE *Handles,
+  IN UINTN      HandleCount
+  )
+{
+  EFI_SIMPLE_NETWORK_PROTOCOL *Snp;
+  EFI_STATUS                  Status;
+  UINTN                       Index;
+  UINTN                       Byte;
+
+  for (Index = 0; Index < HandleCount; Index++) {
+    Status = gBS->HandleProtocol (Handles[Index], &gEfiSimpleNetworkProtocolGuid,
+                    (VOID **)&Snp);
+    if (EFI_ERROR (Status)) {
+      continue;
+    }
+
+    Print (L"%2d: ", Index);
+    for (Byte = 0; Byte < Snp->Mode->HwAddressSize; Byte++) {
+      Print (L"%02x%s", Snp->Mode->CurrentAddress.Addr[Byte],
+        (Byte + 1 < Snp->Mode->HwAddressSize) ? L":" : L"");
+    }
+    Print (L" state %d, media %s\n", Snp->Mode->State,
+      !Snp->Mode->MediaPresentSupported ? L"unknown" :
+      Snp->Mode->MediaPresent ? L"present" : L"absent");
+  }
+}
+
+/**
+  Entry point of the benchmark application.
+
+  @param[in]  ImageHandle   Handle of the application image.
+  @param[in]  SystemTable   Pointer to the EFI System Table.
+
+  @retval  EFI_SUCCESS            The benchmark ran.
+  @retval  EFI_INVALID_PARAMETER  The command line is invalid.
+  @retval  EFI_NOT_FOUND          No suitable interface was found.
+
+**/
+EFI_STATUS
+EFIAPI
+SnpPerfTestEntryPoint (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  )
+{
+  EFI_SHELL_PARAMETERS_PROTOCOL *ShellParameters;
+  SNP_PERF_CONTEXT              *Context;
+  EFI_HANDLE                    *Handles;
+  EFI_STATUS                    Status;
+  BOOLEAN                       StartedHere;
+  BOOLEAN                       InitializedHere;
+  BOOLEAN                       List;
+  UINTN                         HandleCount;
+  UINTN                         SnpIndex;
+  UINTN                         Index;
+
+  Context = AllocateZeroPool (sizeof (SNP_PERF_CONTEXT));
+  if (Context == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Context->Count = SNP_PERF_DEFAULT_COUNT;
+  Context->FrameSize = SNP_PERF_DEFAULT_SIZE;
+  SnpIndex = 0;
+  List = FALSE;
+
+  Status = gBS->HandleProtocol (ImageHandle, &gEfiShellParametersProtocolGuid,
+                  (VOID **)&ShellParameters);
+  if (!EFI_ERROR (Status)) {
+    for (Index = 1; Index < ShellParameters->Argc; Index++) {
+      if (StrCmp (ShellParameters->Argv[Index], L"-l") == 0) {
+        List = TRUE;
+        continue;
+      }
+
+      if (Index + 1 >= ShellParameters->Argc) {
+        PrintUsage ();
+        Status = EFI_INVALID_PARAMETER;
+        goto Exit;
+      }
+
+      if (StrCmp (ShellParameters->Argv[Index], L"-i") == 0) {
+        SnpIndex = StrDecimalToUintn (ShellParameters->Argv[++Index]);
+      } else if (StrCmp (ShellParameters->Argv[Index], L"-n") == 0) {
+        Context->Count = StrDecimalToUintn (ShellParameters->Argv[++Index]);
+      } else if (StrCmp (ShellParameters->Argv[Index], L"-s") == 0) {
+        Context->FrameSize = StrDecimalToUintn (ShellParameters->Argv[++Index]);
+      } else if (StrCmp (ShellParameters->Argv[Index], L"-m") == 0) {
+        Index++;
+        if (StrCmp (ShellParameters->Argv[Index], L"loopback") == 0) {
+          Context->Loopback = TRUE;
+        } else if (StrCmp (ShellParameters->Argv[Index], L"peer") != 0) {
+          PrintUsage ();
+          Status = EFI_INVALID_PARAMETER;
+          goto Exit;
+        }
+      } else {
+        PrintUsage ();
+        Status = EFI_INVALID_PARAMETER;
+        goto Exit;
+      }
+    }
+  }
+
+  if ((Context->FrameSize < SNP_PERF_MIN_SIZE) ||
+      (Context->FrameSize > SNP_PERF_MAX_SIZE) ||
+      (Context->Count == 0)) {
+    PrintUsage ();
+    Status = EFI_INVALID_PARAMETER;
+    goto Exit;
+  }
+
+  Status = gBS->LocateHandleBuffer (ByProtocol, &gEfiSimpleNetworkProtocolGuid,
+                  NULL, &HandleCount, &Handles);
+  if (EFI_ERROR (Status)) {
+    Print (L"No Simple Network Protocol instance found\n");
+    Status = EFI_NOT_FOUND;
+    goto Exit;
+  }
+
+  if (List) {
+    ListInterfaces (Handles, HandleCount);
+    FreePool (Handles);
+    Status = EFI_SUCCESS;
+    goto Exit;
+  }
+
+  if (SnpIndex >= HandleCount) {
+    Print (L"Invalid interface index %d, %d instances found\n", SnpIndex, HandleCount);
+    FreePool (Handles);
+    Status = EFI_NOT_FOUND;
+    goto Exit;
+  }
+
+  Status = gBS->HandleProtocol (Handles[SnpIndex], &gEfiSimpleNetworkProtocolGuid,
+                  (VOID **)&Context->Snp);
+  FreePool (Handles);
+  if (EFI_ERROR (Status)) {
+    goto Exit;
+  }
+
+  if ((Context->Snp->Mode->IfType != NET_IFTYPE_ETHERNET) ||
+      (Context->Snp->Mode->MediaHeaderSize != 14)) {
+    Print (L"Interface %d is not an Ethernet interface\n", SnpIndex);
+    Status = EFI_UNSUPPORTED;
+    goto Exit;
+  }
+
+  Status = PrepareInterface (Context->Snp, &StartedHere, &InitializedHere);
+  if (EFI_ERROR (Status)) {
+    RestoreInterface (Context->Snp, StartedHere, InitializedHere);
+    goto Exit;
+  }
+
+  Print (L"Interface %d: %d frames of %d bytes, %s mode\n",
+    SnpIndex,
+    Context->Count,
+    Context->FrameSize,
+    Context->Loopback ? L"loopback" : L"peer");
+
+  Status = RunBenchmark (Context);
+
+  RestoreInterface (Context->Snp, StartedHere, InitializedHere);
+
+Exit:
+  if (Context->TxBuffers != NULL) {
+    FreePool (Context->TxBuffers);
+  }
+  if (Context->RxBuffer != NULL) {
+    FreePool (Context->RxBuffer);
+  }
+  FreePool (Context);
+
+  return Status;
+}
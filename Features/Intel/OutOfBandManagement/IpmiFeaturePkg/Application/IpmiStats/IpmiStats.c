@@ -0,0 +1,95 @@
+/** @file
+  Shell application dumping the IPMI command statistics collected by the
+  DXE IPMI Command Library during this boot.
+
+Copyright (c) 2019, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/UefiLib.h>
+#include <Protocol/IpmiStats.h>
+
+/**
+  Print one statistics table entry.
+
+  @param[in] Entry  Statistics of one NetFn/command pair.
+**/
+VOID
+PrintCommandStats (
+  IN IPMI_COMMAND_STATS  *Entry
+  )
+{
+  Print (
+    L"  %02x    %02x   %8d %6d %7d %12ld %10ld %10ld\n",
+    Entry->NetFunction,
+    Entry->Command,
+    Entry->Count,
+    Entry->ErrorCount,
+    Entry->RetryCount,
+    DivU64x32 (Entry->TotalTimeNs, 1000),
+    (Entry->Count != 0) ? DivU64x32 (DivU64x32 (Entry->TotalTimeNs, Entry->Count), 1000) : 0,
+    DivU64x32 (Entry->MaxTimeNs, 1000)
+    );
+}
+
+/**
+  Entry point of the IpmiStats application.
+
+  @param[in] ImageHandle  The image handle of the application.
+  @param[in] SystemTable  The EFI system table.
+
+  @retval EFI_SUCCESS    The statistics were printed.
+  @retval EFI_NOT_FOUND  No IPMI command has been accounted in this boot.
+**/
+EFI_STATUS
+EFIAPI
+IpmiStatsEntryPoint (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  )
+{
+  EFI_STATUS           Status;
+  IPMI_STATS_PROTOCOL  *Stats;
+  UINT32               Index;
+  UINT32               Count;
+  UINT32               Errors;
+  UINT32               Retries;
+  UINT64               TotalTimeNs;
+
+  Status = gBS->LocateProtocol (&gIpmiStatsProtocolGuid, NULL, (VOID **) &Stats);
+  if (EFI_ERROR (Status)) {
+    Print (L"No IPMI command statistics available.\n");
+    return EFI_NOT_FOUND;
+  }
+
+  Print (L"NetFn   Cmd      Count Errors Retries   Total (us)   Avg (us)   Max (us)\n");
+
+  Count       = 0;
+  Errors      = 0;
+  Retries     = 0;
+  TotalTimeNs = 0;
+  for (Index = 0; Index < Stats->CommandCount && Index < IPMI_STATS_MAX_COMMANDS; Index++) {
+    PrintCommandStats (&Stats->Commands[Index]);
+    Count       += Stats->Commands[Index].Count;
+    Errors      += Stats->Commands[Index].ErrorCount;
+    Retries     += Stats->Commands[Index].RetryCount;
+    TotalTimeNs += Stats->Commands[Index].TotalTimeNs;
+  }
+
+  Print (
+    L"Total %d commands, %d errors, %d retries, %ld us in BMC communication\n",
+    Count,
+    Errors,
+    Retries,
+    DivU64x32 (TotalTimeNs, 1000)
+    );
+  if (Stats->DroppedCount != 0) {
+    Print (L"%d commands not accounted, statistics table full\n", Stats->DroppedCount);
+  }
+
+  return EFI_SUCCESS;
+}
@@ -13,7 +13,18 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/MemoryAllocationLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/UefiRuntimeServicesTableLib.h>
+#include <Library/UefiLib.h>
+#include <Library/IpmiLib.h>
 #include <Library/IpmiCommandLib.h>
+#include <Protocol/IpmiBmcElog.h>
+
+#define BMC_ELOG_QUEUE_SIZE        32
+#define BMC_ELOG_DRAIN_BATCH       4
+#define BMC_ELOG_TIMER_PERIOD      (50 * 10000)  // [100ns] 50 ms
+#define BMC_ELOG_ERASE_TICKS       0x200
+#define SEL_ERASE_INITIATE         0xAA
+#define SEL_ERASE_GET_STATUS       0x00
+#define SEL_ERASE_COMPLETED        0x01
 
 EFI_STATUS
 EFIAPI
@@ -21,6 +32,42 @@ CheckIfSelIsFull (
   VOID
   );
 
+EFI_STATUS
+EFIAPI
+BmcElogLogEvent (
+  IN IPMI_BMC_ELOG_PROTOCOL      *This,
+  IN IPMI_ADD_SEL_ENTRY_REQUEST  *Entry
+  );
+
+EFI_STATUS
+EFIAPI
+BmcElogEraseSel (
+  IN     IPMI_BMC_ELOG_PROTOCOL  *This,
+  IN OUT IPMI_SEL_ERASE_TOKEN    *Token
+  );
+
+IPMI_BMC_ELOG_PROTOCOL      mBmcElog = {
+  BmcElogLogEvent,
+  BmcElogEraseSel
+};
+
+//
+// Ring of SEL entries waiting to be written, protected by TPL_NOTIFY.
+//
+IPMI_ADD_SEL_ENTRY_REQUEST  mSelQueue[BMC_ELOG_QUEUE_SIZE];
+UINTN                       mSelQueueHead;
+UINTN                       mSelQueueCount;
+UINTN                       mSelQueueDropped;
+
+//
+// Background erase state, only touched at TPL_CALLBACK.
+//
+IPMI_SEL_ERASE_TOKEN        *mEraseToken;
+UINT8                       mEraseResvId[2];
+UINTN                       mEraseTicksLeft;
+
+EFI_EVENT                   mBmcElogTimer;
+
 /*++
 
   Routine Description:
@@ -88,6 +135,332 @@ Returns:
   }
 }
 
+EFI_STATUS
+SendClearSel (
+  IN  UINT8                             *ResvId,
+  IN  UINT8                             Erase,
+  OUT UINT8                             *ErasureProgress
+  )
+/*++
+
+Routine Description:
+
+  Issue one Clear SEL command, either to initiate the erase or to get its
+  progress.
+
+Arguments:
+
+  ResvId           - SEL reservation ID
+  Erase            - SEL_ERASE_INITIATE or SEL_ERASE_GET_STATUS
+  ErasureProgress  - Erasure progress reported by the BMC
+
+Returns:
+
+  EFI_STATUS
+
+--*/
+{
+  EFI_STATUS               Status;
+  IPMI_CLEAR_SEL_REQUEST   ClearSel;
+  IPMI_CLEAR_SEL_RESPONSE  ClearSelResponse;
+
+  ZeroMem (&ClearSel, sizeof(ClearSel));
+  ZeroMem (&ClearSelResponse, sizeof(ClearSelResponse));
+  ClearSel.Reserve[0]  = ResvId[0];
+  ClearSel.Reserve[1]  = ResvId[1];
+  ClearSel.AscC        = 0x43;
+  ClearSel.AscL        = 0x4C;
+  ClearSel.AscR        = 0x52;
+  ClearSel.Erase       = Erase;
+
+  Status = IpmiClearSel (&ClearSel, &ClearSelResponse);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+  if (ClearSelResponse.CompletionCode != 0) {
+    return EFI_DEVICE_ERROR;
+  }
+
+  *ErasureProgress = ClearSelResponse.ErasureProgress & 0xf;
+  return EFI_SUCCESS;
+}
+
+VOID
+CompleteErase (
+  IN EFI_STATUS                         Status
+  )
+/*++
+
+Routine Description:
+
+  Finish the background erase and signal its completion event.
+
+Arguments:
+
+  Status  - Final status of the erase
+
+Returns:
+
+  None
+
+--*/
+{
+  mEraseToken->Status = Status;
+  if (mEraseToken->Event != NULL) {
+    gBS->SignalEvent (mEraseToken->Event);
+  }
+  mEraseToken = NULL;
+}
+
+VOID
+DrainSelQueue (
+  IN UINTN                              MaxEntries
+  )
+/*++
+
+Routine Description:
+
+  Write up to MaxEntries queued SEL entries to the BMC. Entries the BMC does
+  not take are kept and retried on the next drain.
+
+Arguments:
+
+  MaxEntries  - Maximum number of entries to write
+
+Returns:
+
+  None
+
+--*/
+{
+  EFI_STATUS                   Status;
+  EFI_TPL                      OldTpl;
+  IPMI_ADD_SEL_ENTRY_REQUEST   Entry;
+  IPMI_ADD_SEL_ENTRY_RESPONSE  Response;
+
+  while (MaxEntries-- != 0) {
+    OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+    if (mSelQueueCount == 0) {
+      gBS->RestoreTPL (OldTpl);
+      return;
+    }
+    CopyMem (&Entry, &mSelQueue[mSelQueueHead], sizeof (Entry));
+    gBS->RestoreTPL (OldTpl);
+
+    Status = IpmiAddSelEntry (&Entry, &Response);
+    if (EFI_ERROR (Status) || Response.CompletionCode != 0) {
+      DEBUG ((DEBUG_WARN, "[BmcElog] Add SEL entry failed (status: %r), retrying later\n", Status));
+      return;
+    }
+
+    OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+    mSelQueueHead = (mSelQueueHead + 1) % BMC_ELOG_QUEUE_SIZE;
+    mSelQueueCount--;
+    gBS->RestoreTPL (OldTpl);
+  }
+}
+
+VOID
+EFIAPI
+BmcElogTimerHandler (
+  IN EFI_EVENT                          Event,
+  IN VOID                               *Context
+  )
+/*++
+
+Routine Description:
+
+  Periodic timer handler: advances a background erase, otherwise writes a
+  batch of queued SEL entries.
+
+Arguments:
+
+  Event    - The timer event
+  Context  - Not used
+
+Returns:
+
+  None
+
+--*/
+{
+  EFI_STATUS  Status;
+  UINT8       ErasureProgress;
+
+  if (mEraseToken != NULL) {
+    Status = SendClearSel (mEraseResvId, SEL_ERASE_GET_STATUS, &ErasureProgress);
+    if (!EFI_ERROR (Status) && ErasureProgress == SEL_ERASE_COMPLETED) {
+      CompleteErase (EFI_SUCCESS);
+    } else if (--mEraseTicksLeft == 0) {
+      //
+      //  If there is not a response from the BMC controller we need to give up and not hang.
+      //
+      CompleteErase (EFI_NO_RESPONSE);
+    }
+    return;
+  }
+
+  DrainSelQueue (BMC_ELOG_DRAIN_BATCH);
+}
+
+VOID
+EFIAPI
+BmcElogReadyToBoot (
+  IN EFI_EVENT                          Event,
+  IN VOID                               *Context
+  )
+/*++
+
+Routine Description:
+
+  Write everything still queued before the OS takes over. A running erase is
+  waited for first so that the entries are not lost in it.
+
+Arguments:
+
+  Event    - The ReadyToBoot event
+  Context  - Not used
+
+Returns:
+
+  None
+
+--*/
+{
+  while (mEraseToken != NULL) {
+    BmcElogTimerHandler (NULL, NULL);
+    if (mEraseToken != NULL) {
+      gBS->Stall (BMC_ELOG_TIMER_PERIOD / 10);
+    }
+  }
+
+  DrainSelQueue (BMC_ELOG_QUEUE_SIZE);
+
+  if (mSelQueueDropped != 0) {
+    DEBUG ((DEBUG_WARN, "[BmcElog] %d SEL entries dropped, queue was full\n", (UINT32) mSelQueueDropped));
+  }
+  gBS->CloseEvent (Event);
+}
+
+EFI_STATUS
+EFIAPI
+BmcElogLogEvent (
+  IN IPMI_BMC_ELOG_PROTOCOL      *This,
+  IN IPMI_ADD_SEL_ENTRY_REQUEST  *Entry
+  )
+/*++
+
+Routine Description:
+
+  Queue one SEL entry; it is written to the BMC by the event log timer or at
+  ReadyToBoot.
+
+Arguments:
+
+  This   - Protocol instance
+  Entry  - SEL entry to add
+
+Returns:
+
+  EFI_SUCCESS           - The entry is queued
+  EFI_INVALID_PARAMETER - Entry is NULL
+  EFI_OUT_OF_RESOURCES  - The queue is full and the entry was dropped
+
+--*/
+{
+  EFI_TPL  OldTpl;
+
+  if (Entry == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+  if (mSelQueueCount == BMC_ELOG_QUEUE_SIZE) {
+    mSelQueueDropped++;
+    gBS->RestoreTPL (OldTpl);
+    return EFI_OUT_OF_RESOURCES;
+  }
+  CopyMem (
+    &mSelQueue[(mSelQueueHead + mSelQueueCount) % BMC_ELOG_QUEUE_SIZE],
+    Entry,
+    sizeof (*Entry)
+    );
+  mSelQueueCount++;
+  gBS->RestoreTPL (OldTpl);
+
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+EFIAPI
+BmcElogEraseSel (
+  IN     IPMI_BMC_ELOG_PROTOCOL  *This,
+  IN OUT IPMI_SEL_ERASE_TOKEN    *Token
+  )
+/*++
+
+Routine Description:
+
+  Reserve the SEL and initiate its erase; the event log timer then polls the
+  erasure progress and signals Token->Event once it is done.
+
+Arguments:
+
+  This   - Protocol instance
+  Token  - Completion token
+
+Returns:
+
+  EFI_STATUS
+
+--*/
+{
+  EFI_STATUS  Status;
+  EFI_TPL     OldTpl;
+  UINT8       ReserveSelResponse[3];
+  UINT32      ResponseSize;
+  UINT8       ErasureProgress;
+
+  if (Token == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // Keep the timer handler out while the erase is being started.
+  //
+  OldTpl = gBS->RaiseTPL (TPL_CALLBACK);
+  if (mEraseToken != NULL) {
+    gBS->RestoreTPL (OldTpl);
+    return EFI_ALREADY_STARTED;
+  }
+
+  ResponseSize = sizeof (ReserveSelResponse);
+  Status = IpmiSubmitCommand (
+             IPMI_NETFN_STORAGE,
+             IPMI_STORAGE_RESERVE_SEL,
+             NULL,
+             0,
+             ReserveSelResponse,
+             &ResponseSize
+             );
+  if (!EFI_ERROR (Status) && (ReserveSelResponse[0] != 0 || ResponseSize < sizeof (ReserveSelResponse))) {
+    Status = EFI_DEVICE_ERROR;
+  }
+  if (!EFI_ERROR (Status)) {
+    mEraseResvId[0] = ReserveSelResponse[1];
+    mEraseResvId[1] = ReserveSelResponse[2];
+    Status = SendClearSel (mEraseResvId, SEL_ERASE_INITIATE, &ErasureProgress);
+  }
+  if (!EFI_ERROR (Status)) {
+    Token->Status   = EFI_NOT_READY;
+    mEraseToken     = Token;
+    mEraseTicksLeft = BMC_ELOG_ERASE_TICKS;
+  }
+
+  gBS->RestoreTPL (OldTpl);
+  return Status;
+}
+
 EFI_STATUS
 EfiActivateBmcElog (
   IN BOOLEAN                            *EnableElog,
@@ -191,10 +564,52 @@ Returns:
 
 --*/
 {
+  EFI_STATUS  Status;
+  EFI_EVENT   ReadyToBootEvent;
+  EFI_HANDLE  Handle;
+
   SetElogRedirInstall ();
 
   CheckIfSelIsFull ();
 
+  //
+  // SEL writes and erases are done from a timer so that callers never wait
+  // for the BMC; whatever is left is written at ReadyToBoot.
+  //
+  Status = gBS->CreateEvent (
+                  EVT_TIMER | EVT_NOTIFY_SIGNAL,
+                  TPL_CALLBACK,
+                  BmcElogTimerHandler,
+                  NULL,
+                  &mBmcElogTimer
+                  );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Status = gBS->SetTimer (mBmcElogTimer, TimerPeriodic, BMC_ELOG_TIMER_PERIOD);
+  if (EFI_ERROR (Status)) {
+    gBS->CloseEvent (mBmcElogTimer);
+    return Status;
+  }
+
+  Status = EfiCreateEventReadyToBootEx (
+             TPL_CALLBACK,
+             BmcElogReadyToBoot,
+             NULL,
+             &ReadyToBootEvent
+             );
+  ASSERT_EFI_ERROR (Status);
+
+  Handle = NULL;
+  Status = gBS->InstallProtocolInterface (
+                  &Handle,
+                  &gIpmiBmcElogProtocolGuid,
+                  EFI_NATIVE_INTERFACE,
+                  &mBmcElog
+                  );
+  ASSERT_EFI_ERROR (Status);
+
   return EFI_SUCCESS;
 }
 
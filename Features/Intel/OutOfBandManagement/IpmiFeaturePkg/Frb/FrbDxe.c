@@ -14,6 +14,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/MemoryAllocationLib.h>
 #include <Library/PcdLib.h>
 #include <Library/IpmiCommandLib.h>
+#include <Library/IpmiWatchdogLib.h>
 #include <IndustryStandard/Ipmi.h>
 
 EFI_STATUS
@@ -41,7 +42,7 @@ EfiDisableFrb (
   UINT8                            CompletionCode;
   IPMI_GET_WATCHDOG_TIMER_RESPONSE GetWatchdogTimer;
 
-  Status = IpmiGetWatchdogTimer (&GetWatchdogTimer);
+  Status = IpmiWatchdogGetTimer (&GetWatchdogTimer);
   if (EFI_ERROR (Status)) {
     return Status;
   }
@@ -62,7 +63,12 @@ EfiDisableFrb (
   SetWatchdogTimer.TimerUseExpirationFlagsClear &= ~BIT2;
   SetWatchdogTimer.TimerUseExpirationFlagsClear |= BIT1 | BIT4;
 
-  Status = IpmiSetWatchdogTimer (&SetWatchdogTimer, &CompletionCode);
+  Status = IpmiWatchdogSetTimer (&SetWatchdogTimer);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Status = IpmiWatchdogFlush (&CompletionCode);
   return Status;
 }
 
@@ -117,7 +123,7 @@ CheckForAndReportErrors(
   //
   // Get the Watchdog timer info to find out what kind of timer expiration occurred.
   //
-  Status = IpmiGetWatchdogTimer (&GetWatchdogTimer);
+  Status = IpmiWatchdogGetTimer (&GetWatchdogTimer);
   if (EFI_ERROR (Status)) {
     return Status;
   }
@@ -146,7 +152,12 @@ CheckForAndReportErrors(
   SetWatchdogTimer.TimerUse.Bits.TimerRunning     = 1;
   SetWatchdogTimer.TimerUseExpirationFlagsClear  |= BIT1 | BIT2 | BIT3;
 
-  Status = IpmiSetWatchdogTimer (&SetWatchdogTimer, &CompletionCode);
+  Status = IpmiWatchdogSetTimer (&SetWatchdogTimer);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Status = IpmiWatchdogFlush (&CompletionCode);
 
   return Status;
 }
@@ -176,7 +187,7 @@ ReportFrb2Status (
   //
   // Get the Watchdog timer info to find out what kind of timer expiration occurred.
   //
-  Status = IpmiGetWatchdogTimer (&GetWatchdogTimer);
+  Status = IpmiWatchdogGetTimer (&GetWatchdogTimer);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_INFO, "Failed to get Watchdog Timer info from BMC.\n"));
     return Status;
@@ -232,4 +232,108 @@ IpmiGetSdr (
   IN OUT UINT32                     *GetSdrResponseSize
   );
 
+//
+// SEL and SDR repository readers
+//
+
+///
+/// Caller owned copy of a SEL or SDR repository. Zero it before first use.
+/// Records are kept back to back in Data, each stored as a UINT16 size
+/// followed by the raw record, whose first two bytes are its record ID.
+///
+typedef struct {
+  BOOLEAN  Valid;
+  UINT32   RecentAddTimeStamp;
+  UINT32   RecentEraseTimeStamp;
+  UINTN    RecordCount;
+  UINTN    DataSize;
+  UINTN    BufferSize;
+  UINT8    *Data;
+} IPMI_REPOSITORY_CACHE;
+
+/**
+  Read the whole SEL into SelCache, unless the cache already matches the
+  BMC's last add and erase time stamps.
+
+  @param[in, out] SelCache  Cache to fill or revalidate.
+
+  @retval EFI_SUCCESS           SelCache holds the current SEL.
+  @retval EFI_OUT_OF_RESOURCES  No memory to hold the records.
+  @retval EFI_TIMEOUT           The SEL kept changing while it was read.
+  @retval Others                The BMC did not answer or reported an error.
+**/
+EFI_STATUS
+EFIAPI
+IpmiReadSelRepository (
+  IN OUT IPMI_REPOSITORY_CACHE  *SelCache
+  );
+
+/**
+  Read the whole SDR repository into SdrCache, unless the cache already
+  matches the BMC's last add and erase time stamps.
+
+  @param[in, out] SdrCache  Cache to fill or revalidate.
+
+  @retval EFI_SUCCESS           SdrCache holds the current SDR repository.
+  @retval EFI_OUT_OF_RESOURCES  No memory to hold the records.
+  @retval EFI_TIMEOUT           The repository kept changing while it was read.
+  @retval Others                The BMC did not answer or reported an error.
+**/
+EFI_STATUS
+EFIAPI
+IpmiReadSdrRepository (
+  IN OUT IPMI_REPOSITORY_CACHE  *SdrCache
+  );
+
+/**
+  Iterate over the records of a repository cache.
+
+  @param[in]      Cache       Cache filled by IpmiReadSelRepository or IpmiReadSdrRepository.
+  @param[in, out] Position    Set to 0 for the first record; advanced on return.
+  @param[out]     Record      Points at the record inside the cache.
+  @param[out]     RecordSize  Size of the record in bytes.
+
+  @retval EFI_SUCCESS    The next record is returned.
+  @retval EFI_NOT_FOUND  There are no more records.
+**/
+EFI_STATUS
+EFIAPI
+IpmiGetNextRepositoryRecord (
+  IN     IPMI_REPOSITORY_CACHE  *Cache,
+  IN OUT UINTN                  *Position,
+  OUT    UINT8                  **Record,
+  OUT    UINT16                 *RecordSize
+  );
+
+/**
+  Look up a record of a repository cache by its record ID.
+
+  @param[in]  Cache       Cache filled by IpmiReadSelRepository or IpmiReadSdrRepository.
+  @param[in]  RecordId    Record ID to look for.
+  @param[out] Record      Points at the record inside the cache.
+  @param[out] RecordSize  Size of the record in bytes.
+
+  @retval EFI_SUCCESS    The record is returned.
+  @retval EFI_NOT_FOUND  The cache holds no record with that ID.
+**/
+EFI_STATUS
+EFIAPI
+IpmiFindRepositoryRecord (
+  IN  IPMI_REPOSITORY_CACHE  *Cache,
+  IN  UINT16                 RecordId,
+  OUT UINT8                  **Record,
+  OUT UINT16                 *RecordSize
+  );
+
+/**
+  Free the records held by a repository cache and reset it.
+
+  @param[in, out] Cache  Cache to release.
+**/
+VOID
+EFIAPI
+IpmiFreeRepositoryCache (
+  IN OUT IPMI_REPOSITORY_CACHE  *Cache
+  );
+
 #endif
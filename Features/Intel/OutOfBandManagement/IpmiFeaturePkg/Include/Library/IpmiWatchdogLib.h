@@ -0,0 +1,66 @@
+/** @file
+  This library keeps one view of the BMC watchdog timer for all DXE drivers
+  and merges their changes into as few Set Watchdog Timer commands as
+  possible.
+
+Copyright (c) 2019, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef _IPMI_WATCHDOG_LIB_H_
+#define _IPMI_WATCHDOG_LIB_H_
+
+#include <Uefi.h>
+#include <IndustryStandard/Ipmi.h>
+
+/**
+  Return the watchdog timer state. Only the first call in a boot sends Get
+  Watchdog Timer; later calls return the state tracked from the commands
+  sent since, with any pending change applied. PresentCountdownValue is
+  that of the last command sent.
+
+  @param[out] GetWatchdogTimer  Watchdog timer state.
+
+  @retval EFI_SUCCESS  The state is returned.
+  @retval Others       The BMC could not be read.
+**/
+EFI_STATUS
+EFIAPI
+IpmiWatchdogGetTimer (
+  OUT IPMI_GET_WATCHDOG_TIMER_RESPONSE  *GetWatchdogTimer
+  );
+
+/**
+  Queue a Set Watchdog Timer. The timer configuration of the last queued
+  request wins, the expiration flags to clear of all queued requests are
+  combined. Nothing is sent before IpmiWatchdogFlush.
+
+  @param[in] SetWatchdogTimer  Requested watchdog timer configuration.
+
+  @retval EFI_SUCCESS  The request is queued.
+  @retval Others       The current state could not be read from the BMC.
+**/
+EFI_STATUS
+EFIAPI
+IpmiWatchdogSetTimer (
+  IN IPMI_SET_WATCHDOG_TIMER_REQUEST  *SetWatchdogTimer
+  );
+
+/**
+  Send the queued change as one Set Watchdog Timer, unless it would leave a
+  stopped timer exactly as it is.
+
+  @param[out] CompletionCode  Completion code of the command, 0 when nothing
+                              had to be sent. Optional.
+
+  @retval EFI_SUCCESS  The change was sent or was not needed.
+  @retval Others       The BMC could not be reached.
+**/
+EFI_STATUS
+EFIAPI
+IpmiWatchdogFlush (
+  OUT UINT8  *CompletionCode  OPTIONAL
+  );
+
+#endif
@@ -0,0 +1,85 @@
+/** @file
+  IPMI BMC event log protocol.
+
+  Lets drivers log SEL entries and erase the SEL without waiting for the BMC.
+  Entries are queued in memory and written by the BMC event log driver from
+  a timer and at ReadyToBoot; erasing runs in the background and signals an
+  event when it is done.
+
+Copyright (c) 2019, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef _IPMI_BMC_ELOG_PROTOCOL_H_
+#define _IPMI_BMC_ELOG_PROTOCOL_H_
+
+#include <IndustryStandard/Ipmi.h>
+
+#define IPMI_BMC_ELOG_PROTOCOL_GUID \
+  { \
+    0xd82818ca, 0x8304, 0x4d29, { 0xbc, 0x6b, 0xc1, 0x30, 0xfd, 0xdf, 0xae, 0x32 } \
+  }
+
+typedef struct _IPMI_BMC_ELOG_PROTOCOL IPMI_BMC_ELOG_PROTOCOL;
+
+///
+/// Completion token of a background SEL erase.
+///
+typedef struct {
+  ///
+  /// Signaled when the erase has finished, successfully or not.
+  ///
+  EFI_EVENT   Event;
+  ///
+  /// EFI_NOT_READY while the erase runs, then its final status.
+  ///
+  EFI_STATUS  Status;
+} IPMI_SEL_ERASE_TOKEN;
+
+/**
+  Queue one SEL entry to be written to the BMC.
+
+  @param[in] This   Protocol instance.
+  @param[in] Entry  SEL entry to add.
+
+  @retval EFI_SUCCESS           The entry is queued.
+  @retval EFI_INVALID_PARAMETER Entry is NULL.
+  @retval EFI_OUT_OF_RESOURCES  The queue is full and the entry was dropped.
+**/
+typedef
+EFI_STATUS
+(EFIAPI *IPMI_BMC_ELOG_LOG_EVENT) (
+  IN IPMI_BMC_ELOG_PROTOCOL      *This,
+  IN IPMI_ADD_SEL_ENTRY_REQUEST  *Entry
+  );
+
+/**
+  Start erasing the SEL in the background.
+
+  Queued entries are held while the erase runs and are written once it has
+  completed. Must be called at TPL_CALLBACK or below.
+
+  @param[in]      This   Protocol instance.
+  @param[in, out] Token  Completion token. Token->Event may be NULL.
+
+  @retval EFI_SUCCESS           The erase has started.
+  @retval EFI_INVALID_PARAMETER Token is NULL.
+  @retval EFI_ALREADY_STARTED   An erase is already running.
+  @retval Others                The BMC refused to start the erase.
+**/
+typedef
+EFI_STATUS
+(EFIAPI *IPMI_BMC_ELOG_ERASE_SEL) (
+  IN     IPMI_BMC_ELOG_PROTOCOL  *This,
+  IN OUT IPMI_SEL_ERASE_TOKEN    *Token
+  );
+
+struct _IPMI_BMC_ELOG_PROTOCOL {
+  IPMI_BMC_ELOG_LOG_EVENT  LogEvent;
+  IPMI_BMC_ELOG_ERASE_SEL  EraseSel;
+};
+
+extern EFI_GUID gIpmiBmcElogProtocolGuid;
+
+#endif
@@ -0,0 +1,23 @@
+/** @file
+  IPMI BMC ready protocol.
+
+  A NULL interface installed by the IPMI DXE initialization once the BMC has
+  answered Get Device ID. Drivers that need the BMC register a protocol
+  notify on it instead of waiting for the BMC in their entry point.
+
+Copyright (c) 2019, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef _IPMI_BMC_READY_PROTOCOL_H_
+#define _IPMI_BMC_READY_PROTOCOL_H_
+
+#define IPMI_BMC_READY_PROTOCOL_GUID \
+  { \
+    0x52a923bb, 0xcfa3, 0x44c9, { 0x8e, 0x43, 0xed, 0x1b, 0x61, 0x2c, 0xc0, 0xcd } \
+  }
+
+extern EFI_GUID gIpmiBmcReadyProtocolGuid;
+
+#endif
@@ -0,0 +1,57 @@
+/** @file
+  IPMI FRU protocol.
+
+  Published once by the IPMI FRU driver with the FRU inventory of every
+  logical FRU device read from the BMC and parsed, so that consumers such as
+  SMBIOS producers do not have to issue Read FRU Data commands themselves.
+
+Copyright (c) 2019, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef _IPMI_FRU_PROTOCOL_H_
+#define _IPMI_FRU_PROTOCOL_H_
+
+#define IPMI_FRU_PROTOCOL_GUID \
+  { \
+    0xf6114093, 0x46ac, 0x4222, { 0x83, 0x78, 0x5a, 0xd9, 0x1f, 0x5f, 0x1e, 0x60 } \
+  }
+
+#define IPMI_FRU_PROTOCOL_REVISION  0x00000001
+
+///
+/// One FRU device. String fields are NULL terminated ASCII and are NULL when
+/// the area or field is absent or could not be decoded.
+///
+typedef struct {
+  UINT8   DeviceId;
+  UINT16  InventorySize;
+  UINT8   *Inventory;
+
+  UINT8   ChassisType;
+  CHAR8   *ChassisPartNumber;
+  CHAR8   *ChassisSerialNumber;
+
+  CHAR8   *BoardManufacturer;
+  CHAR8   *BoardProductName;
+  CHAR8   *BoardSerialNumber;
+  CHAR8   *BoardPartNumber;
+
+  CHAR8   *ProductManufacturer;
+  CHAR8   *ProductName;
+  CHAR8   *ProductPartNumber;
+  CHAR8   *ProductVersion;
+  CHAR8   *ProductSerialNumber;
+  CHAR8   *ProductAssetTag;
+} IPMI_FRU_DEVICE_INFO;
+
+typedef struct {
+  UINT32                Revision;
+  UINTN                 DeviceCount;
+  IPMI_FRU_DEVICE_INFO  *Devices;
+} IPMI_FRU_PROTOCOL;
+
+extern EFI_GUID gIpmiFruProtocolGuid;
+
+#endif
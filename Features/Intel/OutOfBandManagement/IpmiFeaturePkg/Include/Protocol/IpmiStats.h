@@ -0,0 +1,58 @@
+/** @file
+  IPMI command statistics protocol.
+
+  A data only interface installed by the DXE instance of IpmiCommandLib the
+  first time any module sends an IPMI command. Every DXE module linked with
+  that instance adds its commands to the same table, so the table shows how
+  much boot time went to BMC communication and which commands it went to.
+
+Copyright (c) 2019, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef _IPMI_STATS_PROTOCOL_H_
+#define _IPMI_STATS_PROTOCOL_H_
+
+#define IPMI_STATS_PROTOCOL_GUID \
+  { \
+    0x145b06ed, 0x9905, 0x4780, { 0x99, 0x37, 0xe7, 0xfa, 0xa8, 0xe0, 0x54, 0xfd } \
+  }
+
+#define IPMI_STATS_PROTOCOL_REVISION  0x00000001
+
+#define IPMI_STATS_MAX_COMMANDS       64
+
+///
+/// Statistics of one NetFn/command pair. A retry is a command sent again
+/// right after the same command failed.
+///
+typedef struct {
+  UINT8   NetFunction;
+  UINT8   Command;
+  UINT32  Count;
+  UINT32  ErrorCount;
+  UINT32  RetryCount;
+  UINT64  TotalTimeNs;
+  UINT64  MaxTimeNs;
+} IPMI_COMMAND_STATS;
+
+typedef struct {
+  UINT32              Revision;
+  ///
+  /// Number of valid entries in Commands.
+  ///
+  UINT32              CommandCount;
+  ///
+  /// Commands not accounted because Commands was full.
+  ///
+  UINT32              DroppedCount;
+  UINT8               LastNetFunction;
+  UINT8               LastCommand;
+  BOOLEAN             LastFailed;
+  IPMI_COMMAND_STATS  Commands[IPMI_STATS_MAX_COMMANDS];
+} IPMI_STATS_PROTOCOL;
+
+extern EFI_GUID gIpmiStatsProtocolGuid;
+
+#endif
@@ -13,6 +13,375 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/BaseMemoryLib.h>
 #include <Library/IpmiCommandLib.h>
 #include <IndustryStandard/Ipmi.h>
+#include <Protocol/IpmiFru.h>
+
+#define FRU_MAX_DEVICES                 16
+#define FRU_MAX_READ_COUNT              0xFF
+#define FRU_READ_RESPONSE_HEADER        2
+#define FRU_ACCESS_BY_WORDS             BIT0
+#define FRU_COMMON_HEADER_SIZE          8
+#define FRU_COMMON_HEADER_VERSION       0x01
+#define FRU_CHASSIS_AREA_OFFSET         2
+#define FRU_BOARD_AREA_OFFSET           3
+#define FRU_PRODUCT_AREA_OFFSET         4
+#define FRU_TYPE_LENGTH_END             0xC1
+#define FRU_TYPE_BINARY                 0
+#define FRU_TYPE_BCD_PLUS               1
+#define FRU_TYPE_6BIT_ASCII             2
+#define FRU_TYPE_8BIT_ASCII             3
+
+#define SDR_TYPE_FRU_DEVICE_LOCATOR     0x11
+#define SDR_FRU_LOCATOR_ACCESS_ADDRESS  5
+#define SDR_FRU_LOCATOR_DEVICE_ID       6
+#define SDR_FRU_LOCATOR_FLAGS           7
+#define SDR_FRU_LOCATOR_LOGICAL         BIT7
+#define SDR_RECORD_TYPE_OFFSET          3
+#define BMC_SLAVE_ADDRESS               0x20
+
+IPMI_FRU_PROTOCOL     mIpmiFru = {
+  IPMI_FRU_PROTOCOL_REVISION,
+  0,
+  NULL
+};
+
+IPMI_FRU_DEVICE_INFO  mFruDevices[FRU_MAX_DEVICES];
+
+EFI_STATUS
+ReadFruInventory (
+  IN  UINT8   DeviceId,
+  OUT UINT8   **Inventory,
+  OUT UINT16  *InventorySize
+  )
+/*++
+
+Routine Description:
+
+  Read the whole FRU inventory area of a FRU device, using the largest
+  Read FRU Data count the BMC accepts.
+
+Arguments:
+
+  DeviceId       - FRU device ID
+  Inventory      - Allocated buffer holding the inventory area
+  InventorySize  - Size of the inventory area in bytes
+
+Returns:
+
+  EFI_STATUS
+
+--*/
+{
+  EFI_STATUS                                 Status;
+  IPMI_GET_FRU_INVENTORY_AREA_INFO_REQUEST   GetFruInventoryAreaInfoRequest;
+  IPMI_GET_FRU_INVENTORY_AREA_INFO_RESPONSE  GetFruInventoryAreaInfoResponse;
+  IPMI_READ_FRU_DATA_REQUEST                 ReadFruDataRequest;
+  UINT8                                      ReadFruDataResponse[FRU_READ_RESPONSE_HEADER + FRU_MAX_READ_COUNT];
+  UINT32                                     ResponseSize;
+  UINT8                                      *Buffer;
+  UINT16                                     Size;
+  UINT16                                     Offset;
+  UINT8                                      ReadCount;
+  UINT8                                      CountReturned;
+  UINTN                                      Shift;
+
+  GetFruInventoryAreaInfoRequest.DeviceId = DeviceId;
+  Status = IpmiGetFruInventoryAreaInfo (&GetFruInventoryAreaInfoRequest, &GetFruInventoryAreaInfoResponse);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+  if (GetFruInventoryAreaInfoResponse.CompletionCode != 0 ||
+      GetFruInventoryAreaInfoResponse.InventoryAreaSize < FRU_COMMON_HEADER_SIZE) {
+    return EFI_NOT_FOUND;
+  }
+
+  //
+  // Offsets and counts are in words for devices that are accessed by words.
+  //
+  Shift  = ((GetFruInventoryAreaInfoResponse.AccessType & FRU_ACCESS_BY_WORDS) != 0) ? 1 : 0;
+  Size   = GetFruInventoryAreaInfoResponse.InventoryAreaSize;
+  Buffer = AllocateZeroPool (Size);
+  if (Buffer == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  ReadCount = FRU_MAX_READ_COUNT;
+  Offset    = 0;
+  while (Offset < Size) {
+    ReadFruDataRequest.DeviceId        = DeviceId;
+    ReadFruDataRequest.InventoryOffset = (UINT16) (Offset >> Shift);
+    ReadFruDataRequest.CountToRead     = (UINT8) (MIN ((UINT16) ReadCount, Size - Offset) >> Shift);
+    if (ReadFruDataRequest.CountToRead == 0) {
+      ReadFruDataRequest.CountToRead = 1;
+    }
+
+    ResponseSize = sizeof (ReadFruDataResponse);
+    Status = IpmiReadFruData (&ReadFruDataRequest, (IPMI_READ_FRU_DATA_RESPONSE *) ReadFruDataResponse, &ResponseSize);
+    if (EFI_ERROR (Status) || ResponseSize < FRU_READ_RESPONSE_HEADER || ReadFruDataResponse[0] != 0) {
+      //
+      // Most BMCs reject a count larger than their message buffer; shrink
+      // the count and keep it for the rest of the inventory.
+      //
+      if (ReadCount > (1 << (Shift + 3))) {
+        ReadCount = ReadCount / 2;
+        continue;
+      }
+      FreePool (Buffer);
+      return EFI_ERROR (Status) ? Status : EFI_DEVICE_ERROR;
+    }
+
+    CountReturned = (UINT8) (ReadFruDataResponse[1] << Shift);
+    if (CountReturned == 0 || CountReturned > ResponseSize - FRU_READ_RESPONSE_HEADER) {
+      FreePool (Buffer);
+      return EFI_DEVICE_ERROR;
+    }
+    CountReturned = (UINT8) MIN ((UINT16) CountReturned, Size - Offset);
+
+    CopyMem (Buffer + Offset, &ReadFruDataResponse[FRU_READ_RESPONSE_HEADER], CountReturned);
+    Offset = Offset + CountReturned;
+  }
+
+  *Inventory     = Buffer;
+  *InventorySize = Size;
+  return EFI_SUCCESS;
+}
+
+CHAR8 *
+DecodeFruField (
+  IN UINT8   TypeLength,
+  IN UINT8   *Data
+  )
+/*++
+
+Routine Description:
+
+  Decode one type/length encoded FRU field into an allocated ASCII string.
+
+Arguments:
+
+  TypeLength  - Type/length byte of the field
+  Data        - Field data following the type/length byte
+
+Returns:
+
+  Allocated NULL terminated string, or NULL for empty or binary fields.
+
+--*/
+{
+  CONST CHAR8  BcdPlus[] = "0123456789 -.???";
+  UINTN        Length;
+  UINTN        Index;
+  UINTN        Bits;
+  CHAR8        *String;
+
+  Length = TypeLength & 0x3F;
+  if (Length == 0 || (TypeLength >> 6) == FRU_TYPE_BINARY) {
+    return NULL;
+  }
+
+  String = AllocateZeroPool (Length * 2 + 1);
+  if (String == NULL) {
+    return NULL;
+  }
+
+  switch (TypeLength >> 6) {
+  case FRU_TYPE_BCD_PLUS:
+    for (Index = 0; Index < Length; Index++) {
+      String[Index * 2]     = BcdPlus[Data[Index] >> 4];
+      String[Index * 2 + 1] = BcdPlus[Data[Index] & 0x0F];
+    }
+    break;
+
+  case FRU_TYPE_6BIT_ASCII:
+    //
+    // Four 6-bit characters are packed little endian into every three bytes.
+    //
+    for (Index = 0; Index < (Length * 8) / 6; Index++) {
+      Bits = Index * 6;
+      String[Index] = (CHAR8) (0x20 + (((Data[Bits / 8] | ((Bits / 8 + 1 < Length) ? Data[Bits / 8 + 1] << 8 : 0)) >> (Bits % 8)) & 0x3F));
+    }
+    break;
+
+  default:
+    CopyMem (String, Data, Length);
+    break;
+  }
+
+  return String;
+}
+
+VOID
+ParseFruArea (
+  IN  UINT8   *Inventory,
+  IN  UINT16  InventorySize,
+  IN  UINT8   HeaderOffset,
+  IN  UINTN   FixedSize,
+  OUT UINT8   **Fixed,
+  OUT CHAR8   ***Fields,
+  IN  UINTN   FieldCount
+  )
+/*++
+
+Routine Description:
+
+  Locate one FRU info area from the common header, check its checksum and
+  decode its leading type/length fields.
+
+Arguments:
+
+  Inventory      - FRU inventory area
+  InventorySize  - Size of the inventory area
+  HeaderOffset   - Offset of the area pointer in the common header
+  FixedSize      - Bytes between the area header and the first field
+  Fixed          - Returns the start of the fixed bytes, or NULL
+  Fields         - Destinations for the decoded fields
+  FieldCount     - Number of fields to decode
+
+Returns:
+
+  None
+
+--*/
+{
+  UINTN  Start;
+  UINTN  Length;
+  UINTN  Offset;
+  UINTN  Index;
+
+  *Fixed = NULL;
+  Start  = Inventory[HeaderOffset] * 8;
+  if (Start == 0 || Start + 2 > InventorySize) {
+    return;
+  }
+
+  Length = Inventory[Start + 1] * 8;
+  if (Length < 2 + FixedSize || Start + Length > InventorySize ||
+      CalculateSum8 (&Inventory[Start], Length) != 0) {
+    DEBUG ((DEBUG_WARN, "IpmiFru: bad FRU area at 0x%x\n", Start));
+    return;
+  }
+
+  *Fixed = &Inventory[Start + 2];
+  Offset = Start + 2 + FixedSize;
+  for (Index = 0; Index < FieldCount; Index++) {
+    if (Offset >= Start + Length || Inventory[Offset] == FRU_TYPE_LENGTH_END) {
+      break;
+    }
+    if (Offset + 1 + (Inventory[Offset] & 0x3F) > Start + Length) {
+      break;
+    }
+    *Fields[Index] = DecodeFruField (Inventory[Offset], &Inventory[Offset + 1]);
+    Offset += 1 + (Inventory[Offset] & 0x3F);
+  }
+}
+
+EFI_STATUS
+ParseFruDevice (
+  IN OUT IPMI_FRU_DEVICE_INFO  *Device
+  )
+/*++
+
+Routine Description:
+
+  Parse the chassis, board and product info areas of a FRU inventory.
+
+Arguments:
+
+  Device  - FRU device whose Inventory has been read
+
+Returns:
+
+  EFI_STATUS
+
+--*/
+{
+  UINT8  *Fixed;
+  CHAR8  **ChassisFields[2];
+  CHAR8  **BoardFields[4];
+  CHAR8  **ProductFields[6];
+
+  if (Device->Inventory[0] != FRU_COMMON_HEADER_VERSION ||
+      CalculateSum8 (Device->Inventory, FRU_COMMON_HEADER_SIZE) != 0) {
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  ChassisFields[0] = &Device->ChassisPartNumber;
+  ChassisFields[1] = &Device->ChassisSerialNumber;
+  ParseFruArea (Device->Inventory, Device->InventorySize, FRU_CHASSIS_AREA_OFFSET, 1, &Fixed, ChassisFields, ARRAY_SIZE (ChassisFields));
+  if (Fixed != NULL) {
+    Device->ChassisType = Fixed[0];
+  }
+
+  //
+  // The board area has a language code and a 3 byte manufacturing date.
+  //
+  BoardFields[0] = &Device->BoardManufacturer;
+  BoardFields[1] = &Device->BoardProductName;
+  BoardFields[2] = &Device->BoardSerialNumber;
+  BoardFields[3] = &Device->BoardPartNumber;
+  ParseFruArea (Device->Inventory, Device->InventorySize, FRU_BOARD_AREA_OFFSET, 4, &Fixed, BoardFields, ARRAY_SIZE (BoardFields));
+
+  ProductFields[0] = &Device->ProductManufacturer;
+  ProductFields[1] = &Device->ProductName;
+  ProductFields[2] = &Device->ProductPartNumber;
+  ProductFields[3] = &Device->ProductVersion;
+  ProductFields[4] = &Device->ProductSerialNumber;
+  ProductFields[5] = &Device->ProductAssetTag;
+  ParseFruArea (Device->Inventory, Device->InventorySize, FRU_PRODUCT_AREA_OFFSET, 1, &Fixed, ProductFields, ARRAY_SIZE (ProductFields));
+
+  return EFI_SUCCESS;
+}
+
+VOID
+AddFruDevice (
+  IN UINT8  DeviceId
+  )
+/*++
+
+Routine Description:
+
+  Read and parse one FRU device and add it to the published FRU list.
+
+Arguments:
+
+  DeviceId  - FRU device ID
+
+Returns:
+
+  None
+
+--*/
+{
+  EFI_STATUS            Status;
+  UINTN                 Index;
+  IPMI_FRU_DEVICE_INFO  *Device;
+
+  for (Index = 0; Index < mIpmiFru.DeviceCount; Index++) {
+    if (mFruDevices[Index].DeviceId == DeviceId) {
+      return;
+    }
+  }
+  if (mIpmiFru.DeviceCount >= FRU_MAX_DEVICES) {
+    return;
+  }
+
+  Device = &mFruDevices[mIpmiFru.DeviceCount];
+  ZeroMem (Device, sizeof (*Device));
+  Device->DeviceId = DeviceId;
+
+  Status = ReadFruInventory (DeviceId, &Device->Inventory, &Device->InventorySize);
+  if (EFI_ERROR (Status)) {
+    DEBUG((DEBUG_ERROR, "!!! IpmiFru  ReadFruInventory (%d) Status=%r\n", DeviceId, Status));
+    return;
+  }
+  DEBUG((DEBUG_INFO, "IpmiFru  Device %d InventoryAreaSize=%x\n", DeviceId, Device->InventorySize));
+
+  Status = ParseFruDevice (Device);
+  if (EFI_ERROR (Status)) {
+    DEBUG((DEBUG_ERROR, "!!! IpmiFru  ParseFruDevice (%d) Status=%r\n", DeviceId, Status));
+  }
+
+  mIpmiFru.DeviceCount++;
+}
 
 EFI_STATUS
 EFIAPI
@@ -39,8 +408,11 @@ Returns:
 {
   EFI_STATUS                                 Status;
   IPMI_GET_DEVICE_ID_RESPONSE                ControllerInfo;
-  IPMI_GET_FRU_INVENTORY_AREA_INFO_REQUEST   GetFruInventoryAreaInfoRequest;
-  IPMI_GET_FRU_INVENTORY_AREA_INFO_RESPONSE  GetFruInventoryAreaInfoResponse;
+  IPMI_REPOSITORY_CACHE                      SdrCache;
+  UINTN                                      Position;
+  UINT8                                      *Record;
+  UINT16                                     RecordSize;
+  EFI_HANDLE                                 Handle;
 
   //
   //  Get all the SDR Records from BMC and retrieve the Record ID from the structure for future use.
@@ -53,15 +425,45 @@ Returns:
 
   DEBUG((DEBUG_ERROR, "!!! IpmiFru  FruInventorySupport %x\n", ControllerInfo.DeviceSupport.Bits.FruInventorySupport));
 
+  mIpmiFru.Devices = mFruDevices;
+
   if (ControllerInfo.DeviceSupport.Bits.FruInventorySupport) {
-    GetFruInventoryAreaInfoRequest.DeviceId = 0;
-    Status = IpmiGetFruInventoryAreaInfo (&GetFruInventoryAreaInfoRequest, &GetFruInventoryAreaInfoResponse);
-    if (EFI_ERROR (Status)) {
-      DEBUG((DEBUG_ERROR, "!!! IpmiFru  IpmiGetFruInventoryAreaInfo Status=%x\n", Status));
-      return Status;
+    //
+    // FRU device 0 is the BMC's own inventory; further logical FRU devices
+    // behind the BMC are found through the FRU device locator records of
+    // the SDR.
+    //
+    AddFruDevice (0);
+
+    if (ControllerInfo.DeviceSupport.Bits.SdrRepositorySupport) {
+      ZeroMem (&SdrCache, sizeof (SdrCache));
+      Status = IpmiReadSdrRepository (&SdrCache);
+      if (!EFI_ERROR (Status)) {
+        Position = 0;
+        while (!EFI_ERROR (IpmiGetNextRepositoryRecord (&SdrCache, &Position, &Record, &RecordSize))) {
+          if (RecordSize > SDR_FRU_LOCATOR_FLAGS &&
+              Record[SDR_RECORD_TYPE_OFFSET] == SDR_TYPE_FRU_DEVICE_LOCATOR &&
+              Record[SDR_FRU_LOCATOR_ACCESS_ADDRESS] == BMC_SLAVE_ADDRESS &&
+              (Record[SDR_FRU_LOCATOR_FLAGS] & SDR_FRU_LOCATOR_LOGICAL) != 0) {
+            AddFruDevice (Record[SDR_FRU_LOCATOR_DEVICE_ID]);
+          }
+        }
+      }
+      IpmiFreeRepositoryCache (&SdrCache);
     }
-    DEBUG((DEBUG_ERROR, "!!! IpmiFru  InventoryAreaSize=%x\n", GetFruInventoryAreaInfoResponse.InventoryAreaSize));
   }
 
+  //
+  // Publish the parsed inventory so later consumers never touch the BMC for it.
+  //
+  Handle = NULL;
+  Status = gBS->InstallProtocolInterface (
+                  &Handle,
+                  &gIpmiFruProtocolGuid,
+                  EFI_NATIVE_INTERFACE,
+                  &mIpmiFru
+                  );
+  ASSERT_EFI_ERROR (Status);
+
   return EFI_SUCCESS;
 }
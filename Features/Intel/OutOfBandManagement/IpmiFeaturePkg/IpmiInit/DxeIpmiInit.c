@@ -10,10 +10,17 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/BaseLib.h>
 #include <Library/DebugLib.h>
 #include <Library/TimerLib.h>
+#include <Library/PcdLib.h>
+#include <Library/UefiBootServicesTableLib.h>
 #include <Library/IpmiCommandLib.h>
+#include <Protocol/IpmiBmcReady.h>
 
 #define BMC_TIMEOUT          30  // [s] How long shall BIOS wait for BMC
 #define BMC_KCS_TIMEOUT      5   // [s] Single KSC request timeout
+#define BMC_RETRY_PERIOD     50  // [ms] Delay between two Get Device ID attempts
+
+EFI_EVENT  mBmcProbeEvent;
+UINT32     mBmcProbeRetries;
 
 EFI_STATUS
 GetSelfTest (
@@ -56,6 +63,42 @@ Returns:
   return EFI_SUCCESS;
 }
 
+EFI_STATUS
+ProbeDeviceId (
+  OUT BOOLEAN *UpdateMode
+  )
+/*++
+
+Routine Description:
+  Make a single Get Device ID attempt.
+
+Arguments:
+  UpdateMode - Returns TRUE when the BMC is in Force Update Mode
+
+Returns:
+  Status
+
+--*/
+{
+  EFI_STATUS                   Status;
+  IPMI_GET_DEVICE_ID_RESPONSE  BmcInfo;
+
+  Status = IpmiGetDeviceId (&BmcInfo);
+  if (EFI_ERROR(Status)) {
+    return Status;
+  }
+
+  DEBUG((
+    DEBUG_INFO,
+    "[IPMI] BMC Device ID: 0x%02X, firmware version: %d.%02X\n",
+    BmcInfo.DeviceId,
+    BmcInfo.FirmwareRev1.Bits.MajorFirmwareRev,
+    BmcInfo.MinorFirmwareRev
+    ));
+  *UpdateMode = (BOOLEAN)BmcInfo.FirmwareRev1.Bits.UpdateMode;
+  return Status;
+}
+
 EFI_STATUS
 GetDeviceId (
   OUT BOOLEAN *UpdateMode
@@ -74,7 +117,6 @@ Returns:
 --*/
 {
   EFI_STATUS                   Status;
-  IPMI_GET_DEVICE_ID_RESPONSE  BmcInfo;
   UINT32                       Retries;
 
   //
@@ -87,28 +129,103 @@ Returns:
   // Get the device ID information for the BMC.
   //
   do {
-    Status = IpmiGetDeviceId (&BmcInfo);
+    Status = ProbeDeviceId (UpdateMode);
     if (!EFI_ERROR(Status)) {
       break;
     }
     DEBUG ((DEBUG_ERROR, "[IPMI] BMC does not respond (status: %r), %d retries left\n", Status, Retries));
-    MicroSecondDelay(50 * 1000);
+    MicroSecondDelay(BMC_RETRY_PERIOD * 1000);
     if (Retries-- == 0) {
       return Status;
     }
   } while (TRUE);
 
-  DEBUG((
-    DEBUG_INFO,
-    "[IPMI] BMC Device ID: 0x%02X, firmware version: %d.%02X\n",
-    BmcInfo.DeviceId,
-    BmcInfo.FirmwareRev1.Bits.MajorFirmwareRev,
-    BmcInfo.MinorFirmwareRev
-    ));
-  *UpdateMode = (BOOLEAN)BmcInfo.FirmwareRev1.Bits.UpdateMode;
   return Status;
 }
 
+VOID
+BmcReady (
+  IN BOOLEAN  UpdateMode
+  )
+/*++
+
+Routine Description:
+  Finish the initialization once the BMC has answered Get Device ID and
+  announce that the BMC can be used.
+
+Arguments:
+  UpdateMode - TRUE when the BMC is in Force Update Mode
+
+Returns:
+  None
+
+--*/
+{
+  EFI_HANDLE  Handle;
+  EFI_STATUS  Status;
+
+  //
+  // Do not continue initialization if the BMC is in Force Update Mode.
+  //
+  if (UpdateMode) {
+    return;
+  }
+
+  //
+  // Get the SELF TEST Results.
+  //
+  GetSelfTest ();
+
+  Handle = NULL;
+  Status = gBS->InstallProtocolInterface (
+                  &Handle,
+                  &gIpmiBmcReadyProtocolGuid,
+                  EFI_NATIVE_INTERFACE,
+                  NULL
+                  );
+  ASSERT_EFI_ERROR (Status);
+}
+
+VOID
+EFIAPI
+BmcProbeTimerHandler (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+/*++
+
+Routine Description:
+  Periodic timer handler of the asynchronous initialization. Makes one Get
+  Device ID attempt per period until the BMC answers or BMC_TIMEOUT expires.
+
+Arguments:
+  Event   - The probe timer event
+  Context - Not used
+
+Returns:
+  None
+
+--*/
+{
+  EFI_STATUS  Status;
+  BOOLEAN     UpdateMode;
+
+  Status = ProbeDeviceId (&UpdateMode);
+  if (EFI_ERROR (Status) && mBmcProbeRetries-- != 0) {
+    return;
+  }
+
+  gBS->CloseEvent (mBmcProbeEvent);
+  mBmcProbeEvent = NULL;
+
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "\n[IPMI] BMC does not respond (status: %r), giving up!\n\n", Status));
+    return;
+  }
+
+  BmcReady (UpdateMode);
+}
+
 /**
   The entry point of the Ipmi DXE.
 
@@ -130,18 +247,44 @@ IpmiInterfaceInit (
 
   DEBUG((DEBUG_ERROR,"IPMI Dxe:Get BMC Device Id\n"));
 
+  if (FeaturePcdGet (PcdIpmiAsyncInit)) {
+    //
+    // Try once now; if the BMC is still coming up keep probing from a timer
+    // event so that the rest of DXE does not wait for it.
+    //
+    Status = ProbeDeviceId (&UpdateMode);
+    if (!EFI_ERROR (Status)) {
+      BmcReady (UpdateMode);
+      return EFI_SUCCESS;
+    }
+
+    DEBUG ((DEBUG_INFO, "[IPMI] BMC not ready (status: %r), probing in background\n", Status));
+    mBmcProbeRetries = (BMC_TIMEOUT * 1000) / BMC_RETRY_PERIOD;
+    Status = gBS->CreateEvent (
+                    EVT_TIMER | EVT_NOTIFY_SIGNAL,
+                    TPL_CALLBACK,
+                    BmcProbeTimerHandler,
+                    NULL,
+                    &mBmcProbeEvent
+                    );
+    if (!EFI_ERROR (Status)) {
+      Status = gBS->SetTimer (mBmcProbeEvent, TimerPeriodic, BMC_RETRY_PERIOD * 10000);
+      if (EFI_ERROR (Status)) {
+        gBS->CloseEvent (mBmcProbeEvent);
+        mBmcProbeEvent = NULL;
+      }
+    }
+    if (!EFI_ERROR (Status)) {
+      return EFI_SUCCESS;
+    }
+  }
+
   //
   // Get the Device ID and check if the system is in Force Update mode.
   //
   Status = GetDeviceId (&UpdateMode);
-  //
-  // Do not continue initialization if the BMC is in Force Update Mode.
-  //
-  if (!EFI_ERROR(Status) && !UpdateMode) {
-    //
-    // Get the SELF TEST Results.
-    //
-    GetSelfTest ();
+  if (!EFI_ERROR(Status)) {
+    BmcReady (UpdateMode);
   }
 
   return EFI_SUCCESS;
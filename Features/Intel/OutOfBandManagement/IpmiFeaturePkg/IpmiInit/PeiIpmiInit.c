@@ -10,6 +10,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/BaseLib.h>
 #include <Library/DebugLib.h>
 #include <Library/TimerLib.h>
+#include <Library/PcdLib.h>
 #include <Library/IpmiCommandLib.h>
 
 #define BMC_TIMEOUT_PEI      50  // [s] How long shall BIOS wait for BMC
@@ -40,8 +41,14 @@ Returns:
   // Set up a loop to retry for up to 30 seconds. Calculate retries not timeout
   // so that in case KCS is not enabled and EfiIpmiSendCommand() returns
   // immediately we will not wait all the 30 seconds.
+  // With asynchronous init only probe once; the DXE driver keeps waiting for
+  // the BMC without blocking boot.
   //
-  Retries = BMC_TIMEOUT_PEI/ BMC_KCS_TIMEOUT + 1;
+  if (FeaturePcdGet (PcdIpmiAsyncInit)) {
+    Retries = 0;
+  } else {
+    Retries = BMC_TIMEOUT_PEI/ BMC_KCS_TIMEOUT + 1;
+  }
   //
   // Get the device ID information for the BMC.
   //
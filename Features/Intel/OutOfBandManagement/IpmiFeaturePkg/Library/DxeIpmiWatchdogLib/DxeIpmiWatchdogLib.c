@@ -0,0 +1,206 @@
+/** @file
+  DXE IPMI watchdog timer manager.
+
+  The tracked watchdog state lives in a block shared through
+  gIpmiWatchdogStateGuid, installed by the first module using the library,
+  so that FRB and OS watchdog drivers see each other's changes without
+  asking the BMC again.
+
+Copyright (c) 2019, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <PiDxe.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/IpmiCommandLib.h>
+#include <Library/IpmiWatchdogLib.h>
+
+typedef struct {
+  BOOLEAN                           Valid;
+  BOOLEAN                           Pending;
+  IPMI_GET_WATCHDOG_TIMER_RESPONSE  Current;
+  IPMI_SET_WATCHDOG_TIMER_REQUEST   Request;
+} IPMI_WATCHDOG_STATE;
+
+IPMI_WATCHDOG_STATE  *mWatchdogState;
+
+/**
+  Return the state an accepted Set Watchdog Timer leaves the timer in.
+
+  @param[in]  Current  State before the command.
+  @param[in]  Request  The command.
+  @param[out] Next     State after the command.
+**/
+VOID
+WatchdogApplyRequest (
+  IN  IPMI_GET_WATCHDOG_TIMER_RESPONSE  *Current,
+  IN  IPMI_SET_WATCHDOG_TIMER_REQUEST   *Request,
+  OUT IPMI_GET_WATCHDOG_TIMER_RESPONSE  *Next
+  )
+{
+  CopyMem (Next, Current, sizeof (*Next));
+  Next->TimerUse                      = Request->TimerUse;
+  Next->TimerActions                  = Request->TimerActions;
+  Next->PretimeoutInterval            = Request->PretimeoutInterval;
+  Next->InitialCountdownValue         = Request->InitialCountdownValue;
+  Next->PresentCountdownValue         = Request->InitialCountdownValue;
+  Next->TimerUseExpirationFlagsClear &= (UINT8) ~Request->TimerUseExpirationFlagsClear;
+  //
+  // The timer keeps running only if it was running and "don't stop" is set.
+  //
+  Next->TimerUse.Bits.TimerRunning    = Current->TimerUse.Bits.TimerRunning & Request->TimerUse.Bits.TimerRunning;
+}
+
+/**
+  The constructor locates or creates the shared watchdog state.
+
+  @param ImageHandle  The firmware allocated handle for the EFI image.
+  @param SystemTable  A pointer to the EFI System Table.
+
+  @retval EFI_SUCCESS  The constructor always returns EFI_SUCCESS.
+**/
+EFI_STATUS
+EFIAPI
+DxeIpmiWatchdogLibConstructor (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  )
+{
+  EFI_STATUS  Status;
+  EFI_HANDLE  Handle;
+
+  Status = gBS->LocateProtocol (&gIpmiWatchdogStateGuid, NULL, (VOID **) &mWatchdogState);
+  if (!EFI_ERROR (Status)) {
+    return EFI_SUCCESS;
+  }
+
+  mWatchdogState = AllocateZeroPool (sizeof (*mWatchdogState));
+  if (mWatchdogState == NULL) {
+    return EFI_SUCCESS;
+  }
+
+  Handle = NULL;
+  Status = gBS->InstallProtocolInterface (
+                  &Handle,
+                  &gIpmiWatchdogStateGuid,
+                  EFI_NATIVE_INTERFACE,
+                  mWatchdogState
+                  );
+  ASSERT_EFI_ERROR (Status);
+
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+EFIAPI
+IpmiWatchdogGetTimer (
+  OUT IPMI_GET_WATCHDOG_TIMER_RESPONSE  *GetWatchdogTimer
+  )
+{
+  EFI_STATUS  Status;
+
+  if (mWatchdogState == NULL) {
+    return IpmiGetWatchdogTimer (GetWatchdogTimer);
+  }
+
+  if (!mWatchdogState->Valid) {
+    Status = IpmiGetWatchdogTimer (&mWatchdogState->Current);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+    mWatchdogState->Valid = TRUE;
+  }
+
+  if (mWatchdogState->Pending) {
+    WatchdogApplyRequest (&mWatchdogState->Current, &mWatchdogState->Request, GetWatchdogTimer);
+  } else {
+    CopyMem (GetWatchdogTimer, &mWatchdogState->Current, sizeof (*GetWatchdogTimer));
+  }
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+EFIAPI
+IpmiWatchdogSetTimer (
+  IN IPMI_SET_WATCHDOG_TIMER_REQUEST  *SetWatchdogTimer
+  )
+{
+  EFI_STATUS                        Status;
+  IPMI_GET_WATCHDOG_TIMER_RESPONSE  GetWatchdogTimer;
+  UINT8                             FlagsClear;
+
+  if (mWatchdogState == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = IpmiWatchdogGetTimer (&GetWatchdogTimer);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  FlagsClear = mWatchdogState->Pending ? mWatchdogState->Request.TimerUseExpirationFlagsClear : 0;
+  CopyMem (&mWatchdogState->Request, SetWatchdogTimer, sizeof (mWatchdogState->Request));
+  mWatchdogState->Request.TimerUseExpirationFlagsClear |= FlagsClear;
+  mWatchdogState->Pending = TRUE;
+
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+EFIAPI
+IpmiWatchdogFlush (
+  OUT UINT8  *CompletionCode  OPTIONAL
+  )
+{
+  EFI_STATUS                        Status;
+  IPMI_GET_WATCHDOG_TIMER_RESPONSE  *Current;
+  IPMI_SET_WATCHDOG_TIMER_REQUEST   *Request;
+  IPMI_GET_WATCHDOG_TIMER_RESPONSE  Next;
+  UINT8                             Code;
+
+  if (CompletionCode != NULL) {
+    *CompletionCode = 0;
+  }
+  if (mWatchdogState == NULL || !mWatchdogState->Pending) {
+    return EFI_SUCCESS;
+  }
+
+  Current = &mWatchdogState->Current;
+  Request = &mWatchdogState->Request;
+  mWatchdogState->Pending = FALSE;
+
+  //
+  // A Set Watchdog Timer reloads the countdown, so it is only redundant when
+  // the timer is stopped, stays stopped, keeps its configuration and has no
+  // expiration flag to clear.
+  //
+  if (Current->TimerUse.Bits.TimerRunning == 0 &&
+      Current->TimerUse.Uint8 == Request->TimerUse.Uint8 &&
+      Current->TimerActions.Uint8 == Request->TimerActions.Uint8 &&
+      Current->PretimeoutInterval == Request->PretimeoutInterval &&
+      Current->InitialCountdownValue == Request->InitialCountdownValue &&
+      (Current->TimerUseExpirationFlagsClear & Request->TimerUseExpirationFlagsClear) == 0) {
+    DEBUG ((DEBUG_INFO, "[IPMI] Set Watchdog Timer skipped, no change\n"));
+    return EFI_SUCCESS;
+  }
+
+  Status = IpmiSetWatchdogTimer (Request, &Code);
+  if (CompletionCode != NULL) {
+    *CompletionCode = Code;
+  }
+  if (EFI_ERROR (Status) || Code != 0) {
+    //
+    // The outcome is unknown; read the BMC again next time.
+    //
+    mWatchdogState->Valid = FALSE;
+    return Status;
+  }
+
+  WatchdogApplyRequest (Current, Request, &Next);
+  CopyMem (Current, &Next, sizeof (Next));
+  return EFI_SUCCESS;
+}
@@ -0,0 +1,136 @@
+/** @file
+  IPMI Command - DXE command statistics.
+
+  The statistics table is shared by all DXE modules through
+  gIpmiStatsProtocolGuid; the first module sending a command allocates and
+  installs it.
+
+Copyright (c) 2019, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <PiDxe.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/TimerLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Protocol/IpmiStats.h>
+
+#include "IpmiCommandLibInternal.h"
+
+IPMI_STATS_PROTOCOL  *mIpmiStats;
+
+IPMI_STATS_PROTOCOL *
+IpmiStatsGetTable (
+  VOID
+  )
+{
+  EFI_STATUS           Status;
+  IPMI_STATS_PROTOCOL  *Stats;
+  EFI_HANDLE           Handle;
+
+  if (mIpmiStats != NULL) {
+    return mIpmiStats;
+  }
+
+  Status = gBS->LocateProtocol (&gIpmiStatsProtocolGuid, NULL, (VOID **) &Stats);
+  if (EFI_ERROR (Status)) {
+    Stats = AllocateZeroPool (sizeof (*Stats));
+    if (Stats == NULL) {
+      return NULL;
+    }
+    Stats->Revision = IPMI_STATS_PROTOCOL_REVISION;
+
+    Handle = NULL;
+    Status = gBS->InstallProtocolInterface (
+                    &Handle,
+                    &gIpmiStatsProtocolGuid,
+                    EFI_NATIVE_INTERFACE,
+                    Stats
+                    );
+    if (EFI_ERROR (Status)) {
+      FreePool (Stats);
+      return NULL;
+    }
+  }
+
+  mIpmiStats = Stats;
+  return mIpmiStats;
+}
+
+UINT64
+IpmiStatsStart (
+  VOID
+  )
+{
+  return GetPerformanceCounter ();
+}
+
+VOID
+IpmiStatsRecord (
+  IN UINT8       NetFunction,
+  IN UINT8       Command,
+  IN EFI_STATUS  Status,
+  IN UINT64      Start
+  )
+{
+  UINT64               End;
+  UINT64               CounterStart;
+  UINT64               CounterEnd;
+  UINT64               ElapsedNs;
+  IPMI_STATS_PROTOCOL  *Stats;
+  IPMI_COMMAND_STATS   *Entry;
+  UINT32               Index;
+  EFI_TPL              OldTpl;
+
+  End = GetPerformanceCounter ();
+  GetPerformanceCounterProperties (&CounterStart, &CounterEnd);
+  if (CounterStart < CounterEnd) {
+    ElapsedNs = GetTimeInNanoSecond ((End >= Start) ? End - Start : (CounterEnd - Start) + (End - CounterStart));
+  } else {
+    ElapsedNs = GetTimeInNanoSecond ((Start >= End) ? Start - End : (Start - CounterEnd) + (CounterStart - End));
+  }
+
+  Stats = IpmiStatsGetTable ();
+  if (Stats == NULL) {
+    return;
+  }
+
+  OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+
+  Entry = NULL;
+  for (Index = 0; Index < Stats->CommandCount; Index++) {
+    if (Stats->Commands[Index].NetFunction == NetFunction &&
+        Stats->Commands[Index].Command == Command) {
+      Entry = &Stats->Commands[Index];
+      break;
+    }
+  }
+  if (Entry == NULL && Stats->CommandCount < IPMI_STATS_MAX_COMMANDS) {
+    Entry              = &Stats->Commands[Stats->CommandCount++];
+    Entry->NetFunction = NetFunction;
+    Entry->Command     = Command;
+  }
+
+  if (Entry == NULL) {
+    Stats->DroppedCount++;
+  } else {
+    Entry->Count++;
+    Entry->TotalTimeNs += ElapsedNs;
+    Entry->MaxTimeNs    = MAX (Entry->MaxTimeNs, ElapsedNs);
+    if (EFI_ERROR (Status)) {
+      Entry->ErrorCount++;
+    }
+    if (Stats->LastFailed && Stats->LastNetFunction == NetFunction && Stats->LastCommand == Command) {
+      Entry->RetryCount++;
+    }
+  }
+
+  Stats->LastNetFunction = NetFunction;
+  Stats->LastCommand     = Command;
+  Stats->LastFailed      = EFI_ERROR (Status);
+
+  gBS->RestoreTPL (OldTpl);
+}
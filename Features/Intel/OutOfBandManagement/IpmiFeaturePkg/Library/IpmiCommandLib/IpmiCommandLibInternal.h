@@ -0,0 +1,54 @@
+/** @file
+  IPMI Command Library internal definitions.
+
+Copyright (c) 2019, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef _IPMI_COMMAND_LIB_INTERNAL_H_
+#define _IPMI_COMMAND_LIB_INTERNAL_H_
+
+#include <Uefi.h>
+
+/**
+  Send an IPMI command through IpmiLib and account it in the command
+  statistics of this library instance.
+
+  Parameters and return values are those of IpmiSubmitCommand.
+**/
+EFI_STATUS
+InternalIpmiSubmitCommand (
+  IN     UINT8     NetFunction,
+  IN     UINT8     Command,
+  IN     UINT8     *RequestData,
+  IN     UINT32    RequestDataSize,
+  OUT    UINT8     *ResponseData,
+  IN OUT UINT32    *ResponseDataSize
+  );
+
+/**
+  Return the start time stamp of a command, in performance counter ticks.
+**/
+UINT64
+IpmiStatsStart (
+  VOID
+  );
+
+/**
+  Account one finished command.
+
+  @param[in] NetFunction  Net function of the command.
+  @param[in] Command      Command code.
+  @param[in] Status       Status returned by the transport.
+  @param[in] Start        Value returned by IpmiStatsStart for this command.
+**/
+VOID
+IpmiStatsRecord (
+  IN UINT8       NetFunction,
+  IN UINT8       Command,
+  IN EFI_STATUS  Status,
+  IN UINT64      Start
+  );
+
+#endif
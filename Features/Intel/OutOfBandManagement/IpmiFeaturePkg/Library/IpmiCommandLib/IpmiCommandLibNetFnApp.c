@@ -13,6 +13,8 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #include <IndustryStandard/Ipmi.h>
 
+#include "IpmiCommandLibInternal.h"
+
 EFI_STATUS
 EFIAPI
 IpmiGetDeviceId (
@@ -23,7 +25,7 @@ IpmiGetDeviceId (
   UINT32                       DataSize;
 
   DataSize = sizeof(*DeviceId);
-  Status = IpmiSubmitCommand (
+  Status = InternalIpmiSubmitCommand (
              IPMI_NETFN_APP,
              IPMI_APP_GET_DEVICE_ID,
              NULL,
@@ -44,7 +46,7 @@ IpmiGetSelfTestResult (
   UINT32                       DataSize;
 
   DataSize = sizeof(*SelfTestResult);
-  Status = IpmiSubmitCommand (
+  Status = InternalIpmiSubmitCommand (
              IPMI_NETFN_APP,
              IPMI_APP_GET_SELFTEST_RESULTS,
              NULL,
@@ -65,7 +67,7 @@ IpmiResetWatchdogTimer (
   UINT32                       DataSize;
 
   DataSize = sizeof(*CompletionCode);
-  Status = IpmiSubmitCommand (
+  Status = InternalIpmiSubmitCommand (
              IPMI_NETFN_APP,
              IPMI_APP_RESET_WATCHDOG_TIMER,
              NULL,
@@ -87,7 +89,7 @@ IpmiSetWatchdogTimer (
   UINT32                       DataSize;
 
   DataSize = sizeof(*CompletionCode);
-  Status = IpmiSubmitCommand (
+  Status = InternalIpmiSubmitCommand (
              IPMI_NETFN_APP,
              IPMI_APP_SET_WATCHDOG_TIMER,
              (VOID *)SetWatchdogTimer,
@@ -108,7 +110,7 @@ IpmiGetWatchdogTimer (
   UINT32                       DataSize;
 
   DataSize = sizeof(*GetWatchdogTimer);
-  Status = IpmiSubmitCommand (
+  Status = InternalIpmiSubmitCommand (
              IPMI_NETFN_APP,
              IPMI_APP_GET_WATCHDOG_TIMER,
              NULL,
@@ -130,7 +132,7 @@ IpmiSetBmcGlobalEnables (
   UINT32                       DataSize;
 
   DataSize = sizeof(*CompletionCode);
-  Status = IpmiSubmitCommand (
+  Status = InternalIpmiSubmitCommand (
              IPMI_NETFN_APP,
              IPMI_APP_SET_BMC_GLOBAL_ENABLES,
              (VOID *)SetBmcGlobalEnables,
@@ -151,7 +153,7 @@ IpmiGetBmcGlobalEnables (
   UINT32                       DataSize;
 
   DataSize = sizeof(*GetBmcGlobalEnables);
-  Status = IpmiSubmitCommand (
+  Status = InternalIpmiSubmitCommand (
              IPMI_NETFN_APP,
              IPMI_APP_GET_BMC_GLOBAL_ENABLES,
              NULL,
@@ -173,7 +175,7 @@ IpmiClearMessageFlags (
   UINT32                       DataSize;
 
   DataSize = sizeof(*CompletionCode);
-  Status = IpmiSubmitCommand (
+  Status = InternalIpmiSubmitCommand (
              IPMI_NETFN_APP,
              IPMI_APP_CLEAR_MESSAGE_FLAGS,
              (VOID *)ClearMessageFlagsRequest,
@@ -194,7 +196,7 @@ IpmiGetMessageFlags (
   UINT32                       DataSize;
 
   DataSize = sizeof(*GetMessageFlagsResponse);
-  Status = IpmiSubmitCommand (
+  Status = InternalIpmiSubmitCommand (
              IPMI_NETFN_APP,
              IPMI_APP_GET_MESSAGE_FLAGS,
              NULL,
@@ -214,7 +216,7 @@ IpmiGetMessage (
 {
   EFI_STATUS                   Status;
 
-  Status = IpmiSubmitCommand (
+  Status = InternalIpmiSubmitCommand (
              IPMI_NETFN_APP,
              IPMI_APP_GET_MESSAGE,
              NULL,
@@ -236,7 +238,7 @@ IpmiSendMessage (
 {
   EFI_STATUS                   Status;
 
-  Status = IpmiSubmitCommand (
+  Status = InternalIpmiSubmitCommand (
              IPMI_NETFN_APP,
              IPMI_APP_SEND_MESSAGE,
              (VOID *)SendMessageRequest,
@@ -13,6 +13,8 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #include <IndustryStandard/Ipmi.h>
 
+#include "IpmiCommandLibInternal.h"
+
 
 EFI_STATUS
 EFIAPI
@@ -24,7 +26,7 @@ IpmiGetChassisCapabilities (
   UINT32                       DataSize;
 
   DataSize = sizeof(*GetChassisCapabilitiesResponse);
-  Status = IpmiSubmitCommand (
+  Status = InternalIpmiSubmitCommand (
              IPMI_NETFN_CHASSIS,
              IPMI_CHASSIS_GET_CAPABILITIES,
              NULL,
@@ -45,7 +47,7 @@ IpmiGetChassisStatus (
   UINT32                       DataSize;
 
   DataSize = sizeof(*GetChassisStatusResponse);
-  Status = IpmiSubmitCommand (
+  Status = InternalIpmiSubmitCommand (
              IPMI_NETFN_CHASSIS,
              IPMI_CHASSIS_GET_STATUS,
              NULL,
@@ -67,7 +69,7 @@ IpmiChassisControl (
   UINT32                       DataSize;
 
   DataSize = sizeof(*CompletionCode);
-  Status = IpmiSubmitCommand (
+  Status = InternalIpmiSubmitCommand (
              IPMI_NETFN_CHASSIS,
              IPMI_CHASSIS_CONTROL,
              (VOID *)ChassisControlRequest,
@@ -89,7 +91,7 @@ IpmiSetPowerRestorePolicy (
   UINT32                       DataSize;
 
   DataSize = sizeof(*ChassisControlResponse);
-  Status = IpmiSubmitCommand (
+  Status = InternalIpmiSubmitCommand (
              IPMI_NETFN_CHASSIS,
              IPMI_CHASSIS_SET_POWER_RESTORE_POLICY,
              (VOID *)ChassisControlRequest,
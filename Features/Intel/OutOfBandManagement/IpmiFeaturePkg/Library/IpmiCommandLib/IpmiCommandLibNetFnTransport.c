@@ -13,6 +13,8 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #include <IndustryStandard/Ipmi.h>
 
+#include "IpmiCommandLibInternal.h"
+
 
 EFI_STATUS
 EFIAPI
@@ -25,7 +27,7 @@ IpmiSolActivating (
   UINT32                       DataSize;
 
   DataSize = sizeof(*CompletionCode);
-  Status = IpmiSubmitCommand (
+  Status = InternalIpmiSubmitCommand (
              IPMI_NETFN_TRANSPORT,
              IPMI_TRANSPORT_SOL_ACTIVATING,
              (VOID *)SolActivatingRequest,
@@ -48,7 +50,7 @@ IpmiSetSolConfigurationParameters (
   UINT32                       DataSize;
 
   DataSize = sizeof(*CompletionCode);
-  Status = IpmiSubmitCommand (
+  Status = InternalIpmiSubmitCommand (
              IPMI_NETFN_TRANSPORT,
              IPMI_TRANSPORT_SET_SOL_CONFIG_PARAM,
              (VOID *)SetConfigurationParametersRequest,
@@ -69,7 +71,7 @@ IpmiGetSolConfigurationParameters (
 {
   EFI_STATUS                   Status;
 
-  Status = IpmiSubmitCommand (
+  Status = InternalIpmiSubmitCommand (
              IPMI_NETFN_TRANSPORT,
              IPMI_TRANSPORT_GET_SOL_CONFIG_PARAM,
              (VOID *)GetConfigurationParametersRequest,
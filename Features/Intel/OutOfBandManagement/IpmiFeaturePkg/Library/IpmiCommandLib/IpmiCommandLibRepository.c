@@ -0,0 +1,501 @@
+/** @file
+  IPMI Command - SEL and SDR repository readers.
+
+  A repository is walked once with full record reads, falling back to the
+  largest partial read size the BMC accepts, and kept in a caller owned
+  IPMI_REPOSITORY_CACHE. Later reads only cost a Get SEL/SDR Repository Info
+  round trip while the BMC's last add and erase time stamps are unchanged.
+
+Copyright (c) 2018, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <PiPei.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/IpmiLib.h>
+#include <Library/IpmiCommandLib.h>
+
+#include <IndustryStandard/Ipmi.h>
+
+#include "IpmiCommandLibInternal.h"
+
+#define IPMI_REPOSITORY_FIRST_RECORD_ID   0x0000
+#define IPMI_REPOSITORY_LAST_RECORD_ID    0xFFFF
+#define IPMI_REPOSITORY_READ_ENTIRE       0xFF
+#define IPMI_REPOSITORY_READ_RETRIES      3
+#define IPMI_REPOSITORY_RESPONSE_HEADER   3
+#define IPMI_SDR_RECORD_HEADER_SIZE       5
+#define IPMI_SDR_RECORD_LENGTH_OFFSET     4
+#define IPMI_SDR_MAX_RECORD_SIZE          (IPMI_SDR_RECORD_HEADER_SIZE + 0xFF)
+#define IPMI_SEL_RECORD_SIZE              16
+
+#define IPMI_REPOSITORY_CC_NORMAL                 0x00
+#define IPMI_REPOSITORY_CC_RESERVATION_CANCELED   0xC5
+#define IPMI_REPOSITORY_CC_CANNOT_RETURN_LENGTH   0xCA
+
+//
+// State kept across one SDR repository walk. ChunkSize is the partial read
+// size last accepted by the BMC; it is only ever lowered, so every later
+// partial read starts at a size known to work.
+//
+typedef struct {
+  UINT16  ReservationId;
+  BOOLEAN Reserved;
+  UINT8   ChunkSize;
+} IPMI_SDR_READ_CONTEXT;
+
+STATIC
+EFI_STATUS
+IpmiRepositoryGetInfo (
+  IN  BOOLEAN  Sdr,
+  OUT UINT32   *RecentAddTimeStamp,
+  OUT UINT32   *RecentEraseTimeStamp,
+  OUT UINTN    *RecordCount
+  )
+{
+  EFI_STATUS                             Status;
+  IPMI_GET_SEL_INFO_RESPONSE             SelInfo;
+  IPMI_GET_SDR_REPOSITORY_INFO_RESPONSE  SdrInfo;
+
+  if (Sdr) {
+    Status = IpmiGetSdrRepositoryInfo (&SdrInfo);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+    if (SdrInfo.CompletionCode != IPMI_REPOSITORY_CC_NORMAL) {
+      return EFI_DEVICE_ERROR;
+    }
+    *RecentAddTimeStamp   = SdrInfo.RecentAdditionTimeStamp;
+    *RecentEraseTimeStamp = SdrInfo.RecentEraseTimeStamp;
+    *RecordCount          = SdrInfo.RecordCount;
+  } else {
+    Status = IpmiGetSelInfo (&SelInfo);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+    if (SelInfo.CompletionCode != IPMI_REPOSITORY_CC_NORMAL) {
+      return EFI_DEVICE_ERROR;
+    }
+    *RecentAddTimeStamp   = SelInfo.RecentAddTimeStamp;
+    *RecentEraseTimeStamp = SelInfo.RecentEraseTimeStamp;
+    *RecordCount          = SelInfo.NoOfEntries;
+  }
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+IpmiRepositoryAppendRecord (
+  IN OUT IPMI_REPOSITORY_CACHE  *Cache,
+  IN     UINT8                  *Record,
+  IN     UINT16                 RecordSize
+  )
+{
+  UINTN  NeededSize;
+  UINTN  NewSize;
+  UINT8  *NewData;
+
+  NeededSize = Cache->DataSize + sizeof (UINT16) + RecordSize;
+  if (NeededSize > Cache->BufferSize) {
+    NewSize = (Cache->BufferSize != 0) ? Cache->BufferSize : IPMI_SDR_MAX_RECORD_SIZE;
+    while (NewSize < NeededSize) {
+      NewSize *= 2;
+    }
+    NewData = ReallocatePool (Cache->BufferSize, NewSize, Cache->Data);
+    if (NewData == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+    Cache->Data       = NewData;
+    Cache->BufferSize = NewSize;
+  }
+
+  CopyMem (Cache->Data + Cache->DataSize, &RecordSize, sizeof (UINT16));
+  CopyMem (Cache->Data + Cache->DataSize + sizeof (UINT16), Record, RecordSize);
+  Cache->DataSize += sizeof (UINT16) + RecordSize;
+  Cache->RecordCount++;
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+IpmiReadSelRecord (
+  IN  UINT16  RecordId,
+  OUT UINT8   *Record,
+  OUT UINT16  *RecordSize,
+  OUT UINT16  *NextRecordId
+  )
+{
+  EFI_STATUS                  Status;
+  IPMI_GET_SEL_ENTRY_REQUEST  Request;
+  UINT8                       Response[IPMI_REPOSITORY_RESPONSE_HEADER + IPMI_SEL_RECORD_SIZE];
+  UINT32                      ResponseSize;
+
+  //
+  // A whole record read at offset 0 needs no reservation.
+  //
+  ZeroMem (&Request, sizeof (Request));
+  Request.SelRecID[0] = (UINT8) RecordId;
+  Request.SelRecID[1] = (UINT8) (RecordId >> 8);
+  Request.Offset      = 0;
+  Request.BytesToRead = IPMI_REPOSITORY_READ_ENTIRE;
+
+  ResponseSize = sizeof (Response);
+  Status = IpmiGetSelEntry (&Request, (IPMI_GET_SEL_ENTRY_RESPONSE *) Response, &ResponseSize);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+  if (Response[0] != IPMI_REPOSITORY_CC_NORMAL || ResponseSize <= IPMI_REPOSITORY_RESPONSE_HEADER) {
+    return EFI_DEVICE_ERROR;
+  }
+
+  *NextRecordId = (UINT16) (Response[1] | (Response[2] << 8));
+  *RecordSize   = (UINT16) (ResponseSize - IPMI_REPOSITORY_RESPONSE_HEADER);
+  CopyMem (Record, &Response[IPMI_REPOSITORY_RESPONSE_HEADER], *RecordSize);
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+IpmiReserveSdrRepository (
+  OUT UINT16  *ReservationId
+  )
+{
+  EFI_STATUS  Status;
+  UINT8       Response[3];
+  UINT32      ResponseSize;
+
+  ResponseSize = sizeof (Response);
+  Status = InternalIpmiSubmitCommand (
+             IPMI_NETFN_STORAGE,
+             IPMI_STORAGE_RESERVE_SDR_REPOSITORY,
+             NULL,
+             0,
+             (VOID *)Response,
+             &ResponseSize
+             );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+  if (Response[0] != IPMI_REPOSITORY_CC_NORMAL || ResponseSize < sizeof (Response)) {
+    return EFI_DEVICE_ERROR;
+  }
+
+  *ReservationId = (UINT16) (Response[1] | (Response[2] << 8));
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+IpmiReadSdrBytes (
+  IN OUT IPMI_SDR_READ_CONTEXT  *Context,
+  IN     UINT16                 RecordId,
+  IN     UINT8                  Offset,
+  IN     UINT8                  BytesToRead,
+  OUT    UINT8                  *Buffer,
+  OUT    UINT16                 *BytesRead,
+  OUT    UINT16                 *NextRecordId
+  )
+{
+  EFI_STATUS            Status;
+  IPMI_GET_SDR_REQUEST  Request;
+  UINT8                 Response[IPMI_REPOSITORY_RESPONSE_HEADER + IPMI_SDR_MAX_RECORD_SIZE];
+  UINT32                ResponseSize;
+
+  Request.ReservationId = Context->ReservationId;
+  Request.RecordId      = RecordId;
+  Request.RecordOffset  = Offset;
+  Request.BytesToRead   = BytesToRead;
+
+  ResponseSize = sizeof (Response);
+  Status = IpmiGetSdr (&Request, (IPMI_GET_SDR_RESPONSE *) Response, &ResponseSize);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+  if (ResponseSize < 1) {
+    return EFI_DEVICE_ERROR;
+  }
+  if (Response[0] == IPMI_REPOSITORY_CC_RESERVATION_CANCELED) {
+    Context->Reserved = FALSE;
+    return EFI_ABORTED;
+  }
+  if (Response[0] == IPMI_REPOSITORY_CC_CANNOT_RETURN_LENGTH) {
+    return EFI_BUFFER_TOO_SMALL;
+  }
+  if (Response[0] != IPMI_REPOSITORY_CC_NORMAL || ResponseSize < IPMI_REPOSITORY_RESPONSE_HEADER) {
+    return EFI_DEVICE_ERROR;
+  }
+
+  *NextRecordId = (UINT16) (Response[1] | (Response[2] << 8));
+  *BytesRead    = (UINT16) (ResponseSize - IPMI_REPOSITORY_RESPONSE_HEADER);
+  CopyMem (Buffer, &Response[IPMI_REPOSITORY_RESPONSE_HEADER], *BytesRead);
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+IpmiReadSdrRecord (
+  IN OUT IPMI_SDR_READ_CONTEXT  *Context,
+  IN     UINT16                 RecordId,
+  OUT    UINT8                  *Record,
+  OUT    UINT16                 *RecordSize,
+  OUT    UINT16                 *NextRecordId
+  )
+{
+  EFI_STATUS  Status;
+  UINT16      BytesRead;
+  UINT16      Size;
+  UINT16      Offset;
+  UINT8       Chunk;
+
+  //
+  // Try the whole record in one transaction first; most BMCs take it.
+  //
+  Status = IpmiReadSdrBytes (Context, RecordId, 0, IPMI_REPOSITORY_READ_ENTIRE, Record, &BytesRead, NextRecordId);
+  if (!EFI_ERROR (Status) && BytesRead >= IPMI_SDR_RECORD_HEADER_SIZE) {
+    Size = IPMI_SDR_RECORD_HEADER_SIZE + Record[IPMI_SDR_RECORD_LENGTH_OFFSET];
+    if (BytesRead >= Size) {
+      *RecordSize = Size;
+      return EFI_SUCCESS;
+    }
+  } else if (Status != EFI_BUFFER_TOO_SMALL) {
+    return EFI_ERROR (Status) ? Status : EFI_DEVICE_ERROR;
+  }
+
+  //
+  // Fall back to partial reads, which need a reservation.
+  //
+  if (!Context->Reserved) {
+    Status = IpmiReserveSdrRepository (&Context->ReservationId);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+    Context->Reserved = TRUE;
+  }
+
+  Status = IpmiReadSdrBytes (Context, RecordId, 0, IPMI_SDR_RECORD_HEADER_SIZE, Record, &BytesRead, NextRecordId);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+  if (BytesRead < IPMI_SDR_RECORD_HEADER_SIZE) {
+    return EFI_DEVICE_ERROR;
+  }
+
+  Size   = IPMI_SDR_RECORD_HEADER_SIZE + Record[IPMI_SDR_RECORD_LENGTH_OFFSET];
+  Offset = IPMI_SDR_RECORD_HEADER_SIZE;
+  while (Offset < Size) {
+    Chunk = (UINT8) MIN ((UINT16) Context->ChunkSize, Size - Offset);
+    Status = IpmiReadSdrBytes (Context, RecordId, (UINT8) Offset, Chunk, Record + Offset, &BytesRead, NextRecordId);
+    if (Status == EFI_BUFFER_TOO_SMALL && Context->ChunkSize > 1) {
+      Context->ChunkSize /= 2;
+      continue;
+    }
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+    if (BytesRead == 0 || BytesRead > Size - Offset) {
+      return EFI_DEVICE_ERROR;
+    }
+    Offset = Offset + BytesRead;
+  }
+
+  *RecordSize = Size;
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+IpmiReadRepository (
+  IN     BOOLEAN                Sdr,
+  IN OUT IPMI_REPOSITORY_CACHE  *Cache
+  )
+{
+  EFI_STATUS             Status;
+  UINT32                 AddTimeStamp;
+  UINT32                 EraseTimeStamp;
+  UINT32                 CheckAddTimeStamp;
+  UINT32                 CheckEraseTimeStamp;
+  UINTN                  RecordCount;
+  UINTN                  Retry;
+  UINTN                  Walked;
+  UINT16                 RecordId;
+  UINT16                 NextRecordId;
+  UINT16                 RecordSize;
+  UINT8                  Record[IPMI_SDR_MAX_RECORD_SIZE];
+  IPMI_SDR_READ_CONTEXT  Context;
+
+  if (Cache == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Status = IpmiRepositoryGetInfo (Sdr, &AddTimeStamp, &EraseTimeStamp, &RecordCount);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  if (Cache->Valid &&
+      Cache->RecentAddTimeStamp == AddTimeStamp &&
+      Cache->RecentEraseTimeStamp == EraseTimeStamp) {
+    return EFI_SUCCESS;
+  }
+
+  Context.Reserved  = FALSE;
+  Context.ChunkSize = IPMI_REPOSITORY_READ_ENTIRE;
+
+  for (Retry = 0; Retry < IPMI_REPOSITORY_READ_RETRIES; Retry++) {
+    Cache->Valid       = FALSE;
+    Cache->DataSize    = 0;
+    Cache->RecordCount = 0;
+
+    RecordId = IPMI_REPOSITORY_FIRST_RECORD_ID;
+    Walked   = 0;
+    Status   = EFI_SUCCESS;
+    while (RecordCount != 0 && RecordId != IPMI_REPOSITORY_LAST_RECORD_ID) {
+      //
+      // Never walk more records than the repository can hold, in case of a
+      // BMC returning a linked list that loops.
+      //
+      if (Walked++ > IPMI_REPOSITORY_LAST_RECORD_ID) {
+        Status = EFI_DEVICE_ERROR;
+        break;
+      }
+
+      if (Sdr) {
+        Status = IpmiReadSdrRecord (&Context, RecordId, Record, &RecordSize, &NextRecordId);
+      } else {
+        Status = IpmiReadSelRecord (RecordId, Record, &RecordSize, &NextRecordId);
+      }
+      if (EFI_ERROR (Status)) {
+        break;
+      }
+
+      Status = IpmiRepositoryAppendRecord (Cache, Record, RecordSize);
+      if (EFI_ERROR (Status)) {
+        return Status;
+      }
+      RecordId = NextRecordId;
+    }
+
+    if (Status == EFI_ABORTED) {
+      //
+      // The SDR reservation was cancelled by a repository update, restart.
+      //
+      DEBUG ((DEBUG_INFO, "IpmiReadRepository: reservation cancelled, retrying\n"));
+    } else if (EFI_ERROR (Status)) {
+      return Status;
+    } else {
+      //
+      // Only keep the walk if nothing was added or erased while it ran.
+      //
+      Status = IpmiRepositoryGetInfo (Sdr, &CheckAddTimeStamp, &CheckEraseTimeStamp, &RecordCount);
+      if (EFI_ERROR (Status)) {
+        return Status;
+      }
+      if (CheckAddTimeStamp == AddTimeStamp && CheckEraseTimeStamp == EraseTimeStamp) {
+        Cache->RecentAddTimeStamp   = AddTimeStamp;
+        Cache->RecentEraseTimeStamp = EraseTimeStamp;
+        Cache->Valid                = TRUE;
+        return EFI_SUCCESS;
+      }
+      AddTimeStamp   = CheckAddTimeStamp;
+      EraseTimeStamp = CheckEraseTimeStamp;
+    }
+  }
+
+  return EFI_TIMEOUT;
+}
+
+EFI_STATUS
+EFIAPI
+IpmiReadSelRepository (
+  IN OUT IPMI_REPOSITORY_CACHE  *SelCache
+  )
+{
+  return IpmiReadRepository (FALSE, SelCache);
+}
+
+EFI_STATUS
+EFIAPI
+IpmiReadSdrRepository (
+  IN OUT IPMI_REPOSITORY_CACHE  *SdrCache
+  )
+{
+  return IpmiReadRepository (TRUE, SdrCache);
+}
+
+EFI_STATUS
+EFIAPI
+IpmiGetNextRepositoryRecord (
+  IN     IPMI_REPOSITORY_CACHE  *Cache,
+  IN OUT UINTN                  *Position,
+  OUT    UINT8                  **Record,
+  OUT    UINT16                 *RecordSize
+  )
+{
+  UINT16  Size;
+
+  if (Cache == NULL || Position == NULL || Record == NULL || RecordSize == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+  if (!Cache->Valid || *Position + sizeof (UINT16) > Cache->DataSize) {
+    return EFI_NOT_FOUND;
+  }
+
+  CopyMem (&Size, Cache->Data + *Position, sizeof (UINT16));
+  *Record     = Cache->Data + *Position + sizeof (UINT16);
+  *RecordSize = Size;
+  *Position  += sizeof (UINT16) + Size;
+
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+EFIAPI
+IpmiFindRepositoryRecord (
+  IN  IPMI_REPOSITORY_CACHE  *Cache,
+  IN  UINT16                 RecordId,
+  OUT UINT8                  **Record,
+  OUT UINT16                 *RecordSize
+  )
+{
+  UINTN   Position;
+  UINT16  Id;
+
+  if (Record == NULL || RecordSize == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Position = 0;
+  while (!EFI_ERROR (IpmiGetNextRepositoryRecord (Cache, &Position, Record, RecordSize))) {
+    if (*RecordSize >= sizeof (UINT16)) {
+      CopyMem (&Id, *Record, sizeof (UINT16));
+      if (Id == RecordId) {
+        return EFI_SUCCESS;
+      }
+    }
+  }
+
+  return EFI_NOT_FOUND;
+}
+
+VOID
+EFIAPI
+IpmiFreeRepositoryCache (
+  IN OUT IPMI_REPOSITORY_CACHE  *Cache
+  )
+{
+  if (Cache == NULL) {
+    return;
+  }
+
+  if (Cache->Data != NULL) {
+    FreePool (Cache->Data);
+  }
+  ZeroMem (Cache, sizeof (*Cache));
+}
@@ -0,0 +1,29 @@
+/** @file
+  IPMI Command - statistics stubs for phases without a shared statistics table.
+
+Copyright (c) 2019, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <PiPei.h>
+
+#include "IpmiCommandLibInternal.h"
+
+UINT64
+IpmiStatsStart (
+  VOID
+  )
+{
+  return 0;
+}
+
+VOID
+IpmiStatsRecord (
+  IN UINT8       NetFunction,
+  IN UINT8       Command,
+  IN EFI_STATUS  Status,
+  IN UINT64      Start
+  )
+{
+}
@@ -0,0 +1,38 @@
+/** @file
+  IPMI Command - common submit path.
+
+Copyright (c) 2019, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <PiPei.h>
+#include <Library/IpmiLib.h>
+
+#include "IpmiCommandLibInternal.h"
+
+EFI_STATUS
+InternalIpmiSubmitCommand (
+  IN     UINT8     NetFunction,
+  IN     UINT8     Command,
+  IN     UINT8     *RequestData,
+  IN     UINT32    RequestDataSize,
+  OUT    UINT8     *ResponseData,
+  IN OUT UINT32    *ResponseDataSize
+  )
+{
+  EFI_STATUS                   Status;
+  UINT64                       Start;
+
+  Start  = IpmiStatsStart ();
+  Status = IpmiSubmitCommand (
+             NetFunction,
+             Command,
+             RequestData,
+             RequestDataSize,
+             ResponseData,
+             ResponseDataSize
+             );
+  IpmiStatsRecord (NetFunction, Command, Status, Start);
+  return Status;
+}
@@ -11,6 +11,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/BaseMemoryLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/IpmiCommandLib.h>
+#include <Library/IpmiWatchdogLib.h>
 #include <IndustryStandard/Ipmi.h>
 
 BOOLEAN mOsWdtFlag = FALSE;
@@ -55,7 +56,7 @@ Returns:
 
   OsWdtEventHandled = TRUE;
 
-  Status = IpmiGetWatchdogTimer (&GetWatchdogTimer);
+  Status = IpmiWatchdogGetTimer (&GetWatchdogTimer);
   if (EFI_ERROR (Status)) {
     return ;
   }
@@ -71,7 +72,12 @@ Returns:
   SetWatchdogTimer.TimerUseExpirationFlagsClear |= BIT1 | BIT2;
   SetWatchdogTimer.InitialCountdownValue         = 600; // 100ms / count
 
-  Status = IpmiSetWatchdogTimer (&SetWatchdogTimer, &CompletionCode);
+  Status = IpmiWatchdogSetTimer (&SetWatchdogTimer);
+  if (EFI_ERROR (Status)) {
+    return ;
+  }
+
+  Status = IpmiWatchdogFlush (&CompletionCode);
   return ;
 }
 
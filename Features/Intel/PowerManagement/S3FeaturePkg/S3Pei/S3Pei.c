@@ -6,8 +6,199 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 **/
 
+#include <PiPei.h>
+#include <Guid/S3SmmInitDone.h>
+#include <Ppi/EndOfPeiPhase.h>
+#include <Ppi/PostBootScriptTable.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/PcdLib.h>
 #include <Library/PeiServicesLib.h>
 #include <Library/SmmAccessLib.h>
+#include <Library/TimerLib.h>
+
+#define S3_RESUME_TIMING_SIGNATURE  SIGNATURE_32 ('S', '3', 'T', 'M')
+
+typedef enum {
+  S3ResumeMemoryRestored,
+  S3ResumeSmmRestored,
+  S3ResumeBootScriptDone,
+  S3ResumeEndOfPei,
+  S3ResumeCheckpointMax
+} S3_RESUME_CHECKPOINT;
+
+//
+// The PEIM may run in place from flash, so the timestamps live in memory
+// allocated on the S3 path, together with the notify descriptors that lead
+// back to them.
+//
+typedef struct {
+  UINT32                     Signature;
+  EFI_PEI_NOTIFY_DESCRIPTOR  NotifyList[S3ResumeCheckpointMax - 1];
+  UINT64                     TimeNs[S3ResumeCheckpointMax];
+} S3_RESUME_TIMING;
+
+GLOBAL_REMOVE_IF_UNREFERENCED CONST CHAR8 *mS3ResumeCheckpointName[] = {
+  "Memory restore",
+  "SMM restore",
+  "Boot script",
+  "Waking vector"
+};
+
+/**
+  Return the time elapsed since reset, in nanoseconds.
+
+  The performance counter restarts from zero on the S3 resume reset, which is
+  what FirmwarePerformancePei relies on for the FPDT S3 resume record too.
+
+  @return The time elapsed since reset, in nanoseconds.
+**/
+STATIC
+UINT64
+GetTimeSinceReset (
+  VOID
+  )
+{
+  return GetTimeInNanoSecond (GetPerformanceCounter ());
+}
+
+/**
+  Log the time spent in each S3 resume phase, and flag the resume if it took
+  longer than PcdS3ResumeTimeBudget.
+
+  @param[in]  Timing      The S3 resume timestamps.
+**/
+STATIC
+VOID
+ReportS3ResumeTiming (
+  IN S3_RESUME_TIMING  *Timing
+  )
+{
+  UINTN   Index;
+  UINT64  PreviousNs;
+  UINT64  TotalMs;
+  UINT32  BudgetMs;
+
+  PreviousNs = 0;
+  for (Index = 0; Index < S3ResumeCheckpointMax; Index++) {
+    if (Timing->TimeNs[Index] == 0) {
+      //
+      // The checkpoint was not reached, e.g. no SMM on this platform
+      //
+      continue;
+    }
+    DEBUG ((
+      DEBUG_INFO,
+      "S3 resume: %a done at %ld us (+%ld us)\n",
+      mS3ResumeCheckpointName[Index],
+      DivU64x32 (Timing->TimeNs[Index], 1000),
+      DivU64x32 (Timing->TimeNs[Index] - PreviousNs, 1000)
+      ));
+    PreviousNs = Timing->TimeNs[Index];
+  }
+
+  TotalMs  = DivU64x32 (Timing->TimeNs[S3ResumeEndOfPei], 1000000);
+  BudgetMs = PcdGet32 (PcdS3ResumeTimeBudget);
+  if ((BudgetMs != 0) && (TotalMs > BudgetMs)) {
+    DEBUG ((
+      DEBUG_ERROR,
+      "S3 resume: over budget, %ld ms to the waking vector, budget %d ms\n",
+      TotalMs,
+      BudgetMs
+      ));
+  }
+}
+
+/**
+  Record the time at which an S3 resume checkpoint is reached.
+
+  @param[in]  PeiServices       An indirect pointer to the EFI_PEI_SERVICES table.
+  @param[in]  NotifyDescriptor  Address of the notification descriptor data structure.
+  @param[in]  Ppi               Address of the PPI that was installed.
+
+  @retval     EFI_SUCCESS       Always.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+S3ResumeCheckpointNotify (
+  IN EFI_PEI_SERVICES           **PeiServices,
+  IN EFI_PEI_NOTIFY_DESCRIPTOR  *NotifyDescriptor,
+  IN VOID                       *Ppi
+  )
+{
+  S3_RESUME_TIMING      *Timing;
+  S3_RESUME_CHECKPOINT  Checkpoint;
+  UINT64                TimeNs;
+
+  TimeNs = GetTimeSinceReset ();
+
+  if (CompareGuid (NotifyDescriptor->Guid, &gEdkiiS3SmmInitDoneGuid)) {
+    Checkpoint = S3ResumeSmmRestored;
+  } else if (CompareGuid (NotifyDescriptor->Guid, &gPeiPostScriptTablePpiGuid)) {
+    Checkpoint = S3ResumeBootScriptDone;
+  } else {
+    Checkpoint = S3ResumeEndOfPei;
+  }
+
+  //
+  // NotifyList[Checkpoint - 1] reports Checkpoint
+  //
+  Timing = BASE_CR (NotifyDescriptor - (Checkpoint - 1), S3_RESUME_TIMING, NotifyList);
+  ASSERT (Timing->Signature == S3_RESUME_TIMING_SIGNATURE);
+
+  Timing->TimeNs[Checkpoint] = TimeNs;
+
+  if (Checkpoint == S3ResumeEndOfPei) {
+    ReportS3ResumeTiming (Timing);
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Start timing the S3 resume path.
+
+  S3Resume2Pei installs the S3 SMM init done PPI once SMM is restored, the
+  post script table PPI once the boot script has been replayed, and the end
+  of PEI PPI as its last step before jumping to the OS waking vector.
+
+  @retval     EFI_SUCCESS          The notifications were registered.
+  @retval     EFI_OUT_OF_RESOURCES Insufficient resources to record the timing.
+**/
+STATIC
+EFI_STATUS
+StartS3ResumeTiming (
+  VOID
+  )
+{
+  S3_RESUME_TIMING  *Timing;
+  UINT64            TimeNs;
+
+  TimeNs = GetTimeSinceReset ();
+
+  Timing = AllocateZeroPool (sizeof (S3_RESUME_TIMING));
+  if (Timing == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Timing->Signature = S3_RESUME_TIMING_SIGNATURE;
+  Timing->TimeNs[S3ResumeMemoryRestored] = TimeNs;
+
+  Timing->NotifyList[0].Flags  = EFI_PEI_PPI_DESCRIPTOR_NOTIFY_CALLBACK;
+  Timing->NotifyList[0].Guid   = &gEdkiiS3SmmInitDoneGuid;
+  Timing->NotifyList[0].Notify = S3ResumeCheckpointNotify;
+  Timing->NotifyList[1].Flags  = EFI_PEI_PPI_DESCRIPTOR_NOTIFY_CALLBACK;
+  Timing->NotifyList[1].Guid   = &gPeiPostScriptTablePpiGuid;
+  Timing->NotifyList[1].Notify = S3ResumeCheckpointNotify;
+  Timing->NotifyList[2].Flags  = EFI_PEI_PPI_DESCRIPTOR_NOTIFY_CALLBACK | EFI_PEI_PPI_DESCRIPTOR_TERMINATE_LIST;
+  Timing->NotifyList[2].Guid   = &gEfiEndOfPeiSignalPpiGuid;
+  Timing->NotifyList[2].Notify = S3ResumeCheckpointNotify;
+
+  return PeiServicesNotifyPpi (Timing->NotifyList);
+}
 
 /**
   S3 PEI module entry point
@@ -25,12 +216,23 @@ S3PeiEntryPoint (
   IN CONST EFI_PEI_SERVICES     **PeiServices
   )
 {
-  EFI_STATUS Status;
+  EFI_STATUS    Status;
+  EFI_BOOT_MODE BootMode;
 
   //
   // Install EFI_PEI_MM_ACCESS_PPI for S3 resume case
   //
   Status = PeiInstallSmmAccessPpi ();
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  //
+  // Timing is best effort and must not fail the resume
+  //
+  if (!EFI_ERROR (PeiServicesGetBootMode (&BootMode)) && (BootMode == BOOT_ON_S3_RESUME)) {
+    StartS3ResumeTiming ();
+  }
 
   return Status;
 }
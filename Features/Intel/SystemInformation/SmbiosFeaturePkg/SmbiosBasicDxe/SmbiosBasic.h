@@ -21,6 +21,28 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/PcdLib.h>
 #include <Library/UefiLib.h>
 
+//
+// Initial size of the arena all records are built in, large enough for the
+// records of this driver with typical string lengths.
+//
+#define SMBIOS_BUILDER_INITIAL_SIZE   SIZE_4KB
+#define SMBIOS_BUILDER_MAX_RECORDS    8
+
+typedef struct {
+  UINT8                         *Buffer;
+  UINTN                         BufferSize;
+  UINTN                         Used;
+  UINTN                         RecordCount;
+  UINTN                         RecordOffset[SMBIOS_BUILDER_MAX_RECORDS];
+  UINTN                         StringCount;
+} SMBIOS_RECORD_BUILDER;
+
+typedef
+EFI_STATUS
+(EFIAPI EFI_BASIC_SMBIOS_DATA_FUNCTION) (
+  IN  SMBIOS_RECORD_BUILDER  *Builder
+  );
+
 /**
   Add an SMBIOS record.
 
@@ -42,4 +64,90 @@ AddSmbiosRecord (
   IN EFI_SMBIOS_TABLE_HEADER    *Record
   );
 
+/**
+  Start a new SMBIOS record in the builder arena.
+
+  The formatted area is zero filled, TemplateSize bytes of Template are copied
+  into it and the header is set to Type, Length and handle 0. Strings added
+  after this are placed at offset Length.
+
+  @param  Builder               The record builder.
+  @param  Type                  SMBIOS structure type.
+  @param  Template              Template of the formatted area.
+  @param  TemplateSize          Size of Template in bytes.
+  @param  Length                Length of the formatted area.
+  @param  Record                Returns the record. Only valid until the next
+                                string is added.
+
+  @retval EFI_SUCCESS           Record was started.
+  @retval EFI_OUT_OF_RESOURCES  The arena could not be grown.
+
+**/
+EFI_STATUS
+SmbiosBuilderStartRecord (
+  IN  SMBIOS_RECORD_BUILDER     *Builder,
+  IN  UINT8                     Type,
+  IN  CONST VOID                *Template,
+  IN  UINTN                     TemplateSize,
+  IN  UINT8                     Length,
+  OUT VOID                      **Record
+  );
+
+/**
+  Append a string to the string-set of the current record.
+
+  @param  Builder               The record builder.
+  @param  String                The string to append.
+
+  @retval EFI_SUCCESS           String was added.
+  @retval EFI_OUT_OF_RESOURCES  The arena could not be grown.
+
+**/
+EFI_STATUS
+SmbiosBuilderAddString (
+  IN  SMBIOS_RECORD_BUILDER     *Builder,
+  IN  CONST CHAR8               *String
+  );
+
+/**
+  Terminate the string-set of the current record.
+
+  @param  Builder               The record builder.
+
+  @retval EFI_SUCCESS           Record was completed.
+  @retval EFI_OUT_OF_RESOURCES  The arena could not be grown.
+
+**/
+EFI_STATUS
+SmbiosBuilderEndRecord (
+  IN  SMBIOS_RECORD_BUILDER     *Builder
+  );
+
+/**
+  Add all completed records of the builder to the SMBIOS table.
+
+  @param  Builder               The record builder.
+  @param  Smbios                The EFI_SMBIOS_PROTOCOL instance.
+
+  @retval EFI_SUCCESS           All records were added.
+  @retval Others                A record could not be added.
+
+**/
+EFI_STATUS
+SmbiosBuilderSubmit (
+  IN  SMBIOS_RECORD_BUILDER     *Builder,
+  IN  EFI_SMBIOS_PROTOCOL       *Smbios
+  );
+
+/**
+  Release the builder arena.
+
+  @param  Builder               The record builder.
+
+**/
+VOID
+SmbiosBuilderFree (
+  IN  SMBIOS_RECORD_BUILDER     *Builder
+  );
+
 #endif
@@ -0,0 +1,225 @@
+/** @file
+  Smbios record builder.
+
+  All records of this driver are built back to back in one arena and handed
+  to the SMBIOS protocol in a single pass once every record is complete.
+
+Copyright (c) 2018 - 2019, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "SmbiosBasic.h"
+
+/**
+  Make sure the arena has room for Size more bytes.
+
+  @param  Builder               The record builder.
+  @param  Size                  Number of bytes needed.
+
+  @retval EFI_SUCCESS           There is enough room.
+  @retval EFI_OUT_OF_RESOURCES  The arena could not be grown.
+
+**/
+STATIC
+EFI_STATUS
+SmbiosBuilderReserve (
+  IN  SMBIOS_RECORD_BUILDER     *Builder,
+  IN  UINTN                     Size
+  )
+{
+  UINTN                         NewSize;
+  UINT8                         *NewBuffer;
+
+  if (Builder->BufferSize - Builder->Used >= Size) {
+    return EFI_SUCCESS;
+  }
+
+  NewSize = MAX (Builder->BufferSize, SMBIOS_BUILDER_INITIAL_SIZE);
+  while (NewSize - Builder->Used < Size) {
+    NewSize *= 2;
+  }
+
+  NewBuffer = ReallocatePool (Builder->BufferSize, NewSize, Builder->Buffer);
+  if (NewBuffer == NULL) {
+    ASSERT_EFI_ERROR (EFI_OUT_OF_RESOURCES);
+    return EFI_OUT_OF_RESOURCES;
+  }
+  Builder->Buffer     = NewBuffer;
+  Builder->BufferSize = NewSize;
+  return EFI_SUCCESS;
+}
+
+/**
+  Start a new SMBIOS record in the builder arena.
+
+  The formatted area is zero filled, TemplateSize bytes of Template are copied
+  into it and the header is set to Type, Length and handle 0. Strings added
+  after this are placed at offset Length.
+
+  @param  Builder               The record builder.
+  @param  Type                  SMBIOS structure type.
+  @param  Template              Template of the formatted area.
+  @param  TemplateSize          Size of Template in bytes.
+  @param  Length                Length of the formatted area.
+  @param  Record                Returns the record. Only valid until the next
+                                string is added.
+
+  @retval EFI_SUCCESS           Record was started.
+  @retval EFI_OUT_OF_RESOURCES  The arena could not be grown.
+
+**/
+EFI_STATUS
+SmbiosBuilderStartRecord (
+  IN  SMBIOS_RECORD_BUILDER     *Builder,
+  IN  UINT8                     Type,
+  IN  CONST VOID                *Template,
+  IN  UINTN                     TemplateSize,
+  IN  UINT8                     Length,
+  OUT VOID                      **Record
+  )
+{
+  EFI_STATUS                    Status;
+  UINTN                         FixedSize;
+  EFI_SMBIOS_TABLE_HEADER       *Header;
+
+  ASSERT (Builder->RecordCount < SMBIOS_BUILDER_MAX_RECORDS);
+  if (Builder->RecordCount >= SMBIOS_BUILDER_MAX_RECORDS) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  FixedSize = MAX (TemplateSize, Length);
+  Status = SmbiosBuilderReserve (Builder, FixedSize);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Header = (EFI_SMBIOS_TABLE_HEADER *)(Builder->Buffer + Builder->Used);
+  ZeroMem (Header, FixedSize);
+  CopyMem (Header, Template, TemplateSize);
+  Header->Type   = Type;
+  Header->Length = Length;
+  Header->Handle = 0;
+
+  Builder->RecordOffset[Builder->RecordCount] = Builder->Used;
+  Builder->Used       += Length;
+  Builder->StringCount = 0;
+
+  *Record = Header;
+  return EFI_SUCCESS;
+}
+
+/**
+  Append a string to the string-set of the current record.
+
+  @param  Builder               The record builder.
+  @param  String                The string to append.
+
+  @retval EFI_SUCCESS           String was added.
+  @retval EFI_OUT_OF_RESOURCES  The arena could not be grown.
+
+**/
+EFI_STATUS
+SmbiosBuilderAddString (
+  IN  SMBIOS_RECORD_BUILDER     *Builder,
+  IN  CONST CHAR8               *String
+  )
+{
+  EFI_STATUS                    Status;
+  UINTN                         StringSize;
+
+  StringSize = AsciiStrSize (String);
+  ASSERT (StringSize - 1 <= SMBIOS_STRING_MAX_LENGTH);
+
+  Status = SmbiosBuilderReserve (Builder, StringSize);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  CopyMem (Builder->Buffer + Builder->Used, String, StringSize);
+  Builder->Used += StringSize;
+  Builder->StringCount++;
+  return EFI_SUCCESS;
+}
+
+/**
+  Terminate the string-set of the current record.
+
+  @param  Builder               The record builder.
+
+  @retval EFI_SUCCESS           Record was completed.
+  @retval EFI_OUT_OF_RESOURCES  The arena could not be grown.
+
+**/
+EFI_STATUS
+SmbiosBuilderEndRecord (
+  IN  SMBIOS_RECORD_BUILDER     *Builder
+  )
+{
+  EFI_STATUS                    Status;
+  UINTN                         Size;
+
+  //
+  // Two zeros following the last string, or a double-null if there are none.
+  //
+  Size = (Builder->StringCount == 0) ? 2 : 1;
+  Status = SmbiosBuilderReserve (Builder, Size);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  ZeroMem (Builder->Buffer + Builder->Used, Size);
+  Builder->Used += Size;
+  Builder->RecordCount++;
+  return EFI_SUCCESS;
+}
+
+/**
+  Add all completed records of the builder to the SMBIOS table.
+
+  @param  Builder               The record builder.
+  @param  Smbios                The EFI_SMBIOS_PROTOCOL instance.
+
+  @retval EFI_SUCCESS           All records were added.
+  @retval Others                A record could not be added.
+
+**/
+EFI_STATUS
+SmbiosBuilderSubmit (
+  IN  SMBIOS_RECORD_BUILDER     *Builder,
+  IN  EFI_SMBIOS_PROTOCOL       *Smbios
+  )
+{
+  EFI_STATUS                    Status;
+  UINTN                         Index;
+  EFI_SMBIOS_HANDLE             SmbiosHandle;
+  EFI_SMBIOS_TABLE_HEADER       *Record;
+
+  for (Index = 0; Index < Builder->RecordCount; Index++) {
+    Record = (EFI_SMBIOS_TABLE_HEADER *)(Builder->Buffer + Builder->RecordOffset[Index]);
+    Status = AddSmbiosRecord (Smbios, &SmbiosHandle, Record);
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "Basic smbios add error.  Type=%d, ReturnStatus=%r\n", Record->Type, Status));
+      return Status;
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Release the builder arena.
+
+  @param  Builder               The record builder.
+
+**/
+VOID
+SmbiosBuilderFree (
+  IN  SMBIOS_RECORD_BUILDER     *Builder
+  )
+{
+  if (Builder->Buffer != NULL) {
+    FreePool (Builder->Buffer);
+  }
+  ZeroMem (Builder, sizeof (*Builder));
+}
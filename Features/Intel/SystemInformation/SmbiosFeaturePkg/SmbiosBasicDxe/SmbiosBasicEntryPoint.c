@@ -11,37 +11,31 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 EFI_STATUS
 EFIAPI
 BiosVendorFunction(
-  IN  EFI_SMBIOS_PROTOCOL   *Smbios
+  IN  SMBIOS_RECORD_BUILDER *Builder
   );
 
 EFI_STATUS
 EFIAPI
 SystemManufacturerFunction(
-  IN  EFI_SMBIOS_PROTOCOL   *Smbios
+  IN  SMBIOS_RECORD_BUILDER *Builder
   );
 
 EFI_STATUS
 EFIAPI
 BaseBoardManufacturerFunction(
-  IN  EFI_SMBIOS_PROTOCOL   *Smbios
+  IN  SMBIOS_RECORD_BUILDER *Builder
   );
 
 EFI_STATUS
 EFIAPI
 ChassisManufacturerFunction(
-  IN  EFI_SMBIOS_PROTOCOL   *Smbios
+  IN  SMBIOS_RECORD_BUILDER *Builder
   );
 
 EFI_STATUS
 EFIAPI
 BootInfoStatusFunction(
-  IN  EFI_SMBIOS_PROTOCOL   *Smbios
-  );
-
-typedef
-EFI_STATUS
-(EFIAPI EFI_BASIC_SMBIOS_DATA_FUNCTION) (
-  IN  EFI_SMBIOS_PROTOCOL  *Smbios
+  IN  SMBIOS_RECORD_BUILDER *Builder
   );
 
 typedef struct {
@@ -58,7 +52,8 @@ EFI_BASIC_SMBIOS_DATA mSmbiosBasicDataFuncTable[] = {
 
 /**
   Standard EFI driver point.  This driver parses the mSmbiosMiscDataTable
-  structure and reports any generated data using SMBIOS protocol.
+  structure, builds all records in one arena and then reports them using
+  SMBIOS protocol in a single pass.
 
   @param  ImageHandle     Handle for the image of this driver
   @param  SystemTable     Pointer to the EFI System Table
@@ -76,6 +71,7 @@ SmbiosBasicEntryPoint(
   UINTN                Index;
   EFI_STATUS           EfiStatus;
   EFI_SMBIOS_PROTOCOL  *Smbios;
+  SMBIOS_RECORD_BUILDER Builder;
 
   EfiStatus = gBS->LocateProtocol(&gEfiSmbiosProtocolGuid, NULL, (VOID**)&Smbios);
   if (EFI_ERROR(EfiStatus)) {
@@ -83,14 +79,18 @@ SmbiosBasicEntryPoint(
     return EfiStatus;
   }
 
+  ZeroMem (&Builder, sizeof (Builder));
   for (Index = 0; Index < sizeof(mSmbiosBasicDataFuncTable)/sizeof(mSmbiosBasicDataFuncTable[0]); ++Index) {
-    EfiStatus = (*mSmbiosBasicDataFuncTable[Index].Function) (Smbios);
+    EfiStatus = (*mSmbiosBasicDataFuncTable[Index].Function) (&Builder);
     if (EFI_ERROR(EfiStatus)) {
       DEBUG((DEBUG_ERROR, "Basic smbios store error.  Index=%d, ReturnStatus=%r\n", Index, EfiStatus));
+      SmbiosBuilderFree (&Builder);
       return EfiStatus;
     }
   }
 
+  EfiStatus = SmbiosBuilderSubmit (&Builder, Smbios);
+  SmbiosBuilderFree (&Builder);
   return EfiStatus;
 }
 
@@ -20,62 +20,36 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 EFI_STATUS
 EFIAPI
 BiosVendorFunction(
-  IN  EFI_SMBIOS_PROTOCOL   *Smbios
+  IN  SMBIOS_RECORD_BUILDER *Builder
   )
 {
   EFI_STATUS            Status;
-  CHAR8                 *VendorStr;
-  UINTN                 VendorStrLen;
-  CHAR8                 *VersionStr;
-  UINTN                 VerStrLen;
-  CHAR8                 *DateStr;
-  UINTN                 DateStrLen;
   SMBIOS_TABLE_TYPE0    *SmbiosRecord;
-  SMBIOS_TABLE_TYPE0    *PcdSmbiosRecord;
-  EFI_SMBIOS_HANDLE     SmbiosHandle;
-  UINTN                 StringOffset;
 
-  PcdSmbiosRecord = PcdGetPtr (PcdSmbiosType0BiosInformation);
-
-  VendorStr = PcdGetPtr (PcdSmbiosType0StringVendor);
-  VendorStrLen = AsciiStrLen (VendorStr);
-  ASSERT (VendorStrLen <= SMBIOS_STRING_MAX_LENGTH);
-
-  VersionStr = PcdGetPtr (PcdSmbiosType0StringBiosVersion);
-  VerStrLen = AsciiStrLen (VersionStr);
-  ASSERT (VerStrLen <= SMBIOS_STRING_MAX_LENGTH);
-
-  DateStr = PcdGetPtr (PcdSmbiosType0StringBiosReleaseDate);
-  DateStrLen = AsciiStrLen (DateStr);
-  ASSERT (DateStrLen <= SMBIOS_STRING_MAX_LENGTH);
-
-  //
-  // Two zeros following the last string.
-  //
-  SmbiosRecord = AllocateZeroPool (sizeof (SMBIOS_TABLE_TYPE0) + VendorStrLen + 1 + VerStrLen + 1 + DateStrLen + 1 + 1);
-  if (SmbiosRecord == NULL) {
-    ASSERT_EFI_ERROR (EFI_OUT_OF_RESOURCES);
-    return EFI_OUT_OF_RESOURCES;
+  Status = SmbiosBuilderStartRecord (
+             Builder,
+             SMBIOS_TYPE_BIOS_INFORMATION,
+             PcdGetPtr (PcdSmbiosType0BiosInformation),
+             sizeof (SMBIOS_TABLE_TYPE0),
+             sizeof (SMBIOS_TABLE_TYPE0),
+             (VOID **)&SmbiosRecord
+             );
+  if (EFI_ERROR (Status)) {
+    return Status;
   }
 
-  CopyMem (SmbiosRecord, PcdSmbiosRecord, sizeof(SMBIOS_TABLE_TYPE0));
-
-  SmbiosRecord->Hdr.Type = SMBIOS_TYPE_BIOS_INFORMATION;
-  SmbiosRecord->Hdr.Length = sizeof (SMBIOS_TABLE_TYPE0);
-  SmbiosRecord->Hdr.Handle = 0;
-
-  StringOffset = SmbiosRecord->Hdr.Length;
-  CopyMem ((UINT8 *)SmbiosRecord + StringOffset, VendorStr, VendorStrLen);
-  StringOffset += VendorStrLen + 1;
-  CopyMem ((UINT8 *)SmbiosRecord + StringOffset, VersionStr, VerStrLen);
-  StringOffset += VerStrLen + 1;
-  CopyMem ((UINT8 *)SmbiosRecord + StringOffset, DateStr, DateStrLen);
-
-  //
-  // Now we have got the full smbios record, call smbios protocol to add this record.
-  //
-  Status = AddSmbiosRecord (Smbios, &SmbiosHandle, (EFI_SMBIOS_TABLE_HEADER *) SmbiosRecord);
+  Status = SmbiosBuilderAddString (Builder, PcdGetPtr (PcdSmbiosType0StringVendor));
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+  Status = SmbiosBuilderAddString (Builder, PcdGetPtr (PcdSmbiosType0StringBiosVersion));
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+  Status = SmbiosBuilderAddString (Builder, PcdGetPtr (PcdSmbiosType0StringBiosReleaseDate));
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
 
-  FreePool (SmbiosRecord);
-  return Status;
+  return SmbiosBuilderEndRecord (Builder);
 }
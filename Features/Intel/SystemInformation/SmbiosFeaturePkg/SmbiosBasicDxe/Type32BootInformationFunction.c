@@ -21,36 +21,23 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 EFI_STATUS
 EFIAPI
 BootInfoStatusFunction(
-  IN  EFI_SMBIOS_PROTOCOL   *Smbios
+  IN  SMBIOS_RECORD_BUILDER *Builder
   )
 {
   EFI_STATUS                         Status;
-  EFI_SMBIOS_HANDLE                  SmbiosHandle;
-  SMBIOS_TABLE_TYPE32                *PcdSmbiosRecord;
   SMBIOS_TABLE_TYPE32                *SmbiosRecord;
 
-  PcdSmbiosRecord = PcdGetPtr (PcdSmbiosType32SystemBootInformation);
-
-  //
-  // Two zeros following the last string.
-  //
-  SmbiosRecord = AllocateZeroPool(sizeof (SMBIOS_TABLE_TYPE32) + 1 + 1);
-  if (SmbiosRecord == NULL) {
-    ASSERT_EFI_ERROR (EFI_OUT_OF_RESOURCES);
-    return EFI_OUT_OF_RESOURCES;
+  Status = SmbiosBuilderStartRecord (
+             Builder,
+             EFI_SMBIOS_TYPE_SYSTEM_BOOT_INFORMATION,
+             PcdGetPtr (PcdSmbiosType32SystemBootInformation),
+             sizeof (SMBIOS_TABLE_TYPE32),
+             sizeof (SMBIOS_TABLE_TYPE32),
+             (VOID **)&SmbiosRecord
+             );
+  if (EFI_ERROR (Status)) {
+    return Status;
   }
 
-  CopyMem (SmbiosRecord, PcdSmbiosRecord, sizeof(SMBIOS_TABLE_TYPE32));
-
-  SmbiosRecord->Hdr.Type = EFI_SMBIOS_TYPE_SYSTEM_BOOT_INFORMATION;
-  SmbiosRecord->Hdr.Length = sizeof (SMBIOS_TABLE_TYPE32);
-  SmbiosRecord->Hdr.Handle = 0;
-
-  //
-  // Now we have got the full smbios record, call smbios protocol to add this record.
-  //
-  Status = AddSmbiosRecord (Smbios, &SmbiosHandle, (EFI_SMBIOS_TABLE_HEADER *) SmbiosRecord);
-
-  FreePool(SmbiosRecord);
-  return Status;
+  return SmbiosBuilderEndRecord (Builder);
 }
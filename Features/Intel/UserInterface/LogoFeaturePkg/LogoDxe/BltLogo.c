@@ -0,0 +1,229 @@
+/** @file
+  Logo DXE Driver, install Edkii Platform Logo protocol for a logo that has
+  been converted to BLT pixels at build time (see Tools/BmpToBltLogo.py), so
+  no image decoding or scaling is needed at boot.
+
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+#include <Uefi.h>
+#include <Protocol/GraphicsOutput.h>
+#include <Protocol/PlatformLogo.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/DebugLib.h>
+
+//
+// A run header word with this bit set is followed by one pixel that is
+// repeated (header & BLT_LOGO_RUN_LENGTH_MASK) times; otherwise it is
+// followed by that many literal pixels.
+//
+#define BLT_LOGO_RUN_REPEAT_FLAG  BIT31
+#define BLT_LOGO_RUN_LENGTH_MASK  (BIT31 - 1)
+
+typedef struct {
+  UINT32  ScreenWidth;   ///< Screen resolution this copy of the logo is sized for
+  UINT32  ScreenHeight;
+  UINT32  Width;
+  UINT32  Height;
+  BOOLEAN Compressed;    ///< Run-length encoded
+  UINT32  Offset;        ///< First word in mBltLogoData
+  UINT32  Length;        ///< Number of words in mBltLogoData
+} BLT_LOGO_VARIANT;
+
+#include "BltLogoData.h"
+
+/**
+  Pick the copy of the logo pre-scaled for the largest resolution that fits
+  on the console's screen, or the unscaled one if there is no console GOP yet.
+
+  @return The logo variant to display.
+**/
+CONST BLT_LOGO_VARIANT *
+SelectVariant (
+  VOID
+  )
+{
+  EFI_STATUS                   Status;
+  EFI_GRAPHICS_OUTPUT_PROTOCOL *GraphicsOutput;
+  CONST BLT_LOGO_VARIANT       *Best;
+  UINTN                        Index;
+
+  Best = &mBltLogoVariants[0];
+
+  Status = gBS->HandleProtocol (
+                  gST->ConsoleOutHandle,
+                  &gEfiGraphicsOutputProtocolGuid,
+                  (VOID **) &GraphicsOutput
+                  );
+  if (EFI_ERROR (Status)) {
+    return Best;
+  }
+
+  for (Index = 1; Index < ARRAY_SIZE (mBltLogoVariants); Index++) {
+    if (mBltLogoVariants[Index].ScreenWidth <= GraphicsOutput->Mode->Info->HorizontalResolution &&
+        mBltLogoVariants[Index].ScreenHeight <= GraphicsOutput->Mode->Info->VerticalResolution &&
+        mBltLogoVariants[Index].ScreenWidth >= Best->ScreenWidth) {
+      Best = &mBltLogoVariants[Index];
+    }
+  }
+
+  return Best;
+}
+
+/**
+  Expand a logo variant into a BLT buffer.
+
+  @param Variant           The logo variant to expand.
+  @param Bitmap            Buffer of Variant->Width * Variant->Height pixels.
+
+  @retval EFI_SUCCESS           The logo was expanded.
+  @retval EFI_VOLUME_CORRUPTED  The logo data is inconsistent.
+**/
+EFI_STATUS
+ExpandVariant (
+  IN  CONST BLT_LOGO_VARIANT      *Variant,
+  OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL *Bitmap
+  )
+{
+  CONST UINT32 *Data;
+  CONST UINT32 *End;
+  UINT32       *Pixel;
+  UINT32       *PixelEnd;
+  UINT32       Run;
+
+  Data     = &mBltLogoData[Variant->Offset];
+  Pixel    = (UINT32 *) Bitmap;
+  PixelEnd = Pixel + Variant->Width * Variant->Height;
+
+  if (!Variant->Compressed) {
+    if (Variant->Length != Variant->Width * Variant->Height) {
+      return EFI_VOLUME_CORRUPTED;
+    }
+    CopyMem (Pixel, Data, Variant->Length * sizeof (UINT32));
+    return EFI_SUCCESS;
+  }
+
+  End = Data + Variant->Length;
+  while (Data < End) {
+    Run = *Data & BLT_LOGO_RUN_LENGTH_MASK;
+    if ((UINTN) (PixelEnd - Pixel) < Run) {
+      return EFI_VOLUME_CORRUPTED;
+    }
+
+    if ((*Data & BLT_LOGO_RUN_REPEAT_FLAG) != 0) {
+      if (End - Data < 2) {
+        return EFI_VOLUME_CORRUPTED;
+      }
+      SetMem32 (Pixel, Run * sizeof (UINT32), Data[1]);
+      Data += 2;
+    } else {
+      if ((UINTN) (End - Data - 1) < Run) {
+        return EFI_VOLUME_CORRUPTED;
+      }
+      CopyMem (Pixel, Data + 1, Run * sizeof (UINT32));
+      Data += 1 + Run;
+    }
+    Pixel += Run;
+  }
+
+  return (Pixel == PixelEnd) ? EFI_SUCCESS : EFI_VOLUME_CORRUPTED;
+}
+
+/**
+  Load a platform logo image and return its data and attributes.
+
+  @param This              The pointer to this protocol instance.
+  @param Instance          The visible image instance is found.
+  @param Image             Points to the image.
+  @param Attribute         The display attributes of the image returned.
+  @param OffsetX           The X offset of the image regarding the Attribute.
+  @param OffsetY           The Y offset of the image regarding the Attribute.
+
+  @retval EFI_SUCCESS      The image was fetched successfully.
+  @retval EFI_NOT_FOUND    The specified image could not be found.
+**/
+EFI_STATUS
+EFIAPI
+GetImage (
+  IN     EDKII_PLATFORM_LOGO_PROTOCOL          *This,
+  IN OUT UINT32                                *Instance,
+     OUT EFI_IMAGE_INPUT                       *Image,
+     OUT EDKII_PLATFORM_LOGO_DISPLAY_ATTRIBUTE *Attribute,
+     OUT INTN                                  *OffsetX,
+     OUT INTN                                  *OffsetY
+  )
+{
+  EFI_STATUS             Status;
+  CONST BLT_LOGO_VARIANT *Variant;
+
+  if (Instance == NULL || Image == NULL ||
+      Attribute == NULL || OffsetX == NULL || OffsetY == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // There is only one logo; the variants are copies of it at different sizes.
+  //
+  if (*Instance != 0) {
+    return EFI_NOT_FOUND;
+  }
+
+  Variant = SelectVariant ();
+
+  Image->Bitmap = AllocatePool (Variant->Width * Variant->Height * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL));
+  if (Image->Bitmap == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = ExpandVariant (Variant, Image->Bitmap);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Logo data for %dx%d is corrupted\n", Variant->ScreenWidth, Variant->ScreenHeight));
+    FreePool (Image->Bitmap);
+    Image->Bitmap = NULL;
+    return Status;
+  }
+
+  (*Instance)++;
+  Image->Flags  = 0;
+  Image->Width  = (UINT16) Variant->Width;
+  Image->Height = (UINT16) Variant->Height;
+  *Attribute    = EdkiiPlatformLogoDisplayAttributeCenter;
+  *OffsetX      = 0;
+  *OffsetY      = 0;
+  return EFI_SUCCESS;
+}
+
+EDKII_PLATFORM_LOGO_PROTOCOL mPlatformLogo = {
+  GetImage
+};
+
+/**
+  Entrypoint of this module.
+
+  This function is the entrypoint of this module. It installs the Edkii
+  Platform Logo protocol.
+
+  @param  ImageHandle       The firmware allocated handle for the EFI image.
+  @param  SystemTable       A pointer to the EFI System Table.
+
+  @retval EFI_SUCCESS       The entry point is executed successfully.
+
+**/
+EFI_STATUS
+EFIAPI
+InitializeLogo (
+  IN EFI_HANDLE               ImageHandle,
+  IN EFI_SYSTEM_TABLE         *SystemTable
+  )
+{
+  EFI_HANDLE Handle;
+
+  Handle = NULL;
+  return gBS->InstallMultipleProtocolInterfaces (
+                &Handle,
+                &gEdkiiPlatformLogoProtocolGuid, &mPlatformLogo,
+                NULL
+                );
+}
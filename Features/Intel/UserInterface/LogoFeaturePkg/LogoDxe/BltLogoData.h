@@ -0,0 +1,3767 @@
+/** @file
+  Pre-decoded platform logo.
+
+  Generated by LogoFeaturePkg/Tools/BmpToBltLogo.py from Logo.bmp. Do not edit.
+
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+STATIC CONST BLT_LOGO_VARIANT mBltLogoVariants[] = {
+  { 800, 600, 304, 201, TRUE, 0, 7418 },
+  { 1920, 1080, 547, 362, TRUE, 7418, 22588 },
+};
+
+STATIC CONST UINT32 mBltLogoData[] = {
+  0x800001e5, 0x00000000, 0x00000020, 0x00060606, 0x00131313, 0x00202020, 0x002d2d2d, 0x003a3a3a,
+  0x00484848, 0x00555555, 0x00626262, 0x006f6f6f, 0x007c7c7c, 0x00898989, 0x00979797, 0x00a3a3a3,
+  0x00a3a3a3, 0x009c9c9c, 0x00959595, 0x008e8e8e, 0x00878787, 0x00808080, 0x007a7a7a, 0x00737373,
+  0x006c6c6c, 0x00656565, 0x005e5e5e, 0x00585858, 0x00515151, 0x004a4a4a, 0x00434343, 0x003c3c3c,
+  0x00353535, 0x002a2a2a, 0x000f0f0f, 0x80000105, 0x00000000, 0x0000000b, 0x00141414, 0x00343434,
+  0x00555555, 0x00757575, 0x00959595, 0x00b4b4b4, 0x00c4c4c4, 0x00d1d1d1, 0x00dedede, 0x00ebebeb,
+  0x00f9f9f9, 0x80000020, 0x00ffffff, 0x00000009, 0x00f3f3f3, 0x00d6d6d6, 0x00bababa, 0x009d9d9d,
+  0x00808080, 0x00646464, 0x00474747, 0x002a2a2a, 0x000e0e0e, 0x800000f4, 0x00000000, 0x00000008,
+  0x00111111, 0x00323232, 0x00525252, 0x00727272, 0x00939393, 0x00b3b3b3, 0x00d3d3d3, 0x00f3f3f3,
+  0x80000034, 0x00ffffff, 0x00000008, 0x00f1f1f1, 0x00d5d5d5, 0x00b8b8b8, 0x009b9b9b, 0x007f7f7f,
+  0x00626262, 0x003d3d3d, 0x000a0a0a, 0x800000e5, 0x00000000, 0x00000007, 0x00131313, 0x00464646,
+  0x00707070, 0x00909090, 0x00b0b0b0, 0x00d1d1d1, 0x00f1f1f1, 0x80000043, 0x00ffffff, 0x00000006,
+  0x00fcfcfc, 0x00d1d1d1, 0x009a9a9a, 0x00646464, 0x002e2e2e, 0x00030303, 0x800000db, 0x00000000,
+  0x00000005, 0x00151515, 0x00474747, 0x007a7a7a, 0x00adadad, 0x00e0e0e0, 0x8000004f, 0x00ffffff,
+  0x00000005, 0x00f4f4f4, 0x00c2c2c2, 0x008c8c8c, 0x00555555, 0x001f1f1f, 0x800000d2, 0x00000000,
+  0x00000005, 0x00161616, 0x00494949, 0x007c7c7c, 0x00aeaeae, 0x00e1e1e1, 0x80000059, 0x00ffffff,
+  0x00000005, 0x00e9e9e9, 0x00b3b3b3, 0x007d7d7d, 0x00474747, 0x00111111, 0x800000c8, 0x00000000,
+  0x00000005, 0x00171717, 0x004a4a4a, 0x007d7d7d, 0x00b0b0b0, 0x00e3e3e3, 0x80000062, 0x00ffffff,
+  0x00000004, 0x00fefefe, 0x00c5c5c5, 0x00707070, 0x001c1c1c, 0x800000c1, 0x00000000, 0x00000004,
+  0x00282828, 0x006e6e6e, 0x00b0b0b0, 0x00e4e4e4, 0x8000006a, 0x00ffffff, 0x00000004, 0x00fefefe,
+  0x00c5c5c5, 0x00707070, 0x001c1c1c, 0x800000ba, 0x00000000, 0x00000004, 0x00111111, 0x00555555,
+  0x009b9b9b, 0x00e1e1e1, 0x80000071, 0x00ffffff, 0x00000004, 0x00fefefe, 0x00c5c5c5, 0x00707070,
+  0x001c1c1c, 0x800000b3, 0x00000000, 0x00000005, 0x00040404, 0x003b3b3b, 0x00828282, 0x00c8c8c8,
+  0x00fdfdfd, 0x80000077, 0x00ffffff, 0x00000004, 0x00fefefe, 0x00c5c5c5, 0x00707070, 0x001c1c1c,
+  0x800000ad, 0x00000000, 0x00000004, 0x00222222, 0x00686868, 0x00afafaf, 0x00f1f1f1, 0x80000037,
+  0x00ffffff, 0x00000013, 0x00fbfbfb, 0x00ededed, 0x00dfdfdf, 0x00d1d1d1, 0x00c3c3c3, 0x00c3c3c3,
+  0x00c7c7c7, 0x00cccccc, 0x00d0d0d0, 0x00d4d4d4, 0x00d9d9d9, 0x00dddddd, 0x00e2e2e2, 0x00e6e6e6,
+  0x00eaeaea, 0x00efefef, 0x00f3f3f3, 0x00f8f8f8, 0x00fcfcfc, 0x80000034, 0x00ffffff, 0x00000004,
+  0x00fefefe, 0x00c5c5c5, 0x00707070, 0x00171717, 0x800000a6, 0x00000000, 0x00000004, 0x000d0d0d,
+  0x004f4f4f, 0x00959595, 0x00dcdcdc, 0x8000002c, 0x00ffffff, 0x0000000f, 0x00f3f3f3, 0x00d4d4d4,
+  0x00b5b5b5, 0x00a4a4a4, 0x00969696, 0x00888888, 0x00797979, 0x006b6b6b, 0x005d5d5d, 0x004f4f4f,
+  0x00414141, 0x00333333, 0x00252525, 0x00171717, 0x00090909, 0x80000013, 0x00000000, 0x0000000c,
+  0x00010101, 0x00050505, 0x00111111, 0x002b2b2b, 0x00454545, 0x005e5e5e, 0x00787878, 0x00929292,
+  0x00acacac, 0x00c5c5c5, 0x00dfdfdf, 0x00f8f8f8, 0x8000002b, 0x00ffffff, 0x00000003, 0x00f8f8f8,
+  0x009e9e9e, 0x002d2d2d, 0x800000a1, 0x00000000, 0x00000004, 0x001d1d1d, 0x00757575, 0x00c2c2c2,
+  0x00fbfbfb, 0x80000027, 0x00ffffff, 0x00000008, 0x00f0f0f0, 0x00d0d0d0, 0x00b1b1b1, 0x00919191,
+  0x00727272, 0x00525252, 0x00333333, 0x00131313, 0x8000002e, 0x00000000, 0x00000008, 0x00131313,
+  0x002c2c2c, 0x00464646, 0x00606060, 0x007a7a7a, 0x00959595, 0x00c2c2c2, 0x00f2f2f2, 0x80000026,
+  0x00ffffff, 0x00000003, 0x00bababa, 0x00484848, 0x00010101, 0x8000009b, 0x00000000, 0x00000004,
+  0x00101010, 0x00646464, 0x00bfbfbf, 0x00fefefe, 0x80000022, 0x00ffffff, 0x00000008, 0x00f4f4f4,
+  0x00cdcdcd, 0x00adadad, 0x008e8e8e, 0x006e6e6e, 0x004e4e4e, 0x002f2f2f, 0x000f0f0f, 0x8000003d,
+  0x00000000, 0x00000006, 0x00010101, 0x00272727, 0x00595959, 0x008c8c8c, 0x00bebebe, 0x00f0f0f0,
+  0x80000023, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00636363, 0x00050505, 0x80000096, 0x00000000,
+  0x00000004, 0x00070707, 0x00535353, 0x00aeaeae, 0x00f8f8f8, 0x80000020, 0x00ffffff, 0x00000006,
+  0x00e6e6e6, 0x00b6b6b6, 0x00868686, 0x00565656, 0x00272727, 0x00020202, 0x80000049, 0x00000000,
+  0x00000006, 0x00010101, 0x00232323, 0x00555555, 0x00888888, 0x00bababa, 0x00ececec, 0x80000020,
+  0x00ffffff, 0x00000003, 0x00dcdcdc, 0x005a5a5a, 0x00010101, 0x80000091, 0x00000000, 0x00000004,
+  0x00020202, 0x00414141, 0x009c9c9c, 0x00f0f0f0, 0x8000001d, 0x00ffffff, 0x00000006, 0x00fcfcfc,
+  0x00d5d5d5, 0x00a5a5a5, 0x00757575, 0x00454545, 0x00161616, 0x80000055, 0x00000000, 0x00000004,
+  0x001f1f1f, 0x00525252, 0x00919191, 0x00e2e2e2, 0x8000001e, 0x00ffffff, 0x00000002, 0x00d0d0d0,
+  0x004a4a4a, 0x8000008e, 0x00000000, 0x00000003, 0x002f2f2f, 0x008b8b8b, 0x00e4e4e4, 0x8000001b,
+  0x00ffffff, 0x00000006, 0x00f2f2f2, 0x00c3c3c3, 0x00949494, 0x00646464, 0x00343434, 0x00080808,
+  0x8000005e, 0x00000000, 0x00000003, 0x00353535, 0x00868686, 0x00d8d8d8, 0x8000001d, 0x00ffffff,
+  0x00000002, 0x00c2c2c2, 0x003b3b3b, 0x80000089, 0x00000000, 0x00000003, 0x001f1f1f, 0x00797979,
+  0x00d4d4d4, 0x8000001a, 0x00ffffff, 0x00000005, 0x00e3e3e3, 0x00a2a2a2, 0x00626262, 0x00242424,
+  0x00010101, 0x80000066, 0x00000000, 0x00000003, 0x002a2a2a, 0x007c7c7c, 0x00cecece, 0x8000001c,
+  0x00ffffff, 0x00000002, 0x00a3a3a3, 0x00141414, 0x80000084, 0x00000000, 0x00000004, 0x00111111,
+  0x00676767, 0x00c3c3c3, 0x00fefefe, 0x80000018, 0x00ffffff, 0x00000004, 0x00e4e4e4, 0x00a4a4a4,
+  0x00646464, 0x00232323, 0x8000006e, 0x00000000, 0x00000004, 0x00202020, 0x00727272, 0x00c3c3c3,
+  0x00fdfdfd, 0x80000019, 0x00ffffff, 0x00000002, 0x00eaeaea, 0x005a5a5a, 0x80000081, 0x00000000,
+  0x00000003, 0x00262626, 0x00979797, 0x00f6f6f6, 0x80000017, 0x00ffffff, 0x00000004, 0x00e6e6e6,
+  0x00a6a6a6, 0x00666666, 0x00252525, 0x80000075, 0x00000000, 0x00000003, 0x00181818, 0x00676767,
+  0x00c6c6c6, 0x80000019, 0x00ffffff, 0x00000002, 0x00b5b5b5, 0x001e1e1e, 0x8000007d, 0x00000000,
+  0x00000003, 0x003f3f3f, 0x00b2b2b2, 0x00fefefe, 0x80000015, 0x00ffffff, 0x00000004, 0x00e8e8e8,
+  0x00a8a8a8, 0x00676767, 0x00272727, 0x8000007c, 0x00000000, 0x00000002, 0x003f3f3f, 0x00b8b8b8,
+  0x80000018, 0x00ffffff, 0x00000002, 0x00f3f3f3, 0x006a6a6a, 0x80000079, 0x00000000, 0x00000003,
+  0x00040404, 0x005a5a5a, 0x00cccccc, 0x80000014, 0x00ffffff, 0x00000004, 0x00f4f4f4, 0x00adadad,
+  0x00696969, 0x00292929, 0x80000082, 0x00000000, 0x00000003, 0x00323232, 0x00ababab, 0x00fdfdfd,
+  0x80000017, 0x00ffffff, 0x00000002, 0x00ababab, 0x000d0d0d, 0x80000075, 0x00000000, 0x00000003,
+  0x000f0f0f, 0x00757575, 0x00e3e3e3, 0x80000013, 0x00ffffff, 0x00000004, 0x00eeeeee, 0x00a1a1a1,
+  0x004f4f4f, 0x00090909, 0x80000087, 0x00000000, 0x00000003, 0x00272727, 0x009e9e9e, 0x00fafafa,
+  0x80000016, 0x00ffffff, 0x00000002, 0x00d9d9d9, 0x002d2d2d, 0x80000072, 0x00000000, 0x00000003,
+  0x00212121, 0x00909090, 0x00f3f3f3, 0x80000012, 0x00ffffff, 0x00000004, 0x00e5e5e5, 0x00959595,
+  0x00444444, 0x00040404, 0x8000008c, 0x00000000, 0x00000003, 0x001d1d1d, 0x00919191, 0x00f5f5f5,
+  0x80000015, 0x00ffffff, 0x00000002, 0x00f5f5f5, 0x005e5e5e, 0x8000006f, 0x00000000, 0x00000003,
+  0x00383838, 0x00ababab, 0x00fcfcfc, 0x80000011, 0x00ffffff, 0x00000004, 0x00dbdbdb, 0x008a8a8a,
+  0x00393939, 0x00010101, 0x80000091, 0x00000000, 0x00000003, 0x00151515, 0x00848484, 0x00efefef,
+  0x80000015, 0x00ffffff, 0x00000002, 0x00999999, 0x00050505, 0x8000006a, 0x00000000, 0x00000003,
+  0x00030303, 0x00535353, 0x00c6c6c6, 0x80000011, 0x00ffffff, 0x00000003, 0x00d0d0d0, 0x007f7f7f,
+  0x002d2d2d, 0x80000097, 0x00000000, 0x00000003, 0x000f0f0f, 0x00939393, 0x00fdfdfd, 0x80000014,
+  0x00ffffff, 0x00000002, 0x00b4b4b4, 0x00080808, 0x80000067, 0x00000000, 0x00000003, 0x00090909,
+  0x006e6e6e, 0x00dedede, 0x8000000f, 0x00ffffff, 0x00000004, 0x00fefefe, 0x00c5c5c5, 0x00737373,
+  0x00222222, 0x8000009c, 0x00000000, 0x00000002, 0x00363636, 0x00cfcfcf, 0x80000014, 0x00ffffff,
+  0x00000002, 0x00c0c0c0, 0x000d0d0d, 0x80000064, 0x00000000, 0x00000003, 0x00020202, 0x00606060,
+  0x00e3e3e3, 0x8000000f, 0x00ffffff, 0x00000003, 0x00d7d7d7, 0x00737373, 0x00181818, 0x800000a0,
+  0x00000000, 0x00000003, 0x00040404, 0x00747474, 0x00f5f5f5, 0x80000013, 0x00ffffff, 0x00000002,
+  0x00cacaca, 0x00131313, 0x80000062, 0x00000000, 0x00000002, 0x00474747, 0x00d1d1d1, 0x8000000e,
+  0x00ffffff, 0x00000003, 0x00f5f5f5, 0x00a0a0a0, 0x003c3c3c, 0x800000a5, 0x00000000, 0x00000002,
+  0x001f1f1f, 0x00c4c4c4, 0x80000013, 0x00ffffff, 0x00000002, 0x00d4d4d4, 0x00191919, 0x8000005f,
+  0x00000000, 0x00000002, 0x00303030, 0x00bababa, 0x8000000e, 0x00ffffff, 0x00000003, 0x00cdcdcd,
+  0x00686868, 0x000e0e0e, 0x800000a8, 0x00000000, 0x00000002, 0x00040404, 0x008f8f8f, 0x80000013,
+  0x00ffffff, 0x00000002, 0x00d8d8d8, 0x00121212, 0x8000005c, 0x00000000, 0x00000003, 0x001d1d1d,
+  0x00a1a1a1, 0x00fdfdfd, 0x8000000c, 0x00ffffff, 0x00000003, 0x00f0f0f0, 0x00959595, 0x00313131,
+  0x800000ad, 0x00000000, 0x00000002, 0x00555555, 0x00f2f2f2, 0x80000012, 0x00ffffff, 0x00000002,
+  0x00c4c4c4, 0x00080808, 0x80000059, 0x00000000, 0x00000003, 0x000f0f0f, 0x00888888, 0x00f7f7f7,
+  0x8000000c, 0x00ffffff, 0x00000003, 0x00c2c2c2, 0x005e5e5e, 0x00090909, 0x800000b0, 0x00000000,
+  0x00000002, 0x00282828, 0x00d5d5d5, 0x80000012, 0x00ffffff, 0x00000002, 0x00acacac, 0x00020202,
+  0x80000056, 0x00000000, 0x00000003, 0x00060606, 0x006f6f6f, 0x00ececec, 0x8000000b, 0x00ffffff,
+  0x00000003, 0x00e9e9e9, 0x008a8a8a, 0x00272727, 0x800000b4, 0x00000000, 0x00000002, 0x000e0e0e,
+  0x00c1c1c1, 0x80000012, 0x00ffffff, 0x00000001, 0x00909090, 0x80000054, 0x00000000, 0x00000003,
+  0x00010101, 0x00575757, 0x00dddddd, 0x8000000a, 0x00ffffff, 0x00000004, 0x00fdfdfd, 0x00b7b7b7,
+  0x00535353, 0x00050505, 0x800000b7, 0x00000000, 0x00000002, 0x00090909, 0x00b6b6b6, 0x80000012,
+  0x00ffffff, 0x00000001, 0x00717171, 0x80000052, 0x00000000, 0x00000002, 0x003e3e3e, 0x00c9c9c9,
+  0x8000000a, 0x00ffffff, 0x00000003, 0x00f9f9f9, 0x009c9c9c, 0x00262626, 0x800000bb, 0x00000000,
+  0x00000002, 0x00050505, 0x00a9a9a9, 0x80000011, 0x00ffffff, 0x00000002, 0x00fcfcfc, 0x00373737,
+  0x8000004f, 0x00000000, 0x00000002, 0x00272727, 0x00b1b1b1, 0x8000000a, 0x00ffffff, 0x00000003,
+  0x00f3f3f3, 0x008c8c8c, 0x001b1b1b, 0x800000be, 0x00000000, 0x00000002, 0x00020202, 0x009c9c9c,
+  0x80000011, 0x00ffffff, 0x00000002, 0x00dadada, 0x000a0a0a, 0x8000004e, 0x00000000, 0x00000001,
+  0x00989898, 0x80000009, 0x00ffffff, 0x00000003, 0x00eaeaea, 0x007c7c7c, 0x00111111, 0x800000c1,
+  0x00000000, 0x00000002, 0x00010101, 0x00aaaaaa, 0x80000011, 0x00ffffff, 0x00000001, 0x00959595,
+  0x8000004e, 0x00000000, 0x00000001, 0x00989898, 0x80000007, 0x00ffffff, 0x00000003, 0x00e0e0e0,
+  0x006c6c6c, 0x00090909, 0x800000c4, 0x00000000, 0x00000002, 0x00080808, 0x00c7c7c7, 0x80000011,
+  0x00ffffff, 0x00000001, 0x00474747, 0x8000004d, 0x00000000, 0x00000001, 0x00989898, 0x80000005,
+  0x00ffffff, 0x00000003, 0x00d3d3d3, 0x005c5c5c, 0x00040404, 0x800000c7, 0x00000000, 0x00000002,
+  0x00161616, 0x00dfdfdf, 0x80000010, 0x00ffffff, 0x00000002, 0x00e5e5e5, 0x00121212, 0x8000004c,
+  0x00000000, 0x00000001, 0x00989898, 0x80000003, 0x00ffffff, 0x00000003, 0x00c4c4c4, 0x004c4c4c,
+  0x00010101, 0x800000ca, 0x00000000, 0x00000002, 0x002a2a2a, 0x00f0f0f0, 0x80000010, 0x00ffffff,
+  0x00000001, 0x00959595, 0x8000004c, 0x00000000, 0x00000004, 0x00989898, 0x00ffffff, 0x00b4b4b4,
+  0x003c3c3c, 0x800000ce, 0x00000000, 0x00000001, 0x004c4c4c, 0x80000010, 0x00ffffff, 0x00000002,
+  0x00fbfbfb, 0x00262626, 0x8000004b, 0x00000000, 0x00000002, 0x00535353, 0x002d2d2d, 0x800000d1,
+  0x00000000, 0x00000001, 0x009c9c9c, 0x80000010, 0x00ffffff, 0x00000001, 0x00adadad, 0x8000011e,
+  0x00000000, 0x00000002, 0x000e0e0e, 0x00e0e0e0, 0x80000010, 0x00ffffff, 0x00000001, 0x00393939,
+  0x8000011e, 0x00000000, 0x00000002, 0x00424242, 0x00fefefe, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00c3c3c3, 0x8000011f, 0x00000000, 0x00000001, 0x00949494, 0x80000010, 0x00ffffff, 0x00000001,
+  0x004b4b4b, 0x8000011e, 0x00000000, 0x00000002, 0x000f0f0f, 0x00efefef, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00b4b4b4, 0x800000ed, 0x00000000, 0x00000001, 0x00454545, 0x8000000e, 0x00606060,
+  0x00000001, 0x00515151, 0x8000000f, 0x00000000, 0x00000004, 0x00242424, 0x00515151, 0x00313131,
+  0x00040404, 0x8000000f, 0x00000000, 0x00000001, 0x007c7c7c, 0x8000000f, 0x00ffffff, 0x00000002,
+  0x00fcfcfc, 0x001b1b1b, 0x800000ec, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff,
+  0x00000001, 0x00d8d8d8, 0x8000000d, 0x00000000, 0x00000008, 0x00656565, 0x00ebebeb, 0x00e2e2e2,
+  0x00b5b5b5, 0x00d5d5d5, 0x00f4f4f4, 0x008f8f8f, 0x000a0a0a, 0x8000000d, 0x00000000, 0x00000002,
+  0x000d0d0d, 0x00ececec, 0x8000000f, 0x00ffffff, 0x00000001, 0x007c7c7c, 0x80000032, 0x00000000,
+  0x00000001, 0x00141414, 0x8000000f, 0x00404040, 0x00000001, 0x00101010, 0x800000a9, 0x00000000,
+  0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000000b, 0x00000000,
+  0x0000000b, 0x00020202, 0x00b3b3b3, 0x00d0d0d0, 0x00363636, 0x00161616, 0x00111111, 0x00000000,
+  0x00141414, 0x00a8a8a8, 0x00dbdbdb, 0x001b1b1b, 0x8000000d, 0x00000000, 0x00000001, 0x00777777,
+  0x8000000f, 0x00ffffff, 0x00000002, 0x00dfdfdf, 0x00010101, 0x80000031, 0x00000000, 0x00000001,
+  0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00404040, 0x800000a9, 0x00000000, 0x00000001,
+  0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000000b, 0x00000000, 0x0000000b,
+  0x00727272, 0x00c8c8c8, 0x00121212, 0x00ececec, 0x00ffffff, 0x00ffffff, 0x00dadada, 0x00848484,
+  0x00000000, 0x00868686, 0x00b6b6b6, 0x8000000d, 0x00000000, 0x00000002, 0x000b0b0b, 0x00e9e9e9,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00454545, 0x80000031, 0x00000000, 0x00000001, 0x00505050,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00404040, 0x800000a9, 0x00000000, 0x00000001, 0x00b8b8b8,
+  0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000000a, 0x00000000, 0x0000000d, 0x00121212,
+  0x00f0f0f0, 0x00292929, 0x00181818, 0x00ffffff, 0x008e8e8e, 0x00494949, 0x00a4a4a4, 0x00ffffff,
+  0x00313131, 0x00060606, 0x00d5d5d5, 0x004f4f4f, 0x8000000d, 0x00000000, 0x00000001, 0x00858585,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00a3a3a3, 0x80000031, 0x00000000, 0x00000001, 0x00505050,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00404040, 0x800000a9, 0x00000000, 0x00000001, 0x00b8b8b8,
+  0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000000a, 0x00000000, 0x0000000d, 0x00484848,
+  0x00c5c5c5, 0x00000000, 0x00181818, 0x00ffffff, 0x00686868, 0x00000000, 0x003b3b3b, 0x00ffffff,
+  0x00474747, 0x00000000, 0x007b7b7b, 0x00909090, 0x8000000d, 0x00000000, 0x00000001, 0x00272727,
+  0x8000000f, 0x00ffffff, 0x00000002, 0x00eaeaea, 0x00010101, 0x80000030, 0x00000000, 0x00000001,
+  0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00404040, 0x800000a9, 0x00000000, 0x00000001,
+  0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000000a, 0x00000000, 0x0000000d,
+  0x007c7c7c, 0x00939393, 0x00000000, 0x00181818, 0x00ffffff, 0x00c5c5c5, 0x00a2a2a2, 0x00e3e3e3,
+  0x00e6e6e6, 0x000b0b0b, 0x00000000, 0x00444444, 0x00c4c4c4, 0x8000000e, 0x00000000, 0x00000001,
+  0x00c8c8c8, 0x8000000f, 0x00ffffff, 0x00000001, 0x00303030, 0x80000030, 0x00000000, 0x00000001,
+  0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00404040, 0x800000a9, 0x00000000, 0x00000001,
+  0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000000a, 0x00000000, 0x0000000d,
+  0x006d6d6d, 0x00a2a2a2, 0x00000000, 0x00181818, 0x00ffffff, 0x00c8c8c8, 0x00d3d3d3, 0x00fefefe,
+  0x00282828, 0x00000000, 0x00000000, 0x00545454, 0x00b5b5b5, 0x8000000e, 0x00000000, 0x00000001,
+  0x00696969, 0x8000000f, 0x00ffffff, 0x00000001, 0x00757575, 0x80000030, 0x00000000, 0x00000001,
+  0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00404040, 0x800000a9, 0x00000000, 0x00000001,
+  0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000000a, 0x00000000, 0x0000000d,
+  0x00373737, 0x00d7d7d7, 0x00000000, 0x00181818, 0x00ffffff, 0x00787878, 0x00282828, 0x00fafafa,
+  0x00a0a0a0, 0x00000000, 0x00000000, 0x008e8e8e, 0x007f7f7f, 0x8000000e, 0x00000000, 0x00000002,
+  0x00111111, 0x00f8f8f8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00bababa, 0x80000030, 0x00000000,
+  0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00404040, 0x8000004a, 0x00000000,
+  0x00000001, 0x00373737, 0x8000000f, 0x00b0b0b0, 0x00000001, 0x00161616, 0x8000004e, 0x00000000,
+  0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000000a, 0x00000000,
+  0x0000000d, 0x00060606, 0x00dbdbdb, 0x00595959, 0x00181818, 0x00ffffff, 0x00787878, 0x00000000,
+  0x008e8e8e, 0x00fefefe, 0x00393939, 0x001e1e1e, 0x00ececec, 0x002d2d2d, 0x8000000f, 0x00000000,
+  0x00000001, 0x00b2b2b2, 0x8000000e, 0x00ffffff, 0x00000002, 0x00f7f7f7, 0x00080808, 0x8000002f,
+  0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00404040, 0x8000004a,
+  0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000004e,
+  0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000000b,
+  0x00000000, 0x0000000b, 0x003c3c3c, 0x00eaeaea, 0x003d3d3d, 0x008c8c8c, 0x00393939, 0x00000000,
+  0x000f0f0f, 0x008c8c8c, 0x00666666, 0x00c4c4c4, 0x007d7d7d, 0x80000010, 0x00000000, 0x00000001,
+  0x00747474, 0x8000000f, 0x00ffffff, 0x00000001, 0x00434343, 0x80000023, 0x00000000, 0x00000002,
+  0x00010101, 0x00555555, 0x8000000a, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00404040, 0x8000004a, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00202020, 0x8000004e, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff,
+  0x00000001, 0x00d8d8d8, 0x8000000c, 0x00000000, 0x0000000a, 0x005f5f5f, 0x00eeeeee, 0x008d8d8d,
+  0x00424242, 0x00151515, 0x00353535, 0x00717171, 0x00eaeaea, 0x008f8f8f, 0x00040404, 0x80000010,
+  0x00000000, 0x00000001, 0x00383838, 0x8000000f, 0x00ffffff, 0x00000001, 0x00707070, 0x80000022,
+  0x00000000, 0x00000003, 0x00030303, 0x00a2a2a2, 0x00b8b8b8, 0x8000000a, 0x00000000, 0x00000001,
+  0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00404040, 0x8000004a, 0x00000000, 0x00000001,
+  0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000004e, 0x00000000, 0x00000001,
+  0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000000d, 0x00000000, 0x00000007,
+  0x00202020, 0x009b9b9b, 0x00cfcfcf, 0x00f9f9f9, 0x00dcdcdc, 0x00aaaaaa, 0x003f3f3f, 0x80000012,
+  0x00000000, 0x00000002, 0x00060606, 0x00f6f6f6, 0x8000000e, 0x00ffffff, 0x00000001, 0x00979797,
+  0x80000021, 0x00000000, 0x00000004, 0x00050505, 0x00aaaaaa, 0x00ffffff, 0x00b8b8b8, 0x8000000a,
+  0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00404040, 0x8000004a,
+  0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000004e,
+  0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000010,
+  0x00000000, 0x00000001, 0x00010101, 0x80000016, 0x00000000, 0x00000001, 0x00c1c1c1, 0x8000000e,
+  0x00ffffff, 0x00000001, 0x00bdbdbd, 0x80000020, 0x00000000, 0x00000005, 0x00070707, 0x00b2b2b2,
+  0x00ffffff, 0x00ffffff, 0x00b8b8b8, 0x8000000a, 0x00000000, 0x00000001, 0x00505050, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x00404040, 0x8000004a, 0x00000000, 0x00000001, 0x00505050, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x00202020, 0x8000004e, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e,
+  0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000027, 0x00000000, 0x00000001, 0x00858585, 0x8000000e,
+  0x00ffffff, 0x00000001, 0x00e4e4e4, 0x8000001f, 0x00000000, 0x00000002, 0x000a0a0a, 0x00bababa,
+  0x80000003, 0x00ffffff, 0x00000001, 0x00b8b8b8, 0x8000000a, 0x00000000, 0x00000001, 0x00505050,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00404040, 0x8000004a, 0x00000000, 0x00000001, 0x00505050,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000004e, 0x00000000, 0x00000001, 0x00b8b8b8,
+  0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000027, 0x00000000, 0x00000001, 0x00575757,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x000b0b0b, 0x8000001d, 0x00000000, 0x00000002, 0x000d0d0d,
+  0x00c1c1c1, 0x80000004, 0x00ffffff, 0x00000001, 0x00b8b8b8, 0x8000000a, 0x00000000, 0x00000001,
+  0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00404040, 0x8000004a, 0x00000000, 0x00000001,
+  0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000004e, 0x00000000, 0x00000001,
+  0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000027, 0x00000000, 0x00000001,
+  0x00414141, 0x8000000f, 0x00ffffff, 0x00000001, 0x00313131, 0x8000001c, 0x00000000, 0x00000002,
+  0x00101010, 0x00c8c8c8, 0x80000005, 0x00ffffff, 0x00000001, 0x00b8b8b8, 0x8000000a, 0x00000000,
+  0x00000001, 0x00282828, 0x8000000f, 0x00808080, 0x00000001, 0x00202020, 0x8000004a, 0x00000000,
+  0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000004e, 0x00000000,
+  0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000027, 0x00000000,
+  0x00000001, 0x002a2a2a, 0x8000000f, 0x00ffffff, 0x00000001, 0x00545454, 0x8000001b, 0x00000000,
+  0x00000002, 0x00141414, 0x00cfcfcf, 0x80000006, 0x00ffffff, 0x00000001, 0x00b8b8b8, 0x80000065,
+  0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000004e,
+  0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000027,
+  0x00000000, 0x00000001, 0x00141414, 0x8000000f, 0x00ffffff, 0x00000001, 0x00626262, 0x8000001a,
+  0x00000000, 0x00000002, 0x00161616, 0x00d5d5d5, 0x80000007, 0x00ffffff, 0x00000001, 0x007c7c7c,
+  0x80000065, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020,
+  0x8000004e, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8,
+  0x80000027, 0x00000000, 0x00000002, 0x00010101, 0x00fcfcfc, 0x8000000e, 0x00ffffff, 0x00000001,
+  0x006d6d6d, 0x80000019, 0x00000000, 0x00000002, 0x00070707, 0x00c6c6c6, 0x80000007, 0x00ffffff,
+  0x00000002, 0x00afafaf, 0x00010101, 0x80000065, 0x00000000, 0x00000001, 0x00505050, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x00202020, 0x8000004e, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e,
+  0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000028, 0x00000000, 0x00000001, 0x00e7e7e7, 0x8000000e,
+  0x00ffffff, 0x00000001, 0x00787878, 0x80000019, 0x00000000, 0x00000001, 0x00a5a5a5, 0x80000007,
+  0x00ffffff, 0x00000002, 0x00d2d2d2, 0x000c0c0c, 0x80000066, 0x00000000, 0x00000001, 0x00505050,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000004e, 0x00000000, 0x00000001, 0x00b8b8b8,
+  0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000028, 0x00000000, 0x00000001, 0x00d1d1d1,
+  0x8000000e, 0x00ffffff, 0x00000001, 0x00838383, 0x80000018, 0x00000000, 0x00000001, 0x007e7e7e,
+  0x80000007, 0x00ffffff, 0x00000002, 0x00ebebeb, 0x00212121, 0x80000067, 0x00000000, 0x00000001,
+  0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000004e, 0x00000000, 0x00000001,
+  0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000028, 0x00000000, 0x00000001,
+  0x00bbbbbb, 0x8000000e, 0x00ffffff, 0x00000001, 0x008e8e8e, 0x80000017, 0x00000000, 0x00000002,
+  0x00575757, 0x00fefefe, 0x80000006, 0x00ffffff, 0x00000002, 0x00fbfbfb, 0x00404040, 0x80000068,
+  0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000004e,
+  0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000028,
+  0x00000000, 0x00000001, 0x00bbbbbb, 0x8000000e, 0x00ffffff, 0x00000001, 0x00989898, 0x80000016,
+  0x00000000, 0x00000002, 0x00373737, 0x00f7f7f7, 0x80000007, 0x00ffffff, 0x00000001, 0x00696969,
+  0x80000069, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020,
+  0x8000002a, 0x00000000, 0x00000002, 0x00010101, 0x00080808, 0x80000022, 0x00000000, 0x00000001,
+  0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000028, 0x00000000, 0x00000001,
+  0x00d1d1d1, 0x8000000e, 0x00ffffff, 0x00000001, 0x009a9a9a, 0x80000015, 0x00000000, 0x00000002,
+  0x001e1e1e, 0x00e8e8e8, 0x80000007, 0x00ffffff, 0x00000001, 0x009f9f9f, 0x8000000f, 0x00000000,
+  0x00000001, 0x00020202, 0x8000000f, 0x00080808, 0x00000001, 0x00020202, 0x8000000d, 0x00000000,
+  0x80000004, 0x00070707, 0x80000004, 0x00060606, 0x80000004, 0x00050505, 0x80000004, 0x00040404,
+  0x80000004, 0x00030303, 0x80000004, 0x00020202, 0x80000004, 0x00010101, 0x80000021, 0x00000000,
+  0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00272727, 0x8000000a, 0x00080808,
+  0x00000001, 0x00060606, 0x80000018, 0x00000000, 0x00000010, 0x00070707, 0x00454545, 0x00868686,
+  0x00a1a1a1, 0x00b8b8b8, 0x00cfcfcf, 0x00e6e6e6, 0x00fbfbfb, 0x00ffffff, 0x00f0f0f0, 0x00d6d6d6,
+  0x00bcbcbc, 0x00a2a2a2, 0x00888888, 0x00575757, 0x000b0b0b, 0x8000001b, 0x00000000, 0x00000001,
+  0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000028, 0x00000000, 0x00000001,
+  0x00e7e7e7, 0x8000000e, 0x00ffffff, 0x00000001, 0x008b8b8b, 0x80000014, 0x00000000, 0x00000002,
+  0x000c0c0c, 0x00d1d1d1, 0x80000007, 0x00ffffff, 0x00000002, 0x00e2e2e2, 0x000e0e0e, 0x8000000f,
+  0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d,
+  0x00000000, 0x80000020, 0x00ffffff, 0x00000007, 0x00f3f3f3, 0x00dddddd, 0x00c6c6c6, 0x00b0b0b0,
+  0x00959595, 0x004f4f4f, 0x00090909, 0x80000016, 0x00000000, 0x00000001, 0x00505050, 0x8000001a,
+  0x00ffffff, 0x00000001, 0x00c0c0c0, 0x80000015, 0x00000000, 0x00000004, 0x001f1f1f, 0x00686868,
+  0x00b2b2b2, 0x00f4f4f4, 0x8000000e, 0x00ffffff, 0x00000004, 0x00f5f5f5, 0x00aaaaaa, 0x00545454,
+  0x00090909, 0x80000018, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001,
+  0x00d8d8d8, 0x80000027, 0x00000000, 0x00000002, 0x00010101, 0x00fcfcfc, 0x8000000e, 0x00ffffff,
+  0x00000001, 0x007d7d7d, 0x80000013, 0x00000000, 0x00000002, 0x00020202, 0x00b3b3b3, 0x80000008,
+  0x00ffffff, 0x00000001, 0x00454545, 0x80000010, 0x00000000, 0x00000001, 0x00505050, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x80000026, 0x00ffffff, 0x00000004,
+  0x00f5f5f5, 0x00afafaf, 0x00575757, 0x00010101, 0x80000013, 0x00000000, 0x00000001, 0x00505050,
+  0x8000001a, 0x00ffffff, 0x00000001, 0x00c0c0c0, 0x80000013, 0x00000000, 0x00000002, 0x00333333,
+  0x00b8b8b8, 0x80000015, 0x00ffffff, 0x00000003, 0x00f4f4f4, 0x00969696, 0x00101010, 0x80000016,
+  0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000027,
+  0x00000000, 0x00000001, 0x00141414, 0x8000000f, 0x00ffffff, 0x00000001, 0x006e6e6e, 0x80000013,
+  0x00000000, 0x00000001, 0x008b8b8b, 0x80000008, 0x00ffffff, 0x00000001, 0x00989898, 0x80000011,
+  0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d,
+  0x00000000, 0x80000029, 0x00ffffff, 0x00000002, 0x00c8c8c8, 0x00363636, 0x80000012, 0x00000000,
+  0x00000001, 0x00505050, 0x8000001a, 0x00ffffff, 0x00000001, 0x00c0c0c0, 0x80000011, 0x00000000,
+  0x00000003, 0x00282828, 0x00ababab, 0x00fefefe, 0x80000018, 0x00ffffff, 0x00000002, 0x00e8e8e8,
+  0x00595959, 0x80000015, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001,
+  0x00d8d8d8, 0x80000027, 0x00000000, 0x00000001, 0x002a2a2a, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x005f5f5f, 0x80000012, 0x00000000, 0x00000002, 0x00404040, 0x00fefefe, 0x80000007, 0x00ffffff,
+  0x00000002, 0x00dfdfdf, 0x000c0c0c, 0x80000011, 0x00000000, 0x00000001, 0x00505050, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000002a, 0x00ffffff, 0x00000003,
+  0x00fefefe, 0x00999999, 0x00050505, 0x80000010, 0x00000000, 0x00000001, 0x00505050, 0x8000001a,
+  0x00ffffff, 0x00000001, 0x00c0c0c0, 0x8000000f, 0x00000000, 0x00000003, 0x00101010, 0x009e9e9e,
+  0x00fcfcfc, 0x8000001c, 0x00ffffff, 0x00000002, 0x00b8b8b8, 0x00212121, 0x80000013, 0x00000000,
+  0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000027, 0x00000000,
+  0x00000001, 0x00414141, 0x8000000f, 0x00ffffff, 0x00000001, 0x00505050, 0x80000011, 0x00000000,
+  0x00000002, 0x000b0b0b, 0x00dddddd, 0x80000007, 0x00ffffff, 0x00000002, 0x00fefefe, 0x00414141,
+  0x80000012, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00505050,
+  0x8000000d, 0x00000000, 0x8000002c, 0x00ffffff, 0x00000002, 0x00b0b0b0, 0x00060606, 0x8000000f,
+  0x00000000, 0x00000001, 0x00505050, 0x8000001a, 0x00ffffff, 0x00000001, 0x00c0c0c0, 0x8000000e,
+  0x00000000, 0x00000002, 0x00232323, 0x00d7d7d7, 0x8000001f, 0x00ffffff, 0x00000002, 0x00f3f3f3,
+  0x003c3c3c, 0x80000012, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001,
+  0x00d8d8d8, 0x80000027, 0x00000000, 0x00000001, 0x00575757, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x003f3f3f, 0x80000011, 0x00000000, 0x00000001, 0x00929292, 0x80000008, 0x00ffffff, 0x00000001,
+  0x00939393, 0x80000013, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00505050, 0x8000000d, 0x00000000, 0x8000002d, 0x00ffffff, 0x00000002, 0x00b5b5b5, 0x00070707,
+  0x8000000e, 0x00000000, 0x00000001, 0x00505050, 0x8000001a, 0x00ffffff, 0x00000001, 0x00c0c0c0,
+  0x8000000d, 0x00000000, 0x00000002, 0x003e3e3e, 0x00ececec, 0x80000021, 0x00ffffff, 0x00000002,
+  0x00f3f3f3, 0x003c3c3c, 0x80000011, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff,
+  0x00000001, 0x00d8d8d8, 0x80000027, 0x00000000, 0x00000001, 0x008a8a8a, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00191919, 0x80000010, 0x00000000, 0x00000002, 0x003d3d3d, 0x00fefefe, 0x80000007,
+  0x00ffffff, 0x00000002, 0x00e8e8e8, 0x000c0c0c, 0x80000013, 0x00000000, 0x00000001, 0x00505050,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000002e, 0x00ffffff,
+  0x00000001, 0x00888888, 0x8000000e, 0x00000000, 0x00000001, 0x00505050, 0x8000001a, 0x00ffffff,
+  0x00000001, 0x00c0c0c0, 0x8000000c, 0x00000000, 0x00000002, 0x00606060, 0x00f9f9f9, 0x80000023,
+  0x00ffffff, 0x00000002, 0x00f3f3f3, 0x003c3c3c, 0x80000010, 0x00000000, 0x00000001, 0x00b8b8b8,
+  0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000027, 0x00000000, 0x00000001, 0x00cdcdcd,
+  0x8000000e, 0x00ffffff, 0x00000001, 0x00efefef, 0x80000010, 0x00000000, 0x00000002, 0x00090909,
+  0x00dbdbdb, 0x80000008, 0x00ffffff, 0x00000001, 0x006a6a6a, 0x80000014, 0x00000000, 0x00000001,
+  0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000002e,
+  0x00ffffff, 0x00000002, 0x00fcfcfc, 0x00333333, 0x8000000d, 0x00000000, 0x00000001, 0x00505050,
+  0x8000001a, 0x00ffffff, 0x00000001, 0x00c0c0c0, 0x8000000b, 0x00000000, 0x00000001, 0x00616161,
+  0x80000026, 0x00ffffff, 0x00000002, 0x00f3f3f3, 0x003a3a3a, 0x8000000f, 0x00000000, 0x00000001,
+  0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000026, 0x00000000, 0x00000002,
+  0x00131313, 0x00fefefe, 0x8000000e, 0x00ffffff, 0x00000001, 0x00c5c5c5, 0x80000010, 0x00000000,
+  0x00000001, 0x008e8e8e, 0x80000008, 0x00ffffff, 0x00000002, 0x00dbdbdb, 0x00050505, 0x80000014,
+  0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d,
+  0x00000000, 0x8000002f, 0x00ffffff, 0x00000002, 0x00d0d0d0, 0x00010101, 0x8000000c, 0x00000000,
+  0x00000001, 0x00505050, 0x8000001a, 0x00ffffff, 0x00000001, 0x00c0c0c0, 0x8000000a, 0x00000000,
+  0x00000002, 0x00303030, 0x00f7f7f7, 0x80000027, 0x00ffffff, 0x00000002, 0x00e2e2e2, 0x000d0d0d,
+  0x8000000e, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8,
+  0x80000026, 0x00000000, 0x00000001, 0x00555555, 0x8000000f, 0x00ffffff, 0x00000001, 0x009b9b9b,
+  0x8000000f, 0x00000000, 0x00000002, 0x003a3a3a, 0x00fdfdfd, 0x80000008, 0x00ffffff, 0x00000001,
+  0x00575757, 0x80000015, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00505050, 0x8000000d, 0x00000000, 0x80000030, 0x00ffffff, 0x00000001, 0x00484848, 0x8000000c,
+  0x00000000, 0x00000001, 0x00505050, 0x8000001a, 0x00ffffff, 0x00000001, 0x00c0c0c0, 0x80000009,
+  0x00000000, 0x00000002, 0x000f0f0f, 0x00dcdcdc, 0x80000029, 0x00ffffff, 0x00000001, 0x00959595,
+  0x8000000e, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8,
+  0x80000026, 0x00000000, 0x00000001, 0x00989898, 0x8000000f, 0x00ffffff, 0x00000001, 0x00707070,
+  0x8000000e, 0x00000000, 0x00000002, 0x00080808, 0x00d9d9d9, 0x80000008, 0x00ffffff, 0x00000002,
+  0x00cccccc, 0x00010101, 0x80000015, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x80000030, 0x00ffffff, 0x00000001, 0x00b0b0b0,
+  0x8000000c, 0x00000000, 0x00000001, 0x00505050, 0x8000001a, 0x00ffffff, 0x00000001, 0x00c0c0c0,
+  0x80000008, 0x00000000, 0x00000002, 0x00010101, 0x00b0b0b0, 0x8000002a, 0x00ffffff, 0x00000002,
+  0x00fefefe, 0x003c3c3c, 0x8000000d, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff,
+  0x00000001, 0x00d8d8d8, 0x80000026, 0x00000000, 0x00000001, 0x00dcdcdc, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00464646, 0x8000000e, 0x00000000, 0x00000001, 0x008b8b8b, 0x80000009, 0x00ffffff,
+  0x00000001, 0x00434343, 0x80000016, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x80000030, 0x00ffffff, 0x00000002, 0x00fcfcfc,
+  0x001a1a1a, 0x8000000b, 0x00000000, 0x00000001, 0x00505050, 0x8000001a, 0x00ffffff, 0x00000001,
+  0x00c0c0c0, 0x80000008, 0x00000000, 0x00000001, 0x00727272, 0x80000014, 0x00ffffff, 0x00000006,
+  0x00f9f9f9, 0x00dbdbdb, 0x00bfbfbf, 0x00cfcfcf, 0x00e9e9e9, 0x00fefefe, 0x80000012, 0x00ffffff,
+  0x00000002, 0x00d8d8d8, 0x00080808, 0x8000000c, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e,
+  0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000025, 0x00000000, 0x00000001, 0x00202020, 0x8000000f,
+  0x00ffffff, 0x00000002, 0x00fbfbfb, 0x000e0e0e, 0x8000000d, 0x00000000, 0x00000002, 0x00282828,
+  0x00fdfdfd, 0x80000008, 0x00ffffff, 0x00000001, 0x00bababa, 0x80000017, 0x00000000, 0x00000001,
+  0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x00b3b3b3, 0x8000000c, 0x00707070, 0x00000004, 0x007a7a7a, 0x009c9c9c,
+  0x00c0c0c0, 0x00f4f4f4, 0x80000011, 0x00ffffff, 0x00000001, 0x005c5c5c, 0x8000000b, 0x00000000,
+  0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00828282, 0x8000000a, 0x00707070,
+  0x00000001, 0x00545454, 0x80000007, 0x00000000, 0x00000002, 0x000c0c0c, 0x00eeeeee, 0x80000011,
+  0x00ffffff, 0x00000004, 0x00c7c7c7, 0x00595959, 0x001b1b1b, 0x00020202, 0x80000004, 0x00000000,
+  0x00000003, 0x00131313, 0x00666666, 0x00c3c3c3, 0x80000011, 0x00ffffff, 0x00000001, 0x00787878,
+  0x8000000c, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8,
+  0x80000025, 0x00000000, 0x00000001, 0x00686868, 0x8000000f, 0x00ffffff, 0x00000001, 0x00c5c5c5,
+  0x8000000e, 0x00000000, 0x00000001, 0x00a2a2a2, 0x80000009, 0x00ffffff, 0x00000001, 0x00333333,
+  0x80000017, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00505050,
+  0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x8000000f, 0x00000000,
+  0x00000002, 0x00191919, 0x00a4a4a4, 0x80000010, 0x00ffffff, 0x00000001, 0x00949494, 0x8000000b,
+  0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x80000012,
+  0x00000000, 0x00000001, 0x00747474, 0x80000010, 0x00ffffff, 0x00000002, 0x00bbbbbb, 0x00353535,
+  0x8000000b, 0x00000000, 0x00000002, 0x005e5e5e, 0x00f0f0f0, 0x8000000f, 0x00ffffff, 0x00000002,
+  0x00e1e1e1, 0x00020202, 0x8000000b, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff,
+  0x00000001, 0x00d8d8d8, 0x80000025, 0x00000000, 0x00000001, 0x00d0d0d0, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x007f7f7f, 0x8000000d, 0x00000000, 0x00000002, 0x00222222, 0x00fcfcfc, 0x80000008,
+  0x00ffffff, 0x00000001, 0x00c5c5c5, 0x80000018, 0x00000000, 0x00000001, 0x00505050, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00787878, 0x80000011, 0x00000000, 0x00000001, 0x008c8c8c, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00cdcdcd, 0x8000000b, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00202020, 0x80000011, 0x00000000, 0x00000002, 0x00070707, 0x00e6e6e6, 0x8000000f, 0x00ffffff,
+  0x00000002, 0x008b8b8b, 0x00030303, 0x8000000d, 0x00000000, 0x00000002, 0x00262626, 0x00e9e9e9,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x004c4c4c, 0x8000000b, 0x00000000, 0x00000001, 0x00b8b8b8,
+  0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000024, 0x00000000, 0x00000001, 0x00414141,
+  0x80000010, 0x00ffffff, 0x00000001, 0x003a3a3a, 0x8000000d, 0x00000000, 0x00000001, 0x009a9a9a,
+  0x80000009, 0x00ffffff, 0x00000001, 0x005c5c5c, 0x80000018, 0x00000000, 0x00000001, 0x00505050,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00787878, 0x80000011, 0x00000000, 0x00000002, 0x000b0b0b, 0x00e1e1e1, 0x8000000e,
+  0x00ffffff, 0x00000001, 0x00f1f1f1, 0x8000000b, 0x00000000, 0x00000001, 0x00505050, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x00202020, 0x80000011, 0x00000000, 0x00000001, 0x00686868, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x00616161, 0x80000010, 0x00000000, 0x00000002, 0x00313131, 0x00f4f4f4,
+  0x8000000e, 0x00ffffff, 0x00000001, 0x00b4b4b4, 0x8000000b, 0x00000000, 0x00000001, 0x00b8b8b8,
+  0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000024, 0x00000000, 0x00000001, 0x00b1b1b1,
+  0x8000000f, 0x00ffffff, 0x00000002, 0x00f1f1f1, 0x00040404, 0x8000000c, 0x00000000, 0x00000002,
+  0x001d1d1d, 0x00f9f9f9, 0x80000008, 0x00ffffff, 0x00000002, 0x00ebebeb, 0x00070707, 0x80000018,
+  0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d,
+  0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012, 0x00000000, 0x00000001,
+  0x00999999, 0x8000000e, 0x00ffffff, 0x00000002, 0x00fefefe, 0x00030303, 0x8000000a, 0x00000000,
+  0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x80000010, 0x00000000,
+  0x00000002, 0x00040404, 0x00dedede, 0x8000000e, 0x00ffffff, 0x00000001, 0x009f9f9f, 0x80000012,
+  0x00000000, 0x00000001, 0x008b8b8b, 0x8000000e, 0x00ffffff, 0x00000002, 0x00fdfdfd, 0x001f1f1f,
+  0x8000000a, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8,
+  0x80000023, 0x00000000, 0x00000002, 0x00242424, 0x00fdfdfd, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00afafaf, 0x8000000d, 0x00000000, 0x00000001, 0x00929292, 0x80000009, 0x00ffffff, 0x00000001,
+  0x00898989, 0x80000019, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012,
+  0x00000000, 0x00000001, 0x00757575, 0x8000000f, 0x00ffffff, 0x00000001, 0x00131313, 0x8000000a,
+  0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x80000010,
+  0x00000000, 0x00000001, 0x00414141, 0x8000000e, 0x00ffffff, 0x00000002, 0x00e3e3e3, 0x000f0f0f,
+  0x80000012, 0x00000000, 0x00000002, 0x00181818, 0x00f7f7f7, 0x8000000e, 0x00ffffff, 0x00000001,
+  0x007f7f7f, 0x8000000a, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001,
+  0x00d8d8d8, 0x80000023, 0x00000000, 0x00000001, 0x00929292, 0x80000010, 0x00ffffff, 0x00000001,
+  0x00585858, 0x8000000c, 0x00000000, 0x00000002, 0x00171717, 0x00f7f7f7, 0x80000008, 0x00ffffff,
+  0x00000002, 0x00fefefe, 0x00222222, 0x80000019, 0x00000000, 0x00000001, 0x00505050, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00787878, 0x80000012, 0x00000000, 0x00000001, 0x00595959, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x001f1f1f, 0x8000000a, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00202020, 0x80000010, 0x00000000, 0x00000001, 0x00838383, 0x8000000e, 0x00ffffff, 0x00000001,
+  0x00686868, 0x80000014, 0x00000000, 0x00000001, 0x00959595, 0x8000000e, 0x00ffffff, 0x00000001,
+  0x00bebebe, 0x8000000a, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001,
+  0x00d8d8d8, 0x80000022, 0x00000000, 0x00000002, 0x000f0f0f, 0x00f3f3f3, 0x8000000f, 0x00ffffff,
+  0x00000002, 0x00efefef, 0x00080808, 0x8000000c, 0x00000000, 0x00000001, 0x008a8a8a, 0x80000009,
+  0x00ffffff, 0x00000001, 0x00b7b7b7, 0x8000001a, 0x00000000, 0x00000001, 0x00505050, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00787878, 0x80000012, 0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00202020, 0x8000000a, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00202020, 0x80000010, 0x00000000, 0x00000001, 0x00c5c5c5, 0x8000000d, 0x00ffffff, 0x00000002,
+  0x00fbfbfb, 0x00141414, 0x80000014, 0x00000000, 0x00000002, 0x001f1f1f, 0x00fbfbfb, 0x8000000d,
+  0x00ffffff, 0x00000002, 0x00f3f3f3, 0x00030303, 0x80000009, 0x00000000, 0x00000001, 0x00b8b8b8,
+  0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000022, 0x00000000, 0x00000001, 0x00737373,
+  0x80000010, 0x00ffffff, 0x00000001, 0x00979797, 0x8000000c, 0x00000000, 0x00000002, 0x00131313,
+  0x00f3f3f3, 0x80000009, 0x00ffffff, 0x00000001, 0x004d4d4d, 0x8000001a, 0x00000000, 0x00000001,
+  0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x00787878, 0x80000012, 0x00000000, 0x00000001, 0x00585858, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x00202020, 0x8000000a, 0x00000000, 0x00000001, 0x00505050, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x00202020, 0x8000000f, 0x00000000, 0x00000002, 0x000c0c0c, 0x00fbfbfb,
+  0x8000000d, 0x00ffffff, 0x00000001, 0x00b9b9b9, 0x80000016, 0x00000000, 0x00000001, 0x00d0d0d0,
+  0x8000000e, 0x00ffffff, 0x00000001, 0x002e2e2e, 0x80000009, 0x00000000, 0x00000001, 0x00b8b8b8,
+  0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000021, 0x00000000, 0x00000002, 0x00121212,
+  0x00eaeaea, 0x80000010, 0x00ffffff, 0x00000001, 0x00373737, 0x8000000c, 0x00000000, 0x00000001,
+  0x00828282, 0x80000009, 0x00ffffff, 0x00000002, 0x00e6e6e6, 0x00030303, 0x8000001a, 0x00000000,
+  0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012, 0x00000000, 0x00000001, 0x00585858,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000a, 0x00000000, 0x00000001, 0x00505050,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000f, 0x00000000, 0x00000001, 0x004a4a4a,
+  0x8000000e, 0x00ffffff, 0x00000001, 0x00727272, 0x80000016, 0x00000000, 0x00000001, 0x00a8a8a8,
+  0x8000000e, 0x00ffffff, 0x00000001, 0x00666666, 0x80000009, 0x00000000, 0x00000001, 0x00b8b8b8,
+  0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000021, 0x00000000, 0x00000001, 0x009d9d9d,
+  0x80000010, 0x00ffffff, 0x00000001, 0x00d6d6d6, 0x8000000c, 0x00000000, 0x00000002, 0x00050505,
+  0x00ededed, 0x80000009, 0x00ffffff, 0x00000001, 0x009b9b9b, 0x8000001b, 0x00000000, 0x00000001,
+  0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x00787878, 0x80000012, 0x00000000, 0x00000001, 0x00585858, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x00202020, 0x8000000a, 0x00000000, 0x00000001, 0x00505050, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x00202020, 0x8000000f, 0x00000000, 0x00000001, 0x008c8c8c, 0x8000000e,
+  0x00ffffff, 0x00000001, 0x00525252, 0x80000016, 0x00000000, 0x00000001, 0x00818181, 0x8000000e,
+  0x00ffffff, 0x00000001, 0x009e9e9e, 0x80000009, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e,
+  0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000020, 0x00000000, 0x00000002, 0x003f3f3f, 0x00fefefe,
+  0x80000010, 0x00ffffff, 0x00000001, 0x00737373, 0x8000000c, 0x00000000, 0x00000001, 0x00464646,
+  0x8000000a, 0x00ffffff, 0x00000001, 0x00505050, 0x8000001b, 0x00000000, 0x00000001, 0x00505050,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00787878, 0x80000012, 0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00202020, 0x8000000a, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00202020, 0x8000000f, 0x00000000, 0x00000001, 0x00c2c2c2, 0x8000000e, 0x00ffffff,
+  0x00000001, 0x00353535, 0x80000016, 0x00000000, 0x00000001, 0x00595959, 0x8000000e, 0x00ffffff,
+  0x00000001, 0x00cfcfcf, 0x80000009, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff,
+  0x00000001, 0x00d8d8d8, 0x8000001f, 0x00000000, 0x00000002, 0x00060606, 0x00d7d7d7, 0x80000010,
+  0x00ffffff, 0x00000002, 0x00eeeeee, 0x000d0d0d, 0x8000000c, 0x00000000, 0x00000001, 0x00989898,
+  0x80000009, 0x00ffffff, 0x00000002, 0x00f9f9f9, 0x000c0c0c, 0x8000001b, 0x00000000, 0x00000001,
+  0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x00787878, 0x80000012, 0x00000000, 0x00000001, 0x00585858, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x00202020, 0x8000000a, 0x00000000, 0x00000001, 0x00505050, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x00202020, 0x8000000f, 0x00000000, 0x00000001, 0x00d8d8d8, 0x8000000e,
+  0x00ffffff, 0x00000001, 0x00545454, 0x80000016, 0x00404040, 0x00000001, 0x00696969, 0x8000000e,
+  0x00ffffff, 0x00000001, 0x00e3e3e3, 0x80000009, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e,
+  0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000001f, 0x00000000, 0x00000001, 0x007e7e7e, 0x80000011,
+  0x00ffffff, 0x00000001, 0x00818181, 0x8000000c, 0x00000000, 0x00000002, 0x00020202, 0x00e8e8e8,
+  0x80000009, 0x00ffffff, 0x00000001, 0x00bcbcbc, 0x8000001c, 0x00000000, 0x00000001, 0x00505050,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00787878, 0x80000012, 0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00202020, 0x8000000a, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00202020, 0x8000000f, 0x00000000, 0x00000001, 0x00ececec, 0x80000034, 0x00ffffff,
+  0x00000001, 0x00f5f5f5, 0x80000009, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff,
+  0x00000001, 0x00d8d8d8, 0x8000001e, 0x00000000, 0x00000002, 0x00262626, 0x00f8f8f8, 0x80000010,
+  0x00ffffff, 0x00000002, 0x00f3f3f3, 0x00131313, 0x8000000c, 0x00000000, 0x00000001, 0x003c3c3c,
+  0x8000000a, 0x00ffffff, 0x00000001, 0x00717171, 0x8000001c, 0x00000000, 0x00000001, 0x00505050,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00787878, 0x80000012, 0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00202020, 0x8000000a, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00202020, 0x8000000e, 0x00000000, 0x00000002, 0x00030303, 0x00fdfdfd, 0x80000035,
+  0x00ffffff, 0x00000001, 0x00070707, 0x80000008, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e,
+  0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000001e, 0x00000000, 0x00000001, 0x00bebebe, 0x80000011,
+  0x00ffffff, 0x00000001, 0x008c8c8c, 0x8000000d, 0x00000000, 0x00000001, 0x008e8e8e, 0x8000000a,
+  0x00ffffff, 0x00000001, 0x00272727, 0x8000001c, 0x00000000, 0x00000001, 0x00505050, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00787878, 0x80000012, 0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00202020, 0x8000000a, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00202020, 0x8000000e, 0x00000000, 0x00000001, 0x00151515, 0x80000036, 0x00ffffff, 0x00000001,
+  0x00181818, 0x80000008, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001,
+  0x00d8d8d8, 0x8000001d, 0x00000000, 0x00000001, 0x007b7b7b, 0x80000011, 0x00ffffff, 0x00000002,
+  0x00f8f8f8, 0x00191919, 0x8000000d, 0x00000000, 0x00000001, 0x00e0e0e0, 0x80000009, 0x00ffffff,
+  0x00000001, 0x00dcdcdc, 0x8000001d, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878,
+  0x80000012, 0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020,
+  0x8000000a, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020,
+  0x8000000e, 0x00000000, 0x00000001, 0x00292929, 0x80000036, 0x00ffffff, 0x00000001, 0x002a2a2a,
+  0x80000008, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8,
+  0x8000001c, 0x00000000, 0x00000002, 0x00545454, 0x00fefefe, 0x80000011, 0x00ffffff, 0x00000001,
+  0x00878787, 0x8000000d, 0x00000000, 0x00000001, 0x00323232, 0x8000000a, 0x00ffffff, 0x00000001,
+  0x00939393, 0x8000001d, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012,
+  0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000a,
+  0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000e,
+  0x00000000, 0x00000001, 0x003d3d3d, 0x80000036, 0x00ffffff, 0x00000001, 0x003b3b3b, 0x80000008,
+  0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000001b,
+  0x00000000, 0x00000002, 0x00343434, 0x00f6f6f6, 0x80000011, 0x00ffffff, 0x00000002, 0x00e2e2e2,
+  0x000a0a0a, 0x8000000d, 0x00000000, 0x00000001, 0x00848484, 0x8000000a, 0x00ffffff, 0x00000001,
+  0x005f5f5f, 0x8000001d, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012,
+  0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000a,
+  0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000e,
+  0x00000000, 0x00000001, 0x004a4a4a, 0x80000036, 0x00ffffff, 0x00000001, 0x00404040, 0x80000008,
+  0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000001a,
+  0x00000000, 0x00000002, 0x001c1c1c, 0x00e6e6e6, 0x80000012, 0x00ffffff, 0x00000001, 0x00525252,
+  0x8000000e, 0x00000000, 0x00000001, 0x00d6d6d6, 0x8000000a, 0x00ffffff, 0x00000001, 0x00343434,
+  0x8000001d, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00505050,
+  0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012, 0x00000000,
+  0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000a, 0x00000000,
+  0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000e, 0x00000000,
+  0x00000001, 0x003a3a3a, 0x80000036, 0x00ffffff, 0x00000001, 0x00404040, 0x80000008, 0x00000000,
+  0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000019, 0x00000000,
+  0x00000002, 0x000b0b0b, 0x00cecece, 0x80000012, 0x00ffffff, 0x00000001, 0x00b7b7b7, 0x8000000e,
+  0x00000000, 0x00000001, 0x00272727, 0x8000000a, 0x00ffffff, 0x00000002, 0x00fefefe, 0x000a0a0a,
+  0x8000001d, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00505050,
+  0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012, 0x00000000,
+  0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000a, 0x00000000,
+  0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000e, 0x00000000,
+  0x00000001, 0x00262626, 0x80000036, 0x00ffffff, 0x00000001, 0x00404040, 0x80000008, 0x00000000,
+  0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000018, 0x00000000,
+  0x00000002, 0x00020202, 0x00afafaf, 0x80000012, 0x00ffffff, 0x00000002, 0x00f8f8f8, 0x00242424,
+  0x8000000e, 0x00000000, 0x00000001, 0x005c5c5c, 0x8000000a, 0x00ffffff, 0x00000001, 0x00dddddd,
+  0x8000001e, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00505050,
+  0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012, 0x00000000,
+  0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000a, 0x00000000,
+  0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000e, 0x00000000,
+  0x00000001, 0x00131313, 0x80000036, 0x00ffffff, 0x00000001, 0x00404040, 0x80000008, 0x00000000,
+  0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000018, 0x00000000,
+  0x00000001, 0x00909090, 0x80000013, 0x00ffffff, 0x00000001, 0x00727272, 0x8000000f, 0x00000000,
+  0x00000001, 0x00838383, 0x8000000a, 0x00ffffff, 0x00000001, 0x00b2b2b2, 0x8000001e, 0x00000000,
+  0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012, 0x00000000, 0x00000001, 0x00585858,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000a, 0x00000000, 0x00000001, 0x00505050,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000e, 0x00000000, 0x00000002, 0x00020202,
+  0x00fdfdfd, 0x80000035, 0x00ffffff, 0x00000001, 0x00404040, 0x80000008, 0x00000000, 0x00000001,
+  0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000016, 0x00000000, 0x00000002,
+  0x00040404, 0x009f9f9f, 0x80000013, 0x00ffffff, 0x00000001, 0x00ababab, 0x80000010, 0x00000000,
+  0x00000001, 0x00aaaaaa, 0x8000000a, 0x00ffffff, 0x00000001, 0x00878787, 0x8000001e, 0x00000000,
+  0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012, 0x00000000, 0x00000001, 0x00585858,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000a, 0x00000000, 0x00000001, 0x00505050,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000f, 0x00000000, 0x00000001, 0x00ebebeb,
+  0x8000000e, 0x00ffffff, 0x00000001, 0x005e5e5e, 0x80000026, 0x00484848, 0x00000001, 0x00121212,
+  0x80000008, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8,
+  0x80000015, 0x00000000, 0x00000002, 0x000a0a0a, 0x00b5b5b5, 0x80000013, 0x00ffffff, 0x00000002,
+  0x00d7d7d7, 0x000d0d0d, 0x80000010, 0x00000000, 0x00000001, 0x00d1d1d1, 0x8000000a, 0x00ffffff,
+  0x00000001, 0x005b5b5b, 0x8000001e, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878,
+  0x80000012, 0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020,
+  0x8000000a, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020,
+  0x8000000f, 0x00000000, 0x00000001, 0x00d8d8d8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00434343,
+  0x8000002f, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8,
+  0x80000014, 0x00000000, 0x00000002, 0x00141414, 0x00c8c8c8, 0x80000013, 0x00ffffff, 0x00000002,
+  0x00f3f3f3, 0x00292929, 0x80000010, 0x00000000, 0x00000002, 0x00010101, 0x00f6f6f6, 0x8000000a,
+  0x00ffffff, 0x00000001, 0x00303030, 0x8000001e, 0x00000000, 0x00000001, 0x00505050, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00787878, 0x80000012, 0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00202020, 0x8000000a, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00202020, 0x8000000f, 0x00000000, 0x00000001, 0x00c4c4c4, 0x8000000e, 0x00ffffff, 0x00000001,
+  0x006e6e6e, 0x8000002f, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001,
+  0x00d8d8d8, 0x80000013, 0x00000000, 0x00000002, 0x00202020, 0x00d9d9d9, 0x80000014, 0x00ffffff,
+  0x00000001, 0x00565656, 0x80000011, 0x00000000, 0x00000001, 0x001f1f1f, 0x8000000b, 0x00ffffff,
+  0x00000001, 0x000e0e0e, 0x8000001e, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878,
+  0x80000012, 0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020,
+  0x8000000a, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020,
+  0x8000000f, 0x00000000, 0x00000001, 0x00ababab, 0x8000000e, 0x00ffffff, 0x00000001, 0x00989898,
+  0x8000002f, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8,
+  0x80000012, 0x00000000, 0x00000002, 0x002f2f2f, 0x00e6e6e6, 0x80000014, 0x00ffffff, 0x00000001,
+  0x008e8e8e, 0x80000012, 0x00000000, 0x00000001, 0x00464646, 0x8000000b, 0x00ffffff, 0x00000001,
+  0x00040404, 0x8000001e, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012,
+  0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000a,
+  0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000f,
+  0x00000000, 0x00000001, 0x006d6d6d, 0x8000000e, 0x00ffffff, 0x00000001, 0x00c2c2c2, 0x8000002f,
+  0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x80000011,
+  0x00000000, 0x00000002, 0x00515151, 0x00f1f1f1, 0x80000014, 0x00ffffff, 0x00000002, 0x00c2c2c2,
+  0x00040404, 0x80000012, 0x00000000, 0x00000001, 0x006d6d6d, 0x8000000a, 0x00ffffff, 0x00000001,
+  0x00fbfbfb, 0x8000001f, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012,
+  0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000a,
+  0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000f,
+  0x00000000, 0x00000001, 0x00282828, 0x8000000e, 0x00ffffff, 0x00000002, 0x00ededed, 0x00020202,
+  0x8000002e, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8,
+  0x8000000f, 0x00000000, 0x00000002, 0x000f0f0f, 0x00a0a0a0, 0x80000015, 0x00ffffff, 0x00000002,
+  0x00e7e7e7, 0x00191919, 0x80000013, 0x00000000, 0x00000001, 0x00949494, 0x8000000a, 0x00ffffff,
+  0x00000001, 0x00f1f1f1, 0x8000001f, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878,
+  0x80000012, 0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020,
+  0x8000000a, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020,
+  0x80000010, 0x00000000, 0x00000001, 0x00e3e3e3, 0x8000000e, 0x00ffffff, 0x00000001, 0x00515151,
+  0x8000002e, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8,
+  0x8000000e, 0x00000000, 0x00000002, 0x00434343, 0x00e2e2e2, 0x80000015, 0x00ffffff, 0x00000002,
+  0x00fbfbfb, 0x003d3d3d, 0x80000014, 0x00000000, 0x00000001, 0x00bbbbbb, 0x8000000a, 0x00ffffff,
+  0x00000001, 0x00e8e8e8, 0x8000001f, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878,
+  0x80000012, 0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020,
+  0x8000000a, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00232323,
+  0x80000010, 0x00000000, 0x00000001, 0x009f9f9f, 0x8000000e, 0x00ffffff, 0x00000001, 0x00c8c8c8,
+  0x8000002e, 0x00000000, 0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8,
+  0x8000000c, 0x00000000, 0x00000003, 0x00090909, 0x00919191, 0x00fefefe, 0x80000015, 0x00ffffff,
+  0x00000002, 0x00fefefe, 0x00686868, 0x80000015, 0x00000000, 0x00000001, 0x00e2e2e2, 0x8000000a,
+  0x00ffffff, 0x00000001, 0x00dfdfdf, 0x8000001f, 0x00000000, 0x00000001, 0x00505050, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00787878, 0x80000012, 0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00202020, 0x8000000a, 0x00000000, 0x00000001, 0x004d4d4d, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00404040, 0x80000010, 0x00000000, 0x00000001, 0x005a5a5a, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00616161, 0x80000018, 0x00000000, 0x00000002, 0x006d6d6d, 0x004c4c4c, 0x80000013, 0x00000000,
+  0x00000001, 0x00b8b8b8, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000000b, 0x00000000,
+  0x00000002, 0x00363636, 0x00d8d8d8, 0x80000016, 0x00ffffff, 0x00000002, 0x00fcfcfc, 0x00606060,
+  0x80000016, 0x00000000, 0x00000001, 0x00efefef, 0x8000000a, 0x00ffffff, 0x00000001, 0x00d6d6d6,
+  0x8000001f, 0x00000000, 0x00000001, 0x00505050, 0x8000000f, 0x00ffffff, 0x00000001, 0x00505050,
+  0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012, 0x00000000,
+  0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000a, 0x00000000,
+  0x00000001, 0x003c3c3c, 0x8000000f, 0x00ffffff, 0x00000001, 0x00626262, 0x80000010, 0x00000000,
+  0x00000002, 0x00161616, 0x00fefefe, 0x8000000e, 0x00ffffff, 0x00000002, 0x00f7f7f7, 0x00313131,
+  0x80000015, 0x00000000, 0x00000005, 0x00020202, 0x008e8e8e, 0x00ffffff, 0x00fafafa, 0x00555555,
+  0x80000012, 0x00000000, 0x00000001, 0x00a7a7a7, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8,
+  0x8000000a, 0x00000000, 0x00000002, 0x005f5f5f, 0x00fcfcfc, 0x80000016, 0x00ffffff, 0x00000002,
+  0x00f8f8f8, 0x00515151, 0x80000017, 0x00000000, 0x00000001, 0x00ededed, 0x8000000a, 0x00ffffff,
+  0x00000001, 0x00cccccc, 0x8000001f, 0x00000000, 0x00000001, 0x00474747, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878,
+  0x80000012, 0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020,
+  0x8000000a, 0x00000000, 0x00000001, 0x00282828, 0x8000000f, 0x00ffffff, 0x00000001, 0x00c3c3c3,
+  0x80000011, 0x00000000, 0x00000001, 0x00c0c0c0, 0x8000000f, 0x00ffffff, 0x00000002, 0x00e6e6e6,
+  0x00333333, 0x80000013, 0x00000000, 0x00000002, 0x000d0d0d, 0x00adadad, 0x80000003, 0x00ffffff,
+  0x00000002, 0x00fcfcfc, 0x005f5f5f, 0x80000011, 0x00000000, 0x00000001, 0x00858585, 0x8000000e,
+  0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000000a, 0x00000000, 0x00000001, 0x00909090, 0x80000016,
+  0x00ffffff, 0x00000002, 0x00f4f4f4, 0x00444444, 0x80000018, 0x00000000, 0x00000001, 0x00ececec,
+  0x8000000a, 0x00ffffff, 0x00000001, 0x00c3c3c3, 0x8000001f, 0x00000000, 0x00000001, 0x00272727,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00787878, 0x80000012, 0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff,
+  0x00000001, 0x00202020, 0x8000000a, 0x00000000, 0x00000001, 0x00131313, 0x80000010, 0x00ffffff,
+  0x00000001, 0x00626262, 0x80000010, 0x00000000, 0x00000001, 0x003f3f3f, 0x80000010, 0x00ffffff,
+  0x00000002, 0x00f5f5f5, 0x00555555, 0x80000011, 0x00000000, 0x00000002, 0x005c5c5c, 0x00e6e6e6,
+  0x80000005, 0x00ffffff, 0x00000002, 0x00fefefe, 0x006a6a6a, 0x80000010, 0x00000000, 0x00000001,
+  0x00636363, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000000a, 0x00000000, 0x00000001,
+  0x00909090, 0x80000015, 0x00ffffff, 0x00000002, 0x00eeeeee, 0x00373737, 0x80000019, 0x00000000,
+  0x00000001, 0x00eaeaea, 0x8000000a, 0x00ffffff, 0x00000001, 0x00d0d0d0, 0x8000001f, 0x00000000,
+  0x00000002, 0x00070707, 0x00fdfdfd, 0x8000000e, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d,
+  0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012, 0x00000000, 0x00000001,
+  0x00585858, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000b, 0x00000000, 0x00000001,
+  0x00e0e0e0, 0x80000010, 0x00ffffff, 0x00000003, 0x00acacac, 0x00404040, 0x00171717, 0x8000000e,
+  0x00000000, 0x00000001, 0x00bbbbbb, 0x80000011, 0x00ffffff, 0x00000002, 0x00c3c3c3, 0x003e3e3e,
+  0x8000000c, 0x00000000, 0x00000003, 0x000a0a0a, 0x004e4e4e, 0x00c4c4c4, 0x80000009, 0x00ffffff,
+  0x00000001, 0x00757575, 0x8000000f, 0x00000000, 0x00000001, 0x00414141, 0x8000000e, 0x00ffffff,
+  0x00000001, 0x00d8d8d8, 0x8000000a, 0x00000000, 0x00000001, 0x00909090, 0x80000014, 0x00ffffff,
+  0x00000002, 0x00e6e6e6, 0x002c2c2c, 0x8000001a, 0x00000000, 0x00000001, 0x00e9e9e9, 0x8000000a,
+  0x00ffffff, 0x00000001, 0x00ececec, 0x80000020, 0x00000000, 0x00000001, 0x00e2e2e2, 0x8000000e,
+  0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00787878, 0x80000012, 0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00202020, 0x8000000b, 0x00000000, 0x00000001, 0x00a1a1a1, 0x80000013, 0x00ffffff, 0x00000001,
+  0x00f4f4f4, 0x80000005, 0x00f0f0f0, 0x00000001, 0x00b4b4b4, 0x80000007, 0x00000000, 0x00000001,
+  0x00383838, 0x80000013, 0x00ffffff, 0x0000000d, 0x00dcdcdc, 0x00949494, 0x004e4e4e, 0x002e2e2e,
+  0x00191919, 0x00060606, 0x000e0e0e, 0x00212121, 0x00353535, 0x00484848, 0x006b6b6b, 0x00b5b5b5,
+  0x00f7f7f7, 0x8000000c, 0x00ffffff, 0x00000001, 0x00818181, 0x8000000e, 0x00000000, 0x00000001,
+  0x001f1f1f, 0x8000000e, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000000a, 0x00000000, 0x00000001,
+  0x00909090, 0x80000013, 0x00ffffff, 0x00000002, 0x00dedede, 0x00222222, 0x8000001b, 0x00000000,
+  0x00000001, 0x00e8e8e8, 0x8000000b, 0x00ffffff, 0x00000001, 0x00080808, 0x8000001f, 0x00000000,
+  0x00000001, 0x00c0c0c0, 0x8000000e, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012, 0x00000000, 0x00000001, 0x00585858,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000b, 0x00000000, 0x00000001, 0x00616161,
+  0x80000019, 0x00ffffff, 0x00000001, 0x00c0c0c0, 0x80000008, 0x00000000, 0x00000001, 0x00b4b4b4,
+  0x8000002c, 0x00ffffff, 0x00000001, 0x008d8d8d, 0x8000000d, 0x00000000, 0x00000002, 0x00020202,
+  0x00f9f9f9, 0x8000000d, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000000a, 0x00000000, 0x00000001,
+  0x00909090, 0x80000012, 0x00ffffff, 0x00000002, 0x00d4d4d4, 0x001a1a1a, 0x8000001c, 0x00000000,
+  0x00000001, 0x00e6e6e6, 0x8000000b, 0x00ffffff, 0x00000001, 0x00232323, 0x8000001f, 0x00000000,
+  0x00000001, 0x009e9e9e, 0x8000000e, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012, 0x00000000, 0x00000001, 0x00585858,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000b, 0x00000000, 0x00000002, 0x00101010,
+  0x00f3f3f3, 0x80000018, 0x00ffffff, 0x00000001, 0x00c0c0c0, 0x80000008, 0x00000000, 0x00000002,
+  0x00313131, 0x00fcfcfc, 0x8000002c, 0x00ffffff, 0x00000002, 0x00989898, 0x00010101, 0x8000000c,
+  0x00000000, 0x00000001, 0x00aeaeae, 0x8000000d, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000000a,
+  0x00000000, 0x00000001, 0x00909090, 0x80000011, 0x00ffffff, 0x00000002, 0x00b1b1b1, 0x00121212,
+  0x8000001d, 0x00000000, 0x00000001, 0x00e5e5e5, 0x8000000b, 0x00ffffff, 0x00000001, 0x003f3f3f,
+  0x8000001f, 0x00000000, 0x00000001, 0x00636363, 0x8000000e, 0x00ffffff, 0x00000001, 0x00505050,
+  0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012, 0x00000000,
+  0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000c, 0x00000000,
+  0x00000001, 0x00919191, 0x80000018, 0x00ffffff, 0x00000001, 0x00c0c0c0, 0x80000009, 0x00000000,
+  0x00000001, 0x006a6a6a, 0x8000002d, 0x00ffffff, 0x00000002, 0x00a2a2a2, 0x00030303, 0x8000000b,
+  0x00000000, 0x00000001, 0x00454545, 0x8000000d, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000000a,
+  0x00000000, 0x00000001, 0x00909090, 0x8000000f, 0x00ffffff, 0x00000002, 0x00f1f1f1, 0x00606060,
+  0x8000001f, 0x00000000, 0x00000001, 0x00e3e3e3, 0x8000000b, 0x00ffffff, 0x00000001, 0x005b5b5b,
+  0x8000001f, 0x00000000, 0x00000002, 0x000b0b0b, 0x00f1f1f1, 0x8000000d, 0x00ffffff, 0x00000001,
+  0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012,
+  0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000c,
+  0x00000000, 0x00000002, 0x00222222, 0x00fcfcfc, 0x80000017, 0x00ffffff, 0x00000001, 0x00c0c0c0,
+  0x8000000a, 0x00000000, 0x00000001, 0x008e8e8e, 0x8000002c, 0x00ffffff, 0x00000002, 0x00f1f1f1,
+  0x002f2f2f, 0x8000000b, 0x00000000, 0x00000002, 0x00010101, 0x00d2d2d2, 0x8000000c, 0x00ffffff,
+  0x00000001, 0x00d8d8d8, 0x8000000a, 0x00000000, 0x00000001, 0x00909090, 0x8000000e, 0x00ffffff,
+  0x00000002, 0x00bcbcbc, 0x001d1d1d, 0x80000020, 0x00000000, 0x00000001, 0x00e2e2e2, 0x8000000b,
+  0x00ffffff, 0x00000001, 0x00777777, 0x80000020, 0x00000000, 0x00000001, 0x00939393, 0x8000000d,
+  0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00787878, 0x80000012, 0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001,
+  0x00202020, 0x8000000d, 0x00000000, 0x00000001, 0x00808080, 0x80000017, 0x00ffffff, 0x00000001,
+  0x00c0c0c0, 0x8000000a, 0x00000000, 0x00000002, 0x00020202, 0x00afafaf, 0x8000002a, 0x00ffffff,
+  0x00000002, 0x00e1e1e1, 0x002c2c2c, 0x8000000d, 0x00000000, 0x00000002, 0x00353535, 0x00fcfcfc,
+  0x8000000b, 0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000000a, 0x00000000, 0x00000001, 0x00909090,
+  0x8000000c, 0x00ffffff, 0x00000003, 0x00f5f5f5, 0x006c6c6c, 0x00010101, 0x80000021, 0x00000000,
+  0x00000001, 0x00e1e1e1, 0x8000000b, 0x00ffffff, 0x00000001, 0x00939393, 0x80000020, 0x00000000,
+  0x00000002, 0x00131313, 0x00e7e7e7, 0x8000000c, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d,
+  0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012, 0x00000000, 0x00000001,
+  0x00585858, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000d, 0x00000000, 0x00000002,
+  0x00030303, 0x00c5c5c5, 0x80000016, 0x00ffffff, 0x00000001, 0x00c0c0c0, 0x8000000b, 0x00000000,
+  0x00000002, 0x000a0a0a, 0x00cacaca, 0x80000028, 0x00ffffff, 0x00000002, 0x00cbcbcb, 0x00181818,
+  0x8000000f, 0x00000000, 0x00000001, 0x00888888, 0x8000000b, 0x00ffffff, 0x00000001, 0x00d8d8d8,
+  0x8000000a, 0x00000000, 0x00000001, 0x00909090, 0x8000000b, 0x00ffffff, 0x00000002, 0x00c5c5c5,
+  0x00252525, 0x80000023, 0x00000000, 0x00000001, 0x00d8d8d8, 0x8000000b, 0x00ffffff, 0x00000001,
+  0x00b3b3b3, 0x80000021, 0x00000000, 0x00000001, 0x004d4d4d, 0x8000000c, 0x00ffffff, 0x00000001,
+  0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012,
+  0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000e,
+  0x00000000, 0x00000002, 0x00202020, 0x00e3e3e3, 0x80000015, 0x00ffffff, 0x00000001, 0x00c0c0c0,
+  0x8000000c, 0x00000000, 0x00000002, 0x00101010, 0x00acacac, 0x80000026, 0x00ffffff, 0x00000002,
+  0x00b0b0b0, 0x000a0a0a, 0x80000010, 0x00000000, 0x00000002, 0x00020202, 0x009a9a9a, 0x8000000a,
+  0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000000a, 0x00000000, 0x00000001, 0x00909090, 0x80000009,
+  0x00ffffff, 0x00000003, 0x00f9f9f9, 0x00777777, 0x00020202, 0x80000024, 0x00000000, 0x00000001,
+  0x00b1b1b1, 0x8000000b, 0x00ffffff, 0x00000002, 0x00efefef, 0x00030303, 0x80000021, 0x00000000,
+  0x00000001, 0x007c7c7c, 0x8000000b, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012, 0x00000000, 0x00000001, 0x00585858,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x8000000f, 0x00000000, 0x00000002, 0x001d1d1d,
+  0x00d5d5d5, 0x80000014, 0x00ffffff, 0x00000001, 0x00c0c0c0, 0x8000000e, 0x00000000, 0x00000002,
+  0x00686868, 0x00f7f7f7, 0x80000022, 0x00ffffff, 0x00000003, 0x00f5f5f5, 0x007b7b7b, 0x00020202,
+  0x80000013, 0x00000000, 0x00000001, 0x008b8b8b, 0x80000009, 0x00ffffff, 0x00000001, 0x00d8d8d8,
+  0x8000000a, 0x00000000, 0x00000001, 0x00909090, 0x80000008, 0x00ffffff, 0x00000002, 0x00bcbcbc,
+  0x002c2c2c, 0x80000026, 0x00000000, 0x00000001, 0x00888888, 0x8000000c, 0x00ffffff, 0x00000001,
+  0x00373737, 0x80000022, 0x00000000, 0x00000001, 0x00757575, 0x8000000a, 0x00ffffff, 0x00000001,
+  0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012,
+  0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x80000010,
+  0x00000000, 0x00000002, 0x00111111, 0x00bdbdbd, 0x80000013, 0x00ffffff, 0x00000001, 0x00c0c0c0,
+  0x8000000f, 0x00000000, 0x00000002, 0x002c2c2c, 0x00d5d5d5, 0x80000020, 0x00ffffff, 0x00000002,
+  0x00a8a8a8, 0x001d1d1d, 0x80000016, 0x00000000, 0x00000002, 0x00444444, 0x00dadada, 0x80000007,
+  0x00ffffff, 0x00000001, 0x00d8d8d8, 0x8000000a, 0x00000000, 0x00000001, 0x00909090, 0x80000005,
+  0x00ffffff, 0x00000003, 0x00fdfdfd, 0x00adadad, 0x00353535, 0x80000028, 0x00000000, 0x00000001,
+  0x005f5f5f, 0x8000000c, 0x00ffffff, 0x00000001, 0x007b7b7b, 0x80000023, 0x00000000, 0x00000002,
+  0x00515151, 0x00e1e1e1, 0x80000008, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012, 0x00000000, 0x00000001, 0x00585858,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x80000012, 0x00000000, 0x00000002, 0x00535353,
+  0x00dbdbdb, 0x80000011, 0x00ffffff, 0x00000001, 0x00c0c0c0, 0x80000010, 0x00000000, 0x00000003,
+  0x000a0a0a, 0x00737373, 0x00e0e0e0, 0x8000001c, 0x00ffffff, 0x00000002, 0x00cfcfcf, 0x003d3d3d,
+  0x80000019, 0x00000000, 0x00000003, 0x00070707, 0x00777777, 0x00dadada, 0x80000005, 0x00ffffff,
+  0x00000001, 0x00d8d8d8, 0x8000000a, 0x00000000, 0x00000001, 0x00909090, 0x80000003, 0x00ffffff,
+  0x00000003, 0x00fafafa, 0x009e9e9e, 0x00282828, 0x8000002a, 0x00000000, 0x00000001, 0x00353535,
+  0x8000000c, 0x00ffffff, 0x00000001, 0x00c0c0c0, 0x80000024, 0x00000000, 0x00000003, 0x000a0a0a,
+  0x00848484, 0x00f2f2f2, 0x80000006, 0x00ffffff, 0x00000001, 0x00505050, 0x8000000d, 0x00000000,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012, 0x00000000, 0x00000001, 0x00585858,
+  0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x80000013, 0x00000000, 0x00000004, 0x00050505,
+  0x00676767, 0x00bbbbbb, 0x00f9f9f9, 0x8000000e, 0x00ffffff, 0x00000001, 0x00c0c0c0, 0x80000012,
+  0x00000000, 0x00000003, 0x00030303, 0x00545454, 0x00c5c5c5, 0x80000017, 0x00ffffff, 0x00000004,
+  0x00f9f9f9, 0x00b7b7b7, 0x005f5f5f, 0x00020202, 0x8000001d, 0x00000000, 0x00000006, 0x00353535,
+  0x00909090, 0x00cccccc, 0x00f6f6f6, 0x00ffffff, 0x00d8d8d8, 0x8000000a, 0x00000000, 0x00000005,
+  0x00909090, 0x00ffffff, 0x00f4f4f4, 0x008f8f8f, 0x001c1c1c, 0x8000002c, 0x00000000, 0x00000001,
+  0x000d0d0d, 0x8000000c, 0x00ffffff, 0x00000002, 0x00f9f9f9, 0x000b0b0b, 0x80000025, 0x00000000,
+  0x00000004, 0x00090909, 0x00565656, 0x00b0b0b0, 0x00f9f9f9, 0x80000003, 0x00ffffff, 0x00000001,
+  0x00505050, 0x8000000d, 0x00000000, 0x8000000f, 0x00ffffff, 0x00000001, 0x00787878, 0x80000012,
+  0x00000000, 0x00000001, 0x00585858, 0x8000000f, 0x00ffffff, 0x00000001, 0x00202020, 0x80000016,
+  0x00000000, 0x00000007, 0x000c0c0c, 0x00515151, 0x008d8d8d, 0x00a6a6a6, 0x00bdbdbd, 0x00d5d5d5,
+  0x00ebebeb, 0x80000008, 0x00f0f0f0, 0x00000001, 0x00b4b4b4, 0x80000015, 0x00000000, 0x00000004,
+  0x00353535, 0x00868686, 0x00c3c3c3, 0x00f8f8f8, 0x80000010, 0x00ffffff, 0x00000004, 0x00f0f0f0,
+  0x00a7a7a7, 0x00575757, 0x000e0e0e, 0x80000023, 0x00000000, 0x00000003, 0x00020202, 0x00242424,
+  0x00414141, 0x8000000a, 0x00000000, 0x00000003, 0x007c7c7c, 0x00808080, 0x00131313, 0x8000002f,
+  0x00000000, 0x00000001, 0x00e3e3e3, 0x8000000c, 0x00ffffff, 0x00000001, 0x00494949, 0x80000028,
+  0x00000000, 0x00000005, 0x00060606, 0x002d2d2d, 0x00585858, 0x00848484, 0x00323232, 0x8000000d,
+  0x00000000, 0x8000000f, 0x00080808, 0x00000001, 0x00030303, 0x80000012, 0x00000000, 0x00000001,
+  0x00020202, 0x8000000f, 0x00080808, 0x00000001, 0x00010101, 0x8000003e, 0x00000000, 0x00000012,
+  0x00070707, 0x003c3c3c, 0x00797979, 0x00a6a6a6, 0x00b8b8b8, 0x00c9c9c9, 0x00dadada, 0x00ececec,
+  0x00fbfbfb, 0x00ececec, 0x00d6d6d6, 0x00c0c0c0, 0x00aaaaaa, 0x00959595, 0x007f7f7f, 0x00696969,
+  0x00444444, 0x00050505, 0x80000065, 0x00000000, 0x00000001, 0x00bababa, 0x8000000c, 0x00ffffff,
+  0x00000001, 0x008d8d8d, 0x80000122, 0x00000000, 0x00000001, 0x00919191, 0x8000000c, 0x00ffffff,
+  0x00000001, 0x00d3d3d3, 0x80000122, 0x00000000, 0x00000001, 0x00676767, 0x8000000d, 0x00ffffff,
+  0x00000001, 0x00383838, 0x80000121, 0x00000000, 0x00000001, 0x003e3e3e, 0x8000000d, 0x00ffffff,
+  0x00000001, 0x00aeaeae, 0x80000121, 0x00000000, 0x00000001, 0x00151515, 0x8000000d, 0x00ffffff,
+  0x00000002, 0x00fdfdfd, 0x00262626, 0x80000121, 0x00000000, 0x00000001, 0x00e5e5e5, 0x8000000d,
+  0x00ffffff, 0x00000001, 0x009a9a9a, 0x80000121, 0x00000000, 0x00000001, 0x00989898, 0x8000000d,
+  0x00ffffff, 0x00000002, 0x00f8f8f8, 0x00171717, 0x80000120, 0x00000000, 0x00000001, 0x00494949,
+  0x8000000e, 0x00ffffff, 0x00000001, 0x00858585, 0x80000120, 0x00000000, 0x00000002, 0x00060606,
+  0x00f2f2f2, 0x8000000d, 0x00ffffff, 0x00000002, 0x00eeeeee, 0x000c0c0c, 0x80000120, 0x00000000,
+  0x00000001, 0x00a9a9a9, 0x8000000e, 0x00ffffff, 0x00000001, 0x00828282, 0x80000120, 0x00000000,
+  0x00000001, 0x00595959, 0x8000000e, 0x00ffffff, 0x00000002, 0x00fbfbfb, 0x00343434, 0x800000e5,
+  0x00000000, 0x00000001, 0x00030303, 0x80000039, 0x00000000, 0x00000002, 0x000f0f0f, 0x00fafafa,
+  0x8000000e, 0x00ffffff, 0x00000002, 0x00d6d6d6, 0x00080808, 0x800000e2, 0x00000000, 0x00000003,
+  0x000c0c0c, 0x00808080, 0x009b9b9b, 0x8000003a, 0x00000000, 0x00000001, 0x00bababa, 0x8000000f,
+  0x00ffffff, 0x00000001, 0x008d8d8d, 0x800000e0, 0x00000000, 0x00000005, 0x00050505, 0x006c6c6c,
+  0x00e9e9e9, 0x00ffffff, 0x00a8a8a8, 0x8000003a, 0x00000000, 0x00000001, 0x00585858, 0x8000000f,
+  0x00ffffff, 0x00000002, 0x00fdfdfd, 0x003e3e3e, 0x800000dd, 0x00000000, 0x00000003, 0x00010101,
+  0x00585858, 0x00dcdcdc, 0x80000003, 0x00ffffff, 0x00000001, 0x00a8a8a8, 0x8000003a, 0x00000000,
+  0x00000002, 0x00030303, 0x00dedede, 0x8000000f, 0x00ffffff, 0x00000002, 0x00dedede, 0x000c0c0c,
+  0x800000db, 0x00000000, 0x00000002, 0x00434343, 0x00cccccc, 0x80000005, 0x00ffffff, 0x00000001,
+  0x00a8a8a8, 0x8000003b, 0x00000000, 0x00000001, 0x006b6b6b, 0x80000010, 0x00ffffff, 0x00000001,
+  0x009a9a9a, 0x800000d9, 0x00000000, 0x00000002, 0x00313131, 0x00b9b9b9, 0x80000007, 0x00ffffff,
+  0x00000001, 0x00a8a8a8, 0x8000003b, 0x00000000, 0x00000002, 0x00090909, 0x00eaeaea, 0x80000010,
+  0x00ffffff, 0x00000001, 0x00757575, 0x800000d6, 0x00000000, 0x00000003, 0x00272727, 0x00a5a5a5,
+  0x00fefefe, 0x80000008, 0x00ffffff, 0x00000001, 0x00a8a8a8, 0x8000003c, 0x00000000, 0x00000001,
+  0x007e7e7e, 0x80000011, 0x00ffffff, 0x00000001, 0x00676767, 0x800000d3, 0x00000000, 0x00000003,
+  0x003c3c3c, 0x00b0b0b0, 0x00fefefe, 0x8000000a, 0x00ffffff, 0x00000001, 0x00a8a8a8, 0x8000003c,
+  0x00000000, 0x00000002, 0x00121212, 0x00f4f4f4, 0x80000010, 0x00ffffff, 0x00000002, 0x00fdfdfd,
+  0x00595959, 0x800000cf, 0x00000000, 0x00000003, 0x00020202, 0x00535353, 0x00c7c7c7, 0x8000000d,
+  0x00ffffff, 0x00000001, 0x00a8a8a8, 0x8000003d, 0x00000000, 0x00000001, 0x00909090, 0x80000011,
+  0x00ffffff, 0x00000002, 0x00fbfbfb, 0x004d4d4d, 0x800000cc, 0x00000000, 0x00000003, 0x000a0a0a,
+  0x006a6a6a, 0x00dcdcdc, 0x8000000f, 0x00ffffff, 0x00000001, 0x00a8a8a8, 0x8000003d, 0x00000000,
+  0x00000002, 0x001b1b1b, 0x00f2f2f2, 0x80000011, 0x00ffffff, 0x00000002, 0x00f7f7f7, 0x00414141,
+  0x800000c9, 0x00000000, 0x00000003, 0x00161616, 0x00828282, 0x00ececec, 0x80000011, 0x00ffffff,
+  0x00000001, 0x00a8a8a8, 0x8000003e, 0x00000000, 0x00000001, 0x006a6a6a, 0x80000012, 0x00ffffff,
+  0x00000002, 0x00f3f3f3, 0x003b3b3b, 0x800000c6, 0x00000000, 0x00000003, 0x00272727, 0x00999999,
+  0x00f7f7f7, 0x80000013, 0x00ffffff, 0x00000001, 0x00a8a8a8, 0x8000003e, 0x00000000, 0x00000002,
+  0x00010101, 0x00c4c4c4, 0x80000012, 0x00ffffff, 0x00000002, 0x00f9f9f9, 0x00676767, 0x800000c2,
+  0x00000000, 0x00000004, 0x00070707, 0x00565656, 0x00b8b8b8, 0x00fefefe, 0x80000015, 0x00ffffff,
+  0x00000001, 0x00a8a8a8, 0x8000003f, 0x00000000, 0x00000002, 0x00292929, 0x00f8f8f8, 0x80000013,
+  0x00ffffff, 0x00000002, 0x009d9d9d, 0x00070707, 0x800000be, 0x00000000, 0x00000003, 0x00313131,
+  0x00939393, 0x00ededed, 0x80000018, 0x00ffffff, 0x00000001, 0x00a8a8a8, 0x80000040, 0x00000000,
+  0x00000001, 0x007d7d7d, 0x80000014, 0x00ffffff, 0x00000002, 0x00cbcbcb, 0x001d1d1d, 0x800000ba,
+  0x00000000, 0x00000003, 0x00121212, 0x006d6d6d, 0x00cfcfcf, 0x8000001b, 0x00ffffff, 0x00000001,
+  0x00a8a8a8, 0x80000040, 0x00000000, 0x00000002, 0x00050505, 0x00d3d3d3, 0x80000014, 0x00ffffff,
+  0x00000002, 0x00eaeaea, 0x00424242, 0x800000b6, 0x00000000, 0x00000004, 0x00020202, 0x00484848,
+  0x00aaaaaa, 0x00f9f9f9, 0x8000001d, 0x00ffffff, 0x00000001, 0x00a8a8a8, 0x80000041, 0x00000000,
+  0x00000002, 0x00373737, 0x00fdfdfd, 0x80000014, 0x00ffffff, 0x00000003, 0x00fcfcfc, 0x00767676,
+  0x00020202, 0x800000b2, 0x00000000, 0x00000003, 0x00242424, 0x00848484, 0x00e3e3e3, 0x80000020,
+  0x00ffffff, 0x00000001, 0x00a8a8a8, 0x80000042, 0x00000000, 0x00000001, 0x00757575, 0x80000016,
+  0x00ffffff, 0x00000002, 0x00cccccc, 0x00363636, 0x800000ae, 0x00000000, 0x00000003, 0x001f1f1f,
+  0x00727272, 0x00c6c6c6, 0x80000023, 0x00ffffff, 0x00000001, 0x00a8a8a8, 0x80000043, 0x00000000,
+  0x00000001, 0x009c9c9c, 0x80000016, 0x00ffffff, 0x00000003, 0x00fefefe, 0x009a9a9a, 0x00131313,
+  0x800000a9, 0x00000000, 0x00000003, 0x00242424, 0x00777777, 0x00cbcbcb, 0x80000026, 0x00ffffff,
+  0x00000001, 0x00a8a8a8, 0x80000043, 0x00000000, 0x00000002, 0x00050505, 0x00bebebe, 0x80000017,
+  0x00ffffff, 0x00000003, 0x00ececec, 0x00656565, 0x00010101, 0x800000a4, 0x00000000, 0x00000003,
+  0x00292929, 0x007c7c7c, 0x00d0d0d0, 0x80000029, 0x00ffffff, 0x00000001, 0x00a8a8a8, 0x80000044,
+  0x00000000, 0x00000002, 0x00121212, 0x00dadada, 0x80000018, 0x00ffffff, 0x00000002, 0x00c9c9c9,
+  0x00333333, 0x800000a0, 0x00000000, 0x00000003, 0x002e2e2e, 0x00818181, 0x00d5d5d5, 0x8000002c,
+  0x00ffffff, 0x00000001, 0x00a8a8a8, 0x80000045, 0x00000000, 0x00000002, 0x00252525, 0x00ededed,
+  0x80000018, 0x00ffffff, 0x00000003, 0x00fdfdfd, 0x00a9a9a9, 0x00343434, 0x8000009a, 0x00000000,
+  0x00000004, 0x00030303, 0x00393939, 0x00878787, 0x00dadada, 0x8000002f, 0x00ffffff, 0x00000001,
+  0x00a8a8a8, 0x80000046, 0x00000000, 0x00000002, 0x00404040, 0x00fafafa, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00bfbfbf, 0x004a4a4a, 0x00010101, 0x80000094, 0x00000000, 0x00000004, 0x001f1f1f,
+  0x00656565, 0x00acacac, 0x00efefef, 0x80000032, 0x00ffffff, 0x00000001, 0x00a8a8a8, 0x80000047,
+  0x00000000, 0x00000002, 0x00565656, 0x00fafafa, 0x8000001b, 0x00ffffff, 0x00000003, 0x00d4d4d4,
+  0x00606060, 0x00060606, 0x8000008e, 0x00000000, 0x00000004, 0x000b0b0b, 0x004c4c4c, 0x00929292,
+  0x00d9d9d9, 0x80000036, 0x00ffffff, 0x00000001, 0x00898989, 0x80000048, 0x00000000, 0x00000002,
+  0x00494949, 0x00f5f5f5, 0x8000001c, 0x00ffffff, 0x00000003, 0x00e5e5e5, 0x00767676, 0x00141414,
+  0x80000088, 0x00000000, 0x00000005, 0x00010101, 0x00323232, 0x00787878, 0x00bfbfbf, 0x00f9f9f9,
+  0x80000037, 0x00ffffff, 0x00000002, 0x00bcbcbc, 0x003c3c3c, 0x8000004a, 0x00000000, 0x00000002,
+  0x003b3b3b, 0x00efefef, 0x8000001d, 0x00ffffff, 0x00000004, 0x00fbfbfb, 0x00b5b5b5, 0x005b5b5b,
+  0x000b0b0b, 0x80000082, 0x00000000, 0x00000004, 0x00262626, 0x00616161, 0x00a5a5a5, 0x00eaeaea,
+  0x80000039, 0x00ffffff, 0x00000002, 0x00bcbcbc, 0x003c3c3c, 0x8000004d, 0x00000000, 0x00000002,
+  0x002f2f2f, 0x00e8e8e8, 0x8000001f, 0x00ffffff, 0x00000004, 0x00f5f5f5, 0x00a7a7a7, 0x004c4c4c,
+  0x00050505, 0x8000007a, 0x00000000, 0x00000005, 0x000a0a0a, 0x003f3f3f, 0x00797979, 0x00b2b2b2,
+  0x00ececec, 0x8000003b, 0x00ffffff, 0x00000002, 0x00bcbcbc, 0x003c3c3c, 0x80000050, 0x00000000,
+  0x00000002, 0x00242424, 0x00dfdfdf, 0x80000021, 0x00ffffff, 0x00000004, 0x00ededed, 0x00989898,
+  0x003f3f3f, 0x00040404, 0x80000073, 0x00000000, 0x00000005, 0x001d1d1d, 0x00575757, 0x00919191,
+  0x00cbcbcb, 0x00fbfbfb, 0x8000003d, 0x00ffffff, 0x00000002, 0x00bcbcbc, 0x003c3c3c, 0x80000053,
+  0x00000000, 0x00000002, 0x001b1b1b, 0x00d5d5d5, 0x80000023, 0x00ffffff, 0x00000005, 0x00f3f3f3,
+  0x00b6b6b6, 0x00737373, 0x00313131, 0x00020202, 0x8000006a, 0x00000000, 0x00000005, 0x00070707,
+  0x00353535, 0x006f6f6f, 0x00a9a9a9, 0x00e3e3e3, 0x80000040, 0x00ffffff, 0x00000002, 0x00bcbcbc,
+  0x003c3c3c, 0x80000056, 0x00000000, 0x00000002, 0x000e0e0e, 0x00a7a7a7, 0x80000026, 0x00ffffff,
+  0x00000004, 0x00ededed, 0x00adadad, 0x006b6b6b, 0x00292929, 0x80000061, 0x00000000, 0x00000007,
+  0x00010101, 0x00222222, 0x004f4f4f, 0x007c7c7c, 0x00a9a9a9, 0x00d6d6d6, 0x00fcfcfc, 0x80000041,
+  0x00ffffff, 0x00000003, 0x00fcfcfc, 0x00aeaeae, 0x003b3b3b, 0x8000005a, 0x00000000, 0x00000002,
+  0x00626262, 0x00f5f5f5, 0x80000028, 0x00ffffff, 0x00000005, 0x00e6e6e6, 0x00adadad, 0x007c7c7c,
+  0x004b4b4b, 0x001a1a1a, 0x80000057, 0x00000000, 0x00000006, 0x00151515, 0x00424242, 0x006f6f6f,
+  0x009c9c9c, 0x00c9c9c9, 0x00f4f4f4, 0x80000045, 0x00ffffff, 0x00000003, 0x00e9e9e9, 0x00848484,
+  0x001d1d1d, 0x8000005d, 0x00000000, 0x00000002, 0x00282828, 0x00d1d1d1, 0x8000002c, 0x00ffffff,
+  0x00000006, 0x00e9e9e9, 0x00b8b8b8, 0x00878787, 0x00565656, 0x00252525, 0x00010101, 0x8000004a,
+  0x00000000, 0x00000007, 0x00131313, 0x00323232, 0x00525252, 0x00717171, 0x00919191, 0x00bbbbbb,
+  0x00e8e8e8, 0x80000049, 0x00ffffff, 0x00000003, 0x00c6c6c6, 0x005a5a5a, 0x00060606, 0x80000060,
+  0x00000000, 0x00000002, 0x00080808, 0x00949494, 0x80000030, 0x00ffffff, 0x00000008, 0x00f3f3f3,
+  0x00cfcfcf, 0x00aeaeae, 0x008d8d8d, 0x006c6c6c, 0x004b4b4b, 0x002a2a2a, 0x000a0a0a, 0x8000003a,
+  0x00000000, 0x00000009, 0x00010101, 0x00171717, 0x00373737, 0x00565656, 0x00767676, 0x00959595,
+  0x00b5b5b5, 0x00d4d4d4, 0x00f3f3f3, 0x8000004d, 0x00ffffff, 0x00000003, 0x00f6f6f6, 0x009c9c9c,
+  0x00313131, 0x80000065, 0x00000000, 0x00000002, 0x00505050, 0x00ededed, 0x80000036, 0x00ffffff,
+  0x0000000b, 0x00e9e9e9, 0x00c8c8c8, 0x00a7a7a7, 0x008d8d8d, 0x00797979, 0x00666666, 0x00525252,
+  0x003f3f3f, 0x002b2b2b, 0x00171717, 0x00040404, 0x80000020, 0x00000000, 0x00000010, 0x00040404,
+  0x00131313, 0x00232323, 0x00323232, 0x00424242, 0x00515151, 0x00616161, 0x00707070, 0x007f7f7f,
+  0x008f8f8f, 0x009e9e9e, 0x00aeaeae, 0x00bdbdbd, 0x00cdcdcd, 0x00dddddd, 0x00f7f7f7, 0x80000053,
+  0x00ffffff, 0x00000003, 0x00dcdcdc, 0x00727272, 0x00111111, 0x80000068, 0x00000000, 0x00000002,
+  0x001a1a1a, 0x00a6a6a6, 0x80000040, 0x00ffffff, 0x00000020, 0x00f0f0f0, 0x00dcdcdc, 0x00cacaca,
+  0x00c5c5c5, 0x00c2c2c2, 0x00bfbfbf, 0x00bcbcbc, 0x00b9b9b9, 0x00b6b6b6, 0x00b3b3b3, 0x00b0b0b0,
+  0x00adadad, 0x00aaaaaa, 0x00a8a8a8, 0x00a5a5a5, 0x00a2a2a2, 0x009f9f9f, 0x009c9c9c, 0x00999999,
+  0x00969696, 0x00939393, 0x00909090, 0x008d8d8d, 0x008a8a8a, 0x008a8a8a, 0x00989898, 0x00a7a7a7,
+  0x00b7b7b7, 0x00c6c6c6, 0x00d6d6d6, 0x00e5e5e5, 0x00f5f5f5, 0x80000060, 0x00ffffff, 0x00000004,
+  0x00f9f9f9, 0x00b0b0b0, 0x00484848, 0x00010101, 0x8000006c, 0x00000000, 0x00000002, 0x003d3d3d,
+  0x00cfcfcf, 0x800000bb, 0x00ffffff, 0x00000004, 0x00fefefe, 0x00c0c0c0, 0x00656565, 0x00111111,
+  0x80000070, 0x00000000, 0x00000003, 0x00020202, 0x00686868, 0x00ececec, 0x800000b7, 0x00ffffff,
+  0x00000003, 0x00cfcfcf, 0x00757575, 0x001c1c1c, 0x80000075, 0x00000000, 0x00000003, 0x00121212,
+  0x00949494, 0x00fcfcfc, 0x800000b2, 0x00ffffff, 0x00000003, 0x00dddddd, 0x00848484, 0x00292929,
+  0x8000007a, 0x00000000, 0x00000002, 0x002e2e2e, 0x00bebebe, 0x800000ae, 0x00ffffff, 0x00000003,
+  0x00e9e9e9, 0x00939393, 0x00393939, 0x8000007f, 0x00000000, 0x00000003, 0x003c3c3c, 0x00b3b3b3,
+  0x00fefefe, 0x800000a8, 0x00ffffff, 0x00000004, 0x00dfdfdf, 0x00939393, 0x00454545, 0x00040404,
+  0x80000083, 0x00000000, 0x00000003, 0x002b2b2b, 0x00a1a1a1, 0x00fafafa, 0x800000a2, 0x00ffffff,
+  0x00000004, 0x00fdfdfd, 0x00c4c4c4, 0x00787878, 0x002b2b2b, 0x80000089, 0x00000000, 0x00000003,
+  0x001d1d1d, 0x008e8e8e, 0x00f3f3f3, 0x8000009d, 0x00ffffff, 0x00000004, 0x00f0f0f0, 0x00a9a9a9,
+  0x005d5d5d, 0x00131313, 0x8000008e, 0x00000000, 0x00000003, 0x00111111, 0x007c7c7c, 0x00eaeaea,
+  0x80000098, 0x00ffffff, 0x00000004, 0x00dadada, 0x008e8e8e, 0x00414141, 0x00050505, 0x80000093,
+  0x00000000, 0x00000004, 0x00060606, 0x00505050, 0x00adadad, 0x00f9f9f9, 0x80000091, 0x00ffffff,
+  0x00000004, 0x00eaeaea, 0x00ababab, 0x006b6b6b, 0x00262626, 0x8000009a, 0x00000000, 0x00000003,
+  0x00111111, 0x00686868, 0x00c5c5c5, 0x8000008b, 0x00ffffff, 0x00000005, 0x00eaeaea, 0x00ababab,
+  0x006b6b6b, 0x002b2b2b, 0x00010101, 0x800000a0, 0x00000000, 0x00000003, 0x00232323, 0x00808080,
+  0x00dcdcdc, 0x80000084, 0x00ffffff, 0x00000004, 0x00e9e9e9, 0x00aaaaaa, 0x006a6a6a, 0x002a2a2a,
+  0x800000a8, 0x00000000, 0x00000003, 0x003a3a3a, 0x00909090, 0x00d8d8d8, 0x8000007d, 0x00ffffff,
+  0x00000004, 0x00e0e0e0, 0x00a9a9a9, 0x006a6a6a, 0x002a2a2a, 0x800000af, 0x00000000, 0x00000004,
+  0x00202020, 0x00686868, 0x00b0b0b0, 0x00f2f2f2, 0x80000074, 0x00ffffff, 0x00000005, 0x00eaeaea,
+  0x00b5b5b5, 0x00808080, 0x004a4a4a, 0x00151515, 0x800000b6, 0x00000000, 0x00000005, 0x00050505,
+  0x003f3f3f, 0x00878787, 0x00cfcfcf, 0x00fefefe, 0x8000006b, 0x00ffffff, 0x00000005, 0x00f3f3f3,
+  0x00c0c0c0, 0x008a8a8a, 0x00555555, 0x00202020, 0x800000bf, 0x00000000, 0x00000005, 0x00181818,
+  0x005d5d5d, 0x00959595, 0x00c9c9c9, 0x00f8f8f8, 0x80000062, 0x00ffffff, 0x00000006, 0x00e5e5e5,
+  0x00bbbbbb, 0x00919191, 0x00606060, 0x002b2b2b, 0x00020202, 0x800000c7, 0x00000000, 0x00000006,
+  0x00050505, 0x00313131, 0x00656565, 0x00989898, 0x00cccccc, 0x00f9f9f9, 0x80000056, 0x00ffffff,
+  0x00000007, 0x00fefefe, 0x00e1e1e1, 0x00b7b7b7, 0x008d8d8d, 0x00636363, 0x00393939, 0x000f0f0f,
+  0x800000d2, 0x00000000, 0x00000006, 0x00060606, 0x00343434, 0x00686868, 0x009c9c9c, 0x00c5c5c5,
+  0x00e9e9e9, 0x8000004b, 0x00ffffff, 0x00000007, 0x00eeeeee, 0x00cfcfcf, 0x00b0b0b0, 0x00898989,
+  0x005f5f5f, 0x00353535, 0x000c0c0c, 0x800000de, 0x00000000, 0x00000008, 0x000c0c0c, 0x002f2f2f,
+  0x00525252, 0x00757575, 0x00989898, 0x00bcbcbc, 0x00dfdfdf, 0x00fcfcfc, 0x8000003a, 0x00ffffff,
+  0x00000009, 0x00fdfdfd, 0x00e4e4e4, 0x00c5c5c5, 0x00a7a7a7, 0x00888888, 0x00696969, 0x004a4a4a,
+  0x002b2b2b, 0x000d0d0d, 0x800000ec, 0x00000000, 0x0000000c, 0x00050505, 0x00252525, 0x00484848,
+  0x00636363, 0x00777777, 0x008b8b8b, 0x009f9f9f, 0x00b3b3b3, 0x00c7c7c7, 0x00dbdbdb, 0x00efefef,
+  0x00fefefe, 0x80000023, 0x00ffffff, 0x0000000d, 0x00f8f8f8, 0x00e5e5e5, 0x00d2d2d2, 0x00bebebe,
+  0x00ababab, 0x00989898, 0x00848484, 0x00717171, 0x005e5e5e, 0x004b4b4b, 0x00373737, 0x00212121,
+  0x00050505, 0x800000ff, 0x00000000, 0x00000024, 0x00040404, 0x00171717, 0x002b2b2b, 0x003f3f3f,
+  0x00535353, 0x005c5c5c, 0x00626262, 0x00686868, 0x006e6e6e, 0x00747474, 0x007a7a7a, 0x00808080,
+  0x00868686, 0x008c8c8c, 0x00919191, 0x00979797, 0x009d9d9d, 0x00a3a3a3, 0x00a5a5a5, 0x009f9f9f,
+  0x00989898, 0x00919191, 0x008b8b8b, 0x00848484, 0x007d7d7d, 0x00767676, 0x006f6f6f, 0x00696969,
+  0x00626262, 0x005b5b5b, 0x00545454, 0x004e4e4e, 0x00454545, 0x00323232, 0x001f1f1f, 0x000c0c0c,
+  0x800001d7, 0x00000000, 0x80000369, 0x00000000, 0x00000015, 0x00010101, 0x00030303, 0x00040404,
+  0x00060606, 0x00060606, 0x00090909, 0x00090909, 0x000c0c0c, 0x000c0c0c, 0x000e0e0e, 0x00101010,
+  0x00111111, 0x00131313, 0x00141414, 0x00161616, 0x00161616, 0x00191919, 0x001a1a1a, 0x001b1b1b,
+  0x001d1d1d, 0x001e1e1e, 0x80000004, 0x00202020, 0x00000021, 0x001f1f1f, 0x001f1f1f, 0x001e1e1e,
+  0x001d1d1d, 0x001c1c1c, 0x001b1b1b, 0x001b1b1b, 0x001a1a1a, 0x00191919, 0x00181818, 0x00181818,
+  0x00171717, 0x00161616, 0x00151515, 0x00141414, 0x00141414, 0x00131313, 0x00131313, 0x00121212,
+  0x00111111, 0x00101010, 0x000f0f0f, 0x000f0f0f, 0x000e0e0e, 0x000d0d0d, 0x000c0c0c, 0x000c0c0c,
+  0x000b0b0b, 0x000a0a0a, 0x00080808, 0x00050505, 0x00030303, 0x00010101, 0x800001e8, 0x00000000,
+  0x0000003b, 0x00020202, 0x00060606, 0x000d0d0d, 0x00131313, 0x001c1c1c, 0x00202020, 0x002c2c2c,
+  0x002f2f2f, 0x003a3a3a, 0x003f3f3f, 0x00484848, 0x004f4f4f, 0x00555555, 0x005e5e5e, 0x00626262,
+  0x006e6e6e, 0x00717171, 0x007c7c7c, 0x00808080, 0x00898989, 0x00909090, 0x00979797, 0x00a0a0a0,
+  0x00a3a3a3, 0x00a3a3a3, 0x00a2a2a2, 0x009c9c9c, 0x009a9a9a, 0x00959595, 0x00919191, 0x008e8e8e,
+  0x00898989, 0x00878787, 0x00808080, 0x007f7f7f, 0x007a7a7a, 0x00787878, 0x00737373, 0x006f6f6f,
+  0x006c6c6c, 0x00676767, 0x00656565, 0x005e5e5e, 0x005d5d5d, 0x00585858, 0x00565656, 0x00515151,
+  0x004d4d4d, 0x004a4a4a, 0x00454545, 0x00434343, 0x003c3c3c, 0x003b3b3b, 0x00353535, 0x00313131,
+  0x002a2a2a, 0x001b1b1b, 0x000f0f0f, 0x00040404, 0x800001d4, 0x00000000, 0x0000005f, 0x00010101,
+  0x00080808, 0x000c0c0c, 0x00151515, 0x001b1b1b, 0x00222222, 0x002b2b2b, 0x002f2f2f, 0x003a3a3a,
+  0x003d3d3d, 0x00484848, 0x004a4a4a, 0x004e4e4e, 0x00515151, 0x00535353, 0x00575757, 0x00585858,
+  0x005d5d5d, 0x005e5e5e, 0x00636363, 0x00656565, 0x00696969, 0x006d6d6d, 0x00717171, 0x00777777,
+  0x00797979, 0x00808080, 0x00828282, 0x00888888, 0x008b8b8b, 0x00919191, 0x00959595, 0x00999999,
+  0x009e9e9e, 0x00a0a0a0, 0x00a8a8a8, 0x00a9a9a9, 0x00b0b0b0, 0x00b3b3b3, 0x00b8b8b8, 0x00bcbcbc,
+  0x00c0c0c0, 0x00c6c6c6, 0x00c8c8c8, 0x00c8c8c8, 0x00c7c7c7, 0x00c3c3c3, 0x00c2c2c2, 0x00bfbfbf,
+  0x00bdbdbd, 0x00bbbbbb, 0x00b8b8b8, 0x00b7b7b7, 0x00b3b3b3, 0x00b2b2b2, 0x00afafaf, 0x00aeaeae,
+  0x00ababab, 0x00a8a8a8, 0x00a7a7a7, 0x00a3a3a3, 0x00a2a2a2, 0x009e9e9e, 0x009e9e9e, 0x009a9a9a,
+  0x00999999, 0x00969696, 0x00949494, 0x00929292, 0x008f8f8f, 0x008e8e8e, 0x008a8a8a, 0x00898989,
+  0x00858585, 0x00838383, 0x007f7f7f, 0x00767676, 0x006f6f6f, 0x00646464, 0x00616161, 0x00565656,
+  0x00545454, 0x004a4a4a, 0x00464646, 0x003e3e3e, 0x00383838, 0x00333333, 0x002b2b2b, 0x00282828,
+  0x001d1d1d, 0x001b1b1b, 0x00111111, 0x000d0d0d, 0x00060606, 0x00030303, 0x800001c4, 0x00000000,
+  0x00000015, 0x00020202, 0x00141414, 0x001e1e1e, 0x00343434, 0x00454545, 0x00555555, 0x006c6c6c,
+  0x00757575, 0x00929292, 0x00999999, 0x00b4b4b4, 0x00b9b9b9, 0x00c4c4c4, 0x00cbcbcb, 0x00d1d1d1,
+  0x00dadada, 0x00dedede, 0x00eaeaea, 0x00ededed, 0x00f9f9f9, 0x00fbfbfb, 0x80000039, 0x00ffffff,
+  0x00000011, 0x00f6f6f6, 0x00f3f3f3, 0x00d8d8d8, 0x00d2d2d2, 0x00bababa, 0x00b0b0b0, 0x009d9d9d,
+  0x008d8d8d, 0x00808080, 0x006b6b6b, 0x00646464, 0x00494949, 0x00434343, 0x002a2a2a, 0x00202020,
+  0x000e0e0e, 0x00060606, 0x800001b6, 0x00000000, 0x00000023, 0x00050505, 0x000a0a0a, 0x00181818,
+  0x001e1e1e, 0x002f2f2f, 0x00333333, 0x00444444, 0x004a4a4a, 0x00585858, 0x00626262, 0x006b6b6b,
+  0x00787878, 0x007e7e7e, 0x008f8f8f, 0x00939393, 0x00a0a0a0, 0x00a4a4a4, 0x00adadad, 0x00b4b4b4,
+  0x00bababa, 0x00c4c4c4, 0x00c7c7c7, 0x00d3d3d3, 0x00d6d6d6, 0x00e1e1e1, 0x00e3e3e3, 0x00e7e7e7,
+  0x00eaeaea, 0x00ececec, 0x00f0f0f0, 0x00f2f2f2, 0x00f7f7f7, 0x00f8f8f8, 0x00fdfdfd, 0x00fdfdfd,
+  0x80000039, 0x00ffffff, 0x0000001f, 0x00fbfbfb, 0x00fafafa, 0x00efefef, 0x00ededed, 0x00e3e3e3,
+  0x00dfdfdf, 0x00d8d8d8, 0x00d1d1d1, 0x00cccccc, 0x00c3c3c3, 0x00c1c1c1, 0x00b6b6b6, 0x00b3b3b3,
+  0x00a9a9a9, 0x00a5a5a5, 0x009e9e9e, 0x00969696, 0x00909090, 0x00838383, 0x007f7f7f, 0x006f6f6f,
+  0x006b6b6b, 0x005d5d5d, 0x00575757, 0x004c4c4c, 0x00424242, 0x003b3b3b, 0x002a2a2a, 0x00242424,
+  0x00070707, 0x00050505, 0x800001a8, 0x00000000, 0x0000000f, 0x00090909, 0x00111111, 0x00282828,
+  0x00323232, 0x004f4f4f, 0x00555555, 0x00727272, 0x007c7c7c, 0x00939393, 0x00a3a3a3, 0x00b3b3b3,
+  0x00cacaca, 0x00d3d3d3, 0x00f0f0f0, 0x00f4f4f4, 0x8000005d, 0x00ffffff, 0x0000000f, 0x00f7f7f7,
+  0x00f1f1f1, 0x00dcdcdc, 0x00d5d5d5, 0x00bababa, 0x00b4b4b4, 0x009b9b9b, 0x00919191, 0x007f7f7f,
+  0x006f6f6f, 0x00626262, 0x00464646, 0x003d3d3d, 0x000d0d0d, 0x00080808, 0x8000019b, 0x00000000,
+  0x0000001c, 0x00020202, 0x000f0f0f, 0x001b1b1b, 0x00383838, 0x00494949, 0x00595959, 0x006b6b6b,
+  0x00737373, 0x008a8a8a, 0x008f8f8f, 0x00a6a6a6, 0x00aeaeae, 0x00c0c0c0, 0x00c7c7c7, 0x00cecece,
+  0x00d3d3d3, 0x00d5d5d5, 0x00dbdbdb, 0x00dcdcdc, 0x00e2e2e2, 0x00e4e4e4, 0x00e9e9e9, 0x00ececec,
+  0x00efefef, 0x00f4f4f4, 0x00f6f6f6, 0x00fcfcfc, 0x00fdfdfd, 0x8000005d, 0x00ffffff, 0x00000018,
+  0x00fdfdfd, 0x00fcfcfc, 0x00f8f8f8, 0x00f6f6f6, 0x00f1f1f1, 0x00f0f0f0, 0x00ebebeb, 0x00e9e9e9,
+  0x00e5e5e5, 0x00e2e2e2, 0x00dfdfdf, 0x00d9d9d9, 0x00d7d7d7, 0x00cbcbcb, 0x00c5c5c5, 0x00a6a6a6,
+  0x00979797, 0x007b7b7b, 0x00636363, 0x00505050, 0x002f2f2f, 0x00252525, 0x00040404, 0x00020202,
+  0x80000192, 0x00000000, 0x0000000e, 0x00020202, 0x00131313, 0x00222222, 0x00464646, 0x005b5b5b,
+  0x00707070, 0x00878787, 0x00909090, 0x00adadad, 0x00b3b3b3, 0x00d1d1d1, 0x00dbdbdb, 0x00f1f1f1,
+  0x00f8f8f8, 0x80000078, 0x00ffffff, 0x0000000b, 0x00fcfcfc, 0x00f5f5f5, 0x00d1d1d1, 0x00bebebe,
+  0x009a9a9a, 0x007c7c7c, 0x00646464, 0x003b3b3b, 0x002e2e2e, 0x00050505, 0x00030303, 0x80000189,
+  0x00000000, 0x0000000a, 0x00020202, 0x00151515, 0x00242424, 0x00474747, 0x00606060, 0x00797979,
+  0x009d9d9d, 0x00acacac, 0x00dadada, 0x00e2e2e2, 0x80000007, 0x00fefefe, 0x80000082, 0x00ffffff,
+  0x80000005, 0x00fefefe, 0x0000000a, 0x00f3f3f3, 0x00ebebeb, 0x00c1c1c1, 0x00aeaeae, 0x008b8b8b,
+  0x006d6d6d, 0x00555555, 0x002c2c2c, 0x001f1f1f, 0x00010101, 0x80000179, 0x00000000, 0x00000012,
+  0x00040404, 0x00070707, 0x000e0e0e, 0x00131313, 0x00181818, 0x001f1f1f, 0x00222222, 0x002b2b2b,
+  0x002e2e2e, 0x00424242, 0x004e4e4e, 0x006b6b6b, 0x007f7f7f, 0x00949494, 0x00b1b1b1, 0x00bdbdbd,
+  0x00e2e2e2, 0x00e9e9e9, 0x8000008e, 0x00ffffff, 0x00000012, 0x00f7f7f7, 0x00f0f0f0, 0x00cecece,
+  0x00bebebe, 0x00a2a2a2, 0x008a8a8a, 0x00767676, 0x00555555, 0x004a4a4a, 0x002e2e2e, 0x002c2c2c,
+  0x00232323, 0x001f1f1f, 0x00181818, 0x00121212, 0x000e0e0e, 0x00060606, 0x00030303, 0x80000170,
+  0x00000000, 0x0000000a, 0x00020202, 0x00161616, 0x00252525, 0x00494949, 0x00626262, 0x007c7c7c,
+  0x009f9f9f, 0x00aeaeae, 0x00dcdcdc, 0x00e4e4e4, 0x800000a0, 0x00ffffff, 0x0000000a, 0x00eaeaea,
+  0x00e0e0e0, 0x00b3b3b3, 0x00a0a0a0, 0x007d7d7d, 0x005f5f5f, 0x00474747, 0x001e1e1e, 0x00111111,
+  0x00010101, 0x80000166, 0x00000000, 0x00000013, 0x00010101, 0x00090909, 0x000f0f0f, 0x001d1d1d,
+  0x00272727, 0x00313131, 0x003f3f3f, 0x00454545, 0x00575757, 0x005c5c5c, 0x00727272, 0x007b7b7b,
+  0x00919191, 0x00a0a0a0, 0x00afafaf, 0x00c5c5c5, 0x00cecece, 0x00eaeaea, 0x00efefef, 0x800000a0,
+  0x00ffffff, 0x0000000f, 0x00f2f2f2, 0x00ececec, 0x00d1d1d1, 0x00c5c5c5, 0x00b0b0b0, 0x009e9e9e,
+  0x008f8f8f, 0x00767676, 0x006e6e6e, 0x004f4f4f, 0x00484848, 0x002c2c2c, 0x00202020, 0x000b0b0b,
+  0x00050505, 0x80000161, 0x00000000, 0x0000000a, 0x00020202, 0x00171717, 0x00262626, 0x004a4a4a,
+  0x00636363, 0x007d7d7d, 0x00a0a0a0, 0x00b0b0b0, 0x00dedede, 0x00e6e6e6, 0x800000b0, 0x00ffffff,
+  0x00000008, 0x00fefefe, 0x00fefefe, 0x00c7c7c7, 0x00b7b7b7, 0x00707070, 0x00525252, 0x001c1c1c,
+  0x000c0c0c, 0x8000015a, 0x00000000, 0x00000011, 0x00070707, 0x00181818, 0x002c2c2c, 0x00414141,
+  0x005c5c5c, 0x00686868, 0x00848484, 0x00898989, 0x00a0a0a0, 0x00a6a6a6, 0x00b5b5b5, 0x00bfbfbf,
+  0x00cacaca, 0x00d8d8d8, 0x00dfdfdf, 0x00f1f1f1, 0x00f5f5f5, 0x800000b2, 0x00ffffff, 0x0000000b,
+  0x00e8e8e8, 0x00e2e2e2, 0x00c5c5c5, 0x00b8b8b8, 0x00a2a2a2, 0x00888888, 0x00757575, 0x004e4e4e,
+  0x00424242, 0x00121212, 0x000e0e0e, 0x80000155, 0x00000000, 0x00000008, 0x000c0c0c, 0x00282828,
+  0x004a4a4a, 0x006e6e6e, 0x009c9c9c, 0x00b0b0b0, 0x00dedede, 0x00e6e6e6, 0x800000bf, 0x00ffffff,
+  0x00000007, 0x00fefefe, 0x00dedede, 0x00c5c5c5, 0x00848484, 0x00707070, 0x001f1f1f, 0x00171717,
+  0x8000014e, 0x00000000, 0x0000000f, 0x00070707, 0x000d0d0d, 0x00323232, 0x00434343, 0x00747474,
+  0x00808080, 0x00b2b2b2, 0x00bbbbbb, 0x00d2d2d2, 0x00d9d9d9, 0x00e1e1e1, 0x00eaeaea, 0x00eeeeee,
+  0x00f8f8f8, 0x00fafafa, 0x800000c0, 0x00ffffff, 0x0000000c, 0x00f8f8f8, 0x00f3f3f3, 0x00e5e5e5,
+  0x00e1e1e1, 0x00cfcfcf, 0x00c6c6c6, 0x009c9c9c, 0x00838383, 0x00595959, 0x00333333, 0x00161616,
+  0x00050505, 0x80000148, 0x00000000, 0x00000008, 0x00080808, 0x00111111, 0x00404040, 0x00555555,
+  0x00939393, 0x00a1a1a1, 0x00e1e1e1, 0x00eaeaea, 0x800000cb, 0x00ffffff, 0x00000008, 0x00fefefe,
+  0x00f5f5f5, 0x00c5c5c5, 0x00a6a6a6, 0x00707070, 0x00404040, 0x001c1c1c, 0x00070707, 0x80000141,
+  0x00000000, 0x0000000d, 0x00030303, 0x00040404, 0x00343434, 0x00404040, 0x00818181, 0x00959595,
+  0x00c6c6c6, 0x00e0e0e0, 0x00fbfbfb, 0x00fcfcfc, 0x00fdfdfd, 0x00fefefe, 0x00fefefe, 0x800000cf,
+  0x00ffffff, 0x80000003, 0x00fefefe, 0x00000008, 0x00fdfdfd, 0x00fcfcfc, 0x00d0d0d0, 0x00c3c3c3,
+  0x00727272, 0x00616161, 0x001c1c1c, 0x00121212, 0x80000136, 0x00000000, 0x00000010, 0x00010101,
+  0x00060606, 0x000a0a0a, 0x00141414, 0x001a1a1a, 0x00212121, 0x002c2c2c, 0x00313131, 0x005b5b5b,
+  0x00656565, 0x009a9a9a, 0x00aaaaaa, 0x00d2d2d2, 0x00e7e7e7, 0x00fdfdfd, 0x00fefefe, 0x8000005b,
+  0x00ffffff, 0x00000007, 0x00fefefe, 0x00fefefe, 0x00fcfcfc, 0x00fbfbfb, 0x00f9f9f9, 0x00f8f8f8,
+  0x00f6f6f6, 0x80000005, 0x00f4f4f4, 0x0000000a, 0x00f5f5f5, 0x00f5f5f5, 0x00f6f6f6, 0x00f6f6f6,
+  0x00f7f7f7, 0x00f7f7f7, 0x00f8f8f8, 0x00f8f8f8, 0x00f9f9f9, 0x00f9f9f9, 0x80000003, 0x00fafafa,
+  0x00000006, 0x00fbfbfb, 0x00fbfbfb, 0x00fcfcfc, 0x00fcfcfc, 0x00fdfdfd, 0x00fdfdfd, 0x80000003,
+  0x00fefefe, 0x80000059, 0x00ffffff, 0x0000000c, 0x00fefefe, 0x00dbdbdb, 0x00d0d0d0, 0x008d8d8d,
+  0x00808080, 0x00474747, 0x003a3a3a, 0x00252525, 0x001c1c1c, 0x00151515, 0x00080808, 0x00040404,
+  0x80000131, 0x00000000, 0x00000009, 0x00030303, 0x00222222, 0x00363636, 0x00686868, 0x008a8a8a,
+  0x00afafaf, 0x00dcdcdc, 0x00f1f1f1, 0x00fdfdfd, 0x80000062, 0x00ffffff, 0x00000023, 0x00fbfbfb,
+  0x00f9f9f9, 0x00ededed, 0x00e8e8e8, 0x00dfdfdf, 0x00d8d8d8, 0x00d1d1d1, 0x00c7c7c7, 0x00c3c3c3,
+  0x00c3c3c3, 0x00c4c4c4, 0x00c7c7c7, 0x00c9c9c9, 0x00cccccc, 0x00cecece, 0x00d0d0d0, 0x00d3d3d3,
+  0x00d4d4d4, 0x00d9d9d9, 0x00dadada, 0x00dddddd, 0x00dfdfdf, 0x00e2e2e2, 0x00e4e4e4, 0x00e6e6e6,
+  0x00e9e9e9, 0x00eaeaea, 0x00efefef, 0x00f0f0f0, 0x00f3f3f3, 0x00f5f5f5, 0x00f8f8f8, 0x00fafafa,
+  0x00fcfcfc, 0x00fefefe, 0x8000005d, 0x00ffffff, 0x00000008, 0x00fefefe, 0x00e9e9e9, 0x00c5c5c5,
+  0x00959595, 0x00707070, 0x002b2b2b, 0x00171717, 0x00010101, 0x80000129, 0x00000000, 0x00000010,
+  0x00010101, 0x00050505, 0x00111111, 0x001f1f1f, 0x00313131, 0x003a3a3a, 0x00525252, 0x00585858,
+  0x00787878, 0x00848484, 0x00a3a3a3, 0x00b8b8b8, 0x00cecece, 0x00eaeaea, 0x00f6f6f6, 0x00fefefe,
+  0x80000047, 0x00ffffff, 0x00000053, 0x00fbfbfb, 0x00f9f9f9, 0x00eeeeee, 0x00ebebeb, 0x00e2e2e2,
+  0x00dfdfdf, 0x00dcdcdc, 0x00d8d8d8, 0x00d6d6d6, 0x00d1d1d1, 0x00d0d0d0, 0x00cbcbcb, 0x00c9c9c9,
+  0x00c6c6c6, 0x00c3c3c3, 0x00c0c0c0, 0x00bcbcbc, 0x00bbbbbb, 0x00b6b6b6, 0x00b5b5b5, 0x00b0b0b0,
+  0x00aeaeae, 0x00aaaaaa, 0x00a8a8a8, 0x00a5a5a5, 0x00a1a1a1, 0x00a0a0a0, 0x009a9a9a, 0x00999999,
+  0x00919191, 0x008e8e8e, 0x00888888, 0x00848484, 0x00808080, 0x007a7a7a, 0x00777777, 0x00777777,
+  0x00787878, 0x007a7a7a, 0x007b7b7b, 0x007d7d7d, 0x007e7e7e, 0x007f7f7f, 0x00818181, 0x00828282,
+  0x00858585, 0x00858585, 0x00878787, 0x00888888, 0x008a8a8a, 0x008c8c8c, 0x008d8d8d, 0x008f8f8f,
+  0x008f8f8f, 0x00929292, 0x00939393, 0x00959595, 0x00969696, 0x00989898, 0x00999999, 0x009a9a9a,
+  0x009c9c9c, 0x009c9c9c, 0x009e9e9e, 0x009f9f9f, 0x00a3a3a3, 0x00a6a6a6, 0x00adadad, 0x00b2b2b2,
+  0x00b7b7b7, 0x00bebebe, 0x00c1c1c1, 0x00cacaca, 0x00cccccc, 0x00d5d5d5, 0x00d8d8d8, 0x00dfdfdf,
+  0x00e4e4e4, 0x00e8e8e8, 0x00f0f0f0, 0x00f3f3f3, 0x00fcfcfc, 0x00fdfdfd, 0x80000048, 0x00ffffff,
+  0x0000000b, 0x00fefefe, 0x00f2f2f2, 0x00dcdcdc, 0x00bebebe, 0x00a7a7a7, 0x007b7b7b, 0x006e6e6e,
+  0x003f3f3f, 0x00363636, 0x00111111, 0x000b0b0b, 0x80000126, 0x00000000, 0x00000008, 0x00040404,
+  0x000d0d0d, 0x002d2d2d, 0x004f4f4f, 0x007f7f7f, 0x00959595, 0x00d4d4d4, 0x00dfdfdf, 0x8000004f,
+  0x00ffffff, 0x0000001c, 0x00f4f4f4, 0x00f0f0f0, 0x00d4d4d4, 0x00cacaca, 0x00b5b5b5, 0x00acacac,
+  0x00a4a4a4, 0x009a9a9a, 0x00969696, 0x00898989, 0x00868686, 0x00797979, 0x00757575, 0x006b6b6b,
+  0x00646464, 0x005d5d5d, 0x00535353, 0x004f4f4f, 0x00424242, 0x003f3f3f, 0x00333333, 0x002f2f2f,
+  0x00252525, 0x001e1e1e, 0x00171717, 0x000d0d0d, 0x00090909, 0x00010101, 0x80000021, 0x00000000,
+  0x00000016, 0x00010101, 0x00010101, 0x00050505, 0x00070707, 0x00111111, 0x001a1a1a, 0x002b2b2b,
+  0x00393939, 0x00454545, 0x00575757, 0x005e5e5e, 0x00767676, 0x007c7c7c, 0x00929292, 0x009b9b9b,
+  0x00acacac, 0x00b9b9b9, 0x00c5c5c5, 0x00d8d8d8, 0x00dfdfdf, 0x00f7f7f7, 0x00f9f9f9, 0x8000004d,
+  0x00ffffff, 0x00000006, 0x00fafafa, 0x00f8f8f8, 0x00a1a1a1, 0x008b8b8b, 0x002d2d2d, 0x001c1c1c,
+  0x80000121, 0x00000000, 0x0000000d, 0x000c0c0c, 0x00111111, 0x003e3e3e, 0x00484848, 0x00727272,
+  0x007d7d7d, 0x00999999, 0x00a7a7a7, 0x00b6b6b6, 0x00cacaca, 0x00d3d3d3, 0x00ededed, 0x00f2f2f2,
+  0x80000040, 0x00ffffff, 0x0000002a, 0x00fcfcfc, 0x00f6f6f6, 0x00ededed, 0x00e3e3e3, 0x00d7d7d7,
+  0x00d1d1d1, 0x00c0c0c0, 0x00bcbcbc, 0x00acacac, 0x00a6a6a6, 0x00999999, 0x00909090, 0x00878787,
+  0x007a7a7a, 0x00747474, 0x00666666, 0x00636363, 0x00585858, 0x00545454, 0x004b4b4b, 0x00474747,
+  0x00444444, 0x00404040, 0x003e3e3e, 0x00393939, 0x00373737, 0x00323232, 0x00303030, 0x002c2c2c,
+  0x00292929, 0x00262626, 0x00222222, 0x00212121, 0x001b1b1b, 0x001a1a1a, 0x00151515, 0x00131313,
+  0x000f0f0f, 0x000c0c0c, 0x00090909, 0x00050505, 0x00040404, 0x80000024, 0x00000000, 0x00000023,
+  0x00020202, 0x00030303, 0x00070707, 0x000b0b0b, 0x00121212, 0x00181818, 0x001c1c1c, 0x00242424,
+  0x00272727, 0x00313131, 0x00333333, 0x003c3c3c, 0x00404040, 0x00474747, 0x004d4d4d, 0x00515151,
+  0x00595959, 0x005c5c5c, 0x00666666, 0x00686868, 0x00747474, 0x00797979, 0x00838383, 0x008b8b8b,
+  0x00929292, 0x009e9e9e, 0x00a2a2a2, 0x00b0b0b0, 0x00b3b3b3, 0x00c1c1c1, 0x00cacaca, 0x00dbdbdb,
+  0x00ebebeb, 0x00f7f7f7, 0x00fdfdfd, 0x8000003e, 0x00ffffff, 0x0000000b, 0x00fdfdfd, 0x00fcfcfc,
+  0x00d8d8d8, 0x00cfcfcf, 0x00a8a8a8, 0x00929292, 0x006d6d6d, 0x00474747, 0x002a2a2a, 0x000a0a0a,
+  0x00010101, 0x8000011c, 0x00000000, 0x00000008, 0x00141414, 0x001d1d1d, 0x006a6a6a, 0x007b7b7b,
+  0x00c2c2c2, 0x00d2d2d2, 0x00fbfbfb, 0x00fdfdfd, 0x80000045, 0x00ffffff, 0x00000010, 0x00fafafa,
+  0x00f0f0f0, 0x00e0e0e0, 0x00d0d0d0, 0x00bababa, 0x00b1b1b1, 0x00949494, 0x008e8e8e, 0x00727272,
+  0x00686868, 0x00525252, 0x00424242, 0x00333333, 0x001c1c1c, 0x00131313, 0x00020202, 0x80000051,
+  0x00000000, 0x00000010, 0x00030303, 0x00131313, 0x001c1c1c, 0x002c2c2c, 0x003a3a3a, 0x00464646,
+  0x00595959, 0x00606060, 0x00797979, 0x007e7e7e, 0x00959595, 0x00a5a5a5, 0x00c2c2c2, 0x00dcdcdc,
+  0x00f2f2f2, 0x00fcfcfc, 0x80000043, 0x00ffffff, 0x00000006, 0x00e5e5e5, 0x00bababa, 0x00797979,
+  0x00484848, 0x00111111, 0x00010101, 0x80000116, 0x00000000, 0x0000000d, 0x00010101, 0x000d0d0d,
+  0x001f1f1f, 0x004f4f4f, 0x00717171, 0x00969696, 0x00bcbcbc, 0x00cecece, 0x00dfdfdf, 0x00e3e3e3,
+  0x00f2f2f2, 0x00f5f5f5, 0x00fefefe, 0x80000038, 0x00ffffff, 0x0000001d, 0x00f9f9f9, 0x00f6f6f6,
+  0x00dbdbdb, 0x00d5d5d5, 0x00bfbfbf, 0x00b7b7b7, 0x00a6a6a6, 0x009a9a9a, 0x008d8d8d, 0x007b7b7b,
+  0x00747474, 0x005e5e5e, 0x00595959, 0x00424242, 0x003e3e3e, 0x00333333, 0x00303030, 0x002c2c2c,
+  0x00282828, 0x00262626, 0x00202020, 0x001e1e1e, 0x00181818, 0x00161616, 0x00121212, 0x000e0e0e,
+  0x000b0b0b, 0x00060606, 0x00040404, 0x80000052, 0x00000000, 0x00000019, 0x00010101, 0x00040404,
+  0x00060606, 0x00090909, 0x000c0c0c, 0x000f0f0f, 0x00131313, 0x00151515, 0x001a1a1a, 0x001b1b1b,
+  0x00202020, 0x00232323, 0x002a2a2a, 0x00303030, 0x00353535, 0x004d4d4d, 0x00555555, 0x007a7a7a,
+  0x00828282, 0x00a5a5a5, 0x00b2b2b2, 0x00cccccc, 0x00e1e1e1, 0x00f3f3f3, 0x00fcfcfc, 0x8000003a,
+  0x00ffffff, 0x0000000a, 0x00fafafa, 0x00f0f0f0, 0x00e2e2e2, 0x00d8d8d8, 0x00b3b3b3, 0x00a8a8a8,
+  0x00505050, 0x00414141, 0x00040404, 0x00020202, 0x80000112, 0x00000000, 0x00000008, 0x00010101,
+  0x00101010, 0x00272727, 0x00646464, 0x008f8f8f, 0x00bfbfbf, 0x00eaeaea, 0x00fefefe, 0x8000003d,
+  0x00ffffff, 0x0000000f, 0x00f7f7f7, 0x00f4f4f4, 0x00d1d1d1, 0x00cacaca, 0x00adadad, 0x00a4a4a4,
+  0x008e8e8e, 0x007e7e7e, 0x006e6e6e, 0x00575757, 0x004e4e4e, 0x00323232, 0x002c2c2c, 0x000f0f0f,
+  0x000a0a0a, 0x8000006d, 0x00000000, 0x0000000c, 0x00010101, 0x00010101, 0x001d1d1d, 0x00272727,
+  0x00565656, 0x00616161, 0x008c8c8c, 0x009d9d9d, 0x00bebebe, 0x00d9d9d9, 0x00f0f0f0, 0x00fbfbfb,
+  0x8000003e, 0x00ffffff, 0x00000006, 0x00dfdfdf, 0x00d5d5d5, 0x00666666, 0x00535353, 0x00050505,
+  0x00030303, 0x8000010d, 0x00000000, 0x0000000b, 0x00030303, 0x00070707, 0x00393939, 0x00525252,
+  0x00a0a0a0, 0x00b1b1b1, 0x00f5f5f5, 0x00f7f7f7, 0x00fdfdfd, 0x00fdfdfd, 0x00fefefe, 0x80000036,
+  0x00ffffff, 0x0000000b, 0x00eeeeee, 0x00e6e6e6, 0x00bcbcbc, 0x00b2b2b2, 0x00888888, 0x007a7a7a,
+  0x00595959, 0x00414141, 0x002a2a2a, 0x00111111, 0x00060606, 0x80000003, 0x00030303, 0x80000004,
+  0x00020202, 0x80000004, 0x00010101, 0x80000072, 0x00000000, 0x80000003, 0x00010101, 0x0000000f,
+  0x00020202, 0x00020202, 0x00030303, 0x00040404, 0x00050505, 0x001e1e1e, 0x00262626, 0x00555555,
+  0x005f5f5f, 0x008a8a8a, 0x009b9b9b, 0x00bbbbbb, 0x00d6d6d6, 0x00ececec, 0x00fafafa, 0x80000036,
+  0x00ffffff, 0x00000008, 0x00fefefe, 0x00fdfdfd, 0x00f6f6f6, 0x00d9d9d9, 0x00a9a9a9, 0x00595959,
+  0x00262626, 0x00010101, 0x80000106, 0x00000000, 0x0000000c, 0x00010101, 0x000c0c0c, 0x00111111,
+  0x001d1d1d, 0x00272727, 0x00323232, 0x005e5e5e, 0x00737373, 0x00b4b4b4, 0x00c1c1c1, 0x00f9f9f9,
+  0x00fbfbfb, 0x8000002f, 0x00ffffff, 0x00000015, 0x00fefefe, 0x00f9f9f9, 0x00f7f7f7, 0x00efefef,
+  0x00eeeeee, 0x00e6e6e6, 0x00e3e3e3, 0x00dddddd, 0x00d8d8d8, 0x00d4d4d4, 0x00c3c3c3, 0x00bcbcbc,
+  0x00989898, 0x00919191, 0x006d6d6d, 0x00626262, 0x00464646, 0x00333333, 0x00202020, 0x000b0b0b,
+  0x00020202, 0x80000084, 0x00000000, 0x00000012, 0x00010101, 0x00161616, 0x001d1d1d, 0x00434343,
+  0x004c4c4c, 0x006f6f6f, 0x007d7d7d, 0x00989898, 0x00aeaeae, 0x00c1c1c1, 0x00d1d1d1, 0x00d6d6d6,
+  0x00dfdfdf, 0x00e1e1e1, 0x00ebebeb, 0x00f0f0f0, 0x00fafafa, 0x00fdfdfd, 0x80000031, 0x00ffffff,
+  0x00000008, 0x00fafafa, 0x00e2e2e2, 0x00bbbbbb, 0x00787878, 0x004a4a4a, 0x00272727, 0x00131313,
+  0x000e0e0e, 0x80000103, 0x00000000, 0x00000008, 0x00020202, 0x00070707, 0x00414141, 0x005a5a5a,
+  0x009c9c9c, 0x00c4c4c4, 0x00f0f0f0, 0x00fafafa, 0x80000033, 0x00ffffff, 0x0000000c, 0x00fefefe,
+  0x00fcfcfc, 0x00e1e1e1, 0x00d5d5d5, 0x00aaaaaa, 0x00a0a0a0, 0x00757575, 0x00676767, 0x00454545,
+  0x002e2e2e, 0x00161616, 0x00070707, 0x80000098, 0x00000000, 0x00000008, 0x00171717, 0x001f1f1f,
+  0x00505050, 0x005c5c5c, 0x00919191, 0x00aeaeae, 0x00e2e2e2, 0x00f2f2f2, 0x80000035, 0x00ffffff,
+  0x00000005, 0x00e4e4e4, 0x00d0d0d0, 0x00686868, 0x004a4a4a, 0x00020202, 0x800000fe, 0x00000000,
+  0x0000000c, 0x00080808, 0x00121212, 0x002a2a2a, 0x00353535, 0x00545454, 0x005c5c5c, 0x008a8a8a,
+  0x00999999, 0x00c2c2c2, 0x00dadada, 0x00f6f6f6, 0x00fcfcfc, 0x8000002a, 0x00ffffff, 0x00000015,
+  0x00fdfdfd, 0x00fafafa, 0x00eeeeee, 0x00e8e8e8, 0x00d8d8d8, 0x00d4d4d4, 0x00c4c4c4, 0x00bebebe,
+  0x00b1b1b1, 0x00a8a8a8, 0x009f9f9f, 0x008c8c8c, 0x00838383, 0x00696969, 0x00636363, 0x00484848,
+  0x003f3f3f, 0x002b2b2b, 0x001c1c1c, 0x000e0e0e, 0x00040404, 0x80000098, 0x00000000, 0x0000000d,
+  0x000e0e0e, 0x00131313, 0x00313131, 0x00393939, 0x00595959, 0x006b6b6b, 0x008b8b8b, 0x00a1a1a1,
+  0x00b2b2b2, 0x00c9c9c9, 0x00d1d1d1, 0x00efefef, 0x00f2f2f2, 0x80000030, 0x00ffffff, 0x00000008,
+  0x00eeeeee, 0x00e2e2e2, 0x00a2a2a2, 0x008f8f8f, 0x004c4c4c, 0x00414141, 0x00171717, 0x000e0e0e,
+  0x800000fb, 0x00000000, 0x00000006, 0x00161616, 0x002f2f2f, 0x006d6d6d, 0x008b8b8b, 0x00d9d9d9,
+  0x00e6e6e6, 0x80000030, 0x00ffffff, 0x0000000c, 0x00f9f9f9, 0x00f2f2f2, 0x00d2d2d2, 0x00c3c3c3,
+  0x00999999, 0x00909090, 0x00646464, 0x00565656, 0x00343434, 0x001e1e1e, 0x00080808, 0x00020202,
+  0x800000a8, 0x00000000, 0x00000006, 0x001d1d1d, 0x00353535, 0x00727272, 0x00868686, 0x00d4d4d4,
+  0x00dedede, 0x80000034, 0x00ffffff, 0x00000004, 0x00c3c3c3, 0x00aaaaaa, 0x003b3b3b, 0x00252525,
+  0x800000f6, 0x00000000, 0x0000000b, 0x00101010, 0x00161616, 0x00464646, 0x00555555, 0x007b7b7b,
+  0x00909090, 0x00a8a8a8, 0x00c2c2c2, 0x00cfcfcf, 0x00efefef, 0x00f5f5f5, 0x80000029, 0x00ffffff,
+  0x00000013, 0x00f4f4f4, 0x00efefef, 0x00cdcdcd, 0x00c6c6c6, 0x00a4a4a4, 0x00999999, 0x00808080,
+  0x00737373, 0x00666666, 0x00585858, 0x00515151, 0x00404040, 0x003c3c3c, 0x002a2a2a, 0x00242424,
+  0x00161616, 0x000d0d0d, 0x00030303, 0x00010101, 0x800000a8, 0x00000000, 0x0000000c, 0x000c0c0c,
+  0x00161616, 0x00303030, 0x00383838, 0x00595959, 0x00616161, 0x00838383, 0x00949494, 0x00b3b3b3,
+  0x00cdcdcd, 0x00e2e2e2, 0x00f8f8f8, 0x8000002e, 0x00ffffff, 0x00000008, 0x00e6e6e6, 0x00dbdbdb,
+  0x00adadad, 0x00909090, 0x005f5f5f, 0x002f2f2f, 0x000c0c0c, 0x00030303, 0x800000f2, 0x00000000,
+  0x00000006, 0x001b1b1b, 0x00252525, 0x00797979, 0x00929292, 0x00d4d4d4, 0x00e8e8e8, 0x8000002e,
+  0x00ffffff, 0x00000009, 0x00ececec, 0x00e3e3e3, 0x00a9a9a9, 0x009c9c9c, 0x00626262, 0x00505050,
+  0x00242424, 0x00131313, 0x00010101, 0x800000b7, 0x00000000, 0x00000007, 0x00070707, 0x002a2a2a,
+  0x00474747, 0x007c7c7c, 0x00aaaaaa, 0x00cecece, 0x00f3f3f3, 0x80000031, 0x00ffffff, 0x00000005,
+  0x00dcdcdc, 0x00a3a3a3, 0x00505050, 0x00141414, 0x00040404, 0x800000ec, 0x00000000, 0x0000000c,
+  0x00040404, 0x000d0d0d, 0x002d2d2d, 0x00505050, 0x00808080, 0x00989898, 0x00c6c6c6, 0x00cfcfcf,
+  0x00e2e2e2, 0x00e7e7e7, 0x00f6f6f6, 0x00fafafa, 0x80000027, 0x00ffffff, 0x0000000f, 0x00ececec,
+  0x00e6e6e6, 0x00b8b8b8, 0x00aaaaaa, 0x00868686, 0x006d6d6d, 0x00535353, 0x003c3c3c, 0x00323232,
+  0x00252525, 0x00222222, 0x00151515, 0x00121212, 0x00080808, 0x00040404, 0x800000b8, 0x00000000,
+  0x0000000e, 0x00010101, 0x00090909, 0x00101010, 0x001b1b1b, 0x00252525, 0x002d2d2d, 0x00484848,
+  0x00515151, 0x008e8e8e, 0x009b9b9b, 0x00d0d0d0, 0x00e1e1e1, 0x00fdfdfd, 0x00fefefe, 0x8000002a,
+  0x00ffffff, 0x00000007, 0x00f7f7f7, 0x00ebebeb, 0x00cfcfcf, 0x00bbbbbb, 0x00606060, 0x00464646,
+  0x00010101, 0x800000ea, 0x00000000, 0x00000008, 0x00050505, 0x00111111, 0x00393939, 0x00676767,
+  0x00a4a4a4, 0x00c3c3c3, 0x00f6f6f6, 0x00fefefe, 0x8000002b, 0x00ffffff, 0x00000008, 0x00e7e7e7,
+  0x00dfdfdf, 0x00a4a4a4, 0x00929292, 0x00646464, 0x00444444, 0x00232323, 0x000b0b0b, 0x800000c5,
+  0x00000000, 0x00000008, 0x00181818, 0x00202020, 0x006f6f6f, 0x007f7f7f, 0x00c3c3c3, 0x00d8d8d8,
+  0x00fdfdfd, 0x00fefefe, 0x8000002c, 0x00ffffff, 0x00000005, 0x00f3f3f3, 0x00eaeaea, 0x007a7a7a,
+  0x005a5a5a, 0x00020202, 0x800000e7, 0x00000000, 0x00000009, 0x00202020, 0x002d2d2d, 0x00949494,
+  0x00adadad, 0x00f1f1f1, 0x00f6f6f6, 0x00fcfcfc, 0x00fdfdfd, 0x00fefefe, 0x80000025, 0x00ffffff,
+  0x0000000f, 0x00fdfdfd, 0x00e6e6e6, 0x00d5d5d5, 0x00a8a8a8, 0x00898989, 0x00696969, 0x003d3d3d,
+  0x00292929, 0x00090909, 0x00040404, 0x00030303, 0x00030303, 0x00020202, 0x00010101, 0x00010101,
+  0x800000c7, 0x00000000, 0x0000000b, 0x00010101, 0x00020202, 0x00030303, 0x00040404, 0x000d0d0d,
+  0x001d1d1d, 0x00484848, 0x006a6a6a, 0x00b1b1b1, 0x00c7c7c7, 0x00fdfdfd, 0x8000002a, 0x00ffffff,
+  0x00000006, 0x00fcfcfc, 0x00fcfcfc, 0x00b3b3b3, 0x00979797, 0x001d1d1d, 0x00121212, 0x800000e0,
+  0x00000000, 0x0000000a, 0x00050505, 0x000b0b0b, 0x00191919, 0x00202020, 0x00474747, 0x00535353,
+  0x00aaaaaa, 0x00bebebe, 0x00f8f8f8, 0x00fbfbfb, 0x80000021, 0x00ffffff, 0x00000010, 0x00fefefe,
+  0x00fbfbfb, 0x00f5f5f5, 0x00efefef, 0x00e7e7e7, 0x00e4e4e4, 0x00dadada, 0x00d6d6d6, 0x00bdbdbd,
+  0x00aeaeae, 0x00888888, 0x006f6f6f, 0x00545454, 0x002f2f2f, 0x001e1e1e, 0x00030303, 0x800000d1,
+  0x00000000, 0x0000000a, 0x00070707, 0x00141414, 0x00383838, 0x00555555, 0x00909090, 0x00a3a3a3,
+  0x00dbdbdb, 0x00e0e0e0, 0x00f2f2f2, 0x00f7f7f7, 0x80000029, 0x00ffffff, 0x00000006, 0x00c3c3c3,
+  0x00ababab, 0x00444444, 0x00313131, 0x00131313, 0x00080808, 0x800000de, 0x00000000, 0x00000006,
+  0x001d1d1d, 0x003f3f3f, 0x008b8b8b, 0x00b2b2b2, 0x00f4f4f4, 0x00fefefe, 0x80000025, 0x00ffffff,
+  0x00000008, 0x00f9f9f9, 0x00e8e8e8, 0x00c9c9c9, 0x00a8a8a8, 0x007c7c7c, 0x00676767, 0x002f2f2f,
+  0x00242424, 0x800000df, 0x00000000, 0x00000004, 0x003d3d3d, 0x00535353, 0x00b8b8b8, 0x00d2d2d2,
+  0x8000002a, 0x00ffffff, 0x00000005, 0x00fdfdfd, 0x00f3f3f3, 0x00bfbfbf, 0x006a6a6a, 0x002c2c2c,
+  0x800000d9, 0x00000000, 0x0000000b, 0x00010101, 0x00040404, 0x00222222, 0x002d2d2d, 0x004d4d4d,
+  0x00686868, 0x00888888, 0x00b7b7b7, 0x00cfcfcf, 0x00f8f8f8, 0x00fefefe, 0x8000001e, 0x00ffffff,
+  0x0000000f, 0x00fdfdfd, 0x00fbfbfb, 0x00e9e9e9, 0x00e0e0e0, 0x00c9c9c9, 0x00c4c4c4, 0x00aeaeae,
+  0x00a6a6a6, 0x00909090, 0x007d7d7d, 0x00686868, 0x004d4d4d, 0x00404040, 0x001d1d1d, 0x00161616,
+  0x800000df, 0x00000000, 0x00000009, 0x00262626, 0x00343434, 0x00727272, 0x00898989, 0x00b1b1b1,
+  0x00cbcbcb, 0x00dfdfdf, 0x00f7f7f7, 0x00fefefe, 0x80000025, 0x00ffffff, 0x00000008, 0x00fefefe,
+  0x00f8f8f8, 0x00d7d7d7, 0x00a2a2a2, 0x00696969, 0x00414141, 0x00121212, 0x00050505, 0x800000d6,
+  0x00000000, 0x00000006, 0x00030303, 0x00090909, 0x005a5a5a, 0x00787878, 0x00cccccc, 0x00e4e4e4,
+  0x80000023, 0x00ffffff, 0x00000008, 0x00fafafa, 0x00f4f4f4, 0x00c4c4c4, 0x00adadad, 0x00717171,
+  0x00646464, 0x00292929, 0x001e1e1e, 0x800000e9, 0x00000000, 0x00000006, 0x00121212, 0x00323232,
+  0x00767676, 0x00ababab, 0x00eaeaea, 0x00fdfdfd, 0x80000029, 0x00ffffff, 0x00000004, 0x00cecece,
+  0x00ababab, 0x002f2f2f, 0x000d0d0d, 0x800000d2, 0x00000000, 0x0000000a, 0x00040404, 0x00090909,
+  0x00303030, 0x00444444, 0x007c7c7c, 0x00888888, 0x00b9b9b9, 0x00c6c6c6, 0x00e9e9e9, 0x00f3f3f3,
+  0x8000001e, 0x00ffffff, 0x0000000d, 0x00f6f6f6, 0x00f2f2f2, 0x00c9c9c9, 0x00bcbcbc, 0x00999999,
+  0x00848484, 0x006c6c6c, 0x00555555, 0x00494949, 0x00303030, 0x002a2a2a, 0x00111111, 0x000c0c0c,
+  0x800000e9, 0x00000000, 0x0000000a, 0x00080808, 0x00151515, 0x00323232, 0x00484848, 0x00747474,
+  0x00818181, 0x00c5c5c5, 0x00d0d0d0, 0x00fcfcfc, 0x00fdfdfd, 0x80000025, 0x00ffffff, 0x00000006,
+  0x00eaeaea, 0x00dbdbdb, 0x00969696, 0x00838383, 0x001c1c1c, 0x00151515, 0x800000d0, 0x00000000,
+  0x00000006, 0x00070707, 0x000f0f0f, 0x00525252, 0x00757575, 0x00d4d4d4, 0x00e5e5e5, 0x80000022,
+  0x00ffffff, 0x00000008, 0x00f0f0f0, 0x00e8e8e8, 0x00a1a1a1, 0x008a8a8a, 0x004f4f4f, 0x002e2e2e,
+  0x00090909, 0x00030303, 0x800000f2, 0x00000000, 0x00000006, 0x001e1e1e, 0x00272727, 0x009a9a9a,
+  0x00adadad, 0x00fafafa, 0x00fcfcfc, 0x80000027, 0x00ffffff, 0x00000004, 0x00e1e1e1, 0x00d9d9d9,
+  0x00303030, 0x00252525, 0x800000cc, 0x00000000, 0x0000000a, 0x00020202, 0x001a1a1a, 0x00303030,
+  0x00707070, 0x00959595, 0x00c0c0c0, 0x00d5d5d5, 0x00e0e0e0, 0x00f5f5f5, 0x00f9f9f9, 0x8000001c,
+  0x00ffffff, 0x0000000e, 0x00f9f9f9, 0x00ebebeb, 0x00cdcdcd, 0x00adadad, 0x00828282, 0x006e6e6e,
+  0x003f3f3f, 0x00373737, 0x00242424, 0x001f1f1f, 0x00121212, 0x000a0a0a, 0x00020202, 0x00010101,
+  0x800000f2, 0x00000000, 0x0000000a, 0x00070707, 0x00090909, 0x00222222, 0x002b2b2b, 0x004e4e4e,
+  0x00707070, 0x00aaaaaa, 0x00d6d6d6, 0x00f7f7f7, 0x00fdfdfd, 0x80000023, 0x00ffffff, 0x00000006,
+  0x00f8f8f8, 0x00f6f6f6, 0x00c9c9c9, 0x00b1b1b1, 0x00494949, 0x002d2d2d, 0x800000ca, 0x00000000,
+  0x00000007, 0x00020202, 0x00212121, 0x003e3e3e, 0x00909090, 0x00bebebe, 0x00f3f3f3, 0x00fbfbfb,
+  0x8000001f, 0x00ffffff, 0x00000008, 0x00f8f8f8, 0x00e5e5e5, 0x00bfbfbf, 0x00959595, 0x005e5e5e,
+  0x00444444, 0x000c0c0c, 0x00040404, 0x800000fb, 0x00000000, 0x00000007, 0x00050505, 0x001d1d1d,
+  0x00484848, 0x00919191, 0x00cacaca, 0x00f5f5f5, 0x00fdfdfd, 0x80000025, 0x00ffffff, 0x00000004,
+  0x00f5f5f5, 0x00d9d9d9, 0x005e5e5e, 0x003a3a3a, 0x800000c7, 0x00000000, 0x00000008, 0x00242424,
+  0x00373737, 0x00979797, 0x00ababab, 0x00f7f7f7, 0x00f8f8f8, 0x00fcfcfc, 0x00fdfdfd, 0x8000001c,
+  0x00ffffff, 0x0000000b, 0x00e7e7e7, 0x00dcdcdc, 0x00979797, 0x00878787, 0x003e3e3e, 0x002f2f2f,
+  0x00070707, 0x00050505, 0x00040404, 0x00020202, 0x00020202, 0x800000fe, 0x00000000, 0x00000009,
+  0x00010101, 0x00020202, 0x00040404, 0x00111111, 0x001b1b1b, 0x006e6e6e, 0x00878787, 0x00ececec,
+  0x00f2f2f2, 0x80000023, 0x00ffffff, 0x00000007, 0x00fefefe, 0x00fbfbfb, 0x00d4d4d4, 0x00959595,
+  0x00414141, 0x00050505, 0x00010101, 0x800000be, 0x00000000, 0x0000000b, 0x00010101, 0x00040404,
+  0x000e0e0e, 0x00181818, 0x00222222, 0x00474747, 0x005b5b5b, 0x00acacac, 0x00bebebe, 0x00fdfdfd,
+  0x00fdfdfd, 0x80000018, 0x00ffffff, 0x0000000d, 0x00fefefe, 0x00f7f7f7, 0x00f3f3f3, 0x00e9e9e9,
+  0x00e2e2e2, 0x00dadada, 0x00c1c1c1, 0x00b5b5b5, 0x007b7b7b, 0x006d6d6d, 0x002f2f2f, 0x00222222,
+  0x00010101, 0x80000105, 0x00000000, 0x00000008, 0x000a0a0a, 0x00111111, 0x00585858, 0x006d6d6d,
+  0x00c5c5c5, 0x00cecece, 0x00ececec, 0x00f3f3f3, 0x80000023, 0x00ffffff, 0x00000006, 0x00dfdfdf,
+  0x00ababab, 0x005c5c5c, 0x00232323, 0x00090909, 0x00010101, 0x800000bd, 0x00000000, 0x00000006,
+  0x00030303, 0x00181818, 0x00535353, 0x00888888, 0x00c6c6c6, 0x00ececec, 0x8000001d, 0x00ffffff,
+  0x00000007, 0x00fcfcfc, 0x00d0d0d0, 0x00bababa, 0x007f7f7f, 0x00585858, 0x002d2d2d, 0x000f0f0f,
+  0x8000010f, 0x00000000, 0x00000006, 0x000f0f0f, 0x00262626, 0x00939393, 0x00bababa, 0x00fdfdfd,
+  0x00fefefe, 0x80000023, 0x00ffffff, 0x00000004, 0x00d3d3d3, 0x00b4b4b4, 0x002d2d2d, 0x00080808,
+  0x800000b9, 0x00000000, 0x0000000a, 0x00020202, 0x00030303, 0x00242424, 0x002b2b2b, 0x00555555,
+  0x00656565, 0x00939393, 0x00b4b4b4, 0x00dbdbdb, 0x00f3f3f3, 0x80000018, 0x00ffffff, 0x0000000c,
+  0x00f5f5f5, 0x00e9e9e9, 0x00d5d5d5, 0x00cbcbcb, 0x00b1b1b1, 0x00aaaaaa, 0x00828282, 0x00757575,
+  0x00505050, 0x00373737, 0x001c1c1c, 0x00090909, 0x8000010f, 0x00000000, 0x00000008, 0x00090909,
+  0x00181818, 0x005c5c5c, 0x007c7c7c, 0x00b3b3b3, 0x00d4d4d4, 0x00ededed, 0x00fbfbfb, 0x80000021,
+  0x00ffffff, 0x00000006, 0x00e3e3e3, 0x00d0d0d0, 0x00696969, 0x004d4d4d, 0x00060606, 0x00040404,
+  0x800000b7, 0x00000000, 0x00000006, 0x00060606, 0x00090909, 0x005f5f5f, 0x00747474, 0x00dedede,
+  0x00e6e6e6, 0x8000001b, 0x00ffffff, 0x00000007, 0x00fefefe, 0x00e3e3e3, 0x00c5c5c5, 0x008e8e8e,
+  0x00737373, 0x002d2d2d, 0x00202020, 0x80000118, 0x00000000, 0x00000005, 0x00141414, 0x00363636,
+  0x008e8e8e, 0x00cfcfcf, 0x00f4f4f4, 0x80000023, 0x00ffffff, 0x00000004, 0x00cdcdcd, 0x00c0c0c0,
+  0x000f0f0f, 0x000b0b0b, 0x800000b4, 0x00000000, 0x00000009, 0x00010101, 0x001a1a1a, 0x00373737,
+  0x006b6b6b, 0x00868686, 0x00b8b8b8, 0x00c4c4c4, 0x00f1f1f1, 0x00f5f5f5, 0x80000017, 0x00ffffff,
+  0x0000000b, 0x00ebebeb, 0x00e4e4e4, 0x00afafaf, 0x00a1a1a1, 0x007a7a7a, 0x00696969, 0x00545454,
+  0x003d3d3d, 0x00313131, 0x00131313, 0x000e0e0e, 0x80000118, 0x00000000, 0x00000008, 0x00090909,
+  0x00171717, 0x003e3e3e, 0x005b5b5b, 0x009c9c9c, 0x00afafaf, 0x00f7f7f7, 0x00fafafa, 0x80000020,
+  0x00ffffff, 0x00000006, 0x00eaeaea, 0x00e4e4e4, 0x007b7b7b, 0x00646464, 0x000b0b0b, 0x00070707,
+  0x800000b1, 0x00000000, 0x00000007, 0x00010101, 0x00020202, 0x002d2d2d, 0x00606060, 0x00b6b6b6,
+  0x00e3e3e3, 0x00fbfbfb, 0x8000001a, 0x00ffffff, 0x00000006, 0x00dcdcdc, 0x00d0d0d0, 0x00737373,
+  0x005b5b5b, 0x00181818, 0x000d0d0d, 0x8000011f, 0x00000000, 0x00000006, 0x00020202, 0x00040404,
+  0x005b5b5b, 0x00747474, 0x00f2f2f2, 0x00f7f7f7, 0x80000022, 0x00ffffff, 0x00000004, 0x00cbcbcb,
+  0x00a8a8a8, 0x00131313, 0x000c0c0c, 0x800000af, 0x00000000, 0x00000009, 0x00030303, 0x00373737,
+  0x00525252, 0x00a2a2a2, 0x00bbbbbb, 0x00dbdbdb, 0x00eeeeee, 0x00f9f9f9, 0x00fefefe, 0x80000014,
+  0x00ffffff, 0x0000000c, 0x00fdfdfd, 0x00f7f7f7, 0x00d9d9d9, 0x00b6b6b6, 0x00838383, 0x00696969,
+  0x00393939, 0x00303030, 0x001a1a1a, 0x00151515, 0x00050505, 0x00030303, 0x8000011f, 0x00000000,
+  0x00000008, 0x00010101, 0x00010101, 0x00151515, 0x001b1b1b, 0x004f4f4f, 0x00676767, 0x00d2d2d2,
+  0x00e3e3e3, 0x80000020, 0x00ffffff, 0x00000006, 0x00f3f3f3, 0x00e5e5e5, 0x00a8a8a8, 0x006e6e6e,
+  0x00131313, 0x00080808, 0x800000ad, 0x00000000, 0x00000005, 0x00040404, 0x00474747, 0x006a6a6a,
+  0x00d1d1d1, 0x00e6e6e6, 0x80000018, 0x00ffffff, 0x00000007, 0x00fcfcfc, 0x00f5f5f5, 0x00cecece,
+  0x00a0a0a0, 0x005e5e5e, 0x003c3c3c, 0x00080808, 0x80000128, 0x00000000, 0x00000004, 0x001e1e1e,
+  0x003c3c3c, 0x00c4c4c4, 0x00dadada, 0x80000021, 0x00ffffff, 0x00000005, 0x00f7f7f7, 0x00d4d4d4,
+  0x008b8b8b, 0x00191919, 0x000a0a0a, 0x800000aa, 0x00000000, 0x00000008, 0x001e1e1e, 0x002f2f2f,
+  0x00a1a1a1, 0x00b8b8b8, 0x00fafafa, 0x00fbfbfb, 0x00fefefe, 0x00fefefe, 0x80000015, 0x00ffffff,
+  0x00000009, 0x00d5d5d5, 0x00c8c8c8, 0x006d6d6d, 0x00555555, 0x00151515, 0x000d0d0d, 0x00050505,
+  0x00030303, 0x00020202, 0x80000129, 0x00000000, 0x00000006, 0x00010101, 0x00020202, 0x000a0a0a,
+  0x003d3d3d, 0x00929292, 0x00d1d1d1, 0x80000020, 0x00ffffff, 0x00000006, 0x00fefefe, 0x00ededed,
+  0x00d2d2d2, 0x00616161, 0x00111111, 0x00040404, 0x800000a4, 0x00000000, 0x00000008, 0x00010101,
+  0x00050505, 0x000f0f0f, 0x001b1b1b, 0x003f3f3f, 0x00535353, 0x00b5b5b5, 0x00c9c9c9, 0x80000013,
+  0x00ffffff, 0x0000000c, 0x00fefefe, 0x00fcfcfc, 0x00f5f5f5, 0x00ededed, 0x00e2e2e2, 0x00dcdcdc,
+  0x00b1b1b1, 0x00a5a5a5, 0x00565656, 0x00434343, 0x000c0c0c, 0x00060606, 0x8000012d, 0x00000000,
+  0x00000008, 0x00010101, 0x00030303, 0x002f2f2f, 0x00777777, 0x00b5b5b5, 0x00e2e2e2, 0x00f7f7f7,
+  0x00fdfdfd, 0x8000001e, 0x00ffffff, 0x00000006, 0x00f2f2f2, 0x00dfdfdf, 0x00787878, 0x00303030,
+  0x000b0b0b, 0x00010101, 0x800000a3, 0x00000000, 0x00000006, 0x00070707, 0x001d1d1d, 0x00585858,
+  0x00a1a1a1, 0x00dddddd, 0x00fdfdfd, 0x80000015, 0x00ffffff, 0x00000007, 0x00fbfbfb, 0x00f0f0f0,
+  0x00c6c6c6, 0x00959595, 0x00535353, 0x00313131, 0x00070707, 0x80000136, 0x00000000, 0x00000004,
+  0x00313131, 0x00555555, 0x00cfcfcf, 0x00f2f2f2, 0x80000020, 0x00ffffff, 0x00000004, 0x00dcdcdc,
+  0x00c4c4c4, 0x00303030, 0x00080808, 0x800000a0, 0x00000000, 0x00000009, 0x00050505, 0x00080808,
+  0x00323232, 0x00414141, 0x006d6d6d, 0x00949494, 0x00c4c4c4, 0x00e9e9e9, 0x00fefefe, 0x80000012,
+  0x00ffffff, 0x0000000a, 0x00ececec, 0x00e6e6e6, 0x00c4c4c4, 0x00b9b9b9, 0x009b9b9b, 0x007f7f7f,
+  0x005e5e5e, 0x00343434, 0x001f1f1f, 0x00040404, 0x80000136, 0x00000000, 0x00000006, 0x001f1f1f,
+  0x00363636, 0x008e8e8e, 0x00a8a8a8, 0x00eeeeee, 0x00f2f2f2, 0x8000001e, 0x00ffffff, 0x00000006,
+  0x00e9e9e9, 0x00dadada, 0x00646464, 0x00444444, 0x00010101, 0x00010101, 0x8000009e, 0x00000000,
+  0x00000006, 0x000d0d0d, 0x00151515, 0x00888888, 0x00a4a4a4, 0x00f7f7f7, 0x00fbfbfb, 0x80000015,
+  0x00ffffff, 0x00000006, 0x00cbcbcb, 0x00bcbcbc, 0x005e5e5e, 0x00484848, 0x00090909, 0x00050505,
+  0x8000013c, 0x00000000, 0x00000004, 0x001f1f1f, 0x00282828, 0x00d1d1d1, 0x00dcdcdc, 0x80000020,
+  0x00ffffff, 0x00000004, 0x00bdbdbd, 0x00acacac, 0x00040404, 0x00020202, 0x8000009a, 0x00000000,
+  0x0000000a, 0x00020202, 0x00030303, 0x002a2a2a, 0x003f3f3f, 0x00818181, 0x008f8f8f, 0x00cbcbcb,
+  0x00d8d8d8, 0x00fcfcfc, 0x00fdfdfd, 0x8000000f, 0x00ffffff, 0x0000000c, 0x00fcfcfc, 0x00f3f3f3,
+  0x00dadada, 0x00bdbdbd, 0x00989898, 0x00848484, 0x005b5b5b, 0x00515151, 0x00292929, 0x001f1f1f,
+  0x00040404, 0x00020202, 0x8000013c, 0x00000000, 0x00000006, 0x000d0d0d, 0x00111111, 0x00626262,
+  0x00797979, 0x00dcdcdc, 0x00e9e9e9, 0x8000001e, 0x00ffffff, 0x00000004, 0x00e3e3e3, 0x00dbdbdb,
+  0x00545454, 0x00434343, 0x8000009a, 0x00000000, 0x00000006, 0x00030303, 0x00060606, 0x004a4a4a,
+  0x006f6f6f, 0x00d9d9d9, 0x00ededed, 0x80000013, 0x00ffffff, 0x00000007, 0x00f9f9f9, 0x00e9e9e9,
+  0x00bebebe, 0x008a8a8a, 0x00494949, 0x00272727, 0x00060606, 0x80000143, 0x00000000, 0x00000004,
+  0x000e0e0e, 0x002e2e2e, 0x00c1c1c1, 0x00d8d8d8, 0x80000020, 0x00ffffff, 0x00000002, 0x00919191,
+  0x00757575, 0x80000097, 0x00000000, 0x00000009, 0x00010101, 0x00111111, 0x00434343, 0x00717171,
+  0x00ababab, 0x00cccccc, 0x00dddddd, 0x00f6f6f6, 0x00fbfbfb, 0x8000000e, 0x00ffffff, 0x0000000c,
+  0x00fefefe, 0x00fdfdfd, 0x00d0d0d0, 0x00c4c4c4, 0x007b7b7b, 0x006b6b6b, 0x003a3a3a, 0x002e2e2e,
+  0x00202020, 0x00111111, 0x00090909, 0x00010101, 0x80000143, 0x00000000, 0x00000006, 0x00030303,
+  0x000c0c0c, 0x00343434, 0x006c6c6c, 0x00c7c7c7, 0x00e7e7e7, 0x8000001e, 0x00ffffff, 0x00000004,
+  0x00e5e5e5, 0x00cacaca, 0x00575757, 0x00353535, 0x80000095, 0x00000000, 0x00000006, 0x00010101,
+  0x00161616, 0x00575757, 0x00939393, 0x00dddddd, 0x00f3f3f3, 0x80000011, 0x00ffffff, 0x00000008,
+  0x00fefefe, 0x00fdfdfd, 0x00c1c1c1, 0x00b1b1b1, 0x00535353, 0x003f3f3f, 0x00050505, 0x00030303,
+  0x80000148, 0x00000000, 0x00000005, 0x00020202, 0x00090909, 0x004a4a4a, 0x00b6b6b6, 0x00e0e0e0,
+  0x8000001f, 0x00ffffff, 0x00000003, 0x00e4e4e4, 0x00717171, 0x00454545, 0x80000093, 0x00000000,
+  0x00000007, 0x00333333, 0x00424242, 0x00c2c2c2, 0x00d0d0d0, 0x00f9f9f9, 0x00fbfbfb, 0x00fefefe,
+  0x8000000e, 0x00ffffff, 0x0000000a, 0x00fefefe, 0x00f9f9f9, 0x00d0d0d0, 0x009f9f9f, 0x00555555,
+  0x002d2d2d, 0x000c0c0c, 0x00060606, 0x00030303, 0x00020202, 0x8000014c, 0x00000000, 0x00000005,
+  0x00040404, 0x000b0b0b, 0x00686868, 0x00acacac, 0x00ededed, 0x8000001d, 0x00ffffff, 0x00000005,
+  0x00fefefe, 0x00f7f7f7, 0x00ababab, 0x00353535, 0x00161616, 0x8000008d, 0x00000000, 0x00000008,
+  0x00030303, 0x00060606, 0x00151515, 0x001d1d1d, 0x00545454, 0x00636363, 0x00d2d2d2, 0x00dddddd,
+  0x8000000e, 0x00ffffff, 0x0000000a, 0x00fdfdfd, 0x00fcfcfc, 0x00ececec, 0x00e6e6e6, 0x00d5d5d5,
+  0x00afafaf, 0x00828282, 0x00424242, 0x00202020, 0x00050505, 0x8000014f, 0x00000000, 0x00000006,
+  0x00020202, 0x00040404, 0x00545454, 0x008e8e8e, 0x00d9d9d9, 0x00efefef, 0x8000001d, 0x00ffffff,
+  0x00000005, 0x00fcfcfc, 0x00bababa, 0x00525252, 0x00222222, 0x00020202, 0x8000008c, 0x00000000,
+  0x00000005, 0x00111111, 0x00272727, 0x00808080, 0x00b1b1b1, 0x00f3f3f3, 0x80000011, 0x00ffffff,
+  0x00000006, 0x00f5f5f5, 0x00eeeeee, 0x008c8c8c, 0x006f6f6f, 0x001b1b1b, 0x000f0f0f, 0x80000155,
+  0x00000000, 0x00000005, 0x00010101, 0x00020202, 0x007a7a7a, 0x009c9c9c, 0x00fdfdfd, 0x8000001d,
+  0x00ffffff, 0x00000005, 0x00f1f1f1, 0x00dadada, 0x005f5f5f, 0x000a0a0a, 0x00020202, 0x8000008b,
+  0x00000000, 0x00000005, 0x00242424, 0x00505050, 0x00a1a1a1, 0x00cdcdcd, 0x00f7f7f7, 0x8000000d,
+  0x00ffffff, 0x0000000a, 0x00fcfcfc, 0x00f7f7f7, 0x00dddddd, 0x00cfcfcf, 0x00a8a8a8, 0x009d9d9d,
+  0x00595959, 0x00474747, 0x00111111, 0x00090909, 0x80000155, 0x00000000, 0x00000006, 0x00010101,
+  0x00010101, 0x004e4e4e, 0x00646464, 0x00dedede, 0x00e6e6e6, 0x8000001c, 0x00ffffff, 0x00000005,
+  0x00f6f6f6, 0x00e7e7e7, 0x00828282, 0x003c3c3c, 0x000d0d0d, 0x8000008b, 0x00000000, 0x00000003,
+  0x00444444, 0x00989898, 0x00dadada, 0x8000000f, 0x00ffffff, 0x00000006, 0x00f6f6f6, 0x00eaeaea,
+  0x00a2a2a2, 0x007c7c7c, 0x00212121, 0x00101010, 0x8000015b, 0x00000000, 0x00000004, 0x00010101,
+  0x00010101, 0x00a7a7a7, 0x00b9b9b9, 0x8000001e, 0x00ffffff, 0x00000003, 0x00c0c0c0, 0x00959595,
+  0x001f1f1f, 0x8000008b, 0x00000000, 0x00000003, 0x00444444, 0x00989898, 0x00dadada, 0x8000000b,
+  0x00ffffff, 0x0000000a, 0x00fefefe, 0x00eeeeee, 0x00dddddd, 0x00acacac, 0x008f8f8f, 0x006c6c6c,
+  0x00494949, 0x00363636, 0x000e0e0e, 0x00070707, 0x8000015d, 0x00000000, 0x00000004, 0x004d4d4d,
+  0x00696969, 0x00e0e0e0, 0x00ececec, 0x8000001c, 0x00ffffff, 0x00000004, 0x00e4e4e4, 0x00d1d1d1,
+  0x004b4b4b, 0x00282828, 0x8000008a, 0x00000000, 0x00000003, 0x00444444, 0x00989898, 0x00dadada,
+  0x8000000b, 0x00ffffff, 0x00000007, 0x00fdfdfd, 0x00e0e0e0, 0x00c3c3c3, 0x006c6c6c, 0x003f3f3f,
+  0x00090909, 0x00030303, 0x80000160, 0x00000000, 0x00000004, 0x00080808, 0x002b2b2b, 0x00c7c7c7,
+  0x00dcdcdc, 0x8000001e, 0x00ffffff, 0x00000002, 0x006d6d6d, 0x00474747, 0x8000008a, 0x00000000,
+  0x00000003, 0x00444444, 0x00989898, 0x00dadada, 0x80000008, 0x00ffffff, 0x0000000a, 0x00e9e9e9,
+  0x00dedede, 0x00919191, 0x007f7f7f, 0x00393939, 0x00313131, 0x001a1a1a, 0x000f0f0f, 0x00020202,
+  0x00010101, 0x80000160, 0x00000000, 0x00000006, 0x00020202, 0x000d0d0d, 0x00404040, 0x00808080,
+  0x00e7e7e7, 0x00f5f5f5, 0x8000001c, 0x00ffffff, 0x00000004, 0x00cccccc, 0x00bfbfbf, 0x000f0f0f,
+  0x000b0b0b, 0x80000088, 0x00000000, 0x00000003, 0x00444444, 0x00989898, 0x00dadada, 0x80000008,
+  0x00ffffff, 0x00000006, 0x00e2e2e2, 0x00d3d3d3, 0x006e6e6e, 0x00585858, 0x00040404, 0x00030303,
+  0x80000165, 0x00000000, 0x00000005, 0x00040404, 0x00161616, 0x00636363, 0x00dfdfdf, 0x00f2f2f2,
+  0x8000001c, 0x00ffffff, 0x00000004, 0x00eaeaea, 0x00e5e5e5, 0x00131313, 0x000f0f0f, 0x80000088,
+  0x00000000, 0x00000003, 0x00444444, 0x00989898, 0x00dadada, 0x80000004, 0x00ffffff, 0x00000008,
+  0x00f1f1f1, 0x00c6c6c6, 0x00939393, 0x00535353, 0x00232323, 0x00090909, 0x00050505, 0x00030303,
+  0x80000168, 0x00000000, 0x00000006, 0x00010101, 0x00131313, 0x00313131, 0x00a1a1a1, 0x00f1f1f1,
+  0x00fcfcfc, 0x8000001a, 0x00ffffff, 0x00000004, 0x00fefefe, 0x00fefefe, 0x00919191, 0x00747474,
+  0x80000088, 0x00000000, 0x0000000d, 0x00444444, 0x00989898, 0x00dadada, 0x00ffffff, 0x00f5f5f5,
+  0x00f2f2f2, 0x00e0e0e0, 0x00d1d1d1, 0x00a5a5a5, 0x00787878, 0x00404040, 0x00171717, 0x00010101,
+  0x8000016b, 0x00000000, 0x00000005, 0x000d0d0d, 0x00232323, 0x008b8b8b, 0x00d6d6d6, 0x00f6f6f6,
+  0x8000001c, 0x00ffffff, 0x00000004, 0x00a6a6a6, 0x00868686, 0x00060606, 0x00040404, 0x80000086,
+  0x00000000, 0x00000008, 0x00444444, 0x00989898, 0x00dadada, 0x00ffffff, 0x00c0c0c0, 0x00aeaeae,
+  0x003c3c3c, 0x002d2d2d, 0x80000172, 0x00000000, 0x00000003, 0x002c2c2c, 0x004c4c4c, 0x00d8d8d8,
+  0x8000001c, 0x00ffffff, 0x00000004, 0x00fbfbfb, 0x00d2d2d2, 0x00262626, 0x00171717, 0x80000086,
+  0x00000000, 0x00000008, 0x00393939, 0x007f7f7f, 0x00a1a1a1, 0x00b4b4b4, 0x007d7d7d, 0x00707070,
+  0x00272727, 0x001d1d1d, 0x80000172, 0x00000000, 0x00000005, 0x001c1c1c, 0x00313131, 0x00b6b6b6,
+  0x00dcdcdc, 0x00fefefe, 0x8000001a, 0x00ffffff, 0x00000004, 0x00fcfcfc, 0x00dcdcdc, 0x00565656,
+  0x00343434, 0x80000086, 0x00000000, 0x00000005, 0x00252525, 0x00535353, 0x003b3b3b, 0x002d2d2d,
+  0x00070707, 0x80000177, 0x00000000, 0x00000003, 0x007a7a7a, 0x009c9c9c, 0x00fdfdfd, 0x8000001b,
+  0x00ffffff, 0x00000003, 0x00efefef, 0x00adadad, 0x00696969, 0x80000086, 0x00000000, 0x00000005,
+  0x00101010, 0x00252525, 0x001a1a1a, 0x00141414, 0x00030303, 0x80000177, 0x00000000, 0x00000004,
+  0x003c3c3c, 0x004d4d4d, 0x00ebebeb, 0x00f1f1f1, 0x8000001a, 0x00ffffff, 0x00000005, 0x00f8f8f8,
+  0x00dbdbdb, 0x00919191, 0x00202020, 0x000d0d0d, 0x80000200, 0x00000000, 0x00000004, 0x000b0b0b,
+  0x000e0e0e, 0x00dddddd, 0x00e6e6e6, 0x8000001c, 0x00ffffff, 0x00000003, 0x00b1b1b1, 0x00393939,
+  0x00171717, 0x80000200, 0x00000000, 0x00000005, 0x00030303, 0x00030303, 0x00676767, 0x00848484,
+  0x00fefefe, 0x8000001b, 0x00ffffff, 0x00000003, 0x00dadada, 0x00a1a1a1, 0x00414141, 0x80000202,
+  0x00000000, 0x00000004, 0x00414141, 0x00656565, 0x00fefefe, 0x00fefefe, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00e7e7e7, 0x00c3c3c3, 0x004f4f4f, 0x80000202, 0x00000000, 0x00000004, 0x00030303,
+  0x001f1f1f, 0x00999999, 0x00c0c0c0, 0x8000001a, 0x00ffffff, 0x00000005, 0x00fefefe, 0x00fcfcfc,
+  0x00919191, 0x00484848, 0x000f0f0f, 0x80000201, 0x00000000, 0x00000005, 0x00171717, 0x007f7f7f,
+  0x00b0b0b0, 0x00fdfdfd, 0x00fefefe, 0x8000001a, 0x00ffffff, 0x00000003, 0x009d9d9d, 0x005b5b5b,
+  0x00131313, 0x80000201, 0x00000000, 0x00000005, 0x00030303, 0x000f0f0f, 0x00656565, 0x00efefef,
+  0x00f8f8f8, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00b4b4b4, 0x00252525, 0x800001a9,
+  0x00000000, 0x00000003, 0x00090909, 0x00181818, 0x001e1e1e, 0x80000018, 0x00222222, 0x00000003,
+  0x00202020, 0x001d1d1d, 0x000d0d0d, 0x8000001a, 0x00000000, 0x00000008, 0x00070707, 0x000d0d0d,
+  0x00191919, 0x001d1d1d, 0x00121212, 0x000f0f0f, 0x00010101, 0x00010101, 0x80000018, 0x00000000,
+  0x00000005, 0x00020202, 0x000a0a0a, 0x00525252, 0x00c6c6c6, 0x00e8e8e8, 0x8000001a, 0x00ffffff,
+  0x00000004, 0x00e1e1e1, 0x00cdcdcd, 0x00313131, 0x000a0a0a, 0x800001a8, 0x00000000, 0x00000003,
+  0x00181818, 0x00454545, 0x00545454, 0x80000018, 0x00606060, 0x00000003, 0x005b5b5b, 0x00515151,
+  0x00232323, 0x8000001a, 0x00000000, 0x00000008, 0x00151515, 0x00242424, 0x00474747, 0x00515151,
+  0x00323232, 0x00292929, 0x00040404, 0x00030303, 0x8000001a, 0x00000000, 0x00000003, 0x00303030,
+  0x007c7c7c, 0x00c9c9c9, 0x8000001a, 0x00ffffff, 0x00000004, 0x00fdfdfd, 0x00fcfcfc, 0x00494949,
+  0x001b1b1b, 0x800001a8, 0x00000000, 0x00000003, 0x002f2f2f, 0x00858585, 0x00a1a1a1, 0x80000018,
+  0x00b8b8b8, 0x00000003, 0x00aeaeae, 0x009c9c9c, 0x00444444, 0x80000016, 0x00000000, 0x00000010,
+  0x000a0a0a, 0x00383838, 0x00535353, 0x00828282, 0x00888888, 0x008d8d8d, 0x00898989, 0x00888888,
+  0x008b8b8b, 0x008b8b8b, 0x00898989, 0x00737373, 0x004f4f4f, 0x00252525, 0x00060606, 0x00010101,
+  0x80000016, 0x00000000, 0x00000005, 0x00181818, 0x003f3f3f, 0x00a9a9a9, 0x00f5f5f5, 0x00fdfdfd,
+  0x80000018, 0x00ffffff, 0x00000004, 0x00fefefe, 0x00fefefe, 0x00747474, 0x00515151, 0x800001a8,
+  0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000016, 0x00000000, 0x00000010, 0x00111111, 0x00656565,
+  0x00979797, 0x00ebebeb, 0x00e6e6e6, 0x00e2e2e2, 0x00bfbfbf, 0x00b5b5b5, 0x00d4d4d4, 0x00dadada,
+  0x00f4f4f4, 0x00cecece, 0x008f8f8f, 0x00424242, 0x000a0a0a, 0x00020202, 0x80000016, 0x00000000,
+  0x00000005, 0x00050505, 0x000d0d0d, 0x00909090, 0x00ececec, 0x00fbfbfb, 0x8000001a, 0x00ffffff,
+  0x00000002, 0x00979797, 0x007c7c7c, 0x8000005a, 0x00000000, 0x00000002, 0x000f0f0f, 0x00171717,
+  0x8000001a, 0x00303030, 0x00000003, 0x00272727, 0x000c0c0c, 0x00070707, 0x8000012f, 0x00000000,
+  0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1,
+  0x00d8d8d8, 0x005f5f5f, 0x80000013, 0x00000000, 0x00000014, 0x00010101, 0x00020202, 0x00838383,
+  0x008e8e8e, 0x00b5b5b5, 0x00979797, 0x00636363, 0x00545454, 0x00494949, 0x003d3d3d, 0x003a3a3a,
+  0x00353535, 0x00393939, 0x004c4c4c, 0x006c6c6c, 0x00a2a2a2, 0x00a5a5a5, 0x00a7a7a7, 0x00353535,
+  0x00141414, 0x80000015, 0x00000000, 0x00000005, 0x00010101, 0x00030303, 0x00585858, 0x00949494,
+  0x00e8e8e8, 0x8000001a, 0x00ffffff, 0x00000004, 0x00d2d2d2, 0x00c6c6c6, 0x00010101, 0x00010101,
+  0x80000057, 0x00000000, 0x00000003, 0x00010101, 0x00141414, 0x001e1e1e, 0x8000001a, 0x00404040,
+  0x00000003, 0x00343434, 0x00101010, 0x00090909, 0x8000012f, 0x00000000, 0x00000003, 0x00414141,
+  0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f,
+  0x80000013, 0x00000000, 0x00000015, 0x00020202, 0x00020202, 0x00aeaeae, 0x00b8b8b8, 0x00d0d0d0,
+  0x00979797, 0x00363636, 0x00242424, 0x00161616, 0x00121212, 0x00111111, 0x00000000, 0x00030303,
+  0x00141414, 0x004c4c4c, 0x00a8a8a8, 0x00c5c5c5, 0x00dbdbdb, 0x00464646, 0x001b1b1b, 0x00010101,
+  0x80000016, 0x00000000, 0x00000003, 0x00464646, 0x00777777, 0x00e2e2e2, 0x8000001a, 0x00ffffff,
+  0x00000004, 0x00e6e6e6, 0x00dfdfdf, 0x00020202, 0x00010101, 0x80000057, 0x00000000, 0x00000003,
+  0x00020202, 0x004d4d4d, 0x00747474, 0x8000001a, 0x00f5f5f5, 0x00000003, 0x00c9c9c9, 0x003e3e3e,
+  0x00222222, 0x8000012f, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018,
+  0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000013, 0x00000000, 0x00000008,
+  0x00535353, 0x006c6c6c, 0x00c4c4c4, 0x00aaaaaa, 0x001b1b1b, 0x00666666, 0x00e3e3e3, 0x00ececec,
+  0x80000003, 0x00f3f3f3, 0x0000000a, 0x00d0d0d0, 0x00c1c1c1, 0x007e7e7e, 0x00525252, 0x00080808,
+  0x00535353, 0x008a8a8a, 0x00a6a6a6, 0x00aeaeae, 0x00040404, 0x80000016, 0x00000000, 0x00000004,
+  0x000a0a0a, 0x00101010, 0x00bcbcbc, 0x00eaeaea, 0x80000019, 0x00ffffff, 0x00000004, 0x00fefefe,
+  0x00fdfdfd, 0x00424242, 0x00353535, 0x80000057, 0x00000000, 0x00000003, 0x00020202, 0x00505050,
+  0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d1d1d1, 0x00404040, 0x00242424, 0x8000012f,
+  0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000, 0x00000018, 0x00020202, 0x00030303,
+  0x00676767, 0x00858585, 0x00afafaf, 0x00959595, 0x00131313, 0x00656565, 0x00efefef, 0x00eeeeee,
+  0x00eeeeee, 0x00e6e6e6, 0x00e4e4e4, 0x00d2d2d2, 0x00c8c8c8, 0x00969696, 0x00616161, 0x00070707,
+  0x00454545, 0x00737373, 0x00ababab, 0x00bbbbbb, 0x00101010, 0x000a0a0a, 0x80000015, 0x00000000,
+  0x00000004, 0x00050505, 0x00090909, 0x00adadad, 0x00dadada, 0x8000001b, 0x00ffffff, 0x00000002,
+  0x00545454, 0x00434343, 0x80000057, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00d1d1d1, 0x00404040, 0x00242424, 0x8000012f, 0x00000000,
+  0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1,
+  0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000, 0x00000018, 0x000a0a0a, 0x00121212, 0x00bdbdbd,
+  0x00f0f0f0, 0x002f2f2f, 0x00262626, 0x00181818, 0x006e6e6e, 0x00ffffff, 0x00bebebe, 0x008e8e8e,
+  0x00595959, 0x00494949, 0x00a2a2a2, 0x00b4b4b4, 0x00ffffff, 0x00b2b2b2, 0x00313131, 0x00181818,
+  0x00060606, 0x00a7a7a7, 0x00d5d5d5, 0x00525252, 0x00414141, 0x80000017, 0x00000000, 0x00000003,
+  0x00696969, 0x00858585, 0x00fdfdfd, 0x8000001a, 0x00ffffff, 0x00000002, 0x00a3a3a3, 0x00838383,
+  0x80000057, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00d1d1d1, 0x00404040, 0x00242424, 0x8000012f, 0x00000000, 0x00000003, 0x00414141,
+  0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f,
+  0x80000011, 0x00000000, 0x00000018, 0x00151515, 0x00252525, 0x00b6b6b6, 0x00e1e1e1, 0x00212121,
+  0x001a1a1a, 0x00181818, 0x006e6e6e, 0x00ffffff, 0x00b7b7b7, 0x00818181, 0x00424242, 0x00303030,
+  0x007d7d7d, 0x00969696, 0x00ffffff, 0x00b5b5b5, 0x00393939, 0x001a1a1a, 0x00040404, 0x008e8e8e,
+  0x00b6b6b6, 0x00676767, 0x00545454, 0x80000017, 0x00000000, 0x00000003, 0x004f4f4f, 0x00646464,
+  0x00fdfdfd, 0x8000001a, 0x00ffffff, 0x00000002, 0x00bcbcbc, 0x00979797, 0x80000057, 0x00000000,
+  0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d1d1d1,
+  0x00404040, 0x00242424, 0x8000012f, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf,
+  0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000,
+  0x00000018, 0x00292929, 0x00484848, 0x00a8a8a8, 0x00c5c5c5, 0x00060606, 0x00040404, 0x00181818,
+  0x006e6e6e, 0x00ffffff, 0x00a9a9a9, 0x00686868, 0x00181818, 0x00000000, 0x00393939, 0x005d5d5d,
+  0x00ffffff, 0x00bababa, 0x00474747, 0x001e1e1e, 0x00000000, 0x005f5f5f, 0x007b7b7b, 0x00909090,
+  0x00767676, 0x80000017, 0x00000000, 0x00000003, 0x001f1f1f, 0x00272727, 0x00fcfcfc, 0x8000001a,
+  0x00ffffff, 0x00000004, 0x00eaeaea, 0x00bcbcbc, 0x00010101, 0x00010101, 0x80000055, 0x00000000,
+  0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d1d1d1,
+  0x00404040, 0x00242424, 0x8000012f, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf,
+  0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000,
+  0x00000018, 0x00393939, 0x00646464, 0x009a9a9a, 0x00aaaaaa, 0x00050505, 0x00040404, 0x00181818,
+  0x006e6e6e, 0x00ffffff, 0x00c6c6c6, 0x009b9b9b, 0x00686868, 0x00595959, 0x00959595, 0x00a7a7a7,
+  0x00f1f1f1, 0x00a5a5a5, 0x00262626, 0x00101010, 0x00000000, 0x00484848, 0x005d5d5d, 0x00ababab,
+  0x008e8e8e, 0x80000017, 0x00000000, 0x00000004, 0x000e0e0e, 0x00121212, 0x00dedede, 0x00e7e7e7,
+  0x80000019, 0x00ffffff, 0x00000004, 0x00f6f6f6, 0x00cacaca, 0x001b1b1b, 0x00101010, 0x80000055,
+  0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00d1d1d1, 0x00404040, 0x00242424, 0x8000012f, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8,
+  0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011,
+  0x00000000, 0x00000018, 0x00474747, 0x007c7c7c, 0x008e8e8e, 0x00939393, 0x00040404, 0x00040404,
+  0x00181818, 0x006e6e6e, 0x00ffffff, 0x00dedede, 0x00c5c5c5, 0x00aaaaaa, 0x00a2a2a2, 0x00e1e1e1,
+  0x00e4e4e4, 0x00e6e6e6, 0x00949494, 0x000b0b0b, 0x00050505, 0x00000000, 0x00353535, 0x00444444,
+  0x00c1c1c1, 0x00a1a1a1, 0x80000019, 0x00000000, 0x00000002, 0x00c5c5c5, 0x00d2d2d2, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00d6d6d6, 0x00303030, 0x001d1d1d, 0x80000055, 0x00000000, 0x00000003,
+  0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d1d1d1, 0x00404040,
+  0x00242424, 0x8000012f, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018,
+  0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000, 0x0000000a,
+  0x00404040, 0x00717171, 0x00949494, 0x009e9e9e, 0x00050505, 0x00040404, 0x00181818, 0x006e6e6e,
+  0x00ffffff, 0x00dfdfdf, 0x80000003, 0x00c7c7c7, 0x0000000b, 0x00f6f6f6, 0x00dbdbdb, 0x00585858,
+  0x00383838, 0x00030303, 0x00010101, 0x00000000, 0x003e3e3e, 0x00505050, 0x00b6b6b6, 0x00989898,
+  0x80000019, 0x00000000, 0x00000002, 0x007f7f7f, 0x00999999, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00e0e0e0, 0x00636363, 0x003c3c3c, 0x80000055, 0x00000000, 0x00000003, 0x00020202, 0x00505050,
+  0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d1d1d1, 0x00404040, 0x00242424, 0x8000012f,
+  0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000, 0x00000011, 0x003e3e3e, 0x006d6d6d,
+  0x00969696, 0x00a2a2a2, 0x00050505, 0x00040404, 0x00181818, 0x006e6e6e, 0x00ffffff, 0x00e0e0e0,
+  0x00c8c8c8, 0x00d1d1d1, 0x00d3d3d3, 0x00fdfdfd, 0x00d9d9d9, 0x00282828, 0x00191919, 0x80000003,
+  0x00000000, 0x00000004, 0x00414141, 0x00545454, 0x00b3b3b3, 0x00959595, 0x80000019, 0x00000000,
+  0x00000002, 0x00686868, 0x00858585, 0x8000001a, 0x00ffffff, 0x00000003, 0x00e4e4e4, 0x00757575,
+  0x00464646, 0x80000055, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00d1d1d1, 0x00404040, 0x00242424, 0x8000012f, 0x00000000, 0x00000003,
+  0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8,
+  0x005f5f5f, 0x80000011, 0x00000000, 0x00000011, 0x00212121, 0x003a3a3a, 0x00b1b1b1, 0x00d4d4d4,
+  0x00060606, 0x00040404, 0x00181818, 0x006e6e6e, 0x00ffffff, 0x00b4b4b4, 0x007c7c7c, 0x00424242,
+  0x00313131, 0x00f5f5f5, 0x00e9e9e9, 0x00999999, 0x00606060, 0x80000003, 0x00000000, 0x00000004,
+  0x006c6c6c, 0x008b8b8b, 0x00828282, 0x006b6b6b, 0x80000019, 0x00000000, 0x00000004, 0x00161616,
+  0x00404040, 0x00f8f8f8, 0x00fbfbfb, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00b6b6b6,
+  0x006e6e6e, 0x80000055, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00d1d1d1, 0x00404040, 0x00242424, 0x80000084, 0x00000000, 0x00000003,
+  0x00020202, 0x00080808, 0x00101010, 0x8000001a, 0x00191919, 0x00000003, 0x000e0e0e, 0x00030303,
+  0x00010101, 0x8000008b, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018,
+  0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000, 0x00000018,
+  0x001b1b1b, 0x00303030, 0x00b1b1b1, 0x00d8d8d8, 0x00131313, 0x000f0f0f, 0x00181818, 0x006e6e6e,
+  0x00ffffff, 0x00b2b2b2, 0x00787878, 0x00363636, 0x00222222, 0x00e5e5e5, 0x00e0e0e0, 0x00aeaeae,
+  0x00707070, 0x00080808, 0x00060606, 0x00040404, 0x007a7a7a, 0x009c9c9c, 0x00747474, 0x005f5f5f,
+  0x80000019, 0x00000000, 0x00000004, 0x000e0e0e, 0x00383838, 0x00eeeeee, 0x00f5f5f5, 0x80000018,
+  0x00ffffff, 0x00000004, 0x00f3f3f3, 0x00c3c3c3, 0x00767676, 0x00010101, 0x80000054, 0x00000000,
+  0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d1d1d1,
+  0x00404040, 0x00242424, 0x80000084, 0x00000000, 0x00000003, 0x00101010, 0x00373737, 0x00727272,
+  0x8000001a, 0x00b0b0b0, 0x00000003, 0x00636363, 0x00161616, 0x00070707, 0x8000008b, 0x00000000,
+  0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1,
+  0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000, 0x00000018, 0x00030303, 0x00060606, 0x00aaaaaa,
+  0x00dbdbdb, 0x005d5d5d, 0x004e4e4e, 0x00181818, 0x006e6e6e, 0x00ffffff, 0x00b2b2b2, 0x00787878,
+  0x001b1b1b, 0x00000000, 0x008a8a8a, 0x00a2a2a2, 0x00fefefe, 0x00b4b4b4, 0x00393939, 0x00292929,
+  0x001e1e1e, 0x00bebebe, 0x00ececec, 0x00313131, 0x00252525, 0x8000001a, 0x00000000, 0x00000003,
+  0x00212121, 0x00b2b2b2, 0x00d0d0d0, 0x80000018, 0x00ffffff, 0x00000005, 0x00fdfdfd, 0x00f7f7f7,
+  0x00989898, 0x00080808, 0x00030303, 0x80000053, 0x00000000, 0x00000003, 0x00020202, 0x00505050,
+  0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d1d1d1, 0x00404040, 0x00242424, 0x80000084,
+  0x00000000, 0x00000003, 0x00121212, 0x00404040, 0x00848484, 0x8000001a, 0x00cbcbcb, 0x00000003,
+  0x00727272, 0x00191919, 0x00080808, 0x8000008b, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8,
+  0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011,
+  0x00000000, 0x00000018, 0x00020202, 0x00040404, 0x007f7f7f, 0x00a4a4a4, 0x008c8c8c, 0x00797979,
+  0x00252525, 0x00676767, 0x00d8d8d8, 0x00949494, 0x00626262, 0x00161616, 0x00000000, 0x00606060,
+  0x00777777, 0x00d7d7d7, 0x00a1a1a1, 0x00484848, 0x00515151, 0x00575757, 0x00adadad, 0x00c6c6c6,
+  0x00212121, 0x00181818, 0x8000001a, 0x00000000, 0x00000003, 0x001d1d1d, 0x009d9d9d, 0x00c3c3c3,
+  0x80000018, 0x00ffffff, 0x00000005, 0x00fefefe, 0x00fafafa, 0x00a2a2a2, 0x001c1c1c, 0x000b0b0b,
+  0x80000053, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00d1d1d1, 0x00404040, 0x00242424, 0x80000084, 0x00000000, 0x00000003, 0x00171717,
+  0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a,
+  0x8000008b, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff,
+  0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000013, 0x00000000, 0x00000015, 0x002e2e2e,
+  0x003c3c3c, 0x00e5e5e5, 0x00cccccc, 0x003d3d3d, 0x005a5a5a, 0x008c8c8c, 0x005c5c5c, 0x00393939,
+  0x000d0d0d, 0x00000000, 0x000f0f0f, 0x00252525, 0x008c8c8c, 0x007e7e7e, 0x00666666, 0x009c9c9c,
+  0x00c4c4c4, 0x008d8d8d, 0x007d7d7d, 0x00030303, 0x8000001b, 0x00000000, 0x00000003, 0x00161616,
+  0x00747474, 0x00aaaaaa, 0x8000001a, 0x00ffffff, 0x00000003, 0x00b4b4b4, 0x00434343, 0x001b1b1b,
+  0x8000003f, 0x00000000, 0x00000003, 0x00010101, 0x00262626, 0x002d2d2d, 0x80000011, 0x00000000,
+  0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d1d1d1,
+  0x00404040, 0x00242424, 0x80000084, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000008b, 0x00000000,
+  0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1,
+  0x00d8d8d8, 0x005f5f5f, 0x80000013, 0x00000000, 0x00000015, 0x00151515, 0x001b1b1b, 0x009b9b9b,
+  0x009e9e9e, 0x009d9d9d, 0x00979797, 0x008d8d8d, 0x00606060, 0x003e3e3e, 0x00171717, 0x000b0b0b,
+  0x00232323, 0x00333333, 0x007d7d7d, 0x008f8f8f, 0x00aeaeae, 0x00aaaaaa, 0x00a7a7a7, 0x00545454,
+  0x003b3b3b, 0x00010101, 0x8000001b, 0x00000000, 0x00000003, 0x00101010, 0x00535353, 0x00969696,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00bebebe, 0x005b5b5b, 0x00252525, 0x8000003e, 0x00000000,
+  0x00000004, 0x00010101, 0x00010101, 0x00464646, 0x00535353, 0x80000011, 0x00000000, 0x00000003,
+  0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d1d1d1, 0x00404040,
+  0x00242424, 0x80000084, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000008b, 0x00000000, 0x00000003,
+  0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8,
+  0x005f5f5f, 0x80000015, 0x00000000, 0x00000012, 0x005c5c5c, 0x00777777, 0x00eeeeee, 0x00cacaca,
+  0x008d8d8d, 0x00626262, 0x00424242, 0x001f1f1f, 0x00151515, 0x00343434, 0x003f3f3f, 0x00717171,
+  0x009e9e9e, 0x00eaeaea, 0x00b6b6b6, 0x008f8f8f, 0x00232323, 0x00040404, 0x8000001c, 0x00000000,
+  0x00000003, 0x000b0b0b, 0x00383838, 0x00858585, 0x8000001a, 0x00ffffff, 0x00000003, 0x00c6c6c6,
+  0x00707070, 0x002d2d2d, 0x8000003c, 0x00000000, 0x00000006, 0x00010101, 0x00020202, 0x004c4c4c,
+  0x00787878, 0x00989898, 0x009b9b9b, 0x80000011, 0x00000000, 0x00000003, 0x00020202, 0x00505050,
+  0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d1d1d1, 0x00404040, 0x00242424, 0x80000084,
+  0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00909090, 0x00202020, 0x000a0a0a, 0x8000008b, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8,
+  0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000015,
+  0x00000000, 0x00000012, 0x00181818, 0x00232323, 0x00555555, 0x006e6e6e, 0x00979797, 0x00a2a2a2,
+  0x00ababab, 0x00bababa, 0x00bebebe, 0x00b1b1b1, 0x00adadad, 0x009b9b9b, 0x00898989, 0x006b6b6b,
+  0x00434343, 0x00252525, 0x00090909, 0x00010101, 0x8000001c, 0x00000000, 0x00000005, 0x00040404,
+  0x00131313, 0x006c6c6c, 0x00f8f8f8, 0x00fcfcfc, 0x80000018, 0x00ffffff, 0x00000003, 0x00d2d2d2,
+  0x008d8d8d, 0x00393939, 0x8000003c, 0x00000000, 0x00000006, 0x00010101, 0x00030303, 0x00666666,
+  0x00a2a2a2, 0x00b4b4b4, 0x00b4b4b4, 0x80000011, 0x00000000, 0x00000003, 0x00020202, 0x00505050,
+  0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d1d1d1, 0x00404040, 0x00242424, 0x80000084,
+  0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00909090, 0x00202020, 0x000a0a0a, 0x8000008b, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8,
+  0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000016,
+  0x00000000, 0x0000000e, 0x00050505, 0x00202020, 0x004e4e4e, 0x009b9b9b, 0x00b9b9b9, 0x00cfcfcf,
+  0x00efefef, 0x00f9f9f9, 0x00dddddd, 0x00d3d3d3, 0x00aaaaaa, 0x00828282, 0x003f3f3f, 0x001b1b1b,
+  0x8000001f, 0x00000000, 0x00000005, 0x00010101, 0x00060606, 0x00636363, 0x00f6f6f6, 0x00fbfbfb,
+  0x80000018, 0x00ffffff, 0x00000003, 0x00d6d6d6, 0x00979797, 0x003d3d3d, 0x8000003a, 0x00000000,
+  0x00000008, 0x00010101, 0x00050505, 0x00464646, 0x00a0a0a0, 0x00d8d8d8, 0x00f9f9f9, 0x00c4c4c4,
+  0x00b4b4b4, 0x80000011, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00d1d1d1, 0x00404040, 0x00242424, 0x80000084, 0x00000000, 0x00000003,
+  0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x008f8f8f, 0x00202020,
+  0x000a0a0a, 0x8000008b, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018,
+  0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000017, 0x00000000, 0x0000000d,
+  0x00020202, 0x00050505, 0x00090909, 0x000b0b0b, 0x000c0c0c, 0x000f0f0f, 0x00101010, 0x000d0d0d,
+  0x000d0d0d, 0x000a0a0a, 0x00080808, 0x00040404, 0x00020202, 0x80000021, 0x00000000, 0x00000003,
+  0x004c4c4c, 0x00c4c4c4, 0x00e7e7e7, 0x80000018, 0x00ffffff, 0x00000003, 0x00e4e4e4, 0x00bbbbbb,
+  0x004b4b4b, 0x80000039, 0x00000000, 0x00000009, 0x00010101, 0x00070707, 0x001d1d1d, 0x005d5d5d,
+  0x00b6b6b6, 0x00e3e3e3, 0x00ffffff, 0x00c5c5c5, 0x00b4b4b4, 0x80000011, 0x00000000, 0x00000003,
+  0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d1d1d1, 0x00404040,
+  0x00242424, 0x80000084, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000008b, 0x00000000, 0x00000003,
+  0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8,
+  0x005f5f5f, 0x8000001c, 0x00000000, 0x00000002, 0x00010101, 0x00010101, 0x80000027, 0x00000000,
+  0x00000003, 0x00484848, 0x00b9b9b9, 0x00e2e2e2, 0x80000018, 0x00ffffff, 0x00000003, 0x00e7e7e7,
+  0x00c2c2c2, 0x004e4e4e, 0x80000039, 0x00000000, 0x00000004, 0x00070707, 0x002d2d2d, 0x00b2b2b2,
+  0x00d2d2d2, 0x80000003, 0x00ffffff, 0x00000002, 0x00c5c5c5, 0x00b4b4b4, 0x80000011, 0x00000000,
+  0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d1d1d1,
+  0x00404040, 0x00242424, 0x80000084, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000008b, 0x00000000,
+  0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1,
+  0x00d8d8d8, 0x005f5f5f, 0x80000045, 0x00000000, 0x00000003, 0x00343434, 0x00858585, 0x00cdcdcd,
+  0x80000018, 0x00ffffff, 0x00000003, 0x00f4f4f4, 0x00e4e4e4, 0x005c5c5c, 0x80000037, 0x00000000,
+  0x00000006, 0x00030303, 0x00050505, 0x00444444, 0x00626262, 0x00cccccc, 0x00e2e2e2, 0x80000003,
+  0x00ffffff, 0x00000002, 0x00c5c5c5, 0x00b4b4b4, 0x80000011, 0x00000000, 0x00000003, 0x00020202,
+  0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d1d1d1, 0x00404040, 0x00242424,
+  0x80000084, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000008b, 0x00000000, 0x00000003, 0x00414141,
+  0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f,
+  0x80000045, 0x00000000, 0x00000003, 0x002e2e2e, 0x00757575, 0x00c6c6c6, 0x80000018, 0x00ffffff,
+  0x00000005, 0x00f8f8f8, 0x00ededed, 0x00616161, 0x00040404, 0x00010101, 0x80000035, 0x00000000,
+  0x00000004, 0x00080808, 0x000d0d0d, 0x00bababa, 0x00c9c9c9, 0x80000005, 0x00ffffff, 0x00000002,
+  0x00c5c5c5, 0x00b4b4b4, 0x80000011, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00d1d1d1, 0x00404040, 0x00242424, 0x80000084, 0x00000000,
+  0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090,
+  0x00202020, 0x000a0a0a, 0x8000008b, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf,
+  0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000045, 0x00000000,
+  0x00000003, 0x00222222, 0x00575757, 0x00bababa, 0x8000001a, 0x00ffffff, 0x00000003, 0x006d6d6d,
+  0x000b0b0b, 0x00020202, 0x80000033, 0x00000000, 0x00000006, 0x00040404, 0x00070707, 0x005a5a5a,
+  0x006f6f6f, 0x00dfdfdf, 0x00e6e6e6, 0x80000005, 0x00ffffff, 0x00000002, 0x00c5c5c5, 0x00b4b4b4,
+  0x80000011, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00d1d1d1, 0x00404040, 0x00242424, 0x80000084, 0x00000000, 0x00000003, 0x00171717,
+  0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a,
+  0x8000008b, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff,
+  0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000045, 0x00000000, 0x00000003, 0x001d1d1d,
+  0x004b4b4b, 0x00b5b5b5, 0x8000001a, 0x00ffffff, 0x00000003, 0x00797979, 0x001f1f1f, 0x00060606,
+  0x80000033, 0x00000000, 0x00000004, 0x00080808, 0x000d0d0d, 0x00a0a0a0, 0x00c2c2c2, 0x80000007,
+  0x00ffffff, 0x00000002, 0x00c5c5c5, 0x00b4b4b4, 0x80000011, 0x00000000, 0x00000003, 0x00020202,
+  0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d1d1d1, 0x00404040, 0x00242424,
+  0x80000084, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000008b, 0x00000000, 0x00000003, 0x00414141,
+  0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f,
+  0x80000045, 0x00000000, 0x00000003, 0x00191919, 0x00414141, 0x00b1b1b1, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00848484, 0x00313131, 0x000a0a0a, 0x80000031, 0x00000000, 0x00000006, 0x00050505,
+  0x000c0c0c, 0x00626262, 0x00979797, 0x00dfdfdf, 0x00efefef, 0x80000007, 0x00ffffff, 0x00000002,
+  0x00c5c5c5, 0x00b4b4b4, 0x80000011, 0x00000000, 0x00000003, 0x00010101, 0x00333333, 0x004c4c4c,
+  0x8000001a, 0x00a1a1a1, 0x00000003, 0x00848484, 0x00282828, 0x00171717, 0x80000084, 0x00000000,
+  0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x008f8f8f,
+  0x00202020, 0x000a0a0a, 0x8000008b, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf,
+  0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000045, 0x00000000,
+  0x00000003, 0x00131313, 0x00303030, 0x00aaaaaa, 0x8000001a, 0x00ffffff, 0x00000003, 0x00939393,
+  0x004b4b4b, 0x000f0f0f, 0x80000031, 0x00000000, 0x00000005, 0x00070707, 0x00101010, 0x00828282,
+  0x00c8c8c8, 0x00f5f5f5, 0x80000008, 0x00ffffff, 0x00000002, 0x00c5c5c5, 0x00b4b4b4, 0x80000011,
+  0x00000000, 0x00000003, 0x00010101, 0x00282828, 0x003c3c3c, 0x8000001a, 0x00808080, 0x00000003,
+  0x00696969, 0x00202020, 0x00121212, 0x80000084, 0x00000000, 0x00000003, 0x00171717, 0x00505050,
+  0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000008b,
+  0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000045, 0x00000000, 0x00000003, 0x00101010, 0x002a2a2a,
+  0x00a7a7a7, 0x8000001a, 0x00ffffff, 0x00000003, 0x00999999, 0x00545454, 0x00111111, 0x8000002f,
+  0x00000000, 0x00000007, 0x00040404, 0x00131313, 0x005c5c5c, 0x00c3c3c3, 0x00e6e6e6, 0x00fbfbfb,
+  0x00fefefe, 0x80000008, 0x00ffffff, 0x00000002, 0x00c5c5c5, 0x00b4b4b4, 0x80000012, 0x00000000,
+  0x00000002, 0x00030303, 0x00040404, 0x8000001a, 0x00080808, 0x00000003, 0x00070707, 0x00020202,
+  0x00010101, 0x80000084, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000008b, 0x00000000, 0x00000003,
+  0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8,
+  0x005f5f5f, 0x80000045, 0x00000000, 0x00000003, 0x00080808, 0x00151515, 0x009f9f9f, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00a0a0a0, 0x00616161, 0x00131313, 0x8000002e, 0x00000000, 0x00000006,
+  0x00030303, 0x000c0c0c, 0x002e2e2e, 0x00747474, 0x00d5d5d5, 0x00efefef, 0x8000000a, 0x00ffffff,
+  0x00000002, 0x00bebebe, 0x00acacac, 0x800000b5, 0x00000000, 0x00000003, 0x00171717, 0x00505050,
+  0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000008b,
+  0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000045, 0x00000000, 0x00000003, 0x00070707, 0x00111111,
+  0x009d9d9d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00a2a2a2, 0x00636363, 0x00141414, 0x8000002e,
+  0x00000000, 0x00000004, 0x00161616, 0x003f3f3f, 0x00d5d5d5, 0x00e7e7e7, 0x8000000c, 0x00ffffff,
+  0x00000002, 0x00939393, 0x00797979, 0x800000b5, 0x00000000, 0x00000003, 0x00171717, 0x00505050,
+  0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000008b,
+  0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000046, 0x00000000, 0x00000004, 0x00010101, 0x00959595,
+  0x00fcfcfc, 0x00fefefe, 0x80000018, 0x00ffffff, 0x00000003, 0x00a8a8a8, 0x006d6d6d, 0x00161616,
+  0x8000002c, 0x00000000, 0x00000006, 0x00020202, 0x00040404, 0x00515151, 0x00707070, 0x00e3e3e3,
+  0x00efefef, 0x8000000a, 0x00ffffff, 0x00000004, 0x00eeeeee, 0x00e4e4e4, 0x006d6d6d, 0x00515151,
+  0x800000b5, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000008b, 0x00000000, 0x00000003, 0x00414141,
+  0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f,
+  0x80000046, 0x00000000, 0x00000004, 0x00010101, 0x00919191, 0x00f5f5f5, 0x00fdfdfd, 0x80000018,
+  0x00ffffff, 0x00000003, 0x00aaaaaa, 0x00717171, 0x00171717, 0x8000002c, 0x00000000, 0x00000004,
+  0x00060606, 0x000a0a0a, 0x00c6c6c6, 0x00d2d2d2, 0x8000000c, 0x00ffffff, 0x00000004, 0x00cdcdcd,
+  0x00afafaf, 0x00202020, 0x00010101, 0x800000b5, 0x00000000, 0x00000003, 0x00171717, 0x00505050,
+  0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000008b,
+  0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000047, 0x00000000, 0x00000003, 0x00888888, 0x00e7e7e7,
+  0x00fafafa, 0x80000018, 0x00ffffff, 0x00000003, 0x00aeaeae, 0x00787878, 0x00181818, 0x8000002c,
+  0x00000000, 0x00000004, 0x004a4a4a, 0x005d5d5d, 0x00e4e4e4, 0x00eaeaea, 0x8000000a, 0x00ffffff,
+  0x00000005, 0x00f5f5f5, 0x00e7e7e7, 0x008e8e8e, 0x00585858, 0x00101010, 0x800000b6, 0x00000000,
+  0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090,
+  0x00202020, 0x000a0a0a, 0x8000008b, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf,
+  0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000047, 0x00000000,
+  0x00000003, 0x00818181, 0x00dbdbdb, 0x00f7f7f7, 0x80000018, 0x00ffffff, 0x00000003, 0x00b2b2b2,
+  0x007e7e7e, 0x00191919, 0x8000002c, 0x00000000, 0x00000002, 0x00878787, 0x00a6a6a6, 0x8000000c,
+  0x00ffffff, 0x00000005, 0x00ececec, 0x00d2d2d2, 0x00575757, 0x000c0c0c, 0x00020202, 0x800000b6,
+  0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00909090, 0x00202020, 0x000a0a0a, 0x8000008b, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8,
+  0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000047,
+  0x00000000, 0x00000003, 0x007b7b7b, 0x00d1d1d1, 0x00f5f5f5, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00b5b5b5, 0x00838383, 0x001a1a1a, 0x8000002a, 0x00000000, 0x00000004, 0x00393939, 0x005c5c5c,
+  0x00cdcdcd, 0x00e7e7e7, 0x8000000a, 0x00ffffff, 0x00000007, 0x00fcfcfc, 0x00f0f0f0, 0x00adadad,
+  0x00515151, 0x00202020, 0x00030303, 0x00010101, 0x800000b6, 0x00000000, 0x00000003, 0x00171717,
+  0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x008f8f8f, 0x00202020, 0x000a0a0a,
+  0x8000008b, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff,
+  0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000047, 0x00000000, 0x00000003, 0x00727272,
+  0x00c1c1c1, 0x00f2f2f2, 0x80000018, 0x00ffffff, 0x00000003, 0x00bababa, 0x008b8b8b, 0x001c1c1c,
+  0x8000002a, 0x00000000, 0x00000003, 0x004e4e4e, 0x007e7e7e, 0x00e7e7e7, 0x8000000b, 0x00ffffff,
+  0x00000005, 0x00fbfbfb, 0x00ebebeb, 0x00969696, 0x00212121, 0x000c0c0c, 0x800000b8, 0x00000000,
+  0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090,
+  0x00202020, 0x000a0a0a, 0x8000008b, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf,
+  0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005e5e5e, 0x80000047, 0x00000000,
+  0x00000003, 0x006e6e6e, 0x00bbbbbb, 0x00f1f1f1, 0x80000018, 0x00ffffff, 0x00000003, 0x00bbbbbb,
+  0x008e8e8e, 0x001c1c1c, 0x80000028, 0x00000000, 0x00000005, 0x00222222, 0x00515151, 0x00b6b6b6,
+  0x00f5f5f5, 0x00fdfdfd, 0x8000000a, 0x00ffffff, 0x00000006, 0x00fbfbfb, 0x00d5d5d5, 0x004c4c4c,
+  0x002d2d2d, 0x00020202, 0x00010101, 0x800000b8, 0x00000000, 0x00000003, 0x00171717, 0x00505050,
+  0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000008b,
+  0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000047, 0x00000000, 0x00000003, 0x006e6e6e, 0x00bbbbbb,
+  0x00f1f1f1, 0x80000018, 0x00ffffff, 0x00000003, 0x00c1c1c1, 0x00979797, 0x001e1e1e, 0x80000026,
+  0x00000000, 0x00000006, 0x00020202, 0x00070707, 0x00313131, 0x006c6c6c, 0x00c6c6c6, 0x00fefefe,
+  0x8000000b, 0x00ffffff, 0x00000004, 0x00e8e8e8, 0x00c1c1c1, 0x00383838, 0x00202020, 0x800000ba,
+  0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x008f8f8f, 0x00202020, 0x000a0a0a, 0x8000004d, 0x00000000, 0x00000001, 0x00010101, 0x8000003d,
+  0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000047, 0x00000000, 0x00000003, 0x00707070, 0x00bebebe,
+  0x00f1f1f1, 0x80000018, 0x00ffffff, 0x00000003, 0x00c1c1c1, 0x00989898, 0x001f1f1f, 0x80000026,
+  0x00000000, 0x00000005, 0x000c0c0c, 0x00373737, 0x00878787, 0x00f7f7f7, 0x00fcfcfc, 0x8000000b,
+  0x00ffffff, 0x00000003, 0x00fcfcfc, 0x00696969, 0x00525252, 0x800000bc, 0x00000000, 0x00000003,
+  0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020,
+  0x000a0a0a, 0x8000004b, 0x00000000, 0x00000004, 0x00010101, 0x00030303, 0x00080808, 0x00040404,
+  0x8000003c, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff,
+  0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000047, 0x00000000, 0x00000003, 0x007b7b7b,
+  0x00d1d1d1, 0x00f5f5f5, 0x80000018, 0x00ffffff, 0x00000003, 0x00c3c3c3, 0x009a9a9a, 0x001f1f1f,
+  0x80000025, 0x00000000, 0x00000006, 0x000a0a0a, 0x00202020, 0x00717171, 0x00aaaaaa, 0x00fafafa,
+  0x00fdfdfd, 0x8000000a, 0x00ffffff, 0x00000004, 0x00e5e5e5, 0x00dcdcdc, 0x00474747, 0x00373737,
+  0x80000019, 0x00000000, 0x00000002, 0x00010101, 0x00010101, 0x8000001a, 0x00030303, 0x00000002,
+  0x00020202, 0x00010101, 0x80000018, 0x00000000, 0x80000015, 0x00020202, 0x80000016, 0x00010101,
+  0x80000042, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00919191, 0x00222222, 0x000c0c0c, 0x80000011, 0x00030303, 0x00000002, 0x00020202,
+  0x00020202, 0x8000002b, 0x00000000, 0x0000001d, 0x00020202, 0x00020202, 0x00151515, 0x00191919,
+  0x002c2c2c, 0x002f2f2f, 0x00353535, 0x00393939, 0x003c3c3c, 0x00424242, 0x00444444, 0x004b4b4b,
+  0x004c4c4c, 0x00535353, 0x00555555, 0x00595959, 0x00545454, 0x004f4f4f, 0x00494949, 0x00464646,
+  0x003e3e3e, 0x003d3d3d, 0x00353535, 0x00323232, 0x002d2d2d, 0x00242424, 0x001d1d1d, 0x000a0a0a,
+  0x00040404, 0x80000030, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018,
+  0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000047, 0x00000000, 0x00000003,
+  0x007f7f7f, 0x00d8d8d8, 0x00f7f7f7, 0x80000018, 0x00ffffff, 0x00000003, 0x00c0c0c0, 0x00959595,
+  0x001e1e1e, 0x80000025, 0x00000000, 0x00000004, 0x001e1e1e, 0x00494949, 0x00e8e8e8, 0x00f2f2f2,
+  0x8000000c, 0x00ffffff, 0x00000002, 0x00b0b0b0, 0x009c9c9c, 0x8000001b, 0x00000000, 0x00000002,
+  0x00020202, 0x00030303, 0x8000001a, 0x00080808, 0x00000003, 0x00070707, 0x00020202, 0x00010101,
+  0x80000017, 0x00000000, 0x80000007, 0x00070707, 0x80000007, 0x00060606, 0x80000008, 0x00050505,
+  0x80000007, 0x00040404, 0x80000007, 0x00030303, 0x80000007, 0x00020202, 0x80000007, 0x00010101,
+  0x8000003b, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00939393, 0x00272727, 0x00111111, 0x80000011, 0x00080808, 0x00000003, 0x00070707,
+  0x00060606, 0x00010101, 0x8000002a, 0x00000000, 0x0000001e, 0x00050505, 0x00070707, 0x00404040,
+  0x004d4d4d, 0x00868686, 0x008f8f8f, 0x00a1a1a1, 0x00adadad, 0x00b8b8b8, 0x00c9c9c9, 0x00cfcfcf,
+  0x00e4e4e4, 0x00e9e9e9, 0x00fbfbfb, 0x00fcfcfc, 0x00ffffff, 0x00f7f7f7, 0x00f0f0f0, 0x00dddddd,
+  0x00d6d6d6, 0x00bebebe, 0x00b9b9b9, 0x00a2a2a2, 0x00999999, 0x00888888, 0x006e6e6e, 0x00575757,
+  0x001f1f1f, 0x000b0b0b, 0x00010101, 0x8000002f, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8,
+  0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000047,
+  0x00000000, 0x00000003, 0x00888888, 0x00e7e7e7, 0x00fafafa, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00bababa, 0x008b8b8b, 0x001c1c1c, 0x80000023, 0x00000000, 0x00000006, 0x00050505, 0x00080808,
+  0x007c7c7c, 0x00969696, 0x00f4f4f4, 0x00f9f9f9, 0x8000000a, 0x00ffffff, 0x00000004, 0x00f6f6f6,
+  0x00f0f0f0, 0x006f6f6f, 0x00515151, 0x8000001a, 0x00000000, 0x00000003, 0x00010101, 0x002b2b2b,
+  0x00414141, 0x8000001a, 0x008a8a8a, 0x00000003, 0x00737373, 0x002b2b2b, 0x00181818, 0x80000016,
+  0x00000000, 0x00000001, 0x00070707, 0x80000007, 0x008a8a8a, 0x8000000f, 0x00898989, 0x8000000e,
+  0x00888888, 0x8000000f, 0x00878787, 0x80000006, 0x00868686, 0x0000000e, 0x00848484, 0x00808080,
+  0x00787878, 0x00757575, 0x006a6a6a, 0x00686868, 0x005d5d5d, 0x00595959, 0x004f4f4f, 0x003d3d3d,
+  0x002a2a2a, 0x00111111, 0x00050505, 0x00010101, 0x80000026, 0x00000000, 0x00000003, 0x00171717,
+  0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00cccccc, 0x00999999, 0x008f8f8f,
+  0x80000011, 0x008a8a8a, 0x00000003, 0x00727272, 0x00686868, 0x000a0a0a, 0x80000024, 0x00000000,
+  0x00000029, 0x00020202, 0x00101010, 0x001d1d1d, 0x00373737, 0x004b4b4b, 0x005e5e5e, 0x00797979,
+  0x00848484, 0x00a4a4a4, 0x00ababab, 0x00c6c6c6, 0x00cacaca, 0x00d3d3d3, 0x00d8d8d8, 0x00dddddd,
+  0x00e5e5e5, 0x00e8e8e8, 0x00f2f2f2, 0x00f4f4f4, 0x00fdfdfd, 0x00fefefe, 0x00ffffff, 0x00fbfbfb,
+  0x00f8f8f8, 0x00efefef, 0x00ececec, 0x00e0e0e0, 0x00dedede, 0x00d3d3d3, 0x00cfcfcf, 0x00c7c7c7,
+  0x00bababa, 0x00b0b0b0, 0x00919191, 0x00868686, 0x005d5d5d, 0x00545454, 0x002c2c2c, 0x001f1f1f,
+  0x00050505, 0x00020202, 0x8000002a, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf,
+  0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000046, 0x00000000,
+  0x00000004, 0x00010101, 0x008f8f8f, 0x00f2f2f2, 0x00fcfcfc, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00b5b5b5, 0x00848484, 0x001a1a1a, 0x80000023, 0x00000000, 0x00000004, 0x000a0a0a, 0x000f0f0f,
+  0x00d1d1d1, 0x00dbdbdb, 0x8000000c, 0x00ffffff, 0x00000004, 0x00ededed, 0x00e2e2e2, 0x00343434,
+  0x000e0e0e, 0x8000001a, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001,
+  0x000d0d0d, 0x80000039, 0x00ffffff, 0x0000000e, 0x00f9f9f9, 0x00f3f3f3, 0x00e4e4e4, 0x00dddddd,
+  0x00c9c9c9, 0x00c4c4c4, 0x00b0b0b0, 0x00a9a9a9, 0x00959595, 0x00747474, 0x004f4f4f, 0x00202020,
+  0x00090909, 0x00010101, 0x80000026, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6,
+  0x8000002e, 0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x80000024, 0x00000000,
+  0x00000009, 0x00040404, 0x001f1f1f, 0x00373737, 0x00686868, 0x008f8f8f, 0x00b2b2b2, 0x00e2e2e2,
+  0x00f4f4f4, 0x00fefefe, 0x80000018, 0x00ffffff, 0x00000008, 0x00f8f8f8, 0x00f5f5f5, 0x00afafaf,
+  0x009e9e9e, 0x00545454, 0x003b3b3b, 0x00090909, 0x00040404, 0x8000002a, 0x00000000, 0x00000003,
+  0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8,
+  0x005f5f5f, 0x80000046, 0x00000000, 0x00000004, 0x00010101, 0x00959595, 0x00fcfcfc, 0x00fefefe,
+  0x80000018, 0x00ffffff, 0x00000003, 0x00b1b1b1, 0x007d7d7d, 0x00191919, 0x80000021, 0x00000000,
+  0x00000006, 0x00010101, 0x00010101, 0x006d6d6d, 0x00878787, 0x00f2f2f2, 0x00f5f5f5, 0x8000000c,
+  0x00ffffff, 0x00000004, 0x00a7a7a7, 0x00707070, 0x00171717, 0x00040404, 0x8000001a, 0x00000000,
+  0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5,
+  0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x80000039, 0x00ffffff,
+  0x00000012, 0x00fdfdfd, 0x00fcfcfc, 0x00f8f8f8, 0x00f6f6f6, 0x00f0f0f0, 0x00efefef, 0x00e9e9e9,
+  0x00e7e7e7, 0x00e2e2e2, 0x00d9d9d9, 0x00cfcfcf, 0x00bdbdbd, 0x00b4b4b4, 0x00868686, 0x007a7a7a,
+  0x003f3f3f, 0x002e2e2e, 0x00010101, 0x80000022, 0x00000000, 0x00000003, 0x00171717, 0x00505050,
+  0x00a6a6a6, 0x8000002e, 0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x80000021,
+  0x00000000, 0x0000000b, 0x001b1b1b, 0x00252525, 0x007e7e7e, 0x008d8d8d, 0x00c2c2c2, 0x00c8c8c8,
+  0x00d6d6d6, 0x00e0e0e0, 0x00eaeaea, 0x00f7f7f7, 0x00fcfcfc, 0x80000019, 0x00ffffff, 0x0000000c,
+  0x00fdfdfd, 0x00fcfcfc, 0x00e9e9e9, 0x00e5e5e5, 0x00d0d0d0, 0x00c7c7c7, 0x00b4b4b4, 0x008e8e8e,
+  0x006d6d6d, 0x00252525, 0x000c0c0c, 0x00010101, 0x80000026, 0x00000000, 0x00000003, 0x00414141,
+  0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f,
+  0x80000045, 0x00000000, 0x00000004, 0x00060606, 0x000f0f0f, 0x009c9c9c, 0x00fefefe, 0x80000019,
+  0x00ffffff, 0x00000003, 0x00ababab, 0x00727272, 0x00171717, 0x80000021, 0x00000000, 0x00000004,
+  0x00010101, 0x00020202, 0x00929292, 0x00b4b4b4, 0x8000000e, 0x00ffffff, 0x00000003, 0x008c8c8c,
+  0x00454545, 0x000c0c0c, 0x8000001b, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000,
+  0x00000001, 0x000d0d0d, 0x80000044, 0x00ffffff, 0x00000008, 0x00f8f8f8, 0x00f5f5f5, 0x00b8b8b8,
+  0x00a8a8a8, 0x00575757, 0x003f3f3f, 0x00010101, 0x00010101, 0x80000021, 0x00000000, 0x00000003,
+  0x00171717, 0x00505050, 0x00a6a6a6, 0x8000002e, 0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00c0c0c0,
+  0x00121212, 0x80000021, 0x00000000, 0x00000004, 0x00252525, 0x00333333, 0x00adadad, 0x00c1c1c1,
+  0x80000025, 0x00ffffff, 0x00000007, 0x00fbfbfb, 0x00f4f4f4, 0x00c2c2c2, 0x00969696, 0x00333333,
+  0x00101010, 0x00010101, 0x80000026, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf,
+  0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000045, 0x00000000,
+  0x00000003, 0x00080808, 0x00141414, 0x009e9e9e, 0x8000001a, 0x00ffffff, 0x00000003, 0x00a8a8a8,
+  0x006e6e6e, 0x00161616, 0x80000021, 0x00000000, 0x00000004, 0x004f4f4f, 0x00818181, 0x00e3e3e3,
+  0x00f9f9f9, 0x8000000c, 0x00ffffff, 0x00000005, 0x00d7d7d7, 0x00a0a0a0, 0x00404040, 0x00050505,
+  0x00010101, 0x8000001b, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001,
+  0x000d0d0d, 0x80000044, 0x00ffffff, 0x0000000a, 0x00fefefe, 0x00fefefe, 0x00fafafa, 0x00f9f9f9,
+  0x00f2f2f2, 0x00e3e3e3, 0x00b9b9b9, 0x00797979, 0x00323232, 0x00101010, 0x8000001f, 0x00000000,
+  0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000002e, 0x00ffffff, 0x00000003, 0x00d2d2d2,
+  0x00c0c0c0, 0x00121212, 0x8000001d, 0x00000000, 0x00000008, 0x000c0c0c, 0x00252525, 0x00646464,
+  0x009e9e9e, 0x00d8d8d8, 0x00efefef, 0x00f9f9f9, 0x00fafafa, 0x80000026, 0x00ffffff, 0x00000007,
+  0x00fefefe, 0x00fafafa, 0x00f7f7f7, 0x00e0e0e0, 0x00d8d8d8, 0x005b5b5b, 0x00474747, 0x80000025,
+  0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00f1f1f1, 0x00d8d8d8, 0x005e5e5e, 0x80000045, 0x00000000, 0x00000003, 0x00101010, 0x00282828,
+  0x00a7a7a7, 0x8000001a, 0x00ffffff, 0x00000003, 0x00a0a0a0, 0x00606060, 0x00131313, 0x8000001f,
+  0x00000000, 0x00000005, 0x00030303, 0x00080808, 0x00616161, 0x00999999, 0x00ececec, 0x8000000b,
+  0x00ffffff, 0x00000005, 0x00fefefe, 0x00fbfbfb, 0x00cacaca, 0x00878787, 0x00333333, 0x8000001d,
+  0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x80000049,
+  0x00ffffff, 0x00000008, 0x00f2f2f2, 0x00cfcfcf, 0x00929292, 0x004f4f4f, 0x00262626, 0x00131313,
+  0x00030303, 0x00010101, 0x8000001c, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6,
+  0x8000002e, 0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x8000001a, 0x00000000,
+  0x00000009, 0x00020202, 0x00040404, 0x00141414, 0x00232323, 0x00424242, 0x007e7e7e, 0x00b5b5b5,
+  0x00eaeaea, 0x00fefefe, 0x8000002b, 0x00ffffff, 0x00000008, 0x00f0f0f0, 0x00ebebeb, 0x00757575,
+  0x00626262, 0x00171717, 0x00111111, 0x00040404, 0x00020202, 0x80000021, 0x00000000, 0x00000003,
+  0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8,
+  0x005f5f5f, 0x80000045, 0x00000000, 0x00000003, 0x00111111, 0x002d2d2d, 0x00a9a9a9, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x009e9e9e, 0x005d5d5d, 0x00131313, 0x8000001f, 0x00000000, 0x00000004,
+  0x001a1a1a, 0x00404040, 0x00b4b4b4, 0x00fefefe, 0x8000000c, 0x00ffffff, 0x00000005, 0x00f8f8f8,
+  0x00dfdfdf, 0x00878787, 0x000c0c0c, 0x00050505, 0x8000001d, 0x00000000, 0x00000003, 0x00020202,
+  0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d,
+  0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000004c, 0x00ffffff, 0x00000005, 0x00fefefe,
+  0x00bababa, 0x00999999, 0x00171717, 0x00050505, 0x8000001c, 0x00000000, 0x00000003, 0x00171717,
+  0x00505050, 0x00a6a6a6, 0x8000002e, 0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212,
+  0x8000001a, 0x00000000, 0x00000006, 0x000f0f0f, 0x00212121, 0x009e9e9e, 0x00bcbcbc, 0x00fcfcfc,
+  0x00fefefe, 0x80000031, 0x00ffffff, 0x00000005, 0x00f5f5f5, 0x00b8b8b8, 0x00858585, 0x00212121,
+  0x000f0f0f, 0x80000021, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018,
+  0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000045, 0x00000000, 0x00000003,
+  0x00191919, 0x00414141, 0x00b1b1b1, 0x8000001a, 0x00ffffff, 0x00000003, 0x00969696, 0x00505050,
+  0x00101010, 0x8000001d, 0x00000000, 0x00000006, 0x00010101, 0x00040404, 0x00313131, 0x00737373,
+  0x00c8c8c8, 0x00fefefe, 0x8000000c, 0x00ffffff, 0x00000005, 0x00ededed, 0x00acacac, 0x00676767,
+  0x00080808, 0x00030303, 0x8000001d, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000,
+  0x00000001, 0x000d0d0d, 0x8000004c, 0x00ffffff, 0x00000007, 0x00fefefe, 0x00d0d0d0, 0x00bababa,
+  0x004c4c4c, 0x00383838, 0x00020202, 0x00010101, 0x8000001a, 0x00000000, 0x00000003, 0x00171717,
+  0x00505050, 0x00a6a6a6, 0x8000002e, 0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212,
+  0x80000018, 0x00000000, 0x00000008, 0x00080808, 0x000b0b0b, 0x004b4b4b, 0x005d5d5d, 0x00bdbdbd,
+  0x00d2d2d2, 0x00fdfdfd, 0x00fefefe, 0x80000031, 0x00ffffff, 0x00000007, 0x00f8f8f8, 0x00cfcfcf,
+  0x00ababab, 0x00656565, 0x00393939, 0x00131313, 0x00050505, 0x8000001f, 0x00000000, 0x00000003,
+  0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8,
+  0x005f5f5f, 0x80000045, 0x00000000, 0x00000003, 0x001c1c1c, 0x00484848, 0x00b4b4b4, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00939393, 0x004b4b4b, 0x000f0f0f, 0x8000001d, 0x00000000, 0x00000005,
+  0x00020202, 0x000b0b0b, 0x00616161, 0x00dddddd, 0x00f2f2f2, 0x8000000c, 0x00ffffff, 0x00000004,
+  0x00fefefe, 0x00d5d5d5, 0x00414141, 0x00262626, 0x8000001f, 0x00000000, 0x00000003, 0x00020202,
+  0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d,
+  0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000004f, 0x00ffffff, 0x00000004, 0x00bababa,
+  0x00a3a3a3, 0x00060606, 0x00040404, 0x8000001a, 0x00000000, 0x00000003, 0x00171717, 0x00505050,
+  0x00a6a6a6, 0x8000002e, 0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x80000018,
+  0x00000000, 0x00000004, 0x00191919, 0x00232323, 0x00c8c8c8, 0x00dcdcdc, 0x80000037, 0x00ffffff,
+  0x00000005, 0x00fbfbfb, 0x00f3f3f3, 0x00909090, 0x003c3c3c, 0x00101010, 0x8000001f, 0x00000000,
+  0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1,
+  0x00d8d8d8, 0x005f5f5f, 0x80000045, 0x00000000, 0x00000003, 0x00222222, 0x00575757, 0x00bababa,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x008c8c8c, 0x003f3f3f, 0x000d0d0d, 0x8000001d, 0x00000000,
+  0x00000005, 0x00111111, 0x00525252, 0x00929292, 0x00efefef, 0x00f9f9f9, 0x8000000b, 0x00ffffff,
+  0x00000005, 0x00fefefe, 0x00c6c6c6, 0x00a2a2a2, 0x001f1f1f, 0x00121212, 0x8000001f, 0x00000000,
+  0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5,
+  0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000004f, 0x00ffffff,
+  0x00000006, 0x00dedede, 0x00d0d0d0, 0x00616161, 0x00474747, 0x00040404, 0x00020202, 0x80000018,
+  0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000002e, 0x00ffffff, 0x00000003,
+  0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x80000016, 0x00000000, 0x00000006, 0x00111111, 0x00202020,
+  0x006e6e6e, 0x008c8c8c, 0x00e4e4e4, 0x00eeeeee, 0x80000037, 0x00ffffff, 0x00000007, 0x00fdfdfd,
+  0x00f9f9f9, 0x00c7c7c7, 0x009c9c9c, 0x00404040, 0x001f1f1f, 0x00020202, 0x8000001d, 0x00000000,
+  0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1,
+  0x00d8d8d8, 0x005f5f5f, 0x80000045, 0x00000000, 0x00000003, 0x002c2c2c, 0x00727272, 0x00c5c5c5,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00808080, 0x002b2b2b, 0x00090909, 0x8000001d, 0x00000000,
+  0x00000003, 0x001f1f1f, 0x00929292, 0x00bfbfbf, 0x8000000d, 0x00ffffff, 0x00000003, 0x00fdfdfd,
+  0x00939393, 0x00737373, 0x80000021, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000,
+  0x00000001, 0x000d0d0d, 0x80000050, 0x00ffffff, 0x00000005, 0x00f9f9f9, 0x00b5b5b5, 0x00848484,
+  0x00070707, 0x00040404, 0x80000018, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6,
+  0x8000002e, 0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x80000016, 0x00000000,
+  0x00000005, 0x00202020, 0x003e3e3e, 0x00bbbbbb, 0x00ececec, 0x00fdfdfd, 0x8000003a, 0x00ffffff,
+  0x00000005, 0x00f9f9f9, 0x00f3f3f3, 0x006c6c6c, 0x003c3c3c, 0x00040404, 0x8000001d, 0x00000000,
+  0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1,
+  0x00d8d8d8, 0x005f5f5f, 0x80000045, 0x00000000, 0x00000003, 0x00363636, 0x008a8a8a, 0x00cfcfcf,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00757575, 0x00191919, 0x00050505, 0x8000001c, 0x00000000,
+  0x00000004, 0x002c2c2c, 0x00525252, 0x00e0e0e0, 0x00ededed, 0x8000000c, 0x00ffffff, 0x00000004,
+  0x00f1f1f1, 0x00ebebeb, 0x00323232, 0x00272727, 0x80000021, 0x00000000, 0x00000003, 0x00020202,
+  0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d,
+  0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x80000050, 0x00ffffff, 0x00000005, 0x00fdfdfd,
+  0x00eaeaea, 0x00c5c5c5, 0x00646464, 0x00343434, 0x80000018, 0x00000000, 0x00000003, 0x00171717,
+  0x00505050, 0x00a6a6a6, 0x8000002e, 0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212,
+  0x80000014, 0x00000000, 0x00000006, 0x00161616, 0x00454545, 0x00878787, 0x00c5c5c5, 0x00ebebeb,
+  0x00fafafa, 0x8000003b, 0x00ffffff, 0x00000006, 0x00fdfdfd, 0x00fcfcfc, 0x00d0d0d0, 0x00c0c0c0,
+  0x00343434, 0x00252525, 0x8000001c, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf,
+  0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000045, 0x00000000,
+  0x00000003, 0x00484848, 0x00bababa, 0x00e3e3e3, 0x80000018, 0x00ffffff, 0x00000005, 0x00fafafa,
+  0x00f3f3f3, 0x00666666, 0x00070707, 0x00010101, 0x8000001b, 0x00000000, 0x00000005, 0x00010101,
+  0x003d3d3d, 0x00666666, 0x00fefefe, 0x00fefefe, 0x8000000c, 0x00ffffff, 0x00000004, 0x00ececec,
+  0x00e4e4e4, 0x000c0c0c, 0x00090909, 0x80000021, 0x00000000, 0x00000003, 0x00020202, 0x00505050,
+  0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016,
+  0x00000000, 0x00000001, 0x000d0d0d, 0x80000052, 0x00ffffff, 0x00000003, 0x00dedede, 0x00888888,
+  0x00474747, 0x80000018, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000002e,
+  0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x80000014, 0x00000000, 0x00000005,
+  0x001e1e1e, 0x00606060, 0x00afafaf, 0x00f9f9f9, 0x00fdfdfd, 0x8000003e, 0x00ffffff, 0x00000004,
+  0x00f6f6f6, 0x00f3f3f3, 0x00474747, 0x00343434, 0x8000001c, 0x00000000, 0x00000003, 0x00414141,
+  0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f,
+  0x80000045, 0x00000000, 0x00000003, 0x00505050, 0x00cdcdcd, 0x00eaeaea, 0x80000018, 0x00ffffff,
+  0x00000003, 0x00f9f9f9, 0x00efefef, 0x00606060, 0x8000001c, 0x00000000, 0x00000004, 0x00070707,
+  0x000a0a0a, 0x00cecece, 0x00d9d9d9, 0x8000000e, 0x00ffffff, 0x00000004, 0x008e8e8e, 0x00727272,
+  0x00010101, 0x00010101, 0x80000021, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000,
+  0x00000001, 0x000d0d0d, 0x80000052, 0x00ffffff, 0x00000005, 0x00fcfcfc, 0x00f3f3f3, 0x00959595,
+  0x002f2f2f, 0x000f0f0f, 0x80000016, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6,
+  0x8000002e, 0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x80000012, 0x00000000,
+  0x00000005, 0x000a0a0a, 0x00595959, 0x008a8a8a, 0x00f2f2f2, 0x00f9f9f9, 0x80000040, 0x00ffffff,
+  0x00000006, 0x00fefefe, 0x00fefefe, 0x00e6e6e6, 0x00cccccc, 0x00353535, 0x00232323, 0x8000001a,
+  0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000043, 0x00000000, 0x00000005, 0x00030303, 0x00111111,
+  0x006c6c6c, 0x00fafafa, 0x00fdfdfd, 0x80000018, 0x00ffffff, 0x00000003, 0x00e9e9e9, 0x00c8c8c8,
+  0x00505050, 0x8000001c, 0x00000000, 0x00000004, 0x00141414, 0x001b1b1b, 0x00dfdfdf, 0x00e6e6e6,
+  0x8000000c, 0x00ffffff, 0x00000004, 0x00fcfcfc, 0x00fbfbfb, 0x007b7b7b, 0x005c5c5c, 0x80000023,
+  0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x80000052,
+  0x00ffffff, 0x00000005, 0x00fefefe, 0x00fcfcfc, 0x00a5a5a5, 0x00464646, 0x00161616, 0x80000016,
+  0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000002e, 0x00ffffff, 0x00000003,
+  0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x80000011, 0x00000000, 0x00000004, 0x00050505, 0x00121212,
+  0x00737373, 0x009f9f9f, 0x80000044, 0x00ffffff, 0x00000006, 0x00f5f5f5, 0x00dddddd, 0x004e4e4e,
+  0x00343434, 0x00020202, 0x00010101, 0x80000018, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8,
+  0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000043,
+  0x00000000, 0x00000004, 0x00050505, 0x001b1b1b, 0x00737373, 0x00fefefe, 0x80000019, 0x00ffffff,
+  0x00000003, 0x00e6e6e6, 0x00c0c0c0, 0x004d4d4d, 0x8000001c, 0x00000000, 0x00000002, 0x00737373,
+  0x008f8f8f, 0x8000000e, 0x00ffffff, 0x00000004, 0x00e9e9e9, 0x00dbdbdb, 0x002c2c2c, 0x00050505,
+  0x80000023, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d,
+  0x80000054, 0x00ffffff, 0x00000004, 0x00e8e8e8, 0x00d0d0d0, 0x00434343, 0x00010101, 0x80000015,
+  0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000002e, 0x00ffffff, 0x00000003,
+  0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x80000011, 0x00000000, 0x00000004, 0x002c2c2c, 0x00474747,
+  0x00f7f7f7, 0x00fafafa, 0x80000045, 0x00ffffff, 0x00000005, 0x00fbfbfb, 0x00e2e2e2, 0x00999999,
+  0x000d0d0d, 0x00060606, 0x80000018, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf,
+  0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000043, 0x00000000,
+  0x00000003, 0x00101010, 0x00555555, 0x00979797, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d7d7d7,
+  0x009b9b9b, 0x003e3e3e, 0x8000001a, 0x00000000, 0x00000004, 0x000b0b0b, 0x00121212, 0x00939393,
+  0x00b2b2b2, 0x8000000e, 0x00ffffff, 0x00000004, 0x00cfcfcf, 0x00b1b1b1, 0x00232323, 0x00030303,
+  0x80000023, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d,
+  0x80000054, 0x00ffffff, 0x00000005, 0x00f0f0f0, 0x00dfdfdf, 0x00575757, 0x00181818, 0x00030303,
+  0x80000014, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000002e, 0x00ffffff,
+  0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x8000000f, 0x00000000, 0x00000006, 0x00030303,
+  0x00050505, 0x005e5e5e, 0x00787878, 0x00fafafa, 0x00fbfbfb, 0x80000045, 0x00ffffff, 0x00000005,
+  0x00fcfcfc, 0x00ebebeb, 0x00aeaeae, 0x00383838, 0x001a1a1a, 0x80000018, 0x00000000, 0x00000003,
+  0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8,
+  0x005f5f5f, 0x80000043, 0x00000000, 0x00000003, 0x00141414, 0x006a6a6a, 0x00a4a4a4, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00d2d2d2, 0x008d8d8d, 0x00393939, 0x8000001a, 0x00000000, 0x00000004,
+  0x00232323, 0x003a3a3a, 0x00d8d8d8, 0x00fdfdfd, 0x8000000e, 0x00ffffff, 0x00000003, 0x00989898,
+  0x00575757, 0x00101010, 0x80000024, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000,
+  0x00000001, 0x000d0d0d, 0x80000056, 0x00ffffff, 0x00000003, 0x00828282, 0x00484848, 0x00090909,
+  0x80000014, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000002e, 0x00ffffff,
+  0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x8000000f, 0x00000000, 0x00000004, 0x000b0b0b,
+  0x000f0f0f, 0x00cacaca, 0x00e0e0e0, 0x80000049, 0x00ffffff, 0x00000003, 0x00dbdbdb, 0x00959595,
+  0x00444444, 0x80000018, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018,
+  0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000043, 0x00000000, 0x00000003,
+  0x001c1c1c, 0x00989898, 0x00c0c0c0, 0x8000001a, 0x00ffffff, 0x00000003, 0x00c6c6c6, 0x00707070,
+  0x002d2d2d, 0x80000018, 0x00000000, 0x00000006, 0x00020202, 0x00040404, 0x00575757, 0x008c8c8c,
+  0x00e8e8e8, 0x00fefefe, 0x8000000c, 0x00ffffff, 0x00000005, 0x00f4f4f4, 0x00e5e5e5, 0x00727272,
+  0x002b2b2b, 0x00080808, 0x80000024, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000,
+  0x00000001, 0x000d0d0d, 0x80000056, 0x00ffffff, 0x00000003, 0x00a7a7a7, 0x007e7e7e, 0x000f0f0f,
+  0x80000014, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000002e, 0x00ffffff,
+  0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x8000000e, 0x00000000, 0x00000005, 0x00010101,
+  0x00464646, 0x00626262, 0x00e2e2e2, 0x00f0f0f0, 0x80000049, 0x00ffffff, 0x00000005, 0x00ededed,
+  0x00cbcbcb, 0x006e6e6e, 0x001f1f1f, 0x00080808, 0x80000016, 0x00000000, 0x00000003, 0x00414141,
+  0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f,
+  0x80000043, 0x00000000, 0x00000003, 0x00232323, 0x00bbbbbb, 0x00d6d6d6, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00bdbdbd, 0x005a5a5a, 0x00242424, 0x80000018, 0x00000000, 0x00000005, 0x00030303,
+  0x00080808, 0x00878787, 0x00d9d9d9, 0x00f8f8f8, 0x8000000d, 0x00ffffff, 0x00000004, 0x00eaeaea,
+  0x00cccccc, 0x004f4f4f, 0x00010101, 0x80000025, 0x00000000, 0x00000003, 0x00020202, 0x00505050,
+  0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016,
+  0x00000000, 0x00000001, 0x000d0d0d, 0x80000056, 0x00ffffff, 0x00000003, 0x00c9c9c9, 0x00b0b0b0,
+  0x00151515, 0x80000014, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000002e,
+  0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x8000000d, 0x00000000, 0x00000005,
+  0x00010101, 0x00010101, 0x007e7e7e, 0x00b0b0b0, 0x00f8f8f8, 0x8000004b, 0x00ffffff, 0x00000004,
+  0x00fefefe, 0x00959595, 0x003c3c3c, 0x000f0f0f, 0x80000016, 0x00000000, 0x00000003, 0x00414141,
+  0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f,
+  0x80000043, 0x00000000, 0x00000003, 0x00292929, 0x00dcdcdc, 0x00eaeaea, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00b5b5b5, 0x00464646, 0x001c1c1c, 0x80000018, 0x00000000, 0x00000005, 0x002a2a2a,
+  0x00666666, 0x00bcbcbc, 0x00f4f4f4, 0x00fdfdfd, 0x8000000d, 0x00ffffff, 0x00000003, 0x00c1c1c1,
+  0x006a6a6a, 0x00292929, 0x80000026, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000,
+  0x00000001, 0x000d0d0d, 0x80000056, 0x00ffffff, 0x00000004, 0x00eeeeee, 0x00e6e6e6, 0x002c2c2c,
+  0x00111111, 0x80000013, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000002e,
+  0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x8000000d, 0x00000000, 0x00000005,
+  0x002a2a2a, 0x00525252, 0x00bdbdbd, 0x00e9e9e9, 0x00fdfdfd, 0x80000021, 0x00ffffff, 0x0000000b,
+  0x00fcfcfc, 0x00fbfbfb, 0x00e7e7e7, 0x00e3e3e3, 0x00d1d1d1, 0x00d5d5d5, 0x00dddddd, 0x00e6e6e6,
+  0x00efefef, 0x00fafafa, 0x00fefefe, 0x80000020, 0x00ffffff, 0x00000004, 0x00d2d2d2, 0x00acacac,
+  0x00303030, 0x00060606, 0x80000015, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf,
+  0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000042, 0x00000000,
+  0x00000004, 0x00171717, 0x00414141, 0x00f5f5f5, 0x00f9f9f9, 0x80000018, 0x00ffffff, 0x00000005,
+  0x00fefefe, 0x00fcfcfc, 0x00a4a4a4, 0x001e1e1e, 0x000c0c0c, 0x80000018, 0x00000000, 0x00000003,
+  0x00393939, 0x008b8b8b, 0x00d2d2d2, 0x8000000f, 0x00ffffff, 0x00000003, 0x00b1b1b1, 0x00434343,
+  0x001a1a1a, 0x80000026, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001,
+  0x000d0d0d, 0x80000056, 0x00ffffff, 0x00000004, 0x00fdfdfd, 0x00fcfcfc, 0x00353535, 0x00181818,
+  0x80000013, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000002e, 0x00ffffff,
+  0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x8000000d, 0x00000000, 0x00000003, 0x003b3b3b,
+  0x00727272, 0x00d7d7d7, 0x80000023, 0x00ffffff, 0x0000000b, 0x00fbfbfb, 0x00f9f9f9, 0x00dddddd,
+  0x00d7d7d7, 0x00bfbfbf, 0x00c4c4c4, 0x00cfcfcf, 0x00dddddd, 0x00e9e9e9, 0x00f8f8f8, 0x00fefefe,
+  0x80000020, 0x00ffffff, 0x00000004, 0x00eaeaea, 0x00d8d8d8, 0x003d3d3d, 0x00080808, 0x80000015,
+  0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000042, 0x00000000, 0x00000002, 0x00202020, 0x004a4a4a,
+  0x8000001a, 0x00ffffff, 0x00000005, 0x00fefefe, 0x00fbfbfb, 0x009d9d9d, 0x000e0e0e, 0x00060606,
+  0x80000016, 0x00000000, 0x00000005, 0x00080808, 0x00252525, 0x00797979, 0x00f3f3f3, 0x00fafafa,
+  0x8000000d, 0x00ffffff, 0x00000005, 0x00f1f1f1, 0x00c0c0c0, 0x00737373, 0x00060606, 0x00020202,
+  0x80000026, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00fbfbfb, 0x00b9b9b9, 0x00a9a9a9, 0x80000015, 0x007c7c7c,
+  0x00000008, 0x00828282, 0x00858585, 0x00a0a0a0, 0x00a7a7a7, 0x00c5c5c5, 0x00d2d2d2, 0x00f5f5f5,
+  0x00fafafa, 0x8000001e, 0x00ffffff, 0x00000002, 0x006a6a6a, 0x004f4f4f, 0x80000013, 0x00000000,
+  0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00c6c6c6,
+  0x008d8d8d, 0x00818181, 0x80000011, 0x007c7c7c, 0x00000003, 0x00666666, 0x005d5d5d, 0x00090909,
+  0x8000000b, 0x00000000, 0x00000005, 0x00030303, 0x000b0b0b, 0x007a7a7a, 0x00e4e4e4, 0x00f7f7f7,
+  0x8000001d, 0x00ffffff, 0x00000015, 0x00f9f9f9, 0x00cccccc, 0x00ababab, 0x00676767, 0x00494949,
+  0x002e2e2e, 0x001d1d1d, 0x00171717, 0x00131313, 0x00121212, 0x00101010, 0x00111111, 0x00121212,
+  0x00131313, 0x00141414, 0x00222222, 0x00272727, 0x006e6e6e, 0x007e7e7e, 0x00c8c8c8, 0x00dadada,
+  0x8000001c, 0x00ffffff, 0x00000005, 0x00fdfdfd, 0x00fcfcfc, 0x00939393, 0x006f6f6f, 0x00060606,
+  0x80000014, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff,
+  0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000042, 0x00000000, 0x00000002, 0x00616161,
+  0x007f7f7f, 0x8000001a, 0x00ffffff, 0x00000004, 0x00f4f4f4, 0x00cacaca, 0x007a7a7a, 0x00010101,
+  0x80000017, 0x00000000, 0x00000005, 0x000b0b0b, 0x00363636, 0x00878787, 0x00fdfdfd, 0x00fefefe,
+  0x8000000d, 0x00ffffff, 0x00000003, 0x00ededed, 0x00ababab, 0x00646464, 0x80000028, 0x00000000,
+  0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5,
+  0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00fafafa, 0x00acacac, 0x00999999, 0x80000015, 0x00636363, 0x0000000a, 0x00696969,
+  0x006c6c6c, 0x00868686, 0x008c8c8c, 0x00aaaaaa, 0x00b7b7b7, 0x00dbdbdb, 0x00e7e7e7, 0x00f5f5f5,
+  0x00fcfcfc, 0x8000001c, 0x00ffffff, 0x00000002, 0x00757575, 0x005a5a5a, 0x80000013, 0x00000000,
+  0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00bbbbbb,
+  0x00777777, 0x00696969, 0x80000011, 0x00636363, 0x00000003, 0x00525252, 0x004a4a4a, 0x00070707,
+  0x8000000b, 0x00000000, 0x00000005, 0x00070707, 0x00181818, 0x00878787, 0x00f0f0f0, 0x00fbfbfb,
+  0x8000001a, 0x00ffffff, 0x0000000b, 0x00f9f9f9, 0x00f7f7f7, 0x00e9e9e9, 0x00e1e1e1, 0x00b0b0b0,
+  0x00919191, 0x004f4f4f, 0x00323232, 0x00181818, 0x00080808, 0x00020202, 0x80000007, 0x00000000,
+  0x00000009, 0x000c0c0c, 0x00111111, 0x00555555, 0x00656565, 0x00adadad, 0x00c2c2c2, 0x00ededed,
+  0x00f5f5f5, 0x00fdfdfd, 0x8000001b, 0x00ffffff, 0x00000003, 0x00a4a4a4, 0x00848484, 0x00080808,
+  0x80000014, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff,
+  0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000042, 0x00000000, 0x00000002, 0x00727272,
+  0x008e8e8e, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f2f2f2, 0x00bdbdbd, 0x00727272, 0x80000018,
+  0x00000000, 0x00000003, 0x00222222, 0x00a2a2a2, 0x00c8c8c8, 0x8000000f, 0x00ffffff, 0x00000003,
+  0x00d3d3d3, 0x00333333, 0x001e1e1e, 0x80000028, 0x00000000, 0x00000003, 0x00020202, 0x00505050,
+  0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016,
+  0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878,
+  0x00595959, 0x8000001a, 0x00000000, 0x00000005, 0x00070707, 0x00191919, 0x005a5a5a, 0x00a4a4a4,
+  0x00e1e1e1, 0x8000001c, 0x00ffffff, 0x00000002, 0x00a1a1a1, 0x00888888, 0x80000013, 0x00000000,
+  0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090,
+  0x00202020, 0x000a0a0a, 0x8000001f, 0x00000000, 0x00000003, 0x00242424, 0x00747474, 0x00bbbbbb,
+  0x8000001c, 0x00ffffff, 0x00000004, 0x00cecece, 0x00bbbbbb, 0x003f3f3f, 0x002e2e2e, 0x80000013,
+  0x00000000, 0x00000005, 0x001f1f1f, 0x005e5e5e, 0x00acacac, 0x00f0f0f0, 0x00fbfbfb, 0x8000001a,
+  0x00ffffff, 0x00000004, 0x00e9e9e9, 0x00e1e1e1, 0x000e0e0e, 0x00020202, 0x80000013, 0x00000000,
+  0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1,
+  0x00d8d8d8, 0x005e5e5e, 0x80000042, 0x00000000, 0x00000002, 0x00cdcdcd, 0x00d9d9d9, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00e6e6e6, 0x007f7f7f, 0x004c4c4c, 0x80000017, 0x00000000, 0x00000004,
+  0x000b0b0b, 0x00303030, 0x00bebebe, 0x00d9d9d9, 0x8000000e, 0x00ffffff, 0x00000004, 0x00ededed,
+  0x00c2c2c2, 0x00232323, 0x00151515, 0x80000028, 0x00000000, 0x00000003, 0x00020202, 0x00505050,
+  0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016,
+  0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878,
+  0x00595959, 0x8000001a, 0x00000000, 0x00000007, 0x00050505, 0x00111111, 0x003e3e3e, 0x00717171,
+  0x00b8b8b8, 0x00dbdbdb, 0x00fafafa, 0x8000001a, 0x00ffffff, 0x00000002, 0x00b0b0b0, 0x00989898,
+  0x80000013, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000001e, 0x00000000, 0x00000004, 0x00020202,
+  0x00313131, 0x00989898, 0x00cdcdcd, 0x8000001a, 0x00ffffff, 0x00000006, 0x00ececec, 0x00dbdbdb,
+  0x009a9a9a, 0x00818181, 0x002b2b2b, 0x00202020, 0x80000013, 0x00000000, 0x00000006, 0x00151515,
+  0x00414141, 0x007c7c7c, 0x00b1b1b1, 0x00e5e5e5, 0x00f8f8f8, 0x80000019, 0x00ffffff, 0x00000004,
+  0x00f0f0f0, 0x00eaeaea, 0x00252525, 0x00161616, 0x80000013, 0x00000000, 0x00000003, 0x00414141,
+  0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f,
+  0x80000040, 0x00000000, 0x00000004, 0x00101010, 0x00141414, 0x00dcdcdc, 0x00e5e5e5, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00e1e1e1, 0x00696969, 0x003f3f3f, 0x80000017, 0x00000000, 0x00000004,
+  0x00222222, 0x004f4f4f, 0x00fcfcfc, 0x00fdfdfd, 0x8000000d, 0x00ffffff, 0x00000003, 0x00fefefe,
+  0x00c5c5c5, 0x009b9b9b, 0x8000002a, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000,
+  0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959,
+  0x8000001e, 0x00000000, 0x00000003, 0x005e5e5e, 0x008c8c8c, 0x00f0f0f0, 0x8000001a, 0x00ffffff,
+  0x00000002, 0x00d3d3d3, 0x00bcbcbc, 0x80000013, 0x00000000, 0x00000003, 0x00171717, 0x00505050,
+  0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000001d,
+  0x00000000, 0x00000005, 0x00010101, 0x00070707, 0x004d4d4d, 0x00e6e6e6, 0x00f3f3f3, 0x8000001a,
+  0x00ffffff, 0x00000004, 0x00c2c2c2, 0x008b8b8b, 0x00292929, 0x00030303, 0x80000017, 0x00000000,
+  0x00000005, 0x00141414, 0x00262626, 0x00b5b5b5, 0x00e9e9e9, 0x00fefefe, 0x8000001a, 0x00ffffff,
+  0x00000002, 0x00565656, 0x00414141, 0x80000013, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8,
+  0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000040,
+  0x00000000, 0x00000003, 0x00333333, 0x00414141, 0x00fcfcfc, 0x8000001b, 0x00ffffff, 0x00000003,
+  0x00d8d8d8, 0x003a3a3a, 0x00232323, 0x80000016, 0x00000000, 0x00000005, 0x00010101, 0x005f5f5f,
+  0x00808080, 0x00fefefe, 0x00fefefe, 0x8000000d, 0x00ffffff, 0x00000003, 0x00fefefe, 0x008f8f8f,
+  0x00717171, 0x8000002a, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001,
+  0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x8000001e,
+  0x00000000, 0x00000004, 0x00323232, 0x004a4a4a, 0x00dadada, 0x00f1f1f1, 0x80000019, 0x00ffffff,
+  0x00000002, 0x00e3e3e3, 0x00cdcdcd, 0x80000013, 0x00000000, 0x00000003, 0x00171717, 0x00505050,
+  0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000001d,
+  0x00000000, 0x00000005, 0x00060606, 0x00393939, 0x00737373, 0x00f3f3f3, 0x00f9f9f9, 0x80000018,
+  0x00ffffff, 0x00000006, 0x00e5e5e5, 0x00aeaeae, 0x00767676, 0x00444444, 0x00141414, 0x00010101,
+  0x80000017, 0x00000000, 0x00000006, 0x000a0a0a, 0x00131313, 0x006b6b6b, 0x008b8b8b, 0x00f2f2f2,
+  0x00fafafa, 0x80000019, 0x00ffffff, 0x00000002, 0x00888888, 0x006f6f6f, 0x80000013, 0x00000000,
+  0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1,
+  0x00d8d8d8, 0x005f5f5f, 0x80000040, 0x00000000, 0x00000003, 0x00606060, 0x007a7a7a, 0x00fdfdfd,
+  0x8000001a, 0x00ffffff, 0x00000004, 0x00f8f8f8, 0x00cdcdcd, 0x001e1e1e, 0x00121212, 0x80000016,
+  0x00000000, 0x00000003, 0x00010101, 0x009a9a9a, 0x00afafaf, 0x8000000f, 0x00ffffff, 0x00000003,
+  0x00fdfdfd, 0x005c5c5c, 0x00484848, 0x8000002a, 0x00000000, 0x00000003, 0x00020202, 0x00505050,
+  0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016,
+  0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878,
+  0x00595959, 0x8000001e, 0x00000000, 0x00000004, 0x00070707, 0x000b0b0b, 0x00c6c6c6, 0x00e3e3e3,
+  0x80000019, 0x00ffffff, 0x00000002, 0x00f3f3f3, 0x00dddddd, 0x80000013, 0x00000000, 0x00000003,
+  0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020,
+  0x000a0a0a, 0x8000001d, 0x00000000, 0x00000003, 0x000c0c0c, 0x00686868, 0x00979797, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00cccccc, 0x00616161, 0x002e2e2e, 0x8000001c, 0x00000000, 0x00000004,
+  0x00242424, 0x00313131, 0x00e7e7e7, 0x00f5f5f5, 0x80000019, 0x00ffffff, 0x00000002, 0x00b8b8b8,
+  0x009a9a9a, 0x80000013, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018,
+  0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000040, 0x00000000, 0x00000003,
+  0x008b8b8b, 0x00b1b1b1, 0x00fefefe, 0x8000001a, 0x00ffffff, 0x00000004, 0x00f1f1f1, 0x00c2c2c2,
+  0x00040404, 0x00020202, 0x80000015, 0x00000000, 0x00000004, 0x00111111, 0x00161616, 0x00dedede,
+  0x00e5e5e5, 0x8000000e, 0x00ffffff, 0x00000004, 0x00f3f3f3, 0x00eeeeee, 0x00202020, 0x00191919,
+  0x8000002a, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x8000001e, 0x00000000,
+  0x00000004, 0x00020202, 0x00030303, 0x00989898, 0x00b4b4b4, 0x80000019, 0x00ffffff, 0x00000004,
+  0x00fbfbfb, 0x00e6e6e6, 0x00020202, 0x00020202, 0x80000011, 0x00000000, 0x00000003, 0x00171717,
+  0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a,
+  0x8000001c, 0x00000000, 0x00000004, 0x00030303, 0x00181818, 0x00bcbcbc, 0x00d1d1d1, 0x80000018,
+  0x00ffffff, 0x00000005, 0x00f7f7f7, 0x00bbbbbb, 0x00888888, 0x001c1c1c, 0x000d0d0d, 0x8000001c,
+  0x00000000, 0x00000004, 0x000a0a0a, 0x000e0e0e, 0x009f9f9f, 0x00b5b5b5, 0x80000019, 0x00ffffff,
+  0x00000004, 0x00e9e9e9, 0x00cacaca, 0x00161616, 0x000e0e0e, 0x80000011, 0x00000000, 0x00000003,
+  0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8,
+  0x005f5f5f, 0x8000003e, 0x00000000, 0x00000004, 0x000f0f0f, 0x001a1a1a, 0x00bbbbbb, 0x00e7e7e7,
+  0x8000001b, 0x00ffffff, 0x00000004, 0x00c2c2c2, 0x009c9c9c, 0x00010101, 0x00010101, 0x80000015,
+  0x00000000, 0x00000004, 0x00171717, 0x001e1e1e, 0x00f9f9f9, 0x00fafafa, 0x8000000e, 0x00ffffff,
+  0x00000004, 0x00efefef, 0x00e8e8e8, 0x00070707, 0x00060606, 0x8000002a, 0x00000000, 0x00000003,
+  0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050,
+  0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x00858585, 0x00a0a0a0,
+  0x80000019, 0x00ffffff, 0x00000004, 0x00fefefe, 0x00e9e9e9, 0x00030303, 0x00020202, 0x80000011,
+  0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00909090, 0x00202020, 0x000a0a0a, 0x8000001c, 0x00000000, 0x00000004, 0x00040404, 0x001c1c1c,
+  0x00dedede, 0x00e8e8e8, 0x80000018, 0x00ffffff, 0x00000003, 0x00f3f3f3, 0x009f9f9f, 0x006c6c6c,
+  0x80000020, 0x00000000, 0x00000002, 0x00828282, 0x009b9b9b, 0x80000019, 0x00ffffff, 0x00000004,
+  0x00fdfdfd, 0x00dddddd, 0x001f1f1f, 0x00141414, 0x80000011, 0x00000000, 0x00000003, 0x00414141,
+  0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f,
+  0x8000003e, 0x00000000, 0x00000004, 0x00151515, 0x00242424, 0x00cfcfcf, 0x00fdfdfd, 0x8000001b,
+  0x00ffffff, 0x00000002, 0x00afafaf, 0x008c8c8c, 0x80000017, 0x00000000, 0x00000003, 0x006d6d6d,
+  0x00888888, 0x00fefefe, 0x8000000f, 0x00ffffff, 0x00000003, 0x00a6a6a6, 0x00909090, 0x00010101,
+  0x8000002b, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000,
+  0x00000002, 0x00696969, 0x00828282, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ebebeb, 0x00121212,
+  0x000d0d0d, 0x80000011, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000001c, 0x00000000, 0x00000004,
+  0x00363636, 0x00515151, 0x00fcfcfc, 0x00fdfdfd, 0x80000017, 0x00ffffff, 0x00000004, 0x00e8e8e8,
+  0x00cdcdcd, 0x001c1c1c, 0x00131313, 0x80000020, 0x00000000, 0x00000004, 0x00202020, 0x003f3f3f,
+  0x00f8f8f8, 0x00fafafa, 0x80000018, 0x00ffffff, 0x00000003, 0x00ebebeb, 0x00767676, 0x004e4e4e,
+  0x80000011, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff,
+  0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x8000003e, 0x00000000, 0x00000003, 0x00505050,
+  0x00888888, 0x00e5e5e5, 0x8000001c, 0x00ffffff, 0x00000002, 0x00606060, 0x004d4d4d, 0x80000015,
+  0x00000000, 0x00000004, 0x00020202, 0x00030303, 0x007f7f7f, 0x009e9e9e, 0x80000010, 0x00ffffff,
+  0x00000002, 0x00969696, 0x007c7c7c, 0x8000002c, 0x00000000, 0x00000003, 0x00020202, 0x00505050,
+  0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016,
+  0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878,
+  0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x00636363, 0x007c7c7c, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00ececec, 0x00141414, 0x000f0f0f, 0x80000011, 0x00000000, 0x00000003, 0x00171717,
+  0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a,
+  0x8000001c, 0x00000000, 0x00000002, 0x00424242, 0x005d5d5d, 0x80000019, 0x00ffffff, 0x00000004,
+  0x00d9d9d9, 0x00bdbdbd, 0x000d0d0d, 0x00090909, 0x80000020, 0x00000000, 0x00000004, 0x00141414,
+  0x00323232, 0x00ececec, 0x00f3f3f3, 0x80000018, 0x00ffffff, 0x00000003, 0x00ededed, 0x00868686,
+  0x00585858, 0x80000011, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018,
+  0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005e5e5e, 0x8000003c, 0x00000000, 0x00000005,
+  0x00010101, 0x00020202, 0x005c5c5c, 0x009d9d9d, 0x00eaeaea, 0x8000001a, 0x00ffffff, 0x00000004,
+  0x00fefefe, 0x00fdfdfd, 0x00505050, 0x00404040, 0x80000015, 0x00000000, 0x00000004, 0x000e0e0e,
+  0x00171717, 0x00cccccc, 0x00f7f7f7, 0x8000000e, 0x00ffffff, 0x00000004, 0x00fefefe, 0x00fefefe,
+  0x004b4b4b, 0x00222222, 0x8000002c, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000,
+  0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959,
+  0x80000020, 0x00000000, 0x00000002, 0x004e4e4e, 0x00656565, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00ededed, 0x001f1f1f, 0x00161616, 0x80000011, 0x00000000, 0x00000003, 0x00171717, 0x00505050,
+  0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000001c,
+  0x00000000, 0x00000002, 0x00777777, 0x00919191, 0x80000019, 0x00ffffff, 0x00000002, 0x00747474,
+  0x005b5b5b, 0x80000023, 0x00000000, 0x00000003, 0x00141414, 0x00959595, 0x00b9b9b9, 0x80000018,
+  0x00ffffff, 0x00000003, 0x00f6f6f6, 0x00bebebe, 0x007c7c7c, 0x80000011, 0x00000000, 0x00000003,
+  0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8,
+  0x005f5f5f, 0x8000003c, 0x00000000, 0x00000005, 0x00060606, 0x000f0f0f, 0x00949494, 0x00f3f3f3,
+  0x00fcfcfc, 0x8000001a, 0x00ffffff, 0x00000004, 0x00f2f2f2, 0x00efefef, 0x00090909, 0x00060606,
+  0x80000015, 0x00000000, 0x00000004, 0x00232323, 0x003a3a3a, 0x00d4d4d4, 0x00fafafa, 0x8000000e,
+  0x00ffffff, 0x00000004, 0x00f1f1f1, 0x00e8e8e8, 0x003f3f3f, 0x00171717, 0x8000002c, 0x00000000,
+  0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5,
+  0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d,
+  0x00656565, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x001f1f1f, 0x00161616, 0x80000011,
+  0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x008f8f8f, 0x00202020, 0x000a0a0a, 0x8000001c, 0x00000000, 0x00000002, 0x008a8a8a, 0x00a3a3a3,
+  0x80000017, 0x00ffffff, 0x00000004, 0x00fefefe, 0x00fefefe, 0x005c5c5c, 0x00454545, 0x80000023,
+  0x00000000, 0x00000005, 0x000f0f0f, 0x00717171, 0x00a0a0a0, 0x00fefefe, 0x00fefefe, 0x80000016,
+  0x00ffffff, 0x00000004, 0x00f8f8f8, 0x00cecece, 0x00878787, 0x00010101, 0x80000010, 0x00000000,
+  0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1,
+  0x00d8d8d8, 0x005e5e5e, 0x8000003c, 0x00000000, 0x00000005, 0x00121212, 0x002e2e2e, 0x00a3a3a3,
+  0x00f7f7f7, 0x00fdfdfd, 0x8000001a, 0x00ffffff, 0x00000004, 0x00dddddd, 0x00d4d4d4, 0x00060606,
+  0x00040404, 0x80000015, 0x00000000, 0x00000003, 0x00545454, 0x008a8a8a, 0x00e8e8e8, 0x8000000f,
+  0x00ffffff, 0x00000003, 0x00d3d3d3, 0x00b7b7b7, 0x00222222, 0x8000002d, 0x00000000, 0x00000003,
+  0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050,
+  0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000,
+  0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090,
+  0x00202020, 0x000a0a0a, 0x8000001c, 0x00000000, 0x00000002, 0x00b4b4b4, 0x00cbcbcb, 0x80000017,
+  0x00ffffff, 0x00000004, 0x00fcfcfc, 0x00fbfbfb, 0x00262626, 0x00121212, 0x80000023, 0x00000000,
+  0x00000005, 0x00040404, 0x001f1f1f, 0x00696969, 0x00fbfbfb, 0x00fdfdfd, 0x80000016, 0x00ffffff,
+  0x00000005, 0x00fdfdfd, 0x00f3f3f3, 0x00a0a0a0, 0x00030303, 0x00010101, 0x8000000f, 0x00000000,
+  0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1,
+  0x00d8d8d8, 0x005f5f5f, 0x8000003c, 0x00000000, 0x00000003, 0x002c2c2c, 0x00737373, 0x00c5c5c5,
+  0x8000001c, 0x00ffffff, 0x00000002, 0x00acacac, 0x00979797, 0x80000015, 0x00000000, 0x00000005,
+  0x00040404, 0x000a0a0a, 0x00787878, 0x00bfbfbf, 0x00f3f3f3, 0x8000000f, 0x00ffffff, 0x00000003,
+  0x00b2b2b2, 0x00818181, 0x00181818, 0x8000002d, 0x00000000, 0x00000003, 0x00020202, 0x00505050,
+  0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016,
+  0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878,
+  0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003, 0x00171717,
+  0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x008f8f8f, 0x00202020, 0x000a0a0a,
+  0x8000001a, 0x00000000, 0x00000004, 0x00040404, 0x00060606, 0x00cdcdcd, 0x00e4e4e4, 0x80000017,
+  0x00ffffff, 0x00000004, 0x00e4e4e4, 0x00dadada, 0x001a1a1a, 0x00090909, 0x80000023, 0x00000000,
+  0x00000005, 0x00020202, 0x000f0f0f, 0x00575757, 0x00e5e5e5, 0x00f3f3f3, 0x80000016, 0x00ffffff,
+  0x00000005, 0x00fefefe, 0x00f9f9f9, 0x00acacac, 0x00191919, 0x000b0b0b, 0x8000000f, 0x00000000,
+  0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1,
+  0x00d8d8d8, 0x005f5f5f, 0x8000003a, 0x00000000, 0x00000005, 0x00020202, 0x00090909, 0x00494949,
+  0x00afafaf, 0x00dedede, 0x8000001c, 0x00ffffff, 0x00000002, 0x00858585, 0x00666666, 0x80000015,
+  0x00000000, 0x00000005, 0x00080808, 0x00131313, 0x009b9b9b, 0x00f3f3f3, 0x00fdfdfd, 0x8000000f,
+  0x00ffffff, 0x00000003, 0x00929292, 0x004d4d4d, 0x000e0e0e, 0x8000002d, 0x00000000, 0x00000003,
+  0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050,
+  0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000,
+  0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090,
+  0x00202020, 0x000a0a0a, 0x8000001a, 0x00000000, 0x00000004, 0x00090909, 0x000c0c0c, 0x00e6e6e6,
+  0x00fbfbfb, 0x80000017, 0x00ffffff, 0x00000003, 0x00cdcdcd, 0x00b9b9b9, 0x000f0f0f, 0x80000026,
+  0x00000000, 0x00000003, 0x00464646, 0x00d0d0d0, 0x00e9e9e9, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00b7b7b7, 0x002e2e2e, 0x00151515, 0x8000000f, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8,
+  0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x8000003a,
+  0x00000000, 0x00000005, 0x00030303, 0x00121212, 0x00656565, 0x00eaeaea, 0x00f6f6f6, 0x8000001c,
+  0x00ffffff, 0x00000002, 0x00606060, 0x00373737, 0x80000015, 0x00000000, 0x00000005, 0x00272727,
+  0x00616161, 0x00bfbfbf, 0x00fbfbfb, 0x00fefefe, 0x8000000d, 0x00ffffff, 0x00000005, 0x00f8f8f8,
+  0x00ededed, 0x006b6b6b, 0x00191919, 0x00050505, 0x8000002d, 0x00000000, 0x00000003, 0x00020202,
+  0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d,
+  0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7,
+  0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003,
+  0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020,
+  0x000a0a0a, 0x8000001a, 0x00000000, 0x00000004, 0x00282828, 0x00383838, 0x00ececec, 0x00fefefe,
+  0x80000017, 0x00ffffff, 0x00000003, 0x00a8a8a8, 0x00878787, 0x000b0b0b, 0x80000026, 0x00000000,
+  0x00000003, 0x003c3c3c, 0x00b4b4b4, 0x00dcdcdc, 0x80000018, 0x00ffffff, 0x00000003, 0x00c4c4c4,
+  0x00565656, 0x00272727, 0x8000000f, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf,
+  0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x8000003a, 0x00000000,
+  0x00000005, 0x00151515, 0x00747474, 0x00a7a7a7, 0x00f9f9f9, 0x00fcfcfc, 0x8000001a, 0x00ffffff,
+  0x00000004, 0x00eeeeee, 0x00e2e2e2, 0x003b3b3b, 0x00101010, 0x80000015, 0x00000000, 0x00000003,
+  0x00353535, 0x00828282, 0x00cecece, 0x8000000f, 0x00ffffff, 0x00000005, 0x00f5f5f5, 0x00e6e6e6,
+  0x005b5b5b, 0x00030303, 0x00010101, 0x8000002d, 0x00000000, 0x00000003, 0x00020202, 0x00505050,
+  0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016,
+  0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878,
+  0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003, 0x00171717,
+  0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a,
+  0x8000001a, 0x00000000, 0x00000003, 0x00353535, 0x004a4a4a, 0x00efefef, 0x80000018, 0x00ffffff,
+  0x00000003, 0x00999999, 0x00727272, 0x00090909, 0x80000026, 0x00000000, 0x00000003, 0x00383838,
+  0x00a8a8a8, 0x00d7d7d7, 0x80000018, 0x00ffffff, 0x00000003, 0x00cacaca, 0x00666666, 0x002e2e2e,
+  0x8000000f, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff,
+  0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x8000003a, 0x00000000, 0x00000003, 0x001d1d1d,
+  0x009d9d9d, 0x00c3c3c3, 0x8000001c, 0x00ffffff, 0x00000003, 0x00e7e7e7, 0x00d6d6d6, 0x002c2c2c,
+  0x80000014, 0x00000000, 0x00000005, 0x00010101, 0x00050505, 0x005e5e5e, 0x00e3e3e3, 0x00f4f4f4,
+  0x8000000f, 0x00ffffff, 0x00000003, 0x00d9d9d9, 0x00a2a2a2, 0x003f3f3f, 0x8000002f, 0x00000000,
+  0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5,
+  0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d,
+  0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011,
+  0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00909090, 0x00202020, 0x000a0a0a, 0x8000001a, 0x00000000, 0x00000003, 0x005f5f5f, 0x00868686,
+  0x00f4f4f4, 0x80000018, 0x00ffffff, 0x00000003, 0x00858585, 0x00555555, 0x00070707, 0x80000026,
+  0x00000000, 0x00000003, 0x002d2d2d, 0x00858585, 0x00c6c6c6, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00dcdcdc, 0x00999999, 0x00454545, 0x8000000f, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8,
+  0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000039,
+  0x00000000, 0x00000004, 0x00383838, 0x005c5c5c, 0x00f5f5f5, 0x00f9f9f9, 0x8000001c, 0x00ffffff,
+  0x00000003, 0x00b1b1b1, 0x007c7c7c, 0x00191919, 0x80000014, 0x00000000, 0x00000005, 0x00020202,
+  0x000c0c0c, 0x00686868, 0x00efefef, 0x00f9f9f9, 0x8000000f, 0x00ffffff, 0x00000003, 0x00d3d3d3,
+  0x00939393, 0x00393939, 0x8000002f, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000,
+  0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959,
+  0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003, 0x00171717, 0x00505050,
+  0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000001a,
+  0x00000000, 0x00000003, 0x00676767, 0x00929292, 0x00f5f5f5, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00808080, 0x004f4f4f, 0x00060606, 0x80000026, 0x00000000, 0x00000003, 0x002a2a2a, 0x007d7d7d,
+  0x00c3c3c3, 0x80000018, 0x00ffffff, 0x00000003, 0x00dfdfdf, 0x00a3a3a3, 0x004a4a4a, 0x8000000f,
+  0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000038, 0x00000000, 0x00000005, 0x00010101, 0x004e4e4e,
+  0x006f6f6f, 0x00fefefe, 0x00fefefe, 0x8000001a, 0x00ffffff, 0x00000005, 0x00fefefe, 0x00fdfdfd,
+  0x00a5a5a5, 0x00686868, 0x00151515, 0x80000014, 0x00000000, 0x00000003, 0x000e0e0e, 0x00464646,
+  0x00919191, 0x80000011, 0x00ffffff, 0x00000003, 0x00b7b7b7, 0x00505050, 0x001f1f1f, 0x8000002f,
+  0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002,
+  0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717,
+  0x80000011, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000001a, 0x00000000, 0x00000003, 0x008a8a8a,
+  0x00c2c2c2, 0x00fafafa, 0x80000018, 0x00ffffff, 0x00000003, 0x006d6d6d, 0x00353535, 0x00040404,
+  0x80000026, 0x00000000, 0x00000003, 0x001e1e1e, 0x00595959, 0x00b2b2b2, 0x80000018, 0x00ffffff,
+  0x00000003, 0x00eeeeee, 0x00cfcfcf, 0x005e5e5e, 0x8000000f, 0x00000000, 0x00000003, 0x00414141,
+  0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f,
+  0x80000037, 0x00000000, 0x00000004, 0x00050505, 0x00060606, 0x00d4d4d4, 0x00dedede, 0x8000001c,
+  0x00ffffff, 0x00000005, 0x00f8f8f8, 0x00eeeeee, 0x00686868, 0x000d0d0d, 0x00030303, 0x80000014,
+  0x00000000, 0x00000003, 0x00131313, 0x005f5f5f, 0x00a0a0a0, 0x80000010, 0x00ffffff, 0x00000004,
+  0x00fdfdfd, 0x00adadad, 0x003b3b3b, 0x00171717, 0x8000002f, 0x00000000, 0x00000003, 0x00020202,
+  0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d,
+  0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7,
+  0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003,
+  0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020,
+  0x000a0a0a, 0x8000001a, 0x00000000, 0x00000003, 0x008f8f8f, 0x00c9c9c9, 0x00fafafa, 0x80000018,
+  0x00ffffff, 0x00000003, 0x00747474, 0x003e3e3e, 0x00171717, 0x80000026, 0x00131313, 0x00000003,
+  0x002c2c2c, 0x005e5e5e, 0x00b4b4b4, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d5d5d5,
+  0x00616161, 0x8000000f, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018,
+  0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000037, 0x00000000, 0x00000004,
+  0x00212121, 0x002a2a2a, 0x00e0e0e0, 0x00e8e8e8, 0x8000001c, 0x00ffffff, 0x00000005, 0x00ebebeb,
+  0x00cdcdcd, 0x00585858, 0x00090909, 0x00020202, 0x80000014, 0x00000000, 0x00000003, 0x001f1f1f,
+  0x00989898, 0x00c2c2c2, 0x8000000f, 0x00ffffff, 0x00000005, 0x00fefefe, 0x00f9f9f9, 0x00989898,
+  0x000c0c0c, 0x00050505, 0x8000002f, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000,
+  0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959,
+  0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003, 0x00171717, 0x00505050,
+  0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000001a,
+  0x00000000, 0x00000003, 0x00999999, 0x00d8d8d8, 0x00fcfcfc, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00848484, 0x00545454, 0x00424242, 0x80000026, 0x00404040, 0x00000003, 0x004e4e4e, 0x00696969,
+  0x00b9b9b9, 0x80000018, 0x00ffffff, 0x00000003, 0x00f5f5f5, 0x00e3e3e3, 0x00676767, 0x8000000f,
+  0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00f1f1f1, 0x00d8d8d8, 0x005e5e5e, 0x80000037, 0x00000000, 0x00000003, 0x00636363, 0x007e7e7e,
+  0x00fdfdfd, 0x8000001d, 0x00ffffff, 0x00000003, 0x00cdcdcd, 0x00818181, 0x00343434, 0x80000015,
+  0x00000000, 0x00000004, 0x00010101, 0x00282828, 0x00c0c0c0, 0x00dadada, 0x8000000f, 0x00ffffff,
+  0x00000005, 0x00f7f7f7, 0x00dadada, 0x00838383, 0x00060606, 0x00020202, 0x8000002f, 0x00000000,
+  0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5,
+  0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d,
+  0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011,
+  0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00909090, 0x00202020, 0x000a0a0a, 0x8000001a, 0x00000000, 0x00000003, 0x00a1a1a1, 0x00e2e2e2,
+  0x00fcfcfc, 0x80000018, 0x00ffffff, 0x00000003, 0x00c2c2c2, 0x00aaaaaa, 0x00a1a1a1, 0x80000026,
+  0x00a0a0a0, 0x00000003, 0x00a7a7a7, 0x00b4b4b4, 0x00dcdcdc, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00f8f8f8, 0x00ececec, 0x006b6b6b, 0x8000000f, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8,
+  0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000035,
+  0x00000000, 0x00000005, 0x000b0b0b, 0x00131313, 0x00979797, 0x00bbbbbb, 0x00fefefe, 0x8000001b,
+  0x00ffffff, 0x00000005, 0x00fefefe, 0x00f9f9f9, 0x00b4b4b4, 0x004a4a4a, 0x001e1e1e, 0x80000015,
+  0x00000000, 0x00000004, 0x00020202, 0x00313131, 0x00e8e8e8, 0x00f1f1f1, 0x8000000f, 0x00ffffff,
+  0x00000003, 0x00f1f1f1, 0x00bcbcbc, 0x006f6f6f, 0x80000031, 0x00000000, 0x00000003, 0x00020202,
+  0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d,
+  0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7,
+  0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003,
+  0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020,
+  0x000a0a0a, 0x8000001a, 0x00000000, 0x00000003, 0x00a8a8a8, 0x00ececec, 0x00fdfdfd, 0x8000005c,
+  0x00ffffff, 0x00000003, 0x00fcfcfc, 0x00f5f5f5, 0x006f6f6f, 0x8000000f, 0x00000000, 0x00000003,
+  0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8,
+  0x005f5f5f, 0x80000035, 0x00000000, 0x00000004, 0x00161616, 0x00262626, 0x00cacaca, 0x00f8f8f8,
+  0x8000001c, 0x00ffffff, 0x00000005, 0x00fdfdfd, 0x00f3f3f3, 0x009b9b9b, 0x00131313, 0x00080808,
+  0x80000015, 0x00000000, 0x00000004, 0x002b2b2b, 0x00555555, 0x00f8f8f8, 0x00fbfbfb, 0x8000000f,
+  0x00ffffff, 0x00000003, 0x00e6e6e6, 0x00878787, 0x00505050, 0x80000031, 0x00000000, 0x00000003,
+  0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050,
+  0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000,
+  0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090,
+  0x00202020, 0x000a0a0a, 0x80000018, 0x00000000, 0x00000005, 0x00010101, 0x00020202, 0x00b1b1b1,
+  0x00f8f8f8, 0x00fefefe, 0x8000005c, 0x00ffffff, 0x00000005, 0x00fefefe, 0x00fcfcfc, 0x00757575,
+  0x00050505, 0x00010101, 0x8000000d, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf,
+  0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000035, 0x00000000,
+  0x00000004, 0x00545454, 0x00919191, 0x00e5e5e5, 0x00fdfdfd, 0x8000001c, 0x00ffffff, 0x00000005,
+  0x00efefef, 0x00ababab, 0x006a6a6a, 0x00060606, 0x00020202, 0x80000015, 0x00000000, 0x00000002,
+  0x003c3c3c, 0x00646464, 0x80000011, 0x00ffffff, 0x00000003, 0x00e1e1e1, 0x00717171, 0x00434343,
+  0x80000031, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000,
+  0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020,
+  0x00171717, 0x80000011, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x80000018, 0x00000000, 0x00000004,
+  0x00020202, 0x00030303, 0x00b5b5b5, 0x00fdfdfd, 0x8000005f, 0x00ffffff, 0x00000003, 0x00787878,
+  0x00070707, 0x00020202, 0x8000000d, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf,
+  0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000035, 0x00000000,
+  0x00000003, 0x006f6f6f, 0x00bebebe, 0x00f1f1f1, 0x8000001d, 0x00ffffff, 0x00000003, 0x00e9e9e9,
+  0x008c8c8c, 0x00555555, 0x80000017, 0x00000000, 0x00000002, 0x00868686, 0x009f9f9f, 0x80000011,
+  0x00ffffff, 0x00000003, 0x00d3d3d3, 0x002e2e2e, 0x001b1b1b, 0x80000031, 0x00000000, 0x00000003,
+  0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050,
+  0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000,
+  0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090,
+  0x00202020, 0x000a0a0a, 0x80000018, 0x00000000, 0x00000003, 0x000a0a0a, 0x00131313, 0x00bbbbbb,
+  0x80000060, 0x00ffffff, 0x00000003, 0x00808080, 0x00161616, 0x00060606, 0x8000000d, 0x00000000,
+  0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1,
+  0x00d8d8d8, 0x005f5f5f, 0x80000033, 0x00000000, 0x00000005, 0x002a2a2a, 0x006f6f6f, 0x00bfbfbf,
+  0x00f9f9f9, 0x00fefefe, 0x8000001c, 0x00ffffff, 0x00000004, 0x00f9f9f9, 0x00d0d0d0, 0x00242424,
+  0x00161616, 0x80000017, 0x00000000, 0x00000002, 0x00969696, 0x00acacac, 0x80000010, 0x00ffffff,
+  0x00000004, 0x00fcfcfc, 0x00cecece, 0x00232323, 0x00151515, 0x80000031, 0x00000000, 0x00000003,
+  0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050,
+  0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000,
+  0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090,
+  0x00202020, 0x000a0a0a, 0x80000018, 0x00000000, 0x00000003, 0x000c0c0c, 0x00171717, 0x00bcbcbc,
+  0x80000060, 0x00ffffff, 0x00000003, 0x00828282, 0x001a1a1a, 0x00070707, 0x8000000d, 0x00000000,
+  0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1,
+  0x00d8d8d8, 0x005f5f5f, 0x80000031, 0x00000000, 0x00000005, 0x00020202, 0x00080808, 0x00393939,
+  0x00888888, 0x00cdcdcd, 0x8000001e, 0x00ffffff, 0x00000004, 0x00ededed, 0x00c3c3c3, 0x00171717,
+  0x000e0e0e, 0x80000016, 0x00000000, 0x00000003, 0x00010101, 0x00e0e0e0, 0x00e6e6e6, 0x80000010,
+  0x00ffffff, 0x00000002, 0x00dcdcdc, 0x00aeaeae, 0x80000033, 0x00000000, 0x00000003, 0x00020202,
+  0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d,
+  0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7,
+  0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003,
+  0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020,
+  0x000a0a0a, 0x80000018, 0x00000000, 0x00000003, 0x00151515, 0x00292929, 0x00c1c1c1, 0x80000060,
+  0x00ffffff, 0x00000003, 0x008b8b8b, 0x002a2a2a, 0x000b0b0b, 0x8000000d, 0x00000000, 0x00000003,
+  0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8,
+  0x005f5f5f, 0x80000031, 0x00000000, 0x00000004, 0x000f0f0f, 0x00545454, 0x00959595, 0x00fefefe,
+  0x8000001f, 0x00ffffff, 0x00000002, 0x00888888, 0x006d6d6d, 0x80000017, 0x00000000, 0x00000004,
+  0x000c0c0c, 0x00101010, 0x00e9e9e9, 0x00eeeeee, 0x8000000f, 0x00ffffff, 0x00000003, 0x00fefefe,
+  0x00c6c6c6, 0x009c9c9c, 0x80000033, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000,
+  0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959,
+  0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003, 0x00171717, 0x00505050,
+  0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x008f8f8f, 0x00202020, 0x000a0a0a, 0x80000018,
+  0x00000000, 0x00000003, 0x00181818, 0x002f2f2f, 0x00c3c3c3, 0x80000060, 0x00ffffff, 0x00000003,
+  0x008d8d8d, 0x002f2f2f, 0x000c0c0c, 0x8000000d, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8,
+  0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000030,
+  0x00000000, 0x00000005, 0x000f0f0f, 0x00252525, 0x00848484, 0x00b3b3b3, 0x00fefefe, 0x8000001d,
+  0x00ffffff, 0x00000004, 0x00f8f8f8, 0x00f6f6f6, 0x00636363, 0x004f4f4f, 0x80000017, 0x00000000,
+  0x00000002, 0x00282828, 0x00333333, 0x80000011, 0x00ffffff, 0x00000003, 0x00fefefe, 0x00939393,
+  0x00747474, 0x80000033, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001,
+  0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020,
+  0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed,
+  0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x80000018, 0x00000000,
+  0x00000003, 0x001f1f1f, 0x003d3d3d, 0x00c7c7c7, 0x80000060, 0x00ffffff, 0x00000003, 0x00949494,
+  0x003b3b3b, 0x000f0f0f, 0x8000000d, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf,
+  0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000030, 0x00000000,
+  0x00000004, 0x00333333, 0x00575757, 0x00f6f6f6, 0x00f9f9f9, 0x8000001e, 0x00ffffff, 0x00000004,
+  0x00e8e8e8, 0x00e2e2e2, 0x000b0b0b, 0x00080808, 0x80000017, 0x00000000, 0x00000002, 0x00494949,
+  0x005b5b5b, 0x80000011, 0x00ffffff, 0x00000003, 0x00fefefe, 0x00797979, 0x00606060, 0x80000033,
+  0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002,
+  0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717,
+  0x80000011, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x80000018, 0x00000000, 0x00000003, 0x00222222,
+  0x00434343, 0x00c9c9c9, 0x80000060, 0x00ffffff, 0x00000003, 0x00959595, 0x003d3d3d, 0x00101010,
+  0x8000000d, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff,
+  0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x8000002e, 0x00000000, 0x00000006, 0x000b0b0b,
+  0x000e0e0e, 0x008a8a8a, 0x00a0a0a0, 0x00fafafa, 0x00fcfcfc, 0x8000001e, 0x00ffffff, 0x00000004,
+  0x00afafaf, 0x009a9a9a, 0x00060606, 0x00040404, 0x80000017, 0x00000000, 0x00000002, 0x006a6a6a,
+  0x00848484, 0x80000011, 0x00ffffff, 0x00000003, 0x00fdfdfd, 0x005f5f5f, 0x004b4b4b, 0x80000033,
+  0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002,
+  0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717,
+  0x80000011, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x80000018, 0x00000000, 0x00000003, 0x00262626,
+  0x004a4a4a, 0x00cbcbcb, 0x80000060, 0x00ffffff, 0x00000003, 0x00979797, 0x00404040, 0x00101010,
+  0x8000000d, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff,
+  0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005e5e5e, 0x8000002e, 0x00000000, 0x00000004, 0x00161616,
+  0x001c1c1c, 0x00e2e2e2, 0x00ebebeb, 0x80000020, 0x00ffffff, 0x00000003, 0x00767676, 0x00525252,
+  0x00010101, 0x80000018, 0x00000000, 0x00000002, 0x00989898, 0x00bdbdbd, 0x80000011, 0x00ffffff,
+  0x00000003, 0x00fdfdfd, 0x00414141, 0x00333333, 0x80000033, 0x00000000, 0x00000003, 0x00020202,
+  0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d,
+  0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7,
+  0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003,
+  0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020,
+  0x000a0a0a, 0x80000018, 0x00000000, 0x00000003, 0x00202020, 0x003f3f3f, 0x00c7c7c7, 0x80000060,
+  0x00ffffff, 0x00000003, 0x00979797, 0x00404040, 0x00101010, 0x8000000d, 0x00000000, 0x00000003,
+  0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8,
+  0x005f5f5f, 0x8000002c, 0x00000000, 0x00000006, 0x00040404, 0x00080808, 0x00787878, 0x00989898,
+  0x00f6f6f6, 0x00f9f9f9, 0x8000001e, 0x00ffffff, 0x00000004, 0x00e1e1e1, 0x00cdcdcd, 0x003e3e3e,
+  0x00191919, 0x80000019, 0x00000000, 0x00000002, 0x00acacac, 0x00d6d6d6, 0x80000011, 0x00ffffff,
+  0x00000003, 0x00fdfdfd, 0x00343434, 0x00292929, 0x80000033, 0x00000000, 0x00000003, 0x00020202,
+  0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d,
+  0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7,
+  0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003,
+  0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020,
+  0x000a0a0a, 0x80000018, 0x00000000, 0x00000003, 0x001e1e1e, 0x003a3a3a, 0x00c6c6c6, 0x80000060,
+  0x00ffffff, 0x00000003, 0x00979797, 0x00404040, 0x00101010, 0x8000000d, 0x00000000, 0x00000003,
+  0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8,
+  0x005f5f5f, 0x8000002c, 0x00000000, 0x00000005, 0x00060606, 0x000b0b0b, 0x00a3a3a3, 0x00cecece,
+  0x00fefefe, 0x8000001f, 0x00ffffff, 0x00000003, 0x00d4d4d4, 0x00b7b7b7, 0x00262626, 0x80000018,
+  0x00000000, 0x00000004, 0x00151515, 0x00232323, 0x00d0d0d0, 0x00fbfbfb, 0x80000010, 0x00ffffff,
+  0x00000004, 0x00fefefe, 0x00fcfcfc, 0x000e0e0e, 0x000b0b0b, 0x80000033, 0x00000000, 0x00000003,
+  0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050,
+  0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000,
+  0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090,
+  0x00202020, 0x000a0a0a, 0x80000018, 0x00000000, 0x00000003, 0x00141414, 0x00282828, 0x00c1c1c1,
+  0x80000060, 0x00ffffff, 0x00000003, 0x00979797, 0x00404040, 0x00101010, 0x8000000d, 0x00000000,
+  0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1,
+  0x00d8d8d8, 0x005f5f5f, 0x8000002a, 0x00000000, 0x00000006, 0x00010101, 0x00020202, 0x005c5c5c,
+  0x009e9e9e, 0x00e6e6e6, 0x00fafafa, 0x8000001e, 0x00ffffff, 0x00000005, 0x00fdfdfd, 0x00f9f9f9,
+  0x00848484, 0x00333333, 0x000b0b0b, 0x80000018, 0x00000000, 0x00000003, 0x001a1a1a, 0x002c2c2c,
+  0x00d5d5d5, 0x80000011, 0x00ffffff, 0x00000004, 0x00fcfcfc, 0x00f8f8f8, 0x00090909, 0x00070707,
+  0x80000033, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000,
+  0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020,
+  0x00171717, 0x80000011, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x80000018, 0x00000000, 0x00000003,
+  0x00121212, 0x00242424, 0x00c0c0c0, 0x80000060, 0x00ffffff, 0x00000003, 0x00979797, 0x00404040,
+  0x00101010, 0x8000000d, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018,
+  0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005e5e5e, 0x8000002a, 0x00000000, 0x00000005,
+  0x00060606, 0x000f0f0f, 0x00707070, 0x00b7b7b7, 0x00efefef, 0x8000001f, 0x00ffffff, 0x00000005,
+  0x00f7f7f7, 0x00ebebeb, 0x00737373, 0x00212121, 0x00070707, 0x80000018, 0x00000000, 0x00000003,
+  0x00373737, 0x005c5c5c, 0x00dfdfdf, 0x80000011, 0x00ffffff, 0x00000002, 0x00e3e3e3, 0x00dbdbdb,
+  0x80000035, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000,
+  0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020,
+  0x00171717, 0x80000011, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x80000018, 0x00000000, 0x00000003,
+  0x000a0a0a, 0x00131313, 0x00bbbbbb, 0x80000060, 0x00ffffff, 0x00000003, 0x00979797, 0x00404040,
+  0x00101010, 0x8000000d, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018,
+  0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x8000002a, 0x00000000, 0x00000003,
+  0x00363636, 0x00909090, 0x00d0d0d0, 0x80000021, 0x00ffffff, 0x00000003, 0x00c8c8c8, 0x00727272,
+  0x002f2f2f, 0x8000001a, 0x00000000, 0x00000003, 0x003e3e3e, 0x00676767, 0x00e1e1e1, 0x80000011,
+  0x00ffffff, 0x00000002, 0x00d9d9d9, 0x00cecece, 0x80000035, 0x00000000, 0x00000003, 0x00020202,
+  0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d,
+  0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7,
+  0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003,
+  0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020,
+  0x000a0a0a, 0x80000018, 0x00000000, 0x00000004, 0x00070707, 0x000e0e0e, 0x00b9b9b9, 0x00fefefe,
+  0x8000005f, 0x00ffffff, 0x00000003, 0x00979797, 0x00404040, 0x00101010, 0x8000000d, 0x00000000,
+  0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1,
+  0x00d8d8d8, 0x005f5f5f, 0x80000027, 0x00000000, 0x00000006, 0x00010101, 0x00090909, 0x002f2f2f,
+  0x00606060, 0x00b1b1b1, 0x00dedede, 0x8000001f, 0x00ffffff, 0x00000005, 0x00fafafa, 0x00e6e6e6,
+  0x00acacac, 0x00515151, 0x00212121, 0x8000001a, 0x00000000, 0x00000003, 0x004f4f4f, 0x00838383,
+  0x00e7e7e7, 0x80000011, 0x00ffffff, 0x00000002, 0x00c1c1c1, 0x00b0b0b0, 0x80000035, 0x00000000,
+  0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5,
+  0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d,
+  0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011,
+  0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00909090, 0x00202020, 0x000a0a0a, 0x80000018, 0x00000000, 0x00000004, 0x00010101, 0x00020202,
+  0x00b4b4b4, 0x00fdfdfd, 0x8000005f, 0x00ffffff, 0x00000003, 0x00979797, 0x00404040, 0x00101010,
+  0x8000000d, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff,
+  0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000027, 0x00000000, 0x00000004, 0x00040404,
+  0x00202020, 0x009f9f9f, 0x00c3c3c3, 0x80000021, 0x00ffffff, 0x00000003, 0x00efefef, 0x00ababab,
+  0x00686868, 0x8000001c, 0x00000000, 0x00000003, 0x005a5a5a, 0x00969696, 0x00eaeaea, 0x80000011,
+  0x00ffffff, 0x00000002, 0x00b0b0b0, 0x009b9b9b, 0x80000035, 0x00000000, 0x00000003, 0x00020202,
+  0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d,
+  0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7,
+  0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003,
+  0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020,
+  0x000a0a0a, 0x80000018, 0x00000000, 0x00000005, 0x00010101, 0x00010101, 0x00aeaeae, 0x00f4f4f4,
+  0x00fefefe, 0x80000018, 0x00ffffff, 0x00000003, 0x00c6c6c6, 0x00b0b0b0, 0x00a6a6a6, 0x80000043,
+  0x00a5a5a5, 0x00000003, 0x00616161, 0x00292929, 0x000a0a0a, 0x8000000d, 0x00000000, 0x00000003,
+  0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8,
+  0x005f5f5f, 0x80000025, 0x00000000, 0x00000006, 0x00040404, 0x00050505, 0x00595959, 0x00707070,
+  0x00cecece, 0x00e1e1e1, 0x80000020, 0x00ffffff, 0x00000004, 0x00ebebeb, 0x00d0d0d0, 0x005d5d5d,
+  0x00393939, 0x8000001c, 0x00000000, 0x00000003, 0x00666666, 0x00aaaaaa, 0x00eeeeee, 0x80000011,
+  0x00ffffff, 0x00000002, 0x009e9e9e, 0x00868686, 0x80000035, 0x00000000, 0x00000003, 0x00020202,
+  0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d,
+  0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7,
+  0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003,
+  0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020,
+  0x000a0a0a, 0x8000001a, 0x00000000, 0x00000003, 0x00a7a7a7, 0x00ebebeb, 0x00fdfdfd, 0x80000018,
+  0x00ffffff, 0x00000003, 0x008b8b8b, 0x005e5e5e, 0x004a4a4a, 0x80000043, 0x00484848, 0x00000003,
+  0x002b2b2b, 0x00121212, 0x00050505, 0x8000000d, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8,
+  0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000025,
+  0x00000000, 0x00000004, 0x00080808, 0x000a0a0a, 0x00b1b1b1, 0x00c2c2c2, 0x80000022, 0x00ffffff,
+  0x00000004, 0x00d7d7d7, 0x00b0b0b0, 0x000d0d0d, 0x00080808, 0x8000001c, 0x00000000, 0x00000003,
+  0x00777777, 0x00c5c5c5, 0x00f4f4f4, 0x80000011, 0x00ffffff, 0x00000002, 0x00858585, 0x00686868,
+  0x80000035, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000,
+  0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020,
+  0x00171717, 0x80000011, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x008f8f8f, 0x00202020, 0x000a0a0a, 0x8000001a, 0x00000000, 0x00000003,
+  0x009e9e9e, 0x00dedede, 0x00fcfcfc, 0x80000018, 0x00ffffff, 0x00000003, 0x007e7e7e, 0x004b4b4b,
+  0x001a1a1a, 0x80000043, 0x00161616, 0x00000003, 0x000d0d0d, 0x00060606, 0x00010101, 0x8000000d,
+  0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00f1f1f1, 0x00d8d8d8, 0x005e5e5e, 0x80000023, 0x00000000, 0x00000006, 0x00080808, 0x000e0e0e,
+  0x00717171, 0x008d8d8d, 0x00e6e6e6, 0x00ececec, 0x80000020, 0x00ffffff, 0x00000006, 0x00f8f8f8,
+  0x00f7f7f7, 0x00606060, 0x004d4d4d, 0x00040404, 0x00020202, 0x8000001c, 0x00000000, 0x00000003,
+  0x007e7e7e, 0x00d1d1d1, 0x00f6f6f6, 0x80000011, 0x00ffffff, 0x00000002, 0x007a7a7a, 0x005a5a5a,
+  0x80000035, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000,
+  0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020,
+  0x00171717, 0x80000011, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000001a, 0x00000000, 0x00000003,
+  0x00999999, 0x00d8d8d8, 0x00fcfcfc, 0x80000018, 0x00ffffff, 0x00000003, 0x00787878, 0x00434343,
+  0x00050505, 0x80000053, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018,
+  0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000023, 0x00000000, 0x00000005,
+  0x000c0c0c, 0x00141414, 0x00a0a0a0, 0x00c8c8c8, 0x00fefefe, 0x80000021, 0x00ffffff, 0x00000004,
+  0x00f6f6f6, 0x00f3f3f3, 0x002b2b2b, 0x00212121, 0x8000001d, 0x00000000, 0x00000004, 0x00010101,
+  0x00929292, 0x00f2f2f2, 0x00fcfcfc, 0x80000011, 0x00ffffff, 0x00000002, 0x005b5b5b, 0x00343434,
+  0x80000035, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000,
+  0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020,
+  0x00171717, 0x80000011, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000001a, 0x00000000, 0x00000003,
+  0x008d8d8d, 0x00c6c6c6, 0x00fafafa, 0x80000018, 0x00ffffff, 0x00000003, 0x00939393, 0x00696969,
+  0x00080808, 0x80000053, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018,
+  0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000021, 0x00000000, 0x00000006,
+  0x000b0b0b, 0x001c1c1c, 0x007d7d7d, 0x00c3c3c3, 0x00ededed, 0x00f9f9f9, 0x80000022, 0x00ffffff,
+  0x00000004, 0x00878787, 0x00676767, 0x00050505, 0x00040404, 0x8000001c, 0x00000000, 0x00000005,
+  0x00010101, 0x00040404, 0x00969696, 0x00f7f7f7, 0x00fdfdfd, 0x80000011, 0x00ffffff, 0x00000002,
+  0x00555555, 0x002d2d2d, 0x80000035, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000,
+  0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959,
+  0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003, 0x00171717, 0x00505050,
+  0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000001a,
+  0x00000000, 0x00000003, 0x008a8a8a, 0x00c2c2c2, 0x00fafafa, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00999999, 0x00727272, 0x00090909, 0x80000053, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8,
+  0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x8000001f,
+  0x00000000, 0x00000007, 0x00010101, 0x00040404, 0x00151515, 0x00323232, 0x00949494, 0x00dcdcdc,
+  0x00f7f7f7, 0x80000021, 0x00ffffff, 0x00000005, 0x00f9f9f9, 0x00f5f5f5, 0x00717171, 0x004e4e4e,
+  0x00010101, 0x8000001d, 0x00000000, 0x00000003, 0x000c0c0c, 0x001f1f1f, 0x00a6a6a6, 0x80000013,
+  0x00ffffff, 0x00000002, 0x003c3c3c, 0x000e0e0e, 0x80000035, 0x00000000, 0x00000003, 0x00020202,
+  0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d,
+  0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7,
+  0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003,
+  0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020,
+  0x000a0a0a, 0x8000001a, 0x00000000, 0x00000003, 0x007a7a7a, 0x00ababab, 0x00f8f8f8, 0x80000018,
+  0x00ffffff, 0x00000003, 0x00b5b5b5, 0x00989898, 0x000c0c0c, 0x80000053, 0x00000000, 0x00000003,
+  0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8,
+  0x005f5f5f, 0x8000001f, 0x00000000, 0x00000005, 0x00080808, 0x002f2f2f, 0x00747474, 0x00e6e6e6,
+  0x00f4f4f4, 0x80000023, 0x00ffffff, 0x00000003, 0x00bcbcbc, 0x008e8e8e, 0x001e1e1e, 0x8000001f,
+  0x00000000, 0x00000003, 0x00111111, 0x002a2a2a, 0x00aaaaaa, 0x80000013, 0x00ffffff, 0x00000002,
+  0x003a3a3a, 0x000b0b0b, 0x80000035, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000,
+  0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959,
+  0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003, 0x00171717, 0x00505050,
+  0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000001a,
+  0x00000000, 0x00000003, 0x006d6d6d, 0x00999999, 0x00f6f6f6, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00bebebe, 0x00a4a4a4, 0x000d0d0d, 0x80000053, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8,
+  0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x8000001e,
+  0x00000000, 0x00000006, 0x00171717, 0x00252525, 0x00676767, 0x00999999, 0x00ededed, 0x00f7f7f7,
+  0x80000021, 0x00ffffff, 0x00000005, 0x00f8f8f8, 0x00ededed, 0x009e9e9e, 0x00666666, 0x00161616,
+  0x8000001f, 0x00000000, 0x00000003, 0x001c1c1c, 0x00464646, 0x00b5b5b5, 0x80000013, 0x00ffffff,
+  0x00000002, 0x00343434, 0x00040404, 0x80000035, 0x00000000, 0x00000003, 0x00020202, 0x00505050,
+  0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016,
+  0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878,
+  0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003, 0x00171717,
+  0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a,
+  0x8000001a, 0x00000000, 0x00000003, 0x004d4d4d, 0x006d6d6d, 0x00f2f2f2, 0x80000018, 0x00ffffff,
+  0x00000003, 0x00d3d3d3, 0x00c2c2c2, 0x000f0f0f, 0x80000053, 0x00000000, 0x00000003, 0x00414141,
+  0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f,
+  0x8000001e, 0x00000000, 0x00000004, 0x004f4f4f, 0x006d6d6d, 0x00f1f1f1, 0x00f6f6f6, 0x80000023,
+  0x00ffffff, 0x00000005, 0x00e7e7e7, 0x00c2c2c2, 0x00525252, 0x00040404, 0x00010101, 0x8000001f,
+  0x00000000, 0x00000003, 0x00242424, 0x00595959, 0x00bdbdbd, 0x80000011, 0x00ffffff, 0x00000004,
+  0x00fefefe, 0x00fdfdfd, 0x00323232, 0x00020202, 0x80000035, 0x00000000, 0x00000003, 0x00020202,
+  0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d,
+  0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7,
+  0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003,
+  0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020,
+  0x000a0a0a, 0x8000001a, 0x00000000, 0x00000003, 0x00363636, 0x004b4b4b, 0x00efefef, 0x80000018,
+  0x00ffffff, 0x00000004, 0x00e2e2e2, 0x00d7d7d7, 0x00121212, 0x00010101, 0x80000052, 0x00000000,
+  0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1,
+  0x00d8d8d8, 0x005f5f5f, 0x8000001a, 0x00000000, 0x00000008, 0x00040404, 0x00070707, 0x003e3e3e,
+  0x004e4e4e, 0x00a4a4a4, 0x00b4b4b4, 0x00f8f8f8, 0x00fbfbfb, 0x80000021, 0x00ffffff, 0x00000006,
+  0x00fdfdfd, 0x00f3f3f3, 0x00c0c0c0, 0x00707070, 0x002f2f2f, 0x00020202, 0x80000020, 0x00000000,
+  0x00000003, 0x002c2c2c, 0x006d6d6d, 0x00c5c5c5, 0x80000011, 0x00ffffff, 0x00000003, 0x00fdfdfd,
+  0x00fbfbfb, 0x00303030, 0x80000036, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000,
+  0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959,
+  0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003, 0x00171717, 0x00505050,
+  0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000001a,
+  0x00000000, 0x00000003, 0x001c1c1c, 0x00282828, 0x00ececec, 0x80000018, 0x00ffffff, 0x00000004,
+  0x00f2f2f2, 0x00ededed, 0x00151515, 0x00020202, 0x80000052, 0x00000000, 0x00000003, 0x00414141,
+  0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f,
+  0x8000001a, 0x00000000, 0x00000005, 0x00090909, 0x000f0f0f, 0x007f7f7f, 0x00a0a0a0, 0x00fcfcfc,
+  0x80000024, 0x00ffffff, 0x00000005, 0x00fbfbfb, 0x00e7e7e7, 0x00979797, 0x00191919, 0x000a0a0a,
+  0x80000021, 0x00000000, 0x00000003, 0x00363636, 0x00888888, 0x00d0d0d0, 0x80000011, 0x00ffffff,
+  0x00000003, 0x00f8f8f8, 0x00f4f4f4, 0x002f2f2f, 0x80000036, 0x00000000, 0x00000003, 0x00020202,
+  0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d,
+  0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7,
+  0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003,
+  0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020,
+  0x000a0a0a, 0x8000001a, 0x00000000, 0x00000004, 0x00090909, 0x000d0d0d, 0x00d8d8d8, 0x00eeeeee,
+  0x80000017, 0x00ffffff, 0x00000004, 0x00fbfbfb, 0x00f9f9f9, 0x00474747, 0x00313131, 0x80000052,
+  0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000018, 0x00000000, 0x00000007, 0x00111111, 0x002e2e2e,
+  0x006f6f6f, 0x00a0a0a0, 0x00d2d2d2, 0x00e1e1e1, 0x00fefefe, 0x80000023, 0x00ffffff, 0x00000006,
+  0x00fcfcfc, 0x00e2e2e2, 0x00727272, 0x00494949, 0x00080808, 0x00030303, 0x80000021, 0x00000000,
+  0x00000003, 0x003b3b3b, 0x00949494, 0x00d4d4d4, 0x80000011, 0x00ffffff, 0x00000003, 0x00f6f6f6,
+  0x00f1f1f1, 0x002e2e2e, 0x80000036, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000,
+  0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959,
+  0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003, 0x00171717, 0x00505050,
+  0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00909090, 0x00202020, 0x000a0a0a, 0x8000001c,
+  0x00000000, 0x00000002, 0x00cfcfcf, 0x00e6e6e6, 0x80000019, 0x00ffffff, 0x00000002, 0x005f5f5f,
+  0x00474747, 0x80000052, 0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018,
+  0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005e5e5e, 0x80000018, 0x00000000, 0x00000005,
+  0x00191919, 0x00434343, 0x009e9e9e, 0x00e2e2e2, 0x00f8f8f8, 0x80000025, 0x00ffffff, 0x00000004,
+  0x00fbfbfb, 0x00d7d7d7, 0x003d3d3d, 0x00252525, 0x80000023, 0x00000000, 0x00000003, 0x00494949,
+  0x00b7b7b7, 0x00e2e2e2, 0x80000011, 0x00ffffff, 0x00000003, 0x00f2f2f2, 0x00e9e9e9, 0x002c2c2c,
+  0x80000036, 0x00000000, 0x00000003, 0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000,
+  0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020,
+  0x00171717, 0x80000011, 0x00000000, 0x00000003, 0x00171717, 0x00505050, 0x00a6a6a6, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00919191, 0x00232323, 0x000a0a0a, 0x8000001c, 0x00000000, 0x00000002,
+  0x00989898, 0x00b1b1b1, 0x80000019, 0x00ffffff, 0x00000002, 0x00c0c0c0, 0x00a4a4a4, 0x80000052,
+  0x00000000, 0x00000003, 0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000015, 0x00000000, 0x00000008, 0x00080808, 0x001d1d1d,
+  0x00808080, 0x00a7a7a7, 0x00e9e9e9, 0x00f4f4f4, 0x00fcfcfc, 0x00fefefe, 0x80000023, 0x00ffffff,
+  0x00000006, 0x00fefefe, 0x00fefefe, 0x007b7b7b, 0x00636363, 0x00070707, 0x00040404, 0x80000023,
+  0x00000000, 0x00000003, 0x004c4c4c, 0x00bebebe, 0x00e5e5e5, 0x80000011, 0x00ffffff, 0x00000003,
+  0x00f1f1f1, 0x00e7e7e7, 0x002c2c2c, 0x80000036, 0x00000000, 0x00000003, 0x00020202, 0x00505050,
+  0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016,
+  0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878,
+  0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003, 0x00171717,
+  0x00505050, 0x00a6a6a6, 0x8000001a, 0x00ffffff, 0x00000003, 0x00929292, 0x00252525, 0x000b0b0b,
+  0x8000001c, 0x00000000, 0x00000002, 0x008c8c8c, 0x00a5a5a5, 0x80000019, 0x00ffffff, 0x00000004,
+  0x00d1d1d1, 0x00b5b5b5, 0x00080808, 0x00060606, 0x8000002a, 0x00000000, 0x00000005, 0x00010101,
+  0x00090909, 0x00080808, 0x00060606, 0x00030303, 0x80000021, 0x00000000, 0x00000003, 0x00414141,
+  0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f,
+  0x80000013, 0x00000000, 0x00000007, 0x00040404, 0x00050505, 0x001a1a1a, 0x00303030, 0x009a9a9a,
+  0x00bfbfbf, 0x00fefefe, 0x80000026, 0x00ffffff, 0x00000004, 0x00f4f4f4, 0x00f1f1f1, 0x00616161,
+  0x004d4d4d, 0x80000025, 0x00000000, 0x00000003, 0x005b5b5b, 0x00e2e2e2, 0x00f3f3f3, 0x80000011,
+  0x00ffffff, 0x00000003, 0x00ececec, 0x00dfdfdf, 0x002b2b2b, 0x80000036, 0x00000000, 0x00000003,
+  0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050,
+  0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000,
+  0x00000003, 0x00161616, 0x004d4d4d, 0x00a4a4a4, 0x8000001a, 0x00ffffff, 0x00000003, 0x00a0a0a0,
+  0x00404040, 0x00131313, 0x8000001c, 0x00000000, 0x00000002, 0x00525252, 0x006c6c6c, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00ececec, 0x00616161, 0x00424242, 0x8000002a, 0x00000000, 0x00000005,
+  0x000f0f0f, 0x006d6d6d, 0x00626262, 0x004c4c4c, 0x00232323, 0x80000021, 0x00000000, 0x00000003,
+  0x00414141, 0x00b8b8b8, 0x00dfdfdf, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8,
+  0x005f5f5f, 0x80000013, 0x00000000, 0x00000004, 0x002a2a2a, 0x00363636, 0x00d3d3d3, 0x00dfdfdf,
+  0x80000027, 0x00ffffff, 0x00000005, 0x00fdfdfd, 0x00fcfcfc, 0x00818181, 0x00606060, 0x00010101,
+  0x80000026, 0x00000000, 0x00000003, 0x005c5c5c, 0x00e6e6e6, 0x00f5f5f5, 0x80000011, 0x00ffffff,
+  0x00000003, 0x00eaeaea, 0x00dcdcdc, 0x002a2a2a, 0x80000036, 0x00000000, 0x00000003, 0x00020202,
+  0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d,
+  0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7,
+  0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000, 0x00000003,
+  0x00151515, 0x00484848, 0x00a2a2a2, 0x8000001a, 0x00ffffff, 0x00000003, 0x00a4a4a4, 0x004a4a4a,
+  0x00161616, 0x8000001c, 0x00000000, 0x00000002, 0x00404040, 0x005b5b5b, 0x8000001a, 0x00ffffff,
+  0x00000005, 0x00f1f1f1, 0x008c8c8c, 0x00636363, 0x000e0e0e, 0x00070707, 0x80000026, 0x00000000,
+  0x00000009, 0x00010101, 0x00262626, 0x00373737, 0x00969696, 0x008e8e8e, 0x007d7d7d, 0x00474747,
+  0x00181818, 0x00060606, 0x8000001f, 0x00000000, 0x00000003, 0x003f3f3f, 0x00b3b3b3, 0x00dddddd,
+  0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000,
+  0x00000006, 0x000f0f0f, 0x001b1b1b, 0x005b5b5b, 0x006e6e6e, 0x00e0e0e0, 0x00e8e8e8, 0x80000025,
+  0x00ffffff, 0x00000007, 0x00fefefe, 0x00fdfdfd, 0x00e0e0e0, 0x00cccccc, 0x00626262, 0x00454545,
+  0x00010101, 0x80000026, 0x00000000, 0x00000003, 0x00606060, 0x00efefef, 0x00f9f9f9, 0x80000011,
+  0x00ffffff, 0x00000003, 0x00e6e6e6, 0x00d6d6d6, 0x00292929, 0x80000036, 0x00000000, 0x00000003,
+  0x00020202, 0x00505050, 0x00787878, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050,
+  0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000,
+  0x00000003, 0x00111111, 0x003c3c3c, 0x009c9c9c, 0x8000001a, 0x00ffffff, 0x00000003, 0x00b1b1b1,
+  0x00626262, 0x001d1d1d, 0x8000001c, 0x00000000, 0x00000004, 0x00141414, 0x00303030, 0x00fefefe,
+  0x00fefefe, 0x80000018, 0x00ffffff, 0x00000005, 0x00fefefe, 0x00f7f7f7, 0x00b7b7b7, 0x00313131,
+  0x00171717, 0x80000025, 0x00000000, 0x0000000a, 0x00010101, 0x00020202, 0x00858585, 0x009e9e9e,
+  0x00ffffff, 0x00fdfdfd, 0x00fafafa, 0x00a1a1a1, 0x00555555, 0x00161616, 0x8000001f, 0x00000000,
+  0x00000003, 0x003b3b3b, 0x00a7a7a7, 0x00d8d8d8, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1,
+  0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000, 0x00000004, 0x00363636, 0x005f5f5f, 0x00d8d8d8,
+  0x00fcfcfc, 0x80000027, 0x00ffffff, 0x00000005, 0x00fcfcfc, 0x00f8f8f8, 0x00969696, 0x00515151,
+  0x00111111, 0x80000028, 0x00000000, 0x00000003, 0x00606060, 0x00eeeeee, 0x00f8f8f8, 0x80000011,
+  0x00ffffff, 0x00000003, 0x00e3e3e3, 0x00d1d1d1, 0x00282828, 0x80000036, 0x00000000, 0x00000003,
+  0x00020202, 0x004c4c4c, 0x00757575, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050,
+  0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000,
+  0x00000003, 0x000f0f0f, 0x00323232, 0x00979797, 0x8000001a, 0x00ffffff, 0x00000003, 0x00c8c8c8,
+  0x00919191, 0x002b2b2b, 0x8000001c, 0x00000000, 0x00000004, 0x000a0a0a, 0x00232323, 0x00e0e0e0,
+  0x00eaeaea, 0x80000018, 0x00ffffff, 0x00000007, 0x00fefefe, 0x00fbfbfb, 0x00d6d6d6, 0x00888888,
+  0x004e4e4e, 0x00191919, 0x00070707, 0x80000021, 0x00000000, 0x0000000e, 0x00030303, 0x00060606,
+  0x00404040, 0x00555555, 0x00bebebe, 0x00cdcdcd, 0x00ffffff, 0x00fefefe, 0x00fcfcfc, 0x00cecece,
+  0x00a6a6a6, 0x004d4d4d, 0x002e2e2e, 0x00030303, 0x8000001d, 0x00000000, 0x00000003, 0x00353535,
+  0x00979797, 0x00d0d0d0, 0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f,
+  0x80000011, 0x00000000, 0x00000004, 0x00444444, 0x00777777, 0x00dedede, 0x00fdfdfd, 0x80000025,
+  0x00ffffff, 0x00000007, 0x00fefefe, 0x00fafafa, 0x00d8d8d8, 0x00a1a1a1, 0x005b5b5b, 0x002a2a2a,
+  0x00090909, 0x80000028, 0x00000000, 0x00000003, 0x005f5f5f, 0x00ededed, 0x00f8f8f8, 0x80000011,
+  0x00ffffff, 0x00000003, 0x00e0e0e0, 0x00cccccc, 0x00272727, 0x80000036, 0x00000000, 0x00000003,
+  0x00020202, 0x00474747, 0x00717171, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050,
+  0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011, 0x00000000,
+  0x00000003, 0x000c0c0c, 0x00282828, 0x00919191, 0x8000001a, 0x00ffffff, 0x00000003, 0x00e1e1e1,
+  0x00c3c3c3, 0x003a3a3a, 0x8000001d, 0x00000000, 0x00000003, 0x00151515, 0x00c0c0c0, 0x00d4d4d4,
+  0x8000001a, 0x00ffffff, 0x00000005, 0x00f7f7f7, 0x00e6e6e6, 0x00888888, 0x00333333, 0x000e0e0e,
+  0x80000021, 0x00000000, 0x00000005, 0x00070707, 0x000d0d0d, 0x00838383, 0x00adadad, 0x00fafafa,
+  0x80000004, 0x00ffffff, 0x00000005, 0x00fdfdfd, 0x00fcfcfc, 0x00888888, 0x005f5f5f, 0x00060606,
+  0x8000001d, 0x00000000, 0x00000003, 0x002f2f2f, 0x00858585, 0x00c8c8c8, 0x80000018, 0x00ffffff,
+  0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000, 0x00000003, 0x00525252,
+  0x00909090, 0x00e5e5e5, 0x80000026, 0x00ffffff, 0x00000005, 0x00fdfdfd, 0x00f4f4f4, 0x00b0b0b0,
+  0x00444444, 0x001c1c1c, 0x8000002a, 0x00000000, 0x00000003, 0x005f5f5f, 0x00ececec, 0x00f8f8f8,
+  0x80000011, 0x00ffffff, 0x00000003, 0x00dcdcdc, 0x00c6c6c6, 0x00262626, 0x80000036, 0x00000000,
+  0x00000003, 0x00010101, 0x00313131, 0x00616161, 0x8000001a, 0x00ffffff, 0x00000003, 0x00d5d5d5,
+  0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d,
+  0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000011,
+  0x00000000, 0x00000003, 0x00070707, 0x001a1a1a, 0x008a8a8a, 0x8000001a, 0x00ffffff, 0x00000005,
+  0x00f5f5f5, 0x00ececec, 0x00757575, 0x00434343, 0x00070707, 0x8000001b, 0x00000000, 0x00000003,
+  0x000c0c0c, 0x00686868, 0x00979797, 0x8000001a, 0x00ffffff, 0x00000007, 0x00fcfcfc, 0x00f7f7f7,
+  0x00d6d6d6, 0x00b7b7b7, 0x005d5d5d, 0x003a3a3a, 0x00040404, 0x8000001d, 0x00000000, 0x00000007,
+  0x00151515, 0x003f3f3f, 0x00737373, 0x00a1a1a1, 0x00d3d3d3, 0x00e5e5e5, 0x00fdfdfd, 0x80000004,
+  0x00ffffff, 0x00000006, 0x00fefefe, 0x00fefefe, 0x00d9d9d9, 0x00cbcbcb, 0x00505050, 0x003e3e3e,
+  0x8000001c, 0x00000000, 0x00000003, 0x00272727, 0x006e6e6e, 0x00bebebe, 0x80000018, 0x00ffffff,
+  0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000, 0x00000003, 0x00525252,
+  0x00909090, 0x00e5e5e5, 0x80000025, 0x00ffffff, 0x00000006, 0x00f4f4f4, 0x00dcdcdc, 0x00737373,
+  0x004f4f4f, 0x00161616, 0x00090909, 0x8000002a, 0x00000000, 0x00000003, 0x005f5f5f, 0x00ececec,
+  0x00f7f7f7, 0x80000011, 0x00ffffff, 0x00000003, 0x00dadada, 0x00c3c3c3, 0x00252525, 0x80000036,
+  0x00000000, 0x00000003, 0x00010101, 0x00272727, 0x00595959, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002,
+  0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717,
+  0x80000011, 0x00000000, 0x00000003, 0x00050505, 0x00131313, 0x00878787, 0x8000001c, 0x00ffffff,
+  0x00000003, 0x00919191, 0x00626262, 0x000a0a0a, 0x8000001b, 0x00000000, 0x00000003, 0x00070707,
+  0x003f3f3f, 0x007b7b7b, 0x8000001c, 0x00ffffff, 0x00000005, 0x00fafafa, 0x00f5f5f5, 0x00818181,
+  0x00555555, 0x00060606, 0x8000001d, 0x00000000, 0x00000005, 0x001f1f1f, 0x005c5c5c, 0x00a6a6a6,
+  0x00e6e6e6, 0x00f8f8f8, 0x80000008, 0x00ffffff, 0x00000004, 0x00fefefe, 0x00fefefe, 0x00737373,
+  0x005b5b5b, 0x8000001c, 0x00000000, 0x00000003, 0x00232323, 0x00636363, 0x00b9b9b9, 0x80000018,
+  0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000, 0x00000003,
+  0x00525252, 0x00909090, 0x00e5e5e5, 0x80000025, 0x00ffffff, 0x00000004, 0x00eeeeee, 0x00cccccc,
+  0x00373737, 0x00222222, 0x8000002c, 0x00000000, 0x00000003, 0x005e5e5e, 0x00eaeaea, 0x00f7f7f7,
+  0x80000011, 0x00ffffff, 0x00000003, 0x00e1e1e1, 0x00cecece, 0x00272727, 0x80000037, 0x00000000,
+  0x00000004, 0x000b0b0b, 0x00434343, 0x00fdfdfd, 0x00fefefe, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002,
+  0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717,
+  0x80000011, 0x00000000, 0x00000005, 0x00010101, 0x00020202, 0x00717171, 0x00e4e4e4, 0x00f7f7f7,
+  0x8000001a, 0x00ffffff, 0x00000008, 0x00f2f2f2, 0x00ececec, 0x00a0a0a0, 0x008e8e8e, 0x00383838,
+  0x002d2d2d, 0x00141414, 0x000a0a0a, 0x80000016, 0x00000000, 0x00000005, 0x00010101, 0x00080808,
+  0x00424242, 0x00c3c3c3, 0x00e2e2e2, 0x8000001a, 0x00ffffff, 0x00000008, 0x00fefefe, 0x00fefefe,
+  0x00f0f0f0, 0x00ebebeb, 0x00b0b0b0, 0x009d9d9d, 0x00373737, 0x00252525, 0x80000015, 0x00000000,
+  0x0000000a, 0x00060606, 0x00090909, 0x00414141, 0x00535353, 0x00adadad, 0x00c2c2c2, 0x00ececec,
+  0x00f4f4f4, 0x00fcfcfc, 0x00fefefe, 0x8000000a, 0x00ffffff, 0x00000004, 0x00eeeeee, 0x00dadada,
+  0x00676767, 0x00444444, 0x8000001a, 0x00000000, 0x00000003, 0x00181818, 0x00454545, 0x00acacac,
+  0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005e5e5e, 0x80000011, 0x00000000,
+  0x00000003, 0x00525252, 0x00909090, 0x00e5e5e5, 0x80000023, 0x00ffffff, 0x00000006, 0x00eeeeee,
+  0x00e9e9e9, 0x00464646, 0x00383838, 0x00070707, 0x00040404, 0x8000002c, 0x00000000, 0x00000003,
+  0x005e5e5e, 0x00eaeaea, 0x00f7f7f7, 0x80000011, 0x00ffffff, 0x00000003, 0x00e4e4e4, 0x00d2d2d2,
+  0x00282828, 0x80000037, 0x00000000, 0x00000004, 0x00060606, 0x003f3f3f, 0x00fbfbfb, 0x00fdfdfd,
+  0x80000018, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000,
+  0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959,
+  0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00ededed, 0x00202020, 0x00171717, 0x80000013, 0x00000000, 0x00000003, 0x006b6b6b, 0x00dbdbdb,
+  0x00f4f4f4, 0x8000001c, 0x00ffffff, 0x00000006, 0x00bababa, 0x00a8a8a8, 0x004f4f4f, 0x00444444,
+  0x00292929, 0x001e1e1e, 0x8000000a, 0x00131313, 0x00000003, 0x00101010, 0x000e0e0e, 0x00010101,
+  0x8000000b, 0x00000000, 0x00000003, 0x00373737, 0x00b1b1b1, 0x00d9d9d9, 0x8000001e, 0x00ffffff,
+  0x0000001f, 0x00cccccc, 0x00b8b8b8, 0x004d4d4d, 0x003a3a3a, 0x00121212, 0x000e0e0e, 0x000c0c0c,
+  0x00080808, 0x00060606, 0x00040404, 0x00030303, 0x00020202, 0x00010101, 0x00000000, 0x00010101,
+  0x00010101, 0x00020202, 0x00030303, 0x00040404, 0x00040404, 0x00060606, 0x00070707, 0x00090909,
+  0x000c0c0c, 0x000e0e0e, 0x00191919, 0x001d1d1d, 0x00585858, 0x006b6b6b, 0x00c9c9c9, 0x00dbdbdb,
+  0x8000000f, 0x00ffffff, 0x00000005, 0x00ededed, 0x00808080, 0x00585858, 0x000a0a0a, 0x00050505,
+  0x80000018, 0x00000000, 0x00000003, 0x00161616, 0x003e3e3e, 0x00a9a9a9, 0x80000018, 0x00ffffff,
+  0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000, 0x00000003, 0x00525252,
+  0x00909090, 0x00e5e5e5, 0x80000021, 0x00ffffff, 0x00000006, 0x00fdfdfd, 0x00fcfcfc, 0x00dfdfdf,
+  0x00d6d6d6, 0x002b2b2b, 0x00212121, 0x8000002e, 0x00000000, 0x00000003, 0x005e5e5e, 0x00e9e9e9,
+  0x00f6f6f6, 0x80000011, 0x00ffffff, 0x00000003, 0x00f3f3f3, 0x00ececec, 0x002d2d2d, 0x80000038,
+  0x00000000, 0x00000003, 0x00343434, 0x00e2e2e2, 0x00eeeeee, 0x80000018, 0x00ffffff, 0x00000003,
+  0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002,
+  0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717,
+  0x80000013, 0x00000000, 0x00000003, 0x004f4f4f, 0x00a1a1a1, 0x00e2e2e2, 0x80000021, 0x00ffffff,
+  0x00000003, 0x00f9f9f9, 0x00f4f4f4, 0x00f1f1f1, 0x80000008, 0x00f0f0f0, 0x00000003, 0x00c6c6c6,
+  0x00b4b4b4, 0x00111111, 0x8000000b, 0x00000000, 0x00000003, 0x00121212, 0x00383838, 0x009e9e9e,
+  0x80000021, 0x00ffffff, 0x00000019, 0x00f4f4f4, 0x00dcdcdc, 0x00b6b6b6, 0x00949494, 0x00616161,
+  0x004e4e4e, 0x00303030, 0x002b2b2b, 0x00191919, 0x00131313, 0x00060606, 0x000a0a0a, 0x000e0e0e,
+  0x001c1c1c, 0x00212121, 0x00343434, 0x00383838, 0x00484848, 0x00545454, 0x006b6b6b, 0x00929292,
+  0x00b5b5b5, 0x00e5e5e5, 0x00f7f7f7, 0x00fefefe, 0x80000014, 0x00ffffff, 0x00000003, 0x00d4d4d4,
+  0x00818181, 0x003b3b3b, 0x80000018, 0x00000000, 0x00000003, 0x000b0b0b, 0x001f1f1f, 0x009b9b9b,
+  0x80000018, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000,
+  0x00000003, 0x00525252, 0x00909090, 0x00e5e5e5, 0x80000021, 0x00ffffff, 0x00000005, 0x00ececec,
+  0x00dedede, 0x004b4b4b, 0x00222222, 0x00010101, 0x8000002f, 0x00000000, 0x00000003, 0x005d5d5d,
+  0x00e9e9e9, 0x00f6f6f6, 0x80000011, 0x00ffffff, 0x00000004, 0x00f7f7f7, 0x00f1f1f1, 0x00303030,
+  0x00020202, 0x80000037, 0x00000000, 0x00000003, 0x00323232, 0x00d9d9d9, 0x00e9e9e9, 0x80000018,
+  0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001,
+  0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020,
+  0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed,
+  0x00202020, 0x00171717, 0x80000013, 0x00000000, 0x00000003, 0x00464646, 0x008f8f8f, 0x00dcdcdc,
+  0x80000021, 0x00ffffff, 0x00000003, 0x00fbfbfb, 0x00f7f7f7, 0x00f5f5f5, 0x80000008, 0x00f4f4f4,
+  0x00000003, 0x00c9c9c9, 0x00b7b7b7, 0x00111111, 0x8000000b, 0x00000000, 0x00000005, 0x000d0d0d,
+  0x00282828, 0x008c8c8c, 0x00eaeaea, 0x00f9f9f9, 0x8000001f, 0x00ffffff, 0x00000018, 0x00f7f7f7,
+  0x00e6e6e6, 0x00cacaca, 0x00b2b2b2, 0x008d8d8d, 0x007f7f7f, 0x006a6a6a, 0x00666666, 0x00595959,
+  0x00555555, 0x004b4b4b, 0x004e4e4e, 0x00515151, 0x005b5b5b, 0x005f5f5f, 0x006c6c6c, 0x006f6f6f,
+  0x007b7b7b, 0x00838383, 0x00949494, 0x00b1b1b1, 0x00cacaca, 0x00ededed, 0x00f9f9f9, 0x80000015,
+  0x00ffffff, 0x00000005, 0x00e0e0e0, 0x00a4a4a4, 0x00606060, 0x00272727, 0x000a0a0a, 0x80000016,
+  0x00000000, 0x00000004, 0x00080808, 0x00171717, 0x00969696, 0x00fdfdfd, 0x80000017, 0x00ffffff,
+  0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000, 0x00000003, 0x00525252,
+  0x00909090, 0x00e5e5e5, 0x8000001f, 0x00ffffff, 0x00000006, 0x00fafafa, 0x00f3f3f3, 0x00c7c7c7,
+  0x00a7a7a7, 0x00383838, 0x00191919, 0x80000030, 0x00000000, 0x00000003, 0x005d5d5d, 0x00e8e8e8,
+  0x00f6f6f6, 0x80000013, 0x00ffffff, 0x00000002, 0x00373737, 0x00080808, 0x80000037, 0x00000000,
+  0x00000003, 0x002c2c2c, 0x00c0c0c0, 0x00dbdbdb, 0x80000018, 0x00ffffff, 0x00000003, 0x00d5d5d5,
+  0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d,
+  0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000013,
+  0x00000000, 0x00000003, 0x00303030, 0x00616161, 0x00cecece, 0x8000002c, 0x00ffffff, 0x00000003,
+  0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x8000000d, 0x00000000, 0x00000003, 0x005c5c5c, 0x00b4b4b4,
+  0x00eaeaea, 0x8000004e, 0x00ffffff, 0x00000003, 0x00c1c1c1, 0x008d8d8d, 0x00242424, 0x80000016,
+  0x00000000, 0x00000005, 0x00010101, 0x00020202, 0x008a8a8a, 0x00f9f9f9, 0x00fefefe, 0x80000016,
+  0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000, 0x00000003,
+  0x00525252, 0x00909090, 0x00e5e5e5, 0x8000001f, 0x00ffffff, 0x00000005, 0x00efefef, 0x00d4d4d4,
+  0x00686868, 0x001a1a1a, 0x00060606, 0x80000031, 0x00000000, 0x00000003, 0x005d5d5d, 0x00e7e7e7,
+  0x00f5f5f5, 0x80000013, 0x00ffffff, 0x00000002, 0x00424242, 0x00151515, 0x80000037, 0x00000000,
+  0x00000003, 0x00282828, 0x00b0b0b0, 0x00d2d2d2, 0x80000018, 0x00ffffff, 0x00000003, 0x00d5d5d5,
+  0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d,
+  0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000013,
+  0x00000000, 0x00000005, 0x001d1d1d, 0x003a3a3a, 0x00bebebe, 0x00f9f9f9, 0x00fefefe, 0x8000002a,
+  0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x8000000d, 0x00000000, 0x00000004,
+  0x003c3c3c, 0x00757575, 0x00d7d7d7, 0x00fefefe, 0x8000004d, 0x00ffffff, 0x00000005, 0x00dfdfdf,
+  0x00c3c3c3, 0x00686868, 0x00494949, 0x00050505, 0x80000015, 0x00000000, 0x00000004, 0x00010101,
+  0x00767676, 0x00d5d5d5, 0x00f5f5f5, 0x80000016, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8,
+  0x005f5f5f, 0x80000011, 0x00000000, 0x00000003, 0x00525252, 0x00909090, 0x00e5e5e5, 0x8000001d,
+  0x00ffffff, 0x00000007, 0x00f8f8f8, 0x00dadada, 0x00b4b4b4, 0x00777777, 0x003a3a3a, 0x000e0e0e,
+  0x00030303, 0x80000031, 0x00000000, 0x00000003, 0x005c5c5c, 0x00e6e6e6, 0x00f5f5f5, 0x80000013,
+  0x00ffffff, 0x00000002, 0x004d4d4d, 0x00232323, 0x80000037, 0x00000000, 0x00000003, 0x00242424,
+  0x009e9e9e, 0x00c8c8c8, 0x80000018, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d,
+  0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7,
+  0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000013, 0x00000000, 0x00000005,
+  0x00080808, 0x00101010, 0x00adadad, 0x00f3f3f3, 0x00fefefe, 0x8000002a, 0x00ffffff, 0x00000003,
+  0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x8000000d, 0x00000000, 0x00000004, 0x00191919, 0x00313131,
+  0x00c2c2c2, 0x00fcfcfc, 0x8000004f, 0x00ffffff, 0x00000004, 0x00b2b2b2, 0x00989898, 0x00090909,
+  0x00010101, 0x80000015, 0x00000000, 0x00000003, 0x00606060, 0x00aeaeae, 0x00ebebeb, 0x80000016,
+  0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000, 0x00000003,
+  0x00525252, 0x00909090, 0x00e5e5e5, 0x8000001d, 0x00ffffff, 0x00000005, 0x00f1f1f1, 0x00b1b1b1,
+  0x00747474, 0x00121212, 0x00080808, 0x80000033, 0x00000000, 0x00000003, 0x005c5c5c, 0x00e5e5e5,
+  0x00f5f5f5, 0x80000013, 0x00ffffff, 0x00000002, 0x005c5c5c, 0x00353535, 0x80000037, 0x00000000,
+  0x00000003, 0x001b1b1b, 0x00767676, 0x00b1b1b1, 0x80000018, 0x00ffffff, 0x00000003, 0x00d5d5d5,
+  0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d,
+  0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000013,
+  0x00000000, 0x00000005, 0x00030303, 0x00050505, 0x007c7c7c, 0x00b1b1b1, 0x00f6f6f6, 0x8000002a,
+  0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x8000000d, 0x00000000, 0x00000005,
+  0x00080808, 0x00101010, 0x00727272, 0x00999999, 0x00f6f6f6, 0x8000004e, 0x00ffffff, 0x00000006,
+  0x00e6e6e6, 0x00dedede, 0x00747474, 0x005e5e5e, 0x00020202, 0x00010101, 0x80000013, 0x00000000,
+  0x00000003, 0x00393939, 0x00676767, 0x00d9d9d9, 0x80000016, 0x00ffffff, 0x00000003, 0x00f1f1f1,
+  0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000, 0x00000003, 0x00525252, 0x00909090, 0x00e5e5e5,
+  0x8000001a, 0x00ffffff, 0x00000008, 0x00f8f8f8, 0x00f6f6f6, 0x00959595, 0x00838383, 0x00393939,
+  0x00262626, 0x00060606, 0x00020202, 0x80000033, 0x00000000, 0x00000003, 0x005c5c5c, 0x00e5e5e5,
+  0x00f5f5f5, 0x80000013, 0x00ffffff, 0x00000002, 0x00646464, 0x003e3e3e, 0x80000037, 0x00000000,
+  0x00000003, 0x00171717, 0x00636363, 0x00a6a6a6, 0x80000018, 0x00ffffff, 0x00000003, 0x00d5d5d5,
+  0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d,
+  0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000015,
+  0x00000000, 0x00000003, 0x00646464, 0x00919191, 0x00f3f3f3, 0x8000002a, 0x00ffffff, 0x00000003,
+  0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x8000000f, 0x00000000, 0x00000003, 0x004c4c4c, 0x006a6a6a,
+  0x00f2f2f2, 0x80000050, 0x00ffffff, 0x00000004, 0x00a7a7a7, 0x008b8b8b, 0x00030303, 0x00020202,
+  0x80000013, 0x00000000, 0x00000003, 0x00262626, 0x00454545, 0x00d1d1d1, 0x80000016, 0x00ffffff,
+  0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000, 0x00000003, 0x00525252,
+  0x00909090, 0x00e5e5e5, 0x8000001a, 0x00ffffff, 0x00000004, 0x00f4f4f4, 0x00f1f1f1, 0x00636363,
+  0x004f4f4f, 0x80000037, 0x00000000, 0x00000003, 0x005b5b5b, 0x00e3e3e3, 0x00f4f4f4, 0x80000013,
+  0x00ffffff, 0x00000002, 0x00777777, 0x00575757, 0x80000037, 0x00000000, 0x00000005, 0x00050505,
+  0x00161616, 0x00757575, 0x00f3f3f3, 0x00fafafa, 0x80000016, 0x00ffffff, 0x00000003, 0x00d5d5d5,
+  0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d,
+  0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000015,
+  0x00000000, 0x00000004, 0x00212121, 0x00303030, 0x00e6e6e6, 0x00fdfdfd, 0x80000029, 0x00ffffff,
+  0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x8000000f, 0x00000000, 0x00000004, 0x00090909,
+  0x000d0d0d, 0x00909090, 0x00a7a7a7, 0x8000004f, 0x00ffffff, 0x00000004, 0x00e9e9e9, 0x00cccccc,
+  0x002a2a2a, 0x001b1b1b, 0x80000013, 0x00000000, 0x00000005, 0x00050505, 0x00090909, 0x00a5a5a5,
+  0x00d8d8d8, 0x00fdfdfd, 0x80000014, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f,
+  0x80000011, 0x00000000, 0x00000003, 0x00525252, 0x00909090, 0x00e5e5e5, 0x80000018, 0x00ffffff,
+  0x00000006, 0x00dddddd, 0x00c4c4c4, 0x00565656, 0x00373737, 0x000d0d0d, 0x000a0a0a, 0x80000037,
+  0x00000000, 0x00000003, 0x005b5b5b, 0x00e3e3e3, 0x00f4f4f4, 0x80000013, 0x00ffffff, 0x00000002,
+  0x007c7c7c, 0x005c5c5c, 0x80000037, 0x00000000, 0x00000005, 0x00020202, 0x000a0a0a, 0x006b6b6b,
+  0x00eaeaea, 0x00f7f7f7, 0x80000016, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d,
+  0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7,
+  0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000015, 0x00000000, 0x00000004,
+  0x00161616, 0x001f1f1f, 0x00dcdcdc, 0x00f4f4f4, 0x80000029, 0x00ffffff, 0x00000003, 0x00d2d2d2,
+  0x00c0c0c0, 0x00121212, 0x80000011, 0x00000000, 0x00000004, 0x00787878, 0x00919191, 0x00f9f9f9,
+  0x00fbfbfb, 0x8000004b, 0x00ffffff, 0x00000006, 0x00fdfdfd, 0x00fdfdfd, 0x00e4e4e4, 0x00c8c8c8,
+  0x002b2b2b, 0x001c1c1c, 0x80000013, 0x00000000, 0x00000005, 0x00010101, 0x00010101, 0x00969696,
+  0x00c6c6c6, 0x00fcfcfc, 0x80000014, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005e5e5e,
+  0x80000011, 0x00000000, 0x00000003, 0x00525252, 0x00909090, 0x00e5e5e5, 0x80000015, 0x00ffffff,
+  0x00000008, 0x00fefefe, 0x00fafafa, 0x00f4f4f4, 0x00cccccc, 0x00aeaeae, 0x003b3b3b, 0x001b1b1b,
+  0x00010101, 0x80000038, 0x00000000, 0x00000003, 0x005b5b5b, 0x00e2e2e2, 0x00f3f3f3, 0x80000013,
+  0x00ffffff, 0x00000002, 0x00919191, 0x00767676, 0x80000039, 0x00000000, 0x00000003, 0x003f3f3f,
+  0x00939393, 0x00d7d7d7, 0x80000016, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d,
+  0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7,
+  0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000017, 0x00000000, 0x00000002,
+  0x00727272, 0x008c8c8c, 0x80000029, 0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212,
+  0x80000011, 0x00000000, 0x00000004, 0x00020202, 0x00161616, 0x00afafaf, 0x00c8c8c8, 0x8000004b,
+  0x00ffffff, 0x00000004, 0x00e9e9e9, 0x00e1e1e1, 0x00363636, 0x00262626, 0x80000017, 0x00000000,
+  0x00000004, 0x00282828, 0x00353535, 0x00f3f3f3, 0x00fcfcfc, 0x80000013, 0x00ffffff, 0x00000003,
+  0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000, 0x00000003, 0x00525252, 0x00909090,
+  0x00e5e5e5, 0x80000014, 0x00ffffff, 0x00000006, 0x00fdfdfd, 0x00f5f5f5, 0x00c1c1c1, 0x006c6c6c,
+  0x002e2e2e, 0x00010101, 0x8000003b, 0x00000000, 0x00000003, 0x005b5b5b, 0x00e2e2e2, 0x00f3f3f3,
+  0x80000013, 0x00ffffff, 0x00000002, 0x00979797, 0x007d7d7d, 0x80000039, 0x00000000, 0x00000005,
+  0x00303030, 0x00707070, 0x00c6c6c6, 0x00f8f8f8, 0x00fefefe, 0x80000014, 0x00ffffff, 0x00000003,
+  0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002,
+  0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717,
+  0x80000017, 0x00000000, 0x00000004, 0x00545454, 0x006b6b6b, 0x00efefef, 0x00f4f4f4, 0x80000027,
+  0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x80000011, 0x00000000, 0x00000006,
+  0x00010101, 0x00101010, 0x00828282, 0x00a5a5a5, 0x00f0f0f0, 0x00f8f8f8, 0x80000047, 0x00ffffff,
+  0x00000006, 0x00f7f7f7, 0x00f1f1f1, 0x00bcbcbc, 0x00aaaaaa, 0x00282828, 0x001b1b1b, 0x80000017,
+  0x00000000, 0x00000004, 0x001d1d1d, 0x00262626, 0x00d4d4d4, 0x00e2e2e2, 0x80000013, 0x00ffffff,
+  0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000, 0x00000003, 0x00525252,
+  0x00909090, 0x00e5e5e5, 0x80000013, 0x00ffffff, 0x00000007, 0x00efefef, 0x00e6e6e6, 0x00bcbcbc,
+  0x00939393, 0x004e4e4e, 0x00212121, 0x00010101, 0x8000003b, 0x00000000, 0x00000003, 0x005a5a5a,
+  0x00e1e1e1, 0x00f3f3f3, 0x80000013, 0x00ffffff, 0x00000002, 0x00a8a8a8, 0x00929292, 0x80000039,
+  0x00000000, 0x00000005, 0x00080808, 0x00131313, 0x00999999, 0x00e7e7e7, 0x00fbfbfb, 0x80000014,
+  0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001,
+  0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020,
+  0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed,
+  0x00202020, 0x00171717, 0x80000017, 0x00000000, 0x00000004, 0x00030303, 0x00151515, 0x00c5c5c5,
+  0x00d6d6d6, 0x80000027, 0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x80000012,
+  0x00000000, 0x00000005, 0x00010101, 0x000a0a0a, 0x00474747, 0x00cacaca, 0x00e5e5e5, 0x80000047,
+  0x00ffffff, 0x00000005, 0x00e3e3e3, 0x00cbcbcb, 0x00464646, 0x00181818, 0x00010101, 0x8000001a,
+  0x00000000, 0x00000002, 0x00828282, 0x009a9a9a, 0x80000013, 0x00ffffff, 0x00000003, 0x00f1f1f1,
+  0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000, 0x00000003, 0x00525252, 0x00909090, 0x00e5e5e5,
+  0x80000013, 0x00ffffff, 0x00000004, 0x00c6c6c6, 0x00a9a9a9, 0x00252525, 0x00171717, 0x8000003e,
+  0x00000000, 0x00000003, 0x00595959, 0x00dddddd, 0x00f1f1f1, 0x80000013, 0x00ffffff, 0x00000002,
+  0x00b4b4b4, 0x00a1a1a1, 0x80000039, 0x00000000, 0x00000005, 0x00040404, 0x000a0a0a, 0x00686868,
+  0x009e9e9e, 0x00efefef, 0x80000014, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d,
+  0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7,
+  0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000017, 0x00000000, 0x00000006,
+  0x00010101, 0x000c0c0c, 0x00777777, 0x009b9b9b, 0x00f2f2f2, 0x00f8f8f8, 0x80000025, 0x00ffffff,
+  0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x80000012, 0x00000000, 0x00000007, 0x00010101,
+  0x00050505, 0x00282828, 0x00727272, 0x00a7a7a7, 0x00d8d8d8, 0x00f4f4f4, 0x80000043, 0x00ffffff,
+  0x00000007, 0x00f2f2f2, 0x00dadada, 0x00a0a0a0, 0x00707070, 0x00262626, 0x000d0d0d, 0x00010101,
+  0x8000001a, 0x00000000, 0x00000004, 0x00454545, 0x005d5d5d, 0x00cfcfcf, 0x00e0e0e0, 0x80000011,
+  0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000, 0x00000003,
+  0x00525252, 0x00909090, 0x00e5e5e5, 0x8000000f, 0x00ffffff, 0x00000008, 0x00fdfdfd, 0x00fcfcfc,
+  0x00cccccc, 0x00bfbfbf, 0x006b6b6b, 0x005a5a5a, 0x00141414, 0x000c0c0c, 0x8000003e, 0x00000000,
+  0x00000003, 0x00575757, 0x00d8d8d8, 0x00efefef, 0x80000013, 0x00ffffff, 0x00000002, 0x00c2c2c2,
+  0x00b1b1b1, 0x8000003b, 0x00000000, 0x00000003, 0x00313131, 0x004d4d4d, 0x00e1e1e1, 0x80000014,
+  0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000, 0x00000001,
+  0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020,
+  0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed,
+  0x00202020, 0x00171717, 0x80000018, 0x00000000, 0x00000005, 0x00030303, 0x00202020, 0x00595959,
+  0x00e3e3e3, 0x00f1f1f1, 0x80000025, 0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212,
+  0x80000014, 0x00000000, 0x00000005, 0x00050505, 0x00101010, 0x00616161, 0x00acacac, 0x00e8e8e8,
+  0x80000043, 0x00ffffff, 0x00000005, 0x00e4e4e4, 0x00b0b0b0, 0x00565656, 0x000a0a0a, 0x00030303,
+  0x8000001c, 0x00000000, 0x00000004, 0x00020202, 0x001a1a1a, 0x009a9a9a, 0x00bebebe, 0x80000011,
+  0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000, 0x00000003,
+  0x00525252, 0x00909090, 0x00e5e5e5, 0x8000000f, 0x00ffffff, 0x00000006, 0x00fcfcfc, 0x00f9f9f9,
+  0x00949494, 0x00777777, 0x00050505, 0x00020202, 0x80000040, 0x00000000, 0x00000003, 0x004c4c4c,
+  0x00bebebe, 0x00e5e5e5, 0x80000013, 0x00ffffff, 0x00000004, 0x00e2e2e2, 0x00d9d9d9, 0x00020202,
+  0x00020202, 0x80000039, 0x00000000, 0x00000004, 0x00101010, 0x00191919, 0x008f8f8f, 0x00aaaaaa,
+  0x80000013, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000,
+  0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959,
+  0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00ededed, 0x00202020, 0x00171717, 0x80000018, 0x00000000, 0x00000007, 0x00010101, 0x000b0b0b,
+  0x00232323, 0x005e5e5e, 0x00a0a0a0, 0x00e3e3e3, 0x00f6f6f6, 0x80000023, 0x00ffffff, 0x00000003,
+  0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x80000014, 0x00000000, 0x00000008, 0x00020202, 0x00050505,
+  0x00202020, 0x00383838, 0x007e7e7e, 0x009a9a9a, 0x00f2f2f2, 0x00fafafa, 0x8000003d, 0x00ffffff,
+  0x00000008, 0x00f9f9f9, 0x00ededed, 0x00a6a6a6, 0x00828282, 0x003b3b3b, 0x001d1d1d, 0x00030303,
+  0x00010101, 0x8000001c, 0x00000000, 0x00000006, 0x00010101, 0x00080808, 0x00333333, 0x00606060,
+  0x00b1b1b1, 0x00dcdcdc, 0x8000000f, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f,
+  0x80000011, 0x00000000, 0x00000003, 0x00525252, 0x00909090, 0x00e5e5e5, 0x8000000d, 0x00ffffff,
+  0x00000008, 0x00eeeeee, 0x00d2d2d2, 0x00999999, 0x006f6f6f, 0x00373737, 0x00272727, 0x00020202,
+  0x00010101, 0x80000040, 0x00000000, 0x00000003, 0x00474747, 0x00b1b1b1, 0x00e0e0e0, 0x80000013,
+  0x00ffffff, 0x00000004, 0x00f2f2f2, 0x00ededed, 0x00030303, 0x00020202, 0x8000003b, 0x00000000,
+  0x00000002, 0x00676767, 0x00808080, 0x80000013, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050,
+  0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x8000001a, 0x00000000,
+  0x00000005, 0x00080808, 0x001d1d1d, 0x00787878, 0x00d5d5d5, 0x00f2f2f2, 0x80000023, 0x00ffffff,
+  0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x80000018, 0x00000000, 0x00000004, 0x004b4b4b,
+  0x00686868, 0x00ebebeb, 0x00f8f8f8, 0x8000003d, 0x00ffffff, 0x00000006, 0x00f6f6f6, 0x00e4e4e4,
+  0x007b7b7b, 0x00525252, 0x00020202, 0x00010101, 0x80000021, 0x00000000, 0x00000003, 0x00313131,
+  0x008b8b8b, 0x00cbcbcb, 0x8000000f, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f,
+  0x80000011, 0x00000000, 0x00000003, 0x00525252, 0x00909090, 0x00e5e5e5, 0x8000000d, 0x00ffffff,
+  0x00000005, 0x00e6e6e6, 0x00bcbcbc, 0x00696969, 0x002c2c2c, 0x000a0a0a, 0x80000043, 0x00000000,
+  0x00000003, 0x00393939, 0x008d8d8d, 0x00d2d2d2, 0x80000013, 0x00ffffff, 0x00000004, 0x00fdfdfd,
+  0x00fbfbfb, 0x00303030, 0x00262626, 0x8000003b, 0x00000000, 0x00000004, 0x000d0d0d, 0x00141414,
+  0x00878787, 0x00a3a3a3, 0x80000011, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d,
+  0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7,
+  0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a,
+  0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x8000001a, 0x00000000, 0x00000007,
+  0x00010101, 0x00040404, 0x00171717, 0x002a2a2a, 0x00969696, 0x00c6c6c6, 0x00f9f9f9, 0x80000021,
+  0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x80000018, 0x00000000, 0x00000006,
+  0x000a0a0a, 0x000d0d0d, 0x00424242, 0x00585858, 0x00dadada, 0x00e6e6e6, 0x80000039, 0x00ffffff,
+  0x00000006, 0x00c7c7c7, 0x00b3b3b3, 0x00404040, 0x00333333, 0x00101010, 0x000b0b0b, 0x80000023,
+  0x00000000, 0x00000007, 0x00060606, 0x00121212, 0x003b3b3b, 0x005c5c5c, 0x00bfbfbf, 0x00dfdfdf,
+  0x00fefefe, 0x8000000b, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011,
+  0x00000000, 0x00000003, 0x00525252, 0x00909090, 0x00e5e5e5, 0x80000008, 0x00ffffff, 0x0000000a,
+  0x00fefefe, 0x00fdfdfd, 0x00b9b9b9, 0x00a5a5a5, 0x004f4f4f, 0x003b3b3b, 0x00181818, 0x000e0e0e,
+  0x00060606, 0x00010101, 0x80000043, 0x00000000, 0x00000003, 0x00353535, 0x00858585, 0x00cecece,
+  0x80000014, 0x00ffffff, 0x00000003, 0x00fdfdfd, 0x003c3c3c, 0x002f2f2f, 0x8000003c, 0x00000000,
+  0x00000007, 0x00040404, 0x006d6d6d, 0x008c8c8c, 0x00f3f3f3, 0x00f7f7f7, 0x00fdfdfd, 0x00fefefe,
+  0x8000000d, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000,
+  0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959,
+  0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00ededed, 0x00202020, 0x00171717, 0x8000001c, 0x00000000, 0x00000008, 0x00080808, 0x00101010,
+  0x007f7f7f, 0x00b0b0b0, 0x00ececec, 0x00f4f4f4, 0x00fcfcfc, 0x00fdfdfd, 0x8000001e, 0x00ffffff,
+  0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x8000001a, 0x00000000, 0x00000008, 0x00262626,
+  0x003c3c3c, 0x00c7c7c7, 0x00d6d6d6, 0x00f5f5f5, 0x00f9f9f9, 0x00fdfdfd, 0x00fefefe, 0x80000031,
+  0x00ffffff, 0x00000008, 0x00fefefe, 0x00fcfcfc, 0x00f6f6f6, 0x00f1f1f1, 0x00b2b2b2, 0x009c9c9c,
+  0x00232323, 0x00171717, 0x80000027, 0x00000000, 0x00000008, 0x00232323, 0x003f3f3f, 0x00a9a9a9,
+  0x00cbcbcb, 0x00f4f4f4, 0x00f7f7f7, 0x00fcfcfc, 0x00fdfdfd, 0x80000008, 0x00ffffff, 0x00000003,
+  0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000, 0x00000003, 0x00525252, 0x00909090,
+  0x00e5e5e5, 0x80000006, 0x00ffffff, 0x00000008, 0x00fbfbfb, 0x00f8f8f8, 0x00f0f0f0, 0x00eeeeee,
+  0x00a3a3a3, 0x008d8d8d, 0x00313131, 0x001f1f1f, 0x80000047, 0x00000000, 0x00000003, 0x00262626,
+  0x005f5f5f, 0x00bfbfbf, 0x80000014, 0x00ffffff, 0x00000003, 0x00fefefe, 0x007b7b7b, 0x00616161,
+  0x8000003e, 0x00000000, 0x00000005, 0x00131313, 0x00515151, 0x00909090, 0x00e1e1e1, 0x00f4f4f4,
+  0x8000000d, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000,
+  0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959,
+  0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00ededed, 0x00202020, 0x00171717, 0x80000020, 0x00000000, 0x00000004, 0x004a4a4a, 0x00606060,
+  0x00dbdbdb, 0x00e6e6e6, 0x8000001e, 0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212,
+  0x8000001b, 0x00000000, 0x00000007, 0x00010101, 0x000a0a0a, 0x002c2c2c, 0x00737373, 0x00acacac,
+  0x00e0e0e0, 0x00f6f6f6, 0x80000031, 0x00ffffff, 0x00000005, 0x00efefef, 0x00cfcfcf, 0x00808080,
+  0x003d3d3d, 0x00101010, 0x8000002c, 0x00000000, 0x00000006, 0x00050505, 0x00070707, 0x00727272,
+  0x00878787, 0x00dadada, 0x00e7e7e7, 0x80000008, 0x00ffffff, 0x00000003, 0x00f1f1f1, 0x00d8d8d8,
+  0x005f5f5f, 0x80000011, 0x00000000, 0x00000003, 0x00525252, 0x00909090, 0x00e5e5e5, 0x80000004,
+  0x00ffffff, 0x00000007, 0x00fdfdfd, 0x00fafafa, 0x00c5c5c5, 0x009e9e9e, 0x00434343, 0x00282828,
+  0x00010101, 0x8000004a, 0x00000000, 0x00000003, 0x00222222, 0x00545454, 0x00bbbbbb, 0x80000014,
+  0x00ffffff, 0x00000003, 0x00fefefe, 0x008e8e8e, 0x00707070, 0x8000003e, 0x00000000, 0x00000008,
+  0x000e0e0e, 0x003b3b3b, 0x006a6a6a, 0x00a7a7a7, 0x00cacaca, 0x00dedede, 0x00f7f7f7, 0x00fcfcfc,
+  0x8000000a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016, 0x00000000,
+  0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878, 0x00595959,
+  0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00ededed, 0x00202020, 0x00171717, 0x80000020, 0x00000000, 0x00000009, 0x00363636, 0x00464646,
+  0x00a2a2a2, 0x00b1b1b1, 0x00d6d6d6, 0x00e1e1e1, 0x00ededed, 0x00f8f8f8, 0x00fdfdfd, 0x80000019,
+  0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x8000001b, 0x00000000, 0x0000000a,
+  0x00010101, 0x00070707, 0x00202020, 0x00545454, 0x007e7e7e, 0x00a5a5a5, 0x00c5c5c5, 0x00d1d1d1,
+  0x00ededed, 0x00f1f1f1, 0x80000029, 0x00ffffff, 0x0000000a, 0x00fefefe, 0x00fdfdfd, 0x00ededed,
+  0x00e8e8e8, 0x00d4d4d4, 0x00c0c0c0, 0x00989898, 0x005e5e5e, 0x002d2d2d, 0x000c0c0c, 0x8000002c,
+  0x00000000, 0x00000011, 0x00040404, 0x00050505, 0x00545454, 0x00626262, 0x009f9f9f, 0x00aeaeae,
+  0x00c9c9c9, 0x00d6d6d6, 0x00e1e1e1, 0x00ededed, 0x00f1f1f1, 0x00fcfcfc, 0x00fdfdfd, 0x00ffffff,
+  0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f, 0x80000011, 0x00000000, 0x0000000e, 0x00525252, 0x00909090,
+  0x00e5e5e5, 0x00ffffff, 0x00fcfcfc, 0x00f7f7f7, 0x00e1e1e1, 0x00d4d4d4, 0x00bebebe, 0x00949494,
+  0x00747474, 0x00313131, 0x001d1d1d, 0x00010101, 0x8000004a, 0x00000000, 0x00000003, 0x00151515,
+  0x00353535, 0x00afafaf, 0x80000014, 0x00ffffff, 0x00000003, 0x00fefefe, 0x00c0c0c0, 0x00989898,
+  0x80000040, 0x00000000, 0x00000006, 0x00040404, 0x000a0a0a, 0x00575757, 0x00848484, 0x00e0e0e0,
+  0x00f2f2f2, 0x8000000a, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016,
+  0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878,
+  0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000022, 0x00000000, 0x00000008, 0x00050505,
+  0x00222222, 0x00676767, 0x00919191, 0x00bbbbbb, 0x00e6e6e6, 0x00f9f9f9, 0x00fefefe, 0x80000018,
+  0x00ffffff, 0x00000003, 0x00d2d2d2, 0x00c0c0c0, 0x00121212, 0x8000001f, 0x00000000, 0x00000006,
+  0x00020202, 0x00030303, 0x003d3d3d, 0x00545454, 0x00bcbcbc, 0x00cccccc, 0x80000029, 0x00ffffff,
+  0x00000008, 0x00fbfbfb, 0x00f9f9f9, 0x00bbbbbb, 0x00ababab, 0x005f5f5f, 0x003f3f3f, 0x00020202,
+  0x00010101, 0x80000033, 0x00000000, 0x0000000c, 0x00131313, 0x00353535, 0x00686868, 0x00909090,
+  0x00bebebe, 0x00cccccc, 0x00f4f4f4, 0x00f7f7f7, 0x00ffffff, 0x00f1f1f1, 0x00d8d8d8, 0x005f5f5f,
+  0x80000011, 0x00000000, 0x0000000a, 0x00525252, 0x00909090, 0x00e5e5e5, 0x00ffffff, 0x00f4f4f4,
+  0x00e3e3e3, 0x008f8f8f, 0x00646464, 0x001c1c1c, 0x000c0c0c, 0x8000004e, 0x00000000, 0x00000003,
+  0x000e0e0e, 0x00222222, 0x00a7a7a7, 0x80000015, 0x00ffffff, 0x00000004, 0x00dbdbdb, 0x00aeaeae,
+  0x00050505, 0x00030303, 0x8000003e, 0x00000000, 0x0000000c, 0x00020202, 0x00050505, 0x002f2f2f,
+  0x00464646, 0x007b7b7b, 0x00878787, 0x00b0b0b0, 0x00bababa, 0x00dadada, 0x00e9e9e9, 0x00fcfcfc,
+  0x00fefefe, 0x80000004, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050, 0x002d2d2d, 0x80000016,
+  0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003, 0x00f7f7f7, 0x00787878,
+  0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000022, 0x00000000, 0x00000012, 0x00030303,
+  0x00121212, 0x00373737, 0x004d4d4d, 0x00646464, 0x007e7e7e, 0x008a8a8a, 0x00aaaaaa, 0x00b0b0b0,
+  0x00cacaca, 0x00cdcdcd, 0x00d5d5d5, 0x00dbdbdb, 0x00e0e0e0, 0x00e8e8e8, 0x00ebebeb, 0x00f5f5f5,
+  0x00f6f6f6, 0x8000000e, 0x00f8f8f8, 0x00000003, 0x00cccccc, 0x00bababa, 0x00111111, 0x8000001f,
+  0x00000000, 0x0000000d, 0x00010101, 0x00020202, 0x00212121, 0x002d2d2d, 0x00646464, 0x00707070,
+  0x00a1a1a1, 0x00adadad, 0x00c6c6c6, 0x00d5d5d5, 0x00e3e3e3, 0x00f5f5f5, 0x00fcfcfc, 0x8000001c,
+  0x00ffffff, 0x0000000d, 0x00fefefe, 0x00f8f8f8, 0x00ededed, 0x00d6d6d6, 0x00c2c2c2, 0x00b0b0b0,
+  0x00959595, 0x008b8b8b, 0x00646464, 0x005b5b5b, 0x00333333, 0x00222222, 0x00010101, 0x80000034,
+  0x00000000, 0x0000000c, 0x000a0a0a, 0x001c1c1c, 0x00373737, 0x004d4d4d, 0x00656565, 0x006d6d6d,
+  0x00838383, 0x00878787, 0x00999999, 0x00969696, 0x00919191, 0x00404040, 0x80000011, 0x00000000,
+  0x0000000a, 0x004d4d4d, 0x00878787, 0x00b6b6b6, 0x00c4c4c4, 0x008c8c8c, 0x00808080, 0x004c4c4c,
+  0x00353535, 0x000f0f0f, 0x00060606, 0x8000004e, 0x00000000, 0x00000003, 0x00050505, 0x000d0d0d,
+  0x009f9f9f, 0x80000015, 0x00ffffff, 0x00000004, 0x00f9f9f9, 0x00c7c7c7, 0x000b0b0b, 0x00060606,
+  0x80000042, 0x00000000, 0x00000008, 0x00080808, 0x000c0c0c, 0x00565656, 0x006b6b6b, 0x00b0b0b0,
+  0x00d0d0d0, 0x00f9f9f9, 0x00fdfdfd, 0x80000004, 0x00ffffff, 0x00000003, 0x00d5d5d5, 0x00505050,
+  0x002d2d2d, 0x80000016, 0x00000000, 0x00000001, 0x000d0d0d, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00f7f7f7, 0x00787878, 0x00595959, 0x80000020, 0x00000000, 0x00000002, 0x004d4d4d, 0x00646464,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00ededed, 0x00202020, 0x00171717, 0x80000027, 0x00000000,
+  0x0000000d, 0x00080808, 0x000c0c0c, 0x004a4a4a, 0x00575757, 0x008d8d8d, 0x00949494, 0x00a6a6a6,
+  0x00b2b2b2, 0x00bdbdbd, 0x00cecece, 0x00d5d5d5, 0x00e9e9e9, 0x00ececec, 0x8000000e, 0x00f0f0f0,
+  0x00000003, 0x00c6c6c6, 0x00b4b4b4, 0x00111111, 0x80000024, 0x00000000, 0x00000009, 0x00060606,
+  0x00353535, 0x004f4f4f, 0x00868686, 0x00a6a6a6, 0x00c3c3c3, 0x00e9e9e9, 0x00f8f8f8, 0x00fefefe,
+  0x8000001b, 0x00ffffff, 0x00000009, 0x00fdfdfd, 0x00f0f0f0, 0x00d8d8d8, 0x00a7a7a7, 0x007c7c7c,
+  0x00575757, 0x00212121, 0x000e0e0e, 0x00010101, 0x8000003e, 0x00000000, 0x00000006, 0x00020202,
+  0x00070707, 0x00242424, 0x002e2e2e, 0x00414141, 0x001c1c1c, 0x80000011, 0x00000000, 0x00000006,
+  0x00474747, 0x007c7c7c, 0x007f7f7f, 0x00808080, 0x00161616, 0x00101010, 0x80000052, 0x00000000,
+  0x00000005, 0x00020202, 0x00040404, 0x00909090, 0x00ececec, 0x00fbfbfb, 0x80000013, 0x00ffffff,
+  0x00000004, 0x00fdfdfd, 0x00d3d3d3, 0x00343434, 0x001f1f1f, 0x80000042, 0x00000000, 0x0000000f,
+  0x00030303, 0x00040404, 0x001d1d1d, 0x00242424, 0x003b3b3b, 0x00474747, 0x00575757, 0x00696969,
+  0x00737373, 0x008b8b8b, 0x00919191, 0x00adadad, 0x00929292, 0x003c3c3c, 0x00222222, 0x80000016,
+  0x00000000, 0x00000001, 0x00040404, 0x8000001a, 0x005a5a5a, 0x00000003, 0x00575757, 0x002a2a2a,
+  0x001f1f1f, 0x80000020, 0x00000000, 0x00000002, 0x001b1b1b, 0x00232323, 0x8000001a, 0x005a5a5a,
+  0x00000003, 0x00545454, 0x000b0b0b, 0x00080808, 0x80000027, 0x00000000, 0x0000000d, 0x00030303,
+  0x00040404, 0x00191919, 0x001d1d1d, 0x002f2f2f, 0x00313131, 0x00373737, 0x003b3b3b, 0x003f3f3f,
+  0x00454545, 0x00474747, 0x004e4e4e, 0x004f4f4f, 0x8000000e, 0x00505050, 0x00000003, 0x00424242,
+  0x003c3c3c, 0x00060606, 0x80000024, 0x00000000, 0x0000002c, 0x00020202, 0x00121212, 0x001a1a1a,
+  0x002d2d2d, 0x00373737, 0x00414141, 0x00515151, 0x00575757, 0x007a7a7a, 0x00828282, 0x00a6a6a6,
+  0x00afafaf, 0x00c4c4c4, 0x00cacaca, 0x00d0d0d0, 0x00d8d8d8, 0x00dbdbdb, 0x00e6e6e6, 0x00e8e8e8,
+  0x00f2f2f2, 0x00f6f6f6, 0x00fcfcfc, 0x00f7f7f7, 0x00f2f2f2, 0x00e8e8e8, 0x00e4e4e4, 0x00d6d6d6,
+  0x00d3d3d3, 0x00c6c6c6, 0x00c2c2c2, 0x00b8b8b8, 0x00b1b1b1, 0x00aaaaaa, 0x009f9f9f, 0x009b9b9b,
+  0x00848484, 0x007c7c7c, 0x00535353, 0x004a4a4a, 0x00383838, 0x00292929, 0x001d1d1d, 0x000b0b0b,
+  0x00050505, 0x8000003f, 0x00000000, 0x00000006, 0x00010101, 0x00020202, 0x000c0c0c, 0x000f0f0f,
+  0x00161616, 0x00090909, 0x80000011, 0x00000000, 0x00000006, 0x00181818, 0x00292929, 0x002a2a2a,
+  0x002b2b2b, 0x00070707, 0x00050505, 0x80000054, 0x00000000, 0x00000003, 0x00898989, 0x00e3e3e3,
+  0x00f9f9f9, 0x80000014, 0x00ffffff, 0x00000003, 0x00d9d9d9, 0x00494949, 0x002b2b2b, 0x80000047,
+  0x00000000, 0x0000000a, 0x00030303, 0x00060606, 0x001f1f1f, 0x002d2d2d, 0x00515151, 0x005a5a5a,
+  0x00848484, 0x00707070, 0x00323232, 0x001c1c1c, 0x80000017, 0x00000000, 0x8000001b, 0x00080808,
+  0x00000002, 0x00030303, 0x00020202, 0x80000020, 0x00000000, 0x00000002, 0x00020202, 0x00020202,
+  0x8000001a, 0x00080808, 0x00000003, 0x00070707, 0x00010101, 0x00010101, 0x8000006f, 0x00000000,
+  0x00000021, 0x00050505, 0x00070707, 0x00383838, 0x00444444, 0x00797979, 0x00888888, 0x00a6a6a6,
+  0x00afafaf, 0x00b8b8b8, 0x00c4c4c4, 0x00c9c9c9, 0x00d9d9d9, 0x00dcdcdc, 0x00ececec, 0x00f1f1f1,
+  0x00fbfbfb, 0x00f3f3f3, 0x00ececec, 0x00dcdcdc, 0x00d6d6d6, 0x00c2c2c2, 0x00bdbdbd, 0x00aaaaaa,
+  0x00a3a3a3, 0x00959595, 0x00898989, 0x007f7f7f, 0x006f6f6f, 0x00696969, 0x00464646, 0x003c3c3c,
+  0x00050505, 0x00030303, 0x800000b5, 0x00000000, 0x00000003, 0x00737373, 0x00c0c0c0, 0x00f2f2f2,
+  0x80000014, 0x00ffffff, 0x00000003, 0x00e5e5e5, 0x00848484, 0x004e4e4e, 0x80000048, 0x00000000,
+  0x00000009, 0x00010101, 0x00040404, 0x00060606, 0x000b0b0b, 0x000c0c0c, 0x00121212, 0x000f0f0f,
+  0x00070707, 0x00040404, 0x80000017, 0x00000000, 0x8000001b, 0x00010101, 0x80000024, 0x00000000,
+  0x8000001b, 0x00010101, 0x80000071, 0x00000000, 0x00000020, 0x00010101, 0x00010101, 0x00080808,
+  0x00090909, 0x00101010, 0x00121212, 0x00161616, 0x00181818, 0x00191919, 0x001a1a1a, 0x001b1b1b,
+  0x001d1d1d, 0x001e1e1e, 0x00202020, 0x00202020, 0x00222222, 0x00212121, 0x00202020, 0x001e1e1e,
+  0x001d1d1d, 0x001a1a1a, 0x00191919, 0x00171717, 0x00161616, 0x00141414, 0x00121212, 0x00111111,
+  0x000f0f0f, 0x000e0e0e, 0x00090909, 0x00080808, 0x00010101, 0x800000b6, 0x00000000, 0x00000003,
+  0x006e6e6e, 0x00b7b7b7, 0x00f1f1f1, 0x80000014, 0x00ffffff, 0x00000003, 0x00e8e8e8, 0x00929292,
+  0x00565656, 0x80000209, 0x00000000, 0x00000003, 0x00575757, 0x00919191, 0x00e9e9e9, 0x80000014,
+  0x00ffffff, 0x00000003, 0x00f6f6f6, 0x00d3d3d3, 0x007c7c7c, 0x80000209, 0x00000000, 0x00000003,
+  0x00515151, 0x00868686, 0x00e7e7e7, 0x80000014, 0x00ffffff, 0x00000005, 0x00f8f8f8, 0x00dfdfdf,
+  0x00898989, 0x000f0f0f, 0x00060606, 0x80000207, 0x00000000, 0x00000003, 0x003e3e3e, 0x00676767,
+  0x00e1e1e1, 0x80000016, 0x00ffffff, 0x00000003, 0x00adadad, 0x00383838, 0x00161616, 0x80000207,
+  0x00000000, 0x00000003, 0x00333333, 0x00545454, 0x00dddddd, 0x80000016, 0x00ffffff, 0x00000003,
+  0x00c4c4c4, 0x006f6f6f, 0x002b2b2b, 0x80000207, 0x00000000, 0x00000003, 0x00252525, 0x003e3e3e,
+  0x00d9d9d9, 0x80000016, 0x00ffffff, 0x00000003, 0x00dedede, 0x00aeaeae, 0x00444444, 0x80000207,
+  0x00000000, 0x00000003, 0x00151515, 0x00232323, 0x00d4d4d4, 0x80000016, 0x00ffffff, 0x00000005,
+  0x00f3f3f3, 0x00e2e2e2, 0x00676767, 0x00191919, 0x00050505, 0x80000205, 0x00000000, 0x00000003,
+  0x000d0d0d, 0x00151515, 0x00d1d1d1, 0x80000016, 0x00ffffff, 0x00000005, 0x00fefefe, 0x00fdfdfd,
+  0x00797979, 0x00262626, 0x00070707, 0x80000205, 0x00000000, 0x00000004, 0x00020202, 0x00030303,
+  0x00bbbbbb, 0x00e9e9e9, 0x80000017, 0x00ffffff, 0x00000003, 0x00b7b7b7, 0x008a8a8a, 0x001a1a1a,
+  0x80000207, 0x00000000, 0x00000002, 0x00b4b4b4, 0x00e1e1e1, 0x80000017, 0x00ffffff, 0x00000004,
+  0x00c5c5c5, 0x00a0a0a0, 0x001f1f1f, 0x00010101, 0x80000206, 0x00000000, 0x00000002, 0x007a7a7a,
+  0x00989898, 0x80000017, 0x00ffffff, 0x00000004, 0x00fbfbfb, 0x00f8f8f8, 0x00414141, 0x00171717,
+  0x80000206, 0x00000000, 0x00000002, 0x006a6a6a, 0x00848484, 0x80000017, 0x00ffffff, 0x00000004,
+  0x00fcfcfc, 0x00fafafa, 0x00595959, 0x00333333, 0x80000206, 0x00000000, 0x00000002, 0x003b3b3b,
+  0x004a4a4a, 0x80000019, 0x00ffffff, 0x00000002, 0x009c9c9c, 0x00838383, 0x80000206, 0x00000000,
+  0x00000004, 0x00222222, 0x002b2b2b, 0x00f9f9f9, 0x00fafafa, 0x80000017, 0x00ffffff, 0x00000004,
+  0x00c3c3c3, 0x00b3b3b3, 0x00050505, 0x00040404, 0x80000204, 0x00000000, 0x00000004, 0x00050505,
+  0x00070707, 0x00f2f2f2, 0x00f5f5f5, 0x80000017, 0x00ffffff, 0x00000004, 0x00f1f1f1, 0x00ebebeb,
+  0x000c0c0c, 0x00090909, 0x80000204, 0x00000000, 0x00000004, 0x00020202, 0x00030303, 0x00c2c2c2,
+  0x00cecece, 0x80000017, 0x00ffffff, 0x00000004, 0x00fafafa, 0x00f7f7f7, 0x00595959, 0x00464646,
+  0x80000205, 0x00000000, 0x00000003, 0x00010101, 0x00a9a9a9, 0x00bbbbbb, 0x80000018, 0x00ffffff,
+  0x00000003, 0x00fdfdfd, 0x00828282, 0x00666666, 0x80000206, 0x00000000, 0x00000002, 0x00656565,
+  0x00848484, 0x80000019, 0x00ffffff, 0x00000004, 0x00eaeaea, 0x00c1c1c1, 0x002c2c2c, 0x001a1a1a,
+  0x8000019b, 0x00000000, 0x00000003, 0x00010101, 0x00030303, 0x00010101, 0x80000066, 0x00000000,
+  0x00000002, 0x00555555, 0x00787878, 0x80000019, 0x00ffffff, 0x00000004, 0x00fbfbfb, 0x00d3d3d3,
+  0x003d3d3d, 0x00242424, 0x80000198, 0x00000000, 0x00000006, 0x00010101, 0x00020202, 0x00070707,
+  0x00090909, 0x000b0b0b, 0x00050505, 0x80000066, 0x00000000, 0x00000004, 0x000f0f0f, 0x003f3f3f,
+  0x00fafafa, 0x00fcfcfc, 0x80000018, 0x00ffffff, 0x00000005, 0x00f6f6f6, 0x00d6d6d6, 0x00818181,
+  0x00080808, 0x00030303, 0x80000196, 0x00000000, 0x00000006, 0x000c0c0c, 0x001f1f1f, 0x00808080,
+  0x008a8a8a, 0x009b9b9b, 0x00434343, 0x80000066, 0x00000000, 0x00000004, 0x000b0b0b, 0x00393939,
+  0x00eaeaea, 0x00f2f2f2, 0x80000018, 0x00ffffff, 0x00000005, 0x00f8f8f8, 0x00e0e0e0, 0x00959595,
+  0x002a2a2a, 0x00101010, 0x80000192, 0x00000000, 0x0000000a, 0x00010101, 0x00010101, 0x00151515,
+  0x001b1b1b, 0x00434343, 0x00535353, 0x00a0a0a0, 0x00a0a0a0, 0x009e9e9e, 0x00454545, 0x80000067,
+  0x00000000, 0x00000003, 0x00262626, 0x00bababa, 0x00d6d6d6, 0x8000001a, 0x00ffffff, 0x00000003,
+  0x00d0d0d0, 0x008d8d8d, 0x00363636, 0x80000192, 0x00000000, 0x0000000a, 0x00030303, 0x00050505,
+  0x00545454, 0x006c6c6c, 0x00e4e4e4, 0x00ededed, 0x00ffffff, 0x00dfdfdf, 0x00a8a8a8, 0x00494949,
+  0x80000067, 0x00000000, 0x00000003, 0x001d1d1d, 0x008e8e8e, 0x00bcbcbc, 0x8000001a, 0x00ffffff,
+  0x00000005, 0x00e5e5e5, 0x00c0c0c0, 0x005b5b5b, 0x001c1c1c, 0x00050505, 0x8000018e, 0x00000000,
+  0x0000000c, 0x000f0f0f, 0x00282828, 0x004b4b4b, 0x00666666, 0x009d9d9d, 0x00afafaf, 0x00f0f0f0,
+  0x00f5f5f5, 0x00ffffff, 0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x80000067, 0x00000000, 0x00000003,
+  0x00121212, 0x00585858, 0x009c9c9c, 0x8000001a, 0x00ffffff, 0x00000005, 0x00fefefe, 0x00fdfdfd,
+  0x00888888, 0x003e3e3e, 0x000b0b0b, 0x8000018d, 0x00000000, 0x00000006, 0x00010101, 0x00202020,
+  0x00585858, 0x00a2a2a2, 0x00dcdcdc, 0x00f7f7f7, 0x80000004, 0x00ffffff, 0x00000003, 0x00dfdfdf,
+  0x00a8a8a8, 0x00494949, 0x80000067, 0x00000000, 0x00000005, 0x00070707, 0x00212121, 0x00727272,
+  0x00e9e9e9, 0x00f7f7f7, 0x80000019, 0x00ffffff, 0x00000005, 0x00fefefe, 0x00c8c8c8, 0x00a6a6a6,
+  0x00252525, 0x00080808, 0x8000018a, 0x00000000, 0x00000008, 0x002a2a2a, 0x003a3a3a, 0x00858585,
+  0x009c9c9c, 0x00c5c5c5, 0x00dfdfdf, 0x00f3f3f3, 0x00fcfcfc, 0x80000004, 0x00ffffff, 0x00000003,
+  0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x80000067, 0x00000000, 0x00000005, 0x00010101, 0x00030303,
+  0x005c5c5c, 0x00dedede, 0x00f2f2f2, 0x8000001a, 0x00ffffff, 0x00000004, 0x00ebebeb, 0x00dedede,
+  0x00333333, 0x000c0c0c, 0x8000018a, 0x00000000, 0x00000004, 0x00404040, 0x00595959, 0x00cccccc,
+  0x00dedede, 0x80000008, 0x00ffffff, 0x00000003, 0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x80000069,
+  0x00000000, 0x00000003, 0x00333333, 0x007c7c7c, 0x00cbcbcb, 0x8000001a, 0x00ffffff, 0x00000004,
+  0x00fcfcfc, 0x00fafafa, 0x009a9a9a, 0x00838383, 0x80000186, 0x00000000, 0x00000008, 0x00171717,
+  0x002a2a2a, 0x00828282, 0x009d9d9d, 0x00e0e0e0, 0x00e6e6e6, 0x00f7f7f7, 0x00fafafa, 0x80000008,
+  0x00ffffff, 0x00000003, 0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x80000069, 0x00000000, 0x00000004,
+  0x00292929, 0x00666666, 0x00c2c2c2, 0x00fefefe, 0x8000001b, 0x00ffffff, 0x00000004, 0x00b1b1b1,
+  0x009d9d9d, 0x00060606, 0x00050505, 0x80000181, 0x00000000, 0x00000008, 0x00020202, 0x00040404,
+  0x00080808, 0x00252525, 0x003b3b3b, 0x009d9d9d, 0x00bcbcbc, 0x00fcfcfc, 0x8000000b, 0x00ffffff,
+  0x00000003, 0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x80000069, 0x00000000, 0x00000005, 0x00040404,
+  0x00090909, 0x00919191, 0x00eaeaea, 0x00fbfbfb, 0x8000001b, 0x00ffffff, 0x00000003, 0x00fdfdfd,
+  0x00757575, 0x005c5c5c, 0x80000180, 0x00000000, 0x00000006, 0x00060606, 0x00272727, 0x00545454,
+  0x00a5a5a5, 0x00d7d7d7, 0x00fefefe, 0x8000000e, 0x00ffffff, 0x00000003, 0x00dfdfdf, 0x00a8a8a8,
+  0x00494949, 0x80000069, 0x00000000, 0x00000005, 0x00030303, 0x00070707, 0x00808080, 0x00cfcfcf,
+  0x00f6f6f6, 0x8000001b, 0x00ffffff, 0x00000005, 0x00fdfdfd, 0x00979797, 0x007c7c7c, 0x001a1a1a,
+  0x000f0f0f, 0x8000017b, 0x00000000, 0x00000009, 0x000b0b0b, 0x000f0f0f, 0x002b2b2b, 0x00333333,
+  0x005c5c5c, 0x007f7f7f, 0x00bbbbbb, 0x00e1e1e1, 0x00fefefe, 0x8000000e, 0x00ffffff, 0x00000003,
+  0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x8000006b, 0x00000000, 0x00000003, 0x004c4c4c, 0x007e7e7e,
+  0x00e6e6e6, 0x8000001d, 0x00ffffff, 0x00000003, 0x00dedede, 0x00676767, 0x003c3c3c, 0x8000017b,
+  0x00000000, 0x00000006, 0x002d2d2d, 0x003c3c3c, 0x00ababab, 0x00bcbcbc, 0x00fefefe, 0x00fefefe,
+  0x80000011, 0x00ffffff, 0x00000003, 0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x8000006b, 0x00000000,
+  0x00000004, 0x002f2f2f, 0x004e4e4e, 0x00d9d9d9, 0x00fafafa, 0x8000001c, 0x00ffffff, 0x00000005,
+  0x00ededed, 0x00aaaaaa, 0x00747474, 0x00282828, 0x000f0f0f, 0x80000174, 0x00000000, 0x0000000a,
+  0x00010101, 0x000e0e0e, 0x00252525, 0x00424242, 0x00595959, 0x00858585, 0x00939393, 0x00d1d1d1,
+  0x00dadada, 0x00fefefe, 0x80000012, 0x00ffffff, 0x00000003, 0x00dfdfdf, 0x00a8a8a8, 0x00494949,
+  0x8000006b, 0x00000000, 0x00000004, 0x000b0b0b, 0x00121212, 0x00c8c8c8, 0x00f4f4f4, 0x8000001d,
+  0x00ffffff, 0x00000004, 0x00fdfdfd, 0x00b8b8b8, 0x00595959, 0x00222222, 0x80000174, 0x00000000,
+  0x00000006, 0x00020202, 0x001f1f1f, 0x00535353, 0x00939393, 0x00c7c7c7, 0x00f1f1f1, 0x80000016,
+  0x00ffffff, 0x00000003, 0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x8000006b, 0x00000000, 0x00000004,
+  0x00040404, 0x00060606, 0x00929292, 0x00b4b4b4, 0x8000001d, 0x00ffffff, 0x00000006, 0x00fefefe,
+  0x00e5e5e5, 0x00c2c2c2, 0x00696969, 0x00323232, 0x00090909, 0x8000016e, 0x00000000, 0x0000000a,
+  0x00050505, 0x00060606, 0x00424242, 0x00505050, 0x008f8f8f, 0x00a1a1a1, 0x00c2c2c2, 0x00d9d9d9,
+  0x00ebebeb, 0x00fafafa, 0x80000016, 0x00ffffff, 0x00000003, 0x00dfdfdf, 0x00a8a8a8, 0x00494949,
+  0x8000006d, 0x00000000, 0x00000002, 0x00747474, 0x00919191, 0x8000001e, 0x00ffffff, 0x00000005,
+  0x00fdfdfd, 0x00fbfbfb, 0x008f8f8f, 0x004d4d4d, 0x000e0e0e, 0x8000016e, 0x00000000, 0x00000006,
+  0x00080808, 0x000a0a0a, 0x00666666, 0x007c7c7c, 0x00dcdcdc, 0x00e8e8e8, 0x8000001a, 0x00ffffff,
+  0x00000003, 0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x8000006d, 0x00000000, 0x00000004, 0x00242424,
+  0x002e2e2e, 0x00f4f4f4, 0x00f6f6f6, 0x8000001d, 0x00ffffff, 0x00000005, 0x00fefefe, 0x00eaeaea,
+  0x00dddddd, 0x00555555, 0x00363636, 0x80000169, 0x00000000, 0x0000000a, 0x00070707, 0x00131313,
+  0x00454545, 0x006e6e6e, 0x00b3b3b3, 0x00c9c9c9, 0x00e7e7e7, 0x00ebebeb, 0x00fafafa, 0x00fcfcfc,
+  0x8000001a, 0x00ffffff, 0x00000003, 0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x8000006d, 0x00000000,
+  0x00000004, 0x00151515, 0x001b1b1b, 0x00ececec, 0x00f0f0f0, 0x8000001e, 0x00ffffff, 0x00000006,
+  0x00fafafa, 0x00f7f7f7, 0x00696969, 0x00484848, 0x00030303, 0x00020202, 0x80000164, 0x00000000,
+  0x0000000a, 0x00020202, 0x00030303, 0x00070707, 0x00101010, 0x00202020, 0x00595959, 0x00888888,
+  0x00d4d4d4, 0x00ededed, 0x00fefefe, 0x8000001d, 0x00ffffff, 0x00000003, 0x00dfdfdf, 0x00a8a8a8,
+  0x00494949, 0x8000006e, 0x00000000, 0x00000003, 0x00010101, 0x006a6a6a, 0x00898989, 0x80000020,
+  0x00ffffff, 0x00000004, 0x00f5f5f5, 0x00efefef, 0x003b3b3b, 0x002e2e2e, 0x80000164, 0x00000000,
+  0x00000006, 0x00252525, 0x00383838, 0x00999999, 0x00bababa, 0x00f7f7f7, 0x00fbfbfb, 0x80000021,
+  0x00ffffff, 0x00000003, 0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x8000006e, 0x00000000, 0x00000005,
+  0x00010101, 0x00505050, 0x00727272, 0x00f1f1f1, 0x00f6f6f6, 0x8000001e, 0x00ffffff, 0x00000006,
+  0x00f8f8f8, 0x00f3f3f3, 0x00696969, 0x00585858, 0x00191919, 0x000f0f0f, 0x8000015c, 0x00000000,
+  0x0000000c, 0x00010101, 0x00020202, 0x000c0c0c, 0x00151515, 0x00272727, 0x002d2d2d, 0x00595959,
+  0x00686868, 0x00b2b2b2, 0x00cbcbcb, 0x00f9f9f9, 0x00fcfcfc, 0x80000021, 0x00ffffff, 0x00000003,
+  0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x8000006f, 0x00000000, 0x00000004, 0x00010101, 0x00292929,
+  0x00c4c4c4, 0x00dcdcdc, 0x80000020, 0x00ffffff, 0x00000004, 0x00f9f9f9, 0x00d9d9d9, 0x00676767,
+  0x003c3c3c, 0x8000015c, 0x00000000, 0x00000008, 0x00020202, 0x00070707, 0x00323232, 0x00565656,
+  0x009f9f9f, 0x00b8b8b8, 0x00fbfbfb, 0x00fefefe, 0x80000025, 0x00ffffff, 0x00000003, 0x00dfdfdf,
+  0x00a8a8a8, 0x00494949, 0x8000006f, 0x00000000, 0x00000006, 0x00010101, 0x001b1b1b, 0x007f7f7f,
+  0x00b2b2b2, 0x00fcfcfc, 0x00fefefe, 0x8000001e, 0x00ffffff, 0x00000008, 0x00fcfcfc, 0x00eaeaea,
+  0x00aaaaaa, 0x00808080, 0x00464646, 0x001c1c1c, 0x00030303, 0x00010101, 0x80000155, 0x00000000,
+  0x0000000a, 0x00151515, 0x001c1c1c, 0x00414141, 0x00505050, 0x006d6d6d, 0x00898989, 0x00a1a1a1,
+  0x00cacaca, 0x00d7d7d7, 0x00fdfdfd, 0x80000026, 0x00ffffff, 0x00000003, 0x00dfdfdf, 0x00a8a8a8,
+  0x00494949, 0x80000070, 0x00000000, 0x00000005, 0x00080808, 0x00292929, 0x007d7d7d, 0x00f8f8f8,
+  0x00fcfcfc, 0x80000021, 0x00ffffff, 0x00000005, 0x00d6d6d6, 0x009d9d9d, 0x00404040, 0x00070707,
+  0x00010101, 0x80000155, 0x00000000, 0x00000006, 0x002e2e2e, 0x00404040, 0x00939393, 0x00b2b2b2,
+  0x00ededed, 0x00f7f7f7, 0x8000002a, 0x00ffffff, 0x00000003, 0x00dfdfdf, 0x00a8a8a8, 0x00494949,
+  0x80000070, 0x00000000, 0x00000005, 0x00030303, 0x000f0f0f, 0x004e4e4e, 0x00a9a9a9, 0x00dddddd,
+  0x80000021, 0x00ffffff, 0x00000006, 0x00f0f0f0, 0x00dcdcdc, 0x00a6a6a6, 0x00858585, 0x00272727,
+  0x00121212, 0x8000014e, 0x00000000, 0x0000000c, 0x00040404, 0x000c0c0c, 0x002b2b2b, 0x00464646,
+  0x00757575, 0x00858585, 0x00b3b3b3, 0x00bababa, 0x00d8d8d8, 0x00e4e4e4, 0x00f9f9f9, 0x00fcfcfc,
+  0x8000002a, 0x00ffffff, 0x00000003, 0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x80000072, 0x00000000,
+  0x00000003, 0x00333333, 0x007d7d7d, 0x00cccccc, 0x80000023, 0x00ffffff, 0x00000004, 0x00dfdfdf,
+  0x00cbcbcb, 0x003c3c3c, 0x001c1c1c, 0x8000014e, 0x00000000, 0x00000007, 0x00060606, 0x00121212,
+  0x00444444, 0x006d6d6d, 0x00b6b6b6, 0x00cfcfcf, 0x00fcfcfc, 0x8000002f, 0x00ffffff, 0x00000003,
+  0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x80000072, 0x00000000, 0x00000005, 0x000a0a0a, 0x00181818,
+  0x008e8e8e, 0x00dadada, 0x00f8f8f8, 0x80000021, 0x00ffffff, 0x00000006, 0x00fafafa, 0x00f7f7f7,
+  0x00d1d1d1, 0x00c6c6c6, 0x00373737, 0x002b2b2b, 0x80000147, 0x00000000, 0x0000000b, 0x00010101,
+  0x00020202, 0x00393939, 0x00484848, 0x008f8f8f, 0x00a7a7a7, 0x00d4d4d4, 0x00dfdfdf, 0x00e8e8e8,
+  0x00f3f3f3, 0x00f7f7f7, 0x80000030, 0x00ffffff, 0x00000003, 0x00dfdfdf, 0x00a8a8a8, 0x00494949,
+  0x80000072, 0x00000000, 0x00000005, 0x00020202, 0x00050505, 0x007f7f7f, 0x00cdcdcd, 0x00f5f5f5,
+  0x80000023, 0x00ffffff, 0x00000006, 0x00eeeeee, 0x00e7e7e7, 0x00494949, 0x003a3a3a, 0x00050505,
+  0x00030303, 0x80000142, 0x00000000, 0x0000000b, 0x00010101, 0x00040404, 0x00050505, 0x00090909,
+  0x000b0b0b, 0x004b4b4b, 0x005d5d5d, 0x00adadad, 0x00c8c8c8, 0x00f9f9f9, 0x00fcfcfc, 0x80000033,
+  0x00ffffff, 0x00000003, 0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x80000074, 0x00000000, 0x00000004,
+  0x00212121, 0x00373737, 0x00d7d7d7, 0x00fdfdfd, 0x80000024, 0x00ffffff, 0x00000006, 0x00fcfcfc,
+  0x00dedede, 0x00767676, 0x00454545, 0x00020202, 0x00010101, 0x8000013f, 0x00000000, 0x00000007,
+  0x000c0c0c, 0x00242424, 0x00585858, 0x00848484, 0x00cbcbcb, 0x00e3e3e3, 0x00fdfdfd, 0x80000038,
+  0x00ffffff, 0x00000003, 0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x80000074, 0x00000000, 0x00000004,
+  0x00191919, 0x002a2a2a, 0x00bababa, 0x00dddddd, 0x80000024, 0x00ffffff, 0x00000008, 0x00fdfdfd,
+  0x00e6e6e6, 0x00979797, 0x006c6c6c, 0x00323232, 0x001b1b1b, 0x000d0d0d, 0x00020202, 0x80000138,
+  0x00000000, 0x0000000c, 0x00050505, 0x00070707, 0x001a1a1a, 0x001e1e1e, 0x002f2f2f, 0x003d3d3d,
+  0x00585858, 0x00808080, 0x00a1a1a1, 0x00d7d7d7, 0x00eaeaea, 0x00fefefe, 0x80000038, 0x00ffffff,
+  0x00000003, 0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x80000076, 0x00000000, 0x00000002, 0x005f5f5f,
+  0x00767676, 0x80000027, 0x00ffffff, 0x00000005, 0x00e9e9e9, 0x00cccccc, 0x006e6e6e, 0x00363636,
+  0x00090909, 0x80000138, 0x00000000, 0x00000006, 0x00171717, 0x001f1f1f, 0x006d6d6d, 0x007e7e7e,
+  0x00c6c6c6, 0x00d9d9d9, 0x8000003e, 0x00ffffff, 0x00000003, 0x00dfdfdf, 0x00a8a8a8, 0x00494949,
+  0x80000076, 0x00000000, 0x00000004, 0x00353535, 0x00434343, 0x00d4d4d4, 0x00dddddd, 0x80000025,
+  0x00ffffff, 0x00000008, 0x00f3f3f3, 0x00e2e2e2, 0x00adadad, 0x008e8e8e, 0x00505050, 0x00424242,
+  0x00080808, 0x00060606, 0x8000012f, 0x00000000, 0x0000000c, 0x00020202, 0x00101010, 0x001c1c1c,
+  0x00343434, 0x00484848, 0x00595959, 0x00777777, 0x00818181, 0x00adadad, 0x00b6b6b6, 0x00dfdfdf,
+  0x00eaeaea, 0x8000003e, 0x00ffffff, 0x00000003, 0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x80000077,
+  0x00000000, 0x00000003, 0x00020202, 0x009c9c9c, 0x00b1b1b1, 0x80000027, 0x00ffffff, 0x00000006,
+  0x00fefefe, 0x00fefefe, 0x00ababab, 0x00969696, 0x00131313, 0x000f0f0f, 0x8000012f, 0x00000000,
+  0x00000007, 0x00050505, 0x00242424, 0x00404040, 0x00777777, 0x00a4a4a4, 0x00cbcbcb, 0x00f1f1f1,
+  0x80000043, 0x00ffffff, 0x00000003, 0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x80000077, 0x00000000,
+  0x00000005, 0x00010101, 0x003c3c3c, 0x005c5c5c, 0x00d6d6d6, 0x00e7e7e7, 0x80000027, 0x00ffffff,
+  0x00000007, 0x00e1e1e1, 0x00d9d9d9, 0x009d9d9d, 0x00888888, 0x00404040, 0x00252525, 0x00010101,
+  0x80000127, 0x00000000, 0x0000000c, 0x000e0e0e, 0x001a1a1a, 0x00414141, 0x004f4f4f, 0x00818181,
+  0x008a8a8a, 0x00afafaf, 0x00bababa, 0x00cecece, 0x00dedede, 0x00ececec, 0x00fafafa, 0x80000043,
+  0x00ffffff, 0x00000003, 0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x80000078, 0x00000000, 0x00000004,
+  0x00050505, 0x002c2c2c, 0x00bebebe, 0x00d9d9d9, 0x80000029, 0x00ffffff, 0x00000005, 0x00ececec,
+  0x00cdcdcd, 0x00656565, 0x003a3a3a, 0x00010101, 0x80000127, 0x00000000, 0x00000006, 0x00161616,
+  0x00292929, 0x00666666, 0x007c7c7c, 0x00cbcbcb, 0x00d6d6d6, 0x80000049, 0x00ffffff, 0x00000003,
+  0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x80000078, 0x00000000, 0x00000006, 0x00010101, 0x000a0a0a,
+  0x002e2e2e, 0x00777777, 0x00e0e0e0, 0x00f3f3f3, 0x80000027, 0x00ffffff, 0x00000008, 0x00fcfcfc,
+  0x00f7f7f7, 0x00e6e6e6, 0x00cbcbcb, 0x00a8a8a8, 0x00595959, 0x002b2b2b, 0x00070707, 0x8000011f,
+  0x00000000, 0x0000000b, 0x00242424, 0x00303030, 0x006c6c6c, 0x00838383, 0x00b2b2b2, 0x00c8c8c8,
+  0x00dcdcdc, 0x00e6e6e6, 0x00e9e9e9, 0x00f6f6f6, 0x00f8f8f8, 0x80000049, 0x00ffffff, 0x00000003,
+  0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x80000079, 0x00000000, 0x00000006, 0x00040404, 0x00111111,
+  0x00616161, 0x00d4d4d4, 0x00eeeeee, 0x00fefefe, 0x80000029, 0x00ffffff, 0x00000008, 0x00e9e9e9,
+  0x00cbcbcb, 0x00707070, 0x003a3a3a, 0x000f0f0f, 0x00060606, 0x00020202, 0x00010101, 0x80000116,
+  0x00000000, 0x0000000c, 0x00010101, 0x00020202, 0x00030303, 0x00050505, 0x00070707, 0x00080808,
+  0x00323232, 0x00404040, 0x00858585, 0x00a1a1a1, 0x00d6d6d6, 0x00ececec, 0x8000004e, 0x00ffffff,
+  0x00000003, 0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x8000007b, 0x00000000, 0x00000005, 0x000f0f0f,
+  0x00252525, 0x009f9f9f, 0x00ededed, 0x00fcfcfc, 0x8000002a, 0x00ffffff, 0x00000006, 0x00fefefe,
+  0x00fdfdfd, 0x00b7b7b7, 0x00a6a6a6, 0x00343434, 0x00282828, 0x80000115, 0x00000000, 0x00000008,
+  0x00030303, 0x00151515, 0x00393939, 0x00636363, 0x00878787, 0x00c4c4c4, 0x00dadada, 0x00fdfdfd,
+  0x80000053, 0x00ffffff, 0x00000003, 0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x8000007b, 0x00000000,
+  0x00000006, 0x000c0c0c, 0x001c1c1c, 0x00838383, 0x00c5c5c5, 0x00f3f3f3, 0x00fefefe, 0x80000029,
+  0x00ffffff, 0x0000000a, 0x00fefefe, 0x00fdfdfd, 0x00c8c8c8, 0x00bababa, 0x00636363, 0x00575757,
+  0x002d2d2d, 0x00212121, 0x00111111, 0x00070707, 0x8000010b, 0x00000000, 0x0000000e, 0x00040404,
+  0x00070707, 0x00131313, 0x00181818, 0x00272727, 0x002b2b2b, 0x003a3a3a, 0x00494949, 0x00676767,
+  0x00878787, 0x00a3a3a3, 0x00d2d2d2, 0x00e3e3e3, 0x00fdfdfd, 0x80000053, 0x00ffffff, 0x00000003,
+  0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x8000007d, 0x00000000, 0x00000004, 0x00272727, 0x00404040,
+  0x00d7d7d7, 0x00fafafa, 0x8000002e, 0x00ffffff, 0x00000006, 0x00f0f0f0, 0x00bfbfbf, 0x008d8d8d,
+  0x004a4a4a, 0x001c1c1c, 0x00010101, 0x8000010a, 0x00000000, 0x00000008, 0x00101010, 0x001f1f1f,
+  0x00525252, 0x00656565, 0x00a7a7a7, 0x00b5b5b5, 0x00efefef, 0x00f4f4f4, 0x80000059, 0x00ffffff,
+  0x00000003, 0x00dfdfdf, 0x00a8a8a8, 0x00494949, 0x8000007d, 0x00000000, 0x00000006, 0x00161616,
+  0x00242424, 0x00989898, 0x00b4b4b4, 0x00fdfdfd, 0x00fdfdfd, 0x8000002c, 0x00ffffff, 0x0000000a,
+  0x00f7f7f7, 0x00dbdbdb, 0x00bebebe, 0x00989898, 0x00727272, 0x005c5c5c, 0x00323232, 0x00282828,
+  0x00030303, 0x00020202, 0x800000ff, 0x00000000, 0x0000000f, 0x00030303, 0x00050505, 0x001f1f1f,
+  0x00252525, 0x003f3f3f, 0x00494949, 0x005e5e5e, 0x00707070, 0x00808080, 0x009d9d9d, 0x00a8a8a8,
+  0x00cdcdcd, 0x00d5d5d5, 0x00f6f6f6, 0x00f9f9f9, 0x80000059, 0x00ffffff, 0x00000003, 0x00dadada,
+  0x009b9b9b, 0x00434343, 0x8000007f, 0x00000000, 0x00000004, 0x00464646, 0x00585858, 0x00fafafa,
+  0x00fbfbfb, 0x80000030, 0x00ffffff, 0x00000006, 0x00e4e4e4, 0x00d4d4d4, 0x00737373, 0x005d5d5d,
+  0x00060606, 0x00050505, 0x800000ff, 0x00000000, 0x00000008, 0x00080808, 0x000b0b0b, 0x00474747,
+  0x00555555, 0x00929292, 0x00a9a9a9, 0x00d9d9d9, 0x00ededed, 0x80000060, 0x00ffffff, 0x00000003,
+  0x00d4d4d4, 0x00898989, 0x003b3b3b, 0x8000007f, 0x00000000, 0x00000006, 0x001a1a1a, 0x00212121,
+  0x008a8a8a, 0x00a2a2a2, 0x00f9f9f9, 0x00fbfbfb, 0x8000002e, 0x00ffffff, 0x0000000a, 0x00f5f5f5,
+  0x00efefef, 0x00cccccc, 0x00c3c3c3, 0x00939393, 0x00828282, 0x004b4b4b, 0x00303030, 0x000d0d0d,
+  0x00050505, 0x800000f4, 0x00000000, 0x0000000f, 0x00010101, 0x00050505, 0x00202020, 0x002e2e2e,
+  0x004c4c4c, 0x00636363, 0x00797979, 0x00969696, 0x00a1a1a1, 0x00bbbbbb, 0x00c0c0c0, 0x00d7d7d7,
+  0x00dfdfdf, 0x00f1f1f1, 0x00f8f8f8, 0x8000005d, 0x00ffffff, 0x00000006, 0x00d6d6d6, 0x00c7c7c7,
+  0x00848484, 0x00666666, 0x00323232, 0x00161616, 0x80000080, 0x00000000, 0x00000005, 0x00010101,
+  0x00494949, 0x006e6e6e, 0x00f5f5f5, 0x00f9f9f9, 0x80000031, 0x00ffffff, 0x00000007, 0x00fefefe,
+  0x00e5e5e5, 0x00cbcbcb, 0x00767676, 0x004b4b4b, 0x00141414, 0x00070707, 0x800000f4, 0x00000000,
+  0x00000009, 0x00010101, 0x00070707, 0x00323232, 0x00494949, 0x00787878, 0x009d9d9d, 0x00bfbfbf,
+  0x00e9e9e9, 0x00f9f9f9, 0x80000063, 0x00ffffff, 0x00000004, 0x00bebebe, 0x00a7a7a7, 0x003c3c3c,
+  0x00262626, 0x80000083, 0x00000000, 0x00000006, 0x000c0c0c, 0x001d1d1d, 0x005a5a5a, 0x00999999,
+  0x00f2f2f2, 0x00fafafa, 0x80000030, 0x00ffffff, 0x0000000b, 0x00fbfbfb, 0x00f6f6f6, 0x00e8e8e8,
+  0x00dfdfdf, 0x00d4d4d4, 0x00adadad, 0x00969696, 0x00585858, 0x00494949, 0x00090909, 0x00070707,
+  0x800000e9, 0x00000000, 0x0000000f, 0x000a0a0a, 0x00202020, 0x00393939, 0x00515151, 0x00797979,
+  0x00898989, 0x00bebebe, 0x00c6c6c6, 0x00dcdcdc, 0x00e0e0e0, 0x00e8e8e8, 0x00eeeeee, 0x00f4f4f4,
+  0x00fbfbfb, 0x00fefefe, 0x8000005f, 0x00ffffff, 0x00000008, 0x00e0e0e0, 0x00c7c7c7, 0x00767676,
+  0x005d5d5d, 0x00222222, 0x001c1c1c, 0x000a0a0a, 0x00060606, 0x80000084, 0x00000000, 0x00000006,
+  0x000c0c0c, 0x00393939, 0x00828282, 0x00e9e9e9, 0x00f6f6f6, 0x00fefefe, 0x80000032, 0x00ffffff,
+  0x0000000c, 0x00fdfdfd, 0x00fbfbfb, 0x00d0d0d0, 0x00b7b7b7, 0x006e6e6e, 0x005d5d5d, 0x00121212,
+  0x000f0f0f, 0x00050505, 0x00040404, 0x00020202, 0x00010101, 0x800000de, 0x00000000, 0x0000000f,
+  0x00010101, 0x00020202, 0x00030303, 0x00040404, 0x00050505, 0x00060606, 0x00070707, 0x00131313,
+  0x002c2c2c, 0x004a4a4a, 0x00666666, 0x00959595, 0x00a8a8a8, 0x00e6e6e6, 0x00ededed, 0x80000063,
+  0x00ffffff, 0x00000008, 0x00fdfdfd, 0x00fcfcfc, 0x00f9f9f9, 0x00d4d4d4, 0x00b6b6b6, 0x00585858,
+  0x003a3a3a, 0x00020202, 0x80000089, 0x00000000, 0x00000005, 0x00131313, 0x002f2f2f, 0x00a1a1a1,
+  0x00e8e8e8, 0x00fbfbfb, 0x80000037, 0x00ffffff, 0x00000008, 0x00f5f5f5, 0x00e3e3e3, 0x00a7a7a7,
+  0x007f7f7f, 0x004c4c4c, 0x001f1f1f, 0x00050505, 0x00010101, 0x800000da, 0x00000000, 0x0000000a,
+  0x00030303, 0x000a0a0a, 0x00262626, 0x003f3f3f, 0x00696969, 0x00797979, 0x00adadad, 0x00b9b9b9,
+  0x00ececec, 0x00f2f2f2, 0x80000069, 0x00ffffff, 0x00000005, 0x00f4f4f4, 0x00bcbcbc, 0x008e8e8e,
+  0x003c3c3c, 0x001a1a1a, 0x8000008d, 0x00000000, 0x00000006, 0x000f0f0f, 0x00242424, 0x00818181,
+  0x00bbbbbb, 0x00ededed, 0x00f8f8f8, 0x80000036, 0x00ffffff, 0x0000000d, 0x00f7f7f7, 0x00e9e9e9,
+  0x00bbbbbb, 0x009c9c9c, 0x00757575, 0x004f4f4f, 0x003a3a3a, 0x00272727, 0x00222222, 0x000e0e0e,
+  0x000b0b0b, 0x00010101, 0x00010101, 0x800000ce, 0x00000000, 0x00000011, 0x00030303, 0x00070707,
+  0x00101010, 0x00141414, 0x00202020, 0x00232323, 0x002e2e2e, 0x00343434, 0x00414141, 0x00575757,
+  0x006b6b6b, 0x008b8b8b, 0x00989898, 0x00c0c0c0, 0x00c9c9c9, 0x00f0f0f0, 0x00f5f5f5, 0x80000066,
+  0x00ffffff, 0x00000008, 0x00f3f3f3, 0x00f0f0f0, 0x00d4d4d4, 0x00c8c8c8, 0x00919191, 0x006d6d6d,
+  0x002e2e2e, 0x00141414, 0x8000008f, 0x00000000, 0x00000004, 0x00161616, 0x00242424, 0x00bdbdbd,
+  0x00e0e0e0, 0x8000003b, 0x00ffffff, 0x00000008, 0x00f4f4f4, 0x00ededed, 0x00a6a6a6, 0x00949494,
+  0x003f3f3f, 0x00313131, 0x00040404, 0x00020202, 0x800000ce, 0x00000000, 0x0000000a, 0x000f0f0f,
+  0x001d1d1d, 0x00474747, 0x00575757, 0x008c8c8c, 0x00989898, 0x00cbcbcb, 0x00dadada, 0x00fbfbfb,
+  0x00fdfdfd, 0x8000006d, 0x00ffffff, 0x00000004, 0x00cccccc, 0x00bcbcbc, 0x00414141, 0x00323232,
+  0x80000093, 0x00000000, 0x00000006, 0x000d0d0d, 0x00151515, 0x00757575, 0x008d8d8d, 0x00ededed,
+  0x00f1f1f1, 0x80000039, 0x00ffffff, 0x0000000f, 0x00f8f8f8, 0x00f5f5f5, 0x00cccccc, 0x00c2c2c2,
+  0x00919191, 0x00888888, 0x006a6a6a, 0x005e5e5e, 0x004e4e4e, 0x003b3b3b, 0x00313131, 0x00191919,
+  0x00141414, 0x00010101, 0x00010101, 0x800000be, 0x00000000, 0x00000013, 0x00020202, 0x00030303,
+  0x00111111, 0x00171717, 0x002d2d2d, 0x00323232, 0x00484848, 0x00505050, 0x00616161, 0x00707070,
+  0x007e7e7e, 0x00959595, 0x009f9f9f, 0x00bdbdbd, 0x00c4c4c4, 0x00e1e1e1, 0x00eaeaea, 0x00fdfdfd,
+  0x00fefefe, 0x80000069, 0x00ffffff, 0x00000008, 0x00f5f5f5, 0x00e2e2e2, 0x00c4c4c4, 0x00acacac,
+  0x007b7b7b, 0x006c6c6c, 0x00252525, 0x001d1d1d, 0x80000095, 0x00000000, 0x00000004, 0x00161616,
+  0x001e1e1e, 0x00d5d5d5, 0x00dedede, 0x8000003e, 0x00ffffff, 0x0000000a, 0x00fcfcfc, 0x00f3f3f3,
+  0x00d8d8d8, 0x00b6b6b6, 0x008b8b8b, 0x00737373, 0x003b3b3b, 0x002f2f2f, 0x00020202, 0x00020202,
+  0x800000be, 0x00000000, 0x0000000a, 0x00040404, 0x00070707, 0x00282828, 0x00353535, 0x006a6a6a,
+  0x00767676, 0x00a9a9a9, 0x00bbbbbb, 0x00e3e3e3, 0x00f1f1f1, 0x80000072, 0x00ffffff, 0x00000005,
+  0x00e7e7e7, 0x00bcbcbc, 0x00747474, 0x003c3c3c, 0x000e0e0e, 0x80000098, 0x00000000, 0x00000006,
+  0x00080808, 0x000b0b0b, 0x00585858, 0x00707070, 0x00c8c8c8, 0x00dfdfdf, 0x8000003c, 0x00ffffff,
+  0x00000010, 0x00fefefe, 0x00fbfbfb, 0x00f0f0f0, 0x00e4e4e4, 0x00d4d4d4, 0x00cbcbcb, 0x00b6b6b6,
+  0x00b1b1b1, 0x00959595, 0x008b8b8b, 0x006c6c6c, 0x005a5a5a, 0x00434343, 0x00282828, 0x001a1a1a,
+  0x00040404, 0x800000ae, 0x00000000, 0x00000014, 0x00010101, 0x000b0b0b, 0x00151515, 0x00292929,
+  0x00323232, 0x004b4b4b, 0x00515151, 0x006a6a6a, 0x00737373, 0x00868686, 0x00949494, 0x00a1a1a1,
+  0x00aeaeae, 0x00b4b4b4, 0x00c7c7c7, 0x00cccccc, 0x00dfdfdf, 0x00e6e6e6, 0x00f5f5f5, 0x00fafafa,
+  0x8000006d, 0x00ffffff, 0x0000000a, 0x00fefefe, 0x00fdfdfd, 0x00cecece, 0x00c1c1c1, 0x00848484,
+  0x006e6e6e, 0x00464646, 0x002b2b2b, 0x00161616, 0x00050505, 0x8000009a, 0x00000000, 0x00000004,
+  0x000e0e0e, 0x002f2f2f, 0x00a7a7a7, 0x00cccccc, 0x80000043, 0x00ffffff, 0x00000009, 0x00fefefe,
+  0x00ededed, 0x00dddddd, 0x00adadad, 0x00909090, 0x006b6b6b, 0x00404040, 0x00292929, 0x00060606,
+  0x800000ae, 0x00000000, 0x0000000d, 0x00010101, 0x00121212, 0x00222222, 0x00424242, 0x004f4f4f,
+  0x00787878, 0x00818181, 0x00a9a9a9, 0x00b7b7b7, 0x00d6d6d6, 0x00eaeaea, 0x00fcfcfc, 0x00fefefe,
+  0x80000074, 0x00ffffff, 0x00000006, 0x00fdfdfd, 0x00fcfcfc, 0x00b1b1b1, 0x009c9c9c, 0x003b3b3b,
+  0x00262626, 0x8000009e, 0x00000000, 0x00000008, 0x00020202, 0x00080808, 0x001d1d1d, 0x00454545,
+  0x007d7d7d, 0x00c8c8c8, 0x00f7f7f7, 0x00fefefe, 0x80000040, 0x00ffffff, 0x00000011, 0x00fcfcfc,
+  0x00f9f9f9, 0x00f1f1f1, 0x00ececec, 0x00e5e5e5, 0x00dedede, 0x00dadada, 0x00c2c2c2, 0x00bcbcbc,
+  0x008f8f8f, 0x00858585, 0x00666666, 0x00545454, 0x003e3e3e, 0x00242424, 0x00151515, 0x00030303,
+  0x8000009b, 0x00000000, 0x00000016, 0x00050505, 0x00111111, 0x00242424, 0x00373737, 0x00515151,
+  0x005c5c5c, 0x007d7d7d, 0x00858585, 0x00a6a6a6, 0x00b1b1b1, 0x00cacaca, 0x00d1d1d1, 0x00d9d9d9,
+  0x00dedede, 0x00e0e0e0, 0x00e7e7e7, 0x00e9e9e9, 0x00f0f0f0, 0x00f2f2f2, 0x00f8f8f8, 0x00fbfbfb,
+  0x00fefefe, 0x80000071, 0x00ffffff, 0x0000000a, 0x00f9f9f9, 0x00ededed, 0x00bebebe, 0x00999999,
+  0x00595959, 0x00444444, 0x00202020, 0x001b1b1b, 0x000a0a0a, 0x00070707, 0x800000a1, 0x00000000,
+  0x00000006, 0x00282828, 0x00606060, 0x00b9b9b9, 0x00f0f0f0, 0x00fbfbfb, 0x00fefefe, 0x80000046,
+  0x00ffffff, 0x00000012, 0x00eaeaea, 0x00e4e4e4, 0x00afafaf, 0x00a3a3a3, 0x007f7f7f, 0x006a6a6a,
+  0x004f4f4f, 0x00313131, 0x00202020, 0x000a0a0a, 0x00060606, 0x00050505, 0x00040404, 0x00030303,
+  0x00030303, 0x00020202, 0x00010101, 0x00010101, 0x80000088, 0x00000000, 0x80000003, 0x00010101,
+  0x00000014, 0x00020202, 0x00020202, 0x00030303, 0x00030303, 0x00040404, 0x00050505, 0x00050505,
+  0x00060606, 0x000c0c0c, 0x001b1b1b, 0x00313131, 0x00474747, 0x00666666, 0x00737373, 0x009a9a9a,
+  0x00a3a3a3, 0x00cacaca, 0x00d7d7d7, 0x00f4f4f4, 0x00fafafa, 0x80000078, 0x00ffffff, 0x0000000a,
+  0x00fefefe, 0x00fdfdfd, 0x00fbfbfb, 0x00f3f3f3, 0x00e3e3e3, 0x00adadad, 0x00818181, 0x00353535,
+  0x001c1c1c, 0x00010101, 0x800000a6, 0x00000000, 0x00000004, 0x00191919, 0x00282828, 0x00b2b2b2,
+  0x00d2d2d2, 0x8000004f, 0x00ffffff, 0x0000000b, 0x00ececec, 0x00e7e7e7, 0x00b8b8b8, 0x00acacac,
+  0x00878787, 0x00717171, 0x00565656, 0x00363636, 0x00252525, 0x00060606, 0x00010101, 0x80000085,
+  0x00000000, 0x0000000d, 0x00111111, 0x00161616, 0x00323232, 0x003c3c3c, 0x00525252, 0x00626262,
+  0x00717171, 0x00888888, 0x00919191, 0x00b7b7b7, 0x00c0c0c0, 0x00e8e8e8, 0x00efefef, 0x80000083,
+  0x00ffffff, 0x00000006, 0x00c9c9c9, 0x00b5b5b5, 0x005a5a5a, 0x003c3c3c, 0x00060606, 0x00030303,
+  0x800000aa, 0x00000000, 0x00000006, 0x00131313, 0x001f1f1f, 0x008c8c8c, 0x00a5a5a5, 0x00e7e7e7,
+  0x00ececec, 0x8000004d, 0x00ffffff, 0x00000018, 0x00f1f1f1, 0x00ececec, 0x00c8c8c8, 0x00bebebe,
+  0x00a2a2a2, 0x00919191, 0x007c7c7c, 0x00636363, 0x00565656, 0x003c3c3c, 0x00373737, 0x002e2e2e,
+  0x002c2c2c, 0x00272727, 0x00242424, 0x00202020, 0x001b1b1b, 0x00181818, 0x00121212, 0x00101010,
+  0x00090909, 0x00080808, 0x00020202, 0x00010101, 0x80000069, 0x00000000, 0x0000001c, 0x00020202,
+  0x00050505, 0x00090909, 0x000c0c0c, 0x00111111, 0x00131313, 0x001a1a1a, 0x001b1b1b, 0x00212121,
+  0x00242424, 0x00292929, 0x002c2c2c, 0x002f2f2f, 0x00343434, 0x00363636, 0x00464646, 0x004a4a4a,
+  0x00606060, 0x00676767, 0x00797979, 0x00858585, 0x00919191, 0x00a2a2a2, 0x00aaaaaa, 0x00c7c7c7,
+  0x00cecece, 0x00ededed, 0x00f3f3f3, 0x8000007d, 0x00ffffff, 0x0000000c, 0x00fefefe, 0x00fdfdfd,
+  0x00f2f2f2, 0x00e9e9e9, 0x00d7d7d7, 0x00d1d1d1, 0x009c9c9c, 0x008d8d8d, 0x00464646, 0x002f2f2f,
+  0x00050505, 0x00020202, 0x800000ac, 0x00000000, 0x00000004, 0x00070707, 0x000b0b0b, 0x00949494,
+  0x00acacac, 0x80000056, 0x00ffffff, 0x0000000f, 0x00f5f5f5, 0x00f1f1f1, 0x00cfcfcf, 0x00c7c7c7,
+  0x00aeaeae, 0x009f9f9f, 0x008d8d8d, 0x00777777, 0x006c6c6c, 0x00505050, 0x00494949, 0x002a2a2a,
+  0x00222222, 0x000a0a0a, 0x00050505, 0x80000068, 0x00000000, 0x00000011, 0x00010101, 0x00080808,
+  0x00171717, 0x00272727, 0x00373737, 0x004d4d4d, 0x00565656, 0x00737373, 0x00797979, 0x00959595,
+  0x009f9f9f, 0x00b5b5b5, 0x00c5c5c5, 0x00d4d4d4, 0x00eaeaea, 0x00f3f3f3, 0x00fefefe, 0x80000089,
+  0x00ffffff, 0x00000007, 0x00fcfcfc, 0x00f6f6f6, 0x00c4c4c4, 0x009c9c9c, 0x004b4b4b, 0x00313131,
+  0x00020202, 0x800000b1, 0x00000000, 0x00000008, 0x00040404, 0x00060606, 0x00555555, 0x006a6a6a,
+  0x00b5b5b5, 0x00d1d1d1, 0x00f7f7f7, 0x00fcfcfc, 0x80000052, 0x00ffffff, 0x00000023, 0x00f9f9f9,
+  0x00f7f7f7, 0x00e3e3e3, 0x00dedede, 0x00d0d0d0, 0x00c8c8c8, 0x00bdbdbd, 0x00b1b1b1, 0x00aaaaaa,
+  0x009a9a9a, 0x00969696, 0x00848484, 0x007f7f7f, 0x00727272, 0x006b6b6b, 0x00636363, 0x00595959,
+  0x00555555, 0x00494949, 0x00464646, 0x003c3c3c, 0x00393939, 0x00333333, 0x002f2f2f, 0x002b2b2b,
+  0x00262626, 0x00232323, 0x001c1c1c, 0x001a1a1a, 0x00121212, 0x00101010, 0x000a0a0a, 0x00060606,
+  0x00020202, 0x00010101, 0x80000039, 0x00000000, 0x0000002c, 0x00020202, 0x00040404, 0x00080808,
+  0x000b0b0b, 0x000f0f0f, 0x00131313, 0x00151515, 0x001b1b1b, 0x001c1c1c, 0x00222222, 0x00242424,
+  0x00292929, 0x002c2c2c, 0x002f2f2f, 0x00343434, 0x00363636, 0x003c3c3c, 0x003d3d3d, 0x00434343,
+  0x00454545, 0x004a4a4a, 0x004d4d4d, 0x00505050, 0x00555555, 0x00575757, 0x005d5d5d, 0x005f5f5f,
+  0x00696969, 0x006e6e6e, 0x00797979, 0x00828282, 0x008c8c8c, 0x00989898, 0x009d9d9d, 0x00aeaeae,
+  0x00b2b2b2, 0x00c2c2c2, 0x00c7c7c7, 0x00d4d4d4, 0x00dddddd, 0x00e6e6e6, 0x00f3f3f3, 0x00f8f8f8,
+  0x00fefefe, 0x80000086, 0x00ffffff, 0x0000000a, 0x00f1f1f1, 0x00e9e9e9, 0x00c3c3c3, 0x00b3b3b3,
+  0x00959595, 0x00747474, 0x005a5a5a, 0x002c2c2c, 0x001c1c1c, 0x00010101, 0x800000b4, 0x00000000,
+  0x00000005, 0x00121212, 0x00505050, 0x00929292, 0x00ededed, 0x00f8f8f8, 0x80000060, 0x00ffffff,
+  0x00000015, 0x00f5f5f5, 0x00e9e9e9, 0x00d3d3d3, 0x00c8c8c8, 0x00acacac, 0x00a5a5a5, 0x008d8d8d,
+  0x00888888, 0x00797979, 0x00707070, 0x00666666, 0x00595959, 0x00525252, 0x00424242, 0x003e3e3e,
+  0x002b2b2b, 0x00262626, 0x00171717, 0x000e0e0e, 0x00040404, 0x00010101, 0x80000039, 0x00000000,
+  0x0000001d, 0x00040404, 0x00080808, 0x00131313, 0x001b1b1b, 0x00232323, 0x002d2d2d, 0x00323232,
+  0x00404040, 0x00434343, 0x00515151, 0x00565656, 0x00616161, 0x00686868, 0x00707070, 0x007a7a7a,
+  0x007f7f7f, 0x008d8d8d, 0x00909090, 0x009e9e9e, 0x00a3a3a3, 0x00aeaeae, 0x00b5b5b5, 0x00bdbdbd,
+  0x00c8c8c8, 0x00cdcdcd, 0x00dbdbdb, 0x00dfdfdf, 0x00f7f7f7, 0x00f9f9f9, 0x80000095, 0x00ffffff,
+  0x00000006, 0x00dedede, 0x00cccccc, 0x00727272, 0x00505050, 0x00111111, 0x00080808, 0x800000b8,
+  0x00000000, 0x00000007, 0x00070707, 0x001e1e1e, 0x003e3e3e, 0x006a6a6a, 0x00a4a4a4, 0x00c8c8c8,
+  0x00f5f5f5, 0x8000005e, 0x00ffffff, 0x0000003e, 0x00fbfbfb, 0x00f7f7f7, 0x00eeeeee, 0x00eaeaea,
+  0x00dfdfdf, 0x00dddddd, 0x00d4d4d4, 0x00d2d2d2, 0x00cccccc, 0x00c9c9c9, 0x00c5c5c5, 0x00c0c0c0,
+  0x00bebebe, 0x00b7b7b7, 0x00b6b6b6, 0x00afafaf, 0x00adadad, 0x00a7a7a7, 0x00a4a4a4, 0x00a0a0a0,
+  0x00999999, 0x00959595, 0x008a8a8a, 0x00888888, 0x007e7e7e, 0x007d7d7d, 0x007b7b7b, 0x007a7a7a,
+  0x00797979, 0x00777777, 0x00777777, 0x00757575, 0x00757575, 0x00737373, 0x00737373, 0x00717171,
+  0x00707070, 0x006f6f6f, 0x006e6e6e, 0x006d6d6d, 0x006c6c6c, 0x006b6b6b, 0x006a6a6a, 0x00696969,
+  0x00686868, 0x00686868, 0x00676767, 0x00656565, 0x00656565, 0x00636363, 0x00636363, 0x00616161,
+  0x00606060, 0x005f5f5f, 0x005e5e5e, 0x005d5d5d, 0x005c5c5c, 0x005b5b5b, 0x005a5a5a, 0x00595959,
+  0x00585858, 0x00575757, 0x80000003, 0x00565656, 0x0000002a, 0x005c5c5c, 0x005f5f5f, 0x00676767,
+  0x00696969, 0x00727272, 0x00747474, 0x007b7b7b, 0x00808080, 0x00858585, 0x008b8b8b, 0x008e8e8e,
+  0x00979797, 0x00999999, 0x00a0a0a0, 0x00a2a2a2, 0x00a6a6a6, 0x00a9a9a9, 0x00acacac, 0x00b0b0b0,
+  0x00b1b1b1, 0x00b7b7b7, 0x00b8b8b8, 0x00bdbdbd, 0x00bfbfbf, 0x00c3c3c3, 0x00c6c6c6, 0x00c9c9c9,
+  0x00cdcdcd, 0x00cfcfcf, 0x00d4d4d4, 0x00d5d5d5, 0x00dadada, 0x00dcdcdc, 0x00e0e0e0, 0x00e3e3e3,
+  0x00e6e6e6, 0x00eaeaea, 0x00ececec, 0x00f2f2f2, 0x00f3f3f3, 0x00fcfcfc, 0x00fdfdfd, 0x8000008f,
+  0x00ffffff, 0x0000000c, 0x00fefefe, 0x00fbfbfb, 0x00e2e2e2, 0x00cecece, 0x009d9d9d, 0x008d8d8d,
+  0x00575757, 0x004e4e4e, 0x002b2b2b, 0x001e1e1e, 0x00060606, 0x00030303, 0x800000ba, 0x00000000,
+  0x00000005, 0x000b0b0b, 0x001a1a1a, 0x00717171, 0x00a6a6a6, 0x00efefef, 0x80000072, 0x00ffffff,
+  0x0000002a, 0x00f5f5f5, 0x00f0f0f0, 0x00dfdfdf, 0x00dbdbdb, 0x00cacaca, 0x00c9c9c9, 0x00c5c5c5,
+  0x00c4c4c4, 0x00c2c2c2, 0x00c0c0c0, 0x00bfbfbf, 0x00bcbcbc, 0x00bcbcbc, 0x00b9b9b9, 0x00b8b8b8,
+  0x00b6b6b6, 0x00b5b5b5, 0x00b3b3b3, 0x00b1b1b1, 0x00b0b0b0, 0x00adadad, 0x00adadad, 0x00aaaaaa,
+  0x00a9a9a9, 0x00a8a8a8, 0x00a7a7a7, 0x00a5a5a5, 0x00a3a3a3, 0x00a2a2a2, 0x009f9f9f, 0x009f9f9f,
+  0x009c9c9c, 0x009b9b9b, 0x00999999, 0x00989898, 0x00969696, 0x00949494, 0x00939393, 0x00909090,
+  0x00909090, 0x008d8d8d, 0x008c8c8c, 0x80000003, 0x008a8a8a, 0x0000000d, 0x00949494, 0x00989898,
+  0x00a5a5a5, 0x00a8a8a8, 0x00b7b7b7, 0x00bbbbbb, 0x00c6c6c6, 0x00cecece, 0x00d6d6d6, 0x00e0e0e0,
+  0x00e5e5e5, 0x00f3f3f3, 0x00f6f6f6, 0x800000ac, 0x00ffffff, 0x00000008, 0x00fdfdfd, 0x00f9f9f9,
+  0x00d1d1d1, 0x00b0b0b0, 0x00626262, 0x00484848, 0x00050505, 0x00010101, 0x800000be, 0x00000000,
+  0x00000008, 0x00020202, 0x00050505, 0x00141414, 0x001e1e1e, 0x00545454, 0x00636363, 0x00d8d8d8,
+  0x00e0e0e0, 0x8000006f, 0x00ffffff, 0x00000007, 0x00fdfdfd, 0x00fcfcfc, 0x00f9f9f9, 0x00f9f9f9,
+  0x00f6f6f6, 0x00f5f5f5, 0x00f5f5f5, 0x80000004, 0x00f4f4f4, 0x00000002, 0x00f3f3f3, 0x00f3f3f3,
+  0x80000004, 0x00f2f2f2, 0x80000003, 0x00f1f1f1, 0x80000004, 0x00f0f0f0, 0x80000004, 0x00efefef,
+  0x80000003, 0x00eeeeee, 0x80000003, 0x00ededed, 0x80000004, 0x00ececec, 0x80000003, 0x00ebebeb,
+  0x80000004, 0x00eaeaea, 0x0000000d, 0x00ececec, 0x00ededed, 0x00efefef, 0x00efefef, 0x00f2f2f2,
+  0x00f3f3f3, 0x00f5f5f5, 0x00f6f6f6, 0x00f8f8f8, 0x00f9f9f9, 0x00fafafa, 0x00fdfdfd, 0x00fdfdfd,
+  0x800000a7, 0x00ffffff, 0x0000000c, 0x00fefefe, 0x00fefefe, 0x00cecece, 0x00c0c0c0, 0x00818181,
+  0x00686868, 0x003b3b3b, 0x002c2c2c, 0x00202020, 0x00121212, 0x000d0d0d, 0x00010101, 0x800000c3,
+  0x00000000, 0x00000006, 0x00313131, 0x003f3f3f, 0x00cbcbcb, 0x00d6d6d6, 0x00fcfcfc, 0x00fdfdfd,
+  0x8000014b, 0x00ffffff, 0x0000000b, 0x00fefefe, 0x00fdfdfd, 0x00fcfcfc, 0x00fafafa, 0x00fafafa,
+  0x00bfbfbf, 0x00afafaf, 0x00636363, 0x00464646, 0x00111111, 0x00080808, 0x800000c9, 0x00000000,
+  0x00000006, 0x00020202, 0x00191919, 0x00686868, 0x00a0a0a0, 0x00ececec, 0x00f8f8f8, 0x80000148,
+  0x00ffffff, 0x00000007, 0x00eeeeee, 0x00cfcfcf, 0x009e9e9e, 0x00757575, 0x00333333, 0x001c1c1c,
+  0x00010101, 0x800000ce, 0x00000000, 0x00000009, 0x00020202, 0x00131313, 0x00515151, 0x007f7f7f,
+  0x00bcbcbc, 0x00d7d7d7, 0x00e8e8e8, 0x00fafafa, 0x00fefefe, 0x80000140, 0x00ffffff, 0x0000000c,
+  0x00f9f9f9, 0x00f8f8f8, 0x00e5e5e5, 0x00e1e1e1, 0x00d0d0d0, 0x00c0c0c0, 0x00a2a2a2, 0x007b7b7b,
+  0x005b5b5b, 0x00272727, 0x00161616, 0x00010101, 0x800000d1, 0x00000000, 0x00000006, 0x00080808,
+  0x00121212, 0x00636363, 0x00949494, 0x00eaeaea, 0x00fcfcfc, 0x80000140, 0x00ffffff, 0x00000006,
+  0x00e6e6e6, 0x00dddddd, 0x00898989, 0x00777777, 0x00292929, 0x001b1b1b, 0x800000d7, 0x00000000,
+  0x00000008, 0x00040404, 0x000a0a0a, 0x003a3a3a, 0x00565656, 0x00989898, 0x00a8a8a8, 0x00e4e4e4,
+  0x00eaeaea, 0x80000138, 0x00ffffff, 0x0000000c, 0x00fefefe, 0x00f6f6f6, 0x00eaeaea, 0x00d2d2d2,
+  0x00bdbdbd, 0x00acacac, 0x008c8c8c, 0x00818181, 0x00505050, 0x00454545, 0x00181818, 0x00101010,
+  0x800000db, 0x00000000, 0x00000004, 0x00262626, 0x00323232, 0x00bebebe, 0x00cdcdcd, 0x80000138,
+  0x00ffffff, 0x00000007, 0x00fcfcfc, 0x00e9e9e9, 0x00cccccc, 0x00939393, 0x00626262, 0x00393939,
+  0x000f0f0f, 0x800000e0, 0x00000000, 0x00000009, 0x000f0f0f, 0x00131313, 0x00494949, 0x00575757,
+  0x00878787, 0x00a6a6a6, 0x00d0d0d0, 0x00ededed, 0x00fefefe, 0x8000012e, 0x00ffffff, 0x0000000c,
+  0x00f4f4f4, 0x00ebebeb, 0x00c9c9c9, 0x00bcbcbc, 0x008f8f8f, 0x00858585, 0x005c5c5c, 0x00505050,
+  0x00383838, 0x00262626, 0x00161616, 0x00060606, 0x800000e3, 0x00000000, 0x00000006, 0x000e0e0e,
+  0x003c3c3c, 0x006f6f6f, 0x00b3b3b3, 0x00e2e2e2, 0x00fefefe, 0x8000012e, 0x00ffffff, 0x00000008,
+  0x00eeeeee, 0x00dfdfdf, 0x00a7a7a7, 0x00939393, 0x004a4a4a, 0x003c3c3c, 0x00040404, 0x00030303,
+  0x800000e7, 0x00000000, 0x0000000a, 0x00030303, 0x000b0b0b, 0x00141414, 0x00212121, 0x00404040,
+  0x00525252, 0x00a2a2a2, 0x00b4b4b4, 0x00fbfbfb, 0x00fcfcfc, 0x80000123, 0x00ffffff, 0x0000000e,
+  0x00fefefe, 0x00fdfdfd, 0x00d2d2d2, 0x00c6c6c6, 0x00919191, 0x007c7c7c, 0x00525252, 0x003c3c3c,
+  0x00292929, 0x001f1f1f, 0x001b1b1b, 0x000e0e0e, 0x000b0b0b, 0x00010101, 0x800000ec, 0x00000000,
+  0x00000008, 0x001b1b1b, 0x002a2a2a, 0x008b8b8b, 0x00a1a1a1, 0x00f7f7f7, 0x00f8f8f8, 0x00fdfdfd,
+  0x00fefefe, 0x8000011d, 0x00ffffff, 0x0000000c, 0x00fefefe, 0x00fefefe, 0x00fdfdfd, 0x00fdfdfd,
+  0x00fafafa, 0x00fafafa, 0x00c5c5c5, 0x00b7b7b7, 0x00767676, 0x005d5d5d, 0x002a2a2a, 0x00141414,
+  0x800000f5, 0x00000000, 0x00000007, 0x00010101, 0x001d1d1d, 0x00373737, 0x008e8e8e, 0x00bababa,
+  0x00f3f3f3, 0x00fbfbfb, 0x80000119, 0x00ffffff, 0x00000009, 0x00fdfdfd, 0x00f0f0f0, 0x00d8d8d8,
+  0x00a9a9a9, 0x00808080, 0x005d5d5d, 0x00262626, 0x00131313, 0x00010101, 0x800000fa, 0x00000000,
+  0x0000000a, 0x00010101, 0x00171717, 0x002b2b2b, 0x00707070, 0x00939393, 0x00c3c3c3, 0x00d7d7d7,
+  0x00e3e3e3, 0x00f7f7f7, 0x00fbfbfb, 0x80000111, 0x00ffffff, 0x0000000e, 0x00fbfbfb, 0x00f7f7f7,
+  0x00ebebeb, 0x00e7e7e7, 0x00d7d7d7, 0x00d3d3d3, 0x00bebebe, 0x00ababab, 0x00858585, 0x00656565,
+  0x00494949, 0x001e1e1e, 0x000f0f0f, 0x00010101, 0x800000fe, 0x00000000, 0x00000006, 0x00070707,
+  0x00111111, 0x00555555, 0x007c7c7c, 0x00d8d8d8, 0x00ebebeb, 0x80000111, 0x00ffffff, 0x00000008,
+  0x00ebebeb, 0x00dadada, 0x00a2a2a2, 0x008e8e8e, 0x00464646, 0x00393939, 0x00050505, 0x00030303,
+  0x80000104, 0x00000000, 0x0000000c, 0x00040404, 0x000a0a0a, 0x00323232, 0x00494949, 0x00818181,
+  0x008d8d8d, 0x00b7b7b7, 0x00c0c0c0, 0x00dddddd, 0x00ebebeb, 0x00fdfdfd, 0x00fefefe, 0x80000104,
+  0x00ffffff, 0x0000000f, 0x00f9f9f9, 0x00f6f6f6, 0x00dedede, 0x00d9d9d9, 0x00c2c2c2, 0x00b8b8b8,
+  0x00a5a5a5, 0x00919191, 0x00808080, 0x005f5f5f, 0x00535353, 0x00292929, 0x00212121, 0x00030303,
+  0x00020202, 0x80000108, 0x00000000, 0x00000008, 0x00050505, 0x00080808, 0x00505050, 0x00666666,
+  0x00adadad, 0x00cecece, 0x00f9f9f9, 0x00fdfdfd, 0x80000104, 0x00ffffff, 0x00000008, 0x00f0f0f0,
+  0x00eaeaea, 0x00afafaf, 0x00a3a3a3, 0x006b6b6b, 0x00545454, 0x00262626, 0x00121212, 0x8000010f,
+  0x00000000, 0x0000000b, 0x00020202, 0x00030303, 0x001f1f1f, 0x00272727, 0x00434343, 0x00545454,
+  0x006b6b6b, 0x008e8e8e, 0x00a3a3a3, 0x00d2d2d2, 0x00dddddd, 0x800000fa, 0x00ffffff, 0x0000000f,
+  0x00f3f3f3, 0x00ededed, 0x00cccccc, 0x00bfbfbf, 0x00a4a4a4, 0x00909090, 0x007d7d7d, 0x00656565,
+  0x005b5b5b, 0x00444444, 0x003f3f3f, 0x002a2a2a, 0x00212121, 0x000f0f0f, 0x00070707, 0x80000114,
+  0x00000000, 0x00000006, 0x00070707, 0x00111111, 0x00484848, 0x00686868, 0x00b6b6b6, 0x00c7c7c7,
+  0x800000fa, 0x00ffffff, 0x00000009, 0x00ececec, 0x00e2e2e2, 0x00ababab, 0x00969696, 0x006b6b6b,
+  0x00494949, 0x002b2b2b, 0x000c0c0c, 0x00010101, 0x8000011a, 0x00000000, 0x0000000c, 0x00010101,
+  0x00030303, 0x000e0e0e, 0x00141414, 0x00222222, 0x00272727, 0x004d4d4d, 0x005e5e5e, 0x00989898,
+  0x00b9b9b9, 0x00e3e3e3, 0x00f5f5f5, 0x800000ec, 0x00ffffff, 0x00000010, 0x00fdfdfd, 0x00ededed,
+  0x00dddddd, 0x00bababa, 0x009f9f9f, 0x00868686, 0x00606060, 0x00525252, 0x002f2f2f, 0x002b2b2b,
+  0x00202020, 0x001c1c1c, 0x00141414, 0x000e0e0e, 0x00080808, 0x00020202, 0x80000120, 0x00000000,
+  0x0000000a, 0x00010101, 0x00232323, 0x00383838, 0x007f7f7f, 0x00a7a7a7, 0x00dadada, 0x00f0f0f0,
+  0x00fdfdfd, 0x00fefefe, 0x00fefefe, 0x800000e4, 0x00ffffff, 0x80000004, 0x00fefefe, 0x0000000a,
+  0x00fdfdfd, 0x00fafafa, 0x00e7e7e7, 0x00d2d2d2, 0x00a8a8a8, 0x00878787, 0x00696969, 0x003b3b3b,
+  0x002a2a2a, 0x00030303, 0x8000012d, 0x00000000, 0x00000006, 0x00252525, 0x003a3a3a, 0x00828282,
+  0x00939393, 0x00d8d8d8, 0x00e1e1e1, 0x800000e0, 0x00ffffff, 0x00000008, 0x00f5f5f5, 0x00e0e0e0,
+  0x00c3c3c3, 0x00a9a9a9, 0x007b7b7b, 0x006a6a6a, 0x002f2f2f, 0x00252525, 0x80000135, 0x00000000,
+  0x0000000d, 0x001d1d1d, 0x002e2e2e, 0x00676767, 0x00747474, 0x00ababab, 0x00b4b4b4, 0x00d0d0d0,
+  0x00d7d7d7, 0x00dfdfdf, 0x00e9e9e9, 0x00eeeeee, 0x00fafafa, 0x00fcfcfc, 0x800000d0, 0x00ffffff,
+  0x00000011, 0x00fefefe, 0x00fbfbfb, 0x00f5f5f5, 0x00f0f0f0, 0x00e8e8e8, 0x00e4e4e4, 0x00dadada,
+  0x00d8d8d8, 0x00cecece, 0x00c5c5c5, 0x00b1b1b1, 0x009a9a9a, 0x00868686, 0x00626262, 0x00545454,
+  0x00252525, 0x001d1d1d, 0x8000013a, 0x00000000, 0x00000008, 0x00080808, 0x00202020, 0x00404040,
+  0x00686868, 0x00969696, 0x00b0b0b0, 0x00e8e8e8, 0x00f3f3f3, 0x800000d0, 0x00ffffff, 0x0000000a,
+  0x00f8f8f8, 0x00eaeaea, 0x00cecece, 0x00b5b5b5, 0x008f8f8f, 0x00808080, 0x004e4e4e, 0x00444444,
+  0x00151515, 0x000e0e0e, 0x80000141, 0x00000000, 0x0000000e, 0x00050505, 0x00131313, 0x00262626,
+  0x003e3e3e, 0x00595959, 0x00686868, 0x008b8b8b, 0x00939393, 0x00b1b1b1, 0x00b8b8b8, 0x00cecece,
+  0x00dbdbdb, 0x00ebebeb, 0x00f8f8f8, 0x800000c1, 0x00ffffff, 0x00000013, 0x00fdfdfd, 0x00fafafa,
+  0x00efefef, 0x00e5e5e5, 0x00d6d6d6, 0x00cfcfcf, 0x00bbbbbb, 0x00b7b7b7, 0x00a4a4a4, 0x009c9c9c,
+  0x008b8b8b, 0x007a7a7a, 0x006b6b6b, 0x00555555, 0x004c4c4c, 0x002e2e2e, 0x00282828, 0x000c0c0c,
+  0x00080808, 0x80000147, 0x00000000, 0x00000009, 0x00040404, 0x00070707, 0x003f3f3f, 0x00515151,
+  0x00878787, 0x00a7a7a7, 0x00cfcfcf, 0x00ededed, 0x00fefefe, 0x800000c0, 0x00ffffff, 0x0000000a,
+  0x00fbfbfb, 0x00f3f3f3, 0x00d9d9d9, 0x00c0c0c0, 0x00999999, 0x008a8a8a, 0x00595959, 0x004f4f4f,
+  0x00202020, 0x00161616, 0x80000150, 0x00000000, 0x00000011, 0x00020202, 0x00030303, 0x00191919,
+  0x00202020, 0x00353535, 0x00424242, 0x00515151, 0x00676767, 0x00727272, 0x00969696, 0x009e9e9e,
+  0x00bfbfbf, 0x00c6c6c6, 0x00dedede, 0x00ebebeb, 0x00fbfbfb, 0x00fefefe, 0x800000af, 0x00ffffff,
+  0x00000013, 0x00fafafa, 0x00efefef, 0x00e2e2e2, 0x00d6d6d6, 0x00c4c4c4, 0x00bcbcbc, 0x00a1a1a1,
+  0x009b9b9b, 0x007e7e7e, 0x00757575, 0x00616161, 0x00565656, 0x004b4b4b, 0x003c3c3c, 0x00363636,
+  0x00232323, 0x001f1f1f, 0x000d0d0d, 0x00090909, 0x80000157, 0x00000000, 0x0000000a, 0x000f0f0f,
+  0x00181818, 0x00525252, 0x00606060, 0x00959595, 0x00a2a2a2, 0x00c9c9c9, 0x00dedede, 0x00f8f8f8,
+  0x00fdfdfd, 0x800000af, 0x00ffffff, 0x0000000c, 0x00f7f7f7, 0x00e5e5e5, 0x00cfcfcf, 0x00bbbbbb,
+  0x009d9d9d, 0x00919191, 0x00646464, 0x005a5a5a, 0x002b2b2b, 0x001e1e1e, 0x00020202, 0x00010101,
+  0x8000015e, 0x00000000, 0x00000013, 0x00030303, 0x00050505, 0x00101010, 0x00131313, 0x001d1d1d,
+  0x001f1f1f, 0x00272727, 0x002d2d2d, 0x00343434, 0x004c4c4c, 0x00595959, 0x007d7d7d, 0x00858585,
+  0x00acacac, 0x00b6b6b6, 0x00d6d6d6, 0x00e6e6e6, 0x00fafafa, 0x00fdfdfd, 0x8000009a, 0x00ffffff,
+  0x00000016, 0x00fefefe, 0x00fcfcfc, 0x00e7e7e7, 0x00dcdcdc, 0x00c5c5c5, 0x00b4b4b4, 0x00a3a3a3,
+  0x008b8b8b, 0x00818181, 0x00626262, 0x005c5c5c, 0x003e3e3e, 0x00383838, 0x002c2c2c, 0x00282828,
+  0x00242424, 0x001e1e1e, 0x001c1c1c, 0x00131313, 0x00111111, 0x00080808, 0x00060606, 0x80000167,
+  0x00000000, 0x0000000c, 0x00020202, 0x00050505, 0x00212121, 0x00313131, 0x005d5d5d, 0x00676767,
+  0x00979797, 0x00a4a4a4, 0x00cbcbcb, 0x00dfdfdf, 0x00f8f8f8, 0x00fcfcfc, 0x80000003, 0x00fefefe,
+  0x80000092, 0x00ffffff, 0x80000005, 0x00fefefe, 0x0000000d, 0x00fdfdfd, 0x00fafafa, 0x00e0e0e0,
+  0x00d3d3d3, 0x00b6b6b6, 0x00a1a1a1, 0x008c8c8c, 0x006f6f6f, 0x00636363, 0x003c3c3c, 0x00343434,
+  0x000f0f0f, 0x000a0a0a, 0x80000179, 0x00000000, 0x0000000c, 0x00030303, 0x00060606, 0x00242424,
+  0x00343434, 0x00606060, 0x006b6b6b, 0x009c9c9c, 0x00a6a6a6, 0x00c5c5c5, 0x00d5d5d5, 0x00e9e9e9,
+  0x00f7f7f7, 0x80000086, 0x00ffffff, 0x0000000d, 0x00f3f3f3, 0x00eeeeee, 0x00d2d2d2, 0x00cccccc,
+  0x00b0b0b0, 0x00a4a4a4, 0x00898989, 0x00747474, 0x005f5f5f, 0x00414141, 0x00353535, 0x00101010,
+  0x000b0b0b, 0x80000184, 0x00000000, 0x00000019, 0x00020202, 0x00050505, 0x001d1d1d, 0x00292929,
+  0x004d4d4d, 0x00555555, 0x007c7c7c, 0x00848484, 0x009d9d9d, 0x00aaaaaa, 0x00b9b9b9, 0x00c7c7c7,
+  0x00cdcdcd, 0x00d4d4d4, 0x00d5d5d5, 0x00dcdcdc, 0x00dedede, 0x00e3e3e3, 0x00e6e6e6, 0x00eaeaea,
+  0x00efefef, 0x00f1f1f1, 0x00f7f7f7, 0x00f9f9f9, 0x00fefefe, 0x8000006a, 0x00ffffff, 0x0000001c,
+  0x00fefefe, 0x00f9f9f9, 0x00f8f8f8, 0x00f3f3f3, 0x00f0f0f0, 0x00ededed, 0x00e9e9e9, 0x00e7e7e7,
+  0x00e1e1e1, 0x00e0e0e0, 0x00dadada, 0x00d8d8d8, 0x00d4d4d4, 0x00d1d1d1, 0x00cecece, 0x00c2c2c2,
+  0x00bdbdbd, 0x00a7a7a7, 0x00a2a2a2, 0x008c8c8c, 0x00838383, 0x006d6d6d, 0x005c5c5c, 0x004c4c4c,
+  0x00343434, 0x002a2a2a, 0x000d0d0d, 0x00090909, 0x8000018f, 0x00000000, 0x0000000f, 0x00080808,
+  0x000c0c0c, 0x002a2a2a, 0x00313131, 0x00525252, 0x005b5b5b, 0x00757575, 0x00858585, 0x00989898,
+  0x00b0b0b0, 0x00bcbcbc, 0x00dadada, 0x00e1e1e1, 0x00fcfcfc, 0x00fdfdfd, 0x80000068, 0x00ffffff,
+  0x00000011, 0x00fdfdfd, 0x00fbfbfb, 0x00e4e4e4, 0x00dbdbdb, 0x00c5c5c5, 0x00b6b6b6, 0x00a7a7a7,
+  0x00919191, 0x00888888, 0x006c6c6c, 0x00666666, 0x004a4a4a, 0x00414141, 0x002b2b2b, 0x001c1c1c,
+  0x000d0d0d, 0x00040404, 0x8000019b, 0x00000000, 0x00000021, 0x00050505, 0x00070707, 0x00191919,
+  0x001d1d1d, 0x00313131, 0x00363636, 0x00464646, 0x004f4f4f, 0x005b5b5b, 0x00696969, 0x00707070,
+  0x00828282, 0x00868686, 0x00989898, 0x009c9c9c, 0x00a7a7a7, 0x00aeaeae, 0x00b5b5b5, 0x00bcbcbc,
+  0x00c0c0c0, 0x00c7c7c7, 0x00c9c9c9, 0x00d0d0d0, 0x00d2d2d2, 0x00d8d8d8, 0x00dcdcdc, 0x00e0e0e0,
+  0x00e6e6e6, 0x00e8e8e8, 0x00efefef, 0x00f1f1f1, 0x00f9f9f9, 0x00fafafa, 0x80000040, 0x00ffffff,
+  0x00000027, 0x00fefefe, 0x00fcfcfc, 0x00f7f7f7, 0x00f5f5f5, 0x00eeeeee, 0x00ececec, 0x00e5e5e5,
+  0x00e3e3e3, 0x00dddddd, 0x00d9d9d9, 0x00d5d5d5, 0x00d0d0d0, 0x00cdcdcd, 0x00c7c7c7, 0x00c5c5c5,
+  0x00bebebe, 0x00bcbcbc, 0x00b6b6b6, 0x00b2b2b2, 0x00aeaeae, 0x00a8a8a8, 0x00a6a6a6, 0x009a9a9a,
+  0x00979797, 0x00888888, 0x00838383, 0x00767676, 0x006d6d6d, 0x00646464, 0x00575757, 0x00515151,
+  0x00414141, 0x003d3d3d, 0x002c2c2c, 0x00272727, 0x001a1a1a, 0x00111111, 0x00080808, 0x00020202,
+  0x800001a8, 0x00000000, 0x00000016, 0x00050505, 0x000d0d0d, 0x00252525, 0x00353535, 0x00484848,
+  0x005a5a5a, 0x00636363, 0x00747474, 0x00787878, 0x008b8b8b, 0x00909090, 0x009f9f9f, 0x00a8a8a8,
+  0x00b3b3b3, 0x00c0c0c0, 0x00c7c7c7, 0x00d8d8d8, 0x00dcdcdc, 0x00efefef, 0x00f3f3f3, 0x00fefefe,
+  0x00fefefe, 0x8000003e, 0x00ffffff, 0x00000018, 0x00fcfcfc, 0x00f8f8f8, 0x00ebebeb, 0x00e5e5e5,
+  0x00d4d4d4, 0x00d0d0d0, 0x00bebebe, 0x00b8b8b8, 0x00ababab, 0x00a2a2a2, 0x00989898, 0x008a8a8a,
+  0x00848484, 0x00737373, 0x006f6f6f, 0x005e5e5e, 0x00585858, 0x004b4b4b, 0x00414141, 0x00373737,
+  0x00282828, 0x00212121, 0x00080808, 0x00050505, 0x800001b7, 0x00000000, 0x0000006c, 0x00020202,
+  0x00050505, 0x000f0f0f, 0x00151515, 0x001d1d1d, 0x00242424, 0x00272727, 0x002e2e2e, 0x00303030,
+  0x00373737, 0x00393939, 0x003f3f3f, 0x00434343, 0x00474747, 0x004d4d4d, 0x004f4f4f, 0x00565656,
+  0x00585858, 0x005f5f5f, 0x00616161, 0x00686868, 0x006d6d6d, 0x00737373, 0x007b7b7b, 0x007f7f7f,
+  0x008a8a8a, 0x008c8c8c, 0x00979797, 0x00999999, 0x009d9d9d, 0x009f9f9f, 0x00a0a0a0, 0x00a3a3a3,
+  0x00a4a4a4, 0x00a7a7a7, 0x00a8a8a8, 0x00ababab, 0x00acacac, 0x00afafaf, 0x00b1b1b1, 0x00b3b3b3,
+  0x00b5b5b5, 0x00b6b6b6, 0x00b9b9b9, 0x00bababa, 0x00bdbdbd, 0x00bebebe, 0x00c0c0c0, 0x00c2c2c2,
+  0x00c4c4c4, 0x00c6c6c6, 0x00c8c8c8, 0x00c9c9c9, 0x00c9c9c9, 0x00c5c5c5, 0x00c4c4c4, 0x00c1c1c1,
+  0x00bfbfbf, 0x00bdbdbd, 0x00bababa, 0x00b9b9b9, 0x00b5b5b5, 0x00b5b5b5, 0x00b1b1b1, 0x00b0b0b0,
+  0x00adadad, 0x00aaaaaa, 0x00a8a8a8, 0x00a6a6a6, 0x00a5a5a5, 0x00a1a1a1, 0x00a0a0a0, 0x009c9c9c,
+  0x009b9b9b, 0x00989898, 0x00969696, 0x00949494, 0x00919191, 0x008f8f8f, 0x00858585, 0x00838383,
+  0x00787878, 0x00757575, 0x006d6d6d, 0x00686868, 0x00636363, 0x005d5d5d, 0x005b5b5b, 0x00545454,
+  0x00535353, 0x004c4c4c, 0x00494949, 0x00444444, 0x00404040, 0x003c3c3c, 0x00373737, 0x00353535,
+  0x002e2e2e, 0x002c2c2c, 0x00252525, 0x00232323, 0x001e1e1e, 0x001a1a1a, 0x00161616, 0x00101010,
+  0x000d0d0d, 0x00030303, 0x00020202, 0x800001ca, 0x00000000, 0x00000042, 0x00010101, 0x00040404,
+  0x000d0d0d, 0x00171717, 0x00242424, 0x002b2b2b, 0x003c3c3c, 0x00404040, 0x00535353, 0x00555555,
+  0x005c5c5c, 0x005f5f5f, 0x00626262, 0x00666666, 0x00686868, 0x006d6d6d, 0x006e6e6e, 0x00747474,
+  0x00767676, 0x007a7a7a, 0x007d7d7d, 0x00808080, 0x00848484, 0x00868686, 0x008b8b8b, 0x008c8c8c,
+  0x00919191, 0x00939393, 0x00979797, 0x009a9a9a, 0x009d9d9d, 0x00a1a1a1, 0x00a3a3a3, 0x00a5a5a5,
+  0x00a5a5a5, 0x009f9f9f, 0x009d9d9d, 0x00989898, 0x00959595, 0x00919191, 0x008d8d8d, 0x008b8b8b,
+  0x00858585, 0x00838383, 0x007d7d7d, 0x007b7b7b, 0x00767676, 0x00737373, 0x006f6f6f, 0x006b6b6b,
+  0x00696969, 0x00636363, 0x00616161, 0x005b5b5b, 0x00595959, 0x00545454, 0x00515151, 0x004e4e4e,
+  0x00484848, 0x00454545, 0x00343434, 0x00303030, 0x001f1f1f, 0x001a1a1a, 0x000c0c0c, 0x00060606,
+  0x800001e2, 0x00000000, 0x00000041, 0x00010101, 0x00030303, 0x00050505, 0x00070707, 0x00090909,
+  0x000c0c0c, 0x000d0d0d, 0x00111111, 0x00111111, 0x00121212, 0x00131313, 0x00141414, 0x00141414,
+  0x00151515, 0x00161616, 0x00161616, 0x00171717, 0x00171717, 0x00181818, 0x00191919, 0x00191919,
+  0x001a1a1a, 0x001b1b1b, 0x001c1c1c, 0x001c1c1c, 0x001d1d1d, 0x001d1d1d, 0x001e1e1e, 0x001f1f1f,
+  0x001f1f1f, 0x00202020, 0x00202020, 0x00212121, 0x00212121, 0x00202020, 0x001f1f1f, 0x001e1e1e,
+  0x001e1e1e, 0x001d1d1d, 0x001c1c1c, 0x001c1c1c, 0x001a1a1a, 0x001a1a1a, 0x00191919, 0x00181818,
+  0x00171717, 0x00171717, 0x00161616, 0x00151515, 0x00151515, 0x00141414, 0x00131313, 0x00121212,
+  0x00121212, 0x00111111, 0x00101010, 0x00101010, 0x000e0e0e, 0x000e0e0e, 0x000a0a0a, 0x000a0a0a,
+  0x00060606, 0x00050505, 0x00020202, 0x00010101, 0x8000034f, 0x00000000,
+};
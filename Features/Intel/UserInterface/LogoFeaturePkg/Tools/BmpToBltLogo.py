@@ -0,0 +1,197 @@
+## @file
+# Convert a BMP logo into the pre-decoded logo format used by BltLogoDxe.
+#
+# The output is a C header holding the logo as EFI_GRAPHICS_OUTPUT_BLT_PIXEL
+# values, optionally run-length encoded, plus copies pre-scaled for larger
+# screen resolutions, so that no decoding or scaling is needed at boot.
+#
+# SPDX-License-Identifier: BSD-2-Clause-Patent
+#
+
+##
+# Import Modules
+#
+import os
+import sys
+import struct
+import argparse
+
+__prog__ = 'BmpToBltLogo'
+__description__ = 'Convert a BMP logo into a pre-decoded BLT pixel logo header'
+__version__ = '%s Version %s' % (__prog__, '0.1 ')
+
+#
+# A run header word with this bit set is followed by one pixel that is
+# repeated (header & RUN_LENGTH_MASK) times; otherwise it is followed by
+# that many literal pixels.
+#
+RUN_REPEAT_FLAG = 0x80000000
+RUN_LENGTH_MASK = 0x7FFFFFFF
+#
+# Repeats shorter than this are cheaper stored as literals.
+#
+MIN_REPEAT = 3
+
+
+def ReadBmp(FileName):
+    with open(FileName, 'rb') as File:
+        Data = File.read()
+
+    if Data[0:2] != b'BM':
+        raise ValueError('%s is not a BMP file' % FileName)
+
+    PixelOffset = struct.unpack_from('<I', Data, 10)[0]
+    HeaderSize, Width, Height, Planes, BitCount, Compression = struct.unpack_from('<IiiHHI', Data, 14)
+    if Compression != 0:
+        raise ValueError('Compressed BMP files are not supported')
+    if BitCount not in (8, 24, 32):
+        raise ValueError('%d bits per pixel BMP files are not supported' % BitCount)
+
+    Palette = []
+    if BitCount == 8:
+        Colors = struct.unpack_from('<I', Data, 46)[0] or 256
+        for Index in range(Colors):
+            Blue, Green, Red = struct.unpack_from('<BBB', Data, 14 + HeaderSize + Index * 4)
+            Palette.append((Red << 16) | (Green << 8) | Blue)
+
+    BottomUp = Height > 0
+    Height = abs(Height)
+    RowSize = ((Width * BitCount + 31) // 32) * 4
+
+    Pixels = []
+    for Y in range(Height):
+        Row = Height - 1 - Y if BottomUp else Y
+        Offset = PixelOffset + Row * RowSize
+        for X in range(Width):
+            if BitCount == 8:
+                Pixels.append(Palette[Data[Offset + X]])
+            else:
+                Start = Offset + X * (BitCount // 8)
+                Blue, Green, Red = Data[Start], Data[Start + 1], Data[Start + 2]
+                Pixels.append((Red << 16) | (Green << 8) | Blue)
+
+    return Width, Height, Pixels
+
+
+def Scale(Width, Height, Pixels, NewWidth, NewHeight):
+    """Area-average scaling; every destination pixel is the mean of the source area it covers."""
+    Result = []
+    for Y in range(NewHeight):
+        Y0 = Y * Height / NewHeight
+        Y1 = (Y + 1) * Height / NewHeight
+        for X in range(NewWidth):
+            X0 = X * Width / NewWidth
+            X1 = (X + 1) * Width / NewWidth
+            Total = [0.0, 0.0, 0.0]
+            Area = 0.0
+            SrcY = int(Y0)
+            while SrcY < Y1 and SrcY < Height:
+                Dy = min(Y1, SrcY + 1) - max(Y0, SrcY)
+                SrcX = int(X0)
+                while SrcX < X1 and SrcX < Width:
+                    Dx = min(X1, SrcX + 1) - max(X0, SrcX)
+                    Pixel = Pixels[SrcY * Width + SrcX]
+                    Total[0] += ((Pixel >> 16) & 0xFF) * Dx * Dy
+                    Total[1] += ((Pixel >> 8) & 0xFF) * Dx * Dy
+                    Total[2] += (Pixel & 0xFF) * Dx * Dy
+                    Area += Dx * Dy
+                    SrcX += 1
+                SrcY += 1
+            Red, Green, Blue = [min(255, int(Value / Area + 0.5)) for Value in Total]
+            Result.append((Red << 16) | (Green << 8) | Blue)
+    return Result
+
+
+def RunLengthEncode(Pixels):
+    Words = []
+    Literals = []
+    Index = 0
+    while Index < len(Pixels):
+        Run = 1
+        while Index + Run < len(Pixels) and Pixels[Index + Run] == Pixels[Index]:
+            Run += 1
+        if Run >= MIN_REPEAT:
+            if Literals:
+                Words.append(len(Literals))
+                Words.extend(Literals)
+                Literals = []
+            Words.append(RUN_REPEAT_FLAG | Run)
+            Words.append(Pixels[Index])
+            Index += Run
+        else:
+            Literals.append(Pixels[Index])
+            Index += 1
+    if Literals:
+        Words.append(len(Literals))
+        Words.extend(Literals)
+    return Words
+
+
+def ParseResolution(Text):
+    try:
+        Width, Height = Text.lower().split('x')
+        return int(Width), int(Height)
+    except ValueError:
+        raise argparse.ArgumentTypeError('%s is not a resolution like 1024x768' % Text)
+
+
+def Main():
+    Parser = argparse.ArgumentParser(prog=__prog__, description=__description__)
+    Parser.add_argument('--version', action='version', version=__version__)
+    Parser.add_argument('-i', '--input', required=True, help='BMP logo to convert')
+    Parser.add_argument('-o', '--output', required=True, help='C header to generate')
+    Parser.add_argument('--base', type=ParseResolution, default=(800, 600),
+                        help='screen resolution the logo is drawn at unscaled (default 800x600)')
+    Parser.add_argument('--target', type=ParseResolution, action='append', default=[],
+                        help='additional screen resolution to pre-scale the logo for; may be repeated')
+    Parser.add_argument('--rle', action='store_true', help='run-length encode the pixel data')
+    Args = Parser.parse_args()
+
+    Width, Height, Pixels = ReadBmp(Args.input)
+
+    Variants = [(Args.base, Width, Height, Pixels)]
+    for Target in sorted(set(Args.target)):
+        if Target == Args.base:
+            continue
+        Factor = min(Target[0] / Args.base[0], Target[1] / Args.base[1])
+        NewWidth = max(1, int(Width * Factor + 0.5))
+        NewHeight = max(1, int(Height * Factor + 0.5))
+        Variants.append((Target, NewWidth, NewHeight, Scale(Width, Height, Pixels, NewWidth, NewHeight)))
+
+    Lines = []
+    Lines.append('/** @file')
+    Lines.append('  Pre-decoded platform logo.')
+    Lines.append('')
+    Lines.append('  Generated by LogoFeaturePkg/Tools/BmpToBltLogo.py from %s. Do not edit.' % os.path.basename(Args.input))
+    Lines.append('')
+    Lines.append('SPDX-License-Identifier: BSD-2-Clause-Patent')
+    Lines.append('')
+    Lines.append('**/')
+    Lines.append('')
+
+    Data = []
+    Entries = []
+    for (ScreenWidth, ScreenHeight), VariantWidth, VariantHeight, VariantPixels in Variants:
+        Words = RunLengthEncode(VariantPixels) if Args.rle else VariantPixels
+        Entries.append('  { %d, %d, %d, %d, %s, %d, %d },' % (
+            ScreenWidth, ScreenHeight, VariantWidth, VariantHeight,
+            'TRUE' if Args.rle else 'FALSE', len(Data), len(Words)))
+        Data.extend(Words)
+
+    Lines.append('STATIC CONST BLT_LOGO_VARIANT mBltLogoVariants[] = {')
+    Lines.extend(Entries)
+    Lines.append('};')
+    Lines.append('')
+    Lines.append('STATIC CONST UINT32 mBltLogoData[] = {')
+    for Index in range(0, len(Data), 8):
+        Lines.append('  ' + ', '.join('0x%08x' % Word for Word in Data[Index:Index + 8]) + ',')
+    Lines.append('};')
+
+    with open(Args.output, 'w', newline='\r\n') as File:
+        File.write('\n'.join(Lines) + '\n')
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(Main())
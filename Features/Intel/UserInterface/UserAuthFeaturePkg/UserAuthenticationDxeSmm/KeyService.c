@@ -91,6 +91,7 @@ KeyLibGenerateSalt (
   @param[in]   KeySize          Key buffer size
   @param[in]   SaltValue        Points to the salt buffer
   @param[in]   SaltSize         Size of the salt buffer
+  @param[in]   IterationCount   Number of PBKDF2 iterations
   @param[out]  KeyHash          Points to the hashed result
   @param[in]   KeyHashSize      Size of the hash buffer
 
@@ -106,6 +107,7 @@ KeyLibGeneratePBKDF2Hash (
   IN   UINTN               KeySize,
   IN   UINT8               *SaltValue,
   IN   UINTN               SaltSize,
+  IN   UINTN               IterationCount,
   OUT  UINT8               *KeyHash,
   IN   UINTN               KeyHashSize
   )
@@ -118,13 +120,16 @@ KeyLibGeneratePBKDF2Hash (
   if (KeyHashSize != SHA256_DIGEST_SIZE) {
     return FALSE;
   }
+  if (IterationCount == 0) {
+    return FALSE;
+  }
 
   Result = Pkcs5HashPassword (
              KeySize,
              Key,
              SaltSize,
              SaltValue,
-             DEFAULT_PBKDF2_ITERATION_COUNT,
+             IterationCount,
              SHA256_DIGEST_SIZE,
              KeyHashSize,
              KeyHash
@@ -65,6 +65,7 @@ KeyLibGenerateSalt(
   @param[in]   KeySize          Key buffer size
   @param[in]   SaltValue        Points to the salt buffer
   @param[in]   SaltSize         Size of the salt buffer
+  @param[in]   IterationCount   Number of PBKDF2 iterations
   @param[out]  KeyHash          Points to the hashed result
   @param[in]   KeyHashSize      Size of the hash buffer
 
@@ -80,6 +81,7 @@ KeyLibGeneratePBKDF2Hash (
   IN   UINTN               KeySize,
   IN   UINT8               *SaltValue,
   IN   UINTN               SaltSize,
+  IN   UINTN               IterationCount,
   OUT  UINT8               *KeyHash,
   IN   UINTN               KeyHashSize
   );
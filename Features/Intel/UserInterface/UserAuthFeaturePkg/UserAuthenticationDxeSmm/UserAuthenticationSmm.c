@@ -40,6 +40,7 @@ VerifyPassword (
              PasswordSize,
              UserPasswordVarStruct->PasswordSalt,
              sizeof(UserPasswordVarStruct->PasswordSalt),
+             UserPasswordVarStruct->IterationCount,
              HashData,
              sizeof(HashData)
              );
@@ -72,6 +73,7 @@ GetPasswordHashFromVariable (
   OUT USER_PASSWORD_VAR_STRUCT       *UserPasswordVarStruct
   )
 {
+  EFI_STATUS                        Status;
   UINTN                             DataSize;
   CHAR16                            PasswordName[sizeof(USER_AUTHENTICATION_VAR_NAME)/sizeof(CHAR16) + 5];
 
@@ -82,13 +84,27 @@ GetPasswordHashFromVariable (
   }
 
   DataSize = sizeof(*UserPasswordVarStruct);
-  return mSmmVariable->SmmGetVariable (
-                         PasswordName,
-                         UserGuid,
-                         NULL,
-                         &DataSize,
-                         UserPasswordVarStruct
-                         );
+  Status = mSmmVariable->SmmGetVariable (
+                           PasswordName,
+                           UserGuid,
+                           NULL,
+                           &DataSize,
+                           UserPasswordVarStruct
+                           );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  if (DataSize == OFFSET_OF (USER_PASSWORD_VAR_STRUCT, IterationCount)) {
+    //
+    // Saved before the iteration count was stored with the hash
+    //
+    UserPasswordVarStruct->IterationCount = DEFAULT_PBKDF2_ITERATION_COUNT;
+  } else if (DataSize != sizeof(*UserPasswordVarStruct)) {
+    return EFI_NOT_FOUND;
+  }
+
+  return EFI_SUCCESS;
 }
 
 /**
@@ -226,12 +242,14 @@ SavePasswordToVariable (
   //
   if (Password != NULL) {
     KeyLibGenerateSalt (UserPasswordVarStruct.PasswordSalt, sizeof(UserPasswordVarStruct.PasswordSalt));
+    UserPasswordVarStruct.IterationCount = PcdGet32 (PcdPasswordPbkdf2IterationCount);
     HashOk = KeyLibGeneratePBKDF2Hash (
                HASH_TYPE_SHA256,
                (UINT8 *)Password,
                PasswordSize,
                UserPasswordVarStruct.PasswordSalt,
                sizeof(UserPasswordVarStruct.PasswordSalt),
+               UserPasswordVarStruct.IterationCount,
                UserPasswordVarStruct.PasswordHash,
                sizeof(UserPasswordVarStruct.PasswordHash)
                );
@@ -371,9 +389,14 @@ IsPasswordStrong (
 /**
   Return if the password is set before in PASSWORD_HISTORY_CHECK_COUNT.
 
+  The current password is kept in the history as well. OldPassword has already
+  been verified against it, so that entry is settled by comparing the plain
+  text rather than by another PBKDF2 derivation.
+
   @param[in]  UserGuid               The user GUID of the password variable.
   @param[in]  Password               The user input password.
   @param[in]  PasswordSize           The size of Password in byte.
+  @param[in]  OldPassword            The verified current password.
 
   @retval TRUE    The password is set before.
   @retval FALSE   The password is not set before.
@@ -382,16 +405,29 @@ BOOLEAN
 IsPasswordInHistory (
   IN EFI_GUID                       *UserGuid,
   IN CHAR8                          *Password,
-  IN UINTN                          PasswordSize
+  IN UINTN                          PasswordSize,
+  IN CHAR8                          *OldPassword
   )
 {
   EFI_STATUS                     Status;
   USER_PASSWORD_VAR_STRUCT       UserPasswordVarStruct;
+  USER_PASSWORD_VAR_STRUCT       CurrentPasswordVarStruct;
+  BOOLEAN                        CurrentPasswordSet;
   UINTN                          Index;
 
+  Status = GetPasswordHashFromVariable (UserGuid, 0, &CurrentPasswordVarStruct);
+  CurrentPasswordSet = (BOOLEAN) !EFI_ERROR (Status);
+  if (CurrentPasswordSet && (AsciiStrCmp (Password, OldPassword) == 0)) {
+    return TRUE;
+  }
+
   for (Index = 1; Index <= PASSWORD_HISTORY_CHECK_COUNT; Index++) {
     Status = GetPasswordHashFromVariable (UserGuid, Index, &UserPasswordVarStruct);
     if (!EFI_ERROR(Status)) {
+      if (CurrentPasswordSet &&
+          (CompareMem (&UserPasswordVarStruct, &CurrentPasswordVarStruct, sizeof (UserPasswordVarStruct)) == 0)) {
+        continue;
+      }
       Status = VerifyPassword (Password, PasswordSize, &UserPasswordVarStruct);
       if (!EFI_ERROR(Status)) {
         return TRUE;
@@ -518,7 +554,7 @@ SmmPasswordHandler (
       Status = EFI_UNSUPPORTED;
       goto EXIT;
     }
-    if (PasswordLen != 0 && IsPasswordInHistory (UserGuid, SmmCommunicateSetPassword.NewPassword, PasswordLen + 1)) {
+    if (PasswordLen != 0 && IsPasswordInHistory (UserGuid, SmmCommunicateSetPassword.NewPassword, PasswordLen + 1, SmmCommunicateSetPassword.OldPassword)) {
       DEBUG ((DEBUG_ERROR, "SmmPasswordHandler: NewPassword in history!\n"));
       Status = EFI_ALREADY_STARTED;
       goto EXIT;
@@ -23,6 +23,7 @@
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/SmmServicesTableLib.h>
 #include <Library/MemoryAllocationLib.h>
+#include <Library/PcdLib.h>
 #include <Library/SmmServicesTableLib.h>
 #include <Library/BaseCryptLib.h>
 #include <Library/PlatformPasswordLib.h>
@@ -44,9 +45,13 @@
 //
 // Variable storage
 //
+// Variables written before IterationCount was added end at PasswordSalt and
+// were hashed with DEFAULT_PBKDF2_ITERATION_COUNT.
+//
 typedef struct {
   UINT8        PasswordHash[PASSWORD_HASH_SIZE];
   UINT8        PasswordSalt[PASSWORD_SALT_SIZE];
+  UINT32       IterationCount;
 } USER_PASSWORD_VAR_STRUCT;
 
 #endif
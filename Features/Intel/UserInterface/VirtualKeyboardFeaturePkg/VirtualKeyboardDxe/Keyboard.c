@@ -461,8 +461,10 @@ VkTimer (
   CheckScreenCleared (VkContext);
   CheckBackgroundChanged (VkContext);
   if (VkContext->IsRedrawUpdateUI) {
-    HideVkBody (VkContext);
-    DrawKeyboardLayout (VkContext);
+    if (EFI_ERROR (UpdateVkBody (VkContext))) {
+      HideVkBody (VkContext);
+      DrawKeyboardLayout (VkContext);
+    }
     VkContext->IsRedrawUpdateUI = FALSE;
   }
 
@@ -822,6 +824,7 @@ VkApiStart (
   VkContext->TargetKeyboardDisplay              = VkDisplayAttributeNone;
   VkContext->VkBodyBackgroundBltBuffer          = NULL;
   VkContext->VkBodyCompoundBltBuffer            = NULL;
+  VkContext->VkBodyUpdateBltBuffer              = NULL;
   VkContext->VkBodyBltSize                      = 0;
   VkContext->VkBodyBltStartX                    = 0;
   VkContext->VkBodyBltStartY                    = 0;
@@ -1229,8 +1232,10 @@ VkKeyboardSetState (
     VkContext->PageNumber = VkContext->IsCapsLockFlag ? VkPage1 : VkPage0;
   }
 
-  HideVkBody (VkContext);
-  DrawKeyboardLayout (VkContext);
+  if (EFI_ERROR (UpdateVkBody (VkContext))) {
+    HideVkBody (VkContext);
+    DrawKeyboardLayout (VkContext);
+  }
 
   DEBUG ((DEBUG_VK_KEYS | DEBUG_INFO, "VkContext->KeyToggleState:      %02x\n", VkContext->KeyToggleState));
   DEBUG ((DEBUG_VK_KEYS | DEBUG_INFO, "VkContext->IsCapsLockFlag:      %02x\n", VkContext->IsCapsLockFlag));
@@ -874,6 +874,10 @@ DrawVkBody (
       FreePool (VkContext->VkBodyCompoundBltBuffer);
     }
     VkContext->VkBodyCompoundBltBuffer = NULL;
+    if (VkContext->VkBodyUpdateBltBuffer != NULL) {
+      FreePool (VkContext->VkBodyUpdateBltBuffer);
+    }
+    VkContext->VkBodyUpdateBltBuffer = NULL;
     ModifyShiftKeyColor (VkContext, &BltIn);
     MakeKeyboardTransparent (VkContext, TRUE, BltIn, &(VkContext->VkBodyCompoundBltBuffer));
 
@@ -903,6 +907,234 @@ DVKBODY_Exit:
   return Status;
 }
 
+/**
+  Count the pixels of a rectangle of the keyboard body that differ between
+  two renderings of it.
+
+  @param[in] VkContext  Address of an VK_CONTEXT structure.
+  @param[in] Old        Keyboard body on the screen.
+  @param[in] New        Keyboard body to display.
+  @param[in] StartX     Left of the rectangle, relative to the keyboard body.
+  @param[in] StartY     Top of the rectangle, relative to the keyboard body.
+  @param[in] EndX       Right of the rectangle, exclusive.
+  @param[in] EndY       Bottom of the rectangle, exclusive.
+
+  @return Number of pixels that differ.
+
+**/
+UINTN
+CountChangedPixels (
+  IN VK_CONTEXT                    *VkContext,
+  IN EFI_GRAPHICS_OUTPUT_BLT_PIXEL *Old,
+  IN EFI_GRAPHICS_OUTPUT_BLT_PIXEL *New,
+  IN UINTN                         StartX,
+  IN UINTN                         StartY,
+  IN UINTN                         EndX,
+  IN UINTN                         EndY
+  )
+{
+  UINTN X;
+  UINTN Y;
+  UINTN Offset;
+  UINTN Count;
+
+  Count = 0;
+  for (Y = StartY; Y < EndY; Y++) {
+    Offset = Y * VkContext->VkBodyBltWidth;
+    for (X = StartX; X < EndX; X++) {
+      if ((Old[Offset + X].Red   != New[Offset + X].Red) ||
+          (Old[Offset + X].Green != New[Offset + X].Green) ||
+          (Old[Offset + X].Blue  != New[Offset + X].Blue)) {
+        Count++;
+      }
+    }
+  }
+
+  return Count;
+}
+
+/**
+  Redraw the keys of the displayed keyboard whose image changed.
+
+  A Shift or CapsLock touch only recolors the shift keys, so rather than
+  restoring the background and drawing the whole keyboard again, render the
+  new state from the saved background in memory and Blt only the key
+  cells that differ from what is on the screen.
+
+  @param[in] VkContext          Code context.
+
+  @retval EFI_SUCCESS           The changed keys are on the screen.
+  @retval EFI_NOT_READY         Keyboard isn't displayed in place, redraw it all.
+  @retval EFI_OUT_OF_RESOURCES  Allocate memory failed.
+
+**/
+EFI_STATUS
+UpdateVkBody (
+  IN VK_CONTEXT *VkContext
+  )
+{
+  EFI_STATUS                    Status;
+  EFI_IMAGE_INPUT               *VkImage;
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL *Swap;
+  EFI_GRAPHICS_OUTPUT_PROTOCOL  *GraphicsOutput;
+  VK_STRUCT                     *Key;
+  UINTN                         Index;
+  UINTN                         StartX;
+  UINTN                         StartY;
+  UINTN                         EndX;
+  UINTN                         EndY;
+  UINTN                         Changed;
+  UINTN                         ChangedInKeys;
+  UINTN                         Blts;
+
+  if (!VkContext->IsIconShowed ||
+      (VkContext->CurrentKeyboardDisplay == VkDisplayAttributeNone) ||
+      (VkContext->CurrentKeyboardDisplay != VkContext->TargetKeyboardDisplay) ||
+      (VkContext->VkBodyBackgroundBltBuffer == NULL) ||
+      (VkContext->VkBodyCompoundBltBuffer == NULL)) {
+    return EFI_NOT_READY;
+  }
+
+  switch (VkContext->CurrentKeyboardDisplay) {
+  case VkDisplayAttributeSimpleTop:
+  case VkDisplayAttributeSimpleBottom:
+    VkImage = VkContext->SimKeyBody;
+    break;
+
+  default:
+    VkImage = (VkContext->PageNumber <= VkPage1) ? VkContext->CapLeKeyBody : VkContext->DigKeyBody;
+    break;
+  }
+  if ((VkImage->Width != VkContext->VkBodyBltWidth) || (VkImage->Height != VkContext->VkBodyBltHeight)) {
+    return EFI_NOT_READY;
+  }
+
+  if (VkContext->VkBodyUpdateBltBuffer == NULL) {
+    VkContext->VkBodyUpdateBltBuffer = AllocatePool (VkContext->VkBodyBltSize);
+    if (VkContext->VkBodyUpdateBltBuffer == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+  }
+
+  //
+  // Render the new state over the saved background, as DrawVkBody does.
+  // The blend reads and writes the same pixel, so it can run in place.
+  //
+  CopyMem (
+    VkContext->VkBodyUpdateBltBuffer,
+    VkImage->Bitmap,
+    VkImage->Width * VkImage->Height * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL)
+    );
+  ModifyShiftKeyColor (VkContext, &VkContext->VkBodyUpdateBltBuffer);
+  MakeKeyboardTransparent (VkContext, TRUE, VkContext->VkBodyUpdateBltBuffer, &VkContext->VkBodyUpdateBltBuffer);
+
+  Changed = CountChangedPixels (
+              VkContext,
+              VkContext->VkBodyCompoundBltBuffer,
+              VkContext->VkBodyUpdateBltBuffer,
+              0,
+              0,
+              VkContext->VkBodyBltWidth,
+              VkContext->VkBodyBltHeight
+              );
+
+  //
+  // Find out whether the key cells cover every change. Past half of the
+  // keyboard (a page switch), one Blt of the whole body is cheaper.
+  //
+  ChangedInKeys = 0;
+  for (Index = 0; Index < (VkContext->NumOfKeysInfo - 4) && ChangedInKeys < Changed; Index++) {
+    Key = &VkContext->KeyboardBodyPtr[Index];
+    StartX = Key->DisStartX - VkContext->VkBodyBltStartX;
+    StartY = Key->DisStartY - VkContext->VkBodyBltStartY;
+    EndX   = MIN (Key->DisEndX - VkContext->VkBodyBltStartX, VkContext->VkBodyBltWidth);
+    EndY   = MIN (Key->DisEndY - VkContext->VkBodyBltStartY, VkContext->VkBodyBltHeight);
+    ChangedInKeys += CountChangedPixels (
+                       VkContext,
+                       VkContext->VkBodyCompoundBltBuffer,
+                       VkContext->VkBodyUpdateBltBuffer,
+                       StartX,
+                       StartY,
+                       EndX,
+                       EndY
+                       );
+  }
+
+  GraphicsOutput = VkContext->GraphicsOutput;
+  Status         = EFI_SUCCESS;
+  Blts           = 0;
+  if ((ChangedInKeys < Changed) ||
+      (Changed > (VkContext->VkBodyBltWidth * VkContext->VkBodyBltHeight) / 2)) {
+    Status = GraphicsOutput->Blt (
+                               GraphicsOutput,
+                               VkContext->VkBodyUpdateBltBuffer,
+                               EfiBltBufferToVideo,
+                               0,
+                               0,
+                               VkContext->VkBodyBltStartX,
+                               VkContext->VkBodyBltStartY,
+                               VkContext->VkBodyBltWidth,
+                               VkContext->VkBodyBltHeight,
+                               VkContext->VkBodyBltWidth * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL)
+                               );
+    Blts++;
+  } else if (Changed != 0) {
+    for (Index = 0; Index < (VkContext->NumOfKeysInfo - 4) && !EFI_ERROR (Status); Index++) {
+      Key = &VkContext->KeyboardBodyPtr[Index];
+      StartX = Key->DisStartX - VkContext->VkBodyBltStartX;
+      StartY = Key->DisStartY - VkContext->VkBodyBltStartY;
+      EndX   = MIN (Key->DisEndX - VkContext->VkBodyBltStartX, VkContext->VkBodyBltWidth);
+      EndY   = MIN (Key->DisEndY - VkContext->VkBodyBltStartY, VkContext->VkBodyBltHeight);
+      if (CountChangedPixels (
+            VkContext,
+            VkContext->VkBodyCompoundBltBuffer,
+            VkContext->VkBodyUpdateBltBuffer,
+            StartX,
+            StartY,
+            EndX,
+            EndY
+            ) == 0) {
+        continue;
+      }
+
+      Status = GraphicsOutput->Blt (
+                                 GraphicsOutput,
+                                 VkContext->VkBodyUpdateBltBuffer,
+                                 EfiBltBufferToVideo,
+                                 StartX,
+                                 StartY,
+                                 Key->DisStartX,
+                                 Key->DisStartY,
+                                 EndX - StartX,
+                                 EndY - StartY,
+                                 VkContext->VkBodyBltWidth * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL)
+                                 );
+      Blts++;
+      //
+      // Keep the old rendering in step, so overlapping cells aren't sent twice.
+      //
+      for (; StartY < EndY; StartY++) {
+        CopyMem (
+          &VkContext->VkBodyCompoundBltBuffer[StartY * VkContext->VkBodyBltWidth + StartX],
+          &VkContext->VkBodyUpdateBltBuffer[StartY * VkContext->VkBodyBltWidth + StartX],
+          (EndX - StartX) * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL)
+          );
+      }
+    }
+  }
+  DEBUG ((DEBUG_VK_ROUTINE_ENTRY_EXIT, "UpdateVkBody %d pixels changed, %d Blts, Status: %r\n", Changed, Blts, Status));
+
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Swap = VkContext->VkBodyCompoundBltBuffer;
+  VkContext->VkBodyCompoundBltBuffer = VkContext->VkBodyUpdateBltBuffer;
+  VkContext->VkBodyUpdateBltBuffer   = Swap;
+
+  return EFI_SUCCESS;
+}
+
 /**
   Clear the keyboard body
 
@@ -1344,6 +1576,11 @@ CheckScreenCleared (
       VkContext->VkBodyCompoundBltBuffer = NULL;
     }
 
+    if (VkContext->VkBodyUpdateBltBuffer != NULL) {
+      FreePool (VkContext->VkBodyUpdateBltBuffer);
+      VkContext->VkBodyUpdateBltBuffer = NULL;
+    }
+
     if (VkContext->IconBltBuffer != NULL) {
       FreePool (VkContext->IconBltBuffer);
       VkContext->IconBltBuffer = NULL;
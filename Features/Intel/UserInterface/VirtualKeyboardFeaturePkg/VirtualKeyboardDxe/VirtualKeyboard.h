@@ -265,6 +265,11 @@ struct _VK_CONTEXT {
   ///
   EFI_GRAPHICS_OUTPUT_BLT_PIXEL     *VkBodyBackgroundBltBuffer;
   EFI_GRAPHICS_OUTPUT_BLT_PIXEL     *VkBodyCompoundBltBuffer;
+  ///
+  /// Keyboard body rendered for the new state, swapped with
+  /// VkBodyCompoundBltBuffer once the changed keys are on the screen.
+  ///
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL     *VkBodyUpdateBltBuffer;
   UINTN                             VkBodyBltSize;
   UINTN                             VkBodyBltStartX;
   UINTN                             VkBodyBltStartY;
@@ -654,6 +659,21 @@ DrawVkBody (
   IN VK_DISPLAY_ATTRIBUTE          Attribute
   );
 
+/**
+  Redraw the keys of the displayed keyboard whose image changed.
+
+  @param[in] VkContext          Code context.
+
+  @retval EFI_SUCCESS           The changed keys are on the screen.
+  @retval EFI_NOT_READY         Keyboard isn't displayed in place, redraw it all.
+  @retval EFI_OUT_OF_RESOURCES  Allocate memory failed.
+
+**/
+EFI_STATUS
+UpdateVkBody (
+  IN VK_CONTEXT *VkContext
+  );
+
 /**
   Get unicode by VkContext->PageNumber and VkContext->KeyboardBodyPtr.
 
@@ -379,4 +379,49 @@ BootMonGetFileFromPosition (
   OUT BOOTMON_FS_FILE       **File
   );
 
+/**
+  Insert a file in the file name index of its volume, or move it to the right
+  bucket if its name changed since it was last indexed.
+
+  The name used is the one BootMonGetFileFromAsciiFileName() would compare
+  against: the name in "Info" if the file is open, the name of the footer
+  otherwise. This function must be called every time one of these changes.
+
+  @param[in]  File  Pointer to the description of the file.
+
+**/
+VOID
+BootMonFsIndexFile (
+  IN BOOTMON_FS_FILE  *File
+  );
+
+/**
+  Remove a file from the file name index of its volume and drop the cached
+  directory, as the file is about to be removed from the volume's list.
+
+  @param[in]  File  Pointer to the description of the file.
+
+**/
+VOID
+BootMonFsUnindexFile (
+  IN BOOTMON_FS_FILE  *File
+  );
+
+/**
+  Drop the cached directory of a volume. To be called every time a file is
+  inserted in, removed from or moved within the list of files of the volume.
+
+  @param[in]  Instance  Pointer to the description of the volume.
+
+**/
+VOID
+BootMonFsInvalidateDirectory (
+  IN BOOTMON_FS_INSTANCE  *Instance
+  );
+
+EFI_STATUS
+BootMonFsBuildDirectory (
+  IN BOOTMON_FS_INSTANCE  *Instance
+  );
+
 #endif
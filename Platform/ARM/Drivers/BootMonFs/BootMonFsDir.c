@@ -320,6 +320,7 @@ SetFileName (
     // OK, change the filename.
     AsciiStrToUnicodeStrS (AsciiFileName, File->Info->FileName,
       (File->Info->Size - SIZE_OF_EFI_FILE_INFO) / sizeof (CHAR16));
+    BootMonFsIndexFile (File);
     return EFI_SUCCESS;
   }
 }
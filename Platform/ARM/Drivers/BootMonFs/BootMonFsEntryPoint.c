@@ -48,6 +48,126 @@ EFI_FILE_PROTOCOL mBootMonFsFileTemplate = {
   BootMonFsFlushFile
 };
 
+STATIC
+UINT32
+BootMonFsHashName (
+  IN CONST CHAR8  *Name
+  )
+{
+  UINT32  Hash;
+
+  // FNV-1a
+  Hash = 2166136261U;
+  while (*Name != '\0') {
+    Hash = (Hash ^ (UINT8)*Name) * 16777619U;
+    Name++;
+  }
+  return Hash;
+}
+
+VOID
+BootMonFsIndexFile (
+  IN BOOTMON_FS_FILE  *File
+  )
+{
+  BOOTMON_FS_INSTANCE  *Instance;
+
+  Instance = File->Instance;
+
+  if (!IsListEmpty (&File->HashLink)) {
+    RemoveEntryList (&File->HashLink);
+  }
+
+  if (File->Info != NULL) {
+    UnicodeStrToAsciiStrS (File->Info->FileName, File->IndexedName,
+      MAX_NAME_LENGTH);
+  } else {
+    // The footer name read from media is not guaranteed to be terminated
+    AsciiStrnCpyS (File->IndexedName, MAX_NAME_LENGTH,
+      File->HwDescription.Footer.Filename, MAX_NAME_LENGTH - 1);
+  }
+  File->NameHash = BootMonFsHashName (File->IndexedName);
+
+  InsertTailList (
+    &Instance->FileHash[File->NameHash & (BOOTMON_FS_FILE_HASH_SIZE - 1)],
+    &File->HashLink
+    );
+}
+
+VOID
+BootMonFsUnindexFile (
+  IN BOOTMON_FS_FILE  *File
+  )
+{
+  if (!IsListEmpty (&File->HashLink)) {
+    RemoveEntryList (&File->HashLink);
+    InitializeListHead (&File->HashLink);
+  }
+  BootMonFsInvalidateDirectory (File->Instance);
+}
+
+VOID
+BootMonFsInvalidateDirectory (
+  IN BOOTMON_FS_INSTANCE  *Instance
+  )
+{
+  Instance->DirectoryValid = FALSE;
+}
+
+/**
+  Build the cached directory of a volume from its list of files.
+
+  @param[in]  Instance  Pointer to the description of the volume.
+
+  @retval  EFI_SUCCESS           The cached directory is up to date.
+  @retval  EFI_OUT_OF_RESOURCES  The cache could not be allocated.
+
+**/
+EFI_STATUS
+BootMonFsBuildDirectory (
+  IN BOOTMON_FS_INSTANCE  *Instance
+  )
+{
+  LIST_ENTRY       *Entry;
+  BOOTMON_FS_FILE  **Directory;
+  UINTN            Count;
+
+  Count = 0;
+  for (Entry = GetFirstNode (&Instance->RootFile->Link);
+       !IsNull (&Instance->RootFile->Link, Entry);
+       Entry = GetNextNode (&Instance->RootFile->Link, Entry)
+       )
+  {
+    Count++;
+  }
+
+  if (Count > Instance->DirectoryMaxCount) {
+    // Leave some room for the files created afterwards
+    Directory = AllocatePool ((Count + 8) * sizeof (BOOTMON_FS_FILE*));
+    if (Directory == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+    if (Instance->Directory != NULL) {
+      FreePool (Instance->Directory);
+    }
+    Instance->Directory = Directory;
+    Instance->DirectoryMaxCount = Count + 8;
+  }
+
+  Count = 0;
+  for (Entry = GetFirstNode (&Instance->RootFile->Link);
+       !IsNull (&Instance->RootFile->Link, Entry);
+       Entry = GetNextNode (&Instance->RootFile->Link, Entry)
+       )
+  {
+    Instance->Directory[Count++] = BOOTMON_FS_FILE_FROM_LINK_THIS (Entry);
+  }
+  Instance->DirectoryCount = Count;
+  Instance->DirectoryValid = TRUE;
+
+  return EFI_SUCCESS;
+}
+
 /**
   Search for a file given its name coded in Ascii.
 
@@ -56,11 +176,13 @@ EFI_FILE_PROTOCOL mBootMonFsFileTemplate = {
   "HwDescription.Footer.Filename[]" field of the file's description.
 
   If a file is currently open, its name might not have been written on the
-  media yet, and as the "HwDescription" is a mirror in RAM of what is on the
   media the "HwDescription.Footer.Filename[]" might be outdated. In that case,
   the up to date name of the file is stored in the "Info" field of the file's
   description.
 
+  The files are looked up through the file name index of the volume, which
+  holds the relevant name of each file in its "IndexedName" field.
+
   @param[in]   Instance       Pointer to the description of the volume in which
                               the file has to be search for.
   @param[in]   AsciiFileName  Name of the file.
@@ -79,27 +201,22 @@ BootMonGetFileFromAsciiFileName (
   OUT BOOTMON_FS_FILE       **File
   )
 {
+  LIST_ENTRY       *Bucket;
   LIST_ENTRY       *Entry;
   BOOTMON_FS_FILE  *FileEntry;
-  CHAR8            OpenFileAsciiFileName[MAX_NAME_LENGTH];
-  CHAR8            *AsciiFileNameToCompare;
+  UINT32           Hash;
 
-  // Go through all the files in the list and return the file handle
-  for (Entry = GetFirstNode (&Instance->RootFile->Link);
-       !IsNull (&Instance->RootFile->Link, Entry);
-       Entry = GetNextNode (&Instance->RootFile->Link, Entry)
+  Hash   = BootMonFsHashName (AsciiFileName);
+  Bucket = &Instance->FileHash[Hash & (BOOTMON_FS_FILE_HASH_SIZE - 1)];
+
+  for (Entry = GetFirstNode (Bucket);
+       !IsNull (Bucket, Entry);
+       Entry = GetNextNode (Bucket, Entry)
        )
   {
-    FileEntry = BOOTMON_FS_FILE_FROM_LINK_THIS (Entry);
-    if (FileEntry->Info != NULL) {
-      UnicodeStrToAsciiStrS (FileEntry->Info->FileName, OpenFileAsciiFileName,
-        MAX_NAME_LENGTH);
-      AsciiFileNameToCompare = OpenFileAsciiFileName;
-    } else {
-      AsciiFileNameToCompare = FileEntry->HwDescription.Footer.Filename;
-    }
-
-    if (AsciiStrCmp (AsciiFileNameToCompare, AsciiFileName) == 0) {
+    FileEntry = BOOTMON_FS_FILE_FROM_HASH_LINK (Entry);
+    if ((FileEntry->NameHash == Hash) &&
+        (AsciiStrCmp (FileEntry->IndexedName, AsciiFileName) == 0)) {
       *File = FileEntry;
       return EFI_SUCCESS;
     }
@@ -117,7 +234,17 @@ BootMonGetFileFromPosition (
   LIST_ENTRY        *Entry;
   BOOTMON_FS_FILE   *FileEntry;
 
-  // Go through all the files in the list and return the file handle
+  if (Instance->DirectoryValid ||
+      !EFI_ERROR (BootMonFsBuildDirectory (Instance))) {
+    if (Position >= Instance->DirectoryCount) {
+      return EFI_NOT_FOUND;
+    }
+    *File = Instance->Directory[Position];
+    return EFI_SUCCESS;
+  }
+
+  // The cached directory could not be built, go through all the files in the
+  // list and return the file handle
   for (Entry = GetFirstNode (&Instance->RootFile->Link);
        !IsNull (&Instance->RootFile->Link, Entry) && (&Instance->RootFile->Link != Entry);
        Entry = GetNextNode (&Instance->RootFile->Link, Entry)
@@ -148,6 +275,7 @@ BootMonFsCreateFile (
 
   NewFile->Signature = BOOTMON_FS_FILE_SIGNATURE;
   InitializeListHead (&NewFile->Link);
+  InitializeListHead (&NewFile->HashLink);
   InitializeListHead (&NewFile->RegionToFlushLink);
   NewFile->Instance = Instance;
 
@@ -315,6 +443,7 @@ BootMonFsDriverStart (
   EFI_STATUS           Status;
   UINTN                VolumeNameSize;
   EFI_FILE_INFO       *Info;
+  UINTN                Index;
 
   Instance = AllocateZeroPool (sizeof (BOOTMON_FS_INSTANCE));
   if (Instance == NULL) {
@@ -353,6 +482,9 @@ BootMonFsDriverStart (
   Instance->ControllerHandle = ControllerHandle;
   Instance->Media = Instance->BlockIo->Media;
   Instance->Binding = DriverBinding;
+  for (Index = 0; Index < BOOTMON_FS_FILE_HASH_SIZE; Index++) {
+    InitializeListHead (&Instance->FileHash[Index]);
+  }
 
     // Initialize the Simple File System Protocol
   Instance->Fs.Revision = EFI_SIMPLE_FILE_SYSTEM_PROTOCOL_REVISION;
@@ -476,6 +608,9 @@ BootMonFsDriverStop (
       &gEfiSimpleFileSystemProtocolGuid, &Instance->Fs,
       NULL);
 
+  if (Instance->Directory != NULL) {
+    FreePool (Instance->Directory);
+  }
   FreePool (Instance->RootFile->Info);
   FreePool (Instance->RootFile);
   FreePool (Instance);
@@ -208,9 +208,14 @@ BootMonFsInitialize (
       break;
     }
     InsertTailList (&Instance->RootFile->Link, &NewFile->Link);
+    BootMonFsIndexFile (NewFile);
     ImageCount++;
   }
 
+  // Build the cached directory now. If this fails, it is built again on the
+  // first directory read.
+  BootMonFsBuildDirectory (Instance);
+
   Instance->Initialized = TRUE;
   return EFI_SUCCESS;
 }
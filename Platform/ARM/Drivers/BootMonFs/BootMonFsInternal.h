@@ -29,12 +29,21 @@
 
 #define BOOTMON_FS_VOLUME_LABEL   L"NOR Flash"
 
+// Number of buckets of the file name index, must be a power of two
+#define BOOTMON_FS_FILE_HASH_SIZE 64
+
 typedef struct _BOOTMON_FS_INSTANCE BOOTMON_FS_INSTANCE;
 
+//
+// The regions of a file waiting to be flushed are sorted by offset and never
+// overlap nor touch each other: a write that does is merged into the existing
+// region(s).
+//
 typedef struct {
   LIST_ENTRY            Link;
   VOID*                 Buffer;
   UINTN                 Size;
+  UINTN                 Capacity; // Allocated size of Buffer
   UINT64                Offset; // Offset from the start of the file
 } BOOTMON_FS_FILE_REGION;
 
@@ -43,6 +52,11 @@ typedef struct {
   LIST_ENTRY            Link;
   BOOTMON_FS_INSTANCE   *Instance;
 
+  // Link in the file name index of the volume, keyed on IndexedName
+  LIST_ENTRY            HashLink;
+  UINT32                NameHash;
+  CHAR8                 IndexedName[MAX_NAME_LENGTH];
+
   UINTN                 HwDescAddress;
   HW_IMAGE_DESCRIPTION  HwDescription;
 
@@ -63,6 +77,7 @@ typedef struct {
 #define BOOTMON_FS_FILE_SIGNATURE              SIGNATURE_32('b', 'o', 't', 'f')
 #define BOOTMON_FS_FILE_FROM_FILE_THIS(a)      CR (a, BOOTMON_FS_FILE, File, BOOTMON_FS_FILE_SIGNATURE)
 #define BOOTMON_FS_FILE_FROM_LINK_THIS(a)      CR (a, BOOTMON_FS_FILE, Link, BOOTMON_FS_FILE_SIGNATURE)
+#define BOOTMON_FS_FILE_FROM_HASH_LINK(a)      CR (a, BOOTMON_FS_FILE, HashLink, BOOTMON_FS_FILE_SIGNATURE)
 
 struct _BOOTMON_FS_INSTANCE {
   UINT32                               Signature;
@@ -83,6 +98,16 @@ struct _BOOTMON_FS_INSTANCE {
 
   BOOTMON_FS_FILE                     *RootFile; // All the other files are linked to this root
   BOOLEAN                              Initialized;
+
+  // Index of the files of the volume by name
+  LIST_ENTRY                           FileHash[BOOTMON_FS_FILE_HASH_SIZE];
+
+  // Cached directory: the files of the volume in list order, so that a
+  // directory position maps straight to a file. Rebuilt when invalidated.
+  BOOTMON_FS_FILE                    **Directory;
+  UINTN                                DirectoryCount;
+  UINTN                                DirectoryMaxCount;
+  BOOLEAN                              DirectoryValid;
 };
 
 #define BOOTMON_FS_SIGNATURE            SIGNATURE_32('b', 'o', 't', 'm')
@@ -190,6 +190,7 @@ BootMonFsFindSpaceForNewFile (
       File->Link.ForwardLink = FileLink;
       FileLink->BackLink->ForwardLink = &File->Link;
       FileLink->BackLink = &File->Link;
+      BootMonFsInvalidateDirectory (File->Instance);
 
       return EFI_SUCCESS;
     } else {
@@ -268,6 +269,7 @@ BootMonFsFlushFile (
   UINT64                   NewFileSize;
   UINT64                   EndOfAppendSpace;
   BOOLEAN                  HasSpace;
+  BOOLEAN                  DescriptionOutdated;
 
   if (This == NULL) {
     return EFI_INVALID_PARAMETER;
@@ -306,7 +308,11 @@ BootMonFsFlushFile (
   }
   // FileEnd is the current NOR address of the end of the file's data
   FileEnd = FileStart + File->HwDescription.Region[0].Size;
+  DescriptionOutdated = FALSE;
 
+  // The regions are sorted by offset and coalesced by BootMonFsWriteFile(),
+  // so the media is written in address order with as few, as large, writes as
+  // possible. This lets DiskIo hand whole blocks to the NOR flash driver.
   for (RegionToFlushLink = GetFirstNode (&File->RegionToFlushLink);
        !IsNull (&File->RegionToFlushLink, RegionToFlushLink);
        RegionToFlushLink = GetNextNode (&File->RegionToFlushLink, RegionToFlushLink)
@@ -369,12 +375,14 @@ BootMonFsFlushFile (
       }
 
       if (HasSpace == TRUE) {
-        // Invalidate the current image description of the file if any.
-        if (File->HwDescAddress != 0) {
+        // Invalidate the current image description of the file if any. The
+        // new description is written once all the regions are on media.
+        if ((File->HwDescAddress != 0) && !DescriptionOutdated) {
           Status = InvalidateImageDescription (File);
           if (EFI_ERROR (Status)) {
             return Status;
           }
+          DescriptionOutdated = TRUE;
         }
 
         // Write the new file data
@@ -388,11 +396,7 @@ BootMonFsFlushFile (
         if (EFI_ERROR (Status)) {
           return Status;
         }
-
-        Status = WriteFileDescription (File, AsciiFileName, NewDataSize, FileStart);
-        if (EFI_ERROR (Status)) {
-          return Status;
-        }
+        DescriptionOutdated = TRUE;
 
       } else {
         // There isn't a space for the file.
@@ -407,15 +411,16 @@ BootMonFsFlushFile (
   }
 
   FreeFileRegions (File);
-  Info->PhysicalSize = BootMonFsGetPhysicalSize (File);
 
-  if ((AsciiStrCmp (AsciiFileName, File->HwDescription.Footer.Filename) != 0) ||
+  if (DescriptionOutdated                                                     ||
+      (AsciiStrCmp (AsciiFileName, File->HwDescription.Footer.Filename) != 0) ||
       (Info->FileSize != File->HwDescription.Region[0].Size)               ) {
     Status = WriteFileDescription (File, AsciiFileName, Info->FileSize, FileStart);
     if (EFI_ERROR (Status)) {
       return Status;
     }
   }
+  Info->PhysicalSize = BootMonFsGetPhysicalSize (File);
 
   // Flush DiskIo Buffers (see UEFI Spec 12.7 - DiskIo buffers are flushed by
   // calling FlushBlocks on the same device's BlockIo).
@@ -457,6 +462,8 @@ BootMonFsCloseFile (
     This->Flush (This);
     FreePool (File->Info);
     File->Info = NULL;
+    // The file is now known by the name of its footer
+    BootMonFsIndexFile (File);
   }
 
   return EFI_SUCCESS;
@@ -672,6 +679,7 @@ BootMonFsOpenFile (
         goto Error;
       }
       InsertHeadList (&Instance->RootFile->Link, &File->Link);
+      BootMonFsInvalidateDirectory (Instance);
       Info->Attribute = Attributes;
     } else {
       //
@@ -691,6 +699,7 @@ BootMonFsOpenFile (
     Info = NULL;
     File->Position = 0;
     File->OpenMode = OpenMode;
+    BootMonFsIndexFile (File);
 
     *NewHandle = &File->File;
   }
@@ -781,6 +790,7 @@ BootMonFsDelete (
   }
 
   // Remove the entry from the list
+  BootMonFsUnindexFile (File);
   RemoveEntryList (&File->Link);
   FreePool (File->Info);
   FreePool (File);
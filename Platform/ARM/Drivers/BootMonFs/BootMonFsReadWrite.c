@@ -102,11 +102,138 @@ BootMonFsReadFile (
   return Status;
 }
 
+/**
+  Record data to write to a file in its list of regions to flush.
+
+  The data is merged into the regions it overlaps or is adjacent to, so that
+  the list stays sorted by offset and a sequence of writes ends up as a few
+  large regions rather than one region per write. Where the data overlaps a
+  region, the new data supersedes the old one.
+
+  @param[in]  File    Description of the file.
+  @param[in]  Offset  Offset in the file of the data.
+  @param[in]  Size    Size of the data in bytes.
+  @param[in]  Buffer  The data.
+
+  @retval  EFI_SUCCESS           The data was recorded.
+  @retval  EFI_OUT_OF_RESOURCES  Unable to allocate the buffer to store the data.
+
+**/
+STATIC
+EFI_STATUS
+BootMonFsAddRegion (
+  IN BOOTMON_FS_FILE  *File,
+  IN UINT64           Offset,
+  IN UINTN            Size,
+  IN VOID             *Buffer
+  )
+{
+  LIST_ENTRY              *RegionLink;
+  LIST_ENTRY              *NextLink;
+  BOOTMON_FS_FILE_REGION  *Region;
+  BOOTMON_FS_FILE_REGION  *Next;
+  UINT64                  Start;
+  UINT64                  End;
+  UINTN                   NewSize;
+  UINTN                   Capacity;
+  VOID                    *NewBuffer;
+
+  End = Offset + Size;
+
+  // Look for the first region that does not end before the new data
+  for (RegionLink = GetFirstNode (&File->RegionToFlushLink);
+       !IsNull (&File->RegionToFlushLink, RegionLink);
+       RegionLink = GetNextNode (&File->RegionToFlushLink, RegionLink)
+       )
+  {
+    Region = (BOOTMON_FS_FILE_REGION*)RegionLink;
+    if (Region->Offset + Region->Size >= Offset) {
+      break;
+    }
+  }
+
+  if (IsNull (&File->RegionToFlushLink, RegionLink) ||
+      (((BOOTMON_FS_FILE_REGION*)RegionLink)->Offset > End)) {
+    // Nothing to merge with, insert a new region before RegionLink
+    Region = (BOOTMON_FS_FILE_REGION*)AllocateZeroPool (sizeof (BOOTMON_FS_FILE_REGION));
+    if (Region == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    Region->Buffer = AllocateCopyPool (Size, Buffer);
+    if (Region->Buffer == NULL) {
+      FreePool (Region);
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    Region->Size     = Size;
+    Region->Capacity = Size;
+    Region->Offset   = Offset;
+
+    InsertTailList (RegionLink, &Region->Link);
+    return EFI_SUCCESS;
+  }
+
+  Region = (BOOTMON_FS_FILE_REGION*)RegionLink;
+  Start  = MIN (Region->Offset, Offset);
+
+  // The following regions starting within the merged range are absorbed.
+  for (NextLink = GetNextNode (&File->RegionToFlushLink, RegionLink);
+       !IsNull (&File->RegionToFlushLink, NextLink);
+       NextLink = GetNextNode (&File->RegionToFlushLink, NextLink)
+       )
+  {
+    Next = (BOOTMON_FS_FILE_REGION*)NextLink;
+    if (Next->Offset > End) {
+      break;
+    }
+    End = MAX (End, Next->Offset + Next->Size);
+  }
+  End     = MAX (End, Region->Offset + Region->Size);
+  NewSize = (UINTN)(End - Start);
+
+  if ((Start != Region->Offset) || (NewSize > Region->Capacity)) {
+    // Grow the buffer geometrically, so that a stream of sequential writes
+    // does not copy the whole region each time.
+    Capacity  = MAX (NewSize, 2 * Region->Capacity);
+    NewBuffer = AllocatePool (Capacity);
+    if (NewBuffer == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+    CopyMem ((UINT8*)NewBuffer + (Region->Offset - Start), Region->Buffer,
+      Region->Size);
+    FreePool (Region->Buffer);
+    Region->Buffer   = NewBuffer;
+    Region->Capacity = Capacity;
+    Region->Offset   = Start;
+  }
+
+  NextLink = GetNextNode (&File->RegionToFlushLink, RegionLink);
+  while (!IsNull (&File->RegionToFlushLink, NextLink)) {
+    Next = (BOOTMON_FS_FILE_REGION*)NextLink;
+    if (Next->Offset > End) {
+      break;
+    }
+    CopyMem ((UINT8*)Region->Buffer + (Next->Offset - Start), Next->Buffer,
+      Next->Size);
+    NextLink = RemoveEntryList (NextLink);
+    FreePool (Next->Buffer);
+    FreePool (Next);
+  }
+
+  // Copy the new data last as it supersedes the data it overlaps
+  CopyMem ((UINT8*)Region->Buffer + (Offset - Start), Buffer, Size);
+  Region->Size = NewSize;
+
+  return EFI_SUCCESS;
+}
+
 /**
   Write data to an open file.
 
   The data is not written to the flash yet. It will be written when the file
-  will be either read, closed or flushed.
+  will be either read, closed or flushed. Until then, consecutive and
+  overlapping writes are coalesced in memory.
 
   @param[in]      This        A pointer to the EFI_FILE_PROTOCOL instance that
                               is the file handle to write data to.
@@ -131,7 +258,7 @@ BootMonFsWriteFile (
   )
 {
   BOOTMON_FS_FILE         *File;
-  BOOTMON_FS_FILE_REGION  *Region;
+  EFI_STATUS              Status;
 
   if (This == NULL) {
     return EFI_INVALID_PARAMETER;
@@ -145,25 +272,14 @@ BootMonFsWriteFile (
     return EFI_ACCESS_DENIED;
   }
 
-  // Allocate and initialize the memory region
-  Region = (BOOTMON_FS_FILE_REGION*)AllocateZeroPool (sizeof (BOOTMON_FS_FILE_REGION));
-  if (Region == NULL) {
-    *BufferSize = 0;
-    return EFI_OUT_OF_RESOURCES;
-  }
-
-  Region->Buffer = AllocateCopyPool (*BufferSize, Buffer);
-  if (Region->Buffer == NULL) {
-    *BufferSize = 0;
-    FreePool (Region);
-    return EFI_OUT_OF_RESOURCES;
+  if (*BufferSize > 0) {
+    Status = BootMonFsAddRegion (File, File->Position, *BufferSize, Buffer);
+    if (EFI_ERROR (Status)) {
+      *BufferSize = 0;
+      return Status;
+    }
   }
 
-  Region->Size   = *BufferSize;
-  Region->Offset = File->Position;
-
-  InsertTailList (&File->RegionToFlushLink, &Region->Link);
-
   File->Position += *BufferSize;
 
   if (File->Position > File->Info->FileSize) {
@@ -37,10 +37,27 @@ STATIC CONST EFI_GUID  mFdtPlatformDxeHiiGuid = {
 
 EFI_HANDLE mFdtPlatformDxeHiiHandle;
 
+//
+// Name of the UEFI variable that records, across boots, which of the
+// "PcdFdtDevicePaths" device paths the FDT was last installed from.
+//
+#define FDT_CACHE_VARIABLE_NAME  L"FdtCache"
+
+//
+// Contents of the "FdtCache" UEFI variable. The NUL terminated text device
+// path the FDT was installed from follows the structure.
+//
+typedef struct {
+  UINT32  FdtSize;   // Size of the FDT as given by its header
+  UINT32  FdtCrc32;  // CRC32 of the FDT
+} FDT_PLATFORM_CACHE;
+
 /**
   Install the FDT specified by its device path in text form.
 
-  @param[in]  TextDevicePath  Device path of the FDT to install in text form
+  @param[in]   TextDevicePath  Device path of the FDT to install in text form
+  @param[out]  FdtSize         Size of the installed FDT
+  @param[out]  FdtCrc32        CRC32 of the installed FDT
 
   @retval  EFI_SUCCESS            The FDT was installed.
   @retval  EFI_NOT_FOUND          Failed to locate a protocol or a file.
@@ -51,7 +68,9 @@ EFI_HANDLE mFdtPlatformDxeHiiHandle;
 STATIC
 EFI_STATUS
 InstallFdt (
-  IN CONST CHAR16*  TextDevicePath
+  IN  CONST CHAR16*  TextDevicePath,
+  OUT UINT32         *FdtSize,
+  OUT UINT32         *FdtCrc32
   )
 {
   EFI_STATUS                          Status;
@@ -99,6 +118,12 @@ InstallFdt (
     goto Error;
   }
 
+  *FdtSize = fdt_totalsize ((VOID*)(UINTN)FdtBlobBase);
+  Status = gBS->CalculateCrc32 ((VOID*)(UINTN)FdtBlobBase, *FdtSize, FdtCrc32);
+  if (EFI_ERROR (Status)) {
+    goto Error;
+  }
+
   //
   // Store the FDT as Runtime Service Data to prevent the Kernel from
   // overwritting its data.
@@ -246,6 +271,145 @@ FdtPlatformEntryPoint (
   return Status;
 }
 
+/**
+  Check whether a text device path is one of the "PcdFdtDevicePaths" ones.
+
+  @param[in]  TextDevicePath  Device path in text form.
+
+  @retval  TRUE   The device path is listed in "PcdFdtDevicePaths".
+  @retval  FALSE  The device path is not listed in "PcdFdtDevicePaths".
+
+**/
+STATIC
+BOOLEAN
+IsFdtDevicePathListed (
+  IN CONST CHAR16  *TextDevicePath
+  )
+{
+  CONST CHAR16  *TextDevicePathStart;
+  CONST CHAR16  *TextDevicePathSeparator;
+  UINTN         TextDevicePathLen;
+
+  for (TextDevicePathStart = (CONST CHAR16*)PcdGetPtr (PcdFdtDevicePaths);
+       *TextDevicePathStart != L'\0'                                     ; ) {
+    TextDevicePathSeparator = StrStr (TextDevicePathStart, L";");
+    if (TextDevicePathSeparator == NULL) {
+      TextDevicePathLen = StrLen (TextDevicePathStart);
+    } else {
+      TextDevicePathLen = (UINTN)(TextDevicePathSeparator - TextDevicePathStart);
+    }
+
+    if ((TextDevicePathLen == StrLen (TextDevicePath)) &&
+        (StrnCmp (TextDevicePathStart, TextDevicePath, TextDevicePathLen) == 0)) {
+      return TRUE;
+    }
+
+    if (TextDevicePathSeparator == NULL) {
+      break;
+    }
+    TextDevicePathStart = TextDevicePathSeparator + 1;
+  }
+
+  return FALSE;
+}
+
+/**
+  Get the contents of the "FdtCache" UEFI variable.
+
+  @return  The contents of the variable in an allocated buffer that has to be
+           freed by the caller, or NULL if the variable is not defined or is
+           malformed.
+
+**/
+STATIC
+FDT_PLATFORM_CACHE*
+GetFdtCache (
+  VOID
+  )
+{
+  EFI_STATUS          Status;
+  FDT_PLATFORM_CACHE  *Cache;
+  UINTN               DataSize;
+  CHAR16              *TextDevicePath;
+
+  Status = GetVariable2 (
+             FDT_CACHE_VARIABLE_NAME,
+             &gFdtVariableGuid,
+             (VOID**)&Cache,
+             &DataSize
+             );
+  if (EFI_ERROR (Status)) {
+    return NULL;
+  }
+
+  TextDevicePath = (CHAR16*)(Cache + 1);
+  if ((DataSize < sizeof (FDT_PLATFORM_CACHE) + sizeof (CHAR16)) ||
+      (((DataSize - sizeof (FDT_PLATFORM_CACHE)) % sizeof (CHAR16)) != 0) ||
+      (TextDevicePath[(DataSize - sizeof (FDT_PLATFORM_CACHE)) / sizeof (CHAR16) - 1] != L'\0')) {
+    FreePool (Cache);
+    return NULL;
+  }
+
+  return Cache;
+}
+
+/**
+  Record the device path an FDT has been installed from in the "FdtCache"
+  UEFI variable.
+
+  The variable is written only if its contents change, so that booting the
+  same FDT from the same device path never writes to the variable store.
+
+  @param[in]  Cache           Current contents of the variable, or NULL.
+  @param[in]  TextDevicePath  Device path the FDT was installed from.
+  @param[in]  FdtSize         Size of the installed FDT.
+  @param[in]  FdtCrc32        CRC32 of the installed FDT.
+
+**/
+STATIC
+VOID
+UpdateFdtCache (
+  IN CONST FDT_PLATFORM_CACHE  *Cache OPTIONAL,
+  IN CONST CHAR16              *TextDevicePath,
+  IN UINT32                    FdtSize,
+  IN UINT32                    FdtCrc32
+  )
+{
+  EFI_STATUS          Status;
+  FDT_PLATFORM_CACHE  *NewCache;
+  UINTN               DataSize;
+
+  if ((Cache != NULL) &&
+      (Cache->FdtSize == FdtSize) &&
+      (Cache->FdtCrc32 == FdtCrc32) &&
+      (StrCmp ((CONST CHAR16*)(Cache + 1), TextDevicePath) == 0)) {
+    DEBUG ((EFI_D_INFO, "The FDT is unchanged since the last boot.\n"));
+    return;
+  }
+
+  DataSize = sizeof (FDT_PLATFORM_CACHE) + StrSize (TextDevicePath);
+  NewCache = AllocatePool (DataSize);
+  if (NewCache == NULL) {
+    return;
+  }
+  NewCache->FdtSize  = FdtSize;
+  NewCache->FdtCrc32 = FdtCrc32;
+  CopyMem (NewCache + 1, TextDevicePath, StrSize (TextDevicePath));
+
+  Status = gRT->SetVariable (
+                  FDT_CACHE_VARIABLE_NAME,
+                  &gFdtVariableGuid,
+                  EFI_VARIABLE_NON_VOLATILE      |
+                  EFI_VARIABLE_BOOTSERVICE_ACCESS ,
+                  DataSize,
+                  NewCache
+                  );
+  if (EFI_ERROR (Status)) {
+    DEBUG ((EFI_D_WARN, "Unable to update the \"FdtCache\" UEFI variable - %r\n", Status));
+  }
+  FreePool (NewCache);
+}
+
 /**
   Run the FDT installation process.
 
@@ -253,6 +417,10 @@ FdtPlatformEntryPoint (
   been asked to be retrieved for. For each device path, try to install
   the FDT. Stop as soon as an installation succeeds.
 
+  The "PcdFdtDevicePaths" device path the FDT was installed from on the
+  previous boot, recorded in the "FdtCache" UEFI variable, is tried before
+  the others so that the device paths that failed then are not tried again.
+
   @param[in]  SuccessfullDevicePath  If not NULL, address where to store the
                                      pointer to the text device path from
                                      which the FDT was successfully retrieved.
@@ -273,14 +441,20 @@ RunFdtInstallation (
   OUT CHAR16  **SuccessfullDevicePath
   )
 {
-  EFI_STATUS  Status;
-  UINTN       DataSize;
-  CHAR16      *TextDevicePath;
-  CHAR16      *TextDevicePathStart;
-  CHAR16      *TextDevicePathSeparator;
-  UINTN       TextDevicePathLen;
-
-  TextDevicePath = NULL;
+  EFI_STATUS          Status;
+  UINTN               DataSize;
+  CHAR16              *TextDevicePath;
+  CHAR16              *TextDevicePathStart;
+  CHAR16              *TextDevicePathSeparator;
+  UINTN               TextDevicePathLen;
+  FDT_PLATFORM_CACHE  *Cache;
+  CHAR16              *CachedDevicePath;
+  UINT32              FdtSize;
+  UINT32              FdtCrc32;
+
+  TextDevicePath   = NULL;
+  Cache            = NULL;
+  CachedDevicePath = NULL;
   //
   // For development purpose, if enabled through the "PcdOverridePlatformFdt"
   // feature PCD, try first to install the FDT specified by the device path in
@@ -319,7 +493,7 @@ RunFdtInstallation (
         goto Error;
       }
 
-      Status = InstallFdt (TextDevicePath);
+      Status = InstallFdt (TextDevicePath, &FdtSize, &FdtCrc32);
       if (!EFI_ERROR (Status)) {
         DEBUG ((
           EFI_D_WARN,
@@ -337,6 +511,35 @@ RunFdtInstallation (
     }
   }
 
+  //
+  // Try first the device path the FDT was installed from on the previous
+  // boot, provided it is still one of the "PcdFdtDevicePaths" ones.
+  //
+  Cache = GetFdtCache ();
+  if (Cache != NULL) {
+    CachedDevicePath = (CHAR16*)(Cache + 1);
+    if (IsFdtDevicePathListed (CachedDevicePath)) {
+      Status = InstallFdt (CachedDevicePath, &FdtSize, &FdtCrc32);
+      if (!EFI_ERROR (Status)) {
+        TextDevicePath = AllocateCopyPool (StrSize (CachedDevicePath), CachedDevicePath);
+        if (TextDevicePath == NULL) {
+          Status = EFI_OUT_OF_RESOURCES;
+          goto Error;
+        }
+        DEBUG ((EFI_D_WARN, "Installation of the FDT using the device path <%s> completed.\n",
+          TextDevicePath
+          ));
+        UpdateFdtCache (Cache, TextDevicePath, FdtSize, FdtCrc32);
+        goto Done;
+      }
+      DEBUG ((EFI_D_WARN, "Installation of the FDT using the cached device path <%s> failed - %r.\n",
+        CachedDevicePath, Status
+        ));
+    } else {
+      CachedDevicePath = NULL;
+    }
+  }
+
   //
   // Loop over the device path list provided by "PcdFdtDevicePaths". The device
   // paths are in text form and separated by a semi-colon.
@@ -366,11 +569,19 @@ RunFdtInstallation (
     }
     TextDevicePath[TextDevicePathLen] = L'\0';
 
-    Status = InstallFdt (TextDevicePath);
+    //
+    // Do not try again the cached device path that has just failed.
+    //
+    if ((CachedDevicePath != NULL) && (StrCmp (TextDevicePath, CachedDevicePath) == 0)) {
+      Status = EFI_NOT_FOUND;
+    } else {
+      Status = InstallFdt (TextDevicePath, &FdtSize, &FdtCrc32);
+    }
     if (!EFI_ERROR (Status)) {
       DEBUG ((EFI_D_WARN, "Installation of the FDT using the device path <%s> completed.\n",
         TextDevicePath
         ));
+      UpdateFdtCache (Cache, TextDevicePath, FdtSize, FdtCrc32);
       goto Done;
     }
 
@@ -388,6 +599,10 @@ RunFdtInstallation (
 Error:
 Done:
 
+  if (Cache != NULL) {
+    FreePool (Cache);
+  }
+
   if (EFI_ERROR (Status)) {
     DEBUG ((EFI_D_ERROR, "Failed to install the FDT - %r.\n", Status));
     return Status;
@@ -31,9 +31,19 @@
 #include <SsdtUart.hex>
 #include <SsdtPci.hex>
 
+/** The Juno board revision, read from the board SYS_ID register.
+*/
+STATIC UINT32 mJunoRevision;
+
 /** The platform configuration repository information.
+
+  None of this depends on the board at runtime, so the repository is
+  constant and lives in read-only data; the only revision dependent
+  objects (the PCIe tables and configuration space) are filtered on
+  mJunoRevision when they are requested.
 */
 STATIC
+CONST
 EDKII_PLATFORM_REPOSITORY_INFO ArmJunoPlatformRepositoryInfo = {
   /// Configuration Manager information
   { CONFIGURATION_MANAGER_REVISION, CFG_MGR_OEM_ID },
@@ -578,12 +588,8 @@ InitializePlatformRepository (
   IN  CONST EDKII_CONFIGURATION_MANAGER_PROTOCOL  * CONST This
   )
 {
-  EDKII_PLATFORM_REPOSITORY_INFO  * PlatformRepo;
-
-  PlatformRepo = This->PlatRepoInfo;
-
-  GetJunoRevision (PlatformRepo->JunoRevision);
-  DEBUG ((DEBUG_INFO, "Juno Rev = 0x%x\n", PlatformRepo->JunoRevision));
+  GetJunoRevision (mJunoRevision);
+  DEBUG ((DEBUG_INFO, "Juno Rev = 0x%x\n", mJunoRevision));
   return EFI_SUCCESS;
 }
 
@@ -786,7 +792,7 @@ GetStandardNameSpaceObject (
       CmObject->ObjectId = CmObjectId;
       TableCount = sizeof (PlatformRepo->CmAcpiTableList) /
                      sizeof (PlatformRepo->CmAcpiTableList[0]);
-      if (PlatformRepo->JunoRevision != JUNO_REVISION_R0) {
+      if (mJunoRevision != JUNO_REVISION_R0) {
         CmObject->Size = sizeof (PlatformRepo->CmAcpiTableList);
         CmObject->Count = TableCount;
       } else {
@@ -823,6 +829,54 @@ GetStandardNameSpaceObject (
   return Status;
 }
 
+/** The ARM namespace objects, indexed by object ID.
+
+  Every field of the repository is fixed at build time, so the table is
+  constant and a query is a single index rather than a search.
+*/
+STATIC
+CONST
+CM_OBJECT_TABLE_ENTRY mArmObjectTable[EArmObjMax] = {
+  [EArmObjBootArchInfo] =
+    CM_OBJECT_TABLE_ENTRY_INIT (BootArchInfo, 1, NULL),
+  [EArmObjPowerManagementProfileInfo] =
+    CM_OBJECT_TABLE_ENTRY_INIT (PmProfileInfo, 1, NULL),
+  [EArmObjGicCInfo] =
+    CM_OBJECT_TABLE_ENTRY_INIT (GicCInfo, PLAT_CPU_COUNT, GetGicCInfo),
+  [EArmObjGicDInfo] =
+    CM_OBJECT_TABLE_ENTRY_INIT (GicDInfo, 1, NULL),
+  [EArmObjGicMsiFrameInfo] =
+    CM_OBJECT_TABLE_ENTRY_INIT (GicMsiFrameInfo, 1, NULL),
+  [EArmObjSerialConsolePortInfo] =
+    CM_OBJECT_TABLE_ENTRY_INIT (SpcrSerialPort, 1, NULL),
+  [EArmObjSerialDebugPortInfo] =
+    CM_OBJECT_TABLE_ENTRY_INIT (DbgSerialPort, 1, NULL),
+  [EArmObjGenericTimerInfo] =
+    CM_OBJECT_TABLE_ENTRY_INIT (GenericTimerInfo, 1, NULL),
+  [EArmObjPlatformGTBlockInfo] =
+    CM_OBJECT_TABLE_ENTRY_INIT (GTBlockInfo, PLAT_GTBLOCK_COUNT, NULL),
+  [EArmObjGTBlockTimerFrameInfo] =
+    CM_OBJECT_TABLE_ENTRY_INIT (
+      GTBlock0TimerInfo,
+      PLAT_GTFRAME_COUNT,
+      GetGTBlockTimerFrameInfo
+      ),
+  [EArmObjPlatformGenericWatchdogInfo] =
+    CM_OBJECT_TABLE_ENTRY_INIT (Watchdog, 1, NULL),
+  [EArmObjPciConfigSpaceInfo] =
+    CM_OBJECT_TABLE_ENTRY_INIT (PciConfigInfo, 1, NULL),
+  [EArmObjProcHierarchyInfo] =
+    CM_OBJECT_TABLE_ENTRY_INIT (
+      ProcHierarchyInfo,
+      PLAT_PROC_HIERARCHY_NODE_COUNT,
+      NULL
+      ),
+  [EArmObjCacheInfo] =
+    CM_OBJECT_TABLE_ENTRY_INIT (CacheInfo, PLAT_CACHE_COUNT, NULL),
+  [EArmObjCmRef] =
+    { NULL, 0, 0, GetCmObjRefs }
+};
+
 /** Return an ARM namespace object.
 
   @param [in]      This        Pointer to the Configuration Manager Protocol.
@@ -845,139 +899,79 @@ GetArmNameSpaceObject (
   IN  OUT   CM_OBJ_DESCRIPTOR                     * CONST CmObject
   )
 {
-  EFI_STATUS                        Status;
-  EDKII_PLATFORM_REPOSITORY_INFO  * PlatformRepo;
+  EFI_STATUS                      Status;
+  UINT32                          ObjectId;
+  CONST CM_OBJECT_TABLE_ENTRY   * Entry;
 
-  Status = EFI_SUCCESS;
   if ((This == NULL) || (CmObject == NULL)) {
     ASSERT (This != NULL);
     ASSERT (CmObject != NULL);
     return EFI_INVALID_PARAMETER;
   }
-  PlatformRepo = This->PlatRepoInfo;
 
-  switch (GET_CM_OBJECT_ID (CmObjectId)) {
-    HANDLE_CM_OBJECT (
-      EArmObjBootArchInfo,
-      CmObjectId,
-      PlatformRepo->BootArchInfo,
-      1
-      );
-    HANDLE_CM_OBJECT (
-      EArmObjPowerManagementProfileInfo,
-      CmObjectId,
-      PlatformRepo->PmProfileInfo,
-      1
-      );
-    HANDLE_CM_OBJECT (
-      EArmObjGenericTimerInfo,
-      CmObjectId,
-      PlatformRepo->GenericTimerInfo,
-      1
-      );
-    HANDLE_CM_OBJECT (
-      EArmObjPlatformGenericWatchdogInfo,
-      CmObjectId,
-      PlatformRepo->Watchdog,
-      1
-      );
-    HANDLE_CM_OBJECT (
-      EArmObjPlatformGTBlockInfo,
-      CmObjectId,
-      PlatformRepo->GTBlockInfo,
-      (sizeof (PlatformRepo->GTBlockInfo) /
-         sizeof (PlatformRepo->GTBlockInfo[0]))
-      );
-    HANDLE_CM_OBJECT_REF_BY_TOKEN (
-      EArmObjGTBlockTimerFrameInfo,
-      CmObjectId,
-      PlatformRepo->GTBlock0TimerInfo,
-      (sizeof (PlatformRepo->GTBlock0TimerInfo) /
-         sizeof (PlatformRepo->GTBlock0TimerInfo[0])),
-      Token,
-      GetGTBlockTimerFrameInfo
-      );
-    HANDLE_CM_OBJECT_REF_BY_TOKEN (
-      EArmObjGicCInfo,
-      CmObjectId,
-      PlatformRepo->GicCInfo,
-      ARRAY_SIZE (PlatformRepo->GicCInfo),
-      Token,
-      GetGicCInfo
-      );
-    HANDLE_CM_OBJECT (
-      EArmObjGicDInfo,
-      CmObjectId,
-      PlatformRepo->GicDInfo,
-      1
-      );
-    HANDLE_CM_OBJECT (
-      EArmObjSerialConsolePortInfo,
-      CmObjectId,
-      PlatformRepo->SpcrSerialPort,
-      1
-      );
+  ObjectId = GET_CM_OBJECT_ID (CmObjectId);
+  if (ObjectId >= EArmObjMax) {
+    Entry = NULL;
+  } else {
+    Entry = &mArmObjectTable[ObjectId];
+  }
 
-    HANDLE_CM_OBJECT (
-      EArmObjSerialDebugPortInfo,
-      CmObjectId,
-      PlatformRepo->DbgSerialPort,
-      1
-      );
-    HANDLE_CM_OBJECT (
-      EArmObjGicMsiFrameInfo,
-      CmObjectId,
-      PlatformRepo->GicMsiFrameInfo,
-      1
-      );
-    HANDLE_CM_OBJECT (
-      EArmObjProcHierarchyInfo,
-      CmObjectId,
-      PlatformRepo->ProcHierarchyInfo,
-      ARRAY_SIZE (PlatformRepo->ProcHierarchyInfo)
-      );
-    HANDLE_CM_OBJECT (
-      EArmObjCacheInfo,
-      CmObjectId,
-      PlatformRepo->CacheInfo,
-      ARRAY_SIZE (PlatformRepo->CacheInfo)
-      );
-    HANDLE_CM_OBJECT_SEARCH_PLAT_REPO (
-      EArmObjCmRef,
+  if ((Entry == NULL) ||
+      ((Entry->Data == NULL) && (Entry->HandlerProc == NULL))) {
+    Status = EFI_NOT_FOUND;
+    DEBUG ((
+      DEBUG_INFO,
+      "INFO: Object 0x%x. Status = %r\n",
       CmObjectId,
-      Token,
-      GetCmObjRefs
-      );
+      Status
+      ));
+    return Status;
+  }
 
-    case EArmObjPciConfigSpaceInfo:
-      if (PlatformRepo->JunoRevision != JUNO_REVISION_R0) {
-        CmObject->ObjectId = CmObjectId;
-        CmObject->Size = sizeof (PlatformRepo->PciConfigInfo);
-        CmObject->Count = 1;
-        CmObject->Data = (VOID*)&PlatformRepo->PciConfigInfo;
-        DEBUG ((
-          DEBUG_INFO,
-          "EArmObjPciConfigSpaceInfo: Ptr = 0x%p, Size = %d, Count = %d\n",
-          CmObject->Data,
-          CmObject->Size,
-          CmObject->Count
-          ));
-      }
-      break;
+  // PCIe is only available on Juno R1 and R2.
+  if ((ObjectId == EArmObjPciConfigSpaceInfo) &&
+      (mJunoRevision == JUNO_REVISION_R0)) {
+    return EFI_SUCCESS;
+  }
 
-    default: {
-      Status = EFI_NOT_FOUND;
-      DEBUG ((
-        DEBUG_INFO,
-        "INFO: Object 0x%x. Status = %r\n",
-        CmObjectId,
-        Status
-        ));
-      break;
-    }
-  }//switch
+  CmObject->ObjectId = CmObjectId;
 
-  return Status;
+  if ((Token != CM_NULL_TOKEN) && (Entry->HandlerProc != NULL)) {
+    Status = Entry->HandlerProc (This, CmObjectId, Token, CmObject);
+    DEBUG ((
+      DEBUG_INFO,
+      "Object 0x%x: Token = 0x%p, Ptr = 0x%p, Size = %d, Count = %d\n",
+      CmObjectId,
+      (VOID*)Token,
+      CmObject->Data,
+      CmObject->Size,
+      CmObject->Count
+      ));
+    return Status;
+  }
+
+  if (Entry->Data == NULL) {
+    DEBUG ((
+      DEBUG_ERROR,
+      "Object 0x%x: CM_NULL_TOKEN value is not allowed when searching"
+      " the entire platform repository.\n",
+      CmObjectId
+      ));
+    return EFI_INVALID_PARAMETER;
+  }
+
+  CmObject->Size = Entry->Size;
+  CmObject->Data = (VOID*)Entry->Data;
+  CmObject->Count = Entry->Count;
+  DEBUG ((
+    DEBUG_INFO,
+    "Object 0x%x: Ptr = 0x%p, Size = %d, Count = %d\n",
+    CmObjectId,
+    CmObject->Data,
+    CmObject->Size,
+    CmObject->Count
+    ));
+  return EFI_SUCCESS;
 }
 
 /** Return an OEM namespace object.
@@ -1117,7 +1111,7 @@ EDKII_CONFIGURATION_MANAGER_PROTOCOL ArmJunoPlatformConfigManagerProtocol = {
   CREATE_REVISION (1, 0),
   ArmJunoPlatformGetObject,
   ArmJunoPlatformSetObject,
-  &ArmJunoPlatformRepositoryInfo
+  (EDKII_PLATFORM_REPOSITORY_INFO*)&ArmJunoPlatformRepositoryInfo
 };
 
 /**
@@ -171,6 +171,43 @@
     break;                                                                  \
   }
 
+/** A function that returns the configuration manager object(s)
+    identified by a token.
+*/
+typedef
+EFI_STATUS
+(EFIAPI *CM_OBJECT_HANDLER_PROC) (
+  IN  CONST EDKII_CONFIGURATION_MANAGER_PROTOCOL  * CONST This,
+  IN  CONST CM_OBJECT_ID                                  CmObjectId,
+  IN  CONST CM_OBJECT_TOKEN                               Token,
+  IN  OUT   CM_OBJ_DESCRIPTOR                     * CONST CmObject
+  );
+
+/** An entry in the constant table of configuration manager objects,
+    indexed by object ID.
+
+  Data, Size and Count describe the object(s) returned for CM_NULL_TOKEN.
+  If HandlerProc is not NULL, it is called for any other token; an entry
+  with a HandlerProc and no Data does not accept CM_NULL_TOKEN.
+*/
+typedef struct CmObjectTableEntry {
+  CONST VOID              * Data;
+  UINT32                    Size;
+  UINT32                    Count;
+  CM_OBJECT_HANDLER_PROC    HandlerProc;
+} CM_OBJECT_TABLE_ENTRY;
+
+/** A helper macro for populating a configuration manager object table entry
+    that describes a field of the platform repository.
+*/
+#define CM_OBJECT_TABLE_ENTRY_INIT(Object, ObjectCount, HandlerProc)    \
+  {                                                                     \
+    &ArmJunoPlatformRepositoryInfo.Object,                              \
+    sizeof (ArmJunoPlatformRepositoryInfo.Object),                      \
+    ObjectCount,                                                        \
+    HandlerProc                                                         \
+  }
+
 /** The number of CPUs
 */
 #define PLAT_CPU_COUNT          6
@@ -299,9 +336,6 @@ typedef struct PlatformRepositoryInfo {
 
   // 'LITTLE' core private resources
   CM_ARM_OBJ_REF                        LittleCoreResources[LITTLE_CORE_RESOURCE_COUNT];
-
-  /// Juno Board Revision
-  UINT32                                JunoRevision;
 } EDKII_PLATFORM_REPOSITORY_INFO;
 
 #endif // CONFIGURATION_MANAGER_H__
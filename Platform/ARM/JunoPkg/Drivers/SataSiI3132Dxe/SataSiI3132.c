@@ -17,6 +17,7 @@
 #include "SataSiI3132.h"
 
 #include <IndustryStandard/Acpi10.h>
+#include <IndustryStandard/Atapi.h>
 
 #include <Library/MemoryAllocationLib.h>
 #include <Library/UefiBootServicesTableLib.h>
@@ -55,7 +56,7 @@ SataSiI3132PortConstructor (
   Port->Instance = SataSiI3132Instance;
   InitializeListHead (&(Port->Devices));
 
-  NumberOfBytes = sizeof (SATA_SI3132_PRB);
+  NumberOfBytes = sizeof (SATA_SI3132_PRB) * SII3132_PORT_SLOTS;
   Status = SataSiI3132Instance->PciIo->AllocateBuffer (
              SataSiI3132Instance->PciIo, AllocateAnyPages, EfiBootServicesData,
              EFI_SIZE_TO_PAGES (NumberOfBytes), &HostPRB, 0
@@ -77,6 +78,7 @@ SataSiI3132PortConstructor (
   Port->HostPRB            = HostPRB;
   Port->PhysAddrHostPRB    = PhysAddrHostPRB;
   Port->PciAllocMappingPRB = PciAllocMappingPRB;
+  Port->ActiveSlots        = 0;
 
   return Status;
 }
@@ -90,6 +92,7 @@ SataSiI3132Constructor (
 {
   SATA_SI3132_INSTANCE    *Instance;
   EFI_ATA_PASS_THRU_MODE  *AtaPassThruMode;
+  EFI_STATUS              Status;
 
   if (!SataSiI3132Instance) {
     return EFI_INVALID_PARAMETER;
@@ -104,9 +107,25 @@ SataSiI3132Constructor (
   Instance->PciIo               = PciIo;
 
   AtaPassThruMode = (EFI_ATA_PASS_THRU_MODE*)AllocatePool (sizeof (EFI_ATA_PASS_THRU_MODE));
-  AtaPassThruMode->Attributes = EFI_ATA_PASS_THRU_ATTRIBUTES_PHYSICAL | EFI_ATA_PASS_THRU_ATTRIBUTES_LOGICAL;
+  AtaPassThruMode->Attributes = EFI_ATA_PASS_THRU_ATTRIBUTES_PHYSICAL | EFI_ATA_PASS_THRU_ATTRIBUTES_LOGICAL |
+                                EFI_ATA_PASS_THRU_ATTRIBUTES_NONBLOCKIO;
   AtaPassThruMode->IoAlign = 0x1000;
 
+  // Timer used to complete the non-blocking commands. It is only armed while
+  // such commands are in flight.
+  Status = gBS->CreateEvent (
+                  EVT_TIMER | EVT_NOTIFY_SIGNAL,
+                  TPL_NOTIFY,
+                  SiI3132AsyncPoll,
+                  Instance,
+                  &Instance->AsyncPollEvent
+                  );
+  if (EFI_ERROR (Status)) {
+    FreePool (AtaPassThruMode);
+    FreePool (Instance);
+    return Status;
+  }
+
   // Initialize SiI3132 ports
   SataSiI3132PortConstructor (Instance, 0);
   SataSiI3132PortConstructor (Instance, 1);
@@ -126,6 +145,35 @@ SataSiI3132Constructor (
   return EFI_SUCCESS;
 }
 
+STATIC
+VOID
+SiI3132SoftResetPacket (
+  OUT EFI_ATA_PASS_THRU_COMMAND_PACKET  *Packet,
+  IN  EFI_ATA_STATUS_BLOCK              *Asb,
+  IN  EFI_ATA_COMMAND_BLOCK             *Acb
+  )
+{
+  ZeroMem (Packet, sizeof (EFI_ATA_PASS_THRU_COMMAND_PACKET));
+  ZeroMem (Acb, sizeof (EFI_ATA_COMMAND_BLOCK));
+
+  Acb->Reserved1[1] = 0;
+
+  Packet->Asb      = Asb;
+  Packet->Acb      = Acb;
+  Packet->Timeout  = 100000;
+  Packet->Protocol = EFI_ATA_PASS_THRU_PROTOCOL_ATA_SOFTWARE_RESET;
+}
+
+STATIC
+UINT32
+SiI3132SignatureFromAsb (
+  IN EFI_ATA_STATUS_BLOCK *Asb
+  )
+{
+  return (Asb->AtaCylinderHigh << 24) | (Asb->AtaCylinderLow << 16) |
+         (Asb->AtaSectorNumber << 8 ) | (Asb->AtaSectorCount);
+}
+
 EFI_STATUS
 SiI3132SoftResetCommand (
   IN   SATA_SI3132_PORT *Port,
@@ -138,78 +186,97 @@ SiI3132SoftResetCommand (
   EFI_ATA_COMMAND_BLOCK             Acb;
   CONST UINT16                      PortMultiplierPort = 0;
 
-  ZeroMem (&Acb, sizeof (EFI_ATA_COMMAND_BLOCK));
-
-  Acb.Reserved1[1] = 0;
-
-  Packet.Asb      = &Asb;
-  Packet.Acb      = &Acb;
-  Packet.Timeout  = 100000;
-  Packet.Protocol = EFI_ATA_PASS_THRU_PROTOCOL_ATA_SOFTWARE_RESET;
+  SiI3132SoftResetPacket (&Packet, &Asb, &Acb);
 
   Status = SiI3132AtaPassThruCommand (Port->Instance, Port, PortMultiplierPort, &Packet, 0);
 
   if (Status == EFI_SUCCESS) {
-    *Signature = (Asb.AtaCylinderHigh << 24) | (Asb.AtaCylinderLow << 16) |
-                 (Asb.AtaSectorNumber << 8 ) | (Asb.AtaSectorCount);
+    *Signature = SiI3132SignatureFromAsb (&Asb);
   }
   return Status;
 }
 
+/**
+  Create the device described by the signature returned by the soft reset
+  of the port.
+**/
+STATIC
 EFI_STATUS
-SataSiI3132PortInitialization (
+SataSiI3132PortAddDevice (
+  IN SATA_SI3132_PORT *Port,
+  IN UINT32           Signature
+  )
+{
+  SATA_SI3132_DEVICE*     Device;
+
+  if (Signature == SII3132_PORT_SIGNATURE_PMP) {
+    SATA_TRACE ("SataSiI3132PortInitialization(): a Port Multiplier is present");
+    if (FeaturePcdGet (PcdSataSiI3132FeaturePMPSupport)) {
+      ASSERT (0); // Not supported yet
+    } else {
+      return EFI_UNSUPPORTED;
+    }
+  } else if (Signature == SII3132_PORT_SIGNATURE_ATAPI) {
+    ASSERT (0); // Not supported yet
+    SATA_TRACE ("SataSiI3132PortInitialization(): an ATAPI device is present");
+    return EFI_UNSUPPORTED;
+  } else if (Signature == SII3132_PORT_SIGNATURE_ATA) {
+    SATA_TRACE ("SataSiI3132PortInitialization(): an ATA device is present");
+  } else {
+    SATA_TRACE ("SataSiI3132PortInitialization(): Present device unknown!");
+    ASSERT (0); // Not supported
+    return EFI_UNSUPPORTED;
+  }
+
+  // Create Device
+  Device            = (SATA_SI3132_DEVICE*)AllocatePool (sizeof (SATA_SI3132_DEVICE));
+  Device->Index     = Port->Index; //TODO: Could need to be fixed when SATA Port Multiplier support
+  Device->Port      = Port;
+  Device->BlockSize = 0;
+
+  // Attached the device to the Sata Port
+  InsertTailList (&Port->Devices, &Device->Link);
+
+  SATA_TRACE ("SataSiI3132PortInitialization(): Port Ready");
+  return EFI_SUCCESS;
+}
+
+STATIC
+BOOLEAN
+SataSiI3132PortDevicePresent (
   IN SATA_SI3132_PORT *Port
   )
 {
   UINT32                  Value32;
-  SATA_SI3132_DEVICE*     Device;
-  UINT32                  Signature;
   EFI_STATUS              Status;
   EFI_PCI_IO_PROTOCOL*    PciIo;
 
+  PciIo = Port->Instance->PciIo;
+
+  Status = SATA_PORT_READ32 (Port->RegBase + SII3132_PORT_SSTATUS_REG, &Value32);
+  return !EFI_ERROR (Status) && (Value32 & 0x3);
+}
+
+EFI_STATUS
+SataSiI3132PortInitialization (
+  IN SATA_SI3132_PORT *Port
+  )
+{
+  UINT32                  Signature;
+  EFI_STATUS              Status;
+
   Status = SiI3132HwResetPort (Port);
   if (EFI_ERROR (Status)) {
     return Status;
   }
 
-  PciIo = Port->Instance->PciIo;
-
   // Is a device is present ?
-  Status = SATA_PORT_READ32 (Port->RegBase + SII3132_PORT_SSTATUS_REG, &Value32);
-  if (!EFI_ERROR (Status) && (Value32 & 0x3)) {
+  if (SataSiI3132PortDevicePresent (Port)) {
     // Do a soft reset to see if it is a port multiplier
     SATA_TRACE ("SataSiI3132PortInitialization: soft reset - it is a port multiplier\n");
     Status = SiI3132SoftResetCommand (Port, &Signature);
     if (!EFI_ERROR (Status)) {
-      if (Signature == SII3132_PORT_SIGNATURE_PMP) {
-        SATA_TRACE ("SataSiI3132PortInitialization(): a Port Multiplier is present");
-        if (FeaturePcdGet (PcdSataSiI3132FeaturePMPSupport)) {
-          ASSERT (0); // Not supported yet
-        } else {
-          return EFI_UNSUPPORTED;
-        }
-      } else if (Signature == SII3132_PORT_SIGNATURE_ATAPI) {
-        ASSERT (0); // Not supported yet
-        SATA_TRACE ("SataSiI3132PortInitialization(): an ATAPI device is present");
-        return EFI_UNSUPPORTED;
-      } else if (Signature == SII3132_PORT_SIGNATURE_ATA) {
-        SATA_TRACE ("SataSiI3132PortInitialization(): an ATA device is present");
-      } else {
-        SATA_TRACE ("SataSiI3132PortInitialization(): Present device unknown!");
-        ASSERT (0); // Not supported
-        return EFI_UNSUPPORTED;
-      }
-
-      // Create Device
-      Device            = (SATA_SI3132_DEVICE*)AllocatePool (sizeof (SATA_SI3132_DEVICE));
-      Device->Index     = Port->Index; //TODO: Could need to be fixed when SATA Port Multiplier support
-      Device->Port      = Port;
-      Device->BlockSize = 0;
-
-      // Attached the device to the Sata Port
-      InsertTailList (&Port->Devices, &Device->Link);
-
-      SATA_TRACE ("SataSiI3132PortInitialization(): Port Ready");
+      Status = SataSiI3132PortAddDevice (Port, Signature);
     }
   }
   return Status;
@@ -220,8 +287,14 @@ SataSiI3132Initialization (
   IN SATA_SI3132_INSTANCE* SataSiI3132Instance
   )
 {
-  UINTN                 Index;
-  EFI_PCI_IO_PROTOCOL*  PciIo;
+  UINTN                             Index;
+  EFI_PCI_IO_PROTOCOL*              PciIo;
+  SATA_SI3132_PORT*                 Port;
+  EFI_ATA_PASS_THRU_COMMAND_PACKET  Packet[SATA_SII3132_MAXPORT];
+  EFI_ATA_STATUS_BLOCK              Asb[SATA_SII3132_MAXPORT];
+  EFI_ATA_COMMAND_BLOCK             Acb[SATA_SII3132_MAXPORT];
+  EFI_EVENT                         Event[SATA_SII3132_MAXPORT];
+  EFI_STATUS                        Status;
 
   if (!SataSiI3132Instance) {
     return EFI_INVALID_PARAMETER;
@@ -235,8 +308,57 @@ SataSiI3132Initialization (
   // Clear Global Control Register
   SATA_GLOBAL_WRITE32 (SII3132_GLOBAL_CONTROL_REG, 0x0);
 
+  if (FeaturePcdGet (PcdSataSiI3132FeatureStaggeredSpinUp)) {
+    // Bring the ports up one after the other to limit the spin-up current
+    for (Index = 0; Index < SATA_SII3132_MAXPORT; Index++) {
+      SataSiI3132PortInitialization (&(SataSiI3132Instance->Ports[Index]));
+    }
+    return EFI_SUCCESS;
+  }
+
+  // Take all the ports out of reset together so that their links come up in parallel
+  for (Index = 0; Index < SATA_SII3132_MAXPORT; Index++) {
+    SiI3132HwResetPortStart (&(SataSiI3132Instance->Ports[Index]));
+  }
+
+  // Then issue the soft resets without waiting for each of them, so that all
+  // the devices report their signature at the same time
   for (Index = 0; Index < SATA_SII3132_MAXPORT; Index++) {
-    SataSiI3132PortInitialization (&(SataSiI3132Instance->Ports[Index]));
+    Port = &(SataSiI3132Instance->Ports[Index]);
+    Event[Index] = NULL;
+
+    if (EFI_ERROR (SiI3132HwResetPortWait (Port)) || !SataSiI3132PortDevicePresent (Port)) {
+      continue;
+    }
+
+    Status = gBS->CreateEvent (0, 0, NULL, NULL, &Event[Index]);
+    if (EFI_ERROR (Status)) {
+      Event[Index] = NULL;
+      continue;
+    }
+
+    SiI3132SoftResetPacket (&Packet[Index], &Asb[Index], &Acb[Index]);
+    Status = SiI3132AtaPassThruCommand (SataSiI3132Instance, Port, 0, &Packet[Index], Event[Index]);
+    if (EFI_ERROR (Status)) {
+      gBS->CloseEvent (Event[Index]);
+      Event[Index] = NULL;
+    }
+  }
+
+  // Collect the results
+  for (Index = 0; Index < SATA_SII3132_MAXPORT; Index++) {
+    if (Event[Index] == NULL) {
+      continue;
+    }
+
+    while (gBS->CheckEvent (Event[Index]) == EFI_NOT_READY) {
+      gBS->Stall (1);
+    }
+    gBS->CloseEvent (Event[Index]);
+
+    if ((Asb[Index].AsbStatus & ATA_STSREG_ERR) == 0) {
+      SataSiI3132PortAddDevice (&(SataSiI3132Instance->Ports[Index]), SiI3132SignatureFromAsb (&Asb[Index]));
+    }
   }
 
   return EFI_SUCCESS;
@@ -72,6 +72,16 @@
 
 #define SATA_SII3132_MAXPORT    2
 
+// Each port has 31 command slots; bit 31 of the slot status register is the
+// port 'attention' bit, set when a command has completed with an error
+#define SII3132_PORT_SLOTS              31
+#define SII3132_PORT_SLOT_ATTENTION     BIT31
+#define SII3132_PORT_SLOT_SIZE          0x80
+#define SII3132_PORT_SLOT_ASB_OFFSET    0x08
+
+// Period of the timer that completes non-blocking commands (in 100ns units)
+#define SII3132_ASYNC_POLL_INTERVAL     10000
+
 #define PRB_CTRL_ATA            0x0
 #define PRB_CTRL_PROT_OVERRIDE  0x1
 #define PRB_CTRL_RESTRANSMIT    0x2
@@ -124,6 +134,16 @@ typedef struct _SATA_SI3132_DEVICE {
     UINT32                      BlockSize;
 } SATA_SI3132_DEVICE;
 
+typedef struct _SATA_SI3132_SLOT {
+    EFI_ATA_PASS_THRU_COMMAND_PACKET  *Packet;
+    EFI_EVENT                         Event;        // NULL for blocking commands
+    VOID*                             PciAllocMapping;
+    UINT16                            PortMultiplierPort;
+    UINT64                            Timeout;      // Remaining poll intervals, 0 means no timeout
+    BOOLEAN                           Completed;
+    EFI_STATUS                        Status;
+} SATA_SI3132_SLOT;
+
 typedef struct _SATA_SI3132_PORT {
     UINTN                           Index;
     UINTN                           RegBase;
@@ -132,9 +152,13 @@ typedef struct _SATA_SI3132_PORT {
     //TODO: Support Port multiplier
     LIST_ENTRY                      Devices;
 
+    // One PRB per command slot
     SATA_SI3132_PRB*                HostPRB;
     EFI_PHYSICAL_ADDRESS            PhysAddrHostPRB;
     VOID*                           PciAllocMappingPRB;
+
+    SATA_SI3132_SLOT                Slots[SII3132_PORT_SLOTS];
+    UINT32                          ActiveSlots;
 } SATA_SI3132_PORT;
 
 typedef struct _SATA_SI3132_INSTANCE {
@@ -145,6 +169,10 @@ typedef struct _SATA_SI3132_INSTANCE {
     EFI_ATA_PASS_THRU_PROTOCOL  AtaPassThruProtocol;
 
     EFI_PCI_IO_PROTOCOL         *PciIo;
+
+    // Periodic timer completing non-blocking commands
+    EFI_EVENT                   AsyncPollEvent;
+    UINTN                       AsyncCommands;
 } SATA_SI3132_INSTANCE;
 
 #define SATA_SII3132_SIGNATURE              SIGNATURE_32('s', 'i', '3', '2')
@@ -183,6 +211,15 @@ SataSiI3132ComponentNameGetControllerName (
   );
 
 EFI_STATUS SiI3132HwResetPort (SATA_SI3132_PORT *Port);
+VOID SiI3132HwResetPortStart (SATA_SI3132_PORT *Port);
+EFI_STATUS SiI3132HwResetPortWait (SATA_SI3132_PORT *Port);
+
+VOID
+EFIAPI
+SiI3132AsyncPoll (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  );
 
 /*
  * Driver Binding Protocol Functions
@@ -16,6 +16,7 @@
 #include "SataSiI3132.h"
 
 #include <IndustryStandard/Atapi.h>
+#include <Library/BaseLib.h>
 #include <Library/DevicePathLib.h>
 
 SATA_SI3132_DEVICE*
@@ -45,6 +46,204 @@ GetSataDevice (
   return NULL;
 }
 
+/**
+  Complete a command slot: fill the packet status block, release the data
+  mapping and, for non-blocking commands, signal the caller's event and
+  free the slot. Blocking commands free their own slot once they have seen
+  it complete.
+
+  Must be called at TPL_NOTIFY.
+**/
+STATIC
+VOID
+SiI3132CompleteSlot (
+  IN SATA_SI3132_INSTANCE   *SataSiI3132Instance,
+  IN SATA_SI3132_PORT       *SataPort,
+  IN UINTN                  Slot,
+  IN EFI_STATUS             CompletionStatus
+  )
+{
+  SATA_SI3132_SLOT        *CmdSlot;
+  EFI_ATA_PASS_THRU_COMMAND_PACKET *Packet;
+  SATA_SI3132_DEVICE      *SataDevice;
+  EFI_PCI_IO_PROTOCOL     *PciIo;
+  EFI_STATUS              Status;
+
+  PciIo   = SataSiI3132Instance->PciIo;
+  CmdSlot = &SataPort->Slots[Slot];
+  Packet  = CmdSlot->Packet;
+
+  // Fill Packet Ata Status Block from the slot's LRAM
+  Status = PciIo->Mem.Read (PciIo, EfiPciIoWidthUint32, 1, // Bar 1
+      SataPort->RegBase + (Slot * SII3132_PORT_SLOT_SIZE) + SII3132_PORT_SLOT_ASB_OFFSET,
+      sizeof (EFI_ATA_STATUS_BLOCK) / 4,
+      Packet->Asb);
+  ASSERT_EFI_ERROR (Status);
+
+  if (CmdSlot->PciAllocMapping) {
+    Status = PciIo->Unmap (PciIo, CmdSlot->PciAllocMapping);
+    ASSERT (!EFI_ERROR (Status));
+    CmdSlot->PciAllocMapping = NULL;
+  }
+
+  // If the command was ATA_CMD_IDENTIFY_DRIVE then we need to update the BlockSize
+  if (!EFI_ERROR (CompletionStatus) && (Packet->Acb->AtaCommand == ATA_CMD_IDENTIFY_DRIVE)) {
+    ATA_IDENTIFY_DATA *IdentifyData = (ATA_IDENTIFY_DATA*)Packet->InDataBuffer;
+
+    // Get the corresponding Block Device
+    SataDevice = GetSataDevice (SataSiI3132Instance, SataPort->Index, CmdSlot->PortMultiplierPort);
+    ASSERT (SataDevice != NULL);
+
+    // Check logical block size
+    if ((IdentifyData->phy_logic_sector_support & BIT12) != 0) {
+      SataDevice->BlockSize = (UINT32) (((IdentifyData->logic_sector_size_hi << 16) |
+                                          IdentifyData->logic_sector_size_lo) * sizeof (UINT16));
+    } else {
+      SataDevice->BlockSize = 0x200;
+    }
+  }
+
+  CmdSlot->Status    = CompletionStatus;
+  CmdSlot->Completed = TRUE;
+
+  if (CmdSlot->Event != NULL) {
+    // Non-blocking callers only see the status block
+    if (EFI_ERROR (CompletionStatus)) {
+      Packet->Asb->AsbStatus |= ATA_STSREG_ERR;
+    }
+    SataPort->ActiveSlots &= ~(1U << Slot);
+    SataSiI3132Instance->AsyncCommands--;
+    gBS->SignalEvent (CmdSlot->Event);
+  }
+}
+
+/**
+  Abort every command in flight on a port by re-initializing it. This is
+  how the SiI3132 recovers from a command error or a timeout: the port
+  stops processing its queue until it is initialized again, so all the
+  outstanding commands are failed with CompletionStatus.
+
+  Must be called at TPL_NOTIFY.
+**/
+STATIC
+VOID
+SiI3132AbortPort (
+  IN SATA_SI3132_INSTANCE   *SataSiI3132Instance,
+  IN SATA_SI3132_PORT       *SataPort,
+  IN EFI_STATUS             CompletionStatus
+  )
+{
+  EFI_PCI_IO_PROTOCOL     *PciIo;
+  UINT32                  Value32;
+  UINTN                   Timeout;
+  UINTN                   Slot;
+
+  PciIo = SataSiI3132Instance->PciIo;
+
+  SATA_PORT_WRITE32 (SataPort->RegBase + SII3132_PORT_CONTROLSET_REG, SII3132_PORT_CONTROL_INT);
+
+  Timeout = 1000;
+  do {
+    gBS->Stall (1);
+    SATA_PORT_READ32 (SataPort->RegBase + SII3132_PORT_STATUS_REG, &Value32);
+  } while (--Timeout && !(Value32 & SII3132_PORT_STATUS_PORTREADY));
+  if (Timeout == 0) {
+    DEBUG ((EFI_D_ERROR, "SiI3132AbortPort(%d) Port not ready after initialization\n", SataPort->Index));
+  }
+
+  // Clear the pending interrupts
+  SATA_PORT_WRITE32 (SataPort->RegBase + SII3132_PORT_INTSTATUS_REG,
+                     (SII3132_PORT_INT_CMDCOMPL | SII3132_PORT_INT_CMDERR | SII3132_PORT_INT_PORTRDY) << 16);
+
+  for (Slot = 0; Slot < SII3132_PORT_SLOTS; Slot++) {
+    if ((SataPort->ActiveSlots & (1U << Slot)) && !SataPort->Slots[Slot].Completed) {
+      SiI3132CompleteSlot (SataSiI3132Instance, SataPort, Slot, CompletionStatus);
+    }
+  }
+}
+
+/**
+  Retire the commands the port has finished with.
+
+  Must be called at TPL_NOTIFY.
+**/
+STATIC
+VOID
+SiI3132PollPort (
+  IN SATA_SI3132_INSTANCE   *SataSiI3132Instance,
+  IN SATA_SI3132_PORT       *SataPort
+  )
+{
+  EFI_PCI_IO_PROTOCOL     *PciIo;
+  UINT32                  SlotStatus;
+  UINT32                  Error;
+  UINTN                   Slot;
+
+  if (SataPort->ActiveSlots == 0) {
+    return;
+  }
+
+  PciIo = SataSiI3132Instance->PciIo;
+
+  SATA_PORT_READ32 (SataPort->RegBase + SII3132_PORT_SLOTSTATUS_REG, &SlotStatus);
+  if (SlotStatus & SII3132_PORT_SLOT_ATTENTION) {
+    SATA_PORT_READ32 (SataPort->RegBase + SII3132_PORT_CMDERROR_REG, &Error);
+    DEBUG ((EFI_D_ERROR, "SiI3132AtaPassThru() CmdErr on port %d: SlotStatus:0x%X (SiI3132 Err:0x%X)\n",
+           SataPort->Index, SlotStatus, Error));
+    SiI3132AbortPort (SataSiI3132Instance, SataPort, EFI_DEVICE_ERROR);
+    return;
+  }
+
+  // Clear Command Complete, the slot status register tells us which ones are done
+  SATA_PORT_WRITE32 (SataPort->RegBase + SII3132_PORT_INTSTATUS_REG, SII3132_PORT_INT_CMDCOMPL << 16);
+
+  for (Slot = 0; Slot < SII3132_PORT_SLOTS; Slot++) {
+    if ((SataPort->ActiveSlots & (1U << Slot)) && !SataPort->Slots[Slot].Completed &&
+        !(SlotStatus & (1U << Slot))) {
+      SiI3132CompleteSlot (SataSiI3132Instance, SataPort, Slot, EFI_SUCCESS);
+    }
+  }
+}
+
+/**
+  Timer handler completing the non-blocking commands and expiring their
+  timeouts.
+**/
+VOID
+EFIAPI
+SiI3132AsyncPoll (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  SATA_SI3132_INSTANCE    *SataSiI3132Instance;
+  SATA_SI3132_PORT        *SataPort;
+  SATA_SI3132_SLOT        *CmdSlot;
+  UINTN                   Index;
+  UINTN                   Slot;
+
+  SataSiI3132Instance = (SATA_SI3132_INSTANCE*)Context;
+
+  for (Index = 0; Index < SATA_SII3132_MAXPORT; Index++) {
+    SataPort = &SataSiI3132Instance->Ports[Index];
+    SiI3132PollPort (SataSiI3132Instance, SataPort);
+
+    for (Slot = 0; Slot < SII3132_PORT_SLOTS; Slot++) {
+      CmdSlot = &SataPort->Slots[Slot];
+      if ((SataPort->ActiveSlots & (1U << Slot)) && (CmdSlot->Event != NULL) &&
+          !CmdSlot->Completed && (CmdSlot->Timeout != 0) && (--CmdSlot->Timeout == 0)) {
+        DEBUG ((EFI_D_ERROR, "SiI3132AtaPassThru() Err:Timeout on port %d slot %d\n", Index, Slot));
+        SiI3132AbortPort (SataSiI3132Instance, SataPort, EFI_TIMEOUT);
+        break;
+      }
+    }
+  }
+
+  if (SataSiI3132Instance->AsyncCommands == 0) {
+    gBS->SetTimer (SataSiI3132Instance->AsyncPollEvent, TimerCancel, 0);
+  }
+}
+
 EFI_STATUS
 EFIAPI
 SiI3132AtaPassThruCommand (
@@ -56,21 +255,47 @@ SiI3132AtaPassThruCommand (
   )
 {
   SATA_SI3132_DEVICE      *SataDevice;
-  EFI_PHYSICAL_ADDRESS    PhysInDataBuffer;
-  UINTN                   InDataBufferLength = 0;
-  EFI_PHYSICAL_ADDRESS    PhysOutDataBuffer;
-  UINTN                   OutDataBufferLength;
-  CONST UINTN             EmptySlot = 0;
+  SATA_SI3132_PRB         *Prb;
+  SATA_SI3132_SLOT        *CmdSlot;
+  EFI_PHYSICAL_ADDRESS    PhysAddrPrb;
+  EFI_PHYSICAL_ADDRESS    PhysDataBuffer;
+  UINTN                   DataBufferLength;
+  EFI_PCI_IO_PROTOCOL_OPERATION Operation;
+  VOID                    *DataBuffer;
+  UINTN                   Slot;
   UINTN                   Control = PRB_CTRL_ATA;
   UINTN                   Protocol = 0;
-  UINT32                  Value32, Error, Timeout = 0;
-  CONST UINT32            IrqMask = (SII3132_PORT_INT_CMDCOMPL | SII3132_PORT_INT_CMDERR) << 16;
+  UINT64                  Timeout;
+  BOOLEAN                 HasData = FALSE;
+  BOOLEAN                 Completed;
   EFI_STATUS              Status;
+  EFI_TPL                 OldTpl;
   VOID*                   PciAllocMapping = NULL;
   EFI_PCI_IO_PROTOCOL     *PciIo;
 
   PciIo = SataSiI3132Instance->PciIo;
-  ZeroMem (SataPort->HostPRB, sizeof (SATA_SI3132_PRB));
+
+  // The slot bookkeeping is shared with the completion timer
+  OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+
+  // Find a free command slot
+  for (Slot = 0; Slot < SII3132_PORT_SLOTS; Slot++) {
+    if (!(SataPort->ActiveSlots & (1U << Slot))) {
+      break;
+    }
+  }
+  if (Slot == SII3132_PORT_SLOTS) {
+    gBS->RestoreTPL (OldTpl);
+    return EFI_NOT_READY;
+  }
+
+  Prb         = &SataPort->HostPRB[Slot];
+  PhysAddrPrb = SataPort->PhysAddrHostPRB + (Slot * sizeof (SATA_SI3132_PRB));
+  ZeroMem (Prb, sizeof (SATA_SI3132_PRB));
+
+  DataBufferLength = 0;
+  DataBuffer       = NULL;
+  Operation        = EfiPciIoOperationBusMasterWrite;
 
   // Construct Si3132 PRB
   switch (Packet->Protocol) {
@@ -82,7 +307,7 @@ SiI3132AtaPassThruCommand (
     Control = PRB_CTRL_SRST;
 
     if (FeaturePcdGet (PcdSataSiI3132FeaturePMPSupport)) {
-        SataPort->HostPRB->Fis.Control = 0x0F;
+        Prb->Fis.Control = 0x0F;
     }
     break;
   case EFI_ATA_PASS_THRU_PROTOCOL_ATA_NON_DATA:
@@ -95,74 +320,34 @@ SiI3132AtaPassThruCommand (
     // Fixup the size for block transfer. Following UEFI Specification, 'InTransferLength' should
     // be in number of bytes. But for most data transfer commands, the value is in number of blocks
     if (Packet->Acb->AtaCommand == ATA_CMD_IDENTIFY_DRIVE) {
-      InDataBufferLength = Packet->InTransferLength;
+      DataBufferLength = Packet->InTransferLength;
     } else {
       SataDevice = GetSataDevice (SataSiI3132Instance, SataPort->Index, PortMultiplierPort);
       if (!SataDevice || (SataDevice->BlockSize == 0)) {
+        gBS->RestoreTPL (OldTpl);
         return EFI_INVALID_PARAMETER;
       }
 
-      InDataBufferLength = Packet->InTransferLength * SataDevice->BlockSize;
-    }
-
-    Status = PciIo->Map (
-               PciIo, EfiPciIoOperationBusMasterWrite,
-               Packet->InDataBuffer, &InDataBufferLength, &PhysInDataBuffer, &PciAllocMapping
-               );
-    if (EFI_ERROR (Status)) {
-      return Status;
-    }
-
-    // Construct SGEs (32-bit system)
-    SataPort->HostPRB->Sge[0].DataAddressLow = (UINT32)PhysInDataBuffer;
-    SataPort->HostPRB->Sge[0].DataAddressHigh = (UINT32)(PhysInDataBuffer >> 32);
-    SataPort->HostPRB->Sge[0].Attributes = SGE_TRM; // Only one SGE
-    SataPort->HostPRB->Sge[0].DataCount = InDataBufferLength;
-
-    // Copy the Ata Command Block
-    CopyMem (&SataPort->HostPRB->Fis, Packet->Acb, sizeof (EFI_ATA_COMMAND_BLOCK));
-
-    // Fixup the FIS
-    SataPort->HostPRB->Fis.FisType = 0x27; // Register - Host to Device FIS
-    SataPort->HostPRB->Fis.Control = 1 << 7; // Is a command
-    if (FeaturePcdGet (PcdSataSiI3132FeaturePMPSupport)) {
-      SataPort->HostPRB->Fis.Control |= PortMultiplierPort & 0xFF;
+      DataBufferLength = Packet->InTransferLength * SataDevice->BlockSize;
     }
+    DataBuffer = Packet->InDataBuffer;
+    Operation  = EfiPciIoOperationBusMasterWrite;
+    HasData    = TRUE;
     break;
   case EFI_ATA_PASS_THRU_PROTOCOL_UDMA_DATA_OUT:
   case EFI_ATA_PASS_THRU_PROTOCOL_PIO_DATA_OUT:
     SataDevice = GetSataDevice (SataSiI3132Instance, SataPort->Index, PortMultiplierPort);
     if (!SataDevice || (SataDevice->BlockSize == 0)) {
+      gBS->RestoreTPL (OldTpl);
       return EFI_INVALID_PARAMETER;
     }
 
     // Fixup the size for block transfer. Following UEFI Specification, 'InTransferLength' should
     // be in number of bytes. But for most data transfer commands, the value is in number of blocks
-    OutDataBufferLength = Packet->OutTransferLength * SataDevice->BlockSize;
-
-    Status = PciIo->Map (
-               PciIo, EfiPciIoOperationBusMasterRead,
-               Packet->OutDataBuffer, &OutDataBufferLength, &PhysOutDataBuffer, &PciAllocMapping
-               );
-    if (EFI_ERROR (Status)) {
-      return Status;
-    }
-
-    // Construct SGEs (32-bit system)
-    SataPort->HostPRB->Sge[0].DataAddressLow  = (UINT32)PhysOutDataBuffer;
-    SataPort->HostPRB->Sge[0].DataAddressHigh = (UINT32)(PhysOutDataBuffer >> 32);
-    SataPort->HostPRB->Sge[0].Attributes      = SGE_TRM; // Only one SGE
-    SataPort->HostPRB->Sge[0].DataCount       = OutDataBufferLength;
-
-    // Copy the Ata Command Block
-    CopyMem (&SataPort->HostPRB->Fis, Packet->Acb, sizeof (EFI_ATA_COMMAND_BLOCK));
-
-    // Fixup the FIS
-    SataPort->HostPRB->Fis.FisType = 0x27; // Register - Host to Device FIS
-    SataPort->HostPRB->Fis.Control = 1 << 7; // Is a command
-    if (FeaturePcdGet (PcdSataSiI3132FeaturePMPSupport)) {
-      SataPort->HostPRB->Fis.Control |= PortMultiplierPort & 0xFF;
-    }
+    DataBufferLength = Packet->OutTransferLength * SataDevice->BlockSize;
+    DataBuffer = Packet->OutDataBuffer;
+    Operation  = EfiPciIoOperationBusMasterRead;
+    HasData    = TRUE;
     break;
   case EFI_ATA_PASS_THRU_PROTOCOL_DMA:
     ASSERT (0); //TODO: Implement me!
@@ -177,7 +362,27 @@ SiI3132AtaPassThruCommand (
     ASSERT (0); //TODO: Implement me!
     break;
   case EFI_ATA_PASS_THRU_PROTOCOL_FPDMA:
-    ASSERT (0); //TODO: Implement me!
+    // Native Command Queuing: READ/WRITE FPDMA QUEUED. The transfer direction
+    // is given by the buffer the caller provided.
+    SataDevice = GetSataDevice (SataSiI3132Instance, SataPort->Index, PortMultiplierPort);
+    if (!SataDevice || (SataDevice->BlockSize == 0)) {
+      gBS->RestoreTPL (OldTpl);
+      return EFI_INVALID_PARAMETER;
+    }
+
+    Control = PRB_CTRL_PROT_OVERRIDE;
+    if (Packet->InTransferLength != 0) {
+      DataBufferLength = Packet->InTransferLength * SataDevice->BlockSize;
+      DataBuffer = Packet->InDataBuffer;
+      Operation  = EfiPciIoOperationBusMasterWrite;
+      Protocol   = PRB_PROT_NATIVE_QUEUE | PRB_PROT_READ;
+    } else {
+      DataBufferLength = Packet->OutTransferLength * SataDevice->BlockSize;
+      DataBuffer = Packet->OutDataBuffer;
+      Operation  = EfiPciIoOperationBusMasterRead;
+      Protocol   = PRB_PROT_NATIVE_QUEUE | PRB_PROT_WRITE;
+    }
+    HasData = TRUE;
     break;
   case EFI_ATA_PASS_THRU_PROTOCOL_RETURN_RESPONSE:
     ASSERT (0); //TODO: Implement me!
@@ -187,105 +392,102 @@ SiI3132AtaPassThruCommand (
     break;
   }
 
-  SataPort->HostPRB->Control = Control;
-  SataPort->HostPRB->ProtocolOverride = Protocol;
+  if (HasData) {
+    Status = PciIo->Map (
+               PciIo, Operation,
+               DataBuffer, &DataBufferLength, &PhysDataBuffer, &PciAllocMapping
+               );
+    if (EFI_ERROR (Status)) {
+      gBS->RestoreTPL (OldTpl);
+      return Status;
+    }
+
+    // Construct SGEs (32-bit system)
+    Prb->Sge[0].DataAddressLow  = (UINT32)PhysDataBuffer;
+    Prb->Sge[0].DataAddressHigh = (UINT32)(PhysDataBuffer >> 32);
+    Prb->Sge[0].Attributes      = SGE_TRM; // Only one SGE
+    Prb->Sge[0].DataCount       = DataBufferLength;
 
-  // Clear IRQ
-  SATA_PORT_WRITE32 (SataPort->RegBase + SII3132_PORT_INTSTATUS_REG, IrqMask);
+    // Copy the Ata Command Block
+    CopyMem (&Prb->Fis, Packet->Acb, sizeof (EFI_ATA_COMMAND_BLOCK));
 
-  if (!FeaturePcdGet (PcdSataSiI3132FeatureDirectCommandIssuing)) {
-    // Indirect Command Issuance
+    // Fixup the FIS
+    Prb->Fis.FisType = 0x27; // Register - Host to Device FIS
+    Prb->Fis.Control = 1 << 7; // Is a command
+    if (FeaturePcdGet (PcdSataSiI3132FeaturePMPSupport)) {
+      Prb->Fis.Control |= PortMultiplierPort & 0xFF;
+    }
+
+    // The NCQ tag (Sector Count bits 7:3) must be the slot the command is issued to
+    if (Packet->Protocol == EFI_ATA_PASS_THRU_PROTOCOL_FPDMA) {
+      Prb->Fis.Fis[8] = (UINT8)((Prb->Fis.Fis[8] & 0x7) | (Slot << 3));
+    }
+  }
 
-    //TODO: Find which slot is free (maybe use the Cmd FIFO)
-    //SATA_PORT_READ32 (SataPort->RegBase + SII3132_PORT_CMDEXECFIFO_REG, &EmptySlot);
+  Prb->Control = Control;
+  Prb->ProtocolOverride = Protocol;
+
+  CmdSlot = &SataPort->Slots[Slot];
+  CmdSlot->Packet             = Packet;
+  CmdSlot->Event              = Event;
+  CmdSlot->PciAllocMapping    = PciAllocMapping;
+  CmdSlot->PortMultiplierPort = PortMultiplierPort;
+  CmdSlot->Completed          = FALSE;
+  CmdSlot->Status             = EFI_NOT_READY;
+  // Packet->Timeout is in 100ns units, round up to the next poll interval
+  CmdSlot->Timeout            = (Packet->Timeout == 0) ? 0 :
+                                DivU64x32 (Packet->Timeout, SII3132_ASYNC_POLL_INTERVAL) + 1;
+  SataPort->ActiveSlots |= 1U << Slot;
 
-    SATA_PORT_WRITE32 (SataPort->RegBase + SII3132_PORT_CMDACTIV_REG + (EmptySlot * 8),
-                     (UINT32)(SataPort->PhysAddrHostPRB & 0xFFFFFFFF));
-    SATA_PORT_WRITE32 (SataPort->RegBase + SII3132_PORT_CMDACTIV_REG + (EmptySlot * 8) + 4,
-                     (UINT32)((SataPort->PhysAddrHostPRB >> 32) & 0xFFFFFFFF));
+  if (!FeaturePcdGet (PcdSataSiI3132FeatureDirectCommandIssuing)) {
+    // Indirect Command Issuance
+    SATA_PORT_WRITE32 (SataPort->RegBase + SII3132_PORT_CMDACTIV_REG + (Slot * 8),
+                     (UINT32)(PhysAddrPrb & 0xFFFFFFFF));
+    SATA_PORT_WRITE32 (SataPort->RegBase + SII3132_PORT_CMDACTIV_REG + (Slot * 8) + 4,
+                     (UINT32)((PhysAddrPrb >> 32) & 0xFFFFFFFF));
   } else {
     // Direct Command Issuance
     Status = PciIo->Mem.Write (PciIo, EfiPciIoWidthUint32, 1, // Bar 1
-        SataPort->RegBase + (EmptySlot * 0x80),
+        SataPort->RegBase + (Slot * SII3132_PORT_SLOT_SIZE),
         sizeof (SATA_SI3132_PRB) / 4,
-        SataPort->HostPRB);
+        Prb);
     ASSERT_EFI_ERROR (Status);
 
-    SATA_PORT_WRITE32 (SataPort->RegBase + SII3132_PORT_CMDEXECFIFO_REG, EmptySlot);
+    SATA_PORT_WRITE32 (SataPort->RegBase + SII3132_PORT_CMDEXECFIFO_REG, Slot);
   }
 
-#if 0
-  // Could need to be implemented if we run multiple command in parallel to know which slot has been completed
-  SATA_PORT_READ32 (SataPort->RegBase + SII3132_PORT_SLOTSTATUS_REG, &Value32);
-  Timeout = Packet->Timeout;
-  while (!Timeout && !Value32) {
-    gBS->Stall (1);
-    SATA_PORT_READ32 (SataPort->RegBase + SII3132_PORT_SLOTSTATUS_REG, &Value32);
-    Timeout--;
-  }
-#else
-  SATA_PORT_READ32 (SataPort->RegBase + SII3132_PORT_INTSTATUS_REG, &Value32);
-  if (!Packet->Timeout) {
-    while (!(Value32 & IrqMask)) {
-      gBS->Stall (1);
-      SATA_PORT_READ32 (SataPort->RegBase + SII3132_PORT_INTSTATUS_REG, &Value32);
-    }
-  } else {
-    Timeout = Packet->Timeout;
-    while (Timeout && !(Value32 & IrqMask)) {
-      gBS->Stall (1);
-      SATA_PORT_READ32 (SataPort->RegBase + SII3132_PORT_INTSTATUS_REG, &Value32);
-      Timeout--;
+  if (Event != NULL) {
+    // Non-blocking: the completion timer will signal Event
+    if (SataSiI3132Instance->AsyncCommands++ == 0) {
+      gBS->SetTimer (SataSiI3132Instance->AsyncPollEvent, TimerPeriodic, SII3132_ASYNC_POLL_INTERVAL);
     }
+    gBS->RestoreTPL (OldTpl);
+    return EFI_SUCCESS;
   }
-#endif
-  // Fill Packet Ata Status Block
-  Status = PciIo->Mem.Read (PciIo, EfiPciIoWidthUint32, 1, // Bar 1
-      SataPort->RegBase + 0x08,
-      sizeof (EFI_ATA_STATUS_BLOCK) / 4,
-      Packet->Asb);
-  ASSERT_EFI_ERROR (Status);
-
+  gBS->RestoreTPL (OldTpl);
 
-  if ((Packet->Timeout != 0) && (Timeout == 0)) {
-    DEBUG ((EFI_D_ERROR, "SiI3132AtaPassThru() Err:Timeout\n"));
-    //ASSERT (0);
-    return EFI_TIMEOUT;
-  } else if (Value32 & (SII3132_PORT_INT_CMDERR << 16)) {
-    SATA_PORT_READ32 (SataPort->RegBase + SII3132_PORT_CMDERROR_REG, &Error);
-    DEBUG ((EFI_D_ERROR, "SiI3132AtaPassThru() CmdErr:0x%X (SiI3132 Err:0x%X)\n", Value32, Error));
-    ASSERT (0);
-    return EFI_DEVICE_ERROR;
-  } else if (Value32 & (SII3132_PORT_INT_CMDCOMPL << 16)) {
-    // Clear Command Complete
-    SATA_PORT_WRITE32 (SataPort->RegBase + SII3132_PORT_INTSTATUS_REG, SII3132_PORT_INT_CMDCOMPL << 16);
-
-    if (PciAllocMapping) {
-      Status = PciIo->Unmap (PciIo, PciAllocMapping);
-      ASSERT (!EFI_ERROR (Status));
+  // Blocking: wait for our slot, other slots may complete meanwhile
+  Timeout = Packet->Timeout;
+  do {
+    OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+    SiI3132PollPort (SataSiI3132Instance, SataPort);
+    Completed = CmdSlot->Completed;
+    if (!Completed && (Packet->Timeout != 0) && (--Timeout == 0)) {
+      DEBUG ((EFI_D_ERROR, "SiI3132AtaPassThru() Err:Timeout\n"));
+      SiI3132AbortPort (SataSiI3132Instance, SataPort, EFI_TIMEOUT);
+      Completed = TRUE;
     }
+    if (Completed) {
+      SataPort->ActiveSlots &= ~(1U << Slot);
+    }
+    gBS->RestoreTPL (OldTpl);
 
-    // If the command was ATA_CMD_IDENTIFY_DRIVE then we need to update the BlockSize
-    if (Packet->Acb->AtaCommand == ATA_CMD_IDENTIFY_DRIVE) {
-      ATA_IDENTIFY_DATA *IdentifyData = (ATA_IDENTIFY_DATA*)Packet->InDataBuffer;
-
-      // Get the corresponding Block Device
-      SataDevice = GetSataDevice (SataSiI3132Instance, SataPort->Index, PortMultiplierPort);
-
-      // Check logical block size
-      if ((IdentifyData->phy_logic_sector_support & BIT12) != 0) {
-        ASSERT (SataDevice != NULL);
-        SataDevice->BlockSize = (UINT32) (((IdentifyData->logic_sector_size_hi << 16) |
-                                            IdentifyData->logic_sector_size_lo) * sizeof (UINT16));
-      } else {
-        SataDevice->BlockSize = 0x200;
-      }
+    if (!Completed) {
+      gBS->Stall (1);
     }
-    return EFI_SUCCESS;
-  } else {
-    ASSERT (0);
-    return EFI_DEVICE_ERROR;
-  }
+  } while (!Completed);
+
+  return CmdSlot->Status;
 }
 
 /**
@@ -653,16 +855,20 @@ SiI3132GetDevice (
   }
 }
 
-EFI_STATUS
-SiI3132HwResetPort (
+/**
+  Take the port out of reset. This does not wait for the port to become
+  ready, see SiI3132HwResetPortWait(), so that several ports can bring up
+  their link at the same time.
+**/
+VOID
+SiI3132HwResetPortStart (
   IN SATA_SI3132_PORT *SataPort
   )
 {
   EFI_PCI_IO_PROTOCOL *PciIo;
   UINT32              Value32;
-  UINTN               Timeout;
 
-  SATA_TRACE ("SiI3132HwResetPort()");
+  SATA_TRACE ("SiI3132HwResetPortStart()");
 
   PciIo = SataPort->Instance->PciIo;
 
@@ -682,6 +888,22 @@ SiI3132HwResetPort (
 
   // Clear IRQ
   SATA_PORT_WRITE32 (SataPort->RegBase + SII3132_PORT_ENABLEINT_REG, SII3132_PORT_INT_CMDCOMPL | SII3132_PORT_INT_CMDERR | SII3132_PORT_INT_PORTRDY | (1 << 3));
+}
+
+/**
+  Wait for a port taken out of reset by SiI3132HwResetPortStart() to
+  become ready.
+**/
+EFI_STATUS
+SiI3132HwResetPortWait (
+  IN SATA_SI3132_PORT *SataPort
+  )
+{
+  EFI_PCI_IO_PROTOCOL *PciIo;
+  UINT32              Value32;
+  UINTN               Timeout;
+
+  PciIo = SataPort->Instance->PciIo;
 
   // Wait until Port Ready
   SATA_PORT_READ32 (SataPort->RegBase + SII3132_PORT_INTSTATUS_REG, &Value32);
@@ -695,16 +917,27 @@ SiI3132HwResetPort (
   SATA_PORT_WRITE32 (SataPort->RegBase + SII3132_PORT_INTSTATUS_REG, SII3132_PORT_INT_PORTRDY);
 
   if (Timeout == 0) {
-    SATA_TRACE ("SiI3132HwResetPort(): Timeout");
+    SATA_TRACE ("SiI3132HwResetPortWait(): Timeout");
     return EFI_TIMEOUT;
   } else if ((Value32 & SII3132_PORT_INT_PORTRDY) == 0) {
-    SATA_TRACE ("SiI3132HwResetPort(): Port Not Ready");
+    SATA_TRACE ("SiI3132HwResetPortWait(): Port Not Ready");
     return EFI_DEVICE_ERROR;
   } else {
     return EFI_SUCCESS;
   }
 }
 
+EFI_STATUS
+SiI3132HwResetPort (
+  IN SATA_SI3132_PORT *SataPort
+  )
+{
+  SATA_TRACE ("SiI3132HwResetPort()");
+
+  SiI3132HwResetPortStart (SataPort);
+  return SiI3132HwResetPortWait (SataPort);
+}
+
 /**
   Resets a specific port on the ATA controller. This operation also resets all the ATA devices
   connected to the port.
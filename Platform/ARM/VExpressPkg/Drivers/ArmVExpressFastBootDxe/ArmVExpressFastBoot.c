@@ -31,12 +31,41 @@
 #define IS_ALPHA(Char) (((Char) <= L'z' && (Char) >= L'a') || \
                         ((Char) <= L'Z' && (Char) >= L'Z'))
 
+/* See sparse_format.h in AOSP  */
+#define SPARSE_HEADER_MAGIC       0xed26ff3a
+#define CHUNK_TYPE_RAW            0xCAC1
+#define CHUNK_TYPE_FILL           0xCAC2
+#define CHUNK_TYPE_DONT_CARE      0xCAC3
+#define CHUNK_TYPE_CRC32          0xCAC4
+
+// Largest single write issued for a FILL chunk
+#define SPARSE_FILL_BUFFER_SIZE   SIZE_1MB
+
 typedef struct _FASTBOOT_PARTITION_LIST {
   LIST_ENTRY  Link;
   CHAR16      PartitionName[PARTITION_NAME_MAX_LENGTH];
   EFI_HANDLE  PartitionHandle;
 } FASTBOOT_PARTITION_LIST;
 
+typedef struct _SPARSE_HEADER {
+  UINT32    Magic;
+  UINT16    MajorVersion;
+  UINT16    MinorVersion;
+  UINT16    FileHeaderSize;
+  UINT16    ChunkHeaderSize;
+  UINT32    BlockSize;
+  UINT32    TotalBlocks;
+  UINT32    TotalChunks;
+  UINT32    ImageChecksum;
+} SPARSE_HEADER;
+
+typedef struct _CHUNK_HEADER {
+  UINT16    ChunkType;
+  UINT16    Reserved1;
+  UINT32    ChunkSize;
+  UINT32    TotalSize;
+} CHUNK_HEADER;
+
 STATIC LIST_ENTRY mPartitionListHead;
 
 /*
@@ -307,9 +336,154 @@ ArmFastbootPlatformUnInit (
   FreePartitionList ();
 }
 
+/*
+  Write an Android sparse image to a partition. RAW chunks are written straight
+  from the download buffer, FILL chunks are expanded into a fill buffer and
+  written in runs of up to SPARSE_FILL_BUFFER_SIZE bytes, and DONT_CARE chunks
+  are skipped so the blocks they cover are not rewritten.
+
+  @param[in] DiskIo         Disk IO protocol of the partition.
+  @param[in] MediaId        Media ID of the partition.
+  @param[in] PartitionSize  Size of the partition in bytes.
+  @param[in] Size           Size of Image in bytes.
+  @param[in] Image          The sparse image.
+
+  @retval EFI_INVALID_PARAMETER  The sparse image is malformed.
+  @retval EFI_VOLUME_FULL        The expanded image does not fit in the partition.
+  @retval EFI_DEVICE_ERROR       Flashing failed.
+*/
+STATIC
+EFI_STATUS
+FlashSparseImage (
+  IN EFI_DISK_IO_PROTOCOL  *DiskIo,
+  IN UINT32                 MediaId,
+  IN UINT64                 PartitionSize,
+  IN UINTN                  Size,
+  IN UINT8                 *Image
+  )
+{
+  EFI_STATUS      Status;
+  SPARSE_HEADER  *SparseHeader;
+  CHUNK_HEADER   *ChunkHeader;
+  UINT32          Chunk;
+  UINT8          *Data;
+  UINT8          *End;
+  UINT64          Offset;
+  UINT64          ChunkBytes;
+  UINTN           DataSize;
+  UINTN           WriteSize;
+  UINT32         *FillBuffer;
+  UINT32          FillValue;
+  BOOLEAN         FillReady;
+
+  SparseHeader = (SPARSE_HEADER *) Image;
+  End          = Image + Size;
+
+  if (SparseHeader->MajorVersion != 1 ||
+      SparseHeader->FileHeaderSize < sizeof (SPARSE_HEADER) ||
+      SparseHeader->ChunkHeaderSize < sizeof (CHUNK_HEADER) ||
+      SparseHeader->BlockSize == 0 ||
+      SparseHeader->BlockSize % sizeof (UINT32) != 0 ||
+      SparseHeader->FileHeaderSize > Size) {
+    DEBUG ((EFI_D_ERROR, "Sparse image version %d.%d not supported or bad header.\n",
+      SparseHeader->MajorVersion, SparseHeader->MinorVersion));
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (PartitionSize < MultU64x32 (SparseHeader->TotalBlocks, SparseHeader->BlockSize)) {
+    DEBUG ((EFI_D_ERROR, "Partition not big enough.\n"));
+    return EFI_VOLUME_FULL;
+  }
+
+  FillBuffer = NULL;
+  FillReady  = FALSE;
+  FillValue  = 0;
+  Status     = EFI_SUCCESS;
+  Offset     = 0;
+  Data       = Image + SparseHeader->FileHeaderSize;
+
+  for (Chunk = 0; Chunk < SparseHeader->TotalChunks; Chunk++) {
+    if ((UINTN) (End - Data) < SparseHeader->ChunkHeaderSize) {
+      Status = EFI_INVALID_PARAMETER;
+      break;
+    }
+    ChunkHeader = (CHUNK_HEADER *) Data;
+    if (ChunkHeader->TotalSize < SparseHeader->ChunkHeaderSize ||
+        (UINTN) (End - Data) < ChunkHeader->TotalSize) {
+      Status = EFI_INVALID_PARAMETER;
+      break;
+    }
+    Data    += SparseHeader->ChunkHeaderSize;
+    DataSize = ChunkHeader->TotalSize - SparseHeader->ChunkHeaderSize;
+
+    ChunkBytes = MultU64x32 (ChunkHeader->ChunkSize, SparseHeader->BlockSize);
+    if (Offset + ChunkBytes > PartitionSize) {
+      Status = EFI_VOLUME_FULL;
+      break;
+    }
+
+    switch (ChunkHeader->ChunkType) {
+    case CHUNK_TYPE_RAW:
+      if (DataSize != ChunkBytes) {
+        Status = EFI_INVALID_PARAMETER;
+        break;
+      }
+      Status = DiskIo->WriteDisk (DiskIo, MediaId, Offset, DataSize, Data);
+      break;
+
+    case CHUNK_TYPE_FILL:
+      if (DataSize < sizeof (UINT32)) {
+        Status = EFI_INVALID_PARAMETER;
+        break;
+      }
+      if (FillBuffer == NULL) {
+        FillBuffer = AllocatePool (SPARSE_FILL_BUFFER_SIZE);
+        if (FillBuffer == NULL) {
+          Status = EFI_OUT_OF_RESOURCES;
+          break;
+        }
+      }
+      if (!FillReady || FillValue != ReadUnaligned32 ((UINT32 *) Data)) {
+        FillValue = ReadUnaligned32 ((UINT32 *) Data);
+        SetMem32 (FillBuffer, SPARSE_FILL_BUFFER_SIZE, FillValue);
+        FillReady = TRUE;
+      }
+      while (ChunkBytes > 0 && !EFI_ERROR (Status)) {
+        WriteSize = (UINTN) MIN (ChunkBytes, SPARSE_FILL_BUFFER_SIZE);
+        Status = DiskIo->WriteDisk (DiskIo, MediaId, Offset, WriteSize, FillBuffer);
+        Offset     += WriteSize;
+        ChunkBytes -= WriteSize;
+      }
+      break;
+
+    case CHUNK_TYPE_DONT_CARE:
+    case CHUNK_TYPE_CRC32:
+      break;
+
+    default:
+      DEBUG ((EFI_D_ERROR, "Unknown sparse chunk type: 0x%x\n", ChunkHeader->ChunkType));
+      Status = EFI_INVALID_PARAMETER;
+      break;
+    }
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+
+    Offset += ChunkBytes;
+    Data   += DataSize;
+  }
+
+  if (FillBuffer != NULL) {
+    FreePool (FillBuffer);
+  }
+
+  return Status;
+}
+
 /*
   Flash the partition named (according to a platform-specific scheme)
   PartitionName, with the image pointed to by Buffer, whose size is BufferSize.
+  Android sparse images are expanded on the fly, see FlashSparseImage.
 
   @param[in] PartitionName  Null-terminated name of partition to write.
   @param[in] BufferSize     Size of Buffer in byets.
@@ -334,6 +508,7 @@ ArmFastbootPlatformFlashPartition (
   FASTBOOT_PARTITION_LIST *Entry;
   CHAR16                   PartitionNameUnicode[60];
   BOOLEAN                  PartitionFound;
+  BOOLEAN                  IsSparse;
 
   AsciiStrToUnicodeStrS (PartitionName, PartitionNameUnicode,
     ARRAY_SIZE (PartitionNameUnicode));
@@ -368,7 +543,9 @@ ArmFastbootPlatformFlashPartition (
 
   // Check image will fit on device
   PartitionSize = (BlockIo->Media->LastBlock + 1) * BlockIo->Media->BlockSize;
-  if (PartitionSize < Size) {
+  IsSparse = Size >= sizeof (SPARSE_HEADER) &&
+             ((SPARSE_HEADER *) Image)->Magic == SPARSE_HEADER_MAGIC;
+  if (!IsSparse && PartitionSize < Size) {
     DEBUG ((EFI_D_ERROR, "Partition not big enough.\n"));
     DEBUG ((EFI_D_ERROR, "Partition Size:\t%d\nImage Size:\t%d\n", PartitionSize, Size));
 
@@ -387,7 +564,11 @@ ArmFastbootPlatformFlashPartition (
                   );
   ASSERT_EFI_ERROR (Status);
 
-  Status = DiskIo->WriteDisk (DiskIo, MediaId, 0, Size, Image);
+  if (IsSparse) {
+    Status = FlashSparseImage (DiskIo, MediaId, PartitionSize, Size, Image);
+  } else {
+    Status = DiskIo->WriteDisk (DiskIo, MediaId, 0, Size, Image);
+  }
   if (EFI_ERROR (Status)) {
     return Status;
   }
@@ -67,6 +67,12 @@ STATIC USB_DEVICE_TX_CALLBACK   mDataSentCallback;
 // 10 Microseconds
 #define ISP1761_INTERRUPT_POLL_PERIOD 10000
 
+// Bulk OUT data is gathered into this buffer so that all the packets found in
+// the (double-buffered) endpoint FIFO on a poll are handed to the receive
+// callback at once, instead of one allocation and callback per packet.
+#define ISP1761_RX_QUEUE_SIZE         SIZE_16KB
+STATIC UINT8 mRxQueue[ISP1761_RX_QUEUE_SIZE];
+
 STATIC
 VOID
 SelectEndpoint (
@@ -154,6 +160,48 @@ ReadEndpointBuffer (
   return EFI_SUCCESS;
 }
 
+// Read the packets waiting in the FIFO for the endpoint indexed by Endpoint
+// into the buffer pointed at by Buffer, whose size is *Size bytes.
+//
+// Stops when the FIFO is empty, when a short packet ends the transfer or when
+// there is no room left for a full packet.
+//
+// Update *Size with the number of bytes read.
+STATIC
+EFI_STATUS
+ReadEndpointPackets (
+  IN      UINT8   Endpoint,
+  IN      UINTN   MaxPacketSize,
+  IN OUT  UINTN  *Size,
+  IN OUT  VOID   *Buffer
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       NumBytesRead;
+  UINTN       PacketSize;
+
+  Status = EFI_SUCCESS;
+  NumBytesRead = 0;
+  while ((*Size - NumBytesRead) >= MaxPacketSize) {
+    PacketSize = MaxPacketSize;
+    Status = ReadEndpointBuffer (
+               Endpoint,
+               &PacketSize,
+               (UINT8 *) Buffer + NumBytesRead
+               );
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+    NumBytesRead += PacketSize;
+    if (PacketSize < MaxPacketSize) {
+      break;
+    }
+  }
+
+  *Size = NumBytesRead;
+  return Status;
+}
+
 /*
   Write an endpoint buffer. Parameters:
   Endpoint        Endpoint index (see Endpoint Index Register in datasheet)
@@ -339,8 +387,16 @@ HandleSetConfiguration (
     // register sounds like it might fix this problem, but it doesn't
     // (it's "applicable only in the DMA mode").
     WRITE_REG32 (ISP1761_BUFFER_LENGTH, EPDesc->MaxPacketSize);
-    WRITE_REG32 (ISP1761_ENDPOINT_TYPE, (EPDesc->Attributes & 0x3) |
-                                        ISP1761_ENDPOINT_TYPE_ENABLE);
+    // Double-buffer the bulk endpoints, so that the host can fill (or drain)
+    // one buffer while we're busy with the other.
+    if ((EPDesc->Attributes & 0x3) == USB_ENDPOINT_BULK) {
+      WRITE_REG32 (ISP1761_ENDPOINT_TYPE, (EPDesc->Attributes & 0x3) |
+                                          ISP1761_ENDPOINT_TYPE_DBLBUF |
+                                          ISP1761_ENDPOINT_TYPE_ENABLE);
+    } else {
+      WRITE_REG32 (ISP1761_ENDPOINT_TYPE, (EPDesc->Attributes & 0x3) |
+                                          ISP1761_ENDPOINT_TYPE_ENABLE);
+    }
   }
 
   StatusAcknowledge (ISP1761_EP0TX);
@@ -432,18 +488,27 @@ CheckInterrupts (
     HandledInterrupts |= ISP1761_DC_INTERRUPT_EP0TX;
   }
   if (DcInterrupts & ISP1761_DC_INTERRUPT_EP1RX) {
-    NumBytes = 512;
-    DataPacket = AllocatePool (NumBytes);
-    Status = ReadEndpointBuffer (ISP1761_EP1RX, &NumBytes, DataPacket);
-    if (EFI_ERROR (Status) || NumBytes == 0) {
-      if (EFI_ERROR (Status)) {
-        DEBUG ((EFI_D_ERROR, "Couldn't read EP1RX data: %r\n", Status));
+    // Drain both endpoint buffers in one go and hand everything to the
+    // receive callback as one buffer.
+    NumBytes = sizeof (mRxQueue);
+    Status = ReadEndpointPackets (
+               ISP1761_EP1RX,
+               MAX_PACKET_SIZE_BULK,
+               &NumBytes,
+               mRxQueue
+               );
+    if (EFI_ERROR (Status)) {
+      DEBUG ((EFI_D_ERROR, "Couldn't read EP1RX data: %r\n", Status));
+    }
+    if (NumBytes != 0) {
+      DataPacket = AllocateCopyPool (NumBytes, mRxQueue);
+      if (DataPacket == NULL) {
+        DEBUG ((EFI_D_ERROR, "Couldn't allocate EP1RX buffer\n"));
+      } else {
+        // Signal this event again so we poll again ASAP
+        gBS->SignalEvent (Event);
+        mDataReceivedCallback (NumBytes, DataPacket);
       }
-      FreePool (DataPacket);
-    } else {
-      // Signal this event again so we poll again ASAP
-      gBS->SignalEvent (Event);
-      mDataReceivedCallback (NumBytes, DataPacket);
     }
     HandledInterrupts |= ISP1761_DC_INTERRUPT_EP1RX;
   }
@@ -70,6 +70,7 @@
 #define ISP1761_ENDPOINT_TYPE               0x208
 #define ISP1761_ENDPOINT_TYPE_NOEMPKT       BIT4
 #define ISP1761_ENDPOINT_TYPE_ENABLE        BIT3
+#define ISP1761_ENDPOINT_TYPE_DBLBUF        BIT2
 
 #define ISP1761_INTERRUPT_CONFIG            0x210
 // Interrupt config value to only interrupt on ACK of IN and OUT tokens
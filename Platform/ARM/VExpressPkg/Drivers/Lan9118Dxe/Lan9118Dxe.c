@@ -170,6 +170,143 @@ Lan9118DxeEntry (
   return Status;
 }
 
+/*
+ *  Drop the frames waiting in the Rx ring and consider all the transmits in
+ *  flight as done, a soft reset empties the FIFOs they were tracked in.
+ */
+STATIC
+VOID
+Lan9118FlushQueues (
+  IN  LAN9118_DRIVER  *LanDriver
+  )
+{
+  LanDriver->RxRingHead = 0;
+  LanDriver->RxRingCount = 0;
+  LanDriver->TxCompletedTag = LanDriver->NextPacketTag;
+}
+
+/*
+ *  Read all the statuses present in the Tx status FIFO
+ *
+ *  Each status retires the frames up to the one it is tagged with, and makes
+ *  their buffers available to GetStatus(). Errors are only reported, the
+ *  frame is lost either way.
+ */
+STATIC
+VOID
+Lan9118DrainTxStatus (
+  IN  LAN9118_DRIVER  *LanDriver,
+  IN  UINT32          TxFifoInf
+  )
+{
+  UINT32  NumTxStatusEntries;
+  UINT32  TxStatus;
+  UINT16  PacketTag;
+
+  // (We ignore TXSTATUS_NO_CA has it might happen in Full Duplex)
+  NumTxStatusEntries = (TxFifoInf & TXFIFOINF_TXSUSED_MASK) >> 16;
+  for (; NumTxStatusEntries > 0; NumTxStatusEntries--) {
+    TxStatus = Lan9118MmioRead32 (LAN9118_TX_STATUS);
+    PacketTag = TxStatus >> 16;
+    TxStatus = TxStatus & 0xFFFF;
+    if ((TxStatus & TXSTATUS_ES) && (TxStatus != (TXSTATUS_ES | TXSTATUS_NO_CA))) {
+      DEBUG ((EFI_D_ERROR, "LAN9118: There was an error transmitting. TxStatus=0x%08x:", TxStatus));
+      if (TxStatus & TXSTATUS_NO_CA) {
+        DEBUG ((EFI_D_ERROR, "- No carrier\n"));
+      }
+      if (TxStatus & TXSTATUS_DEF) {
+        DEBUG ((EFI_D_ERROR, "- Packet tx was deferred\n"));
+      }
+      if (TxStatus & TXSTATUS_EDEF) {
+        DEBUG ((EFI_D_ERROR, "- Tx ended because of excessive deferral\n"));
+      }
+      if (TxStatus & TXSTATUS_ECOLL) {
+        DEBUG ((EFI_D_ERROR, "- Tx ended because of Excessive Collisions\n"));
+      }
+      if (TxStatus & TXSTATUS_LCOLL) {
+        DEBUG ((EFI_D_ERROR, "- Packet Tx aborted after coll window of 64 bytes\n"));
+      }
+      if (TxStatus & TXSTATUS_LOST_CA) {
+        DEBUG ((EFI_D_ERROR, "- Lost carrier during Tx\n"));
+      }
+      LanDriver->Stats.TxDroppedFrames += 1;
+    } else {
+      LanDriver->Stats.TxTotalFrames += 1;
+    }
+    LanDriver->TxCompletedTag = (UINT16)(PacketTag + 1);
+  }
+}
+
+/*
+ *  Move the frames received so far from the Rx FIFOs to the Rx ring
+ *
+ *  The Rx status FIFO level is read once, then the status word and the data
+ *  of as many frames as the ring has room for are pulled in one go.
+ */
+STATIC
+VOID
+Lan9118FillRxRing (
+  IN  LAN9118_DRIVER              *LanDriver,
+  IN  EFI_SIMPLE_NETWORK_PROTOCOL *Snp
+  )
+{
+  LAN9118_RX_FRAME  *Frame;
+  UINT32            NumPackets;
+  UINT32            RxCfgValue;
+  UINT32            ReadLimit;
+  UINT32            Count;
+
+  NumPackets = RxStatusUsedSpace (0, Snp) / 4;
+  if (NumPackets > LAN9118_RX_RING_NUM_ENTRIES - LanDriver->RxRingCount) {
+    NumPackets = LAN9118_RX_RING_NUM_ENTRIES - LanDriver->RxRingCount;
+  }
+  if (NumPackets == 0) {
+    return;
+  }
+
+  // Set end alignment to 4-bytes, the FIFO then holds whole DWORDs per frame
+  RxCfgValue = Lan9118MmioRead32 (LAN9118_RX_CFG);
+  RxCfgValue &= ~(RXCFG_RX_DMA_CNT_MASK | RXCFG_RX_END_ALIGN_MASK);
+  Lan9118MmioWrite32 (LAN9118_RX_CFG, RxCfgValue);
+
+  for (; NumPackets > 0; NumPackets--) {
+    Frame = &LanDriver->RxRing[(LanDriver->RxRingHead + LanDriver->RxRingCount) %
+                               LAN9118_RX_RING_NUM_ENTRIES];
+    Frame->Status = Lan9118MmioRead32 (LAN9118_RX_STATUS);
+    ReadLimit = (GET_RXSTATUS_PACKET_LENGTH (Frame->Status) + 3) / 4;
+
+    // The data of every frame must leave the FIFO, even if it is not kept
+    if (ReadLimit > ARRAY_SIZE (Frame->Data)) {
+      DEBUG ((EFI_D_WARN, "Warning: Frame too long for the Rx ring\n"));
+      for (Count = 0; Count < ReadLimit; Count++) {
+        Lan9118MmioRead32 (LAN9118_RX_DATA);
+      }
+      LanDriver->Stats.RxTotalFrames += 1;
+      LanDriver->Stats.RxOversizeFrames += 1;
+      LanDriver->Stats.RxDroppedFrames += 1;
+      continue;
+    }
+
+    for (Count = 0; Count < ReadLimit; Count++) {
+      Frame->Data[Count] = Lan9118MmioRead32 (LAN9118_RX_DATA);
+    }
+    LanDriver->RxRingCount++;
+  }
+}
+
+/*
+ *  Remove the oldest frame from the Rx ring
+ */
+STATIC
+VOID
+Lan9118ReleaseRxFrame (
+  IN  LAN9118_DRIVER  *LanDriver
+  )
+{
+  LanDriver->RxRingHead = (LanDriver->RxRingHead + 1) % LAN9118_RX_RING_NUM_ENTRIES;
+  LanDriver->RxRingCount--;
+}
+
 /*
  *  UEFI Start() function
  *
@@ -263,6 +400,7 @@ SnpInitialize (
   INT32      AllocResult;
   UINT32     RxStatusSize;
   UINT32     TxStatusSize;
+  LAN9118_DRIVER *LanDriver;
 
   // Initialize variables
   // Global variables to hold tx and rx FIFO allocation
@@ -298,6 +436,11 @@ SnpInitialize (
     return EFI_DEVICE_ERROR;
   }
 
+  // Start over with empty Rx and Tx rings
+  LanDriver = INSTANCE_FROM_SNP_THIS (Snp);
+  Lan9118FlushQueues (LanDriver);
+  LanDriver->TxReclaimedTag = LanDriver->NextPacketTag;
+
   // Read the PM register
   PmConf = Lan9118MmioRead32 (LAN9118_PMT_CTRL);
 
@@ -420,6 +563,7 @@ SnpReset (
     DEBUG ((EFI_D_WARN, "Warning: Soft Reset Failed: Hardware Error\n"));
     return EFI_DEVICE_ERROR;
   }
+  Lan9118FlushQueues (INSTANCE_FROM_SNP_THIS (Snp));
 
   // Read the PM register
   PmConf = Lan9118MmioRead32 (LAN9118_PMT_CTRL);
@@ -495,6 +639,7 @@ SnpShutdown (
     DEBUG ((EFI_D_WARN, "Warning: Soft Reset Failed: Hardware Error\n"));
     return Status;
   }
+  Lan9118FlushQueues (INSTANCE_FROM_SNP_THIS (Snp));
 
   // Back to the started and thus not initialized state
   Snp->Mode->State = EfiSimpleNetworkStarted;
@@ -967,9 +1112,6 @@ SnpGetStatus (
 {
   UINT32          FifoInt;
   EFI_STATUS      Status;
-  UINTN           NumTxStatusEntries;
-  UINT32          TxStatus;
-  UINT16          PacketTag;
   UINT32          Interrupts;
   LAN9118_DRIVER *LanDriver;
 
@@ -1024,41 +1166,19 @@ SnpGetStatus (
     }
   }
 
-  // Check Status of transmitted packets
-  // (We ignore TXSTATUS_NO_CA has it might happen in Full Duplex)
+  // Pass back the oldest transmitted buffer. The Tx status FIFO is only
+  // read when no buffer is known to be done already.
+  if (TxBuff != NULL) {
+    if (LanDriver->TxCompletedTag == LanDriver->TxReclaimedTag) {
+      Lan9118DrainTxStatus (LanDriver, Lan9118MmioRead32 (LAN9118_TX_FIFO_INF));
+    }
 
-  NumTxStatusEntries = Lan9118MmioRead32(LAN9118_TX_FIFO_INF) & TXFIFOINF_TXSUSED_MASK;
-  if (NumTxStatusEntries > 0) {
-    TxStatus = Lan9118MmioRead32 (LAN9118_TX_STATUS);
-    PacketTag = TxStatus >> 16;
-    TxStatus = TxStatus & 0xFFFF;
-    if ((TxStatus & TXSTATUS_ES) && (TxStatus != (TXSTATUS_ES | TXSTATUS_NO_CA))) {
-      DEBUG ((EFI_D_ERROR, "LAN9118: There was an error transmitting. TxStatus=0x%08x:", TxStatus));
-      if (TxStatus & TXSTATUS_NO_CA) {
-        DEBUG ((EFI_D_ERROR, "- No carrier\n"));
-      }
-      if (TxStatus & TXSTATUS_DEF) {
-        DEBUG ((EFI_D_ERROR, "- Packet tx was deferred\n"));
-      }
-      if (TxStatus & TXSTATUS_EDEF) {
-        DEBUG ((EFI_D_ERROR, "- Tx ended because of excessive deferral\n"));
-      }
-      if (TxStatus & TXSTATUS_ECOLL) {
-        DEBUG ((EFI_D_ERROR, "- Tx ended because of Excessive Collisions\n"));
-      }
-      if (TxStatus & TXSTATUS_LCOLL) {
-        DEBUG ((EFI_D_ERROR, "- Packet Tx aborted after coll window of 64 bytes\n"));
-      }
-      if (TxStatus & TXSTATUS_LOST_CA) {
-        DEBUG ((EFI_D_ERROR, "- Lost carrier during Tx\n"));
-      }
-      return EFI_DEVICE_ERROR;
-    } else if (TxBuff != NULL) {
-      LanDriver->Stats.TxTotalFrames += 1;
-      *TxBuff = LanDriver->TxRing[PacketTag % LAN9118_TX_RING_NUM_ENTRIES];
+    if (LanDriver->TxCompletedTag != LanDriver->TxReclaimedTag) {
+      *TxBuff = LanDriver->TxRing[LanDriver->TxReclaimedTag % LAN9118_TX_RING_NUM_ENTRIES];
+      LanDriver->TxReclaimedTag++;
+    } else {
+      *TxBuff = NULL;
     }
-  } else if (TxBuff != NULL) {
-    *TxBuff = NULL;
   }
 
   // Check for a TX Error interrupt
@@ -1072,6 +1192,7 @@ SnpGetStatus (
       DEBUG ((EFI_D_ERROR, "\n\tSoft Reset Failed: Hardware Error\n"));
       return EFI_DEVICE_ERROR;
     }
+    Lan9118FlushQueues (LanDriver);
 
     // Reactivate the LEDs
     Status = ConfigureHardware (HW_CONF_USE_LEDS, Snp);
@@ -1119,8 +1240,8 @@ SnpTransmit (
   )
 {
   LAN9118_DRIVER *LanDriver;
+  UINT32 TxFifoInf;
   UINT32 TxFreeSpace;
-  UINT32 TxStatusSpace;
   INT32 Count;
   UINT32 CommandA;
   UINT32 CommandB;
@@ -1176,16 +1297,25 @@ SnpTransmit (
     return EFI_NOT_READY;
   }*/
 
-  // Get DATA FIFO free space in bytes
-  TxFreeSpace = TxDataFreeSpace (0, Snp);
+  // Get DATA FIFO free space in bytes and STATUS FIFO usage in one read
+  TxFifoInf = Lan9118MmioRead32 (LAN9118_TX_FIFO_INF);
+  TxFreeSpace = TxFifoInf & TXFIFOINF_TDFREE_MASK;
   if (TxFreeSpace < BuffSize) {
     return EFI_NOT_READY;
   }
 
-  // Get STATUS FIFO used space in bytes
-  TxStatusSpace = TxStatusUsedSpace (0, Snp);
-  if (TxStatusSpace > 500) {
-    return EFI_NOT_READY;
+  // Retire whatever has been sent, so that transmits never wait for the
+  // consumer to collect Tx statuses through GetStatus().
+  Lan9118DrainTxStatus (LanDriver, TxFifoInf);
+
+  // Every frame in flight or waiting to be recycled holds a Tx ring slot.
+  // If the consumer is not collecting recycled buffers, give up on the
+  // oldest one rather than stalling.
+  if ((UINT16)(LanDriver->NextPacketTag - LanDriver->TxReclaimedTag) >= LAN9118_TX_RING_NUM_ENTRIES) {
+    if (LanDriver->TxCompletedTag == LanDriver->TxReclaimedTag) {
+      return EFI_NOT_READY;
+    }
+    LanDriver->TxReclaimedTag++;
   }
 
   // If DstAddr is not provided, get it from Buffer (we trust that the caller
@@ -1310,13 +1440,11 @@ SnpReceive (
   )
 {
   LAN9118_DRIVER  *LanDriver;
+  LAN9118_RX_FRAME *Frame;
   UINT32          IntSts;
   UINT32          RxFifoStatus;
-  UINT32          NumPackets;
-  UINT32          RxCfgValue;
   UINT32          PLength; // Packet length
   UINT32          ReadLimit;
-  UINT32          Count;
   UINT32          Padding;
   UINT32          *RawData;
   EFI_MAC_ADDRESS Dst;
@@ -1370,13 +1498,47 @@ SnpReceive (
   DroppedFrames = Lan9118MmioRead32 (LAN9118_RX_DROP);
   LanDriver->Stats.RxDroppedFrames += DroppedFrames;
 
-  NumPackets = RxStatusUsedSpace (0, Snp) / 4;
-  if (!NumPackets) {
-    return EFI_NOT_READY;
+  // Pull all the frames received so far once the Rx ring has been emptied
+  if (LanDriver->RxRingCount == 0) {
+    Lan9118FillRxRing (LanDriver, Snp);
+
+    // Check for Rx errors (worst possible error)
+    if (Lan9118MmioRead32 (LAN9118_INT_STS) & INSTS_RXE) {
+      DEBUG ((EFI_D_WARN, "Warning: Receiver Error. Restarting...\n"));
+
+      // Software reset, the RXE interrupt is cleared by the reset.
+      Status = SoftReset (0, Snp);
+      if (EFI_ERROR (Status)) {
+        DEBUG ((EFI_D_ERROR, "Error: Soft Reset Failed: Hardware Error.\n"));
+        return EFI_DEVICE_ERROR;
+      }
+      Lan9118FlushQueues (LanDriver);
+
+      // Reactivate the LEDs
+      Status = ConfigureHardware (HW_CONF_USE_LEDS, Snp);
+      if (EFI_ERROR (Status)) {
+        return Status;
+      }
+
+      //
+      // Restart the receiver and the transmitter without resetting the FIFOs
+      // as it has been done by SoftReset().
+      //
+      StartRx (0, Snp);
+      StartTx (START_TX_MAC | START_TX_CFG, Snp);
+
+      // Say that command could not be sent
+      return EFI_DEVICE_ERROR;
+    }
+
+    if (LanDriver->RxRingCount == 0) {
+      return EFI_NOT_READY;
+    }
   }
 
-  // Read Rx Status (only if not empty)
-  RxFifoStatus = Lan9118MmioRead32 (LAN9118_RX_STATUS);
+  // Take the oldest frame of the ring
+  Frame = &LanDriver->RxRing[LanDriver->RxRingHead];
+  RxFifoStatus = Frame->Status;
   LanDriver->Stats.RxTotalFrames += 1;
 
   // First check for errors
@@ -1388,6 +1550,7 @@ SnpReceive (
       (RxFifoStatus & RXSTATUS_DB))
   {
     DEBUG ((EFI_D_WARN, "Warning: There was an error on frame reception.\n"));
+    Lan9118ReleaseRxFrame (LanDriver);
     return EFI_DEVICE_ERROR;
   }
 
@@ -1396,6 +1559,7 @@ SnpReceive (
     DEBUG ((EFI_D_WARN, "Warning: Crc Error\n"));
     LanDriver->Stats.RxCrcErrorFrames += 1;
     LanDriver->Stats.RxDroppedFrames += 1;
+    Lan9118ReleaseRxFrame (LanDriver);
     return EFI_DEVICE_ERROR;
   }
 
@@ -1404,6 +1568,7 @@ SnpReceive (
     DEBUG ((EFI_D_WARN, "Warning: Runt Frame\n"));
     LanDriver->Stats.RxUndersizeFrames += 1;
     LanDriver->Stats.RxDroppedFrames += 1;
+    Lan9118ReleaseRxFrame (LanDriver);
     return EFI_DEVICE_ERROR;
   }
 
@@ -1441,22 +1606,13 @@ SnpReceive (
     Padding = 0;
   }
 
-  // Check buffer size
+  // Check buffer size, the frame stays in the ring for another attempt
   if (*BuffSize < (PLength + Padding)) {
     *BuffSize = PLength + Padding;
+    LanDriver->Stats.RxTotalFrames -= 1;
     return EFI_BUFFER_TOO_SMALL;
   }
 
-  // Set the amount of data to be transferred out of FIFO for THIS packet
-  // This can be used to trigger an interrupt, and status can be checked
-  RxCfgValue = Lan9118MmioRead32 (LAN9118_RX_CFG);
-  RxCfgValue &= ~(RXCFG_RX_DMA_CNT_MASK);
-  RxCfgValue |= RXCFG_RX_DMA_CNT (ReadLimit);
-
-  // Set end alignment to 4-bytes
-  RxCfgValue &= ~(RXCFG_RX_END_ALIGN_MASK);
-  Lan9118MmioWrite32 (LAN9118_RX_CFG, RxCfgValue);
-
   // Update buffer size
   *BuffSize = PLength; // -4 bytes may be needed: Received in buffer as
                        // 4 bytes longer than packet actually is, unless
@@ -1465,13 +1621,9 @@ SnpReceive (
   if (HdrSize != NULL)
     *HdrSize = Snp->Mode->MediaHeaderSize;
 
-  // Format the pointer
-  RawData = (UINT32*)Data;
-
-  // Read Rx Packet
-  for (Count = 0; Count < ReadLimit; Count++) {
-    RawData[Count] = Lan9118MmioRead32 (LAN9118_RX_DATA);
-  }
+  // Copy the Rx Packet out of the ring
+  RawData = Frame->Data;
+  CopyMem (Data, RawData, ReadLimit * 4);
 
   // Get the destination address
   if (DstAddr != NULL) {
@@ -1500,33 +1652,7 @@ SnpReceive (
     *Protocol = NTOHS (RawData[3] & 0xFFFF);
   }
 
-  // Check for Rx errors (worst possible error)
-  if (Lan9118MmioRead32 (LAN9118_INT_STS) & INSTS_RXE) {
-    DEBUG ((EFI_D_WARN, "Warning: Receiver Error. Restarting...\n"));
-
-    // Software reset, the RXE interrupt is cleared by the reset.
-    Status = SoftReset (0, Snp);
-    if (EFI_ERROR (Status)) {
-      DEBUG ((EFI_D_ERROR, "Error: Soft Reset Failed: Hardware Error.\n"));
-      return EFI_DEVICE_ERROR;
-    }
-
-    // Reactivate the LEDs
-    Status = ConfigureHardware (HW_CONF_USE_LEDS, Snp);
-    if (EFI_ERROR (Status)) {
-      return Status;
-    }
-
-    //
-    // Restart the receiver and the transmitter without resetting the FIFOs
-    // as it has been done by SoftReset().
-    //
-    StartRx (0, Snp);
-    StartTx (START_TX_MAC | START_TX_CFG, Snp);
-
-    // Say that command could not be sent
-    return EFI_DEVICE_ERROR;
-  }
+  Lan9118ReleaseRxFrame (LanDriver);
 
 #if defined(EVAL_PERFORMANCE)
   UINT64 EndClock = GetPerformanceCounter ();
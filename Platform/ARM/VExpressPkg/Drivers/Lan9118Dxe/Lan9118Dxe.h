@@ -50,6 +50,14 @@
 #define LAN9118_RX_STATUS_SIZE        704
 
 #define LAN9118_TX_RING_NUM_ENTRIES 32
+#define LAN9118_RX_RING_NUM_ENTRIES 8
+#define LAN9118_RX_FRAME_SIZE       1536  // Largest frame kept in the Rx ring, CRC included
+
+// A frame moved out of the Rx FIFOs, waiting for SnpReceive() to return it
+typedef struct {
+  UINT32  Status;
+  UINT32  Data[LAN9118_RX_FRAME_SIZE / 4];
+} LAN9118_RX_FRAME;
 
 /*------------------------------------------------------------------------------
   LAN9118 Information Structure
@@ -68,8 +76,17 @@ typedef struct {
   EFI_NETWORK_STATISTICS Stats;
 
   // Saved transmitted buffers so we can notify consumers when packets have been sent.
+  // Tags from TxReclaimedTag to TxCompletedTag have been sent and wait for
+  // GetStatus(), tags from TxCompletedTag to NextPacketTag are in flight.
   UINT16  NextPacketTag;
+  UINT16  TxCompletedTag;
+  UINT16  TxReclaimedTag;
   VOID    *TxRing[LAN9118_TX_RING_NUM_ENTRIES];
+
+  // Received frames pulled out of the Rx FIFOs in batches
+  UINTN             RxRingHead;
+  UINTN             RxRingCount;
+  LAN9118_RX_FRAME  RxRing[LAN9118_RX_RING_NUM_ENTRIES];
 } LAN9118_DRIVER;
 
 #define LAN9118_SIGNATURE                       SIGNATURE_32('l', 'a', 'n', '9')
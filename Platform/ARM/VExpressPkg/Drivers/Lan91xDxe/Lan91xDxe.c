@@ -28,6 +28,7 @@
 #include <Protocol/DevicePath.h>
 
 // Libraries used by this driver
+#include <Library/BaseLib.h>
 #include <Library/UefiLib.h>
 #include <Library/DebugLib.h>
 #include <Library/UefiBootServicesTableLib.h>
@@ -75,6 +76,9 @@ typedef struct _LAN91X_DRIVER {
   INT8              PhyAd;              // Phy Address
   UINT8             BankSel;            // Currently selected register bank
 
+  // Transmit packet allocated ahead of the next SnpTransmit() call
+  BOOLEAN           TxAllocPending;     // Allocation request issued, result not yet read
+
 } LAN91X_DRIVER;
 
 #define LAN91X_NO_PHY (-1)              // PhyAd value if PHY not detected
@@ -85,6 +89,8 @@ typedef struct _LAN91X_DRIVER {
 #define LAN91X_STALL              2
 #define LAN91X_MEMORY_ALLOC_POLLS 100   // Max times to poll for memory allocation
 #define LAN91X_PKT_OVERHEAD       6     // Overhead bytes in packet buffer
+#define LAN91X_PKT_DATA_OFFSET    4     // Status and byte count words precede the data
+#define LAN91X_TX_MAX_PAGES       7     // Largest Tx allocation, in 256-byte pages minus 1
 
 // Synchronization TPLs
 #define LAN91X_TPL  TPL_CALLBACK
@@ -735,16 +741,16 @@ SetCurrentMacAddress (
   return EFI_SUCCESS;
 }
 
+// Wait for the MMU to finish the current operation
 STATIC
 EFI_STATUS
-MmuOperation (
+MmuWaitIdle (
   IN  LAN91X_DRIVER *LanDriver,
   IN  UINTN          MmuOp
   )
 {
   UINTN   Polls;
 
-  WriteIoReg16 (LanDriver, LAN91X_MMUCR, MmuOp);
   Polls = 100;
   while ((ReadIoReg16 (LanDriver, LAN91X_MMUCR) & MMUCR_BUSY) != 0) {
     if (--Polls == 0) {
@@ -757,41 +763,135 @@ MmuOperation (
   return EFI_SUCCESS;
 }
 
+STATIC
+EFI_STATUS
+MmuOperation (
+  IN  LAN91X_DRIVER *LanDriver,
+  IN  UINTN          MmuOp
+  )
+{
+  EFI_STATUS  Status;
+
+  // An allocation issued ahead of time may still be in progress
+  Status = MmuWaitIdle (LanDriver, MmuOp);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  WriteIoReg16 (LanDriver, LAN91X_MMUCR, MmuOp);
+  return MmuWaitIdle (LanDriver, MmuOp);
+}
+
 // Read bytes from the DATA register
+//
+// Offset is the position of the first byte in the packet buffer. The head
+// and tail of the transfer use 8- and 16-bit accesses so that the bulk of
+// the data moves as a burst of 32-bit accesses on dword aligned pointers.
 STATIC
 EFI_STATUS
 ReadIoData (
   IN  LAN91X_DRIVER *LanDriver,
   IN  VOID          *Buffer,
-  IN  UINTN          BufLen
+  IN  UINTN          BufLen,
+  IN  UINTN          Offset
   )
 {
   UINT8     *Ptr;
+  UINTN      DataReg;
+
+  // The DATA register is in bank 2, select it once for the whole transfer
+  SelectIoBank (LanDriver, LAN91X_DATA0);
+  DataReg = LanDriver->IoBase + RegisterToOffset (LAN91X_DATA0);
 
   Ptr = Buffer;
-  for (; BufLen > 0; --BufLen) {
-    *Ptr = ReadIoReg8 (LanDriver, LAN91X_DATA0);
-    ++Ptr;
+  if ((BufLen > 0) && ((Offset & 1) != 0)) {
+    *Ptr = MmioRead8 (DataReg);
+    Ptr += 1;
+    BufLen -= 1;
+    Offset += 1;
+  }
+  if ((BufLen >= 2) && ((Offset & 2) != 0)) {
+    WriteUnaligned16 ((UINT16 *)Ptr, MmioRead16 (DataReg));
+    Ptr += 2;
+    BufLen -= 2;
+  }
+
+  if (((UINTN)Ptr & 3) == 0) {
+    for (; BufLen >= 4; BufLen -= 4) {
+      *(UINT32 *)Ptr = MmioRead32 (DataReg);
+      Ptr += 4;
+    }
+  } else {
+    for (; BufLen >= 4; BufLen -= 4) {
+      WriteUnaligned32 ((UINT32 *)Ptr, MmioRead32 (DataReg));
+      Ptr += 4;
+    }
+  }
+
+  if (BufLen >= 2) {
+    WriteUnaligned16 ((UINT16 *)Ptr, MmioRead16 (DataReg));
+    Ptr += 2;
+    BufLen -= 2;
+  }
+  if (BufLen > 0) {
+    *Ptr = MmioRead8 (DataReg);
   }
 
   return EFI_SUCCESS;
 }
 
 // Write bytes to the DATA register
+//
+// Offset is the position of the first byte in the packet buffer, see
+// ReadIoData().
 STATIC
 EFI_STATUS
 WriteIoData (
   IN  LAN91X_DRIVER *LanDriver,
   IN  VOID          *Buffer,
-  IN  UINTN          BufLen
+  IN  UINTN          BufLen,
+  IN  UINTN          Offset
   )
 {
   UINT8     *Ptr;
+  UINTN      DataReg;
+
+  // The DATA register is in bank 2, select it once for the whole transfer
+  SelectIoBank (LanDriver, LAN91X_DATA0);
+  DataReg = LanDriver->IoBase + RegisterToOffset (LAN91X_DATA0);
 
   Ptr = Buffer;
-  for (; BufLen > 0; --BufLen) {
-    WriteIoReg8 (LanDriver, LAN91X_DATA0, *Ptr);
-    ++Ptr;
+  if ((BufLen > 0) && ((Offset & 1) != 0)) {
+    MmioWrite8 (DataReg, *Ptr);
+    Ptr += 1;
+    BufLen -= 1;
+    Offset += 1;
+  }
+  if ((BufLen >= 2) && ((Offset & 2) != 0)) {
+    MmioWrite16 (DataReg, ReadUnaligned16 ((UINT16 *)Ptr));
+    Ptr += 2;
+    BufLen -= 2;
+  }
+
+  if (((UINTN)Ptr & 3) == 0) {
+    for (; BufLen >= 4; BufLen -= 4) {
+      MmioWrite32 (DataReg, *(UINT32 *)Ptr);
+      Ptr += 4;
+    }
+  } else {
+    for (; BufLen >= 4; BufLen -= 4) {
+      MmioWrite32 (DataReg, ReadUnaligned32 ((UINT32 *)Ptr));
+      Ptr += 4;
+    }
+  }
+
+  if (BufLen >= 2) {
+    MmioWrite16 (DataReg, ReadUnaligned16 ((UINT16 *)Ptr));
+    Ptr += 2;
+    BufLen -= 2;
+  }
+  if (BufLen > 0) {
+    MmioWrite8 (DataReg, *Ptr);
   }
 
   return EFI_SUCCESS;
@@ -874,8 +974,9 @@ SoftReset (
   Val16 |= CTR_AUTO_REL;
   WriteIoReg16 (LanDriver, LAN91X_CTR, Val16);
 
-  // Reset the MMU
+  // Reset the MMU, this also drops any Tx buffer allocated ahead of time
   MmuOperation (LanDriver, MMUCR_OP_RESET_MMU);
+  LanDriver->TxAllocPending = FALSE;
 
   return EFI_SUCCESS;
 }
@@ -1712,6 +1813,7 @@ SnpTransmit (
   EFI_STATUS       Status;
   UINT8           *Ptr;
   UINTN            Len;
+  UINTN            Offset;
   UINTN            MmuPages;
   UINTN            Retries;
   UINT16           Proto;
@@ -1771,21 +1873,28 @@ SnpTransmit (
   // Calculate the request size in 256-byte "pages" minus 1
   // The 91C111 ignores this, but some older devices need it.
   MmuPages = ((BufSize & ~1) + LAN91X_PKT_OVERHEAD - 1) >> 8;
-  if (MmuPages > 7) {
+  if (MmuPages > LAN91X_TX_MAX_PAGES) {
     DEBUG ((DEBUG_WARN, "LAN91x: Tx buffer too large (%d bytes)\n", BufSize));
     LanDriver->Stats.TxOversizeFrames += 1;
     LanDriver->Stats.TxDroppedFrames += 1;
     ReturnUnlock (EFI_BAD_BUFFER_SIZE);
   }
 
-  // Request allocation of a transmit buffer
-  Status = MmuOperation (LanDriver, MMUCR_OP_TX_ALLOC | MmuPages);
-  if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_ERROR, "LAN91x: Tx buffer request failure: %d\n", Status));
-    ReturnUnlock (EFI_DEVICE_ERROR);
+  // Request allocation of a transmit buffer, unless the previous transmit
+  // already asked for one. That request was sized for the largest frame,
+  // so it fits whatever this one is.
+  if (!LanDriver->TxAllocPending) {
+    Status = MmuOperation (LanDriver, MMUCR_OP_TX_ALLOC | MmuPages);
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "LAN91x: Tx buffer request failure: %d\n", Status));
+      ReturnUnlock (EFI_DEVICE_ERROR);
+    }
+    LanDriver->TxAllocPending = TRUE;
   }
 
-  // Wait for allocation request completion
+  // Wait for allocation request completion. The MMU keeps retrying a
+  // request it cannot satisfy yet, so leave it pending on timeout rather
+  // than issuing another one.
   Retries = LAN91X_MEMORY_ALLOC_POLLS;
   while ((ReadIoReg8 (LanDriver, LAN91X_IST) & IST_ALLOC) == 0) {
     if (--Retries == 0) {
@@ -1793,6 +1902,7 @@ SnpTransmit (
       ReturnUnlock (EFI_TIMEOUT);
     }
   }
+  LanDriver->TxAllocPending = FALSE;
 
   // Check for successful allocation
   PktNum = ReadIoReg8 (LanDriver, LAN91X_ARR);
@@ -1821,6 +1931,13 @@ SnpTransmit (
   WriteIoReg8 (LanDriver, LAN91X_PNR, PktNum);
   WriteIoReg16 (LanDriver, LAN91X_PTR, PTR_AUTO_INCR);
 
+  // Ask for the next frame's buffer now, so the MMU allocates it while
+  // this frame is copied into the chip. PNR keeps pointing at this one.
+  if (MmuWaitIdle (LanDriver, MMUCR_OP_TX_ALLOC) == EFI_SUCCESS) {
+    WriteIoReg16 (LanDriver, LAN91X_MMUCR, MMUCR_OP_TX_ALLOC | LAN91X_TX_MAX_PAGES);
+    LanDriver->TxAllocPending = TRUE;
+  }
+
   // Set up mutable buffer information variables
   Ptr = BufAddr;
   Len = BufSize;
@@ -1828,24 +1945,28 @@ SnpTransmit (
   // Write Status and Byte Count first
   WriteIoReg16 (LanDriver, LAN91X_DATA0, 0);
   WriteIoReg16 (LanDriver, LAN91X_DATA0, (Len + LAN91X_PKT_OVERHEAD) & BCW_COUNT);
+  Offset = LAN91X_PKT_DATA_OFFSET;
 
   // This packet may come with a preconfigured Ethernet header.
   // If not, we need to construct one from optional parameters.
   if (HdrSize) {
 
     // Write the destination address
-    WriteIoData (LanDriver, DstAddr, NET_ETHER_ADDR_LEN);
+    WriteIoData (LanDriver, DstAddr, NET_ETHER_ADDR_LEN, Offset);
+    Offset += NET_ETHER_ADDR_LEN;
 
     // Write the Source Address
     if (SrcAddr != NULL) {
-      WriteIoData (LanDriver, SrcAddr, NET_ETHER_ADDR_LEN);
+      WriteIoData (LanDriver, SrcAddr, NET_ETHER_ADDR_LEN, Offset);
     } else {
-      WriteIoData (LanDriver, &LanDriver->SnpMode.CurrentAddress, NET_ETHER_ADDR_LEN);
+      WriteIoData (LanDriver, &LanDriver->SnpMode.CurrentAddress, NET_ETHER_ADDR_LEN, Offset);
     }
+    Offset += NET_ETHER_ADDR_LEN;
 
     // Write the Protocol word
     Proto = HTONS (*Protocol);
     WriteIoReg16 (LanDriver, LAN91X_DATA0, Proto);
+    Offset += sizeof (Proto);
 
     // Adjust the data start and length
     Ptr += sizeof(ETHER_HEAD);
@@ -1853,7 +1974,7 @@ SnpTransmit (
   }
 
   // Copy the remainder data buffer, except the odd byte
-  WriteIoData (LanDriver, Ptr, Len & ~1);
+  WriteIoData (LanDriver, Ptr, Len & ~1, Offset);
   Ptr += Len & ~1;
   Len &= 1;
 
@@ -2050,7 +2171,7 @@ SnpReceive (
 
   // Transfer the data bytes
   DataPtr = Data;
-  ReadIoData (LanDriver, DataPtr, PktLength & ~0x0001);
+  ReadIoData (LanDriver, DataPtr, PktLength & ~0x0001, LAN91X_PKT_DATA_OFFSET);
 
   // Read the PktControl and Odd Byte from the FIFO
   PktControl = ReadIoReg16 (LanDriver, LAN91X_DATA0);
@@ -21,6 +21,14 @@
 
 EFI_MMC_HOST_PROTOCOL     *gpMmcHost;
 
+//
+// Multi-block commands are only issued once the transfer length is known,
+// from MciReadBlockData/MciWriteBlockData, as the data path must be armed
+// before the card starts sending.
+//
+STATIC MMC_CMD  mMciPendingCmd;
+STATIC UINT32   mMciPendingArgument;
+
 // Untested ...
 //#define USE_STREAM
 
@@ -86,22 +94,34 @@ GetPow2BlockLen (
 
 VOID
 MciPrepareDataPath (
-  IN UINTN TransferDirection
+  IN UINTN TransferDirection,
+  IN UINTN Length
   )
 {
   // Set Data Length & Data Timer
   MmioWrite32 (MCI_DATA_TIMER_REG, 0xFFFFFFF);
-  MmioWrite32 (MCI_DATA_LENGTH_REG, MMCI0_BLOCKLEN);
+  MmioWrite32 (MCI_DATA_LENGTH_REG, Length);
 
+  //
+  // The FIFO is serviced by the CPU, so leave the DMA request lines off:
+  // there is no DMA channel programmed to answer them.
+  //
 #ifndef USE_STREAM
   //Note: we are using a hardcoded BlockLen (==512). If we decide to use a variable size, we could
   // compute the pow2 of BlockLen with the above function GetPow2BlockLen ()
-  MmioWrite32 (MCI_DATA_CTL_REG, MCI_DATACTL_ENABLE | MCI_DATACTL_DMA_ENABLE | TransferDirection | (MMCI0_POW2_BLOCKLEN << 4));
+  MmioWrite32 (MCI_DATA_CTL_REG, MCI_DATACTL_ENABLE | TransferDirection | (MMCI0_POW2_BLOCKLEN << 4));
 #else
-  MmioWrite32 (MCI_DATA_CTL_REG, MCI_DATACTL_ENABLE | MCI_DATACTL_DMA_ENABLE | TransferDirection | MCI_DATACTL_STREAM_TRANS);
+  MmioWrite32 (MCI_DATA_CTL_REG, MCI_DATACTL_ENABLE | TransferDirection | MCI_DATACTL_STREAM_TRANS);
 #endif
 }
 
+STATIC
+EFI_STATUS
+MciIssueCommand (
+  IN MMC_CMD                    MmcCmd,
+  IN UINT32                     Argument
+  );
+
 EFI_STATUS
 MciSendCommand (
   IN EFI_MMC_HOST_PROTOCOL     *This,
@@ -109,18 +129,16 @@ MciSendCommand (
   IN UINT32                     Argument
   )
 {
-  UINT32  Status;
-  UINT32  Cmd;
-  UINTN   RetVal;
-  UINTN   CmdCtrlReg;
-  UINT32  DoneMask;
-
-  RetVal = EFI_SUCCESS;
+  if ((MmcCmd == MMC_CMD18) || (MmcCmd == MMC_CMD25)) {
+    mMciPendingCmd = MmcCmd;
+    mMciPendingArgument = Argument;
+    return EFI_SUCCESS;
+  }
 
   if ((MmcCmd == MMC_CMD17) || (MmcCmd == MMC_CMD11)) {
-    MciPrepareDataPath (MCI_DATACTL_CARD_TO_CONT);
+    MciPrepareDataPath (MCI_DATACTL_CARD_TO_CONT, MMCI0_BLOCKLEN);
   } else if ((MmcCmd == MMC_CMD24) || (MmcCmd == MMC_CMD20)) {
-    MciPrepareDataPath (MCI_DATACTL_CONT_TO_CARD);
+    MciPrepareDataPath (MCI_DATACTL_CONT_TO_CARD, MMCI0_BLOCKLEN);
   } else if (MmcCmd == MMC_CMD6) {
     MmioWrite32 (MCI_DATA_TIMER_REG, 0xFFFFFFF);
     MmioWrite32 (MCI_DATA_LENGTH_REG, 64);
@@ -140,6 +158,24 @@ MciSendCommand (
 #endif
   }
 
+  return MciIssueCommand (MmcCmd, Argument);
+}
+
+STATIC
+EFI_STATUS
+MciIssueCommand (
+  IN MMC_CMD                    MmcCmd,
+  IN UINT32                     Argument
+  )
+{
+  UINT32  Status;
+  UINT32  Cmd;
+  UINTN   RetVal;
+  UINTN   CmdCtrlReg;
+  UINT32  DoneMask;
+
+  RetVal = EFI_SUCCESS;
+
   // Create Command for PL180
   Cmd = (MMC_GET_INDX (MmcCmd) & INDX_MASK)  | MCI_CPSM_ENABLE;
   if (MmcCmd & MMC_CMD_WAIT_RESPONSE) {
@@ -235,37 +271,36 @@ MciReadBlockData (
 
   // Read data from the RX FIFO
   Loop   = 0;
-  if (Length < MMCI0_BLOCKLEN) {
-    Finish = Length / 4;
-  } else {
-    Finish = MMCI0_BLOCKLEN / 4;
-  }
+  Finish = Length / 4;
 
   // Raise the TPL at the highest level to disable Interrupts.
   Tpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
 
+  if (mMciPendingCmd != 0) {
+    MciPrepareDataPath (MCI_DATACTL_CARD_TO_CONT, Length);
+    RetVal = MciIssueCommand (mMciPendingCmd, mMciPendingArgument);
+    mMciPendingCmd = 0;
+    if (EFI_ERROR (RetVal)) {
+      goto Exit;
+    }
+  }
+
   do {
     // Read the Status flags
     Status = MmioRead32 (MCI_STATUS_REG);
 
-    // Do eight reads if possible else a single read
-    if (Status & MCI_STATUS_CMD_RXFIFOHALFFULL) {
-      Buffer[Loop] = MmioRead32(MCI_FIFO_REG);
-      Loop++;
-      Buffer[Loop] = MmioRead32(MCI_FIFO_REG);
-      Loop++;
-      Buffer[Loop] = MmioRead32(MCI_FIFO_REG);
-      Loop++;
-      Buffer[Loop] = MmioRead32(MCI_FIFO_REG);
-      Loop++;
-      Buffer[Loop] = MmioRead32(MCI_FIFO_REG);
-      Loop++;
-      Buffer[Loop] = MmioRead32(MCI_FIFO_REG);
-      Loop++;
-      Buffer[Loop] = MmioRead32(MCI_FIFO_REG);
-      Loop++;
-      Buffer[Loop] = MmioRead32(MCI_FIFO_REG);
-      Loop++;
+    //
+    // Drain as much as the FIFO flags guarantee in one go, using the
+    // whole FIFO window so the accesses can be merged into bursts.
+    //
+    if ((Status & MCI_STATUS_CMD_RXFIFOFULL) &&
+        (Finish - Loop >= MCI_FIFO_DEPTH)) {
+      MmioReadBuffer32 (MCI_FIFO_REG, MCI_FIFO_WINDOW_SIZE, &Buffer[Loop]);
+      Loop += MCI_FIFO_DEPTH;
+    } else if ((Status & MCI_STATUS_CMD_RXFIFOHALFFULL) &&
+               (Finish - Loop >= MCI_FIFO_HALF_DEPTH)) {
+      MmioReadBuffer32 (MCI_FIFO_REG, MCI_FIFO_WINDOW_SIZE / 2, &Buffer[Loop]);
+      Loop += MCI_FIFO_HALF_DEPTH;
     } else if (Status & MCI_STATUS_CMD_RXDATAAVAILBL) {
       Buffer[Loop] = MmioRead32(MCI_FIFO_REG);
       Loop++;
@@ -291,6 +326,7 @@ MciReadBlockData (
     }
   } while ((Loop < Finish));
 
+Exit:
   // Restore Tpl
   gBS->RestoreTPL (Tpl);
 
@@ -324,9 +360,22 @@ MciWriteBlockData (
 
   // Write the data to the TX FIFO
   Loop   = 0;
-  Finish = MMCI0_BLOCKLEN / 4;
+  Finish = Length / 4;
   Timer  = MMCI0_TIMEOUT * 100;
 
+  if (mMciPendingCmd != 0) {
+    //
+    // The card only expects data after the write command has been
+    // answered, so arming the data path first is all that's needed.
+    //
+    MciPrepareDataPath (MCI_DATACTL_CONT_TO_CARD, Length);
+    RetVal = MciIssueCommand (mMciPendingCmd, mMciPendingArgument);
+    mMciPendingCmd = 0;
+    if (EFI_ERROR (RetVal)) {
+      goto Exit;
+    }
+  }
+
   // Raise the TPL at the highest level to disable Interrupts.
   Tpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
 
@@ -334,24 +383,15 @@ MciWriteBlockData (
     // Read the Status flags
     Status = MmioRead32 (MCI_STATUS_REG);
 
-    // Do eight writes if possible else a single write
-    if (Status & MCI_STATUS_CMD_TXFIFOHALFEMPTY) {
-      MmioWrite32(MCI_FIFO_REG, Buffer[Loop]);
-      Loop++;
-      MmioWrite32(MCI_FIFO_REG, Buffer[Loop]);
-      Loop++;
-      MmioWrite32(MCI_FIFO_REG, Buffer[Loop]);
-      Loop++;
-      MmioWrite32(MCI_FIFO_REG, Buffer[Loop]);
-      Loop++;
-      MmioWrite32(MCI_FIFO_REG, Buffer[Loop]);
-      Loop++;
-      MmioWrite32(MCI_FIFO_REG, Buffer[Loop]);
-      Loop++;
-      MmioWrite32(MCI_FIFO_REG, Buffer[Loop]);
-      Loop++;
-      MmioWrite32(MCI_FIFO_REG, Buffer[Loop]);
-      Loop++;
+    // Fill as much of the FIFO as the flags guarantee is free
+    if ((Status & MCI_STATUS_CMD_TXFIFOEMPTY) &&
+        (Finish - Loop >= MCI_FIFO_DEPTH)) {
+      MmioWriteBuffer32 (MCI_FIFO_REG, MCI_FIFO_WINDOW_SIZE, &Buffer[Loop]);
+      Loop += MCI_FIFO_DEPTH;
+    } else if ((Status & MCI_STATUS_CMD_TXFIFOHALFEMPTY) &&
+               (Finish - Loop >= MCI_FIFO_HALF_DEPTH)) {
+      MmioWriteBuffer32 (MCI_FIFO_REG, MCI_FIFO_WINDOW_SIZE / 2, &Buffer[Loop]);
+      Loop += MCI_FIFO_HALF_DEPTH;
     } else if (!(Status & MCI_STATUS_CMD_TXFIFOFULL)) {
         MmioWrite32(MCI_FIFO_REG, Buffer[Loop]);
         Loop++;
@@ -360,16 +400,16 @@ MciWriteBlockData (
       if (Status & MCI_STATUS_CMD_DATATIMEOUT) {
         DEBUG ((EFI_D_ERROR, "MciWriteBlockData(): TIMEOUT! Response:0x%X Status:0x%x\n", MmioRead32 (MCI_RESPONSE0_REG), Status));
         RetVal = EFI_TIMEOUT;
-        goto Exit;
+        break;
       } else if (Status & MCI_STATUS_CMD_DATACRCFAIL) {
         DEBUG ((EFI_D_ERROR, "MciWriteBlockData(): CRC Error! Response:0x%X Status:0x%x\n", MmioRead32 (MCI_RESPONSE0_REG), Status));
         RetVal = EFI_CRC_ERROR;
-        goto Exit;
+        break;
       } else if (Status & MCI_STATUS_CMD_TX_UNDERRUN) {
         DEBUG ((EFI_D_ERROR, "MciWriteBlockData(): TX buffer Underrun! Response:0x%X Status:0x%x, Number of bytes written 0x%x\n",MmioRead32(MCI_RESPONSE0_REG),Status, Loop));
         RetVal = EFI_BUFFER_TOO_SMALL;
         ASSERT(0);
-        goto Exit;
+        break;
       }
     }
   } while (Loop < Finish);
@@ -377,6 +417,10 @@ MciWriteBlockData (
   // Restore Tpl
   gBS->RestoreTPL (Tpl);
 
+  if (EFI_ERROR (RetVal)) {
+    goto Exit;
+  }
+
   // Wait for FIFO to drain
   Timer  = MMCI0_TIMEOUT * 60;
   Status = MmioRead32 (MCI_STATUS_REG);
@@ -516,6 +560,14 @@ MciBuildDevicePath (
   return EFI_SUCCESS;
 }
 
+BOOLEAN
+MciIsMultiBlock (
+  IN EFI_MMC_HOST_PROTOCOL      *This
+  )
+{
+  return TRUE;
+}
+
 EFI_MMC_HOST_PROTOCOL gMciHost = {
   MMC_HOST_PROTOCOL_REVISION,
   MciIsCardPresent,
@@ -525,7 +577,9 @@ EFI_MMC_HOST_PROTOCOL gMciHost = {
   MciSendCommand,
   MciReceiveResponse,
   MciReadBlockData,
-  MciWriteBlockData
+  MciWriteBlockData,
+  NULL,                   // SetIos
+  MciIsMultiBlock
 };
 
 EFI_STATUS
@@ -138,6 +138,10 @@
 #define MCI_DATACTL_DMA_DISABLED        0
 #define MCI_DATACTL_DMA_ENABLE          BIT3
 
+#define MCI_FIFO_DEPTH                  16    // in 32-bit words
+#define MCI_FIFO_HALF_DEPTH             (MCI_FIFO_DEPTH / 2)
+#define MCI_FIFO_WINDOW_SIZE            (MCI_FIFO_DEPTH * sizeof (UINT32))
+
 #define INDX_MASK                       0x3F
 
 #define MCI_CPSM_WAIT_RESPONSE          BIT6
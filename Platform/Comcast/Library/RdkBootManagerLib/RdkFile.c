@@ -6,7 +6,7 @@
 */
 #include <RdkBootManagerLib.h>
 
-#define MAX_VAR       6
+#define MAX_VAR       8
 
 /**
  * list_for_each_entry	-	iterate over list of given type
@@ -282,7 +282,10 @@ SetVariable (
       DataSize,
       PkCert
     );
-
+  }
+  else if (KeyType == DB_KEY)
+  {
+    DEBUG ((DEBUG_INFO, "Setting db Key\n"));
     Status = gRT->SetVariable (
       EFI_IMAGE_SECURITY_DATABASE,
       &gEfiImageSecurityDatabaseGuid,
@@ -291,6 +294,17 @@ SetVariable (
       PkCert
     );
   }
+  else if (KeyType == DBX_KEY)
+  {
+    DEBUG ((DEBUG_INFO, "Setting dbx Key\n"));
+    Status = gRT->SetVariable (
+      EFI_IMAGE_SECURITY_DATABASE1,
+      &gEfiImageSecurityDatabaseGuid,
+      Attr,
+      DataSize,
+      PkCert
+    );
+  }
   else
   {
     ASSERT(FALSE);
@@ -298,64 +312,142 @@ SetVariable (
   return Status;
 }
 
+//
+// Append one EFI_SIGNATURE_LIST holding SignatureCount entries of the same
+// type and size to the set in *CertList, growing it as needed.
+//
 STATIC
-VOID
-PopulateCert (
-  OUT EFI_SIGNATURE_LIST  **Cert,
-  IN  UINTN               DataSize,
-  IN  UINT8               *Data
+EFI_STATUS
+AppendSignatureList (
+  IN OUT EFI_SIGNATURE_LIST  **CertList,
+  IN OUT UINTN               *CertListSize,
+  IN     EFI_GUID            *SignatureType,
+  IN     UINT8               *Data,
+  IN     UINTN               SignatureDataSize,
+  IN     UINTN               SignatureCount
 )
 {
-  EFI_SIGNATURE_DATA  *CertData = NULL;
+  EFI_SIGNATURE_LIST  *Cert;
+  EFI_SIGNATURE_DATA  *CertData;
+  UINTN               SignatureSize;
+  UINTN               ListSize;
+  UINTN               Index;
+  UINT8               *NewList;
+
+  SignatureSize = OFFSET_OF (EFI_SIGNATURE_DATA, SignatureData) + SignatureDataSize;
+  ListSize      = sizeof (EFI_SIGNATURE_LIST) + SignatureSize * SignatureCount;
+
+  NewList = ReallocatePool (*CertListSize, *CertListSize + ListSize, *CertList);
+  if (NewList == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
 
-  if ((*Cert) == NULL)
-  {
-    (*Cert) = (EFI_SIGNATURE_LIST*) AllocateZeroPool (sizeof (EFI_SIGNATURE_LIST)
-      + sizeof(EFI_SIGNATURE_DATA) - 1
-      + DataSize );
+  Cert = (EFI_SIGNATURE_LIST*) (NewList + *CertListSize);
+  Cert->SignatureListSize   = (UINT32) ListSize;
+  Cert->SignatureSize       = (UINT32) SignatureSize;
+  Cert->SignatureHeaderSize = 0;
+  CopyGuid (&Cert->SignatureType, SignatureType);
+
+  CertData = (EFI_SIGNATURE_DATA*) (Cert + 1);
+  for (Index = 0; Index < SignatureCount; Index++) {
+    CopyGuid (&CertData->SignatureOwner, &gEfiGlobalVariableGuid);
+    CopyMem (&CertData->SignatureData, Data + Index * SignatureDataSize, SignatureDataSize);
+    CertData = (EFI_SIGNATURE_DATA*) ((UINT8*) CertData + SignatureSize);
+  }
 
-    ASSERT ((*Cert) != NULL);
+  *CertList     = (EFI_SIGNATURE_LIST*) NewList;
+  *CertListSize += ListSize;
+  return EFI_SUCCESS;
+}
+
+//
+// Append the content of every file listed in Paths (separated by ';') to the
+// set in *CertList: one X509 list per certificate, or for dbx one SHA-256
+// list per file of raw hashes.
+//
+STATIC
+EFI_STATUS
+ReadSignatureLists (
+  IN     CONST CHAR16        *Paths,
+  IN     eKey                KeyType,
+  IN OUT EFI_SIGNATURE_LIST  **CertList,
+  IN OUT UINTN               *CertListSize
+)
+{
+  EFI_STATUS  Status;
+  CHAR16      *PathList;
+  CHAR16      *Path;
+  CHAR16      *Next;
+  UINT8       *Data;
+  UINTN       DataSize;
+
+  PathList = AllocateCopyPool (StrSize (Paths), Paths);
+  if (PathList == NULL) {
+    return EFI_OUT_OF_RESOURCES;
   }
-  (*Cert)->SignatureListSize   = (UINT32) (sizeof (EFI_SIGNATURE_LIST)
-    + sizeof (EFI_SIGNATURE_DATA) - 1
-    + DataSize);
-  (*Cert)->SignatureSize       = (UINT32) (sizeof (EFI_SIGNATURE_DATA) - 1 + DataSize);
-  (*Cert)->SignatureHeaderSize = 0;
-  CopyGuid (&(*Cert)->SignatureType, &gEfiCertX509Guid);
 
+  Status = EFI_SUCCESS;
+  for (Path = PathList; Path != NULL && !EFI_ERROR (Status); Path = Next) {
+    Next = StrStr (Path, L";");
+    if (Next != NULL) {
+      *Next++ = L'\0';
+    }
+    if (*Path == L'\0') {
+      continue;
+    }
+
+    Data = NULL;
+    Status = RdkReadFile (Path, (VOID **)&Data, &DataSize);
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "Failed to read %s\n", Path));
+      break;
+    }
 
-  CertData = (EFI_SIGNATURE_DATA*) ((UINTN)(*Cert) + \
-    sizeof(EFI_SIGNATURE_LIST) + (*Cert)->SignatureHeaderSize);
-  ASSERT (CertData != NULL);
+    if (KeyType == DBX_KEY) {
+      if (DataSize == 0 || (DataSize % sizeof (EFI_SHA256_HASH)) != 0) {
+        DEBUG ((DEBUG_ERROR, "%s is not a list of SHA-256 hashes\n", Path));
+        Status = EFI_INVALID_PARAMETER;
+      } else {
+        Status = AppendSignatureList (CertList, CertListSize, &gEfiCertSha256Guid,
+          Data, sizeof (EFI_SHA256_HASH), DataSize / sizeof (EFI_SHA256_HASH));
+      }
+    } else {
+      Status = AppendSignatureList (CertList, CertListSize, &gEfiCertX509Guid,
+        Data, DataSize, 1);
+    }
+    FreePool (Data);
+  }
 
-  CopyGuid (&CertData->SignatureOwner, &gEfiGlobalVariableGuid);
-  CopyMem (&CertData->SignatureData, Data, DataSize);
+  FreePool (PathList);
+  return Status;
 }
 
+//
+// Write a complete signature list set with one authenticated SetVariable
+// call, so the variable driver verifies it only once. CertList is freed.
+//
 STATIC
 EFI_STATUS
 RegisterCert (
-  IN  UINT8   *KeyData,
-  IN  UINTN   KeySize,
-  IN  eKey    KeyType
+  IN  EFI_SIGNATURE_LIST  *CertList,
+  IN  UINTN               CertListSize,
+  IN  eKey                KeyType
 )
 {
   EFI_STATUS          Status;
-  EFI_SIGNATURE_LIST  *Cert;
-
-  Cert = NULL;
 
   Status = SetBootMode (CUSTOM_SECURE_BOOT_MODE);
   ASSERT_EFI_ERROR (Status);
 
-  PopulateCert (&Cert, KeySize, KeyData);
-
-  KeySize = Cert->SignatureListSize;
-
-  Status = CreateTimeBasedPayload (&KeySize, (UINT8**) &Cert);
+  Status = CreateTimeBasedPayload (&CertListSize, (UINT8**) &CertList);
   ASSERT_EFI_ERROR (Status);
+  if (EFI_ERROR (Status)) {
+    FreePool (CertList);
+    return Status;
+  }
 
-  Status = SetVariable (Cert, KeySize, KeyType);
+  Status = SetVariable (CertList, CertListSize, KeyType);
+  FreePool (CertList);
   return Status;
 }
 
@@ -367,15 +459,19 @@ RdkSetVariable (
 {
   CONST CHAR16	*KeyPath;
   EFI_STATUS  	Status;
-  UINT8         *KekKey,    *PkKey,    *KekCrtData;
-  UINTN         KekKeySize, PkKeySize, KekCrtSize;
+  UINT8         *KekCrtData;
+  UINTN         KekCrtSize;
   INT8*         SetupMode;
   eKey          KeyType;
+  EFI_SIGNATURE_LIST  *PkList,    *KekList,    *DbList,    *DbxList;
+  UINTN               PkListSize, KekListSize, DbListSize, DbxListSize;
 
   KeyPath    = NULL;
   SetupMode  = NULL;
-  KekKey     = PkKey     = KekCrtData = NULL;
-  KekKeySize = PkKeySize = KekCrtSize = 0;
+  KekCrtData = NULL;
+  KekCrtSize = 0;
+  PkList     = KekList     = DbList     = DbxList     = NULL;
+  PkListSize = KekListSize = DbListSize = DbxListSize = 0;
 
   Status = GetRdkVariable (L"ROOTCERT", &KeyPath);
 
@@ -400,35 +496,62 @@ RdkSetVariable (
     if (KekCrtData) FreePool (KekCrtData);
   }
 
+  //
+  // Build the full signature list set of each variable before writing it,
+  // so that every variable is written and verified once no matter how many
+  // certificates or hashes it holds.
+  //
   Status = GetRdkVariable (L"KEKCERT", &KeyPath);
   ASSERT_EFI_ERROR (Status);
 
-  Status = RdkReadFile (
-    KeyPath,
-    (VOID **)&KekKey,
-    &KekKeySize
-    );
+  Status = ReadSignatureLists (KeyPath, KEK_KEY, &KekList, &KekListSize);
   ASSERT_EFI_ERROR (Status);
 
+  //
+  // db always trusts the KEK certificates, plus any listed in DBCERT
+  //
+  DbList = AllocateCopyPool (KekListSize, KekList);
+  ASSERT (DbList != NULL);
+  DbListSize = KekListSize;
+
+  Status = GetRdkVariable (L"DBCERT", &KeyPath);
+  if (!EFI_ERROR (Status)) {
+    Status = ReadSignatureLists (KeyPath, DB_KEY, &DbList, &DbListSize);
+    ASSERT_EFI_ERROR (Status);
+  }
+
+  Status = GetRdkVariable (L"DBXHASH", &KeyPath);
+  if (!EFI_ERROR (Status)) {
+    Status = ReadSignatureLists (KeyPath, DBX_KEY, &DbxList, &DbxListSize);
+    ASSERT_EFI_ERROR (Status);
+  }
+
   Status = GetRdkVariable (L"PKCERT", &KeyPath);
   ASSERT_EFI_ERROR (Status);
 
-  Status = RdkReadFile (
-    KeyPath,
-    (VOID **)&PkKey,
-    &PkKeySize
-    );
+  Status = ReadSignatureLists (KeyPath, PK_KEY, &PkList, &PkListSize);
   ASSERT_EFI_ERROR (Status);
 
   KeyType = PK_KEY;
-  Status = RegisterCert (PkKey, PkKeySize, KeyType);
+  Status = RegisterCert (PkList, PkListSize, KeyType);
   GetEfiGlobalVariable2 (L"SetupMode", (VOID**)&SetupMode, NULL);
 
   if (*SetupMode == 0)
   {
     DEBUG ((DEBUG_INFO, "PK Key Got Registered. Now System in User Mode\n"));
     KeyType = KEK_KEY;
-    Status = RegisterCert (KekKey, KekKeySize, KeyType);
+    Status = RegisterCert (KekList, KekListSize, KeyType);
+    KekList = NULL;
+
+    KeyType = DB_KEY;
+    Status = RegisterCert (DbList, DbListSize, KeyType);
+    DbList = NULL;
+
+    if (DbxList != NULL) {
+      KeyType = DBX_KEY;
+      Status = RegisterCert (DbxList, DbxListSize, KeyType);
+      DbxList = NULL;
+    }
   }
   else if(*SetupMode == 1)
   {
@@ -436,8 +559,9 @@ RdkSetVariable (
     ASSERT_EFI_ERROR (Status);
   }
 
-  if ( PkKey ) FreePool (PkKey);
-  if ( KekKey ) FreePool (KekKey);
+  if ( KekList ) FreePool (KekList);
+  if ( DbList ) FreePool (DbList);
+  if ( DbxList ) FreePool (DbxList);
 }
 
 EFI_STATUS
@@ -10,6 +10,7 @@
 #include <Uefi.h>
 #include <Library/ArmArchTimer.h>
 #include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
 #include <libfdt.h>
 #include <Library/IoLib.h>
 #include <Library/DebugLib.h>
@@ -122,21 +123,162 @@ GetMacAddress (UINT32 Port)
     return EFI_SUCCESS;
 }
 
+STATIC CONST CHAR8  *EthPath[8]=
+{
+ "/soc/ethernet@0","/soc/ethernet@1",
+ "/soc/ethernet@2","/soc/ethernet@3",
+ "/soc/ethernet@4","/soc/ethernet@5",
+ "/soc/ethernet@6","/soc/ethernet@7"
+};
+
+//
+// Property values referenced by the update batch until it is applied
+//
+STATIC MAC_ADDRESS  mPortMacAddress[8];
+STATIC UINT32       mRefClkFrequency;
+
+EFI_STATUS
+FdtUpdateBatchAdd (
+  IN OUT FDT_UPDATE_BATCH  *Batch,
+  IN     CONST CHAR8       *NodePath,
+  IN     CONST CHAR8       *Property,
+  IN     CONST VOID        *Value,
+  IN     UINT32            Length
+  )
+{
+  FDT_UPDATE_PROPERTY  *Update;
+
+  if (Batch->Count >= FDT_UPDATE_MAX_PROPERTIES) {
+    DEBUG ((DEBUG_ERROR, "[%a]:[%dL] Too many FDT updates\n", __FUNCTION__, __LINE__));
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Update = &Batch->Property[Batch->Count++];
+  Update->NodePath = NodePath;
+  Update->Property = Property;
+  Update->Value    = Value;
+  Update->Length   = Length;
+  return EFI_SUCCESS;
+}
+
+UINTN
+FdtUpdateBatchSize (
+  IN CONST VOID              *Fdt,
+  IN CONST FDT_UPDATE_BATCH  *Batch
+  )
+{
+  CONST FDT_UPDATE_PROPERTY  *Update;
+  CONST CHAR8                *Name;
+  UINTN                      Size;
+  UINTN                      Index;
+  INTN                       Node;
+  INT32                      OldLength;
+
+  Size = fdt_totalsize (Fdt);
+  for (Index = 0; Index < Batch->Count; Index++) {
+    Update = &Batch->Property[Index];
+    Node = fdt_path_offset (Fdt, Update->NodePath);
+    if (Node < 0) {
+      //
+      // FDT_BEGIN_NODE, name and FDT_END_NODE of the new node
+      //
+      Name = AsciiStrStr (Update->NodePath, "/");
+      while (AsciiStrStr (Name + 1, "/") != NULL) {
+        Name = AsciiStrStr (Name + 1, "/");
+      }
+      Size += 2 * FDT_TAGSIZE + ALIGN_VALUE (AsciiStrSize (Name + 1), FDT_TAGSIZE);
+    } else if (fdt_getprop (Fdt, Node, Update->Property, &OldLength) != NULL) {
+      if (ALIGN_VALUE (Update->Length, FDT_TAGSIZE) > ALIGN_VALUE ((UINT32)OldLength, FDT_TAGSIZE)) {
+        Size += ALIGN_VALUE (Update->Length, FDT_TAGSIZE) -
+                ALIGN_VALUE ((UINT32)OldLength, FDT_TAGSIZE);
+      }
+      continue;
+    }
+
+    //
+    // New property, whose name may also have to be added to the strings block
+    //
+    Size += sizeof (struct fdt_property) + ALIGN_VALUE (Update->Length, FDT_TAGSIZE) +
+            AsciiStrSize (Update->Property);
+  }
+
+  return Size;
+}
+
+EFI_STATUS
+FdtUpdateBatchApply (
+  IN OUT VOID                    *Fdt,
+  IN     CONST FDT_UPDATE_BATCH  *Batch
+  )
+{
+  CONST FDT_UPDATE_PROPERTY  *Update;
+  CHAR8                      ParentPath[128];
+  CONST CHAR8                *Name;
+  EFI_STATUS                 Status;
+  UINTN                      Index;
+  INTN                       Node;
+  INTN                       Parent;
+  INTN                       Error;
+  INT32                      OldLength;
+
+  Status = EFI_SUCCESS;
+  for (Index = 0; Index < Batch->Count; Index++) {
+    Update = &Batch->Property[Index];
+    Node = fdt_path_offset (Fdt, Update->NodePath);
+    if (Node < 0) {
+      Name = AsciiStrStr (Update->NodePath, "/");
+      while (AsciiStrStr (Name + 1, "/") != NULL) {
+        Name = AsciiStrStr (Name + 1, "/");
+      }
+      if (Name == Update->NodePath) {
+        Parent = 0;
+      } else {
+        if ((UINTN)(Name - Update->NodePath) >= sizeof (ParentPath)) {
+          Status = EFI_INVALID_PARAMETER;
+          continue;
+        }
+        CopyMem (ParentPath, Update->NodePath, Name - Update->NodePath);
+        ParentPath[Name - Update->NodePath] = '\0';
+        Parent = fdt_path_offset (Fdt, ParentPath);
+      }
+      Node = (Parent < 0) ? Parent : fdt_add_subnode (Fdt, Parent, Name + 1);
+      if (Node < 0) {
+        DEBUG ((DEBUG_ERROR, "[%a]:[%dL] Can't create %a: %a\n",
+          __FUNCTION__, __LINE__, Update->NodePath, fdt_strerror (Node)));
+        Status = EFI_INVALID_PARAMETER;
+        continue;
+      }
+    }
+
+    //
+    // Only a property that changes length moves the rest of the blob
+    //
+    if ((fdt_getprop (Fdt, Node, Update->Property, &OldLength) != NULL) &&
+        ((UINT32)OldLength == Update->Length)) {
+      Error = fdt_setprop_inplace (Fdt, Node, Update->Property, Update->Value, Update->Length);
+    } else {
+      Error = fdt_setprop (Fdt, Node, Update->Property, Update->Value, Update->Length);
+    }
+    if (Error) {
+      DEBUG ((DEBUG_ERROR, "ERROR:fdt_setprop() %a %a: %a\n",
+        Update->NodePath, Update->Property, fdt_strerror (Error)));
+      Status = EFI_INVALID_PARAMETER;
+    }
+  }
+
+  return Status;
+}
+
 STATIC
 EFI_STATUS
-DelPhyhandleUpdateMacAddress(IN VOID* Fdt)
+DelPhyhandleUpdateMacAddress(IN CONST VOID* Fdt, IN OUT FDT_UPDATE_BATCH* Batch)
 {
     UINT8               port;
     INTN                ethernetnode;
-    INTN                node;
-    INTN                Error;
-    struct              fdt_property *m_prop;
-    int                 m_oldlen;
     EFI_STATUS          Status = EFI_SUCCESS;
     EFI_STATUS          GetMacStatus = EFI_SUCCESS;
 
-    node = fdt_subnode_offset(Fdt, 0, "soc");
-    if (node < 0)
+    if (fdt_path_offset(Fdt, "/soc") < 0)
     {
         DEBUG ((EFI_D_ERROR, "can not find soc root node\n"));
         return EFI_INVALID_PARAMETER;
@@ -146,7 +288,7 @@ DelPhyhandleUpdateMacAddress(IN VOID* Fdt)
         for( port=0; port<8; port++ )
         {
             GetMacStatus= GetMacAddress(port);
-            ethernetnode = fdt_subnode_offset(Fdt, node,EthName[port]);
+            ethernetnode = fdt_path_offset(Fdt, EthPath[port]);
             if(!EFI_ERROR(GetMacStatus))
             {
 
@@ -156,19 +298,12 @@ DelPhyhandleUpdateMacAddress(IN VOID* Fdt)
                     DEBUG ((EFI_D_WARN, "Suppose port %d is not enabled.\n", port));
                     continue;
                 }
-                m_prop = fdt_get_property_w(Fdt, ethernetnode, "local-mac-address", &m_oldlen);
-                if(m_prop)
+                if(fdt_getprop(Fdt, ethernetnode, "local-mac-address", NULL))
                 {
-                    Error = fdt_delprop(Fdt, ethernetnode, "local-mac-address");
-                    if (Error)
-                    {
-                        DEBUG ((EFI_D_ERROR, "ERROR:fdt_delprop() Local-mac-address: %a\n", fdt_strerror (Error)));
-                        Status = EFI_INVALID_PARAMETER;
-                    }
-                    Error = fdt_setprop(Fdt, ethernetnode, "local-mac-address",gMacAddress,sizeof(MAC_ADDRESS));
-                    if (Error)
+                    mPortMacAddress[port] = gMacAddress[0];
+                    if (EFI_ERROR (FdtUpdateBatchAdd (Batch, EthPath[port], "local-mac-address",
+                                     &mPortMacAddress[port], sizeof(MAC_ADDRESS))))
                     {
-                        DEBUG ((EFI_D_ERROR, "ERROR:fdt_setprop():local-mac-address %a\n", fdt_strerror (Error)));
                         Status = EFI_INVALID_PARAMETER;
                     }
                 }
@@ -180,14 +315,10 @@ DelPhyhandleUpdateMacAddress(IN VOID* Fdt)
 
 STATIC
 EFI_STATUS
-UpdateRefClk (IN VOID* Fdt)
+UpdateRefClk (IN CONST VOID* Fdt, IN OUT FDT_UPDATE_BATCH* Batch)
 {
   INTN                node;
-  INTN                Error;
-  struct              fdt_property *m_prop;
-  int                 m_oldlen;
   UINTN               ArchTimerFreq = 0;
-  UINT32              Data;
   CONST CHAR8         *Property = "clock-frequency";
 
   ArmArchTimerReadReg (CntFrq, &ArchTimerFreq);
@@ -196,91 +327,28 @@ UpdateRefClk (IN VOID* Fdt)
     return EFI_INVALID_PARAMETER;
   }
 
-  node = fdt_subnode_offset(Fdt, 0, "soc");
-  if (node < 0) {
-    DEBUG ((DEBUG_ERROR, "can not find soc node\n"));
-    return EFI_INVALID_PARAMETER;
-  }
-
-  node = fdt_subnode_offset(Fdt, node, "refclk");
+  node = fdt_path_offset(Fdt, "/soc/refclk");
   if (node < 0) {
     DEBUG ((DEBUG_ERROR, "can not find refclk node\n"));
     return EFI_INVALID_PARAMETER;
   }
 
-  m_prop = fdt_get_property_w(Fdt, node, Property, &m_oldlen);
-  if(!m_prop) {
+  if(!fdt_getprop(Fdt, node, Property, NULL)) {
     DEBUG ((DEBUG_ERROR, "[%a]:[%dL] Can't find property %a\n", __FUNCTION__, __LINE__, Property));
     return EFI_INVALID_PARAMETER;
   }
 
-  Error = fdt_delprop(Fdt, node, Property);
-  if (Error) {
-    DEBUG ((DEBUG_ERROR, "ERROR: fdt_delprop() %a: %a\n", Property, fdt_strerror (Error)));
-    return EFI_INVALID_PARAMETER;
-  }
-
   // UINT32 is enough for refclk data length
-  Data = (UINT32) ArchTimerFreq;
-  Data = cpu_to_fdt32 (Data);
-  Error = fdt_setprop(Fdt, node, Property, &Data, sizeof(Data));
-  if (Error) {
-    DEBUG ((DEBUG_ERROR, "ERROR:fdt_setprop() %a: %a\n", Property, fdt_strerror (Error)));
-    return EFI_INVALID_PARAMETER;
-  }
-
-  DEBUG ((DEBUG_INFO, "Update refclk successfully.\n"));
-  return EFI_SUCCESS;
-}
-
-INTN
-GetMemoryNode(VOID* Fdt)
-{
-    INTN                node;
-    int                 m_oldlen;
-    struct              fdt_property *m_prop;
-    INTN                Error = 0;
-
-
-    node = fdt_subnode_offset(Fdt, 0, "memory");
-    if (node < 0)
-    {
-        // Create the memory node
-        node = fdt_add_subnode(Fdt, 0, "memory");
-
-        if(node < 0)
-        {
-          DEBUG((EFI_D_ERROR, "[%a]:[%dL] fdt add subnode error\n", __FUNCTION__, __LINE__));
-
-          return node;
-        }
-
-    }
-    //find the memory node property
-    m_prop = fdt_get_property_w(Fdt, node, "memory", &m_oldlen);
-    if(m_prop)
-    {
-        Error = fdt_delprop(Fdt, node, "reg");
-
-        if (Error)
-        {
-            DEBUG ((EFI_D_ERROR, "ERROR:fdt_delprop(): %a\n", fdt_strerror (Error)));
-            node = -1;
-            return node;
-        }
-    }
-
-    return node;
+  mRefClkFrequency = cpu_to_fdt32 ((UINT32) ArchTimerFreq);
+  return FdtUpdateBatchAdd (Batch, "/soc/refclk", Property, &mRefClkFrequency, sizeof(mRefClkFrequency));
 }
 
 
-EFI_STATUS UpdateMemoryNode(VOID* Fdt)
+EFI_STATUS UpdateMemoryNode(IN OUT FDT_UPDATE_BATCH* Batch, OUT PHY_MEM_REGION** Regions)
 {
-    INTN                Error = 0;
     EFI_STATUS          Status = EFI_SUCCESS;
     UINT32              Index = 0;
     UINT32              MemIndex;
-    INTN                node;
     EFI_MEMORY_DESCRIPTOR *MemoryMap;
     EFI_MEMORY_DESCRIPTOR *MemoryMapPtr;
     EFI_MEMORY_DESCRIPTOR *MemoryMapPtrCurrent;
@@ -296,12 +364,7 @@ EFI_STATUS UpdateMemoryNode(VOID* Fdt)
     UINTN                 MemoryMapCurrentStartAddress;
     BOOLEAN               FindMemoryRegionFlag = FALSE;
 
-    node = GetMemoryNode(Fdt);
-    if (node < 0)
-    {
-        DEBUG((EFI_D_ERROR, "Can not find memory node\n"));
-        return EFI_NOT_FOUND;
-    }
+    *Regions = NULL;
     MemoryMap = NULL;
     MemoryMapSize = 0;
     MemIndex = 0;
@@ -382,18 +445,17 @@ EFI_STATUS UpdateMemoryNode(VOID* Fdt)
         mRegion[MemIndex].LengthLow = cpu_to_fdt32(MemoryMapLastEndAddress-MemoryMapcontinuousStartAddress);
     }
 
-    Error = fdt_setprop(Fdt, node, "reg",mRegion,sizeof(PHY_MEM_REGION) *(MemIndex+1));
-
-    FreePool (mRegion);
     FreePages (MemoryMap, Pages0);
-    if (Error)
+
+    Status = FdtUpdateBatchAdd (Batch, "/memory", "reg", mRegion, sizeof(PHY_MEM_REGION) *(MemIndex+1));
+    if (EFI_ERROR (Status))
     {
-        DEBUG ((EFI_D_ERROR, "ERROR:fdt_setprop(): %a\n", fdt_strerror (Error)));
-        Status = EFI_INVALID_PARAMETER;
+        FreePool (mRegion);
         return Status;
     }
 
-  return Status;
+    *Regions = mRegion;
+    return Status;
 }
 
 
@@ -407,75 +469,92 @@ UpdateNumaNode(VOID* Fdt)
  * Entry point for fdtupdate lib.
  */
 
-EFI_STATUS EFIFdtUpdate(UINTN FdtFileAddr)
+EFI_STATUS EFIFdtUpdate(UINTN FdtFileAddr, VOID **NewFdtBlob, UINTN *NewFdtBlobSize)
 {
     INTN                Error;
-    VOID*               Fdt;
-    UINT32              Size;
-    UINTN               NewFdtBlobSize;
-    UINTN               NewFdtBlobBase;
+    CONST VOID*         Fdt;
+    VOID*               NewFdt;
+    UINTN               NewFdtSize;
+    FDT_UPDATE_BATCH    Batch;
+    PHY_MEM_REGION      *MemRegions;
     EFI_STATUS          Status = EFI_SUCCESS;
     EFI_STATUS          UpdateNumaStatus = EFI_SUCCESS;
 
 
-    Error = fdt_check_header ((VOID*)(FdtFileAddr));
+    Fdt = (CONST VOID*)FdtFileAddr;
+    Error = fdt_check_header (Fdt);
     if (0 != Error)
     {
         DEBUG ((EFI_D_ERROR,"ERROR: Device Tree header not valid (%a)\n", fdt_strerror(Error)));
         return EFI_INVALID_PARAMETER;
     }
 
-    Size = (UINTN)fdt_totalsize ((VOID*)(UINTN)(FdtFileAddr));
-    NewFdtBlobSize = Size + ADD_FILE_LENGTH;
-    Fdt = (VOID*)(UINTN)FdtFileAddr;
+    //
+    // Collect all the updates against the original FDT first
+    //
+    Batch.Count = 0;
+    MemRegions = NULL;
 
-    Status = gBS->AllocatePages (AllocateAnyPages, EfiBootServicesData, EFI_SIZE_TO_PAGES(NewFdtBlobSize), &NewFdtBlobBase);
+    Status = DelPhyhandleUpdateMacAddress(Fdt, &Batch);
     if (EFI_ERROR (Status))
     {
-        return EFI_OUT_OF_RESOURCES;
+        DEBUG ((EFI_D_ERROR, "DelPhyhandleUpdateMacAddress fail:\n"));
+        Status = EFI_SUCCESS;
     }
 
-
-    Error = fdt_open_into(Fdt,(VOID*)(UINTN)(NewFdtBlobBase), (NewFdtBlobSize));
-    if (Error) {
-        DEBUG ((EFI_D_ERROR, "ERROR:fdt_open_into(): %a\n", fdt_strerror (Error)));
-        Status = EFI_INVALID_PARAMETER;
-        goto EXIT;
+    Status =  UpdateRefClk (Fdt, &Batch);
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "UpdateiRefClk fail.\n"));
     }
 
-    Fdt = (VOID*)(UINTN)NewFdtBlobBase;
-    Status = DelPhyhandleUpdateMacAddress(Fdt);
+    Status = UpdateMemoryNode(&Batch, &MemRegions);
     if (EFI_ERROR (Status))
     {
-        DEBUG ((EFI_D_ERROR, "DelPhyhandleUpdateMacAddress fail:\n"));
-        Status = EFI_SUCCESS;
+        DEBUG ((EFI_D_ERROR, "UpdateMemoryNode Error\n"));
+        return Status;
     }
 
-    Status =  UpdateRefClk (Fdt);
-    if (EFI_ERROR (Status)) {
-      DEBUG ((DEBUG_ERROR, "UpdateiRefClk fail.\n"));
+    //
+    // Then copy the FDT once into a buffer large enough for all of them
+    //
+    NewFdtSize = ALIGN_VALUE (FdtUpdateBatchSize (Fdt, &Batch), EFI_PAGE_SIZE);
+    NewFdt = AllocateRuntimePages (EFI_SIZE_TO_PAGES (NewFdtSize));
+    if (NewFdt == NULL)
+    {
+        Status = EFI_OUT_OF_RESOURCES;
+        goto EXIT;
+    }
+
+    Error = fdt_open_into(Fdt, NewFdt, NewFdtSize);
+    if (Error) {
+        DEBUG ((EFI_D_ERROR, "ERROR:fdt_open_into(): %a\n", fdt_strerror (Error)));
+        Status = EFI_INVALID_PARAMETER;
+        FreePages (NewFdt, EFI_SIZE_TO_PAGES (NewFdtSize));
+        goto EXIT;
     }
 
-    Status = UpdateMemoryNode(Fdt);
+    Status = FdtUpdateBatchApply (NewFdt, &Batch);
     if (EFI_ERROR (Status))
     {
-        DEBUG ((EFI_D_ERROR, "UpdateMemoryNode Error\n"));
+        DEBUG ((EFI_D_ERROR, "FdtUpdateBatchApply Error\n"));
+        FreePages (NewFdt, EFI_SIZE_TO_PAGES (NewFdtSize));
         goto EXIT;
     }
 
-    UpdateNumaStatus = UpdateNumaNode(Fdt);
+    UpdateNumaStatus = UpdateNumaNode(NewFdt);
     if (EFI_ERROR (UpdateNumaStatus))
     {
         DEBUG ((EFI_D_ERROR, "Update NumaNode fail\n"));
     }
 
-    gBS->CopyMem(((VOID*)(UINTN)(FdtFileAddr)),((VOID*)(UINTN)(NewFdtBlobBase)),NewFdtBlobSize);
+    *NewFdtBlob = NewFdt;
+    *NewFdtBlobSize = NewFdtSize;
 
 EXIT:
-    gBS->FreePages(NewFdtBlobBase,EFI_SIZE_TO_PAGES(NewFdtBlobSize));
+    if (MemRegions != NULL)
+    {
+        FreePool (MemRegions);
+    }
 
     return Status;
-
-
-
 }
@@ -982,6 +982,11 @@ EnumUsbKeyboard (
   Connect with predeined platform connect sequence,
   the OEM/IBV can customize with their own connect sequence.
 
+  Each PCI root bridge tree is connected on its own first so that the
+  performance table shows what every tree costs; the individual driver
+  Start() calls inside are already timed by the DXE core. Whatever is left
+  is picked up by EfiBootManagerConnectAll ().
+
   @param[in] BootMode          Boot mode of this boot.
 **/
 VOID
@@ -989,7 +994,30 @@ ConnectSequence (
   IN EFI_BOOT_MODE         BootMode
   )
 {
+  EFI_STATUS                       Status;
+  UINTN                            RootBridgeHandleCount;
+  EFI_HANDLE                       *RootBridgeHandleBuffer;
+  UINTN                            RootBridgeIndex;
+
+  Status = gBS->LocateHandleBuffer (
+                  ByProtocol,
+                  &gEfiPciRootBridgeIoProtocolGuid,
+                  NULL,
+                  &RootBridgeHandleCount,
+                  &RootBridgeHandleBuffer
+                  );
+  if (!EFI_ERROR (Status)) {
+    for (RootBridgeIndex = 0; RootBridgeIndex < RootBridgeHandleCount; RootBridgeIndex++) {
+      PERF_START_EX (RootBridgeHandleBuffer[RootBridgeIndex], "ConnectRb", NULL, AsmReadTsc(), 0x7052);
+      gBS->ConnectController (RootBridgeHandleBuffer[RootBridgeIndex], NULL, NULL, TRUE);
+      PERF_END_EX (RootBridgeHandleBuffer[RootBridgeIndex], "ConnectRb", NULL, AsmReadTsc(), 0x7053);
+    }
+    FreePool (RootBridgeHandleBuffer);
+  }
+
+  PERF_START_EX (NULL, "ConnectAll", NULL, AsmReadTsc(), 0x7054);
   EfiBootManagerConnectAll ();
+  PERF_END_EX (NULL, "ConnectAll", NULL, AsmReadTsc(), 0x7055);
 }
 
 
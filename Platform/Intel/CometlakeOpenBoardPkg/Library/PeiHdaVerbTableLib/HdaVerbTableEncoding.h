@@ -0,0 +1,51 @@
+/** @file
+  Compact encoding of the Intel HD Audio verb tables of this library.
+
+  Encoded tables are stored with the same header as HDAUDIO_VERB_TABLE, but
+  their data DWORDs are either a plain verb, which always has the codec
+  address field [31:28] clear, or one of the commands below that have it set:
+
+  HDA_ENC_PIN_CONFIG - NID in [27:20], the next DWORD is the 32-bit pin
+                       configuration default. Expands to the four
+                       Set Configuration Default verbs of the pin.
+  HDA_ENC_COEF       - NID in [27:20], count in [15:0], followed by count
+                       DWORDs of (Index << 16 | Value). Each one expands to a
+                       Set Coefficient Index and Set Processing Coefficient
+                       verb pair.
+
+  Copyright (c) 2020, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#ifndef _HDA_VERB_TABLE_ENCODING_H_
+#define _HDA_VERB_TABLE_ENCODING_H_
+
+#include <ConfigBlock/HdAudioConfig.h>
+
+typedef HDAUDIO_VERB_TABLE HDAUDIO_ENCODED_VERB_TABLE;
+
+#define HDA_ENC_CMD_MASK                  0xF0000000
+#define HDA_ENC_NID_MASK                  0x0FF00000
+#define HDA_ENC_COUNT_MASK                0x0000FFFF
+#define HDA_ENC_PIN_CONFIG                0xF0000000
+#define HDA_ENC_COEF                      0xE0000000
+
+#define HDA_VERB_SET_CONFIG_DEFAULT_BYTE0 0x00071C00
+#define HDA_VERB_SET_COEF_INDEX           0x00050000
+#define HDA_VERB_SET_PROC_COEF            0x00040000
+
+///
+/// Set the pin configuration default of a pin widget
+///
+#define HDA_PIN_CONFIG(Nid,Config) \
+  (HDA_ENC_PIN_CONFIG | ((UINT32)(Nid) << 20)), (UINT32)(Config)
+
+///
+/// Write a list of HDA_COEF () processing coefficients of a widget
+///
+#define HDA_COEF_WRITES(Nid,...) \
+  (HDA_ENC_COEF | ((UINT32)(Nid) << 20) | (sizeof((UINT32[]){__VA_ARGS__})/sizeof(UINT32))), __VA_ARGS__
+
+#define HDA_COEF(Index,Value)             (((UINT32)(Index) << 16) | (UINT16)(Value))
+
+#endif
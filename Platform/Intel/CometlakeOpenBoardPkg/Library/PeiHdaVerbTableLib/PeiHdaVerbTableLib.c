@@ -13,12 +13,94 @@
 #include <Library/HdaVerbTableLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/PcdLib.h>
+#include "HdaVerbTableEncoding.h"
 
-extern HDAUDIO_VERB_TABLE HdaVerbTableDisplayAudio;
-extern HDAUDIO_VERB_TABLE HdaVerbTableAlc274;
-extern HDAUDIO_VERB_TABLE HdaVerbTableAlc700;
-extern HDAUDIO_VERB_TABLE HdaVerbTableAlc701;
-extern HDAUDIO_VERB_TABLE WhlHdaVerbTableAlc700;
+extern HDAUDIO_ENCODED_VERB_TABLE HdaVerbTableDisplayAudio;
+extern HDAUDIO_ENCODED_VERB_TABLE HdaVerbTableAlc274;
+extern HDAUDIO_ENCODED_VERB_TABLE HdaVerbTableAlc700;
+extern HDAUDIO_ENCODED_VERB_TABLE HdaVerbTableAlc701;
+extern HDAUDIO_ENCODED_VERB_TABLE WhlHdaVerbTableAlc700;
+
+/**
+  Expand a verb table from the compact encoding of HdaVerbTableEncoding.h
+  into the plain verb list format consumed by HD Audio initialization.
+
+  @param[in] EncodedTable           Encoded verb table
+
+  @retval    Pointer to the expanded verb table, NULL if out of resources
+**/
+STATIC
+HDAUDIO_VERB_TABLE *
+InternalExpandVerbTable (
+  IN CONST HDAUDIO_ENCODED_VERB_TABLE  *EncodedTable
+  )
+{
+  CONST UINT32            *Data;
+  UINTN                   DataDwords;
+  UINTN                   Index;
+  UINTN                   Count;
+  UINTN                   Byte;
+  UINT32                  Nid;
+  HDAUDIO_VERB_TABLE      *VerbTable;
+  UINT32                  *Verb;
+
+  Data = EncodedTable->Data;
+
+  //
+  // Size the expanded table first, so it can be allocated in one go
+  //
+  DataDwords = 0;
+  for (Index = 0; Index < EncodedTable->Header.DataDwords; Index++) {
+    switch (Data[Index] & HDA_ENC_CMD_MASK) {
+      case HDA_ENC_PIN_CONFIG:
+        Index++;
+        DataDwords += 4;
+        break;
+      case HDA_ENC_COEF:
+        Count = Data[Index] & HDA_ENC_COUNT_MASK;
+        Index += Count;
+        DataDwords += 2 * Count;
+        break;
+      default:
+        DataDwords++;
+        break;
+    }
+  }
+  ASSERT (Index == EncodedTable->Header.DataDwords);
+
+  VerbTable = AllocatePool (sizeof (PCH_HDA_VERB_TABLE_HEADER) + DataDwords * sizeof (UINT32));
+  if (VerbTable == NULL) {
+    DEBUG ((DEBUG_ERROR, "HDA: Out of resources expanding verb table\n"));
+    return NULL;
+  }
+  CopyMem (&VerbTable->Header, &EncodedTable->Header, sizeof (PCH_HDA_VERB_TABLE_HEADER));
+  VerbTable->Header.DataDwords = (UINT16) DataDwords;
+
+  Verb = VerbTable->Data;
+  for (Index = 0; Index < EncodedTable->Header.DataDwords; Index++) {
+    Nid = Data[Index] & HDA_ENC_NID_MASK;
+    switch (Data[Index] & HDA_ENC_CMD_MASK) {
+      case HDA_ENC_PIN_CONFIG:
+        Index++;
+        for (Byte = 0; Byte < 4; Byte++) {
+          *Verb++ = Nid | (HDA_VERB_SET_CONFIG_DEFAULT_BYTE0 + ((UINT32) Byte << 8)) | ((Data[Index] >> (Byte * 8)) & 0xFF);
+        }
+        break;
+      case HDA_ENC_COEF:
+        for (Count = Data[Index] & HDA_ENC_COUNT_MASK; Count > 0; Count--) {
+          Index++;
+          *Verb++ = Nid | HDA_VERB_SET_COEF_INDEX | (Data[Index] >> 16);
+          *Verb++ = Nid | HDA_VERB_SET_PROC_COEF | (Data[Index] & 0xFFFF);
+        }
+        break;
+      default:
+        *Verb++ = Data[Index];
+        break;
+    }
+  }
+
+  return VerbTable;
+}
 
 /**
   Add verb table helper function.
@@ -107,31 +189,39 @@ HdaVerbTableInit (
 {
   HDAUDIO_VERB_TABLE *VerbTable;
   HDAUDIO_VERB_TABLE *VerbTable2;
+  HDAUDIO_VERB_TABLE *VerbTableAlc700;
+  HDAUDIO_VERB_TABLE *VerbTableAlc701;
 
   VerbTable = NULL;
   VerbTable2 = NULL;
 
+  //
+  // Tables are kept encoded in the image, expand each used one only once
+  //
+  VerbTableAlc700 = InternalExpandVerbTable (&HdaVerbTableAlc700);
+  VerbTableAlc701 = InternalExpandVerbTable (&HdaVerbTableAlc701);
+
   switch (BoardId) {
 
     case BoardIdCometLakeULpddr3Rvp:
-      VerbTable = &WhlHdaVerbTableAlc700;
+      VerbTable = InternalExpandVerbTable (&WhlHdaVerbTableAlc700);
       break;
 
     default:
       DEBUG ((DEBUG_INFO, "HDA: Init default verb tables (Realtek ALC700 and ALC701)\n"));
-      VerbTable = &HdaVerbTableAlc700;
-      VerbTable2 = &HdaVerbTableAlc701;
+      VerbTable = VerbTableAlc700;
+      VerbTable2 = VerbTableAlc701;
       break;
   }
 
   PcdSet32S (PcdHdaVerbTable, (UINT32) VerbTable);
   PcdSet32S (PcdHdaVerbTable2, (UINT32) VerbTable2);
-  PcdSet32S (PcdDisplayAudioHdaVerbTable, (UINT32) &HdaVerbTableDisplayAudio);
+  PcdSet32S (PcdDisplayAudioHdaVerbTable, (UINT32) InternalExpandVerbTable (&HdaVerbTableDisplayAudio));
 
   // Codecs - Realtek ALC700, ALC701, ALC274 (external - connected via HDA header)
-  PcdSet32S (PcdCommonHdaVerbTable1, (UINT32) &HdaVerbTableAlc700);
-  PcdSet32S (PcdCommonHdaVerbTable2, (UINT32) &HdaVerbTableAlc701);
-  PcdSet32S (PcdCommonHdaVerbTable3, (UINT32) &HdaVerbTableAlc274);
+  PcdSet32S (PcdCommonHdaVerbTable1, (UINT32) VerbTableAlc700);
+  PcdSet32S (PcdCommonHdaVerbTable2, (UINT32) VerbTableAlc701);
+  PcdSet32S (PcdCommonHdaVerbTable3, (UINT32) InternalExpandVerbTable (&HdaVerbTableAlc274));
 
   return EFI_SUCCESS;
 }
@@ -28,6 +28,7 @@ extern UINT8                      gCurrentDiscreteTbtRootPortType;
 
 BOOLEAN isLegacyDevice          = FALSE;
 STATIC UINT8 TbtSegment         = 0;
+STATIC HR_CACHE mHrCache        = { 0 };
 
 STATIC
 VOID
@@ -350,12 +351,18 @@ SetDevResources (
 
   for (Fun = 0; Fun < MaxFun; ++Fun) {
     gDeviceBaseAddress = PCI_SEGMENT_LIB_ADDRESS (TbtSegment, Bus, Dev, Fun, 0);
-    PciSegmentWrite8 (gDeviceBaseAddress + PCI_COMMAND_OFFSET, CMD_BUS_MASTER);
-    Cmd = PciSegmentRead8 (gDeviceBaseAddress + PCI_COMMAND_OFFSET);
     if (0xFFFF == PciSegmentRead16 (gDeviceBaseAddress + PCI_DEVICE_ID_OFFSET)) {
       continue;
 
     }
+    if ((Fun == 0) && !(PciSegmentRead8 (gDeviceBaseAddress + PCI_HEADER_TYPE_OFFSET) & HEADER_TYPE_MULTI_FUNCTION)) {
+      //
+      // Only function 0 exists, don't probe the others
+      //
+      MaxFun = 1;
+    }
+    PciSegmentWrite8 (gDeviceBaseAddress + PCI_COMMAND_OFFSET, CMD_BUS_MASTER);
+    Cmd = PciSegmentRead8 (gDeviceBaseAddress + PCI_COMMAND_OFFSET);
 
     for (Reg = PCI_BASE_ADDRESSREG_OFFSET; Reg <= MaxBar; Reg += 4) {
       BarReq = SaveSetGetRestoreBar(gDeviceBaseAddress + Reg); // Perform BAR sizing
@@ -875,6 +882,78 @@ InitializeHostRouter (
   PciSegmentWrite8 (gDeviceBaseAddress + PCI_COMMAND_OFFSET, CMD_BM_MEM);
   return Ret;
 } // InitializeHostRouter
+
+STATIC
+VOID
+GetRpRegs (
+  IN   UINTN   RpSegment,
+  IN   UINTN   RpBus,
+  IN   UINTN   RpDevice,
+  IN   UINTN   RpFunction,
+  OUT  UINT32  *RpRegs
+  )
+{
+  gDeviceBaseAddress = PCI_SEGMENT_LIB_ADDRESS (RpSegment, RpBus, RpDevice, RpFunction, 0);
+  RpRegs[0] = PciSegmentRead32 (gDeviceBaseAddress + PCI_BRIDGE_PRIMARY_BUS_REGISTER_OFFSET) & 0x00FFFFFF;
+  RpRegs[1] = PciSegmentRead16 (gDeviceBaseAddress + OFFSET_OF (PCI_TYPE01, Bridge.IoBase));
+  RpRegs[2] = PciSegmentRead32 (gDeviceBaseAddress + OFFSET_OF (PCI_TYPE01, Bridge.MemoryBase));
+  RpRegs[3] = PciSegmentRead32 (gDeviceBaseAddress + OFFSET_OF (PCI_TYPE01, Bridge.PrefetchableMemoryBase));
+  RpRegs[4] = PciSegmentRead32 (gDeviceBaseAddress + OFFSET_OF (PCI_TYPE01, Bridge.PrefetchableBaseUpper32));
+  RpRegs[5] = PciSegmentRead32 (gDeviceBaseAddress + OFFSET_OF (PCI_TYPE01, Bridge.PrefetchableLimitUpper32));
+} // GetRpRegs
+
+STATIC
+BOOLEAN
+IsHostRouterConfigured (
+  OUT  HR_CONFIG  *Hr_Config,
+  IN   UINTN      RpSegment,
+  IN   UINTN      RpBus,
+  IN   UINTN      RpDevice,
+  IN   UINTN      RpFunction
+  )
+{
+  UINT32       RpRegs[HR_CACHE_RP_REGS];
+  UINT32       BusRegs;
+  BRDG_CONFIG  *Brdg;
+  UINT8        i;
+
+  if (!mHrCache.Valid ||
+      mHrCache.RpSegment != RpSegment || mHrCache.RpBus != RpBus ||
+      mHrCache.RpDevice != RpDevice || mHrCache.RpFunction != RpFunction) {
+    return FALSE;
+  }
+  TbtSegment = (UINT8)RpSegment;
+  //
+  // Host router resources are carved out of root port windows, those must not have changed
+  //
+  GetRpRegs (RpSegment, RpBus, RpDevice, RpFunction, RpRegs);
+  if (CompareMem (RpRegs, mHrCache.RpRegs, sizeof (RpRegs)) != 0) {
+    return FALSE;
+  }
+  gDeviceBaseAddress = PCI_SEGMENT_LIB_ADDRESS (RpSegment, mHrCache.HrConfig.HRBus, 0x00, 0x00, 0);
+  if (PciSegmentRead16 (gDeviceBaseAddress + PCI_DEVICE_ID_OFFSET) != mHrCache.HrConfig.DeviceId) {
+    return FALSE;
+  }
+  //
+  // Host router bridges lose their bus numbers when host router is reset or powered off,
+  // so if they all still hold what InitializeHostRouter programmed, so does the rest of it
+  //
+  for (i = 0; i < mHrCache.HrConfig.BridgeLoops; ++i) {
+    Brdg = &HrConfigs[i];
+    gDeviceBaseAddress = PCI_SEGMENT_LIB_ADDRESS (TbtSegment, Brdg->DevId.Bus, Brdg->DevId.Dev, Brdg->DevId.Fun, 0);
+    BusRegs = PciSegmentRead32 (gDeviceBaseAddress + PCI_BRIDGE_PRIMARY_BUS_REGISTER_OFFSET) & 0x00FFFFFF;
+    if (BusRegs != (Brdg->PBus | ((UINT32) Brdg->SBus << 8) | ((UINT32) Brdg->SubBus << 16))) {
+      return FALSE;
+    }
+    if (PciSegmentRead8 (gDeviceBaseAddress + PCI_COMMAND_OFFSET) != Brdg->Res.Cmd) {
+      return FALSE;
+    }
+  }
+
+  CopyMem (Hr_Config, &mHrCache.HrConfig, sizeof (HR_CONFIG));
+  return TRUE;
+} // IsHostRouterConfigured
+
 STATIC
 UINT8
 ConfigureSlot (
@@ -1468,9 +1547,21 @@ ThunderboltCallback (
       return;
     }
     GetDTbtRpDevFun(gCurrentDiscreteTbtRootPortType, gCurrentDiscreteTbtRootPort - 1, &Device, &Function);
-    DEBUG((DEBUG_INFO, "InitializeHostRouter. \n"));
-    if (!InitializeHostRouter (&HrConfig, Segment, Bus, Device, Function)) {
-      return ;
+    if (IsHostRouterConfigured (&HrConfig, Segment, Bus, Device, Function)) {
+      DEBUG((DEBUG_INFO, "HostRouter already configured. \n"));
+    } else {
+      DEBUG((DEBUG_INFO, "InitializeHostRouter. \n"));
+      mHrCache.Valid = FALSE;
+      if (!InitializeHostRouter (&HrConfig, Segment, Bus, Device, Function)) {
+        return ;
+      }
+      mHrCache.RpSegment  = Segment;
+      mHrCache.RpBus      = Bus;
+      mHrCache.RpDevice   = Device;
+      mHrCache.RpFunction = Function;
+      GetRpRegs (Segment, Bus, Device, Function, mHrCache.RpRegs);
+      CopyMem (&mHrCache.HrConfig, &HrConfig, sizeof (HR_CONFIG));
+      mHrCache.Valid      = TRUE;
     }
   //
   // Configure DS ports
@@ -1598,6 +1689,7 @@ TbtDisablePCIDevicesAndBridges (
     }
     TbtSegment = (UINT8)Segment;
     MinBus++;
+    mHrCache.Valid = FALSE;
     //
     // @todo : Move this out when we dont have Loop for ITBT
     //
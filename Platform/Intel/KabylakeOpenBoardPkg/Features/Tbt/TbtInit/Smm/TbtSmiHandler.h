@@ -121,6 +121,22 @@ typedef struct _HR_CONFIG {
   UINT8   BridgeLoops;
 } HR_CONFIG;
 
+#define HR_CACHE_RP_REGS      6
+
+//
+// Host router configuration kept in SMRAM between hot-plug SMIs, so that
+// it doesn't need to be programmed again while the host router keeps it
+//
+typedef struct _HR_CACHE {
+  BOOLEAN    Valid;
+  UINTN      RpSegment;
+  UINTN      RpBus;
+  UINTN      RpDevice;
+  UINTN      RpFunction;
+  UINT32     RpRegs[HR_CACHE_RP_REGS];
+  HR_CONFIG  HrConfig;
+} HR_CACHE;
+
 STATIC const BRDG_RES_CONFIG  NOT_IN_USE_BRIDGE = {
   CMD_BUS_MASTER,
   0,
@@ -44,12 +44,16 @@ PeiFspMiscUpdUpdatePreMem (
 
   //
   // Initialize S3 Data variable (S3DataPtr). It may be used for warm and fast boot paths.
+  // It is only used when it matches the size and CRC32 saved with it, otherwise
+  // memory is trained again.
   //
   VariableSize = 0;
   MemorySavedData = NULL;
-  Status = PeiGetVariable (
+  Status = PeiGetMemoryConfig (
              L"MemoryConfig",
              &gFspNonVolatileStorageHobGuid,
+             NULL,
+             0,
              &MemorySavedData,
              &VariableSize
              );
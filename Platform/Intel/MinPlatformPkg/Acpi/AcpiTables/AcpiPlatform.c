@@ -38,6 +38,23 @@ typedef union {
 
 #pragma pack()
 
+//
+// The MADT and MCFG built by this driver are saved in a variable and installed
+// as they are on the next boot, unless anything they are built from changed.
+//
+#define ACPI_TABLE_CACHE_VARIABLE_NAME  L"AcpiPlatformTableCache"
+#define ACPI_TABLE_CACHE_SIGNATURE      SIGNATURE_32 ('A', 'T', 'B', 'C')
+
+typedef struct {
+  UINT32   Signature;
+  UINT32   InputCrc;           // CRC32 of the inputs the MADT and MCFG are built from
+  UINT32   HardwareSignature;  // FACS hardware signature of the boot that saved the cache
+  UINT32   MadtLength;
+  UINT32   McfgLength;
+//UINT8    Madt[MadtLength];
+//UINT8    Mcfg[McfgLength];
+} ACPI_TABLE_CACHE_HEADER;
+
 extern EFI_ACPI_5_0_FIRMWARE_ACPI_CONTROL_STRUCTURE  Facs;
 extern EFI_ACPI_5_0_FIXED_ACPI_DESCRIPTION_TABLE Fadt;
 extern EFI_ACPI_HIGH_PRECISION_EVENT_TIMER_TABLE_HEADER  Hpet;
@@ -62,6 +79,12 @@ EFI_CPU_ID_ORDER_MAP        mCpuApicIdOrderTable[MAX_CPU_NUM];
 UINTN                       mNumberOfCPUs = 0;
 UINTN                       mNumberOfEnabledCPUs = 0;
 
+UINT32                      mHardwareSignature = 0;
+UINT32                      mTableCacheInputCrc = 0;
+UINT32                      mTableCacheHardwareSignature = 0;
+BOOLEAN                     mTableCacheInstalled = FALSE;
+ACPI_TABLE_CACHE_HEADER     *mTableCache = NULL;
+
 // following are possible APICID Map for SKX
 static const UINT32 ApicIdMapA[] = {  //for SKUs have number of core > 16
   //it is 14 + 14 + 14 + 14 format
@@ -110,6 +133,48 @@ static const UINT32 ApicIdMapD[] = { //for SKUs have number of cores <= 8 use 16
 
 const UINT32 *mApicIdMap = NULL;
 
+//
+// Reverse lookup of mApicIdMap: CoreThreadId -> index of mApicIdMap.
+// All the valid IDs in the maps above are below 0x40.
+//
+#define APIC_ID_MAP_INDEX_COUNT  0x40
+UINT32       mApicIdMapIndex[APIC_ID_MAP_INDEX_COUNT];
+
+/**
+  This function builds the reverse lookup table of the selected ApicID Map,
+  so that GetIndexFromApicId does not need to scan the map for every CPU.
+
+  @param None
+
+  @retval VOID
+
+**/
+VOID
+BuildApicIdMapIndex (
+  VOID
+  )
+{
+  UINT32 MaxIndex;
+  UINT32 Index;
+
+  MaxIndex = FixedPcdGet32(PcdMaxCpuCoreCount) * FixedPcdGet32(PcdMaxCpuThreadCount);
+
+  for (Index = 0; Index < APIC_ID_MAP_INDEX_COUNT; Index++) {
+    mApicIdMapIndex[Index] = MaxIndex;
+  }
+
+  //
+  // Walk backward so that the first matching index wins, as the linear scan did.
+  //
+  Index = (UINT32) MIN (MaxIndex, sizeof (ApicIdMapA) / sizeof (ApicIdMapA[0]));
+  while (Index > 0) {
+    Index--;
+    if (mApicIdMap[Index] < APIC_ID_MAP_INDEX_COUNT) {
+      mApicIdMapIndex[mApicIdMap[Index]] = Index;
+    }
+  }
+}
+
 /**
   This function detect the APICID map and update ApicID Map pointer
 
@@ -156,6 +221,8 @@ VOID DetectApicIdMap(VOID)
 
   }
 
+  BuildApicIdMapIndex ();
+
   return;
 }
 
@@ -179,6 +246,10 @@ GetIndexFromApicId (
 
   CoreThreadId = ApicId & ((1 << mNumOfBitShift) - 1);
 
+  if (CoreThreadId < APIC_ID_MAP_INDEX_COUNT) {
+    return mApicIdMapIndex[CoreThreadId];
+  }
+
   for(i = 0; i < (FixedPcdGet32(PcdMaxCpuCoreCount) * FixedPcdGet32(PcdMaxCpuThreadCount)); i++) {
     if(mApicIdMap[i] == CoreThreadId) {
       break;
@@ -373,6 +444,8 @@ SortCpuLocalApicInTable (
     }
 
     //Make sure no holes between enabled threads
+    //Single pass: Index is the next free slot, enabled entries keep their order
+    Index = 0;
     for(CurrProcessor = 0; CurrProcessor < MAX_CPU_NUM; CurrProcessor++) {
 
       if(mCpuApicIdOrderTable[CurrProcessor].Flags == 0) {
@@ -380,24 +453,23 @@ SortCpuLocalApicInTable (
         mCpuApicIdOrderTable[CurrProcessor].ApicId = (UINT32)-1;
         mCpuApicIdOrderTable[CurrProcessor].AcpiProcessorId = (UINT32)-1;
         mCpuApicIdOrderTable[CurrProcessor].SwProcApicId = (UINT32)-1;
+        continue;
+      }
 
-        for(Index = CurrProcessor+1; Index < MAX_CPU_NUM; Index++) {
-          if(mCpuApicIdOrderTable[Index].Flags == 1) {
-            //move enabled entry up
-            mCpuApicIdOrderTable[CurrProcessor].Flags = 1;
-            mCpuApicIdOrderTable[CurrProcessor].ApicId = mCpuApicIdOrderTable[Index].ApicId;
-            mCpuApicIdOrderTable[CurrProcessor].AcpiProcessorId = mCpuApicIdOrderTable[Index].AcpiProcessorId;
-            mCpuApicIdOrderTable[CurrProcessor].SwProcApicId = mCpuApicIdOrderTable[Index].SwProcApicId;
-            mCpuApicIdOrderTable[CurrProcessor].SocketNum = mCpuApicIdOrderTable[Index].SocketNum;
-            //disable moved entry
-            mCpuApicIdOrderTable[Index].Flags = 0;
-            mCpuApicIdOrderTable[Index].ApicId = (UINT32)-1;
-            mCpuApicIdOrderTable[Index].AcpiProcessorId = (UINT32)-1;
-            mCpuApicIdOrderTable[Index].SwProcApicId = (UINT32)-1;
-            break;
-          }
-        }
+      if(Index != CurrProcessor) {
+        //move enabled entry up
+        mCpuApicIdOrderTable[Index].Flags = 1;
+        mCpuApicIdOrderTable[Index].ApicId = mCpuApicIdOrderTable[CurrProcessor].ApicId;
+        mCpuApicIdOrderTable[Index].AcpiProcessorId = mCpuApicIdOrderTable[CurrProcessor].AcpiProcessorId;
+        mCpuApicIdOrderTable[Index].SwProcApicId = mCpuApicIdOrderTable[CurrProcessor].SwProcApicId;
+        mCpuApicIdOrderTable[Index].SocketNum = mCpuApicIdOrderTable[CurrProcessor].SocketNum;
+        //disable moved entry
+        mCpuApicIdOrderTable[CurrProcessor].Flags = 0;
+        mCpuApicIdOrderTable[CurrProcessor].ApicId = (UINT32)-1;
+        mCpuApicIdOrderTable[CurrProcessor].AcpiProcessorId = (UINT32)-1;
+        mCpuApicIdOrderTable[CurrProcessor].SwProcApicId = (UINT32)-1;
       }
+      Index++;
     }
 
     //keep for debug purpose
@@ -1444,7 +1516,7 @@ IsHardwareChange (
   //
   // Calculate CRC value with HWChange data.
   //
-  Status = gBS->CalculateCrc32(HWChange, HWChangeSize, &CRC);
+  Status = gBS->CalculateCrc32(HWChange, sizeof(UINT32) * HWChangeSize, &CRC);
   DEBUG((DEBUG_INFO, "CRC = %x and Status = %r\n", CRC, Status));
 
   //
@@ -1452,6 +1524,7 @@ IsHardwareChange (
   //
   FacsPtr = (EFI_ACPI_2_0_FIRMWARE_ACPI_CONTROL_STRUCTURE *)(UINTN)pFADT->FirmwareCtrl;
   FacsPtr->HardwareSignature = CRC;
+  mHardwareSignature = CRC;
   FreePool( HWChange );
 }
 
@@ -1485,6 +1558,241 @@ UpdateLocalTable (
   }
 }
 
+/**
+  Calculate the CRC32 of everything the MADT and MCFG are built from: the
+  processor information reported by the MP services, the APIC configuration,
+  the PCI segments and the PCDs used for the tables.
+
+  @retval The CRC32 of the inputs, or 0 if it could not be calculated.
+**/
+UINT32
+GetTableCacheInputCrc (
+  VOID
+  )
+{
+  EFI_STATUS                    Status;
+  EFI_PROCESSOR_INFORMATION     ProcessorInfo;
+  PCI_SEGMENT_INFO              *PciSegmentInfo;
+  UINTN                         SegmentCount;
+  UINT64                        *Inputs;
+  UINTN                         InputCount;
+  UINTN                         Index;
+  UINT64                        OemId;
+  UINT32                        Crc;
+
+  PciSegmentInfo = GetPciSegmentInfo (&SegmentCount);
+
+  Inputs = AllocateZeroPool (sizeof (UINT64) * (16 + 5 * mNumberOfCPUs + 4 * SegmentCount));
+  if (Inputs == NULL) {
+    return 0;
+  }
+
+  InputCount = 0;
+  Inputs[InputCount++] = mNumberOfCPUs;
+  Inputs[InputCount++] = mNumberOfEnabledCPUs;
+  Inputs[InputCount++] = mNumOfBitShift;
+  Inputs[InputCount++] = mX2ApicEnabled;
+  Inputs[InputCount++] = mForceX2ApicId;
+
+  for (Index = 0; Index < mNumberOfCPUs; Index++) {
+    Status = mMpService->GetProcessorInfo (mMpService, Index, &ProcessorInfo);
+    if (EFI_ERROR (Status)) {
+      FreePool (Inputs);
+      return 0;
+    }
+    Inputs[InputCount++] = ProcessorInfo.ProcessorId;
+    Inputs[InputCount++] = ProcessorInfo.StatusFlag;
+    Inputs[InputCount++] = ProcessorInfo.Location.Package;
+    Inputs[InputCount++] = ProcessorInfo.Location.Core;
+    Inputs[InputCount++] = ProcessorInfo.Location.Thread;
+  }
+
+  for (Index = 0; Index < SegmentCount; Index++) {
+    Inputs[InputCount++] = PciSegmentInfo[Index].SegmentNumber;
+    Inputs[InputCount++] = PciSegmentInfo[Index].BaseAddress;
+    Inputs[InputCount++] = PciSegmentInfo[Index].StartBusNumber;
+    Inputs[InputCount++] = PciSegmentInfo[Index].EndBusNumber;
+  }
+
+  OemId = 0;
+  CopyMem (&OemId, PcdGetPtr (PcdAcpiDefaultOemId), 6);
+  Inputs[InputCount++] = OemId;
+  Inputs[InputCount++] = PcdGet64 (PcdAcpiDefaultOemTableId);
+  Inputs[InputCount++] = PcdGet32 (PcdLocalApicAddress);
+  Inputs[InputCount++] = PcdGet32 (PcdIoApicAddress);
+  Inputs[InputCount++] = PcdGet8 (PcdIoApicId);
+  Inputs[InputCount++] = PcdGet32 (PcdPcIoApicEnable);
+  Inputs[InputCount++] = PcdGet8 (PcdPcIoApicCount);
+  Inputs[InputCount++] = PcdGet8 (PcdPcIoApicIdBase);
+  Inputs[InputCount++] = PcdGet32 (PcdPcIoApicAddressBase);
+
+  Status = gBS->CalculateCrc32 (Inputs, sizeof (UINT64) * InputCount, &Crc);
+  FreePool (Inputs);
+  if (EFI_ERROR (Status)) {
+    return 0;
+  }
+
+  return Crc;
+}
+
+/**
+  Install the MADT and MCFG saved by a previous boot, if they were built from
+  the same inputs as this boot's.
+
+  @retval EFI_SUCCESS           The cached MADT and MCFG were installed.
+  @retval EFI_NOT_FOUND         There is no cache, or it does not match this boot.
+  @retval Others                The cached tables could not be installed.
+**/
+EFI_STATUS
+InstallTablesFromCache (
+  VOID
+  )
+{
+  EFI_STATUS                    Status;
+  ACPI_TABLE_CACHE_HEADER       *Cache;
+  UINTN                         CacheSize;
+  EFI_ACPI_DESCRIPTION_HEADER   *Madt;
+  EFI_ACPI_DESCRIPTION_HEADER   *Mcfg;
+  UINTN                         MadtHandle;
+  UINTN                         McfgHandle;
+
+  if (mTableCacheInputCrc == 0) {
+    return EFI_NOT_FOUND;
+  }
+
+  Status = GetVariable2 (ACPI_TABLE_CACHE_VARIABLE_NAME, &gEfiCallerIdGuid, (VOID **)&Cache, &CacheSize);
+  if (EFI_ERROR (Status)) {
+    return EFI_NOT_FOUND;
+  }
+
+  Madt = (EFI_ACPI_DESCRIPTION_HEADER *)(Cache + 1);
+  Mcfg = (EFI_ACPI_DESCRIPTION_HEADER *)((UINT8 *)Madt + Cache->MadtLength);
+  if ((CacheSize < sizeof (*Cache)) ||
+      (Cache->Signature != ACPI_TABLE_CACHE_SIGNATURE) ||
+      (Cache->InputCrc != mTableCacheInputCrc) ||
+      (Cache->MadtLength < sizeof (*Madt)) ||
+      (Cache->McfgLength < sizeof (*Mcfg)) ||
+      ((UINT64)CacheSize != (UINT64)sizeof (*Cache) + Cache->MadtLength + Cache->McfgLength) ||
+      (Madt->Signature != EFI_ACPI_4_0_MULTIPLE_APIC_DESCRIPTION_TABLE_SIGNATURE) ||
+      (Madt->Length != Cache->MadtLength) ||
+      (Mcfg->Signature != EFI_ACPI_3_0_PCI_EXPRESS_MEMORY_MAPPED_CONFIGURATION_SPACE_BASE_ADDRESS_DESCRIPTION_TABLE_SIGNATURE) ||
+      (Mcfg->Length != Cache->McfgLength)) {
+    DEBUG ((DEBUG_INFO, "ACPI table cache does not match, rebuilding MADT and MCFG\n"));
+    FreePool (Cache);
+    return EFI_NOT_FOUND;
+  }
+
+  MadtHandle = 0;
+  Status = mAcpiTable->InstallAcpiTable (mAcpiTable, Madt, Madt->Length, &MadtHandle);
+  if (!EFI_ERROR (Status)) {
+    McfgHandle = 0;
+    Status = mAcpiTable->InstallAcpiTable (mAcpiTable, Mcfg, Mcfg->Length, &McfgHandle);
+    if (EFI_ERROR (Status)) {
+      mAcpiTable->UninstallAcpiTable (mAcpiTable, MadtHandle);
+    }
+  }
+
+  if (!EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_INFO, "MADT and MCFG installed from the ACPI table cache\n"));
+    mTableCacheHardwareSignature = Cache->HardwareSignature;
+    mTableCacheInstalled = TRUE;
+  }
+
+  FreePool (Cache);
+  return Status;
+}
+
+/**
+  Take a copy of the MADT and MCFG that were just built, to be saved at End of
+  DXE once the hardware signature of this boot is known.
+**/
+VOID
+CreateTableCache (
+  VOID
+  )
+{
+  EFI_STATUS                    Status;
+  EFI_ACPI_DESCRIPTION_HEADER   *Madt;
+  EFI_ACPI_DESCRIPTION_HEADER   *Mcfg;
+  UINTN                         Handle;
+
+  if (mTableCacheInputCrc == 0) {
+    return;
+  }
+
+  Madt = NULL;
+  Mcfg = NULL;
+  Handle = 0;
+  Status = LocateAcpiTableBySignature (
+             EFI_ACPI_4_0_MULTIPLE_APIC_DESCRIPTION_TABLE_SIGNATURE,
+             &Madt,
+             &Handle
+             );
+  if (!EFI_ERROR (Status)) {
+    Handle = 0;
+    Status = LocateAcpiTableBySignature (
+               EFI_ACPI_3_0_PCI_EXPRESS_MEMORY_MAPPED_CONFIGURATION_SPACE_BASE_ADDRESS_DESCRIPTION_TABLE_SIGNATURE,
+               &Mcfg,
+               &Handle
+               );
+  }
+
+  if (!EFI_ERROR (Status) && (Madt != NULL) && (Mcfg != NULL)) {
+    mTableCache = AllocatePool (sizeof (*mTableCache) + Madt->Length + Mcfg->Length);
+    if (mTableCache != NULL) {
+      mTableCache->Signature         = ACPI_TABLE_CACHE_SIGNATURE;
+      mTableCache->InputCrc          = mTableCacheInputCrc;
+      mTableCache->HardwareSignature = 0;
+      mTableCache->MadtLength        = Madt->Length;
+      mTableCache->McfgLength        = Mcfg->Length;
+      CopyMem (mTableCache + 1, Madt, Madt->Length);
+      CopyMem ((UINT8 *)(mTableCache + 1) + Madt->Length, Mcfg, Mcfg->Length);
+    }
+  }
+
+  if (Madt != NULL) {
+    FreePool (Madt);
+  }
+  if (Mcfg != NULL) {
+    FreePool (Mcfg);
+  }
+}
+
+/**
+  Save the tables built on this boot, or drop the cache if the tables were
+  installed from it but the hardware signature of the platform changed.
+**/
+VOID
+UpdateTableCache (
+  VOID
+  )
+{
+  EFI_STATUS                    Status;
+
+  if (mTableCache != NULL) {
+    mTableCache->HardwareSignature = mHardwareSignature;
+    Status = gRT->SetVariable (
+                    ACPI_TABLE_CACHE_VARIABLE_NAME,
+                    &gEfiCallerIdGuid,
+                    EFI_VARIABLE_NON_VOLATILE | EFI_VARIABLE_BOOTSERVICE_ACCESS,
+                    sizeof (*mTableCache) + mTableCache->MadtLength + mTableCache->McfgLength,
+                    mTableCache
+                    );
+    DEBUG ((DEBUG_INFO, "Save ACPI table cache - %r\n", Status));
+    FreePool (mTableCache);
+    mTableCache = NULL;
+  } else if (mTableCacheInstalled && (mHardwareSignature != 0) &&
+             (mHardwareSignature != mTableCacheHardwareSignature)) {
+    DEBUG ((DEBUG_INFO, "Hardware signature changed, drop ACPI table cache\n"));
+    gRT->SetVariable (
+           ACPI_TABLE_CACHE_VARIABLE_NAME,
+           &gEfiCallerIdGuid,
+           0,
+           0,
+           NULL
+           );
+  }
+}
 
 VOID
 EFIAPI
@@ -1503,6 +1811,10 @@ AcpiEndOfDxeEvent (
   // Calculate Hardware Signature value based on current platform configurations
   //
   IsHardwareChange();
+
+  if (FeaturePcdGet (PcdAcpiTableCacheEnable)) {
+    UpdateTableCache ();
+  }
 }
 
 /**
@@ -1568,8 +1880,19 @@ InstallAcpiPlatform (
 
   UpdateLocalTable ();
 
+  if (FeaturePcdGet (PcdAcpiTableCacheEnable)) {
+    mTableCacheInputCrc = GetTableCacheInputCrc ();
+    if (!EFI_ERROR (InstallTablesFromCache ())) {
+      return EFI_SUCCESS;
+    }
+  }
+
   InstallMadtFromScratch ();
   InstallMcfgFromScratch ();
 
+  if (FeaturePcdGet (PcdAcpiTableCacheEnable)) {
+    CreateTableCache ();
+  }
+
   return EFI_SUCCESS;
 }
@@ -14,6 +14,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Uefi/UefiBaseType.h>
 #include <Uefi/UefiSpec.h>
 #include <Library/UefiBootServicesTableLib.h>
+#include <Library/BaseLib.h>
 #include <Library/DebugLib.h>
 #include <Library/UefiLib.h>
 #include <Library/BaseMemoryLib.h>
@@ -27,6 +28,27 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 static EFI_ACPI_SDT_PROTOCOL      *mAcpiSdt = NULL;
 static EFI_ACPI_TABLE_PROTOCOL    *mAcpiTable = NULL;
 
+//
+// Index of the NameOp encodings in the installed DSDT, so that a board
+// patching many names does not scan the whole AML stream for each of them.
+// Offsets do not move when a Name value is patched, so the index stays valid
+// until the DSDT is replaced by another party (different handle or length).
+//
+#define AML_NAME_INDEX_HASH_SIZE  0x100
+
+typedef struct {
+  UINT32                      Signature;
+  UINT32                      Offset;   ///< Offset of the NameSeg in the table
+  UINT32                      Next;     ///< Index + 1 of the next entry in the bucket, 0 for none
+} AML_NAME_INDEX_ENTRY;
+
+static BOOLEAN                mDsdtNameIndexValid = FALSE;
+static UINTN                  mDsdtNameIndexHandle;
+static UINT32                 mDsdtNameIndexLength;
+static UINT32                 mDsdtNameIndexCount;
+static AML_NAME_INDEX_ENTRY   *mDsdtNameIndex = NULL;
+static UINT32                 mDsdtNameIndexBucket[AML_NAME_INDEX_HASH_SIZE];
+
 /**
   Initialize the ASL update library state.
   This must be called at the beginning of the function calls in this library.
@@ -107,6 +129,103 @@ LocateAcpiTableByOemTableId (
   return Status;
 }
 
+/**
+  Hash a NameSeg signature into a bucket of the AML name index.
+
+  @param[in] Signature         - NameSeg signature
+
+  @retval Bucket index.
+**/
+UINT32
+HashAmlNameSignature (
+  IN     UINT32                        Signature
+  )
+{
+  return (Signature ^ (Signature >> 8) ^ (Signature >> 16) ^ (Signature >> 24)) & (AML_NAME_INDEX_HASH_SIZE - 1);
+}
+
+/**
+  Build the index of all the NameOp encodings of the DSDT.
+
+  Each bucket is kept in ascending offset order, so the first entry with a
+  matching signature is the one a linear scan of the table would find.
+
+  @param[in] Table             - The DSDT
+  @param[in] Handle            - AcpiTable protocol handle of the DSDT
+
+  @retval EFI_SUCCESS          - The index was built.
+  @retval EFI_OUT_OF_RESOURCES - No enough memory for the index.
+**/
+EFI_STATUS
+BuildDsdtNameIndex (
+  IN     EFI_ACPI_DESCRIPTION_HEADER   *Table,
+  IN     UINTN                         Handle
+  )
+{
+  UINT8                       *AmlPointer;
+  UINT32                      Offset;
+  UINT32                      Count;
+  UINT32                      Bucket;
+  AML_NAME_INDEX_ENTRY        *Entry;
+
+  mDsdtNameIndexValid = FALSE;
+  if (mDsdtNameIndex != NULL) {
+    FreePool (mDsdtNameIndex);
+    mDsdtNameIndex = NULL;
+  }
+  ZeroMem (mDsdtNameIndexBucket, sizeof (mDsdtNameIndexBucket));
+  mDsdtNameIndexCount = 0;
+
+  AmlPointer = (UINT8 *) Table;
+  if (Table->Length <= sizeof (EFI_ACPI_DESCRIPTION_HEADER) + sizeof (UINT32) + 1) {
+    mDsdtNameIndexHandle = Handle;
+    mDsdtNameIndexLength = Table->Length;
+    mDsdtNameIndexValid  = TRUE;
+    return EFI_SUCCESS;
+  }
+
+  ///
+  /// Count the NameOp candidates, a NameSeg and a data byte must follow the opcode.
+  ///
+  Count = 0;
+  for (Offset = sizeof (EFI_ACPI_DESCRIPTION_HEADER); Offset + sizeof (UINT32) + 1 < Table->Length; Offset++) {
+    if (AmlPointer[Offset] == AML_NAME_OP) {
+      Count++;
+    }
+  }
+
+  if (Count != 0) {
+    mDsdtNameIndex = AllocatePool (Count * sizeof (AML_NAME_INDEX_ENTRY));
+    if (mDsdtNameIndex == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+  }
+
+  ///
+  /// Walk backward and push to the bucket head, so each bucket is in ascending offset order.
+  ///
+  Offset = Table->Length - sizeof (UINT32) - 1;
+  while (Offset > sizeof (EFI_ACPI_DESCRIPTION_HEADER)) {
+    Offset--;
+    if (AmlPointer[Offset] != AML_NAME_OP) {
+      continue;
+    }
+    Entry            = &mDsdtNameIndex[mDsdtNameIndexCount];
+    Entry->Signature = ReadUnaligned32 ((UINT32 *) (AmlPointer + Offset + 1));
+    Entry->Offset    = Offset + 1;
+    Bucket           = HashAmlNameSignature (Entry->Signature);
+    Entry->Next      = mDsdtNameIndexBucket[Bucket];
+    mDsdtNameIndexCount++;
+    mDsdtNameIndexBucket[Bucket] = mDsdtNameIndexCount;
+  }
+
+  mDsdtNameIndexHandle = Handle;
+  mDsdtNameIndexLength = Table->Length;
+  mDsdtNameIndexValid  = TRUE;
+  DEBUG ((DEBUG_INFO, "DxeAslUpdateLib: indexed %d NameOp in DSDT\n", mDsdtNameIndexCount));
+  return EFI_SUCCESS;
+}
+
 /**
   This procedure will update immediate value assigned to a Name.
 
@@ -128,11 +247,11 @@ UpdateNameAslCode (
 {
   EFI_STATUS                  Status;
   EFI_ACPI_DESCRIPTION_HEADER *Table;
-  UINT8                       *CurrPtr;
-  UINT32                      *Signature;
   UINT8                       *DsdtPointer;
   UINTN                       Handle;
   UINT8                       DataSize;
+  UINT32                      EntryIndex;
+  AML_NAME_INDEX_ENTRY        *Entry;
 
   if (mAcpiTable == NULL) {
     InitializeAslUpdateLib ();
@@ -155,56 +274,64 @@ UpdateNameAslCode (
   }
 
   ///
-  /// Point to the beginning of the DSDT table
+  /// Index the NameOp of the DSDT once, rebuild only if the DSDT was replaced.
   ///
-  CurrPtr = (UINT8 *) Table;
+  if (!mDsdtNameIndexValid || (mDsdtNameIndexHandle != Handle) || (mDsdtNameIndexLength != Table->Length)) {
+    Status = BuildDsdtNameIndex (Table, Handle);
+    if (EFI_ERROR (Status)) {
+      FreePool (Table);
+      return Status;
+    }
+  }
 
   ///
-  /// Loop through the ASL looking for values that we must fix up.
+  /// Look up the Name we must fix up.
   ///
-  for (DsdtPointer = CurrPtr; DsdtPointer <= (CurrPtr + ((EFI_ACPI_COMMON_HEADER *) CurrPtr)->Length); DsdtPointer++) {
+  for (EntryIndex = mDsdtNameIndexBucket[HashAmlNameSignature (AslSignature)]; EntryIndex != 0; EntryIndex = Entry->Next) {
+    Entry = &mDsdtNameIndex[EntryIndex - 1];
+    if (Entry->Signature != AslSignature) {
+      continue;
+    }
+    DsdtPointer = (UINT8 *) Table + Entry->Offset;
     ///
-    /// Get a pointer to compare for signature
+    /// Check if size of new and old data is the same
     ///
-    Signature = (UINT32 *) DsdtPointer;
+    DataSize = *(DsdtPointer+4);
+    if (((Length == 1 && DataSize == 0xA) ||
+         (Length == 2 && DataSize == 0xB) ||
+         (Length == 4 && DataSize == 0xC)) &&
+        (Entry->Offset + 5 + Length <= Table->Length)) {
+      CopyMem (DsdtPointer+5, Buffer, Length);
+    } else if (Length == 1 && ((*(UINT8*) Buffer) == 0 || (*(UINT8*) Buffer) == 1) && (DataSize == 0 || DataSize == 1)) {
+      CopyMem (DsdtPointer+4, Buffer, Length);
+    } else {
+      FreePool (Table);
+      return EFI_BAD_BUFFER_SIZE;
+    }
+    Status = mAcpiTable->UninstallAcpiTable (
+                           mAcpiTable,
+                           Handle
+                           );
+    Handle = 0;
+    Status = mAcpiTable->InstallAcpiTable (
+                           mAcpiTable,
+                           Table,
+                           Table->Length,
+                           &Handle
+                           );
     ///
-    /// Check if this is the Device Object signature we are looking for
+    /// The offsets are unchanged in the new copy, follow its handle.
     ///
-    if ((*Signature) == AslSignature) {
-      ///
-      /// Look for Name Encoding
-      ///
-      if (*(DsdtPointer-1) == AML_NAME_OP) {
-        ///
-        /// Check if size of new and old data is the same
-        ///
-        DataSize = *(DsdtPointer+4);
-        if ((Length == 1 && DataSize == 0xA) ||
-            (Length == 2 && DataSize == 0xB) ||
-            (Length == 4 && DataSize == 0xC)) {
-          CopyMem (DsdtPointer+5, Buffer, Length);
-        } else if (Length == 1 && ((*(UINT8*) Buffer) == 0 || (*(UINT8*) Buffer) == 1) && (DataSize == 0 || DataSize == 1)) {
-          CopyMem (DsdtPointer+4, Buffer, Length);
-        } else {
-          FreePool (Table);
-          return EFI_BAD_BUFFER_SIZE;
-        }
-        Status = mAcpiTable->UninstallAcpiTable (
-                               mAcpiTable,
-                               Handle
-                               );
-        Handle = 0;
-        Status = mAcpiTable->InstallAcpiTable (
-                               mAcpiTable,
-                               Table,
-                               Table->Length,
-                               &Handle
-                               );
-        FreePool (Table);
-        return Status;
-      }
+    if (EFI_ERROR (Status)) {
+      mDsdtNameIndexValid = FALSE;
+    } else {
+      mDsdtNameIndexHandle = Handle;
     }
+    FreePool (Table);
+    return Status;
   }
+
+  FreePool (Table);
   return EFI_NOT_FOUND;
 }
 
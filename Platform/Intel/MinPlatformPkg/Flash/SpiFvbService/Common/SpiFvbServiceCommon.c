@@ -183,6 +183,72 @@ FvbGetLbaAddress (
   }
 }
 
+/**
+  Check whether a flash range is decoded in the BIOS region memory map, so
+  it can be read directly instead of through hardware sequencing.
+
+  @param[in]  Address       The starting physical address of the range
+  @param[in]  Length        The length of the range in bytes
+
+  @retval     TRUE          The whole range is memory mapped
+  @retval     FALSE         Part of the range is outside the memory map
+
+**/
+STATIC
+BOOLEAN
+FvbIsMemoryMapped (
+  IN UINTN                                Address,
+  IN UINTN                                Length
+  )
+{
+  UINTN                                   FlashBase;
+  UINTN                                   FlashSize;
+
+  FlashBase = (UINTN) PcdGet32 (PcdFlashAreaBaseAddress);
+  FlashSize = (UINTN) PcdGet32 (PcdFlashAreaSize);
+
+  return (BOOLEAN) ((Address >= FlashBase) &&
+                    (Length <= FlashSize) &&
+                    ((Address - FlashBase) <= (FlashSize - Length)));
+}
+
+/**
+  Check whether a memory mapped flash range is already fully erased.
+
+  @param[in]  Address       The starting physical address of the range
+  @param[in]  Length        The length of the range in bytes
+
+  @retval     TRUE          Every byte of the range reads as 0xFF
+  @retval     FALSE         The range holds data
+
+**/
+STATIC
+BOOLEAN
+FvbIsErased (
+  IN UINTN                                Address,
+  IN UINTN                                Length
+  )
+{
+  UINTN                                   Index;
+
+  //
+  // Make sure the check does not run against stale cache lines
+  //
+  WriteBackInvalidateDataCacheRange ((VOID *) Address, Length);
+
+  for (Index = 0; (Index + sizeof (UINT64)) <= Length; Index += sizeof (UINT64)) {
+    if (*(volatile UINT64 *) (Address + Index) != MAX_UINT64) {
+      return FALSE;
+    }
+  }
+  for (; Index < Length; Index++) {
+    if (*(volatile UINT8 *) (Address + Index) != 0xFF) {
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
+
 /**
   Reads specified number of bytes into a buffer from the specified block.
 
@@ -254,7 +320,15 @@ FvbReadBlock (
     BadBufferSize = TRUE;
   }
 
-  Status = SpiFlashRead (LbaAddress + BlockOffset, (UINT32 *)NumBytes, Buffer);
+  if (FvbIsMemoryMapped (LbaAddress + BlockOffset, *NumBytes)) {
+    //
+    // The BIOS region is decoded, no need to go through hardware sequencing
+    //
+    CopyMem (Buffer, (VOID *) (LbaAddress + BlockOffset), *NumBytes);
+    Status = EFI_SUCCESS;
+  } else {
+    Status = SpiFlashRead (LbaAddress + BlockOffset, (UINT32 *)NumBytes, Buffer);
+  }
 
   if (!EFI_ERROR (Status) && BadBufferSize) {
     return EFI_BAD_BUFFER_SIZE;
@@ -298,6 +372,9 @@ FvbWriteBlock (
   UINTN                                   LbaLength;
   EFI_STATUS                              Status;
   BOOLEAN                                 BadBufferSize = FALSE;
+  UINTN                                   WriteAddress;
+  UINTN                                   WriteLength;
+  UINT8                                   *WriteBuffer;
 
   if ((NumBytes == NULL) || (Buffer == NULL)) {
     return EFI_INVALID_PARAMETER;
@@ -336,17 +413,40 @@ FvbWriteBlock (
     BadBufferSize = TRUE;
   }
 
-  Status = SpiFlashWrite (LbaAddress + BlockOffset, (UINT32 *)NumBytes, Buffer);
-  if (EFI_ERROR (Status)) {
-    return Status;
-  }
+  WriteAddress = LbaAddress + BlockOffset;
+  WriteLength  = *NumBytes;
+  WriteBuffer  = Buffer;
 
-  Status = SpiFlashLock ();
-  if (EFI_ERROR (Status)) {
-    return Status;
+  //
+  // The variable driver rewrites whole headers to flip a few state bits.
+  // Only send the bytes that actually change to the flash.
+  //
+  if (FvbIsMemoryMapped (WriteAddress, WriteLength)) {
+    WriteBackInvalidateDataCacheRange ((VOID *) WriteAddress, WriteLength);
+    while ((WriteLength > 0) && (*(volatile UINT8 *) WriteAddress == *WriteBuffer)) {
+      WriteAddress++;
+      WriteBuffer++;
+      WriteLength--;
+    }
+    while ((WriteLength > 0) &&
+           (*(volatile UINT8 *) (WriteAddress + WriteLength - 1) == WriteBuffer[WriteLength - 1])) {
+      WriteLength--;
+    }
   }
 
-  WriteBackInvalidateDataCacheRange ((VOID *) (LbaAddress + BlockOffset), *NumBytes);
+  if (WriteLength > 0) {
+    Status = SpiFlashWrite (WriteAddress, (UINT32 *) &WriteLength, WriteBuffer);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+
+    Status = SpiFlashLock ();
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+
+    WriteBackInvalidateDataCacheRange ((VOID *) WriteAddress, WriteLength);
+  }
 
   if (!EFI_ERROR (Status) && BadBufferSize) {
     return EFI_BAD_BUFFER_SIZE;
@@ -400,6 +500,13 @@ FvbEraseBlock (
     return Status;
   }
 
+  //
+  // Reclaim and FTW erase blocks that are frequently still blank
+  //
+  if (FvbIsMemoryMapped (LbaAddress, LbaLength) && FvbIsErased (LbaAddress, LbaLength)) {
+    return EFI_SUCCESS;
+  }
+
   Status = SpiFlashBlockErase (LbaAddress, &LbaLength);
   if (EFI_ERROR (Status)) {
     return Status;
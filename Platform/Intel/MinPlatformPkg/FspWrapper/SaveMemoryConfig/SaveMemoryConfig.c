@@ -16,7 +16,9 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Guid/GlobalVariable.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/BaseMemoryLib.h>
+#include <Library/BaseLib.h>
 #include <Protocol/VariableLock.h>
+#include <MemoryConfigInfo.h>
 
 /**
   This is the standard EFI driver point that detects whether there is a
@@ -41,6 +43,10 @@ SaveMemoryConfigEntryPoint (
   UINTN             DataSize;
   UINTN             BufferSize;
   EDKII_VARIABLE_LOCK_PROTOCOL        *VariableLock;
+  EFI_HOB_GUID_TYPE                   *InfoHob;
+  MEMORY_CONFIG_INFO                  NewInfo;
+  MEMORY_CONFIG_INFO                  SavedInfo;
+  UINTN                               InfoSize;
 
   DataSize     = 0;
   VariableData = NULL;
@@ -57,28 +63,37 @@ SaveMemoryConfigEntryPoint (
     DataSize = GET_GUID_HOB_DATA_SIZE(GuidHob);
     if (DataSize > 0) {
       //
-      // Use the HOB to save Memory Configuration Data
+      // Compare the size and CRC32 of the HOB data with MemoryConfigInfo first,
+      // so the whole MemoryConfig variable is only read back when it changed.
       //
-      BufferSize = DataSize;
-      VariableData = AllocatePool (BufferSize);
-      if (VariableData == NULL) {
-        return EFI_UNSUPPORTED;
+      NewInfo.Revision         = MEMORY_CONFIG_INFO_REVISION;
+      NewInfo.DataSize         = (UINT32) DataSize;
+      NewInfo.DataCrc32        = CalculateCrc32 (HobData, DataSize);
+      NewInfo.FingerprintCrc32 = 0;
+      InfoHob = GetFirstGuidHob (&gMemoryConfigInfoGuid);
+      if (InfoHob != NULL) {
+        NewInfo.FingerprintCrc32 = ((MEMORY_CONFIG_INFO *) GET_GUID_HOB_DATA (InfoHob))->FingerprintCrc32;
       }
+
+      InfoSize = sizeof (SavedInfo);
       Status = gRT->GetVariable (
-                      L"MemoryConfig",
-                      &gFspNonVolatileStorageHobGuid,
+                      MEMORY_CONFIG_INFO_VARIABLE_NAME,
+                      &gMemoryConfigInfoGuid,
                       NULL,
-                      &BufferSize,
-                      VariableData
+                      &InfoSize,
+                      &SavedInfo
                       );
-
-      if (Status == EFI_BUFFER_TOO_SMALL) {
-        FreePool (VariableData);
+      if (!EFI_ERROR (Status) && InfoSize == sizeof (SavedInfo) && 0 == CompareMem (&SavedInfo, &NewInfo, sizeof (NewInfo))) {
+        DEBUG((DEBUG_INFO, "MemoryConfig is not changed\n"));
+      } else {
+        //
+        // Use the HOB to save Memory Configuration Data
+        //
+        BufferSize = DataSize;
         VariableData = AllocatePool (BufferSize);
         if (VariableData == NULL) {
           return EFI_UNSUPPORTED;
         }
-
         Status = gRT->GetVariable (
                         L"MemoryConfig",
                         &gFspNonVolatileStorageHobGuid,
@@ -86,19 +101,46 @@ SaveMemoryConfigEntryPoint (
                         &BufferSize,
                         VariableData
                         );
-      }
 
-      if ( (EFI_ERROR(Status)) || BufferSize != DataSize || 0 != CompareMem (HobData, VariableData, DataSize)) {
+        if (Status == EFI_BUFFER_TOO_SMALL) {
+          FreePool (VariableData);
+          VariableData = AllocatePool (BufferSize);
+          if (VariableData == NULL) {
+            return EFI_UNSUPPORTED;
+          }
+
+          Status = gRT->GetVariable (
+                          L"MemoryConfig",
+                          &gFspNonVolatileStorageHobGuid,
+                          NULL,
+                          &BufferSize,
+                          VariableData
+                          );
+        }
+
+        if ( (EFI_ERROR(Status)) || BufferSize != DataSize || 0 != CompareMem (HobData, VariableData, DataSize)) {
+          Status = gRT->SetVariable (
+                          L"MemoryConfig",
+                          &gFspNonVolatileStorageHobGuid,
+                          (EFI_VARIABLE_NON_VOLATILE | EFI_VARIABLE_BOOTSERVICE_ACCESS),
+                          DataSize,
+                          HobData
+                          );
+          ASSERT_EFI_ERROR (Status);
+
+          DEBUG((DEBUG_INFO, "Restored Size is 0x%x\n", DataSize));
+        }
+
+        FreePool (VariableData);
+
         Status = gRT->SetVariable (
-                        L"MemoryConfig",
-                        &gFspNonVolatileStorageHobGuid,
+                        MEMORY_CONFIG_INFO_VARIABLE_NAME,
+                        &gMemoryConfigInfoGuid,
                         (EFI_VARIABLE_NON_VOLATILE | EFI_VARIABLE_BOOTSERVICE_ACCESS),
-                        DataSize,
-                        HobData
+                        sizeof (NewInfo),
+                        &NewInfo
                         );
         ASSERT_EFI_ERROR (Status);
-
-        DEBUG((DEBUG_INFO, "Restored Size is 0x%x\n", DataSize));
       }
 
       //
@@ -108,9 +150,9 @@ SaveMemoryConfigEntryPoint (
       if (!EFI_ERROR(Status)) {
         Status = VariableLock->RequestToLock(VariableLock, L"MemoryConfig", &gFspNonVolatileStorageHobGuid);
         ASSERT_EFI_ERROR(Status);
+        Status = VariableLock->RequestToLock(VariableLock, MEMORY_CONFIG_INFO_VARIABLE_NAME, &gMemoryConfigInfoGuid);
+        ASSERT_EFI_ERROR(Status);
       }
-
-      FreePool (VariableData);
     } else {
       DEBUG((DEBUG_INFO, "Memory save size is %d\n", DataSize));
     }
@@ -9,6 +9,16 @@
 #ifndef _EFI_COMPRESS_LIB_H_
 #define _EFI_COMPRESS_LIB_H_
 
+//
+// Compression levels for CompressEx (). The levels below COMPRESS_LEVEL_BEST
+// use a hash chain match finder that searches more candidates as the level
+// goes up. COMPRESS_LEVEL_BEST uses the binary tree search, the output is the
+// same as the one of the EFI/Tiano compressor.
+//
+#define COMPRESS_LEVEL_FASTEST  1
+#define COMPRESS_LEVEL_DEFAULT  6
+#define COMPRESS_LEVEL_BEST     9
+
 /**
   The compression routine.
 
@@ -30,5 +40,31 @@ Compress (
   IN OUT  UINT64  *DstSize
   );
 
+/**
+  The compression routine with a selectable compression level. All levels
+  produce the EFI/Tiano compressed format.
+
+  @param[in]       SrcBuffer     The buffer containing the source data.
+  @param[in]       SrcSize       Number of bytes in SrcBuffer.
+  @param[in]       DstBuffer     The buffer to put the compressed image in.
+  @param[in, out]  DstSize       On input the size (in bytes) of DstBuffer, on
+                                 return the number of bytes placed in DstBuffer.
+  @param[in]       Level         The compression level, from COMPRESS_LEVEL_FASTEST
+                                 to COMPRESS_LEVEL_BEST.
+
+  @retval EFI_SUCCESS           The compression was sucessful.
+  @retval EFI_BUFFER_TOO_SMALL  The buffer was too small.  DstSize is required.
+  @retval EFI_INVALID_PARAMETER Level is not a valid compression level.
+**/
+EFI_STATUS
+EFIAPI
+CompressEx (
+  IN      VOID    *SrcBuffer,
+  IN      UINT64  SrcSize,
+  IN      VOID    *DstBuffer,
+  IN OUT  UINT64  *DstSize,
+  IN      UINTN   Level
+  );
+
 #endif
 
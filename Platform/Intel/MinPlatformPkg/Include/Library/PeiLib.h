@@ -38,6 +38,42 @@ PeiGetVariable (
   OUT UINTN          *Size
   );
 
+/**
+  Gets the saved memory configuration data for a fast boot. The data is
+  returned only when it matches the size and CRC32 saved in the
+  MemoryConfigInfo variable, and it was saved with the same platform memory
+  fingerprint. Otherwise the caller should let the memory be trained again.
+
+  The CRC32 of Fingerprint is also passed to SaveMemoryConfig in a HOB, so
+  that it is saved with new memory configuration data.
+
+  The returned buffer is allocated using AllocatePool().
+
+  @param[in]  Name             The name of the memory configuration variable.
+  @param[in]  Guid             The GUID of the memory configuration variable.
+  @param[in]  Fingerprint      Platform memory fingerprint, for example the DIMM
+                               SPD serial numbers. It is optional.
+  @param[in]  FingerprintSize  The size of Fingerprint.
+  @param[out] Value            The buffer point saved the memory configuration data.
+  @param[out] Size             The buffer size of the memory configuration data.
+
+  @retval EFI_SUCCESS          The saved memory configuration data is valid.
+  @retval EFI_NOT_FOUND        The data is not found, or it was saved with a
+                               different fingerprint.
+  @retval EFI_CRC_ERROR        The data does not match its saved size and CRC32.
+  @return Others Errors        Return errors from call to PeiGetVariable.
+**/
+EFI_STATUS
+EFIAPI
+PeiGetMemoryConfig (
+  IN CONST CHAR16    *Name,
+  IN CONST EFI_GUID  *Guid,
+  IN CONST VOID      *Fingerprint  OPTIONAL,
+  IN UINTN           FingerprintSize,
+  OUT VOID           **Value,
+  OUT UINTN          *Size
+  );
+
 /**
   Finds the file in any FV and gets file Address and Size
   
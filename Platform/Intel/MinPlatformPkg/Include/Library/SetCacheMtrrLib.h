@@ -19,6 +19,21 @@ SetCacheMtrr (
   VOID
   );
 
+/**
+  Program the MTRR settings saved in the MTRR settings HOB by SetCacheMtrr ().
+
+  It may be called on the BSP and on the APs, so that all the processors use
+  the same MTRR settings without computing them again.
+
+  @retval  EFI_SUCCESS    The MTRR settings are programmed.
+  @retval  EFI_NOT_FOUND  SetCacheMtrr () has not saved the MTRR settings yet.
+**/
+EFI_STATUS
+EFIAPI
+SetCacheMtrrFromHob (
+  VOID
+  );
+
 /**
   Update MTRR setting in EndOfPei phase.
   This function will clear temporary memory (CAR) phase MTRR settings
@@ -179,6 +179,24 @@ TestPointEndOfPeiPciBusMasterDisabled (
   VOID
   );
 
+/**
+  This service verifies the end of PEI is reached within the platform boot time budget.
+
+  Test subject: Boot performance.
+  Test overview: Compare the time elapsed since reset with PcdTestPointEndOfPeiTimeBudget.
+  Reporting mechanism: Set ADAPTER_INFO_PLATFORM_TEST_POINT_STRUCT.
+                       Records an FPDT performance event.
+                       Dumps the boot time to the debug log.
+
+  @retval EFI_SUCCESS         The test point check was performed successfully.
+  @retval EFI_UNSUPPORTED     The test point check is not supported on this platform.
+**/
+EFI_STATUS
+EFIAPI
+TestPointEndOfPeiBootTimeBudget (
+  VOID
+  );
+
 /**
   This service verifies bus master enable (BME) is disabled after PCI enumeration.
 
@@ -264,6 +282,24 @@ TestPointEndOfDxeDmaProtectionEnabled (
   VOID
   );
 
+/**
+  This service verifies the end of DXE is reached within the platform boot time budget.
+
+  Test subject: Boot performance.
+  Test overview: Compare the time elapsed since reset with PcdTestPointEndOfDxeTimeBudget.
+  Reporting mechanism: Set ADAPTER_INFO_PLATFORM_TEST_POINT_STRUCT.
+                       Records an FPDT performance event.
+                       Dumps the boot time to the debug log.
+
+  @retval EFI_SUCCESS         The test point check was performed successfully.
+  @retval EFI_UNSUPPORTED     The test point check is not supported on this platform.
+**/
+EFI_STATUS
+EFIAPI
+TestPointEndOfDxeBootTimeBudget (
+  VOID
+  );
+
 /**
   This service verifies the validity of System Management RAM (SMRAM) alignment at SMM Ready To Lock.
 
@@ -454,6 +490,24 @@ TestPointReadyToBootEsrtTableFunctional (
   VOID
   );
 
+/**
+  This service verifies ready to boot is reached within the platform boot time budget.
+
+  Test subject: Boot performance.
+  Test overview: Compare the time elapsed since reset with PcdTestPointReadyToBootTimeBudget.
+  Reporting mechanism: Set ADAPTER_INFO_PLATFORM_TEST_POINT_STRUCT.
+                       Records an FPDT performance event.
+                       Dumps the boot time to the debug log.
+
+  @retval EFI_SUCCESS         The test point check was performed successfully.
+  @retval EFI_UNSUPPORTED     The test point check is not supported on this platform.
+**/
+EFI_STATUS
+EFIAPI
+TestPointReadyToBootBootTimeBudget (
+  VOID
+  );
+
 /**
   This service verifies UEFI Secure Boot is enabled.
 
@@ -769,6 +823,17 @@ TestPointSmmExitBootServices (
 #define   TEST_POINT_BYTE8_READY_TO_BOOT_HSTI_TABLE_FUNCTIONAL_ERROR_CODE                        L"0x08010000"
 #define   TEST_POINT_BYTE8_READY_TO_BOOT_HSTI_TABLE_FUNCTIONAL_ERROR_STRING                      L"No HSTI\r\n"
 
+// Byte 9 - Boot Performance
+#define TEST_POINT_BYTE9_END_OF_PEI_BOOT_TIME_BUDGET                                        BIT0
+#define TEST_POINT_BYTE9_END_OF_DXE_BOOT_TIME_BUDGET                                        BIT1
+#define TEST_POINT_BYTE9_READY_TO_BOOT_BOOT_TIME_BUDGET                                     BIT2
+#define   TEST_POINT_BYTE9_END_OF_PEI_BOOT_TIME_BUDGET_ERROR_CODE                                L"0x09000000"
+#define   TEST_POINT_BYTE9_END_OF_PEI_BOOT_TIME_BUDGET_ERROR_STRING                              L"Boot time budget exceeded\r\n"
+#define   TEST_POINT_BYTE9_END_OF_DXE_BOOT_TIME_BUDGET_ERROR_CODE                                L"0x09010000"
+#define   TEST_POINT_BYTE9_END_OF_DXE_BOOT_TIME_BUDGET_ERROR_STRING                              L"Boot time budget exceeded\r\n"
+#define   TEST_POINT_BYTE9_READY_TO_BOOT_BOOT_TIME_BUDGET_ERROR_CODE                             L"0x09020000"
+#define   TEST_POINT_BYTE9_READY_TO_BOOT_BOOT_TIME_BUDGET_ERROR_STRING                           L"Boot time budget exceeded\r\n"
+
 #pragma pack (1)
 
 typedef struct {
@@ -0,0 +1,46 @@
+/** @file
+  Definitions for the information record of the saved memory configuration.
+
+  SaveMemoryConfig keeps the size and CRC32 of the memory configuration data
+  (the FSP non-volatile storage) in the MemoryConfigInfo variable, next to the
+  data itself. It is used to detect a change of the data without reading back
+  the whole variable, and by PeiGetMemoryConfig () to check the saved data
+  before it is passed to FSP-M for a fast boot.
+
+Copyright (c) 2020, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef _MEMORY_CONFIG_INFO_H_
+#define _MEMORY_CONFIG_INFO_H_
+
+#define MEMORY_CONFIG_INFO_VARIABLE_NAME  L"MemoryConfigInfo"
+
+#define MEMORY_CONFIG_INFO_REVISION       1
+
+///
+/// The MemoryConfigInfo variable, and the GUID HOB that PeiGetMemoryConfig ()
+/// builds for SaveMemoryConfig with only FingerprintCrc32 used, both use
+/// gMemoryConfigInfoGuid.
+///
+typedef struct {
+  UINT32  Revision;
+  ///
+  /// Size of the memory configuration data.
+  ///
+  UINT32  DataSize;
+  ///
+  /// CRC32 of the memory configuration data.
+  ///
+  UINT32  DataCrc32;
+  ///
+  /// CRC32 of the platform memory fingerprint (for example the DIMM SPD serial
+  /// numbers) the data was trained with, 0 if the platform provides none.
+  ///
+  UINT32  FingerprintCrc32;
+} MEMORY_CONFIG_INFO;
+
+extern EFI_GUID gMemoryConfigInfoGuid;
+
+#endif
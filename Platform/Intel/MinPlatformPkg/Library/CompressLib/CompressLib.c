@@ -15,6 +15,7 @@
 #include <Library/MemoryAllocationLib.h>
 #include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
+#include <Library/CompressLib.h>
 #include <Uefi/UefiBaseType.h>
 
 #define SHELL_FREE_NON_NULL(Pointer)  \
@@ -61,6 +62,15 @@ typedef INT16             NODE;
 #else
   #define                 NPT NP
 #endif
+
+//
+// Hash chain match finder
+//
+#define HASH_CHAIN_BIT    15
+#define HASH_CHAIN_SIZE   (1U << HASH_CHAIN_BIT)
+#define HASH_CHAIN(Ptr)   ((((UINT32) (Ptr)[0] << 10) ^ ((UINT32) (Ptr)[1] << 5) ^ (Ptr)[2]) & (HASH_CHAIN_SIZE - 1))
+#define LAZY_MATCH_LEVEL  4
+
 //
 // Function Prototypes
 //
@@ -126,6 +136,17 @@ STATIC NODE   *mPrev;
 STATIC NODE   *mNext = NULL;
 INT32         mHuffmanDepth = 0;
 
+STATIC UINT32 *mHashHead = NULL;
+STATIC UINT32 *mHashPrev = NULL;
+
+//
+// Maximum hash chain length searched for each compression level, indexed by
+// level. COMPRESS_LEVEL_BEST uses the binary tree search instead.
+//
+STATIC CONST UINT16 mMaxChain[COMPRESS_LEVEL_BEST] = {
+  0, 4, 8, 16, 32, 64, 128, 512, 2048
+};
+
 /**
   Make a CRC table.
 
@@ -185,25 +206,17 @@ PutDword (
 }
 
 /**
-  Allocate memory spaces for data structures used in compression process.
-  
+  Allocate the block buffer used to collect the output of the match finder.
+
   @retval EFI_SUCCESS           Memory was allocated successfully.
   @retval EFI_OUT_OF_RESOURCES  A memory allocation failed.
 **/
 EFI_STATUS
 EFIAPI
-AllocateMemory (
+AllocateBlockBuffer (
   VOID
   )
 {
-  mText       = AllocateZeroPool (WNDSIZ * 2 + MAXMATCH);
-  mLevel      = AllocateZeroPool ((WNDSIZ + UINT8_MAX + 1) * sizeof (*mLevel));
-  mChildCount = AllocateZeroPool ((WNDSIZ + UINT8_MAX + 1) * sizeof (*mChildCount));
-  mPosition   = AllocateZeroPool ((WNDSIZ + UINT8_MAX + 1) * sizeof (*mPosition));
-  mParent     = AllocateZeroPool (WNDSIZ * 2 * sizeof (*mParent));
-  mPrev       = AllocateZeroPool (WNDSIZ * 2 * sizeof (*mPrev));
-  mNext       = AllocateZeroPool ((MAX_HASH_VAL + 1) * sizeof (*mNext));
-
   mBufSiz     = BLKSIZ;
   mBuf        = AllocateZeroPool (mBufSiz);
   while (mBuf == NULL) {
@@ -220,6 +233,29 @@ AllocateMemory (
   return EFI_SUCCESS;
 }
 
+/**
+  Allocate memory spaces for data structures used in compression process.
+  
+  @retval EFI_SUCCESS           Memory was allocated successfully.
+  @retval EFI_OUT_OF_RESOURCES  A memory allocation failed.
+**/
+EFI_STATUS
+EFIAPI
+AllocateMemory (
+  VOID
+  )
+{
+  mText       = AllocateZeroPool (WNDSIZ * 2 + MAXMATCH);
+  mLevel      = AllocateZeroPool ((WNDSIZ + UINT8_MAX + 1) * sizeof (*mLevel));
+  mChildCount = AllocateZeroPool ((WNDSIZ + UINT8_MAX + 1) * sizeof (*mChildCount));
+  mPosition   = AllocateZeroPool ((WNDSIZ + UINT8_MAX + 1) * sizeof (*mPosition));
+  mParent     = AllocateZeroPool (WNDSIZ * 2 * sizeof (*mParent));
+  mPrev       = AllocateZeroPool (WNDSIZ * 2 * sizeof (*mPrev));
+  mNext       = AllocateZeroPool ((MAX_HASH_VAL + 1) * sizeof (*mNext));
+
+  return AllocateBlockBuffer ();
+}
+
 /**
   Called when compression is completed to free memory previously allocated.
 
@@ -237,6 +273,8 @@ FreeMemory (
   SHELL_FREE_NON_NULL (mParent);
   SHELL_FREE_NON_NULL (mPrev);
   SHELL_FREE_NON_NULL (mNext);
+  SHELL_FREE_NON_NULL (mHashHead);
+  SHELL_FREE_NON_NULL (mHashPrev);
   SHELL_FREE_NON_NULL (mBuf);
 }
 
@@ -1336,6 +1374,198 @@ Encode (
   return (Status);
 }
 
+/**
+  Insert a position of the source data into the hash chains.
+
+  @param[in] Pos      The position to insert.
+  @param[in] SrcLen   The number of bytes in the source data.
+**/
+VOID
+EFIAPI
+HashChainInsert (
+  IN UINT32 Pos,
+  IN UINT32 SrcLen
+  )
+{
+  UINT32  Hash;
+
+  if (SrcLen - Pos < THRESHOLD) {
+    return;
+  }
+
+  Hash                            = HASH_CHAIN (&mSrc[Pos]);
+  mHashPrev[Pos & (WNDSIZ - 1)]   = mHashHead[Hash];
+  mHashHead[Hash]                 = Pos + 1;
+}
+
+/**
+  Find the longest match for a position of the source data within the window,
+  then insert the position into the hash chains.
+
+  @param[in]  Pos       The position to find a match for.
+  @param[in]  SrcLen    The number of bytes in the source data.
+  @param[in]  MaxChain  The maximum number of chain entries to compare.
+  @param[out] MatchPos  The position of the match.
+
+  @return The length of the match, 0 if no match of at least THRESHOLD bytes is found.
+**/
+UINT32
+EFIAPI
+HashChainFindMatch (
+  IN  UINT32  Pos,
+  IN  UINT32  SrcLen,
+  IN  UINT32  MaxChain,
+  OUT UINT32  *MatchPos
+  )
+{
+  UINT32  Candidate;
+  UINT32  Limit;
+  UINT32  Len;
+  UINT32  BestLen;
+
+  if (SrcLen - Pos < THRESHOLD) {
+    return 0;
+  }
+
+  Limit     = SrcLen - Pos;
+  if (Limit > MAXMATCH) {
+    Limit = MAXMATCH;
+  }
+  BestLen   = 0;
+  Candidate = mHashHead[HASH_CHAIN (&mSrc[Pos])];
+  while (Candidate != 0 && MaxChain-- > 0) {
+    Candidate--;
+    //
+    // The pointer encodes (distance - 1) in WNDBIT bits. Older entries of
+    // mHashPrev are also overwritten by then, so stop at the window end.
+    //
+    if (Pos - Candidate >= WNDSIZ) {
+      break;
+    }
+
+    if (mSrc[Candidate + BestLen] == mSrc[Pos + BestLen]) {
+      for (Len = 0; Len < Limit && mSrc[Candidate + Len] == mSrc[Pos + Len]; Len++) {
+      }
+
+      if (Len > BestLen) {
+        BestLen   = Len;
+        *MatchPos = Candidate;
+        if (BestLen >= Limit) {
+          break;
+        }
+      }
+    }
+
+    Candidate = mHashPrev[Candidate & (WNDSIZ - 1)];
+  }
+
+  HashChainInsert (Pos, SrcLen);
+
+  return (BestLen >= THRESHOLD) ? BestLen : 0;
+}
+
+/**
+  The main controlling routine for compression process using the hash chain
+  match finder. From LAZY_MATCH_LEVEL on, a match is deferred by one byte when
+  the next position has a longer one.
+
+  The output uses the same Original Character and Pointer encoding as Encode (),
+  so any EFI/Tiano decompressor can decode it.
+
+  @param[in] Level              The compression level, below COMPRESS_LEVEL_BEST.
+
+  @retval EFI_SUCCESS           The compression is successful.
+  @retval EFI_OUT_0F_RESOURCES  Not enough memory for compression process.
+**/
+EFI_STATUS
+EFIAPI
+HashChainEncode (
+  IN UINTN  Level
+  )
+{
+  EFI_STATUS  Status;
+  UINT32      SrcLen;
+  UINT32      Pos;
+  UINT32      MatchLen;
+  UINT32      MatchPos;
+  UINT32      LastMatchLen;
+  UINT32      LastMatchPos;
+  BOOLEAN     Pending;
+
+  Status     = AllocateBlockBuffer ();
+  mHashHead  = AllocateZeroPool (HASH_CHAIN_SIZE * sizeof (*mHashHead));
+  mHashPrev  = AllocateZeroPool (WNDSIZ * sizeof (*mHashPrev));
+  if (EFI_ERROR (Status) || mHashHead == NULL || mHashPrev == NULL) {
+    FreeMemory ();
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  HufEncodeStart ();
+
+  SrcLen       = (UINT32) (mSrcUpperLimit - mSrc);
+  mOrigSize    = SrcLen;
+  Pos          = 0;
+  MatchPos     = 0;
+  LastMatchPos = 0;
+  LastMatchLen = 0;
+  Pending      = FALSE;
+
+  while (Pos < SrcLen) {
+    MatchLen = HashChainFindMatch (Pos, SrcLen, mMaxChain[Level], &MatchPos);
+
+    if (Level < LAZY_MATCH_LEVEL) {
+      if (MatchLen == 0) {
+        CompressOutput (mSrc[Pos], 0);
+        Pos++;
+        continue;
+      }
+
+      CompressOutput (MatchLen + (UINT8_MAX + 1 - THRESHOLD), Pos - MatchPos - 1);
+      while (--MatchLen > 0) {
+        HashChainInsert (++Pos, SrcLen);
+      }
+      Pos++;
+      continue;
+    }
+
+    if (Pending && LastMatchLen != 0 && MatchLen <= LastMatchLen) {
+      //
+      // The match found at the previous position is at least as long, output it.
+      // The current position is already inserted.
+      //
+      CompressOutput (LastMatchLen + (UINT8_MAX + 1 - THRESHOLD), Pos - 1 - LastMatchPos - 1);
+      LastMatchLen -= 2;
+      while (LastMatchLen > 0) {
+        HashChainInsert (++Pos, SrcLen);
+        LastMatchLen--;
+      }
+      Pos++;
+      Pending = FALSE;
+      continue;
+    }
+
+    if (Pending) {
+      CompressOutput (mSrc[Pos - 1], 0);
+    }
+    LastMatchLen = MatchLen;
+    LastMatchPos = MatchPos;
+    Pending      = TRUE;
+    Pos++;
+  }
+
+  if (Pending) {
+    if (LastMatchLen != 0) {
+      CompressOutput (LastMatchLen + (UINT8_MAX + 1 - THRESHOLD), Pos - 1 - LastMatchPos - 1);
+    } else {
+      CompressOutput (mSrc[Pos - 1], 0);
+    }
+  }
+
+  HufEncodeEnd ();
+  FreeMemory ();
+  return EFI_SUCCESS;
+}
+
 /**
   The compression routine.
 
@@ -1356,9 +1586,41 @@ Compress (
   IN       VOID   *DstBuffer,
   IN OUT   UINT64 *DstSize
   )
+{
+  return CompressEx (SrcBuffer, SrcSize, DstBuffer, DstSize, COMPRESS_LEVEL_DEFAULT);
+}
+
+/**
+  The compression routine with a selectable compression level.
+
+  @param[in]       SrcBuffer     The buffer containing the source data.
+  @param[in]       SrcSize       The number of bytes in SrcBuffer.
+  @param[in]       DstBuffer     The buffer to put the compressed image in.
+  @param[in, out]  DstSize       On input the size (in bytes) of DstBuffer, on
+                                return the number of bytes placed in DstBuffer.
+  @param[in]       Level         The compression level, from COMPRESS_LEVEL_FASTEST
+                                 to COMPRESS_LEVEL_BEST.
+
+  @retval EFI_SUCCESS           The compression was sucessful.
+  @retval EFI_BUFFER_TOO_SMALL  The buffer was too small.  DstSize is required.
+  @retval EFI_INVALID_PARAMETER Level is not a valid compression level.
+**/
+EFI_STATUS
+EFIAPI
+CompressEx (
+  IN       VOID   *SrcBuffer,
+  IN       UINT64 SrcSize,
+  IN       VOID   *DstBuffer,
+  IN OUT   UINT64 *DstSize,
+  IN       UINTN  Level
+  )
 {
   EFI_STATUS  Status;
 
+  if (Level < COMPRESS_LEVEL_FASTEST || Level > COMPRESS_LEVEL_BEST) {
+    return EFI_INVALID_PARAMETER;
+  }
+
   //
   // Initializations
   //
@@ -1371,6 +1633,8 @@ Compress (
   mParent         = NULL;
   mPrev           = NULL;
   mNext           = NULL;
+  mHashHead       = NULL;
+  mHashPrev       = NULL;
 
   mSrc            = SrcBuffer;
   mSrcUpperLimit  = mSrc + SrcSize;
@@ -1388,7 +1652,11 @@ Compress (
   //
   // Compress it
   //
-  Status = Encode ();
+  if (Level == COMPRESS_LEVEL_BEST) {
+    Status = Encode ();
+  } else {
+    Status = HashChainEncode (Level);
+  }
   if (EFI_ERROR (Status)) {
     return EFI_OUT_OF_RESOURCES;
   }
@@ -17,6 +17,8 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include "Variable.h"
 #include "Fce.h"
 
+EFI_GUID mHobVariableIndexGuid = HOB_VARIABLE_INDEX_GUID;
+
 /**
 
   Gets the pointer to the first variable header in given variable store area.
@@ -406,6 +408,165 @@ EFI_PEI_NOTIFY_DESCRIPTOR mMemoryNotifyList = {
   BuildDefaultDataHobForRecoveryVariable 
 };
 
+/**
+  Hash a variable name and vendor GUID for the variable index.
+
+  @param[in]  VariableName      Variable name.
+  @param[in]  NameSize          Maximum size of the name in bytes, the hash stops at a Null-terminator.
+  @param[in]  VendorGuid        Vendor GUID.
+
+  @return The hash value.
+
+**/
+STATIC
+UINT32
+HashVariableName (
+  IN CHAR16                     *VariableName,
+  IN UINTN                      NameSize,
+  IN EFI_GUID                   *VendorGuid
+  )
+{
+  UINT32                        Hash;
+  UINTN                         Index;
+  CHAR16                        Char;
+
+  CopyMem (&Hash, VendorGuid, sizeof (Hash));
+  for (Index = 0; Index < NameSize / sizeof (CHAR16); Index++) {
+    CopyMem (&Char, &VariableName[Index], sizeof (Char));
+    if (Char == 0) {
+      break;
+    }
+    Hash = (Hash * 31) + Char;
+  }
+
+  return Hash;
+}
+
+/**
+  Get the default variable store HOB.
+
+  @param[out] AuthFlag          Pointer to output Authenticated variable flag.
+
+  @return Pointer to variable store header, NULL if not found.
+
+**/
+STATIC
+VARIABLE_STORE_HEADER *
+GetVariableStoreFromHob (
+  OUT BOOLEAN                   *AuthFlag
+  )
+{
+  EFI_HOB_GUID_TYPE             *GuidHob;
+
+  GuidHob = GetFirstGuidHob (&gEfiAuthenticatedVariableGuid);
+  if (GuidHob != NULL) {
+    *AuthFlag = TRUE;
+    return (VARIABLE_STORE_HEADER *) GET_GUID_HOB_DATA (GuidHob);
+  }
+
+  GuidHob = GetFirstGuidHob (&gEfiVariableGuid);
+  if (GuidHob != NULL) {
+    *AuthFlag = FALSE;
+    return (VARIABLE_STORE_HEADER *) GET_GUID_HOB_DATA (GuidHob);
+  }
+
+  return NULL;
+}
+
+/**
+  Build the name and GUID hash index of the default variable HOB and publish it
+  as a GUID HOB.
+
+  Each bucket is kept in variable store order, so a lookup finds the same
+  variable as a walk of the variable store.
+
+  @retval EFI_SUCCESS           The index HOB is built.
+  @retval EFI_NOT_FOUND         No default variable HOB.
+  @retval EFI_OUT_OF_RESOURCES  No enough resource to create HOB.
+
+**/
+EFI_STATUS
+BuildVariableIndexHob (
+  VOID
+  )
+{
+  VARIABLE_STORE_HEADER         *VariableStoreHeader;
+  AUTHENTICATED_VARIABLE_HEADER *StartPtr;
+  AUTHENTICATED_VARIABLE_HEADER *EndPtr;
+  AUTHENTICATED_VARIABLE_HEADER *CurrPtr;
+  BOOLEAN                       AuthFlag;
+  HOB_VARIABLE_INDEX            *VariableIndex;
+  UINT32                        *Bucket;
+  HOB_VARIABLE_INDEX_ENTRY      *Entry;
+  UINT32                        EntryCount;
+  UINT32                        BucketCount;
+  UINT32                        Index;
+
+  VariableStoreHeader = GetVariableStoreFromHob (&AuthFlag);
+  if (VariableStoreHeader == NULL) {
+    return EFI_NOT_FOUND;
+  }
+
+  StartPtr = GetStartPointer (VariableStoreHeader);
+  EndPtr   = GetEndPointer (VariableStoreHeader);
+
+  EntryCount = 0;
+  for ( CurrPtr = StartPtr
+      ; (CurrPtr < EndPtr) && IsValidVariableHeader (CurrPtr)
+      ; CurrPtr = GetNextVariablePtr (CurrPtr, AuthFlag)
+      ) {
+    if (CurrPtr->State == VAR_ADDED) {
+      EntryCount++;
+    }
+  }
+
+  BucketCount = 16;
+  while (BucketCount < EntryCount) {
+    BucketCount <<= 1;
+  }
+
+  VariableIndex = BuildGuidHob (
+                    &mHobVariableIndexGuid,
+                    sizeof (HOB_VARIABLE_INDEX) + BucketCount * sizeof (UINT32) + EntryCount * sizeof (HOB_VARIABLE_INDEX_ENTRY)
+                    );
+  if (VariableIndex == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+  CopyGuid (&VariableIndex->StoreSignature, &VariableStoreHeader->Signature);
+  VariableIndex->BucketCount = BucketCount;
+  VariableIndex->EntryCount  = EntryCount;
+  Bucket = (UINT32 *) (VariableIndex + 1);
+  Entry  = (HOB_VARIABLE_INDEX_ENTRY *) (Bucket + BucketCount);
+  ZeroMem (Bucket, BucketCount * sizeof (UINT32));
+
+  Index = 0;
+  for ( CurrPtr = StartPtr
+      ; (CurrPtr < EndPtr) && IsValidVariableHeader (CurrPtr) && (Index < EntryCount)
+      ; CurrPtr = GetNextVariablePtr (CurrPtr, AuthFlag)
+      ) {
+    if (CurrPtr->State == VAR_ADDED) {
+      Entry[Index].Hash   = HashVariableName (
+                              GetVariableNamePtr (CurrPtr, AuthFlag),
+                              NameSizeOfVariable (CurrPtr, AuthFlag),
+                              GetVendorGuidPtr (CurrPtr, AuthFlag)
+                              );
+      Entry[Index].Offset = (UINT32) ((UINTN) CurrPtr - (UINTN) VariableStoreHeader);
+      Index++;
+    }
+  }
+
+  //
+  // Push to the bucket head from the last entry, so each bucket is in store order.
+  //
+  while (Index > 0) {
+    Index--;
+    Entry[Index].Next = Bucket[Entry[Index].Hash & (BucketCount - 1)];
+    Bucket[Entry[Index].Hash & (BucketCount - 1)] = Index + 1;
+  }
+
+  return EFI_SUCCESS;
+}
+
 /**
   Find variable from default variable HOB.
 
@@ -430,25 +591,50 @@ FindVariableFromHob (
   AUTHENTICATED_VARIABLE_HEADER *EndPtr;
   AUTHENTICATED_VARIABLE_HEADER *CurrPtr;
   VOID                          *Point;
+  HOB_VARIABLE_INDEX            *VariableIndex;
+  UINT32                        *Bucket;
+  HOB_VARIABLE_INDEX_ENTRY      *Entry;
+  UINT32                        Hash;
+  UINT32                        EntryIndex;
 
-  VariableStoreHeader = NULL;
-
-  GuidHob = GetFirstGuidHob (&gEfiAuthenticatedVariableGuid);
-  if (GuidHob != NULL) {
-    VariableStoreHeader = (VARIABLE_STORE_HEADER *) GET_GUID_HOB_DATA (GuidHob);
-    *AuthFlag = TRUE;
-  } else {
-    GuidHob = GetFirstGuidHob (&gEfiVariableGuid);
-    if (GuidHob != NULL) {
-      VariableStoreHeader = (VARIABLE_STORE_HEADER *) GET_GUID_HOB_DATA (GuidHob);
-      *AuthFlag = FALSE;
-    }
-  }
+  VariableStoreHeader = GetVariableStoreFromHob (AuthFlag);
   ASSERT (VariableStoreHeader != NULL);
   if (VariableStoreHeader == NULL) {
     return NULL;
   }
 
+  //
+  // Use the index built with the default variable HOB when it is for this store.
+  //
+  GuidHob = GetFirstGuidHob (&mHobVariableIndexGuid);
+  if (GuidHob != NULL) {
+    VariableIndex = (HOB_VARIABLE_INDEX *) GET_GUID_HOB_DATA (GuidHob);
+    if (CompareGuid (&VariableIndex->StoreSignature, &VariableStoreHeader->Signature)) {
+      Bucket = (UINT32 *) (VariableIndex + 1);
+      Entry  = (HOB_VARIABLE_INDEX_ENTRY *) (Bucket + VariableIndex->BucketCount);
+      Hash   = HashVariableName (VariableName, MAX_UINTN, VendorGuid);
+      for ( EntryIndex = Bucket[Hash & (VariableIndex->BucketCount - 1)]
+          ; EntryIndex != 0
+          ; EntryIndex = Entry[EntryIndex - 1].Next
+          ) {
+        if (Entry[EntryIndex - 1].Hash != Hash) {
+          continue;
+        }
+        CurrPtr = (AUTHENTICATED_VARIABLE_HEADER *) ((UINTN) VariableStoreHeader + Entry[EntryIndex - 1].Offset);
+        if ((CurrPtr->State == VAR_ADDED) &&
+            CompareGuid (VendorGuid, GetVendorGuidPtr (CurrPtr, *AuthFlag))) {
+          Point = (VOID *) GetVariableNamePtr (CurrPtr, *AuthFlag);
+
+          ASSERT (NameSizeOfVariable (CurrPtr, *AuthFlag) != 0);
+          if (CompareMem (VariableName, Point, NameSizeOfVariable (CurrPtr, *AuthFlag)) == 0) {
+            return CurrPtr;
+          }
+        }
+      }
+      return NULL;
+    }
+  }
+
   StartPtr = GetStartPointer (VariableStoreHeader);
   EndPtr   = GetEndPointer (VariableStoreHeader);
   for ( CurrPtr = StartPtr
@@ -445,6 +445,12 @@ CreateDefaultVariableHob (
   //
   VarStoreHeaderHob->Size = VarStoreHeader->Size - VarDataOffset + VarHobDataOffset;
 
+  //
+  // Index the default variable HOB by name and GUID for FindVariableFromHob ().
+  //
+  Status = BuildVariableIndexHob ();
+  DEBUG ((DEBUG_INFO, "BuildVariableIndexHob - %r\n", Status));
+
   //
   // On recovery boot mode, emulation variable driver will be used.
   // But, Emulation variable only knows normal variable data format. 
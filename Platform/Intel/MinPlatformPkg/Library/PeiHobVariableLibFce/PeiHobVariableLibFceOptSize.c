@@ -184,6 +184,12 @@ CreateDefaultVariableHob (
     return EFI_NOT_FOUND;
   }
 
+  //
+  // Index the default variable HOB by name and GUID for FindVariableFromHob ().
+  //
+  Status = BuildVariableIndexHob ();
+  DEBUG ((DEBUG_INFO, "BuildVariableIndexHob - %r\n", Status));
+
   //
   // On recovery boot mode, emulation variable driver will be used.
   // But, Emulation variable only knows normal variable data format. 
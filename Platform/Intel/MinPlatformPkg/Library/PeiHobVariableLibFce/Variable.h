@@ -169,4 +169,56 @@ typedef struct {
 
 #pragma pack()
 
+///
+/// HOB published next to the default variable HOB, so that variables can be
+/// looked up by name and GUID without walking the whole variable store.
+///
+#define HOB_VARIABLE_INDEX_GUID \
+  { 0x8f33528f, 0x1e05, 0x4a39, { 0xa5, 0x27, 0x02, 0xa5, 0x50, 0xd8, 0x17, 0x65 } }
+
+typedef struct {
+  ///
+  /// Hash of the variable name and vendor GUID.
+  ///
+  UINT32      Hash;
+  ///
+  /// Offset of the variable header from the variable store header.
+  ///
+  UINT32      Offset;
+  ///
+  /// Index + 1 of the next entry in the same bucket, 0 for the end of the bucket.
+  ///
+  UINT32      Next;
+} HOB_VARIABLE_INDEX_ENTRY;
+
+typedef struct {
+  ///
+  /// Signature of the indexed variable store.
+  ///
+  EFI_GUID    StoreSignature;
+  ///
+  /// Number of buckets, a power of 2.
+  ///
+  UINT32      BucketCount;
+  UINT32      EntryCount;
+  //
+  // UINT32                    Bucket[BucketCount];   // Index + 1 of the first entry
+  // HOB_VARIABLE_INDEX_ENTRY  Entry[EntryCount];
+  //
+} HOB_VARIABLE_INDEX;
+
+/**
+  Build the name and GUID hash index of the default variable HOB and publish it
+  as a GUID HOB.
+
+  @retval EFI_SUCCESS           The index HOB is built.
+  @retval EFI_NOT_FOUND         No default variable HOB.
+  @retval EFI_OUT_OF_RESOURCES  No enough resource to create HOB.
+
+**/
+EFI_STATUS
+BuildVariableIndexHob (
+  VOID
+  );
+
 #endif
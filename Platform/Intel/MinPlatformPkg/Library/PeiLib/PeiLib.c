@@ -6,10 +6,14 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 **/
 
 #include <PiPei.h>
+#include <Library/BaseLib.h>
 #include <Library/DebugLib.h>
+#include <Library/HobLib.h>
+#include <Library/PeiLib.h>
 #include <Library/PeiServicesLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Ppi/ReadOnlyVariable2.h>
+#include <MemoryConfigInfo.h>
 
 /**
   Returns the status whether get the variable success. The function retrieves 
@@ -108,6 +112,102 @@ PeiGetVariable (
   return Status;
 }
 
+/**
+  Gets the saved memory configuration data for a fast boot. The data is
+  returned only when it matches the size and CRC32 saved in the
+  MemoryConfigInfo variable, and it was saved with the same platform memory
+  fingerprint. Otherwise the caller should let the memory be trained again.
+
+  The CRC32 of Fingerprint is also passed to SaveMemoryConfig in a HOB, so
+  that it is saved with new memory configuration data.
+
+  The returned buffer is allocated using AllocatePool().
+
+  @param[in]  Name             The name of the memory configuration variable.
+  @param[in]  Guid             The GUID of the memory configuration variable.
+  @param[in]  Fingerprint      Platform memory fingerprint, for example the DIMM
+                               SPD serial numbers. It is optional.
+  @param[in]  FingerprintSize  The size of Fingerprint.
+  @param[out] Value            The buffer point saved the memory configuration data.
+  @param[out] Size             The buffer size of the memory configuration data.
+
+  @retval EFI_SUCCESS          The saved memory configuration data is valid.
+  @retval EFI_NOT_FOUND        The data is not found, or it was saved with a
+                               different fingerprint.
+  @retval EFI_CRC_ERROR        The data does not match its saved size and CRC32.
+  @return Others Errors        Return errors from call to PeiGetVariable.
+**/
+EFI_STATUS
+EFIAPI
+PeiGetMemoryConfig (
+  IN CONST CHAR16    *Name,
+  IN CONST EFI_GUID  *Guid,
+  IN CONST VOID      *Fingerprint  OPTIONAL,
+  IN UINTN           FingerprintSize,
+  OUT VOID           **Value,
+  OUT UINTN          *Size
+  )
+{
+  EFI_STATUS                        Status;
+  MEMORY_CONFIG_INFO                CurrentInfo;
+  MEMORY_CONFIG_INFO                *SavedInfo;
+  UINTN                             InfoSize;
+
+  ASSERT (Value != NULL);
+  ASSERT (Size != NULL);
+
+  CurrentInfo.Revision         = MEMORY_CONFIG_INFO_REVISION;
+  CurrentInfo.DataSize         = 0;
+  CurrentInfo.DataCrc32        = 0;
+  CurrentInfo.FingerprintCrc32 = 0;
+  if ((Fingerprint != NULL) && (FingerprintSize != 0)) {
+    CurrentInfo.FingerprintCrc32 = CalculateCrc32 ((VOID *) Fingerprint, FingerprintSize);
+  }
+  BuildGuidDataHob (&gMemoryConfigInfoGuid, &CurrentInfo, sizeof (CurrentInfo));
+
+  *Value = NULL;
+  *Size  = 0;
+
+  //
+  // The data saved by an older firmware has no MemoryConfigInfo, it is
+  // returned as is.
+  //
+  SavedInfo = NULL;
+  InfoSize  = 0;
+  Status = PeiGetVariable (
+             MEMORY_CONFIG_INFO_VARIABLE_NAME,
+             &gMemoryConfigInfoGuid,
+             (VOID **) &SavedInfo,
+             &InfoSize
+             );
+  if (EFI_ERROR (Status)) {
+    SavedInfo = NULL;
+  } else if ((InfoSize < sizeof (MEMORY_CONFIG_INFO)) ||
+             (SavedInfo->Revision != MEMORY_CONFIG_INFO_REVISION) ||
+             (SavedInfo->FingerprintCrc32 != CurrentInfo.FingerprintCrc32)) {
+    DEBUG ((DEBUG_INFO, "Memory configuration fingerprint changed, retrain memory\n"));
+    FreePool (SavedInfo);
+    return EFI_NOT_FOUND;
+  }
+
+  Status = PeiGetVariable (Name, Guid, Value, Size);
+  if (!EFI_ERROR (Status) && (SavedInfo != NULL)) {
+    if ((*Size != SavedInfo->DataSize) ||
+        (CalculateCrc32 (*Value, *Size) != SavedInfo->DataCrc32)) {
+      DEBUG ((DEBUG_ERROR, "Memory configuration data CRC error, retrain memory\n"));
+      FreePool (*Value);
+      *Value = NULL;
+      *Size  = 0;
+      Status = EFI_CRC_ERROR;
+    }
+  }
+
+  if (SavedInfo != NULL) {
+    FreePool (SavedInfo);
+  }
+  return Status;
+}
+
 EFI_PEI_FILE_HANDLE
 InternalGetFfsHandleFromAnyFv (
   IN CONST  EFI_GUID           *NameGuid
@@ -19,8 +19,47 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/PeiServicesLib.h>
 #include <Guid/SmramMemoryReserve.h>
 
+//
+// Memory ranges passed to MtrrLib by SetCacheMtrr (). The first ones, DRAM
+// below 4GB and VGA-MMIO, are always kept.
+//
+#define SET_CACHE_MTRR_RANGE_COUNT           4
+#define SET_CACHE_MTRR_REQUIRED_RANGE_COUNT  2
+#define SET_CACHE_MTRR_SCRATCH_SIZE          SIZE_16KB
+
+/**
+  Program the MTRR settings saved in the MTRR settings HOB by SetCacheMtrr ().
+
+  It may be called on the BSP and on the APs, so that all the processors use
+  the same MTRR settings without computing them again.
+
+  @retval  EFI_SUCCESS    The MTRR settings are programmed.
+  @retval  EFI_NOT_FOUND  SetCacheMtrr () has not saved the MTRR settings yet.
+**/
+EFI_STATUS
+EFIAPI
+SetCacheMtrrFromHob (
+  VOID
+  )
+{
+  EFI_HOB_GUID_TYPE           *GuidHob;
+
+  GuidHob = GetFirstGuidHob (&gMinPlatformMtrrSettingsHobGuid);
+  if (GuidHob == NULL) {
+    return EFI_NOT_FOUND;
+  }
+
+  MtrrSetAllMtrrs ((MTRR_SETTINGS *) GET_GUID_HOB_DATA (GuidHob));
+  return EFI_SUCCESS;
+}
+
 /**
   Set Cache Mtrr.
+
+  The memory map is described as a list of ranges and passed to MtrrLib at
+  once, so that it computes the variable MTRR layout with the least MTRRs,
+  using UC ranges overlapping WB ranges where it saves MTRRs. The result is
+  saved in a HOB for SetCacheMtrrFromHob ().
 **/
 VOID
 EFIAPI
@@ -31,13 +70,21 @@ SetCacheMtrr (
   EFI_STATUS                  Status;
   EFI_PEI_HOB_POINTERS        Hob;
   MTRR_SETTINGS               MtrrSetting;
-  UINT64                      MemoryBase;
-  UINT64                      MemoryLength;
+  MTRR_MEMORY_RANGE           MemoryRange[SET_CACHE_MTRR_RANGE_COUNT];
+  UINTN                       RangeCount;
+  UINT8                       Scratch[SET_CACHE_MTRR_SCRATCH_SIZE];
+  UINTN                       ScratchSize;
   UINT64                      LowMemoryLength;
   UINT64                      HighMemoryLength;
   EFI_BOOT_MODE               BootMode;
   EFI_RESOURCE_ATTRIBUTE_TYPE ResourceAttribute;
-  UINT64                      CacheMemoryLength;
+
+  ///
+  /// The settings are computed once, following calls replay them.
+  ///
+  if (!EFI_ERROR (SetCacheMtrrFromHob ())) {
+    return ;
+  }
 
   ///
   /// Reset all MTRR setting.
@@ -105,72 +152,67 @@ SetCacheMtrr (
   DEBUG ((DEBUG_INFO, "Memory Length (Above 4GB) = %lx.\n", HighMemoryLength));
 
   ///
-  /// Assume size of main memory is multiple of 256MB
+  /// Describe the whole memory map, later ranges override earlier ones:
+  /// DRAM below 4GB as WB, VGA-MMIO - 0xA0000 to 0xC0000 as UC,
+  /// DRAM above 4GB as WB and the Flash area as WP.
   ///
-  MemoryLength = (LowMemoryLength + 0xFFFFFFF) & 0xF0000000;
-  MemoryBase = 0;
+  RangeCount = 0;
+  MemoryRange[RangeCount].BaseAddress = 0;
+  MemoryRange[RangeCount].Length      = LowMemoryLength;
+  MemoryRange[RangeCount].Type        = CacheWriteBack;
+  RangeCount++;
+
+  MemoryRange[RangeCount].BaseAddress = 0xA0000;
+  MemoryRange[RangeCount].Length      = 0x20000;
+  MemoryRange[RangeCount].Type        = CacheUncacheable;
+  RangeCount++;
+
+  if (HighMemoryLength != 0) {
+    MemoryRange[RangeCount].BaseAddress = 0x100000000ULL;
+    MemoryRange[RangeCount].Length      = HighMemoryLength;
+    MemoryRange[RangeCount].Type        = CacheWriteBack;
+    RangeCount++;
+  }
+
+  MemoryRange[RangeCount].BaseAddress = (UINTN) PcdGet32 (PcdFlashAreaBaseAddress);
+  MemoryRange[RangeCount].Length      = (UINTN) PcdGet32 (PcdFlashAreaSize);
+  MemoryRange[RangeCount].Type        = CacheWriteProtected;
+  RangeCount++;
 
-  CacheMemoryLength = MemoryLength;
   ///
-  /// Programming MTRRs to avoid override SPI region with UC when MAX TOLUD Length >= 3.5GB
+  /// When the MTRRs are not enough, drop the ranges that are only for
+  /// performance from the end, but never leave DRAM below 4GB uncached.
   ///
-  if (MemoryLength > 0xDC000000) {
-     CacheMemoryLength = 0xC0000000;
-     Status = MtrrSetMemoryAttributeInMtrrSettings (
-                &MtrrSetting,
-                MemoryBase,
-                CacheMemoryLength,
-                CacheWriteBack
-                );
-     ASSERT_EFI_ERROR (Status);
-
-     MemoryBase = 0xC0000000;
-     CacheMemoryLength = MemoryLength - 0xC0000000;
-     if (MemoryLength > 0xE0000000) {
-        CacheMemoryLength = 0x20000000;
-        Status = MtrrSetMemoryAttributeInMtrrSettings (
-                 &MtrrSetting,
-                 MemoryBase,
-                 CacheMemoryLength,
-                 CacheWriteBack
-                 );
-        ASSERT_EFI_ERROR (Status);
-
-        MemoryBase = 0xE0000000;
-        CacheMemoryLength = MemoryLength - 0xE0000000;
-     }
-  }
-
-  Status = MtrrSetMemoryAttributeInMtrrSettings (
-                &MtrrSetting,
-                MemoryBase,
-                CacheMemoryLength,
-                CacheWriteBack
-                );
+  do {
+    ZeroMem (&MtrrSetting, sizeof(MTRR_SETTINGS));
+    ScratchSize = sizeof (Scratch);
+    Status = MtrrSetMemoryAttributesInMtrrSettings (
+               &MtrrSetting,
+               Scratch,
+               &ScratchSize,
+               MemoryRange,
+               RangeCount
+               );
+    if (Status != EFI_OUT_OF_RESOURCES) {
+      break;
+    }
+    DEBUG ((
+      DEBUG_WARN,
+      "SetCacheMtrr - %r, drop range [0x%lx, 0x%lx)\n",
+      Status,
+      MemoryRange[RangeCount - 1].BaseAddress,
+      MemoryRange[RangeCount - 1].BaseAddress + MemoryRange[RangeCount - 1].Length
+      ));
+    RangeCount--;
+  } while (RangeCount > SET_CACHE_MTRR_REQUIRED_RANGE_COUNT);
   ASSERT_EFI_ERROR (Status);
 
-  if (LowMemoryLength != MemoryLength) {
-     MemoryBase = LowMemoryLength;
-     MemoryLength -= LowMemoryLength;
-     Status = MtrrSetMemoryAttributeInMtrrSettings (
-                   &MtrrSetting,
-                   MemoryBase,
-                   MemoryLength,
-                   CacheUncacheable
-                   );
-      ASSERT_EFI_ERROR (Status);
-  }
-
   ///
-  /// VGA-MMIO - 0xA0000 to 0xC0000 to be UC
+  /// Save the MTRR settings for SetCacheMtrrFromHob ().
   ///
-  Status = MtrrSetMemoryAttributeInMtrrSettings (
-                &MtrrSetting,
-                0xA0000,
-                0x20000,
-                CacheUncacheable
-                );
-  ASSERT_EFI_ERROR (Status);
+  if (!EFI_ERROR (Status)) {
+    BuildGuidDataHob (&gMinPlatformMtrrSettingsHobGuid, &MtrrSetting, sizeof (MtrrSetting));
+  }
 
   ///
   /// Update MTRR setting from MTRR buffer
@@ -22,6 +22,20 @@ SetCacheMtrr (
   return;
 }
 
+/**
+  Program the MTRR settings saved in the MTRR settings HOB by SetCacheMtrr ().
+
+  @retval  EFI_NOT_FOUND  SetCacheMtrr () does not save the MTRR settings.
+**/
+EFI_STATUS
+EFIAPI
+SetCacheMtrrFromHob (
+  VOID
+  )
+{
+  return EFI_NOT_FOUND;
+}
+
 /**
   Update MTRR setting in EndOfPei phase.
   This function will clear temporary memory (CAR) phase MTRR settings
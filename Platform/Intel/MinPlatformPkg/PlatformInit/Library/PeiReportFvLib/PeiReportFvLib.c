@@ -15,6 +15,49 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Guid/FirmwareFileSystem2.h>
 #include <Ppi/FirmwareVolumeInfo.h>
 
+/**
+  Report a firmware volume that only holds DXE modules.
+
+  By default the FV is installed as a FV Info PPI. When PcdReportDxeFvOnDemand
+  is set, only a FV HOB is built so that the PEI Core does not process the FV,
+  and nothing is reported on S3 resume.
+
+  @param[in]  Name      Name of the FV for debug messages.
+  @param[in]  FvBase    Base address of the FV.
+  @param[in]  FvSize    Size of the FV.
+  @param[in]  BootMode  Current boot mode.
+**/
+STATIC
+VOID
+ReportDxeFv (
+  IN CHAR8          *Name,
+  IN UINT32         FvBase,
+  IN UINT32         FvSize,
+  IN EFI_BOOT_MODE  BootMode
+  )
+{
+  if (!FixedPcdGetBool (PcdReportDxeFvOnDemand)) {
+    DEBUG ((DEBUG_INFO, "Install %a - 0x%x, 0x%x\n", Name, FvBase, FvSize));
+    PeiServicesInstallFvInfo2Ppi (
+      &(((EFI_FIRMWARE_VOLUME_HEADER *) (UINTN) FvBase)->FileSystemGuid),
+      (VOID *) (UINTN) FvBase,
+      FvSize,
+      NULL,
+      NULL,
+      0
+      );
+    return;
+  }
+
+  if (BootMode == BOOT_ON_S3_RESUME) {
+    DEBUG ((DEBUG_INFO, "Skip %a on S3 resume\n", Name));
+    return;
+  }
+
+  DEBUG ((DEBUG_INFO, "Report %a on demand - 0x%x, 0x%x\n", Name, FvBase, FvSize));
+  BuildFvHob ((UINTN) FvBase, FvSize);
+}
+
 VOID
 ReportPreMemFv (
   VOID
@@ -93,24 +136,8 @@ ReportPostMemFv (
       NULL,
       0
       );
-    DEBUG ((DEBUG_INFO, "Install FlashFvUefiBoot - 0x%x, 0x%x\n", PcdGet32 (PcdFlashFvUefiBootBase), PcdGet32 (PcdFlashFvUefiBootSize)));
-    PeiServicesInstallFvInfo2Ppi (
-      &(((EFI_FIRMWARE_VOLUME_HEADER *) (UINTN) PcdGet32 (PcdFlashFvUefiBootBase))->FileSystemGuid),
-      (VOID *) (UINTN) PcdGet32 (PcdFlashFvUefiBootBase),
-      PcdGet32 (PcdFlashFvUefiBootSize),
-      NULL,
-      NULL,
-      0
-      );
-    DEBUG ((DEBUG_INFO, "Install FlashFvOsBoot - 0x%x, 0x%x\n", PcdGet32 (PcdFlashFvOsBootBase), PcdGet32 (PcdFlashFvOsBootSize)));
-    PeiServicesInstallFvInfo2Ppi (
-      &(((EFI_FIRMWARE_VOLUME_HEADER *) (UINTN) PcdGet32 (PcdFlashFvOsBootBase))->FileSystemGuid),
-      (VOID *) (UINTN) PcdGet32 (PcdFlashFvOsBootBase),
-      PcdGet32 (PcdFlashFvOsBootSize),
-      NULL,
-      NULL,
-      0
-      );
+    ReportDxeFv ("FlashFvUefiBoot", PcdGet32 (PcdFlashFvUefiBootBase), PcdGet32 (PcdFlashFvUefiBootSize), BootMode);
+    ReportDxeFv ("FlashFvOsBoot", PcdGet32 (PcdFlashFvOsBootBase), PcdGet32 (PcdFlashFvOsBootSize), BootMode);
     if (PcdGet8 (PcdBootStage) >= 6) {
       DEBUG ((DEBUG_INFO, "Install FlashFvAdvanced - 0x%x, 0x%x\n", PcdGet32 (PcdFlashFvAdvancedBase), PcdGet32 (PcdFlashFvAdvancedSize)));
       PeiServicesInstallFvInfo2Ppi (
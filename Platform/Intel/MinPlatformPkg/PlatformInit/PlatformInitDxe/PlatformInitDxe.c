@@ -79,6 +79,8 @@ OnEndOfDxe (
   TestPointEndOfDxeDmaAcpiTableFunctional ();
 
   TestPointEndOfDxeDmaProtectionEnabled ();
+
+  TestPointEndOfDxeBootTimeBudget ();
 }
 
 /**
@@ -154,6 +156,8 @@ OnReadyToBootLater (
   TestPointReadyToBootTcgTrustedBootEnabled ();
   TestPointReadyToBootTcgMorEnabled ();
   TestPointReadyToBootEsrtTableFunctional ();
+
+  TestPointReadyToBootBootTimeBudget ();
 }
 
 /**
@@ -69,6 +69,8 @@ PlatformInitEndOfPei (
 
   TestPointEndOfPeiMtrrFunctional ();
 
+  TestPointEndOfPeiBootTimeBudget ();
+
   return Status;
 }
 
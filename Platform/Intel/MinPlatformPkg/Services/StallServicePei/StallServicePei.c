@@ -8,12 +8,33 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Ppi/Stall.h>
 #include <Library/BaseLib.h>
 #include <Library/DebugLib.h>
+#include <Library/HobLib.h>
+#include <Library/MemoryAllocationLib.h>
 #include <Library/PeimEntryPoint.h>
 #include <Library/TimerLib.h>
 #include <Library/PeiServicesLib.h>
 
 #define PEI_STALL_RESOLUTION   1
 
+//
+// Time the TSC is calibrated against the timer library for, in microseconds.
+//
+#define TSC_CALIBRATION_TIME   1000
+
+#define PEI_STALL_PRIVATE_SIGNATURE  SIGNATURE_32 ('P', 'S', 'T', 'L')
+
+typedef struct {
+  UINT32                  Signature;
+  EFI_PEI_STALL_PPI       StallPpi;
+  EFI_PEI_PPI_DESCRIPTOR  PpiDescriptor;
+  ///
+  /// TSC frequency in Hz, 0 when the TSC can not be used.
+  ///
+  UINT64                  TscFrequency;
+} PEI_STALL_PRIVATE;
+
+#define PEI_STALL_PRIVATE_FROM_THIS(a)  CR (a, PEI_STALL_PRIVATE, StallPpi, PEI_STALL_PRIVATE_SIGNATURE)
+
 /**
   The Stall() function provides a blocking stall for at least the number
   of microseconds stipulated in the final argument of the API.
@@ -53,14 +74,113 @@ Stall (
   IN UINTN                    Microseconds
   )
 {
-  MicroSecondDelay (Microseconds);
+  PEI_STALL_PRIVATE  *Private;
+  UINT64             Ticks;
+  UINT64             Start;
+
+  //
+  // The PPI in mStallPpi is only installed when the TSC can not be used.
+  //
+  if (This == &mStallPpi) {
+    MicroSecondDelay (Microseconds);
+    return EFI_SUCCESS;
+  }
+
+  Private = PEI_STALL_PRIVATE_FROM_THIS (This);
+  if (Microseconds > DivU64x64Remainder (MAX_UINT64, Private->TscFrequency, NULL)) {
+    MicroSecondDelay (Microseconds);
+    return EFI_SUCCESS;
+  }
+
+  Ticks = DivU64x32 (MultU64x64 (Microseconds, Private->TscFrequency), 1000000) + 1;
+  Start = AsmReadTsc ();
+  while (AsmReadTsc () - Start < Ticks) {
+    CpuPause ();
+  }
 
   return EFI_SUCCESS;
 }
 
+/**
+  Get the TSC frequency.
+
+  The TSC is only used when it is invariant. The frequency is taken from the
+  TSC/crystal clock ratio of CPUID leaf 0x15 when it is reported, otherwise
+  the TSC is calibrated once against the timer library.
+
+  @return The TSC frequency in Hz, 0 when the TSC can not be used.
+
+**/
+UINT64
+GetTscFrequency (
+  VOID
+  )
+{
+  UINT32  MaxExtendedLeaf;
+  UINT32  MaxLeaf;
+  UINT32  RegEax;
+  UINT32  RegEbx;
+  UINT32  RegEcx;
+  UINT32  RegEdx;
+  UINT64  StartValue;
+  UINT64  EndValue;
+  UINT64  TimerStart;
+  UINT64  TimerEnd;
+  UINT64  TscStart;
+  UINT64  TscEnd;
+  UINT64  ElapsedTime;
+
+  //
+  // CPUID.80000007H:EDX[8] - Invariant TSC
+  //
+  AsmCpuid (0x80000000, &MaxExtendedLeaf, NULL, NULL, NULL);
+  if (MaxExtendedLeaf < 0x80000007) {
+    return 0;
+  }
+  AsmCpuid (0x80000007, NULL, NULL, NULL, &RegEdx);
+  if ((RegEdx & BIT8) == 0) {
+    return 0;
+  }
+
+  //
+  // CPUID.15H - TSC/core crystal clock ratio and the crystal clock frequency
+  //
+  AsmCpuid (0, &MaxLeaf, NULL, NULL, NULL);
+  if (MaxLeaf >= 0x15) {
+    AsmCpuid (0x15, &RegEax, &RegEbx, &RegEcx, NULL);
+    if ((RegEax != 0) && (RegEbx != 0) && (RegEcx != 0)) {
+      return DivU64x32 (MultU64x32 (RegEcx, RegEbx), RegEax);
+    }
+  }
+
+  //
+  // Calibrate the TSC against the timer library
+  //
+  GetPerformanceCounterProperties (&StartValue, &EndValue);
+  TimerStart = GetPerformanceCounter ();
+  TscStart   = AsmReadTsc ();
+  MicroSecondDelay (TSC_CALIBRATION_TIME);
+  TscEnd     = AsmReadTsc ();
+  TimerEnd   = GetPerformanceCounter ();
+
+  if (StartValue < EndValue) {
+    ElapsedTime = GetTimeInNanoSecond (TimerEnd - TimerStart);
+  } else {
+    ElapsedTime = GetTimeInNanoSecond (TimerStart - TimerEnd);
+  }
+  if (ElapsedTime == 0) {
+    return 0;
+  }
+
+  return DivU64x64Remainder (MultU64x32 (TscEnd - TscStart, 1000000000), ElapsedTime, NULL);
+}
+
 /**
   This function will install the EFI_PEI_STALL_PPI.
 
+  When the TSC can be used, the PPI stalls on the TSC instead of the timer
+  library, and the TSC frequency is published in a HOB for later phases.
+
   @param  FileHandle            Handle of the file being invoked.
   @param  PeiServices           Pointer to PEI Services table.
 
@@ -78,9 +198,34 @@ StallServiceEntryPoint (
   IN CONST EFI_PEI_SERVICES     **PeiServices
   )
 {
-  EFI_STATUS   Status;
-
-  Status = PeiServicesInstallPpi (&mPeiInstallStallPpi);
+  EFI_STATUS          Status;
+  PEI_STALL_PRIVATE   *Private;
+  UINT64              TscFrequency;
+
+  TscFrequency = GetTscFrequency ();
+  DEBUG ((DEBUG_INFO, "StallServicePei - TSC frequency %ld Hz\n", TscFrequency));
+
+  Private = NULL;
+  if (TscFrequency != 0) {
+    BuildGuidDataHob (&gMinPlatformTscFrequencyHobGuid, &TscFrequency, sizeof (TscFrequency));
+    Private = AllocatePool (sizeof (PEI_STALL_PRIVATE));
+  }
+
+  if (Private == NULL) {
+    Status = PeiServicesInstallPpi (&mPeiInstallStallPpi);
+    ASSERT_EFI_ERROR (Status);
+    return Status;
+  }
+
+  Private->Signature              = PEI_STALL_PRIVATE_SIGNATURE;
+  Private->StallPpi.Resolution    = PEI_STALL_RESOLUTION;
+  Private->StallPpi.Stall         = Stall;
+  Private->TscFrequency           = TscFrequency;
+  Private->PpiDescriptor.Flags    = EFI_PEI_PPI_DESCRIPTOR_PPI | EFI_PEI_PPI_DESCRIPTOR_TERMINATE_LIST;
+  Private->PpiDescriptor.Guid     = &gEfiPeiStallPpiGuid;
+  Private->PpiDescriptor.Ppi      = &Private->StallPpi;
+
+  Status = PeiServicesInstallPpi (&Private->PpiDescriptor);
   ASSERT_EFI_ERROR (Status);
 
   return Status;
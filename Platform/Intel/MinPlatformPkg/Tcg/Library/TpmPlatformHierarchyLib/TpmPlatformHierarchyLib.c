@@ -21,6 +21,8 @@
 #include <Library/Tpm2CommandLib.h>
 #include <Library/RngLib.h>
 #include <Library/UefiLib.h>
+#include <Library/PcdLib.h>
+#include <Protocol/Tcg2Protocol.h>
 #include <Protocol/DxeSmmReadyToLock.h>
 
 //
@@ -54,7 +56,7 @@ RdRandGenerateEntropy (
   UINT8       *Ptr;
 
   Status = EFI_NOT_READY;
-  BlockCount = Length / 64;
+  BlockCount = Length / sizeof (Seed);
   Ptr = (UINT8 *)Entropy;
 
   //
@@ -65,10 +67,10 @@ RdRandGenerateEntropy (
     if (EFI_ERROR (Status)) {
       return Status;
     }
-    CopyMem (Ptr, Seed, 64);
+    CopyMem (Ptr, Seed, sizeof (Seed));
 
     BlockCount--;
-    Ptr = Ptr + 64;
+    Ptr = Ptr + sizeof (Seed);
   }
 
   //
@@ -78,11 +80,38 @@ RdRandGenerateEntropy (
   if (EFI_ERROR (Status)) {
     return Status;
   }
-  CopyMem (Ptr, Seed, (Length % 64));
+  CopyMem (Ptr, Seed, (Length % sizeof (Seed)));
 
   return Status;
 }
 
+/**
+  Return the largest digest size of the PCR banks in a TPM2 hash mask.
+
+  @param[in]  HashMask     Bitmap of EFI_TCG2_BOOT_HASH_ALG_xxx.
+
+  @return The largest digest size, or 0 if HashMask has no known bank.
+**/
+UINT16
+GetAuthSizeFromHashMask (
+  IN UINT32  HashMask
+  )
+{
+  if ((HashMask & EFI_TCG2_BOOT_HASH_ALG_SHA512) != 0) {
+    return SHA512_DIGEST_SIZE;
+  }
+  if ((HashMask & EFI_TCG2_BOOT_HASH_ALG_SHA384) != 0) {
+    return SHA384_DIGEST_SIZE;
+  }
+  if ((HashMask & (EFI_TCG2_BOOT_HASH_ALG_SHA256 | EFI_TCG2_BOOT_HASH_ALG_SM3_256)) != 0) {
+    return SHA256_DIGEST_SIZE;
+  }
+  if ((HashMask & EFI_TCG2_BOOT_HASH_ALG_SHA1) != 0) {
+    return SHA1_DIGEST_SIZE;
+  }
+  return 0;
+}
+
 /**
   This function returns the maximum size of TPM2B_AUTH; this structure is used for an authorization value
   and limits an authValue to being no larger than the largest digest produced by a TPM.
@@ -106,6 +135,14 @@ GetAuthSize (
 
   Status = EFI_SUCCESS;
 
+  //
+  // Tcg2Pei has already synced PcdTpm2HashMask with the active PCR banks, so
+  // size the auth from it rather than spending a command on a slow TPM.
+  //
+  if (mAuthSize == 0) {
+    mAuthSize = GetAuthSizeFromHashMask (PcdGet32 (PcdTpm2HashMask));
+  }
+
   while (mAuthSize == 0) {
 
     mAuthSize = SHA1_DIGEST_SIZE;
@@ -186,6 +223,7 @@ RandomizePlatformAuth (
   RdRandGenerateEntropy (RandSize, Rand);
   CopyMem (NewPlatformAuth.buffer, Rand, AuthSize);
 
+  ZeroMem (Rand, RandSize);
   FreePool (Rand);
 
   //
@@ -194,7 +232,6 @@ RandomizePlatformAuth (
   Status = Tpm2HierarchyChangeAuth (TPM_RH_PLATFORM, NULL, &NewPlatformAuth);
   DEBUG ((DEBUG_INFO, "Tpm2HierarchyChangeAuth Result: - %r\n", Status));
   ZeroMem (NewPlatformAuth.buffer, AuthSize);
-  ZeroMem (Rand, RandSize);
 }
 
 /**
@@ -14,6 +14,8 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/Tpm2CommandLib.h>
 #include <Library/Tpm2DeviceLib.h>
 #include <Library/RngLib.h>
+#include <Library/PcdLib.h>
+#include <Protocol/Tcg2Protocol.h>
 
 #include <Ppi/EndOfPeiPhase.h>
 
@@ -41,8 +43,8 @@ RdRandGenerateEntropy (
   UINT64      Seed[2];
   UINT8       *Ptr;
 
-  Status = EFI_NOT_READY;
-  BlockCount = Length / 64;
+  Status = (Length == 0) ? EFI_SUCCESS : EFI_NOT_READY;
+  BlockCount = Length / sizeof (Seed);
   Ptr = (UINT8 *)Entropy;
 
   //
@@ -53,24 +55,54 @@ RdRandGenerateEntropy (
     if (EFI_ERROR(Status)) {
       return Status;
     }
-    CopyMem(Ptr, Seed, 64);
+    CopyMem(Ptr, Seed, sizeof (Seed));
 
     BlockCount--;
-    Ptr = Ptr + 64;
+    Ptr = Ptr + sizeof (Seed);
   }
 
   //
-  // Populate the remained data as request.
+  // Populate the remained data as request, only when there is a partial block.
   //
-  Status = GetRandomNumber128(Seed);
-  if (EFI_ERROR(Status)) {
-    return Status;
+  if ((Length % sizeof (Seed)) != 0) {
+    Status = GetRandomNumber128(Seed);
+    if (EFI_ERROR(Status)) {
+      return Status;
+    }
+    CopyMem(Ptr, Seed, (Length % sizeof (Seed)));
   }
-  CopyMem(Ptr, Seed, (Length % 64));
 
+  ZeroMem(Seed, sizeof (Seed));
   return Status;
 }
 
+/**
+  Return the largest digest size of the PCR banks in a TPM2 hash mask.
+
+  @param[in]  HashMask     Bitmap of EFI_TCG2_BOOT_HASH_ALG_xxx.
+
+  @return The largest digest size, or 0 if HashMask has no known bank.
+**/
+UINT16
+GetAuthSizeFromHashMask (
+  IN UINT32  HashMask
+  )
+{
+  if ((HashMask & EFI_TCG2_BOOT_HASH_ALG_SHA512) != 0) {
+    return SHA512_DIGEST_SIZE;
+  }
+  if ((HashMask & EFI_TCG2_BOOT_HASH_ALG_SHA384) != 0) {
+    return SHA384_DIGEST_SIZE;
+  }
+  if ((HashMask & (EFI_TCG2_BOOT_HASH_ALG_SHA256 | EFI_TCG2_BOOT_HASH_ALG_SM3_256)) != 0) {
+    return SHA256_DIGEST_SIZE;
+  }
+  if ((HashMask & EFI_TCG2_BOOT_HASH_ALG_SHA1) != 0) {
+    return SHA1_DIGEST_SIZE;
+  }
+  return 0;
+}
+
 /**
   Set PlatformAuth to random value.
 **/
@@ -83,54 +115,59 @@ RandomizePlatformAuth (
   UINT16                            AuthSize;
   TPML_PCR_SELECTION                Pcrs;
   UINT32                            Index;
-  UINT8                             *Rand;
-  UINTN                             RandSize;
   TPM2B_AUTH                        NewPlatformAuth;
 
   //
   // Send Tpm2HierarchyChange Auth with random value to avoid PlatformAuth being null
   //
-  ZeroMem(&Pcrs, sizeof(TPML_PCR_SELECTION));
-  AuthSize = MAX_NEW_AUTHORIZATION_SIZE;
 
-  Status = Tpm2GetCapabilityPcrs(&Pcrs);
-  if (EFI_ERROR(Status)) {
-    DEBUG((EFI_D_ERROR, "Tpm2GetCapabilityPcrs fail!\n"));
-  } else {
-    for (Index = 0; Index < Pcrs.count; Index++) {
-      switch (Pcrs.pcrSelections[Index].hash) {
-      case TPM_ALG_SHA1:
-        AuthSize = SHA1_DIGEST_SIZE;
-        break;
-      case TPM_ALG_SHA256:
-        AuthSize = SHA256_DIGEST_SIZE;
-        break;
-      case TPM_ALG_SHA384:
-        AuthSize = SHA384_DIGEST_SIZE;
-        break;
-      case TPM_ALG_SHA512:
-        AuthSize = SHA512_DIGEST_SIZE;
-        break;
-      case TPM_ALG_SM3_256:
-        AuthSize = SM3_256_DIGEST_SIZE;
-        break;
+  //
+  // Tcg2Pei has already synced PcdTpm2HashMask with the active PCR banks, so
+  // size the auth from it rather than spending a command on a slow TPM.
+  //
+  AuthSize = GetAuthSizeFromHashMask (PcdGet32 (PcdTpm2HashMask));
+  if (AuthSize == 0) {
+    ZeroMem(&Pcrs, sizeof(TPML_PCR_SELECTION));
+    AuthSize = MAX_NEW_AUTHORIZATION_SIZE;
+
+    Status = Tpm2GetCapabilityPcrs(&Pcrs);
+    if (EFI_ERROR(Status)) {
+      DEBUG((EFI_D_ERROR, "Tpm2GetCapabilityPcrs fail!\n"));
+    } else {
+      for (Index = 0; Index < Pcrs.count; Index++) {
+        switch (Pcrs.pcrSelections[Index].hash) {
+        case TPM_ALG_SHA1:
+          AuthSize = SHA1_DIGEST_SIZE;
+          break;
+        case TPM_ALG_SHA256:
+          AuthSize = SHA256_DIGEST_SIZE;
+          break;
+        case TPM_ALG_SHA384:
+          AuthSize = SHA384_DIGEST_SIZE;
+          break;
+        case TPM_ALG_SHA512:
+          AuthSize = SHA512_DIGEST_SIZE;
+          break;
+        case TPM_ALG_SM3_256:
+          AuthSize = SM3_256_DIGEST_SIZE;
+          break;
+        }
       }
     }
   }
 
-  ZeroMem(NewPlatformAuth.buffer, AuthSize);
   NewPlatformAuth.size = AuthSize;
 
   //
-  // Allocate one buffer to store random data.
+  // Only AuthSize bytes are used, so generate exactly those, straight into
+  // the auth buffer.
   //
-  RandSize = MAX_NEW_AUTHORIZATION_SIZE;
-  Rand = AllocatePool(RandSize);
-
-  RdRandGenerateEntropy(RandSize, Rand);
-  CopyMem(NewPlatformAuth.buffer, Rand, AuthSize);
-
-  FreePool(Rand);
+  Status = RdRandGenerateEntropy(AuthSize, NewPlatformAuth.buffer);
+  if (EFI_ERROR(Status)) {
+    DEBUG((DEBUG_ERROR, "RdRandGenerateEntropy fail - %r\n", Status));
+    ZeroMem(NewPlatformAuth.buffer, AuthSize);
+    return;
+  }
 
   //
   // Send Tpm2HierarchyChangeAuth command with the new Auth value
@@ -138,7 +175,6 @@ RandomizePlatformAuth (
   Status = Tpm2HierarchyChangeAuth(TPM_RH_PLATFORM, NULL, &NewPlatformAuth);
   DEBUG((DEBUG_INFO, "Tpm2HierarchyChangeAuth Result: - %r\n", Status));
   ZeroMem(NewPlatformAuth.buffer, AuthSize);
-  ZeroMem(Rand, RandSize);
 }
 
 /**
@@ -0,0 +1,72 @@
+/** @file
+
+Copyright (c) 2020, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+#include <Library/TestPointCheckLib.h>
+#include <Library/DebugLib.h>
+#include <Library/BaseLib.h>
+#include <Library/TimerLib.h>
+#include <Library/PerformanceLib.h>
+
+/**
+  Get the time elapsed since the performance counter was started at reset.
+
+  @return The elapsed time in microseconds.
+**/
+UINT64
+TestPointGetBootTime (
+  VOID
+  )
+{
+  UINT64  CurrentTicks;
+  UINT64  StartValue;
+  UINT64  EndValue;
+  UINT64  Ticks;
+
+  CurrentTicks = GetPerformanceCounter ();
+  GetPerformanceCounterProperties (&StartValue, &EndValue);
+  if (EndValue >= StartValue) {
+    Ticks = CurrentTicks - StartValue;
+  } else {
+    Ticks = StartValue - CurrentTicks;
+  }
+
+  return DivU64x32 (GetTimeInNanoSecond (Ticks), 1000);
+}
+
+/**
+  Record the boot time of a test point and check it against its budget.
+
+  The time stamp is also logged as a performance event, so that it shows up
+  in the FPDT next to the other boot performance records.
+
+  @param[in]  TestPointName   The name of the test point, used as the event string.
+  @param[in]  BudgetInMs      The boot time budget in milliseconds. 0 means no budget.
+
+  @retval EFI_SUCCESS         The test point is reached within its budget.
+  @retval EFI_TIMEOUT         The test point is reached after its budget.
+**/
+EFI_STATUS
+TestPointCheckBootTime (
+  IN CONST CHAR8  *TestPointName,
+  IN UINT32       BudgetInMs
+  )
+{
+  UINT64  BootTime;
+
+  PERF_EVENT (TestPointName);
+
+  BootTime = TestPointGetBootTime ();
+  DEBUG ((DEBUG_INFO, "%a - BootTime: %ld us, Budget: %d ms\n", TestPointName, BootTime, BudgetInMs));
+
+  if ((BudgetInMs != 0) && (BootTime > MultU64x32 (BudgetInMs, 1000))) {
+    DEBUG ((DEBUG_ERROR, "%a - Boot time budget exceeded by %ld us\n", TestPointName, BootTime - MultU64x32 (BudgetInMs, 1000)));
+    return EFI_TIMEOUT;
+  }
+
+  return EFI_SUCCESS;
+}
@@ -152,6 +152,12 @@ TestPointGetAcpi (
   IN UINT32  Signature
   );
 
+EFI_STATUS
+TestPointCheckBootTime (
+  IN CONST CHAR8  *TestPointName,
+  IN UINT32       BudgetInMs
+  );
+
 GLOBAL_REMOVE_IF_UNREFERENCED ADAPTER_INFO_PLATFORM_TEST_POINT_STRUCT  mTestPointStruct = {
   PLATFORM_TEST_POINT_VERSION,
   PLATFORM_TEST_POINT_ROLE_PLATFORM_IBV,
@@ -350,6 +356,54 @@ TestPointEndOfDxeDmaProtectionEnabled (
   return EFI_SUCCESS;
 }
 
+/**
+  This service verifies the end of DXE is reached within the platform boot time budget.
+
+  Test subject: Boot performance.
+  Test overview: Compare the time elapsed since reset with PcdTestPointEndOfDxeTimeBudget.
+  Reporting mechanism: Set ADAPTER_INFO_PLATFORM_TEST_POINT_STRUCT.
+                       Records an FPDT performance event.
+                       Dumps the boot time to the debug log.
+
+  @retval EFI_SUCCESS         The test point check was performed successfully.
+  @retval EFI_UNSUPPORTED     The test point check is not supported on this platform.
+**/
+EFI_STATUS
+EFIAPI
+TestPointEndOfDxeBootTimeBudget (
+  VOID
+  )
+{
+  EFI_STATUS  Status;
+
+  if ((mFeatureImplemented[9] & TEST_POINT_BYTE9_END_OF_DXE_BOOT_TIME_BUDGET) == 0) {
+    return EFI_SUCCESS;
+  }
+
+  DEBUG ((DEBUG_INFO, "======== TestPointEndOfDxeBootTimeBudget - Enter\n"));
+
+  Status = TestPointCheckBootTime ("TestPointEndOfDxe", PcdGet32 (PcdTestPointEndOfDxeTimeBudget));
+  if (EFI_ERROR(Status)) {
+    TestPointLibAppendErrorString (
+      PLATFORM_TEST_POINT_ROLE_PLATFORM_IBV,
+      NULL,
+      TEST_POINT_BYTE9_END_OF_DXE_BOOT_TIME_BUDGET_ERROR_CODE \
+        TEST_POINT_END_OF_DXE \
+        TEST_POINT_BYTE9_END_OF_DXE_BOOT_TIME_BUDGET_ERROR_STRING
+      );
+  } else {
+    TestPointLibSetFeaturesVerified (
+      PLATFORM_TEST_POINT_ROLE_PLATFORM_IBV,
+      NULL,
+      9,
+      TEST_POINT_BYTE9_END_OF_DXE_BOOT_TIME_BUDGET
+      );
+  }
+
+  DEBUG ((DEBUG_INFO, "======== TestPointEndOfDxeBootTimeBudget - Exit\n"));
+  return EFI_SUCCESS;
+}
+
 /**
   This service verifies no 3rd party PCI option ROMs (OPROMs) were dispatched prior to the end of DXE.
 
@@ -1049,6 +1103,54 @@ TestPointReadyToBootEsrtTableFunctional (
   return EFI_SUCCESS;
 }
 
+/**
+  This service verifies ready to boot is reached within the platform boot time budget.
+
+  Test subject: Boot performance.
+  Test overview: Compare the time elapsed since reset with PcdTestPointReadyToBootTimeBudget.
+  Reporting mechanism: Set ADAPTER_INFO_PLATFORM_TEST_POINT_STRUCT.
+                       Records an FPDT performance event.
+                       Dumps the boot time to the debug log.
+
+  @retval EFI_SUCCESS         The test point check was performed successfully.
+  @retval EFI_UNSUPPORTED     The test point check is not supported on this platform.
+**/
+EFI_STATUS
+EFIAPI
+TestPointReadyToBootBootTimeBudget (
+  VOID
+  )
+{
+  EFI_STATUS  Status;
+
+  if ((mFeatureImplemented[9] & TEST_POINT_BYTE9_READY_TO_BOOT_BOOT_TIME_BUDGET) == 0) {
+    return EFI_SUCCESS;
+  }
+
+  DEBUG ((DEBUG_INFO, "======== TestPointReadyToBootBootTimeBudget - Enter\n"));
+
+  Status = TestPointCheckBootTime ("TestPointReadyToBoot", PcdGet32 (PcdTestPointReadyToBootTimeBudget));
+  if (EFI_ERROR(Status)) {
+    TestPointLibAppendErrorString (
+      PLATFORM_TEST_POINT_ROLE_PLATFORM_IBV,
+      NULL,
+      TEST_POINT_BYTE9_READY_TO_BOOT_BOOT_TIME_BUDGET_ERROR_CODE \
+        TEST_POINT_READY_TO_BOOT \
+        TEST_POINT_BYTE9_READY_TO_BOOT_BOOT_TIME_BUDGET_ERROR_STRING
+      );
+  } else {
+    TestPointLibSetFeaturesVerified (
+      PLATFORM_TEST_POINT_ROLE_PLATFORM_IBV,
+      NULL,
+      9,
+      TEST_POINT_BYTE9_READY_TO_BOOT_BOOT_TIME_BUDGET
+      );
+  }
+
+  DEBUG ((DEBUG_INFO, "======== TestPointReadyToBootBootTimeBudget - Exit\n"));
+  return EFI_SUCCESS;
+}
+
 /**
   This service verifies UEFI Secure Boot is enabled.
 
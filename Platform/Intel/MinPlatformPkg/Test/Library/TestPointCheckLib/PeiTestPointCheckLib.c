@@ -52,6 +52,12 @@ TestPointVtdEngine (
   VOID
   );
 
+EFI_STATUS
+TestPointCheckBootTime (
+  IN CONST CHAR8  *TestPointName,
+  IN UINT32       BudgetInMs
+  );
+
 GLOBAL_REMOVE_IF_UNREFERENCED ADAPTER_INFO_PLATFORM_TEST_POINT_STRUCT  mTestPointStruct = {
   PLATFORM_TEST_POINT_VERSION,
   PLATFORM_TEST_POINT_ROLE_PLATFORM_IBV,
@@ -469,6 +475,56 @@ TestPointEndOfPeiPciBusMasterDisabled (
   return EFI_SUCCESS;
 }
 
+/**
+  This service verifies the end of PEI is reached within the platform boot time budget.
+
+  Test subject: Boot performance.
+  Test overview: Compare the time elapsed since reset with PcdTestPointEndOfPeiTimeBudget.
+  Reporting mechanism: Set ADAPTER_INFO_PLATFORM_TEST_POINT_STRUCT.
+                       Records an FPDT performance event.
+                       Dumps the boot time to the debug log.
+
+  @retval EFI_SUCCESS         The test point check was performed successfully.
+  @retval EFI_UNSUPPORTED     The test point check is not supported on this platform.
+**/
+EFI_STATUS
+EFIAPI
+TestPointEndOfPeiBootTimeBudget (
+  VOID
+  )
+{
+  EFI_STATUS  Status;
+  UINT8       *FeatureImplemented;
+
+  FeatureImplemented = GetFeatureImplemented ();
+
+  if ((FeatureImplemented[9] & TEST_POINT_BYTE9_END_OF_PEI_BOOT_TIME_BUDGET) == 0) {
+    return EFI_SUCCESS;
+  }
+
+  DEBUG ((DEBUG_INFO, "======== TestPointEndOfPeiBootTimeBudget - Enter\n"));
+  Status = TestPointCheckBootTime ("TestPointEndOfPei", PcdGet32 (PcdTestPointEndOfPeiTimeBudget));
+  if (EFI_ERROR(Status)) {
+    TestPointLibAppendErrorString (
+      PLATFORM_TEST_POINT_ROLE_PLATFORM_IBV,
+      NULL,
+      TEST_POINT_BYTE9_END_OF_PEI_BOOT_TIME_BUDGET_ERROR_CODE \
+        TEST_POINT_END_OF_PEI \
+        TEST_POINT_BYTE9_END_OF_PEI_BOOT_TIME_BUDGET_ERROR_STRING
+      );
+  } else {
+    TestPointLibSetFeaturesVerified (
+      PLATFORM_TEST_POINT_ROLE_PLATFORM_IBV,
+      NULL,
+      9,
+      TEST_POINT_BYTE9_END_OF_PEI_BOOT_TIME_BUDGET
+      );
+  }
+
+  DEBUG ((DEBUG_INFO, "======== TestPointEndOfPeiBootTimeBudget - Exit\n"));
+  return EFI_SUCCESS;
+}
+
 /**
   Initialize feature data.
 
@@ -193,6 +193,27 @@ TestPointEndOfPeiPciBusMasterDisabled (
   return EFI_SUCCESS;
 }
 
+/**
+  This service verifies the end of PEI is reached within the platform boot time budget.
+
+  Test subject: Boot performance.
+  Test overview: Compare the time elapsed since reset with PcdTestPointEndOfPeiTimeBudget.
+  Reporting mechanism: Set ADAPTER_INFO_PLATFORM_TEST_POINT_STRUCT.
+                       Records an FPDT performance event.
+                       Dumps the boot time to the debug log.
+
+  @retval EFI_SUCCESS         The test point check was performed successfully.
+  @retval EFI_UNSUPPORTED     The test point check is not supported on this platform.
+**/
+EFI_STATUS
+EFIAPI
+TestPointEndOfPeiBootTimeBudget (
+  VOID
+  )
+{
+  return EFI_SUCCESS;
+}
+
 /**
   This service verifies bus master enable (BME) is disabled after PCI enumeration.
 
@@ -293,6 +314,27 @@ TestPointEndOfDxeDmaProtectionEnabled (
   return EFI_SUCCESS;
 }
 
+/**
+  This service verifies the end of DXE is reached within the platform boot time budget.
+
+  Test subject: Boot performance.
+  Test overview: Compare the time elapsed since reset with PcdTestPointEndOfDxeTimeBudget.
+  Reporting mechanism: Set ADAPTER_INFO_PLATFORM_TEST_POINT_STRUCT.
+                       Records an FPDT performance event.
+                       Dumps the boot time to the debug log.
+
+  @retval EFI_SUCCESS         The test point check was performed successfully.
+  @retval EFI_UNSUPPORTED     The test point check is not supported on this platform.
+**/
+EFI_STATUS
+EFIAPI
+TestPointEndOfDxeBootTimeBudget (
+  VOID
+  )
+{
+  return EFI_SUCCESS;
+}
+
 /**
   This service verifies the validity of System Management RAM (SMRAM) alignment at SMM Ready To Lock.
 
@@ -516,6 +558,27 @@ TestPointReadyToBootEsrtTableFunctional (
   return EFI_SUCCESS;
 }
 
+/**
+  This service verifies ready to boot is reached within the platform boot time budget.
+
+  Test subject: Boot performance.
+  Test overview: Compare the time elapsed since reset with PcdTestPointReadyToBootTimeBudget.
+  Reporting mechanism: Set ADAPTER_INFO_PLATFORM_TEST_POINT_STRUCT.
+                       Records an FPDT performance event.
+                       Dumps the boot time to the debug log.
+
+  @retval EFI_SUCCESS         The test point check was performed successfully.
+  @retval EFI_UNSUPPORTED     The test point check is not supported on this platform.
+**/
+EFI_STATUS
+EFIAPI
+TestPointReadyToBootBootTimeBudget (
+  VOID
+  )
+{
+  return EFI_SUCCESS;
+}
+
 /**
   This service verifies UEFI Secure Boot is enabled.
 
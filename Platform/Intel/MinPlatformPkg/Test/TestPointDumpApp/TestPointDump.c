@@ -14,6 +14,12 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/UefiLib.h>
 #include <Library/TestPointLib.h>
 #include <Protocol/AdapterInformation.h>
+#include <Protocol/LoadedImage.h>
+
+EFI_STATUS
+DumpTestPointCsv (
+  IN EFI_HANDLE  ImageHandle
+  );
 
 VOID
 DumpTestPoint (
@@ -166,7 +172,23 @@ TestPointDumpAppEntrypoint (
   IN EFI_SYSTEM_TABLE     *SystemTable
   )
 {
+  EFI_STATUS                 Status;
+  EFI_LOADED_IMAGE_PROTOCOL  *LoadedImage;
+
   DumpTestPointDataDxe (0, NULL);
 
+  //
+  // "-csv" also exports the test points and the boot performance records
+  // to a CSV file for offline tools.
+  //
+  Status = gBS->HandleProtocol (ImageHandle, &gEfiLoadedImageProtocolGuid, (VOID **)&LoadedImage);
+  if (!EFI_ERROR (Status) &&
+      (LoadedImage->LoadOptions != NULL) &&
+      (LoadedImage->LoadOptionsSize >= sizeof(CHAR16)) &&
+      (((CHAR16 *)LoadedImage->LoadOptions)[LoadedImage->LoadOptionsSize / sizeof(CHAR16) - 1] == 0) &&
+      (StrStr (LoadedImage->LoadOptions, L"-csv") != NULL)) {
+    DumpTestPointCsv (ImageHandle);
+  }
+
   return EFI_SUCCESS;
 }
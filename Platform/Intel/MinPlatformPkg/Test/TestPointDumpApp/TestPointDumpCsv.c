@@ -0,0 +1,409 @@
+/** @file
+  Export the test point tables and the FPDT boot performance records as CSV.
+
+Copyright (c) 2020, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <PiDxe.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/DebugLib.h>
+#include <Library/UefiLib.h>
+#include <Library/PrintLib.h>
+#include <Library/TestPointLib.h>
+#include <Protocol/AdapterInformation.h>
+#include <Protocol/LoadedImage.h>
+#include <Protocol/SimpleFileSystem.h>
+#include <Guid/Acpi.h>
+#include <Guid/ExtendedFirmwarePerformance.h>
+#include <IndustryStandard/Acpi.h>
+
+#define TEST_POINT_DUMP_CSV_FILE_NAME  L"\\TestPointDump.csv"
+#define TEST_POINT_DUMP_CSV_LINE_SIZE  0x200
+
+CHAR8  *mCsvBuffer     = NULL;
+UINTN  mCsvBufferSize  = 0;
+UINTN  mCsvBufferUsed  = 0;
+
+/**
+  Append a formatted line to the CSV buffer.
+
+  @param[in]  Format    ASCII format string.
+  @param[in]  ...       Variable argument list.
+**/
+VOID
+EFIAPI
+AppendCsv (
+  IN CONST CHAR8  *Format,
+  ...
+  )
+{
+  CHAR8    Line[TEST_POINT_DUMP_CSV_LINE_SIZE];
+  UINTN    LineSize;
+  VA_LIST  Marker;
+  CHAR8    *NewBuffer;
+  UINTN    NewBufferSize;
+
+  VA_START (Marker, Format);
+  LineSize = AsciiVSPrint (Line, sizeof(Line), Format, Marker);
+  VA_END (Marker);
+
+  if (mCsvBufferUsed + LineSize >= mCsvBufferSize) {
+    NewBufferSize = MAX (mCsvBufferSize * 2, mCsvBufferUsed + LineSize + EFI_PAGE_SIZE);
+    NewBuffer = ReallocatePool (mCsvBufferSize, NewBufferSize, mCsvBuffer);
+    if (NewBuffer == NULL) {
+      return ;
+    }
+    mCsvBuffer     = NewBuffer;
+    mCsvBufferSize = NewBufferSize;
+  }
+  CopyMem (mCsvBuffer + mCsvBufferUsed, Line, LineSize);
+  mCsvBufferUsed += LineSize;
+}
+
+/**
+  Append the test point tables published through the AIP to the CSV buffer.
+**/
+VOID
+AppendTestPointCsv (
+  VOID
+  )
+{
+  EFI_STATUS                        Status;
+  EFI_ADAPTER_INFORMATION_PROTOCOL  *Aip;
+  UINTN                             NoHandles;
+  EFI_HANDLE                        *Handles;
+  UINTN                             Index;
+  UINTN                             FeatureIndex;
+  VOID                              *InformationBlock;
+  UINTN                             InformationBlockSize;
+  ADAPTER_INFO_PLATFORM_TEST_POINT  *TestPoint;
+  UINT8                             *Features;
+  CHAR16                            *ErrorString;
+  CHAR16                            ErrorChar;
+
+  AppendCsv ("TestPoint,Role,ImplementationID,FeaturesImplemented,FeaturesVerified,ErrorString\n");
+
+  Status = gBS->LocateHandleBuffer (
+                  ByProtocol,
+                  &gEfiAdapterInformationProtocolGuid,
+                  NULL,
+                  &NoHandles,
+                  &Handles
+                  );
+  if (EFI_ERROR (Status)) {
+    return ;
+  }
+
+  for (Index = 0; Index < NoHandles; Index++) {
+    Status = gBS->HandleProtocol (
+                    Handles[Index],
+                    &gEfiAdapterInformationProtocolGuid,
+                    (VOID **)&Aip
+                    );
+    if (EFI_ERROR (Status)) {
+      continue;
+    }
+
+    Status = Aip->GetInformation (
+                    Aip,
+                    &gAdapterInfoPlatformTestPointGuid,
+                    &InformationBlock,
+                    &InformationBlockSize
+                    );
+    if (EFI_ERROR (Status)) {
+      continue;
+    }
+
+    TestPoint = InformationBlock;
+    AppendCsv ("TestPoint,0x%08x,\"%s\",", TestPoint->Role, TestPoint->ImplementationID);
+
+    Features = (UINT8 *)(TestPoint + 1);
+    for (FeatureIndex = 0; FeatureIndex < TestPoint->FeaturesSize; FeatureIndex++) {
+      AppendCsv ("%02x", Features[FeatureIndex]);
+    }
+    AppendCsv (",");
+    Features = (UINT8 *)(Features + TestPoint->FeaturesSize);
+    for (FeatureIndex = 0; FeatureIndex < TestPoint->FeaturesSize; FeatureIndex++) {
+      AppendCsv ("%02x", Features[FeatureIndex]);
+    }
+
+    //
+    // Error strings are separated by CRLF, keep them on one CSV line.
+    //
+    AppendCsv (",\"");
+    ErrorString = (CHAR16 *)(Features + TestPoint->FeaturesSize);
+    CopyMem (&ErrorChar, ErrorString, sizeof(ErrorChar));
+    for (; ErrorChar != 0;) {
+      if (ErrorChar == L'\n') {
+        AppendCsv (";");
+      } else if ((ErrorChar != L'\r') && (ErrorChar != L'"')) {
+        AppendCsv ("%c", ErrorChar);
+      }
+      ErrorString++;
+      CopyMem (&ErrorChar, ErrorString, sizeof(ErrorChar));
+    }
+    AppendCsv ("\"\n");
+
+    FreePool (InformationBlock);
+  }
+  FreePool (Handles);
+}
+
+/**
+  Find the FPDT in the XSDT.
+
+  @return The FPDT, or NULL if it is not found.
+**/
+EFI_ACPI_5_0_FIRMWARE_PERFORMANCE_DATA_TABLE_HEADER *
+GetFpdt (
+  VOID
+  )
+{
+  EFI_STATUS                                    Status;
+  EFI_ACPI_2_0_ROOT_SYSTEM_DESCRIPTION_POINTER  *Rsdp;
+  EFI_ACPI_DESCRIPTION_HEADER                   *Xsdt;
+  EFI_ACPI_DESCRIPTION_HEADER                   *Table;
+  UINTN                                         Index;
+  UINTN                                         Count;
+
+  Status = EfiGetSystemConfigurationTable (&gEfiAcpi20TableGuid, (VOID **)&Rsdp);
+  if (EFI_ERROR (Status) || (Rsdp == NULL) || (Rsdp->XsdtAddress == 0)) {
+    return NULL;
+  }
+
+  Xsdt  = (EFI_ACPI_DESCRIPTION_HEADER *)(UINTN)Rsdp->XsdtAddress;
+  Count = (Xsdt->Length - sizeof(EFI_ACPI_DESCRIPTION_HEADER)) / sizeof(UINT64);
+  for (Index = 0; Index < Count; Index++) {
+    Table = (EFI_ACPI_DESCRIPTION_HEADER *)(UINTN)ReadUnaligned64 ((UINT64 *)(Xsdt + 1) + Index);
+    if ((Table != NULL) && (Table->Signature == EFI_ACPI_5_0_FIRMWARE_PERFORMANCE_DATA_TABLE_SIGNATURE)) {
+      return (EFI_ACPI_5_0_FIRMWARE_PERFORMANCE_DATA_TABLE_HEADER *)Table;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Append an extended FPDT record to the CSV buffer.
+
+  All the extended records start with the FPDT_GUID_EVENT_RECORD fields.
+
+  @param[in]  Record        The extended FPDT record.
+  @param[in]  StringOffset  Offset of the ASCII name in the record, 0 if the record has no name.
+**/
+VOID
+AppendGuidEventCsv (
+  IN EFI_ACPI_5_0_FPDT_PERFORMANCE_RECORD_HEADER  *Record,
+  IN UINTN                                        StringOffset
+  )
+{
+  FPDT_GUID_EVENT_RECORD  *GuidEvent;
+  CHAR8                   *RecordString;
+  CHAR8                   Name[FPDT_STRING_EVENT_RECORD_NAME_LENGTH + 1];
+  UINTN                   Index;
+
+  if (Record->Length < sizeof(FPDT_GUID_EVENT_RECORD)) {
+    return ;
+  }
+  GuidEvent = (FPDT_GUID_EVENT_RECORD *)Record;
+
+  Index = 0;
+  if ((StringOffset != 0) && (Record->Length > StringOffset)) {
+    RecordString = (CHAR8 *)Record + StringOffset;
+    for (; (Index < Record->Length - StringOffset) && (Index < FPDT_STRING_EVENT_RECORD_NAME_LENGTH); Index++) {
+      if ((RecordString[Index] == 0) || (RecordString[Index] == '"')) {
+        break;
+      }
+      Name[Index] = RecordString[Index];
+    }
+  }
+  Name[Index] = 0;
+
+  AppendCsv (
+    "Record,0x%04x,0x%04x,%g,%ld,\"%a\"\n",
+    Record->Type,
+    GuidEvent->ProgressID,
+    &GuidEvent->Guid,
+    GuidEvent->Timestamp,
+    Name
+    );
+}
+
+/**
+  Append the records of the Firmware Basic Boot Performance Table to the CSV buffer.
+
+  The table holds the PEI, DXE and SMM boot performance records, including the
+  module dispatch start/end pairs and the test point events, with timestamps in
+  nanoseconds.
+**/
+VOID
+AppendBootPerformanceCsv (
+  VOID
+  )
+{
+  EFI_ACPI_5_0_FIRMWARE_PERFORMANCE_DATA_TABLE_HEADER        *Fpdt;
+  EFI_ACPI_5_0_FPDT_BOOT_PERFORMANCE_TABLE_POINTER_RECORD    *FbptPointer;
+  EFI_ACPI_5_0_FPDT_FIRMWARE_BASIC_BOOT_TABLE_HEADER         *Fbpt;
+  EFI_ACPI_5_0_FPDT_PERFORMANCE_RECORD_HEADER                *Record;
+  EFI_ACPI_5_0_FPDT_FIRMWARE_BASIC_BOOT_RECORD               *BasicBoot;
+  UINT8                                                      *RecordEnd;
+
+  Fpdt = GetFpdt ();
+  if (Fpdt == NULL) {
+    DEBUG ((DEBUG_INFO, "No FPDT\n"));
+    return ;
+  }
+
+  FbptPointer = (EFI_ACPI_5_0_FPDT_BOOT_PERFORMANCE_TABLE_POINTER_RECORD *)(Fpdt + 1);
+  if ((Fpdt->Header.Length < sizeof(*Fpdt) + sizeof(*FbptPointer)) ||
+      (FbptPointer->Header.Type != EFI_ACPI_5_0_FPDT_RECORD_TYPE_FIRMWARE_BASIC_BOOT_POINTER) ||
+      (FbptPointer->BootPerformanceTablePointer == 0)) {
+    return ;
+  }
+
+  Fbpt = (EFI_ACPI_5_0_FPDT_FIRMWARE_BASIC_BOOT_TABLE_HEADER *)(UINTN)FbptPointer->BootPerformanceTablePointer;
+  if (Fbpt->Signature != EFI_ACPI_5_0_FPDT_BOOT_PERFORMANCE_TABLE_SIGNATURE) {
+    return ;
+  }
+
+  AppendCsv ("Record,Type,ProgressID,Guid,Timestamp(ns),Name\n");
+
+  Record    = (EFI_ACPI_5_0_FPDT_PERFORMANCE_RECORD_HEADER *)(Fbpt + 1);
+  RecordEnd = (UINT8 *)Fbpt + Fbpt->Length;
+  while ((UINT8 *)Record + sizeof(*Record) <= RecordEnd) {
+    if ((Record->Length == 0) || ((UINT8 *)Record + Record->Length > RecordEnd)) {
+      break;
+    }
+
+    switch (Record->Type) {
+    case EFI_ACPI_5_0_FPDT_RUNTIME_RECORD_TYPE_FIRMWARE_BASIC_BOOT:
+      BasicBoot = (EFI_ACPI_5_0_FPDT_FIRMWARE_BASIC_BOOT_RECORD *)Record;
+      AppendCsv ("Record,0x%04x,,,%ld,ResetEnd\n", Record->Type, BasicBoot->ResetEnd);
+      AppendCsv ("Record,0x%04x,,,%ld,OsLoaderLoadImageStart\n", Record->Type, BasicBoot->OsLoaderLoadImageStart);
+      AppendCsv ("Record,0x%04x,,,%ld,OsLoaderStartImageStart\n", Record->Type, BasicBoot->OsLoaderStartImageStart);
+      AppendCsv ("Record,0x%04x,,,%ld,ExitBootServicesEntry\n", Record->Type, BasicBoot->ExitBootServicesEntry);
+      AppendCsv ("Record,0x%04x,,,%ld,ExitBootServicesExit\n", Record->Type, BasicBoot->ExitBootServicesExit);
+      break;
+
+    case FPDT_GUID_EVENT_TYPE:
+    case FPDT_GUID_QWORD_EVENT_TYPE:
+      AppendGuidEventCsv (Record, 0);
+      break;
+
+    case FPDT_DYNAMIC_STRING_EVENT_TYPE:
+      AppendGuidEventCsv (Record, OFFSET_OF (FPDT_DYNAMIC_STRING_EVENT_RECORD, String));
+      break;
+
+    case FPDT_DUAL_GUID_STRING_EVENT_TYPE:
+      AppendGuidEventCsv (Record, OFFSET_OF (FPDT_DUAL_GUID_STRING_EVENT_RECORD, String));
+      break;
+
+    case FPDT_GUID_QWORD_STRING_EVENT_TYPE:
+      AppendGuidEventCsv (Record, OFFSET_OF (FPDT_GUID_QWORD_STRING_EVENT_RECORD, String));
+      break;
+
+    default:
+      break;
+    }
+
+    Record = (EFI_ACPI_5_0_FPDT_PERFORMANCE_RECORD_HEADER *)((UINT8 *)Record + Record->Length);
+  }
+}
+
+/**
+  Write the CSV buffer to the root of the file system the application was loaded from.
+
+  @param[in]  ImageHandle   The image handle of this application.
+
+  @retval EFI_SUCCESS       The CSV file is written.
+  @retval others            The CSV file is not written.
+**/
+EFI_STATUS
+WriteCsvFile (
+  IN EFI_HANDLE  ImageHandle
+  )
+{
+  EFI_STATUS                       Status;
+  EFI_LOADED_IMAGE_PROTOCOL        *LoadedImage;
+  EFI_SIMPLE_FILE_SYSTEM_PROTOCOL  *FileSystem;
+  EFI_FILE_PROTOCOL                *Root;
+  EFI_FILE_PROTOCOL                *File;
+  UINTN                            Size;
+
+  Status = gBS->HandleProtocol (ImageHandle, &gEfiLoadedImageProtocolGuid, (VOID **)&LoadedImage);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+  Status = gBS->HandleProtocol (LoadedImage->DeviceHandle, &gEfiSimpleFileSystemProtocolGuid, (VOID **)&FileSystem);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+  Status = FileSystem->OpenVolume (FileSystem, &Root);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  //
+  // Delete the file of a previous run, so that no stale data is left at its end.
+  //
+  Status = Root->Open (Root, &File, TEST_POINT_DUMP_CSV_FILE_NAME, EFI_FILE_MODE_READ | EFI_FILE_MODE_WRITE, 0);
+  if (!EFI_ERROR (Status)) {
+    File->Delete (File);
+  }
+
+  Status = Root->Open (
+                   Root,
+                   &File,
+                   TEST_POINT_DUMP_CSV_FILE_NAME,
+                   EFI_FILE_MODE_READ | EFI_FILE_MODE_WRITE | EFI_FILE_MODE_CREATE,
+                   0
+                   );
+  if (!EFI_ERROR (Status)) {
+    Size = mCsvBufferUsed;
+    Status = File->Write (File, &Size, mCsvBuffer);
+    File->Close (File);
+  }
+  Root->Close (Root);
+
+  return Status;
+}
+
+/**
+  Export the test point tables and the boot performance records as CSV.
+
+  @param[in]  ImageHandle   The image handle of this application.
+
+  @retval EFI_SUCCESS       The CSV file is written.
+  @retval others            The CSV file is not written.
+**/
+EFI_STATUS
+DumpTestPointCsv (
+  IN EFI_HANDLE  ImageHandle
+  )
+{
+  EFI_STATUS  Status;
+
+  mCsvBufferUsed = 0;
+  AppendTestPointCsv ();
+  AppendBootPerformanceCsv ();
+  if (mCsvBuffer == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = WriteCsvFile (ImageHandle);
+  if (EFI_ERROR (Status)) {
+    Print (L"Failed to write %s - %r\n", TEST_POINT_DUMP_CSV_FILE_NAME, Status);
+  } else {
+    Print (L"Boot performance data written to %s\n", TEST_POINT_DUMP_CSV_FILE_NAME);
+  }
+
+  FreePool (mCsvBuffer);
+  mCsvBuffer     = NULL;
+  mCsvBufferSize = 0;
+  return Status;
+}
@@ -63,6 +63,9 @@ PlatformSecLibStartup (
   VOID
   )
 {
+  MTRR_MEMORY_RANGE  Ranges[2];
+  UINTN              ScratchSize;
+
   //
   // Process all library constructor functions linked to SecCore.
   // This function must be called before any library functions are called
@@ -72,20 +75,22 @@ PlatformSecLibStartup (
   //
   // Set write back cache attribute for SPI FLASH
   //
-  MtrrSetMemoryAttribute (
-    PcdGet32 (PcdFlashAreaBaseAddress),
-    PcdGet32 (PcdFlashAreaSize),
-    CacheWriteBack
-    );
+  Ranges[0].BaseAddress = PcdGet32 (PcdFlashAreaBaseAddress);
+  Ranges[0].Length      = PcdGet32 (PcdFlashAreaSize);
+  Ranges[0].Type        = CacheWriteBack;
 
   //
   // Set write back cache attribute for 512KB Embedded SRAM
   //
-  MtrrSetMemoryAttribute (
-    PcdGet32 (PcdEsramStage1Base),
-    SIZE_512KB,
-    CacheWriteBack
-    );
+  Ranges[1].BaseAddress = PcdGet32 (PcdEsramStage1Base);
+  Ranges[1].Length      = SIZE_512KB;
+  Ranges[1].Type        = CacheWriteBack;
+
+  //
+  // Program both in one MTRR update
+  //
+  ScratchSize = 0;
+  MtrrSetMemoryAttributesInMtrrSettings (NULL, NULL, &ScratchSize, Ranges, ARRAY_SIZE (Ranges));
 
   //
   // Pass control to SecCore module passing in the size of the temporary RAM in
@@ -23,6 +23,261 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 EFI_METRONOME_ARCH_PROTOCOL *mMetronome;
 EFI_CPU_IO2_PROTOCOL        *mCpuIo;
 
+STATIC
+BOOLEAN
+RootBridgeIoMemAddressValid (
+  IN PCI_ROOT_BRIDGE_INSTANCE  *PrivateData,
+  IN UINT64                    Address
+  )
+/*++
+
+Routine Description:
+
+  Check a memory mapped I/O address against the root bridge memory aperture.
+
+Arguments:
+
+  PrivateData  -  Root bridge instance the access is made through.
+  Address      -  Memory mapped I/O address to check.
+
+Returns:
+
+  TRUE   -  The address is inside the memory aperture limit.
+  FALSE  -  The address is beyond the memory aperture limit.
+
+--*/
+{
+  if (PrivateData->Aperture.Mem64Limit > PrivateData->Aperture.Mem64Base) {
+    return (BOOLEAN) (Address <= PrivateData->Aperture.Mem64Limit);
+  }
+
+  return (BOOLEAN) (Address <= PrivateData->Aperture.Mem32Limit);
+}
+
+STATIC
+BOOLEAN
+RootBridgeIoMmioDirectAccess (
+  IN EFI_PCI_ROOT_BRIDGE_IO_PROTOCOL_WIDTH  Width,
+  IN UINT64                                 Address,
+  IN UINTN                                  Count,
+  IN VOID                                   *Buffer
+  )
+/*++
+
+Routine Description:
+
+  Check whether a memory mapped I/O transfer can be done with direct MMIO
+  accesses instead of going through the CPU I/O protocol. Misaligned or
+  overflowing requests are left to the CPU I/O protocol so that they are
+  still rejected the same way.
+
+Arguments:
+
+  Width    -  Width of the memory operation, including the FIFO and Fill types.
+  Address  -  Base address of the memory operation.
+  Count    -  Number of memory operations to perform.
+  Buffer   -  Buffer the data is transferred from or to.
+
+Returns:
+
+  TRUE   -  The transfer can be done with direct MMIO accesses.
+  FALSE  -  The transfer has to go through the CPU I/O protocol.
+
+--*/
+{
+  UINTN   Size;
+  UINT64  Span;
+
+  if (Count == 0) {
+    return FALSE;
+  }
+
+  Size = (UINTN) 1 << (Width & 0x03);
+  if ((Address & (Size - 1)) != 0 || ((UINTN) Buffer & (Size - 1)) != 0) {
+    return FALSE;
+  }
+
+  Span = Size - 1;
+  if (Width < EfiPciWidthFifoUint8 || Width >= EfiPciWidthFillUint8) {
+    Span += MultU64x32 ((UINT64) (Count - 1), (UINT32) Size);
+  }
+
+  return (BOOLEAN) (Address <= (UINT64) MAX_ADDRESS &&
+                    Span <= (UINT64) MAX_ADDRESS - Address);
+}
+
+STATIC
+VOID
+RootBridgeIoMmioTransfer (
+  IN     BOOLEAN                                Write,
+  IN     EFI_PCI_ROOT_BRIDGE_IO_PROTOCOL_WIDTH  Width,
+  IN     UINT64                                 Address,
+  IN     UINTN                                  Count,
+  IN OUT VOID                                   *Buffer
+  )
+/*++
+
+Routine Description:
+
+  Move data between a buffer and memory mapped I/O space with direct MMIO
+  accesses of the base width. FIFO widths keep the MMIO address fixed and
+  Fill widths keep the buffer element fixed, as the CPU I/O protocol does.
+
+Arguments:
+
+  Write    -  TRUE to write Buffer to MMIO, FALSE to read MMIO into Buffer.
+  Width    -  Width of the memory operation, including the FIFO and Fill types.
+  Address  -  Base address of the memory operation.
+  Count    -  Number of memory operations to perform.
+  Buffer   -  Buffer the data is transferred from or to.
+
+Returns:
+
+  None.
+
+--*/
+{
+  UINTN  Size;
+  UINTN  AddressStride;
+  UINTN  BufferStride;
+  UINTN  MmioAddress;
+  UINT8  *Uint8Buffer;
+
+  Size          = (UINTN) 1 << (Width & 0x03);
+  AddressStride = (Width >= EfiPciWidthFifoUint8 && Width < EfiPciWidthFillUint8) ? 0 : Size;
+  BufferStride  = (Width >= EfiPciWidthFillUint8) ? 0 : Size;
+  MmioAddress   = (UINTN) Address;
+  Uint8Buffer   = (UINT8 *) Buffer;
+
+  if (Write) {
+    switch (Width & 0x03) {
+    case EfiPciWidthUint8:
+      for (; Count > 0; Count--, MmioAddress += AddressStride, Uint8Buffer += BufferStride) {
+        MmioWrite8 (MmioAddress, *Uint8Buffer);
+      }
+      break;
+    case EfiPciWidthUint16:
+      for (; Count > 0; Count--, MmioAddress += AddressStride, Uint8Buffer += BufferStride) {
+        MmioWrite16 (MmioAddress, *(UINT16 *) Uint8Buffer);
+      }
+      break;
+    default:
+      for (; Count > 0; Count--, MmioAddress += AddressStride, Uint8Buffer += BufferStride) {
+        MmioWrite32 (MmioAddress, *(UINT32 *) Uint8Buffer);
+      }
+      break;
+    }
+  } else {
+    switch (Width & 0x03) {
+    case EfiPciWidthUint8:
+      for (; Count > 0; Count--, MmioAddress += AddressStride, Uint8Buffer += BufferStride) {
+        *Uint8Buffer = MmioRead8 (MmioAddress);
+      }
+      break;
+    case EfiPciWidthUint16:
+      for (; Count > 0; Count--, MmioAddress += AddressStride, Uint8Buffer += BufferStride) {
+        *(UINT16 *) Uint8Buffer = MmioRead16 (MmioAddress);
+      }
+      break;
+    default:
+      for (; Count > 0; Count--, MmioAddress += AddressStride, Uint8Buffer += BufferStride) {
+        *(UINT32 *) Uint8Buffer = MmioRead32 (MmioAddress);
+      }
+      break;
+    }
+  }
+}
+
+STATIC
+VOID
+RootBridgeIoMmioCopy (
+  IN EFI_PCI_ROOT_BRIDGE_IO_PROTOCOL_WIDTH  Width,
+  IN UINTN                                  DestAddress,
+  IN UINTN                                  SrcAddress,
+  IN UINTN                                  Count
+  )
+/*++
+
+Routine Description:
+
+  Copy one memory mapped I/O region to another with direct MMIO accesses of
+  the given base width. Overlapping regions are copied in the direction that
+  keeps the source intact.
+
+Arguments:
+
+  Width        -  Base width of the memory operations.
+  DestAddress  -  Destination address, aligned to Width.
+  SrcAddress   -  Source address, aligned to Width.
+  Count        -  Number of memory operations to perform.
+
+Returns:
+
+  None.
+
+--*/
+{
+  INTN  Stride;
+
+  Stride = (INTN) 1 << Width;
+  if ((DestAddress > SrcAddress) && (DestAddress < SrcAddress + (Count << Width))) {
+    DestAddress += (Count - 1) << Width;
+    SrcAddress  += (Count - 1) << Width;
+    Stride       = -Stride;
+  }
+
+  switch (Width) {
+  case EfiPciWidthUint8:
+    for (; Count > 0; Count--, DestAddress += Stride, SrcAddress += Stride) {
+      MmioWrite8 (DestAddress, MmioRead8 (SrcAddress));
+    }
+    break;
+  case EfiPciWidthUint16:
+    for (; Count > 0; Count--, DestAddress += Stride, SrcAddress += Stride) {
+      MmioWrite16 (DestAddress, MmioRead16 (SrcAddress));
+    }
+    break;
+  default:
+    for (; Count > 0; Count--, DestAddress += Stride, SrcAddress += Stride) {
+      MmioWrite32 (DestAddress, MmioRead32 (SrcAddress));
+    }
+    break;
+  }
+}
+
+STATIC
+UINT64
+RootBridgeIoMmioReadValue (
+  IN EFI_PCI_ROOT_BRIDGE_IO_PROTOCOL_WIDTH  Width,
+  IN UINTN                                  Address
+  )
+/*++
+
+Routine Description:
+
+  Read one memory mapped I/O location of the given base width.
+
+Arguments:
+
+  Width    -  Base width of the memory operation.
+  Address  -  Address of the memory operation.
+
+Returns:
+
+  The value read, zero extended to 64 bits.
+
+--*/
+{
+  switch (Width) {
+  case EfiPciWidthUint8:
+    return MmioRead8 (Address);
+  case EfiPciWidthUint16:
+    return MmioRead16 (Address);
+  default:
+    return MmioRead32 (Address);
+  }
+}
+
 EFI_STATUS
 SimpleIioRootBridgeConstructor (
   IN EFI_PCI_ROOT_BRIDGE_IO_PROTOCOL       *Protocol,
@@ -185,8 +440,12 @@ Returns:
 --*/
 {
   EFI_STATUS  Status;
-  UINT64      NumberOfTicks;
-  UINT32       Remainder;
+  UINT64      Timeout;
+  UINT64      ElapsedTicks;
+  UINT64      Previous;
+  UINT64      Current;
+  UINT64      CounterStart;
+  UINT64      CounterEnd;
 
   if (Result == NULL) {
     return EFI_INVALID_PARAMETER;
@@ -196,7 +455,8 @@ Returns:
     return EFI_INVALID_PARAMETER;
   }
   //
-  // No matter what, always do a single poll.
+  // No matter what, always do a single poll. This also validates the
+  // address, so the rest of the polling can read the location directly.
   //
   Status = This->Mem.Read (
                       This,
@@ -215,46 +475,35 @@ Returns:
 
   if (Delay != 0) {
     //
-    // Determine the proper # of metronome ticks to wait for polling the
-    // location.  The nuber of ticks is Roundup (Delay / mMetronome->TickPeriod)+1
-    // The "+1" to account for the possibility of the first tick being short
-    // because we started in the middle of a tick.
-    //
-    // BugBug: overriding mMetronome->TickPeriod with UINT32 until Metronome
-    // protocol definition is updated.
+    // Spin on the location against a performance counter deadline instead
+    // of sleeping a whole metronome tick between reads, so the exit
+    // condition is seen as soon as the device sets it. Elapsed time is
+    // accumulated from counter deltas, which copes with counters that count
+    // down or wrap while polling.
     //
-    NumberOfTicks = DivU64x32Remainder (
-                      Delay,
-                      (UINT32) mMetronome->TickPeriod,
-                      &Remainder
-                      );
-    if (Remainder != 0) {
-      NumberOfTicks += 1;
-    }
-
-    NumberOfTicks += 1;
-
-    while (NumberOfTicks) {
-
-      mMetronome->WaitForTick (mMetronome, 1);
-
-      Status = This->Mem.Read (
-                          This,
-                          Width,
-                          Address,
-                          1,
-                          Result
-                          );
-      if (EFI_ERROR (Status)) {
-        return Status;
-      }
+    Timeout      = MultU64x32 (Delay, 100);
+    ElapsedTicks = 0;
+    GetPerformanceCounterProperties (&CounterStart, &CounterEnd);
+    Previous     = GetPerformanceCounter ();
 
+    do {
+      *Result = RootBridgeIoMmioReadValue (Width, (UINTN) Address);
       if ((*Result & Mask) == Value) {
         return EFI_SUCCESS;
       }
 
-      NumberOfTicks -= 1;
-    }
+      Current = GetPerformanceCounter ();
+      if (CounterStart < CounterEnd) {
+        ElapsedTicks += (Current >= Previous) ?
+                        Current - Previous :
+                        (CounterEnd - Previous) + (Current - CounterStart);
+      } else {
+        ElapsedTicks += (Previous >= Current) ?
+                        Previous - Current :
+                        (Previous - CounterEnd) + (CounterStart - Current);
+      }
+      Previous = Current;
+    } while (GetTimeInNanoSecond (ElapsedTicks) < Timeout);
   }
 
   return EFI_TIMEOUT;
@@ -420,14 +669,17 @@ Returns:
   //
   // Check memory access limit
   //
-  if (PrivateData->Aperture.Mem64Limit > PrivateData->Aperture.Mem64Base) {
-      if (Address > PrivateData->Aperture.Mem64Limit) {
-        return EFI_INVALID_PARAMETER;
-      }
-  } else {
-      if (Address > PrivateData->Aperture.Mem32Limit) {
-        return EFI_INVALID_PARAMETER;
-      }
+  if (!RootBridgeIoMemAddressValid (PrivateData, Address)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // Aligned transfers, FIFO and Fill included, are done with direct MMIO
+  // accesses so each element costs a single bus cycle.
+  //
+  if (RootBridgeIoMmioDirectAccess (Width, Address, Count, Buffer)) {
+    RootBridgeIoMmioTransfer (FALSE, Width, Address, Count, Buffer);
+    return EFI_SUCCESS;
   }
 
   return mCpuIo->Mem.Read (
@@ -490,14 +742,17 @@ Returns:
   //
   // Check memory access limit
   //
-  if (PrivateData->Aperture.Mem64Limit > PrivateData->Aperture.Mem64Base) {
-      if (Address > PrivateData->Aperture.Mem64Limit) {
-        return EFI_INVALID_PARAMETER;
-      }
-  } else {
-      if (Address > PrivateData->Aperture.Mem32Limit) {
-        return EFI_INVALID_PARAMETER;
-      }
+  if (!RootBridgeIoMemAddressValid (PrivateData, Address)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // Aligned transfers, FIFO and Fill included, are done with direct MMIO
+  // accesses so each element costs a single bus cycle.
+  //
+  if (RootBridgeIoMmioDirectAccess (Width, Address, Count, Buffer)) {
+    RootBridgeIoMmioTransfer (TRUE, Width, Address, Count, Buffer);
+    return EFI_SUCCESS;
   }
 
   return mCpuIo->Mem.Write (
@@ -694,11 +949,14 @@ Returns:
                             resources.
 --*/
 {
-  EFI_STATUS  Status;
-  BOOLEAN     Direction;
-  UINTN       Stride;
-  UINTN       Index;
-  UINT64      Result;
+  EFI_STATUS                             Status;
+  BOOLEAN                                Direction;
+  UINTN                                  Stride;
+  UINTN                                  Index;
+  UINT64                                 Result;
+  UINT64                                 Length;
+  EFI_PCI_ROOT_BRIDGE_IO_PROTOCOL_WIDTH  CopyWidth;
+  PCI_ROOT_BRIDGE_INSTANCE               *PrivateData;
 
   if (Width < 0 || Width > EfiPciWidthUint64) {
     return EFI_INVALID_PARAMETER;
@@ -708,6 +966,37 @@ Returns:
     return EFI_SUCCESS;
   }
 
+  //
+  // Copy with the widest MMIO access that the source, destination and length
+  // are all aligned to, and do it directly rather than issuing a Mem.Read and
+  // a Mem.Write per element. Requests that would wrap the address space take
+  // the element by element path below, which rejects them.
+  //
+  if (Width <= EfiPciWidthUint32 && Count != 0) {
+    Length    = LShiftU64 ((UINT64) Count, Width);
+    CopyWidth = EfiPciWidthUint32;
+    while (((DestAddress | SrcAddress | Length) & (LShiftU64 (1, CopyWidth) - 1)) != 0) {
+      CopyWidth--;
+    }
+
+    if (SrcAddress <= (UINT64) MAX_ADDRESS && Length - 1 <= (UINT64) MAX_ADDRESS - SrcAddress &&
+        DestAddress <= (UINT64) MAX_ADDRESS && Length - 1 <= (UINT64) MAX_ADDRESS - DestAddress) {
+      PrivateData = DRIVER_INSTANCE_FROM_PCI_ROOT_BRIDGE_IO_THIS (This);
+      if (!RootBridgeIoMemAddressValid (PrivateData, SrcAddress + Length - 1) ||
+          !RootBridgeIoMemAddressValid (PrivateData, DestAddress + Length - 1)) {
+        return EFI_INVALID_PARAMETER;
+      }
+
+      RootBridgeIoMmioCopy (
+        CopyWidth,
+        (UINTN) DestAddress,
+        (UINTN) SrcAddress,
+        (UINTN) RShiftU64 (Length, CopyWidth)
+        );
+      return EFI_SUCCESS;
+    }
+  }
+
   Stride    = (UINTN)1 << Width;
 
   Direction = TRUE;
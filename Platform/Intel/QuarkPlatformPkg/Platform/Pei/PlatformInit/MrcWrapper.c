@@ -259,6 +259,7 @@ MemoryInit (
   EFI_STATUS_CODE_VALUE                       ErrorCodeValue;
   PEI_QNC_MEMORY_INIT_PPI                     *QncMemoryInitPpi;
   UINT16                                      PmswAdr;
+  PEI_MEMORY_TEST_OP                          MemoryTestOp;
 
   ErrorCodeValue  = 0;
 
@@ -362,6 +363,12 @@ MemoryInit (
         MrcData.boot_mode = bmCold;
         break;
       }
+    } else if (MrcData.boot_mode == bmCold) {
+      //
+      // Restore the timings trained on a previous boot, MRC verifies them
+      // and falls back to full training if they no longer work.
+      //
+      MrcData.boot_mode = bmFast;
     }
   }
 
@@ -393,6 +400,13 @@ MemoryInit (
   // Mark MRC completed
   IoAnd32 (PmswAdr, ~(UINT32)B_QNC_GPE0BLK_PMSW_DRAM_INIT);
 
+  if (MrcData.status != MRC_SUCCESS) {
+    DEBUG ((EFI_D_ERROR, "MRC memory test failed.\n"));
+    REPORT_STATUS_CODE (
+      EFI_ERROR_CODE + EFI_ERROR_MAJOR,
+      EFI_COMPUTING_UNIT_MEMORY + EFI_CU_MEMORY_EC_UNCORRECTABLE
+    );
+  }
 
   //
   // Note emulation platform has to read actual memory size
@@ -419,24 +433,38 @@ MemoryInit (
   //
   DEBUG ((EFI_D_INFO, "InstallEfiMemory.\n"));
 
+  //
+  // After full training MRC has already run the HTE pattern test over all of
+  // memory, the CPU test is only needed when the timings were restored.
+  //
+  if (MrcData.boot_mode == bmCold) {
+    MemoryTestOp = Ignore;
+  } else {
+    MemoryTestOp = (PEI_MEMORY_TEST_OP) PcdGet8 (PcdMemoryTestOperation);
+  }
+
   Status = InstallEfiMemory (
              PeiServices,
              VariableServices,
              BootMode,
-             MrcData.mem_size
+             MrcData.mem_size,
+             MemoryTestOp
              );
   ASSERT_EFI_ERROR (Status);
 
   PostInstallMemory (&MrcData, FALSE);
 
   //
-  // Save current configuration into Hob and will save into Variable later in DXE
+  // Save current configuration into Hob and will save into Variable later in DXE.
+  // Timings only change when MRC did full training.
   //
-  DEBUG ((EFI_D_INFO, "SaveConfig.\n"));
-  Status = SaveConfig (
-             &MrcData
-             );
-  ASSERT_EFI_ERROR (Status);
+  if (MrcData.boot_mode == bmCold) {
+    DEBUG ((EFI_D_INFO, "SaveConfig.\n"));
+    Status = SaveConfig (
+               &MrcData
+               );
+    ASSERT_EFI_ERROR (Status);
+  }
 
   DEBUG ((EFI_D_INFO, "MemoryInit Complete.\n"));
 
@@ -522,6 +550,7 @@ LoadConfig (
   @param   BootMode       The specific boot path that is being followed
   @param   Mch            Pointer to the DualChannelDdrMemoryInit PPI
   @param   RowConfArray   Row configuration information for each row in the system.
+  @param   MemoryTestOp   Coverage of the CPU memory test of 1M->TOM.
 
   @return  EFI_SUCCESS            The function completed successfully.
            EFI_INVALID_PARAMETER  One of the input parameters was invalid.
@@ -533,7 +562,8 @@ InstallEfiMemory (
   IN      EFI_PEI_SERVICES                           **PeiServices,
   IN      EFI_PEI_READ_ONLY_VARIABLE2_PPI            *VariableServices,
   IN      EFI_BOOT_MODE                              BootMode,
-  IN      UINT32                                     TotalMemorySize
+  IN      UINT32                                     TotalMemorySize,
+  IN      PEI_MEMORY_TEST_OP                         MemoryTestOp
   )
 {
   EFI_PHYSICAL_ADDRESS                  PeiMemoryBaseAddress;
@@ -567,7 +597,7 @@ InstallEfiMemory (
               PeiServices,
               0x100000,
               (TotalMemorySize - 0x100000),
-              Quick,
+              MemoryTestOp,
               &BadMemoryAddress
               );
   ASSERT_EFI_ERROR (Status);
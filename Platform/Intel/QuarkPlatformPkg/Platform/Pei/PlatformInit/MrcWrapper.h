@@ -148,7 +148,8 @@ InstallEfiMemory (
   IN      EFI_PEI_SERVICES                           **PeiServices,
   IN      EFI_PEI_READ_ONLY_VARIABLE2_PPI            *VariableServices,
   IN      EFI_BOOT_MODE                              BootMode,
-  IN      UINT32                                     TotalMemorySize
+  IN      UINT32                                     TotalMemorySize,
+  IN      PEI_MEMORY_TEST_OP                         MemoryTestOp
   );
 
 EFI_STATUS
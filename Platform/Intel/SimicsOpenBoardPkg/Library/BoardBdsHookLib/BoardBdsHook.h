@@ -31,6 +31,7 @@
 #include <Library/UefiLib.h>
 #include <Library/DxeServicesTableLib.h>
 #include <Library/DevicePathLib.h>
+#include <Library/PrintLib.h>
 #include <Library/IoLib.h>
 #include <Library/NvVarsFileLib.h>
 #include <Library/BoardBdsHookLib.h>
@@ -37,6 +37,13 @@ EFI_EVENT     mEmuVariableEvent;
 BOOLEAN       mDetectVgaOnly;
 UINT16        mHostBridgeDevId;
 
+//
+// Boot options found before BdsBeforeConsoleAfterTrustedConsoleCallback
+// removed them; their devices are what PcdSimicsFastBootConnect connects.
+//
+EFI_BOOT_MANAGER_LOAD_OPTION  *mBootPathOptions;
+UINTN                         mBootPathOptionCount;
+
 //
 // Table of host IRQs matching PCI IRQs A-D
 // (for configuring PCI Interrupt Line register)
@@ -1224,6 +1231,100 @@ PlatformBdsRestoreNvVarsFromHardDisk (
     );
 }
 
+/**
+  Connect the device of a boot option that does not live in a firmware
+  volume.
+
+  @param[in]      Option     The boot option.
+  @param[in, out] Connected  Incremented when a device was connected.
+
+  @retval EFI_SUCCESS  The device was connected or no connect is needed.
+  @retval other        The device was not found.
+**/
+EFI_STATUS
+PlatformBdsConnectBootOption (
+  IN     EFI_BOOT_MANAGER_LOAD_OPTION  *Option,
+  IN OUT UINTN                         *Connected
+  )
+{
+  EFI_DEVICE_PATH_PROTOCOL  *Node;
+  EFI_STATUS                Status;
+
+  Node = Option->FilePath;
+  if ((DevicePathType (Node) == HARDWARE_DEVICE_PATH &&
+       DevicePathSubType (Node) == HW_MEMMAP_DP) ||
+      (DevicePathType (Node) == MEDIA_DEVICE_PATH &&
+       DevicePathSubType (Node) == MEDIA_PIWG_FW_VOL_DP)) {
+    return EFI_SUCCESS;
+  }
+
+  Status = EfiBootManagerConnectDevicePath (Node, NULL);
+  DEBUG ((DEBUG_INFO, "%a: Boot%04x %r\n", __FUNCTION__,
+    (UINT32) Option->OptionNumber, Status));
+  if (!EFI_ERROR (Status)) {
+    (*Connected)++;
+  }
+  return Status;
+}
+
+/**
+  Connect only the devices that BootNext and the BootOrder options of this
+  boot point to.
+
+  @retval TRUE   Every boot device was connected.
+  @retval FALSE  There was no boot device outside the firmware volumes or
+                 one of them is missing; the caller has to connect
+                 everything instead.
+**/
+BOOLEAN
+PlatformBdsConnectBootPaths (
+  VOID
+  )
+{
+  EFI_BOOT_MANAGER_LOAD_OPTION  BootNextOption;
+  CHAR16                        OptionName[sizeof ("Boot####")];
+  UINT16                        *BootNext;
+  UINTN                         Size;
+  UINTN                         Index;
+  UINTN                         Connected;
+  BOOLEAN                       Found;
+  EFI_STATUS                    Status;
+
+  Connected = 0;
+
+  //
+  // A BootNext option that is also in BootOrder has already been removed and
+  // is connected from mBootPathOptions below.
+  //
+  Status = GetEfiGlobalVariable2 (EFI_BOOT_NEXT_VARIABLE_NAME, (VOID **) &BootNext, &Size);
+  if (!EFI_ERROR (Status)) {
+    Found = FALSE;
+    if (Size == sizeof (UINT16)) {
+      UnicodeSPrint (OptionName, sizeof (OptionName), L"Boot%04x", *BootNext);
+      Found = !EFI_ERROR (EfiBootManagerVariableToLoadOption (OptionName, &BootNextOption));
+    }
+    FreePool (BootNext);
+    if (Found) {
+      Status = PlatformBdsConnectBootOption (&BootNextOption, &Connected);
+      EfiBootManagerFreeLoadOption (&BootNextOption);
+      if (EFI_ERROR (Status)) {
+        return FALSE;
+      }
+    }
+  }
+
+  for (Index = 0; Index < mBootPathOptionCount; Index++) {
+    if ((mBootPathOptions[Index].Attributes & LOAD_OPTION_ACTIVE) == 0) {
+      continue;
+    }
+    if (EFI_ERROR (PlatformBdsConnectBootOption (&mBootPathOptions[Index], &Connected))) {
+      return FALSE;
+    }
+  }
+
+  return Connected != 0;
+}
+
 /**
   Connect with predefined platform connect sequence.
 
@@ -1253,11 +1354,21 @@ PlatformBdsConnectSequence (
     Index++;
   }
 
-  //
-  // Just use the simple policy to connect all devices
-  //
-  DEBUG ((DEBUG_INFO, "EfiBootManagerConnectAll\n"));
-  EfiBootManagerConnectAll ();
+  if (FeaturePcdGet (PcdSimicsFastBootConnect) && PlatformBdsConnectBootPaths ()) {
+    DEBUG ((DEBUG_INFO, "Connected boot devices only\n"));
+  } else {
+    //
+    // Just use the simple policy to connect all devices
+    //
+    DEBUG ((DEBUG_INFO, "EfiBootManagerConnectAll\n"));
+    EfiBootManagerConnectAll ();
+  }
+
+  if (mBootPathOptions != NULL) {
+    EfiBootManagerFreeLoadOptions (mBootPathOptions, mBootPathOptionCount);
+    mBootPathOptions     = NULL;
+    mBootPathOptionCount = 0;
+  }
 
   PciAcpiInitialization ();
 }
@@ -1540,6 +1651,13 @@ BdsBeforeConsoleAfterTrustedConsoleCallback (
     }
   }
 
+  if (FeaturePcdGet (PcdSimicsFastBootConnect)) {
+    mBootPathOptions     = NvBootOptions;
+    mBootPathOptionCount = NvBootOptionCount;
+  } else {
+    EfiBootManagerFreeLoadOptions (NvBootOptions, NvBootOptionCount);
+  }
+
   InstallDevicePathCallback ();
 
   VisitAllInstancesOfProtocol (&gEfiPciRootBridgeIoProtocolGuid, ConnectRootBridge, NULL);
@@ -18,6 +18,7 @@
 #include <Library/PerformanceLib.h>
 #include <Library/BootLogoLib.h>
 #include <Library/BoardBootManagerLib.h>
+#include <Library/UefiBootManagerLib.h>
 
 /**
   This function is called each second during the boot manager waits the
@@ -56,6 +57,9 @@ BoardBootManagerWaitCallback (
   built into firmware volumes.
 
   If this function returns, BDS attempts to enter an infinite loop.
+
+  With PcdSimicsFastBootConnect only the boot devices were connected, so
+  connect everything, rebuild the boot options and try them once more.
 **/
 VOID
 EFIAPI
@@ -63,5 +67,28 @@ BoardBootManagerUnableToBoot (
   VOID
   )
 {
+  EFI_BOOT_MANAGER_LOAD_OPTION  *BootOptions;
+  UINTN                         BootOptionCount;
+  UINTN                         Index;
+
+  if (!FeaturePcdGet (PcdSimicsFastBootConnect)) {
+    return;
+  }
+
+  DEBUG ((DEBUG_INFO, "%a: connecting all devices\n", __FUNCTION__));
+  EfiBootManagerConnectAll ();
+  EfiBootManagerRefreshAllBootOption ();
 
+  BootOptions = EfiBootManagerGetLoadOptions (&BootOptionCount, LoadOptionTypeBoot);
+  for (Index = 0; Index < BootOptionCount; Index++) {
+    if ((BootOptions[Index].Attributes & LOAD_OPTION_ACTIVE) == 0 ||
+        (BootOptions[Index].Attributes & LOAD_OPTION_CATEGORY) != LOAD_OPTION_CATEGORY_BOOT) {
+      continue;
+    }
+    EfiBootManagerBoot (&BootOptions[Index]);
+    if (BootOptions[Index].Status == EFI_SUCCESS) {
+      break;
+    }
+  }
+  EfiBootManagerFreeLoadOptions (BootOptions, BootOptionCount);
 }
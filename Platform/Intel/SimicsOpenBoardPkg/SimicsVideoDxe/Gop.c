@@ -71,6 +71,144 @@ QemuVideoCompleteModeData (
   return EFI_SUCCESS;
 }
 
+/**
+  Mark scan lines of the shadow frame buffer as needing to be copied to VRAM.
+
+  @param  Private  The video device.
+  @param  Y        First scan line.
+  @param  Height   Number of scan lines.
+**/
+STATIC
+VOID
+QemuVideoMarkDirty (
+  IN  QEMU_VIDEO_PRIVATE_DATA  *Private,
+  IN  UINTN                    Y,
+  IN  UINTN                    Height
+  )
+{
+  if (Private->ShadowFrameBuffer == NULL) {
+    return;
+  }
+
+  for (; Height > 0; Y++, Height--) {
+    Private->DirtyLines[Y / 32] |= 1u << (Y % 32);
+  }
+}
+
+/**
+  Copy the dirty scan lines of the shadow frame buffer to VRAM, one copy per
+  contiguous run of dirty lines.
+
+  @param  Private  The video device.
+**/
+STATIC
+VOID
+QemuVideoFlush (
+  IN  QEMU_VIDEO_PRIVATE_DATA  *Private
+  )
+{
+  EFI_TPL  OriginalTPL;
+  UINTN    Lines;
+  UINTN    Y;
+  UINTN    Start;
+  UINT8    *FrameBuffer;
+
+  if (Private->ShadowFrameBuffer == NULL) {
+    return;
+  }
+
+  OriginalTPL = gBS->RaiseTPL (TPL_NOTIFY);
+
+  FrameBuffer = (UINT8 *) (UINTN) Private->GraphicsOutput.Mode->FrameBufferBase;
+  Lines = Private->GraphicsOutput.Mode->Info->VerticalResolution;
+  Y = 0;
+  while (Y < Lines) {
+    if (Private->DirtyLines[Y / 32] == 0) {
+      Y = (Y / 32 + 1) * 32;
+      continue;
+    }
+    if ((Private->DirtyLines[Y / 32] & (1u << (Y % 32))) == 0) {
+      Y++;
+      continue;
+    }
+
+    Start = Y;
+    while (Y < Lines && (Private->DirtyLines[Y / 32] & (1u << (Y % 32))) != 0) {
+      Private->DirtyLines[Y / 32] &= ~(1u << (Y % 32));
+      Y++;
+    }
+
+    CopyMem (
+      FrameBuffer + Start * Private->BytesPerScanLine,
+      Private->ShadowFrameBuffer + Start * Private->BytesPerScanLine,
+      (Y - Start) * Private->BytesPerScanLine
+      );
+  }
+
+  gBS->RestoreTPL (OriginalTPL);
+}
+
+/**
+  Timer and ExitBootServices notification: bring VRAM up to date with the
+  shadow frame buffer.
+
+  @param  Event    The event that fired.
+  @param  Context  The video device.
+**/
+STATIC
+VOID
+EFIAPI
+QemuVideoFlushNotify (
+  IN  EFI_EVENT  Event,
+  IN  VOID       *Context
+  )
+{
+  QemuVideoFlush ((QEMU_VIDEO_PRIVATE_DATA *) Context);
+}
+
+/**
+  Replace the shadow frame buffer with one sized for the current mode.
+  If it can't be allocated, Blt goes straight to VRAM.
+
+  @param  Private  The video device.
+**/
+STATIC
+VOID
+QemuVideoAllocateShadow (
+  IN  QEMU_VIDEO_PRIVATE_DATA  *Private
+  )
+{
+  EFI_GRAPHICS_OUTPUT_PROTOCOL_MODE  *Mode;
+
+  if (Private->ShadowFrameBuffer != NULL) {
+    FreePages (Private->ShadowFrameBuffer, Private->ShadowFrameBufferPages);
+    Private->ShadowFrameBuffer = NULL;
+  }
+  if (Private->DirtyLines != NULL) {
+    FreePool (Private->DirtyLines);
+    Private->DirtyLines = NULL;
+  }
+
+  Mode = Private->GraphicsOutput.Mode;
+  Private->BytesPerScanLine = Mode->Info->HorizontalResolution *
+    ((Private->ModeData[Mode->Mode].ColorDepth + 7) / 8);
+
+  Private->DirtyLines = AllocateZeroPool (
+                          (Mode->Info->VerticalResolution + 31) / 32 * sizeof (UINT32)
+                          );
+  if (Private->DirtyLines == NULL) {
+    return;
+  }
+
+  Private->ShadowFrameBufferPages = EFI_SIZE_TO_PAGES (Mode->FrameBufferSize);
+  Private->ShadowFrameBuffer = AllocatePages (Private->ShadowFrameBufferPages);
+  if (Private->ShadowFrameBuffer == NULL) {
+    DEBUG ((EFI_D_WARN, "No shadow frame buffer, Blt will write VRAM directly\n"));
+    FreePool (Private->DirtyLines);
+    Private->DirtyLines = NULL;
+  }
+}
+
 //
 // Graphics Output Protocol Member Functions
 //
@@ -163,6 +301,11 @@ Routine Description:
 
   ModeData = &Private->ModeData[ModeNumber];
 
+  //
+  // Don't lose anything that is still waiting to go out in the old mode.
+  //
+  QemuVideoFlush (Private);
+
   switch (Private->Variant) {
   case QEMU_VIDEO_CIRRUS_5430:
   case QEMU_VIDEO_CIRRUS_5446:
@@ -183,12 +326,15 @@ Routine Description:
   This->Mode->SizeOfInfo = sizeof(EFI_GRAPHICS_OUTPUT_MODE_INFORMATION);
 
   QemuVideoCompleteModeData (Private, This->Mode);
+  QemuVideoAllocateShadow (Private);
 
   //
   // Re-initialize the frame buffer configure when mode changes.
   //
   Status = FrameBufferBltConfigure (
-             (VOID*) (UINTN) This->Mode->FrameBufferBase,
+             (Private->ShadowFrameBuffer != NULL) ?
+               (VOID*) Private->ShadowFrameBuffer :
+               (VOID*) (UINTN) This->Mode->FrameBufferBase,
              This->Mode->Info,
              Private->FrameBufferBltConfigure,
              &Private->FrameBufferBltConfigureSize
@@ -208,7 +354,9 @@ Routine Description:
     // Create the configuration for FrameBufferBltLib
     //
     Status = FrameBufferBltConfigure (
-                (VOID*) (UINTN) This->Mode->FrameBufferBase,
+                (Private->ShadowFrameBuffer != NULL) ?
+                  (VOID*) Private->ShadowFrameBuffer :
+                  (VOID*) (UINTN) This->Mode->FrameBufferBase,
                 This->Mode->Info,
                 Private->FrameBufferBltConfigure,
                 &Private->FrameBufferBltConfigureSize
@@ -230,6 +378,8 @@ Routine Description:
              0
              );
   ASSERT_RETURN_ERROR (Status);
+  QemuVideoMarkDirty (Private, 0, This->Mode->Info->VerticalResolution);
+  QemuVideoFlush (Private);
 
   return EFI_SUCCESS;
 }
@@ -306,6 +456,9 @@ Returns:
       Height,
       Delta
       );
+    if (!EFI_ERROR (Status) && BltOperation != EfiBltVideoToBltBuffer) {
+      QemuVideoMarkDirty (Private, DestinationY, Height);
+    }
     break;
 
   default:
@@ -356,13 +509,42 @@ QemuVideoGraphicsOutputConstructor (
   Private->GraphicsOutput.Mode->Mode    = GRAPHICS_OUTPUT_INVALIDE_MODE_NUMBER;
   Private->FrameBufferBltConfigure      = NULL;
   Private->FrameBufferBltConfigureSize  = 0;
+  Private->ShadowFrameBuffer            = NULL;
+  Private->DirtyLines                   = NULL;
+
+  Status = gBS->CreateEvent (
+                  EVT_TIMER | EVT_NOTIFY_SIGNAL,
+                  TPL_CALLBACK,
+                  QemuVideoFlushNotify,
+                  Private,
+                  &Private->FlushEvent
+                  );
+  if (EFI_ERROR (Status)) {
+    goto FreeInfo;
+  }
+
+  Status = gBS->CreateEvent (
+                  EVT_SIGNAL_EXIT_BOOT_SERVICES,
+                  TPL_CALLBACK,
+                  QemuVideoFlushNotify,
+                  Private,
+                  &Private->ExitBootServicesEvent
+                  );
+  if (EFI_ERROR (Status)) {
+    goto CloseFlushEvent;
+  }
 
   //
   // Initialize the hardware
   //
   Status = GraphicsOutput->SetMode (GraphicsOutput, 0);
   if (EFI_ERROR (Status)) {
-    goto FreeInfo;
+    goto CloseExitBootServicesEvent;
+  }
+
+  Status = gBS->SetTimer (Private->FlushEvent, TimerPeriodic, QEMU_VIDEO_FLUSH_PERIOD);
+  if (EFI_ERROR (Status)) {
+    goto CloseExitBootServicesEvent;
   }
 
   DrawLogo (
@@ -373,7 +555,19 @@ QemuVideoGraphicsOutputConstructor (
 
   return EFI_SUCCESS;
 
+CloseExitBootServicesEvent:
+  gBS->CloseEvent (Private->ExitBootServicesEvent);
+
+CloseFlushEvent:
+  gBS->CloseEvent (Private->FlushEvent);
+
 FreeInfo:
+  if (Private->ShadowFrameBuffer != NULL) {
+    FreePages (Private->ShadowFrameBuffer, Private->ShadowFrameBufferPages);
+  }
+  if (Private->DirtyLines != NULL) {
+    FreePool (Private->DirtyLines);
+  }
   FreePool (Private->GraphicsOutput.Mode->Info);
 
 FreeMode:
@@ -399,6 +593,18 @@ Returns:
 
 --*/
 {
+  gBS->CloseEvent (Private->FlushEvent);
+  gBS->CloseEvent (Private->ExitBootServicesEvent);
+  QemuVideoFlush (Private);
+
+  if (Private->ShadowFrameBuffer != NULL) {
+    FreePages (Private->ShadowFrameBuffer, Private->ShadowFrameBufferPages);
+  }
+
+  if (Private->DirtyLines != NULL) {
+    FreePool (Private->DirtyLines);
+  }
+
   if (Private->FrameBufferBltConfigure != NULL) {
     FreePool (Private->FrameBufferBltConfigure);
   }
@@ -116,8 +116,27 @@ typedef struct {
   QEMU_VIDEO_VARIANT                    Variant;
   FRAME_BUFFER_CONFIGURE                *FrameBufferBltConfigure;
   UINTN                                 FrameBufferBltConfigureSize;
+
+  //
+  // Writes to emulated VRAM are expensive, so Blt works on a copy of the
+  // frame buffer in system memory. The scan lines it changes are marked in
+  // DirtyLines, and copied to VRAM in contiguous runs by FlushEvent, before
+  // a mode set and at ExitBootServices. ShadowFrameBuffer is NULL if the
+  // copy couldn't be allocated, and Blt then goes straight to VRAM.
+  //
+  UINT8                                 *ShadowFrameBuffer;
+  UINTN                                 ShadowFrameBufferPages;
+  UINT32                                *DirtyLines;
+  UINTN                                 BytesPerScanLine;
+  EFI_EVENT                             FlushEvent;
+  EFI_EVENT                             ExitBootServicesEvent;
 } QEMU_VIDEO_PRIVATE_DATA;
 
+//
+// How often dirty scan lines are copied from the shadow frame buffer to VRAM
+//
+#define QEMU_VIDEO_FLUSH_PERIOD  EFI_TIMER_PERIOD_MILLISECONDS (20)
+
 ///
 /// Card-specific Video Mode structures
 ///
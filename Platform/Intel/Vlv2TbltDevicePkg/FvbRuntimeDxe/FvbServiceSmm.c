@@ -14,9 +14,18 @@ Copyright (c) 2010 - 2014, Intel Corporation. All rights reserved.<BR>
 
 #include <PiSmm.h>
 #include <Library/SmmServicesTableLib.h>
+#include <Library/SmmMemLib.h>
 #include "FvbSmmCommon.h"
 #include "FvbService.h"
 
+#define SMM_FVB_MAX_INSTANCES  (sizeof (mPlatformFvBaseAddress) / sizeof (mPlatformFvBaseAddress[0]))
+
+//
+// The SMM FVB instances the communication buffer is allowed to name.
+//
+EFI_SMM_FIRMWARE_VOLUME_BLOCK_PROTOCOL  *mSmmFvbInstances[SMM_FVB_MAX_INSTANCES];
+UINTN                                   mSmmFvbInstanceCount = 0;
+
 /**
   The function installs EFI_SMM_FIRMWARE_VOLUME_BLOCK protocol
   for each FV in the system.
@@ -79,6 +88,10 @@ InstallFvbProtocol (
                     );
   ASSERT_EFI_ERROR (Status);
 
+  if (mSmmFvbInstanceCount < SMM_FVB_MAX_INSTANCES) {
+    mSmmFvbInstances[mSmmFvbInstanceCount++] = &FvbDevice->FwVolBlockInstance;
+  }
+
   Status = gSmst->SmmInstallProtocolInterface (
                     &FvbHandle,
                     &gEfiDevicePathProtocolGuid,
@@ -100,6 +113,249 @@ InstallFvbProtocol (
 }
 
 
+/**
+  Check that an SMM FVB pointer from the communication buffer is one of ours.
+
+  @param[in]  SmmFvb        The pointer to check.
+
+  @retval     TRUE          SmmFvb is an instance installed by this driver.
+  @retval     FALSE         SmmFvb is unknown.
+
+**/
+BOOLEAN
+IsSmmFvbValid (
+  IN  EFI_SMM_FIRMWARE_VOLUME_BLOCK_PROTOCOL  *SmmFvb
+  )
+{
+  UINTN                                       Index;
+
+  for (Index = 0; Index < mSmmFvbInstanceCount; Index++) {
+    if (mSmmFvbInstances[Index] == SmmFvb) {
+      return TRUE;
+    }
+  }
+  return FALSE;
+}
+
+
+/**
+  Run one FVB function from the communication buffer.
+
+  @param[in]      Function      The EFI_FUNCTION_* code.
+  @param[in, out] Data          The function payload.
+  @param[in]      DataSize      The size of the payload in bytes.
+  @param[in]      AllowBatch    Whether EFI_FUNCTION_BATCH is accepted.
+
+  @retval         EFI_INVALID_PARAMETER  The payload is malformed.
+  @retval         EFI_UNSUPPORTED        The function is unknown.
+  @retval         Others                 The status of the FVB function.
+
+**/
+EFI_STATUS
+SmmFvbDispatch (
+  IN      UINTN                                 Function,
+  IN OUT  VOID                                  *Data,
+  IN      UINTN                                 DataSize,
+  IN      BOOLEAN                               AllowBatch
+  )
+{
+  EFI_STATUS                                    Status;
+  EFI_SMM_FIRMWARE_VOLUME_BLOCK_PROTOCOL        *SmmFvb;
+  SMM_FVB_ATTRIBUTES_HEADER                     *AttributesHeader;
+  SMM_FVB_PHYSICAL_ADDRESS_HEADER               *PhysicalAddressHeader;
+  SMM_FVB_BLOCK_SIZE_HEADER                     *BlockSizeHeader;
+  SMM_FVB_READ_WRITE_HEADER                     *ReadWriteHeader;
+  SMM_FVB_BLOCKS_HEADER                         *BlocksHeader;
+  SMM_FVB_BATCH_HEADER                          *BatchHeader;
+  SMM_FVB_BATCH_ENTRY_HEADER                    *Entry;
+  UINTN                                         Count;
+  UINTN                                         Index;
+  UINTN                                         EntrySize;
+  UINTN                                         NumBytes;
+
+  switch (Function) {
+  case EFI_FUNCTION_GET_ATTRIBUTES:
+  case EFI_FUNCTION_SET_ATTRIBUTES:
+    if (DataSize < sizeof (SMM_FVB_ATTRIBUTES_HEADER)) {
+      return EFI_INVALID_PARAMETER;
+    }
+    AttributesHeader = (SMM_FVB_ATTRIBUTES_HEADER *) Data;
+    SmmFvb = AttributesHeader->SmmFvb;
+    if (!IsSmmFvbValid (SmmFvb)) {
+      return EFI_INVALID_PARAMETER;
+    }
+    if (Function == EFI_FUNCTION_GET_ATTRIBUTES) {
+      return SmmFvb->GetAttributes (SmmFvb, &AttributesHeader->Attributes);
+    }
+    return SmmFvb->SetAttributes (SmmFvb, &AttributesHeader->Attributes);
+
+  case EFI_FUNCTION_GET_PHYSICAL_ADDRESS:
+    if (DataSize < sizeof (SMM_FVB_PHYSICAL_ADDRESS_HEADER)) {
+      return EFI_INVALID_PARAMETER;
+    }
+    PhysicalAddressHeader = (SMM_FVB_PHYSICAL_ADDRESS_HEADER *) Data;
+    SmmFvb = PhysicalAddressHeader->SmmFvb;
+    if (!IsSmmFvbValid (SmmFvb)) {
+      return EFI_INVALID_PARAMETER;
+    }
+    return SmmFvb->GetPhysicalAddress (SmmFvb, &PhysicalAddressHeader->Address);
+
+  case EFI_FUNCTION_GET_BLOCK_SIZE:
+    if (DataSize < sizeof (SMM_FVB_BLOCK_SIZE_HEADER)) {
+      return EFI_INVALID_PARAMETER;
+    }
+    BlockSizeHeader = (SMM_FVB_BLOCK_SIZE_HEADER *) Data;
+    SmmFvb = BlockSizeHeader->SmmFvb;
+    if (!IsSmmFvbValid (SmmFvb)) {
+      return EFI_INVALID_PARAMETER;
+    }
+    return SmmFvb->GetBlockSize (
+                     SmmFvb,
+                     BlockSizeHeader->Lba,
+                     &BlockSizeHeader->BlockSize,
+                     &BlockSizeHeader->NumOfBlocks
+                     );
+
+  case EFI_FUNCTION_READ:
+  case EFI_FUNCTION_WRITE:
+    if (DataSize < sizeof (SMM_FVB_READ_WRITE_HEADER)) {
+      return EFI_INVALID_PARAMETER;
+    }
+    ReadWriteHeader = (SMM_FVB_READ_WRITE_HEADER *) Data;
+    SmmFvb   = ReadWriteHeader->SmmFvb;
+    NumBytes = ReadWriteHeader->NumBytes;
+    if (!IsSmmFvbValid (SmmFvb) ||
+        (NumBytes > DataSize - sizeof (SMM_FVB_READ_WRITE_HEADER))) {
+      return EFI_INVALID_PARAMETER;
+    }
+    if (Function == EFI_FUNCTION_READ) {
+      Status = SmmFvb->Read (
+                         SmmFvb,
+                         ReadWriteHeader->Lba,
+                         ReadWriteHeader->Offset,
+                         &NumBytes,
+                         (UINT8 *) (ReadWriteHeader + 1)
+                         );
+    } else {
+      Status = SmmFvb->Write (
+                         SmmFvb,
+                         ReadWriteHeader->Lba,
+                         ReadWriteHeader->Offset,
+                         &NumBytes,
+                         (UINT8 *) (ReadWriteHeader + 1)
+                         );
+    }
+    ReadWriteHeader->NumBytes = NumBytes;
+    return Status;
+
+  case EFI_FUNCTION_ERASE_BLOCKS:
+    if (DataSize < sizeof (SMM_FVB_BLOCKS_HEADER)) {
+      return EFI_INVALID_PARAMETER;
+    }
+    BlocksHeader = (SMM_FVB_BLOCKS_HEADER *) Data;
+    SmmFvb = BlocksHeader->SmmFvb;
+    if (!IsSmmFvbValid (SmmFvb)) {
+      return EFI_INVALID_PARAMETER;
+    }
+    return SmmFvb->EraseBlocks (
+                     SmmFvb,
+                     BlocksHeader->StartLba,
+                     BlocksHeader->NumOfLba,
+                     EFI_LBA_LIST_TERMINATOR
+                     );
+
+  case EFI_FUNCTION_BATCH:
+    if (!AllowBatch || (DataSize < sizeof (SMM_FVB_BATCH_HEADER))) {
+      return EFI_INVALID_PARAMETER;
+    }
+    BatchHeader = (SMM_FVB_BATCH_HEADER *) Data;
+    Count    = BatchHeader->Count;
+    Entry    = (SMM_FVB_BATCH_ENTRY_HEADER *) (BatchHeader + 1);
+    DataSize -= sizeof (SMM_FVB_BATCH_HEADER);
+
+    for (Index = 0; Index < Count; Index++) {
+      if (DataSize < sizeof (SMM_FVB_BATCH_ENTRY_HEADER)) {
+        return EFI_INVALID_PARAMETER;
+      }
+      EntrySize = Entry->Size;
+      if ((EntrySize > DataSize - sizeof (SMM_FVB_BATCH_ENTRY_HEADER)) ||
+          (SMM_FVB_BATCH_ENTRY_SIZE (EntrySize) > DataSize)) {
+        return EFI_INVALID_PARAMETER;
+      }
+
+      Status = SmmFvbDispatch (Entry->Function, Entry + 1, EntrySize, FALSE);
+      Entry->ReturnStatus = Status;
+      if (EFI_ERROR (Status)) {
+        return Status;
+      }
+
+      DataSize -= SMM_FVB_BATCH_ENTRY_SIZE (EntrySize);
+      Entry = (SMM_FVB_BATCH_ENTRY_HEADER *) ((UINT8 *) Entry + SMM_FVB_BATCH_ENTRY_SIZE (EntrySize));
+    }
+    return EFI_SUCCESS;
+
+  default:
+    return EFI_UNSUPPORTED;
+  }
+}
+
+
+/**
+  Communication service SMI Handler entry.
+
+  This SMI handler provides services for the FVB wrapper driver, which
+  forwards the FVB protocol calls of non-SMM code to SMM.
+
+  @param[in]      DispatchHandle    The unique handle assigned to this handler by SmiHandlerRegister().
+  @param[in]      RegisterContext   Points to an optional handler context which was specified when the
+                                    handler was registered.
+  @param[in, out] CommBuffer        A pointer to a collection of data in memory that will
+                                    be conveyed from a non-SMM environment into an SMM environment.
+  @param[in, out] CommBufferSize    The size of the CommBuffer.
+
+  @retval         EFI_SUCCESS       The interrupt was handled and quiesced. No other handlers
+                                    should still be called.
+
+**/
+EFI_STATUS
+EFIAPI
+SmmFvbHandler (
+  IN     EFI_HANDLE                             DispatchHandle,
+  IN     CONST VOID                             *RegisterContext,
+  IN OUT VOID                                   *CommBuffer,
+  IN OUT UINTN                                  *CommBufferSize
+  )
+{
+  SMM_FVB_COMMUNICATE_FUNCTION_HEADER           *SmmFvbFunctionHeader;
+  UINTN                                         CommSize;
+
+  if ((CommBuffer == NULL) || (CommBufferSize == NULL)) {
+    return EFI_SUCCESS;
+  }
+
+  CommSize = *CommBufferSize;
+  if (CommSize < SMM_FVB_COMMUNICATE_HEADER_SIZE) {
+    DEBUG ((EFI_D_ERROR, "SmmFvbHandler: SMM communication buffer size invalid!\n"));
+    return EFI_SUCCESS;
+  }
+
+  if (!SmmIsBufferOutsideSmmValid ((UINTN) CommBuffer, CommSize)) {
+    DEBUG ((EFI_D_ERROR, "SmmFvbHandler: SMM communication buffer in SMRAM or overflow!\n"));
+    return EFI_SUCCESS;
+  }
+
+  SmmFvbFunctionHeader = (SMM_FVB_COMMUNICATE_FUNCTION_HEADER *) CommBuffer;
+  SmmFvbFunctionHeader->ReturnStatus = SmmFvbDispatch (
+                                         SmmFvbFunctionHeader->Function,
+                                         SmmFvbFunctionHeader->Data,
+                                         CommSize - SMM_FVB_COMMUNICATE_HEADER_SIZE,
+                                         TRUE
+                                         );
+
+  return EFI_SUCCESS;
+}
+
+
 /**
   The driver entry point for SMM Firmware Volume Block Driver.
 
@@ -120,8 +376,22 @@ FvbSmmInitialize (
   IN EFI_SYSTEM_TABLE   *SystemTable
   )
 {
+  EFI_STATUS            Status;
+  EFI_HANDLE            SmmFvbHandle;
+
   FvbInitialize ();
 
+  //
+  // Register the SMI handler the FVB wrapper driver talks to.
+  //
+  SmmFvbHandle = NULL;
+  Status = gSmst->SmiHandlerRegister (
+                    SmmFvbHandler,
+                    &gEfiSmmFirmwareVolumeBlockProtocolGuid,
+                    &SmmFvbHandle
+                    );
+  ASSERT_EFI_ERROR (Status);
+
   return EFI_SUCCESS;
 }
 
@@ -22,6 +22,7 @@ Copyright (c) 2010 - 2014, Intel Corporation. All rights reserved. <BR>
 #define EFI_FUNCTION_READ                     5
 #define EFI_FUNCTION_WRITE                    6
 #define EFI_FUNCTION_ERASE_BLOCKS             7
+#define EFI_FUNCTION_BATCH                    8
 
 typedef struct {
   UINTN       Function;
@@ -70,4 +71,26 @@ typedef struct {
   UINTN                                      NumOfLba;
 } SMM_FVB_BLOCKS_HEADER;
 
+///
+/// EFI_FUNCTION_BATCH payload: Count entries follow the header back to back,
+/// each one an entry header and the payload of a single FVB function. SMM
+/// runs them in order in one SMI and stops at the first failure; entries not
+/// run keep the ReturnStatus the caller put in.
+///
+typedef struct {
+  UINTN                                      Count;
+} SMM_FVB_BATCH_HEADER;
+
+typedef struct {
+  UINTN                                      Function;
+  EFI_STATUS                                 ReturnStatus;
+  UINTN                                      Size;
+} SMM_FVB_BATCH_ENTRY_HEADER;
+
+///
+/// Size of one batch entry with a payload of PayloadSize bytes.
+///
+#define SMM_FVB_BATCH_ENTRY_SIZE(PayloadSize) \
+          ALIGN_VALUE (sizeof (SMM_FVB_BATCH_ENTRY_HEADER) + (PayloadSize), sizeof (UINT64))
+
 #endif
@@ -158,6 +158,40 @@ SendCommunicateBuffer (
   return  SmmFvbFunctionHeader->ReturnStatus;
 }
 
+
+/**
+  Append one FVB function to a batch being built in a communicate buffer.
+
+  @param[in, out]  BatchHeader       The batch header in the communicate buffer.
+  @param[in, out]  NextEntry         On input, where to put the entry. On output,
+                                     where the next entry goes.
+  @param[in]       Function          The function number of the entry.
+  @param[in]       PayloadSize       The payload size of the entry.
+
+  @return          A pointer to the entry payload for the caller to fill in.
+
+**/
+VOID *
+AddBatchEntry (
+  IN OUT  SMM_FVB_BATCH_HEADER              *BatchHeader,
+  IN OUT  SMM_FVB_BATCH_ENTRY_HEADER        **NextEntry,
+  IN      UINTN                             Function,
+  IN      UINTN                             PayloadSize
+  )
+{
+  SMM_FVB_BATCH_ENTRY_HEADER                *Entry;
+
+  Entry = *NextEntry;
+  Entry->Function     = Function;
+  Entry->ReturnStatus = EFI_NOT_STARTED;
+  Entry->Size         = PayloadSize;
+
+  BatchHeader->Count++;
+  *NextEntry = (SMM_FVB_BATCH_ENTRY_HEADER *) ((UINT8 *) Entry + SMM_FVB_BATCH_ENTRY_SIZE (PayloadSize));
+
+  return Entry + 1;
+}
+
 /**
   This function retrieves the attributes and current settings of the block.
 
@@ -707,8 +741,16 @@ FvbEraseBlocks (
   VA_LIST                                        Marker;
   EFI_LBA                                        StartingLba;
   UINTN                                          NumOfLba;
+  UINTN                                          RangeCount;
+  UINTN                                          PayloadSize;
+  EFI_SMM_COMMUNICATE_HEADER                     *SmmCommunicateHeader;
+  SMM_FVB_BATCH_HEADER                           *SmmFvbBatchHeader;
+  SMM_FVB_BATCH_ENTRY_HEADER                     *SmmFvbBatchEntry;
+  SMM_FVB_BLOCKS_HEADER                          *SmmFvbBlocksHeader;
+  EFI_FVB_DEVICE                                 *FvbDevice;
 
-  Status = EFI_SUCCESS;
+  Status     = EFI_SUCCESS;
+  RangeCount = 0;
 
   //
   // Check the parameter.
@@ -725,12 +767,41 @@ FvbEraseBlocks (
       return EFI_INVALID_PARAMETER;
     }
 
+    RangeCount++;
   } while ( 1 );
   VA_END (Marker);
 
+  if (RangeCount == 0) {
+    return EFI_SUCCESS;
+  }
+
+  if (RangeCount == 1) {
+    VA_START (Marker, This);
+    StartingLba = VA_ARG (Marker, EFI_LBA);
+    NumOfLba    = VA_ARG (Marker, UINTN);
+    VA_END (Marker);
+
+    return EraseBlock (This, StartingLba, NumOfLba);
+  }
+
   //
-  // Erase the blocks.
+  // Erase all of the ranges in one SMI, in list order.
   //
+  FvbDevice   = FVB_DEVICE_FROM_THIS (This);
+  PayloadSize = sizeof (SMM_FVB_BATCH_HEADER) + RangeCount * SMM_FVB_BATCH_ENTRY_SIZE (sizeof (SMM_FVB_BLOCKS_HEADER));
+  Status = InitCommunicateBuffer (
+             (VOID **)&SmmCommunicateHeader,
+             (VOID **)&SmmFvbBatchHeader,
+             PayloadSize,
+             EFI_FUNCTION_BATCH
+             );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  SmmFvbBatchHeader->Count = 0;
+  SmmFvbBatchEntry = (SMM_FVB_BATCH_ENTRY_HEADER *) (SmmFvbBatchHeader + 1);
+
   VA_START (Marker, This);
   do {
     StartingLba = VA_ARG (Marker, EFI_LBA);
@@ -738,13 +809,26 @@ FvbEraseBlocks (
       break;
     }
     NumOfLba = VA_ARG (Marker, UINTN);
-    Status = EraseBlock (This, StartingLba, NumOfLba);
-    if (EFI_ERROR (Status)) {
-      break;
-    }
+
+    SmmFvbBlocksHeader = AddBatchEntry (
+                           SmmFvbBatchHeader,
+                           &SmmFvbBatchEntry,
+                           EFI_FUNCTION_ERASE_BLOCKS,
+                           sizeof (SMM_FVB_BLOCKS_HEADER)
+                           );
+    SmmFvbBlocksHeader->SmmFvb   = FvbDevice->SmmFvbInstance;
+    SmmFvbBlocksHeader->StartLba = StartingLba;
+    SmmFvbBlocksHeader->NumOfLba = NumOfLba;
   } while ( 1 );
   VA_END (Marker);
 
+  //
+  // Send data to SMM.
+  //
+  Status = SendCommunicateBuffer (SmmCommunicateHeader, PayloadSize);
+
+  FreePool (SmmCommunicateHeader);
+
   return Status;
 }
 
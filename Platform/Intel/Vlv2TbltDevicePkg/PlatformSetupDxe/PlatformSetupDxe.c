@@ -150,7 +150,6 @@ SystemConfigExtractConfig (
   OUT EFI_STRING                             *Results
   )
 {
-  SetupInfo();
   return EFI_UNSUPPORTED;
 }
 
@@ -225,6 +224,16 @@ SystemConfigCallback (
   UINT8                         OsSelection;
   EDKII_FORM_BROWSER_EXTENSION2_PROTOCOL *FormBrowserEx2;
 
+  //
+  // Gather the information and strings shown on the setup pages the first time
+  // the browser opens one of our forms (the root form has interactive questions,
+  // so it always gets FORM_OPEN), rather than whenever anyone exports the
+  // configuration. Boots that never enter setup do not pay for it.
+  //
+  if (Action == EFI_BROWSER_ACTION_FORM_OPEN) {
+    SetupInfo ();
+  }
+
   StringBuffer1 = AllocateZeroPool (200 * sizeof (CHAR16));
   ASSERT (StringBuffer1 != NULL);
   StringBuffer2 = AllocateZeroPool (200 * sizeof (CHAR16));
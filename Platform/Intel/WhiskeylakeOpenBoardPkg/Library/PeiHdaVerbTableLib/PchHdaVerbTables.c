@@ -6,8 +6,9 @@
 
 #include <ConfigBlock/HdAudioConfig.h>
 #include <Ppi/SiPolicy.h>
+#include "HdaVerbTableEncoding.h"
 
-HDAUDIO_VERB_TABLE HdaVerbTableDisplayAudio = HDAUDIO_VERB_TABLE_INIT (
+HDAUDIO_ENCODED_VERB_TABLE HdaVerbTableDisplayAudio = HDAUDIO_VERB_TABLE_INIT (
   //
   //  VerbTable: CFL Display Audio Codec
   //  Revision ID = 0xFF
@@ -22,20 +23,11 @@ HDAUDIO_VERB_TABLE HdaVerbTableDisplayAudio = HDAUDIO_VERB_TABLE_INIT (
   // Port to be exposed to the inbox driver in the vanilla mode: PORT C - BIT[7:6] = 01b
   0x00878140,
   // Pin Widget 5 - PORT B - Configuration Default: 0x18560010
-  0x00571C10,
-  0x00571D00,
-  0x00571E56,
-  0x00571F18,
+  HDA_PIN_CONFIG (0x05, 0x18560010),
   // Pin Widget 6 - PORT C - Configuration Default: 0x18560020
-  0x00671C20,
-  0x00671D00,
-  0x00671E56,
-  0x00671F18,
+  HDA_PIN_CONFIG (0x06, 0x18560020),
   // Pin Widget 7 - PORT D - Configuration Default: 0x18560030
-  0x00771C30,
-  0x00771D00,
-  0x00771E56,
-  0x00771F18,
+  HDA_PIN_CONFIG (0x07, 0x18560030),
   // Disable the third converter and third Pin (NID 08h)
   0x00878140
 );
@@ -43,7 +35,7 @@ HDAUDIO_VERB_TABLE HdaVerbTableDisplayAudio = HDAUDIO_VERB_TABLE_INIT (
 //
 //codecs verb tables
 //
-HDAUDIO_VERB_TABLE HdaVerbTableAlc700 = HDAUDIO_VERB_TABLE_INIT (
+HDAUDIO_ENCODED_VERB_TABLE HdaVerbTableAlc700 = HDAUDIO_VERB_TABLE_INIT (
   //
   //  VerbTable: (Realtek ALC700)
   //  Revision ID = 0xff
@@ -95,85 +87,40 @@ HDAUDIO_VERB_TABLE HdaVerbTableAlc700 = HDAUDIO_VERB_TABLE_INIT (
   0x0017FF00,
   0x0017FF00,
   //Pin widget 0x12 - DMIC
-  0x01271C00,
-  0x01271D00,
-  0x01271E00,
-  0x01271F40,
+  HDA_PIN_CONFIG (0x12, 0x40000000),
   //Pin widget 0x13 - DMIC
-  0x01371C00,
-  0x01371D00,
-  0x01371E00,
-  0x01371F40,
+  HDA_PIN_CONFIG (0x13, 0x40000000),
   //Pin widget 0x14 - FRONT (Port-D)
-  0x01471CF0,
-  0x01471D11,
-  0x01471E11,
-  0x01471F41,
+  HDA_PIN_CONFIG (0x14, 0x411111F0),
   //Pin widget 0x15 - I2S-OUT
-  0x01571CF0,
-  0x01571D11,
-  0x01571E11,
-  0x01571F41,
+  HDA_PIN_CONFIG (0x15, 0x411111F0),
   //Pin widget 0x16 - LINE3 (Port-B)
-  0x01671CF0,
-  0x01671D11,
-  0x01671E11,
-  0x01671F41,
+  HDA_PIN_CONFIG (0x16, 0x411111F0),
   //Pin widget 0x17 - I2S-OUT
-  0x01771C10,
-  0x01771D01,
-  0x01771E17,
-  0x01771F90,
+  HDA_PIN_CONFIG (0x17, 0x90170110),
   //Pin widget 0x18 - I2S-IN
-  0x01871CF0,
-  0x01871D11,
-  0x01871E11,
-  0x01871F41,
+  HDA_PIN_CONFIG (0x18, 0x411111F0),
   //Pin widget 0x19 - MIC2 (Port-F)
-  0x01971C30,
-  0x01971D10,
-  0x01971EA1,
-  0x01971F04,
+  HDA_PIN_CONFIG (0x19, 0x04A11030),
   //Pin widget 0x1A - LINE1 (Port-C)
-  0x01A71CF0,
-  0x01A71D11,
-  0x01A71E11,
-  0x01A71F41,
+  HDA_PIN_CONFIG (0x1A, 0x411111F0),
   //Pin widget 0x1B - LINE2 (Port-E)
-  0x01B71CF0,
-  0x01B71D11,
-  0x01B71E11,
-  0x01B71F41,
+  HDA_PIN_CONFIG (0x1B, 0x411111F0),
   //Pin widget 0x1D - PC-BEEP
-  0x01D71C05,
-  0x01D71D20,
-  0x01D71E62,
-  0x01D71F40,
+  HDA_PIN_CONFIG (0x1D, 0x40622005),
   //Pin widget 0x1E - S/PDIF-OUT
-  0x01E71CF0,
-  0x01E71D11,
-  0x01E71E11,
-  0x01E71F41,
+  HDA_PIN_CONFIG (0x1E, 0x411111F0),
   //Pin widget 0x1F - S/PDIF-IN
-  0x01F71CF0,
-  0x01F71D11,
-  0x01F71E11,
-  0x01F71F41,
+  HDA_PIN_CONFIG (0x1F, 0x411111F0),
   //Pin widget 0x21 - HP-OUT (Port-I)
-  0x02171C20,
-  0x02171D10,
-  0x02171E21,
-  0x02171F04,
+  HDA_PIN_CONFIG (0x21, 0x04211020),
   //Pin widget 0x29 - I2S-IN
-  0x02971CF0,
-  0x02971D11,
-  0x02971E11,
-  0x02971F41,
+  HDA_PIN_CONFIG (0x29, 0x411111F0),
   //Widget node 0x20 :
-  0x02050045,
-  0x02045289,
-  0x0205004A,
-  0x0204201B,
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0045, 0x5289),
+    HDA_COEF (0x004A, 0x201B)
+    ),
   //Widget node 0x20 - 1 :
   0x05850000,
   0x05843888,
@@ -182,647 +129,505 @@ HDAUDIO_VERB_TABLE HdaVerbTableAlc700 = HDAUDIO_VERB_TABLE_INIT (
 
 
   //Widget node 0X20 for ALC1305   20160603 update
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040000,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040004,
-  0x02050028,
-  0x02040600,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204003C,
-  0x02050028,
-  0x0204FFD0,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040080,
-  0x02050028,
-  0x02040080,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040080,
-  0x02050028,
-  0x02040880,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204003A,
-  0x02050028,
-  0x02040DFE,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006A,
-  0x02050028,
-  0x0204005D,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006C,
-  0x02050028,
-  0x02040442,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040005,
-  0x02050028,
-  0x02040880,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040006,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040008,
-  0x02050028,
-  0x0204B000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204002E,
-  0x02050028,
-  0x02040800,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006A,
-  0x02050028,
-  0x020400C3,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006C,
-  0x02050028,
-  0x0204D4A0,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006A,
-  0x02050028,
-  0x020400CC,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006C,
-  0x02050028,
-  0x0204400A,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006A,
-  0x02050028,
-  0x020400C1,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006C,
-  0x02050028,
-  0x02040320,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040039,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204003B,
-  0x02050028,
-  0x0204FFFF,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204003C,
-  0x02050028,
-  0x0204FC20,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204003A,
-  0x02050028,
-  0x02041DFE,
-  0x02050029,
-  0x0204B024,
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0000),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0004),
+    HDA_COEF (0x0028, 0x0600),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x003C),
+    HDA_COEF (0x0028, 0xFFD0),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0080),
+    HDA_COEF (0x0028, 0x0080),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0080),
+    HDA_COEF (0x0028, 0x0880),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x003A),
+    HDA_COEF (0x0028, 0x0DFE),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006A),
+    HDA_COEF (0x0028, 0x005D),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006C),
+    HDA_COEF (0x0028, 0x0442),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0005),
+    HDA_COEF (0x0028, 0x0880),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0006),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0008),
+    HDA_COEF (0x0028, 0xB000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x002E),
+    HDA_COEF (0x0028, 0x0800),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006A),
+    HDA_COEF (0x0028, 0x00C3),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006C),
+    HDA_COEF (0x0028, 0xD4A0),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006A),
+    HDA_COEF (0x0028, 0x00CC),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006C),
+    HDA_COEF (0x0028, 0x400A),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006A),
+    HDA_COEF (0x0028, 0x00C1),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006C),
+    HDA_COEF (0x0028, 0x0320),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0039),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x003B),
+    HDA_COEF (0x0028, 0xFFFF),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x003C),
+    HDA_COEF (0x0028, 0xFC20),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x003A),
+    HDA_COEF (0x0028, 0x1DFE),
+    HDA_COEF (0x0029, 0xB024)
+    ),
   //
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400C0,
-  0x02050028,
-  0x020401FA,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400C1,
-  0x02050028,
-  0x0204DE23,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400C2,
-  0x02050028,
-  0x02041C00,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400C3,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400C4,
-  0x02050028,
-  0x02040200,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400C5,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400C6,
-  0x02050028,
-  0x020403F5,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400C7,
-  0x02050028,
-  0x0204AF1B,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400C8,
-  0x02050028,
-  0x02041E0A,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400C9,
-  0x02050028,
-  0x0204368E,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400CA,
-  0x02050028,
-  0x020401FA,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400CB,
-  0x02050028,
-  0x0204DE23,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400CC,
-  0x02050028,
-  0x02041C00,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400CD,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400CE,
-  0x02050028,
-  0x02040200,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400CF,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400D0,
-  0x02050028,
-  0x020403F5,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400D1,
-  0x02050028,
-  0x0204AF1B,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400D2,
-  0x02050028,
-  0x02041E0A,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400D3,
-  0x02050028,
-  0x0204368E,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040040,
-  0x02050028,
-  0x0204800F,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040062,
-  0x02050028,
-  0x02048000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040063,
-  0x02050028,
-  0x02044848,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040064,
-  0x02050028,
-  0x02040800,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040065,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040066,
-  0x02050028,
-  0x02044004,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040067,
-  0x02050028,
-  0x02040802,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040068,
-  0x02050028,
-  0x0204890F,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040069,
-  0x02050028,
-  0x0204E021,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040070,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040071,
-  0x02050000,
-  0x02043330,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040072,
-  0x02050000,
-  0x02043333,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040073,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040074,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040075,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040076,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040050,
-  0x02050028,
-  0x020402EC,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040051,
-  0x02050028,
-  0x02044909,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040052,
-  0x02050028,
-  0x020440B0,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040046,
-  0x02050028,
-  0x0204C22E,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040047,
-  0x02050028,
-  0x02040C00,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040048,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040049,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204004A,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204004B,
-  0x02050028,
-  0x02041C00,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006A,
-  0x02050028,
-  0x02040090,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006C,
-  0x02050028,
-  0x0204721F,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204009E,
-  0x02050028,
-  0x02040001,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040004,
-  0x02050028,
-  0x02040500,
-  0x02050029,
-  0x0204B024
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00C0),
+    HDA_COEF (0x0028, 0x01FA),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00C1),
+    HDA_COEF (0x0028, 0xDE23),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00C2),
+    HDA_COEF (0x0028, 0x1C00),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00C3),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00C4),
+    HDA_COEF (0x0028, 0x0200),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00C5),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00C6),
+    HDA_COEF (0x0028, 0x03F5),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00C7),
+    HDA_COEF (0x0028, 0xAF1B),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00C8),
+    HDA_COEF (0x0028, 0x1E0A),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00C9),
+    HDA_COEF (0x0028, 0x368E),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00CA),
+    HDA_COEF (0x0028, 0x01FA),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00CB),
+    HDA_COEF (0x0028, 0xDE23),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00CC),
+    HDA_COEF (0x0028, 0x1C00),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00CD),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00CE),
+    HDA_COEF (0x0028, 0x0200),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00CF),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00D0),
+    HDA_COEF (0x0028, 0x03F5),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00D1),
+    HDA_COEF (0x0028, 0xAF1B),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00D2),
+    HDA_COEF (0x0028, 0x1E0A),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00D3),
+    HDA_COEF (0x0028, 0x368E),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0040),
+    HDA_COEF (0x0028, 0x800F),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0062),
+    HDA_COEF (0x0028, 0x8000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0063),
+    HDA_COEF (0x0028, 0x4848),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0064),
+    HDA_COEF (0x0028, 0x0800),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0065),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0066),
+    HDA_COEF (0x0028, 0x4004),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0067),
+    HDA_COEF (0x0028, 0x0802),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0068),
+    HDA_COEF (0x0028, 0x890F),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0069),
+    HDA_COEF (0x0028, 0xE021),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0070),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0071),
+    HDA_COEF (0x0000, 0x3330),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0072),
+    HDA_COEF (0x0000, 0x3333),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0073),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0074),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0075),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0076),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0050),
+    HDA_COEF (0x0028, 0x02EC),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0051),
+    HDA_COEF (0x0028, 0x4909),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0052),
+    HDA_COEF (0x0028, 0x40B0),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0046),
+    HDA_COEF (0x0028, 0xC22E),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0047),
+    HDA_COEF (0x0028, 0x0C00),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0048),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0049),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x004A),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x004B),
+    HDA_COEF (0x0028, 0x1C00),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006A),
+    HDA_COEF (0x0028, 0x0090),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006C),
+    HDA_COEF (0x0028, 0x721F),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x009E),
+    HDA_COEF (0x0028, 0x0001),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0004),
+    HDA_COEF (0x0028, 0x0500),
+    HDA_COEF (0x0029, 0xB024)
+    )
 ); // HdaVerbTableAlc700
 
-HDAUDIO_VERB_TABLE HdaVerbTableAlc701 = HDAUDIO_VERB_TABLE_INIT (
+HDAUDIO_ENCODED_VERB_TABLE HdaVerbTableAlc701 = HDAUDIO_VERB_TABLE_INIT (
   //
   //  VerbTable: (Realtek ALC701)
   //  Revision ID = 0xff
@@ -874,85 +679,40 @@ HDAUDIO_VERB_TABLE HdaVerbTableAlc701 = HDAUDIO_VERB_TABLE_INIT (
   0x0017FF00,
   0x0017FF00,
   //Pin widget 0x12 - DMIC
-  0x01271C00,
-  0x01271D00,
-  0x01271E00,
-  0x01271F40,
+  HDA_PIN_CONFIG (0x12, 0x40000000),
   //Pin widget 0x13 - DMIC
-  0x01371C00,
-  0x01371D00,
-  0x01371E00,
-  0x01371F40,
+  HDA_PIN_CONFIG (0x13, 0x40000000),
   //Pin widget 0x14 - FRONT (Port-D)
-  0x01471CF0,
-  0x01471D11,
-  0x01471E11,
-  0x01471F41,
+  HDA_PIN_CONFIG (0x14, 0x411111F0),
   //Pin widget 0x15 - I2S-OUT
-  0x01571CF0,
-  0x01571D11,
-  0x01571E11,
-  0x01571F41,
+  HDA_PIN_CONFIG (0x15, 0x411111F0),
   //Pin widget 0x16 - LINE3 (Port-B)
-  0x01671CF0,
-  0x01671D11,
-  0x01671E11,
-  0x01671F41,
+  HDA_PIN_CONFIG (0x16, 0x411111F0),
   //Pin widget 0x17 - I2S-OUT
-  0x01771C10,
-  0x01771D01,
-  0x01771E17,
-  0x01771F90,
+  HDA_PIN_CONFIG (0x17, 0x90170110),
   //Pin widget 0x18 - I2S-IN
-  0x01871CF0,
-  0x01871D11,
-  0x01871E11,
-  0x01871F41,
+  HDA_PIN_CONFIG (0x18, 0x411111F0),
   //Pin widget 0x19 - MIC2 (Port-F)
-  0x01971C30,
-  0x01971D10,
-  0x01971EA1,
-  0x01971F04,
+  HDA_PIN_CONFIG (0x19, 0x04A11030),
   //Pin widget 0x1A - LINE1 (Port-C)
-  0x01A71CF0,
-  0x01A71D11,
-  0x01A71E11,
-  0x01A71F41,
+  HDA_PIN_CONFIG (0x1A, 0x411111F0),
   //Pin widget 0x1B - LINE2 (Port-E)
-  0x01B71CF0,
-  0x01B71D11,
-  0x01B71E11,
-  0x01B71F41,
+  HDA_PIN_CONFIG (0x1B, 0x411111F0),
   //Pin widget 0x1D - PC-BEEP
-  0x01D71C41,
-  0x01D71D00,
-  0x01D71E61,
-  0x01D71F40,
+  HDA_PIN_CONFIG (0x1D, 0x40610041),
   //Pin widget 0x1E - S/PDIF-OUT
-  0x01E71CF0,
-  0x01E71D11,
-  0x01E71E11,
-  0x01E71F41,
+  HDA_PIN_CONFIG (0x1E, 0x411111F0),
   //Pin widget 0x1F - S/PDIF-IN
-  0x01F71CF0,
-  0x01F71D11,
-  0x01F71E11,
-  0x01F71F41,
+  HDA_PIN_CONFIG (0x1F, 0x411111F0),
   //Pin widget 0x21 - HP-OUT (Port-I)
-  0x02171C20,
-  0x02171D10,
-  0x02171E21,
-  0x02171F04,
+  HDA_PIN_CONFIG (0x21, 0x04211020),
   //Pin widget 0x29 - I2S-IN
-  0x02971CF0,
-  0x02971D11,
-  0x02971E11,
-  0x02971F41,
+  HDA_PIN_CONFIG (0x29, 0x411111F0),
   //Widget node 0x20 :
-  0x02050045,
-  0x02045289,
-  0x0205004A,
-  0x0204201B,
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0045, 0x5289),
+    HDA_COEF (0x004A, 0x201B)
+    ),
   //Widget node 0x20 - 1 :
   0x05850000,
   0x05843888,
@@ -960,7 +720,7 @@ HDAUDIO_VERB_TABLE HdaVerbTableAlc701 = HDAUDIO_VERB_TABLE_INIT (
   0x02042C0B
 ); // HdaVerbTableAlc701
 
-HDAUDIO_VERB_TABLE HdaVerbTableAlc274 = HDAUDIO_VERB_TABLE_INIT (
+HDAUDIO_ENCODED_VERB_TABLE HdaVerbTableAlc274 = HDAUDIO_VERB_TABLE_INIT (
   //
   //  VerbTable: (Realtek ALC274)
   //  Revision ID = 0xff
@@ -1012,101 +772,59 @@ HDAUDIO_VERB_TABLE HdaVerbTableAlc274 = HDAUDIO_VERB_TABLE_INIT (
   0x0017FF00,
   0x0017FF00,
   //Pin widget 0x12 - DMIC
-  0x01271C00,
-  0x01271D00,
-  0x01271E00,
-  0x01271F40,
+  HDA_PIN_CONFIG (0x12, 0x40000000),
   //Pin widget 0x13 - DMIC
-  0x01371CF0,
-  0x01371D11,
-  0x01371E11,
-  0x01371F41,
+  HDA_PIN_CONFIG (0x13, 0x411111F0),
   //Pin widget 0x14 - NPC
-  0x01471CF0,
-  0x01471D11,
-  0x01471E11,
-  0x01471F41,
+  HDA_PIN_CONFIG (0x14, 0x411111F0),
   //Pin widget 0x15 - I2S_OUT2
-  0x01571CF0,
-  0x01571D11,
-  0x01571E11,
-  0x01571F41,
+  HDA_PIN_CONFIG (0x15, 0x411111F0),
   //Pin widget 0x16 - LINE3 (Port-B)
-  0x01671CF0,
-  0x01671D11,
-  0x01671E11,
-  0x01671F41,
+  HDA_PIN_CONFIG (0x16, 0x411111F0),
   //Pin widget 0x17 - I2S_OUT1
-  0x01771CF0,
-  0x01771D11,
-  0x01771E11,
-  0x01771F41,
+  HDA_PIN_CONFIG (0x17, 0x411111F0),
   //Pin widget 0x18 - I2S_IN
-  0x01871CF0,
-  0x01871D11,
-  0x01871E11,
-  0x01871F41,
+  HDA_PIN_CONFIG (0x18, 0x411111F0),
   //Pin widget 0x19 - MIC2 (Port-F)
-  0x01971C20,
-  0x01971D10,
-  0x01971EA1,
-  0x01971F04,
+  HDA_PIN_CONFIG (0x19, 0x04A11020),
   //Pin widget 0x1A - LINE1 (Port-C)
-  0x01A71CF0,
-  0x01A71D11,
-  0x01A71E11,
-  0x01A71F41,
+  HDA_PIN_CONFIG (0x1A, 0x411111F0),
   //Pin widget 0x1B - LINE2 (Port-E)
-  0x01B71CF0,
-  0x01B71D11,
-  0x01B71E11,
-  0x01B71F41,
+  HDA_PIN_CONFIG (0x1B, 0x411111F0),
   //Pin widget 0x1D - PC-BEEP
-  0x01D71C05,
-  0x01D71D1B,
-  0x01D71E45,
-  0x01D71F40,
+  HDA_PIN_CONFIG (0x1D, 0x40451B05),
   //Pin widget 0x1E - S/PDIF-OUT
-  0x01E71CF0,
-  0x01E71D11,
-  0x01E71E11,
-  0x01E71F41,
+  HDA_PIN_CONFIG (0x1E, 0x411111F0),
   //Pin widget 0x1F - S/PDIF-IN
-  0x01F71CF0,
-  0x01F71D11,
-  0x01F71E11,
-  0x01F71F41,
+  HDA_PIN_CONFIG (0x1F, 0x411111F0),
   //Pin widget 0x21 - HP-OUT (Port-I)
-  0x02171C10,
-  0x02171D10,
-  0x02171E21,
-  0x02171F04,
+  HDA_PIN_CONFIG (0x21, 0x04211010),
   //Widget node 0x20 :
-  0x02050045,
-  0x02045289,
-  0x0205006F,
-  0x02042C0B,
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0045, 0x5289),
+    HDA_COEF (0x006F, 0x2C0B)
+    ),
   //Widget node 0x20 - 1 :
   0x02050035,
   0x02048968,
   0x05B50001,
   0x05B48540,
   //Widget node 0x20 - 2 :
-  0x05850000,
-  0x05843888,
-  0x05850000,
-  0x05843888,
+  HDA_COEF_WRITES (0x58,
+    HDA_COEF (0x0000, 0x3888),
+    HDA_COEF (0x0000, 0x3888)
+    ),
   //Widget node 0x20 - 3 :
-  0x0205004A,
-  0x0204201B,
-  0x0205004A,
-  0x0204201B
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x004A, 0x201B),
+    HDA_COEF (0x004A, 0x201B)
+    )
 ); //HdaVerbTableAlc274
 
 //
 // WHL codecs verb tables
 //
-HDAUDIO_VERB_TABLE WhlHdaVerbTableAlc700 = HDAUDIO_VERB_TABLE_INIT (
+HDAUDIO_ENCODED_VERB_TABLE WhlHdaVerbTableAlc700 = HDAUDIO_VERB_TABLE_INIT (
   //
   //  VerbTable: (Realtek ALC700) WHL RVP
   //  Revision ID = 0xff
@@ -1158,85 +876,40 @@ HDAUDIO_VERB_TABLE WhlHdaVerbTableAlc700 = HDAUDIO_VERB_TABLE_INIT (
   0x0017FF00,
   0x0017FF00,
   //Pin widget 0x12 - DMIC
-  0x01271CF0,
-  0x01271D11,
-  0x01271E11,
-  0x01271F41,
+  HDA_PIN_CONFIG (0x12, 0x411111F0),
   //Pin widget 0x13 - DMIC
-  0x01371C00,
-  0x01371D00,
-  0x01371E00,
-  0x01371F40,
+  HDA_PIN_CONFIG (0x13, 0x40000000),
   //Pin widget 0x14 - FRONT (Port-D)
-  0x01471CF0,
-  0x01471D11,
-  0x01471E11,
-  0x01471F41,
+  HDA_PIN_CONFIG (0x14, 0x411111F0),
   //Pin widget 0x15 - I2S-OUT
-  0x01571CF0,
-  0x01571D11,
-  0x01571E11,
-  0x01571F41,
+  HDA_PIN_CONFIG (0x15, 0x411111F0),
   //Pin widget 0x16 - LINE3 (Port-B)
-  0x01671CF0,
-  0x01671D11,
-  0x01671E11,
-  0x01671F41,
+  HDA_PIN_CONFIG (0x16, 0x411111F0),
   //Pin widget 0x17 - I2S-OUT
-  0x01771C10,
-  0x01771D01,
-  0x01771E17,
-  0x01771F90,
+  HDA_PIN_CONFIG (0x17, 0x90170110),
   //Pin widget 0x18 - I2S-IN
-  0x01871CF0,
-  0x01871D11,
-  0x01871E11,
-  0x01871F41,
+  HDA_PIN_CONFIG (0x18, 0x411111F0),
   //Pin widget 0x19 - MIC2 (Port-F)
-  0x01971C40,
-  0x01971D90,
-  0x01971EA1,
-  0x01971F02,
+  HDA_PIN_CONFIG (0x19, 0x02A19040),
   //Pin widget 0x1A - LINE1 (Port-C)
-  0x01A71CF0,
-  0x01A71D11,
-  0x01A71E11,
-  0x01A71F41,
+  HDA_PIN_CONFIG (0x1A, 0x411111F0),
   //Pin widget 0x1B - LINE2 (Port-E)
-  0x01B71CF0,
-  0x01B71D11,
-  0x01B71E11,
-  0x01B71F41,
+  HDA_PIN_CONFIG (0x1B, 0x411111F0),
   //Pin widget 0x1D - PC-BEEP
-  0x01D71C29,
-  0x01D71D80,
-  0x01D71E63,
-  0x01D71F40,
+  HDA_PIN_CONFIG (0x1D, 0x40638029),
   //Pin widget 0x1E - S/PDIF-OUT
-  0x01E71CF0,
-  0x01E71D11,
-  0x01E71E11,
-  0x01E71F41,
+  HDA_PIN_CONFIG (0x1E, 0x411111F0),
   //Pin widget 0x1F - S/PDIF-IN
-  0x01F71CF0,
-  0x01F71D11,
-  0x01F71E11,
-  0x01F71F41,
+  HDA_PIN_CONFIG (0x1F, 0x411111F0),
   //Pin widget 0x21 - HP-OUT (Port-I)
-  0x02171C20,
-  0x02171D10,
-  0x02171E21,
-  0x02171F02,
+  HDA_PIN_CONFIG (0x21, 0x02211020),
   //Pin widget 0x29 - I2S-IN
-  0x02971CF0,
-  0x02971D11,
-  0x02971E11,
-  0x02971F41,
+  HDA_PIN_CONFIG (0x29, 0x411111F0),
   //Widget node 0x20 - 0  FAKE JD unplug
-  0x02050008,
-  0x0204A80F,
-  0x02050008,
-  0x0204A80F,
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0008, 0xA80F),
+    HDA_COEF (0x0008, 0xA80F)
+    ),
 
   //Widget node 0x20 - 1 : //remove NID 58 realted setting for ALC700  bypass DAC02 DRE(NID5B bit14)
   0x05B50010,
@@ -1245,16 +918,16 @@ HDAUDIO_VERB_TABLE WhlHdaVerbTableAlc700 = HDAUDIO_VERB_TABLE_INIT (
   0x02040F8B,   //Zeek, 0F8Bh
 
   //Widget node 0x20 -2:
-  0x02050045,
-  0x02045089,
-  0x0205004A,
-  0x0204201B,
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0045, 0x5089),
+    HDA_COEF (0x004A, 0x201B)
+    ),
 
   //Widget node 0x20 - 3   From JD detect
-  0x02050008,
-  0x0204A807,
-  0x02050008,
-  0x0204A807,
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0008, 0xA807),
+    HDA_COEF (0x0008, 0xA807)
+    ),
 
   //Widget node 0x20 - 4  Pull high ALC700 GPIO5 for AMP1305 PD pin and enable I2S BCLK first
   0x02050090,
@@ -1268,786 +941,612 @@ HDAUDIO_VERB_TABLE WhlHdaVerbTableAlc700 = HDAUDIO_VERB_TABLE_INIT (
   0x01770740,
 
   //Widget node 0x20 for ALC1305   20181105 update   2W/4ohm to remove ALC1305 EQ setting and enable ALC1305 silencet detect to prevent I2S noise
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040000,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006A,
-  0x02050028,
-  0x020400CF,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006C,
-  0x02050028,
-  0x02045548,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204003F,
-  0x02050028,
-  0x02041000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040004,
-  0x02050028,
-  0x02040600,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204003C,
-  0x02050028,
-  0x0204FFD0,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040080,
-  0x02050028,
-  0x02040080,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040080,
-  0x02050028,
-  0x02040880,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204003A,
-  0x02050028,
-  0x02040DFE,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006A,
-  0x02050028,
-  0x0204005D,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006C,
-  0x02050028,
-  0x02040442,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040005,
-  0x02050028,
-  0x02040880,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040006,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040008,
-  0x02050028,
-  0x0204B000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204002E,
-  0x02050028,
-  0x02040800,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006A,
-  0x02050028,
-  0x020400C3,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006C,
-  0x02050028,
-  0x0204D4A0,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006A,
-  0x02050028,
-  0x020400CC,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006C,
-  0x02050028,
-  0x0204400A,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006A,
-  0x02050028,
-  0x020400C1,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006C,
-  0x02050028,
-  0x02040320,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040039,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204003B,
-  0x02050028,
-  0x0204FFFF,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204003C,
-  0x02050028,
-  0x0204FC20,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006A,
-  0x02050028,
-  0x02040006,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006C,
-  0x02050028,
-  0x020400C0,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204003C,
-  0x02050028,
-  0x0204FCA0,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204003C,
-  0x02050028,
-  0x0204FCE0,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204003C,
-  0x02050028,
-  0x0204FCF0,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040080,
-  0x02050028,
-  0x02040080,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040080,
-  0x02050028,
-  0x02040880,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040080,
-  0x02050028,
-  0x02040880,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204003C,
-  0x02050028,
-  0x0204FCE0,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204003C,
-  0x02050028,
-  0x0204FCA0,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204003C,
-  0x02050028,
-  0x0204FC20,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006A,
-  0x02050028,
-  0x02040006,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006C,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040080,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400C0,
-  0x02050028,
-  0x020401F0,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400C1,
-  0x02050028,
-  0x0204C1C7,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400C2,
-  0x02050028,
-  0x02041C00,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400C3,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400C4,
-  0x02050028,
-  0x02040200,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400C5,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400C6,
-  0x02050028,
-  0x020403E1,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400C7,
-  0x02050028,
-  0x02040F5A,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400C8,
-  0x02050028,
-  0x02041E1E,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400C9,
-  0x02050028,
-  0x0204083F,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400CA,
-  0x02050028,
-  0x020401F0,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400CB,
-  0x02050028,
-  0x0204C1C7,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400CC,
-  0x02050028,
-  0x02041C00,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400CD,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400CE,
-  0x02050028,
-  0x02040200,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400CF,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400D0,
-  0x02050028,
-  0x020403E1,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400D1,
-  0x02050028,
-  0x02040F5A,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400D2,
-  0x02050028,
-  0x02041E1E,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x020400D3,
-  0x02050028,
-  0x0204083F,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040062,
-  0x02050028,
-  0x02048000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040063,
-  0x02050028,
-  0x02045F5F,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040064,
-  0x02050028,
-  0x02042000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040065,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040066,
-  0x02050028,
-  0x02044004,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040067,
-  0x02050028,
-  0x02040802,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040068,
-  0x02050028,
-  0x0204890F,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040069,
-  0x02050028,
-  0x0204E021,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040070,
-  0x02050028,
-  0x02048012,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040071,
-  0x02050028,
-  0x02043450,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040072,
-  0x02050028,
-  0x02040123,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040073,
-  0x02050028,
-  0x02044543,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040074,
-  0x02050028,
-  0x02042100,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040075,
-  0x02050028,
-  0x02044321,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040076,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040050,
-  0x02050028,
-  0x02048200,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040051,
-  0x02050028,
-  0x02040707,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040052,
-  0x02050028,
-  0x02044090,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006A,
-  0x02050028,
-  0x02040090,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204006C,
-  0x02050028,
-  0x0204721F,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040012,
-  0x02050028,
-  0x0204DFDF,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204009E,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040004,
-  0x02050028,
-  0x02040500,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040060,
-  0x02050028,
-  0x0204E213,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204003A,
-  0x02050028,
-  0x02041DFE,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204003F,
-  0x02050028,
-  0x02043000,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040040,
-  0x02050028,
-  0x0204000C,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x02040046,
-  0x02050028,
-  0x0204422E,
-  0x02050029,
-  0x0204B024,
-
-  0x02050024,
-  0x02040010,
-  0x02050026,
-  0x0204004B,
-  0x02050028,
-  0x02040000,
-  0x02050029,
-  0x0204B024
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0000),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006A),
+    HDA_COEF (0x0028, 0x00CF),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006C),
+    HDA_COEF (0x0028, 0x5548),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x003F),
+    HDA_COEF (0x0028, 0x1000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0004),
+    HDA_COEF (0x0028, 0x0600),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x003C),
+    HDA_COEF (0x0028, 0xFFD0),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0080),
+    HDA_COEF (0x0028, 0x0080),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0080),
+    HDA_COEF (0x0028, 0x0880),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x003A),
+    HDA_COEF (0x0028, 0x0DFE),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006A),
+    HDA_COEF (0x0028, 0x005D),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006C),
+    HDA_COEF (0x0028, 0x0442),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0005),
+    HDA_COEF (0x0028, 0x0880),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0006),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0008),
+    HDA_COEF (0x0028, 0xB000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x002E),
+    HDA_COEF (0x0028, 0x0800),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006A),
+    HDA_COEF (0x0028, 0x00C3),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006C),
+    HDA_COEF (0x0028, 0xD4A0),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006A),
+    HDA_COEF (0x0028, 0x00CC),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006C),
+    HDA_COEF (0x0028, 0x400A),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006A),
+    HDA_COEF (0x0028, 0x00C1),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006C),
+    HDA_COEF (0x0028, 0x0320),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0039),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x003B),
+    HDA_COEF (0x0028, 0xFFFF),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x003C),
+    HDA_COEF (0x0028, 0xFC20),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006A),
+    HDA_COEF (0x0028, 0x0006),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006C),
+    HDA_COEF (0x0028, 0x00C0),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x003C),
+    HDA_COEF (0x0028, 0xFCA0),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x003C),
+    HDA_COEF (0x0028, 0xFCE0),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x003C),
+    HDA_COEF (0x0028, 0xFCF0),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0080),
+    HDA_COEF (0x0028, 0x0080),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0080),
+    HDA_COEF (0x0028, 0x0880),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0080),
+    HDA_COEF (0x0028, 0x0880),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x003C),
+    HDA_COEF (0x0028, 0xFCE0),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x003C),
+    HDA_COEF (0x0028, 0xFCA0),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x003C),
+    HDA_COEF (0x0028, 0xFC20),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006A),
+    HDA_COEF (0x0028, 0x0006),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006C),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0080),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00C0),
+    HDA_COEF (0x0028, 0x01F0),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00C1),
+    HDA_COEF (0x0028, 0xC1C7),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00C2),
+    HDA_COEF (0x0028, 0x1C00),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00C3),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00C4),
+    HDA_COEF (0x0028, 0x0200),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00C5),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00C6),
+    HDA_COEF (0x0028, 0x03E1),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00C7),
+    HDA_COEF (0x0028, 0x0F5A),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00C8),
+    HDA_COEF (0x0028, 0x1E1E),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00C9),
+    HDA_COEF (0x0028, 0x083F),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00CA),
+    HDA_COEF (0x0028, 0x01F0),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00CB),
+    HDA_COEF (0x0028, 0xC1C7),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00CC),
+    HDA_COEF (0x0028, 0x1C00),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00CD),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00CE),
+    HDA_COEF (0x0028, 0x0200),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00CF),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00D0),
+    HDA_COEF (0x0028, 0x03E1),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00D1),
+    HDA_COEF (0x0028, 0x0F5A),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00D2),
+    HDA_COEF (0x0028, 0x1E1E),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x00D3),
+    HDA_COEF (0x0028, 0x083F),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0062),
+    HDA_COEF (0x0028, 0x8000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0063),
+    HDA_COEF (0x0028, 0x5F5F),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0064),
+    HDA_COEF (0x0028, 0x2000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0065),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0066),
+    HDA_COEF (0x0028, 0x4004),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0067),
+    HDA_COEF (0x0028, 0x0802),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0068),
+    HDA_COEF (0x0028, 0x890F),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0069),
+    HDA_COEF (0x0028, 0xE021),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0070),
+    HDA_COEF (0x0028, 0x8012),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0071),
+    HDA_COEF (0x0028, 0x3450),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0072),
+    HDA_COEF (0x0028, 0x0123),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0073),
+    HDA_COEF (0x0028, 0x4543),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0074),
+    HDA_COEF (0x0028, 0x2100),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0075),
+    HDA_COEF (0x0028, 0x4321),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0076),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0050),
+    HDA_COEF (0x0028, 0x8200),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0051),
+    HDA_COEF (0x0028, 0x0707),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0052),
+    HDA_COEF (0x0028, 0x4090),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006A),
+    HDA_COEF (0x0028, 0x0090),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x006C),
+    HDA_COEF (0x0028, 0x721F),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0012),
+    HDA_COEF (0x0028, 0xDFDF),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x009E),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0004),
+    HDA_COEF (0x0028, 0x0500),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0060),
+    HDA_COEF (0x0028, 0xE213),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x003A),
+    HDA_COEF (0x0028, 0x1DFE),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x003F),
+    HDA_COEF (0x0028, 0x3000),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0040),
+    HDA_COEF (0x0028, 0x000C),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x0046),
+    HDA_COEF (0x0028, 0x422E),
+    HDA_COEF (0x0029, 0xB024)
+    ),
+
+  HDA_COEF_WRITES (0x20,
+    HDA_COEF (0x0024, 0x0010),
+    HDA_COEF (0x0026, 0x004B),
+    HDA_COEF (0x0028, 0x0000),
+    HDA_COEF (0x0029, 0xB024)
+    )
 ); // WhlHdaVerbTableAlc700
@@ -48,6 +48,12 @@ STATIC CONST MV_GPIO_PIN mXhciVbusPins[] = {
   },
 };
 
+//
+// All XHCI controllers share the VBUS pins above, so drive them only on the
+// first controller that gets connected.
+//
+STATIC BOOLEAN mXhciVbusEnabled;
+
 STATIC
 EFI_STATUS
 EFIAPI
@@ -62,6 +68,10 @@ XhciInit (
   EFI_STATUS           Status;
   UINTN                Index;
 
+  if (mXhciVbusEnabled) {
+    return EFI_SUCCESS;
+  }
+
   Status = MvGpioGetProtocol (MV_GPIO_DRIVER_TYPE_PCA95XX, &GpioProtocol);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "%a: Unable to find GPIO protocol\n", __FUNCTION__));
@@ -76,6 +86,8 @@ XhciInit (
     VbusPin++;
   }
 
+  mXhciVbusEnabled = TRUE;
+
   return EFI_SUCCESS;
 }
 
@@ -21,13 +21,19 @@
 
 #include "NonDiscoverableInitLib.h"
 
+//
+// Some pin groups are shared by several controllers; Configured tracks
+// whether a group has already been driven so that connecting the other
+// controllers costs no GPIO expander traffic.
+//
 STATIC
 EFI_STATUS
 EFIAPI
 ConfigurePins (
   IN  CONST MV_GPIO_PIN        *VbusPin,
   IN  UINTN                     PinCount,
-  IN  MV_GPIO_DRIVER_TYPE       DriverType
+  IN  MV_GPIO_DRIVER_TYPE       DriverType,
+  IN OUT BOOLEAN               *Configured
   )
 {
   EMBEDDED_GPIO_MODE   Mode;
@@ -36,6 +42,10 @@ ConfigurePins (
   EFI_STATUS           Status;
   UINTN                Index;
 
+  if (*Configured) {
+    return EFI_SUCCESS;
+  }
+
   Status = MvGpioGetProtocol (DriverType, &GpioProtocol);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "%a: Unable to find GPIO protocol\n", __FUNCTION__));
@@ -49,6 +59,8 @@ ConfigurePins (
     VbusPin++;
   }
 
+  *Configured = TRUE;
+
   return EFI_SUCCESS;
 }
 
@@ -79,6 +91,8 @@ STATIC CONST MV_GPIO_PIN mCp0XhciVbusPins[] = {
   },
 };
 
+STATIC BOOLEAN mCp0XhciConfigured;
+
 STATIC
 EFI_STATUS
 EFIAPI
@@ -88,7 +102,8 @@ Cp0XhciInit (
 {
   return ConfigurePins (mCp0XhciVbusPins,
            ARRAY_SIZE (mCp0XhciVbusPins),
-           MV_GPIO_DRIVER_TYPE_PCA95XX);
+           MV_GPIO_DRIVER_TYPE_PCA95XX,
+           &mCp0XhciConfigured);
 }
 
 STATIC CONST MV_GPIO_PIN mCp1XhciVbusPins[] = {
@@ -106,6 +121,8 @@ STATIC CONST MV_GPIO_PIN mCp1XhciVbusPins[] = {
   },
 };
 
+STATIC BOOLEAN mCp1XhciConfigured;
+
 STATIC
 EFI_STATUS
 EFIAPI
@@ -115,7 +132,8 @@ Cp1XhciInit (
 {
   return ConfigurePins (mCp1XhciVbusPins,
            ARRAY_SIZE (mCp1XhciVbusPins),
-           MV_GPIO_DRIVER_TYPE_SOC_CONTROLLER);
+           MV_GPIO_DRIVER_TYPE_SOC_CONTROLLER,
+           &mCp1XhciConfigured);
 }
 
 STATIC CONST MV_GPIO_PIN mCp2XhciVbusPins[] = {
@@ -145,6 +163,8 @@ STATIC CONST MV_GPIO_PIN mCp2XhciVbusPins[] = {
   },
 };
 
+STATIC BOOLEAN mCp2XhciConfigured;
+
 STATIC
 EFI_STATUS
 EFIAPI
@@ -154,7 +174,8 @@ Cp2XhciInit (
 {
   return ConfigurePins (mCp2XhciVbusPins,
            ARRAY_SIZE (mCp2XhciVbusPins),
-           MV_GPIO_DRIVER_TYPE_SOC_CONTROLLER);
+           MV_GPIO_DRIVER_TYPE_SOC_CONTROLLER,
+           &mCp2XhciConfigured);
 }
 
 STATIC CONST MV_GPIO_PIN mCp0SdMmcPins[] = {
@@ -172,6 +193,8 @@ STATIC CONST MV_GPIO_PIN mCp0SdMmcPins[] = {
   },
 };
 
+STATIC BOOLEAN mCp0SdMmcConfigured;
+
 STATIC
 EFI_STATUS
 EFIAPI
@@ -181,7 +204,8 @@ Cp0SdMmcInit (
 {
   return ConfigurePins (mCp0SdMmcPins,
            ARRAY_SIZE (mCp0SdMmcPins),
-           MV_GPIO_DRIVER_TYPE_PCA95XX);
+           MV_GPIO_DRIVER_TYPE_PCA95XX,
+           &mCp0SdMmcConfigured);
 }
 
 NON_DISCOVERABLE_DEVICE_INIT
@@ -17,6 +17,19 @@ UINT32 LastExecutedCommand = (UINT32) -1;
 
 STATIC RASPBERRY_PI_FIRMWARE_PROTOCOL *mFwProtocol;
 
+STATIC UINT32 mDmaMode = ARASAN_DMA_MODE_PIO;
+STATIC ADMA2_DESCRIPTOR_32 *mAdmaTable;
+STATIC EFI_PHYSICAL_ADDRESS mAdmaTableBusAddress;
+STATIC VOID *mAdmaTableMapping;
+
+//
+// With DMA enabled, read/write commands are only issued once the data
+// buffer is known, i.e. from MMCReadBlockData/MMCWriteBlockData.
+//
+STATIC BOOLEAN mDataCmdPending = FALSE;
+STATIC UINT32 mPendingCmd;
+STATIC UINT32 mPendingArgument;
+
 /**
    These SD commands are optional, according to the SD Spec
 **/
@@ -268,11 +281,16 @@ MMCBuildDevicePath (
   return EFI_SUCCESS;
 }
 
+/**
+   Issues an already translated command. A non-zero DmaBlockCount programs
+   the block count and turns on DMA for the data phase.
+**/
+STATIC
 EFI_STATUS
-MMCSendCommand (
-  IN EFI_MMC_HOST_PROTOCOL    *This,
-  IN MMC_CMD                  MmcCmd,
-  IN UINT32                   Argument
+SendTranslatedCommand (
+  IN UINT32 MmcCmd,
+  IN UINT32 Argument,
+  IN UINTN  DmaBlockCount
   )
 {
   UINTN MmcStatus;
@@ -283,17 +301,6 @@ MMCSendCommand (
   BOOLEAN IsDATCmd = FALSE;
   BOOLEAN IsADTCCmd = FALSE;
 
-  DEBUG ((DEBUG_MMCHOST_SD, "ArasanMMCHost: MMCSendCommand(MmcCmd: %08x, Argument: %08x)\n", MmcCmd, Argument));
-
-  if (IgnoreCommand (MmcCmd)) {
-    return EFI_SUCCESS;
-  }
-
-  MmcCmd = TranslateCommand (MmcCmd, Argument);
-  if (MmcCmd == 0xffffffff) {
-    return EFI_UNSUPPORTED;
-  }
-
   if ((MmcCmd & CMD_R1_ADTC) == CMD_R1_ADTC) {
     IsADTCCmd = TRUE;
   }
@@ -330,6 +337,10 @@ MMCSendCommand (
     MmioWrite32 (MMCHS_BLK, 8);
   } else if (!IsAppCmd && MmcCmd == CMD6) {
     MmioWrite32 (MMCHS_BLK, 64);
+  } else if (IsADTCCmd && DmaBlockCount != 0) {
+    MmioWrite32 (MMCHS_BLK, BLEN_512BYTES | SDMA_BOUNDARY_512K |
+      ((UINT32)DmaBlockCount << BLOCK_COUNT_SHIFT));
+    MmcCmd |= DE_ENABLE | BCE_ENABLE;
   } else if (IsADTCCmd) {
     MmioWrite32 (MMCHS_BLK, BLEN_512BYTES);
   }
@@ -394,11 +405,50 @@ Exit:
   if (EFI_ERROR (Status)) {
     LastExecutedCommand = (UINT32) -1;
   } else {
-    LastExecutedCommand = MmcCmd;
+    LastExecutedCommand = MmcCmd & ~(DE_ENABLE | BCE_ENABLE);
   }
   return Status;
 }
 
+EFI_STATUS
+MMCSendCommand (
+  IN EFI_MMC_HOST_PROTOCOL    *This,
+  IN MMC_CMD                  MmcCmd,
+  IN UINT32                   Argument
+  )
+{
+  DEBUG ((DEBUG_MMCHOST_SD, "ArasanMMCHost: MMCSendCommand(MmcCmd: %08x, Argument: %08x)\n", MmcCmd, Argument));
+
+  if (IgnoreCommand (MmcCmd)) {
+    return EFI_SUCCESS;
+  }
+
+  MmcCmd = TranslateCommand (MmcCmd, Argument);
+  if (MmcCmd == 0xffffffff) {
+    return EFI_UNSUPPORTED;
+  }
+
+  if (mDataCmdPending) {
+    DEBUG ((DEBUG_ERROR, "%a(%u): dropping MMC_CMD%u without data transfer\n",
+      __FUNCTION__, __LINE__, MMC_CMD_NUM (mPendingCmd)));
+    mDataCmdPending = FALSE;
+  }
+
+  if (mDmaMode != ARASAN_DMA_MODE_PIO &&
+      (MmcCmd == CMD_READ_SINGLE_BLOCK ||
+       MmcCmd == CMD_READ_MULTIPLE_BLOCK ||
+       MmcCmd == CMD_WRITE_SINGLE_BLOCK ||
+       MmcCmd == CMD_WRITE_MULTIPLE_BLOCK)) {
+    mPendingCmd = MmcCmd;
+    mPendingArgument = Argument;
+    mDataCmdPending = TRUE;
+    LastExecutedCommand = MmcCmd;
+    return EFI_SUCCESS;
+  }
+
+  return SendTranslatedCommand (MmcCmd, Argument, 0);
+}
+
 EFI_STATUS
 MMCNotifyState (
   IN EFI_MMC_HOST_PROTOCOL    *This,
@@ -422,6 +472,8 @@ MMCNotifyState (
       EFI_STATUS Status;
       UINT32 Divisor;
 
+      mDataCmdPending = FALSE;
+
       Status = SoftReset (SRA);
       if (EFI_ERROR (Status)) {
         return Status;
@@ -601,6 +653,168 @@ MMCReceiveResponse (
   return EFI_SUCCESS;
 }
 
+/**
+   Moves the data of the pending read/write command by SDMA or ADMA2.
+
+   Returns EFI_UNSUPPORTED, before anything is sent to the card, if the
+   buffer can't be used for DMA. The caller then falls back to PIO.
+**/
+STATIC
+EFI_STATUS
+DmaTransferBlockData (
+  IN     BOOLEAN  IsRead,
+  IN     UINTN    Length,
+  IN OUT UINT32   *Buffer
+  )
+{
+  EFI_STATUS           Status;
+  EFI_PHYSICAL_ADDRESS BusAddress;
+  EFI_PHYSICAL_ADDRESS SdmaNextAddress;
+  VOID                 *Mapping;
+  UINTN                MappedLength;
+  UINTN                BlockCount;
+  UINTN                Offset;
+  UINTN                Index;
+  UINTN                Chunk;
+  UINTN                MmcStatus;
+  UINTN                RetryCount;
+  UINTN                MaxRetryCount;
+
+  if (Length == 0 || (Length % BLEN_512BYTES) != 0 ||
+      (Length / BLEN_512BYTES) > MAX_DMA_BLOCK_COUNT) {
+    return EFI_UNSUPPORTED;
+  }
+  BlockCount = Length / BLEN_512BYTES;
+
+  MappedLength = Length;
+  Status = DmaMap (IsRead ? MapOperationBusMasterWrite : MapOperationBusMasterRead,
+             Buffer, &MappedLength, &BusAddress, &Mapping);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_VERBOSE, "%a(%u): DmaMap: %r\n", __FUNCTION__, __LINE__, Status));
+    return EFI_UNSUPPORTED;
+  }
+
+  if (MappedLength != Length || (BusAddress + Length) > SIZE_4GB) {
+    DmaUnmap (Mapping);
+    return EFI_UNSUPPORTED;
+  }
+
+  if (mDmaMode == ARASAN_DMA_MODE_ADMA2) {
+    Offset = 0;
+    Index = 0;
+    while (Offset < Length) {
+      Chunk = MIN (Length - Offset, ADMA2_MAX_LENGTH);
+      mAdmaTable[Index].Attributes = ADMA2_VALID | ADMA2_ACT_TRAN;
+      mAdmaTable[Index].Length = (UINT16)Chunk;
+      mAdmaTable[Index].Address = (UINT32)(BusAddress + Offset);
+      Offset += Chunk;
+      Index++;
+    }
+    mAdmaTable[Index - 1].Attributes |= ADMA2_END;
+    MemoryFence ();
+
+    MmioAndThenOr32 (MMCHS_HCTL, (UINT32) ~DMAS_MASK, DMAS_ADMA2_32);
+    MmioWrite32 (MMCHS_ADMA_ADDR, (UINT32)mAdmaTableBusAddress);
+  } else {
+    MmioAndThenOr32 (MMCHS_HCTL, (UINT32) ~DMAS_MASK, DMAS_SDMA);
+    MmioWrite32 (MMCHS_SDMA_ADDR, (UINT32)BusAddress);
+  }
+  SdmaNextAddress = (BusAddress & ~((EFI_PHYSICAL_ADDRESS)SDMA_BOUNDARY_SIZE - 1)) +
+                    SDMA_BOUNDARY_SIZE;
+
+  mDataCmdPending = FALSE;
+  Status = SendTranslatedCommand (mPendingCmd, mPendingArgument, BlockCount);
+  if (EFI_ERROR (Status)) {
+    goto Unmap;
+  }
+
+  mFwProtocol->SetLed (TRUE);
+
+  MmcStatus = 0;
+  RetryCount = 0;
+  MaxRetryCount = MAX_RETRY_COUNT + BlockCount * DMA_RETRY_COUNT_PER_BLOCK;
+  Status = EFI_TIMEOUT;
+  while (RetryCount < MaxRetryCount) {
+    MmcStatus = MmioRead32 (MMCHS_INT_STAT);
+    if ((MmcStatus & ERRI) != 0) {
+      DEBUG ((DEBUG_ERROR, "%a(%u): MMC_CMD%u ERRI MmcStatus 0x%x\n",
+        __FUNCTION__, __LINE__, MMC_CMD_NUM (mPendingCmd), MmcStatus));
+      Status = EFI_DEVICE_ERROR;
+      break;
+    }
+
+    if ((MmcStatus & TC) != 0) {
+      MmioWrite32 (MMCHS_INT_STAT, TC | DINT);
+      Status = EFI_SUCCESS;
+      break;
+    }
+
+    //
+    // SDMA pauses at every SDMA_BOUNDARY_SIZE boundary until the
+    // next address is written.
+    //
+    if ((MmcStatus & DINT) != 0) {
+      MmioWrite32 (MMCHS_INT_STAT, DINT);
+      if (mDmaMode == ARASAN_DMA_MODE_SDMA) {
+        MmioWrite32 (MMCHS_SDMA_ADDR, (UINT32)SdmaNextAddress);
+        SdmaNextAddress += SDMA_BOUNDARY_SIZE;
+      }
+      continue;
+    }
+
+    gBS->Stall (STALL_AFTER_RETRY_US);
+    RetryCount++;
+  }
+
+  mFwProtocol->SetLed (FALSE);
+
+  if (EFI_ERROR (Status)) {
+    if (Status == EFI_TIMEOUT) {
+      DEBUG ((DEBUG_ERROR, "%a(%u): MMC_CMD%u %lu blocks TIMEOUT MmcStatus 0x%x\n",
+        __FUNCTION__, __LINE__, MMC_CMD_NUM (mPendingCmd), (UINT64)BlockCount, MmcStatus));
+    }
+    SoftReset (SRC | SRD);
+  }
+
+Unmap:
+  DmaUnmap (Mapping);
+  return Status;
+}
+
+/**
+   Issues the read/write command deferred by MMCSendCommand, if any.
+
+   Returns EFI_SUCCESS if the data was transferred by DMA, EFI_NOT_STARTED
+   if the command was sent and the data is left to PIO.
+**/
+STATIC
+EFI_STATUS
+StartPendingDataCommand (
+  IN     BOOLEAN  IsRead,
+  IN     UINTN    Length,
+  IN OUT UINT32   *Buffer
+  )
+{
+  EFI_STATUS Status;
+
+  if (!mDataCmdPending) {
+    return EFI_NOT_STARTED;
+  }
+
+  Status = DmaTransferBlockData (IsRead, Length, Buffer);
+  if (Status != EFI_UNSUPPORTED) {
+    return Status;
+  }
+
+  mDataCmdPending = FALSE;
+  Status = SendTranslatedCommand (mPendingCmd, mPendingArgument, 0);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  return EFI_NOT_STARTED;
+}
+
 EFI_STATUS
 MMCReadBlockData (
   IN EFI_MMC_HOST_PROTOCOL    *This,
@@ -612,6 +826,7 @@ MMCReadBlockData (
   UINTN MmcStatus;
   UINTN RemLength;
   UINTN Count;
+  EFI_STATUS Status;
 
   DEBUG ((DEBUG_VERBOSE, "%a(%u): LBA: 0x%x, Length: 0x%x, Buffer: 0x%x)\n",
     __FUNCTION__, __LINE__, Lba, Length, Buffer));
@@ -626,6 +841,11 @@ MMCReadBlockData (
     return EFI_INVALID_PARAMETER;
   }
 
+  Status = StartPendingDataCommand (TRUE, Length, Buffer);
+  if (Status != EFI_NOT_STARTED) {
+    return Status;
+  }
+
   RemLength = Length;
   while (RemLength != 0) {
     UINTN RetryCount = 0;
@@ -676,6 +896,7 @@ MMCWriteBlockData (
   UINTN MmcStatus;
   UINTN RemLength;
   UINTN Count;
+  EFI_STATUS Status;
 
   DEBUG ((DEBUG_VERBOSE, "%a(%u): LBA: 0x%x, Length: 0x%x, Buffer: 0x%x)\n",
     __FUNCTION__, __LINE__, Lba, Length, Buffer));
@@ -690,6 +911,11 @@ MMCWriteBlockData (
     return EFI_INVALID_PARAMETER;
   }
 
+  Status = StartPendingDataCommand (FALSE, Length, Buffer);
+  if (Status != EFI_NOT_STARTED) {
+    return Status;
+  }
+
   RemLength = Length;
   while (RemLength != 0) {
     UINTN RetryCount = 0;
@@ -752,6 +978,62 @@ EFI_MMC_HOST_PROTOCOL gMMCHost =
   MMCIsMultiBlock
 };
 
+/**
+   Picks the data transfer mode from PcdArasanDmaMode and what the
+   controller advertises, falling back from ADMA2 to SDMA to PIO.
+**/
+STATIC
+VOID
+InitializeDmaMode (
+  VOID
+  )
+{
+  EFI_STATUS Status;
+  UINT32 Capabilities;
+  UINTN TableSize;
+
+  mDmaMode = PcdGet32 (PcdArasanDmaMode);
+  Capabilities = MmioRead32 (MMCHS_CAPA);
+
+  if (mDmaMode == ARASAN_DMA_MODE_ADMA2) {
+    if ((Capabilities & ADMA2_SUPPORT) == 0) {
+      DEBUG ((DEBUG_INFO, "ArasanMMCHost: ADMA2 not supported\n"));
+      mDmaMode = ARASAN_DMA_MODE_SDMA;
+    } else {
+      Status = DmaAllocateBuffer (EfiBootServicesData, ADMA2_TABLE_PAGES,
+                 (VOID**)&mAdmaTable);
+      if (!EFI_ERROR (Status)) {
+        TableSize = EFI_PAGES_TO_SIZE (ADMA2_TABLE_PAGES);
+        Status = DmaMap (MapOperationBusMasterCommonBuffer, mAdmaTable,
+                   &TableSize, &mAdmaTableBusAddress, &mAdmaTableMapping);
+        if (EFI_ERROR (Status)) {
+          DmaFreeBuffer (ADMA2_TABLE_PAGES, mAdmaTable);
+        }
+      }
+      if (EFI_ERROR (Status)) {
+        DEBUG ((DEBUG_ERROR, "%a: failed to set up ADMA2 table (Status == %r)\n",
+          __FUNCTION__, Status));
+        mAdmaTable = NULL;
+        mDmaMode = ARASAN_DMA_MODE_SDMA;
+      }
+    }
+  }
+
+  if (mDmaMode == ARASAN_DMA_MODE_SDMA &&
+      (Capabilities & SDMA_SUPPORT) == 0) {
+    DEBUG ((DEBUG_INFO, "ArasanMMCHost: SDMA not supported\n"));
+    mDmaMode = ARASAN_DMA_MODE_PIO;
+  }
+
+  if (mDmaMode > ARASAN_DMA_MODE_ADMA2) {
+    mDmaMode = ARASAN_DMA_MODE_PIO;
+  }
+
+  DEBUG ((DEBUG_INFO, "ArasanMMCHost: using %a data transfers\n",
+    mDmaMode == ARASAN_DMA_MODE_ADMA2 ? "ADMA2" :
+    mDmaMode == ARASAN_DMA_MODE_SDMA ? "SDMA" : "PIO"));
+}
+
 EFI_STATUS
 MMCInitialize (
   IN EFI_HANDLE          ImageHandle,
@@ -775,6 +1057,8 @@ MMCInitialize (
     return Status;
   }
 
+  InitializeDmaMode ();
+
   Status = gBS->InstallMultipleProtocolInterfaces (
                   &Handle,
                   &gRaspberryPiMmcHostProtocolGuid,
@@ -41,4 +41,33 @@
 
 #define MAX_DIVISOR_VALUE 1023
 
+//
+// Data transfer modes selected by PcdArasanDmaMode.
+//
+#define ARASAN_DMA_MODE_PIO   0
+#define ARASAN_DMA_MODE_SDMA  1
+#define ARASAN_DMA_MODE_ADMA2 2
+
+//
+// Largest transfer MmcDxe issues is 0xFFFF blocks, which takes at most
+// 512 full-length ADMA2 descriptors.
+//
+#define MAX_DMA_BLOCK_COUNT   0xFFFF
+#define ADMA2_DESCRIPTOR_COUNT \
+  ((MAX_DMA_BLOCK_COUNT * BLEN_512BYTES + ADMA2_MAX_LENGTH - 1) / ADMA2_MAX_LENGTH)
+#define ADMA2_TABLE_PAGES     \
+  EFI_SIZE_TO_PAGES (ADMA2_DESCRIPTOR_COUNT * sizeof (ADMA2_DESCRIPTOR_32))
+
+//
+// DMA completion budget, in STALL_AFTER_RETRY_US units per 512-byte block
+// on top of MAX_RETRY_COUNT.
+//
+#define DMA_RETRY_COUNT_PER_BLOCK 50
+
+typedef struct {
+  UINT16 Attributes;
+  UINT16 Length;
+  UINT32 Address;
+} ADMA2_DESCRIPTOR_32;
+
 #endif
@@ -21,6 +21,7 @@
 #include <Library/IoLib.h>
 #include <Library/NetLib.h>
 #include <Library/UefiBootServicesTableLib.h>
+#include <Library/UefiLib.h>
 #include <Library/UefiRuntimeServicesTableLib.h>
 #include <Protocol/BcmGenetPlatformDevice.h>
 #include <Protocol/RpiFirmware.h>
@@ -385,12 +386,17 @@ ApplyVariables (
     }
   }
 
+  /*
+   * Reading the speed back is only worth a mailbox round trip for the log.
+   */
+  DEBUG_CODE_BEGIN ();
   Status = mFwProtocol->GetClockRate (RPI_MBOX_CLOCK_RATE_ARM, &Rate);
   if (Status != EFI_SUCCESS) {
     DEBUG ((DEBUG_ERROR, "Couldn't get the CPU speed: %r\n", Status));
   } else {
     DEBUG ((DEBUG_INFO, "Current CPU speed is %u MHz\n", Rate / FREQ_1_MHZ));
   }
+  DEBUG_CODE_END ();
 
   if (mModelFamily >= 4 && PcdGet32 (PcdRamMoreThan3GB) != 0 &&
       PcdGet32 (PcdRamLimitTo3GB) == 0) {
@@ -532,6 +538,9 @@ ApplyVariables (
    * 9           TCK         GPIO25    ALT4    22
    * 11          RTCK        GPIO23    ALT4    16
    * 13          TDO         GPIO24    ALT4    18
+   *
+   * Routing JTAG is wanted right away, to debug the firmware itself. Turning
+   * it off only matters to the OS, see ApplyDeferredVariables ().
    */
   if (PcdGet32 (PcdDebugEnableJTAG)) {
     GpioPinFuncSet (22, GPIO_FSEL_ALT4);
@@ -540,7 +549,25 @@ ApplyVariables (
     GpioPinFuncSet (25, GPIO_FSEL_ALT4);
     GpioPinFuncSet (23, GPIO_FSEL_ALT4);
     GpioPinFuncSet (24, GPIO_FSEL_ALT4);
-  } else {
+  }
+}
+
+
+/*
+ * Settings that no device on the boot path depends on, applied at
+ * ReadyToBoot instead of on the DXE critical path.
+ */
+STATIC
+VOID
+EFIAPI
+ApplyDeferredVariables (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  gBS->CloseEvent (Event);
+
+  if (!PcdGet32 (PcdDebugEnableJTAG)) {
     GpioPinFuncSet (22, GPIO_FSEL_INPUT);
     GpioPinFuncSet (4, GPIO_FSEL_INPUT);
     GpioPinFuncSet (27, GPIO_FSEL_INPUT);
@@ -560,6 +587,7 @@ ConfigInitialize (
 {
   EFI_STATUS                      Status;
   EFI_EVENT                       EndOfDxeEvent;
+  EFI_EVENT                       ReadyToBootEvent;
 
   Status = gBS->LocateProtocol (&gRaspberryPiFirmwareProtocolGuid,
                   NULL, (VOID**)&mFwProtocol);
@@ -588,6 +616,10 @@ ConfigInitialize (
   }
 
   ApplyVariables ();
+  Status = EfiCreateEventReadyToBootEx (TPL_CALLBACK, ApplyDeferredVariables,
+             NULL, &ReadyToBootEvent);
+  ASSERT_EFI_ERROR (Status);
+
   Status = gBS->InstallProtocolInterface (&ImageHandle,
                   &gRaspberryPiConfigAppliedProtocolGuid,
                   EFI_NATIVE_INTERFACE,
@@ -23,6 +23,11 @@
                                 (posY) * This->Mode->Info->PixelsPerScanLine * \
                                 PI3_BYTES_PER_PIXEL +                   \
                                 (posX) * PI3_BYTES_PER_PIXEL))
+#define POS_TO_SHADOW(posX, posY) ((UINT8*)                             \
+                               ((UINTN)mShadowFb +                      \
+                                (posY) * This->Mode->Info->PixelsPerScanLine * \
+                                PI3_BYTES_PER_PIXEL +                   \
+                                (posX) * PI3_BYTES_PER_PIXEL))
 
 STATIC
 EFI_STATUS
@@ -111,6 +116,16 @@ STATIC EFI_HANDLE mDevice;
 STATIC RASPBERRY_PI_FIRMWARE_PROTOCOL *mFwProtocol;
 STATIC EFI_CPU_ARCH_PROTOCOL *mCpu;
 
+/*
+ * Cached copy of the framebuffer contents. The framebuffer itself is
+ * mapped write-combining, which makes reads from it very slow, so Blt
+ * reads (and scrolling in particular) are served from here instead and
+ * the framebuffer is only ever written. If the shadow could not be
+ * allocated, this points at the framebuffer itself.
+ */
+STATIC UINT8 *mShadowFb;
+STATIC UINTN mShadowFbPages;
+
 STATIC UINTN mLastMode;
 STATIC GOP_MODE_DATA mGopModeTemplate[] = {
   { 800,  600  }, /* Legacy */
@@ -251,18 +266,30 @@ DisplaySetMode (
   }
 
   /*
-   * WT, because certain OS loaders access the frame buffer directly
+   * WC, because certain OS loaders access the frame buffer directly
    * and we don't want to see corruption due to missing WB cache
-   * maintenance. Performance with WT is good.
+   * maintenance. Writes are combined into bursts, but reads are slow,
+   * so the Blt code below never reads back from the frame buffer.
    */
   Status = mCpu->SetMemoryAttributes (mCpu, FbBase,
                    ALIGN_VALUE (FbSize, EFI_PAGE_SIZE),
-                   EFI_MEMORY_WT);
+                   EFI_MEMORY_WC);
   if (Status != EFI_SUCCESS) {
     DEBUG ((DEBUG_ERROR, "Couldn't set framebuffer attributes: %r\n", Status));
     return Status;
   }
 
+  if (mShadowFb != NULL &&
+      mShadowFb != (UINT8*)(UINTN)This->Mode->FrameBufferBase) {
+    FreePages (mShadowFb, mShadowFbPages);
+  }
+  mShadowFbPages = EFI_SIZE_TO_PAGES (FbSize);
+  mShadowFb = AllocatePages (mShadowFbPages);
+  if (mShadowFb == NULL) {
+    DEBUG ((DEBUG_WARN, "Couldn't allocate shadow framebuffer, Blt will be slow\n"));
+    mShadowFb = (UINT8*)(UINTN)FbBase;
+  }
+
   This->Mode->Mode = ModeNumber;
   This->Mode->Info->Version = 0;
   This->Mode->Info->HorizontalResolution = Mode->Width;
@@ -280,6 +307,38 @@ DisplaySetMode (
   return EFI_SUCCESS;
 }
 
+/*
+ * Copy a rectangle of the shadow framebuffer out to the real one. Full
+ * width rectangles are contiguous and go out as a single copy.
+ */
+STATIC
+VOID
+FlushShadow (
+  IN  EFI_GRAPHICS_OUTPUT_PROTOCOL      *This,
+  IN  UINTN                             X,
+  IN  UINTN                             Y,
+  IN  UINTN                             Width,
+  IN  UINTN                             Height
+  )
+{
+  UINTN i;
+
+  if (mShadowFb == (UINT8*)(UINTN)This->Mode->FrameBufferBase) {
+    return;
+  }
+
+  if (Width == This->Mode->Info->PixelsPerScanLine) {
+    CopyMem (POS_TO_FB (0, Y), POS_TO_SHADOW (0, Y),
+      Width * Height * PI3_BYTES_PER_PIXEL);
+    return;
+  }
+
+  for (i = 0; i < Height; i++) {
+    CopyMem (POS_TO_FB (X, Y + i), POS_TO_SHADOW (X, Y + i),
+      Width * PI3_BYTES_PER_PIXEL);
+  }
+}
+
 STATIC
 EFI_STATUS
 EFIAPI
@@ -298,16 +357,31 @@ DisplayBlt (
 {
   UINT8 *VidBuf, *BltBuf, *VidBuf1;
   UINTN i;
+  UINTN Stride;
+
+  Stride = This->Mode->Info->PixelsPerScanLine * PI3_BYTES_PER_PIXEL;
 
   switch (BltOperation) {
   case EfiBltVideoFill:
-    BltBuf = (UINT8*)BltBuffer;
+    if (Height == 0) {
+      break;
+    }
 
-    for (i = 0; i < Height; i++) {
-      VidBuf = POS_TO_FB (DestinationX, DestinationY + i);
+    BltBuf = (UINT8*)BltBuffer;
 
-      SetMem32 (VidBuf, Width * PI3_BYTES_PER_PIXEL, *(UINT32*)BltBuf);
+    /*
+     * Fill the first line, then replicate it with (much wider) copies.
+     */
+    VidBuf = POS_TO_SHADOW (DestinationX, DestinationY);
+    SetMem32 (VidBuf, Width * PI3_BYTES_PER_PIXEL, *(UINT32*)BltBuf);
+    if (Width == This->Mode->Info->PixelsPerScanLine) {
+      SetMem32 (VidBuf + Stride, (Height - 1) * Stride, *(UINT32*)BltBuf);
+    } else {
+      for (i = 1; i < Height; i++) {
+        CopyMem (VidBuf + i * Stride, VidBuf, Width * PI3_BYTES_PER_PIXEL);
+      }
     }
+    FlushShadow (This, DestinationX, DestinationY, Width, Height);
     break;
 
   case EfiBltVideoToBltBuffer:
@@ -316,12 +390,12 @@ DisplayBlt (
     }
 
     for (i = 0; i < Height; i++) {
-      VidBuf = POS_TO_FB (SourceX, SourceY + i);
+      VidBuf = POS_TO_SHADOW (SourceX, SourceY + i);
 
       BltBuf = (UINT8*)((UINTN)BltBuffer + (DestinationY + i) * Delta +
         DestinationX * PI3_BYTES_PER_PIXEL);
 
-      gBS->CopyMem ((VOID*)BltBuf, (VOID*)VidBuf, PI3_BYTES_PER_PIXEL * Width);
+      CopyMem ((VOID*)BltBuf, (VOID*)VidBuf, PI3_BYTES_PER_PIXEL * Width);
     }
     break;
 
@@ -331,21 +405,42 @@ DisplayBlt (
     }
 
     for (i = 0; i < Height; i++) {
-      VidBuf = POS_TO_FB (DestinationX, DestinationY + i);
+      VidBuf = POS_TO_SHADOW (DestinationX, DestinationY + i);
       BltBuf = (UINT8*)((UINTN)BltBuffer + (SourceY + i) * Delta +
         SourceX * PI3_BYTES_PER_PIXEL);
 
-      gBS->CopyMem ((VOID*)VidBuf, (VOID*)BltBuf, Width * PI3_BYTES_PER_PIXEL);
+      CopyMem ((VOID*)VidBuf, (VOID*)BltBuf, Width * PI3_BYTES_PER_PIXEL);
     }
+    FlushShadow (This, DestinationX, DestinationY, Width, Height);
     break;
 
   case EfiBltVideoToVideo:
-    for (i = 0; i < Height; i++) {
-      VidBuf = POS_TO_FB (SourceX, SourceY + i);
-      VidBuf1 = POS_TO_FB (DestinationX, DestinationY + i);
+    if (Width == This->Mode->Info->PixelsPerScanLine) {
+      /*
+       * Full width (i.e. console scrolling): one overlap-safe move.
+       */
+      CopyMem (POS_TO_SHADOW (0, DestinationY), POS_TO_SHADOW (0, SourceY),
+        Height * Stride);
+    } else if (DestinationY > SourceY) {
+      /*
+       * Copy bottom-up so overlapping source lines aren't overwritten
+       * before they have been copied.
+       */
+      for (i = Height; i > 0; i--) {
+        VidBuf = POS_TO_SHADOW (SourceX, SourceY + i - 1);
+        VidBuf1 = POS_TO_SHADOW (DestinationX, DestinationY + i - 1);
+
+        CopyMem ((VOID*)VidBuf1, (VOID*)VidBuf, Width * PI3_BYTES_PER_PIXEL);
+      }
+    } else {
+      for (i = 0; i < Height; i++) {
+        VidBuf = POS_TO_SHADOW (SourceX, SourceY + i);
+        VidBuf1 = POS_TO_SHADOW (DestinationX, DestinationY + i);
 
-      gBS->CopyMem ((VOID*)VidBuf1, (VOID*)VidBuf, Width * PI3_BYTES_PER_PIXEL);
+        CopyMem ((VOID*)VidBuf1, (VOID*)VidBuf, Width * PI3_BYTES_PER_PIXEL);
+      }
     }
+    FlushShadow (This, DestinationX, DestinationY, Width, Height);
     break;
 
   default:
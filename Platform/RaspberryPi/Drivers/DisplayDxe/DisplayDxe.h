@@ -23,6 +23,7 @@
 #include <Protocol/GraphicsOutput.h>
 #include <Protocol/DevicePath.h>
 #include <Protocol/RpiFirmware.h>
+#include <Protocol/SimpleFileSystem.h>
 
 extern EFI_GRAPHICS_OUTPUT_PROTOCOL gDisplayProto;
 extern EFI_COMPONENT_NAME_PROTOCOL  gComponentName;
@@ -33,4 +34,10 @@ RegisterScreenshotHandlers (
   VOID
   );
 
+EFI_STATUS
+PngWriteScreen (
+  IN EFI_GRAPHICS_OUTPUT_PROTOCOL *GraphicsOutput,
+  IN EFI_FILE_PROTOCOL            *File
+  );
+
 #endif /* _DISPLAY_H_ */
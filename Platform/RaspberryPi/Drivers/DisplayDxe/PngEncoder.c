@@ -0,0 +1,642 @@
+/** @file
+ *
+ *  Streaming PNG encoder for screenshots.
+ *
+ *  The screen is read back one row at a time, each row gets the PNG
+ *  filter that makes it most compressible and is then deflated
+ *  (LZ77 over the previous and current row, fixed Huffman codes)
+ *  straight into fixed-size IDAT chunks that are written out as they
+ *  fill. Memory use depends only on the screen width.
+ *
+ *  SPDX-License-Identifier: BSD-2-Clause-Patent
+ *
+ **/
+
+#include "DisplayDxe.h"
+
+/*
+ * Size of the data part of each IDAT chunk.
+ */
+#define PNG_IDAT_SIZE         SIZE_32KB
+/*
+ * Length, type and CRC around the data of each chunk.
+ */
+#define PNG_CHUNK_OVERHEAD    12
+#define PNG_BYTES_PER_PIXEL   3
+
+#define PNG_FILTER_NONE       0
+#define PNG_FILTER_SUB        1
+#define PNG_FILTER_UP         2
+#define PNG_FILTER_AVERAGE    3
+#define PNG_FILTER_PAETH      4
+#define PNG_FILTER_COUNT      5
+
+#define DEFLATE_HASH_BITS     13
+#define DEFLATE_HASH_SIZE     (1 << DEFLATE_HASH_BITS)
+#define DEFLATE_MIN_MATCH     3
+#define DEFLATE_MAX_MATCH     258
+#define DEFLATE_MAX_DISTANCE  32768
+#define DEFLATE_END_OF_BLOCK  256
+
+#define ADLER_MOD             65521
+/*
+ * Largest number of bytes that can be summed before the Adler-32
+ * accumulators have to be reduced modulo ADLER_MOD.
+ */
+#define ADLER_NMAX            5552
+
+typedef struct {
+  EFI_FILE_PROTOCOL *File;
+  EFI_STATUS        Status;
+  /*
+   * Chunk being filled: room for length and type, PNG_IDAT_SIZE bytes
+   * of data, then the CRC.
+   */
+  UINT8             *Chunk;
+  UINTN             ChunkLength;
+  UINT32            BitBuffer;
+  UINTN             BitCount;
+  UINT32            Adler;
+  /*
+   * LZ77 window: the previous and the current filtered row. Hash
+   * entries are absolute stream positions plus one (zero is empty),
+   * WindowBase is the stream position of Window[0].
+   */
+  UINT8             *Window;
+  UINTN             WindowLength;
+  UINTN             WindowBase;
+  UINT32            *Head;
+  UINTN             RowBytes;
+} PNG_ENCODER;
+
+STATIC CONST UINT8 mPngSignature[] = {
+  0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'
+};
+
+STATIC CONST UINT16 mLengthBase[] = {
+  3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+  35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+
+STATIC CONST UINT8 mLengthExtra[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+
+STATIC CONST UINT16 mDistanceBase[] = {
+  1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+  257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+  8193, 12289, 16385, 24577
+};
+
+STATIC CONST UINT8 mDistanceExtra[] = {
+  0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+  7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+STATIC UINT32 mCrcTable[256];
+
+STATIC
+VOID
+PngInitCrcTable (
+  VOID
+  )
+{
+  UINT32 Crc;
+  UINTN  Index;
+  UINTN  Bit;
+
+  if (mCrcTable[1] != 0) {
+    return;
+  }
+
+  for (Index = 0; Index < ARRAY_SIZE (mCrcTable); Index++) {
+    Crc = (UINT32)Index;
+    for (Bit = 0; Bit < 8; Bit++) {
+      Crc = (Crc & 1) ? (0xedb88320 ^ (Crc >> 1)) : (Crc >> 1);
+    }
+    mCrcTable[Index] = Crc;
+  }
+}
+
+STATIC
+UINT32
+PngUpdateCrc (
+  IN UINT32      Crc,
+  IN CONST UINT8 *Data,
+  IN UINTN       Length
+  )
+{
+  while (Length-- > 0) {
+    Crc = mCrcTable[(Crc ^ *Data++) & 0xff] ^ (Crc >> 8);
+  }
+  return Crc;
+}
+
+STATIC
+VOID
+PngPutUint32 (
+  OUT UINT8  *Buffer,
+  IN  UINT32 Value
+  )
+{
+  Buffer[0] = (UINT8)(Value >> 24);
+  Buffer[1] = (UINT8)(Value >> 16);
+  Buffer[2] = (UINT8)(Value >> 8);
+  Buffer[3] = (UINT8)Value;
+}
+
+/*
+ * Write a chunk whose Length data bytes are at Buffer + 8. The length,
+ * type and CRC are filled in around them, so that the whole chunk goes
+ * out in a single write.
+ */
+STATIC
+VOID
+PngWriteChunk (
+  IN PNG_ENCODER *Enc,
+  IN CONST CHAR8 *Type,
+  IN UINT8       *Buffer,
+  IN UINTN       Length
+  )
+{
+  UINTN Size;
+
+  if (EFI_ERROR (Enc->Status)) {
+    return;
+  }
+
+  PngPutUint32 (Buffer, (UINT32)Length);
+  CopyMem (Buffer + 4, Type, 4);
+  PngPutUint32 (Buffer + 8 + Length,
+    ~PngUpdateCrc (MAX_UINT32, Buffer + 4, Length + 4));
+
+  Size = Length + PNG_CHUNK_OVERHEAD;
+  Enc->Status = Enc->File->Write (Enc->File, &Size, Buffer);
+}
+
+STATIC
+VOID
+PngFlushIdat (
+  IN PNG_ENCODER *Enc
+  )
+{
+  if (Enc->ChunkLength != 0) {
+    PngWriteChunk (Enc, "IDAT", Enc->Chunk, Enc->ChunkLength);
+    Enc->ChunkLength = 0;
+  }
+}
+
+STATIC
+VOID
+PngPutByte (
+  IN PNG_ENCODER *Enc,
+  IN UINT8       Byte
+  )
+{
+  Enc->Chunk[8 + Enc->ChunkLength++] = Byte;
+  if (Enc->ChunkLength == PNG_IDAT_SIZE) {
+    PngFlushIdat (Enc);
+  }
+}
+
+/*
+ * Deflate packs values LSB first.
+ */
+STATIC
+VOID
+PngPutBits (
+  IN PNG_ENCODER *Enc,
+  IN UINT32      Value,
+  IN UINTN       Count
+  )
+{
+  Enc->BitBuffer |= Value << Enc->BitCount;
+  Enc->BitCount += Count;
+  while (Enc->BitCount >= 8) {
+    PngPutByte (Enc, (UINT8)Enc->BitBuffer);
+    Enc->BitBuffer >>= 8;
+    Enc->BitCount -= 8;
+  }
+}
+
+/*
+ * ...but Huffman codes MSB first.
+ */
+STATIC
+VOID
+PngPutCode (
+  IN PNG_ENCODER *Enc,
+  IN UINT32      Code,
+  IN UINTN       Length
+  )
+{
+  UINT32 Reversed;
+  UINTN  Index;
+
+  Reversed = 0;
+  for (Index = 0; Index < Length; Index++) {
+    Reversed = (Reversed << 1) | ((Code >> Index) & 1);
+  }
+  PngPutBits (Enc, Reversed, Length);
+}
+
+/*
+ * Literal/length symbol, using the fixed Huffman code.
+ */
+STATIC
+VOID
+PngPutSymbol (
+  IN PNG_ENCODER *Enc,
+  IN UINTN       Symbol
+  )
+{
+  if (Symbol <= 143) {
+    PngPutCode (Enc, 0x30 + (UINT32)Symbol, 8);
+  } else if (Symbol <= 255) {
+    PngPutCode (Enc, 0x190 + (UINT32)(Symbol - 144), 9);
+  } else if (Symbol <= 279) {
+    PngPutCode (Enc, (UINT32)(Symbol - 256), 7);
+  } else {
+    PngPutCode (Enc, 0xc0 + (UINT32)(Symbol - 280), 8);
+  }
+}
+
+STATIC
+VOID
+PngPutMatch (
+  IN PNG_ENCODER *Enc,
+  IN UINTN       Length,
+  IN UINTN       Distance
+  )
+{
+  UINTN Code;
+
+  Code = ARRAY_SIZE (mLengthBase) - 1;
+  while (mLengthBase[Code] > Length) {
+    Code--;
+  }
+  PngPutSymbol (Enc, 257 + Code);
+  PngPutBits (Enc, (UINT32)(Length - mLengthBase[Code]), mLengthExtra[Code]);
+
+  Code = ARRAY_SIZE (mDistanceBase) - 1;
+  while (mDistanceBase[Code] > Distance) {
+    Code--;
+  }
+  PngPutCode (Enc, (UINT32)Code, 5);
+  PngPutBits (Enc, (UINT32)(Distance - mDistanceBase[Code]), mDistanceExtra[Code]);
+}
+
+STATIC
+VOID
+PngUpdateAdler (
+  IN PNG_ENCODER *Enc,
+  IN CONST UINT8 *Data,
+  IN UINTN       Length
+  )
+{
+  UINT32 A;
+  UINT32 B;
+  UINTN  Run;
+
+  A = Enc->Adler & 0xffff;
+  B = Enc->Adler >> 16;
+  while (Length > 0) {
+    Run = MIN (Length, ADLER_NMAX);
+    Length -= Run;
+    while (Run-- > 0) {
+      A += *Data++;
+      B += A;
+    }
+    A %= ADLER_MOD;
+    B %= ADLER_MOD;
+  }
+  Enc->Adler = (B << 16) | A;
+}
+
+STATIC
+UINTN
+PngHash (
+  IN CONST UINT8 *Data
+  )
+{
+  UINT32 Value;
+
+  Value = ((UINT32)Data[0] << 16) | ((UINT32)Data[1] << 8) | Data[2];
+  return (UINTN)((Value * 2654435761U) >> (32 - DEFLATE_HASH_BITS));
+}
+
+/*
+ * Deflate one filtered row as a fixed Huffman block. Matches may
+ * reach back into the previous row but not past the end of this one.
+ */
+STATIC
+VOID
+PngDeflateRow (
+  IN PNG_ENCODER *Enc,
+  IN CONST UINT8 *Row
+  )
+{
+  UINTN  Pos;
+  UINTN  End;
+  UINTN  Hash;
+  UINTN  Candidate;
+  UINTN  Length;
+  UINTN  MaxLength;
+  UINTN  Index;
+  UINT8  *Window;
+
+  if (Enc->WindowLength + Enc->RowBytes > 2 * Enc->RowBytes) {
+    CopyMem (Enc->Window, Enc->Window + Enc->RowBytes, Enc->RowBytes);
+    Enc->WindowBase += Enc->RowBytes;
+    Enc->WindowLength -= Enc->RowBytes;
+  }
+
+  Window = Enc->Window;
+  Pos = Enc->WindowLength;
+  CopyMem (Window + Pos, Row, Enc->RowBytes);
+  Enc->WindowLength += Enc->RowBytes;
+  End = Enc->WindowLength;
+  PngUpdateAdler (Enc, Row, Enc->RowBytes);
+
+  /*
+   * BFINAL = 0, BTYPE = 01 (fixed Huffman codes).
+   */
+  PngPutBits (Enc, 0, 1);
+  PngPutBits (Enc, 1, 2);
+
+  while (Pos < End) {
+    Length = 0;
+    if (Pos + DEFLATE_MIN_MATCH <= End) {
+      Hash = PngHash (Window + Pos);
+      Candidate = Enc->Head[Hash];
+      Enc->Head[Hash] = (UINT32)(Enc->WindowBase + Pos + 1);
+
+      if (Candidate > Enc->WindowBase &&
+          Enc->WindowBase + Pos - (Candidate - 1) <= DEFLATE_MAX_DISTANCE) {
+        Candidate -= Enc->WindowBase + 1;
+        MaxLength = MIN (End - Pos, DEFLATE_MAX_MATCH);
+        while (Length < MaxLength &&
+               Window[Candidate + Length] == Window[Pos + Length]) {
+          Length++;
+        }
+      }
+    }
+
+    if (Length < DEFLATE_MIN_MATCH) {
+      PngPutSymbol (Enc, Window[Pos]);
+      Pos++;
+      continue;
+    }
+
+    PngPutMatch (Enc, Length, Pos - Candidate);
+    for (Index = 1; Index < Length && Pos + Index + DEFLATE_MIN_MATCH <= End; Index++) {
+      Enc->Head[PngHash (Window + Pos + Index)] =
+        (UINT32)(Enc->WindowBase + Pos + Index + 1);
+    }
+    Pos += Length;
+  }
+
+  PngPutSymbol (Enc, DEFLATE_END_OF_BLOCK);
+}
+
+STATIC
+UINT8
+PngPaeth (
+  IN UINT8 A,
+  IN UINT8 B,
+  IN UINT8 C
+  )
+{
+  INTN P;
+  INTN PA;
+  INTN PB;
+  INTN PC;
+
+  P = (INTN)A + B - C;
+  PA = ABS (P - A);
+  PB = ABS (P - B);
+  PC = ABS (P - C);
+  if (PA <= PB && PA <= PC) {
+    return A;
+  }
+  return (PB <= PC) ? B : C;
+}
+
+/*
+ * Apply Filter to the raw row Cur (Prev is the raw row above it) into
+ * Out, and return the sum of the filtered bytes taken as signed
+ * values: the usual heuristic for which filter compresses best.
+ */
+STATIC
+UINTN
+PngFilterRow (
+  IN  UINT8       Filter,
+  IN  CONST UINT8 *Cur,
+  IN  CONST UINT8 *Prev,
+  IN  UINTN       Length,
+  OUT UINT8       *Out
+  )
+{
+  UINTN Index;
+  UINT8 A;
+  UINT8 B;
+  UINT8 C;
+  UINT8 Value;
+  UINTN Sum;
+
+  Out[0] = Filter;
+  Sum = 0;
+  for (Index = 0; Index < Length; Index++) {
+    A = (Index >= PNG_BYTES_PER_PIXEL) ? Cur[Index - PNG_BYTES_PER_PIXEL] : 0;
+    B = Prev[Index];
+    C = (Index >= PNG_BYTES_PER_PIXEL) ? Prev[Index - PNG_BYTES_PER_PIXEL] : 0;
+
+    switch (Filter) {
+    case PNG_FILTER_SUB:
+      Value = (UINT8)(Cur[Index] - A);
+      break;
+    case PNG_FILTER_UP:
+      Value = (UINT8)(Cur[Index] - B);
+      break;
+    case PNG_FILTER_AVERAGE:
+      Value = (UINT8)(Cur[Index] - ((UINTN)A + B) / 2);
+      break;
+    case PNG_FILTER_PAETH:
+      Value = (UINT8)(Cur[Index] - PngPaeth (A, B, C));
+      break;
+    default:
+      Value = Cur[Index];
+      break;
+    }
+
+    Out[1 + Index] = Value;
+    Sum += (Value < 0x80) ? Value : 0x100 - Value;
+  }
+
+  return Sum;
+}
+
+/**
+  Write the current contents of the screen to File as a PNG image.
+
+  @param  GraphicsOutput   Display to capture.
+  @param  File             Open, empty file to write to.
+
+  @retval EFI_SUCCESS           The image was written.
+  @retval EFI_OUT_OF_RESOURCES  Couldn't allocate the encoder buffers.
+  @retval other                 Reading the screen or writing the file failed.
+
+**/
+EFI_STATUS
+PngWriteScreen (
+  IN EFI_GRAPHICS_OUTPUT_PROTOCOL *GraphicsOutput,
+  IN EFI_FILE_PROTOCOL            *File
+  )
+{
+  PNG_ENCODER                   Enc;
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL *Pixels;
+  UINT8                         *Prev;
+  UINT8                         *Cur;
+  UINT8                         *Best;
+  UINT8                         *Try;
+  UINT8                         *Swap;
+  UINT8                         Header[PNG_CHUNK_OVERHEAD + 13];
+  UINT32                        Width;
+  UINT32                        Height;
+  UINTN                         Size;
+  UINTN                         X;
+  UINTN                         Y;
+  UINTN                         Score;
+  UINTN                         BestScore;
+  UINT8                         Filter;
+  EFI_STATUS                    Status;
+
+  PngInitCrcTable ();
+
+  Width = GraphicsOutput->Mode->Info->HorizontalResolution;
+  Height = GraphicsOutput->Mode->Info->VerticalResolution;
+
+  ZeroMem (&Enc, sizeof (Enc));
+  Enc.File = File;
+  Enc.Adler = 1;
+  Enc.RowBytes = 1 + Width * PNG_BYTES_PER_PIXEL;
+  Enc.Chunk = AllocatePool (PNG_IDAT_SIZE + PNG_CHUNK_OVERHEAD);
+  Enc.Window = AllocatePool (2 * Enc.RowBytes);
+  Enc.Head = AllocateZeroPool (DEFLATE_HASH_SIZE * sizeof (UINT32));
+  Pixels = AllocatePool (Width * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL));
+  Prev = AllocateZeroPool (Enc.RowBytes);
+  Cur = AllocatePool (Enc.RowBytes);
+  Best = AllocatePool (Enc.RowBytes);
+  Try = AllocatePool (Enc.RowBytes);
+
+  if (Enc.Chunk == NULL || Enc.Window == NULL || Enc.Head == NULL ||
+      Pixels == NULL || Prev == NULL || Cur == NULL || Best == NULL ||
+      Try == NULL) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto Done;
+  }
+
+  Size = sizeof (mPngSignature);
+  Status = File->Write (File, &Size, (VOID*)mPngSignature);
+  if (EFI_ERROR (Status)) {
+    goto Done;
+  }
+
+  /*
+   * 8-bit RGB, deflate, adaptive filtering, no interlace.
+   */
+  PngPutUint32 (Header + 8, Width);
+  PngPutUint32 (Header + 12, Height);
+  Header[16] = 8;
+  Header[17] = 2;
+  Header[18] = 0;
+  Header[19] = 0;
+  Header[20] = 0;
+  PngWriteChunk (&Enc, "IHDR", Header, 13);
+
+  /*
+   * zlib header: deflate with a 32K window, fastest compression.
+   */
+  PngPutByte (&Enc, 0x78);
+  PngPutByte (&Enc, 0x01);
+
+  for (Y = 0; Y < Height && !EFI_ERROR (Enc.Status); Y++) {
+    Status = GraphicsOutput->Blt (GraphicsOutput, Pixels,
+                               EfiBltVideoToBltBuffer, 0, Y, 0, 0,
+                               Width, 1, 0);
+    if (EFI_ERROR (Status)) {
+      goto Done;
+    }
+
+    for (X = 0; X < Width; X++) {
+      Cur[X * PNG_BYTES_PER_PIXEL] = Pixels[X].Red;
+      Cur[X * PNG_BYTES_PER_PIXEL + 1] = Pixels[X].Green;
+      Cur[X * PNG_BYTES_PER_PIXEL + 2] = Pixels[X].Blue;
+    }
+
+    BestScore = PngFilterRow (PNG_FILTER_NONE, Cur, Prev,
+                  Enc.RowBytes - 1, Best);
+    for (Filter = PNG_FILTER_SUB; Filter < PNG_FILTER_COUNT; Filter++) {
+      Score = PngFilterRow (Filter, Cur, Prev, Enc.RowBytes - 1, Try);
+      if (Score < BestScore) {
+        BestScore = Score;
+        Swap = Best;
+        Best = Try;
+        Try = Swap;
+      }
+    }
+
+    PngDeflateRow (&Enc, Best);
+
+    Swap = Prev;
+    Prev = Cur;
+    Cur = Swap;
+  }
+
+  /*
+   * Empty final block, then pad to a byte and add the Adler-32.
+   */
+  PngPutBits (&Enc, 1, 1);
+  PngPutBits (&Enc, 1, 2);
+  PngPutSymbol (&Enc, DEFLATE_END_OF_BLOCK);
+  PngPutBits (&Enc, 0, 7);
+  Enc.BitBuffer = 0;
+  Enc.BitCount = 0;
+  PngPutByte (&Enc, (UINT8)(Enc.Adler >> 24));
+  PngPutByte (&Enc, (UINT8)(Enc.Adler >> 16));
+  PngPutByte (&Enc, (UINT8)(Enc.Adler >> 8));
+  PngPutByte (&Enc, (UINT8)Enc.Adler);
+  PngFlushIdat (&Enc);
+
+  PngWriteChunk (&Enc, "IEND", Header, 0);
+  Status = Enc.Status;
+
+Done:
+  if (Enc.Chunk != NULL) {
+    FreePool (Enc.Chunk);
+  }
+  if (Enc.Window != NULL) {
+    FreePool (Enc.Window);
+  }
+  if (Enc.Head != NULL) {
+    FreePool (Enc.Head);
+  }
+  if (Pixels != NULL) {
+    FreePool (Pixels);
+  }
+  if (Prev != NULL) {
+    FreePool (Prev);
+  }
+  if (Cur != NULL) {
+    FreePool (Cur);
+  }
+  if (Best != NULL) {
+    FreePool (Best);
+  }
+  if (Try != NULL) {
+    FreePool (Try);
+  }
+
+  return Status;
+}
@@ -34,9 +34,7 @@
  */
 
 #include "DisplayDxe.h"
-#include <Protocol/SimpleFileSystem.h>
 #include <Library/PrintLib.h>
-#include <Library/BmpSupportLib.h>
 #include <Library/UefiRuntimeServicesTableLib.h>
 
 /*
@@ -150,102 +148,115 @@ FindWritableFs (
   return Status;
 }
 
+/*
+ * Checks whether anything has been drawn, one row at a time to
+ * avoid having to hold a copy of the whole screen.
+ */
+STATIC
+EFI_STATUS
+IsScreenBlank (
+  IN  EFI_GRAPHICS_OUTPUT_PROTOCOL *GraphicsOutput,
+  OUT BOOLEAN                      *Blank
+  )
+{
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL *Row;
+  EFI_STATUS Status;
+  UINT32 ScreenWidth;
+  UINT32 ScreenHeight;
+  UINTN X;
+  UINTN Y;
+
+  ScreenWidth = GraphicsOutput->Mode->Info->HorizontalResolution;
+  ScreenHeight = GraphicsOutput->Mode->Info->VerticalResolution;
+
+  Row = AllocatePool (ScreenWidth * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL));
+  if (Row == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  *Blank = TRUE;
+  for (Y = 0; Y < ScreenHeight && *Blank; Y++) {
+    Status = GraphicsOutput->Blt (GraphicsOutput, Row,
+                               EfiBltVideoToBltBuffer, 0, Y, 0, 0,
+                               ScreenWidth, 1, 0);
+    if (EFI_ERROR (Status)) {
+      FreePool (Row);
+      return Status;
+    }
+
+    for (X = 0; X < ScreenWidth; X++) {
+      if (Row[X].Red != 0x00 ||
+          Row[X].Green != 0x00 ||
+          Row[X].Blue != 0x00) {
+        *Blank = FALSE;
+        break;
+      }
+    }
+  }
+
+  FreePool (Row);
+  return EFI_SUCCESS;
+}
+
 STATIC
 VOID
 TakeScreenshot (
   VOID
   )
 {
-  VOID *BmpImage = NULL;
   EFI_FILE_PROTOCOL *Fs = NULL;
   EFI_FILE_PROTOCOL *File = NULL;
   EFI_GRAPHICS_OUTPUT_PROTOCOL *GraphicsOutput = &gDisplayProto;
-  EFI_GRAPHICS_OUTPUT_BLT_PIXEL *Image = NULL;
   EFI_STATUS Status;
   CHAR16 FileName[8 + 1 + 3 + 1];
-  UINT32 ScreenWidth;
-  UINT32 ScreenHeight;
-  UINTN ImageSize;
-  UINTN BmpSize;
-  UINTN Index;
+  BOOLEAN Blank;
   EFI_TIME Time;
 
   Status = FindWritableFs (&Fs);
   if (EFI_ERROR (Status)) {
     ShowStatus (GraphicsOutput, STATUS_YELLOW);
+    return;
   }
 
-  ScreenWidth = GraphicsOutput->Mode->Info->HorizontalResolution;
-  ScreenHeight = GraphicsOutput->Mode->Info->VerticalResolution;
-  ImageSize = ScreenWidth * ScreenHeight;
-
   Status = gRT->GetTime (&Time, NULL);
   if (!EFI_ERROR (Status)) {
-    UnicodeSPrint (FileName, sizeof (FileName), L"%02d%02d%02d%02d.bmp",
+    UnicodeSPrint (FileName, sizeof (FileName), L"%02d%02d%02d%02d.png",
       Time.Day, Time.Hour, Time.Minute, Time.Second);
   } else {
-    UnicodeSPrint (FileName, sizeof (FileName), L"scrnshot.bmp");
-  }
-
-  Image = AllocatePool (ImageSize * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL));
-  if (Image == NULL) {
-    Status = EFI_OUT_OF_RESOURCES;
-    ShowStatus (GraphicsOutput, STATUS_RED);
-    goto Done;
+    UnicodeSPrint (FileName, sizeof (FileName), L"scrnshot.png");
   }
 
-  Status = GraphicsOutput->Blt (GraphicsOutput, Image,
-                             EfiBltVideoToBltBuffer, 0, 0, 0, 0,
-                             ScreenWidth, ScreenHeight, 0);
+  Status = IsScreenBlank (GraphicsOutput, &Blank);
   if (EFI_ERROR (Status)) {
     ShowStatus (GraphicsOutput, STATUS_RED);
-    goto Done;
-  }
-
-  for (Index = 0; Index < ImageSize; Index++) {
-    if (Image[Index].Red != 0x00 ||
-        Image[Index].Green != 0x00 ||
-        Image[Index].Blue != 0x00) {
-      break;
-    }
+    return;
   }
 
-  if (Index == ImageSize) {
+  if (Blank) {
     ShowStatus (GraphicsOutput, STATUS_BLUE);
-    goto Done;
-  }
-
-  Status = TranslateGopBltToBmp (Image, ScreenHeight, ScreenWidth,
-             &BmpImage, (UINT32*)&BmpSize);
-  if (EFI_ERROR (Status)) {
-    ShowStatus (GraphicsOutput, STATUS_RED);
-    goto Done;
+    return;
   }
 
   Status = Fs->Open (Fs, &File, FileName, EFI_FILE_MODE_CREATE |
                  EFI_FILE_MODE_READ | EFI_FILE_MODE_WRITE, 0);
   if (EFI_ERROR (Status)) {
     ShowStatus (GraphicsOutput, STATUS_RED);
-    goto Done;
+    return;
   }
 
-  Status = File->Write (File, &BmpSize, BmpImage);
-  File->Close (File);
+  /*
+   * The image is encoded and written out a row at a time, so nothing
+   * close to the size of the screen is ever held in memory.
+   */
+  Status = PngWriteScreen (GraphicsOutput, File);
   if (EFI_ERROR (Status)) {
+    File->Delete (File);
     ShowStatus (GraphicsOutput, STATUS_RED);
-    goto Done;
+    return;
   }
 
+  File->Close (File);
   ShowStatus (GraphicsOutput, STATUS_GREEN);
-
-Done:
-  if (BmpImage != NULL) {
-    FreePool (BmpImage);
-  }
-
-  if (Image != NULL) {
-    FreePool (Image);
-  }
 }
 
 STATIC
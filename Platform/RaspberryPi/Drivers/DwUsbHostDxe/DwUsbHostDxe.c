@@ -222,6 +222,114 @@ DwCoreReset (
   return EFI_SUCCESS;
 }
 
+/*
+ * Host channels are handed out to transfers as they start and
+ * returned when they finish. Control, bulk and interrupt transfers
+ * no longer share a fixed channel, and a transfer does not hold off
+ * the periodic handler, so interrupt polling keeps going while a
+ * long bulk transfer is in flight and vice versa.
+ */
+STATIC
+EFI_STATUS
+DwHcAllocateChannel (
+  IN  DWUSB_OTGHC_DEV *DwHc,
+  OUT UINT32          *Channel
+  )
+{
+  UINT32     Index;
+  EFI_TPL    PreviousTpl;
+  EFI_STATUS Status = EFI_OUT_OF_RESOURCES;
+
+  PreviousTpl = gBS->RaiseTPL (TPL_NOTIFY);
+  for (Index = 0; Index < DwHc->NumChannels; Index++) {
+    if ((DwHc->ChannelsInUse & (1U << Index)) == 0) {
+      DwHc->ChannelsInUse |= (1U << Index);
+      *Channel = Index;
+      Status = EFI_SUCCESS;
+      break;
+    }
+  }
+  gBS->RestoreTPL (PreviousTpl);
+
+  return Status;
+}
+
+STATIC
+VOID
+DwHcFreeChannel (
+  IN  DWUSB_OTGHC_DEV *DwHc,
+  IN  UINT32          Channel
+  )
+{
+  EFI_TPL PreviousTpl;
+
+  ASSERT ((DwHc->ChannelsInUse & (1U << Channel)) != 0);
+
+  PreviousTpl = gBS->RaiseTPL (TPL_NOTIFY);
+  DwHc->ChannelsInUse &= ~(1U << Channel);
+  gBS->RestoreTPL (PreviousTpl);
+}
+
+/*
+ * Bulk transfers from a DWORD-aligned buffer are DMAed straight
+ * to or from the caller's buffer, so a multi-KB request goes out
+ * as one channel program of up to MaxPacketCount packets instead
+ * of 64K bounce buffer sized pieces. Only whole packets are mapped,
+ * the tail of an IN transfer that isn't a multiple of the packet
+ * size still goes through the bounce buffer, as the controller
+ * always writes whole packets.
+ */
+STATIC
+VOID *
+DwHcMapTransferBuffer (
+  IN      DWUSB_OTGHC_DEV        *DwHc,
+  IN      UINT32                 TransferDirection,
+  IN      VOID                   *Buffer,
+  IN      UINTN                  MaximumPacketLength,
+  IN  OUT UINT32                 *TxferLen,
+  OUT     EFI_PHYSICAL_ADDRESS   *BusAddress
+  )
+{
+  UINTN      Length;
+  UINTN      MappedLength;
+  VOID       *Mapping;
+  EFI_STATUS Status;
+
+  if (((UINTN)Buffer & (sizeof (UINT32) - 1)) != 0) {
+    return NULL;
+  }
+
+  Length = MIN (*TxferLen, DwHc->MaxPacketCount * MaximumPacketLength);
+  Length = MIN (Length, DwHc->MaxTransferSize);
+  if (TransferDirection || Length < *TxferLen) {
+    /*
+     * A short packet ends the transfer, so anything but the
+     * last piece of an OUT transfer must be whole packets too.
+     */
+    Length -= Length % MaximumPacketLength;
+  }
+
+  if (Length == 0) {
+    return NULL;
+  }
+
+  MappedLength = Length;
+  Status = DmaMap (TransferDirection ? MapOperationBusMasterWrite :
+             MapOperationBusMasterRead, Buffer, &MappedLength,
+             BusAddress, &Mapping);
+  if (EFI_ERROR (Status)) {
+    return NULL;
+  }
+
+  if (MappedLength != Length) {
+    DmaUnmap (Mapping);
+    return NULL;
+  }
+
+  *TxferLen = Length;
+  return Mapping;
+}
+
 STATIC
 EFI_STATUS
 DwHcTransfer (
@@ -250,13 +358,19 @@ DwHcTransfer (
   UINT32                          StopTransfer = 0;
   EFI_STATUS                      Status = EFI_SUCCESS;
   SPLIT_CONTROL                   Split = { 0 };
-
-  EFI_TPL Tpl = gBS->RaiseTPL (TPL_NOTIFY);
+  DWUSB_CHANNEL                   *HostChannel = &DwHc->Channels[Channel];
+  EFI_PHYSICAL_ADDRESS            BusAddress;
+  VOID                            *Mapping = NULL;
 
   *TransferResult = EFI_USB_NOERROR;
 
   do {
   RestartXfer:
+    if (Mapping != NULL) {
+      DmaUnmap (Mapping);
+      Mapping = NULL;
+    }
+
     if (DeviceSpeed == EFI_USB_SPEED_LOW ||
         DeviceSpeed == EFI_USB_SPEED_FULL) {
       Split.Splitting = TRUE;
@@ -266,34 +380,45 @@ DwHcTransfer (
 
     TxferLen = *DataLength - Done;
 
-    if (TxferLen > DWC2_MAX_TRANSFER_SIZE) {
-      TxferLen = DWC2_MAX_TRANSFER_SIZE - MaximumPacketLength + 1;
-    }
-
-    if (TxferLen > DWC2_DATA_BUF_SIZE) {
-      TxferLen = DWC2_DATA_BUF_SIZE - MaximumPacketLength + 1;
+    if (EpType == DWC2_HCCHAR_EPTYPE_BULK && !Split.Splitting) {
+      Mapping = DwHcMapTransferBuffer (DwHc, TransferDirection,
+                  Data + Done, MaximumPacketLength, &TxferLen,
+                  &BusAddress);
     }
 
-    if (Split.Splitting || TxferLen == 0) {
-      NumPackets = 1;
-    } else {
+    if (Mapping != NULL) {
       NumPackets = (TxferLen + MaximumPacketLength - 1) / MaximumPacketLength;
-      if (NumPackets > DWC2_MAX_PACKET_COUNT) {
-        NumPackets = DWC2_MAX_PACKET_COUNT;
-        TxferLen = NumPackets * MaximumPacketLength;
+    } else {
+      BusAddress = HostChannel->AlignedBufferBusAddress;
+
+      if (TxferLen > DWC2_MAX_TRANSFER_SIZE) {
+        TxferLen = DWC2_MAX_TRANSFER_SIZE - MaximumPacketLength + 1;
       }
-    }
 
-    if (TransferDirection) { // in
-      TxferLen = NumPackets * MaximumPacketLength;
-    } else {
-      CopyMem (DwHc->AlignedBuffer, Data + Done, TxferLen);
-      ArmDataSynchronizationBarrier ();
+      if (TxferLen > DWC2_DATA_BUF_SIZE) {
+        TxferLen = DWC2_DATA_BUF_SIZE - MaximumPacketLength + 1;
+      }
+
+      if (Split.Splitting || TxferLen == 0) {
+        NumPackets = 1;
+      } else {
+        NumPackets = (TxferLen + MaximumPacketLength - 1) / MaximumPacketLength;
+        if (NumPackets > DWC2_MAX_PACKET_COUNT) {
+          NumPackets = DWC2_MAX_PACKET_COUNT;
+          TxferLen = NumPackets * MaximumPacketLength;
+        }
+      }
+
+      if (TransferDirection) { // in
+        TxferLen = NumPackets * MaximumPacketLength;
+      } else {
+        CopyMem (HostChannel->AlignedBuffer, Data + Done, TxferLen);
+        ArmDataSynchronizationBarrier ();
+      }
     }
 
   RestartChannel:
-    MmioWrite32 (DwHc->DwUsbBase + HCDMA (Channel),
-      (UINTN)DwHc->AlignedBufferBusAddress);
+    MmioWrite32 (DwHc->DwUsbBase + HCDMA (Channel), (UINTN)BusAddress);
 
     DwOtgHcInit (DwHc, Channel, Translator, DeviceSpeed,
       DeviceAddress, EpAddress,
@@ -365,10 +490,17 @@ DwHcTransfer (
       break;
     }
 
+    if (Mapping != NULL) {
+      DmaUnmap (Mapping);
+      Mapping = NULL;
+    }
+
     if (TransferDirection) { // in
       ArmDataSynchronizationBarrier ();
       TxferLen -= Sub;
-      CopyMem (Data + Done, DwHc->AlignedBuffer, TxferLen);
+      if (BusAddress == HostChannel->AlignedBufferBusAddress) {
+        CopyMem (Data + Done, HostChannel->AlignedBuffer, TxferLen);
+      }
       if (Sub) {
         StopTransfer = 1;
       }
@@ -377,13 +509,15 @@ DwHcTransfer (
     Done += TxferLen;
   } while (Done < *DataLength && !StopTransfer);
 
+  if (Mapping != NULL) {
+    DmaUnmap (Mapping);
+  }
+
   MmioWrite32 (DwHc->DwUsbBase + HCINTMSK (Channel), 0);
   MmioWrite32 (DwHc->DwUsbBase + HCINT (Channel), 0xFFFFFFFF);
 
   *DataLength = Done;
 
-  gBS->RestoreTPL (Tpl);
-
   ASSERT (!EFI_ERROR (Status) || *TransferResult != EFI_USB_NOERROR);
 
   return Status;
@@ -420,10 +554,21 @@ DwHcDeferredTransfer (
 {
   EFI_STATUS Status;
   EFI_EVENT TimeoutEvt = NULL;
+  UINT32 Channel;
+
+  Status = DwHcAllocateChannel (Req->DwHc, &Channel);
+  if (EFI_ERROR (Status)) {
+    /*
+     * All channels are busy, poll again on the next frame.
+     */
+    Req->TargetFrame = Req->DwHc->CurrentFrame + 1;
+    return;
+  }
 
   Status = gBS->CreateEvent (EVT_TIMER, 0, NULL, NULL, &TimeoutEvt);
   ASSERT_EFI_ERROR (Status);
   if (EFI_ERROR (Status)) {
+    DwHcFreeChannel (Req->DwHc, Channel);
     goto Exit;
   }
 
@@ -431,18 +576,21 @@ DwHcDeferredTransfer (
                   EFI_TIMER_PERIOD_MILLISECONDS (Req->TimeOut));
   ASSERT_EFI_ERROR (Status);
   if (EFI_ERROR (Status)) {
+    DwHcFreeChannel (Req->DwHc, Channel);
     goto Exit;
   }
 
   Req->TransferResult = EFI_USB_NOERROR;
   Status = DwHcTransfer (Req->DwHc, TimeoutEvt,
-             Req->Channel, Req->Translator,
+             Channel, Req->Translator,
              Req->DeviceSpeed, Req->DeviceAddress,
              Req->MaximumPacketLength, &Req->Pid,
              Req->TransferDirection, Req->Data, &Req->DataLength,
              Req->EpAddress, Req->EpType, &Req->TransferResult,
              Req->IgnoreAck);
 
+  DwHcFreeChannel (Req->DwHc, Channel);
+
   if (Req->EpType == DWC2_HCCHAR_EPTYPE_INTR &&
       Status == EFI_DEVICE_ERROR &&
       Req->TransferResult == EFI_USB_ERR_NAK) {
@@ -802,6 +950,8 @@ DwHcControlTransfer (
   UINTN                   Length;
   EFI_USB_DATA_DIRECTION  StatusDirection;
   UINT32                  Direction;
+  UINT32                  Channel;
+  BOOLEAN                 ChannelAllocated = FALSE;
   EFI_EVENT TimeoutEvt = NULL;
 
   if ((Request == NULL) || (TransferResult == NULL)) {
@@ -848,10 +998,16 @@ DwHcControlTransfer (
     goto Exit;
   }
 
+  Status = DwHcAllocateChannel (DwHc, &Channel);
+  if (EFI_ERROR (Status)) {
+    goto Exit;
+  }
+  ChannelAllocated = TRUE;
+
   Pid = DWC2_HC_PID_SETUP;
   Length = 8;
   Status = DwHcTransfer (DwHc, TimeoutEvt,
-             DWC2_HC_CHANNEL, Translator, DeviceSpeed,
+             Channel, Translator, DeviceSpeed,
              DeviceAddress, MaximumPacketLength, &Pid, 0,
              Request, &Length, 0, DWC2_HCCHAR_EPTYPE_CONTROL,
              TransferResult, 1);
@@ -872,7 +1028,7 @@ DwHcControlTransfer (
     }
 
     Status = DwHcTransfer (DwHc, TimeoutEvt,
-               DWC2_HC_CHANNEL, Translator, DeviceSpeed,
+               Channel, Translator, DeviceSpeed,
                DeviceAddress, MaximumPacketLength, &Pid,
                Direction, Data, DataLength, 0,
                DWC2_HCCHAR_EPTYPE_CONTROL,
@@ -895,7 +1051,7 @@ DwHcControlTransfer (
   Pid = DWC2_HC_PID_DATA1;
   Length = 0;
   Status = DwHcTransfer (DwHc, TimeoutEvt,
-             DWC2_HC_CHANNEL, Translator, DeviceSpeed,
+             Channel, Translator, DeviceSpeed,
              DeviceAddress, MaximumPacketLength, &Pid,
              StatusDirection, DwHc->StatusBuffer, &Length, 0,
              DWC2_HCCHAR_EPTYPE_CONTROL, TransferResult, 1);
@@ -907,6 +1063,10 @@ DwHcControlTransfer (
   }
 
 Exit:
+  if (ChannelAllocated) {
+    DwHcFreeChannel (DwHc, Channel);
+  }
+
   if (TimeoutEvt != NULL) {
     gBS->CloseEvent (TimeoutEvt);
   }
@@ -943,6 +1103,7 @@ DwHcBulkTransfer (
   UINT8                   TransferDirection;
   UINT8                   EpAddress;
   UINT32                  Pid;
+  UINT32                  Channel;
   EFI_EVENT TimeoutEvt = NULL;
 
   if ((Data == NULL) || (Data[0] == NULL) ||
@@ -984,12 +1145,19 @@ DwHcBulkTransfer (
   EpAddress = EndPointAddress & 0x0F;
   Pid = (*DataToggle << 1);
 
+  Status = DwHcAllocateChannel (DwHc, &Channel);
+  if (EFI_ERROR (Status)) {
+    goto Exit;
+  }
+
   Status = DwHcTransfer (DwHc, TimeoutEvt,
-             DWC2_HC_CHANNEL_BULK, Translator, DeviceSpeed,
+             Channel, Translator, DeviceSpeed,
              DeviceAddress, MaximumPacketLength, &Pid,
              TransferDirection, Data[0], DataLength, EpAddress,
              DWC2_HCCHAR_EPTYPE_BULK, TransferResult, 1);
 
+  DwHcFreeChannel (DwHc, Channel);
+
   *DataToggle = (Pid >> 1);
 
 Exit:
@@ -1098,7 +1266,6 @@ DwHcAsyncInterruptTransfer (
     NewReq->FrameInterval;
 
   NewReq->DwHc = DwHc;
-  NewReq->Channel = DWC2_HC_CHANNEL_ASYNC;
   NewReq->Translator = Translator;
   NewReq->DeviceSpeed = DeviceSpeed;
   NewReq->DeviceAddress = DeviceAddress;
@@ -1155,6 +1322,7 @@ DwHcSyncInterruptTransfer (
   UINT8 TransferDirection;
   UINT8 EpAddress;
   UINT32 Pid;
+  UINT32 Channel;
 
   DwHc = DWHC_FROM_THIS (This);
 
@@ -1187,14 +1355,23 @@ DwHcSyncInterruptTransfer (
   TransferDirection = (EndPointAddress >> 7) & 0x01;
   EpAddress = EndPointAddress & 0x0F;
   Pid = (*DataToggle << 1);
+
+  Status = DwHcAllocateChannel (DwHc, &Channel);
+  if (EFI_ERROR (Status)) {
+    goto Exit;
+  }
+
   Status = DwHcTransfer (DwHc, TimeoutEvt,
-             DWC2_HC_CHANNEL_SYNC, Translator,
+             Channel, Translator,
              DeviceSpeed, DeviceAddress,
              MaximumPacketLength,
              &Pid, TransferDirection, Data,
              DataLength, EpAddress,
              DWC2_HCCHAR_EPTYPE_INTR,
              TransferResult, 0);
+
+  DwHcFreeChannel (DwHc, Channel);
+
   *DataToggle = (Pid >> 1);
 
 Exit:
@@ -1419,6 +1596,7 @@ DestroyDwUsbHc (
   )
 {
   UINT32 Pages;
+  UINT32 Index;
   EFI_TPL PreviousTpl;
 
   if (DwHc == NULL) {
@@ -1436,8 +1614,14 @@ DestroyDwUsbHc (
   }
 
   Pages = EFI_SIZE_TO_PAGES (DWC2_DATA_BUF_SIZE);
-  DmaUnmap (DwHc->AlignedBufferMapping);
-  DmaFreeBuffer (Pages, DwHc->AlignedBuffer);
+  for (Index = 0; Index < DwHc->NumChannels; Index++) {
+    if (DwHc->Channels[Index].AlignedBufferMapping != NULL) {
+      DmaUnmap (DwHc->Channels[Index].AlignedBufferMapping);
+    }
+    if (DwHc->Channels[Index].AlignedBuffer != NULL) {
+      DmaFreeBuffer (Pages, DwHc->Channels[Index].AlignedBuffer);
+    }
+  }
 
   Pages = EFI_SIZE_TO_PAGES (DWC2_STATUS_BUF_SIZE);
   FreePages (DwHc->StatusBuffer, Pages);
@@ -1524,7 +1708,10 @@ CreateDwUsbHc (
   )
 {
   DWUSB_OTGHC_DEV *DwHc;
+  DWUSB_CHANNEL   *Channel;
   UINT32          Pages;
+  UINT32          Index;
+  UINT32          Hwcfg3;
   UINTN           BufferSize;
   EFI_STATUS      Status;
 
@@ -1558,19 +1745,39 @@ CreateDwUsbHc (
     return EFI_OUT_OF_RESOURCES;
   }
 
+  DwHc->NumChannels = MmioRead32 (DwHc->DwUsbBase + GHWCFG2);
+  DwHc->NumChannels &= DWC2_HWCFG2_NUM_HOST_CHAN_MASK;
+  DwHc->NumChannels >>= DWC2_HWCFG2_NUM_HOST_CHAN_OFFSET;
+  DwHc->NumChannels = MIN (DwHc->NumChannels + 1, MAX_CHANNEL);
+
+  Hwcfg3 = MmioRead32 (DwHc->DwUsbBase + GHWCFG3);
+  DwHc->MaxTransferSize = (1U << (((Hwcfg3 & DWC2_HWCFG3_XFER_SIZE_CNTR_WIDTH_MASK) >>
+                                    DWC2_HWCFG3_XFER_SIZE_CNTR_WIDTH_OFFSET) + 11)) - 1;
+  DwHc->MaxTransferSize = MIN (DwHc->MaxTransferSize, DWC2_HCTSIZ_XFERSIZE_MASK);
+  DwHc->MaxPacketCount = (1U << (((Hwcfg3 & DWC2_HWCFG3_PACKET_SIZE_CNTR_WIDTH_MASK) >>
+                                   DWC2_HWCFG3_PACKET_SIZE_CNTR_WIDTH_OFFSET) + 4)) - 1;
+  DwHc->MaxPacketCount = MIN (DwHc->MaxPacketCount,
+                           DWC2_HCTSIZ_PKTCNT_MASK >> DWC2_HCTSIZ_PKTCNT_OFFSET);
+  DEBUG ((DEBUG_INFO, "Host has %u channels, %u byte/%u packet transfers\n",
+    DwHc->NumChannels, DwHc->MaxTransferSize, DwHc->MaxPacketCount));
+
   Pages = EFI_SIZE_TO_PAGES (DWC2_DATA_BUF_SIZE);
-  Status = DmaAllocateBuffer (EfiBootServicesData, Pages, (VOID**)&DwHc->AlignedBuffer);
-  if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_ERROR, "CreateDwUsbHc: DmaAllocateBuffer: %r\n", Status));
-    return Status;
-  }
+  for (Index = 0; Index < DwHc->NumChannels; Index++) {
+    Channel = &DwHc->Channels[Index];
 
-  BufferSize = EFI_PAGES_TO_SIZE (Pages);
-  Status = DmaMap (MapOperationBusMasterCommonBuffer, DwHc->AlignedBuffer, &BufferSize,
-             &DwHc->AlignedBufferBusAddress, &DwHc->AlignedBufferMapping);
-  if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_ERROR, "CreateDwUsbHc: DmaMap: %r\n", Status));
-    return Status;
+    Status = DmaAllocateBuffer (EfiBootServicesData, Pages, (VOID**)&Channel->AlignedBuffer);
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "CreateDwUsbHc: DmaAllocateBuffer: %r\n", Status));
+      return Status;
+    }
+
+    BufferSize = EFI_PAGES_TO_SIZE (Pages);
+    Status = DmaMap (MapOperationBusMasterCommonBuffer, Channel->AlignedBuffer, &BufferSize,
+               &Channel->AlignedBufferBusAddress, &Channel->AlignedBufferMapping);
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "CreateDwUsbHc: DmaMap: %r\n", Status));
+      return Status;
+    }
   }
 
   InitializeListHead (&DwHc->DeferredList);
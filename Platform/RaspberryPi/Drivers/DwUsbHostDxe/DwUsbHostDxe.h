@@ -37,6 +37,7 @@
 
 #define MAX_DEVICE                      16
 #define MAX_ENDPOINT                    16
+#define MAX_CHANNEL                     16
 
 #define DWUSB_OTGHC_DEV_SIGNATURE       SIGNATURE_32 ('d', 'w', 'h', 'c')
 #define DWHC_FROM_THIS(a)               CR(a, DWUSB_OTGHC_DEV, DwUsbOtgHc, DWUSB_OTGHC_DEV_SIGNATURE)
@@ -73,7 +74,6 @@ typedef struct {
 typedef struct _DWUSB_DEFERRED_REQ {
   IN OUT LIST_ENTRY                         List;
   IN     struct _DWUSB_OTGHC_DEV            *DwHc;
-  IN     UINT32                             Channel;
   IN     UINT32                             FrameInterval;
   IN     UINT32                             TargetFrame;
   IN     EFI_USB2_HC_TRANSACTION_TRANSLATOR *Translator;
@@ -93,6 +93,12 @@ typedef struct _DWUSB_DEFERRED_REQ {
   IN     UINTN                              TimeOut;
 } DWUSB_DEFERRED_REQ;
 
+typedef struct {
+  UINT8                           *AlignedBuffer;
+  VOID *                          AlignedBufferMapping;
+  UINTN                           AlignedBufferBusAddress;
+} DWUSB_CHANNEL;
+
 typedef struct _DWUSB_OTGHC_DEV {
   UINTN                           Signature;
 
@@ -107,9 +113,20 @@ typedef struct _DWUSB_OTGHC_DEV {
   EFI_PHYSICAL_ADDRESS            DwUsbBase;
   UINT8                           *StatusBuffer;
 
-  UINT8                           *AlignedBuffer;
-  VOID *                          AlignedBufferMapping;
-  UINTN                           AlignedBufferBusAddress;
+  /*
+   * Each host channel has its own bounce buffer, so that
+   * transfers on different channels can be in flight at
+   * the same time.
+   */
+  UINT32                          NumChannels;
+  UINT32                          ChannelsInUse;
+  /*
+   * Largest single channel program, from the HCTSIZ
+   * counter widths in GHWCFG3.
+   */
+  UINT32                          MaxTransferSize;
+  UINT32                          MaxPacketCount;
+  DWUSB_CHANNEL                   Channels[MAX_CHANNEL];
   LIST_ENTRY                      DeferredList;
   /*
    * 1ms frames.
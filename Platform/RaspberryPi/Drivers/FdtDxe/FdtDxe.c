@@ -23,52 +23,93 @@ STATIC VOID                             *mFdtImage;
 
 STATIC RASPBERRY_PI_FIRMWARE_PROTOCOL   *mFwProtocol;
 
+//
+// The nodes the devicetree fix-ups operate on.
+//
+typedef enum {
+  FdtFixupNodePsci,
+  FdtFixupNodeCpus,
+  FdtFixupNodeMemory,
+  FdtFixupNodeDisplay,
+  FdtFixupNodeAliases,
+  FdtFixupNodeEthernet,
+  FdtFixupNodeUsb,
+  FdtFixupNodeMax
+} FDT_FIXUP_NODE;
+
+//
+// Deepest node, and longest node path, matched against the aliases.
+//
+#define FDT_FIXUP_MAX_DEPTH     16
+#define FDT_FIXUP_MAX_PATH      256
+
+typedef struct {
+  //
+  // Offset of each fix-up node, or a negative value if it does not exist.
+  // If there is no /psci node, its offset is that of the root node, which
+  // is where the fix-up creates it.
+  //
+  INT32         Node[FdtFixupNodeMax];
+  //
+  // The 'ethernet[0]' alias, copied so that it survives changes to the tree.
+  //
+  CHAR8         *EthernetAlias;
+  BOOLEAN       HasEthernet;
+  BOOLEAN       HasEthernet0;
+} FDT_FIXUP_CONTEXT;
+
+typedef
+EFI_STATUS
+(*FDT_FIXUP_HANDLER) (
+  IN  FDT_FIXUP_CONTEXT   *Context,
+  IN  INT32               Node
+  );
+
+typedef struct {
+  FDT_FIXUP_HANDLER   Handler;
+  CONST CHAR16        *Description;
+} FDT_FIXUP;
+
 STATIC
 EFI_STATUS
-FixEthernetAliases (
-  VOID
+FixAliases (
+  IN  FDT_FIXUP_CONTEXT   *Context,
+  IN  INT32               Aliases
 )
 {
-  INTN          Aliases;
-  CONST CHAR8   *Ethernet;
-  CONST CHAR8   *Ethernet0;
-  CONST CHAR8   *Alias;
+  CONST CHAR8   *Copy;
   UINTN         CopySize;
-  CHAR8         *Copy;
   INTN          Retval;
   EFI_STATUS    Status;
 
-  //
-  // Look up the 'ethernet[0]' aliases
-  //
-  Aliases = fdt_path_offset (mFdtImage, "/aliases");
   if (Aliases < 0) {
     DEBUG ((DEBUG_ERROR, "%a: failed to locate '/aliases'\n", __FUNCTION__));
     return EFI_NOT_FOUND;
   }
-  Ethernet = fdt_getprop (mFdtImage, Aliases, "ethernet", NULL);
-  Ethernet0 = fdt_getprop (mFdtImage, Aliases, "ethernet0", NULL);
-  Alias = Ethernet ? Ethernet : Ethernet0;
-  if (!Alias) {
-    DEBUG ((DEBUG_ERROR, "%a: failed to locate 'ethernet[0]' alias\n", __FUNCTION__));
-    return EFI_NOT_FOUND;
-  }
 
   //
-  // Create copy for fdt_setprop
+  // Drop the alias of the simple-framebuffer removed by CleanSimpleFramebuffer
   //
-  CopySize = AsciiStrSize (Alias);
-  Copy = AllocateCopyPool (CopySize, Alias);
+  Status = EFI_SUCCESS;
+  if (Context->Node[FdtFixupNodeDisplay] >= 0) {
+    Retval = fdt_delprop (mFdtImage, Aliases, "display0");
+    if (Retval != 0) {
+      DEBUG ((DEBUG_ERROR, "Failed to remove display0 alias\n"));
+      Status = EFI_NOT_FOUND;
+    }
+  }
+
+  Copy = Context->EthernetAlias;
   if (!Copy) {
-    DEBUG ((DEBUG_ERROR, "%a: failed to copy '%a'\n", __FUNCTION__, Alias));
-    return EFI_OUT_OF_RESOURCES;
+    DEBUG ((DEBUG_ERROR, "%a: failed to locate 'ethernet[0]' alias\n", __FUNCTION__));
+    return EFI_NOT_FOUND;
   }
+  CopySize = AsciiStrSize (Copy);
 
   //
   // Create missing aliases
   //
-  Status = EFI_SUCCESS;
-  if (!Ethernet) {
+  if (!Context->HasEthernet) {
     Retval = fdt_setprop (mFdtImage, Aliases, "ethernet", Copy, CopySize);
     if (Retval != 0) {
       Status = EFI_NOT_FOUND;
@@ -77,7 +118,7 @@ FixEthernetAliases (
     }
     DEBUG ((DEBUG_INFO, "%a: created 'ethernet' alias '%a'\n", __FUNCTION__, Copy));
   }
-  if (!Ethernet0) {
+  if (!Context->HasEthernet0) {
     Retval = fdt_setprop (mFdtImage, Aliases, "ethernet0", Copy, CopySize);
     if (Retval != 0) {
       Status = EFI_NOT_FOUND;
@@ -87,25 +128,23 @@ FixEthernetAliases (
     DEBUG ((DEBUG_INFO, "%a: created 'ethernet0' alias '%a'\n", __FUNCTION__, Copy));
   }
 
-  FreePool (Copy);
   return Status;
 }
 
 STATIC
 EFI_STATUS
 UpdateMacAddress (
-  VOID
+  IN  FDT_FIXUP_CONTEXT   *Context,
+  IN  INT32               Node
   )
 {
-  INTN          Node;
   INTN          Retval;
   EFI_STATUS    Status;
   UINT8         MacAddress[6];
 
   //
-  // Locate the node that the 'ethernet' alias refers to
+  // The node that the 'ethernet' alias refers to
   //
-  Node = fdt_path_offset (mFdtImage, "ethernet");
   if (Node < 0) {
     DEBUG ((DEBUG_ERROR, "%a: failed to locate 'ethernet' alias\n", __FUNCTION__));
     return EFI_NOT_FOUND;
@@ -141,7 +180,8 @@ UpdateMacAddress (
 STATIC
 EFI_STATUS
 AddUsbCompatibleProperty (
-  VOID
+  IN  FDT_FIXUP_CONTEXT   *Context,
+  IN  INT32               Node
   )
 {
   CONST CHAR8   Prop[]    = "brcm,bcm2708-usb";
@@ -149,11 +189,9 @@ AddUsbCompatibleProperty (
   CONST CHAR8   *List;
   CHAR8         *NewList;
   INT32         ListSize;
-  INTN          Node;
   INTN          Retval;
 
-  // Locate the node that the 'usb' alias refers to
-  Node = fdt_path_offset (mFdtImage, "usb");
+  // The node that the 'usb' alias refers to
   if (Node < 0) {
     DEBUG ((DEBUG_ERROR, "%a: failed to locate 'usb' alias\n", __FUNCTION__));
     return EFI_NOT_FOUND;
@@ -207,13 +245,12 @@ AddUsbCompatibleProperty (
 STATIC
 EFI_STATUS
 CleanMemoryNodes (
-  VOID
+  IN  FDT_FIXUP_CONTEXT   *Context,
+  IN  INT32               Node
   )
 {
-  INTN Node;
   INT32 Retval;
 
-  Node = fdt_path_offset (mFdtImage, "/memory");
   if (Node < 0) {
     return EFI_SUCCESS;
   }
@@ -235,22 +272,17 @@ CleanMemoryNodes (
 STATIC
 EFI_STATUS
 SanitizePSCI (
-  VOID
+  IN  FDT_FIXUP_CONTEXT   *Context,
+  IN  INT32               Node
   )
 {
-  INTN Node;
-  INTN Root;
   INT32 Retval;
 
-  Root = fdt_path_offset (mFdtImage, "/");
-  ASSERT (Root >= 0);
-  if (Root < 0) {
-    return EFI_NOT_FOUND;
-  }
-
-  Node = fdt_path_offset (mFdtImage, "/psci");
-  if (Node < 0) {
-    Node = fdt_add_subnode (mFdtImage, Root, "psci");
+  //
+  // Offset 0 is the root node, meaning there is no /psci yet
+  //
+  if (Node == 0) {
+    Node = fdt_add_subnode (mFdtImage, Node, "psci");
   }
 
   ASSERT (Node >= 0);
@@ -271,13 +303,24 @@ SanitizePSCI (
     return EFI_NOT_FOUND;
   }
 
-  Root = fdt_path_offset (mFdtImage, "/cpus");
-  if (Root < 0) {
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+SanitizeCpuEnableMethod (
+  IN  FDT_FIXUP_CONTEXT   *Context,
+  IN  INT32               Cpus
+  )
+{
+  INT32 Node;
+
+  if (Cpus < 0) {
     DEBUG ((DEBUG_ERROR, "No CPUs to update with PSCI enable-method?\n"));
     return EFI_NOT_FOUND;
   }
 
-  Node = fdt_first_subnode (mFdtImage, Root);
+  Node = fdt_first_subnode (mFdtImage, Cpus);
   while (Node >= 0) {
     if (fdt_setprop_string (mFdtImage, Node, "enable-method", "psci") != 0) {
       DEBUG ((DEBUG_ERROR, "Failed to update enable-method for a CPU\n"));
@@ -293,24 +336,20 @@ SanitizePSCI (
 STATIC
 EFI_STATUS
 CleanSimpleFramebuffer (
-  VOID
+  IN  FDT_FIXUP_CONTEXT   *Context,
+  IN  INT32               Node
   )
 {
-  INTN Node;
   INT32 Retval;
 
-  /*
-   * Should look for nodes by kind and remove aliases
-   * by matching against device.
-   */
-  Node = fdt_path_offset (mFdtImage, "display0");
   if (Node < 0) {
     return EFI_SUCCESS;
   }
 
   /*
    * Remove bogus GPU-injected simple-framebuffer, which
-   * doesn't reflect the framebuffer built by UEFI.
+   * doesn't reflect the framebuffer built by UEFI. Its
+   * alias is removed by FixAliases.
    */
   DEBUG ((DEBUG_INFO, "Removing bogus display0\n"));
   Retval = fdt_del_node (mFdtImage, Node);
@@ -319,21 +358,207 @@ CleanSimpleFramebuffer (
     return EFI_NOT_FOUND;
   }
 
-  Node = fdt_path_offset (mFdtImage, "/aliases");
-  if (Node < 0) {
-    DEBUG ((DEBUG_ERROR, "Couldn't find /aliases to remove display0\n"));
-    return EFI_NOT_FOUND;
+  return EFI_SUCCESS;
+}
+
+//
+// The fix-ups, indexed by the node they operate on. Each one only changes
+// its own node and that node's subtree.
+//
+STATIC CONST FDT_FIXUP mFdtFixups[FdtFixupNodeMax] = {
+  { SanitizePSCI,             L"sanitize PSCI" },
+  { SanitizeCpuEnableMethod,  L"sanitize CPU enable methods" },
+  { CleanMemoryNodes,         L"clean memory nodes" },
+  { CleanSimpleFramebuffer,   L"clean frame buffer" },
+  { FixAliases,               L"fix aliases" },
+  { UpdateMacAddress,         L"update MAC address" },
+  { AddUsbCompatibleProperty, L"update USB compatible properties" },
+};
+
+/**
+  Return whether a node name matches a base name, ignoring any unit address,
+  the same way fdt_path_offset () matches path components.
+**/
+STATIC
+BOOLEAN
+FdtNodeNameMatches (
+  IN  CONST CHAR8   *Name,
+  IN  INT32         NameLen,
+  IN  CONST CHAR8   *BaseName
+  )
+{
+  UINTN   BaseLen;
+
+  BaseLen = AsciiStrLen (BaseName);
+  if ((UINTN)NameLen < BaseLen || CompareMem (Name, BaseName, BaseLen) != 0) {
+    return FALSE;
   }
+  return (UINTN)NameLen == BaseLen || Name[BaseLen] == '@';
+}
 
-  Retval = fdt_delprop (mFdtImage, Node, "display0");
-  if (Retval != 0) {
-    DEBUG ((DEBUG_ERROR, "Failed to remove display0 alias\n"));
-    return EFI_NOT_FOUND;
+/**
+  Locate every node the fix-ups operate on, in one walk over the tree.
+
+  The aliases are looked up first, and each node's path is built up as the
+  tree is walked, so that alias targets are matched without searching the
+  tree again for each of them.
+**/
+STATIC
+EFI_STATUS
+FdtFixupCollect (
+  OUT FDT_FIXUP_CONTEXT   *Context
+  )
+{
+  CONST CHAR8   *Ethernet;
+  CONST CHAR8   *Ethernet0;
+  CONST CHAR8   *Target[FdtFixupNodeMax];
+  CONST CHAR8   *Name;
+  CHAR8         Path[FDT_FIXUP_MAX_PATH];
+  UINTN         PathEnd[FDT_FIXUP_MAX_DEPTH];
+  UINTN         Start;
+  INT32         NameLen;
+  INT32         Aliases;
+  INT32         Depth;
+  INT32         Node;
+  UINTN         Index;
+
+  for (Index = 0; Index < FdtFixupNodeMax; Index++) {
+    Context->Node[Index] = -FDT_ERR_NOTFOUND;
+    Target[Index] = NULL;
+  }
+  Context->EthernetAlias = NULL;
+
+  Aliases = fdt_subnode_offset (mFdtImage, 0, "aliases");
+  Context->Node[FdtFixupNodeAliases] = Aliases;
+  Ethernet = NULL;
+  Ethernet0 = NULL;
+  if (Aliases >= 0) {
+    Ethernet = fdt_getprop (mFdtImage, Aliases, "ethernet", NULL);
+    Ethernet0 = fdt_getprop (mFdtImage, Aliases, "ethernet0", NULL);
+    Target[FdtFixupNodeDisplay] = fdt_getprop (mFdtImage, Aliases, "display0", NULL);
+    Target[FdtFixupNodeUsb] = fdt_getprop (mFdtImage, Aliases, "usb", NULL);
+  }
+  Target[FdtFixupNodeEthernet] = Ethernet ? Ethernet : Ethernet0;
+  Context->HasEthernet = (Ethernet != NULL);
+  Context->HasEthernet0 = (Ethernet0 != NULL);
+
+  if (Target[FdtFixupNodeEthernet] != NULL) {
+    Context->EthernetAlias = AllocateCopyPool (
+                               AsciiStrSize (Target[FdtFixupNodeEthernet]),
+                               Target[FdtFixupNodeEthernet]);
+    if (Context->EthernetAlias == NULL) {
+      DEBUG ((DEBUG_ERROR, "%a: failed to copy '%a'\n", __FUNCTION__,
+        Target[FdtFixupNodeEthernet]));
+      return EFI_OUT_OF_RESOURCES;
+    }
+  }
+
+  PathEnd[0] = 0;
+  Depth = 0;
+  for (Node = fdt_next_node (mFdtImage, 0, &Depth);
+       Node >= 0 && Depth > 0;
+       Node = fdt_next_node (mFdtImage, Node, &Depth)) {
+    if (Depth >= FDT_FIXUP_MAX_DEPTH) {
+      continue;
+    }
+
+    Name = fdt_get_name (mFdtImage, Node, &NameLen);
+    Start = PathEnd[Depth - 1];
+    if (Name == NULL || Start == MAX_UINTN ||
+        Start + NameLen + 2 > sizeof (Path)) {
+      //
+      // Nothing below this node can be matched.
+      //
+      PathEnd[Depth] = MAX_UINTN;
+      continue;
+    }
+    Path[Start] = '/';
+    CopyMem (&Path[Start + 1], Name, NameLen);
+    PathEnd[Depth] = Start + 1 + NameLen;
+    Path[PathEnd[Depth]] = '\0';
+
+    if (Depth == 1) {
+      if (Context->Node[FdtFixupNodeMemory] < 0 &&
+          FdtNodeNameMatches (Name, NameLen, "memory")) {
+        Context->Node[FdtFixupNodeMemory] = Node;
+      } else if (Context->Node[FdtFixupNodePsci] < 0 &&
+                 FdtNodeNameMatches (Name, NameLen, "psci")) {
+        Context->Node[FdtFixupNodePsci] = Node;
+      } else if (Context->Node[FdtFixupNodeCpus] < 0 &&
+                 FdtNodeNameMatches (Name, NameLen, "cpus")) {
+        Context->Node[FdtFixupNodeCpus] = Node;
+      }
+    }
+
+    for (Index = 0; Index < FdtFixupNodeMax; Index++) {
+      if (Target[Index] != NULL && Context->Node[Index] < 0 &&
+          AsciiStrCmp (Path, Target[Index]) == 0) {
+        Context->Node[Index] = Node;
+      }
+    }
+  }
+
+  //
+  // A missing /psci is created under the root node.
+  //
+  if (Context->Node[FdtFixupNodePsci] < 0) {
+    Context->Node[FdtFixupNodePsci] = 0;
   }
 
   return EFI_SUCCESS;
 }
 
+/**
+  Apply all devicetree fix-ups.
+
+  Nodes are located in a single walk, after which the fix-ups are applied
+  from the highest node offset to the lowest: changing a node only moves
+  what follows it in the blob, so the offsets of the nodes still to be
+  fixed up stay valid and the tree never has to be searched again. These
+  are all best-effort.
+**/
+STATIC
+VOID
+FdtFixupApply (
+  VOID
+  )
+{
+  FDT_FIXUP_CONTEXT   Context;
+  UINTN               Order[FdtFixupNodeMax];
+  UINTN               Index;
+  UINTN               Sorted;
+  UINTN               Current;
+  EFI_STATUS          Status;
+
+  Status = FdtFixupCollect (&Context);
+  if (EFI_ERROR (Status)) {
+    Print (L"Failed to locate devicetree nodes: %r\n", Status);
+    return;
+  }
+
+  for (Index = 0; Index < FdtFixupNodeMax; Index++) {
+    Current = Index;
+    for (Sorted = Index;
+         Sorted > 0 && Context.Node[Order[Sorted - 1]] < Context.Node[Current];
+         Sorted--) {
+      Order[Sorted] = Order[Sorted - 1];
+    }
+    Order[Sorted] = Current;
+  }
+
+  for (Index = 0; Index < FdtFixupNodeMax; Index++) {
+    Current = Order[Index];
+    Status = mFdtFixups[Current].Handler (&Context, Context.Node[Current]);
+    if (EFI_ERROR (Status)) {
+      Print (L"Failed to %s: %r\n", mFdtFixups[Current].Description, Status);
+    }
+  }
+
+  if (Context.EthernetAlias != NULL) {
+    FreePool (Context.EthernetAlias);
+  }
+}
+
 /**
   @param  ImageHandle   of the loaded driver
   @param  SystemTable   Pointer to the System Table
@@ -397,39 +622,7 @@ FdtDxeInitialize (
      goto out;
   }
 
-  /*
-   * These are all best-effort.
-   */
-
-  Status = SanitizePSCI ();
-  if (EFI_ERROR (Status)) {
-    Print (L"Failed to sanitize PSCI: %r\n", Status);
-  }
-
-  Status = CleanMemoryNodes ();
-  if (EFI_ERROR (Status)) {
-    Print (L"Failed to clean memory nodes: %r\n", Status);
-  }
-
-  Status = CleanSimpleFramebuffer ();
-  if (EFI_ERROR (Status)) {
-    Print (L"Failed to clean frame buffer: %r\n", Status);
-  }
-
-  Status = FixEthernetAliases ();
-  if (EFI_ERROR (Status)) {
-    Print (L"Failed to fix ethernet aliases: %r\n", Status);
-  }
-
-  Status = UpdateMacAddress ();
-  if (EFI_ERROR (Status)) {
-    Print (L"Failed to update MAC address: %r\n", Status);
-  }
-
-  Status = AddUsbCompatibleProperty ();
-  if (EFI_ERROR (Status)) {
-    Print (L"Failed to update USB compatible properties: %r\n", Status);
-  }
+  FdtFixupApply ();
 
   DEBUG ((DEBUG_INFO, "Installed devicetree at address %p\n", mFdtImage));
   Status = gBS->InstallConfigurationTable (&gFdtTableGuid, mFdtImage);
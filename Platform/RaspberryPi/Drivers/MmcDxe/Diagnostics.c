@@ -13,11 +13,27 @@
 #include <Library/BaseMemoryLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/BaseLib.h>
+#include <Library/PrintLib.h>
+#include <Library/TimerLib.h>
 
 #include "Mmc.h"
 
 #define DIAGNOSTIC_LOGBUFFER_MAXCHAR  1024
 
+//
+// Extended diagnostics: throughput/latency benchmark. Every transfer size is run
+// BENCHMARK_ITERATIONS times, or fewer so that at most BENCHMARK_BYTES_PER_RUN
+// are moved per run. Writes put back the data just read, so the media content
+// is left unchanged.
+//
+#define DIAGNOSTIC_BENCHMARK_LOGBUFFER_MAXCHAR  4096
+#define BENCHMARK_ITERATIONS                    64
+#define BENCHMARK_BYTES_PER_RUN                 SIZE_16MB
+#define BENCHMARK_MAX_TRANSFER_SIZE             SIZE_1MB
+
+STATIC CONST UINTN mBenchmarkTransferSize[] = { SIZE_4KB, SIZE_64KB, SIZE_1MB };
+STATIC UINT64      mBenchmarkSeed = 0x2545F4914F6CDD1DULL;
+
 CHAR16* mLogBuffer = NULL;
 UINTN   mLogRemainChar = 0;
 
@@ -168,6 +184,196 @@ MmcReadWriteDataTest (
   return EFI_SUCCESS;
 }
 
+STATIC
+UINT64
+BenchmarkReadCounter (
+  VOID
+  )
+{
+  UINT64  StartValue;
+  UINT64  EndValue;
+  UINT64  Value;
+
+  GetPerformanceCounterProperties (&StartValue, &EndValue);
+  Value = GetPerformanceCounter ();
+
+  if (StartValue > EndValue) {
+    return StartValue - Value;
+  }
+  return Value;
+}
+
+STATIC
+UINT64
+BenchmarkRandom (
+  VOID
+  )
+{
+  mBenchmarkSeed = MultU64x64 (mBenchmarkSeed, 6364136223846793005ULL) + 1442695040888963407ULL;
+  return RShiftU64 (mBenchmarkSeed, 16);
+}
+
+STATIC
+VOID
+BenchmarkSortLatency (
+  UINT64 *Latency,
+  UINTN  Count
+  )
+{
+  UINTN  i;
+  UINTN  j;
+  UINT64 Value;
+
+  for (i = 1; i < Count; i++) {
+    Value = Latency[i];
+    for (j = i; (j > 0) && (Latency[j - 1] > Value); j--) {
+      Latency[j] = Latency[j - 1];
+    }
+    Latency[j] = Value;
+  }
+}
+
+/**
+  Time Count reads or writes of TransferSize bytes, either back to back from
+  the middle of the media or at random TransferSize aligned locations, and log
+  throughput, IOPS and latency percentiles.
+**/
+EFI_STATUS
+MmcBenchmarkRun (
+  MMC_HOST_INSTANCE *MmcHostInstance,
+  BOOLEAN           Write,
+  BOOLEAN           Random,
+  UINTN             TransferSize,
+  VOID              *Buffer,
+  UINT64            *Latency
+  )
+{
+  EFI_BLOCK_IO_MEDIA  *Media;
+  EFI_STATUS          Status;
+  EFI_LBA             Lba;
+  EFI_LBA             Slots;
+  UINT64              Start;
+  UINT64              TotalNs;
+  UINT64              KBps;
+  UINT64              Iops;
+  UINTN               Blocks;
+  UINTN               Count;
+  UINTN               i;
+  CHAR16              Line[160];
+
+  Media  = MmcHostInstance->BlockIo.Media;
+  Blocks = TransferSize / Media->BlockSize;
+  Count  = MIN (BENCHMARK_ITERATIONS, BENCHMARK_BYTES_PER_RUN / TransferSize);
+  Slots  = DivU64x32 (Media->LastBlock + 1, (UINT32)Blocks);
+  if (Slots < Count) {
+    return EFI_BAD_BUFFER_SIZE;
+  }
+
+  TotalNs = 0;
+  for (i = 0; i < Count; i++) {
+    if (Random) {
+      DivU64x64Remainder (BenchmarkRandom (), Slots, &Lba);
+    } else {
+      Lba = DivU64x32 (Slots - Count, 2) + i;
+    }
+    Lba = MultU64x32 (Lba, (UINT32)Blocks);
+
+    if (Write) {
+      Status = MmcReadBlocks (&(MmcHostInstance->BlockIo), Media->MediaId, Lba, TransferSize, Buffer);
+      if (EFI_ERROR (Status)) {
+        DiagnosticLog (L"ERROR: Fail to Read Block\n");
+        return Status;
+      }
+      Start = BenchmarkReadCounter ();
+      Status = MmcWriteBlocks (&(MmcHostInstance->BlockIo), Media->MediaId, Lba, TransferSize, Buffer);
+    } else {
+      Start = BenchmarkReadCounter ();
+      Status = MmcReadBlocks (&(MmcHostInstance->BlockIo), Media->MediaId, Lba, TransferSize, Buffer);
+    }
+    Latency[i] = GetTimeInNanoSecond (BenchmarkReadCounter () - Start);
+    if (EFI_ERROR (Status)) {
+      DiagnosticLog (Write ? L"ERROR: Fail to Write Block\n" : L"ERROR: Fail to Read Block\n");
+      return Status;
+    }
+    TotalNs += Latency[i];
+  }
+
+  if (TotalNs == 0) {
+    TotalNs = 1;
+  }
+  KBps = DivU64x64Remainder (MultU64x32 (1000000000ULL, (UINT32)(Count * TransferSize)),
+           MultU64x32 (TotalNs, SIZE_1KB), NULL);
+  Iops = DivU64x64Remainder (MultU64x64 (Count, 1000000000ULL), TotalNs, NULL);
+  BenchmarkSortLatency (Latency, Count);
+
+  UnicodeSPrint (Line, sizeof (Line),
+    L"%a %a %7d: %5ld.%ld MB/s %6ld IOPS, us p50 %ld p90 %ld p99 %ld max %ld\n",
+    Random ? "Rand" : "Seq ",
+    Write ? "Wr" : "Rd",
+    (UINT32)TransferSize,
+    DivU64x32 (KBps, SIZE_1KB),
+    DivU64x32 (MultU64x32 (ModU64x32 (KBps, SIZE_1KB), 10), SIZE_1KB),
+    Iops,
+    DivU64x32 (Latency[(Count - 1) * 50 / 100], 1000),
+    DivU64x32 (Latency[(Count - 1) * 90 / 100], 1000),
+    DivU64x32 (Latency[(Count - 1) * 99 / 100], 1000),
+    DivU64x32 (Latency[Count - 1], 1000));
+  DiagnosticLog (Line);
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+MmcBenchmark (
+  MMC_HOST_INSTANCE *MmcHostInstance
+  )
+{
+  EFI_STATUS  Status;
+  VOID        *Buffer;
+  UINT64      *Latency;
+  UINTN       TransferSize;
+  UINTN       Size;
+  UINTN       Pattern;
+
+  if (!MmcHostInstance->BlockIo.Media->MediaPresent) {
+    DiagnosticLog (L"ERROR: No Media Present\n");
+    return EFI_NO_MEDIA;
+  }
+
+  if (MmcHostInstance->State != MmcTransferState) {
+    DiagnosticLog (L"ERROR: Not ready for Transfer state\n");
+    return EFI_NOT_READY;
+  }
+
+  Buffer = AllocatePages (EFI_SIZE_TO_PAGES (BENCHMARK_MAX_TRANSFER_SIZE));
+  Latency = AllocatePool (BENCHMARK_ITERATIONS * sizeof (UINT64));
+  if ((Buffer == NULL) || (Latency == NULL)) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto Exit;
+  }
+
+  Status = EFI_SUCCESS;
+  for (Pattern = 0; (Pattern < 4) && !EFI_ERROR (Status); Pattern++) {
+    for (Size = 0; Size <= ARRAY_SIZE (mBenchmarkTransferSize); Size++) {
+      TransferSize = (Size == 0) ? MmcHostInstance->BlockIo.Media->BlockSize :
+                                   mBenchmarkTransferSize[Size - 1];
+      Status = MmcBenchmarkRun (MmcHostInstance, (Pattern & BIT0) != 0, (Pattern & BIT1) != 0,
+                 TransferSize, Buffer, Latency);
+      if (EFI_ERROR (Status)) {
+        break;
+      }
+    }
+  }
+
+Exit:
+  if (Buffer != NULL) {
+    FreePages (Buffer, EFI_SIZE_TO_PAGES (BENCHMARK_MAX_TRANSFER_SIZE));
+  }
+  if (Latency != NULL) {
+    FreePool (Latency);
+  }
+  return Status;
+}
+
 EFI_STATUS
 EFIAPI
 MmcDriverDiagnosticsRunDiagnostics (
@@ -200,8 +406,12 @@ MmcDriverDiagnosticsRunDiagnostics (
 
   Status = EFI_SUCCESS;
   *ErrorType = NULL;
-  *BufferSize = DIAGNOSTIC_LOGBUFFER_MAXCHAR;
-  *Buffer = DiagnosticInitLog (DIAGNOSTIC_LOGBUFFER_MAXCHAR);
+  if (DiagnosticType == EfiDriverDiagnosticTypeExtended) {
+    *BufferSize = DIAGNOSTIC_BENCHMARK_LOGBUFFER_MAXCHAR;
+  } else {
+    *BufferSize = DIAGNOSTIC_LOGBUFFER_MAXCHAR;
+  }
+  *Buffer = DiagnosticInitLog (*BufferSize);
 
   DiagnosticLog (L"MMC Driver Diagnostics\n");
 
@@ -245,6 +455,11 @@ MmcDriverDiagnosticsRunDiagnostics (
   DiagnosticLog (L"MMC Driver Diagnostics - Test: First Block / 2 BlockSSize\n");
   Status = MmcReadWriteDataTest (MmcHostInstance, 1, 2 * MmcHostInstance->BlockIo.Media->BlockSize);
 
+  if ((DiagnosticType == EfiDriverDiagnosticTypeExtended) && !EFI_ERROR (Status)) {
+    DiagnosticLog (L"MMC Driver Diagnostics - Benchmark\n");
+    Status = MmcBenchmark (MmcHostInstance);
+  }
+
   return Status;
 }
 
@@ -109,6 +109,16 @@ MMC_HOST_INSTANCE* CreateMmcHostInstance (
 
   MmcHostInstance->MmcHost = MmcHost;
 
+  // Reserve the read-ahead window; the cache is simply disabled if this fails
+  MmcHostInstance->ReadAheadSize = PcdGet32 (PcdMmcReadAheadSize);
+  if (MmcHostInstance->ReadAheadSize != 0) {
+    MmcHostInstance->ReadAheadBuffer = AllocatePages (EFI_SIZE_TO_PAGES (MmcHostInstance->ReadAheadSize));
+    if (MmcHostInstance->ReadAheadBuffer == NULL) {
+      DEBUG ((DEBUG_WARN, "%a: read-ahead cache disabled\n", __func__));
+      MmcHostInstance->ReadAheadSize = 0;
+    }
+  }
+
   // Create DevicePath for the new MMC Host
   Status = MmcHost->BuildDevicePath (MmcHost, &NewDevicePathNode);
   if (EFI_ERROR (Status)) {
@@ -140,6 +150,9 @@ FREE_DEVICE_PATH:
   FreePool (DevicePath);
 
 FREE_MEDIA:
+  if (MmcHostInstance->ReadAheadBuffer != NULL) {
+    FreePages (MmcHostInstance->ReadAheadBuffer, EFI_SIZE_TO_PAGES (MmcHostInstance->ReadAheadSize));
+  }
   FreePool (MmcHostInstance->BlockIo.Media);
 
 FREE_INSTANCE:
@@ -170,6 +183,9 @@ EFI_STATUS DestroyMmcHostInstance (
   if (MmcHostInstance->CardInfo.ECSDData) {
     FreePages (MmcHostInstance->CardInfo.ECSDData, EFI_SIZE_TO_PAGES (sizeof (ECSD)));
   }
+  if (MmcHostInstance->ReadAheadBuffer != NULL) {
+    FreePages (MmcHostInstance->ReadAheadBuffer, EFI_SIZE_TO_PAGES (MmcHostInstance->ReadAheadSize));
+  }
   FreePool (MmcHostInstance);
 
   return Status;
@@ -364,6 +380,7 @@ CheckCardsCallback (
 
     if (MmcHostInstance->MmcHost->IsCardPresent (MmcHostInstance->MmcHost) == !MmcHostInstance->Initialized) {
       MmcHostInstance->State = MmcHwInitializationState;
+      MmcInvalidateReadAhead (MmcHostInstance);
       MmcHostInstance->BlockIo.Media->MediaPresent = !MmcHostInstance->Initialized;
       MmcHostInstance->Initialized = !MmcHostInstance->Initialized;
 
@@ -27,6 +27,15 @@
 #define MMC_IOBLOCKS_READ       0
 #define MMC_IOBLOCKS_WRITE      1
 
+//
+// SET_BLOCK_COUNT (CMD23) takes a 16-bit block count on eMMC, which also
+// bounds the size of a single multi-block transfer.
+//
+#define MMC_MAX_BLOCK_COUNT     0xFFFF
+
+// SCR CMD_SUPPORT bits
+#define SD_SCR_CMD23_SUPPORT    BIT1
+
 #define MMC_OCR_POWERUP             0x80000000
 
 #define MMC_OCR_ACCESS_MASK         0x3     /* bit[30-29] */
@@ -65,8 +74,13 @@
 
 #define SWITCH_CMD_DATA_LENGTH              64
 #define SD_HIGH_SPEED_SUPPORTED             0x200
+#define SD_SDR50_SUPPORTED                  0x400
+#define SD_SDR104_SUPPORTED                 0x800
 #define SD_DEFAULT_SPEED                    25000000
 #define SD_HIGH_SPEED                       50000000
+#define SD_SDR50_SPEED                      100000000
+#define SD_SDR104_SPEED                     208000000
+#define EMMC_HS200_SPEED                    200000000
 #define SWITCH_CMD_SUCCESS_MASK             0xf
 
 #define BUSWIDTH_4                          4
@@ -328,8 +342,22 @@ typedef struct {
   CID       CIDData;
   CSD       CSDData;
   ECSD      *ECSDData;                         // MMC V4 extended card specific
+  BOOLEAN   SetBlockCountSupported;            // CMD23 pre-defined transfers
+  BOOLEAN   Signal1V8;                         // SD: switched to UHS-I signalling
 } CARD_INFO;
 
+//
+// Last converged tuning, so that the next boot with the same card can
+// skip the full tuning procedure.
+//
+#define MMC_TUNING_VARIABLE_NAME    L"MmcTuning"
+
+typedef struct {
+  UINT32    CidRaw[4];                         // R2 response, as in CIDData
+  UINT32    TimingMode;
+  UINT32    TuningValue;
+} MMC_TUNING_CACHE;
+
 typedef struct _MMC_HOST_INSTANCE {
   UINTN                     Signature;
   LIST_ENTRY                Link;
@@ -342,6 +370,15 @@ typedef struct _MMC_HOST_INSTANCE {
   EFI_MMC_HOST_PROTOCOL     *MmcHost;
 
   BOOLEAN                   Initialized;
+
+  //
+  // Read-ahead cache: ReadAheadBlocks == 0 means the window is empty.
+  //
+  VOID                      *ReadAheadBuffer;
+  UINTN                     ReadAheadSize;
+  EFI_LBA                   ReadAheadLba;
+  UINTN                     ReadAheadBlocks;
+  UINT32                    ReadAheadMediaId;
 } MMC_HOST_INSTANCE;
 
 #define MMC_HOST_INSTANCE_SIGNATURE                 SIGNATURE_32('m', 'm', 'c', 'h')
@@ -481,6 +518,17 @@ MmcFlushBlocks (
   IN EFI_BLOCK_IO_PROTOCOL  *This
   );
 
+/**
+  Drop any blocks held in the read-ahead cache.
+
+  @param  MmcHostInstance        The MMC host instance owning the cache.
+
+**/
+VOID
+MmcInvalidateReadAhead (
+  IN MMC_HOST_INSTANCE      *MmcHostInstance
+  );
+
 EFI_STATUS
 MmcNotifyState (
   IN MMC_HOST_INSTANCE      *MmcHostInstance,
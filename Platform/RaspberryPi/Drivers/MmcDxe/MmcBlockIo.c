@@ -176,6 +176,7 @@ MmcReset (
 
     // Indicate that the driver requires initialization
     MmcHostInstance->State = MmcHwInitializationState;
+    MmcInvalidateReadAhead (MmcHostInstance);
 
     return EFI_SUCCESS;
   }
@@ -213,6 +214,37 @@ MmcStopTransmission (
   return Status;
 }
 
+/**
+  Pre-define the length of the next multi-block transfer with CMD23, so that
+  the card ends it by itself and no CMD12 is needed.
+
+  @param[in]  MmcHostInstance   MMC host instance.
+  @param[in]  BlockCount        Number of blocks of the next transfer.
+
+**/
+STATIC
+EFI_STATUS
+MmcSetBlockCount (
+  IN MMC_HOST_INSTANCE        *MmcHostInstance,
+  IN UINTN                    BlockCount
+  )
+{
+  EFI_STATUS              Status;
+  UINT32                  Response[4];
+  EFI_MMC_HOST_PROTOCOL   *MmcHost;
+
+  MmcHost = MmcHostInstance->MmcHost;
+
+  ASSERT (BlockCount <= MMC_MAX_BLOCK_COUNT);
+  Status = MmcHost->SendCommand (MmcHost, MMC_CMD23, (UINT32)BlockCount);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  MmcHost->ReceiveResponse (MmcHost, MMC_RESPONSE_TYPE_R1, Response);
+  return EFI_SUCCESS;
+}
+
 STATIC
 EFI_STATUS
 MmcTransferBlock (
@@ -230,10 +262,27 @@ MmcTransferBlock (
   MMC_HOST_INSTANCE       *MmcHostInstance;
   EFI_MMC_HOST_PROTOCOL   *MmcHost;
   UINTN                   CmdArg;
+  BOOLEAN                 SetBlockCount;
 
   MmcHostInstance = MMC_HOST_INSTANCE_FROM_BLOCK_IO_THIS (This);
   MmcHost = MmcHostInstance->MmcHost;
 
+  //
+  // Use a pre-defined multi-block transfer when the card supports it. If
+  // CMD23 is rejected, fall back to open-ended transfers for good.
+  //
+  SetBlockCount = FALSE;
+  if (BufferSize > This->Media->BlockSize &&
+      MmcHostInstance->CardInfo.SetBlockCountSupported) {
+    Status = MmcSetBlockCount (MmcHostInstance, BufferSize / This->Media->BlockSize);
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_WARN, "%a(MMC_CMD23): Error %r, using CMD12\n", __func__, Status));
+      MmcHostInstance->CardInfo.SetBlockCountSupported = FALSE;
+    } else {
+      SetBlockCount = TRUE;
+    }
+  }
+
   //Set command argument based on the card access mode (Byte mode or Block mode)
   if ((MmcHostInstance->CardInfo.OCRData.AccessMode & MMC_OCR_ACCESS_MASK) ==
       MMC_OCR_ACCESS_SECTOR) {
@@ -262,10 +311,10 @@ MmcTransferBlock (
   }
 
   if (EFI_ERROR (Status) ||
-      BufferSize > This->Media->BlockSize) {
+      (BufferSize > This->Media->BlockSize && !SetBlockCount)) {
     /*
-     * CMD12 needs to be set for multiblock (to transition from
-     * RECV to PROG) or for errors.
+     * CMD12 needs to be set for open-ended multiblock (to transition
+     * from RECV to PROG) or for errors.
      */
     EFI_STATUS Status2 = MmcStopTransmission (MmcHost);
     if (EFI_ERROR (Status2)) {
@@ -284,13 +333,16 @@ MmcTransferBlock (
   }
 
   //
-  // For reads, should be already in TRAN. For writes, wait
-  // until programming finishes.
+  // For reads, should be already in TRAN, and a pre-defined read is known
+  // to be over once its last block is in. For writes, wait until
+  // programming finishes.
   //
-  Status = WaitUntilTran (MmcHostInstance);
-  if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_ERROR, "WaitUntilTran after write failed\n"));
-    return Status;
+  if (Transfer != MMC_IOBLOCKS_READ || !SetBlockCount) {
+    Status = WaitUntilTran (MmcHostInstance);
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "WaitUntilTran after write failed\n"));
+      return Status;
+    }
   }
 
   Status = MmcNotifyState (MmcHostInstance, MmcTransferState);
@@ -355,6 +407,8 @@ MmcIoBlocks (
       MMC_HOST_HAS_ISMULTIBLOCK (MmcHost) &&
       MmcHost->IsMultiBlock (MmcHost)) {
     BlockCount = (BufferSize + This->Media->BlockSize - 1) / This->Media->BlockSize;
+    // Split large requests in the largest transfers the card can take
+    BlockCount = MIN (BlockCount, MMC_MAX_BLOCK_COUNT);
   }
 
   // All blocks must be within the device
@@ -381,16 +435,24 @@ MmcIoBlocks (
     return EFI_INVALID_PARAMETER;
   }
 
+  //
+  // Every transfer leaves the card in TRAN, so only check it once.
+  //
+  Status = WaitUntilTran (MmcHostInstance);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "WaitUntilTran before IO failed"));
+    return Status;
+  }
+
   BytesRemainingToBeTransfered = BufferSize;
   while (BytesRemainingToBeTransfered > 0) {
-    Status = WaitUntilTran (MmcHostInstance);
-    if (EFI_ERROR (Status)) {
-      DEBUG ((DEBUG_ERROR, "WaitUntilTran before IO failed"));
-      return Status;
+    ConsumeSize = BlockCount * This->Media->BlockSize;
+    if (BytesRemainingToBeTransfered < ConsumeSize) {
+      ConsumeSize = BytesRemainingToBeTransfered;
     }
 
     if (Transfer == MMC_IOBLOCKS_READ) {
-      if (BlockCount == 1) {
+      if (ConsumeSize == This->Media->BlockSize) {
         // Read a single block
         Cmd = MMC_CMD17;
       } else {
@@ -398,7 +460,7 @@ MmcIoBlocks (
         Cmd = MMC_CMD18;
       }
     } else {
-      if (BlockCount == 1) {
+      if (ConsumeSize == This->Media->BlockSize) {
         // Write a single block
         Cmd = MMC_CMD24;
       } else {
@@ -407,11 +469,6 @@ MmcIoBlocks (
       }
     }
 
-    ConsumeSize = BlockCount * This->Media->BlockSize;
-    if (BytesRemainingToBeTransfered < ConsumeSize) {
-      ConsumeSize = BytesRemainingToBeTransfered;
-    }
-
     Status = MmcTransferBlock (This, Cmd, Transfer, MediaId, Lba, ConsumeSize, Buffer, &ConsumeSize);
     if (EFI_ERROR (Status)) {
       DEBUG ((DEBUG_ERROR, "%a(): Failed to transfer block and Status:%r\n", __func__, Status));
@@ -428,6 +485,14 @@ MmcIoBlocks (
   return EFI_SUCCESS;
 }
 
+VOID
+MmcInvalidateReadAhead (
+  IN MMC_HOST_INSTANCE      *MmcHostInstance
+  )
+{
+  MmcHostInstance->ReadAheadBlocks = 0;
+}
+
 EFI_STATUS
 EFIAPI
 MmcReadBlocks (
@@ -438,7 +503,70 @@ MmcReadBlocks (
   OUT VOID                    *Buffer
   )
 {
-  return MmcIoBlocks (This, MMC_IOBLOCKS_READ, MediaId, Lba, BufferSize, Buffer);
+  EFI_STATUS              Status;
+  MMC_HOST_INSTANCE       *MmcHostInstance;
+  EFI_BLOCK_IO_MEDIA      *Media;
+  UINTN                   BlockCount;
+  UINTN                   WindowBlocks;
+
+  MmcHostInstance = MMC_HOST_INSTANCE_FROM_BLOCK_IO_THIS (This);
+  Media = This->Media;
+
+  //
+  // Large reads gain nothing from the cache, and anything malformed is
+  // left to MmcIoBlocks to reject.
+  //
+  if ((MmcHostInstance->ReadAheadBuffer == NULL) ||
+      (Buffer == NULL) ||
+      (MediaId != Media->MediaId) ||
+      !Media->MediaPresent ||
+      (BufferSize == 0) ||
+      (BufferSize >= MmcHostInstance->ReadAheadSize) ||
+      ((BufferSize % Media->BlockSize) != 0) ||
+      (Lba > Media->LastBlock)) {
+    return MmcIoBlocks (This, MMC_IOBLOCKS_READ, MediaId, Lba, BufferSize, Buffer);
+  }
+
+  BlockCount = BufferSize / Media->BlockSize;
+
+  if ((MmcHostInstance->ReadAheadBlocks == 0) ||
+      (MmcHostInstance->ReadAheadMediaId != MediaId) ||
+      (Lba < MmcHostInstance->ReadAheadLba) ||
+      ((Lba + BlockCount) > (MmcHostInstance->ReadAheadLba + MmcHostInstance->ReadAheadBlocks))) {
+    //
+    // Miss: refill the window starting at the requested block, clamped to
+    // the end of the media.
+    //
+    WindowBlocks = MmcHostInstance->ReadAheadSize / Media->BlockSize;
+    if ((Media->LastBlock + 1 - Lba) < WindowBlocks) {
+      WindowBlocks = (UINTN)(Media->LastBlock + 1 - Lba);
+    }
+    if (WindowBlocks < BlockCount) {
+      return MmcIoBlocks (This, MMC_IOBLOCKS_READ, MediaId, Lba, BufferSize, Buffer);
+    }
+
+    MmcInvalidateReadAhead (MmcHostInstance);
+    Status = MmcIoBlocks (This, MMC_IOBLOCKS_READ, MediaId, Lba,
+               WindowBlocks * Media->BlockSize, MmcHostInstance->ReadAheadBuffer);
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_WARN, "%a: read-ahead of %u blocks at 0x%lx failed: %r\n",
+        __func__, (UINT32)WindowBlocks, Lba, Status));
+      return MmcIoBlocks (This, MMC_IOBLOCKS_READ, MediaId, Lba, BufferSize, Buffer);
+    }
+
+    MmcHostInstance->ReadAheadLba = Lba;
+    MmcHostInstance->ReadAheadBlocks = WindowBlocks;
+    MmcHostInstance->ReadAheadMediaId = MediaId;
+  }
+
+  CopyMem (
+    Buffer,
+    (UINT8*)MmcHostInstance->ReadAheadBuffer +
+      (UINTN)(Lba - MmcHostInstance->ReadAheadLba) * Media->BlockSize,
+    BufferSize
+    );
+
+  return EFI_SUCCESS;
 }
 
 EFI_STATUS
@@ -451,6 +579,7 @@ MmcWriteBlocks (
   IN VOID                     *Buffer
   )
 {
+  MmcInvalidateReadAhead (MMC_HOST_INSTANCE_FROM_BLOCK_IO_THIS (This));
   return MmcIoBlocks (This, MMC_IOBLOCKS_WRITE, MediaId, Lba, BufferSize, Buffer);
 }
 
@@ -460,5 +589,6 @@ MmcFlushBlocks (
   IN EFI_BLOCK_IO_PROTOCOL  *This
   )
 {
+  MmcInvalidateReadAhead (MMC_HOST_INSTANCE_FROM_BLOCK_IO_THIS (This));
   return EFI_SUCCESS;
 }
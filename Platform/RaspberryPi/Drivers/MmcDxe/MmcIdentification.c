@@ -10,6 +10,7 @@
 #include <Library/BaseMemoryLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/TimerLib.h>
+#include <Library/UefiRuntimeServicesTableLib.h>
 
 #include "Mmc.h"
 
@@ -45,6 +46,13 @@ typedef union {
 
 #define SD_CCC_SWITCH           (1 << 10)
 
+#define SD_OCR_S18R             BIT24       // ACMD41: request 1.8V signalling
+#define SD_OCR_S18A             BIT24       // ACMD41 response: 1.8V accepted
+
+#define SD_SWITCH_FUNC_HS       1
+#define SD_SWITCH_FUNC_SDR50    2
+#define SD_SWITCH_FUNC_SDR104   3
+
 #define DEVICE_STATE(x)         (((x) >> 9) & 0xf)
 typedef enum _EMMC_DEVICE_STATE {
   EMMC_IDLE_STATE = 0,
@@ -242,6 +250,8 @@ EmmcIdentificationMode (
 
   // Setup card type
   MmcHostInstance->CardInfo.CardType = EMMC_CARD;
+  // SET_BLOCK_COUNT is mandatory for eMMC
+  MmcHostInstance->CardInfo.SetBlockCountSupported = TRUE;
   return EFI_SUCCESS;
 
 FreePageExit:
@@ -249,6 +259,125 @@ FreePageExit:
   return Status;
 }
 
+/**
+  Tune the sampling point for the current bus timing.
+
+  The last converged value is kept in a non-volatile variable together
+  with the card CID, so that a reboot with the same card only needs one
+  tuning command to validate it. A full tuning sweep is only executed if
+  there's no matching entry or the cached value no longer works.
+**/
+STATIC
+EFI_STATUS
+MmcExecuteTuning (
+  IN  MMC_HOST_INSTANCE   *MmcHostInstance,
+  IN  MMC_CMD             TuningCmd,
+  IN  UINT32              TimingMode
+  )
+{
+  EFI_MMC_HOST_PROTOCOL *Host;
+  MMC_TUNING_CACHE      Cache;
+  UINTN                 Size;
+  EFI_STATUS            Status;
+
+  Host = MmcHostInstance->MmcHost;
+
+  Size = sizeof (Cache);
+  Status = gRT->GetVariable (MMC_TUNING_VARIABLE_NAME,
+                  &gRaspberryPiTokenSpaceGuid, NULL, &Size, &Cache);
+  if (!EFI_ERROR (Status) && Size == sizeof (Cache) &&
+      Cache.TimingMode == TimingMode &&
+      CompareMem (Cache.CidRaw, &MmcHostInstance->CardInfo.CIDData,
+        sizeof (Cache.CidRaw)) == 0 &&
+      MMC_HOST_HAS_SETTUNING (Host)) {
+    Status = Host->SetTuning (Host, TuningCmd, Cache.TuningValue);
+    if (!EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_INFO, "%a: reusing tuning 0x%x\n", __FUNCTION__,
+        Cache.TuningValue));
+      return EFI_SUCCESS;
+    }
+    DEBUG ((DEBUG_WARN, "%a: cached tuning 0x%x rejected, retuning\n",
+      __FUNCTION__, Cache.TuningValue));
+  }
+
+  Status = Host->ExecuteTuning (Host, TuningCmd, &Cache.TuningValue);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a: tuning failed: %r\n", __FUNCTION__, Status));
+    return Status;
+  }
+
+  CopyMem (Cache.CidRaw, &MmcHostInstance->CardInfo.CIDData, sizeof (Cache.CidRaw));
+  Cache.TimingMode = TimingMode;
+  Status = gRT->SetVariable (MMC_TUNING_VARIABLE_NAME,
+                  &gRaspberryPiTokenSpaceGuid,
+                  EFI_VARIABLE_NON_VOLATILE | EFI_VARIABLE_BOOTSERVICE_ACCESS,
+                  sizeof (Cache), &Cache);
+  if (EFI_ERROR (Status)) {
+    //
+    // Not fatal, we'll just tune from scratch on the next boot.
+    //
+    DEBUG ((DEBUG_WARN, "%a: failed to save tuning: %r\n", __FUNCTION__, Status));
+  }
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+EmmcSetHs200 (
+  IN  MMC_HOST_INSTANCE   *MmcHostInstance,
+  IN  UINT32              BusWidth
+  )
+{
+  EFI_MMC_HOST_PROTOCOL *Host;
+  EFI_STATUS            Status;
+
+  Host = MmcHostInstance->MmcHost;
+
+  //
+  // HS200 is SDR only, and the bus width must be set before HS_TIMING.
+  //
+  Status = EmmcSetEXTCSD (MmcHostInstance, EXTCSD_BUS_WIDTH,
+             BusWidth == 8 ? EMMC_BUS_WIDTH_8BIT : EMMC_BUS_WIDTH_4BIT);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a: Failed to set EXTCSD bus width, Status:%r\n", __FUNCTION__, Status));
+    return Status;
+  }
+
+  Status = Host->SetIos (Host, 0, BusWidth, EMMCBACKWARD);
+  if (EFI_ERROR (Status)) {
+    goto Revert;
+  }
+
+  Status = EmmcSetEXTCSD (MmcHostInstance, EXTCSD_HS_TIMING, EMMC_TIMING_HS200);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a: Failed to switch HS200 timing, Status:%r\n", __FUNCTION__, Status));
+    goto Revert;
+  }
+
+  Status = Host->SetIos (Host, EMMC_HS200_SPEED, BusWidth, EMMCHS200SDR1V8);
+  if (EFI_ERROR (Status)) {
+    goto Revert;
+  }
+
+  Status = MmcExecuteTuning (MmcHostInstance, MMC_CMD21, EMMCHS200SDR1V8);
+  if (EFI_ERROR (Status)) {
+    goto Revert;
+  }
+
+  DEBUG ((DEBUG_INFO, "%a: eMMC running HS200 %u-bit\n", __FUNCTION__, BusWidth));
+  return EFI_SUCCESS;
+
+Revert:
+  //
+  // Drop back to a clock every timing can cope with, and let the caller
+  // try the legacy high speed modes.
+  //
+  DEBUG ((DEBUG_WARN, "%a: HS200 not usable: %r\n", __FUNCTION__, Status));
+  Host->SetIos (Host, 26000000, BusWidth, EMMCHS26);
+  return Status;
+}
+
 STATIC
 EFI_STATUS
 InitializeEmmcDevice (
@@ -283,6 +412,16 @@ InitializeEmmcDevice (
     return EFI_SUCCESS;
   }
 
+  if ((ECSDData->DEVICE_TYPE & EMMCHS200SDR1V8) != 0 && BusWidth != 1 &&
+      MMC_HOST_HAS_GETCAPABILITIES (Host) &&
+      MMC_HOST_HAS_EXECUTETUNING (Host) &&
+      (Host->GetCapabilities (Host) & EMMCHS200SDR1V8) != 0) {
+    Status = EmmcSetHs200 (MmcHostInstance, BusWidth);
+    if (!EFI_ERROR (Status)) {
+      return EFI_SUCCESS;
+    }
+  }
+
   Status = EmmcSetEXTCSD (MmcHostInstance, EXTCSD_HS_TIMING, EMMC_TIMING_HS);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "InitializeEmmcDevice(): Failed to switch high speed mode, Status:%r.\n", Status));
@@ -568,6 +707,109 @@ SdSetSpeed (
   return EFI_SUCCESS;
 }
 
+STATIC
+EFI_STATUS
+SdSwitchFunction (
+  IN  MMC_HOST_INSTANCE *MmcHostInstance,
+  IN  UINT32            Function,
+  IN  BOOLEAN           Mode,
+  OUT UINT32            *Buffer
+  )
+{
+  EFI_STATUS            Status;
+  EFI_MMC_HOST_PROTOCOL *MmcHost = MmcHostInstance->MmcHost;
+
+  Status = MmcHost->SendCommand (MmcHost, MMC_CMD6,
+             SdSwitchCmdArgument (Function, 0xf, 0xf, 0xf, Mode));
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a(%u): error: %r\n", __FUNCTION__, __LINE__, Status));
+    return Status;
+  }
+
+  Status = MmcHost->ReadBlockData (MmcHost, 0, SWITCH_CMD_DATA_LENGTH, Buffer);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a(%u): error: %r\n", __FUNCTION__, __LINE__, Status));
+    return Status;
+  }
+
+  if (Mode && (Buffer[4] & SWITCH_CMD_SUCCESS_MASK) != Function) {
+    return EFI_DEVICE_ERROR;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Move a card already signalling at 1.8V from SDR25 to the fastest UHS-I
+  SDR mode both sides support. Falls back to high speed on any failure.
+**/
+STATIC
+EFI_STATUS
+SdSetUhsSpeed (
+  IN  MMC_HOST_INSTANCE *MmcHostInstance
+  )
+{
+  UINT32                Buffer[16];
+  UINT32                HostCaps;
+  UINT32                Function;
+  UINT32                TimingMode;
+  UINT32                Speed;
+  EFI_STATUS            Status;
+  EFI_MMC_HOST_PROTOCOL *MmcHost = MmcHostInstance->MmcHost;
+
+  if (!MMC_HOST_HAS_GETCAPABILITIES (MmcHost) ||
+      !MMC_HOST_HAS_EXECUTETUNING (MmcHost)) {
+    return EFI_SUCCESS;
+  }
+  HostCaps = MmcHost->GetCapabilities (MmcHost);
+
+  Status = SdSwitchFunction (MmcHostInstance, 0xf, FALSE, Buffer);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  if ((Buffer[3] & SD_SDR104_SUPPORTED) != 0 && (HostCaps & SDUHSSDR104) != 0) {
+    Function = SD_SWITCH_FUNC_SDR104;
+    TimingMode = SDUHSSDR104;
+    Speed = SD_SDR104_SPEED;
+  } else if ((Buffer[3] & SD_SDR50_SUPPORTED) != 0 && (HostCaps & SDUHSSDR50) != 0) {
+    Function = SD_SWITCH_FUNC_SDR50;
+    TimingMode = SDUHSSDR50;
+    Speed = SD_SDR50_SPEED;
+  } else {
+    DEBUG ((DEBUG_INFO, "%a: no common UHS-I mode\n", __FUNCTION__));
+    return EFI_SUCCESS;
+  }
+
+  Status = SdSwitchFunction (MmcHostInstance, Function, TRUE, Buffer);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a: Problem switching SD card into UHS-I mode %u\n",
+      __FUNCTION__, Function));
+    return EFI_SUCCESS;
+  }
+
+  Status = MmcHost->SetIos (MmcHost, Speed, 0, TimingMode);
+  if (!EFI_ERROR (Status)) {
+    Status = MmcExecuteTuning (MmcHostInstance, MMC_CMD19, TimingMode);
+  }
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_WARN, "%a: UHS-I mode %u not usable: %r\n",
+      __FUNCTION__, Function, Status));
+    Speed = PcdGet32 (PcdMmcSdHighSpeedMHz) * 1000000;
+    if (Speed == 0) {
+      Speed = SD_HIGH_SPEED;
+    }
+    //
+    // Lower the clock first so that the switch command itself is reliable.
+    //
+    MmcHost->SetIos (MmcHost, Speed, 0, EMMCBACKWARD);
+    return SdSwitchFunction (MmcHostInstance, SD_SWITCH_FUNC_HS, TRUE, Buffer);
+  }
+
+  DEBUG ((DEBUG_INFO, "SD card running UHS-I mode %u at %u Hz\n", Function, Speed));
+  return EFI_SUCCESS;
+}
+
 STATIC
 EFI_STATUS
 SdExecuteScr (
@@ -670,11 +912,17 @@ InitializeSdMmcDevice (
     return Status;
   }
 
+  ZeroMem (&Scr, sizeof (Scr));
   Status = SdExecuteScr (MmcHostInstance, &Scr);
   if (EFI_ERROR (Status)) {
      return Status;
   }
 
+  MmcHostInstance->CardInfo.SetBlockCountSupported =
+    (Scr.CMD_SUPPORT & SD_SCR_CMD23_SUPPORT) != 0;
+  DEBUG ((DEBUG_INFO, "SD Card %a SET_BLOCK_COUNT\n",
+    MmcHostInstance->CardInfo.SetBlockCountSupported ? "supports" : "does not support"));
+
   if (Scr.SD_SPEC == 2) {
     if (Scr.SD_SPEC3 == 1) {
       if (Scr.SD_SPEC4 == 1) {
@@ -713,6 +961,18 @@ InitializeSdMmcDevice (
     }
   }
 
+  //
+  // UHS-I modes need the 4-bit bus, and CMD6 to have worked above.
+  //
+  if (MmcHostInstance->CardInfo.Signal1V8 && CccSwitch &&
+      (Scr.SD_BUS_WIDTHS & SD_BUS_WIDTH_4BIT) != 0 &&
+      !PcdGet32 (PcdMmcForce1Bit)) {
+    Status = SdSetUhsSpeed (MmcHostInstance);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+  }
+
   return EFI_SUCCESS;
 }
 
@@ -728,12 +988,14 @@ MmcIdentificationMode (
   UINTN                   Timeout;
   UINTN                   CmdArg;
   BOOLEAN                 IsHCS;
+  BOOLEAN                 UseS18R;
   EFI_MMC_HOST_PROTOCOL   *MmcHost;
   OCR_RESPONSE            OcrResponse;
 
   MmcHost = MmcHostInstance->MmcHost;
   CmdArg = 0;
   IsHCS = FALSE;
+  UseS18R = FALSE;
 
   if (MmcHost == NULL) {
     return EFI_INVALID_PARAMETER;
@@ -820,6 +1082,14 @@ MmcIdentificationMode (
     DEBUG ((DEBUG_ERROR, "Not a SD2.0 Card\n"));
   }
 
+  MmcHostInstance->CardInfo.Signal1V8 = FALSE;
+  if (IsHCS && !PcdGet32 (PcdMmcForceDefaultSpeed) &&
+      MMC_HOST_HAS_GETCAPABILITIES (MmcHost) &&
+      MMC_HOST_HAS_SWITCHVOLTAGE (MmcHost) &&
+      (MmcHost->GetCapabilities (MmcHost) & (SDUHSSDR50 | SDUHSSDR104)) != 0) {
+    UseS18R = TRUE;
+  }
+
   // We need to wait for the MMC or SD card is ready => (gCardInfo.OCRData.PowerUp == 1)
   Timeout = MAX_RETRY_COUNT;
   while (Timeout > 0) {
@@ -838,6 +1108,9 @@ MmcIdentificationMode (
       if (IsHCS) {
         CmdArg |= BIT30;
       }
+      if (UseS18R) {
+        CmdArg |= SD_OCR_S18R;
+      }
       Status = MmcHost->SendCommand (MmcHost, MMC_ACMD41, CmdArg);
       if (!EFI_ERROR (Status)) {
         Status = MmcHost->ReceiveResponse (MmcHost, MMC_RESPONSE_TYPE_OCR, Response);
@@ -886,6 +1159,23 @@ MmcIdentificationMode (
     PrintOCR (Response[0]);
   }
 
+  if (UseS18R && MmcHostInstance->CardInfo.CardType != MMC_CARD &&
+      (Response[0] & SD_OCR_S18A) != 0) {
+    //
+    // The card agreed to 1.8V signalling, do the CMD11 voltage switch
+    // sequence. A card that fails it needs a power cycle to recover.
+    //
+    Status = MmcHost->SendCommand (MmcHost, MMC_CMD11, 0);
+    if (!EFI_ERROR (Status)) {
+      Status = MmcHost->SwitchVoltage (MmcHost);
+    }
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "MmcIdentificationMode(): 1.8V switch failed, Status=%r.\n", Status));
+      return Status;
+    }
+    MmcHostInstance->CardInfo.Signal1V8 = TRUE;
+  }
+
   Status = MmcNotifyState (MmcHostInstance, MmcReadyState);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "MmcIdentificationMode() : Error MmcReadyState\n"));
@@ -904,6 +1194,7 @@ MmcIdentificationMode (
   }
 
   PrintCID (Response);
+  CopyMem (&MmcHostInstance->CardInfo.CIDData, Response, sizeof (Response));
 
   Status = MmcHost->NotifyState (MmcHost, MmcIdentificationState);
   if (EFI_ERROR (Status)) {
@@ -229,26 +229,81 @@ typedef struct {
   UINT32                    Size;
 } RPI_FW_ARM_MEMORY_TAG;
 
+typedef struct {
+  UINT8                     MacAddress[6];
+  UINT32                    Padding;
+} RPI_FW_MAC_ADDR_TAG;
+
+typedef struct {
+  UINT64                    Serial;
+} RPI_FW_SERIAL_TAG;
+
+typedef struct {
+  UINT32                    Model;
+} RPI_FW_MODEL_TAG;
+
+typedef struct {
+  UINT32                    Revision;
+} RPI_FW_MODEL_REVISION_TAG;
+#pragma pack()
+
+#pragma pack(1)
 typedef struct {
   RPI_FW_BUFFER_HEAD        BufferHead;
-  RPI_FW_TAG_HEAD           TagHead;
-  RPI_FW_ARM_MEMORY_TAG     TagBody;
+  RPI_FW_TAG_HEAD           FirmwareRevisionTag;
+  RPI_FW_MODEL_REVISION_TAG FirmwareRevision;
+  RPI_FW_TAG_HEAD           ModelTag;
+  RPI_FW_MODEL_TAG          Model;
+  RPI_FW_TAG_HEAD           ModelRevisionTag;
+  RPI_FW_MODEL_REVISION_TAG ModelRevision;
+  RPI_FW_TAG_HEAD           MacAddressTag;
+  RPI_FW_MAC_ADDR_TAG       MacAddress;
+  RPI_FW_TAG_HEAD           SerialTag;
+  RPI_FW_SERIAL_TAG         Serial;
+  RPI_FW_TAG_HEAD           ArmMemoryTag;
+  RPI_FW_ARM_MEMORY_TAG     ArmMemory;
   UINT32                    EndTag;
-} RPI_FW_GET_ARM_MEMORY_CMD;
+} RPI_FW_GET_BOARD_INFO_CMD;
 #pragma pack()
 
+//
+// None of the board properties change while we are running, so they are all
+// fetched in a single mailbox transaction the first time any of them is
+// needed, and served from this copy afterwards.
+//
+STATIC RPI_FW_GET_BOARD_INFO_CMD  mBoardInfo;
+STATIC BOOLEAN                    mBoardInfoValid;
+
+#define RPI_FW_TAG_ANSWERED(Tag) \
+  (((Tag).TagValueSize & RPI_MBOX_VALUE_SIZE_RESPONSE_MASK) != 0)
+
+STATIC
+VOID
+RpiFirmwareInitTag (
+  OUT   RPI_FW_TAG_HEAD   *TagHead,
+  IN    UINT32            TagId,
+  IN    UINT32            TagSize
+  )
+{
+  TagHead->TagId        = TagId;
+  TagHead->TagSize      = TagSize;
+  TagHead->TagValueSize = 0;
+}
+
 STATIC
 EFI_STATUS
-EFIAPI
-RpiFirmwareGetArmMemory (
-  OUT   UINT32 *Base,
-  OUT   UINT32 *Size
+RpiFirmwareGetBoardInfo (
+  VOID
   )
 {
-  RPI_FW_GET_ARM_MEMORY_CMD   *Cmd;
+  RPI_FW_GET_BOARD_INFO_CMD   *Cmd;
   EFI_STATUS                  Status;
   UINT32                      Result;
 
+  if (mBoardInfoValid) {
+    return EFI_SUCCESS;
+  }
+
   if (!AcquireSpinLockOrFail (&mMailboxLock)) {
     DEBUG ((DEBUG_ERROR, "%a: failed to acquire spinlock\n", __FUNCTION__));
     return EFI_DEVICE_ERROR;
@@ -259,97 +314,79 @@ RpiFirmwareGetArmMemory (
 
   Cmd->BufferHead.BufferSize  = sizeof (*Cmd);
   Cmd->BufferHead.Response    = 0;
-  Cmd->TagHead.TagId          = RPI_MBOX_GET_ARM_MEMSIZE;
-  Cmd->TagHead.TagSize        = sizeof (Cmd->TagBody);
-  Cmd->TagHead.TagValueSize   = 0;
+  RpiFirmwareInitTag (&Cmd->FirmwareRevisionTag, RPI_MBOX_GET_REVISION,
+    sizeof (Cmd->FirmwareRevision));
+  RpiFirmwareInitTag (&Cmd->ModelTag, RPI_MBOX_GET_BOARD_MODEL,
+    sizeof (Cmd->Model));
+  RpiFirmwareInitTag (&Cmd->ModelRevisionTag, RPI_MBOX_GET_BOARD_REVISION,
+    sizeof (Cmd->ModelRevision));
+  RpiFirmwareInitTag (&Cmd->MacAddressTag, RPI_MBOX_GET_MAC_ADDRESS,
+    sizeof (Cmd->MacAddress));
+  RpiFirmwareInitTag (&Cmd->SerialTag, RPI_MBOX_GET_BOARD_SERIAL,
+    sizeof (Cmd->Serial));
+  RpiFirmwareInitTag (&Cmd->ArmMemoryTag, RPI_MBOX_GET_ARM_MEMSIZE,
+    sizeof (Cmd->ArmMemory));
   Cmd->EndTag                 = 0;
 
   Status = MailboxTransaction (Cmd->BufferHead.BufferSize, RPI_MBOX_VC_CHANNEL, &Result);
 
+  if (!EFI_ERROR (Status) &&
+      Cmd->BufferHead.Response == RPI_MBOX_RESP_SUCCESS) {
+    CopyMem (&mBoardInfo, Cmd, sizeof (mBoardInfo));
+    mBoardInfoValid = TRUE;
+  }
+
   ReleaseSpinLock (&mMailboxLock);
 
-  if (EFI_ERROR (Status) ||
-      Cmd->BufferHead.Response != RPI_MBOX_RESP_SUCCESS) {
+  if (!mBoardInfoValid) {
     DEBUG ((DEBUG_ERROR,
       "%a: mailbox transaction error: Status == %r, Response == 0x%x\n",
       __FUNCTION__, Status, Cmd->BufferHead.Response));
     return EFI_DEVICE_ERROR;
   }
 
-  *Base = Cmd->TagBody.Base;
-  *Size = Cmd->TagBody.Size;
   return EFI_SUCCESS;
 }
 
-#pragma pack()
-typedef struct {
-  UINT8                     MacAddress[6];
-  UINT32                    Padding;
-} RPI_FW_MAC_ADDR_TAG;
-
-typedef struct {
-  RPI_FW_BUFFER_HEAD        BufferHead;
-  RPI_FW_TAG_HEAD           TagHead;
-  RPI_FW_MAC_ADDR_TAG       TagBody;
-  UINT32                    EndTag;
-} RPI_FW_GET_MAC_ADDR_CMD;
-#pragma pack()
-
 STATIC
 EFI_STATUS
 EFIAPI
-RpiFirmwareGetMacAddress (
-  OUT   UINT8   MacAddress[6]
+RpiFirmwareGetArmMemory (
+  OUT   UINT32 *Base,
+  OUT   UINT32 *Size
   )
 {
-  RPI_FW_GET_MAC_ADDR_CMD     *Cmd;
   EFI_STATUS                  Status;
-  UINT32                      Result;
 
-  if (!AcquireSpinLockOrFail (&mMailboxLock)) {
-    DEBUG ((DEBUG_ERROR, "%a: failed to acquire spinlock\n", __FUNCTION__));
+  Status = RpiFirmwareGetBoardInfo ();
+  if (EFI_ERROR (Status) || !RPI_FW_TAG_ANSWERED (mBoardInfo.ArmMemoryTag)) {
     return EFI_DEVICE_ERROR;
   }
 
-  Cmd = mDmaBuffer;
-  ZeroMem (Cmd, sizeof (*Cmd));
-
-  Cmd->BufferHead.BufferSize  = sizeof (*Cmd);
-  Cmd->BufferHead.Response    = 0;
-  Cmd->TagHead.TagId          = RPI_MBOX_GET_MAC_ADDRESS;
-  Cmd->TagHead.TagSize        = sizeof (Cmd->TagBody);
-  Cmd->TagHead.TagValueSize   = 0;
-  Cmd->EndTag                 = 0;
-
-  Status = MailboxTransaction (Cmd->BufferHead.BufferSize, RPI_MBOX_VC_CHANNEL, &Result);
+  *Base = mBoardInfo.ArmMemory.Base;
+  *Size = mBoardInfo.ArmMemory.Size;
+  return EFI_SUCCESS;
+}
 
-  ReleaseSpinLock (&mMailboxLock);
+STATIC
+EFI_STATUS
+EFIAPI
+RpiFirmwareGetMacAddress (
+  OUT   UINT8   MacAddress[6]
+  )
+{
+  EFI_STATUS                  Status;
 
-  if (EFI_ERROR (Status) ||
-      Cmd->BufferHead.Response != RPI_MBOX_RESP_SUCCESS) {
-    DEBUG ((DEBUG_ERROR,
-      "%a: mailbox transaction error: Status == %r, Response == 0x%x\n",
-      __FUNCTION__, Status, Cmd->BufferHead.Response));
+  Status = RpiFirmwareGetBoardInfo ();
+  if (EFI_ERROR (Status) || !RPI_FW_TAG_ANSWERED (mBoardInfo.MacAddressTag)) {
     return EFI_DEVICE_ERROR;
   }
 
-  CopyMem (MacAddress, Cmd->TagBody.MacAddress, sizeof (Cmd->TagBody.MacAddress));
+  CopyMem (MacAddress, mBoardInfo.MacAddress.MacAddress,
+    sizeof (mBoardInfo.MacAddress.MacAddress));
   return EFI_SUCCESS;
 }
 
-#pragma pack()
-typedef struct {
-  UINT64                    Serial;
-} RPI_FW_SERIAL_TAG;
-
-typedef struct {
-  RPI_FW_BUFFER_HEAD        BufferHead;
-  RPI_FW_TAG_HEAD           TagHead;
-  RPI_FW_SERIAL_TAG         TagBody;
-  UINT32                    EndTag;
-} RPI_FW_GET_SERIAL_CMD;
-#pragma pack()
-
 STATIC
 EFI_STATUS
 EFIAPI
@@ -357,38 +394,14 @@ RpiFirmwareGetSerial (
   OUT   UINT64 *Serial
   )
 {
-  RPI_FW_GET_SERIAL_CMD       *Cmd;
   EFI_STATUS                  Status;
-  UINT32                      Result;
-
-  if (!AcquireSpinLockOrFail (&mMailboxLock)) {
-    DEBUG ((DEBUG_ERROR, "%a: failed to acquire spinlock\n", __FUNCTION__));
-    return EFI_DEVICE_ERROR;
-  }
-
-  Cmd = mDmaBuffer;
-  ZeroMem (Cmd, sizeof (*Cmd));
-
-  Cmd->BufferHead.BufferSize  = sizeof (*Cmd);
-  Cmd->BufferHead.Response    = 0;
-  Cmd->TagHead.TagId          = RPI_MBOX_GET_BOARD_SERIAL;
-  Cmd->TagHead.TagSize        = sizeof (Cmd->TagBody);
-  Cmd->TagHead.TagValueSize   = 0;
-  Cmd->EndTag                 = 0;
 
-  Status = MailboxTransaction (Cmd->BufferHead.BufferSize, RPI_MBOX_VC_CHANNEL, &Result);
-
-  ReleaseSpinLock (&mMailboxLock);
-
-  if (EFI_ERROR (Status) ||
-      Cmd->BufferHead.Response != RPI_MBOX_RESP_SUCCESS) {
-    DEBUG ((DEBUG_ERROR,
-      "%a: mailbox transaction error: Status == %r, Response == 0x%x\n",
-      __FUNCTION__, Status, Cmd->BufferHead.Response));
+  Status = RpiFirmwareGetBoardInfo ();
+  if (EFI_ERROR (Status) || !RPI_FW_TAG_ANSWERED (mBoardInfo.SerialTag)) {
     return EFI_DEVICE_ERROR;
   }
 
-  *Serial = Cmd->TagBody.Serial;
+  *Serial = mBoardInfo.Serial.Serial;
   // Some platforms return 0 or 0x0000000010000000 for serial.
   // For those, try to use the MAC address.
   if ((*Serial == 0) || ((*Serial & 0xFFFFFFFF0FFFFFFFULL) == 0)) {
@@ -400,19 +413,6 @@ RpiFirmwareGetSerial (
   return Status;
 }
 
-#pragma pack()
-typedef struct {
-  UINT32                    Model;
-} RPI_FW_MODEL_TAG;
-
-typedef struct {
-  RPI_FW_BUFFER_HEAD        BufferHead;
-  RPI_FW_TAG_HEAD           TagHead;
-  RPI_FW_MODEL_TAG          TagBody;
-  UINT32                    EndTag;
-} RPI_FW_GET_MODEL_CMD;
-#pragma pack()
-
 STATIC
 EFI_STATUS
 EFIAPI
@@ -420,54 +420,17 @@ RpiFirmwareGetModel (
   OUT   UINT32 *Model
   )
 {
-  RPI_FW_GET_MODEL_CMD       *Cmd;
   EFI_STATUS                  Status;
-  UINT32                      Result;
-
-  if (!AcquireSpinLockOrFail (&mMailboxLock)) {
-    DEBUG ((DEBUG_ERROR, "%a: failed to acquire spinlock\n", __FUNCTION__));
-    return EFI_DEVICE_ERROR;
-  }
-
-  Cmd = mDmaBuffer;
-  ZeroMem (Cmd, sizeof (*Cmd));
 
-  Cmd->BufferHead.BufferSize  = sizeof (*Cmd);
-  Cmd->BufferHead.Response    = 0;
-  Cmd->TagHead.TagId          = RPI_MBOX_GET_BOARD_MODEL;
-  Cmd->TagHead.TagSize        = sizeof (Cmd->TagBody);
-  Cmd->TagHead.TagValueSize   = 0;
-  Cmd->EndTag                 = 0;
-
-  Status = MailboxTransaction (Cmd->BufferHead.BufferSize, RPI_MBOX_VC_CHANNEL, &Result);
-
-  ReleaseSpinLock (&mMailboxLock);
-
-  if (EFI_ERROR (Status) ||
-      Cmd->BufferHead.Response != RPI_MBOX_RESP_SUCCESS) {
-    DEBUG ((DEBUG_ERROR,
-      "%a: mailbox transaction error: Status == %r, Response == 0x%x\n",
-      __FUNCTION__, Status, Cmd->BufferHead.Response));
+  Status = RpiFirmwareGetBoardInfo ();
+  if (EFI_ERROR (Status) || !RPI_FW_TAG_ANSWERED (mBoardInfo.ModelTag)) {
     return EFI_DEVICE_ERROR;
   }
 
-  *Model = Cmd->TagBody.Model;
+  *Model = mBoardInfo.Model.Model;
   return EFI_SUCCESS;
 }
 
-#pragma pack()
-typedef struct {
-  UINT32                    Revision;
-} RPI_FW_MODEL_REVISION_TAG;
-
-typedef struct {
-  RPI_FW_BUFFER_HEAD        BufferHead;
-  RPI_FW_TAG_HEAD           TagHead;
-  RPI_FW_MODEL_REVISION_TAG TagBody;
-  UINT32                    EndTag;
-} RPI_FW_GET_REVISION_CMD;
-#pragma pack()
-
 STATIC
 EFI_STATUS
 EFIAPI
@@ -475,38 +438,14 @@ RpiFirmwareGetModelRevision (
   OUT   UINT32 *Revision
   )
 {
-  RPI_FW_GET_REVISION_CMD       *Cmd;
   EFI_STATUS                    Status;
-  UINT32                        Result;
-
-  if (!AcquireSpinLockOrFail (&mMailboxLock)) {
-    DEBUG ((DEBUG_ERROR, "%a: failed to acquire spinlock\n", __FUNCTION__));
-    return EFI_DEVICE_ERROR;
-  }
-
-  Cmd = mDmaBuffer;
-  ZeroMem (Cmd, sizeof (*Cmd));
 
-  Cmd->BufferHead.BufferSize  = sizeof (*Cmd);
-  Cmd->BufferHead.Response    = 0;
-  Cmd->TagHead.TagId          = RPI_MBOX_GET_BOARD_REVISION;
-  Cmd->TagHead.TagSize        = sizeof (Cmd->TagBody);
-  Cmd->TagHead.TagValueSize   = 0;
-  Cmd->EndTag                 = 0;
-
-  Status = MailboxTransaction (Cmd->BufferHead.BufferSize, RPI_MBOX_VC_CHANNEL, &Result);
-
-  ReleaseSpinLock (&mMailboxLock);
-
-  if (EFI_ERROR (Status) ||
-      Cmd->BufferHead.Response != RPI_MBOX_RESP_SUCCESS) {
-    DEBUG ((DEBUG_ERROR,
-      "%a: mailbox transaction error: Status == %r, Response == 0x%x\n",
-      __FUNCTION__, Status, Cmd->BufferHead.Response));
+  Status = RpiFirmwareGetBoardInfo ();
+  if (EFI_ERROR (Status) || !RPI_FW_TAG_ANSWERED (mBoardInfo.ModelRevisionTag)) {
     return EFI_DEVICE_ERROR;
   }
 
-  *Revision = Cmd->TagBody.Revision;
+  *Revision = mBoardInfo.ModelRevision.Revision;
   return EFI_SUCCESS;
 }
 
@@ -517,38 +456,15 @@ RpiFirmwareGetFirmwareRevision (
   OUT   UINT32 *Revision
   )
 {
-  RPI_FW_GET_REVISION_CMD       *Cmd;
   EFI_STATUS                    Status;
-  UINT32                        Result;
-
-  if (!AcquireSpinLockOrFail (&mMailboxLock)) {
-    DEBUG ((DEBUG_ERROR, "%a: failed to acquire spinlock\n", __FUNCTION__));
-    return EFI_DEVICE_ERROR;
-  }
-
-  Cmd = mDmaBuffer;
-  ZeroMem (Cmd, sizeof (*Cmd));
-
-  Cmd->BufferHead.BufferSize  = sizeof (*Cmd);
-  Cmd->BufferHead.Response    = 0;
-  Cmd->TagHead.TagId          = RPI_MBOX_GET_REVISION;
-  Cmd->TagHead.TagSize        = sizeof (Cmd->TagBody);
-  Cmd->TagHead.TagValueSize   = 0;
-  Cmd->EndTag                 = 0;
-
-  Status = MailboxTransaction (Cmd->BufferHead.BufferSize, RPI_MBOX_VC_CHANNEL, &Result);
-
-  ReleaseSpinLock (&mMailboxLock);
 
+  Status = RpiFirmwareGetBoardInfo ();
   if (EFI_ERROR (Status) ||
-      Cmd->BufferHead.Response != RPI_MBOX_RESP_SUCCESS) {
-    DEBUG ((DEBUG_ERROR,
-      "%a: mailbox transaction error: Status == %r, Response == 0x%x\n",
-      __FUNCTION__, Status, Cmd->BufferHead.Response));
+      !RPI_FW_TAG_ANSWERED (mBoardInfo.FirmwareRevisionTag)) {
     return EFI_DEVICE_ERROR;
   }
 
-  *Revision = Cmd->TagBody.Revision;
+  *Revision = mBoardInfo.FirmwareRevision.Revision;
   return EFI_SUCCESS;
 }
 
@@ -1143,6 +1059,15 @@ RpiFirmwareGetClockRate (
   return EFI_SUCCESS;
 }
 
+//
+// The clock limits are fixed by the firmware configuration, remember them
+// once read. A rate of 0 means not read yet.
+//
+#define RPI_FW_CACHED_CLOCK_MAX     RPI_MBOX_CLOCK_RATE_PWM
+
+STATIC UINT32 mMaxClockRate[RPI_FW_CACHED_CLOCK_MAX + 1];
+STATIC UINT32 mMinClockRate[RPI_FW_CACHED_CLOCK_MAX + 1];
+
 STATIC
 EFI_STATUS
 EFIAPI
@@ -1162,7 +1087,18 @@ RpiFirmwareGetMaxClockRate (
   OUT UINT32    *ClockRate
   )
 {
-  return RpiFirmwareGetClockRate (ClockId, RPI_MBOX_GET_MAX_CLOCK_RATE, ClockRate);
+  EFI_STATUS    Status;
+
+  if (ClockId <= RPI_FW_CACHED_CLOCK_MAX && mMaxClockRate[ClockId] != 0) {
+    *ClockRate = mMaxClockRate[ClockId];
+    return EFI_SUCCESS;
+  }
+
+  Status = RpiFirmwareGetClockRate (ClockId, RPI_MBOX_GET_MAX_CLOCK_RATE, ClockRate);
+  if (!EFI_ERROR (Status) && ClockId <= RPI_FW_CACHED_CLOCK_MAX) {
+    mMaxClockRate[ClockId] = *ClockRate;
+  }
+  return Status;
 }
 
 STATIC
@@ -1173,7 +1109,18 @@ RpiFirmwareGetMinClockRate (
   OUT UINT32    *ClockRate
   )
 {
-  return RpiFirmwareGetClockRate (ClockId, RPI_MBOX_GET_MIN_CLOCK_RATE, ClockRate);
+  EFI_STATUS    Status;
+
+  if (ClockId <= RPI_FW_CACHED_CLOCK_MAX && mMinClockRate[ClockId] != 0) {
+    *ClockRate = mMinClockRate[ClockId];
+    return EFI_SUCCESS;
+  }
+
+  Status = RpiFirmwareGetClockRate (ClockId, RPI_MBOX_GET_MIN_CLOCK_RATE, ClockRate);
+  if (!EFI_ERROR (Status) && ClockId <= RPI_FW_CACHED_CLOCK_MAX) {
+    mMinClockRate[ClockId] = *ClockRate;
+  }
+  return Status;
 }
 
 #pragma pack()
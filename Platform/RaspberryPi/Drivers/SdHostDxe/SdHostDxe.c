@@ -8,6 +8,7 @@
  **/
 
 #include <Uefi.h>
+#include <Library/ArmLib.h>
 #include <Library/BaseLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/DebugLib.h>
@@ -42,6 +43,20 @@
 
 #define IDENT_MODE_SD_CLOCK_FREQ_HZ         400000 // 400KHz
 
+// System DMA parameters, as used by the Linux bcm2835-sdhost driver
+#define DMA_CHANNEL_DISABLED                0xFF
+#define DMA_CHANNEL_COUNT                   15     // DMA15 isn't contiguous with DMA0-14
+#define DMA_MAX_BLOCK_COUNT                 0xFFFF // Largest MmcDxe transfer
+#define DMA_CONTROL_BLOCK_COUNT             \
+  ((DMA_MAX_BLOCK_COUNT * SDHOST_BLOCK_BYTE_LENGTH + BCM2836_DMA_MAX_CB_LENGTH - 1) / BCM2836_DMA_MAX_CB_LENGTH)
+#define DMA_CONTROL_BLOCK_PAGES             \
+  EFI_SIZE_TO_PAGES (DMA_CONTROL_BLOCK_COUNT * sizeof (DMA_CONTROL_BLOCK))
+#define DMA_POLL_COUNT_PER_BLOCK            1000
+#define FIFO_READ_THRESHOLD                 4
+#define FIFO_WRITE_THRESHOLD                4
+// The FIFO doesn't raise DREQ for the last few words of a read, PIO them.
+#define DMA_READ_DRAIN_WORDS                (FIFO_READ_THRESHOLD - 1)
+
 // Macros adopted from MmcDxe internal header
 #define SDHOST_R0_READY_FOR_DATA            BIT8
 #define SDHOST_R0_CURRENTSTATE(Response)    ((Response >> 9) & 0xF)
@@ -50,8 +65,24 @@
 #define DEBUG_MMCHOST_SD_INFO  DEBUG_INFO
 #define DEBUG_MMCHOST_SD_ERROR DEBUG_ERROR
 
+// BCM283x DMA control block, must be 32-byte aligned
+typedef struct {
+  UINT32 TransferInfo;
+  UINT32 SourceAddress;
+  UINT32 DestinationAddress;
+  UINT32 TransferLength;
+  UINT32 Stride;
+  UINT32 NextControlBlock;
+  UINT32 Reserved[2];
+} DMA_CONTROL_BLOCK;
+
 STATIC RASPBERRY_PI_FIRMWARE_PROTOCOL   *mFwProtocol;
 
+STATIC UINT32                mDmaChannel = DMA_CHANNEL_DISABLED;
+STATIC DMA_CONTROL_BLOCK     *mDmaControlBlocks;
+STATIC EFI_PHYSICAL_ADDRESS  mDmaControlBlocksBusAddress;
+STATIC VOID                  *mDmaControlBlocksMapping;
+
 // Per Physical Layer Simplified Specs
 #ifndef NDEBUG
 STATIC CONST CHAR8* mStrSdState[] = { "idle", "ready", "ident", "stby",
@@ -495,6 +526,206 @@ SdReceiveResponse (
   return EFI_SUCCESS;
 }
 
+STATIC EFI_STATUS
+SdHostPioReadWords (
+  IN  UINT32   NumWords,
+  OUT UINT32   *Buffer
+  )
+{
+  UINT32 WordIdx;
+
+  for (WordIdx = 0; WordIdx < NumWords; ++WordIdx) {
+    UINT32 PollCount = 0;
+    while (PollCount < FIFO_MAX_POLL_COUNT) {
+      UINT32 Hsts = MmioRead32 (SDHOST_HSTS);
+      if ((Hsts & SDHOST_HSTS_DATA_FLAG) != 0) {
+        MmioWrite32 (SDHOST_HSTS, SDHOST_HSTS_DATA_FLAG);
+        Buffer[WordIdx] = MmioRead32 (SDHOST_DATA);
+        break;
+      }
+
+      ++PollCount;
+      gBS->Stall (CMD_STALL_AFTER_RETRY_US);
+    }
+
+    if (PollCount == FIFO_MAX_POLL_COUNT) {
+      DEBUG ((DEBUG_MMCHOST_SD_ERROR,
+          "SdHost: SdReadBlockData(): Block Word%d read poll timed-out\n", WordIdx));
+      SdHostDumpStatus ();
+      MmioWrite32 (SDHOST_HSTS, SDHOST_HSTS_CLEAR);
+      return EFI_TIMEOUT;
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
+STATIC EFI_STATUS
+SdHostPioWriteWords (
+  IN  UINT32   NumWords,
+  IN  UINT32   *Buffer
+  )
+{
+  UINT32 WordIdx;
+
+  for (WordIdx = 0; WordIdx < NumWords; ++WordIdx) {
+    UINT32 PollCount = 0;
+    while (PollCount < FIFO_MAX_POLL_COUNT) {
+      if (MmioRead32 (SDHOST_HSTS) & SDHOST_HSTS_DATA_FLAG) {
+        MmioWrite32 (SDHOST_HSTS, SDHOST_HSTS_DATA_FLAG);
+        MmioWrite32 (SDHOST_DATA, Buffer[WordIdx]);
+        break;
+      }
+
+      ++PollCount;
+      gBS->Stall (CMD_STALL_AFTER_RETRY_US);
+    }
+
+    if (PollCount == FIFO_MAX_POLL_COUNT) {
+      DEBUG ((DEBUG_MMCHOST_SD_ERROR,
+        "SdHost: SdWriteBlockData(): Block Word%d write poll timed-out\n", WordIdx));
+      SdHostDumpStatus ();
+      MmioWrite32 (SDHOST_HSTS, SDHOST_HSTS_CLEAR);
+      return EFI_TIMEOUT;
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Move whole blocks between Buffer and the SDHOST FIFO with the system
+  DMA controller, as a chain of at most 64KB control blocks paced by the
+  SDHOST DREQ.
+
+  Returns EFI_UNSUPPORTED without touching the hardware if DMA is disabled
+  or the buffer can't be mapped, so the caller can fall back to PIO.
+**/
+STATIC EFI_STATUS
+SdHostDmaTransfer (
+  IN     BOOLEAN  IsRead,
+  IN     UINTN    Length,
+  IN OUT UINT32   *Buffer
+  )
+{
+  EFI_STATUS           Status;
+  EFI_PHYSICAL_ADDRESS BusAddress;
+  VOID                 *Mapping;
+  UINTN                MappedLength;
+  UINTN                DmaLength;
+  UINTN                Offset;
+  UINTN                Chunk;
+  UINTN                Index;
+  UINTN                Channel;
+  UINTN                PollCount;
+  UINTN                MaxPollCount;
+  UINT32               TransferInfo;
+  UINT32               Cs;
+
+  if (mDmaChannel == DMA_CHANNEL_DISABLED ||
+      Length == 0 ||
+      (Length % SDHOST_BLOCK_BYTE_LENGTH) != 0 ||
+      (Length / SDHOST_BLOCK_BYTE_LENGTH) > DMA_MAX_BLOCK_COUNT) {
+    return EFI_UNSUPPORTED;
+  }
+
+  //
+  // The whole buffer is mapped, so that the drained words of a read
+  // can't be clobbered when the mapping is torn down.
+  //
+  MappedLength = Length;
+  Status = DmaMap (IsRead ? MapOperationBusMasterWrite : MapOperationBusMasterRead,
+             Buffer, &MappedLength, &BusAddress, &Mapping);
+  if (EFI_ERROR (Status)) {
+    return EFI_UNSUPPORTED;
+  }
+  if (MappedLength != Length) {
+    DmaUnmap (Mapping);
+    return EFI_UNSUPPORTED;
+  }
+
+  DmaLength = Length;
+  if (IsRead) {
+    DmaLength -= DMA_READ_DRAIN_WORDS * sizeof (UINT32);
+    TransferInfo = BCM2836_DMA_TI_SRC_DREQ | BCM2836_DMA_TI_DEST_INC;
+  } else {
+    TransferInfo = BCM2836_DMA_TI_DEST_DREQ | BCM2836_DMA_TI_SRC_INC;
+  }
+  TransferInfo |= BCM2836_DMA_TI_PERMAP (BCM2836_DMA_DREQ_SDHOST) |
+                  BCM2836_DMA_TI_WAIT_RESP;
+
+  for (Offset = 0, Index = 0; Offset < DmaLength; Offset += Chunk, Index++) {
+    Chunk = MIN (DmaLength - Offset, BCM2836_DMA_MAX_CB_LENGTH);
+
+    mDmaControlBlocks[Index].TransferInfo = TransferInfo;
+    if (IsRead) {
+      mDmaControlBlocks[Index].SourceAddress = SDHOST_DATA_BUS_ADDRESS;
+      mDmaControlBlocks[Index].DestinationAddress = (UINT32)(BusAddress + Offset);
+    } else {
+      mDmaControlBlocks[Index].SourceAddress = (UINT32)(BusAddress + Offset);
+      mDmaControlBlocks[Index].DestinationAddress = SDHOST_DATA_BUS_ADDRESS;
+    }
+    mDmaControlBlocks[Index].TransferLength = (UINT32)Chunk;
+    mDmaControlBlocks[Index].Stride = 0;
+    mDmaControlBlocks[Index].NextControlBlock = 0;
+    if (Index > 0) {
+      mDmaControlBlocks[Index - 1].NextControlBlock =
+        (UINT32)(mDmaControlBlocksBusAddress + Index * sizeof (DMA_CONTROL_BLOCK));
+    }
+  }
+
+  ArmDataSynchronizationBarrier ();
+
+  Channel = BCM2836_DMA_CHANNEL_BASE_ADDRESS (mDmaChannel);
+  MmioWrite32 (Channel + BCM2836_DMA_CS_OFFSET, BCM2836_DMA_CS_END | BCM2836_DMA_CS_INT);
+  MmioWrite32 (Channel + BCM2836_DMA_CONBLK_AD_OFFSET, (UINT32)mDmaControlBlocksBusAddress);
+  MmioWrite32 (Channel + BCM2836_DMA_CS_OFFSET, BCM2836_DMA_CS_ACTIVE |
+    BCM2836_DMA_CS_WAIT_FOR_OUTSTANDING_WRITES |
+    BCM2836_DMA_CS_PRIORITY (8) | BCM2836_DMA_CS_PANIC_PRIORITY (15));
+
+  Status = EFI_TIMEOUT;
+  MaxPollCount = FIFO_MAX_POLL_COUNT +
+                 (Length / SDHOST_BLOCK_BYTE_LENGTH) * DMA_POLL_COUNT_PER_BLOCK;
+  for (PollCount = 0; PollCount < MaxPollCount; PollCount++) {
+    Cs = MmioRead32 (Channel + BCM2836_DMA_CS_OFFSET);
+    if ((Cs & BCM2836_DMA_CS_ERROR) != 0 ||
+        (MmioRead32 (SDHOST_HSTS) & SDHOST_HSTS_ERROR) != 0) {
+      Status = EFI_DEVICE_ERROR;
+      break;
+    }
+
+    if ((Cs & BCM2836_DMA_CS_ACTIVE) == 0) {
+      Status = EFI_SUCCESS;
+      break;
+    }
+
+    gBS->Stall (CMD_STALL_AFTER_POLL_US);
+  }
+
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_MMCHOST_SD_ERROR,
+      "SdHost: SdHostDmaTransfer(): %a of 0x%x bytes failed: %r, DMA CS 0x%8.8X DEBUG 0x%8.8X\n",
+      IsRead ? "read" : "write", Length, Status,
+      MmioRead32 (Channel + BCM2836_DMA_CS_OFFSET),
+      MmioRead32 (Channel + BCM2836_DMA_DEBUG_OFFSET)));
+    SdHostDumpStatus ();
+    MmioWrite32 (Channel + BCM2836_DMA_CS_OFFSET, BCM2836_DMA_CS_RESET);
+    MmioWrite32 (Channel + BCM2836_DMA_DEBUG_OFFSET, BCM2836_DMA_DEBUG_ERRORS);
+    MmioWrite32 (SDHOST_HSTS, SDHOST_HSTS_CLEAR);
+  } else {
+    MmioWrite32 (Channel + BCM2836_DMA_CS_OFFSET, BCM2836_DMA_CS_END);
+  }
+
+  DmaUnmap (Mapping);
+
+  if (!EFI_ERROR (Status) && IsRead) {
+    Status = SdHostPioReadWords (DMA_READ_DRAIN_WORDS,
+               Buffer + DmaLength / sizeof (UINT32));
+  }
+
+  return Status;
+}
+
 STATIC EFI_STATUS
 SdReadBlockData (
   IN EFI_MMC_HOST_PROTOCOL    *This,
@@ -509,36 +740,12 @@ SdReadBlockData (
   ASSERT (Buffer != NULL);
   ASSERT (Length % 4 == 0);
 
-  EFI_STATUS Status = EFI_SUCCESS;
+  EFI_STATUS Status;
 
   mFwProtocol->SetLed (TRUE);
-  {
-    UINT32 NumWords = Length / 4;
-    UINT32 WordIdx;
-
-    for (WordIdx = 0; WordIdx < NumWords; ++WordIdx) {
-      UINT32 PollCount = 0;
-      while (PollCount < FIFO_MAX_POLL_COUNT) {
-        UINT32 Hsts = MmioRead32 (SDHOST_HSTS);
-        if ((Hsts & SDHOST_HSTS_DATA_FLAG) != 0) {
-          MmioWrite32 (SDHOST_HSTS, SDHOST_HSTS_DATA_FLAG);
-          Buffer[WordIdx] = MmioRead32 (SDHOST_DATA);
-          break;
-        }
-
-        ++PollCount;
-        gBS->Stall (CMD_STALL_AFTER_RETRY_US);
-      }
-
-      if (PollCount == FIFO_MAX_POLL_COUNT) {
-        DEBUG ((DEBUG_MMCHOST_SD_ERROR,
-            "SdHost: SdReadBlockData(): Block Word%d read poll timed-out\n", WordIdx));
-        SdHostDumpStatus ();
-        MmioWrite32 (SDHOST_HSTS, SDHOST_HSTS_CLEAR);
-        Status = EFI_TIMEOUT;
-        break;
-      }
-    }
+  Status = SdHostDmaTransfer (TRUE, Length, Buffer);
+  if (Status == EFI_UNSUPPORTED) {
+    Status = SdHostPioReadWords (Length / 4, Buffer);
   }
   mFwProtocol->SetLed (FALSE);
 
@@ -560,35 +767,12 @@ SdWriteBlockData (
   ASSERT (Buffer != NULL);
   ASSERT (Length % SDHOST_BLOCK_BYTE_LENGTH == 0);
 
-  EFI_STATUS Status = EFI_SUCCESS;
+  EFI_STATUS Status;
 
   mFwProtocol->SetLed (TRUE);
-  {
-    UINT32 NumWords = Length / 4;
-    UINT32 WordIdx;
-
-    for (WordIdx = 0; WordIdx < NumWords; ++WordIdx) {
-      UINT32 PollCount = 0;
-      while (PollCount < FIFO_MAX_POLL_COUNT) {
-        if (MmioRead32 (SDHOST_HSTS) & SDHOST_HSTS_DATA_FLAG) {
-          MmioWrite32 (SDHOST_HSTS, SDHOST_HSTS_DATA_FLAG);
-          MmioWrite32 (SDHOST_DATA, Buffer[WordIdx]);
-          break;
-        }
-
-        ++PollCount;
-        gBS->Stall (CMD_STALL_AFTER_RETRY_US);
-      }
-
-      if (PollCount == FIFO_MAX_POLL_COUNT) {
-        DEBUG ((DEBUG_MMCHOST_SD_ERROR,
-          "SdHost: SdWriteBlockData(): Block Word%d write poll timed-out\n", WordIdx));
-        SdHostDumpStatus ();
-        MmioWrite32 (SDHOST_HSTS, SDHOST_HSTS_CLEAR);
-        Status = EFI_TIMEOUT;
-        break;
-      }
-    }
+  Status = SdHostDmaTransfer (FALSE, Length, Buffer);
+  if (Status == EFI_UNSUPPORTED) {
+    Status = SdHostPioWriteWords (Length / 4, Buffer);
   }
   mFwProtocol->SetLed (FALSE);
 
@@ -672,6 +856,15 @@ SdNotifyState (
     Hcfg |= SDHOST_HCFG_SLOW_CARD; // Use all bits of CDIV in DataMode
     MmioWrite32 (SDHOST_HCFG, Hcfg);
 
+    if (mDmaChannel != DMA_CHANNEL_DISABLED) {
+      // FIFO levels at which DREQ gets raised
+      MmioAndThenOr32 (SDHOST_EDM,
+        (UINT32) ~(SDHOST_EDM_READ_THRESHOLD (SDHOST_EDM_THRESHOLD_MASK) |
+                   SDHOST_EDM_WRITE_THRESHOLD (SDHOST_EDM_THRESHOLD_MASK)),
+        SDHOST_EDM_READ_THRESHOLD (FIFO_READ_THRESHOLD) |
+        SDHOST_EDM_WRITE_THRESHOLD (FIFO_WRITE_THRESHOLD));
+    }
+
     // Set default clock frequency
     EFI_STATUS Status = SdHostSetClockFrequency (IDENT_MODE_SD_CLOCK_FREQ_HZ);
     if (EFI_ERROR (Status)) {
@@ -802,6 +995,52 @@ EFI_MMC_HOST_PROTOCOL gMmcHost =
     SdIsMultiBlock
   };
 
+STATIC VOID
+SdHostInitializeDma (
+  VOID
+  )
+{
+  EFI_STATUS Status;
+  UINTN      BufferSize;
+  UINT32     Channel;
+
+  Channel = PcdGet32 (PcdSdHostDmaChannel);
+  if (Channel == DMA_CHANNEL_DISABLED) {
+    return;
+  }
+
+  if (Channel >= DMA_CHANNEL_COUNT) {
+    DEBUG ((DEBUG_ERROR, "SdHost: invalid DMA channel %u, using PIO\n", Channel));
+    return;
+  }
+
+  Status = DmaAllocateBuffer (EfiBootServicesData, DMA_CONTROL_BLOCK_PAGES,
+             (VOID**)&mDmaControlBlocks);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a: failed to allocate DMA control blocks (Status == %r)\n",
+      __FUNCTION__, Status));
+    return;
+  }
+
+  BufferSize = EFI_PAGES_TO_SIZE (DMA_CONTROL_BLOCK_PAGES);
+  Status = DmaMap (MapOperationBusMasterCommonBuffer, mDmaControlBlocks,
+             &BufferSize, &mDmaControlBlocksBusAddress, &mDmaControlBlocksMapping);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a: failed to map DMA control blocks (Status == %r)\n",
+      __FUNCTION__, Status));
+    DmaFreeBuffer (DMA_CONTROL_BLOCK_PAGES, mDmaControlBlocks);
+    mDmaControlBlocks = NULL;
+    return;
+  }
+
+  MmioOr32 (BCM2836_DMA_CTRL_BASE_ADDRESS + BCM2836_DMA_ENABLE_OFFSET, 1U << Channel);
+  MmioWrite32 (BCM2836_DMA_CHANNEL_BASE_ADDRESS (Channel) + BCM2836_DMA_CS_OFFSET,
+    BCM2836_DMA_CS_RESET);
+
+  mDmaChannel = Channel;
+  DEBUG ((DEBUG_MMCHOST_SD_INFO, "SdHost: using DMA channel %u\n", mDmaChannel));
+}
+
 EFI_STATUS
 SdHostInitialize (
   IN EFI_HANDLE          ImageHandle,
@@ -822,6 +1061,8 @@ SdHostInitialize (
     return Status;
   }
 
+  SdHostInitializeDma ();
+
   DEBUG ((DEBUG_MMCHOST_SD, "SdHost: Initialize\n"));
   DEBUG ((DEBUG_MMCHOST_SD, "Config:\n"));
   DEBUG ((DEBUG_MMCHOST_SD, " - FIFO_MAX_POLL_COUNT=%d\n", FIFO_MAX_POLL_COUNT));
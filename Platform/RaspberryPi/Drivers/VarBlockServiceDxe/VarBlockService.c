@@ -86,6 +86,38 @@ EFI_FW_VOL_BLOCK_DEVICE mFvbDeviceTemplate = {
 };
 
 
+STATIC
+VOID
+VarStoreMarkDirty (
+  IN UINTN Address,
+  IN UINTN Length
+  )
+{
+  UINTN Block;
+  UINTN LastBlock;
+
+  if (Length == 0) {
+    return;
+  }
+
+  Block = (Address - mFvInstance->FvBase) / mFvInstance->BlockSize;
+  LastBlock = (Address - mFvInstance->FvBase + Length - 1) /
+                mFvInstance->BlockSize;
+  for (; Block <= LastBlock; Block++) {
+    mFvInstance->DirtyBlocks[Block / 8] |= (UINT8)(1 << (Block % 8));
+  }
+  mFvInstance->Dirty = TRUE;
+
+  //
+  // (Re)arm the idle write-back, so a burst of updates costs one write.
+  //
+  if (!EfiAtRuntime () && mFvInstance->FlushEvent != NULL) {
+    gBS->SetTimer (mFvInstance->FlushEvent, TimerRelative,
+      VAR_STORE_FLUSH_IDLE_TIMEOUT);
+  }
+}
+
+
 EFI_STATUS
 VarStoreWrite (
   IN     UINTN Address,
@@ -94,7 +126,7 @@ VarStoreWrite (
   )
 {
   CopyMem ((VOID*)Address, Buffer, *NumBytes);
-  mFvInstance->Dirty = TRUE;
+  VarStoreMarkDirty (Address, *NumBytes);
 
   return EFI_SUCCESS;
 }
@@ -107,7 +139,7 @@ VarStoreErase (
   )
 {
   SetMem ((VOID*)Address, LbaLength, 0xff);
-  mFvInstance->Dirty = TRUE;
+  VarStoreMarkDirty (Address, LbaLength);
 
   return EFI_SUCCESS;
 }
@@ -843,6 +875,12 @@ FvbInitialize (
   mFvInstance->FvBase = (UINTN)BaseAddress;
   mFvInstance->FvLength = (UINTN)Length;
   mFvInstance->Offset = StartOffset;
+  mFvInstance->BlockSize = FixedPcdGet32 (PcdFirmwareBlockSize);
+  mFvInstance->DirtyBlocks = AllocateRuntimeZeroPool (
+                               (Length / mFvInstance->BlockSize + 7) / 8);
+  if (mFvInstance->DirtyBlocks == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
   /*
    * Should I parse config.txt instead and find the real name?
    */
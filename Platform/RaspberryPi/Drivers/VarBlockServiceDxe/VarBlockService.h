@@ -33,8 +33,19 @@ typedef struct {
   EFI_DEVICE_PATH_PROTOCOL   *Device;
   CHAR16                     *MappedFile;
   BOOLEAN                    Dirty;
+  UINTN                      BlockSize;
+  UINT8                      *DirtyBlocks;  // one bit per block
+  EFI_EVENT                  FlushEvent;
 } EFI_FW_VOL_INSTANCE;
 
+//
+// Write back this long after the last change, in 100ns units.
+//
+#define VAR_STORE_FLUSH_IDLE_TIMEOUT  (2 * 10 * 1000 * 1000)
+
+#define VAR_STORE_BLOCK_DIRTY(Instance, Block) \
+          (((Instance)->DirtyBlocks[(Block) / 8] & (1 << ((Block) % 8))) != 0)
+
 extern EFI_FW_VOL_INSTANCE *mFvInstance;
 
 typedef struct {
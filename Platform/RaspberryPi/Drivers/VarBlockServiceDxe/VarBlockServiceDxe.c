@@ -94,6 +94,7 @@ FvbVirtualAddressChangeEvent (
 {
   EfiConvertPointer (0x0, (VOID**)&mFvInstance->FvBase);
   EfiConvertPointer (0x0, (VOID**)&mFvInstance->VolumeHeader);
+  EfiConvertPointer (0x0, (VOID**)&mFvInstance->DirtyBlocks);
   EfiConvertPointer (0x0, (VOID**)&mFvInstance);
 }
 
@@ -121,11 +122,15 @@ InstallVirtualAddressChangeHandler (
 STATIC
 EFI_STATUS
 DoDump (
-  IN EFI_DEVICE_PATH_PROTOCOL *Device
+  IN EFI_DEVICE_PATH_PROTOCOL *Device,
+  IN BOOLEAN                  Full
   )
 {
   EFI_STATUS Status;
   EFI_FILE_PROTOCOL *File;
+  UINTN NumBlocks;
+  UINTN Block;
+  UINTN Run;
 
   Status = FileOpen (Device,
              mFvInstance->MappedFile,
@@ -136,11 +141,41 @@ DoDump (
     return Status;
   }
 
-  Status = FileWrite (File,
-             mFvInstance->Offset,
-             mFvInstance->FvBase,
-             mFvInstance->FvLength);
+  if (Full) {
+    Status = FileWrite (File,
+               mFvInstance->Offset,
+               mFvInstance->FvBase,
+               mFvInstance->FvLength);
+  } else {
+    //
+    // Only write back the runs of modified blocks.
+    //
+    NumBlocks = mFvInstance->FvLength / mFvInstance->BlockSize;
+    for (Block = 0; Block < NumBlocks && !EFI_ERROR (Status); Block = Run) {
+      if (!VAR_STORE_BLOCK_DIRTY (mFvInstance, Block)) {
+        Run = Block + 1;
+        continue;
+      }
+
+      for (Run = Block; Run < NumBlocks; Run++) {
+        if (!VAR_STORE_BLOCK_DIRTY (mFvInstance, Run)) {
+          break;
+        }
+      }
+
+      Status = FileWrite (File,
+                 mFvInstance->Offset + Block * mFvInstance->BlockSize,
+                 mFvInstance->FvBase + Block * mFvInstance->BlockSize,
+                 (Run - Block) * mFvInstance->BlockSize);
+    }
+  }
+
   FileClose (File);
+
+  if (!EFI_ERROR (Status)) {
+    ZeroMem (mFvInstance->DirtyBlocks, (mFvInstance->FvLength /
+      mFvInstance->BlockSize + 7) / 8);
+  }
   return Status;
 }
 
@@ -165,7 +200,7 @@ DumpVars (
     return;
   }
 
-  Status = DoDump (mFvInstance->Device);
+  Status = DoDump (mFvInstance->Device, FALSE);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "Couldn't dump '%s'\n", mFvInstance->MappedFile));
     ASSERT_EFI_ERROR (Status);
@@ -218,6 +253,15 @@ InstallDumpVarEventHandlers (
   EFI_EVENT ResetEvent;
   EFI_EVENT ReadyToBootEvent;
 
+  Status = gBS->CreateEvent (
+                  EVT_TIMER | EVT_NOTIFY_SIGNAL,
+                  TPL_CALLBACK,
+                  DumpVars,
+                  NULL,
+                  &mFvInstance->FlushEvent
+                );
+  ASSERT_EFI_ERROR (Status);
+
   Status = gBS->CreateEventEx (
                   EVT_NOTIFY_SIGNAL,
                   TPL_CALLBACK,
@@ -281,7 +325,7 @@ OnSimpleFileSystemInstall (
       continue;
     }
 
-    Status = DoDump (Device);
+    Status = DoDump (Device, TRUE);
     if (EFI_ERROR (Status)) {
       DEBUG ((DEBUG_ERROR, "Couldn't update '%s'\n", mFvInstance->MappedFile));
       ASSERT_EFI_ERROR (Status);
@@ -53,7 +53,9 @@ typedef UINT32 MMC_CMD;
 #define MMC_CMD16             (MMC_INDX(16) | MMC_CMD_WAIT_RESPONSE)
 #define MMC_CMD17             (MMC_INDX(17) | MMC_CMD_WAIT_RESPONSE)
 #define MMC_CMD18             (MMC_INDX(18) | MMC_CMD_WAIT_RESPONSE)
+#define MMC_CMD19             (MMC_INDX(19) | MMC_CMD_WAIT_RESPONSE)
 #define MMC_CMD20             (MMC_INDX(20) | MMC_CMD_WAIT_RESPONSE)
+#define MMC_CMD21             (MMC_INDX(21) | MMC_CMD_WAIT_RESPONSE)
 #define MMC_CMD23             (MMC_INDX(23) | MMC_CMD_WAIT_RESPONSE)
 #define MMC_CMD24             (MMC_INDX(24) | MMC_CMD_WAIT_RESPONSE)
 #define MMC_CMD25             (MMC_INDX(25) | MMC_CMD_WAIT_RESPONSE)
@@ -97,6 +99,8 @@ typedef enum _CARD_DETECT_STATE {
 #define EMMCHS200SDR1V2      (1 << 5)      // HS200 Single Data Rate @200MHz 1.2V I/O
 #define EMMCHS400DDR1V8      (1 << 6)      // HS400 Dual Data Rate @400MHz 1.8V I/O
 #define EMMCHS400DDR1V2      (1 << 7)      // HS400 Dual Data Rate @400MHz 1.2V I/O
+#define SDUHSSDR50           (1 << 8)      // UHS-I SDR50 @100MHz 1.8V I/O
+#define SDUHSSDR104          (1 << 9)      // UHS-I SDR104 @208MHz 1.8V I/O
 
 ///
 /// Forward declaration for EFI_MMC_HOST_PROTOCOL
@@ -178,6 +182,50 @@ BOOLEAN
   IN  EFI_MMC_HOST_PROTOCOL     *This
   );
 
+/**
+  Return the timing modes (EMMC* / SDUHS* bits) the host can run, on top
+  of the backward compatible and high speed ones.
+**/
+typedef
+UINT32
+(EFIAPI *MMC_GETCAPABILITIES) (
+  IN  EFI_MMC_HOST_PROTOCOL     *This
+  );
+
+/**
+  Switch the I/O signalling to 1.8V, after the card accepted CMD11.
+**/
+typedef
+EFI_STATUS
+(EFIAPI *MMC_SWITCHVOLTAGE) (
+  IN  EFI_MMC_HOST_PROTOCOL     *This
+  );
+
+/**
+  Run the tuning procedure with TuningCmd (CMD19 for SD, CMD21 for eMMC)
+  at the current bus timing, and return an opaque value describing the
+  converged sampling point.
+**/
+typedef
+EFI_STATUS
+(EFIAPI *MMC_EXECUTETUNING) (
+  IN  EFI_MMC_HOST_PROTOCOL     *This,
+  IN  MMC_CMD                   TuningCmd,
+  OUT UINT32                    *TuningValue
+  );
+
+/**
+  Apply a TuningValue returned by an earlier ExecuteTuning and validate it
+  with a single TuningCmd. Fails if the card doesn't respond correctly.
+**/
+typedef
+EFI_STATUS
+(EFIAPI *MMC_SETTUNING) (
+  IN  EFI_MMC_HOST_PROTOCOL     *This,
+  IN  MMC_CMD                   TuningCmd,
+  IN  UINT32                    TuningValue
+  );
+
 struct _EFI_MMC_HOST_PROTOCOL {
   UINT32                  Revision;
   MMC_ISCARDPRESENT       IsCardPresent;
@@ -194,13 +242,26 @@ struct _EFI_MMC_HOST_PROTOCOL {
 
   MMC_SETIOS              SetIos;
   MMC_ISMULTIBLOCK        IsMultiBlock;
+
+  MMC_GETCAPABILITIES     GetCapabilities;
+  MMC_SWITCHVOLTAGE       SwitchVoltage;
+  MMC_EXECUTETUNING       ExecuteTuning;
+  MMC_SETTUNING           SetTuning;
 };
 
-#define MMC_HOST_PROTOCOL_REVISION    0x00010002    // 1.2
+#define MMC_HOST_PROTOCOL_REVISION    0x00010003    // 1.3
 
 #define MMC_HOST_HAS_SETIOS(Host)       (Host->Revision >= MMC_HOST_PROTOCOL_REVISION && \
                                          Host->SetIos != NULL)
 #define MMC_HOST_HAS_ISMULTIBLOCK(Host) (Host->Revision >= MMC_HOST_PROTOCOL_REVISION && \
                                          Host->IsMultiBlock != NULL)
+#define MMC_HOST_HAS_GETCAPABILITIES(Host) (Host->Revision >= MMC_HOST_PROTOCOL_REVISION && \
+                                         Host->GetCapabilities != NULL)
+#define MMC_HOST_HAS_SWITCHVOLTAGE(Host) (Host->Revision >= MMC_HOST_PROTOCOL_REVISION && \
+                                         Host->SwitchVoltage != NULL)
+#define MMC_HOST_HAS_EXECUTETUNING(Host) (Host->Revision >= MMC_HOST_PROTOCOL_REVISION && \
+                                         Host->ExecuteTuning != NULL)
+#define MMC_HOST_HAS_SETTUNING(Host)    (Host->Revision >= MMC_HOST_PROTOCOL_REVISION && \
+                                         Host->SetTuning != NULL)
 
 #endif /* __RASPBERRY_PI_MMC_HOST_PROTOCOL_H__ */
@@ -28,6 +28,12 @@ STATIC CONST MV_GPIO_PIN mXhciVbusPin = {
   TRUE,
 };
 
+//
+// The VBUS pin is shared by all XHCI controllers, so drive it only on the
+// first controller that gets connected.
+//
+STATIC BOOLEAN mXhciVbusEnabled;
+
 STATIC
 EFI_STATUS
 EFIAPI
@@ -38,6 +44,10 @@ XhciInit (
   EMBEDDED_GPIO  *GpioProtocol;
   EFI_STATUS      Status;
 
+  if (mXhciVbusEnabled) {
+    return EFI_SUCCESS;
+  }
+
   Status = MvGpioGetProtocol (MV_GPIO_DRIVER_TYPE_SOC_CONTROLLER, &GpioProtocol);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "%a: Unable to find GPIO protocol\n", __FUNCTION__));
@@ -48,6 +58,8 @@ XhciInit (
                   GPIO (mXhciVbusPin.ControllerId, mXhciVbusPin.PinNumber),
                   GPIO_MODE_OUTPUT_1);
 
+  mXhciVbusEnabled = TRUE;
+
   return Status;
 }
 
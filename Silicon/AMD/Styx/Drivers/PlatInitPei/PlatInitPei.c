@@ -158,15 +158,21 @@ PlatInitPeiEntryPoint (
   //
   for (CoreNum = 0, Index = 0; CoreNum < CpuMapSize && Index < mAmdCoreCount; ++CoreNum) {
     if (CpuMap & 1) {
-      CpuResetInfo.CoreNum = CoreNum;
-      Status = PeiIscpPpi->ExecuteCpuRetrieveIdTransaction (
-                 PeiServices, &CpuResetInfo );
-      ASSERT_EFI_ERROR (Status);
-      ASSERT (CpuResetInfo.CoreStatus.Status != CPU_CORE_DISABLED);
-      ASSERT (CpuResetInfo.CoreStatus.Status != CPU_CORE_UNDEFINED);
-
-      mAmdMpCoreInfoTable[Index].ClusterId = CpuResetInfo.CoreStatus.ClusterId;
-      mAmdMpCoreInfoTable[Index].CoreId = CpuResetInfo.CoreStatus.CoreId;
+      if (FeaturePcdGet (PcdIscpCoreIdFromCpuMap)) {
+        // Core numbers in the fused map are laid out cluster by cluster
+        mAmdMpCoreInfoTable[Index].ClusterId = CoreNum / FixedPcdGet32 (PcdSocCoresPerCluster);
+        mAmdMpCoreInfoTable[Index].CoreId = CoreNum % FixedPcdGet32 (PcdSocCoresPerCluster);
+      } else {
+        CpuResetInfo.CoreNum = CoreNum;
+        Status = PeiIscpPpi->ExecuteCpuRetrieveIdTransaction (
+                   PeiServices, &CpuResetInfo );
+        ASSERT_EFI_ERROR (Status);
+        ASSERT (CpuResetInfo.CoreStatus.Status != CPU_CORE_DISABLED);
+        ASSERT (CpuResetInfo.CoreStatus.Status != CPU_CORE_UNDEFINED);
+
+        mAmdMpCoreInfoTable[Index].ClusterId = CpuResetInfo.CoreStatus.ClusterId;
+        mAmdMpCoreInfoTable[Index].CoreId = CpuResetInfo.CoreStatus.CoreId;
+      }
 
       DEBUG ((EFI_D_ERROR, "Core[%d]: ClusterId = %d   CoreId = %d\n",
         Index, mAmdMpCoreInfoTable[Index].ClusterId,
@@ -13,20 +13,103 @@
 #include <Library/DebugLib.h>
 #include <Library/IoLib.h>
 #include <Library/NonDiscoverableDeviceRegistrationLib.h>
+#include <Library/TimerLib.h>
 
 #include <Protocol/NonDiscoverableDevice.h>
 
 #include <SocVersion.h>
 
+#define SATA_MAX_CONTROLLERS          2
+#define SATA_RESET_POLL_INTERVAL_US   10
+//
+// Refer AHCI 1.3 spec section 10.4.3, the HBA reset must complete within 1s
+//
+#define SATA_RESET_TIMEOUT_US         1000000
+
+typedef struct {
+  EFI_PHYSICAL_ADDRESS    AhciBaseAddr;
+  UINTN                   PortCount;
+  UINTN                   StartPort;
+} STYX_SATA_CONTROLLER;
+
 STATIC
 VOID
-ResetSataController (
+InitializeSataPhy (
+  UINTN                   SataPortCount,
+  UINTN                   StartPort
+  )
+{
+  UINT8                   SataChPerSerdes;
+  UINT32                  PortNum;
+  UINT32                  EvenPort;
+  UINT32                  OddPort;
+
+  SataChPerSerdes = FixedPcdGet8 (PcdSataNumChPerSerdes);
+
+  //
+  // SataChPerSerdes must be 2 for the Even/Odd logic in the loop below
+  //
+  ASSERT(SataChPerSerdes == 2);
+
+  for (PortNum = StartPort; PortNum < SataPortCount + StartPort; PortNum += SataChPerSerdes) {
+    EvenPort = (UINT32)(FixedPcdGet32 (PcdSataPortMode) >> (PortNum * 2)) & 3;
+    OddPort = (UINT32)(FixedPcdGet32 (PcdSataPortMode) >> ((PortNum+1) * 2)) & 3;
+    SataPhyInit (PortNum / SataChPerSerdes, EvenPort, OddPort);
+  }
+}
+
+STATIC
+VOID
+StartSataControllerReset (
   EFI_PHYSICAL_ADDRESS    AhciBaseAddr
   )
 {
   // Make a minimal global reset for HBA regiser
   MmioOr32 (AhciBaseAddr + EFI_AHCI_GHC_OFFSET, EFI_AHCI_GHC_RESET);
+}
+
+//
+// Wait once for the HBA reset of every controller that was kicked off by
+// StartSataControllerReset (), instead of settling each one in turn.
+//
+STATIC
+VOID
+WaitForSataControllerReset (
+  STYX_SATA_CONTROLLER    *Controllers,
+  UINTN                   ControllerCount
+  )
+{
+  UINTN                   Index;
+  UINT32                  Pending;
+  UINTN                   Timeout;
+
+  Timeout = SATA_RESET_TIMEOUT_US;
 
+  do {
+    Pending = 0;
+    for (Index = 0; Index < ControllerCount; Index++) {
+      if ((MmioRead32 (Controllers[Index].AhciBaseAddr + EFI_AHCI_GHC_OFFSET) &
+           EFI_AHCI_GHC_RESET) != 0) {
+        Pending++;
+      }
+    }
+    if (Pending == 0) {
+      return;
+    }
+    MicroSecondDelay (SATA_RESET_POLL_INTERVAL_US);
+    Timeout -= MIN (Timeout, SATA_RESET_POLL_INTERVAL_US);
+  } while (Timeout > 0);
+
+  DEBUG ((DEBUG_WARN, "%a: %d SATA controller(s) still in reset after timeout\n",
+    __FUNCTION__, Pending));
+}
+
+STATIC
+VOID
+EnableSataController (
+  EFI_PHYSICAL_ADDRESS    AhciBaseAddr
+  )
+{
   // Clear all interrupts
   MmioWrite32 (AhciBaseAddr + EFI_AHCI_PORT_IS, EFI_AHCI_PORT_IS_CLEAR);
 
@@ -90,36 +173,20 @@ InitializeSataPorts (
   }
 }
 
+//
+// Called once the HBA reset of the controller has completed
+//
 STATIC
 EFI_STATUS
 InitializeSataController (
   EFI_PHYSICAL_ADDRESS    AhciBaseAddr,
-  UINTN                   SataPortCount,
-  UINTN                   StartPort
+  UINTN                   SataPortCount
   )
 {
-  UINT8                   SataChPerSerdes;
-  UINT32                  PortNum;
-  UINT32                  EvenPort;
-  UINT32                  OddPort;
-
-  SataChPerSerdes = FixedPcdGet8 (PcdSataNumChPerSerdes);
-
-  //
-  // SataChPerSerdes must be 2 for the Even/Odd logic in the loop below
   //
-  ASSERT(SataChPerSerdes == 2);
-
-  for (PortNum = StartPort; PortNum < SataPortCount + StartPort; PortNum += SataChPerSerdes) {
-    EvenPort = (UINT32)(FixedPcdGet32 (PcdSataPortMode) >> (PortNum * 2)) & 3;
-    OddPort = (UINT32)(FixedPcdGet32 (PcdSataPortMode) >> ((PortNum+1) * 2)) & 3;
-    SataPhyInit (PortNum / SataChPerSerdes, EvenPort, OddPort);
-  }
-
-  //
-  // Reset SATA controller
+  // Bring the SATA controller out of reset
   //
-  ResetSataController (AhciBaseAddr);
+  EnableSataController (AhciBaseAddr);
 
   //
   // Set SATA capabilities
@@ -147,18 +214,55 @@ StyxSataPlatformDxeEntryPoint (
   IN EFI_SYSTEM_TABLE   *SystemTable
   )
 {
+  STYX_SATA_CONTROLLER    Controllers[SATA_MAX_CONTROLLERS];
+  UINTN                   ControllerCount;
+  UINTN                   Index;
   UINT32                  PortNum;
   EFI_STATUS              Status;
 
+  Controllers[0].AhciBaseAddr = FixedPcdGet32(PcdSata0CtrlAxiSlvPort);
+  Controllers[0].PortCount = FixedPcdGet8(PcdSata0PortCount);
+  Controllers[0].StartPort = 0;
+  ControllerCount = 1;
+
+  //
+  // Ignore the second SATA controller on pre-B1 silicon
+  //
+  if ((PcdGet32 (PcdSocCpuId) & STYX_SOC_VERSION_MASK) >= STYX_SOC_VERSION_B1 &&
+      FixedPcdGet8(PcdSata1PortCount) > 0) {
+    Controllers[1].AhciBaseAddr = FixedPcdGet32(PcdSata1CtrlAxiSlvPort);
+    Controllers[1].PortCount = FixedPcdGet8(PcdSata1PortCount);
+    Controllers[1].StartPort = FixedPcdGet8(PcdSata0PortCount);
+    ControllerCount = 2;
+  }
+
   //
   // Perform SATA workarounds
   //
   for (PortNum = 0; PortNum < FixedPcdGet8(PcdSata0PortCount); PortNum++) {
       SetCwMinSata0 (PortNum);
   }
+  if (ControllerCount > 1) {
+    for (PortNum = 0; PortNum < FixedPcdGet8(PcdSata1PortCount); PortNum++) {
+        SetCwMinSata1 (PortNum);
+    }
+  }
+
+  //
+  // Kick off the PHYs and the HBA reset of both controllers first, so that
+  // the SerDes, the resets and the links of all ports settle together rather
+  // than one controller after the other.
+  //
+  for (Index = 0; Index < ControllerCount; Index++) {
+    InitializeSataPhy (Controllers[Index].PortCount, Controllers[Index].StartPort);
+  }
+  for (Index = 0; Index < ControllerCount; Index++) {
+    StartSataControllerReset (Controllers[Index].AhciBaseAddr);
+  }
+  WaitForSataControllerReset (Controllers, ControllerCount);
 
-  Status = InitializeSataController (FixedPcdGet32(PcdSata0CtrlAxiSlvPort),
-             FixedPcdGet8(PcdSata0PortCount), 0);
+  Status = InitializeSataController (Controllers[0].AhciBaseAddr,
+             Controllers[0].PortCount);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_WARN, "%a: failed to initialize primary SATA controller!\n",
       __FUNCTION__));
@@ -169,21 +273,9 @@ StyxSataPlatformDxeEntryPoint (
       SetPrdSingleSata0 (PortNum);
   }
 
-  //
-  // Ignore the second SATA controller on pre-B1 silicon
-  //
-  if ((PcdGet32 (PcdSocCpuId) & STYX_SOC_VERSION_MASK) < STYX_SOC_VERSION_B1) {
-    return EFI_SUCCESS;
-  }
-
-  if (FixedPcdGet8(PcdSata1PortCount) > 0) {
-    for (PortNum = 0; PortNum < FixedPcdGet8(PcdSata1PortCount); PortNum++) {
-        SetCwMinSata1 (PortNum);
-    }
-
-    Status = InitializeSataController (FixedPcdGet32(PcdSata1CtrlAxiSlvPort),
-               FixedPcdGet8(PcdSata1PortCount),
-               FixedPcdGet8(PcdSata0PortCount));
+  if (ControllerCount > 1) {
+    Status = InitializeSataController (Controllers[1].AhciBaseAddr,
+               Controllers[1].PortCount);
     if (EFI_ERROR (Status)) {
       DEBUG ((DEBUG_WARN, "%a: failed to initialize secondary SATA controller!\n",
         __FUNCTION__));
@@ -26,6 +26,7 @@ STATIC AMD_ISCP_DXE_PROTOCOL    *mIscpDxeProtocol;
 STATIC EFI_HANDLE               mStyxSpiFvHandle;
 
 STATIC EFI_EVENT                mVirtualAddressChangeEvent;
+STATIC EFI_EVENT                mExitBootServicesEvent;
 
 STATIC UINT64 mNvStorageBase;
 STATIC UINT64 mNvStorageLbaOffset;
@@ -34,6 +35,15 @@ STATIC CONST UINT64 mNvStorageSize = FixedPcdGet32 (PcdFlashNvStorageVariableSiz
                                      FixedPcdGet32 (PcdFlashNvStorageFtwWorkingSize) +
                                      FixedPcdGet32 (PcdFlashNvStorageFtwSpareSize);
 
+//
+// Range [mStagingStart, mStagingEnd) of block mStagingLba that has been
+// written to the in-memory copy but not yet to the SPI flash.
+//
+STATIC BOOLEAN  mStagingValid;
+STATIC EFI_LBA  mStagingLba;
+STATIC UINTN    mStagingStart;
+STATIC UINTN    mStagingEnd;
+
 
 /**
   Notification function of EVT_SIGNAL_VIRTUAL_ADDRESS_CHANGE.
@@ -57,6 +67,56 @@ VariableClassAddressChangeEvent (
   EfiConvertPointer (0x0, (VOID **)&mNvStorageBase);
 }
 
+/**
+  Write the staged range of the in-memory copy to the SPI flash.
+
+  @retval EFI_SUCCESS   Nothing was staged, or the staged range was written.
+  @retval Others        The ISCP update of the staged range failed.
+
+**/
+STATIC
+EFI_STATUS
+StyxSpiFvDxeFlushStaging (
+  VOID
+  )
+{
+  EFI_STATUS      Status;
+
+  if (!mStagingValid) {
+    return EFI_SUCCESS;
+  }
+  mStagingValid = FALSE;
+
+  Status = mIscpDxeProtocol->AmdExecuteUpdateFvBlockDxe (mIscpDxeProtocol,
+                               (mStagingLba + mNvStorageLbaOffset) * BLOCK_SIZE + mStagingStart,
+                               (VOID *)mNvStorageBase + mStagingLba * BLOCK_SIZE + mStagingStart,
+                               mStagingEnd - mStagingStart);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((EFI_D_ERROR, "%a: failed to write LBA 0x%lx [0x%x, 0x%x) - %r\n",
+      __FUNCTION__, mStagingLba, mStagingStart, mStagingEnd, Status));
+  }
+  return Status;
+}
+
+/**
+  Notification function of EVT_SIGNAL_EXIT_BOOT_SERVICES: nothing may be
+  left staged once the OS owns the machine.
+
+  @param  Event        Event whose notification function is being invoked.
+  @param  Context      Pointer to the notification function's context.
+
+**/
+STATIC
+VOID
+EFIAPI
+StyxSpiFvDxeExitBootServicesEvent (
+  IN EFI_EVENT                            Event,
+  IN VOID                                 *Context
+  )
+{
+  StyxSpiFvDxeFlushStaging ();
+}
+
 /**
   The GetAttributes() function retrieves the attributes and
   current settings of the block.
@@ -264,7 +324,10 @@ StyxSpiFvDxeRead (
   DEBUG_CODE_BEGIN ();
     EFI_STATUS      Status;
 
-    if (!EfiAtRuntime ()) {
+    //
+    // Staged data has not reached the flash yet, so it cannot be compared.
+    //
+    if (!EfiAtRuntime () && !(mStagingValid && mStagingLba == Lba)) {
       Lba += mNvStorageLbaOffset;
       Status = mIscpDxeProtocol->AmdExecuteLoadFvBlockDxe (mIscpDxeProtocol,
                                    Lba * BLOCK_SIZE + Offset, Buffer, *NumBytes);
@@ -355,6 +418,41 @@ StyxSpiFvDxeWrite (
 
   Base = (VOID *)mNvStorageBase + Lba * BLOCK_SIZE + Offset;
 
+  if (FeaturePcdGet (PcdFlashNvStorageWriteStaging) && !EfiAtRuntime ()) {
+    //
+    // Merge the write into the staged range if it is in the same block and
+    // overlaps it or touches it, otherwise write the staged range out first.
+    //
+    if (mStagingValid &&
+        (Lba != mStagingLba ||
+         Offset > mStagingEnd || Offset + *NumBytes < mStagingStart)) {
+      Status = StyxSpiFvDxeFlushStaging ();
+      if (EFI_ERROR (Status)) {
+        return Status;
+      }
+    }
+
+    CopyMem (Base, Buffer, *NumBytes);
+
+    if (mStagingValid) {
+      mStagingStart = MIN (mStagingStart, Offset);
+      mStagingEnd   = MAX (mStagingEnd, Offset + *NumBytes);
+    } else {
+      mStagingValid = TRUE;
+      mStagingLba   = Lba;
+      mStagingStart = Offset;
+      mStagingEnd   = Offset + *NumBytes;
+    }
+
+    //
+    // A write that reaches the end of the block is the last one it will see.
+    //
+    if (mStagingEnd == BLOCK_SIZE) {
+      return StyxSpiFvDxeFlushStaging ();
+    }
+    return EFI_SUCCESS;
+  }
+
   Lba += mNvStorageLbaOffset;
   Status = mIscpDxeProtocol->AmdExecuteUpdateFvBlockDxe (mIscpDxeProtocol,
                                Lba * BLOCK_SIZE + Offset, Buffer, *NumBytes);
@@ -428,6 +526,11 @@ StyxSpiFvDxeErase (
   UINTN         Length;
   EFI_STATUS    Status;
 
+  Status = StyxSpiFvDxeFlushStaging ();
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
   VA_START (Args, This);
 
   for (Start = VA_ARG (Args, EFI_LBA);
@@ -488,6 +591,14 @@ StyxSpiFvDxeInitialize (
                   &mVirtualAddressChangeEvent);
   ASSERT_EFI_ERROR (Status);
 
+  if (FeaturePcdGet (PcdFlashNvStorageWriteStaging)) {
+    Status = gBS->CreateEventEx (EVT_NOTIFY_SIGNAL, TPL_NOTIFY,
+                    StyxSpiFvDxeExitBootServicesEvent, NULL,
+                    &gEfiEventExitBootServicesGuid,
+                    &mExitBootServicesEvent);
+    ASSERT_EFI_ERROR (Status);
+  }
+
   return gBS->InstallMultipleProtocolInterfaces (&mStyxSpiFvHandle,
                 &gEfiFirmwareVolumeBlockProtocolGuid, &mStyxSpiFvProtocol,
                 NULL);
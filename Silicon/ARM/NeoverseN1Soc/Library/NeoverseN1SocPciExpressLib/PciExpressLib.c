@@ -59,6 +59,11 @@
 #define GET_FUNC_NUM(Address)   (((Address) >> 12) & 0x07)
 #define GET_REG_NUM(Address)    ((Address) & 0xFFF)
 
+/* Bus, device and function bits of a configuration space offset */
+#define BDF_MAP_OFFSET_MASK     0x07FFF000
+#define BDF_MAP_INDEX(Address)  (((Address) & BDF_MAP_OFFSET_MASK) >> 12)
+#define BDF_MAP_ENTRIES         ((BDF_MAP_OFFSET_MASK >> 12) + 1)
+
 /**
   BDF Table structure : (Header + BDF Entries)
   --------------------------------------------
@@ -80,6 +85,13 @@
 **/
 STATIC UINTN mDummyConfigData = 0xFFFFFFFF;
 
+/**
+   One bit per bus/device/function, set for the BDFs listed in the SCP BDF
+   table. Filled in on first use by BuildValidBdfMap().
+**/
+STATIC UINT32  mValidBdfMap[BDF_MAP_ENTRIES / 32];
+STATIC BOOLEAN mValidBdfMapReady;
+
 /**
   Registers a PCI device so PCI configuration registers may be accessed after
   SetVirtualAddressMap().
@@ -112,6 +124,46 @@ PciExpressRegisterForRuntimeAccess (
   return RETURN_UNSUPPORTED;
 }
 
+/**
+  Build the cache of valid BDFs from the table shared by SCP.
+
+  The table is only written by SCP before the AP is released, so it is walked
+  once and each entry is recorded as a bit in mValidBdfMap, indexed by the
+  bus, device and function bits of its configuration space offset.
+
+**/
+STATIC
+VOID
+BuildValidBdfMap (
+  VOID
+  )
+{
+  UINTN BdfCount;
+  UINTN BdfValue;
+  UINTN BdfEntry;
+  UINTN BdfIndex;
+  UINTN Count;
+  UINTN TableBase;
+
+  TableBase = NEOVERSEN1SOC_NON_SECURE_SRAM_BASE + PCIE_BDF_TABLE_OFFSET;
+  BdfCount = MmioRead32 (TableBase + BDF_TABLE_ENTRY_SIZE);
+  BdfEntry = TableBase + BDF_TABLE_HEADER_SIZE;
+
+  /* Skip the header & record remaining entry */
+  for (Count = 0; Count < BdfCount; Count++, BdfEntry += BDF_TABLE_ENTRY_SIZE) {
+    BdfValue = MmioRead32 (BdfEntry);
+    if ((BdfValue & ~BDF_MAP_OFFSET_MASK) != 0) {
+      DEBUG ((DEBUG_WARN, "%a: ignoring BDF table entry 0x%x\n",
+        __FUNCTION__, BdfValue));
+      continue;
+    }
+    BdfIndex = BDF_MAP_INDEX (BdfValue);
+    mValidBdfMap[BdfIndex / 32] |= 1U << (BdfIndex % 32);
+  }
+
+  mValidBdfMapReady = TRUE;
+}
+
 /**
   Check if the requested PCI address can be safely accessed.
 
@@ -122,6 +174,9 @@ PciExpressRegisterForRuntimeAccess (
   avoid bus fault that occurs when accessing unavailable PCI device due to
   hardware bug.
 
+  The table is cached in a bitmap on first use, so that every configuration
+  access costs a single bit test instead of a walk over the SRAM table.
+
   @param  Address The address that encodes the PCI Bus, Device, Function and
                   Register.
 
@@ -135,27 +190,14 @@ IsBdfValid (
   IN      UINTN                     Address
   )
 {
-  UINTN BdfCount;
-  UINTN BdfValue;
-  UINTN BdfEntry;
-  UINTN Count;
-  UINTN TableBase;
-  UINTN ConfigBase;
+  UINTN BdfIndex;
 
-  ConfigBase = Address & ~0xFFF;
-  TableBase = NEOVERSEN1SOC_NON_SECURE_SRAM_BASE + PCIE_BDF_TABLE_OFFSET;
-  BdfCount = MmioRead32 (TableBase + BDF_TABLE_ENTRY_SIZE);
-  BdfEntry = TableBase + BDF_TABLE_HEADER_SIZE;
-
-  /* Skip the header & check remaining entry */
-  for (Count = 0; Count < BdfCount; Count++, BdfEntry += BDF_TABLE_ENTRY_SIZE) {
-    BdfValue = MmioRead32 (BdfEntry);
-    if (BdfValue == ConfigBase) {
-      return TRUE;
-    }
+  if (!mValidBdfMapReady) {
+    BuildValidBdfMap ();
   }
 
-  return FALSE;
+  BdfIndex = BDF_MAP_INDEX (Address);
+  return (mValidBdfMap[BdfIndex / 32] & (1U << (BdfIndex % 32))) != 0;
 }
 
 /**
@@ -186,14 +228,10 @@ GetPciExpressAddress (
   IN      UINTN                     Address
   )
 {
-  UINT8 Bus, Device, Function;
   UINTN ConfigAddress;
 
-  Bus = GET_BUS_NUM (Address);
-  Device = GET_DEV_NUM (Address);
-  Function = GET_FUNC_NUM (Address);
-
-  if ((Bus == 0) && (Device == 0) && (Function == 0)) {
+  /* BDF 0:0:0 is the root port */
+  if ((Address & BDF_MAP_OFFSET_MASK) == 0) {
     ConfigAddress = PcdGet32 (PcdPcieRootPortConfigBaseAddress) + Address;
   } else {
     ConfigAddress = PcdGet64 (PcdPciExpressBaseAddress) + Address;
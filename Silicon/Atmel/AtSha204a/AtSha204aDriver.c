@@ -76,54 +76,28 @@ AtSha240aGetInfo (
 
 
 /**
-  Produces and returns an RNG value using either the default or specified RNG
-  algorithm.
+  Wake up the device and run RANDOM commands back to back until the pool is
+  full.
 
-  @param[in]  This                A pointer to the EFI_RNG_PROTOCOL instance.
-  @param[in]  Algorithm           A pointer to the EFI_RNG_ALGORITHM that
-                                  identifies the RNG algorithm to use. May be
-                                  NULL in which case the function will use its
-                                  default RNG algorithm.
-  @param[in]  ValueLength         The length in bytes of the memory buffer
-                                  pointed to by RNGValue. The driver shall
-                                  return exactly this numbers of bytes.
-  @param[out] Value               A caller-allocated memory buffer filled by the
-                                  driver with the resulting RNG value.
+  @param[in]  AtSha204a           The device to refill the pool of.
 
-  @retval EFI_SUCCESS             The RNG value was returned successfully.
-  @retval EFI_UNSUPPORTED         The algorithm specified by RNGAlgorithm is not
-                                  supported by this driver.
-  @retval EFI_DEVICE_ERROR        An RNG value could not be retrieved due to a
-                                  hardware or firmware error.
-  @retval EFI_NOT_READY           There is not enough random data available to
-                                  satisfy the length requested by
-                                  RNGValueLength.
-  @retval EFI_INVALID_PARAMETER   RNGValue is NULL or RNGValueLength is zero.
+  @retval EFI_SUCCESS             The pool was filled.
+  @retval EFI_DEVICE_ERROR        The device failed to produce random data.
 
 **/
 STATIC
 EFI_STATUS
-EFIAPI
-AtSha240aGetRNG (
-  IN EFI_RNG_PROTOCOL   *This,
-  IN EFI_RNG_ALGORITHM  *Algorithm OPTIONAL,
-  IN UINTN              ValueLength,
-  OUT UINT8             *Value
-)
+AtSha204aFillPool (
+  IN  ATSHA204A_DEV   *AtSha204a
+  )
 {
   EFI_STATUS                  Status;
-  ATSHA204A_DEV               *AtSha204a;
   ATSHA204A_I2C_RNG_COMMAND   Command;
   ATSHA204A_I2C_RNG_RESULT    Result;
   I2C_RNG_REQUEST             Request;
   I2C_RNG_REQUEST             Response;
   UINTN                       Retries;
-
-  if (Algorithm != NULL && !CompareGuid (Algorithm, &gEfiRngAlgorithmRaw)) {
-    return EFI_UNSUPPORTED;
-  }
-
-  AtSha204a = ATSHA204A_DEV_FROM_THIS (This);
+  BOOLEAN                     Wake;
 
   Request.OperationCount  = 1;
   Request.Operation.Flags = 0;
@@ -141,19 +115,23 @@ AtSha240aGetRNG (
   Response.Operation.Buffer         = (VOID *)&Result;
 
   Retries = 0;
-  while (ValueLength > 0) {
-    //
-    // The AtSha204a will go back to sleep right in the middle of a transaction
-    // if it does not complete in ~1.3 seconds. So send the wake sequence for
-    // each iteration, which consists of a dummy write to slave address 0x0.
-    //
-    Request.Operation.LengthInBytes = 0;
-    Status = AtSha204a->I2cIo->QueueRequest (AtSha204a->I2cIo, 1, NULL,
-                                 (VOID *)&Request, NULL);
-    DEBUG ((DEBUG_INFO, "%a: wake AtSha204a: I2cIo->QueueRequest() - %r\n",
-      __FUNCTION__, Status));
+  Wake = TRUE;
+  while (AtSha204a->PoolCount + ATSHA204A_OUTPUT_SIZE <= ATSHA204A_POOL_SIZE) {
+    if (Wake) {
+      //
+      // The wake sequence consists of a dummy write to slave address 0x0.
+      // A full pool refill fits in a single wake window, so this is only
+      // repeated when a transfer failed, in case the device dozed off.
+      //
+      Request.Operation.LengthInBytes = 0;
+      Status = AtSha204a->I2cIo->QueueRequest (AtSha204a->I2cIo, 1, NULL,
+                                   (VOID *)&Request, NULL);
+      DEBUG ((DEBUG_INFO, "%a: wake AtSha204a: I2cIo->QueueRequest() - %r\n",
+        __FUNCTION__, Status));
 
-    gBS->Stall (2500); // wait 2.5 ms for wake to complete
+      gBS->Stall (2500); // wait 2.5 ms for wake to complete
+      Wake = FALSE;
+    }
 
     Request.Operation.LengthInBytes = sizeof (Command);
     Request.Operation.Buffer = (VOID *)&Command;
@@ -161,6 +139,7 @@ AtSha240aGetRNG (
                                  (VOID *)&Request, NULL);
     if (EFI_ERROR (Status)) {
       if (++Retries <= MAX_RETRIES) {
+        Wake = TRUE;
         continue;
       }
       DEBUG ((DEBUG_ERROR, "%a: I2C request transfer failed, Status == %r\n",
@@ -174,6 +153,7 @@ AtSha240aGetRNG (
                                  (VOID *)&Response, NULL);
     if (EFI_ERROR (Status)) {
       if (++Retries <= MAX_RETRIES) {
+        Wake = TRUE;
         continue;
       }
       DEBUG ((DEBUG_ERROR, "%a: I2C response transfer failed, Status == %r\n",
@@ -186,21 +166,89 @@ AtSha240aGetRNG (
       // Incomplete packet received, most likely due to an error. Retry.
       //
       if (++Retries <= MAX_RETRIES) {
+        Wake = TRUE;
         continue;
       }
       DEBUG ((DEBUG_WARN, "%a: incomplete packet received\n", __FUNCTION__));
       return EFI_DEVICE_ERROR;
     }
 
-    gBS->CopyMem (Value, Result.Result, MIN (ValueLength,
-                                             ATSHA204A_OUTPUT_SIZE));
-    if (ValueLength < ATSHA204A_OUTPUT_SIZE) {
-      break;
+    CopyMem (&AtSha204a->Pool[AtSha204a->PoolCount], Result.Result,
+      ATSHA204A_OUTPUT_SIZE);
+    AtSha204a->PoolCount += ATSHA204A_OUTPUT_SIZE;
+    Retries = 0;
+  }
+
+  ZeroMem (&Result, sizeof (Result));
+  return EFI_SUCCESS;
+}
+
+
+/**
+  Produces and returns an RNG value using either the default or specified RNG
+  algorithm.
+
+  @param[in]  This                A pointer to the EFI_RNG_PROTOCOL instance.
+  @param[in]  Algorithm           A pointer to the EFI_RNG_ALGORITHM that
+                                  identifies the RNG algorithm to use. May be
+                                  NULL in which case the function will use its
+                                  default RNG algorithm.
+  @param[in]  ValueLength         The length in bytes of the memory buffer
+                                  pointed to by RNGValue. The driver shall
+                                  return exactly this numbers of bytes.
+  @param[out] Value               A caller-allocated memory buffer filled by the
+                                  driver with the resulting RNG value.
+
+  @retval EFI_SUCCESS             The RNG value was returned successfully.
+  @retval EFI_UNSUPPORTED         The algorithm specified by RNGAlgorithm is not
+                                  supported by this driver.
+  @retval EFI_DEVICE_ERROR        An RNG value could not be retrieved due to a
+                                  hardware or firmware error.
+  @retval EFI_NOT_READY           There is not enough random data available to
+                                  satisfy the length requested by
+                                  RNGValueLength.
+  @retval EFI_INVALID_PARAMETER   RNGValue is NULL or RNGValueLength is zero.
+
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+AtSha240aGetRNG (
+  IN EFI_RNG_PROTOCOL   *This,
+  IN EFI_RNG_ALGORITHM  *Algorithm OPTIONAL,
+  IN UINTN              ValueLength,
+  OUT UINT8             *Value
+)
+{
+  EFI_STATUS                  Status;
+  ATSHA204A_DEV               *AtSha204a;
+  UINTN                       Size;
+
+  if (Algorithm != NULL && !CompareGuid (Algorithm, &gEfiRngAlgorithmRaw)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  AtSha204a = ATSHA204A_DEV_FROM_THIS (This);
+
+  while (ValueLength > 0) {
+    if (AtSha204a->PoolCount == 0) {
+      Status = AtSha204aFillPool (AtSha204a);
+      if (EFI_ERROR (Status)) {
+        return Status;
+      }
     }
 
-    Value += ATSHA204A_OUTPUT_SIZE;
-    ValueLength -= ATSHA204A_OUTPUT_SIZE;
-    Retries = 0;
+    //
+    // Hand out pool bytes from the top down, and wipe them so that no byte
+    // is ever returned twice.
+    //
+    Size = MIN (ValueLength, AtSha204a->PoolCount);
+    AtSha204a->PoolCount -= Size;
+    CopyMem (Value, &AtSha204a->Pool[AtSha204a->PoolCount], Size);
+    ZeroMem (&AtSha204a->Pool[AtSha204a->PoolCount], Size);
+
+    Value += Size;
+    ValueLength -= Size;
   }
   return EFI_SUCCESS;
 }
@@ -221,6 +269,7 @@ AtSha204aInit (
   }
 
   AtSha204a->Signature    = ATSHA204A_DEV_SIGNATURE;
+  AtSha204a->PoolCount    = 0;
   AtSha204a->Rng.GetInfo  = AtSha240aGetInfo;
   AtSha204a->Rng.GetRNG   = AtSha240aGetRNG;
 
@@ -297,6 +346,7 @@ AtSha204aRelease (
     return Status;
   }
 
+  ZeroMem (AtSha204a->Pool, sizeof (AtSha204a->Pool));
   gBS->FreePool (AtSha204a);
 
   return EFI_SUCCESS;
@@ -21,12 +21,22 @@
 
 #define ATSHA204A_OUTPUT_SIZE     32
 
+//
+// Random output is buffered so that a single wake window serves several
+// callers. Each RANDOM command takes up to 50 ms, so a full refill must stay
+// well within the ~1.3 second watchdog timeout after which the device goes
+// back to sleep by itself.
+//
+#define ATSHA204A_POOL_SIZE       (4 * ATSHA204A_OUTPUT_SIZE)
+
 #define ATSHA204A_DEV_SIGNATURE   SIGNATURE_32('a','t','s','h')
 
 typedef struct {
   UINT32                        Signature;
   EFI_I2C_IO_PROTOCOL           *I2cIo;
   EFI_RNG_PROTOCOL              Rng;
+  UINTN                         PoolCount;
+  UINT8                         Pool[ATSHA204A_POOL_SIZE];
 } ATSHA204A_DEV;
 
 #define ATSHA204A_DEV_FROM_THIS(a) \
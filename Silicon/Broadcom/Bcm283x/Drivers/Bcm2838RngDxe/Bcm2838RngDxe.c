@@ -88,12 +88,12 @@ Bcm2838RngGetInfo (
 }
 
 /**
-  Read a single random value, in either FIFO or regular mode.
+  Wait for the FIFO to hold random values.
 
-  @param[in]  Val                     A pointer to the 32-bit word that is to
-                                      be filled with a random value.
+  @param[out] Avail                   The number of 32-bit words that can be
+                                      read from RNG_FIFO_DATA.
 
-  @retval EFI_SUCCESS                 A random value was successfully read.
+  @retval EFI_SUCCESS                 At least one random value is available.
   @retval EFI_NOT_READY               The number of retries elapsed before a
                                       random value was generated.
 
@@ -101,16 +101,16 @@ Bcm2838RngGetInfo (
 STATIC
 EFI_STATUS
 EFIAPI
-Bcm2838RngReadValue (
-  IN OUT  UINT32                  *Val
+Bcm2838RngWaitForData (
+  OUT     UINT32                  *Avail
 )
 {
-  UINT32 Avail;
+  UINT32 Count;
   UINT32 i;
 
-  ASSERT (Val != NULL);
+  ASSERT (Avail != NULL);
 
-  Avail = MmioRead32 (RNG_FIFO_COUNT) & RNG_FIFO_DATA_AVAIL_MASK;
+  Count = MmioRead32 (RNG_FIFO_COUNT) & RNG_FIFO_DATA_AVAIL_MASK;
 
   //
   // If we don't have a value ready, wait 1 us and retry.
@@ -129,15 +129,15 @@ Bcm2838RngReadValue (
   // (RPi4) you'd need to start requesting random data within the first
   // 250 to 500 ms after driver instantiation for this to happen.
   //
-  for (i = 0; Avail < 1 && i < RNG_MAX_RETRIES; i++) {
+  for (i = 0; Count < 1 && i < RNG_MAX_RETRIES; i++) {
     MicroSecondDelay (1);
-    Avail = MmioRead32 (RNG_FIFO_COUNT) & RNG_FIFO_DATA_AVAIL_MASK;
+    Count = MmioRead32 (RNG_FIFO_COUNT) & RNG_FIFO_DATA_AVAIL_MASK;
   }
-  if (Avail < 1) {
+  if (Count < 1) {
     return EFI_NOT_READY;
   }
 
-  *Val = MmioRead32 (RNG_FIFO_DATA);
+  *Avail = Count;
 
   return EFI_SUCCESS;
 }
@@ -183,6 +183,7 @@ Bcm2838RngGetRNG (
 {
   EFI_STATUS      Status;
   UINT32          Val;
+  UINT32          Avail;
 
   if (This == NULL || RNGValueLength == 0 || RNGValue == NULL) {
     return EFI_INVALID_PARAMETER;
@@ -206,24 +207,31 @@ Bcm2838RngGetRNG (
   // it just stays there...
   //
 
-  while (RNGValueLength >= sizeof (UINT32)) {
-    Status = Bcm2838RngReadValue (&Val);
+  //
+  // Drain whatever the FIFO holds on each status check, rather than polling
+  // RNG_FIFO_COUNT again for every word. The FIFO keeps filling in the
+  // background between calls, so short requests usually need a single check.
+  //
+  while (RNGValueLength > 0) {
+    Status = Bcm2838RngWaitForData (&Avail);
     if (EFI_ERROR (Status)) {
       return Status;
     }
-    WriteUnaligned32 ((VOID *)RNGValue, Val);
-    RNGValue += sizeof (UINT32);
-    RNGValueLength -= sizeof (UINT32);
-  }
 
-  if (RNGValueLength > 0) {
-    Status = Bcm2838RngReadValue (&Val);
-    if (EFI_ERROR (Status)) {
-      return Status;
+    while (RNGValueLength >= sizeof (UINT32) && Avail > 0) {
+      WriteUnaligned32 ((VOID *)RNGValue, MmioRead32 (RNG_FIFO_DATA));
+      RNGValue += sizeof (UINT32);
+      RNGValueLength -= sizeof (UINT32);
+      Avail--;
     }
-    while (RNGValueLength--) {
-      *RNGValue++ = (UINT8)Val;
-      Val >>= 8;
+
+    if (RNGValueLength > 0 && RNGValueLength < sizeof (UINT32) && Avail > 0) {
+      Val = MmioRead32 (RNG_FIFO_DATA);
+      while (RNGValueLength > 0) {
+        *RNGValue++ = (UINT8)Val;
+        Val >>= 8;
+        RNGValueLength--;
+      }
     }
   }
   return EFI_SUCCESS;
@@ -240,15 +240,20 @@ IrqInterruptHandler (
 
   RegVal = MmioRead32 (RegBase + BCM2836_INTC_TIMER_PENDING_OFFSET) &
     ((1 << NUM_IRQS) - 1);
-  Source = HighBitSet32 (RegVal);
-  if (Source < 0) {
-    return;
-  }
 
-  InterruptHandler = mRegisteredInterruptHandlers[Source];
-  if (InterruptHandler != NULL) {
-    // Call the registered interrupt handler.
-    InterruptHandler (Source, SystemContext);
+  //
+  // Dispatch every source that is pending now, highest first, rather than
+  // taking another exception for each of the others.
+  //
+  while (RegVal != 0) {
+    Source = HighBitSet32 (RegVal);
+    RegVal &= ~(1U << Source);
+
+    InterruptHandler = mRegisteredInterruptHandlers[Source];
+    if (InterruptHandler != NULL) {
+      // Call the registered interrupt handler.
+      InterruptHandler (Source, SystemContext);
+    }
   }
 }
 
@@ -120,5 +120,37 @@
 #define BCM2836_DMA_CTRL_BASE_ADDRESS                       (BCM2836_SOC_REGISTERS + BCM2836_DMA_CTRL_OFFSET)
 
 #define BCM2836_DMA_CHANNEL_LENGTH                          0x00000100
+#define BCM2836_DMA_CHANNEL_BASE_ADDRESS(Ch)                (BCM2836_DMA0_BASE_ADDRESS + (Ch) * BCM2836_DMA_CHANNEL_LENGTH)
+
+#define BCM2836_DMA_CS_OFFSET                               0x00000000
+#define BCM2836_DMA_CONBLK_AD_OFFSET                        0x00000004
+#define BCM2836_DMA_DEBUG_OFFSET                            0x00000020
+#define BCM2836_DMA_ENABLE_OFFSET                           0x00000010 // from BCM2836_DMA_CTRL_BASE_ADDRESS
+
+#define BCM2836_DMA_CS_ACTIVE                               BIT0
+#define BCM2836_DMA_CS_END                                  BIT1
+#define BCM2836_DMA_CS_INT                                  BIT2
+#define BCM2836_DMA_CS_ERROR                                BIT8
+#define BCM2836_DMA_CS_PRIORITY(X)                          (((X) & 0xF) << 16)
+#define BCM2836_DMA_CS_PANIC_PRIORITY(X)                    (((X) & 0xF) << 20)
+#define BCM2836_DMA_CS_WAIT_FOR_OUTSTANDING_WRITES          BIT28
+#define BCM2836_DMA_CS_ABORT                                BIT30
+#define BCM2836_DMA_CS_RESET                                BIT31
+
+#define BCM2836_DMA_TI_WAIT_RESP                            BIT3
+#define BCM2836_DMA_TI_DEST_INC                             BIT4
+#define BCM2836_DMA_TI_DEST_DREQ                            BIT6
+#define BCM2836_DMA_TI_SRC_INC                              BIT8
+#define BCM2836_DMA_TI_SRC_DREQ                             BIT10
+#define BCM2836_DMA_TI_PERMAP(X)                            (((X) & 0x1F) << 16)
+
+#define BCM2836_DMA_DEBUG_ERRORS                            0x00000007
+
+#define BCM2836_DMA_DREQ_SDHOST                             13
+
+//
+// DMA-lite channels (7-14) can only move 64KB per control block.
+//
+#define BCM2836_DMA_MAX_CB_LENGTH                           SIZE_64KB
 
 #endif /*__BCM2836_H__ */
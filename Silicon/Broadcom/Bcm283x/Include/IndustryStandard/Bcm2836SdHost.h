@@ -32,6 +32,9 @@
 #define SDHOST_DATA                 SDHOST_REG(0x40)
 #define SDHOST_HBLC                 SDHOST_REG(0x50)
 
+#define SDHOST_BUS_ADDRESS          0x7E202000
+#define SDHOST_DATA_BUS_ADDRESS     (SDHOST_BUS_ADDRESS + 0x40)
+
 //
 // CMD
 //
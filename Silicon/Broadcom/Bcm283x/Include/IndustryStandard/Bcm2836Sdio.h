@@ -16,12 +16,17 @@
 #define MMCHS1_BASE       (BCM2836_SOC_REGISTERS + MMCHS1_OFFSET)
 #define MMCHS1_LENGTH     0x00000100
 
+#define MMCHS_SDMA_ADDR   (MMCHS1_BASE + 0x0)
+
 #define MMCHS_BLK         (MMCHS1_BASE + 0x4)
 #define BLEN_512BYTES     (0x200UL << 0)
+#define SDMA_BOUNDARY_512K (0x7UL << 12)
+#define SDMA_BOUNDARY_SIZE SIZE_512KB
 
 #define MMCHS_ARG         (MMCHS1_BASE + 0x8)
 
 #define MMCHS_CMD         (MMCHS1_BASE + 0xC)
+#define DE_ENABLE         BIT0
 #define BCE_ENABLE        BIT1
 #define DDIR_READ         BIT4
 #define DDIR_WRITE        (0x0UL << 4)
@@ -61,6 +66,9 @@
 #define MMCHS_HCTL        (MMCHS1_BASE + 0x28)
 #define DTW_1_BIT         (0x0UL << 1)
 #define DTW_4_BIT         BIT1
+#define DMAS_MASK         (0x3UL << 3)
+#define DMAS_SDMA         (0x0UL << 3)
+#define DMAS_ADMA2_32     (0x2UL << 3)
 #define SDBP_MASK         BIT8
 #define SDBP_OFF          (0x0UL << 8)
 #define SDBP_ON           BIT8
@@ -87,6 +95,7 @@
 #define MMCHS_INT_STAT    (MMCHS1_BASE + 0x30)
 #define CC                BIT0
 #define TC                BIT1
+#define DINT              BIT3
 #define BWR               BIT4
 #define BRR               BIT5
 #define CARD_INS          BIT6
@@ -95,6 +104,7 @@
 #define DTO               BIT20
 #define DCRC              BIT21
 #define DEB               BIT22
+#define ADMAE             BIT25
 
 #define MMCHS_IE          (MMCHS1_BASE + 0x34)
 #define CC_EN             BIT0
@@ -130,10 +140,13 @@
 #define MMCHS_AC12        (MMCHS1_BASE + 0x3C)
 
 #define MMCHS_CAPA        (MMCHS1_BASE + 0x40)
+#define ADMA2_SUPPORT     BIT19
+#define SDMA_SUPPORT      BIT22
 #define VS30              BIT25
 #define VS18              BIT26
 
 #define MMCHS_CUR_CAPA    (MMCHS1_BASE + 0x48)
+#define MMCHS_ADMA_ADDR   (MMCHS1_BASE + 0x58)
 #define MMCHS_REV         (MMCHS1_BASE + 0xFC)
 
 #define BLOCK_COUNT_SHIFT 16
@@ -183,6 +196,12 @@
 #define ACMD41            (INDX(41) | CMD_R3) // Send Op Cond
 #define ACMD51            (INDX(51) | CMD_R1_ADTC_READ) // Send SCR
 
+// ADMA2 32-bit descriptor
+#define ADMA2_VALID       BIT0
+#define ADMA2_END         BIT1
+#define ADMA2_ACT_TRAN    (0x2UL << 4)
+#define ADMA2_MAX_LENGTH  SIZE_64KB   // encoded as a Length of 0
+
 // User-friendly command names
 #define CMD_IO_SEND_OP_COND      CMD5
 #define CMD_SEND_CSD             CMD9  // CSD: Card-Specific Data
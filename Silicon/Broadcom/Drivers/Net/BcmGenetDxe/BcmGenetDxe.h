@@ -218,15 +218,17 @@ typedef struct {
 
   UINT8                               *TxBuffer[GENET_DMA_DESC_COUNT];
   VOID                                *TxBufferMap[GENET_DMA_DESC_COUNT];
-  UINT8                               TxQueued;
+  UINT16                              TxQueued;
+  UINT16                              TxCompleted;
   UINT16                              TxNext;
   UINT16                              TxConsIndex;
   UINT16                              TxProdIndex;
 
   EFI_PHYSICAL_ADDRESS                RxBuffer;
-  GENET_MAP_INFO                      RxBufferMap[GENET_DMA_DESC_COUNT];
+  GENET_MAP_INFO                      RxBufferMap;
   UINT16                              RxConsIndex;
   UINT16                              RxProdIndex;
+  UINT16                              RxPending;
 
   GENET_PHY_MODE                      PhyMode;
 
@@ -341,15 +343,13 @@ GenetDmaTriggerTx (
   );
 
 EFI_STATUS
-GenetDmaMapRxDescriptor (
-  IN GENET_PRIVATE_DATA *Genet,
-  IN UINT8              DescIndex
+GenetDmaMapRxRing (
+  IN GENET_PRIVATE_DATA *Genet
   );
 
 VOID
-GenetDmaUnmapRxDescriptor (
-  IN GENET_PRIVATE_DATA *Genet,
-  IN UINT8               DescIndex
+GenetDmaUnmapRxRing (
+  IN GENET_PRIVATE_DATA *Genet
   );
 
 VOID
@@ -92,7 +92,12 @@ GenetNotifyExitBootServices (
   VOID          *Context
   )
 {
-  GenetDisableTxRx ((GENET_PRIVATE_DATA *)Context);
+  GENET_PRIVATE_DATA *Genet;
+
+  Genet = (GENET_PRIVATE_DATA *)Context;
+
+  GenericPhyStop (&Genet->Phy);
+  GenetDisableTxRx (Genet);
 }
 
 /**
@@ -181,7 +186,7 @@ GenetDriverBindingStart (
   Genet->SnpMode.MCastFilterCount       = 0;
   Genet->SnpMode.IfType                 = NET_IFTYPE_ETHERNET;
   Genet->SnpMode.MacAddressChangeable   = TRUE;
-  Genet->SnpMode.MultipleTxSupported    = FALSE;
+  Genet->SnpMode.MultipleTxSupported    = TRUE;
   Genet->SnpMode.MediaPresentSupported  = TRUE;
   Genet->SnpMode.MediaPresent           = FALSE;
 
@@ -286,6 +291,8 @@ GenetDriverBindingStop (
   Status = gBS->CloseEvent (Genet->ExitBootServicesEvent);
   ASSERT_EFI_ERROR (Status);
 
+  GenericPhyStop (&Genet->Phy);
+
   GenetDmaFree (Genet);
 
   Status = gBS->CloseProtocol (ControllerHandle,
@@ -15,6 +15,13 @@
 
 #define PHY_RESET_TIMEOUT       500
 
+//
+// PHY state machine polling periods, in 100ns units
+//
+#define PHY_POLL_RESET_MS       10
+#define PHY_POLL_RESET_PERIOD   EFI_TIMER_PERIOD_MILLISECONDS (PHY_POLL_RESET_MS)
+#define PHY_POLL_LINK_PERIOD    EFI_TIMER_PERIOD_MILLISECONDS (100)
+
 /**
   Perform a PHY register read.
 
@@ -174,16 +181,25 @@ GenericPhyAutoNegotiate (
   return GenericPhyWrite (Phy, Phy->PhyAddr, GENERIC_PHY_BMCR, Bmcr);
 }
 
+STATIC
+VOID
+EFIAPI
+GenericPhyPoll (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  );
+
 /**
-  Initialize the first PHY detected, performing a reset and enabling
-  auto-negotiation.
+  Initialize the first PHY detected, launching a reset which is followed
+  by auto-negotiation. Both complete asynchronously, driven by the PHY
+  polling timer, so this function does not wait for the link.
 
   @param  Phy[in]  Pointer to GENERIC_PHY_PRIVATE_DATA.
 
-  @retval EFI_SUCCESS       Auto-negotiation started.
-  @retval EFI_DEVICE_ERROR  PHY register read/write error.
-  @retval EFI_TIMEOUT       PHY reset time-out.
-  @retval EFI_NOT_FOUND     No PHY detected.
+  @retval EFI_SUCCESS           PHY reset started.
+  @retval EFI_DEVICE_ERROR      PHY register read/write error.
+  @retval EFI_NOT_FOUND         No PHY detected.
+  @retval EFI_OUT_OF_RESOURCES  Failed to create the PHY polling timer.
 
 **/
 EFI_STATUS
@@ -203,22 +219,28 @@ GenericPhyInit (
     return Status;
   }
 
-  Status = GenericPhyReset (Phy);
-  if (EFI_ERROR (Status)) {
-    return Status;
+  if (Phy->PollEvent == NULL) {
+    Status = gBS->CreateEvent (EVT_TIMER | EVT_NOTIFY_SIGNAL, TPL_CALLBACK,
+                    GenericPhyPoll, Phy, &Phy->PollEvent);
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "%a: Failed to create PHY timer: %r\n",
+        __FUNCTION__, Status));
+      return Status;
+    }
   }
 
-  return GenericPhyAutoNegotiate (Phy);
+  return GenericPhyReset (Phy);
 }
 
 /**
-  Perform a PHY reset.
+  Start a PHY reset. The reset completion, and the auto-negotiation that
+  follows it, are handled by the PHY polling timer.
 
   @param  Phy[in]  Pointer to GENERIC_PHY_PRIVATE_DATA.
 
-  @retval EFI_SUCCESS       Auto-negotiation started.
+  @retval EFI_SUCCESS       PHY reset started.
   @retval EFI_DEVICE_ERROR  PHY register read/write error.
-  @retval EFI_TIMEOUT       PHY reset time-out.
+  @retval EFI_NOT_READY     PHY was not initialized.
 
 **/
 EFI_STATUS
@@ -228,36 +250,55 @@ GenericPhyReset (
   )
 {
   EFI_STATUS    Status;
-  UINTN         Retry;
-  UINT16        Data;
+  EFI_TPL       SavedTpl;
+
+  if (Phy->PollEvent == NULL) {
+    return EFI_NOT_READY;
+  }
+
+  SavedTpl = gBS->RaiseTPL (TPL_CALLBACK);
+
+  Phy->LinkUp = FALSE;
 
   // Start reset sequence
   Status = GenericPhyWrite (Phy, Phy->PhyAddr, GENERIC_PHY_BMCR,
              GENERIC_PHY_BMCR_RESET);
   if (EFI_ERROR (Status)) {
+    Phy->State = GENERIC_PHY_STATE_STOPPED;
+    gBS->SetTimer (Phy->PollEvent, TimerCancel, 0);
+    gBS->RestoreTPL (SavedTpl);
     return Status;
   }
 
-  // Wait up to 500ms for it to complete
-  for (Retry = PHY_RESET_TIMEOUT; Retry > 0; Retry--) {
-    Status = GenericPhyRead (Phy, Phy->PhyAddr, GENERIC_PHY_BMCR, &Data);
-    if (EFI_ERROR (Status)) {
-      return Status;
-    }
-    if ((Data & GENERIC_PHY_BMCR_RESET) == 0) {
-      break;
-    }
-    gBS->Stall (1000);
-  }
-  if (Retry == 0) {
-    return EFI_TIMEOUT;
-  }
+  // Allow up to 500ms for it to complete
+  Phy->State = GENERIC_PHY_STATE_RESETTING;
+  Phy->ResetRetry = PHY_RESET_TIMEOUT / PHY_POLL_RESET_MS;
+  Status = gBS->SetTimer (Phy->PollEvent, TimerPeriodic, PHY_POLL_RESET_PERIOD);
+
+  gBS->RestoreTPL (SavedTpl);
+
+  return Status;
+}
+
+/**
+  Stop the PHY state machine, e.g. when the MAC is shut down.
+
+  @param  Phy[in]  Pointer to GENERIC_PHY_PRIVATE_DATA.
 
-  if (Phy->ResetAction != NULL) {
-    Phy->ResetAction (Phy->PrivateData);
+**/
+VOID
+EFIAPI
+GenericPhyStop (
+  IN GENERIC_PHY_PRIVATE_DATA   *Phy
+  )
+{
+  if (Phy->PollEvent != NULL) {
+    gBS->CloseEvent (Phy->PollEvent);
+    Phy->PollEvent = NULL;
   }
 
-  return EFI_SUCCESS;
+  Phy->State = GENERIC_PHY_STATE_STOPPED;
+  Phy->LinkUp = FALSE;
 }
 
 /**
@@ -369,9 +410,9 @@ GenericPhyGetConfig (
   @retval EFI_NOT_READY     Link is down.
 
 **/
+STATIC
 EFI_STATUS
-EFIAPI
-GenericPhyUpdateConfig (
+GenericPhyPollLink (
   IN GENERIC_PHY_PRIVATE_DATA *Phy
   )
 {
@@ -402,3 +443,80 @@ GenericPhyUpdateConfig (
 
   return LinkUp ? EFI_SUCCESS : EFI_NOT_READY;
 }
+
+/**
+  PHY polling timer handler, advancing the PHY state machine: wait for the
+  reset to complete, start auto-negotiation, then track the link state.
+
+  @param  Event[in]    Timer event.
+  @param  Context[in]  Pointer to GENERIC_PHY_PRIVATE_DATA.
+
+**/
+STATIC
+VOID
+EFIAPI
+GenericPhyPoll (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  GENERIC_PHY_PRIVATE_DATA  *Phy;
+  EFI_STATUS                Status;
+  UINT16                    Data;
+
+  Phy = Context;
+
+  switch (Phy->State) {
+  case GENERIC_PHY_STATE_RESETTING:
+    Status = GenericPhyRead (Phy, Phy->PhyAddr, GENERIC_PHY_BMCR, &Data);
+    if (!EFI_ERROR (Status) && (Data & GENERIC_PHY_BMCR_RESET) != 0) {
+      if (--Phy->ResetRetry > 0) {
+        break;
+      }
+      Status = EFI_TIMEOUT;
+    }
+
+    if (!EFI_ERROR (Status)) {
+      if (Phy->ResetAction != NULL) {
+        Phy->ResetAction (Phy->PrivateData);
+      }
+      Status = GenericPhyAutoNegotiate (Phy);
+    }
+
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "%a: PHY reset failed: %r\n", __FUNCTION__, Status));
+      Phy->State = GENERIC_PHY_STATE_STOPPED;
+      gBS->SetTimer (Phy->PollEvent, TimerCancel, 0);
+      break;
+    }
+
+    Phy->State = GENERIC_PHY_STATE_LINK_POLL;
+    gBS->SetTimer (Phy->PollEvent, TimerPeriodic, PHY_POLL_LINK_PERIOD);
+    break;
+
+  case GENERIC_PHY_STATE_LINK_POLL:
+    GenericPhyPollLink (Phy);
+    break;
+
+  default:
+    break;
+  }
+}
+
+/**
+  Return the link status tracked by the PHY polling timer.
+
+  @param  Phy[in]  Pointer to GENERIC_PHY_PRIVATE_DATA.
+
+  @retval EFI_SUCCESS       Link is up.
+  @retval EFI_NOT_READY     Link is down, or still being negotiated.
+
+**/
+EFI_STATUS
+EFIAPI
+GenericPhyUpdateConfig (
+  IN GENERIC_PHY_PRIVATE_DATA *Phy
+  )
+{
+  return Phy->LinkUp ? EFI_SUCCESS : EFI_NOT_READY;
+}
@@ -101,6 +101,12 @@ VOID
   IN GENERIC_PHY_DUPLEX       Duplex
   );
 
+typedef enum {
+  GENERIC_PHY_STATE_STOPPED,
+  GENERIC_PHY_STATE_RESETTING,
+  GENERIC_PHY_STATE_LINK_POLL
+} GENERIC_PHY_STATE;
+
 typedef struct {
   GENERIC_PHY_READ            Read;
   GENERIC_PHY_WRITE           Write;
@@ -110,6 +116,10 @@ typedef struct {
 
   UINT8                       PhyAddr;
   BOOLEAN                     LinkUp;
+
+  GENERIC_PHY_STATE           State;
+  EFI_EVENT                   PollEvent;
+  UINTN                       ResetRetry;
 } GENERIC_PHY_PRIVATE_DATA;
 
 EFI_STATUS
@@ -130,4 +140,10 @@ GenericPhyReset (
   IN GENERIC_PHY_PRIVATE_DATA *Phy
   );
 
+VOID
+EFIAPI
+GenericPhyStop (
+  IN GENERIC_PHY_PRIVATE_DATA *Phy
+  );
+
 #endif // GENERICPHY_H__
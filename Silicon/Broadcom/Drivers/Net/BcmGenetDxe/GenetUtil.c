@@ -7,6 +7,7 @@
 **/
 
 #include <Uefi.h>
+#include <Library/CacheMaintenanceLib.h>
 #include <Library/DebugLib.h>
 #include <Library/DmaLib.h>
 #include <Library/IoLib.h>
@@ -544,12 +545,14 @@ GenetDmaInitRings (
   Qid = GENET_DMA_DEFAULT_QUEUE;
 
   Genet->TxQueued = 0;
+  Genet->TxCompleted = 0;
   Genet->TxNext = 0;
   Genet->TxConsIndex = 0;
   Genet->TxProdIndex = 0;
 
   Genet->RxConsIndex = 0;
   Genet->RxProdIndex = 0;
+  Genet->RxPending = 0;
 
   // Configure TX queue
   GenetMmioWrite (Genet, GENET_TX_SCB_BURST_SIZE, 0x08);
@@ -624,64 +627,68 @@ GenetDmaAlloc (
 }
 
 /**
-  Given an RX buffer descriptor index, program the IO address of the buffer into the hardware.
+  Map the whole RX buffer area once and program the IO address of every
+  RX buffer into the hardware. The buffers stay mapped while the interface
+  is initialized, so no per-frame map/unmap is required.
 
   @param  Genet[in]      Pointer to GENET_PRIVATE_DATA.
-  @param  DescIndex[in]  Index of RX buffer descriptor.
 
-  @retval EFI_SUCCESS  DMA buffers allocated.
-  @retval Others       Programmatic errors, as buffers come from DmaAllocateBuffer, and thus
+  @retval EFI_SUCCESS  RX ring mapped.
+  @retval Others       Programmatic errors, as the RX area is page aligned, and thus
                        cannot fail DmaMap (for the expected NonCoherentDmaLib).
 **/
 EFI_STATUS
-GenetDmaMapRxDescriptor (
-  IN GENET_PRIVATE_DATA * Genet,
-  IN UINT8                DescIndex
+GenetDmaMapRxRing (
+  IN GENET_PRIVATE_DATA * Genet
   )
 {
-  EFI_STATUS    Status;
-  UINTN         DmaNumberOfBytes;
+  EFI_STATUS              Status;
+  UINTN                   DmaNumberOfBytes;
+  UINTN                   Idx;
+  EFI_PHYSICAL_ADDRESS    PhysAddr;
 
-  ASSERT (Genet->RxBufferMap[DescIndex].Mapping == NULL);
+  ASSERT (Genet->RxBufferMap.Mapping == NULL);
   ASSERT (Genet->RxBuffer != 0);
 
-  DmaNumberOfBytes = GENET_MAX_PACKET_SIZE;
+  DmaNumberOfBytes = GENET_MAX_PACKET_SIZE * GENET_DMA_DESC_COUNT;
   Status = DmaMap (MapOperationBusMasterWrite,
-             GENET_RX_BUFFER (Genet, DescIndex),
+             GENET_RX_BUFFER (Genet, 0),
              &DmaNumberOfBytes,
-             &Genet->RxBufferMap[DescIndex].PhysAddress,
-             &Genet->RxBufferMap[DescIndex].Mapping);
+             &Genet->RxBufferMap.PhysAddress,
+             &Genet->RxBufferMap.Mapping);
   if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_ERROR, "%a: Failed to map RX buffer: %r\n",
+    DEBUG ((DEBUG_ERROR, "%a: Failed to map RX buffers: %r\n",
       __FUNCTION__, Status));
     return Status;
   }
+  ASSERT (DmaNumberOfBytes == GENET_MAX_PACKET_SIZE * GENET_DMA_DESC_COUNT);
 
-  GenetMmioWrite (Genet, GENET_RX_DESC_ADDRESS_LO (DescIndex),
-    Genet->RxBufferMap[DescIndex].PhysAddress & 0xFFFFFFFF);
-  GenetMmioWrite (Genet, GENET_RX_DESC_ADDRESS_HI (DescIndex),
-    (Genet->RxBufferMap[DescIndex].PhysAddress >> 32) & 0xFFFFFFFF);
-  GenetMmioWrite (Genet, GENET_RX_DESC_STATUS (DescIndex), 0);
+  for (Idx = 0; Idx < GENET_DMA_DESC_COUNT; Idx++) {
+    PhysAddr = Genet->RxBufferMap.PhysAddress + GENET_MAX_PACKET_SIZE * Idx;
+    GenetMmioWrite (Genet, GENET_RX_DESC_ADDRESS_LO (Idx),
+      PhysAddr & 0xFFFFFFFF);
+    GenetMmioWrite (Genet, GENET_RX_DESC_ADDRESS_HI (Idx),
+      (PhysAddr >> 32) & 0xFFFFFFFF);
+    GenetMmioWrite (Genet, GENET_RX_DESC_STATUS (Idx), 0);
+  }
 
   return EFI_SUCCESS;
 }
 
 /**
-  Given an RX buffer descriptor index, undo the DmaMap operation on the buffer.
+  Undo the DmaMap operation on the RX buffer area.
 
   @param  Genet[in]      Pointer to GENET_PRIVATE_DATA.
-  @param  DescIndex[in]  Index of RX buffer descriptor.
 
 **/
 VOID
-GenetDmaUnmapRxDescriptor (
-  IN GENET_PRIVATE_DATA * Genet,
-  IN UINT8                DescIndex
+GenetDmaUnmapRxRing (
+  IN GENET_PRIVATE_DATA * Genet
   )
 {
-  if (Genet->RxBufferMap[DescIndex].Mapping != NULL) {
-    DmaUnmap (Genet->RxBufferMap[DescIndex].Mapping);
-    Genet->RxBufferMap[DescIndex].Mapping = NULL;
+  if (Genet->RxBufferMap.Mapping != NULL) {
+    DmaUnmap (Genet->RxBufferMap.Mapping);
+    Genet->RxBufferMap.Mapping = NULL;
   }
 }
 
@@ -697,11 +704,7 @@ GenetDmaFree (
   IN GENET_PRIVATE_DATA *Genet
   )
 {
-  UINTN Idx;
-
-  for (Idx = 0; Idx < GENET_DMA_DESC_COUNT; Idx++) {
-    GenetDmaUnmapRxDescriptor (Genet, Idx);
-  }
+  GenetDmaUnmapRxRing (Genet);
   gBS->FreePages (Genet->RxBuffer,
          EFI_SIZE_TO_PAGES (GENET_MAX_PACKET_SIZE * GENET_DMA_DESC_COUNT));
 }
@@ -744,6 +747,10 @@ GenetDmaTriggerTx (
 /**
   Simulate a "TX interrupt", return the next (completed) TX buffer to recycle.
 
+  The hardware consumer index is only sampled once all previously reported
+  completions have been handed back, so draining a batch of completed frames
+  costs a single MMIO read.
+
   @param  Genet[in]   Pointer to GENET_PRIVATE_DATA.
   @param  TxBuf[out]  Location to store pointer to next TX buffer to recycle.
 
@@ -754,12 +761,14 @@ GenetTxIntr (
   OUT VOID               **TxBuf
   )
 {
-  UINT32 Total;
+  if (Genet->TxCompleted == 0 && Genet->TxQueued > 0) {
+    Genet->TxCompleted = MIN (GenetTxPending (Genet), Genet->TxQueued);
+  }
 
-  Total = GenetTxPending (Genet);
-  if (Genet->TxQueued > 0 && Total > 0) {
+  if (Genet->TxCompleted > 0) {
     DmaUnmap (Genet->TxBufferMap[Genet->TxNext]);
     *TxBuf = Genet->TxBuffer[Genet->TxNext];
+    Genet->TxCompleted--;
     Genet->TxQueued--;
     Genet->TxNext = (Genet->TxNext + 1) % GENET_DMA_DESC_COUNT;
     Genet->TxConsIndex = (Genet->TxConsIndex + 1) & 0xFFFF;
@@ -798,19 +807,34 @@ GenetTxPending (
   return (ConsIndex - Genet->TxConsIndex) & 0xFFFF;
 }
 
+/**
+  Retire the RX descriptor returned by GenetRxIntr. The descriptors of a batch
+  are handed back to the hardware with a single consumer index update, once
+  the whole batch has been consumed.
+
+  @param  Genet[in]         Pointer to GENET_PRIVATE_DATA.
+
+**/
 VOID
 GenetRxComplete (
   IN GENET_PRIVATE_DATA *Genet
   )
 {
+  ASSERT (Genet->RxPending > 0);
+
   Genet->RxConsIndex = (Genet->RxConsIndex + 1) & 0xFFFF;
-  GenetMmioWrite (Genet, GENET_RX_DMA_CONS_INDEX (GENET_DMA_DEFAULT_QUEUE),
-                  Genet->RxConsIndex);
+  Genet->RxPending--;
+  if (Genet->RxPending == 0) {
+    GenetMmioWrite (Genet, GENET_RX_DMA_CONS_INDEX (GENET_DMA_DEFAULT_QUEUE),
+                    Genet->RxConsIndex);
+  }
 }
 
 /**
   Simulate an "RX interrupt", returning the index of a completed RX buffer and
-  corresponding frame length.
+  corresponding frame length. All descriptors reported by GenetRxPending are
+  served as one batch before the hardware is polled again. The CPU view of the
+  returned frame is made coherent with the data written by the device.
 
   @param  Genet[in]         Pointer to GENET_PRIVATE_DATA.
   @param  DescIndex[out]    Location to store completed RX buffer index.
@@ -828,14 +852,18 @@ GenetRxIntr (
   )
 {
   EFI_STATUS    Status;
-  UINT32        Total;
   UINT32        DescStatus;
 
-  Total = GenetRxPending (Genet);
-  if (Total > 0) {
+  if (Genet->RxPending == 0) {
+    Genet->RxPending = GenetRxPending (Genet);
+  }
+
+  if (Genet->RxPending > 0) {
     *DescIndex = Genet->RxConsIndex % GENET_DMA_DESC_COUNT;
     DescStatus = GenetMmioRead (Genet, GENET_RX_DESC_STATUS (*DescIndex));
     *FrameLength = SHIFTOUT (DescStatus, GENET_RX_DESC_STATUS_BUFLEN);
+    InvalidateDataCacheRange (GENET_RX_BUFFER (Genet, *DescIndex),
+      MIN (*FrameLength, GENET_MAX_PACKET_SIZE));
     Status = EFI_SUCCESS;
   } else {
     Status = EFI_NOT_READY;
@@ -130,7 +130,6 @@ GenetSimpleNetworkInitialize (
 {
   GENET_PRIVATE_DATA  *Genet;
   EFI_STATUS          Status;
-  UINTN               Idx;
 
   if (This == NULL) {
     return EFI_INVALID_PARAMETER;
@@ -156,11 +155,9 @@ GenetSimpleNetworkInitialize (
   GenetDmaInitRings (Genet);
 
   // Map RX buffers
-  for (Idx = 0; Idx < GENET_DMA_DESC_COUNT; Idx++) {
-    Status = GenetDmaMapRxDescriptor (Genet, Idx);
-    if (EFI_ERROR (Status)) {
-      return Status;
-    }
+  Status = GenetDmaMapRxRing (Genet);
+  if (EFI_ERROR (Status)) {
+    return Status;
   }
 
   GenetEnableTxRx (Genet);
@@ -238,7 +235,6 @@ GenetSimpleNetworkShutdown (
   )
 {
   GENET_PRIVATE_DATA  *Genet;
-  UINTN               Idx;
 
   if (This == NULL) {
     return EFI_INVALID_PARAMETER;
@@ -254,9 +250,9 @@ GenetSimpleNetworkShutdown (
 
   GenetDisableTxRx (Genet);
 
-  for (Idx = 0; Idx < GENET_DMA_DESC_COUNT; Idx++) {
-    GenetDmaUnmapRxDescriptor (Genet, Idx);
-  }
+  GenericPhyStop (&Genet->Phy);
+
+  GenetDmaUnmapRxRing (Genet);
 
   Genet->SnpMode.State = EfiSimpleNetworkStarted;
 
@@ -510,10 +506,10 @@ GenetSimpleNetworkGetStatus (
 
   if (InterruptStatus != NULL) {
     *InterruptStatus = 0;
-    if (GenetRxPending (Genet) > 0) {
+    if (Genet->RxPending > 0 || GenetRxPending (Genet) > 0) {
       *InterruptStatus |= EFI_SIMPLE_NETWORK_RECEIVE_INTERRUPT;
     }
-    if (GenetTxPending (Genet) > 0) {
+    if (Genet->TxCompleted > 0 || GenetTxPending (Genet) > 0) {
       *InterruptStatus |= EFI_SIMPLE_NETWORK_TRANSMIT_INTERRUPT;
     }
   }
@@ -736,9 +732,7 @@ GenetSimpleNetworkReceive (
     return Status;
   }
 
-  ASSERT (Genet->RxBufferMap[DescIndex].Mapping != NULL);
-
-  GenetDmaUnmapRxDescriptor (Genet, DescIndex);
+  ASSERT (Genet->RxBufferMap.Mapping != NULL);
 
   Frame = GENET_RX_BUFFER (Genet, DescIndex);
 
@@ -779,11 +773,6 @@ GenetSimpleNetworkReceive (
   }
 
 out:
-  Status = GenetDmaMapRxDescriptor (Genet, DescIndex);
-  if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_ERROR, "%a: Failed to remap RX descriptor!\n", __FUNCTION__));
-  }
-
   GenetRxComplete (Genet);
 
   EfiReleaseLock (&Genet->Lock);
@@ -95,9 +95,10 @@ FlashBlockIoFlushBlocks (
     IN EFI_BLOCK_IO_PROTOCOL*  This
 )
 {
-    // No Flush required for the NOR Flash driver
-    // because cache operations are not permitted.
+    FLASH_INSTANCE*   Instance;
+
+    Instance = INSTANCE_FROM_BLKIO_THIS(This);
 
-    // Nothing to do so just return without error
-    return EFI_SUCCESS;
+    // Write back whatever the FVB cache is holding for this device
+    return FlashCacheFlush (Instance);
 }
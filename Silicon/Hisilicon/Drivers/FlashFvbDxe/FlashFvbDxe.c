@@ -11,7 +11,33 @@
 
 #include "FlashFvbDxe.h"
 STATIC EFI_EVENT mFlashFvbVirtualAddrChangeEvent;
+STATIC EFI_EVENT mFlashFvbExitBootServicesEvent;
 STATIC UINTN     mFlashNvStorageVariableBase;
+STATIC BOOLEAN   mFlashCacheDisabled;
+
+STATIC
+BOOLEAN
+FlashCacheEnabled (
+    IN FLASH_INSTANCE*     Instance
+);
+
+STATIC
+EFI_STATUS
+FlashCacheLoad (
+    IN FLASH_INSTANCE*     Instance,
+    IN UINTN               BlockAddress,
+    IN BOOLEAN             Erase
+);
+
+STATIC
+EFI_STATUS
+FlashCacheWrite (
+    IN FLASH_INSTANCE*     Instance,
+    IN UINTN               BlockAddress,
+    IN UINTN               Offset,
+    IN UINT8*              Buffer,
+    IN UINTN               NumBytes
+);
 
 
 //
@@ -548,6 +574,13 @@ FvbRead (
                                      );
     ReadAddress = StartAddress - Instance->DeviceBaseAddress + Offset;
 
+    // The cached copy is newer than the flash
+    if (Instance->CacheValid && (Instance->CacheAddress == StartAddress))
+    {
+        CopyMem (Buffer, Instance->CacheBuffer + Offset, *NumBytes);
+        return EFI_SUCCESS;
+    }
+
     Status = mFlash->Read(mFlash, (UINT32)ReadAddress, Buffer, *NumBytes);
     if (EFI_SUCCESS != Status)
     {
@@ -680,6 +713,11 @@ FvbWrite (
     BlockAddress = GET_BLOCK_ADDRESS (Instance->RegionBaseAddress, Lba, BlockSize);
     WriteAddress = BlockAddress - Instance->DeviceBaseAddress + Offset;
 
+    if (FlashCacheEnabled (Instance))
+    {
+        return FlashCacheWrite (Instance, BlockAddress, Offset, Buffer, *NumBytes);
+    }
+
     Status = mFlash->Write(mFlash, (UINT32)WriteAddress, (UINT8*)Buffer, *NumBytes);
     if (EFI_SUCCESS != Status)
     {
@@ -806,30 +844,38 @@ FvbEraseBlocks (
         // How many Lba blocks are we requested to erase?
         NumOfLba = VA_ARG (Args, UINT32);
 
-        // Go through each one and erase it
-        while (NumOfLba > 0)
+        // Get the physical address of the first Lba to erase
+        BlockAddress = GET_BLOCK_ADDRESS (
+                           Instance->RegionBaseAddress,
+                           Instance->StartLba + StartingLba,
+                           Instance->Media.BlockSize
+                       );
+
+        // Pending writes to a block about to be erased can be dropped
+        if (Instance->CacheValid &&
+            (Instance->CacheAddress >= BlockAddress) &&
+            (Instance->CacheAddress < BlockAddress + NumOfLba * Instance->Media.BlockSize))
         {
+            Instance->CacheValid = FALSE;
+            Instance->CacheErasePending = FALSE;
+        }
 
-            // Get the physical address of Lba to erase
-            BlockAddress = GET_BLOCK_ADDRESS (
-                               Instance->RegionBaseAddress,
-                               Instance->StartLba + StartingLba,
-                               Instance->Media.BlockSize
-                           );
-
-            // Erase it
-
-            Status = FlashUnlockAndEraseSingleBlock (Instance, BlockAddress);
-            if (EFI_ERROR(Status))
-            {
-                VA_END (Args);
-                Status = EFI_DEVICE_ERROR;
-                goto EXIT;
-            }
+        // A single block is erased in the cache, along with the writes that follow.
+        // A range goes to the flash as one erase.
+        if (FlashCacheEnabled (Instance) && (NumOfLba == 1))
+        {
+            Status = FlashCacheLoad (Instance, BlockAddress, TRUE);
+        }
+        else
+        {
+            Status = FlashUnlockAndEraseBlocks (Instance, BlockAddress, NumOfLba);
+        }
 
-            // Move to the next Lba
-            StartingLba++;
-            NumOfLba--;
+        if (EFI_ERROR(Status))
+        {
+            VA_END (Args);
+            Status = EFI_DEVICE_ERROR;
+            goto EXIT;
         }
     }
     while (TRUE);
@@ -934,6 +980,12 @@ FlashCreateInstance (
 
     CopyGuid (&Instance->DevicePath.Vendor.Guid, FlashGuid);
 
+    if (FeaturePcdGet (PcdFlashFvbWriteCache))
+    {
+        // Without a buffer the instance simply writes through
+        Instance->CacheBuffer = AllocatePool (BlockSize);
+    }
+
     if (SupportFvb)
     {
         Instance->SupportFvb = TRUE;
@@ -985,9 +1037,10 @@ FlashUnlockSingleBlockIfNecessary (
 
 
 EFI_STATUS
-FlashEraseSingleBlock (
+FlashEraseBlocks (
     IN FLASH_INSTANCE*           Instance,
-    IN UINTN                  BlockAddress
+    IN UINTN                  BlockAddress,
+    IN UINTN                  NumBlocks
 )
 {
     EFI_STATUS            Status;
@@ -996,7 +1049,7 @@ FlashEraseSingleBlock (
     Status = EFI_SUCCESS;
     EraseAddress = BlockAddress - Instance->DeviceBaseAddress;
 
-    Status = mFlash->Erase(mFlash, (UINT32)EraseAddress, Instance->Media.BlockSize);
+    Status = mFlash->Erase(mFlash, (UINT32)EraseAddress, (UINT32)(Instance->Media.BlockSize * NumBlocks));
     if (EFI_SUCCESS != Status)
     {
         DEBUG((EFI_D_ERROR, "%s - %d Status=%r\n", __FILE__, __LINE__, Status));
@@ -1007,12 +1060,13 @@ FlashEraseSingleBlock (
 }
 
 /**
- * The following function presumes that the block has already been unlocked.
+ * The following function presumes that the blocks have already been unlocked.
  **/
 EFI_STATUS
-FlashUnlockAndEraseSingleBlock (
+FlashUnlockAndEraseBlocks (
     IN FLASH_INSTANCE*     Instance,
-    IN UINTN                  BlockAddress
+    IN UINTN                  BlockAddress,
+    IN UINTN                  NumBlocks
 )
 {
     EFI_STATUS      Status;
@@ -1026,7 +1080,7 @@ FlashUnlockAndEraseSingleBlock (
         Status = FlashUnlockSingleBlockIfNecessary (Instance, BlockAddress);
         if (!EFI_ERROR(Status))
         {
-            Status = FlashEraseSingleBlock (Instance, BlockAddress);
+            Status = FlashEraseBlocks (Instance, BlockAddress, NumBlocks);
         }
         Index++;
     }
@@ -1034,12 +1088,169 @@ FlashUnlockAndEraseSingleBlock (
 
     if (Index == FLASH_ERASE_RETRY)
     {
-        DEBUG((EFI_D_ERROR, "EraseSingleBlock(BlockAddress=0x%08x: Block Locked Error (try to erase %d times)\n", BlockAddress, Index));
+        DEBUG((EFI_D_ERROR, "EraseBlocks(BlockAddress=0x%08x: Block Locked Error (try to erase %d times)\n", BlockAddress, Index));
     }
 
     return Status;
 }
 
+EFI_STATUS
+FlashUnlockAndEraseSingleBlock (
+    IN FLASH_INSTANCE*     Instance,
+    IN UINTN                  BlockAddress
+)
+{
+    return FlashUnlockAndEraseBlocks (Instance, BlockAddress, 1);
+}
+
+/**
+ * Write-back cache of one block.
+ *
+ * FvbEraseBlocks() and FvbWrite() on a single block are applied to the cached
+ * copy, so an erase followed by many small writes (variable reclaim, FTW) costs
+ * one erase and one program of the dirty range. The block is written back when
+ * another block is touched, on FlushBlocks() and at ExitBootServices; at runtime
+ * everything goes straight to the flash. Readers that go through FVB or BlockIo
+ * see the cached data, direct memory mapped reads do not.
+ **/
+STATIC
+BOOLEAN
+FlashCacheEnabled (
+    IN FLASH_INSTANCE*     Instance
+)
+{
+    return (Instance->CacheBuffer != NULL) && !mFlashCacheDisabled;
+}
+
+EFI_STATUS
+FlashCacheFlush (
+    IN FLASH_INSTANCE*     Instance
+)
+{
+    EFI_STATUS      Status;
+    UINTN           WriteAddress;
+
+    if (!Instance->CacheValid)
+    {
+        return EFI_SUCCESS;
+    }
+
+    if (Instance->CacheErasePending)
+    {
+        Status = FlashUnlockAndEraseSingleBlock (Instance, Instance->CacheAddress);
+        if (EFI_ERROR(Status))
+        {
+            return Status;
+        }
+        Instance->CacheErasePending = FALSE;
+    }
+
+    if (Instance->CacheDirtyEnd > Instance->CacheDirtyStart)
+    {
+        WriteAddress = Instance->CacheAddress - Instance->DeviceBaseAddress + Instance->CacheDirtyStart;
+        Status = mFlash->Write(mFlash, (UINT32)WriteAddress,
+                               Instance->CacheBuffer + Instance->CacheDirtyStart,
+                               (UINT32)(Instance->CacheDirtyEnd - Instance->CacheDirtyStart));
+        if (EFI_SUCCESS != Status)
+        {
+            DEBUG((EFI_D_ERROR, "%s - %d Status=%r\n", __FILE__, __LINE__, Status));
+            return Status;
+        }
+    }
+
+    Instance->CacheValid = FALSE;
+    Instance->CacheDirtyStart = 0;
+    Instance->CacheDirtyEnd = 0;
+
+    return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+FlashCacheLoad (
+    IN FLASH_INSTANCE*     Instance,
+    IN UINTN               BlockAddress,
+    IN BOOLEAN             Erase
+)
+{
+    EFI_STATUS      Status;
+
+    if (!Instance->CacheValid || (Instance->CacheAddress != BlockAddress))
+    {
+        Status = FlashCacheFlush (Instance);
+        if (EFI_ERROR(Status))
+        {
+            return Status;
+        }
+
+        if (!Erase)
+        {
+            Status = mFlash->Read(mFlash, (UINT32)(BlockAddress - Instance->DeviceBaseAddress),
+                                  Instance->CacheBuffer, (UINT32)Instance->Media.BlockSize);
+            if (EFI_SUCCESS != Status)
+            {
+                DEBUG((EFI_D_ERROR, "%s - %d Status=%r\n", __FILE__, __LINE__, Status));
+                return Status;
+            }
+        }
+
+        Instance->CacheAddress = BlockAddress;
+        Instance->CacheValid = TRUE;
+        Instance->CacheErasePending = FALSE;
+        Instance->CacheDirtyStart = 0;
+        Instance->CacheDirtyEnd = 0;
+    }
+
+    if (Erase)
+    {
+        SetMem (Instance->CacheBuffer, Instance->Media.BlockSize, 0xFF);
+        Instance->CacheErasePending = TRUE;
+        Instance->CacheDirtyStart = 0;
+        Instance->CacheDirtyEnd = 0;
+    }
+
+    return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+FlashCacheWrite (
+    IN FLASH_INSTANCE*     Instance,
+    IN UINTN               BlockAddress,
+    IN UINTN               Offset,
+    IN UINT8*              Buffer,
+    IN UINTN               NumBytes
+)
+{
+    EFI_STATUS      Status;
+    UINTN           Index;
+
+    Status = FlashCacheLoad (Instance, BlockAddress, FALSE);
+    if (EFI_ERROR(Status))
+    {
+        return Status;
+    }
+
+    // Programming can only clear bits, keep the copy the way the flash would be
+    for (Index = 0; Index < NumBytes; Index++)
+    {
+        Instance->CacheBuffer[Offset + Index] &= Buffer[Index];
+    }
+
+    if (Instance->CacheDirtyEnd == Instance->CacheDirtyStart)
+    {
+        Instance->CacheDirtyStart = Offset;
+        Instance->CacheDirtyEnd = Offset + NumBytes;
+    }
+    else
+    {
+        Instance->CacheDirtyStart = MIN (Instance->CacheDirtyStart, Offset);
+        Instance->CacheDirtyEnd = MAX (Instance->CacheDirtyEnd, Offset + NumBytes);
+    }
+
+    return EFI_SUCCESS;
+}
+
 EFI_STATUS
 FlashWriteBlocks (
     IN FLASH_INSTANCE*        Instance,
@@ -1088,6 +1299,18 @@ FlashWriteBlocks (
 
     WriteAddress = BlockAddress - Instance->DeviceBaseAddress;
 
+    // Keep the order of writes, the cached block goes out first
+    if (Instance->CacheValid &&
+        (Instance->CacheAddress >= BlockAddress) &&
+        (Instance->CacheAddress < BlockAddress + BufferSizeInBytes))
+    {
+        Status = FlashCacheFlush (Instance);
+        if (EFI_ERROR(Status))
+        {
+            return Status;
+        }
+    }
+
     Status = mFlash->Write(mFlash, (UINT32)WriteAddress, (UINT8*)Buffer, BufferSizeInBytes);
     if (EFI_SUCCESS != Status)
     {
@@ -1153,6 +1376,15 @@ FlashReadBlocks (
         return Status;
     }
 
+    // The cached copy is newer than the flash
+    if (Instance->CacheValid &&
+        (Instance->CacheAddress >= StartAddress) &&
+        (Instance->CacheAddress < StartAddress + BufferSizeInBytes))
+    {
+        CopyMem ((UINT8*)Buffer + (Instance->CacheAddress - StartAddress),
+                 Instance->CacheBuffer, Instance->Media.BlockSize);
+    }
+
     return EFI_SUCCESS;
 }
 
@@ -1168,6 +1400,28 @@ FlashFvbVirtualNotifyEvent (
   return;
 }
 
+VOID
+EFIAPI
+FlashFvbExitBootServicesEvent (
+  IN EFI_EVENT        Event,
+  IN VOID             *Context
+  )
+{
+  UINT32      Index;
+
+  for (Index = 0; Index < FLASH_DEVICE_COUNT; Index++)
+  {
+    if (mFlashInstances[Index] != NULL)
+    {
+      (VOID)FlashCacheFlush (mFlashInstances[Index]);
+    }
+  }
+
+  // Write through from here on
+  mFlashCacheDisabled = TRUE;
+  return;
+}
+
 EFI_STATUS
 EFIAPI
 FlashFvbInitialize (
@@ -1189,7 +1443,7 @@ FlashFvbInitialize (
         return Status;
     }
 
-    mFlashInstances = AllocatePool ((UINT32)(sizeof(FLASH_INSTANCE*) * FlashDeviceCount));
+    mFlashInstances = AllocateZeroPool ((UINT32)(sizeof(FLASH_INSTANCE*) * FlashDeviceCount));
 
     Status = gBS->LocateProtocol (&gHisiSpiFlashProtocolGuid, NULL, (VOID*) &mFlash);
     if (EFI_ERROR(Status))
@@ -1233,5 +1487,18 @@ FlashFvbInitialize (
                   );
     ASSERT_EFI_ERROR (Status);
 
+    if (FeaturePcdGet (PcdFlashFvbWriteCache))
+    {
+        Status = gBS->CreateEventEx (
+                      EVT_NOTIFY_SIGNAL,
+                      TPL_NOTIFY,
+                      FlashFvbExitBootServicesEvent,
+                      NULL,
+                      &gEfiEventExitBootServicesGuid,
+                      &mFlashFvbExitBootServicesEvent
+                      );
+        ASSERT_EFI_ERROR (Status);
+    }
+
     return Status;
 }
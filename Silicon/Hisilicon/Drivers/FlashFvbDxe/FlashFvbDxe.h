@@ -87,6 +87,14 @@ struct _FLASH_INSTANCE
     EFI_FIRMWARE_VOLUME_BLOCK2_PROTOCOL FvbProtocol;
 
     FLASH_DEVICE_PATH                   DevicePath;
+
+    // Write-back cache of one block, see PcdFlashFvbWriteCache
+    UINT8*                              CacheBuffer;
+    BOOLEAN                             CacheValid;
+    BOOLEAN                             CacheErasePending;
+    UINTN                               CacheAddress;
+    UINTN                               CacheDirtyStart;
+    UINTN                               CacheDirtyEnd;
 };
 
 
@@ -203,6 +211,18 @@ FlashUnlockAndEraseSingleBlock (
     IN UINTN                   BlockAddress
 );
 
+EFI_STATUS
+FlashUnlockAndEraseBlocks (
+    IN FLASH_INSTANCE*         Instance,
+    IN UINTN                   BlockAddress,
+    IN UINTN                   NumBlocks
+);
+
+EFI_STATUS
+FlashCacheFlush (
+    IN FLASH_INSTANCE*         Instance
+);
+
 EFI_STATUS
 FlashWriteBlocks (
     IN  FLASH_INSTANCE*    Instance,
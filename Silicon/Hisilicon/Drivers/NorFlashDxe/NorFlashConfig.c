@@ -129,7 +129,9 @@ FLASH_COMMAND_WRITE gFlashCommandWrite[]=
        (0x02AA),
        (0x00550055),
        (0x00250025),
-       (0x00290029)
+       (0x00290029),
+       (0x0555),
+       (0x00A000A0)
     }
 
 };
@@ -15,6 +15,7 @@
 
 
 BOOLEAN  gFlashBusy = FALSE;
+BOOLEAN  gBufferProgram = TRUE;
 FLASH_INDEX gIndex = {
     0,
     0,
@@ -195,6 +196,65 @@ void GetManufacturerID(UINT32 Index, UINT32 Base, UINT8 *pbyData)
 }
 
 
+/*
+ * Read the write buffer size out of the CFI query table. *BufferSize is
+ * returned in device words, zero meaning the part has no write buffer.
+ */
+static EFI_STATUS GetCfiBufferProgramSize(UINT32 Index, UINT32 Base, UINT32 *BufferSize)
+{
+    UINT32 QueryString[3];
+    UINT32 TempData;
+    UINT32 BufferShift;
+    UINT32 i;
+
+    FlashReset(Base);
+
+    (VOID)PortWriteData(Index, Base + (CFI_QUERY_ADDRESS << gFlashInfo[Index].ParallelNum), CFI_QUERY_DATA);
+
+    for (i = 0; i < 3; i ++)
+    {
+        QueryString[i] = PortReadData(Index, Base + ((CFI_QUERY_STRING_OFFSET + i) << gFlashInfo[Index].ParallelNum));
+    }
+    TempData = PortReadData(Index, Base + (CFI_MAX_WRITE_BUFFER_OFFSET << gFlashInfo[Index].ParallelNum));
+
+    FlashReset(Base);    //must reset to return to the read mode
+
+    if ((PortAdjustData(Index, 0x00510051) != QueryString[0])
+        || (PortAdjustData(Index, 0x00520052) != QueryString[1])
+        || (PortAdjustData(Index, 0x00590059) != QueryString[2]))
+    {
+        DEBUG ((EFI_D_ERROR, "[%a]:[%dL]:No CFI query table!\n", __FUNCTION__,__LINE__));
+        return EFI_UNSUPPORTED;
+    }
+
+    //the field is log2 of the buffer size in bytes, take the smaller chip
+    BufferShift = TempData & 0xFF;
+    if ((2 == gFlashInfo[Index].ParallelNum) && (((TempData >> 16) & 0xFF) < BufferShift))
+    {
+        BufferShift = (TempData >> 16) & 0xFF;
+    }
+
+    if (BufferShift <= 1)
+    {
+        *BufferSize = 0;
+        return EFI_SUCCESS;
+    }
+
+    if (BufferShift > 16)
+    {
+        BufferShift = 16;
+    }
+
+    *BufferSize = 1U << (BufferShift - 1);
+    if (*BufferSize > FLASH_MAX_BUFFER_PROGRAM_SIZE)
+    {
+        *BufferSize = FLASH_MAX_BUFFER_PROGRAM_SIZE;
+    }
+
+    return EFI_SUCCESS;
+}
+
+
 EFI_STATUS FlashInit(UINT32 Base)
 {
     UINT32 FlashCount = 0;
@@ -206,6 +266,7 @@ EFI_STATUS FlashInit(UINT32 Base)
     UINT32 TempDev2 = 0;
     UINT32 TempDev3 = 0;
     UINT32 dwAddr;
+    UINT32 BufferSize;
 
     FlashCount = sizeof(gFlashInfo) / sizeof(NOR_FLASH_INFO_TABLE);
     for(;i < FlashCount; i ++ )
@@ -269,6 +330,21 @@ EFI_STATUS FlashInit(UINT32 Base)
         return EFI_DEVICE_ERROR;
     }
 
+    Status = GetCfiBufferProgramSize(gIndex.InfIndex, Base, &BufferSize);
+    if (!EFI_ERROR(Status))
+    {
+        if (0 == BufferSize)
+        {
+            gBufferProgram = FALSE;
+        }
+        else
+        {
+            gFlashInfo[gIndex.InfIndex].BufferProgramSize = BufferSize;
+        }
+    }
+    DEBUG ((EFI_D_INFO, "[%a]:[%dL]:Buffer program %a, 0x%x words\n", __FUNCTION__,__LINE__,
+            gBufferProgram ? "on" : "off", gFlashInfo[gIndex.InfIndex].BufferProgramSize));
+
     return EFI_SUCCESS;
 }
 
@@ -386,6 +462,55 @@ EFI_STATUS BufferWriteCommand(UINTN Base, UINTN Offset, void *pData)
 }
 
 
+EFI_STATUS WordWriteCommand(UINTN Base, UINTN Offset, UINT32 Data)
+{
+    UINT32 dwAddr;
+
+    if(gFlashBusy)
+    {
+        DEBUG((EFI_D_ERROR, "[%a]:[%dL]:Flash is busy!\n", __FUNCTION__,__LINE__));
+        return EFI_NOT_READY;
+    }
+    gFlashBusy = TRUE;
+
+    dwAddr = (UINT32)Base + (gFlashCommandWrite[gIndex.WIndex].BufferProgramAddressStep1 << gFlashInfo[gIndex.InfIndex].ParallelNum);
+    (VOID)PortWriteData(gIndex.InfIndex, dwAddr, gFlashCommandWrite[gIndex.WIndex].BufferProgramDataStep1);
+
+    dwAddr = (UINT32)Base + (gFlashCommandWrite[gIndex.WIndex].BufferProgramAddressStep2 << gFlashInfo[gIndex.InfIndex].ParallelNum);
+    (VOID)PortWriteData(gIndex.InfIndex, dwAddr, gFlashCommandWrite[gIndex.WIndex].BufferProgramDataStep2);
+
+    dwAddr = (UINT32)Base + (gFlashCommandWrite[gIndex.WIndex].WordProgramAddressStep3 << gFlashInfo[gIndex.InfIndex].ParallelNum);
+    (VOID)PortWriteData(gIndex.InfIndex, dwAddr, gFlashCommandWrite[gIndex.WIndex].WordProgramDataStep3);
+
+    dwAddr = (UINT32)Base + (UINT32)Offset;
+    (VOID)PortWriteData(gIndex.InfIndex, dwAddr, Data);
+
+    gFlashBusy = FALSE;
+    return EFI_SUCCESS;
+}
+
+
+/*
+ * Leave the write-to-buffer-abort state a failed buffer program may have
+ * left the chip in, a plain reset is not enough for that.
+ */
+VOID BufferWriteAbortReset(UINTN Base)
+{
+    UINT32 dwAddr;
+
+    dwAddr = (UINT32)Base + (gFlashCommandWrite[gIndex.WIndex].BufferProgramAddressStep1 << gFlashInfo[gIndex.InfIndex].ParallelNum);
+    (VOID)PortWriteData(gIndex.InfIndex, dwAddr, gFlashCommandWrite[gIndex.WIndex].BufferProgramDataStep1);
+
+    dwAddr = (UINT32)Base + (gFlashCommandWrite[gIndex.WIndex].BufferProgramAddressStep2 << gFlashInfo[gIndex.InfIndex].ParallelNum);
+    (VOID)PortWriteData(gIndex.InfIndex, dwAddr, gFlashCommandWrite[gIndex.WIndex].BufferProgramDataStep2);
+
+    dwAddr = (UINT32)Base + (gFlashCommandWrite[gIndex.WIndex].BufferProgramAddressStep1 << gFlashInfo[gIndex.InfIndex].ParallelNum);
+    (VOID)PortWriteData(gIndex.InfIndex, dwAddr, gFlashCommandReset[gIndex.ReIndex].ResetData);
+
+    FlashReset((UINT32)Base);
+}
+
+
 EFI_STATUS SectorEraseCommand(UINTN Base, UINTN Offset)
 {
     UINT32 dwAddr;
@@ -533,6 +658,47 @@ EFI_STATUS IsNeedToWrite(
 }
 
 
+/*
+ * Program one port word at a time, skipping words that already hold the
+ * data. Used when the part has no write buffer or buffer programming fails.
+ */
+EFI_STATUS WordWrite(UINT32 Offset, void *pData, UINT32 Length)
+{
+    EFI_STATUS Status;
+    UINT32 dwLoop;
+    UINT32 UnitSize;
+    UINT8 *pUnit;
+    UINT32 Data;
+
+    UnitSize = (2 == gFlashInfo[gIndex.InfIndex].ParallelNum) ? sizeof(UINT32) : sizeof(UINT16);
+
+    for (dwLoop = 0; dwLoop < Length; dwLoop += UnitSize)
+    {
+        pUnit = (UINT8 *)pData + dwLoop;
+        if (FALSE == IsNeedToWrite(gIndex.Base, Offset + dwLoop, pUnit, UnitSize))
+        {
+            continue;
+        }
+
+        Data = (sizeof(UINT32) == UnitSize) ? *(UINT32 *)pUnit : *(UINT16 *)pUnit;
+        Status = WordWriteCommand(gIndex.Base, Offset + dwLoop, Data);
+        if (EFI_ERROR(Status))
+        {
+            return Status;
+        }
+
+        Status = CompleteCheck(gIndex.Base, Offset + dwLoop, (void *)pUnit, UnitSize);
+        if (EFI_ERROR(Status))
+        {
+            DEBUG((EFI_D_ERROR, "WordWrite ERROR: address %x, %r\n", Offset + dwLoop, Status));
+            return Status;
+        }
+    }
+
+    return EFI_SUCCESS;
+}
+
+
 EFI_STATUS BufferWrite(UINT32 Offset, void *pData, UINT32 Length)
 {
     EFI_STATUS Status;
@@ -544,6 +710,11 @@ EFI_STATUS BufferWrite(UINT32 Offset, void *pData, UINT32 Length)
         return EFI_SUCCESS;
     }
 
+    if (!gBufferProgram)
+    {
+        return WordWrite(Offset, pData, Length);
+    }
+
     do
     {
         (void)BufferWriteCommand(gIndex.Base, Offset, pData);
@@ -569,6 +740,13 @@ EFI_STATUS BufferWrite(UINT32 Offset, void *pData, UINT32 Length)
         }
     } while ((Retry--) && EFI_ERROR(Status));
 
+    if (EFI_ERROR(Status))
+    {
+        DEBUG((EFI_D_ERROR, "Flash_WriteUnit: buffer program failed at %x, falling back to word program\n", Offset));
+        BufferWriteAbortReset(gIndex.Base);
+        Status = WordWrite(Offset, pData, Length);
+    }
+
     return Status;
 }
 
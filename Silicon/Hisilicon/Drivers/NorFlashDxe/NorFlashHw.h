@@ -18,6 +18,15 @@
 
 #define FLASH_DEVICE_NUM  0x10
 
+/*CFI query, offsets are in device words*/
+#define CFI_QUERY_ADDRESS             0x55
+#define CFI_QUERY_DATA                0x00980098
+#define CFI_QUERY_STRING_OFFSET       0x10
+#define CFI_MAX_WRITE_BUFFER_OFFSET   0x2A
+
+/*largest write buffer used, in device words (512 bytes per chip)*/
+#define FLASH_MAX_BUFFER_PROGRAM_SIZE 0x100
+
 
 
 typedef struct {
@@ -64,6 +73,8 @@ typedef struct {
     UINT32 BufferProgramDataStep2;
     UINT32 BufferProgramDataStep3;
     UINT32 BufferProgramtoFlash;
+    UINT32 WordProgramAddressStep3;
+    UINT32 WordProgramDataStep3;
 }FLASH_COMMAND_WRITE;
 
 /*erase*/
@@ -126,7 +126,7 @@
 #define QUEUE_SLOTS                     256
 #define SLOT_ENTRIES                    8192
 #define PHY_CNT                         8
-#define MAX_ITCT_ENTRIES                1
+#define MAX_ITCT_ENTRIES                PHY_CNT
 
 // Completion header
 #define CMPLT_HDR_IPTT_OFF              0
@@ -183,7 +183,9 @@
 #define SGE_LIMIT 0x10000
 #define upper_32_bits(n) ((UINT32)(((n) >> 16) >> 16))
 #define lower_32_bits(n) ((UINT32)(n))
-#define MAX_TARGET_ID 4
+
+// ITCT qw0
+#define ITCT_HDR_PORT_ID_OFF        13
 
 // Generic HW DMA host memory structures
 struct hisi_sas_cmd_hdr {
@@ -257,6 +259,17 @@ UINT32 status[260];
 
 struct hisi_sas_slot {
     BOOLEAN used;
+    BOOLEAN done;
+    EFI_STATUS status;
+    EFI_EXT_SCSI_PASS_THRU_SCSI_REQUEST_PACKET *Packet;
+    EFI_EVENT Event;    // NULL for blocking requests
+    VOID *BufferMap;
+    struct hisi_sas_sts *sts;
+};
+
+struct hisi_sas_target {
+    UINT32 phy_id;
+    UINT32 port_id;
 };
 
 struct hisi_hba {
@@ -271,11 +284,15 @@ struct hisi_hba {
     struct hisi_sas_slot         *slots;
     UINT32 base;
     int queue;
-    int port_id;
-    UINT32 LatestTargetId;
-    UINT64 LatestLun;
+    // One target per port with a phy up, the index is the ITCT device id
+    struct hisi_sas_target targets[MAX_ITCT_ENTRIES];
+    UINT32 target_cnt;
+    UINT32 async_cnt;
 };
 
+// Period of the timer completing non-blocking requests (in 100ns units)
+#define SAS_ASYNC_POLL_INTERVAL   10000
+
 #pragma pack (1)
 typedef struct {
   VENDOR_DEVICE_PATH                  Vendor;
@@ -296,9 +313,13 @@ typedef struct {
 #define SAS_DEVICE_SIGNATURE SIGNATURE_32 ('S','A','S','0')
 #define SAS_FROM_PASS_THRU(a) CR (a, SAS_V1_INFO, ExtScsiPassThru, SAS_DEVICE_SIGNATURE)
 
+// Must be called at TPL_NOTIFY, the slots are shared with the completion timer
 STATIC EFI_STATUS prepare_cmd (
   struct hisi_hba *hba,
-  EFI_EXT_SCSI_PASS_THRU_SCSI_REQUEST_PACKET    *Packet
+  UINT32                                        target,
+  EFI_EXT_SCSI_PASS_THRU_SCSI_REQUEST_PACKET    *Packet,
+  EFI_EVENT                                     Event,
+  UINT32                                        *slot_out
   )
 {
   struct hisi_sas_slot *slot;
@@ -312,7 +333,6 @@ STATIC EFI_STATUS prepare_cmd (
   int queue = hba->queue;
   UINT32 r, w = 0, slot_idx = 0;
   UINT32 base = hba->base;
-  UINT8 *p;
   EFI_PHYSICAL_ADDRESS  BufferAddress;
   EFI_STATUS            Status = EFI_SUCCESS;
   VOID                  *BufferMap = NULL;
@@ -350,11 +370,11 @@ STATIC EFI_STATUS prepare_cmd (
   // Only consider ssp
   hdr->dw0 = (1 << CMD_HDR_RESP_REPORT_OFF) |
        (0x2 << CMD_HDR_TLR_CTRL_OFF) |
-       (hba->port_id << CMD_HDR_PORT_OFF) |
+       (hba->targets[target].port_id << CMD_HDR_PORT_OFF) |
        (1 << CMD_HDR_MODE_OFF) |
        (1 << CMD_HDR_CMD_OFF);
   hdr->dw1 = 1 << CMD_HDR_VERIFY_DTL_OFF;
-  hdr->dw1 |= 0 << CMD_HDR_DEVICE_ID_OFF;
+  hdr->dw1 |= target << CMD_HDR_DEVICE_ID_OFF;
   hdr->dw2 = 0x83000d;
   hdr->transfer_tags = slot_idx << CMD_HDR_IPTT_OFF;
 
@@ -388,6 +408,7 @@ STATIC EFI_STATUS prepare_cmd (
 
     Status = DmaMap (DmaOperation, Buffer, &BufferSize, &BufferAddress, &BufferMap);
     if (EFI_ERROR (Status)) {
+      slot->used = FALSE;
       return Status;
     }
     remain = len = BufferSize;
@@ -410,58 +431,126 @@ STATIC EFI_STATUS prepare_cmd (
     hdr->sg_len = i << CMD_HDR_DATA_SGL_LEN_OFF;
   }
 
+  slot->done = FALSE;
+  slot->status = EFI_SUCCESS;
+  slot->Packet = Packet;
+  slot->Event = Event;
+  slot->BufferMap = BufferMap;
+  slot->sts = sts;
+  *slot_out = slot_idx;
+
   // Ensure descriptor effective before start dma
   MemoryFence();
 
   // Start dma
   WRITE_REG32(base, DLVRY_Q_0_WR_PTR + queue * 0x14, ++w % QUEUE_SLOTS);
 
-  // Wait for dma complete
-  while (slot->used) {
-    if (READ_REG32(base, OQ_INT_SRC) & BIT(queue)) {
-      struct hisi_sas_complete_hdr *complete_hdr;
-      UINT32 data, rd;
-      rd = READ_REG32(base, COMPL_Q_0_RD_PTR + (0x14 * queue));
-
-      complete_hdr = &hba->complete_hdr[queue][rd];
-      data = complete_hdr->data;
-
-      // Check whether dma transfer error
-      if ((data & CMPLT_HDR_ERR_RCRD_XFRD_MSK) &&
-        !(data & CMPLT_HDR_RSPNS_XFRD_MSK)) {
-        DEBUG ((EFI_D_VERBOSE, "sas retry data=0x%x\n", data));
-        DEBUG ((EFI_D_VERBOSE, "sts[0]=0x%x\n", sts->status[0]));
-        DEBUG ((EFI_D_VERBOSE, "sts[1]=0x%x\n", sts->status[1]));
-        DEBUG ((EFI_D_VERBOSE, "sts[2]=0x%x\n", sts->status[2]));
-        Status = EFI_NOT_READY;
-        // wait 1 second and retry, some disk need long time to be ready
-        // and ScsiDisk treat retry over 3 times as error
-        MicroSecondDelay(1000000);
-      }
-       // Update read point
-       WRITE_REG32(base, COMPL_Q_0_RD_PTR + (0x14 * queue), w);
-       // Clear int
-       WRITE_REG32(base, OQ_INT_SRC, BIT(queue));
-       slot->used = FALSE;
-       break;
-    }
-    // Wait for status change in polling
-    NanoSecondDelay (100);
+  return Status;
+}
+
+// Must be called at TPL_NOTIFY
+STATIC VOID slot_complete (
+  struct hisi_hba *hba,
+  UINT32 slot_idx,
+  UINT32 data
+  )
+{
+  struct hisi_sas_slot *slot = &hba->slots[slot_idx];
+  struct hisi_sas_sts *sts = slot->sts;
+  EFI_EXT_SCSI_PASS_THRU_SCSI_REQUEST_PACKET *Packet = slot->Packet;
+  EFI_SCSI_SENSE_DATA *SensePtr = Packet->SenseData;
+  UINT8 *p;
+
+  // Check whether dma transfer error
+  if ((data & CMPLT_HDR_ERR_RCRD_XFRD_MSK) &&
+    !(data & CMPLT_HDR_RSPNS_XFRD_MSK)) {
+    DEBUG ((EFI_D_VERBOSE, "sas retry data=0x%x\n", data));
+    DEBUG ((EFI_D_VERBOSE, "sts[0]=0x%x\n", sts->status[0]));
+    DEBUG ((EFI_D_VERBOSE, "sts[1]=0x%x\n", sts->status[1]));
+    DEBUG ((EFI_D_VERBOSE, "sts[2]=0x%x\n", sts->status[2]));
+    slot->status = EFI_NOT_READY;
   }
 
-  if (BufferMap)
-       DmaUnmap (BufferMap);
+  if (slot->BufferMap) {
+    DmaUnmap (slot->BufferMap);
+    slot->BufferMap = NULL;
+  }
 
   p = (UINT8 *)&sts->status[0];
-  if (p[SENSE_DATA_PRES]) {
+  if (p[SENSE_DATA_PRES] && SensePtr) {
     // Disk not ready normal return for ScsiDiskTestUnitReady do next try
     SensePtr->Sense_Key = EFI_SCSI_SK_NOT_READY;
     SensePtr->Addnl_Sense_Code = EFI_SCSI_ASC_NOT_READY;
     SensePtr->Addnl_Sense_Code_Qualifier = EFI_SCSI_ASCQ_IN_PROGRESS;
-    // wait 1 second for disk spin up, refer drivers/scsi/sd.c
-    MicroSecondDelay(1000000);
   }
-  return Status;
+
+  slot->done = TRUE;
+
+  if (slot->Event != NULL) {
+    // Non-blocking requests only report their status through the packet
+    if (EFI_ERROR (slot->status)) {
+      Packet->HostAdapterStatus = EFI_EXT_SCSI_STATUS_HOST_ADAPTER_OTHER;
+    }
+    slot->used = FALSE;
+    hba->async_cnt--;
+    gBS->SignalEvent (slot->Event);
+  }
+}
+
+// Retire the completed requests of every queue. Must be called at TPL_NOTIFY.
+STATIC VOID poll_cq (struct hisi_hba *hba)
+{
+  UINT32 base = hba->base;
+  UINT32 src, rd, wr, data;
+  int queue;
+
+  src = READ_REG32(base, OQ_INT_SRC);
+  if (src == 0)
+    return;
+
+  for (queue = 0; queue < QUEUE_CNT; queue++) {
+    if (!(src & BIT(queue)))
+      continue;
+
+    // Clear int before draining so that a late completion raises it again
+    WRITE_REG32(base, OQ_INT_SRC, BIT(queue));
+
+    rd = READ_REG32(base, COMPL_Q_0_RD_PTR + (0x14 * queue));
+    wr = READ_REG32(base, COMPL_Q_0_WR_PTR + (0x14 * queue));
+    while (rd != wr) {
+      struct hisi_sas_slot *slot;
+      UINT32 slot_idx;
+
+      data = hba->complete_hdr[queue][rd].data;
+      slot_idx = (data & CMPLT_HDR_IPTT_MSK) >> CMPLT_HDR_IPTT_OFF;
+      if (slot_idx < SLOT_ENTRIES) {
+        slot = &hba->slots[slot_idx];
+        if (slot->used && !slot->done) {
+          slot_complete(hba, slot_idx, data);
+        }
+      }
+      rd = (rd + 1) % QUEUE_SLOTS;
+    }
+    // Update read point
+    WRITE_REG32(base, COMPL_Q_0_RD_PTR + (0x14 * queue), rd);
+  }
+}
+
+STATIC
+VOID
+EFIAPI
+SasV1PollTimer (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  SAS_V1_INFO *SasV1Info = Context;
+
+  poll_cq(SasV1Info->hba);
+
+  if (SasV1Info->hba->async_cnt == 0) {
+    gBS->SetTimer (SasV1Info->TimerEvent, TimerCancel, 0);
+  }
 }
 
 STATIC VOID hisi_sas_v1_init(struct hisi_hba *hba, PLATFORM_SAS_PROTOCOL *plat)
@@ -671,53 +760,130 @@ SasV1ExtScsiPassThruFunction (
 {
   SAS_V1_INFO *SasV1Info = SAS_FROM_PASS_THRU(This);
   struct hisi_hba *hba = SasV1Info->hba;
+  struct hisi_sas_slot *slot;
+  EFI_SCSI_SENSE_DATA *SensePtr;
+  EFI_STATUS Status;
+  EFI_TPL OldTpl;
+  UINT32 slot_idx;
+  BOOLEAN done;
+  UINT8 *p;
+
+  if (Target == NULL || Target[0] >= hba->target_cnt || Lun != 0) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+  Status = prepare_cmd(hba, Target[0], Packet, Event, &slot_idx);
+  if (EFI_ERROR (Status)) {
+    gBS->RestoreTPL (OldTpl);
+    return Status;
+  }
+
+  if (Event != NULL) {
+    // The completion timer signals Event, several requests may be in flight
+    if (hba->async_cnt++ == 0) {
+      gBS->SetTimer (SasV1Info->TimerEvent, TimerPeriodic, SAS_ASYNC_POLL_INTERVAL);
+    }
+    gBS->RestoreTPL (OldTpl);
+    return EFI_SUCCESS;
+  }
+  gBS->RestoreTPL (OldTpl);
+
+  // Wait for dma complete, completions of other requests are retired meanwhile
+  slot = &hba->slots[slot_idx];
+  do {
+    OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+    poll_cq(hba);
+    done = slot->done;
+    gBS->RestoreTPL (OldTpl);
+    if (!done) {
+      // Wait for status change in polling
+      NanoSecondDelay (100);
+    }
+  } while (!done);
+
+  Status = slot->status;
+  if (Status == EFI_NOT_READY) {
+    // wait 1 second and retry, some disk need long time to be ready
+    // and ScsiDisk treat retry over 3 times as error
+    MicroSecondDelay(1000000);
+  }
 
-  return prepare_cmd(hba, Packet);
+  SensePtr = Packet->SenseData;
+  p = (UINT8 *)&slot->sts->status[0];
+  if (p[SENSE_DATA_PRES] && SensePtr) {
+    // wait 1 second for disk spin up, refer drivers/scsi/sd.c
+    MicroSecondDelay(1000000);
+  }
+
+  OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+  slot->used = FALSE;
+  gBS->RestoreTPL (OldTpl);
+
+  return Status;
 }
 
+// Walk the target table built when the driver started
 STATIC
 EFI_STATUS
 EFIAPI
-SasV1ExtScsiPassThruGetNextTargetLun (
+SasV1ExtScsiPassThruGetNextTarget (
   IN  EFI_EXT_SCSI_PASS_THRU_PROTOCOL    *This,
-  IN OUT UINT8                           **Target,
-  IN OUT UINT64                          *Lun
+  IN OUT UINT8                           **Target
   )
 {
   SAS_V1_INFO *SasV1Info = SAS_FROM_PASS_THRU(This);
   struct hisi_hba *hba = SasV1Info->hba;
   UINT8 ScsiId[TARGET_MAX_BYTES];
-  UINT8 TargetId;
+  UINT32 TargetId;
 
-  if (*Target == NULL || Lun == NULL) {
+  if (Target == NULL || *Target == NULL) {
     return EFI_INVALID_PARAMETER;
   }
 
   SetMem (ScsiId, TARGET_MAX_BYTES, 0xFF);
 
-  TargetId = (*Target)[0];
-
-  if (TargetId == MAX_TARGET_ID) {
-    return EFI_NOT_FOUND;
-  }
-
   if (CompareMem(*Target, ScsiId, TARGET_MAX_BYTES) == 0) {
-    SetMem (*Target, TARGET_MAX_BYTES,0);
+    TargetId = 0;
+  } else if ((*Target)[0] < hba->target_cnt) {
+    TargetId = (*Target)[0] + 1;
   } else {
-    (*Target)[0] = (UINT8) (hba->LatestTargetId + 1);
+    return EFI_INVALID_PARAMETER;
   }
 
-  *Lun = 0;
+  if (TargetId >= hba->target_cnt) {
+    return EFI_NOT_FOUND;
+  }
 
-  //
-  // Update the LatestTargetId.
-  //
-  hba->LatestTargetId  = (*Target)[0];
-  hba->LatestLun       = *Lun;
+  SetMem (*Target, TARGET_MAX_BYTES, 0);
+  (*Target)[0] = (UINT8) TargetId;
 
   return EFI_SUCCESS;
 }
 
+STATIC
+EFI_STATUS
+EFIAPI
+SasV1ExtScsiPassThruGetNextTargetLun (
+  IN  EFI_EXT_SCSI_PASS_THRU_PROTOCOL    *This,
+  IN OUT UINT8                           **Target,
+  IN OUT UINT64                          *Lun
+  )
+{
+  EFI_STATUS Status;
+
+  if (Target == NULL || *Target == NULL || Lun == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  // Each target only has LUN 0
+  Status = SasV1ExtScsiPassThruGetNextTarget (This, Target);
+  if (!EFI_ERROR (Status)) {
+    *Lun = 0;
+  }
+  return Status;
+}
+
 STATIC
 EFI_STATUS
 EFIAPI
@@ -771,18 +937,6 @@ SasV1ExtScsiPassThruResetTarget (
   return EFI_UNSUPPORTED;
 }
 
-STATIC
-EFI_STATUS
-EFIAPI
-SasV1ExtScsiPassThruGetNextTarget (
-  IN  EFI_EXT_SCSI_PASS_THRU_PROTOCOL    *This,
-  IN OUT UINT8                           **Target
-  )
-{
-
-  return EFI_UNSUPPORTED;
-}
-
 STATIC EFI_EXT_SCSI_PASS_THRU_PROTOCOL SasV1ExtScsiPassThruProtocolTemplate = {
   NULL,
   SasV1ExtScsiPassThruFunction,
@@ -845,8 +999,8 @@ SasDriverBindingStart (
   PLATFORM_SAS_PROTOCOL *plat;
   SAS_V1_INFO *SasV1Info = NULL;
   SAS_V1_TRANSPORT_DEVICE_PATH  *DevicePath;
-  UINT32 val, base;
-  int i, phy_id = 0;
+  UINT32 val, base, port_id, phy_up = 0;
+  int i, phy_id;
   struct hisi_sas_itct *itct;
   struct hisi_hba *hba;
 
@@ -877,46 +1031,79 @@ SasDriverBindingStart (
 
   sas_init(SasV1Info, plat);
 
-  // Wait for sas controller phyup happen
+  // Timer completing the non-blocking requests, armed while some are in flight
+  Status = gBS->CreateEvent (
+                  EVT_TIMER | EVT_NOTIFY_SIGNAL,
+                  TPL_NOTIFY,
+                  SasV1PollTimer,
+                  SasV1Info,
+                  &SasV1Info->TimerEvent
+                  );
+  ASSERT_EFI_ERROR (Status);
+
+  // Wait for sas controller phyup happen, all the phys come up together
   MicroSecondDelay(100000);
 
-  for (i = 0; i < PHY_CNT; i++) {
-    val = PHY_READ_REG32(base, CHL_INT2, i);
+  // Build the target table: one target per port with a phy up (the phys of
+  // a wide port share a single target)
+  for (phy_id = 0; phy_id < PHY_CNT; phy_id++) {
+    val = PHY_READ_REG32(base, CHL_INT2, phy_id);
+    if (!(val & CHL_INT2_SL_PHY_ENA)) {
+      continue;
+    }
+
+    port_id = (READ_REG32(base, PHY_PORT_NUM_MA) >> (4 * phy_id)) & 0xf;
+    for (i = 0; i < (int)hba->target_cnt; i++) {
+      if (hba->targets[i].port_id == port_id) {
+        break;
+      }
+    }
 
-    if (val & CHL_INT2_SL_PHY_ENA) {
-      phy_id = i;
+    if (i == (int)hba->target_cnt) {
+      hba->targets[i].phy_id = phy_id;
+      hba->targets[i].port_id = port_id;
+      hba->target_cnt++;
+
+      // Setup itct, the target index is the device id
+      itct = &hba->itct[i];
+      itct->qw0 = 0x355 | ((UINT64)port_id << ITCT_HDR_PORT_ID_OFF);
+      itct->sas_addr = PHY_READ_REG32(base, RX_IDAF_DWORD3, phy_id);
+      itct->sas_addr = itct->sas_addr << 32 | PHY_READ_REG32(base, RX_IDAF_DWORD4, phy_id);
+      itct->qw2 = 0;
     }
+
+    // Clear phyup
+    PHY_WRITE_REG32(base, CHL_INT2, phy_id, CHL_INT2_SL_PHY_ENA);
+    val = PHY_READ_REG32(base, CHL_INT0, phy_id);
+    val &= ~CHL_INT0_PHYCTRL_NOTRDY;
+    PHY_WRITE_REG32(base, CHL_INT0, phy_id, val);
+    PHY_WRITE_REG32(base, CHL_INT0_MSK, phy_id, 0x3ce3ee);
+
+    // Need notify
+    val = PHY_READ_REG32(base, SL_CONTROL, phy_id);
+    val |= SL_CONTROL_NOTIFY_EN;
+    PHY_WRITE_REG32(base, SL_CONTROL, phy_id, val);
+    phy_up |= BIT(phy_id);
   }
 
-  itct = &hba->itct[0]; //device_id = 0
-
-  hba->port_id = (READ_REG32(base, PHY_PORT_NUM_MA) >> (4 * phy_id)) & 0xf;
-  // Setup itct
-  itct->qw0 = 0x355;
-  itct->sas_addr = PHY_READ_REG32(base, RX_IDAF_DWORD3, phy_id);
-  itct->sas_addr = itct->sas_addr << 32 | PHY_READ_REG32(base, RX_IDAF_DWORD4, phy_id);
-  itct->qw2 = 0;
-
-  // Clear phyup
-  PHY_WRITE_REG32(base, CHL_INT2, phy_id, CHL_INT2_SL_PHY_ENA);
-  val = PHY_READ_REG32(base, CHL_INT0, phy_id);
-  val &= ~CHL_INT0_PHYCTRL_NOTRDY;
-  PHY_WRITE_REG32(base, CHL_INT0, phy_id, val);
-  PHY_WRITE_REG32(base, CHL_INT0_MSK, phy_id, 0x3ce3ee);
-
-  // Need notify
-  val = PHY_READ_REG32(base, SL_CONTROL, phy_id);
-  val |= SL_CONTROL_NOTIFY_EN;
-  PHY_WRITE_REG32(base, SL_CONTROL, phy_id, val);
   // wait 100ms required for notify takes effect, refer drivers/scsi/hisi_sas/hisi_sas_v1_hw.c
-  MicroSecondDelay(100000);
-  val = PHY_READ_REG32(base, SL_CONTROL, phy_id);
-  val &= ~SL_CONTROL_NOTIFY_EN;
-  PHY_WRITE_REG32(base, SL_CONTROL, phy_id, val);
+  // the phys are notified together so this is only paid once
+  if (phy_up != 0) {
+    MicroSecondDelay(100000);
+  }
+  for (phy_id = 0; phy_id < PHY_CNT; phy_id++) {
+    if (phy_up & BIT(phy_id)) {
+      val = PHY_READ_REG32(base, SL_CONTROL, phy_id);
+      val &= ~SL_CONTROL_NOTIFY_EN;
+      PHY_WRITE_REG32(base, SL_CONTROL, phy_id, val);
+    }
+  }
+  DEBUG ((EFI_D_INFO, "SAS: %d target(s) found, phy mask 0x%x\n", hba->target_cnt, phy_up));
 
   CopyMem (&SasV1Info->ExtScsiPassThru, &SasV1ExtScsiPassThruProtocolTemplate, sizeof (EFI_EXT_SCSI_PASS_THRU_PROTOCOL));
   SasV1Info->ExtScsiPassThruMode.AdapterId = 2;
-  SasV1Info->ExtScsiPassThruMode.Attributes = EFI_EXT_SCSI_PASS_THRU_ATTRIBUTES_PHYSICAL | EFI_EXT_SCSI_PASS_THRU_ATTRIBUTES_LOGICAL;
+  SasV1Info->ExtScsiPassThruMode.Attributes = EFI_EXT_SCSI_PASS_THRU_ATTRIBUTES_PHYSICAL | EFI_EXT_SCSI_PASS_THRU_ATTRIBUTES_LOGICAL |
+                                              EFI_EXT_SCSI_PASS_THRU_ATTRIBUTES_NONBLOCKIO;
   SasV1Info->ExtScsiPassThruMode.IoAlign  = 64; //cache line align
   SasV1Info->ExtScsiPassThru.Mode = &SasV1Info->ExtScsiPassThruMode;
 
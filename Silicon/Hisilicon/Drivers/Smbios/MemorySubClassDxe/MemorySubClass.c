@@ -16,6 +16,10 @@ EFI_HII_HANDLE                  mHiiHandle;
 UINT8                           mMaxSkt;
 UINT8                           mMaxCh;
 
+UINT8                           mDimmSlot[MAX_SOCKET][MAX_CHANNEL];
+UINT16                          mDimmCount;
+MEMORY_DIMM_INFO                *mDimmInfo;
+
 VOID
 SmbiosGetManufacturer (
   IN  UINT8           MfgIdLSB,
@@ -232,47 +236,6 @@ SmbiosGetDimmVoltageInfo (
     }
 }
 
-VOID
-SmbiosGetMemoryDevicesNumber (
-  IN OUT UINT16 *NumberOfDevices
-)
-{
-    UINT8       Skt, Ch, Dimm;
-
-    for(Skt = 0; Skt < mMaxSkt; Skt++)
-    {
-        for(Ch = 0; Ch < mMaxCh; Ch++)
-        {
-            for(Dimm = 0; Dimm < OemGetDimmSlot(Skt, Ch); Dimm++)
-            {
-                (*NumberOfDevices)++;
-            }
-        }
-    }
-}
-
-UINT8
-SmbiosGetPartitionWidth (
-)
-{
-
-    UINT8       Skt, Ch, Dimm;
-    UINT8       PartitionWidth = 0;
-
-    for(Skt = 0; Skt < mMaxSkt; Skt++)
-    {
-        for(Ch = 0; Ch < mMaxCh; Ch++)
-        {
-            for(Dimm = 0; Dimm < OemGetDimmSlot(Skt, Ch); Dimm++)
-            {
-                PartitionWidth++;
-            }
-        }
-    }
-
-    return PartitionWidth;
-}
-
 EFI_STATUS
 SmbiosAddType16Table (
   IN  GBL_INTERFACE      *pGblData,
@@ -283,9 +246,9 @@ SmbiosAddType16Table (
     UINT64                          MemoryCapacity;
     SMBIOS_TABLE_TYPE16             *Type16Record;
 
-    UINT16                          NumberOfMemoryDevices = 0;
+    UINT16                          NumberOfMemoryDevices;
 
-    SmbiosGetMemoryDevicesNumber (&NumberOfMemoryDevices);
+    NumberOfMemoryDevices = mDimmCount;
 
     MemoryCapacity = (UINT64) LShiftU64 (NumberOfMemoryDevices * MAX_DIMM_SIZE, 20); // GB to KB.
 
@@ -373,7 +336,7 @@ SmbiosAddType19Table (
     Type19Record->StartingAddress                   = 0x0;
     Type19Record->EndingAddress                     = (UINT32) (TotalMemorySize - 1); // in KB;
     Type19Record->MemoryArrayHandle                 = MemArraySmbiosHandle;
-    Type19Record->PartitionWidth                    = SmbiosGetPartitionWidth ();
+    Type19Record->PartitionWidth                    = (UINT8)mDimmCount;
     Type19Record->ExtendedStartingAddress           = 0x0;
     Type19Record->ExtendedEndingAddress             = 0x0;
 
@@ -389,248 +352,197 @@ SmbiosAddType19Table (
 }
 
 
-EFI_STATUS
-SmbiosAddType17Table (
-  IN GBL_INTERFACE      *pGblData,
-  IN UINT8              Skt,
-  IN UINT8              Ch,
-  IN UINT8              Dimm,
-  IN EFI_SMBIOS_HANDLE  MemArraySmbiosHandle
+VOID
+SmbiosGetDimmInfo (
+  IN  GBL_INTERFACE      *pGblData,
+  IN  UINT8              Skt,
+  IN  UINT8              Ch,
+  IN  UINT8              Dimm,
+  OUT MEMORY_DIMM_INFO   *DimmInfo
   )
 {
-    EFI_STATUS                      Status;
     SMBIOS_TABLE_TYPE17             *Type17Record;
-    EFI_SMBIOS_HANDLE               MemDevSmbiosHandle;
-    UINTN                           TableSize;
-
-    UINTN                           StringBufferSize;
-    EFI_STRING                      StringBuffer;
-    UINT16                          MemInfoMemFreq;
-    UINT16                          MemoryTotalWidth;
-    UINT16                          MemoryDataWidth;
-    UINT16                          MemoryDeviceSize;
-    UINT16                          MemorySpeed;
-    UINT8                           Attributes;
-    UINT32                          MemoryDeviceExtendSize;
-    UINT16                          CfgMemorySpeed;
-
-    CHAR8                           *OptionalStrStart;
-    UINTN                           DeviceLocatorStrLen;
-    UINTN                           BankLocatorStrLen;
-    UINTN                           ManufactureStrLen;
-    UINTN                           SerialNumberStrLen;
-    UINTN                           AssertTagStrLen;
-    UINTN                           PartNumberStrLen;
-    EFI_STRING                      DeviceLocatorStr;
-    EFI_STRING                      BankLocatorStr;
-    EFI_STRING                      ManufactureStr;
-    EFI_STRING                      SerialNumberStr;
-    EFI_STRING                      AssertTagStr;
-    EFI_STRING                      PartNumberStr;
+    CHAR16                          StringBuffer[SMBIOS_STRING_MAX_LENGTH];
+    EFI_STRING                      HiiString;
     EFI_STRING_ID                   DeviceLocator;
 
-    Type17Record        = NULL;
-    DeviceLocatorStr    = NULL;
-    BankLocatorStr      = NULL;
-    ManufactureStr      = NULL;
-    SerialNumberStr     = NULL;
-    AssertTagStr        = NULL;
-    PartNumberStr       = NULL;
-
-    MemoryTotalWidth    = 0;
-    MemoryDataWidth     = 0;
-    MemoryDeviceSize    = 0;
-    MemoryDeviceExtendSize = 0;
-    MemorySpeed         = 0;
-    Attributes          = 0;
-    CfgMemorySpeed      = 0;
-
-    //
-    // Allocate Buffers
-    //
-    StringBufferSize = (sizeof (CHAR16)) * SMBIOS_STRING_MAX_LENGTH;
-    StringBuffer = AllocateZeroPool (StringBufferSize);
-    if(NULL == StringBuffer)
-    {
-        return EFI_OUT_OF_RESOURCES;
-    }
-
-
-    //
-    // Manufacture
-    //
-    ManufactureStr = AllocateZeroPool (StringBufferSize);
-    if(NULL == ManufactureStr)
-    {
-        Status = EFI_OUT_OF_RESOURCES;
-        goto FREE_STR_BUF;
-    }
-    UnicodeSPrint(ManufactureStr, SMBIOS_STRING_MAX_LENGTH - 1, L"NO DIMM");
-
-    //
-    // SerialNumber
-    //
-    SerialNumberStr = AllocateZeroPool (StringBufferSize);
-    if(NULL == SerialNumberStr)
-    {
-        Status = EFI_OUT_OF_RESOURCES;
-        goto FREE_STR_MAN;
-    }
-    UnicodeSPrint(SerialNumberStr, SMBIOS_STRING_MAX_LENGTH - 1, L"NO DIMM");
-
-    //
-    // AssetTag
-    //
-    AssertTagStr = AllocateZeroPool (StringBufferSize);
-    if(NULL == AssertTagStr)
-    {
-        Status = EFI_OUT_OF_RESOURCES;
-        goto FREE_STR_SN;
-    }
-    UnicodeSPrint(AssertTagStr, SMBIOS_STRING_MAX_LENGTH - 1, L"NO DIMM");
+    Type17Record = &DimmInfo->Type17;
 
-    //
-    // PartNumber
-    //
-    PartNumberStr = AllocateZeroPool (StringBufferSize);
-    if(NULL == PartNumberStr)
-    {
-        Status = EFI_OUT_OF_RESOURCES;
-        goto FREE_STR_AST;
-    }
-    UnicodeSPrint(PartNumberStr, SMBIOS_STRING_MAX_LENGTH - 1, L"NO DIMM");
+    Type17Record->Hdr.Type                      = EFI_SMBIOS_TYPE_MEMORY_DEVICE;
+    Type17Record->Hdr.Length                    = sizeof (SMBIOS_TABLE_TYPE17);
+    Type17Record->Hdr.Handle                    = 0;
+    Type17Record->MemoryErrorInformationHandle  = 0xFFFE;
+    Type17Record->FormFactor                    = MemoryFormFactorDimm;
+    Type17Record->DeviceLocator                 = 1;
+    Type17Record->BankLocator                   = 2;
+    Type17Record->Manufacturer                  = 3;
+    Type17Record->SerialNumber                  = 4;
+    Type17Record->AssetTag                      = 5;
+    Type17Record->PartNumber                    = 6;
+    Type17Record->MemoryType                    = SmbiosGetMemoryType (pGblData, Skt, Ch, Dimm);
+    Type17Record->TypeDetail.Synchronous        = 1;
+    SmbiosGetTypeDetail (pGblData, Skt, Ch, Dimm, &(Type17Record->TypeDetail));
 
+    (VOID)AsciiStrCpyS (DimmInfo->Manufacturer, SMBIOS_STRING_MAX_LENGTH, "NO DIMM");
+    (VOID)AsciiStrCpyS (DimmInfo->SerialNumber, SMBIOS_STRING_MAX_LENGTH, "NO DIMM");
+    (VOID)AsciiStrCpyS (DimmInfo->AssetTag, SMBIOS_STRING_MAX_LENGTH, "NO DIMM");
+    (VOID)AsciiStrCpyS (DimmInfo->PartNumber, SMBIOS_STRING_MAX_LENGTH, "NO DIMM");
 
     if(IsDimmPresent(pGblData, Skt, Ch, Dimm))
     {
-        MemoryDataWidth = pGblData->Channel[Skt][Ch].Dimm[Dimm].PrimaryBusWidth;
-        MemoryTotalWidth = MemoryDataWidth + pGblData->Channel[Skt][Ch].Dimm[Dimm].ExtensionBusWidth;
-
-        MemoryDeviceSize = pGblData->Channel[Skt][Ch].Dimm[Dimm].DimmSize;  //in MB
-        MemoryDeviceExtendSize = 0;
+        Type17Record->DataWidth = pGblData->Channel[Skt][Ch].Dimm[Dimm].PrimaryBusWidth;
+        Type17Record->TotalWidth = Type17Record->DataWidth + pGblData->Channel[Skt][Ch].Dimm[Dimm].ExtensionBusWidth;
 
-        if (MemoryDeviceSize >= 0x7fff)
+        Type17Record->Size = pGblData->Channel[Skt][Ch].Dimm[Dimm].DimmSize;  //in MB
+        if (Type17Record->Size >= 0x7fff)
         {
-            MemoryDeviceExtendSize = MemoryDeviceSize;  // in MB
-            MemoryDeviceSize = 0x7fff;                    // max value
+            Type17Record->ExtendedSize = Type17Record->Size;  // in MB
+            Type17Record->Size = 0x7fff;                      // max value
         }
 
-        MemInfoMemFreq = pGblData->Freq;
-        MemorySpeed = pGblData->Channel[Skt][Ch].Dimm[Dimm].DimmSpeed;
-        Attributes = pGblData->Channel[Skt][Ch].Dimm[Dimm].RankNum;
-        CfgMemorySpeed = MemInfoMemFreq;
+        Type17Record->Speed = pGblData->Channel[Skt][Ch].Dimm[Dimm].DimmSpeed;  // in MHZ
+        Type17Record->Attributes = pGblData->Channel[Skt][Ch].Dimm[Dimm].RankNum;
+        Type17Record->ConfiguredMemoryClockSpeed = pGblData->Freq;
 
         //
-        // Manufacturer
+        // Add for smbios 2.8.0
         //
+        SmbiosGetDimmVoltageInfo (pGblData, Skt, Ch, Dimm, Type17Record);
+
         SmbiosGetManufacturer (pGblData->Channel[Skt][Ch].Dimm[Dimm].SpdMMfgId & 0xFF,
-                                        pGblData->Channel[Skt][Ch].Dimm[Dimm].SpdMMfgId >> 8,
-                                        ManufactureStr
-                                        );
+                               pGblData->Channel[Skt][Ch].Dimm[Dimm].SpdMMfgId >> 8,
+                               StringBuffer
+                               );
+        (VOID)UnicodeStrToAsciiStrS (StringBuffer, DimmInfo->Manufacturer, SMBIOS_STRING_MAX_LENGTH);
 
-        //
-        // SerialNumber
-        //
-        SmbiosGetSerialNumber(pGblData, Skt, Ch, Dimm, SerialNumberStr);
+        SmbiosGetSerialNumber (pGblData, Skt, Ch, Dimm, StringBuffer);
+        (VOID)UnicodeStrToAsciiStrS (StringBuffer, DimmInfo->SerialNumber, SMBIOS_STRING_MAX_LENGTH);
 
-        //
-        // AssetTag
-        //
-        UnicodeSPrint(AssertTagStr, SMBIOS_STRING_MAX_LENGTH - 1, L"Unknown");
+        (VOID)AsciiStrCpyS (DimmInfo->AssetTag, SMBIOS_STRING_MAX_LENGTH, "Unknown");
 
-        //
-        // PartNumber
-        //
-        SmbiosGetPartNumber(pGblData, Skt, Ch, Dimm, PartNumberStr);
+        SmbiosGetPartNumber (pGblData, Skt, Ch, Dimm, StringBuffer);
+        (VOID)UnicodeStrToAsciiStrS (StringBuffer, DimmInfo->PartNumber, SMBIOS_STRING_MAX_LENGTH);
     }
 
     //
     // DeviceLocator
     //
-    DeviceLocatorStr = AllocateZeroPool ((sizeof (CHAR16)) * SMBIOS_STRING_MAX_LENGTH);
-    if(NULL == DeviceLocatorStr)
-    {
-        Status = EFI_OUT_OF_RESOURCES;
-        goto FREE_STR_PN;
-    }
     DeviceLocator = gDimmToDevLocator[Skt][Ch][Dimm];
     if (DeviceLocator != 0xFFFF)
     {
-        UnicodeSPrint(DeviceLocatorStr, SMBIOS_STRING_MAX_LENGTH, L"DIMM%x%x%x ", Skt, Ch, Dimm);
-        StringBuffer = HiiGetPackageString (&gEfiCallerIdGuid, DeviceLocator, NULL);
-        (VOID)StrCatS(DeviceLocatorStr, SMBIOS_STRING_MAX_LENGTH, StringBuffer);
+        UnicodeSPrint(StringBuffer, sizeof (StringBuffer), L"DIMM%x%x%x ", Skt, Ch, Dimm);
+        HiiString = HiiGetPackageString (&gEfiCallerIdGuid, DeviceLocator, NULL);
+        if (HiiString != NULL)
+        {
+            (VOID)StrCatS(StringBuffer, SMBIOS_STRING_MAX_LENGTH, HiiString);
+            FreePool (HiiString);
+        }
     }
     else
     {
-    UnicodeSPrint(DeviceLocatorStr, SMBIOS_STRING_MAX_LENGTH, L"DIMM%x%x%x", Skt, Ch, Dimm);
+        UnicodeSPrint(StringBuffer, sizeof (StringBuffer), L"DIMM%x%x%x", Skt, Ch, Dimm);
     }
-    DeviceLocatorStrLen = StrLen (DeviceLocatorStr);
+    (VOID)UnicodeStrToAsciiStrS (StringBuffer, DimmInfo->DeviceLocator, SMBIOS_STRING_MAX_LENGTH);
 
     //
     // BankLocator
     //
-    BankLocatorStr = AllocateZeroPool ((sizeof (CHAR16)) * SMBIOS_STRING_MAX_LENGTH);
-    if(NULL == BankLocatorStr)
-    {
-        Status = EFI_OUT_OF_RESOURCES;
-        goto FREE_STR_DEV;
-    }
-    UnicodeSPrint(BankLocatorStr, SMBIOS_STRING_MAX_LENGTH, L"SOCKET %x CHANNEL %x DIMM %x", Skt, Ch, Dimm);
-    BankLocatorStrLen = StrLen (BankLocatorStr);
+    AsciiSPrint(DimmInfo->BankLocator, SMBIOS_STRING_MAX_LENGTH, "SOCKET %x CHANNEL %x DIMM %x", Skt, Ch, Dimm);
+}
 
-    ManufactureStrLen = StrLen (ManufactureStr);
-    SerialNumberStrLen = StrLen (SerialNumberStr);
-    AssertTagStrLen = StrLen (AssertTagStr);
-    PartNumberStrLen = StrLen (PartNumberStr);
+EFI_STATUS
+SmbiosCollectDimmInventory (
+  IN  GBL_INTERFACE      *pGblData
+  )
+{
+    UINT8       Skt, Ch, Dimm;
+    UINT8       DimmSlot;
+    UINTN       Index;
 
     //
-    // Report Type 17 SMBIOS Record
+    // Count the slots first so the whole inventory is one allocation, then
+    // read every slot exactly once. The Type 16/17/19 builders only use the
+    // cached table afterwards.
     //
-    TableSize = sizeof(SMBIOS_TABLE_TYPE17) + DeviceLocatorStrLen + 1 + BankLocatorStrLen + 1 + ManufactureStrLen + 1 + SerialNumberStrLen + 1 + AssertTagStrLen + 1 + PartNumberStrLen + 1 + 1;
-    Type17Record = AllocateZeroPool (TableSize);
-    if(NULL == Type17Record)
+    mDimmCount = 0;
+    for(Skt = 0; Skt < mMaxSkt; Skt++)
     {
-        Status = EFI_OUT_OF_RESOURCES;
-        goto FREE_BL;
+        for(Ch = 0; Ch < mMaxCh; Ch++)
+        {
+            mDimmSlot[Skt][Ch] = OemGetDimmSlot(Skt, Ch);
+            mDimmCount += mDimmSlot[Skt][Ch];
+        }
     }
 
-    Type17Record->Hdr.Type                      = EFI_SMBIOS_TYPE_MEMORY_DEVICE;
-    Type17Record->Hdr.Length                    = sizeof (SMBIOS_TABLE_TYPE17);
-    Type17Record->Hdr.Handle                    = 0;
-    Type17Record->MemoryArrayHandle             = MemArraySmbiosHandle;
-    Type17Record->MemoryErrorInformationHandle  = 0xFFFE;
-    Type17Record->TotalWidth                    = MemoryTotalWidth;
-    Type17Record->DataWidth                     = MemoryDataWidth;
-    Type17Record->Size                          = MemoryDeviceSize;           // in MB
-    Type17Record->FormFactor                    = MemoryFormFactorDimm;
-    Type17Record->DeviceLocator                 = 1;
-    Type17Record->BankLocator                   = 2;
-    Type17Record->MemoryType                    = SmbiosGetMemoryType (pGblData, Skt, Ch, Dimm);
+    mDimmInfo = AllocateZeroPool (mDimmCount * sizeof (MEMORY_DIMM_INFO));
+    if (NULL == mDimmInfo)
+    {
+        return EFI_OUT_OF_RESOURCES;
+    }
 
-    Type17Record->TypeDetail.Synchronous    = 1;
+    Index = 0;
+    for(Skt = 0; Skt < mMaxSkt; Skt++)
+    {
+        for(Ch = 0; Ch < mMaxCh; Ch++)
+        {
+            DimmSlot = mDimmSlot[Skt][Ch];
+            for(Dimm = 0; Dimm < DimmSlot; Dimm++)
+            {
+                SmbiosGetDimmInfo (pGblData, Skt, Ch, Dimm, &mDimmInfo[Index++]);
+            }
+        }
+    }
 
-    SmbiosGetTypeDetail (pGblData, Skt, Ch, Dimm, &(Type17Record->TypeDetail));
+    return EFI_SUCCESS;
+}
+
+EFI_STATUS
+SmbiosAddType17Table (
+  IN MEMORY_DIMM_INFO   *DimmInfo,
+  IN EFI_SMBIOS_HANDLE  MemArraySmbiosHandle
+  )
+{
+    EFI_STATUS                      Status;
+    SMBIOS_TABLE_TYPE17             *Type17Record;
+    EFI_SMBIOS_HANDLE               MemDevSmbiosHandle;
+    UINTN                           TableSize;
+    CHAR8                           *OptionalStrStart;
+    CHAR8                           *Strings[6];
+    UINTN                           StringSize[6];
+    UINTN                           Index;
+
+    Strings[0] = DimmInfo->DeviceLocator;
+    Strings[1] = DimmInfo->BankLocator;
+    Strings[2] = DimmInfo->Manufacturer;
+    Strings[3] = DimmInfo->SerialNumber;
+    Strings[4] = DimmInfo->AssetTag;
+    Strings[5] = DimmInfo->PartNumber;
+
+    TableSize = sizeof (SMBIOS_TABLE_TYPE17) + 1;
+    for (Index = 0; Index < ARRAY_SIZE (Strings); Index++)
+    {
+        StringSize[Index] = AsciiStrSize (Strings[Index]);
+        TableSize += StringSize[Index];
+    }
 
-    Type17Record->Speed                         = MemorySpeed; // in MHZ
-    Type17Record->Manufacturer                  = 3;
-    Type17Record->SerialNumber                  = 4;
-    Type17Record->AssetTag                      = 5;
-    Type17Record->PartNumber                    = 6;
-    Type17Record->Attributes                    = Attributes;
-    Type17Record->ExtendedSize                  = MemoryDeviceExtendSize;
-    Type17Record->ConfiguredMemoryClockSpeed    = CfgMemorySpeed;
     //
-    // Add for smbios 2.8.0
+    // Report Type 17 SMBIOS Record
     //
-    SmbiosGetDimmVoltageInfo (pGblData, Skt, Ch, Dimm, Type17Record);
+    Type17Record = AllocateZeroPool (TableSize);
+    if(NULL == Type17Record)
+    {
+        return EFI_OUT_OF_RESOURCES;
+    }
+
+    CopyMem (Type17Record, &DimmInfo->Type17, sizeof (SMBIOS_TABLE_TYPE17));
+    Type17Record->MemoryArrayHandle = MemArraySmbiosHandle;
 
     OptionalStrStart = (CHAR8 *) (Type17Record + 1);
-    UnicodeStrToAsciiStr (DeviceLocatorStr, OptionalStrStart);
-    UnicodeStrToAsciiStr (BankLocatorStr, OptionalStrStart + DeviceLocatorStrLen + 1);
-    UnicodeStrToAsciiStr (ManufactureStr, OptionalStrStart + DeviceLocatorStrLen + 1 + BankLocatorStrLen + 1);
-    UnicodeStrToAsciiStr (SerialNumberStr, OptionalStrStart + DeviceLocatorStrLen + 1 + BankLocatorStrLen + 1 + ManufactureStrLen + 1);
-    UnicodeStrToAsciiStr (AssertTagStr, OptionalStrStart + DeviceLocatorStrLen + 1 + BankLocatorStrLen + 1 + ManufactureStrLen + 1 + SerialNumberStrLen + 1);
-    UnicodeStrToAsciiStr (PartNumberStr, OptionalStrStart + DeviceLocatorStrLen + 1 + BankLocatorStrLen + 1 + ManufactureStrLen + 1 + SerialNumberStrLen + 1 + AssertTagStrLen + 1);
+    for (Index = 0; Index < ARRAY_SIZE (Strings); Index++)
+    {
+        CopyMem (OptionalStrStart, Strings[Index], StringSize[Index]);
+        OptionalStrStart += StringSize[Index];
+    }
 
     MemDevSmbiosHandle = SMBIOS_HANDLE_PI_RESERVED;
     Status = mSmbios->Add (mSmbios, NULL, &MemDevSmbiosHandle, (EFI_SMBIOS_TABLE_HEADER*) Type17Record);
@@ -640,28 +552,6 @@ SmbiosAddType17Table (
     }
 
     FreePool (Type17Record);
-
-FREE_BL:
-    FreePool (BankLocatorStr);
-
-FREE_STR_DEV:
-    FreePool (DeviceLocatorStr);
-
-FREE_STR_PN:
-    FreePool (PartNumberStr);
-
-FREE_STR_AST:
-    FreePool (AssertTagStr);
-
-FREE_STR_SN:
-    FreePool (SerialNumberStr);
-
-FREE_STR_MAN:
-    FreePool (ManufactureStr);
-
-FREE_STR_BUF:
-    FreePool (StringBuffer);
-
     return Status;
 }
 
@@ -688,7 +578,7 @@ MemorySubClassEntryPoint(
     EFI_HOB_GUID_TYPE               *GuidHob;
     GBL_INTERFACE                   *pGblData;
     EFI_SMBIOS_HANDLE               MemArraySmbiosHandle;
-    UINT8                           Skt, Ch, Dimm;
+    UINTN                           Index;
 
     GuidHob = GetFirstGuidHob(&gHisiEfiMemoryMapGuid);
     if(NULL == GuidHob)
@@ -720,37 +610,40 @@ MemorySubClassEntryPoint(
 
     mMaxSkt  = OemGetSocketNumber();
     mMaxCh   = OemGetDdrChannel();
-    // Get DIMM slot number on Socket 0 Channel 0
-    // TODO: Assume all channels have same slot number
+
+    Status = SmbiosCollectDimmInventory (pGblData);
+    if(EFI_ERROR(Status))
+    {
+        DEBUG((EFI_D_ERROR, "Smbios Collect DIMM Inventory Failed.  %r\n", Status));
+        return Status;
+    }
 
     Status = SmbiosAddType16Table (pGblData, &MemArraySmbiosHandle);
     if(EFI_ERROR(Status))
     {
         DEBUG((EFI_D_ERROR, "Smbios Add Type16 Table Failed.  %r\n", Status));
-        return Status;
+        goto FREE_DIMM_INFO;
     }
 
     Status = SmbiosAddType19Table (pGblData, MemArraySmbiosHandle);
     if(EFI_ERROR(Status))
     {
         DEBUG((EFI_D_ERROR, "Smbios Add Type19 Table Failed.  %r\n", Status));
-        return Status;
+        goto FREE_DIMM_INFO;
     }
 
-    for(Skt = 0; Skt < mMaxSkt; Skt++)
+    for(Index = 0; Index < mDimmCount; Index++)
     {
-        for(Ch = 0; Ch < mMaxCh; Ch++)
+        Status = SmbiosAddType17Table (&mDimmInfo[Index], MemArraySmbiosHandle);
+        if(EFI_ERROR(Status))
         {
-            for(Dimm = 0; Dimm < OemGetDimmSlot(Skt, Ch); Dimm++)
-            {
-                Status = SmbiosAddType17Table (pGblData, Skt, Ch, Dimm, MemArraySmbiosHandle);
-                if(EFI_ERROR(Status))
-                {
-                    DEBUG((EFI_D_ERROR, "Smbios Add Type17 Table Failed.  %r\n", Status));
-                }
-            }
+            DEBUG((EFI_D_ERROR, "Smbios Add Type17 Table Failed.  %r\n", Status));
         }
     }
 
+FREE_DIMM_INFO:
+    FreePool (mDimmInfo);
+    mDimmInfo = NULL;
+
     return Status;
 }
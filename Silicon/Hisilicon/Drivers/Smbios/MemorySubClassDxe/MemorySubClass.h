@@ -38,6 +38,20 @@
 
 extern UINT8 MemorySubClassStrings[];
 
+//
+// Everything the Type 16/17/19 records need to know about one DIMM slot,
+// gathered once from the memory map HOB and the HII string package.
+//
+typedef struct {
+    SMBIOS_TABLE_TYPE17 Type17;   // Formatted area, MemoryArrayHandle still unset
+    CHAR8               DeviceLocator[SMBIOS_STRING_MAX_LENGTH];
+    CHAR8               BankLocator[SMBIOS_STRING_MAX_LENGTH];
+    CHAR8               Manufacturer[SMBIOS_STRING_MAX_LENGTH];
+    CHAR8               SerialNumber[SMBIOS_STRING_MAX_LENGTH];
+    CHAR8               AssetTag[SMBIOS_STRING_MAX_LENGTH];
+    CHAR8               PartNumber[SMBIOS_STRING_MAX_LENGTH];
+} MEMORY_DIMM_INFO;
+
 struct SPD_JEDEC_MANUFACTURER
 {
     UINT8  MfgIdLSB;
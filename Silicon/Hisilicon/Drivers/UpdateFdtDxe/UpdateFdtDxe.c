@@ -82,19 +82,14 @@ EFIAPI UpdateFdt (
   IN EFI_SYSTEM_TABLE  *SystemTable)
 {
     INTN                Error;
-    VOID*               Fdt;
-    UINT32              Size;
     UINTN               NewFdtBlobSize;
-    UINTN               NewFdtBlobBase;
+    VOID*               NewFdtBlob;
     EFI_STATUS          Status = EFI_SUCCESS;
     UINT32              Index = 0;
     UINTN               FDTConfigTable;
 
     (VOID) SetNvramSpace ();
 
-    Fdt = (VOID*)(PcdGet64(FdtFileAddress));
-
-
     Error = fdt_check_header ((VOID*)(PcdGet64(FdtFileAddress)));
     DEBUG ((EFI_D_ERROR,"fdtfileaddress:--------- 0x%lx\n",PcdGet64(FdtFileAddress)));
     if (Error != 0)
@@ -103,27 +98,20 @@ EFIAPI UpdateFdt (
         return EFI_INVALID_PARAMETER;
     }
 
-    Size = (UINTN)fdt_totalsize ((VOID*)(PcdGet64(FdtFileAddress)));
-    NewFdtBlobSize = Size + ADD_FILE_LENGTH;
-
-    Status = gBS->AllocatePages (AllocateAnyPages, EfiRuntimeServicesData, EFI_SIZE_TO_PAGES(NewFdtBlobSize), &NewFdtBlobBase);
-    if (EFI_ERROR (Status))
-    {
-        return EFI_OUT_OF_RESOURCES;
-    }
-
-    (VOID) CopyMem((VOID*)NewFdtBlobBase, Fdt, Size);
-
-    Status = EFIFdtUpdate(NewFdtBlobBase);
+    //
+    // The library copies the FDT once, into a buffer sized for all of its
+    // updates, so there is no need for an intermediate copy here.
+    //
+    Status = EFIFdtUpdate((UINTN)PcdGet64(FdtFileAddress), &NewFdtBlob, &NewFdtBlobSize);
     if (EFI_ERROR (Status))
     {
         DEBUG((EFI_D_ERROR, "%a(%d):EFIFdtUpdate Fail!\n", __FUNCTION__,__LINE__));
-        goto EXIT;
+        return Status;
     }
 
 
-    Status = InstallFdtIntoConfigurationTable ((VOID*)(UINTN)NewFdtBlobBase, NewFdtBlobSize);
-    DEBUG ((EFI_D_ERROR, "NewFdtBlobBase: 0x%lx  NewFdtBlobSize:0x%lx\n",NewFdtBlobBase,NewFdtBlobSize));
+    Status = InstallFdtIntoConfigurationTable (NewFdtBlob, NewFdtBlobSize);
+    DEBUG ((EFI_D_ERROR, "NewFdtBlob: 0x%p  NewFdtBlobSize:0x%lx\n",NewFdtBlob,NewFdtBlobSize));
     if (EFI_ERROR (Status))
     {
         DEBUG ((EFI_D_ERROR, "installfdtconfiguration table fail():\n"));
@@ -145,7 +133,7 @@ EFIAPI UpdateFdt (
 
     EXIT:
 
-         gBS->FreePages(NewFdtBlobBase,EFI_SIZE_TO_PAGES(NewFdtBlobSize));
+         FreePages(NewFdtBlob,EFI_SIZE_TO_PAGES(NewFdtBlobSize));
 
     return Status;
 
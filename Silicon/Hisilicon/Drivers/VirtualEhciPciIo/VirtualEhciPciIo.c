@@ -18,6 +18,11 @@ EhciVirtualPciIoInitialize (
   IN EFI_SYSTEM_TABLE   *SystemTable
   )
 {
+  //
+  // The EHCI is DMA coherent: NonDiscoverablePciDeviceDxe then maps buffers
+  // in place and only bounces those above 4 GB when the controller does not
+  // report 64-bit addressing, so no DMA specific handling is needed here.
+  //
   return RegisterNonDiscoverableMmioDevice (
            NonDiscoverableDeviceTypeEhci,
            NonDiscoverableDeviceDmaTypeCoherent,
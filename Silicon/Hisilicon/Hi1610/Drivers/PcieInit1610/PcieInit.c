@@ -118,6 +118,8 @@ PcieInitEntry (
     UINT32             HostBridgeNum = 0;
     UINT32             soctype = 0;
     UINT32       PcieRootBridgeMask;
+    PCIE_PORT_LINK_STATE  Ports[PCIE_MAX_HOSTBRIDGE * PCIE_MAX_ROOTBRIDGE];
+    UINT32             PortCount = 0;
 
 
     if (!OemIsMpBoot())
@@ -142,15 +144,26 @@ PcieInitEntry (
                 continue;
             }
 
-            Status = PciePortInit(soctype, HostBridgeNum, &gastr_pcie_driver_cfg[Port]);
+            /*
+               Start the link training of every enabled port first, then
+               wait for all of them together.
+            */
+            Ports[PortCount].HostBridgeNum = HostBridgeNum;
+            Ports[PortCount].PcieCfg = gastr_pcie_driver_cfg[Port];
+            Ports[PortCount].LaneNumCnt = 0;
+            Status = PciePortStartLink(soctype, HostBridgeNum, &Ports[PortCount].PcieCfg);
+            Ports[PortCount].Pending = !EFI_ERROR(Status);
             if(EFI_ERROR(Status))
             {
                 DEBUG((EFI_D_ERROR, "HostBridge %d, Pcie Port %d Init Failed! \n", HostBridgeNum, Port));
             }
+            PortCount++;
 
         }
     }
 
+    (VOID)PcieWaitPortsLinkUp(soctype, Ports, PortCount);
+
 
     return EFI_SUCCESS;
 
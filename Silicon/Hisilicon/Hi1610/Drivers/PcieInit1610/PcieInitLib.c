@@ -269,12 +269,15 @@ VOID PcieReconfigLaneNum (
   return ;
 }
 
+/*
+ * Start the LTSSM of a port, without waiting for the link training.
+ */
+STATIC
 EFI_STATUS
-PcieEnableItssm (
+PcieStartItssm (
   IN UINT32 soctype,
   IN UINT32 HostBridgeNum,
-  IN UINT32 Port,
-  IN PCIE_DRIVER_CFG *PcieCfg
+  IN UINT32 Port
   )
 {
     PCIE_CTRL_7_U pcie_ctrl7;
@@ -290,7 +293,6 @@ PcieEnableItssm (
         Value |= BIT11|BIT30|BIT31;
         RegWrite(PCIE_APB_SLAVE_BASE_1610[HostBridgeNum][Port] + 0x1114, Value);
         (VOID)PcieRxValidCtrl(soctype, HostBridgeNum, Port, 1);
-        PcieReconfigLaneNum (soctype, HostBridgeNum, Port, PcieCfg);
         return EFI_SUCCESS;
     }
     else
@@ -309,6 +311,29 @@ PcieEnableItssm (
 
 }
 
+EFI_STATUS
+PcieEnableItssm (
+  IN UINT32 soctype,
+  IN UINT32 HostBridgeNum,
+  IN UINT32 Port,
+  IN PCIE_DRIVER_CFG *PcieCfg
+  )
+{
+    EFI_STATUS Status;
+
+    Status = PcieStartItssm (soctype, HostBridgeNum, Port);
+    if (EFI_ERROR (Status)) {
+        return Status;
+    }
+
+    if (0x1610 == soctype)
+    {
+        PcieReconfigLaneNum (soctype, HostBridgeNum, Port, PcieCfg);
+    }
+
+    return EFI_SUCCESS;
+}
+
 EFI_STATUS PcieDisableItssm(UINT32 soctype, UINT32 HostBridgeNum, UINT32 Port)
 {
     PCIE_CTRL_7_U pcie_ctrl7;
@@ -1127,9 +1152,12 @@ SwitchPcieASPMSupport (
   PcieDbiCs2Enable (HostBridgeNum, Port, TRUE);
 }
 
+/*
+ * Bring a port out of reset, configure it and start its link training,
+ * without waiting for the link to come up.
+ */
 EFI_STATUS
-EFIAPI
-PciePortInit (
+PciePortStartLink (
   IN UINT32                 soctype,
   IN UINT32                 HostBridgeNum,
   IN PCIE_DRIVER_CFG        *PcieCfg
@@ -1193,7 +1221,7 @@ PciePortInit (
      /* Disable RC Option Rom */
      DisableRcOptionRom (soctype, HostBridgeNum, PortIndex, PcieCfg->PortInfo.PortType);
      /* assert LTSSM enable */
-     (VOID)PcieEnableItssm (soctype, HostBridgeNum, PortIndex, PcieCfg);
+     (VOID)PcieStartItssm (soctype, HostBridgeNum, PortIndex);
 
      PcieConfigContextHi1610(soctype, HostBridgeNum, PortIndex);
      /*
@@ -1204,6 +1232,57 @@ PciePortInit (
      */
      PcieRegWrite(PortIndex, 0x10, 0);
      (VOID)PcieWriteOwnConfig(HostBridgeNum, PortIndex, 0xa, 0x0604);
+
+     return EFI_SUCCESS;
+}
+
+/*
+ * Finish the initialization of a port whose link is up.
+ */
+STATIC
+VOID
+PciePortLinkUp (
+  IN UINT32                 soctype,
+  IN UINT32                 HostBridgeNum,
+  IN UINT32                 PortIndex
+  )
+{
+     DEBUG((EFI_D_INFO, "HostBridge %d, Port %d Link up ok\n", HostBridgeNum, PortIndex));
+
+     /* RegResource is per port index, and may since refer to another host bridge */
+     if (0x1610 == soctype)
+     {
+         mPcieIntCfg.RegResource[PortIndex] = (VOID *)PCIE_APB_SLAVE_BASE_1610[HostBridgeNum][PortIndex];
+     }
+     else
+     {
+         mPcieIntCfg.RegResource[PortIndex] = (VOID *)(UINTN)PCIE_REG_BASE(HostBridgeNum, PortIndex);
+     }
+     PcieRegWrite(PortIndex, 0x8BC, 0);
+}
+
+EFI_STATUS
+EFIAPI
+PciePortInit (
+  IN UINT32                 soctype,
+  IN UINT32                 HostBridgeNum,
+  IN PCIE_DRIVER_CFG        *PcieCfg
+  )
+{
+     EFI_STATUS          Status;
+     UINT16              Count = 0;
+     UINT32             PortIndex = PcieCfg->PortIndex;
+
+     Status = PciePortStartLink (soctype, HostBridgeNum, PcieCfg);
+     if (EFI_ERROR (Status)) {
+        return Status;
+     }
+
+     if (0x1610 == soctype)
+     {
+         PcieReconfigLaneNum (soctype, HostBridgeNum, PortIndex, PcieCfg);
+     }
+
      /* check if the link is up or not */
      while (!PcieIsLinkUp(soctype, HostBridgeNum, PortIndex)) {
          MicroSecondDelay(1000);
@@ -1213,13 +1292,111 @@ PciePortInit (
             return PCIE_ERR_LINK_OVER_TIME;
          }
      }
-     DEBUG((EFI_D_INFO, "HostBridge %d, Port %d Link up ok\n", HostBridgeNum, PortIndex));
 
-     PcieRegWrite(PortIndex, 0x8BC, 0);
+     PciePortLinkUp (soctype, HostBridgeNum, PortIndex);
 
      return EFI_SUCCESS;
 }
 
+/*
+ * Wait for the links of several ports, whose training has been started by
+ * PciePortStartLink, to come up, against a single deadline. The lane number
+ * is reconfigured on the way for the ports that need it, as
+ * PcieReconfigLaneNum does for a single port.
+ */
+EFI_STATUS
+PcieWaitPortsLinkUp (
+  IN UINT32                 soctype,
+  IN PCIE_PORT_LINK_STATE   *Ports,
+  IN UINT32                 PortCount
+  )
+{
+     EFI_STATUS          Status;
+     PCIE_PORT_LINK_STATE *State;
+     UINT32              Pending;
+     UINT32              Index;
+     UINT32              Elapsed;
+     UINT32              LtssmStatus;
+     UINT32              RegVal;
+     UINT32              PortIndex;
+
+     Pending = 0;
+     for (Index = 0; Index < PortCount; Index++) {
+        if (Ports[Index].Pending) {
+            Pending++;
+        }
+     }
+
+     for (Elapsed = 0;
+          (Pending > 0) && (Elapsed < PCIE_LINK_UP_TIMEOUT_US);
+          Elapsed += PCIE_LINK_POLL_INTERVAL_US) {
+        for (Index = 0; Index < PortCount; Index++) {
+            State = &Ports[Index];
+            if (!State->Pending) {
+                continue;
+            }
+            PortIndex = State->PcieCfg.PortIndex;
+
+            if (PcieIsLinkUp(soctype, State->HostBridgeNum, PortIndex)) {
+                PciePortLinkUp (soctype, State->HostBridgeNum, PortIndex);
+                State->Pending = FALSE;
+                Pending--;
+                continue;
+            }
+
+            if ((0x1610 != soctype) ||
+                (Elapsed >= PCIE_LANE_NUM_CHECK_US) ||
+                (State->PcieCfg.PortInfo.PortWidth <= 1)) {
+                continue;
+            }
+
+            /*
+             * Check the lane num config state is normal or not, see
+             * PcieReconfigLaneNum.
+             */
+            PcieGetLtssmValue (State->HostBridgeNum, PortIndex, &LtssmStatus);
+            if ((LtssmStatus == PCIE_LTSSM_CFG_LANENUM_ACPT) || (LtssmStatus == PCIE_LTSSM_CFG_COMPLETE)) {
+                State->LaneNumCnt++;
+            } else {
+                State->LaneNumCnt = 0;
+            }
+
+            if (State->LaneNumCnt > MAX_TRY_LINK_NUM) {
+                /* Disable LTSSM */
+                RegRead (PCIE_APB_SLAVE_BASE_1610[State->HostBridgeNum][PortIndex] + PCIE_CTRL_7_REG, RegVal);
+                RegVal &= ~(LTSSM_ENABLE);
+                RegWrite (PCIE_APB_SLAVE_BASE_1610[State->HostBridgeNum][PortIndex] + PCIE_CTRL_7_REG, RegVal);
+                /* Decrease the PortWidth and try to link again */
+                State->PcieCfg.PortInfo.PortWidth = (PCIE_PORT_WIDTH)((UINT8)State->PcieCfg.PortInfo.PortWidth >> 1);
+                State->LaneNumCnt = 0;
+
+                Status = PciePortStartLink (soctype, State->HostBridgeNum, &State->PcieCfg);
+                if (EFI_ERROR(Status)) {
+                    DEBUG ((DEBUG_ERROR, "PcieReconfigLanenum HostBridge %d, Pcie Port %d Init Failed! \n", State->HostBridgeNum, PortIndex));
+                    State->Pending = FALSE;
+                    Pending--;
+                }
+            }
+        }
+
+        if (Pending > 0) {
+            MicroSecondDelay (PCIE_LINK_POLL_INTERVAL_US);
+        }
+     }
+
+     if (Pending == 0) {
+        return EFI_SUCCESS;
+     }
+
+     for (Index = 0; Index < PortCount; Index++) {
+        if (Ports[Index].Pending) {
+            DEBUG((EFI_D_ERROR, "HostBridge %d, Port %d link up failed\n",
+              Ports[Index].HostBridgeNum, Ports[Index].PcieCfg.PortIndex));
+        }
+     }
+     return PCIE_ERR_LINK_OVER_TIME;
+}
+
 
 
 
@@ -240,4 +240,21 @@ EFI_STATUS PcieWaitLinkUp(UINT32 Port);
 
 EFI_STATUS PcieSetDBICS2Enable(UINT32 HostBridgeNum, UINT32 Port, UINT32 Enable);
 
+/* Deadline shared by all the ports whose links are trained together */
+#define PCIE_LINK_UP_TIMEOUT_US      1000000
+#define PCIE_LINK_POLL_INTERVAL_US   200
+/* Time during which the lane number may be reconfigured */
+#define PCIE_LANE_NUM_CHECK_US       100000
+
+typedef struct {
+    UINT32          HostBridgeNum;
+    PCIE_DRIVER_CFG PcieCfg;
+    UINT32          LaneNumCnt;
+    BOOLEAN         Pending;
+} PCIE_PORT_LINK_STATE;
+
+EFI_STATUS PciePortStartLink(UINT32 soctype, UINT32 HostBridgeNum, PCIE_DRIVER_CFG *PcieCfg);
+
+EFI_STATUS PcieWaitPortsLinkUp(UINT32 soctype, PCIE_PORT_LINK_STATE *Ports, UINT32 PortCount);
+
 #endif
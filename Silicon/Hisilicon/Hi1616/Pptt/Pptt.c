@@ -28,6 +28,13 @@ EFI_ACPI_6_2_PPTT_STRUCTURE_ID mPpttSocketType2[PPTT_SOCKET_COMPONENT_NO] =
 
 EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE mPpttCacheType1[PPTT_CACHE_NO];
 
+//
+// Table offsets of the cache and ID structures. Each one is emitted once and
+// then referenced by every processor node it describes a resource of.
+//
+STATIC UINT32 mCacheOffset[PPTT_CACHE_NO];
+STATIC UINT32 mSocketIdOffset[PPTT_SOCKET_COMPONENT_NO];
+
 
 STATIC
 VOID
@@ -119,6 +126,51 @@ InitCacheInfo (
   }
 }
 
+/**
+  Get the offset of the cache type structure for mPpttCacheType1[Index],
+  appending it to the table the first time it is referenced.
+
+  @param[in, out] PpttTable              The table being built.
+  @param[in, out] PpttTableLengthRemain  Space left in the table.
+  @param[in]      Index                  Index in mPpttCacheType1.
+  @param[in]      NextLevelOfCache       Offset of the next level cache, only
+                                         used when the structure is emitted.
+
+  @return The offset of the structure, or 0 if the table is full.
+**/
+STATIC
+UINT32
+AddCacheTable (
+  IN     EFI_ACPI_DESCRIPTION_HEADER *PpttTable,
+  IN OUT UINT32                      *PpttTableLengthRemain,
+  IN     UINT8                       Index,
+  IN     UINT32                      NextLevelOfCache
+  )
+{
+  EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE     *PpttType1;
+
+  if (mCacheOffset[Index] != 0) {
+    return mCacheOffset[Index];
+  }
+
+  if (*PpttTableLengthRemain < sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE)) {
+    return 0;
+  }
+  mCacheOffset[Index] = PpttTable->Length;
+  PpttType1 = (EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE *)((UINT8 *)PpttTable +
+                                                    PpttTable->Length);
+  gBS->CopyMem (
+         PpttType1,
+         &mPpttCacheType1[Index],
+         sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE)
+         );
+  PpttType1->NextLevelOfCache = NextLevelOfCache;
+  *PpttTableLengthRemain -= PpttType1->Length;
+  PpttTable->Length += PpttType1->Length;
+
+  return mCacheOffset[Index];
+}
+
 STATIC
 EFI_STATUS
 AddCoreTable (
@@ -130,7 +182,6 @@ AddCoreTable (
   )
 {
   EFI_ACPI_6_2_PPTT_STRUCTURE_PROCESSOR *PpttType0;
-  EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE     *PpttType1;
   UINT32                                *PrivateResource;
   UINT8                                 Index;
 
@@ -154,21 +205,17 @@ AddCoreTable (
   PrivateResource = (UINT32 *)((UINT8 *)PpttType0 +
                                sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_PROCESSOR));
 
-  // Add cache type structure
+  // Reference the cache type structures shared by all cores
   for (Index = 0; Index < ResourceNo; Index++, PrivateResource++) {
-    if (*PpttTableLengthRemain < sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE)) {
+    *PrivateResource = AddCacheTable (
+                         PpttTable,
+                         PpttTableLengthRemain,
+                         Index,
+                         0
+                         );
+    if (*PrivateResource == 0) {
       return EFI_OUT_OF_RESOURCES;
     }
-    *PrivateResource = PpttTable->Length;
-    PpttType1 = (EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE *)((UINT8 *)PpttTable +
-                                                      PpttTable->Length);
-    gBS->CopyMem (
-           PpttType1,
-           &mPpttCacheType1[Index],
-           sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE)
-           );
-    *PpttTableLengthRemain -= PpttType1->Length;
-    PpttTable->Length += PpttType1->Length;
   }
 
   return EFI_SUCCESS;
@@ -184,7 +231,6 @@ AddClusterTable (
   )
 {
   EFI_ACPI_6_2_PPTT_STRUCTURE_PROCESSOR *PpttType0;
-  EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE     *PpttType1;
   UINT32                                *PrivateResource;
 
   if ((*PpttTableLengthRemain) <
@@ -205,20 +251,11 @@ AddClusterTable (
   PrivateResource = (UINT32 *)((UINT8 *)PpttType0 +
                                sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_PROCESSOR));
 
-  // Add cache type structure
-  if (*PpttTableLengthRemain < sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE)) {
+  // Reference the cache type structure
+  *PrivateResource = AddCacheTable (PpttTable, PpttTableLengthRemain, 2, 0);
+  if (*PrivateResource == 0) {
     return EFI_OUT_OF_RESOURCES;
   }
-  *PrivateResource = PpttTable->Length;
-  PpttType1 = (EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE *)((UINT8 *)PpttTable +
-                                                    PpttTable->Length);
-  gBS->CopyMem (
-         PpttType1,
-         &mPpttCacheType1[2],
-         sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE)
-         );
-  *PpttTableLengthRemain -= PpttType1->Length;
-  PpttTable->Length += PpttType1->Length;
 
   return EFI_SUCCESS;
 }
@@ -233,7 +270,6 @@ AddScclTable (
   )
 {
   EFI_ACPI_6_2_PPTT_STRUCTURE_PROCESSOR *PpttType0;
-  EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE     *PpttType1;
   UINT32                                *PrivateResource;
 
   if (*PpttTableLengthRemain <
@@ -254,20 +290,11 @@ AddScclTable (
   PrivateResource = (UINT32 *)((UINT8 *)PpttType0 +
                                sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_PROCESSOR));
 
-  // Add cache type structure
-  if (*PpttTableLengthRemain < sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE)) {
+  // Reference the cache type structure
+  *PrivateResource = AddCacheTable (PpttTable, PpttTableLengthRemain, 3, 0);
+  if (*PrivateResource == 0) {
     return EFI_OUT_OF_RESOURCES;
   }
-  *PrivateResource = PpttTable->Length;
-  PpttType1 = (EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE *)((UINT8 *)PpttTable +
-                                                    PpttTable->Length);
-  gBS->CopyMem (
-         PpttType1,
-         &mPpttCacheType1[3],
-         sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE)
-         );
-  *PpttTableLengthRemain -= PpttType1->Length;
-  PpttTable->Length += PpttType1->Length;
 
   return EFI_SUCCESS;
 }
@@ -311,19 +338,22 @@ AddSocketTable (
           sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_ID)));
 
   for (Index = 0; Index < ResourceNo; Index++, PrivateResource++) {
-    if (*PpttTableLengthRemain < sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_ID)) {
-      return EFI_OUT_OF_RESOURCES;
+    if (mSocketIdOffset[Index] == 0) {
+      if (*PpttTableLengthRemain < sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_ID)) {
+        return EFI_OUT_OF_RESOURCES;
+      }
+      mSocketIdOffset[Index] = PpttTable->Length;
+      PpttType2 = (EFI_ACPI_6_2_PPTT_STRUCTURE_ID *)((UINT8 *)PpttTable +
+                                                     PpttTable->Length);
+      gBS->CopyMem (
+             PpttType2,
+             &mPpttSocketType2[Index],
+             sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_ID)
+             );
+      *PpttTableLengthRemain -= PpttType2->Length;
+      PpttTable->Length += PpttType2->Length;
     }
-    *PrivateResource = PpttTable->Length;
-    PpttType2 = (EFI_ACPI_6_2_PPTT_STRUCTURE_ID *)((UINT8 *)PpttTable +
-                                                   PpttTable->Length);
-    gBS->CopyMem (
-           PpttType2,
-           &mPpttSocketType2[Index],
-           sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_ID)
-           );
-    *PpttTableLengthRemain -= PpttType2->Length;
-    PpttTable->Length += PpttType2->Length;
+    *PrivateResource = mSocketIdOffset[Index];
   }
 
   return EFI_SUCCESS;
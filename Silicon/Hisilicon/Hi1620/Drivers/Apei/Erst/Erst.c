@@ -328,6 +328,14 @@ ErstHeaderCreator (
   ERST_RT_CONTEXT       *ErstRtCtx;
   //
   ErstRtCtx = AllocateReservedZeroPool (sizeof (ERST_RT_CONTEXT));
+  if (ErstRtCtx == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+  ErstRtCtx->ErrorLogAddressRange = (UINT64)AllocateReservedZeroPool (BufferSize);
+  if (ErstRtCtx->ErrorLogAddressRange == 0) {
+    FreePool (ErstRtCtx);
+    return EFI_OUT_OF_RESOURCES;
+  }
   ErstRtCtx->Operation = ERST_END_OPERATION;
   ErstRtCtx->RecordOffset = 0;
   ErstRtCtx->BusyStatus = 0;
@@ -335,7 +343,6 @@ ErstHeaderCreator (
   ErstRtCtx->KeyRecordId = 0;
   ErstRtCtx->MaxTimeOfExecuteOperation = MAX_UINT64;
   ErstRtCtx->RecordCount = 0;
-  ErstRtCtx->ErrorLogAddressRange = (UINT64)AllocateReservedZeroPool (BufferSize);
   ErstRtCtx->ErrorLogAddressRangeLength = BufferSize;
   ErstRtCtx->ErrorLogAttributes = 0;
   ErstRtCtx->NvRamLogAddrRange = NvRamAddrRange;
@@ -289,19 +289,28 @@ GetNvRamRegion (
 )
 {
   UINT32 Store = ERST_RECORD_STORE_IN_MEM;
+
+  * NvRamAddrRange = NULL;
+  * NvRamAddrRangeLength = 0;
   switch (Store) {
     case (ERST_RECORD_STORE_IN_NVRAM):
       break;
     case (ERST_RECORD_STORE_IN_MEM):
-      * NvRamAddrRangeLength = ERST_DATASTORE_SIZE;
+      //
+      // The whole record store is reserved once here and records are only
+      // appended to it by the trusted firmware, nothing is erased per record.
+      //
       * NvRamAddrRange = AllocateReservedZeroPool (ERST_DATASTORE_SIZE);
+      if (* NvRamAddrRange != NULL) {
+        * NvRamAddrRangeLength = ERST_DATASTORE_SIZE;
+      }
       break;
     case (ERST_RECORD_STORE_IN_SPI_FLASH):
       break;
     default:
       ;
   }
-  return TRUE;
+  return (* NvRamAddrRange != NULL);
 }
 
 /***OEM***/
@@ -316,7 +325,10 @@ OemInitErstTable (
   UINT64            NvRamAddrRangeLength;
   UINT64            NvRamAllRecordLength;
 
-  GetNvRamRegion (&NvRamAddrRange, &NvRamAddrRangeLength);
+  if (!GetNvRamRegion (&NvRamAddrRange, &NvRamAddrRangeLength)) {
+    DEBUG ((DEBUG_ERROR, "[%a]:[%dL]: No ERST record store\n", __FUNCTION__, __LINE__));
+    return EFI_OUT_OF_RESOURCES;
+  }
   NvRamAllRecordLength = 0;
   Status = ErstHeaderCreator (
              &Context,
@@ -324,6 +336,10 @@ OemInitErstTable (
              NvRamAddrRange,
              NvRamAllRecordLength,
              NvRamAddrRangeLength);
+  if (EFI_ERROR (Status)) {
+    FreePool (NvRamAddrRange);
+    return Status;
+  }
   OemErstConfigExecuteOperationEntry (&Context);
   mApeiTrustedfirmwareData->ErstContext = (VOID*)Context.Rt;
   ErstSetAcpiTable (&Context);
@@ -31,6 +31,13 @@ EFI_ACPI_6_2_PPTT_STRUCTURE_ID mPpttSocketType2[PPTT_SOCKET_COMPONENT_NO] =
 
 EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE mPpttCacheType1[PPTT_CACHE_NO];
 
+//
+// Table offsets of the cache and ID structures. Each one is emitted once and
+// then referenced by every processor node it describes a resource of.
+//
+STATIC UINT32 mCacheOffset[PPTT_CACHE_NO];
+STATIC UINT32 mSocketIdOffset[PPTT_SOCKET_COMPONENT_NO];
+
 STATIC UINT32 mSocketOffset[MAX_SOCKET];
 STATIC UINT32 mScclOffset[MAX_SCL];
 STATIC UINT32 mClusterOffset[MAX_SCL][MAX_CLUSTER_PER_SCL];
@@ -125,6 +132,51 @@ InitCacheInfo (
   }
 }
 
+/**
+  Get the offset of the cache type structure for mPpttCacheType1[Index],
+  appending it to the table the first time it is referenced.
+
+  @param[in, out] PpttTable              The table being built.
+  @param[in, out] PpttTableLengthRemain  Space left in the table.
+  @param[in]      Index                  Index in mPpttCacheType1.
+  @param[in]      NextLevelOfCache       Offset of the next level cache, only
+                                         used when the structure is emitted.
+
+  @return The offset of the structure, or 0 if the table is full.
+**/
+STATIC
+UINT32
+AddCacheTable (
+  IN     EFI_ACPI_DESCRIPTION_HEADER *PpttTable,
+  IN OUT UINT32                      *PpttTableLengthRemain,
+  IN     UINT8                       Index,
+  IN     UINT32                      NextLevelOfCache
+  )
+{
+  EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE     *PpttType1;
+
+  if (mCacheOffset[Index] != 0) {
+    return mCacheOffset[Index];
+  }
+
+  if (*PpttTableLengthRemain < sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE)) {
+    return 0;
+  }
+  mCacheOffset[Index] = PpttTable->Length;
+  PpttType1 = (EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE *)((UINT8 *)PpttTable +
+                                                    PpttTable->Length);
+  gBS->CopyMem (
+         PpttType1,
+         &mPpttCacheType1[Index],
+         sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE)
+         );
+  PpttType1->NextLevelOfCache = NextLevelOfCache;
+  *PpttTableLengthRemain -= PpttType1->Length;
+  PpttTable->Length += PpttType1->Length;
+
+  return mCacheOffset[Index];
+}
+
 STATIC
 EFI_STATUS
 AddCoreTable (
@@ -136,7 +188,6 @@ AddCoreTable (
   )
 {
   EFI_ACPI_6_2_PPTT_STRUCTURE_PROCESSOR *PpttType0;
-  EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE     *PpttType1;
   UINT32                                *PrivateResource;
   UINT8                                 Index;
   UINT32                                NextLevelCacheOffset;
@@ -161,30 +212,32 @@ AddCoreTable (
   PrivateResource = (UINT32 *)((UINT8 *)PpttType0 +
                                sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_PROCESSOR));
 
-  // Add cache type structure
-  for (Index = 0; Index < ResourceNo; Index++, PrivateResource++) {
-    if (*PpttTableLengthRemain < sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE)) {
+  // The L1 caches point at L2, so L2 is emitted first
+  NextLevelCacheOffset = 0;
+  if (ResourceNo > 2) {
+    NextLevelCacheOffset = AddCacheTable (
+                             PpttTable,
+                             PpttTableLengthRemain,
+                             2,
+                             0
+                             );
+    if (NextLevelCacheOffset == 0) {
       return EFI_OUT_OF_RESOURCES;
     }
-    *PrivateResource = PpttTable->Length;
-    PpttType1 = (EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE *)((UINT8 *)PpttTable +
-                                                      PpttTable->Length);
-    gBS->CopyMem (
-           PpttType1,
-           &mPpttCacheType1[Index],
-           sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE)
-           );
-    *PpttTableLengthRemain -= PpttType1->Length;
-    PpttTable->Length += PpttType1->Length;
   }
 
-  NextLevelCacheOffset = *(PrivateResource - 1);
-  PrivateResource = (UINT32 *)(PpttType0 + 1);
-  // Set the next level to L2 for L1I and L1D
-  PpttType1 = (EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE *)((UINT8 *) PpttTable + *PrivateResource++);
-  PpttType1->NextLevelOfCache = NextLevelCacheOffset;
-  PpttType1 = (EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE *)((UINT8 *) PpttTable + *PrivateResource++);
-  PpttType1->NextLevelOfCache = NextLevelCacheOffset;
+  // Reference the cache type structures shared by all cores
+  for (Index = 0; Index < ResourceNo; Index++, PrivateResource++) {
+    *PrivateResource = AddCacheTable (
+                         PpttTable,
+                         PpttTableLengthRemain,
+                         Index,
+                         (Index < 2) ? NextLevelCacheOffset : 0
+                         );
+    if (*PrivateResource == 0) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+  }
 
   return EFI_SUCCESS;
 }
@@ -229,7 +282,6 @@ AddScclTable (
   )
 {
   EFI_ACPI_6_2_PPTT_STRUCTURE_PROCESSOR *PpttType0;
-  EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE     *PpttType1;
   UINT32                                *PrivateResource;
 
   if (*PpttTableLengthRemain <
@@ -250,20 +302,11 @@ AddScclTable (
   PrivateResource = (UINT32 *)((UINT8 *)PpttType0 +
                                sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_PROCESSOR));
 
-  // Add cache type structure
-  if (*PpttTableLengthRemain < sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE)) {
+  // Reference the cache type structure
+  *PrivateResource = AddCacheTable (PpttTable, PpttTableLengthRemain, 3, 0);
+  if (*PrivateResource == 0) {
     return EFI_OUT_OF_RESOURCES;
   }
-  *PrivateResource = PpttTable->Length;
-  PpttType1 = (EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE *)((UINT8 *)PpttTable +
-                                                    PpttTable->Length);
-  gBS->CopyMem (
-         PpttType1,
-         &mPpttCacheType1[3],
-         sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_CACHE)
-         );
-  *PpttTableLengthRemain -= PpttType1->Length;
-  PpttTable->Length += PpttType1->Length;
 
   return EFI_SUCCESS;
 }
@@ -307,19 +350,22 @@ AddSocketTable (
           sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_ID)));
 
   for (Index = 0; Index < ResourceNo; Index++, PrivateResource++) {
-    if (*PpttTableLengthRemain < sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_ID)) {
-      return EFI_OUT_OF_RESOURCES;
+    if (mSocketIdOffset[Index] == 0) {
+      if (*PpttTableLengthRemain < sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_ID)) {
+        return EFI_OUT_OF_RESOURCES;
+      }
+      mSocketIdOffset[Index] = PpttTable->Length;
+      PpttType2 = (EFI_ACPI_6_2_PPTT_STRUCTURE_ID *)((UINT8 *)PpttTable +
+                                                     PpttTable->Length);
+      gBS->CopyMem (
+             PpttType2,
+             &mPpttSocketType2[Index],
+             sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_ID)
+             );
+      *PpttTableLengthRemain -= PpttType2->Length;
+      PpttTable->Length += PpttType2->Length;
     }
-    *PrivateResource = PpttTable->Length;
-    PpttType2 = (EFI_ACPI_6_2_PPTT_STRUCTURE_ID *)((UINT8 *)PpttTable +
-                                                   PpttTable->Length);
-    gBS->CopyMem (
-           PpttType2,
-           &mPpttSocketType2[Index],
-           sizeof (EFI_ACPI_6_2_PPTT_STRUCTURE_ID)
-           );
-    *PpttTableLengthRemain -= PpttType2->Length;
-    PpttTable->Length += PpttType2->Length;
+    *PrivateResource = mSocketIdOffset[Index];
   }
 
   return EFI_SUCCESS;
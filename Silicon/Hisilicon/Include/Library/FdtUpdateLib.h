@@ -32,7 +32,99 @@ typedef struct
   UINT8 data5;
 }MAC_ADDRESS;
 
-extern  EFI_STATUS EFIFdtUpdate(UINTN FdtFileAddr);
+//
+// Maximum number of property updates in one batch
+//
+#define FDT_UPDATE_MAX_PROPERTIES  16
+
+//
+// A property to set. The node is given by its full path, and is created if
+// it does not exist yet. Value must stay valid until the batch is applied.
+//
+typedef struct
+{
+  CONST CHAR8   *NodePath;
+  CONST CHAR8   *Property;
+  CONST VOID    *Value;
+  UINT32        Length;
+}FDT_UPDATE_PROPERTY;
+
+typedef struct
+{
+  UINTN                 Count;
+  FDT_UPDATE_PROPERTY   Property[FDT_UPDATE_MAX_PROPERTIES];
+}FDT_UPDATE_BATCH;
+
+/**
+  Add a property update to a batch.
+
+  @param[in, out]  Batch     The batch to add the update to.
+  @param[in]       NodePath  Full path of the node holding the property.
+  @param[in]       Property  Name of the property.
+  @param[in]       Value     Value of the property.
+  @param[in]       Length    Length of Value in bytes.
+
+  @retval EFI_SUCCESS           The update was added to the batch.
+  @retval EFI_OUT_OF_RESOURCES  The batch is full.
+**/
+EFI_STATUS
+FdtUpdateBatchAdd (
+  IN OUT FDT_UPDATE_BATCH  *Batch,
+  IN     CONST CHAR8       *NodePath,
+  IN     CONST CHAR8       *Property,
+  IN     CONST VOID        *Value,
+  IN     UINT32            Length
+  );
+
+/**
+  Return the size an FDT needs once a batch of updates is applied to it.
+
+  @param[in]  Fdt    The FDT the batch is to be applied to.
+  @param[in]  Batch  The batch of updates.
+
+  @return  An upper bound of the size of the updated FDT.
+**/
+UINTN
+FdtUpdateBatchSize (
+  IN CONST VOID              *Fdt,
+  IN CONST FDT_UPDATE_BATCH  *Batch
+  );
+
+/**
+  Apply a batch of updates to an FDT.
+
+  The FDT must have been opened into a buffer of at least the size returned
+  by FdtUpdateBatchSize (). Properties whose length is unchanged are updated
+  in place, so that only the properties that grow or shrink move the rest
+  of the blob.
+
+  @param[in, out]  Fdt    The FDT to update.
+  @param[in]       Batch  The batch of updates.
+
+  @retval EFI_SUCCESS            All the updates were applied.
+  @retval EFI_INVALID_PARAMETER  At least one update could not be applied.
+**/
+EFI_STATUS
+FdtUpdateBatchApply (
+  IN OUT VOID                    *Fdt,
+  IN     CONST FDT_UPDATE_BATCH  *Batch
+  );
+
+/**
+  Create the updated platform FDT.
+
+  All the updates are collected first, the size of the updated FDT is then
+  computed, and the FDT is copied once into a buffer of that size, in
+  runtime services data, where the updates are applied.
+
+  @param[in]   FdtFileAddr     Address of the FDT to update.
+  @param[out]  NewFdtBlob      Address of the updated FDT.
+  @param[out]  NewFdtBlobSize  Size of the buffer holding the updated FDT.
+
+  @retval EFI_SUCCESS  The updated FDT was created.
+  @retval Others       The updated FDT could not be created.
+**/
+extern  EFI_STATUS EFIFdtUpdate(UINTN FdtFileAddr, VOID **NewFdtBlob, UINTN *NewFdtBlobSize);
 
 #endif
 
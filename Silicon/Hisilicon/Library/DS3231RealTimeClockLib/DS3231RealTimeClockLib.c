@@ -37,6 +37,63 @@ extern I2C_DEVICE gRtcDevice;
 
 STATIC BOOLEAN       mDS3231Initialized = FALSE;
 
+//
+// The time last read from the DS3231 and the generic timer count at that
+// point, so that GetTime does not need an I2C transfer on every call. The
+// RTC is read again once PcdRtcTimeCacheSeconds have passed or after SetTime.
+//
+STATIC BOOLEAN       mTimeCacheValid = FALSE;
+STATIC UINTN         mTimeCacheEpoch;
+STATIC UINT64        mTimeCacheCounter;
+STATIC INT16         mTimeCacheTimeZone;
+STATIC UINT8         mTimeCacheDaylight;
+
+STATIC
+BOOLEAN
+GetCachedTime (
+  OUT EFI_TIME                *Time
+  )
+{
+  UINT64  Elapsed;
+
+  if (!mTimeCacheValid) {
+    return FALSE;
+  }
+
+  Elapsed = DivU64x32 (
+              GetTimeInNanoSecond (GetPerformanceCounter () - mTimeCacheCounter),
+              1000000000
+              );
+  if (Elapsed >= FixedPcdGet32 (PcdRtcTimeCacheSeconds)) {
+    mTimeCacheValid = FALSE;
+    return FALSE;
+  }
+
+  EpochToEfiTime (mTimeCacheEpoch + (UINTN)Elapsed, Time);
+  Time->Nanosecond = 0;
+  Time->TimeZone   = mTimeCacheTimeZone;
+  Time->Daylight   = mTimeCacheDaylight;
+
+  return TRUE;
+}
+
+STATIC
+VOID
+UpdateTimeCache (
+  IN  EFI_TIME                *Time
+  )
+{
+  if (FixedPcdGet32 (PcdRtcTimeCacheSeconds) == 0) {
+    return;
+  }
+
+  mTimeCacheEpoch    = EfiTimeToEpoch (Time);
+  mTimeCacheCounter  = GetPerformanceCounter ();
+  mTimeCacheTimeZone = Time->TimeZone;
+  mTimeCacheDaylight = Time->Daylight;
+  mTimeCacheValid    = TRUE;
+}
+
 EFI_STATUS
 IdentifyDS3231 (
   VOID
@@ -129,6 +186,10 @@ LibGetTime (
     return EFI_INVALID_PARAMETER;
   }
 
+  if (GetCachedTime (Time)) {
+    return EFI_SUCCESS;
+  }
+
   // Initialize the hardware if not already done
   if (!mDS3231Initialized) {
     Status = InitializeDS3231 ();
@@ -189,6 +250,8 @@ LibGetTime (
     return EFI_DEVICE_ERROR;
   }
 
+  UpdateTimeCache (Time);
+
   return EFI_SUCCESS;
 }
 
@@ -219,6 +282,8 @@ LibSetTime (
     return EFI_INVALID_PARAMETER;
   }
 
+  mTimeCacheValid = FALSE;
+
   // Initialize the hardware if not already done
   if (!mDS3231Initialized) {
     Status = InitializeDS3231 ();
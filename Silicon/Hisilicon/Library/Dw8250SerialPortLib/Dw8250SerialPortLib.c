@@ -17,6 +17,51 @@
 #include "Dw8250SerialPortLib.h"
 
 
+/**
+  Return the depth of the transmit FIFO, or 1 if the FIFOs are disabled or
+  their depth cannot be determined.
+**/
+STATIC
+UINTN
+SerialPortTxFifoDepth (
+  VOID
+  )
+{
+  UINTN  FifoMode;
+
+  if ((MmioRead8 (UART_IIR_REG) & UART_IIR_FIFOSE) != UART_IIR_FIFOSE) {
+    return 1;
+  }
+
+  FifoMode = UART_CPR_FIFO_MODE (MmioRead32 (UART_CPR_REG));
+  if (FifoMode == 0) {
+    return 1;
+  }
+
+  return FifoMode * UART_CPR_FIFO_UNIT;
+}
+
+/**
+  Wait until the transmit FIFO has drained, giving up after UART_SEND_DELAY
+  polls like SerialPortWriteChar () does.
+**/
+STATIC
+VOID
+SerialPortWaitTxFifoEmpty (
+  VOID
+  )
+{
+  UINT32 ulLoop = 0;
+
+  while (ulLoop < (UINT32)UART_SEND_DELAY) {
+    if ((MmioRead8 (UART_USR_REG) & UART_USR_TFE) == UART_USR_TFE) {
+      break;
+    }
+    ulLoop++;
+  }
+}
+
+
 /**
   Initialize the serial device hardware.
 
@@ -78,6 +123,8 @@ SerialPortWrite (
 )
 {
   UINTN  Result;
+  UINTN  FifoDepth;
+  UINTN  Count;
 
   if (NULL == Buffer) {
     return 0;
@@ -85,10 +132,20 @@ SerialPortWrite (
 
   Result = NumberOfBytes;
 
-  while (NumberOfBytes--) {
+  //
+  // Refill the whole transmit FIFO each time it runs empty instead of
+  // waiting for every single byte to leave the shift register.
+  //
+  FifoDepth = SerialPortTxFifoDepth ();
+
+  while (NumberOfBytes > 0) {
+    SerialPortWaitTxFifoEmpty ();
 
-    SerialPortWriteChar(*Buffer);
-    Buffer++;
+    for (Count = 0; Count < FifoDepth && NumberOfBytes > 0; Count++) {
+      MmioWrite8 (UART_THR_REG, *Buffer);
+      Buffer++;
+      NumberOfBytes--;
+    }
   }
 
   return Result;
@@ -30,6 +30,7 @@
 #define UART_LCR_REG         (SERIAL_0_BASE_ADR + UART_LCR)
 #define UART_LSR_REG         (SERIAL_0_BASE_ADR + UART_LSR)
 #define UART_USR_REG         (SERIAL_0_BASE_ADR + UART_USR)
+#define UART_CPR_REG         (SERIAL_0_BASE_ADR + UART_CPR)
 
 
 #define UART_RBR     0x00
@@ -43,6 +44,7 @@
 #define UART_MCR     0x10
 #define UART_LSR     0x14
 #define UART_USR     0x7C
+#define UART_CPR     0xF4
 
 /* register definitions */
 
@@ -100,6 +102,12 @@
 
 
 #define UART_USR_BUSY  0x01
+#define UART_USR_TFNF  0x02
+#define UART_USR_TFE   0x04
+
+/* CPR reads as zero when the component parameter register is not built in */
+#define UART_CPR_FIFO_MODE(Cpr)   (((Cpr) >> 16) & 0xFF)
+#define UART_CPR_FIFO_UNIT        16
 
 #define FIFO_MAXSIZE    32
 
@@ -17,6 +17,14 @@
 #define I2C_EXTENDER_PORT_HNS        5
 
 #define I2C_READ_TIMEOUT             500
+//
+// Time budgets of the polling loops, in microseconds. The loops poll at the
+// pace given by the timing table of the configured speed, so these only
+// bound how long a stuck bus is waited for.
+//
+#define I2C_ENABLE_TIMEOUT_US        (I2C_READ_TIMEOUT * 10000)
+#define I2C_FIFO_TIMEOUT_US          (I2C_READ_TIMEOUT * 2)
+#define I2C_EXTENDER_TIMEOUT_US      (I2C_READ_TIMEOUT * 1000)
 #define I2C_DRV_ONCE_WRITE_BYTES_NUM 8
 #define I2C_DRV_ONCE_READ_BYTES_NUM  8
 #define I2C_READ_SIGNAL              0x0100
@@ -25,6 +25,37 @@
 #define I2C_100KB_SPEED 0x1
 #define I2C_400KB_SPEED 0x2
 
+//
+// Bus timing per speed mode. Status polling is paced at the time a single
+// bit takes on the bus, which is the finest granularity at which FIFO levels
+// can change, and the enable state is sampled at the interval the controller
+// needs to synchronize it to the bus clock.
+//
+typedef struct {
+  UINT32 BitTime;       // us per SCL period, rounded up
+  UINT32 EnableTime;    // us to synchronize the enable state
+} I2C_TIMING;
+
+STATIC CONST I2C_TIMING mI2cTiming[SPEED_MODE_MAX] = {
+  { 10, 100 },          // Normal, 100 kHz
+  { 3,  25 },           // Fast, 400 kHz
+};
+
+STATIC SPEED_MODE mI2cSpeedMode[MAX_SOCKET][I2C_PORT_MAX];
+
+STATIC
+CONST I2C_TIMING *
+I2C_GetTiming (
+  UINT32 Socket,
+  UINT8  Port
+  )
+{
+  if ((Socket >= MAX_SOCKET) || (Port >= I2C_PORT_MAX)) {
+    return &mI2cTiming[Normal];
+  }
+  return &mI2cTiming[mI2cSpeedMode[Socket][Port]];
+}
+
 VOID
 I2C_Delay (
   UINT32 Count
@@ -42,17 +73,21 @@ I2C_Disable (
   UINT8  Port
   )
 {
-  UINT32                  TimeCnt = I2C_READ_TIMEOUT;
+  UINT32                  TimeCnt;
+  UINT32                  Interval;
   I2C0_STATUS_U           I2cStatusReg;
   I2C0_ENABLE_U           I2cEnableReg;
   I2C0_ENABLE_STATUS_U    I2cEnableStatusReg;
 
   UINTN Base = GetI2cBase (Socket, Port);
 
+  Interval = I2C_GetTiming (Socket, Port)->EnableTime;
+  TimeCnt = I2C_ENABLE_TIMEOUT_US / Interval;
+
   I2C_REG_READ ((Base + I2C_STATUS_OFFSET), I2cStatusReg.Val32);
 
   while (I2cStatusReg.bits.activity) {
-    I2C_Delay (10000);
+    I2C_Delay (Interval);
 
     TimeCnt--;
     I2C_REG_READ (Base + I2C_STATUS_OFFSET, I2cStatusReg.Val32);
@@ -83,24 +118,32 @@ I2C_Enable (
 {
   I2C0_ENABLE_U           I2cEnableReg;
   I2C0_ENABLE_STATUS_U    I2cEnableStatusReg;
-  UINT32                  TimeCnt = I2C_READ_TIMEOUT;
+  UINT32                  TimeCnt;
+  UINT32                  Interval;
 
   UINTN Base = GetI2cBase (Socket, Port);
 
+  Interval = I2C_GetTiming (Socket, Port)->EnableTime;
+  TimeCnt = I2C_ENABLE_TIMEOUT_US / Interval;
+
   I2C_REG_READ (Base + I2C_ENABLE_OFFSET, I2cEnableReg.Val32);
   I2cEnableReg.bits.enable = 1;
   I2C_REG_WRITE (Base + I2C_ENABLE_OFFSET, I2cEnableReg.Val32);
 
-  do {
-    // This is a empirical value for I2C delay. MemoryFence is no need here.
-    I2C_Delay (10000);
+  //
+  // Check before waiting, the enable usually takes effect within a few bus
+  // clocks.
+  //
+  I2C_REG_READ (Base + I2C_ENABLE_STATUS_OFFSET, I2cEnableStatusReg.Val32);
+  while (I2cEnableStatusReg.bits.ic_en == 0) {
+    I2C_Delay (Interval);
 
     TimeCnt--;
     I2C_REG_READ (Base + I2C_ENABLE_STATUS_OFFSET, I2cEnableStatusReg.Val32);
     if (TimeCnt == 0) {
       return EFI_DEVICE_ERROR;
     }
-  } while (I2cEnableStatusReg.bits.ic_en == 0);
+  }
 
   return EFI_SUCCESS;
 }
@@ -153,6 +196,8 @@ I2CInit (
     return EFI_DEVICE_ERROR;
   }
 
+  mI2cSpeedMode[Socket][Port] = SpeedMode;
+
   I2C_REG_READ (Base + I2C_CON_OFFSET, I2cControlReg.Val32);
   I2cControlReg.bits.master = 1;
   if(SpeedMode == Normal) {
@@ -255,18 +300,22 @@ CheckI2CTimeOut (
 {
   UINT32 Times = 0;
   UINT32 Fifo;
+  UINT32 Interval;
+  UINT32 MaxTimes;
+
+  Interval = I2C_GetTiming (Socket, Port)->BitTime;
+  if (Port == I2C_EXTENDER_PORT_HNS) {
+    // The extender adds latency, allow for a much longer wait there.
+    MaxTimes = I2C_EXTENDER_TIMEOUT_US / Interval;
+  } else {
+    MaxTimes = I2C_FIFO_TIMEOUT_US / Interval;
+  }
 
   if (Transfer == I2CTx) {
     Fifo = I2C_GetTxStatus (Socket, Port);
     while (Fifo != 0) {
-      if (Port == I2C_EXTENDER_PORT_HNS) {
-        // This is a empirical value for I2C delay. MemoryFence is no need here.
-        I2C_Delay (1000);
-      } else {
-        // This is a empirical value for I2C delay. MemoryFence is no need here.
-        I2C_Delay (2);
-      }
-      if (++Times > I2C_READ_TIMEOUT) {
+      I2C_Delay (Interval);
+      if (++Times > MaxTimes) {
         (VOID)I2C_Disable (Socket, Port);
         return EFI_TIMEOUT;
       }
@@ -275,14 +324,8 @@ CheckI2CTimeOut (
   } else {
     Fifo = I2C_GetRxStatus (Socket, Port);
     while (Fifo == 0) {
-      if (Port == I2C_EXTENDER_PORT_HNS) {
-        // This is a empirical value for I2C delay. MemoryFence is no need here.
-        I2C_Delay (1000);
-      } else {
-        // This is a empirical value for I2C delay. MemoryFence is no need here.
-        I2C_Delay (2);
-      }
-      if (++Times > I2C_READ_TIMEOUT) {
+      I2C_Delay (Interval);
+      if (++Times > MaxTimes) {
         (VOID)I2C_Disable (Socket, Port);
         return EFI_TIMEOUT;
       }
@@ -305,9 +348,12 @@ WriteBeforeRead (
   UINT32 Fifo;
   UINT32 Count;
   UINT32 Times = 0;
+  UINT32 Interval;
 
   UINTN  Base = GetI2cBase (I2cInfo->Socket, I2cInfo->Port);
 
+  Interval = I2C_GetTiming (I2cInfo->Socket, I2cInfo->Port)->BitTime;
+
   I2C_SetTarget (I2cInfo->Socket, I2cInfo->Port, I2cInfo->SlaveDeviceAddress);
 
   if (CheckI2CTimeOut (I2cInfo->Socket, I2cInfo->Port, I2CTx) == EFI_TIMEOUT) {
@@ -318,8 +364,8 @@ WriteBeforeRead (
   for (Count = 0; Count < Length; Count++) {
     Times = 0;
     while (Fifo > I2C_TXRX_THRESHOLD) {
-      I2C_Delay (2);
-      if (++Times > I2C_READ_TIMEOUT) {
+      I2C_Delay (Interval);
+      if (++Times > I2C_FIFO_TIMEOUT_US / Interval) {
         return EFI_TIMEOUT;
       }
       Fifo = I2C_GetTxStatus (I2cInfo->Socket, I2cInfo->Port);
@@ -350,12 +396,14 @@ I2CWrite(
   UINT32 Times = 0;
   UINT32  Idx;
   UINTN  Base;
+  UINT32 Interval;
 
   if (I2cInfo->Port >= I2C_PORT_MAX) {
     return EFI_INVALID_PARAMETER;
   }
 
   Base = GetI2cBase (I2cInfo->Socket, I2cInfo->Port);
+  Interval = I2C_GetTiming (I2cInfo->Socket, I2cInfo->Port)->BitTime;
 
   (VOID)I2C_Enable(I2cInfo->Socket, I2cInfo->Port);
 
@@ -380,9 +428,8 @@ I2CWrite(
     Times = 0;
     Fifo = I2C_GetTxStatus (I2cInfo->Socket, I2cInfo->Port);
     while (Fifo > I2C_TXRX_THRESHOLD) {
-      // This is a empirical value for I2C delay. MemoryFence is no need here.
-      I2C_Delay (1000);
-      if (++Times > I2C_READ_TIMEOUT) {
+      I2C_Delay (Interval);
+      if (++Times > I2C_EXTENDER_TIMEOUT_US / Interval) {
         (VOID)I2C_Disable (I2cInfo->Socket, I2cInfo->Port);
         return EFI_TIMEOUT;
       }
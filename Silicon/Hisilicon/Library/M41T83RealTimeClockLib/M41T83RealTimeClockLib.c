@@ -13,6 +13,7 @@
 #include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
 #include <Library/I2CLib.h>
+#include <Library/PcdLib.h>
 #include <Library/RtcHelperLib.h>
 #include <Library/TimeBaseLib.h>
 #include <Library/TimerLib.h>
@@ -25,6 +26,63 @@ extern I2C_DEVICE gRtcDevice;
 
 STATIC EFI_LOCK  mRtcLock;
 
+//
+// Last time read from the M41T83 and the generic timer count it was read
+// at. GetTime extrapolates from these instead of going through the CPLD
+// I2C switch until PcdRtcTimeCacheSeconds have passed or SetTime is called.
+//
+STATIC BOOLEAN       mTimeCacheValid = FALSE;
+STATIC UINTN         mTimeCacheEpoch;
+STATIC UINT64        mTimeCacheCounter;
+STATIC INT16         mTimeCacheTimeZone;
+STATIC UINT8         mTimeCacheDaylight;
+
+STATIC
+BOOLEAN
+GetCachedTime (
+  OUT EFI_TIME                *Time
+  )
+{
+  UINT64  Elapsed;
+
+  if (!mTimeCacheValid) {
+    return FALSE;
+  }
+
+  Elapsed = DivU64x32 (
+              GetTimeInNanoSecond (GetPerformanceCounter () - mTimeCacheCounter),
+              1000000000
+              );
+  if (Elapsed >= FixedPcdGet32 (PcdRtcTimeCacheSeconds)) {
+    mTimeCacheValid = FALSE;
+    return FALSE;
+  }
+
+  EpochToEfiTime (mTimeCacheEpoch + (UINTN)Elapsed, Time);
+  Time->Nanosecond = 0;
+  Time->TimeZone   = mTimeCacheTimeZone;
+  Time->Daylight   = mTimeCacheDaylight;
+
+  return TRUE;
+}
+
+STATIC
+VOID
+UpdateTimeCache (
+  IN  EFI_TIME                *Time
+  )
+{
+  if (FixedPcdGet32 (PcdRtcTimeCacheSeconds) == 0) {
+    return;
+  }
+
+  mTimeCacheEpoch    = EfiTimeToEpoch (Time);
+  mTimeCacheCounter  = GetPerformanceCounter ();
+  mTimeCacheTimeZone = Time->TimeZone;
+  mTimeCacheDaylight = Time->Daylight;
+  mTimeCacheValid    = TRUE;
+}
+
 /**
   Read RTC content through its registers.
 
@@ -190,6 +248,8 @@ LibSetTime (
     return EFI_INVALID_PARAMETER;
   }
 
+  mTimeCacheValid = FALSE;
+
   Status = SwitchRtcI2cChannelAndLock ();
   if (EFI_ERROR (Status)) {
     return Status;
@@ -293,6 +353,10 @@ LibGetTime (
     return EFI_INVALID_PARAMETER;
   }
 
+  if (GetCachedTime (Time)) {
+    return EFI_SUCCESS;
+  }
+
   Status = SwitchRtcI2cChannelAndLock ();
   if (EFI_ERROR (Status)) {
     return Status;
@@ -337,6 +401,8 @@ LibGetTime (
       goto Exit;
   }
 
+  UpdateTimeCache (Time);
+
 Exit:
   ReleaseOwnershipOfRtc ();
   // Release RTC Lock.
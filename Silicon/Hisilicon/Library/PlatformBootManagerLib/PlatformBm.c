@@ -552,6 +552,103 @@ PlatformBootManagerBeforeConsole (
   PlatformRegisterOptionsAndKeys ();
 }
 
+/**
+  Check whether a device path starts at a PCI root bridge, which the PCI bus
+  driver can connect on its own without touching the other segments.
+**/
+STATIC
+BOOLEAN
+IsPciRootDevicePath (
+  IN EFI_DEVICE_PATH_PROTOCOL  *DevicePath
+  )
+{
+  ACPI_HID_DEVICE_PATH  *Acpi;
+
+  if ((DevicePathType (DevicePath) != ACPI_DEVICE_PATH) ||
+      (DevicePathSubType (DevicePath) != ACPI_DP)) {
+    return FALSE;
+  }
+
+  Acpi = (ACPI_HID_DEVICE_PATH *)DevicePath;
+  return (Acpi->HID == EISA_PNP_ID (0x0A03)) ||
+         (Acpi->HID == EISA_PNP_ID (0x0A08));
+}
+
+/**
+  Connect only the devices the active boot options live on.
+
+  Boot options built into the firmware volumes need nothing connected. Any
+  other option that is not rooted at a PCI root bridge (short-form paths, SAS
+  controllers, ...) can only be resolved by connecting everything.
+
+  @retval TRUE   The boot devices have been connected, the rest can wait.
+  @retval FALSE  The caller must connect all devices.
+**/
+STATIC
+BOOLEAN
+ConnectBootDevices (
+  VOID
+  )
+{
+  EFI_STATUS                   Status;
+  EFI_BOOT_MANAGER_LOAD_OPTION *BootOptions;
+  UINTN                        BootOptionCount;
+  UINTN                        Index;
+  EFI_DEVICE_PATH_PROTOCOL     *DevicePath;
+  BOOLEAN                      Connected;
+
+  BootOptions = EfiBootManagerGetLoadOptions (
+                  &BootOptionCount, LoadOptionTypeBoot
+                  );
+
+  Connected = FALSE;
+  for (Index = 0; Index < BootOptionCount; Index++) {
+    if ((BootOptions[Index].Attributes & LOAD_OPTION_ACTIVE) == 0) {
+      continue;
+    }
+
+    DevicePath = BootOptions[Index].FilePath;
+    if ((DevicePathType (DevicePath) == MEDIA_DEVICE_PATH) &&
+        (DevicePathSubType (DevicePath) == MEDIA_PIWG_FW_VOL_DP)) {
+      continue;
+    }
+
+    if (!IsPciRootDevicePath (DevicePath)) {
+      DEBUG ((DEBUG_INFO, "%a: %s needs a full connect\n", __FUNCTION__,
+        BootOptions[Index].Description));
+      Connected = FALSE;
+      break;
+    }
+
+    Status = EfiBootManagerConnectDevicePath (DevicePath, NULL);
+    DEBUG ((EFI_ERROR (Status) ? DEBUG_WARN : DEBUG_VERBOSE, "%a: %s: %r\n",
+      __FUNCTION__, BootOptions[Index].Description, Status));
+    if (!EFI_ERROR (Status)) {
+      Connected = TRUE;
+    }
+  }
+
+  EfiBootManagerFreeLoadOptions (BootOptions, BootOptionCount);
+  return Connected;
+}
+
+/**
+  ReadyToBoot notification: connect the devices that were left out by
+  ConnectBootDevices(), so that the OS loader and any other boot option tried
+  after it see the whole system.
+**/
+STATIC
+VOID
+EFIAPI
+OnReadyToBootConnectAll (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  gBS->CloseEvent (Event);
+  EfiBootManagerConnectAll ();
+}
+
 STATIC
 VOID
 WaitForDiskReady (
@@ -607,6 +704,7 @@ PlatformBootManagerAfterConsole (
   ESRT_MANAGEMENT_PROTOCOL           *EsrtManagement = NULL;
   OEM_CONFIG_DATA                    SetupData;
   UINTN                              DataSize = sizeof (OEM_CONFIG_DATA);
+  EFI_EVENT                          ReadyToBootEvent;
 
   //
   // Show the splash screen.
@@ -614,15 +712,31 @@ PlatformBootManagerAfterConsole (
   BootLogoEnableLogo ();
 
   //
-  // Connect the rest of the devices.
+  // In deferred mode, connect the devices the boot options point at and leave
+  // the other PCI segments for ReadyToBoot. The boot options are not
+  // refreshed then, as that would drop the ones on the segments not connected.
   //
-  EfiBootManagerConnectAll ();
-  WaitForDiskReady ();
+  if (FeaturePcdGet (PcdDeferNonBootDeviceConnect) &&
+      ConnectBootDevices ()) {
+    Status = EfiCreateEventReadyToBootEx (
+               TPL_CALLBACK,
+               OnReadyToBootConnectAll,
+               NULL,
+               &ReadyToBootEvent
+               );
+    ASSERT_EFI_ERROR (Status);
+  } else {
+    //
+    // Connect the rest of the devices.
+    //
+    EfiBootManagerConnectAll ();
+    WaitForDiskReady ();
 
-  //
-  // Enumerate all possible boot options.
-  //
-  EfiBootManagerRefreshAllBootOption ();
+    //
+    // Enumerate all possible boot options.
+    //
+    EfiBootManagerRefreshAllBootOption ();
+  }
 
   //
   // Sync Esrt Table
@@ -12,6 +12,7 @@
 #include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
 #include <Library/I2CLib.h>
+#include <Library/PcdLib.h>
 #include <Library/RtcHelperLib.h>
 #include <Library/TimeBaseLib.h>
 #include <Library/TimerLib.h>
@@ -28,6 +29,64 @@ STATIC BOOLEAN       mRX8900Initialized = FALSE;
 STATIC CONST CHAR16  mTimeZoneVariableName[] = L"RX8900RtcTimeZone";
 STATIC CONST CHAR16  mDaylightVariableName[] = L"RX8900RtcDaylight";
 
+//
+// GetTime has to win the RTC I2C channel from the BMC and read two
+// variables, so the result is kept together with the generic timer count
+// and extrapolated until PcdRtcTimeCacheSeconds have passed or SetTime is
+// called.
+//
+STATIC BOOLEAN       mTimeCacheValid = FALSE;
+STATIC UINTN         mTimeCacheEpoch;
+STATIC UINT64        mTimeCacheCounter;
+STATIC INT16         mTimeCacheTimeZone;
+STATIC UINT8         mTimeCacheDaylight;
+
+STATIC
+BOOLEAN
+GetCachedTime (
+  OUT EFI_TIME                *Time
+  )
+{
+  UINT64  Elapsed;
+
+  if (!mTimeCacheValid) {
+    return FALSE;
+  }
+
+  Elapsed = DivU64x32 (
+              GetTimeInNanoSecond (GetPerformanceCounter () - mTimeCacheCounter),
+              1000000000
+              );
+  if (Elapsed >= FixedPcdGet32 (PcdRtcTimeCacheSeconds)) {
+    mTimeCacheValid = FALSE;
+    return FALSE;
+  }
+
+  EpochToEfiTime (mTimeCacheEpoch + (UINTN)Elapsed, Time);
+  Time->Nanosecond = 0;
+  Time->TimeZone   = mTimeCacheTimeZone;
+  Time->Daylight   = mTimeCacheDaylight;
+
+  return TRUE;
+}
+
+STATIC
+VOID
+UpdateTimeCache (
+  IN  EFI_TIME                *Time
+  )
+{
+  if (FixedPcdGet32 (PcdRtcTimeCacheSeconds) == 0) {
+    return;
+  }
+
+  mTimeCacheEpoch    = EfiTimeToEpoch (Time);
+  mTimeCacheCounter  = GetPerformanceCounter ();
+  mTimeCacheTimeZone = Time->TimeZone;
+  mTimeCacheDaylight = Time->Daylight;
+  mTimeCacheValid    = TRUE;
+}
+
 EFI_STATUS
 InitializeRX8900 (
   VOID
@@ -184,6 +243,10 @@ LibGetTime (
     return EFI_INVALID_PARAMETER;
   }
 
+  if (GetCachedTime (Time)) {
+    return EFI_SUCCESS;
+  }
+
   // Initialize the hardware if not already done
   if (!mRX8900Initialized) {
     Status = InitializeRX8900 ();
@@ -241,6 +304,10 @@ Err:
     TryCount++;
   } while ((TryCount < 3) && (EFI_ERROR (Status)));
 
+  if (!EFI_ERROR (Status)) {
+    UpdateTimeCache (Time);
+  }
+
   ReleaseOwnershipOfRtc ();
   return Status;
 }
@@ -316,6 +383,8 @@ LibSetTime (
   EFI_STATUS  Status;
   UINTN EpochSeconds;
 
+  mTimeCacheValid = FALSE;
+
   // Initialize the hardware if not already done
   if (!mRX8900Initialized) {
     Status = InitializeRX8900 ();
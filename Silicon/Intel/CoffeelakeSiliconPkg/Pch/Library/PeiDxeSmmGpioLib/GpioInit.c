@@ -114,13 +114,14 @@ GpioDwRegValueFromGpioConfig (
 
 /**
   This internal procedure will scan GPIO initialization table and unlock
-  all pads present in it
+  all pads of a given group present in it
 
   @param[in] NumberOfItem               Number of GPIO pad records in table
   @param[in] GpioInitTableAddress       GPIO initialization table
-  @param[in] Index                      Index of GPIO Initialization table record
+  @param[in] GroupIndex                 GPIO group index
 
   @retval EFI_SUCCESS                   The function completed successfully
+  @retval EFI_NOT_FOUND                 No pad from this group is in GPIO initialization table
   @retval EFI_INVALID_PARAMETER         Invalid group or pad number
 **/
 STATIC
@@ -128,7 +129,7 @@ EFI_STATUS
 GpioUnlockPadsForAGroup (
   IN UINT32                    NumberOfItems,
   IN GPIO_INIT_CONFIG          *GpioInitTableAddress,
-  IN UINT32                    Index
+  IN UINT32                    GroupIndex
   )
 {
   UINT32                 PadsToUnlock[GPIO_GROUP_DW_NUMBER];
@@ -138,29 +139,29 @@ GpioUnlockPadsForAGroup (
   UINT32                 GpioGroupInfoLength;
   CONST GPIO_INIT_CONFIG *GpioData;
   GPIO_GROUP             Group;
-  UINT32                 GroupIndex;
+  UINT32                 Index;
   UINT32                 PadNumber;
+  BOOLEAN                PadFound;
 
   GpioGroupInfo = GpioGetGroupInfoTable (&GpioGroupInfoLength);
 
-  GpioData   = &GpioInitTableAddress[Index];
-  Group      = GpioGetGroupFromGpioPad (GpioData->GpioPad);
-  GroupIndex = GpioGetGroupIndexFromGpioPad (GpioData->GpioPad);
-
+  Group    = 0;
+  PadFound = FALSE;
   ZeroMem (PadsToUnlock, sizeof (PadsToUnlock));
   //
-  // Loop through pads for one group. If pad belongs to a different group then
-  // break and move to register programming.
+  // Loop through whole table and collect pads of this group. Pads of a group
+  // do not need to be placed next to each other in the table.
   //
-  while (Index < NumberOfItems) {
+  for (Index = 0; Index < NumberOfItems; Index++) {
 
     GpioData   = &GpioInitTableAddress[Index];
     if (GroupIndex != GpioGetGroupIndexFromGpioPad (GpioData->GpioPad)) {
-      //if next pad is from different group then break loop
-      break;
+      continue;
     }
 
+    Group      = GpioGetGroupFromGpioPad (GpioData->GpioPad);
     PadNumber  = GpioGetPadNumberFromGpioPad (GpioData->GpioPad);
+    PadFound   = TRUE;
     //
     // Check if legal pin number
     //
@@ -180,9 +181,10 @@ GpioUnlockPadsForAGroup (
     // Update pads which need to be unlocked
     //
     PadsToUnlock[DwNum] |= 0x1 << PadBitPosition;
+  }
 
-    //Move to next item
-    Index++;
+  if (!PadFound) {
+    return EFI_NOT_FOUND;
   }
 
   for (DwNum = 0; DwNum <= GPIO_GET_DW_NUM (GpioGroupInfo[GroupIndex].PadPerGroup); DwNum++) {
@@ -198,6 +200,34 @@ GpioUnlockPadsForAGroup (
   return EFI_SUCCESS;
 }
 
+/**
+  This procedure will write a GPIO register changing only the bits selected by Mask.
+  Register is not accessed if there is nothing to change and it is written
+  without being read first if all of its bits are given.
+
+  @param[in] Address                    Register address
+  @param[in] Mask                       Mask of bits which will change in the register
+  @param[in] Value                      Value of bits selected by Mask
+**/
+STATIC
+VOID
+GpioWriteRegMasked (
+  IN UINTN                     Address,
+  IN UINT32                    Mask,
+  IN UINT32                    Value
+  )
+{
+  if ((Mask | Value) == 0) {
+    return;
+  }
+
+  if (Mask == MAX_UINT32) {
+    MmioWrite32 (Address, Value);
+  } else {
+    MmioAndThenOr32 (Address, ~Mask, Value);
+  }
+}
+
 /**
   This procedure will initialize multiple PCH GPIO pins
 
@@ -232,20 +262,26 @@ GpioConfigurePch (
 
   GpioGroupInfo = GpioGetGroupInfoTable (&GpioGroupInfoLength);
 
-  Index = 0;
-  while (Index < NumberOfItems) {
-
-    GpioData   = &GpioInitTableAddress[Index];
-    GroupIndex = GpioGetGroupIndexFromGpioPad (GpioData->GpioPad);
-    GpioCom    = GpioGroupInfo[GroupIndex].Community;
-
-    DEBUG_CODE_BEGIN();
+  DEBUG_CODE_BEGIN();
+  for (Index = 0; Index < NumberOfItems; Index++) {
+    GpioData = &GpioInitTableAddress[Index];
     if (!GpioIsCorrectPadForThisChipset (GpioData->GpioPad)) {
       DEBUG ((DEBUG_ERROR, "GPIO ERROR: Incorrect GpioPad (0x%08x) used on this chipset!\n", GpioData->GpioPad));
       ASSERT (FALSE);
       return EFI_UNSUPPORTED;
     }
-    DEBUG_CODE_END ();
+  }
+  DEBUG_CODE_END ();
+
+  //
+  // Program pads group by group. This way lock, ownership and interrupt enable
+  // registers of a group are accessed only once regardless of how pads of that
+  // group are distributed in the table. Pads within a group are still programmed
+  // in table order.
+  //
+  for (GroupIndex = 0; GroupIndex < GpioGroupInfoLength; GroupIndex++) {
+
+    GpioCom    = GpioGroupInfo[GroupIndex].Community;
 
     //
     // Unlock pads for a given group which are going to be reconfigured
@@ -257,19 +293,19 @@ GpioConfigurePch (
     // PadRstCfg != Powergood GpioPad will have its configuration locked despite it being not the
     // one desired by BIOS. Before reconfiguring all pads they will get unlocked.
     //
-    GpioUnlockPadsForAGroup (NumberOfItems, GpioInitTableAddress, Index);
+    if (GpioUnlockPadsForAGroup (NumberOfItems, GpioInitTableAddress, GroupIndex) == EFI_NOT_FOUND) {
+      continue;
+    }
 
     ZeroMem (GroupDwData, sizeof (GroupDwData));
     //
-    // Loop through pads for one group. If pad belongs to a different group then
-    // break and move to register programming.
+    // Loop through pads for one group and skip pads from other groups.
     //
-    while (Index < NumberOfItems) {
+    for (Index = 0; Index < NumberOfItems; Index++) {
 
       GpioData   = &GpioInitTableAddress[Index];
       if (GroupIndex != GpioGetGroupIndexFromGpioPad (GpioData->GpioPad)) {
-        //if next pad is from different group then break loop
-        break;
+        continue;
       }
 
       PadNumber  = GpioGetPadNumberFromGpioPad (GpioData->GpioPad);
@@ -292,8 +328,6 @@ GpioConfigurePch (
         DEBUG ((DEBUG_ERROR, "GPIO ERROR: Accessing pad not owned by host (Group=%d, Pad=%d)!\n", GroupIndex, PadNumber));
         DEBUG ((DEBUG_ERROR, "** Please make sure the GPIO usage in sync between CSME and BIOS configuration. \n"));
         DEBUG ((DEBUG_ERROR, "** All the GPIO occupied by CSME should not do any configuration by BIOS.\n"));
-        //Move to next item
-        Index++;
         continue;
       }
 
@@ -328,27 +362,27 @@ GpioConfigurePch (
       //
       // Write PADCFG DW0 register
       //
-      MmioAndThenOr32 (
+      GpioWriteRegMasked (
         PCH_PCR_ADDRESS (GpioCom, PadCfgReg),
-        ~PadCfgDwRegMask[0],
+        PadCfgDwRegMask[0],
         PadCfgDwReg[0]
         );
 
       //
       // Write PADCFG DW1 register
       //
-      MmioAndThenOr32 (
+      GpioWriteRegMasked (
         PCH_PCR_ADDRESS (GpioCom, PadCfgReg + 0x4),
-        ~PadCfgDwRegMask[1],
+        PadCfgDwRegMask[1],
         PadCfgDwReg[1]
         );
 
       //
       // Write PADCFG DW2 register
       //
-      MmioAndThenOr32 (
+      GpioWriteRegMasked (
         PCH_PCR_ADDRESS (GpioCom, PadCfgReg + 0x8),
-        ~PadCfgDwRegMask[2],
+        PadCfgDwRegMask[2],
         PadCfgDwReg[2]
         );
 
@@ -360,9 +394,6 @@ GpioConfigurePch (
         &GpioData->GpioConfig,
         GroupDwData
         );
-
-      //Move to next item
-      Index++;
     }
 
     for (DwNum = 0; DwNum <= GPIO_GET_DW_NUM (GpioGroupInfo[GroupIndex].PadPerGroup); DwNum++) {
@@ -370,9 +401,9 @@ GpioConfigurePch (
       // Write HOSTSW_OWN registers
       //
       if (GpioGroupInfo[GroupIndex].HostOwnOffset != NO_REGISTER_FOR_PROPERTY) {
-        MmioAndThenOr32 (
+        GpioWriteRegMasked (
           PCH_PCR_ADDRESS (GpioCom, GpioGroupInfo[GroupIndex].HostOwnOffset + DwNum * 0x4),
-          ~GroupDwData[DwNum].HostSoftOwnRegMask,
+          GroupDwData[DwNum].HostSoftOwnRegMask,
           GroupDwData[DwNum].HostSoftOwnReg
           );
       }
@@ -381,9 +412,9 @@ GpioConfigurePch (
       // Write GPI_GPE_EN registers
       //
       if (GpioGroupInfo[GroupIndex].GpiGpeEnOffset != NO_REGISTER_FOR_PROPERTY) {
-        MmioAndThenOr32 (
+        GpioWriteRegMasked (
           PCH_PCR_ADDRESS (GpioCom, GpioGroupInfo[GroupIndex].GpiGpeEnOffset + DwNum * 0x4),
-          ~GroupDwData[DwNum].GpiGpeEnRegMask,
+          GroupDwData[DwNum].GpiGpeEnRegMask,
           GroupDwData[DwNum].GpiGpeEnReg
           );
       }
@@ -392,9 +423,9 @@ GpioConfigurePch (
       // Write GPI_NMI_EN registers
       //
       if (GpioGroupInfo[GroupIndex].NmiEnOffset != NO_REGISTER_FOR_PROPERTY) {
-        MmioAndThenOr32 (
+        GpioWriteRegMasked (
           PCH_PCR_ADDRESS (GpioCom, GpioGroupInfo[GroupIndex].NmiEnOffset + DwNum * 0x4),
-          ~GroupDwData[DwNum].GpiNmiEnRegMask,
+          GroupDwData[DwNum].GpiNmiEnRegMask,
           GroupDwData[DwNum].GpiNmiEnReg
           );
       } else if (GroupDwData[DwNum].GpiNmiEnReg != 0x0) {
@@ -406,9 +437,9 @@ GpioConfigurePch (
       // Write GPI_SMI_EN registers
       //
       if (GpioGroupInfo[GroupIndex].SmiEnOffset != NO_REGISTER_FOR_PROPERTY) {
-        MmioAndThenOr32 (
+        GpioWriteRegMasked (
           PCH_PCR_ADDRESS (GpioCom, GpioGroupInfo[GroupIndex].SmiEnOffset + DwNum * 0x4),
-          ~GroupDwData[DwNum].GpiSmiEnRegMask,
+          GroupDwData[DwNum].GpiSmiEnRegMask,
           GroupDwData[DwNum].GpiSmiEnReg
           );
       } else if (GroupDwData[DwNum].GpiSmiEnReg != 0x0) {
@@ -270,21 +270,30 @@ WaitForSpiCycleComplete (
   IN     BOOLEAN            ErrorCheck
   )
 {
-  UINT64        WaitTicks;
-  UINT64        WaitCount;
+  UINT32        TimeoutTicks;
+  UINT32        ElapsedTicks;
+  UINT32        PreviousTick;
+  UINT32        CurrentTick;
   UINT32        Data32;
+  UINT16        ABase;
   SPI_INSTANCE  *SpiInstance;
 
   SpiInstance       = SPI_INSTANCE_FROM_SPIPROTOCOL (This);
+  ABase             = SpiInstance->PchAcpiBase;
 
   //
-  // Convert the wait period allowed into to tick count
+  // Convert the wait time allowed into ACPI timer ticks (3.579545 MHz)
   //
-  WaitCount = SPI_WAIT_TIME / SPI_WAIT_PERIOD;
+  TimeoutTicks = (SPI_WAIT_TIME / 100) * 358;
+  ElapsedTicks = 0;
+  PreviousTick = IoRead32 ((UINTN) (ABase + R_ACPI_IO_PM1_TMR)) & B_ACPI_IO_PM1_TMR_VAL;
   //
   // Wait for the SPI cycle to complete.
+  // Status is polled back to back rather than once per SPI_WAIT_PERIOD, so that
+  // data cycles which take only a few microseconds are not rounded up to the
+  // stall period. The ACPI timer only bounds the total time spent waiting.
   //
-  for (WaitTicks = 0; WaitTicks < WaitCount; WaitTicks++) {
+  do {
     Data32 = MmioRead32 (PchSpiBar0 + R_SPI_MEM_HSFSC);
     if ((Data32 & B_SPI_MEM_HSFSC_SCIP) == 0) {
       MmioWrite32 (PchSpiBar0 + R_SPI_MEM_HSFSC, B_SPI_MEM_HSFSC_FCERR | B_SPI_MEM_HSFSC_FDONE);
@@ -294,8 +303,10 @@ WaitForSpiCycleComplete (
         return TRUE;
       }
     }
-    PchPmTimerStallRuntimeSafe (SpiInstance->PchAcpiBase, SPI_WAIT_PERIOD);
-  }
+    CurrentTick   = IoRead32 ((UINTN) (ABase + R_ACPI_IO_PM1_TMR)) & B_ACPI_IO_PM1_TMR_VAL;
+    ElapsedTicks += (CurrentTick - PreviousTick) & B_ACPI_IO_PM1_TMR_VAL;
+    PreviousTick  = CurrentTick;
+  } while (ElapsedTicks < TimeoutTicks);
   return FALSE;
 }
 
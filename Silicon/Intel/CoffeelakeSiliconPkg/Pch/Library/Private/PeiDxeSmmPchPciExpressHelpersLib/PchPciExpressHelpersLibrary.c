@@ -17,13 +17,18 @@
 // This structure conveniently keeps segment:bus:device:function coordinates of a PCIe device
 // in a single variable. PcieCap is offset to PCI Express capabilities. Having it cached together
 // with coordinates is an optimization feature, because code in this file uses it a lot
+// L1ssCap and LtrCap are offsets to L1 Substates and LTR extended capabilities. They are
+// only valid when ExtCapValid is set, see CacheExtendedCaps ()
 //
 typedef struct {
-  UINT32 Seg     : 8;
-  UINT32 Bus     : 8;
-  UINT32 Dev     : 5;
-  UINT32 Func    : 3;
-  UINT32 PcieCap : 8;
+  UINT32 Seg         : 8;
+  UINT32 Bus         : 8;
+  UINT32 Dev         : 5;
+  UINT32 Func        : 3;
+  UINT32 PcieCap     : 8;
+  UINT32 L1ssCap     : 12;
+  UINT32 LtrCap      : 12;
+  UINT32 ExtCapValid : 1;
 } SBDF;
 
 typedef struct {
@@ -435,6 +440,49 @@ PcieFindExtendedCapId (
   return PcieBaseFindExtendedCapId (DeviceBase, CapId);
 }
 
+/**
+  Walks extended capability list of a device once and caches offsets of all capabilities
+  used by this library in device's SBDF structure. Does nothing if the offsets are already cached.
+
+  @param[in,out] Sbdf   device's segment:bus:device:function coordinates
+                        on exit, L1ssCap and LtrCap offsets are valid
+**/
+STATIC
+VOID
+CacheExtendedCaps (
+  IN OUT SBDF *Sbdf
+  )
+{
+  UINT64  Base;
+  UINT16  CapHeaderOffset;
+  UINT16  CapHeaderId;
+
+  if (Sbdf->ExtCapValid) {
+    return;
+  }
+
+  Base = SbdfToBase (*Sbdf);
+  Sbdf->L1ssCap = 0;
+  Sbdf->LtrCap = 0;
+
+  CapHeaderId     = 0;
+  CapHeaderOffset = R_PCH_PCIE_CFG_EXCAP_OFFSET;
+  while (CapHeaderOffset != 0 && CapHeaderId != MAX_UINT16) {
+    CapHeaderId = PciSegmentRead16 (Base + CapHeaderOffset);
+    if ((CapHeaderId == V_PCIE_EX_L1S_CID) && (Sbdf->L1ssCap == 0)) {
+      Sbdf->L1ssCap = CapHeaderOffset;
+    } else if ((CapHeaderId == R_PCH_PCIE_LTRECH_CID) && (Sbdf->LtrCap == 0)) {
+      Sbdf->LtrCap = CapHeaderOffset;
+    }
+    if ((Sbdf->L1ssCap != 0) && (Sbdf->LtrCap != 0)) {
+      break;
+    }
+    CapHeaderOffset = (PciSegmentRead16 (Base + CapHeaderOffset + 2) >> 4) & ((UINT16) ~(BIT0 | BIT1));
+  }
+
+  Sbdf->ExtCapValid = 1;
+}
+
 /**
   This function checks whether PHY lane power gating is enabled on the port.
 
@@ -798,23 +846,26 @@ GetOverrideLtr (
 /**
   Sets LTR limit in a device.
 
-  @param[in] Base            device's base address
-  @param[in] Ltr             LTR limit
+  @param[in,out] Sbdf        device's segment:bus:device:function coordinates
+  @param[in]     Ltr         LTR limit
 **/
 STATIC
 VOID
 SetLtrLimit (
-  UINT64    Base,
+  SBDF      *Sbdf,
   LTR_LIMIT Ltr
   )
 {
+  UINT64 Base;
   UINT16 LtrCapOffset;
   UINT16 Data16;
 
-  LtrCapOffset = PcieBaseFindExtendedCapId (Base, R_PCH_PCIE_LTRECH_CID);
+  CacheExtendedCaps (Sbdf);
+  LtrCapOffset = (UINT16) Sbdf->LtrCap;
   if (LtrCapOffset == 0) {
     return;
   }
+  Base = SbdfToBase (*Sbdf);
   Data16 = (UINT16)((Ltr.MaxSnoopLatencyValue << N_PCH_PCIE_LTRECH_MSLR_VALUE) | (Ltr.MaxSnoopLatencyScale << N_PCH_PCIE_LTRECH_MSLR_SCALE));
   PciSegmentWrite16(Base + LtrCapOffset + R_PCH_PCIE_LTRECH_MSLR_OFFSET, Data16);
 
@@ -856,6 +907,7 @@ IsPcieDevice (
     return FALSE;
   } else {
     Sbdf->PcieCap = PcieCapOffset;
+    Sbdf->ExtCapValid = 0;
     DEBUG ((DEBUG_INFO, "IsPcieDevice %02x:%02x:%02x - yes\n", Sbdf->Bus, Sbdf->Dev, Sbdf->Func));
     return TRUE;
   }
@@ -1161,24 +1213,27 @@ OverrideL1ssCaps (
 /**
   Returns L1 sub states capabilities of a device
 
-  @param[in] Base   base address of a device
+  @param[in,out] Sbdf   segment:bus:device:function coordinates of a device
 
   @retval L1SS_CAPS structure filled with device's capabilities
 **/
 STATIC
 L1SS_CAPS
 GetL1ssCaps (
-  UINT64         Base,
+  SBDF           *Sbdf,
   OVERRIDE_TABLE *Override
   )
 {
   L1SS_CAPS Capabilities = {0};
+  UINT64    Base;
   UINT16    PcieCapOffset;
   UINT32    CapsRegister;
 
+  Base = SbdfToBase (*Sbdf);
   PcieCapOffset = GetOverrideL1ssCapsOffset (Base, Override);
   if (PcieCapOffset == 0) {
-    PcieCapOffset = PcieBaseFindExtendedCapId (Base, V_PCIE_EX_L1S_CID);
+    CacheExtendedCaps (Sbdf);
+    PcieCapOffset = (UINT16) Sbdf->L1ssCap;
   }
   if (PcieCapOffset == 0) {
     return Capabilities;
@@ -1234,14 +1289,14 @@ CombineL1ss (
 /**
   Configures L1 substate feature in a device
 
-  @param[in] Sbdf     segment:bus:device:function coordinates of a device
+  @param[in,out] Sbdf segment:bus:device:function coordinates of a device
   @param[in] L1ss     configuration to be programmed
   @param[in] Override table of devices that require special handling
 **/
 STATIC
 VOID
 SetL1ss (
-  SBDF           Sbdf,
+  SBDF           *Sbdf,
   L1SS_CAPS      L1ss,
   OVERRIDE_TABLE *Override
   )
@@ -1251,13 +1306,14 @@ SetL1ss (
   UINT32    Ctrl2Register;
   UINT64    Base;
 
-  Base = SbdfToBase(Sbdf);
+  Base = SbdfToBase(*Sbdf);
   Ctrl1Register = 0;
   Ctrl2Register = 0;
 
   PcieCapOffset = GetOverrideL1ssCapsOffset (Base, Override);
   if (PcieCapOffset == 0) {
-    PcieCapOffset = PcieBaseFindExtendedCapId (Base, V_PCIE_EX_L1S_CID);
+    CacheExtendedCaps (Sbdf);
+    PcieCapOffset = (UINT16) Sbdf->L1ssCap;
   }
   if (PcieCapOffset == 0) {
     return;
@@ -1266,7 +1322,7 @@ SetL1ss (
   Ctrl1Register |= (L1ss.PmL11 ? B_PCIE_EX_L1SCAP_PPL11S : 0);
   Ctrl1Register |= (L1ss.AspmL12 ? B_PCIE_EX_L1SCAP_AL12S : 0);
   Ctrl1Register |= (L1ss.AspmL11 ? B_PCIE_EX_L1SCAP_AL1SS : 0);
-  if (GetDeviceType (Sbdf) == DevTypePcieDownstream) {
+  if (GetDeviceType (*Sbdf) == DevTypePcieDownstream) {
     Ctrl1Register |= (L1ss.Cmrt << N_PCIE_EX_L1SCAP_CMRT);
   }
   ///
@@ -1735,26 +1791,25 @@ RecursiveAspmConfiguration (
   Enables L1 substates for PCIE links in the hierarchy below
   L1.1 / L1.2 can be enabled if both sides of a link support it.
 
-  @param[in] Segment,Bus,Device,Function    address of currently visited PCIe device
+  @param[in,out] Sbdf                      address of currently visited PCIe device;
+                                            its extended capability offsets get cached
 
   @retval  structure that describes L1ss capabilities of the device
 **/
 STATIC
 L1SS_CAPS
 RecursiveL1ssConfiguration (
-  SBDF           Sbdf,
+  SBDF           *Sbdf,
   OVERRIDE_TABLE *Override
   )
 {
-  UINT64  Base;
   SBDF    ChildSbdf;
   L1SS_CAPS CombinedCaps;
   L1SS_CAPS ChildCaps;
   PCI_DEV_TYPE DevType;
 
-  DEBUG ((DEBUG_INFO, "RecursiveL1ssConfiguration %x:%x:%x\n", Sbdf.Bus, Sbdf.Dev, Sbdf.Func));
+  DEBUG ((DEBUG_INFO, "RecursiveL1ssConfiguration %x:%x:%x\n", Sbdf->Bus, Sbdf->Dev, Sbdf->Func));
 
-  Base = SbdfToBase (Sbdf);
   //
   // On way down:
   //   do nothing
@@ -1762,18 +1817,18 @@ RecursiveL1ssConfiguration (
   //   In downstream ports, combine L1ss capabilities of that port and device behind it, then enable L1.1 and/or L1.2 if possible
   //   Return L1ss capabilities
   //
-  if (HasChildBus (Sbdf, &ChildSbdf)) {
-    DevType = GetDeviceType (Sbdf);
+  if (HasChildBus (*Sbdf, &ChildSbdf)) {
+    DevType = GetDeviceType (*Sbdf);
     while (FindNextPcieChild (DevType, &ChildSbdf)) {
-      ChildCaps = RecursiveL1ssConfiguration (ChildSbdf, Override);
+      ChildCaps = RecursiveL1ssConfiguration (&ChildSbdf, Override);
       if (DevType == DevTypePcieDownstream && ChildSbdf.Func == 0) {
-        CombinedCaps = CombineL1ss (GetL1ssCaps (Base, Override), ChildCaps);
+        CombinedCaps = CombineL1ss (GetL1ssCaps (Sbdf, Override), ChildCaps);
         SetL1ss (Sbdf, CombinedCaps, Override);
-        SetL1ss (ChildSbdf, CombinedCaps, Override);
+        SetL1ss (&ChildSbdf, CombinedCaps, Override);
       }
     }
   }
-  return GetL1ssCaps (Base, Override);
+  return GetL1ssCaps (Sbdf, Override);
 }
 
 /**
@@ -2004,14 +2059,11 @@ RecursiveLtrConfiguration (
   LTR_LIMIT  LtrLimit
   )
 {
-  UINT64  Base;
   SBDF    ChildSbdf;
   PCI_DEV_TYPE DevType;
 
   DEBUG ((DEBUG_INFO, "RecursiveLtrConfiguration %x:%x:%x\n", Sbdf.Bus, Sbdf.Dev, Sbdf.Func));
 
-  Base = SbdfToBase(Sbdf);
-
   if (!IsLtrCapable (Sbdf)) {
     DEBUG ((DEBUG_INFO, "Not LtrCapable %02x:%02x:%02x\n", Sbdf.Bus, Sbdf.Dev, Sbdf.Func));
     return;
@@ -2023,7 +2075,7 @@ RecursiveLtrConfiguration (
       RecursiveLtrConfiguration (ChildSbdf, LtrLimit);
     }
   }
-  SetLtrLimit (Base, LtrLimit);
+  SetLtrLimit (&Sbdf, LtrLimit);
 }
 
 /**
@@ -2297,6 +2349,7 @@ RootportDownstreamConfiguration (
   if (!(IsDevicePresent (RpBase))) {
     return;
   }
+  ZeroMem (&RpSbdf, sizeof (RpSbdf));
   RpSbdf.Seg = RpSegment;
   RpSbdf.Bus = RpBus;
   RpSbdf.Dev = RpDevice;
@@ -2374,6 +2427,7 @@ RootportDownstreamPmConfiguration (
   PolicyLtr.MaxSnoopLatencyScale   = (RpConfig->LtrMaxSnoopLatency & 0x1c00) >> 10;
   PolicyLtr.MaxSnoopLatencyValue   = RpConfig->LtrMaxSnoopLatency & 0x3FF;
 
+  ZeroMem (&RpSbdf, sizeof (RpSbdf));
   RpSbdf.Seg = RpSegment;
   RpSbdf.Bus = RpBus;
   RpSbdf.Dev = RpDevice;
@@ -2399,7 +2453,7 @@ RootportDownstreamPmConfiguration (
   // L1 substates can be modified only when L1 is disabled, so this function must execute
   // before Aspm configuration which enables L1
   //
-  RecursiveL1ssConfiguration (RpSbdf, &PmOverrideTable);
+  RecursiveL1ssConfiguration (&RpSbdf, &PmOverrideTable);
   L1ssProprietaryConfiguration (RpSbdf);
   RecursiveAspmConfiguration (RpSbdf, 0, &PmOverrideTable);
   ClearBusFromTable (&BridgeCleanupList);
@@ -9,6 +9,7 @@
 #include "PchSmmHelpers.h"
 #include <Private/Protocol/PchNvsArea.h>
 #include <Library/SmiHandlerProfileLib.h>
+#include <Library/SmiHandlerLatencyLib.h>
 #include <Register/PchRegsPcr.h>
 #include <Register/PchRegsPsth.h>
 #include <Register/PchRegsDmi.h>
@@ -251,6 +252,7 @@ IoTrapDispatcherHelper (
   LIST_ENTRY                                *LinkInDb;
   EFI_SMM_IO_TRAP_REGISTER_CONTEXT          CurrentIoTrapRegisterData;
   EFI_SMM_IO_TRAP_CONTEXT                   CurrentIoTrapContextData;
+  UINT64                                    LatencyStart;
   UINT16                                    BaseAddress;
   UINT16                                    StartAddress;
   UINT16                                    EndAddress;
@@ -285,10 +287,14 @@ IoTrapDispatcherHelper (
       //
       if (mIoTrapData.Entry[TrapHandlerNum].MergeDisable) {
         if (RecordInDb->IoTrapCallback != NULL) {
+          LatencyStart = SmiHandlerLatencyStart ();
           RecordInDb->IoTrapCallback (&RecordInDb->Link, &CurrentIoTrapContextData, NULL, NULL);
+          SmiHandlerLatencyStop ((VOID *) (UINTN) RecordInDb->IoTrapCallback, LatencyStart);
         }
         if (RecordInDb->IoTrapExCallback != NULL) {
+          LatencyStart = SmiHandlerLatencyStart ();
           RecordInDb->IoTrapExCallback (BaseAddress, ActiveHighByteEnable, !ReadCycle, WriteData);
+          SmiHandlerLatencyStop ((VOID *) (UINTN) RecordInDb->IoTrapExCallback, LatencyStart);
         }
         //
         // Expect only one callback available. So break immediately.
@@ -304,7 +310,9 @@ IoTrapDispatcherHelper (
             //
             // Pass the IO trap context information
             //
+            LatencyStart = SmiHandlerLatencyStart ();
             RecordInDb->IoTrapCallback (&RecordInDb->Link, &CurrentIoTrapContextData, NULL, NULL);
+            SmiHandlerLatencyStop ((VOID *) (UINTN) RecordInDb->IoTrapCallback, LatencyStart);
           }
           //
           // Break if the address is match
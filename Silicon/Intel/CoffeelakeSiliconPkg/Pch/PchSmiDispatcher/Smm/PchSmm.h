@@ -611,6 +611,17 @@ SmmCoreInsertRecord (
   OUT EFI_HANDLE                        *DispatchHandle
   );
 
+/**
+  Add the top level PMC SMI_STS bit of a record to the summary the dispatcher
+  uses to skip SMIs that none of the registered sources can claim.
+
+  @param[in] Record                     Record inserted into the callback database.
+**/
+VOID
+PchSmmIndexRecord (
+  IN DATABASE_RECORD                    *Record
+  );
+
 /**
   Get the Sleep type
 
@@ -11,6 +11,7 @@
 #include "PchSmmHelpers.h"
 #include "PchSmmEspi.h"
 #include <Library/SmiHandlerProfileLib.h>
+#include <Library/SmiHandlerLatencyLib.h>
 #include <Register/PchRegsGpio.h>
 #include <Register/PchRegsPmc.h>
 #include <Register/PchRegsLpc.h>
@@ -25,6 +26,13 @@ GLOBAL_REMOVE_IF_UNREFERENCED UINT16                mAcpiBaseAddr;
 GLOBAL_REMOVE_IF_UNREFERENCED UINT16                mTcoBaseAddr;
 GLOBAL_REMOVE_IF_UNREFERENCED BOOLEAN               mReadyToLock;
 
+//
+// Top level PMC SMI_STS bits of the records in the callback database, see
+// PchSmmIndexRecord ().
+//
+GLOBAL_REMOVE_IF_UNREFERENCED UINT32                mSmiStsRecordMask;
+GLOBAL_REMOVE_IF_UNREFERENCED BOOLEAN               mSmiStsRecordUnindexed;
+
 GLOBAL_REMOVE_IF_UNREFERENCED PRIVATE_DATA          mPrivateData = {
   {
     NULL,
@@ -310,6 +318,7 @@ SmmCoreInsertRecord (
   // After ensuring the source of event is not null, we will insert the record into the database
   //
   InsertTailList (&mPrivateData.CallbackDataBase, &Record->Link);
+  PchSmmIndexRecord (Record);
 
   //
   // Child's handle will be the address linked list link in the record
@@ -648,6 +657,38 @@ ClearPendingSmiStatus (
   }
 }
 
+/**
+  Add the top level PMC SMI_STS bit of a record to the summary the dispatcher
+  uses to skip SMIs that none of the registered sources can claim.
+
+  A record that is not gated by a PMC SMI_STS bit makes the dispatcher walk the
+  database on every SMI. Bits are never removed on unregister, the summary is
+  a superset of the registered sources.
+
+  @param[in] Record                     Record inserted into the callback database.
+**/
+VOID
+PchSmmIndexRecord (
+  IN DATABASE_RECORD                    *Record
+  )
+{
+  CONST PCH_SMM_BIT_DESC                *TopLevel;
+
+  TopLevel = &Record->SrcDesc.PmcSmiSts;
+  if (IS_BIT_DESC_NULL (*TopLevel)) {
+    TopLevel = &Record->SrcDesc.Sts[0];
+  }
+
+  if (!IS_BIT_DESC_NULL (*TopLevel) &&
+      (TopLevel->Reg.Type == ACPI_ADDR_TYPE) &&
+      (TopLevel->Reg.Data.acpi == R_ACPI_IO_SMI_STS) &&
+      (TopLevel->Bit < 32)) {
+    mSmiStsRecordMask |= (1u << TopLevel->Bit);
+  } else {
+    mSmiStsRecordUnindexed = TRUE;
+  }
+}
+
 /**
   The callback function to handle subsequent SMIs.  This callback will be called by SmmCoreDispatcher.
 
@@ -691,6 +732,7 @@ PchSmmCoreDispatcher (
   UINT32              SmiStsValue;
   UINT8               Port74Save;
   UINT8               Port76Save;
+  UINT64              LatencyStart;
 
   PCH_SMM_SOURCE_DESC ActiveSource;
 
@@ -730,6 +772,16 @@ PchSmmCoreDispatcher (
       SmiEnValue  = IoRead32 ((UINTN) (mAcpiBaseAddr + R_ACPI_IO_SMI_EN));
       SmiStsValue = IoRead32 ((UINTN) (mAcpiBaseAddr + R_ACPI_IO_SMI_STS));
 
+      //
+      // None of the registered sources has its top level SMI_STS bit set,
+      // so no record can claim this SMI. Skip the database walk.
+      //
+      if (!mSmiStsRecordUnindexed && ((SmiStsValue & mSmiStsRecordMask) == 0)) {
+        ClearPendingSmiStatus (SmiStsValue, SciEn);
+        EosSet = PchSmmSetAndCheckEos ();
+        continue;
+      }
+
       while (!IsNull (&mPrivateData.CallbackDataBase, LinkInDb)) {
         RecordInDb = DATABASE_RECORD_FROM_LINK (LinkInDb);
 
@@ -811,7 +863,9 @@ PchSmmCoreDispatcher (
                   //
                   // For PCH SMI dispatch protocols
                   //
+                  LatencyStart = SmiHandlerLatencyStart ();
                   PchSmiTypeCallbackDispatcher (RecordToExhaust);
+                  SmiHandlerLatencyStop ((VOID *) (UINTN) RecordToExhaust->PchSmiCallback, LatencyStart);
                 } else {
                   //
                   // For EFI standard SMI dispatch protocols
@@ -833,7 +887,9 @@ PchSmmCoreDispatcher (
                     }
 
                     PERF_START_EX (NULL, "SmmFunction", NULL, AsmReadTsc (), RecordToExhaust->ProtocolType);
+                    LatencyStart = SmiHandlerLatencyStart ();
                     RecordToExhaust->Callback ((EFI_HANDLE) & RecordToExhaust->Link, &Context, CommBuffer, &CommBufferSize);
+                    SmiHandlerLatencyStop ((VOID *) (UINTN) RecordToExhaust->Callback, LatencyStart);
                     PERF_END_EX (NULL, "SmmFunction", NULL, AsmReadTsc (), RecordToExhaust->ProtocolType);
                     if (RecordToExhaust->ProtocolType == SxType) {
                       SxChildWasDispatched = TRUE;
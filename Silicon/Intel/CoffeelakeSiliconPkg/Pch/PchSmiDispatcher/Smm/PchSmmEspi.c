@@ -10,6 +10,7 @@
 #include <Private/Library/PmcPrivateLib.h>
 #include <Library/PchEspiLib.h>
 #include <Library/SmiHandlerProfileLib.h>
+#include <Library/SmiHandlerLatencyLib.h>
 #include <Register/PchRegs.h>
 #include <Register/PchRegsPcr.h>
 #include <Register/PchRegsLpc.h>
@@ -579,6 +580,7 @@ EspiSmiCallback (
   ESPI_SMI_TYPE       EspiSmiType;
   ESPI_SMI_RECORD     *RecordInDb;
   LIST_ENTRY          *LinkInDb;
+  UINT64              LatencyStart;
 
   PchSmiRecord = DATABASE_RECORD_FROM_LINK (DispatchHandle);
 
@@ -619,7 +621,9 @@ EspiSmiCallback (
         // Callback
         //
         if (RecordInDb->Callback != NULL) {
+          LatencyStart = SmiHandlerLatencyStart ();
           RecordInDb->Callback ((EFI_HANDLE) &RecordInDb->Link);
+          SmiHandlerLatencyStop ((VOID *) (UINTN) RecordInDb->Callback, LatencyStart);
         } else {
           ASSERT (FALSE);
         }
@@ -8,6 +8,7 @@
 
 #include "PchSmmHelpers.h"
 #include <Protocol/SmmCpu.h>
+#include <Library/SmiHandlerLatencyLib.h>
 #include <Register/PchRegsLpc.h>
 #include <Register/PchRegsPmc.h>
 
@@ -287,6 +288,7 @@ PchSwSmiDispatcher (
   LIST_ENTRY                            *LinkInDb;
   EFI_SMM_SW_CONTEXT                    SwSmiCommBuffer;
   UINTN                                 SwSmiCommBufferSize;
+  UINT64                                LatencyStart;
 
   SwSmiCommBufferSize      = sizeof (EFI_SMM_SW_CONTEXT);
   //
@@ -333,7 +335,9 @@ PchSwSmiDispatcher (
     while (!IsNull (&mSwSmiCallbackDataBase, LinkInDb)) {
       SwSmiRecord = SW_SMI_RECORD_FROM_LINK (LinkInDb);
       if (SwSmiRecord->Context.SwSmiInputValue == SmiIoInfo.IoData) {
+        LatencyStart = SmiHandlerLatencyStart ();
         SwSmiRecord->Callback ((EFI_HANDLE) &SwSmiRecord->Link, &SwSmiRecord->Context, &SwSmiCommBuffer, &SwSmiCommBufferSize);
+        SmiHandlerLatencyStop ((VOID *) (UINTN) SwSmiRecord->Callback, LatencyStart);
       }
       LinkInDb = GetNextNode (&mSwSmiCallbackDataBase, &SwSmiRecord->Link);
     }
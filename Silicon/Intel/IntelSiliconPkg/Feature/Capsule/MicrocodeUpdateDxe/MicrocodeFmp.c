@@ -34,6 +34,35 @@ InitializeMicrocodeDescriptor (
   IN MICROCODE_FMP_PRIVATE_DATA  *MicrocodeFmpPrivate
   );
 
+/**
+  Rebuild the Microcode descriptors if the Microcode region was written
+  since they were built.
+
+  @param[in] MicrocodeFmpPrivate private data structure.
+
+  @return EFI_SUCCESS The Microcode descriptors are up to date.
+**/
+EFI_STATUS
+RefreshMicrocodeDescriptor (
+  IN MICROCODE_FMP_PRIVATE_DATA  *MicrocodeFmpPrivate
+  )
+{
+  EFI_STATUS                     Status;
+
+  if (!MicrocodeFmpPrivate->InventoryStale) {
+    return EFI_SUCCESS;
+  }
+
+  Status = InitializeMicrocodeDescriptor(MicrocodeFmpPrivate);
+  if (EFI_ERROR(Status)) {
+    DEBUG((DEBUG_ERROR, "InitializeMicrocodeDescriptor - %r\n", Status));
+    return Status;
+  }
+  DumpPrivateInfo (MicrocodeFmpPrivate);
+
+  return EFI_SUCCESS;
+}
+
 /**
   Returns information about the current firmware image(s) of the device.
 
@@ -94,6 +123,10 @@ FmpGetImageInfo (
     return EFI_INVALID_PARAMETER;
   }
 
+  if (EFI_ERROR(RefreshMicrocodeDescriptor (MicrocodeFmpPrivate))) {
+    return EFI_DEVICE_ERROR;
+  }
+
   if (*ImageInfoSize < sizeof(EFI_FIRMWARE_IMAGE_DESCRIPTOR) * MicrocodeFmpPrivate->DescriptorCount) {
     *ImageInfoSize = sizeof(EFI_FIRMWARE_IMAGE_DESCRIPTOR) * MicrocodeFmpPrivate->DescriptorCount;
     return EFI_BUFFER_TOO_SMALL;
@@ -176,6 +209,10 @@ FmpGetImage (
 
   MicrocodeFmpPrivate = MICROCODE_FMP_PRIVATE_DATA_FROM_FMP(This);
 
+  if (EFI_ERROR(RefreshMicrocodeDescriptor (MicrocodeFmpPrivate))) {
+    return EFI_NOT_FOUND;
+  }
+
   if (ImageIndex == 0 || ImageIndex > MicrocodeFmpPrivate->DescriptorCount || ImageSize == NULL || Image == NULL) {
     return EFI_INVALID_PARAMETER;
   }
@@ -261,6 +298,10 @@ FmpSetImage (
   MicrocodeFmpPrivate = MICROCODE_FMP_PRIVATE_DATA_FROM_FMP(This);
   *AbortReason     = NULL;
 
+  if (EFI_ERROR(RefreshMicrocodeDescriptor (MicrocodeFmpPrivate))) {
+    return EFI_ABORTED;
+  }
+
   if (ImageIndex == 0 || ImageIndex > MicrocodeFmpPrivate->DescriptorCount || Image == NULL) {
     return EFI_INVALID_PARAMETER;
   }
@@ -276,10 +317,11 @@ FmpSetImage (
                      );
   DEBUG((DEBUG_INFO, "SetLastAttempt - %r\n", VarStatus));
 
-  if (!EFI_ERROR(Status)) {
-    InitializeMicrocodeDescriptor(MicrocodeFmpPrivate);
-    DumpPrivateInfo (MicrocodeFmpPrivate);
-  }
+  //
+  // The descriptors are rebuilt from the written region when they are next
+  // queried, so back-to-back updates and an update followed by a reset do
+  // not parse the region in between.
+  //
 
   return Status;
 }
@@ -625,6 +667,7 @@ InitializedProcessorMicrocodeIndex (
   )
 {
   UINTN       CpuIndex;
+  UINTN       Index;
   UINTN       MicrocodeIndex;
   UINTN       TargetCpuIndex;
   UINT32      AttemptStatus;
@@ -634,6 +677,21 @@ InitializedProcessorMicrocodeIndex (
     if (MicrocodeFmpPrivate->ProcessorInfo[CpuIndex].MicrocodeIndex != (UINTN)-1) {
       continue;
     }
+    //
+    // Processors with the same signature, platform ID and revision match the
+    // same Microcode, so only verify it for the first of them.
+    //
+    for (Index = 0; Index < CpuIndex; Index++) {
+      if ((MicrocodeFmpPrivate->ProcessorInfo[Index].ProcessorSignature == MicrocodeFmpPrivate->ProcessorInfo[CpuIndex].ProcessorSignature) &&
+          (MicrocodeFmpPrivate->ProcessorInfo[Index].PlatformId == MicrocodeFmpPrivate->ProcessorInfo[CpuIndex].PlatformId) &&
+          (MicrocodeFmpPrivate->ProcessorInfo[Index].MicrocodeRevision == MicrocodeFmpPrivate->ProcessorInfo[CpuIndex].MicrocodeRevision)) {
+        break;
+      }
+    }
+    if (Index < CpuIndex) {
+      MicrocodeFmpPrivate->ProcessorInfo[CpuIndex].MicrocodeIndex = MicrocodeFmpPrivate->ProcessorInfo[Index].MicrocodeIndex;
+      continue;
+    }
     for (MicrocodeIndex = 0; MicrocodeIndex < MicrocodeFmpPrivate->DescriptorCount; MicrocodeIndex++) {
       if (!MicrocodeFmpPrivate->MicrocodeInfo[MicrocodeIndex].InUse) {
         continue;
@@ -670,6 +728,14 @@ InitializeMicrocodeDescriptor (
 {
   EFI_STATUS Status;
   UINT8      CurrentMicrocodeCount;
+  UINTN      CpuIndex;
+
+  //
+  // The Microcode indexes refer to the previous layout of the region.
+  //
+  for (CpuIndex = 0; CpuIndex < MicrocodeFmpPrivate->ProcessorCount; CpuIndex++) {
+    MicrocodeFmpPrivate->ProcessorInfo[CpuIndex].MicrocodeIndex = (UINTN)-1;
+  }
 
   CurrentMicrocodeCount = (UINT8)GetMicrocodeInfo (MicrocodeFmpPrivate, 0, NULL, NULL);
 
@@ -692,6 +758,7 @@ InitializeMicrocodeDescriptor (
   if (MicrocodeFmpPrivate->ImageDescriptor == NULL) {
     MicrocodeFmpPrivate->ImageDescriptor = AllocateZeroPool(MicrocodeFmpPrivate->DescriptorCount * sizeof(EFI_FIRMWARE_IMAGE_DESCRIPTOR));
     if (MicrocodeFmpPrivate->ImageDescriptor == NULL) {
+      MicrocodeFmpPrivate->DescriptorCount = 0;
       return EFI_OUT_OF_RESOURCES;
     }
   }
@@ -699,6 +766,8 @@ InitializeMicrocodeDescriptor (
     MicrocodeFmpPrivate->MicrocodeInfo = AllocateZeroPool(MicrocodeFmpPrivate->DescriptorCount * sizeof(MICROCODE_INFO));
     if (MicrocodeFmpPrivate->MicrocodeInfo == NULL) {
       FreePool (MicrocodeFmpPrivate->ImageDescriptor);
+      MicrocodeFmpPrivate->ImageDescriptor = NULL;
+      MicrocodeFmpPrivate->DescriptorCount = 0;
       return EFI_OUT_OF_RESOURCES;
     }
   }
@@ -712,10 +781,14 @@ InitializeMicrocodeDescriptor (
   if (EFI_ERROR(Status)) {
     FreePool (MicrocodeFmpPrivate->ImageDescriptor);
     FreePool (MicrocodeFmpPrivate->MicrocodeInfo);
+    MicrocodeFmpPrivate->ImageDescriptor = NULL;
+    MicrocodeFmpPrivate->MicrocodeInfo = NULL;
+    MicrocodeFmpPrivate->DescriptorCount = 0;
     DEBUG((DEBUG_ERROR, "InitializeFitMicrocodeInfo - %r\n", Status));
     return Status;
   }
 
+  MicrocodeFmpPrivate->InventoryStale = FALSE;
   return EFI_SUCCESS;
 }
 
@@ -738,6 +811,7 @@ InitializeProcessorInfo (
   UINTN                                NumberOfEnabledProcessors;
   UINTN                                Index;
   UINTN                                BspIndex;
+  EFI_PROCESSOR_INFORMATION            ProcessorInformation;
 
   Status = gBS->LocateProtocol (&gEfiMpServiceProtocolGuid, NULL, (VOID **)&MpService);
   ASSERT_EFI_ERROR(Status);
@@ -762,9 +836,32 @@ InitializeProcessorInfo (
   for (Index = 0; Index < NumberOfProcessors; Index++) {
     MicrocodeFmpPrivate->ProcessorInfo[Index].CpuIndex = Index;
     MicrocodeFmpPrivate->ProcessorInfo[Index].MicrocodeIndex = (UINTN)-1;
-    if (Index == BspIndex) {
-      CollectProcessorInfo (&MicrocodeFmpPrivate->ProcessorInfo[Index]);
-    } else {
+    Status = MpService->GetProcessorInfo (MpService, Index, &ProcessorInformation);
+    if (!EFI_ERROR(Status)) {
+      MicrocodeFmpPrivate->ProcessorInfo[Index].Package = ProcessorInformation.Location.Package;
+      MicrocodeFmpPrivate->ProcessorInfo[Index].Core    = ProcessorInformation.Location.Core;
+      MicrocodeFmpPrivate->ProcessorInfo[Index].Thread  = ProcessorInformation.Location.Thread;
+    }
+  }
+
+  //
+  // Collect on all APs at once, and fall back to one AP after another.
+  //
+  CollectProcessorInfo (&MicrocodeFmpPrivate->ProcessorInfo[BspIndex]);
+  Status = MpService->StartupAllAPs (
+                        MpService,
+                        CollectProcessorInfoAll,
+                        FALSE,
+                        NULL,
+                        0,
+                        MicrocodeFmpPrivate,
+                        NULL
+                        );
+  if (EFI_ERROR(Status) && (Status != EFI_NOT_STARTED)) {
+    for (Index = 0; Index < NumberOfProcessors; Index++) {
+      if (Index == BspIndex) {
+        continue;
+      }
       Status = MpService->StartupThisAP (
                             MpService,
                             CollectProcessorInfo,
@@ -166,6 +166,121 @@ LoadMicrocodeOnThis (
   }
 }
 
+/**
+  Load Microcode on the calling processor if it is marked LoadPending.
+  The function prototype for invoking a function on all Application Processors.
+
+  @param[in,out] Buffer  The pointer to MICROCODE_LOAD_ALL_BUFFER.
+**/
+VOID
+EFIAPI
+MicrocodeLoadAll (
+  IN OUT VOID  *Buffer
+  )
+{
+  MICROCODE_LOAD_ALL_BUFFER            *MicrocodeLoadAllBuffer;
+  MICROCODE_FMP_PRIVATE_DATA           *MicrocodeFmpPrivate;
+  EFI_STATUS                           Status;
+  UINTN                                CpuIndex;
+
+  MicrocodeLoadAllBuffer = Buffer;
+  MicrocodeFmpPrivate = MicrocodeLoadAllBuffer->MicrocodeFmpPrivate;
+  Status = MicrocodeFmpPrivate->MpService->WhoAmI (MicrocodeFmpPrivate->MpService, &CpuIndex);
+  if (EFI_ERROR(Status) || (CpuIndex >= MicrocodeFmpPrivate->ProcessorCount)) {
+    return;
+  }
+
+  if (MicrocodeFmpPrivate->ProcessorInfo[CpuIndex].LoadPending) {
+    MicrocodeFmpPrivate->ProcessorInfo[CpuIndex].MicrocodeRevision = LoadMicrocode (MicrocodeLoadAllBuffer->Address);
+  }
+}
+
+/**
+  Load a verified Microcode on all other processors it applies to.
+
+  Only one thread per core is loaded, since the threads of a core share the
+  Microcode and must not update it concurrently. The core of the processor
+  the Microcode was verified on is skipped. The APs are loaded together
+  through StartupAllAPs(), falling back to one AP after another if that
+  fails.
+
+  @param[in]  MicrocodeFmpPrivate        The Microcode driver private data
+  @param[in]  LoadedProcessorInfo        The processor the Microcode was verified and loaded on.
+  @param[in]  MicrocodeEntryPoint        The Microcode.
+**/
+VOID
+LoadMicrocodeOnAll (
+  IN MICROCODE_FMP_PRIVATE_DATA  *MicrocodeFmpPrivate,
+  IN PROCESSOR_INFO              *LoadedProcessorInfo,
+  IN CPU_MICROCODE_HEADER        *MicrocodeEntryPoint
+  )
+{
+  EFI_STATUS                           Status;
+  EFI_MP_SERVICES_PROTOCOL             *MpService;
+  MICROCODE_LOAD_ALL_BUFFER            MicrocodeLoadAllBuffer;
+  PROCESSOR_INFO                       *ProcessorInfo;
+  UINTN                                Index;
+  UINTN                                PendingCount;
+  BOOLEAN                              BspPending;
+
+  PendingCount = 0;
+  for (Index = 0; Index < MicrocodeFmpPrivate->ProcessorCount; Index++) {
+    ProcessorInfo = &MicrocodeFmpPrivate->ProcessorInfo[Index];
+    ProcessorInfo->LoadPending = (BOOLEAN) ((ProcessorInfo->ProcessorSignature == LoadedProcessorInfo->ProcessorSignature) &&
+                                            (ProcessorInfo->PlatformId == LoadedProcessorInfo->PlatformId) &&
+                                            (ProcessorInfo->MicrocodeRevision < MicrocodeEntryPoint->UpdateRevision) &&
+                                            (ProcessorInfo->Thread == 0) &&
+                                            ((ProcessorInfo->Package != LoadedProcessorInfo->Package) ||
+                                             (ProcessorInfo->Core != LoadedProcessorInfo->Core)));
+    if (ProcessorInfo->LoadPending) {
+      PendingCount++;
+    }
+  }
+  DEBUG((DEBUG_INFO, "LoadMicrocodeOnAll - 0x%x processors\n", PendingCount));
+  if (PendingCount == 0) {
+    return;
+  }
+
+  MpService = MicrocodeFmpPrivate->MpService;
+  MicrocodeLoadAllBuffer.MicrocodeFmpPrivate = MicrocodeFmpPrivate;
+  MicrocodeLoadAllBuffer.Address = (UINTN)MicrocodeEntryPoint + sizeof(CPU_MICROCODE_HEADER);
+  BspPending = MicrocodeFmpPrivate->ProcessorInfo[MicrocodeFmpPrivate->BspIndex].LoadPending;
+  if ((PendingCount > 1) || !BspPending) {
+    Status = MpService->StartupAllAPs (
+                          MpService,
+                          MicrocodeLoadAll,
+                          FALSE,
+                          NULL,
+                          0,
+                          &MicrocodeLoadAllBuffer,
+                          NULL
+                          );
+    if (EFI_ERROR(Status) && (Status != EFI_NOT_STARTED)) {
+      DEBUG((DEBUG_ERROR, "LoadMicrocodeOnAll - StartupAllAPs - %r\n", Status));
+      for (Index = 0; Index < MicrocodeFmpPrivate->ProcessorCount; Index++) {
+        ProcessorInfo = &MicrocodeFmpPrivate->ProcessorInfo[Index];
+        if (ProcessorInfo->LoadPending && (Index != MicrocodeFmpPrivate->BspIndex) &&
+            (ProcessorInfo->MicrocodeRevision != MicrocodeEntryPoint->UpdateRevision)) {
+          ProcessorInfo->MicrocodeRevision = LoadMicrocodeOnThis (MicrocodeFmpPrivate, Index, MicrocodeLoadAllBuffer.Address);
+        }
+      }
+    }
+  }
+  if (BspPending) {
+    MicrocodeLoadAll (&MicrocodeLoadAllBuffer);
+  }
+
+  for (Index = 0; Index < MicrocodeFmpPrivate->ProcessorCount; Index++) {
+    ProcessorInfo = &MicrocodeFmpPrivate->ProcessorInfo[Index];
+    if (ProcessorInfo->LoadPending) {
+      ProcessorInfo->LoadPending = FALSE;
+      if (ProcessorInfo->MicrocodeRevision != MicrocodeEntryPoint->UpdateRevision) {
+        DEBUG((DEBUG_ERROR, "LoadMicrocodeOnAll - fail on processor 0x%x (0x%08x)\n", Index, ProcessorInfo->MicrocodeRevision));
+      }
+    }
+  }
+}
+
 /**
   Collect processor information.
   The function prototype for invoking a function on an Application Processor.
@@ -186,6 +301,30 @@ CollectProcessorInfo (
   ProcessorInfo->MicrocodeRevision = GetCurrentMicrocodeSignature();
 }
 
+/**
+  Collect processor information into the entry of the calling processor.
+  The function prototype for invoking a function on all Application Processors.
+
+  @param[in,out] Buffer  The pointer to the Microcode driver private data.
+**/
+VOID
+EFIAPI
+CollectProcessorInfoAll (
+  IN OUT VOID  *Buffer
+  )
+{
+  MICROCODE_FMP_PRIVATE_DATA           *MicrocodeFmpPrivate;
+  EFI_STATUS                           Status;
+  UINTN                                CpuIndex;
+
+  MicrocodeFmpPrivate = Buffer;
+  Status = MicrocodeFmpPrivate->MpService->WhoAmI (MicrocodeFmpPrivate->MpService, &CpuIndex);
+  if (EFI_ERROR(Status) || (CpuIndex >= MicrocodeFmpPrivate->ProcessorCount)) {
+    return;
+  }
+  CollectProcessorInfo (&MicrocodeFmpPrivate->ProcessorInfo[CpuIndex]);
+}
+
 /**
   Get current Microcode information.
 
@@ -244,6 +383,16 @@ GetMicrocodeInfo (
         TotalSize = MicrocodeEntryPoint->TotalSize;
       }
 
+      //
+      // Only counting, the verification is done when the information is collected.
+      //
+      if ((ImageDescriptor == NULL) && (MicrocodeInfo == NULL)) {
+        Count++;
+        ASSERT(Count < 0xFF);
+        MicrocodeEntryPoint = (CPU_MICROCODE_HEADER *) (((UINTN) MicrocodeEntryPoint) + TotalSize);
+        continue;
+      }
+
       TargetCpuIndex = (UINTN)-1;
       Status = VerifyMicrocode(MicrocodeFmpPrivate, MicrocodeEntryPoint, TotalSize, FALSE, &AttemptStatus, NULL, &TargetCpuIndex);
       if (!EFI_ERROR(Status)) {
@@ -1300,6 +1449,10 @@ MicrocodeWrite (
   }
   DEBUG((DEBUG_INFO, "  TargetMicrocodeEntryPoint - 0x%x\n", TargetMicrocodeEntryPoint));
 
+  //
+  // Even a failed update may have modified the Microcode region.
+  //
+  MicrocodeFmpPrivate->InventoryStale = TRUE;
   if (MicrocodeFmpPrivate->FitMicrocodeInfo != NULL) {
     Status = UpdateMicrocodeFlashRegionWithFit (
                MicrocodeFmpPrivate,
@@ -1318,6 +1471,13 @@ MicrocodeWrite (
                );
   }
 
+  //
+  // The new Microcode is in flash, bring the remaining processors to it too.
+  //
+  if (!EFI_ERROR(Status) && PcdGetBool(PcdMicrocodeUpdateLoadAllProcessors)) {
+    LoadMicrocodeOnAll (MicrocodeFmpPrivate, &MicrocodeFmpPrivate->ProcessorInfo[TargetCpuIndex], AlignedImage);
+  }
+
   FreePool(AlignedImage);
 
   return Status;
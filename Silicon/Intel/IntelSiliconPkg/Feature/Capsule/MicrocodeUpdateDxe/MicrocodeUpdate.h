@@ -66,6 +66,10 @@ typedef struct {
   UINT8                  PlatformId;
   UINT32                 MicrocodeRevision;
   UINTN                  MicrocodeIndex;
+  UINT32                 Package;
+  UINT32                 Core;
+  UINT32                 Thread;
+  BOOLEAN                LoadPending;
 } PROCESSOR_INFO;
 
 typedef struct {
@@ -91,10 +95,20 @@ struct _MICROCODE_FMP_PRIVATE_DATA {
   PROCESSOR_INFO                       *ProcessorInfo;
   UINT32                               FitMicrocodeEntryCount;
   FIT_MICROCODE_INFO                   *FitMicrocodeInfo;
+  //
+  // TRUE once the Microcode region was written and the information above
+  // has not been rebuilt from it yet.
+  //
+  BOOLEAN                              InventoryStale;
 };
 
 typedef struct _MICROCODE_FMP_PRIVATE_DATA  MICROCODE_FMP_PRIVATE_DATA;
 
+typedef struct {
+  MICROCODE_FMP_PRIVATE_DATA  *MicrocodeFmpPrivate;
+  UINT64                      Address;
+} MICROCODE_LOAD_ALL_BUFFER;
+
 #define MICROCODE_FMP_LAST_ATTEMPT_VARIABLE_NAME  L"MicrocodeLastAttemptVar"
 
 /**
@@ -142,6 +156,18 @@ CollectProcessorInfo (
   IN OUT VOID  *Buffer
   );
 
+/**
+  Collect processor information into the entry of the calling processor.
+  The function prototype for invoking a function on all Application Processors.
+
+  @param[in,out] Buffer  The pointer to the Microcode driver private data.
+**/
+VOID
+EFIAPI
+CollectProcessorInfoAll (
+  IN OUT VOID  *Buffer
+  );
+
 /**
   Get current Microcode information.
 
@@ -200,6 +226,20 @@ VerifyMicrocode (
   IN OUT UINTN                    *TargetCpuIndex  OPTIONAL
   );
 
+/**
+  Load a verified Microcode on all other processors it applies to.
+
+  @param[in]  MicrocodeFmpPrivate        The Microcode driver private data
+  @param[in]  LoadedProcessorInfo        The processor the Microcode was verified and loaded on.
+  @param[in]  MicrocodeEntryPoint        The Microcode.
+**/
+VOID
+LoadMicrocodeOnAll (
+  IN MICROCODE_FMP_PRIVATE_DATA  *MicrocodeFmpPrivate,
+  IN PROCESSOR_INFO              *LoadedProcessorInfo,
+  IN CPU_MICROCODE_HEADER        *MicrocodeEntryPoint
+  );
+
 /**
   Write Microcode.
 
@@ -40,6 +40,12 @@ typedef struct {
   UINTN         PciFunction;
 } PCI_DEVICE_INSTANCE;
 
+//
+// Number of times the digest is read again when the device reports that it
+// changed while it was being read.
+//
+#define DIGEST_READ_RETRY_COUNT  8
+
 #define PCI_DEVICE_INSTANCE_SIGNATURE  SIGNATURE_32 ('P', 'D', 'I', 'S')
 #define PCI_DEVICE_INSTANCE_FROM_LINK(a)  CR (a, PCI_DEVICE_INSTANCE, Link, PCI_DEVICE_INSTANCE_SIGNATURE)
 
@@ -323,7 +329,7 @@ ExtendDigestRegister (
   EFI_STATUS                                               Status;
   PCI_TYPE00                                               PciData;
 
-  Status = PciIo->Pci.Read (PciIo, EfiPciIoWidthUint8, 0, sizeof(PciData), &PciData);
+  Status = PciIo->Pci.Read (PciIo, EfiPciIoWidthUint32, 0, sizeof(PciData)/sizeof(UINT32), &PciData);
   ASSERT_EFI_ERROR(Status);
 
   //
@@ -393,19 +399,31 @@ DoMeasurementsFromDigestRegister (
   OUT EDKII_DEVICE_SECURITY_STATE *DeviceSecurityState
   )
 {
+  INTEL_PCI_DIGEST_CAPABILITY_STRUCTURE     DigestCap;
   UINT8                                     Modified;
   UINT8                                     Valid;
   UINT16                                    TcgAlgId;
   UINT8                                     NumDigest;
   UINT8                                     DigestSel;
-  UINT8                                     Digest[SHA256_DIGEST_SIZE];
+  UINT32                                    Digest[SHA256_DIGEST_SIZE / sizeof(UINT32)];
   UINTN                                     DigestSize;
+  UINTN                                     Retry;
   EFI_STATUS                                Status;
 
-  TcgAlgId = DvSecPciRead8 (
-               PciIo,
-               DvSecOffset + sizeof(INTEL_PCI_DIGEST_CAPABILITY_HEADER) + OFFSET_OF(INTEL_PCI_DIGEST_CAPABILITY_STRUCTURE, TcgAlgId)
-               );
+  //
+  // Fetch the whole capability structure in one go rather than a config
+  // cycle per field. It starts right after the header, on a WORD boundary.
+  //
+  Status = PciIo->Pci.Read (
+                        PciIo,
+                        EfiPciIoWidthUint16,
+                        DvSecOffset + sizeof(INTEL_PCI_DIGEST_CAPABILITY_HEADER),
+                        sizeof(DigestCap)/sizeof(UINT16),
+                        &DigestCap
+                        );
+  ASSERT_EFI_ERROR(Status);
+
+  TcgAlgId = DigestCap.TcgAlgId;
   DEBUG((DEBUG_INFO, "  TcgAlgId      - 0x%04x\n", TcgAlgId));
   DigestSize = DigestSizeFromTcgAlgId (TcgAlgId);
   if (DigestSize == 0) {
@@ -417,16 +435,10 @@ DoMeasurementsFromDigestRegister (
 
   DeviceSecurityState->MeasurementState = EDKII_DEVICE_SECURITY_STATE_SUCCESS;
 
-  NumDigest = DvSecPciRead8 (
-                PciIo,
-                DvSecOffset + sizeof(INTEL_PCI_DIGEST_CAPABILITY_HEADER) + OFFSET_OF(INTEL_PCI_DIGEST_CAPABILITY_STRUCTURE, FirmwareID)
-                );
+  NumDigest = DigestCap.FirmwareID;
   DEBUG((DEBUG_INFO, "  NumDigest     - 0x%02x\n", NumDigest));
 
-  Valid = DvSecPciRead8 (
-            PciIo,
-            DvSecOffset + sizeof(INTEL_PCI_DIGEST_CAPABILITY_HEADER) + OFFSET_OF(INTEL_PCI_DIGEST_CAPABILITY_STRUCTURE, Valid)
-            );
+  Valid = DigestCap.Valid.Data;
   DEBUG((DEBUG_INFO, "  Valid         - 0x%02x\n", Valid));
 
   //
@@ -445,7 +457,7 @@ DoMeasurementsFromDigestRegister (
     if ((DigestSel == 1) && ((Valid & INTEL_PCI_DIGEST_1_VALID) == 0)) {
       continue;
     }
-    while (TRUE) {
+    for (Retry = 0; Retry < DIGEST_READ_RETRY_COUNT; Retry++) {
       //
       // Host MUST clear DIGEST_MODIFIED before read DIGEST.
       //
@@ -455,11 +467,14 @@ DoMeasurementsFromDigestRegister (
         INTEL_PCI_DIGEST_MODIFIED
         );
 
+      //
+      // The digests are DWORD aligned, read them a DWORD per config cycle.
+      //
       Status = PciIo->Pci.Read (
                             PciIo,
-                            EfiPciIoWidthUint8,
+                            EfiPciIoWidthUint32,
                             (UINT32)(DvSecOffset + sizeof(INTEL_PCI_DIGEST_CAPABILITY_HEADER) + sizeof(INTEL_PCI_DIGEST_CAPABILITY_STRUCTURE) + DigestSize * DigestSel),
-                            DigestSize,
+                            DigestSize / sizeof(UINT32),
                             Digest
                             );
       ASSERT_EFI_ERROR(Status);
@@ -475,6 +490,11 @@ DoMeasurementsFromDigestRegister (
         break;
       }
     }
+    if (Retry == DIGEST_READ_RETRY_COUNT) {
+      DEBUG((DEBUG_ERROR, "  Digest keeps changing, give up\n"));
+      DeviceSecurityState->MeasurementState = EDKII_DEVICE_SECURITY_STATE_ERROR_PCI_NO_CAPABILITIES;
+      return ;
+    }
 
     //
     // Dump Digest
@@ -483,13 +503,13 @@ DoMeasurementsFromDigestRegister (
       UINTN  Index;
       DEBUG((DEBUG_INFO, "  Digest        - "));
       for (Index = 0; Index < DigestSize; Index++) {
-        DEBUG((DEBUG_INFO, "%02x", *(Digest + Index)));
+        DEBUG((DEBUG_INFO, "%02x", *((UINT8 *)Digest + Index)));
       }
       DEBUG((DEBUG_INFO, "\n"));
     }
 
     DEBUG((DEBUG_INFO, "ExtendDigestRegister...\n", ExtendDigestRegister));
-    ExtendDigestRegister (PciIo, DeviceSecurityPolicy, TcgAlgId, DigestSel, Digest, DeviceSecurityState);
+    ExtendDigestRegister (PciIo, DeviceSecurityPolicy, TcgAlgId, DigestSel, (UINT8 *)Digest, DeviceSecurityState);
   }
 }
 
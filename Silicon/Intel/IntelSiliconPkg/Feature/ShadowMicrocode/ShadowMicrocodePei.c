@@ -25,6 +25,15 @@ typedef struct {
   UINTN    Size;
 } MICROCODE_PATCH_INFO;
 
+//
+// One entry per unique processor signature, with the platform IDs of all the
+// processors of that signature merged into a ProcessorFlags-style mask.
+//
+typedef struct {
+  UINT32   ProcessorSignature;
+  UINT32   PlatformMask;
+} MICROCODE_CPU_MATCH;
+
 /**
   Shadow microcode update patches to memory.
 
@@ -71,11 +80,51 @@ EFI_PEI_PPI_DESCRIPTOR           mPeiShadowMicrocodePpiList[] = {
 };
 
 /**
-  Determine if a microcode patch matchs the specific processor signature and flag.
+  Build the table of unique processor signatures to match the microcode
+  patches against.
 
   @param[in]  CpuIdCount            Number of elements in MicrocodeCpuId array.
   @param[in]  MicrocodeCpuId        A pointer to an array of EDKII_PEI_MICROCODE_CPU_ID
                                     structures.
+  @param[out] MatchTable            The table, with room for CpuIdCount entries.
+
+  @return The number of entries in MatchTable.
+**/
+UINTN
+BuildCpuMatchTable (
+  IN  UINTN                           CpuIdCount,
+  IN  EDKII_PEI_MICROCODE_CPU_ID      *MicrocodeCpuId,
+  OUT MICROCODE_CPU_MATCH             *MatchTable
+  )
+{
+  UINTN          Index;
+  UINTN          MatchIndex;
+  UINTN          MatchCount;
+
+  MatchCount = 0;
+  for (Index = 0; Index < CpuIdCount; Index++) {
+    for (MatchIndex = 0; MatchIndex < MatchCount; MatchIndex++) {
+      if (MatchTable[MatchIndex].ProcessorSignature == MicrocodeCpuId[Index].ProcessorSignature) {
+        break;
+      }
+    }
+    if (MatchIndex == MatchCount) {
+      MatchTable[MatchIndex].ProcessorSignature = MicrocodeCpuId[Index].ProcessorSignature;
+      MatchTable[MatchIndex].PlatformMask       = 0;
+      MatchCount++;
+    }
+    MatchTable[MatchIndex].PlatformMask |= (1 << MicrocodeCpuId[Index].PlatformId);
+  }
+
+  return MatchCount;
+}
+
+/**
+  Determine if a microcode patch matchs the specific processor signature and flag.
+
+  @param[in]  MatchCount            Number of elements in MatchTable array.
+  @param[in]  MatchTable            The unique processor signatures built by
+                                    BuildCpuMatchTable().
   @param[in]  ProcessorSignature    The processor signature field value
                                     supported by a microcode patch.
   @param[in]  ProcessorFlags        The prcessor flags field value supported by
@@ -86,17 +135,17 @@ EFI_PEI_PPI_DESCRIPTOR           mPeiShadowMicrocodePpiList[] = {
 **/
 BOOLEAN
 IsProcessorMatchedMicrocodePatch (
-  IN  UINTN                           CpuIdCount,
-  IN  EDKII_PEI_MICROCODE_CPU_ID      *MicrocodeCpuId,
+  IN  UINTN                           MatchCount,
+  IN  MICROCODE_CPU_MATCH             *MatchTable,
   IN UINT32                           ProcessorSignature,
   IN UINT32                           ProcessorFlags
   )
 {
   UINTN          Index;
 
-  for (Index = 0; Index < CpuIdCount; Index++) {
-    if ((ProcessorSignature == MicrocodeCpuId[Index].ProcessorSignature) &&
-        (ProcessorFlags & (1 << MicrocodeCpuId[Index].PlatformId)) != 0) {
+  for (Index = 0; Index < MatchCount; Index++) {
+    if ((ProcessorSignature == MatchTable[Index].ProcessorSignature) &&
+        (ProcessorFlags & MatchTable[Index].PlatformMask) != 0) {
       return TRUE;
     }
   }
@@ -109,9 +158,9 @@ IsProcessorMatchedMicrocodePatch (
   patch header with the CPUID and PlatformID of the processors within
   system to decide if it will be copied into memory.
 
-  @param[in]  CpuIdCount            Number of elements in MicrocodeCpuId array.
-  @param[in]  MicrocodeCpuId        A pointer to an array of EDKII_PEI_MICROCODE_CPU_ID
-                                    structures.
+  @param[in]  MatchCount            Number of elements in MatchTable array.
+  @param[in]  MatchTable            The unique processor signatures built by
+                                    BuildCpuMatchTable().
   @param[in]  MicrocodeEntryPoint   The pointer to the microcode patch header.
 
   @retval TRUE     The specified microcode patch need to be loaded.
@@ -119,8 +168,8 @@ IsProcessorMatchedMicrocodePatch (
 **/
 BOOLEAN
 IsMicrocodePatchNeedLoad (
-  IN  UINTN                         CpuIdCount,
-  IN  EDKII_PEI_MICROCODE_CPU_ID    *MicrocodeCpuId,
+  IN  UINTN                         MatchCount,
+  IN  MICROCODE_CPU_MATCH           *MatchTable,
   CPU_MICROCODE_HEADER              *MicrocodeEntryPoint
   )
 {
@@ -136,8 +185,8 @@ IsMicrocodePatchNeedLoad (
   // Check the 'ProcessorSignature' and 'ProcessorFlags' in microcode patch header.
   //
   NeedLoad = IsProcessorMatchedMicrocodePatch (
-               CpuIdCount,
-               MicrocodeCpuId,
+               MatchCount,
+               MatchTable,
                MicrocodeEntryPoint->ProcessorSignature.Uint32,
                MicrocodeEntryPoint->ProcessorFlags
                );
@@ -163,8 +212,8 @@ IsMicrocodePatchNeedLoad (
       // within system to decide if it will be copied into memory
       //
       NeedLoad = IsProcessorMatchedMicrocodePatch (
-                   CpuIdCount,
-                   MicrocodeCpuId,
+                   MatchCount,
+                   MatchTable,
                    ExtendedTable->ProcessorSignature.Uint32,
                    ExtendedTable->ProcessorFlag
                    );
@@ -202,6 +251,8 @@ ShadowMicrocodePatchWorker (
   )
 {
   UINTN                                     Index;
+  UINTN                                     RunStart;
+  UINTN                                     RunSize;
   VOID                                      *MicrocodePatchInRam;
   UINT8                                     *Walker;
   EDKII_MICROCODE_SHADOW_INFO_HOB           *MicrocodeShadowHob;
@@ -239,17 +290,26 @@ ShadowMicrocodePatchWorker (
   }
 
   //
-  // Shadow all the required microcode patches into memory
+  // Shadow all the required microcode patches into memory, with one copy for
+  // each run of patches that are also adjacent in flash.
   //
+  RunStart = 0;
+  RunSize  = 0;
   for (Walker = MicrocodePatchInRam, Index = 0; Index < PatchCount; Index++) {
-    CopyMem (
-      Walker,
-      (VOID *) Patches[Index].Address,
-      Patches[Index].Size
-      );
     MicrocodeAddressInMemory[Index] = (UINT64) (UINTN) Walker;
     Flashcontext->MicrocodeAddressInFlash[Index]  = (UINT64) Patches[Index].Address;
-    Walker += Patches[Index].Size;
+    Walker  += Patches[Index].Size;
+    RunSize += Patches[Index].Size;
+    if ((Index + 1 == PatchCount) ||
+        (Patches[Index].Address + Patches[Index].Size != Patches[Index + 1].Address)) {
+      CopyMem (
+        (VOID *) (UINTN) MicrocodeAddressInMemory[RunStart],
+        (VOID *) Patches[RunStart].Address,
+        RunSize
+        );
+      RunStart = Index + 1;
+      RunSize  = 0;
+    }
   }
 
   //
@@ -392,6 +452,8 @@ ShadowMicrocode (
   UINT32                            Index;
   MICROCODE_PATCH_INFO              *PatchInfoBuffer;
   UINTN                             MaxPatchNumber;
+  MICROCODE_CPU_MATCH               *MatchTable;
+  UINTN                             MatchCount;
   CPU_MICROCODE_HEADER              *MicrocodeEntryPoint;
   UINTN                             PatchCount;
   UINTN                             TotalSize;
@@ -411,35 +473,36 @@ ShadowMicrocode (
   }
 
   //
-  // Calculate microcode entry number
+  // The FIT entry number bounds the microcode entry number, so the FIT is
+  // only walked once.
   //
   FitEntry = (FIRMWARE_INTERFACE_TABLE_ENTRY *) (UINTN) FitPointer;
   EntryNum = *(UINT32 *)(&FitEntry[0].Size[0]) & 0xFFFFFF;
-  MaxPatchNumber = 0;
-  for (Index = 0; Index < EntryNum; Index++) {
-    if (FitEntry[Index].Type == FIT_TYPE_01_MICROCODE) {
-      MaxPatchNumber++;
-    }
-  }
-  if (MaxPatchNumber == 0) {
-    return EFI_NOT_FOUND;
-  }
 
-  PatchInfoBuffer = AllocatePool (MaxPatchNumber * sizeof (MICROCODE_PATCH_INFO));
+  PatchInfoBuffer = AllocatePool (EntryNum * sizeof (MICROCODE_PATCH_INFO) + CpuIdCount * sizeof (MICROCODE_CPU_MATCH));
   if (PatchInfoBuffer == NULL) {
     return EFI_OUT_OF_RESOURCES;
   }
 
+  //
+  // Reduce the processors to their unique signatures once, instead of for
+  // every microcode patch.
+  //
+  MatchTable = (MICROCODE_CPU_MATCH *) (PatchInfoBuffer + EntryNum);
+  MatchCount = BuildCpuMatchTable (CpuIdCount, MicrocodeCpuId, MatchTable);
+
   //
   // Fill up microcode patch info buffer according to FIT table.
   //
+  MaxPatchNumber = 0;
   PatchCount = 0;
   TotalLoadSize = 0;
   for (Index = 0; Index < EntryNum; Index++) {
     if (FitEntry[Index].Type == FIT_TYPE_01_MICROCODE) {
+      MaxPatchNumber++;
       MicrocodeEntryPoint = (CPU_MICROCODE_HEADER *) (UINTN) FitEntry[Index].Address;
       TotalSize = (MicrocodeEntryPoint->DataSize == 0) ? 2048 : MicrocodeEntryPoint->TotalSize;
-      if (IsMicrocodePatchNeedLoad (CpuIdCount, MicrocodeCpuId, MicrocodeEntryPoint)) {
+      if (IsMicrocodePatchNeedLoad (MatchCount, MatchTable, MicrocodeEntryPoint)) {
         PatchInfoBuffer[PatchCount].Address     = (UINTN) MicrocodeEntryPoint;
         PatchInfoBuffer[PatchCount].Size        = TotalSize;
         TotalLoadSize += TotalSize;
@@ -447,6 +510,10 @@ ShadowMicrocode (
       }
     }
   }
+  if (MaxPatchNumber == 0) {
+    FreePool (PatchInfoBuffer);
+    return EFI_NOT_FOUND;
+  }
 
   if (PatchCount != 0) {
     DEBUG ((
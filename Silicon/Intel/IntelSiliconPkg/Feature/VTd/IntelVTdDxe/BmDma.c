@@ -24,7 +24,8 @@ typedef struct {
 #define MAP_INFO_SIGNATURE  SIGNATURE_32 ('D', 'M', 'A', 'P')
 typedef struct {
   UINT32                                    Signature;
-  LIST_ENTRY                                Link;
+  LIST_ENTRY                                Link;         // in mMapsByHandle, or mFreeMapInfo
+  LIST_ENTRY                                AddressLink;  // in mMapsByAddress
   EDKII_IOMMU_OPERATION                     Operation;
   UINTN                                     NumberOfBytes;
   UINTN                                     NumberOfPages;
@@ -33,8 +34,133 @@ typedef struct {
   LIST_ENTRY                                HandleList;
 } MAP_INFO;
 #define MAP_INFO_FROM_LINK(a) CR (a, MAP_INFO, Link, MAP_INFO_SIGNATURE)
+#define MAP_INFO_FROM_ADDRESS_LINK(a) CR (a, MAP_INFO, AddressLink, MAP_INFO_SIGNATURE)
+
+//
+// Live mappings are hashed by their handle (the MAP_INFO itself) for
+// Unmap, and by device address for SetAttribute.
+//
+#define MAP_INFO_HASH_SIZE                0x100
+#define MAP_INFO_HASH_BY_HANDLE(Mapping)  (((UINTN)(Mapping) / sizeof (MAP_INFO)) % MAP_INFO_HASH_SIZE)
+#define MAP_INFO_HASH_BY_ADDRESS(Address) ((UINTN)RShiftU64 ((Address), EFI_PAGE_SHIFT) % MAP_INFO_HASH_SIZE)
+
+//
+// MAP_INFO structures are allocated this many at a time, and recycled
+// through mFreeMapInfo instead of going back to the pool.
+//
+#define MAP_INFO_POOL_CHUNK               64
+
+LIST_ENTRY                        mMapsByHandle[MAP_INFO_HASH_SIZE];
+LIST_ENTRY                        mMapsByAddress[MAP_INFO_HASH_SIZE];
+BOOLEAN                           mMapsInitialized = FALSE;
+LIST_ENTRY                        mFreeMapInfo = INITIALIZE_LIST_HEAD_VARIABLE(mFreeMapInfo);
+
+/**
+  Initialize the hash buckets of the live mappings on first use.
+
+  The caller must be at VTD_TPL_LEVEL.
+**/
+VOID
+InitializeMapInfoHash (
+  VOID
+  )
+{
+  UINTN  Index;
+
+  if (mMapsInitialized) {
+    return;
+  }
+  for (Index = 0; Index < MAP_INFO_HASH_SIZE; Index++) {
+    InitializeListHead (&mMapsByHandle[Index]);
+    InitializeListHead (&mMapsByAddress[Index]);
+  }
+  mMapsInitialized = TRUE;
+}
+
+/**
+  Take a MAP_INFO structure from the pool, growing it if it is empty.
+
+  @return The MAP_INFO structure, not initialized.
+  @retval NULL No resource to allocate it.
+**/
+MAP_INFO *
+AllocateMapInfo (
+  VOID
+  )
+{
+  MAP_INFO                 *MapInfo;
+  EFI_TPL                  OriginalTpl;
+  UINTN                    Index;
+
+  OriginalTpl = gBS->RaiseTPL (VTD_TPL_LEVEL);
+  if (IsListEmpty (&mFreeMapInfo)) {
+    gBS->RestoreTPL (OriginalTpl);
+    MapInfo = AllocatePool (sizeof (MAP_INFO) * MAP_INFO_POOL_CHUNK);
+    if (MapInfo == NULL) {
+      return NULL;
+    }
+    OriginalTpl = gBS->RaiseTPL (VTD_TPL_LEVEL);
+    for (Index = 0; Index < MAP_INFO_POOL_CHUNK; Index++) {
+      InsertTailList (&mFreeMapInfo, &MapInfo[Index].Link);
+    }
+  }
+
+  MapInfo = BASE_CR (GetFirstNode (&mFreeMapInfo), MAP_INFO, Link);
+  RemoveEntryList (&MapInfo->Link);
+  gBS->RestoreTPL (OriginalTpl);
+
+  return MapInfo;
+}
+
+/**
+  Give a MAP_INFO structure back to the pool.
+
+  @param[in]  MapInfo           The MAP_INFO structure, no longer in the hash.
+**/
+VOID
+FreeMapInfo (
+  IN MAP_INFO              *MapInfo
+  )
+{
+  EFI_TPL                  OriginalTpl;
 
-LIST_ENTRY                        gMaps = INITIALIZE_LIST_HEAD_VARIABLE(gMaps);
+  MapInfo->Signature = 0;
+  OriginalTpl = gBS->RaiseTPL (VTD_TPL_LEVEL);
+  InsertHeadList (&mFreeMapInfo, &MapInfo->Link);
+  gBS->RestoreTPL (OriginalTpl);
+}
+
+/**
+  Find the live mapping a handle returned by Map() refers to.
+
+  The caller must be at VTD_TPL_LEVEL.
+
+  @param[in]  Mapping           The mapping value returned from Map().
+
+  @return The MAP_INFO structure.
+  @retval NULL Mapping is not a live mapping.
+**/
+MAP_INFO *
+FindMapInfoByHandle (
+  IN VOID                  *Mapping
+  )
+{
+  LIST_ENTRY               *Bucket;
+  LIST_ENTRY               *Link;
+
+  InitializeMapInfoHash ();
+  Bucket = &mMapsByHandle[MAP_INFO_HASH_BY_HANDLE (Mapping)];
+  for (Link = GetFirstNode (Bucket)
+       ; !IsNull (Bucket, Link)
+       ; Link = GetNextNode (Bucket, Link)
+       ) {
+    if (Link == &((MAP_INFO *)Mapping)->Link) {
+      return MAP_INFO_FROM_LINK (Link);
+    }
+  }
+
+  return NULL;
+}
 
 /**
   This function fills DeviceHandle/IoMmuAccess to the MAP_HANDLE_INFO,
@@ -56,6 +182,7 @@ SyncDeviceHandleToMapInfo (
 {
   MAP_INFO                 *MapInfo;
   MAP_HANDLE_INFO          *MapHandleInfo;
+  LIST_ENTRY               *Bucket;
   LIST_ENTRY               *Link;
   EFI_TPL                  OriginalTpl;
 
@@ -63,12 +190,14 @@ SyncDeviceHandleToMapInfo (
   // Find MapInfo according to DeviceAddress
   //
   OriginalTpl = gBS->RaiseTPL (VTD_TPL_LEVEL);
+  InitializeMapInfoHash ();
   MapInfo = NULL;
-  for (Link = GetFirstNode (&gMaps)
-       ; !IsNull (&gMaps, Link)
-       ; Link = GetNextNode (&gMaps, Link)
+  Bucket = &mMapsByAddress[MAP_INFO_HASH_BY_ADDRESS (DeviceAddress)];
+  for (Link = GetFirstNode (Bucket)
+       ; !IsNull (Bucket, Link)
+       ; Link = GetNextNode (Bucket, Link)
        ) {
-    MapInfo = MAP_INFO_FROM_LINK (Link);
+    MapInfo = MAP_INFO_FROM_ADDRESS_LINK (Link);
     if (MapInfo->DeviceAddress == DeviceAddress) {
       break;
     }
@@ -227,7 +356,7 @@ IoMmuMap (
   // Allocate a MAP_INFO structure to remember the mapping when Unmap() is
   // called later.
   //
-  MapInfo = AllocatePool (sizeof (MAP_INFO));
+  MapInfo = AllocateMapInfo ();
   if (MapInfo == NULL) {
     *NumberOfBytes = 0;
     DEBUG ((DEBUG_ERROR, "IoMmuMap: %r\n", EFI_OUT_OF_RESOURCES));
@@ -256,7 +385,7 @@ IoMmuMap (
                     &MapInfo->DeviceAddress
                     );
     if (EFI_ERROR (Status)) {
-      FreePool (MapInfo);
+      FreeMapInfo (MapInfo);
       *NumberOfBytes = 0;
       DEBUG ((DEBUG_ERROR, "IoMmuMap: %r\n", Status));
       return Status;
@@ -280,7 +409,9 @@ IoMmuMap (
   }
 
   OriginalTpl = gBS->RaiseTPL (VTD_TPL_LEVEL);
-  InsertTailList (&gMaps, &MapInfo->Link);
+  InitializeMapInfoHash ();
+  InsertTailList (&mMapsByHandle[MAP_INFO_HASH_BY_HANDLE (MapInfo)], &MapInfo->Link);
+  InsertTailList (&mMapsByAddress[MAP_INFO_HASH_BY_ADDRESS (MapInfo->DeviceAddress)], &MapInfo->AddressLink);
   gBS->RestoreTPL (OriginalTpl);
 
   //
@@ -316,7 +447,6 @@ IoMmuUnmap (
 {
   MAP_INFO                 *MapInfo;
   MAP_HANDLE_INFO          *MapHandleInfo;
-  LIST_ENTRY               *Link;
   EFI_TPL                  OriginalTpl;
 
   DEBUG ((DEBUG_VERBOSE, "IoMmuUnmap: 0x%08x\n", Mapping));
@@ -327,25 +457,17 @@ IoMmuUnmap (
   }
 
   OriginalTpl = gBS->RaiseTPL (VTD_TPL_LEVEL);
-  MapInfo = NULL;
-  for (Link = GetFirstNode (&gMaps)
-       ; !IsNull (&gMaps, Link)
-       ; Link = GetNextNode (&gMaps, Link)
-       ) {
-    MapInfo = MAP_INFO_FROM_LINK (Link);
-    if (MapInfo == Mapping) {
-      break;
-    }
-  }
+  MapInfo = FindMapInfoByHandle (Mapping);
   //
   // Mapping is not a valid value returned by Map()
   //
-  if (MapInfo != Mapping) {
+  if (MapInfo == NULL) {
     gBS->RestoreTPL (OriginalTpl);
     DEBUG ((DEBUG_ERROR, "IoMmuUnmap: %r\n", EFI_INVALID_PARAMETER));
     return EFI_INVALID_PARAMETER;
   }
   RemoveEntryList (&MapInfo->Link);
+  RemoveEntryList (&MapInfo->AddressLink);
   gBS->RestoreTPL (OriginalTpl);
 
   //
@@ -378,7 +500,7 @@ IoMmuUnmap (
     gBS->FreePages (MapInfo->DeviceAddress, MapInfo->NumberOfPages);
   }
 
-  FreePool (Mapping);
+  FreeMapInfo (MapInfo);
   return EFI_SUCCESS;
 }
 
@@ -508,26 +630,19 @@ GetDeviceInfoFromMapping (
   )
 {
   MAP_INFO                 *MapInfo;
-  LIST_ENTRY               *Link;
+  EFI_TPL                  OriginalTpl;
 
   if (Mapping == NULL) {
     return EFI_INVALID_PARAMETER;
   }
 
-  MapInfo = NULL;
-  for (Link = GetFirstNode (&gMaps)
-       ; !IsNull (&gMaps, Link)
-       ; Link = GetNextNode (&gMaps, Link)
-       ) {
-    MapInfo = MAP_INFO_FROM_LINK (Link);
-    if (MapInfo == Mapping) {
-      break;
-    }
-  }
+  OriginalTpl = gBS->RaiseTPL (VTD_TPL_LEVEL);
+  MapInfo = FindMapInfoByHandle (Mapping);
+  gBS->RestoreTPL (OriginalTpl);
   //
   // Mapping is not a valid value returned by Map()
   //
-  if (MapInfo != Mapping) {
+  if (MapInfo == NULL) {
     return EFI_INVALID_PARAMETER;
   }
 
@@ -51,12 +51,20 @@
 //
 #define MAX_VTD_PCI_DATA_NUMBER             0x100
 
+//
+// Number of buckets PCI data is hashed into by source ID.
+//
+#define VTD_PCI_DATA_HASH_SIZE              0x100
+#define VTD_PCI_DATA_HASH(SourceId)         (((SourceId).Bits.Bus ^ (SourceId).Index.ContextIndex) & (VTD_PCI_DATA_HASH_SIZE - 1))
+
 typedef struct {
   UINT8                            DeviceType;
   VTD_SOURCE_ID                    PciSourceId;
   EDKII_PLATFORM_VTD_PCI_DEVICE_ID PciDeviceId;
   // for statistic analysis
   UINTN                            AccessCount;
+  // index + 1 of the next PCI data in the same hash bucket, 0 ends the chain
+  UINTN                            HashNext;
 } PCI_DEVICE_DATA;
 
 typedef struct {
@@ -64,8 +72,15 @@ typedef struct {
   UINTN                            PciDeviceDataNumber;
   UINTN                            PciDeviceDataMaxNumber;
   PCI_DEVICE_DATA                  *PciDeviceData;
+  // index + 1 of the first PCI data in each hash bucket, 0 if it is empty
+  UINTN                            PciDeviceDataHash[VTD_PCI_DATA_HASH_SIZE];
 } PCI_DEVICE_INFORMATION;
 
+//
+// Number of page table pages each VTd engine keeps back after a merge.
+//
+#define VTD_PAGE_TABLE_CACHE_NUMBER 16
+
 typedef struct {
   UINTN                            VtdUnitBaseAddress;
   UINT16                           Segment;
@@ -76,9 +91,45 @@ typedef struct {
   VTD_SECOND_LEVEL_PAGING_ENTRY    *FixedSecondLevelPagingEntry;
   BOOLEAN                          HasDirtyContext;
   BOOLEAN                          HasDirtyPages;
+  //
+  // Pages changed since the last invalidation, when they all belong to a
+  // single domain. DirtyDomainIdentifier is 0 if they don't, or if the
+  // range isn't known, and the whole IOTLB has to be invalidated.
+  //
+  UINT16                           DirtyDomainIdentifier;
+  UINT64                           DirtyPagesBase;
+  UINT64                           DirtyPagesLimit;
+  //
+  // Invalidation queue, used instead of the invalidation registers once
+  // EnableQueuedInvalidation succeeds.
+  //
+  BOOLEAN                          QiEnabled;
+  VTD_QUEUED_INV_DESCRIPTOR        *QiDescriptors;
+  UINTN                            QiTail;
+  volatile UINT32                  QiWaitStatus;
+  //
+  // Page table pages dropped by merging into a super page. The VTd engine
+  // may still walk them until the next invalidation, after which they are
+  // kept for reuse when a page is split again.
+  //
+  VOID                             *RetiredPageTables[VTD_PAGE_TABLE_CACHE_NUMBER];
+  UINTN                            RetiredPageTableNumber;
+  VOID                             *FreePageTables[VTD_PAGE_TABLE_CACHE_NUMBER];
+  UINTN                            FreePageTableNumber;
   PCI_DEVICE_INFORMATION           PciDeviceInfo;
 } VTD_UNIT_INFORMATION;
 
+//
+// One page of 128-bit descriptors makes up the invalidation queue.
+//
+#define VTD_QI_DESCRIPTOR_NUMBER    (EFI_PAGE_SIZE / sizeof (VTD_QUEUED_INV_DESCRIPTOR))
+
+//
+// A range needing more page-selective descriptors than this is invalidated
+// for the whole domain instead.
+//
+#define VTD_QI_MAX_PAGE_DESCRIPTORS 32
+
 //
 // This is the initial max ACCESS request.
 // The number may be enlarged later.
@@ -211,6 +262,53 @@ InvalidateVtdIOTLBGlobal (
   IN UINTN  VtdIndex
   );
 
+/**
+  Invalidate the IOTLB entries of a range of pages in a domain.
+
+  With queued invalidation, the range is covered by page-selective-within-
+  domain descriptors that are submitted as one batch; otherwise the whole
+  IOTLB is invalidated through the invalidation registers.
+
+  @param[in]  VtdIndex              The index of VTd engine.
+  @param[in]  DomainIdentifier      The domain ID the pages belong to.
+  @param[in]  BaseAddress           The base of the changed range.
+  @param[in]  Length                The length of the changed range.
+
+  @retval EFI_SUCCESS           The IOTLB entries are invalidated.
+  @retval EFI_DEVICE_ERROR      The IOTLB entries are not invalidated.
+**/
+EFI_STATUS
+InvalidateVtdIOTLBDomainPages (
+  IN UINTN   VtdIndex,
+  IN UINT16  DomainIdentifier,
+  IN UINT64  BaseAddress,
+  IN UINT64  Length
+  );
+
+/**
+  Enable queued invalidation of a VTd engine.
+
+  @param[in]  VtdIndex          The index used to identify a VTd engine.
+
+  @retval EFI_SUCCESS           Queued invalidation is enabled.
+  @retval EFI_UNSUPPORTED       The VTd engine doesn't support queued invalidation.
+  @retval EFI_OUT_OF_RESOURCES  The invalidation queue can't be allocated.
+**/
+EFI_STATUS
+EnableQueuedInvalidation (
+  IN UINTN  VtdIndex
+  );
+
+/**
+  Disable queued invalidation of a VTd engine, once the queue is drained.
+
+  @param[in]  VtdIndex          The index used to identify a VTd engine.
+**/
+VOID
+DisableQueuedInvalidation (
+  IN UINTN  VtdIndex
+  );
+
 /**
   Dump VTd registers.
 
@@ -24,19 +24,23 @@ GetPciDataIndex (
   IN VTD_SOURCE_ID  SourceId
   )
 {
-  UINTN          Index;
-  VTD_SOURCE_ID  *PciSourceId;
+  UINTN                   Index;
+  VTD_SOURCE_ID           *PciSourceId;
+  PCI_DEVICE_INFORMATION  *PciDeviceInfo;
 
   if (Segment != mVtdUnitInformation[VtdIndex].Segment) {
     return (UINTN)-1;
   }
 
-  for (Index = 0; Index < mVtdUnitInformation[VtdIndex].PciDeviceInfo.PciDeviceDataNumber; Index++) {
-    PciSourceId = &mVtdUnitInformation[VtdIndex].PciDeviceInfo.PciDeviceData[Index].PciSourceId;
+  PciDeviceInfo = &mVtdUnitInformation[VtdIndex].PciDeviceInfo;
+  for (Index = PciDeviceInfo->PciDeviceDataHash[VTD_PCI_DATA_HASH (SourceId)];
+       Index != 0;
+       Index = PciDeviceInfo->PciDeviceData[Index - 1].HashNext) {
+    PciSourceId = &PciDeviceInfo->PciDeviceData[Index - 1].PciSourceId;
     if ((PciSourceId->Bits.Bus == SourceId.Bits.Bus) &&
         (PciSourceId->Bits.Device == SourceId.Bits.Device) &&
         (PciSourceId->Bits.Function == SourceId.Bits.Function) ) {
-      return Index;
+      return Index - 1;
     }
   }
 
@@ -138,6 +142,13 @@ RegisterPciDevice (
 
     PciDeviceInfo->PciDeviceData[PciDeviceInfo->PciDeviceDataNumber].DeviceType = DeviceType;
 
+    //
+    // Chain it into its hash bucket, so GetPciDataIndex doesn't need to walk
+    // every PCI data of the VTd engine.
+    //
+    PciDeviceInfo->PciDeviceData[PciDeviceInfo->PciDeviceDataNumber].HashNext = PciDeviceInfo->PciDeviceDataHash[VTD_PCI_DATA_HASH (SourceId)];
+    PciDeviceInfo->PciDeviceDataHash[VTD_PCI_DATA_HASH (SourceId)] = PciDeviceInfo->PciDeviceDataNumber + 1;
+
     if ((DeviceType != EFI_ACPI_DEVICE_SCOPE_ENTRY_TYPE_PCI_ENDPOINT) &&
         (DeviceType != EFI_ACPI_DEVICE_SCOPE_ENTRY_TYPE_PCI_BRIDGE)) {
       DEBUG ((DEBUG_INFO, " (*)"));
@@ -7,6 +7,26 @@
 
 #include "DmaProtection.h"
 
+#define VTD_PG_R                   BIT0
+#define VTD_PG_W                   BIT1
+#define VTD_PG_X                   BIT2
+#define VTD_PG_EMT                 (BIT3 | BIT4 | BIT5)
+#define VTD_PG_TM                  (BIT62)
+
+#define VTD_PG_PS                  BIT7
+
+#define PAGE_PROGATE_BITS          (VTD_PG_TM | VTD_PG_EMT | VTD_PG_W | VTD_PG_R)
+
+#define PAGING_4K_MASK  0xFFF
+#define PAGING_2M_MASK  0x1FFFFF
+#define PAGING_1G_MASK  0x3FFFFFFF
+
+#define PAGING_VTD_INDEX_MASK     0x1FF
+
+#define PAGING_4K_ADDRESS_MASK_64 0x000FFFFFFFFFF000ull
+#define PAGING_2M_ADDRESS_MASK_64 0x000FFFFFFFE00000ull
+#define PAGING_1G_ADDRESS_MASK_64 0x000FFFFFC0000000ull
+
 /**
   Create extended context entry.
 
@@ -20,6 +40,17 @@ CreateExtContextEntry (
   IN UINTN  VtdIndex
   );
 
+/**
+  Hand the page tables retired by merges over for reuse, now that the VTd
+  engine no longer walks them.
+
+  @param[in]  VtdIndex         The index used to identify a VTd engine.
+**/
+VOID
+ReleaseRetiredPageTables (
+  IN  UINTN                             VtdIndex
+  );
+
 /**
   Allocate zero pages.
 
@@ -228,6 +259,23 @@ CreateSecondLevelPagingEntryTable (
 
     Lvl3PtEntry = (VTD_SECOND_LEVEL_PAGING_ENTRY *)(UINTN)VTD_64BITS_ADDRESS(Lvl4PtEntry[Index4].Bits.AddressLo, Lvl4PtEntry[Index4].Bits.AddressHi);
     for (Index3 = Lvl3Start; Index3 <= Lvl3End; Index3++) {
+      //
+      // Map whole 1GB ranges with one entry, if the engine supports it.
+      //
+      if ((Lvl3PtEntry[Index3].Uint64 == 0) &&
+          ((mVtdUnitInformation[VtdIndex].CapReg.Bits.SLLPS & BIT1) != 0) &&
+          ((BaseAddress & PAGING_1G_MASK) == 0) &&
+          (BaseAddress + SIZE_1GB <= MemoryLimit)) {
+        Lvl3PtEntry[Index3].Uint64 = BaseAddress;
+        SetSecondLevelPagingEntryAttribute (&Lvl3PtEntry[Index3], IoMmuAccess);
+        Lvl3PtEntry[Index3].Bits.PageSize = 1;
+        BaseAddress += SIZE_1GB;
+        if (BaseAddress >= MemoryLimit) {
+          break;
+        }
+        continue;
+      }
+
       if (Lvl3PtEntry[Index3].Uint64 == 0) {
         Lvl3PtEntry[Index3].Uint64 = (UINT64)(UINTN)AllocateZeroPages (1);
         if (Lvl3PtEntry[Index3].Uint64 == 0) {
@@ -404,7 +452,7 @@ DumpSecondLevelPagingEntry (
       if (Lvl3PtEntry[Index3].Uint64 != 0) {
         DEBUG ((DEBUG_VERBOSE,"    Lvl3Pt Entry(0x%03x) - 0x%016lx\n", Index3, Lvl3PtEntry[Index3].Uint64));
       }
-      if (Lvl3PtEntry[Index3].Uint64 == 0) {
+      if ((Lvl3PtEntry[Index3].Uint64 == 0) || (Lvl3PtEntry[Index3].Bits.PageSize != 0)) {
         continue;
       }
 
@@ -440,32 +488,58 @@ InvalidatePageEntry (
   IN UINTN                 VtdIndex
   )
 {
-  if (mVtdUnitInformation[VtdIndex].HasDirtyContext || mVtdUnitInformation[VtdIndex].HasDirtyPages) {
+  VTD_UNIT_INFORMATION  *VtdUnit;
+
+  VtdUnit = &mVtdUnitInformation[VtdIndex];
+  if (VtdUnit->HasDirtyContext || (VtdUnit->HasDirtyPages && VtdUnit->DirtyDomainIdentifier == 0)) {
     InvalidateVtdIOTLBGlobal (VtdIndex);
+  } else if (VtdUnit->HasDirtyPages) {
+    InvalidateVtdIOTLBDomainPages (
+      VtdIndex,
+      VtdUnit->DirtyDomainIdentifier,
+      VtdUnit->DirtyPagesBase,
+      VtdUnit->DirtyPagesLimit - VtdUnit->DirtyPagesBase
+      );
   }
-  mVtdUnitInformation[VtdIndex].HasDirtyContext = FALSE;
-  mVtdUnitInformation[VtdIndex].HasDirtyPages = FALSE;
-}
-
-#define VTD_PG_R                   BIT0
-#define VTD_PG_W                   BIT1
-#define VTD_PG_X                   BIT2
-#define VTD_PG_EMT                 (BIT3 | BIT4 | BIT5)
-#define VTD_PG_TM                  (BIT62)
+  VtdUnit->HasDirtyContext = FALSE;
+  VtdUnit->HasDirtyPages = FALSE;
+  VtdUnit->DirtyDomainIdentifier = 0;
 
-#define VTD_PG_PS                  BIT7
-
-#define PAGE_PROGATE_BITS          (VTD_PG_TM | VTD_PG_EMT | VTD_PG_W | VTD_PG_R)
-
-#define PAGING_4K_MASK  0xFFF
-#define PAGING_2M_MASK  0x1FFFFF
-#define PAGING_1G_MASK  0x3FFFFFFF
+  ReleaseRetiredPageTables (VtdIndex);
+}
 
-#define PAGING_VTD_INDEX_MASK     0x1FF
+/**
+  Record pages of a domain whose translation changed, so that
+  InvalidatePageEntry can limit the IOTLB invalidation to them.
 
-#define PAGING_4K_ADDRESS_MASK_64 0x000FFFFFFFFFF000ull
-#define PAGING_2M_ADDRESS_MASK_64 0x000FFFFFFFE00000ull
-#define PAGING_1G_ADDRESS_MASK_64 0x000FFFFFC0000000ull
+  @param VtdIndex          The VTd engine index.
+  @param DomainIdentifier  The domain ID the pages belong to.
+  @param BaseAddress       The base of the changed pages.
+  @param Length            The length of the changed pages.
+**/
+VOID
+MarkDirtyPages (
+  IN UINTN                 VtdIndex,
+  IN UINT16                DomainIdentifier,
+  IN UINT64                BaseAddress,
+  IN UINT64                Length
+  )
+{
+  VTD_UNIT_INFORMATION  *VtdUnit;
+
+  VtdUnit = &mVtdUnitInformation[VtdIndex];
+  if (!VtdUnit->HasDirtyPages) {
+    VtdUnit->HasDirtyPages         = TRUE;
+    VtdUnit->DirtyDomainIdentifier = DomainIdentifier;
+    VtdUnit->DirtyPagesBase        = BaseAddress;
+    VtdUnit->DirtyPagesLimit       = BaseAddress + Length;
+  } else if (VtdUnit->DirtyDomainIdentifier == DomainIdentifier) {
+    VtdUnit->DirtyPagesBase        = MIN (VtdUnit->DirtyPagesBase, BaseAddress);
+    VtdUnit->DirtyPagesLimit       = MAX (VtdUnit->DirtyPagesLimit, BaseAddress + Length);
+  } else {
+    VtdUnit->DirtyDomainIdentifier = 0;
+  }
+}
 
 typedef enum {
   PageNone,
@@ -554,6 +628,13 @@ GetSecondLevelPageTableEntry (
   }
 
   L3PageTable = (UINT64 *)(UINTN)(L4PageTable[Index4] & PAGING_4K_ADDRESS_MASK_64);
+  if ((L3PageTable[Index3] == 0) && ((mVtdUnitInformation[VtdIndex].CapReg.Bits.SLLPS & BIT1) != 0)) {
+    //
+    // Start from a not present 1G page; it is split only as far as needed.
+    //
+    L3PageTable[Index3] = (Address & PAGING_1G_ADDRESS_MASK_64) | VTD_PG_PS;
+    FlushPageTableMemory (VtdIndex, (UINTN)&L3PageTable[Index3], sizeof(L3PageTable[Index3]));
+  }
   if (L3PageTable[Index3] == 0) {
     L3PageTable[Index3] = (UINT64)(UINTN)AllocateZeroPages (1);
     if (L3PageTable[Index3] == 0) {
@@ -658,6 +739,178 @@ NeedSplitPage (
   return Page2M;
 }
 
+/**
+  Allocate a page for a page table split off a super page, reusing one
+  that an earlier merge gave back if there is any.
+
+  @param[in]  VtdIndex         The index used to identify a VTd engine.
+
+  @return The page, to be filled in completely by the caller.
+  @retval NULL No resource to allocate the page.
+**/
+VOID *
+AllocatePageTablePage (
+  IN  UINTN                             VtdIndex
+  )
+{
+  VTD_UNIT_INFORMATION  *VtdUnit;
+
+  VtdUnit = &mVtdUnitInformation[VtdIndex];
+  if (VtdUnit->FreePageTableNumber != 0) {
+    VtdUnit->FreePageTableNumber--;
+    return VtdUnit->FreePageTables[VtdUnit->FreePageTableNumber];
+  }
+  return AllocatePages (1);
+}
+
+/**
+  Hand the page tables retired by merges over for reuse, now that the VTd
+  engine no longer walks them.
+
+  @param[in]  VtdIndex         The index used to identify a VTd engine.
+**/
+VOID
+ReleaseRetiredPageTables (
+  IN  UINTN                             VtdIndex
+  )
+{
+  VTD_UNIT_INFORMATION  *VtdUnit;
+
+  VtdUnit = &mVtdUnitInformation[VtdIndex];
+  while (VtdUnit->RetiredPageTableNumber != 0) {
+    VtdUnit->RetiredPageTableNumber--;
+    if (VtdUnit->FreePageTableNumber < VTD_PAGE_TABLE_CACHE_NUMBER) {
+      VtdUnit->FreePageTables[VtdUnit->FreePageTableNumber++] = VtdUnit->RetiredPageTables[VtdUnit->RetiredPageTableNumber];
+    } else {
+      FreePages (VtdUnit->RetiredPageTables[VtdUnit->RetiredPageTableNumber], 1);
+    }
+  }
+}
+
+/**
+  Replace a page table whose entries map one contiguous range with the same
+  attributes by a single super page entry.
+
+  @param[in]  VtdIndex         The index used to identify a VTd engine.
+  @param[in]  PageEntry        The entry pointing to the page table.
+  @param[in]  MergeAttribute   The size of the super page, Page2M or Page1G.
+
+  @retval TRUE   The page table was merged into PageEntry.
+  @retval FALSE  The page table doesn't qualify, or can't be retired now.
+**/
+BOOLEAN
+MergeSecondLevelPage (
+  IN  UINTN                             VtdIndex,
+  IN  UINT64                            *PageEntry,
+  IN  PAGE_ATTRIBUTE                    MergeAttribute
+  )
+{
+  VTD_UNIT_INFORMATION  *VtdUnit;
+  UINT64                *PageTable;
+  UINT64                AddressMask;
+  UINT64                EntryLength;
+  UINT64                MergedAddressMask;
+  UINTN                 Index;
+
+  VtdUnit = &mVtdUnitInformation[VtdIndex];
+  if ((*PageEntry == 0) || ((*PageEntry & VTD_PG_PS) != 0) ||
+      (VtdUnit->RetiredPageTableNumber >= VTD_PAGE_TABLE_CACHE_NUMBER)) {
+    return FALSE;
+  }
+
+  if (MergeAttribute == Page2M) {
+    AddressMask       = PAGING_4K_ADDRESS_MASK_64;
+    EntryLength       = SIZE_4KB;
+    MergedAddressMask = PAGING_2M_ADDRESS_MASK_64;
+  } else {
+    AddressMask       = PAGING_2M_ADDRESS_MASK_64;
+    EntryLength       = SIZE_2MB;
+    MergedAddressMask = PAGING_1G_ADDRESS_MASK_64;
+  }
+
+  PageTable = (UINT64 *)(UINTN)(*PageEntry & PAGING_4K_ADDRESS_MASK_64);
+  if ((PageTable[0] & AddressMask & ~MergedAddressMask) != 0) {
+    return FALSE;
+  }
+  if ((MergeAttribute == Page1G) && ((PageTable[0] & VTD_PG_PS) == 0)) {
+    return FALSE;
+  }
+  for (Index = 1; Index < SIZE_4KB / sizeof(UINT64); Index++) {
+    if (((PageTable[Index] & ~AddressMask) != (PageTable[0] & ~AddressMask)) ||
+        ((PageTable[Index] & AddressMask) != (PageTable[0] & AddressMask) + EntryLength * Index)) {
+      return FALSE;
+    }
+  }
+
+  *PageEntry = (PageTable[0] & (MergedAddressMask | PAGE_PROGATE_BITS)) | VTD_PG_PS;
+  FlushPageTableMemory (VtdIndex, (UINTN)PageEntry, sizeof(*PageEntry));
+  VtdUnit->RetiredPageTables[VtdUnit->RetiredPageTableNumber++] = PageTable;
+  DEBUG ((DEBUG_VERBOSE, "Merge - 0x%x -> 0x%lx\n", PageTable, *PageEntry));
+
+  return TRUE;
+}
+
+/**
+  Merge the page tables covering a range back into super pages where the
+  attributes have become uniform again.
+
+  @param[in]  VtdIndex                The index used to identify a VTd engine.
+  @param[in]  DomainIdentifier        The domain ID of the source.
+  @param[in]  SecondLevelPagingEntry  The second level paging entry in VTd table for the device.
+  @param[in]  BaseAddress             The base of the range that changed.
+  @param[in]  Length                  The length of the range that changed.
+**/
+VOID
+MergeSecondLevelPages (
+  IN UINTN                         VtdIndex,
+  IN UINT16                        DomainIdentifier,
+  IN VTD_SECOND_LEVEL_PAGING_ENTRY *SecondLevelPagingEntry,
+  IN UINT64                        BaseAddress,
+  IN UINT64                        Length
+  )
+{
+  UINT64  Address;
+  UINT64  *L4PageTable;
+  UINT64  *L3PageTable;
+  UINT64  *L2PageTable;
+
+  L4PageTable = (UINT64 *)SecondLevelPagingEntry;
+
+  //
+  // 4K tables into 2M pages first, so their 2M tables can qualify for 1G.
+  //
+  for (Address = ALIGN_VALUE_LOW (BaseAddress, SIZE_2MB); Address < BaseAddress + Length; Address += SIZE_2MB) {
+    L3PageTable = (UINT64 *)(UINTN)(L4PageTable[(UINTN)RShiftU64 (Address, 39) & PAGING_VTD_INDEX_MASK] & PAGING_4K_ADDRESS_MASK_64);
+    if (L3PageTable == NULL) {
+      continue;
+    }
+    if ((L3PageTable[(UINTN)RShiftU64 (Address, 30) & PAGING_VTD_INDEX_MASK] & VTD_PG_PS) != 0) {
+      continue;
+    }
+    L2PageTable = (UINT64 *)(UINTN)(L3PageTable[(UINTN)RShiftU64 (Address, 30) & PAGING_VTD_INDEX_MASK] & PAGING_4K_ADDRESS_MASK_64);
+    if (L2PageTable == NULL) {
+      continue;
+    }
+    if (MergeSecondLevelPage (VtdIndex, &L2PageTable[(UINTN)RShiftU64 (Address, 21) & PAGING_VTD_INDEX_MASK], Page2M)) {
+      MarkDirtyPages (VtdIndex, DomainIdentifier, Address, SIZE_2MB);
+    }
+  }
+
+  if ((mVtdUnitInformation[VtdIndex].CapReg.Bits.SLLPS & BIT1) == 0) {
+    return;
+  }
+
+  for (Address = ALIGN_VALUE_LOW (BaseAddress, SIZE_1GB); Address < BaseAddress + Length; Address += SIZE_1GB) {
+    L3PageTable = (UINT64 *)(UINTN)(L4PageTable[(UINTN)RShiftU64 (Address, 39) & PAGING_VTD_INDEX_MASK] & PAGING_4K_ADDRESS_MASK_64);
+    if (L3PageTable == NULL) {
+      continue;
+    }
+    if (MergeSecondLevelPage (VtdIndex, &L3PageTable[(UINTN)RShiftU64 (Address, 30) & PAGING_VTD_INDEX_MASK], Page1G)) {
+      MarkDirtyPages (VtdIndex, DomainIdentifier, Address, SIZE_1GB);
+    }
+  }
+}
+
 /**
   This function splits one page entry to small page entries.
 
@@ -690,7 +943,7 @@ SplitSecondLevelPage (
     //
     ASSERT (SplitAttribute == Page4K);
     if (SplitAttribute == Page4K) {
-      NewPageEntry = AllocateZeroPages (1);
+      NewPageEntry = AllocatePageTablePage (VtdIndex);
       DEBUG ((DEBUG_VERBOSE, "Split - 0x%x\n", NewPageEntry));
       if (NewPageEntry == NULL) {
         return RETURN_OUT_OF_RESOURCES;
@@ -715,7 +968,7 @@ SplitSecondLevelPage (
     //
     ASSERT (SplitAttribute == Page2M || SplitAttribute == Page4K);
     if ((SplitAttribute == Page2M || SplitAttribute == Page4K)) {
-      NewPageEntry = AllocateZeroPages (1);
+      NewPageEntry = AllocatePageTablePage (VtdIndex);
       DEBUG ((DEBUG_VERBOSE, "Split - 0x%x\n", NewPageEntry));
       if (NewPageEntry == NULL) {
         return RETURN_OUT_OF_RESOURCES;
@@ -774,6 +1027,8 @@ SetSecondLevelPagingAttribute (
   PAGE_ATTRIBUTE                 SplitAttribute;
   EFI_STATUS                     Status;
   BOOLEAN                        IsEntryModified;
+  UINT64                         RangeBase;
+  UINT64                         RangeLength;
 
   DEBUG ((DEBUG_VERBOSE,"SetSecondLevelPagingAttribute (%d) (0x%016lx - 0x%016lx : %x) \n", VtdIndex, BaseAddress, Length, IoMmuAccess));
   DEBUG ((DEBUG_VERBOSE,"  SecondLevelPagingEntry Base - 0x%x\n", SecondLevelPagingEntry));
@@ -787,6 +1042,8 @@ SetSecondLevelPagingAttribute (
     return EFI_UNSUPPORTED;
   }
 
+  RangeBase   = BaseAddress;
+  RangeLength = Length;
   while (Length != 0) {
     PageEntry = GetSecondLevelPageTableEntry (VtdIndex, SecondLevelPagingEntry, BaseAddress, &PageAttribute);
     if (PageEntry == NULL) {
@@ -798,7 +1055,7 @@ SetSecondLevelPagingAttribute (
     if (SplitAttribute == PageNone) {
       ConvertSecondLevelPageEntryAttribute (VtdIndex, PageEntry, IoMmuAccess, &IsEntryModified);
       if (IsEntryModified) {
-        mVtdUnitInformation[VtdIndex].HasDirtyPages = TRUE;
+        MarkDirtyPages (VtdIndex, DomainIdentifier, BaseAddress, PageEntryLength);
       }
       //
       // Convert success, move to next
@@ -811,7 +1068,7 @@ SetSecondLevelPagingAttribute (
         DEBUG ((DEBUG_ERROR, "SplitSecondLevelPage - %r\n", Status));
         return RETURN_UNSUPPORTED;
       }
-      mVtdUnitInformation[VtdIndex].HasDirtyPages = TRUE;
+      MarkDirtyPages (VtdIndex, DomainIdentifier, BaseAddress & ~((UINT64)PageEntryLength - 1), PageEntryLength);
       //
       // Just split current page
       // Convert success in next around
@@ -819,6 +1076,8 @@ SetSecondLevelPagingAttribute (
     }
   }
 
+  MergeSecondLevelPages (VtdIndex, DomainIdentifier, SecondLevelPagingEntry, RangeBase, RangeLength);
+
   return EFI_SUCCESS;
 }
 
@@ -973,6 +1232,43 @@ SetAccessAttribute (
   return EFI_SUCCESS;
 }
 
+/**
+  Get the second level paging entry that allows all DMA access, for a VTd engine.
+
+  The table is a fixed identity map and is never changed after creation, so it
+  is shared by all VTd engines that would build it the same way, i.e. those with
+  the same 1GB page support and the same page table coherency.
+
+  @param[in]  VtdIndex          The index used to identify a VTd engine.
+
+  @return The second level paging entry, or NULL if it cannot be created.
+**/
+VTD_SECOND_LEVEL_PAGING_ENTRY *
+GetFixedSecondLevelPagingEntry (
+  IN UINTN  VtdIndex
+  )
+{
+  UINTN                         Index;
+
+  if (mVtdUnitInformation[VtdIndex].FixedSecondLevelPagingEntry != NULL) {
+    return mVtdUnitInformation[VtdIndex].FixedSecondLevelPagingEntry;
+  }
+
+  for (Index = 0; Index < mVtdUnitNumber; Index++) {
+    if ((mVtdUnitInformation[Index].FixedSecondLevelPagingEntry != NULL) &&
+        ((mVtdUnitInformation[Index].CapReg.Bits.SLLPS & BIT1) == (mVtdUnitInformation[VtdIndex].CapReg.Bits.SLLPS & BIT1)) &&
+        (mVtdUnitInformation[Index].ECapReg.Bits.C == mVtdUnitInformation[VtdIndex].ECapReg.Bits.C)) {
+      DEBUG((DEBUG_INFO, "Share FixedSecondLevelPagingEntry - %d with %d\n", VtdIndex, Index));
+      mVtdUnitInformation[VtdIndex].FixedSecondLevelPagingEntry = mVtdUnitInformation[Index].FixedSecondLevelPagingEntry;
+      return mVtdUnitInformation[VtdIndex].FixedSecondLevelPagingEntry;
+    }
+  }
+
+  DEBUG((DEBUG_INFO, "CreateSecondLevelPagingEntry - %d\n", VtdIndex));
+  mVtdUnitInformation[VtdIndex].FixedSecondLevelPagingEntry = CreateSecondLevelPagingEntry (VtdIndex, EDKII_IOMMU_ACCESS_READ | EDKII_IOMMU_ACCESS_WRITE);
+  return mVtdUnitInformation[VtdIndex].FixedSecondLevelPagingEntry;
+}
+
 /**
   Always enable the VTd page attribute for the device.
 
@@ -1001,12 +1297,10 @@ AlwaysEnablePageAttribute (
     return EFI_DEVICE_ERROR;
   }
 
-  if (mVtdUnitInformation[VtdIndex].FixedSecondLevelPagingEntry == 0) {
-    DEBUG((DEBUG_INFO, "CreateSecondLevelPagingEntry - %d\n", VtdIndex));
-    mVtdUnitInformation[VtdIndex].FixedSecondLevelPagingEntry = CreateSecondLevelPagingEntry (VtdIndex, EDKII_IOMMU_ACCESS_READ | EDKII_IOMMU_ACCESS_WRITE);
+  SecondLevelPagingEntry = GetFixedSecondLevelPagingEntry (VtdIndex);
+  if (SecondLevelPagingEntry == NULL) {
+    return EFI_OUT_OF_RESOURCES;
   }
-
-  SecondLevelPagingEntry = mVtdUnitInformation[VtdIndex].FixedSecondLevelPagingEntry;
   Pt = (UINT64)RShiftU64 ((UINT64)(UINTN)SecondLevelPagingEntry, 12);
   if (ExtContextEntry != NULL) {
     ExtContextEntry->Bits.SecondLevelPageTranslationPointerLo = (UINT32) Pt;
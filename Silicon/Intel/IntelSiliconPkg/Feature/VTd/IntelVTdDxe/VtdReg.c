@@ -54,6 +54,158 @@ FlushWriteBuffer (
   }
 }
 
+/**
+  Append a descriptor to the invalidation queue of a VTd engine.
+
+  The VTd engine doesn't see it until SubmitQueuedInvalidation moves the
+  queue tail.
+
+  @param[in]  VtdIndex          The index used to identify a VTd engine.
+  @param[in]  Descriptor        The invalidation descriptor.
+**/
+STATIC
+VOID
+QueueInvalidationDescriptor (
+  IN UINTN                      VtdIndex,
+  IN VTD_QUEUED_INV_DESCRIPTOR  *Descriptor
+  )
+{
+  VTD_UNIT_INFORMATION  *VtdUnit;
+
+  VtdUnit = &mVtdUnitInformation[VtdIndex];
+  CopyMem (&VtdUnit->QiDescriptors[VtdUnit->QiTail], Descriptor, sizeof (*Descriptor));
+  FlushPageTableMemory (VtdIndex, (UINTN)&VtdUnit->QiDescriptors[VtdUnit->QiTail], sizeof (*Descriptor));
+  VtdUnit->QiTail = (VtdUnit->QiTail + 1) % VTD_QI_DESCRIPTOR_NUMBER;
+}
+
+/**
+  Close the queued descriptors with an invalidation wait descriptor, hand
+  them to the VTd engine and wait until all of them are processed.
+
+  @param[in]  VtdIndex          The index used to identify a VTd engine.
+
+  @retval EFI_SUCCESS           The queued invalidations are complete.
+  @retval EFI_DEVICE_ERROR      The VTd engine reported an invalidation queue error.
+**/
+STATIC
+EFI_STATUS
+SubmitQueuedInvalidation (
+  IN UINTN  VtdIndex
+  )
+{
+  VTD_UNIT_INFORMATION       *VtdUnit;
+  VTD_QUEUED_INV_DESCRIPTOR  Descriptor;
+
+  VtdUnit = &mVtdUnitInformation[VtdIndex];
+
+  ZeroMem (&Descriptor, sizeof (Descriptor));
+  Descriptor.Wait.Type          = V_QI_DESC_TYPE_WAIT;
+  Descriptor.Wait.StatusWrite   = 1;
+  Descriptor.Wait.FenceFlag     = 1;
+  Descriptor.Wait.StatusData    = 1;
+  Descriptor.Wait.StatusAddress = (UINT64)(UINTN)&VtdUnit->QiWaitStatus;
+  VtdUnit->QiWaitStatus = 0;
+  QueueInvalidationDescriptor (VtdIndex, &Descriptor);
+
+  MmioWrite64 (VtdUnit->VtdUnitBaseAddress + R_IQT_REG, LShiftU64 (VtdUnit->QiTail, B_IQT_REG_QT_SHIFT));
+
+  while (VtdUnit->QiWaitStatus == 0) {
+    if ((MmioRead32 (VtdUnit->VtdUnitBaseAddress + R_FSTS_REG) & B_FSTS_REG_IQE) != 0) {
+      DEBUG ((DEBUG_ERROR,"ERROR: SubmitQueuedInvalidation: invalidation queue error for VTD(%d)\n", VtdIndex));
+      DumpVtdRegs (VtdIndex);
+      return EFI_DEVICE_ERROR;
+    }
+    CpuPause ();
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Enable queued invalidation of a VTd engine.
+
+  @param[in]  VtdIndex          The index used to identify a VTd engine.
+
+  @retval EFI_SUCCESS           Queued invalidation is enabled.
+  @retval EFI_UNSUPPORTED       The VTd engine doesn't support queued invalidation.
+  @retval EFI_OUT_OF_RESOURCES  The invalidation queue can't be allocated.
+**/
+EFI_STATUS
+EnableQueuedInvalidation (
+  IN UINTN  VtdIndex
+  )
+{
+  VTD_UNIT_INFORMATION  *VtdUnit;
+  UINT32                Reg32;
+
+  VtdUnit = &mVtdUnitInformation[VtdIndex];
+  if (VtdUnit->ECapReg.Bits.QI == 0) {
+    return EFI_UNSUPPORTED;
+  }
+
+  if (VtdUnit->QiDescriptors == NULL) {
+    VtdUnit->QiDescriptors = AllocateZeroPages (1);
+    if (VtdUnit->QiDescriptors == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+  }
+
+  //
+  // Queue Size 0 is one page, i.e. VTD_QI_DESCRIPTOR_NUMBER descriptors.
+  //
+  VtdUnit->QiTail = 0;
+  MmioWrite64 (VtdUnit->VtdUnitBaseAddress + R_IQT_REG, 0);
+  MmioWrite64 (VtdUnit->VtdUnitBaseAddress + R_IQA_REG, (UINT64)(UINTN)VtdUnit->QiDescriptors);
+
+  Reg32 = MmioRead32 (VtdUnit->VtdUnitBaseAddress + R_GSTS_REG);
+  Reg32 = (Reg32 & 0x96FFFFFF);       // Reset the one-shot bits
+  MmioWrite32 (VtdUnit->VtdUnitBaseAddress + R_GCMD_REG, Reg32 | B_GMCD_REG_QIE);
+  do {
+    Reg32 = MmioRead32 (VtdUnit->VtdUnitBaseAddress + R_GSTS_REG);
+  } while ((Reg32 & B_GSTS_REG_QIES) == 0);
+
+  VtdUnit->QiEnabled = TRUE;
+  DEBUG ((DEBUG_INFO,"VTD (%d) queued invalidation enabled\n", VtdIndex));
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Disable queued invalidation of a VTd engine, once the queue is drained.
+
+  @param[in]  VtdIndex          The index used to identify a VTd engine.
+**/
+VOID
+DisableQueuedInvalidation (
+  IN UINTN  VtdIndex
+  )
+{
+  VTD_UNIT_INFORMATION  *VtdUnit;
+  UINT32                Reg32;
+
+  VtdUnit = &mVtdUnitInformation[VtdIndex];
+  if (!VtdUnit->QiEnabled) {
+    return;
+  }
+
+  while (MmioRead64 (VtdUnit->VtdUnitBaseAddress + R_IQH_REG) != MmioRead64 (VtdUnit->VtdUnitBaseAddress + R_IQT_REG)) {
+    if ((MmioRead32 (VtdUnit->VtdUnitBaseAddress + R_FSTS_REG) & B_FSTS_REG_IQE) != 0) {
+      break;
+    }
+    CpuPause ();
+  }
+
+  Reg32 = MmioRead32 (VtdUnit->VtdUnitBaseAddress + R_GSTS_REG);
+  Reg32 = (Reg32 & 0x96FFFFFF);       // Reset the one-shot bits
+  MmioWrite32 (VtdUnit->VtdUnitBaseAddress + R_GCMD_REG, Reg32 & ~B_GMCD_REG_QIE);
+  do {
+    Reg32 = MmioRead32 (VtdUnit->VtdUnitBaseAddress + R_GSTS_REG);
+  } while ((Reg32 & B_GSTS_REG_QIES) != 0);
+
+  VtdUnit->QiEnabled = FALSE;
+  VtdUnit->QiTail    = 0;
+}
+
 /**
   Invalidate VTd context cache.
 
@@ -64,7 +216,16 @@ InvalidateContextCache (
   IN UINTN  VtdIndex
   )
 {
-  UINT64  Reg64;
+  UINT64                     Reg64;
+  VTD_QUEUED_INV_DESCRIPTOR  Descriptor;
+
+  if (mVtdUnitInformation[VtdIndex].QiEnabled) {
+    ZeroMem (&Descriptor, sizeof (Descriptor));
+    Descriptor.ContextCache.Type        = V_QI_DESC_TYPE_CONTEXT_CACHE;
+    Descriptor.ContextCache.Granularity = V_QI_DESC_GRAN_GLOBAL;
+    QueueInvalidationDescriptor (VtdIndex, &Descriptor);
+    return SubmitQueuedInvalidation (VtdIndex);
+  }
 
   Reg64 = MmioRead64 (mVtdUnitInformation[VtdIndex].VtdUnitBaseAddress + R_CCMD_REG);
   if ((Reg64 & B_CCMD_REG_ICC) != 0) {
@@ -93,7 +254,18 @@ InvalidateIOTLB (
   IN UINTN  VtdIndex
   )
 {
-  UINT64  Reg64;
+  UINT64                     Reg64;
+  VTD_QUEUED_INV_DESCRIPTOR  Descriptor;
+
+  if (mVtdUnitInformation[VtdIndex].QiEnabled) {
+    ZeroMem (&Descriptor, sizeof (Descriptor));
+    Descriptor.Iotlb.Type        = V_QI_DESC_TYPE_IOTLB;
+    Descriptor.Iotlb.Granularity = V_QI_DESC_GRAN_GLOBAL;
+    Descriptor.Iotlb.DrainWrites = mVtdUnitInformation[VtdIndex].CapReg.Bits.DWD;
+    Descriptor.Iotlb.DrainReads  = mVtdUnitInformation[VtdIndex].CapReg.Bits.DRD;
+    QueueInvalidationDescriptor (VtdIndex, &Descriptor);
+    return SubmitQueuedInvalidation (VtdIndex);
+  }
 
   Reg64 = MmioRead64 (mVtdUnitInformation[VtdIndex].VtdUnitBaseAddress + (mVtdUnitInformation[VtdIndex].ECapReg.Bits.IRO * 16) + R_IOTLB_REG);
   if ((Reg64 & B_IOTLB_REG_IVT) != 0) {
@@ -153,6 +325,125 @@ InvalidateVtdIOTLBGlobal (
   return EFI_SUCCESS;
 }
 
+/**
+  Return the largest page-selective address mask that starts at BaseAddress
+  and doesn't go past Length.
+
+  @param[in]  BaseAddress       The base of the range, 4KB aligned.
+  @param[in]  Length            The length of the range, at least 4KB.
+  @param[in]  MaxAddressMask    The largest address mask the VTd engine supports.
+
+  @return The address mask; the descriptor covers SIZE_4KB << mask bytes.
+**/
+STATIC
+UINT8
+GetPageSelectiveAddressMask (
+  IN UINT64  BaseAddress,
+  IN UINT64  Length,
+  IN UINT8   MaxAddressMask
+  )
+{
+  UINT8   AddressMask;
+  UINT64  Size;
+
+  for (AddressMask = 0; AddressMask < MaxAddressMask; AddressMask++) {
+    Size = LShiftU64 (SIZE_4KB, AddressMask + 1);
+    if (((BaseAddress & (Size - 1)) != 0) || (Size > Length)) {
+      break;
+    }
+  }
+
+  return AddressMask;
+}
+
+/**
+  Invalidate the IOTLB entries of a range of pages in a domain.
+
+  With queued invalidation, the range is covered by page-selective-within-
+  domain descriptors that are submitted as one batch; otherwise the whole
+  IOTLB is invalidated through the invalidation registers.
+
+  @param[in]  VtdIndex              The index of VTd engine.
+  @param[in]  DomainIdentifier      The domain ID the pages belong to.
+  @param[in]  BaseAddress           The base of the changed range.
+  @param[in]  Length                The length of the changed range.
+
+  @retval EFI_SUCCESS           The IOTLB entries are invalidated.
+  @retval EFI_DEVICE_ERROR      The IOTLB entries are not invalidated.
+**/
+EFI_STATUS
+InvalidateVtdIOTLBDomainPages (
+  IN UINTN   VtdIndex,
+  IN UINT16  DomainIdentifier,
+  IN UINT64  BaseAddress,
+  IN UINT64  Length
+  )
+{
+  VTD_QUEUED_INV_DESCRIPTOR  Descriptor;
+  VTD_CAP_REG                CapReg;
+  UINT64                     Base;
+  UINT64                     Remaining;
+  UINT64                     Size;
+  UINT8                      AddressMask;
+  UINTN                      Count;
+
+  if (!mVtdEnabled) {
+    return EFI_SUCCESS;
+  }
+
+  DEBUG((DEBUG_VERBOSE, "InvalidateVtdIOTLBDomainPages(%d) Domain %d (0x%016lx - 0x%016lx)\n", VtdIndex, DomainIdentifier, BaseAddress, Length));
+
+  FlushWriteBuffer (VtdIndex);
+
+  if (!mVtdUnitInformation[VtdIndex].QiEnabled) {
+    return InvalidateIOTLB (VtdIndex);
+  }
+
+  CapReg = mVtdUnitInformation[VtdIndex].CapReg;
+  ZeroMem (&Descriptor, sizeof (Descriptor));
+  Descriptor.Iotlb.Type        = V_QI_DESC_TYPE_IOTLB;
+  Descriptor.Iotlb.DomainId    = DomainIdentifier;
+  Descriptor.Iotlb.DrainWrites = CapReg.Bits.DWD;
+  Descriptor.Iotlb.DrainReads  = CapReg.Bits.DRD;
+
+  //
+  // Count the naturally aligned blocks the range splits into first, so a
+  // large range costs one domain-selective descriptor instead.
+  //
+  Count = 0;
+  if (CapReg.Bits.PSI != 0) {
+    Base      = BaseAddress;
+    Remaining = Length;
+    while ((Remaining != 0) && (Count <= VTD_QI_MAX_PAGE_DESCRIPTORS)) {
+      Size = LShiftU64 (SIZE_4KB, GetPageSelectiveAddressMask (Base, Remaining, (UINT8)CapReg.Bits.MAMV));
+      Base      += Size;
+      Remaining -= Size;
+      Count++;
+    }
+  }
+
+  if ((Count == 0) || (Count > VTD_QI_MAX_PAGE_DESCRIPTORS)) {
+    Descriptor.Iotlb.Granularity = V_QI_DESC_GRAN_DOMAIN;
+    QueueInvalidationDescriptor (VtdIndex, &Descriptor);
+  } else {
+    Descriptor.Iotlb.Granularity = V_QI_DESC_GRAN_PAGE;
+    Base      = BaseAddress;
+    Remaining = Length;
+    while (Remaining != 0) {
+      AddressMask = GetPageSelectiveAddressMask (Base, Remaining, (UINT8)CapReg.Bits.MAMV);
+      Size = LShiftU64 (SIZE_4KB, AddressMask);
+      Descriptor.Iotlb.AddressMask = AddressMask;
+      Descriptor.Iotlb.AddressLo   = (UINT32)RShiftU64 (Base, 12) & 0xFFFFF;
+      Descriptor.Iotlb.AddressHi   = (UINT32)RShiftU64 (Base, 32);
+      QueueInvalidationDescriptor (VtdIndex, &Descriptor);
+      Base      += Size;
+      Remaining -= Size;
+    }
+  }
+
+  return SubmitQueuedInvalidation (VtdIndex);
+}
+
 /**
   Prepare VTD configuration.
 **/
@@ -273,10 +564,20 @@ EnableDmar (
     //
     InvalidateIOTLB (Index);
 
+    //
+    // Switch to queued invalidation, so later changes to the translation
+    // table need one batch of page-selective descriptors rather than a
+    // global register-based flush.
+    //
+    EnableQueuedInvalidation (Index);
+
     //
     // Enable VTd
     //
-    MmioWrite32 (mVtdUnitInformation[Index].VtdUnitBaseAddress + R_GCMD_REG, B_GMCD_REG_TE);
+    MmioWrite32 (
+      mVtdUnitInformation[Index].VtdUnitBaseAddress + R_GCMD_REG,
+      B_GMCD_REG_TE | (mVtdUnitInformation[Index].QiEnabled ? B_GMCD_REG_QIE : 0)
+      );
     DEBUG((DEBUG_INFO, "EnableDmar: Waiting B_GSTS_REG_TE ...\n"));
     do {
       Reg32 = MmioRead32 (mVtdUnitInformation[Index].VtdUnitBaseAddress + R_GSTS_REG);
@@ -350,6 +651,8 @@ DisableDmar (
       Reg32 = MmioRead32 (mVtdUnitInformation[Index].VtdUnitBaseAddress + R_GSTS_REG);
     } while((Reg32 & B_GSTS_REG_RTPS) == 0);
 
+    DisableQueuedInvalidation (Index);
+
     Reg32 = MmioRead32 (mVtdUnitInformation[Index].VtdUnitBaseAddress + R_GSTS_REG);
     DEBUG((DEBUG_INFO, "DisableDmar: GSTS_REG - 0x%08x\n", Reg32));
 
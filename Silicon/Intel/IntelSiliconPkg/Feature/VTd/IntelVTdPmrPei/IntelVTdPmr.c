@@ -268,6 +268,74 @@ SetPmrRegion (
   return EFI_SUCCESS;
 }
 
+/**
+  Return if the PMR is enabled.
+
+  @param VtdUnitBaseAddress The base address of the VTd engine.
+
+  @retval TRUE  PMR is enabled.
+  @retval FALSE PMR is disabled or unsupported.
+**/
+BOOLEAN
+IsPmrEnabled (
+  IN UINTN         VtdUnitBaseAddress
+  )
+{
+  UINT32        Reg32;
+  VTD_CAP_REG   CapReg;
+
+  CapReg.Uint64 = MmioRead64 (VtdUnitBaseAddress + R_CAP_REG);
+  if (CapReg.Bits.PLMR == 0 || CapReg.Bits.PHMR == 0) {
+    return FALSE;
+  }
+
+  Reg32 = MmioRead32 (VtdUnitBaseAddress + R_PMEN_ENABLE_REG);
+  if ((Reg32 & BIT0) == 0) {
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+/**
+  Return if the PMR of the VTd engine is enabled and already set to the
+  region.
+
+  @param VtdUnitBaseAddress The base address of the VTd engine.
+  @param LowMemoryBase      The protected low memory region base.
+  @param LowMemoryLength    The protected low memory region length.
+  @param HighMemoryBase     The protected high memory region base.
+  @param HighMemoryLength   The protected high memory region length.
+
+  @retval TRUE  The PMR is already programmed with the region.
+  @retval FALSE The PMR needs to be programmed.
+**/
+BOOLEAN
+IsPmrRegionSet (
+  IN UINTN         VtdUnitBaseAddress,
+  IN UINT32        LowMemoryBase,
+  IN UINT32        LowMemoryLength,
+  IN UINT64        HighMemoryBase,
+  IN UINT64        HighMemoryLength
+  )
+{
+  if (!IsPmrEnabled (VtdUnitBaseAddress)) {
+    return FALSE;
+  }
+
+  if (LowMemoryBase == 0 && LowMemoryLength == 0) {
+    LowMemoryBase = 0xFFFFFFFF;
+  }
+  if (HighMemoryBase == 0 && HighMemoryLength == 0) {
+    HighMemoryBase = 0xFFFFFFFFFFFFFFFF;
+  }
+
+  return (BOOLEAN) ((MmioRead32 (VtdUnitBaseAddress + R_PMEN_LOW_BASE_REG)    == LowMemoryBase) &&
+                    (MmioRead32 (VtdUnitBaseAddress + R_PMEN_LOW_LIMITE_REG)  == LowMemoryBase + LowMemoryLength - 1) &&
+                    (MmioRead64 (VtdUnitBaseAddress + R_PMEN_HIGH_BASE_REG)   == HighMemoryBase) &&
+                    (MmioRead64 (VtdUnitBaseAddress + R_PMEN_HIGH_LIMITE_REG) == HighMemoryBase + HighMemoryLength - 1));
+}
+
 /**
   Set DMA protected region.
 
@@ -300,6 +368,19 @@ SetDmaProtectedRange (
     if ((EngineMask & LShiftU64(1, Index)) == 0) {
       continue;
     }
+    //
+    // Leave the engine untouched if it already protects the same region,
+    // rather than opening a window with PMR disabled.
+    //
+    if (IsPmrRegionSet (
+          (UINTN)VTdInfo->VTdEngineAddress[Index],
+          LowMemoryBase,
+          LowMemoryLength,
+          HighMemoryBase,
+          HighMemoryLength
+          )) {
+      continue;
+    }
     DisablePmr ((UINTN)VTdInfo->VTdEngineAddress[Index]);
     Status = SetPmrRegion (
                VTdInfo->HostAddressWidth,
@@ -355,35 +436,6 @@ DisableDmaProtection (
   return EFI_SUCCESS;
 }
 
-/**
-  Return if the PMR is enabled.
-
-  @param VtdUnitBaseAddress The base address of the VTd engine.
-
-  @retval TRUE  PMR is enabled.
-  @retval FALSE PMR is disabled or unsupported.
-**/
-BOOLEAN
-IsPmrEnabled (
-  IN UINTN         VtdUnitBaseAddress
-  )
-{
-  UINT32        Reg32;
-  VTD_CAP_REG   CapReg;
-
-  CapReg.Uint64 = MmioRead64 (VtdUnitBaseAddress + R_CAP_REG);
-  if (CapReg.Bits.PLMR == 0 || CapReg.Bits.PHMR == 0) {
-    return FALSE;
-  }
-
-  Reg32 = MmioRead32 (VtdUnitBaseAddress + R_PMEN_ENABLE_REG);
-  if ((Reg32 & BIT0) == 0) {
-    return FALSE;
-  }
-
-  return TRUE;
-}
-
 /**
   Return the mask of the VTd engine which is enabled.
 
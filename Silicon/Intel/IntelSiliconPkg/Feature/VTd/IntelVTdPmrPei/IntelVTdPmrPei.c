@@ -31,11 +31,35 @@ EFI_GUID mDmaBufferInfoGuid = {
   0x7b624ec7, 0xfb67, 0x4f9c, { 0xb6, 0xb0, 0x4d, 0xfa, 0x9c, 0x88, 0x20, 0x39 }
 };
 
+//
+// Map() bounce buffers (data + MAP_INFO) are rounded up to a power of two
+// between DMA_MAP_CLASS_MIN_SIZE and DMA_MAP_CLASS_MAX_SIZE, and recycled
+// through one free list per size. Larger ones are only carved and released
+// from the bottom of the DMA buffer.
+//
+#define DMA_MAP_CLASS_MIN_SHIFT  6
+#define DMA_MAP_CLASS_NUMBER     10
+#define DMA_MAP_CLASS_MIN_SIZE   (1 << DMA_MAP_CLASS_MIN_SHIFT)
+#define DMA_MAP_CLASS_MAX_SIZE   (DMA_MAP_CLASS_MIN_SIZE << (DMA_MAP_CLASS_NUMBER - 1))
+
+//
+// AllocateBuffer() ranges of up to DMA_PAGE_CLASS_NUMBER pages are recycled
+// through one free list per page count. Larger ones are only carved and
+// released from the top of the DMA buffer.
+//
+#define DMA_PAGE_CLASS_NUMBER    8
+
 typedef struct {
   UINTN                             DmaBufferBase;
   UINTN                             DmaBufferSize;
   UINTN                             DmaBufferCurrentTop;
   UINTN                             DmaBufferCurrentBottom;
+  //
+  // Heads of the free lists, linked through the first UINTN of each free
+  // block. 0 means empty.
+  //
+  UINTN                             MapFreeList[DMA_MAP_CLASS_NUMBER];
+  UINTN                             PageFreeList[DMA_PAGE_CLASS_NUMBER];
 } DMA_BUFFER_INFO;
 
 #define MAP_INFO_SIGNATURE  SIGNATURE_32 ('D', 'M', 'A', 'P')
@@ -43,6 +67,7 @@ typedef struct {
   UINT32                                    Signature;
   EDKII_IOMMU_OPERATION                     Operation;
   UINTN                                     NumberOfBytes;
+  UINTN                                     BlockSize;
   EFI_PHYSICAL_ADDRESS                      HostAddress;
   EFI_PHYSICAL_ADDRESS                      DeviceAddress;
 } MAP_INFO;
@@ -82,6 +107,169 @@ typedef struct {
               +------------------+ <=============== PLMR.Base (0)
 **/
 
+/**
+  Return the Map() size class of a bounce buffer.
+
+  @param Length             The bounce buffer length, including MAP_INFO.
+
+  @return The size class, or DMA_MAP_CLASS_NUMBER if Length is not pooled.
+**/
+UINTN
+GetMapSizeClass (
+  IN UINTN                    Length
+  )
+{
+  UINTN                       Class;
+
+  for (Class = 0; Class < DMA_MAP_CLASS_NUMBER; Class++) {
+    if (Length <= (UINTN)(DMA_MAP_CLASS_MIN_SIZE << Class)) {
+      break;
+    }
+  }
+  return Class;
+}
+
+/**
+  Allocate a Map() bounce buffer from the DMA buffer.
+
+  @param DmaBufferInfo      The DMA buffer information.
+  @param Length             The bounce buffer length, including MAP_INFO.
+  @param BlockSize          On output, the size actually reserved.
+
+  @return The bounce buffer base, or 0 if the DMA buffer is exhausted.
+**/
+UINTN
+AllocateMapBuffer (
+  IN  DMA_BUFFER_INFO         *DmaBufferInfo,
+  IN  UINTN                   Length,
+  OUT UINTN                   *BlockSize
+  )
+{
+  UINTN                       Class;
+  UINTN                       Buffer;
+
+  Class = GetMapSizeClass (Length);
+  if (Class < DMA_MAP_CLASS_NUMBER) {
+    *BlockSize = DMA_MAP_CLASS_MIN_SIZE << Class;
+    Buffer = DmaBufferInfo->MapFreeList[Class];
+    if (Buffer != 0) {
+      DmaBufferInfo->MapFreeList[Class] = *(UINTN *)Buffer;
+      return Buffer;
+    }
+  } else {
+    *BlockSize = Length;
+  }
+
+  if (*BlockSize > DmaBufferInfo->DmaBufferCurrentTop - DmaBufferInfo->DmaBufferCurrentBottom) {
+    return 0;
+  }
+  Buffer = DmaBufferInfo->DmaBufferCurrentBottom;
+  DmaBufferInfo->DmaBufferCurrentBottom += *BlockSize;
+  return Buffer;
+}
+
+/**
+  Release a Map() bounce buffer to the DMA buffer.
+
+  @param DmaBufferInfo      The DMA buffer information.
+  @param Buffer             The bounce buffer base.
+  @param BlockSize          The size reserved by AllocateMapBuffer().
+**/
+VOID
+FreeMapBuffer (
+  IN DMA_BUFFER_INFO          *DmaBufferInfo,
+  IN UINTN                    Buffer,
+  IN UINTN                    BlockSize
+  )
+{
+  UINTN                       Class;
+
+  if (DmaBufferInfo->DmaBufferCurrentBottom == Buffer + BlockSize) {
+    DmaBufferInfo->DmaBufferCurrentBottom -= BlockSize;
+    return;
+  }
+
+  Class = GetMapSizeClass (BlockSize);
+  if ((Class < DMA_MAP_CLASS_NUMBER) && (BlockSize == (UINTN)(DMA_MAP_CLASS_MIN_SIZE << Class))) {
+    *(UINTN *)Buffer = DmaBufferInfo->MapFreeList[Class];
+    DmaBufferInfo->MapFreeList[Class] = Buffer;
+  }
+}
+
+/**
+  Allocate pages from the DMA buffer.
+
+  @param DmaBufferInfo      The DMA buffer information.
+  @param Pages              The number of pages to allocate.
+
+  @return The pages base, or 0 if the DMA buffer is exhausted.
+**/
+UINTN
+AllocateDmaPages (
+  IN DMA_BUFFER_INFO          *DmaBufferInfo,
+  IN UINTN                    Pages
+  )
+{
+  UINTN                       Length;
+  UINTN                       Buffer;
+  UINTN                       Class;
+
+  Length = EFI_PAGES_TO_SIZE (Pages);
+  if ((Pages != 0) && (Pages <= DMA_PAGE_CLASS_NUMBER)) {
+    Buffer = DmaBufferInfo->PageFreeList[Pages - 1];
+    if (Buffer != 0) {
+      DmaBufferInfo->PageFreeList[Pages - 1] = *(UINTN *)Buffer;
+      return Buffer;
+    }
+  }
+
+  if (Length <= DmaBufferInfo->DmaBufferCurrentTop - DmaBufferInfo->DmaBufferCurrentBottom) {
+    DmaBufferInfo->DmaBufferCurrentTop -= Length;
+    return DmaBufferInfo->DmaBufferCurrentTop;
+  }
+
+  //
+  // The DMA buffer is exhausted. Split a larger free range, keeping the tail
+  // on the free list of its own size.
+  //
+  for (Class = Pages; Class < DMA_PAGE_CLASS_NUMBER; Class++) {
+    Buffer = DmaBufferInfo->PageFreeList[Class];
+    if (Buffer != 0) {
+      DmaBufferInfo->PageFreeList[Class] = *(UINTN *)Buffer;
+      *(UINTN *)(Buffer + Length) = DmaBufferInfo->PageFreeList[Class - Pages];
+      DmaBufferInfo->PageFreeList[Class - Pages] = Buffer + Length;
+      return Buffer;
+    }
+  }
+
+  return 0;
+}
+
+/**
+  Release pages to the DMA buffer.
+
+  @param DmaBufferInfo      The DMA buffer information.
+  @param Pages              The number of pages to free.
+  @param Buffer             The pages base returned by AllocateDmaPages().
+**/
+VOID
+FreeDmaPages (
+  IN DMA_BUFFER_INFO          *DmaBufferInfo,
+  IN UINTN                    Pages,
+  IN UINTN                    Buffer
+  )
+{
+  if (Buffer == DmaBufferInfo->DmaBufferCurrentTop) {
+    DmaBufferInfo->DmaBufferCurrentTop += EFI_PAGES_TO_SIZE (Pages);
+    return;
+  }
+
+  if ((Pages != 0) && (Pages <= DMA_PAGE_CLASS_NUMBER)) {
+    *(UINTN *)Buffer = DmaBufferInfo->PageFreeList[Pages - 1];
+    DmaBufferInfo->PageFreeList[Pages - 1] = Buffer;
+  }
+}
+
 /**
   Set IOMMU attribute for a system memory.
 
@@ -163,6 +351,8 @@ PeiIoMmuMap (
 {
   MAP_INFO                    *MapInfo;
   UINTN                       Length;
+  UINTN                       BlockSize;
+  UINTN                       Buffer;
   VOID                        *Hob;
   DMA_BUFFER_INFO             *DmaBufferInfo;
 
@@ -185,19 +375,20 @@ PeiIoMmuMap (
   }
 
   Length = *NumberOfBytes + sizeof(MAP_INFO);
-  if (Length > DmaBufferInfo->DmaBufferCurrentTop - DmaBufferInfo->DmaBufferCurrentBottom) {
+  Buffer = AllocateMapBuffer (DmaBufferInfo, Length, &BlockSize);
+  if (Buffer == 0) {
     DEBUG ((DEBUG_ERROR, "PeiIoMmuMap - OUT_OF_RESOURCE\n"));
     ASSERT (FALSE);
     return EFI_OUT_OF_RESOURCES;
   }
 
-  *DeviceAddress = DmaBufferInfo->DmaBufferCurrentBottom;
-  DmaBufferInfo->DmaBufferCurrentBottom += Length;
+  *DeviceAddress = Buffer;
 
   MapInfo = (VOID *)(UINTN)(*DeviceAddress + *NumberOfBytes);
   MapInfo->Signature     = MAP_INFO_SIGNATURE;
   MapInfo->Operation     = Operation;
   MapInfo->NumberOfBytes = *NumberOfBytes;
+  MapInfo->BlockSize     = BlockSize;
   MapInfo->HostAddress   = (UINTN)HostAddress;
   MapInfo->DeviceAddress = *DeviceAddress;
   *Mapping = MapInfo;
@@ -241,7 +432,6 @@ PeiIoMmuUnmap (
   )
 {
   MAP_INFO                    *MapInfo;
-  UINTN                       Length;
   VOID                        *Hob;
   DMA_BUFFER_INFO             *DmaBufferInfo;
 
@@ -278,10 +468,8 @@ PeiIoMmuUnmap (
       );
   }
 
-  Length = MapInfo->NumberOfBytes + sizeof(MAP_INFO);
-  if (DmaBufferInfo->DmaBufferCurrentBottom == MapInfo->DeviceAddress + Length) {
-    DmaBufferInfo->DmaBufferCurrentBottom -= Length;
-  }
+  MapInfo->Signature = 0;
+  FreeMapBuffer (DmaBufferInfo, (UINTN)MapInfo->DeviceAddress, MapInfo->BlockSize);
 
   return EFI_SUCCESS;
 }
@@ -317,7 +505,7 @@ PeiIoMmuAllocateBuffer (
   IN     UINT64                                   Attributes
   )
 {
-  UINTN                       Length;
+  UINTN                       Buffer;
   VOID                        *Hob;
   DMA_BUFFER_INFO             *DmaBufferInfo;
 
@@ -332,14 +520,13 @@ PeiIoMmuAllocateBuffer (
     return EFI_NOT_AVAILABLE_YET;
   }
 
-  Length = EFI_PAGES_TO_SIZE(Pages);
-  if (Length > DmaBufferInfo->DmaBufferCurrentTop - DmaBufferInfo->DmaBufferCurrentBottom) {
+  Buffer = AllocateDmaPages (DmaBufferInfo, Pages);
+  if (Buffer == 0) {
     DEBUG ((DEBUG_ERROR, "PeiIoMmuAllocateBuffer - OUT_OF_RESOURCE\n"));
     ASSERT (FALSE);
     return EFI_OUT_OF_RESOURCES;
   }
-  *HostAddress = (VOID *)(UINTN)(DmaBufferInfo->DmaBufferCurrentTop - Length);
-  DmaBufferInfo->DmaBufferCurrentTop -= Length;
+  *HostAddress = (VOID *)Buffer;
 
   DEBUG ((DEBUG_VERBOSE, "PeiIoMmuAllocateBuffer - allocate - %x\n", *HostAddress));
   return EFI_SUCCESS;
@@ -367,7 +554,6 @@ PeiIoMmuFreeBuffer (
   IN  VOID                                     *HostAddress
   )
 {
-  UINTN                       Length;
   VOID                        *Hob;
   DMA_BUFFER_INFO             *DmaBufferInfo;
 
@@ -382,10 +568,7 @@ PeiIoMmuFreeBuffer (
     return EFI_NOT_AVAILABLE_YET;
   }
 
-  Length = EFI_PAGES_TO_SIZE(Pages);
-  if ((UINTN)HostAddress == DmaBufferInfo->DmaBufferCurrentTop) {
-    DmaBufferInfo->DmaBufferCurrentTop += Length;
-  }
+  FreeDmaPages (DmaBufferInfo, Pages, (UINTN)HostAddress);
 
   return EFI_SUCCESS;
 }
@@ -495,6 +678,8 @@ InitDmaProtection (
 
   DmaBufferInfo->DmaBufferCurrentTop = DmaBufferInfo->DmaBufferBase + DmaBufferInfo->DmaBufferSize;
   DmaBufferInfo->DmaBufferCurrentBottom = DmaBufferInfo->DmaBufferBase;
+  ZeroMem (DmaBufferInfo->MapFreeList, sizeof(DmaBufferInfo->MapFreeList));
+  ZeroMem (DmaBufferInfo->PageFreeList, sizeof(DmaBufferInfo->PageFreeList));
   DEBUG ((DEBUG_INFO, " DmaBufferSize : 0x%x\n", DmaBufferInfo->DmaBufferSize));
   DEBUG ((DEBUG_INFO, " DmaBufferBase : 0x%x\n", DmaBufferInfo->DmaBufferBase));
 
@@ -0,0 +1,88 @@
+/** @file
+  Definitions of the SMM communication interface that reports the SMI
+  handler latency statistics collected by SmiHandlerLatencyLib.
+
+  The statistics of all dispatchers are returned as one SMI_HANDLER_LATENCY_DATA
+  structure followed by RecordCount SMI_HANDLER_LATENCY_RECORD entries. The
+  times are in TSC ticks.
+
+  Copyright (c) 2020, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#ifndef _SMI_HANDLER_LATENCY_H_
+#define _SMI_HANDLER_LATENCY_H_
+
+#define SMI_HANDLER_LATENCY_GUID \
+  { \
+    0xb862dd22, 0x3269, 0x4069, { 0x8f, 0xf1, 0x80, 0xcd, 0x98, 0x3b, 0x8a, 0xb6 } \
+  }
+
+#define SMI_HANDLER_LATENCY_DATA_REVISION        1
+
+///
+/// Bucket N of the histogram counts the calls that ran for [2^N, 2^(N+1))
+/// ticks, the last bucket also counts all longer calls.
+///
+#define SMI_HANDLER_LATENCY_HISTOGRAM_BUCKETS    32
+
+typedef struct {
+  UINT64                            Handler;
+  UINT64                            Count;
+  UINT64                            TotalTicks;
+  UINT64                            MinTicks;
+  UINT64                            MaxTicks;
+  UINT32                            Histogram[SMI_HANDLER_LATENCY_HISTOGRAM_BUCKETS];
+} SMI_HANDLER_LATENCY_RECORD;
+
+typedef struct {
+  UINT32                            Revision;
+  UINT32                            RecordCount;
+  ///
+  /// Calls that were not accounted because the record table was full.
+  ///
+  UINT64                            DroppedCount;
+//SMI_HANDLER_LATENCY_RECORD        Record[RecordCount];
+} SMI_HANDLER_LATENCY_DATA;
+
+//
+// SMI handler latency SMM Communication command
+//
+#define SMI_HANDLER_LATENCY_COMMAND_GET_INFO            0x1
+#define SMI_HANDLER_LATENCY_COMMAND_GET_DATA_BY_OFFSET  0x2
+#define SMI_HANDLER_LATENCY_COMMAND_RESET               0x3
+
+typedef struct {
+  UINT32                            Command;
+  UINT32                            DataLength;
+  UINT64                            ReturnStatus;
+} SMI_HANDLER_LATENCY_PARAMETER_HEADER;
+
+///
+/// GET_INFO takes a snapshot of the statistics and returns its size. The
+/// snapshot is what GET_DATA_BY_OFFSET reads, so the data stays consistent
+/// across the SMIs needed to copy it out.
+///
+typedef struct {
+  SMI_HANDLER_LATENCY_PARAMETER_HEADER    Header;
+  UINT64                                  DataSize;
+} SMI_HANDLER_LATENCY_PARAMETER_GET_INFO;
+
+typedef struct {
+  SMI_HANDLER_LATENCY_PARAMETER_HEADER    Header;
+  //
+  // On input, data buffer size.
+  // On output, actual data buffer size copied.
+  //
+  UINT64                                  DataSize;
+  PHYSICAL_ADDRESS                        DataBuffer;
+  //
+  // On input, data buffer offset to copy.
+  // On output, next time data buffer offset to copy.
+  //
+  UINT64                                  DataOffset;
+} SMI_HANDLER_LATENCY_PARAMETER_GET_DATA_BY_OFFSET;
+
+extern EFI_GUID gSmiHandlerLatencyGuid;
+
+#endif
@@ -206,10 +206,12 @@ typedef union {
 #define   B_CAP_REG_RWBF       BIT4
 #define R_ECAP_REG       0x10
 #define R_GCMD_REG       0x18
+#define   B_GMCD_REG_QIE       BIT26
 #define   B_GMCD_REG_WBF       BIT27
 #define   B_GMCD_REG_SRTP      BIT30
 #define   B_GMCD_REG_TE        BIT31
 #define R_GSTS_REG       0x1C
+#define   B_GSTS_REG_QIES      BIT26
 #define   B_GSTS_REG_WBF       BIT27
 #define   B_GSTS_REG_RTPS      BIT30
 #define   B_GSTS_REG_TE        BIT31
@@ -221,11 +223,19 @@ typedef union {
 #define   V_CCMD_REG_CIRG_DEVICE  (BIT62|BIT61)
 #define   B_CCMD_REG_ICC          BIT63
 #define R_FSTS_REG       0x34
+#define   B_FSTS_REG_IQE          BIT4
 #define R_FECTL_REG      0x38
 #define R_FEDATA_REG     0x3C
 #define R_FEADDR_REG     0x40
 #define R_FEUADDR_REG    0x44
 #define R_AFLOG_REG      0x58
+#define R_IQH_REG        0x80
+#define R_IQT_REG        0x88
+#define   B_IQT_REG_QT_SHIFT      4
+#define R_IQA_REG        0x90
+#define   B_IQA_REG_QS_MASK       (BIT0|BIT1|BIT2)
+#define R_ICS_REG        0x9C
+#define   B_ICS_REG_IWC           BIT0
 
 #define R_IVA_REG        0x00 // + IRO
 #define   B_IVA_REG_AM_MASK       (BIT0|BIT1|BIT2|BIT3|BIT4|BIT5)
@@ -336,6 +346,54 @@ typedef union {
   UINT64     Uint64[2];
 } VTD_FRCD_REG;
 
+//
+// Queued invalidation descriptors (128-bit)
+//
+#define V_QI_DESC_TYPE_CONTEXT_CACHE  0x1
+#define V_QI_DESC_TYPE_IOTLB          0x2
+#define V_QI_DESC_TYPE_WAIT           0x5
+
+#define V_QI_DESC_GRAN_GLOBAL         1
+#define V_QI_DESC_GRAN_DOMAIN         2
+#define V_QI_DESC_GRAN_PAGE           3
+
+typedef union {
+  struct {
+    UINT32   Type:4;
+    UINT32   Granularity:2;
+    UINT32   Rsvd_6:10;
+    UINT32   DomainId:16;
+    UINT32   SourceId:16;
+    UINT32   FunctionMask:2;
+    UINT32   Rsvd_50:14;
+    UINT64   Rsvd_64;
+  } ContextCache;
+  struct {
+    UINT32   Type:4;
+    UINT32   Granularity:2;
+    UINT32   DrainWrites:1;
+    UINT32   DrainReads:1;
+    UINT32   Rsvd_8:8;
+    UINT32   DomainId:16;
+    UINT32   Rsvd_32;
+    UINT32   AddressMask:6;
+    UINT32   InvalidationHint:1;
+    UINT32   Rsvd_71:5;
+    UINT32   AddressLo:20;
+    UINT32   AddressHi:32;
+  } Iotlb;
+  struct {
+    UINT32   Type:4;
+    UINT32   InterruptFlag:1;
+    UINT32   StatusWrite:1;
+    UINT32   FenceFlag:1;
+    UINT32   Rsvd_7:25;
+    UINT32   StatusData;
+    UINT64   StatusAddress;
+  } Wait;
+  UINT64     Uint64[2];
+} VTD_QUEUED_INV_DESCRIPTOR;
+
 typedef union {
   struct {
     UINT8    Function:3;
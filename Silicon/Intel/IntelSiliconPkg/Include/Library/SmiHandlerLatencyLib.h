@@ -0,0 +1,41 @@
+/** @file
+  Provides services to measure how long the child handlers of a SMI
+  dispatcher run.
+
+  The dispatcher brackets each call to a child handler with
+  SmiHandlerLatencyStart () and SmiHandlerLatencyStop (). The statistics are
+  kept per handler address and are read from outside SMM through the
+  communication interface defined in Guid/SmiHandlerLatency.h.
+
+  Copyright (c) 2020, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#ifndef _SMI_HANDLER_LATENCY_LIB_H_
+#define _SMI_HANDLER_LATENCY_LIB_H_
+
+/**
+  Start measuring a child SMI handler.
+
+  @return The time stamp to pass to SmiHandlerLatencyStop ().
+**/
+UINT64
+EFIAPI
+SmiHandlerLatencyStart (
+  VOID
+  );
+
+/**
+  Stop measuring a child SMI handler and account the time it ran.
+
+  @param[in] Handler      Address of the child handler that was called.
+  @param[in] StartTicks   The value returned by SmiHandlerLatencyStart ().
+**/
+VOID
+EFIAPI
+SmiHandlerLatencyStop (
+  IN VOID    *Handler,
+  IN UINT64  StartTicks
+  );
+
+#endif
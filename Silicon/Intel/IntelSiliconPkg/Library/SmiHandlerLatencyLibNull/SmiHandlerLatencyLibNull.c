@@ -0,0 +1,38 @@
+/** @file
+  NULL instance of SmiHandlerLatencyLib.
+
+  Copyright (c) 2020, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#include <Base.h>
+#include <Library/SmiHandlerLatencyLib.h>
+
+/**
+  Start measuring a child SMI handler.
+
+  @return The time stamp to pass to SmiHandlerLatencyStop ().
+**/
+UINT64
+EFIAPI
+SmiHandlerLatencyStart (
+  VOID
+  )
+{
+  return 0;
+}
+
+/**
+  Stop measuring a child SMI handler and account the time it ran.
+
+  @param[in] Handler      Address of the child handler that was called.
+  @param[in] StartTicks   The value returned by SmiHandlerLatencyStart ().
+**/
+VOID
+EFIAPI
+SmiHandlerLatencyStop (
+  IN VOID    *Handler,
+  IN UINT64  StartTicks
+  )
+{
+}
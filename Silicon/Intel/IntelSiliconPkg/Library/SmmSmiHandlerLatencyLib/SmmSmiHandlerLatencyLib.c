@@ -0,0 +1,349 @@
+/** @file
+  SMM instance of SmiHandlerLatencyLib.
+
+  The first dispatcher that links this library allocates the statistics table,
+  publishes it as a SMM configuration table and registers the communication
+  handler. The dispatchers loaded after it find the table and account into it,
+  so one request returns the statistics of all of them.
+
+  Caution: This module requires additional review when modified.
+  This driver will have external input - communicate buffer in SMM mode.
+  This external input must be validated carefully to avoid security issue like
+  buffer overflow, integer overflow.
+
+  SmiHandlerLatencySmiHandler() will receive untrusted input and do basic validation.
+
+  Copyright (c) 2020, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#include <PiSmm.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/SmiHandlerLatencyLib.h>
+#include <Library/SmmMemLib.h>
+#include <Library/SmmServicesTableLib.h>
+#include <Guid/SmiHandlerLatency.h>
+
+#define SMI_HANDLER_LATENCY_TABLE_SIGNATURE  SIGNATURE_32 ('S', 'H', 'L', 'T')
+
+///
+/// Number of distinct handlers that can be accounted.
+///
+#define SMI_HANDLER_LATENCY_MAX_RECORDS      64
+
+///
+/// Header and Record are laid out as the data returned by GET_DATA_BY_OFFSET.
+///
+typedef struct {
+  UINT32                            Signature;
+  UINT32                            Reserved;
+  SMI_HANDLER_LATENCY_DATA          Header;
+  SMI_HANDLER_LATENCY_RECORD        Record[SMI_HANDLER_LATENCY_MAX_RECORDS];
+} SMI_HANDLER_LATENCY_TABLE;
+
+STATIC SMI_HANDLER_LATENCY_TABLE    *mLatencyTable = NULL;
+
+//
+// Only used by the module that owns the table and the communication handler.
+//
+STATIC UINT8                        *mLatencySnapshot = NULL;
+STATIC UINTN                        mLatencySnapshotSize = 0;
+
+/**
+  Start measuring a child SMI handler.
+
+  @return The time stamp to pass to SmiHandlerLatencyStop ().
+**/
+UINT64
+EFIAPI
+SmiHandlerLatencyStart (
+  VOID
+  )
+{
+  return AsmReadTsc ();
+}
+
+/**
+  Stop measuring a child SMI handler and account the time it ran.
+
+  @param[in] Handler      Address of the child handler that was called.
+  @param[in] StartTicks   The value returned by SmiHandlerLatencyStart ().
+**/
+VOID
+EFIAPI
+SmiHandlerLatencyStop (
+  IN VOID    *Handler,
+  IN UINT64  StartTicks
+  )
+{
+  UINT64                      Ticks;
+  SMI_HANDLER_LATENCY_RECORD  *Record;
+  UINT32                      Index;
+  UINTN                       Bucket;
+
+  Ticks = AsmReadTsc () - StartTicks;
+
+  if (mLatencyTable == NULL) {
+    return;
+  }
+
+  for (Index = 0; Index < mLatencyTable->Header.RecordCount; Index++) {
+    if (mLatencyTable->Record[Index].Handler == (UINT64) (UINTN) Handler) {
+      break;
+    }
+  }
+
+  Record = &mLatencyTable->Record[Index];
+  if (Index == mLatencyTable->Header.RecordCount) {
+    if (Index == SMI_HANDLER_LATENCY_MAX_RECORDS) {
+      mLatencyTable->Header.DroppedCount++;
+      return;
+    }
+    Record->Handler  = (UINT64) (UINTN) Handler;
+    Record->MinTicks = MAX_UINT64;
+    mLatencyTable->Header.RecordCount++;
+  }
+
+  Record->Count++;
+  Record->TotalTicks += Ticks;
+  if (Ticks < Record->MinTicks) {
+    Record->MinTicks = Ticks;
+  }
+  if (Ticks > Record->MaxTicks) {
+    Record->MaxTicks = Ticks;
+  }
+
+  Bucket = (Ticks == 0) ? 0 : (UINTN) HighBitSet64 (Ticks);
+  if (Bucket >= SMI_HANDLER_LATENCY_HISTOGRAM_BUCKETS) {
+    Bucket = SMI_HANDLER_LATENCY_HISTOGRAM_BUCKETS - 1;
+  }
+  Record->Histogram[Bucket]++;
+}
+
+/**
+  SMI handler latency SMI handler to get info.
+
+  @param[in, out] SmiHandlerLatencyParameterGetInfo   The parameter of SMI handler latency SMI handler get info.
+**/
+VOID
+SmiHandlerLatencySmiHandlerGetInfo (
+  IN OUT SMI_HANDLER_LATENCY_PARAMETER_GET_INFO   *SmiHandlerLatencyParameterGetInfo
+  )
+{
+  mLatencySnapshotSize = sizeof (SMI_HANDLER_LATENCY_DATA) +
+                         mLatencyTable->Header.RecordCount * sizeof (SMI_HANDLER_LATENCY_RECORD);
+  CopyMem (mLatencySnapshot, &mLatencyTable->Header, mLatencySnapshotSize);
+
+  SmiHandlerLatencyParameterGetInfo->DataSize = mLatencySnapshotSize;
+  SmiHandlerLatencyParameterGetInfo->Header.ReturnStatus = 0;
+}
+
+/**
+  SMI handler latency SMI handler to get data by offset.
+
+  @param[in, out] SmiHandlerLatencyParameterGetDataByOffset   The parameter of SMI handler latency SMI handler get data by offset.
+**/
+VOID
+SmiHandlerLatencySmiHandlerGetDataByOffset (
+  IN OUT SMI_HANDLER_LATENCY_PARAMETER_GET_DATA_BY_OFFSET   *SmiHandlerLatencyParameterGetDataByOffset
+  )
+{
+  SMI_HANDLER_LATENCY_PARAMETER_GET_DATA_BY_OFFSET    SmiHandlerLatencyGetDataByOffset;
+
+  CopyMem (
+    &SmiHandlerLatencyGetDataByOffset,
+    SmiHandlerLatencyParameterGetDataByOffset,
+    sizeof (SmiHandlerLatencyGetDataByOffset)
+    );
+
+  //
+  // Sanity check
+  //
+  if (!SmmIsBufferOutsideSmmValid ((UINTN) SmiHandlerLatencyGetDataByOffset.DataBuffer, (UINTN) SmiHandlerLatencyGetDataByOffset.DataSize)) {
+    DEBUG ((DEBUG_ERROR, "SmiHandlerLatencySmiHandlerGetDataByOffset: data buffer in SMRAM or overflow!\n"));
+    SmiHandlerLatencyParameterGetDataByOffset->Header.ReturnStatus = (UINT64) (INT64) (INTN) EFI_ACCESS_DENIED;
+    return;
+  }
+
+  if (mLatencySnapshotSize == 0) {
+    SmiHandlerLatencyParameterGetDataByOffset->Header.ReturnStatus = (UINT64) (INT64) (INTN) EFI_NOT_READY;
+    return;
+  }
+
+  //
+  // The SpeculationBarrier() call here is to ensure the previous range/content
+  // checks for the CommBuffer have been completed before copying the data.
+  //
+  SpeculationBarrier ();
+  if (SmiHandlerLatencyGetDataByOffset.DataOffset >= mLatencySnapshotSize) {
+    SmiHandlerLatencyGetDataByOffset.DataOffset = mLatencySnapshotSize;
+    SmiHandlerLatencyGetDataByOffset.DataSize   = 0;
+  } else {
+    if (mLatencySnapshotSize - SmiHandlerLatencyGetDataByOffset.DataOffset < SmiHandlerLatencyGetDataByOffset.DataSize) {
+      SmiHandlerLatencyGetDataByOffset.DataSize = mLatencySnapshotSize - SmiHandlerLatencyGetDataByOffset.DataOffset;
+    }
+    CopyMem (
+      (VOID *) (UINTN) SmiHandlerLatencyGetDataByOffset.DataBuffer,
+      mLatencySnapshot + (UINTN) SmiHandlerLatencyGetDataByOffset.DataOffset,
+      (UINTN) SmiHandlerLatencyGetDataByOffset.DataSize
+      );
+    SmiHandlerLatencyGetDataByOffset.DataOffset += SmiHandlerLatencyGetDataByOffset.DataSize;
+  }
+
+  CopyMem (
+    SmiHandlerLatencyParameterGetDataByOffset,
+    &SmiHandlerLatencyGetDataByOffset,
+    sizeof (SmiHandlerLatencyGetDataByOffset)
+    );
+
+  SmiHandlerLatencyParameterGetDataByOffset->Header.ReturnStatus = 0;
+}
+
+/**
+  Dispatch function for the SMI handler latency communication interface.
+
+  Caution: This function may receive untrusted input.
+  Communicate buffer and buffer size are external input, so this function will do basic validation.
+
+  @param DispatchHandle  The unique handle assigned to this handler by SmiHandlerRegister().
+  @param Context         Points to an optional handler context which was specified when the
+                         handler was registered.
+  @param CommBuffer      A pointer to a collection of data in memory that will
+                         be conveyed from a non-SMM environment into an SMM environment.
+  @param CommBufferSize  The size of the CommBuffer.
+
+  @retval EFI_SUCCESS Command is handled successfully.
+**/
+EFI_STATUS
+EFIAPI
+SmiHandlerLatencySmiHandler (
+  IN EFI_HANDLE  DispatchHandle,
+  IN CONST VOID  *Context         OPTIONAL,
+  IN OUT VOID    *CommBuffer      OPTIONAL,
+  IN OUT UINTN   *CommBufferSize  OPTIONAL
+  )
+{
+  SMI_HANDLER_LATENCY_PARAMETER_HEADER   *SmiHandlerLatencyParameterHeader;
+  UINTN                                  TempCommBufferSize;
+
+  //
+  // If input is invalid, stop processing this SMI
+  //
+  if (CommBuffer == NULL || CommBufferSize == NULL) {
+    return EFI_SUCCESS;
+  }
+
+  TempCommBufferSize = *CommBufferSize;
+
+  if (TempCommBufferSize < sizeof (SMI_HANDLER_LATENCY_PARAMETER_HEADER)) {
+    DEBUG ((DEBUG_ERROR, "SmiHandlerLatencySmiHandler: SMM communication buffer size invalid!\n"));
+    return EFI_SUCCESS;
+  }
+
+  if (!SmmIsBufferOutsideSmmValid ((UINTN) CommBuffer, TempCommBufferSize)) {
+    DEBUG ((DEBUG_ERROR, "SmiHandlerLatencySmiHandler: SMM communication buffer in SMRAM or overflow!\n"));
+    return EFI_SUCCESS;
+  }
+
+  SmiHandlerLatencyParameterHeader = (SMI_HANDLER_LATENCY_PARAMETER_HEADER *) ((UINTN) CommBuffer);
+  SmiHandlerLatencyParameterHeader->ReturnStatus = (UINT64) -1;
+
+  switch (SmiHandlerLatencyParameterHeader->Command) {
+  case SMI_HANDLER_LATENCY_COMMAND_GET_INFO:
+    if (TempCommBufferSize != sizeof (SMI_HANDLER_LATENCY_PARAMETER_GET_INFO)) {
+      DEBUG ((DEBUG_ERROR, "SmiHandlerLatencySmiHandler: SMM communication buffer size invalid!\n"));
+      return EFI_SUCCESS;
+    }
+    SmiHandlerLatencySmiHandlerGetInfo ((SMI_HANDLER_LATENCY_PARAMETER_GET_INFO *) (UINTN) CommBuffer);
+    break;
+  case SMI_HANDLER_LATENCY_COMMAND_GET_DATA_BY_OFFSET:
+    if (TempCommBufferSize != sizeof (SMI_HANDLER_LATENCY_PARAMETER_GET_DATA_BY_OFFSET)) {
+      DEBUG ((DEBUG_ERROR, "SmiHandlerLatencySmiHandler: SMM communication buffer size invalid!\n"));
+      return EFI_SUCCESS;
+    }
+    SmiHandlerLatencySmiHandlerGetDataByOffset ((SMI_HANDLER_LATENCY_PARAMETER_GET_DATA_BY_OFFSET *) (UINTN) CommBuffer);
+    break;
+  case SMI_HANDLER_LATENCY_COMMAND_RESET:
+    ZeroMem (mLatencyTable->Record, sizeof (mLatencyTable->Record));
+    mLatencyTable->Header.RecordCount  = 0;
+    mLatencyTable->Header.DroppedCount = 0;
+    SmiHandlerLatencyParameterHeader->ReturnStatus = 0;
+    break;
+  default:
+    break;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  The constructor function finds the statistics table shared by the
+  dispatchers, or creates it and registers the communication handler.
+
+  @param[in] ImageHandle  The firmware allocated handle for the EFI image.
+  @param[in] SystemTable  A pointer to the EFI System Table.
+
+  @retval EFI_SUCCESS     The constructor always returns EFI_SUCCESS.
+**/
+EFI_STATUS
+EFIAPI
+SmmSmiHandlerLatencyLibConstructor (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  )
+{
+  EFI_STATUS                  Status;
+  UINTN                       Index;
+  EFI_HANDLE                  DispatchHandle;
+  SMI_HANDLER_LATENCY_TABLE   *Table;
+
+  for (Index = 0; Index < gSmst->NumberOfTableEntries; Index++) {
+    if (CompareGuid (&gSmst->SmmConfigurationTable[Index].VendorGuid, &gSmiHandlerLatencyGuid)) {
+      Table = gSmst->SmmConfigurationTable[Index].VendorTable;
+      if (Table->Signature == SMI_HANDLER_LATENCY_TABLE_SIGNATURE) {
+        mLatencyTable = Table;
+      }
+      return EFI_SUCCESS;
+    }
+  }
+
+  Table            = AllocateZeroPool (sizeof (SMI_HANDLER_LATENCY_TABLE));
+  mLatencySnapshot = AllocateZeroPool (sizeof (SMI_HANDLER_LATENCY_DATA) + sizeof (Table->Record));
+  if ((Table == NULL) || (mLatencySnapshot == NULL)) {
+    DEBUG ((DEBUG_ERROR, "SmmSmiHandlerLatencyLib: out of resources, statistics disabled\n"));
+    if (Table != NULL) {
+      FreePool (Table);
+    }
+    if (mLatencySnapshot != NULL) {
+      FreePool (mLatencySnapshot);
+      mLatencySnapshot = NULL;
+    }
+    return EFI_SUCCESS;
+  }
+  Table->Signature       = SMI_HANDLER_LATENCY_TABLE_SIGNATURE;
+  Table->Header.Revision = SMI_HANDLER_LATENCY_DATA_REVISION;
+
+  Status = gSmst->SmmInstallConfigurationTable (
+                    gSmst,
+                    &gSmiHandlerLatencyGuid,
+                    Table,
+                    sizeof (SMI_HANDLER_LATENCY_TABLE)
+                    );
+  ASSERT_EFI_ERROR (Status);
+  if (EFI_ERROR (Status)) {
+    return EFI_SUCCESS;
+  }
+  mLatencyTable = Table;
+
+  Status = gSmst->SmiHandlerRegister (
+                    SmiHandlerLatencySmiHandler,
+                    &gSmiHandlerLatencyGuid,
+                    &DispatchHandle
+                    );
+  ASSERT_EFI_ERROR (Status);
+
+  return EFI_SUCCESS;
+}
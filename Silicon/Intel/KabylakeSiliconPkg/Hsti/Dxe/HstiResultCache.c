@@ -0,0 +1,260 @@
+/** @file
+  This file contains the HSTI result cache. The results of a full evaluation
+  are kept in a variable together with a fingerprint of the inputs the tests
+  depend on, and reused on later boots for as long as the fingerprint matches.
+
+Copyright (c) 2017, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "HstiSiliconDxe.h"
+
+#define HSTI_RESULT_CACHE_SIGNATURE     SIGNATURE_32 ('H', 'S', 'T', 'C')
+#define HSTI_RESULT_CACHE_VARIABLE_NAME L"HstiSiliconResult"
+
+///
+/// Lock and configuration registers sampled on the BSP
+///
+typedef enum {
+  HstiLockRegisterSpiBiosControl,
+  HstiLockRegisterSpiHsfsc,
+  HstiLockRegisterSpiFrap,
+  HstiLockRegisterDmiGcs,
+  HstiLockRegisterSmramc,
+  HstiLockRegisterTsegmb,
+  HstiLockRegisterBgsm,
+  HstiLockRegisterBdsm,
+  HstiLockRegisterTolud,
+  HstiLockRegisterTouud,
+  HstiLockRegisterTom,
+  HstiLockRegisterDpr,
+  HstiLockRegisterMeSegMask,
+  HstiLockRegisterGgc,
+  HstiLockRegisterPavpc,
+  HstiLockRegisterVtd1,
+  HstiLockRegisterVtd2,
+  HstiLockRegisterDebugInterface,
+  HstiLockRegisterMax
+} HSTI_LOCK_REGISTER;
+
+///
+/// MSRs sampled on every enabled processor
+///
+GLOBAL_REMOVE_IF_UNREFERENCED CONST UINT32  mHstiProcessorMsr[] = {
+  MSR_IA32_BIOS_SIGN_ID,
+  MSR_IA32_FEATURE_CONTROL,
+  MSR_SMM_FEATURE_CONTROL
+};
+
+#define HSTI_PROCESSOR_MSR_COUNT  (sizeof (mHstiProcessorMsr) / sizeof (mHstiProcessorMsr[0]))
+
+typedef struct {
+  UINT32  Signature;
+  UINT32  FirmwareRevision;
+  UINT32  FirmwareVendorCrc;
+  UINT32  NumberOfProcessors;
+  UINT32  ProcessorMsrCrc;
+  UINT8   FeatureImplemented[HSTI_SECURITY_FEATURE_SIZE];
+  UINT32  LockRegister[HstiLockRegisterMax];
+} HSTI_RESULT_FINGERPRINT;
+
+/**
+  Sample the inputs the HSTI tests depend on.
+
+  The fingerprint covers the firmware version, the microcode revision and
+  the lock MSRs of every enabled processor, and the lock and memory map
+  registers checked by the tests, so that any change to them forces a full
+  evaluation.
+
+  @param[out] Fingerprint  - Fingerprint of the current platform state
+
+  @retval EFI_SUCCESS           - Fingerprint is valid.
+  @retval EFI_OUT_OF_RESOURCES  - Not enough memory to sample the processors.
+**/
+EFI_STATUS
+GetHstiResultFingerprint (
+  OUT HSTI_RESULT_FINGERPRINT  *Fingerprint
+  )
+{
+  EFI_STATUS  Status;
+  UINT64      *ProcessorMsr;
+  UINTN       CpuNumber;
+  UINTN       CpuIndex;
+  UINTN       Index;
+  UINTN       McD0BaseAddress;
+  UINT32      PchSpiBar0;
+  UINT32      MchBar;
+  UINT32      RegEcx;
+
+  ZeroMem (Fingerprint, sizeof (*Fingerprint));
+  Fingerprint->Signature        = HSTI_RESULT_CACHE_SIGNATURE;
+  Fingerprint->FirmwareRevision = gST->FirmwareRevision;
+  if (gST->FirmwareVendor != NULL) {
+    Status = gBS->CalculateCrc32 (gST->FirmwareVendor, StrSize (gST->FirmwareVendor), &Fingerprint->FirmwareVendorCrc);
+    ASSERT_EFI_ERROR (Status);
+  }
+  CopyMem (Fingerprint->FeatureImplemented, mFeatureImplemented, sizeof (mFeatureImplemented));
+
+  //
+  // MSR_IA32_BIOS_SIGN_ID still holds the revision latched at microcode load,
+  // which is also what CheckSecureCpuConfiguration () reads.
+  //
+  CpuNumber = GetCpuNumber ();
+  ProcessorMsr = AllocateZeroPool (CpuNumber * HSTI_PROCESSOR_MSR_COUNT * sizeof (UINT64));
+  if (ProcessorMsr == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+  for (CpuIndex = 0; CpuIndex < CpuNumber; CpuIndex++) {
+    for (Index = 0; Index < HSTI_PROCESSOR_MSR_COUNT; Index++) {
+      ProcessorMsr[CpuIndex * HSTI_PROCESSOR_MSR_COUNT + Index] = ProcessorReadMsr64 (CpuIndex, mHstiProcessorMsr[Index]);
+    }
+  }
+  Fingerprint->NumberOfProcessors = (UINT32) CpuNumber;
+  Status = gBS->CalculateCrc32 (
+                  ProcessorMsr,
+                  CpuNumber * HSTI_PROCESSOR_MSR_COUNT * sizeof (UINT64),
+                  &Fingerprint->ProcessorMsrCrc
+                  );
+  ASSERT_EFI_ERROR (Status);
+  FreePool (ProcessorMsr);
+
+  McD0BaseAddress = MmPciBase (DEFAULT_PCI_BUS_NUMBER_PCH, SA_MC_DEV, SA_MC_FUN);
+  PchSpiBar0 = MmioRead32 (MmPciBase (DEFAULT_PCI_BUS_NUMBER_PCH, PCI_DEVICE_NUMBER_PCH_SPI, PCI_FUNCTION_NUMBER_PCH_SPI) + R_PCH_SPI_BAR0) & ~B_PCH_SPI_BAR0_MASK;
+  MchBar = (UINT32) MmioRead64 (McD0BaseAddress + R_SA_MCHBAR) & B_SA_MCHBAR_MCHBAR_MASK;
+
+  Fingerprint->LockRegister[HstiLockRegisterSpiBiosControl] = MmioRead8 (MmPciBase (DEFAULT_PCI_BUS_NUMBER_PCH, PCI_DEVICE_NUMBER_PCH_LPC, PCI_FUNCTION_NUMBER_PCH_SPI) + R_PCH_SPI_BC);
+  Fingerprint->LockRegister[HstiLockRegisterSpiHsfsc]       = MmioRead16 (PchSpiBar0 + R_PCH_SPI_HSFSC);
+  Fingerprint->LockRegister[HstiLockRegisterSpiFrap]        = MmioRead16 (PchSpiBar0 + R_PCH_SPI_FRAP);
+  Fingerprint->LockRegister[HstiLockRegisterDmiGcs]         = MmioRead8 (PCH_PCR_ADDRESS (PID_DMI, R_PCH_PCR_DMI_GCS));
+  Fingerprint->LockRegister[HstiLockRegisterSmramc]         = MmioRead8 (McD0BaseAddress + R_SA_SMRAMC);
+  Fingerprint->LockRegister[HstiLockRegisterTsegmb]         = MmioRead32 (McD0BaseAddress + R_SA_TSEGMB);
+  Fingerprint->LockRegister[HstiLockRegisterBgsm]           = MmioRead32 (McD0BaseAddress + R_SA_BGSM);
+  Fingerprint->LockRegister[HstiLockRegisterBdsm]           = MmioRead32 (McD0BaseAddress + R_SA_BDSM);
+  Fingerprint->LockRegister[HstiLockRegisterTolud]          = MmioRead32 (McD0BaseAddress + R_SA_TOLUD);
+  Fingerprint->LockRegister[HstiLockRegisterTouud]          = MmioRead32 (McD0BaseAddress + R_SA_TOUUD);
+  Fingerprint->LockRegister[HstiLockRegisterTom]            = MmioRead32 (McD0BaseAddress + R_SA_TOM);
+  Fingerprint->LockRegister[HstiLockRegisterDpr]            = MmioRead32 (McD0BaseAddress + R_SA_DPR);
+  Fingerprint->LockRegister[HstiLockRegisterMeSegMask]      = MmioRead32 (McD0BaseAddress + R_SA_MESEG_MASK);
+  Fingerprint->LockRegister[HstiLockRegisterGgc]            = MmioRead16 (McD0BaseAddress + R_SA_GGC);
+  Fingerprint->LockRegister[HstiLockRegisterPavpc]          = MmioRead32 (McD0BaseAddress + R_SA_PAVPC);
+  Fingerprint->LockRegister[HstiLockRegisterVtd1]           = MmioRead32 (MchBar + R_SA_MCHBAR_VTD1_OFFSET);
+  Fingerprint->LockRegister[HstiLockRegisterVtd2]           = MmioRead32 (MchBar + R_SA_MCHBAR_VTD2_OFFSET);
+
+  AsmCpuid (CPUID_VERSION_INFO, NULL, NULL, &RegEcx, NULL);
+  if ((RegEcx & BIT11) != 0) {
+    Fingerprint->LockRegister[HstiLockRegisterDebugInterface] = (UINT32) AsmReadMsr64 (MSR_IA32_DEBUG_INTERFACE);
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Retrieve HSTI results saved by a previous boot, if the platform state they
+  were evaluated against is unchanged.
+
+  @param[out] HstiSize  - Size of the returned results
+
+  @retval NULL   - No usable results; the tests must be run.
+  @retval Other  - Pointer to the cached results. Caller is responsible to free it.
+**/
+ADAPTER_INFO_PLATFORM_SECURITY *
+LoadHstiResultCache (
+  OUT UINTN                    *HstiSize
+  )
+{
+  EFI_STATUS                      Status;
+  HSTI_RESULT_FINGERPRINT         Fingerprint;
+  UINT8                           *Cache;
+  UINTN                           CacheSize;
+  ADAPTER_INFO_PLATFORM_SECURITY  *Hsti;
+  UINTN                           Size;
+
+  if (!FeaturePcdGet (PcdHstiResultCacheEnable)) {
+    return NULL;
+  }
+
+  Status = GetVariable2 (HSTI_RESULT_CACHE_VARIABLE_NAME, &gHstiResultCacheGuid, (VOID **) &Cache, &CacheSize);
+  if (EFI_ERROR (Status)) {
+    return NULL;
+  }
+
+  Hsti = NULL;
+  Size = CacheSize - sizeof (HSTI_RESULT_FINGERPRINT);
+  if ((CacheSize < sizeof (HSTI_RESULT_FINGERPRINT) + sizeof (ADAPTER_INFO_PLATFORM_SECURITY) + 3 * HSTI_SECURITY_FEATURE_SIZE + sizeof (CHAR16)) ||
+      (GetHstiResultFingerprint (&Fingerprint) != EFI_SUCCESS) ||
+      (CompareMem (Cache, &Fingerprint, sizeof (Fingerprint)) != 0)) {
+    DEBUG ((DEBUG_INFO, "HSTI result cache is stale\n"));
+    goto Done;
+  }
+
+  //
+  // Only accept results in the layout this driver publishes, with a
+  // terminated error string.
+  //
+  Hsti = (ADAPTER_INFO_PLATFORM_SECURITY *) (Cache + sizeof (HSTI_RESULT_FINGERPRINT));
+  if ((Hsti->Role != PLATFORM_SECURITY_ROLE_PLATFORM_REFERENCE) ||
+      (Hsti->SecurityFeaturesSize != HSTI_SECURITY_FEATURE_SIZE) ||
+      (((Size - sizeof (ADAPTER_INFO_PLATFORM_SECURITY) - 3 * HSTI_SECURITY_FEATURE_SIZE) % sizeof (CHAR16)) != 0) ||
+      (ReadUnaligned16 ((UINT16 *) (Cache + CacheSize - sizeof (CHAR16))) != 0)) {
+    DEBUG ((DEBUG_INFO, "HSTI result cache is invalid\n"));
+    Hsti = NULL;
+    goto Done;
+  }
+
+  Hsti = AllocateCopyPool (Size, Hsti);
+  if (Hsti != NULL) {
+    DEBUG ((DEBUG_INFO, "HSTI results taken from cache\n"));
+    *HstiSize = Size;
+  }
+
+Done:
+  FreePool (Cache);
+  return Hsti;
+}
+
+/**
+  Save freshly evaluated HSTI results together with the fingerprint of the
+  platform state they were evaluated against.
+
+  @param[in] Hsti      - Pointer to the results
+  @param[in] HstiSize  - Size of the results
+**/
+VOID
+SaveHstiResultCache (
+  IN ADAPTER_INFO_PLATFORM_SECURITY  *Hsti,
+  IN UINTN                           HstiSize
+  )
+{
+  EFI_STATUS  Status;
+  UINT8       *Cache;
+
+  if (!FeaturePcdGet (PcdHstiResultCacheEnable)) {
+    return;
+  }
+
+  Cache = AllocatePool (sizeof (HSTI_RESULT_FINGERPRINT) + HstiSize);
+  if (Cache == NULL) {
+    return;
+  }
+
+  Status = GetHstiResultFingerprint ((HSTI_RESULT_FINGERPRINT *) Cache);
+  if (!EFI_ERROR (Status)) {
+    CopyMem (Cache + sizeof (HSTI_RESULT_FINGERPRINT), Hsti, HstiSize);
+    //
+    // Boot service access only, so that the results cannot be replaced from the OS.
+    //
+    Status = gRT->SetVariable (
+                    HSTI_RESULT_CACHE_VARIABLE_NAME,
+                    &gHstiResultCacheGuid,
+                    EFI_VARIABLE_NON_VOLATILE | EFI_VARIABLE_BOOTSERVICE_ACCESS,
+                    sizeof (HSTI_RESULT_FINGERPRINT) + HstiSize,
+                    Cache
+                    );
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "Failed to save HSTI result cache - %r\n", Status));
+    }
+  }
+
+  FreePool (Cache);
+}
@@ -51,6 +51,11 @@ UINT8  mFeatureImplemented[HSTI_SECURITY_FEATURE_SIZE] = {
 
 DXE_SI_POLICY_PROTOCOL *mSiPolicyData;
 
+///
+/// Results from a previous boot, either handed over by policy or taken from the result cache
+///
+ADAPTER_INFO_PLATFORM_SECURITY *mPreviousHsti;
+
 /**
   Initialize HSTI feature data
 **/
@@ -65,12 +70,12 @@ InitData (
   UINT8                           *SecurityFeatures;
   UINTN                           Index;
 
-  if ((mSiPolicyData != NULL) && (mSiPolicyData->Hsti != NULL)) {
+  if (mPreviousHsti != NULL) {
 
     ///
-    /// Take cached HSTI feature bitmap data pointed to by policy and publish to OS
+    /// Take HSTI feature bitmap data from previous results and publish to OS
     ///
-    Hsti = mSiPolicyData->Hsti;
+    Hsti = mPreviousHsti;
 
     SecurityFeatures = (UINT8 *) (Hsti + 1);
     DEBUG ((DEBUG_INFO, "  SecurityFeaturesRequired    - "));
@@ -159,7 +164,7 @@ BuildHstiErrorString (
 }
 
 /**
-  Update HSTI feature data from cached results or rerun tests
+  Update HSTI feature data from previous results or rerun tests
 **/
 VOID
 UpdateData (
@@ -170,9 +175,9 @@ UpdateData (
   UINT8                          *SecurityFeatures;
   CHAR16                         *ErrorString;
 
-  if ((mSiPolicyData != NULL) && (mSiPolicyData->Hsti != NULL)) {
+  if (mPreviousHsti != NULL) {
 
-    Hsti = mSiPolicyData->Hsti;
+    Hsti = mPreviousHsti;
 
     SecurityFeatures = (UINT8 *) (Hsti + 1);
     SecurityFeatures = (UINT8 *) (SecurityFeatures + Hsti->SecurityFeaturesSize);
@@ -295,6 +300,10 @@ DumpData (
     mSiPolicyData->HstiSize = HstiSize;
   }
 
+  if (mPreviousHsti == NULL) {
+    SaveHstiResultCache (Hsti, HstiSize);
+  }
+
   DumpHsti (Hsti);
 }
 
@@ -314,12 +323,28 @@ OnReadyToBoot (
 {
   EFI_HANDLE                  Handle;
   EFI_STATUS                  Status;
+  UINTN                       HstiSize;
+  BOOLEAN                     FromCache;
 
   InitMp ();
+
+  FromCache = FALSE;
+  if ((mSiPolicyData != NULL) && (mSiPolicyData->Hsti != NULL)) {
+    mPreviousHsti = mSiPolicyData->Hsti;
+  } else {
+    mPreviousHsti = LoadHstiResultCache (&HstiSize);
+    FromCache = (BOOLEAN) (mPreviousHsti != NULL);
+  }
+
   InitData ();
   UpdateData ();
   DumpData ();
 
+  if (FromCache) {
+    FreePool (mPreviousHsti);
+  }
+  mPreviousHsti = NULL;
+
   Handle = NULL;
   Status = gBS->InstallProtocolInterface (
                   &Handle,
@@ -15,6 +15,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/DebugLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/UefiBootServicesTableLib.h>
+#include <Library/UefiRuntimeServicesTableLib.h>
 #include <Protocol/MpService.h>
 #include <Library/PciLib.h>
 #include <Library/TimerLib.h>
@@ -91,6 +92,7 @@ typedef struct {
 extern UINT8  mFeatureImplemented[HSTI_SECURITY_FEATURE_SIZE];
 extern EFI_GUID gHstiProtocolGuid;
 extern EFI_GUID gHstiPublishCompleteProtocolGuid;
+extern EFI_GUID gHstiResultCacheGuid;
 
 /**
   Concatenate error string.
@@ -197,6 +199,37 @@ CheckSecurePchConfiguration (
   VOID
   );
 
+//
+// Result cache
+//
+
+/**
+  Retrieve HSTI results saved by a previous boot, if the platform state they
+  were evaluated against is unchanged.
+
+  @param[out] HstiSize  - Size of the returned results
+
+  @retval NULL   - No usable results; the tests must be run.
+  @retval Other  - Pointer to the cached results. Caller is responsible to free it.
+**/
+ADAPTER_INFO_PLATFORM_SECURITY *
+LoadHstiResultCache (
+  OUT UINTN                    *HstiSize
+  );
+
+/**
+  Save freshly evaluated HSTI results together with the fingerprint of the
+  platform state they were evaluated against.
+
+  @param[in] Hsti      - Pointer to the results
+  @param[in] HstiSize  - Size of the results
+**/
+VOID
+SaveHstiResultCache (
+  IN ADAPTER_INFO_PLATFORM_SECURITY  *Hsti,
+  IN UINTN                           HstiSize
+  );
+
 //
 // Help function
 //
@@ -158,6 +158,34 @@ GpioDwRegValueFromGpioConfig (
   DwRegsValues[DwNum].PadsToLockTx |= ((GpioConfig->LockConfig >> 0x2) & 0x1) << PadBitPosition;
 }
 
+/**
+  This procedure will write a GPIO register changing only the bits selected by Mask.
+  Register is not accessed if there is nothing to change and it is written
+  without being read first if all of its bits are given.
+
+  @param[in] Address                    Register address
+  @param[in] Mask                       Mask of bits which will change in the register
+  @param[in] Value                      Value of bits selected by Mask
+**/
+STATIC
+VOID
+GpioWriteRegMasked (
+  IN UINTN                     Address,
+  IN UINT32                    Mask,
+  IN UINT32                    Value
+  )
+{
+  if ((Mask | Value) == 0) {
+    return;
+  }
+
+  if (Mask == MAX_UINT32) {
+    MmioWrite32 (Address, Value);
+  } else {
+    MmioAndThenOr32 (Address, ~Mask, Value);
+  }
+}
+
 /**
   This SKL PCH specific procedure will initialize multiple SKL PCH GPIO pins
 
@@ -199,8 +227,7 @@ GpioConfigureSklPch (
   GpioGroupOffset = GpioGetLowestGroup ();
   NumberOfGroups = GpioGetNumberOfGroups ();
 
-  Index = 0;
-  while (Index < NumberOfItems) {
+  for (Index = 0; Index < NumberOfItems; Index++) {
 
     GpioData   = &GpioInitTableAddress[Index];
     Group      = GpioGetGroupFromGpioPad (GpioData->GpioPad);
@@ -228,18 +255,25 @@ GpioConfigureSklPch (
       DEBUG ((DEBUG_ERROR, "GPIO ERROR: Invalid group %d\n", GroupIndex));
       return EFI_INVALID_PARAMETER;
     }
+  }
+
+  //
+  // Program pads group by group. This way ownership, interrupt enable and lock
+  // registers of a group are accessed only once regardless of how pads of that
+  // group are distributed in the table. Pads within a group are still programmed
+  // in table order.
+  //
+  for (GroupIndex = 0; GroupIndex < GpioGroupInfoLength; GroupIndex++) {
 
     ZeroMem (DwRegsValues, sizeof (DwRegsValues));
     //
-    // Loop through pads for one group. If pad belongs to a different group then
-    // break and move to register programming.
+    // Loop through pads for one group and skip pads from other groups.
     //
-    while (Index < NumberOfItems) {
+    for (Index = 0; Index < NumberOfItems; Index++) {
 
       GpioData   = &GpioInitTableAddress[Index];
       if (GroupIndex != GpioGetGroupIndexFromGpioPad (GpioData->GpioPad)) {
-        //if next pad is from different group then break loop
-        break;
+        continue;
       }
 
       PadNumber  = GpioGetPadNumberFromGpioPad (GpioData->GpioPad);
@@ -261,8 +295,6 @@ GpioConfigureSklPch (
         DEBUG ((DEBUG_ERROR, "GPIO ERROR: Accessing pad not owned by host (Group=%d, Pad=%d)!\n", GroupIndex, PadNumber));
         DEBUG ((DEBUG_ERROR, "** Please make sure the GPIO usage in sync between CSME and BIOS configuration. \n"));
         DEBUG ((DEBUG_ERROR, "** All the GPIO occupied by CSME should not do any configuration by BIOS.\n"));
-        //Move to next item
-        Index++;
         continue;
       }
       DEBUG_CODE_END ();
@@ -293,18 +325,18 @@ GpioConfigureSklPch (
       //
       // Write PADCFG DW0 register
       //
-      MmioAndThenOr32 (
+      GpioWriteRegMasked (
         PCH_PCR_ADDRESS (GpioGroupInfo[GroupIndex].Community, PadCfgReg),
-        ~PadCfgDwRegMask[0],
+        PadCfgDwRegMask[0],
         PadCfgDwReg[0]
         );
 
       //
       // Write PADCFG DW1 register
       //
-      MmioAndThenOr32 (
+      GpioWriteRegMasked (
         PCH_PCR_ADDRESS (GpioGroupInfo[GroupIndex].Community, PadCfgReg + 0x4),
-        ~PadCfgDwRegMask[1],
+        PadCfgDwRegMask[1],
         PadCfgDwReg[1]
         );
 
@@ -316,9 +348,6 @@ GpioConfigureSklPch (
         &GpioData->GpioConfig,
         DwRegsValues
         );
-
-      //Move to next item
-      Index++;
     }
 
     for (DwNum = 0; DwNum <= GPIO_GET_DW_NUM (GpioGroupInfo[GroupIndex].PadPerGroup); DwNum++) {
@@ -326,9 +355,9 @@ GpioConfigureSklPch (
       // Write HOSTSW_OWN registers
       //
       if (GpioGroupInfo[GroupIndex].HostOwnOffset != NO_REGISTER_FOR_PROPERTY) {
-        MmioAndThenOr32 (
+        GpioWriteRegMasked (
           PCH_PCR_ADDRESS (GpioGroupInfo[GroupIndex].Community, GpioGroupInfo[GroupIndex].HostOwnOffset + DwNum * 0x4),
-          ~DwRegsValues[DwNum].HostSoftOwnRegMask,
+          DwRegsValues[DwNum].HostSoftOwnRegMask,
           DwRegsValues[DwNum].HostSoftOwnReg
           );
       }
@@ -337,9 +366,9 @@ GpioConfigureSklPch (
       // Write GPI_GPE_EN registers
       //
       if (GpioGroupInfo[GroupIndex].GpiGpeEnOffset != NO_REGISTER_FOR_PROPERTY) {
-        MmioAndThenOr32 (
+        GpioWriteRegMasked (
           PCH_PCR_ADDRESS (GpioGroupInfo[GroupIndex].Community, GpioGroupInfo[GroupIndex].GpiGpeEnOffset + DwNum * 0x4),
-          ~DwRegsValues[DwNum].GpiGpeEnRegMask,
+          DwRegsValues[DwNum].GpiGpeEnRegMask,
           DwRegsValues[DwNum].GpiGpeEnReg
           );
       }
@@ -348,9 +377,9 @@ GpioConfigureSklPch (
       // Write GPI_NMI_EN registers
       //
       if (GpioGroupInfo[GroupIndex].NmiEnOffset != NO_REGISTER_FOR_PROPERTY) {
-        MmioAndThenOr32 (
+        GpioWriteRegMasked (
           PCH_PCR_ADDRESS (GpioGroupInfo[GroupIndex].Community, GpioGroupInfo[GroupIndex].NmiEnOffset + DwNum * 0x4),
-          ~DwRegsValues[DwNum].GpiNmiEnRegMask,
+          DwRegsValues[DwNum].GpiNmiEnRegMask,
           DwRegsValues[DwNum].GpiNmiEnReg
           );
       } else if (DwRegsValues[DwNum].GpiNmiEnReg != 0x0) {
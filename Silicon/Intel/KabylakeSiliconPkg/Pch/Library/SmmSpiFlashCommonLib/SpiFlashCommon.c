@@ -98,7 +98,6 @@ SpiFlashWrite (
 {
   EFI_STATUS                Status;
   UINTN                     Offset;
-  UINT32                    Length;
   UINT32                    RemainingBytes;
 
   ASSERT ((NumBytes != NULL) && (Buffer != NULL));
@@ -115,26 +114,20 @@ SpiFlashWrite (
   Status = EFI_SUCCESS;
   RemainingBytes = *NumBytes;
 
-
-  while (RemainingBytes > 0) {
-    if (RemainingBytes > SECTOR_SIZE_4KB) {
-      Length = SECTOR_SIZE_4KB;
-    } else {
-      Length = RemainingBytes;
-    }
-    Status = mSpiProtocol->FlashWrite (
-                             mSpiProtocol,
-                             FlashRegionBios,
-                             (UINT32) Offset,
-                             Length,
-                             Buffer
-                             );
-    if (EFI_ERROR (Status)) {
-      break;
-    }
-    RemainingBytes -= Length;
-    Offset += Length;
-    Buffer += Length;
+  //
+  // FlashWrite splits the request into hardware sequencing cycles itself,
+  // so issue it at once rather than in 4KB pieces. This avoids repeating the
+  // SMI, BIOS write protection and prefetch setup around every piece.
+  //
+  Status = mSpiProtocol->FlashWrite (
+                           mSpiProtocol,
+                           FlashRegionBios,
+                           (UINT32) Offset,
+                           RemainingBytes,
+                           Buffer
+                           );
+  if (!EFI_ERROR (Status)) {
+    RemainingBytes = 0;
   }
 
   //
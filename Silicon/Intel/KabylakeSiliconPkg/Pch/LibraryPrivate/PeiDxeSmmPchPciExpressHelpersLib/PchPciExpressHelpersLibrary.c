@@ -219,6 +219,45 @@ PcieFindExtendedCapId (
   return 0;
 }
 
+/**
+  Walks the extended capability list of a device once and returns offsets of
+  both L1 Sub-States and LTR extended capabilities, so that power management
+  programming doesn't have to search the list separately for each of them.
+
+  @param[in]  DeviceBase                Device PCI Express Address
+  @param[out] L1SubStateCapOffset       Offset of L1 Sub-States capability, 0 if not found
+  @param[out] LtrCapOffset              Offset of LTR capability, 0 if not found
+**/
+STATIC
+VOID
+PcieFindPmExtendedCapIds (
+  IN  UINTN   DeviceBase,
+  OUT UINT16  *L1SubStateCapOffset,
+  OUT UINT16  *LtrCapOffset
+  )
+{
+  UINT16  CapHeaderOffset;
+  UINT16  CapHeaderId;
+
+  *L1SubStateCapOffset = 0;
+  *LtrCapOffset        = 0;
+
+  CapHeaderId     = 0;
+  CapHeaderOffset = R_PCH_PCIE_EXCAP_OFFSET;
+  while (CapHeaderOffset != 0 && CapHeaderId != MAX_UINT16) {
+    CapHeaderId = MmioRead16 (DeviceBase + CapHeaderOffset);
+    if ((CapHeaderId == V_PCIE_EX_L1S_CID) && (*L1SubStateCapOffset == 0)) {
+      *L1SubStateCapOffset = CapHeaderOffset;
+    } else if ((CapHeaderId == R_PCH_PCIE_LTRECH_CID) && (*LtrCapOffset == 0)) {
+      *LtrCapOffset = CapHeaderOffset;
+    }
+    if ((*L1SubStateCapOffset != 0) && (*LtrCapOffset != 0)) {
+      return;
+    }
+    CapHeaderOffset = (MmioRead16 (DeviceBase + CapHeaderOffset + 2) >> 4) & ((UINT16) ~(BIT0 | BIT1));
+  }
+}
+
 /**
   This returns ClkReq Number from Port Number
 
@@ -985,9 +1024,7 @@ GetLtrOverride (
   This function configures the Latency Tolerance Reporting Settings for endpoint devices
 
   @param[in] RootPortConfig         Rootport PCI Express Configuration
-  @param[in] EndPointBus            Endpoint Bus Number
-  @param[in] EndPointDevice         Endpoint Device Number
-  @param[in] EndPointFunction       Endpoint Function Number
+  @param[in] LtrExtendedCapOffset   Offset of Endpoint LTR Extended Capability, 0 if not present
   @param[in] EndPointBase           Endpoint PCI Express Address
   @param[in] EndPointPcieCapOffset  Pointer to Endpoint PCI Express Capability Structure
   @param[in] DeviceCapabilities2    Endpoint Value of Device Capabilities 2 Register (PciE Cap offset + 0x24)
@@ -999,9 +1036,7 @@ GetLtrOverride (
 VOID
 ConfigureLtr (
   IN CONST PCH_PCIE_ROOT_PORT_CONFIG* RootPortConfig,
-  IN UINT8                            EndPointBus,
-  IN UINT8                            EndPointDevice,
-  IN UINT8                            EndPointFunction,
+  IN UINT16                           LtrExtendedCapOffset,
   IN UINTN                            EndPointBase,
   IN UINT8                            EndPointPcieCapOffset,
   IN UINT32                           DeviceCapabilities2,
@@ -1011,7 +1046,6 @@ ConfigureLtr (
 {
   UINT32 Data32;
   UINT16 Data16;
-  UINT16 LtrExtendedCapOffset;
   UINT16 DefaultMaxLatency;
   DefaultMaxLatency = 0;
   ///
@@ -1031,13 +1065,8 @@ ConfigureLtr (
     MmioOr16 (EndPointBase + EndPointPcieCapOffset + R_PCIE_DCTL2_OFFSET, B_PCIE_DCTL2_LTREN);
   }
   ///
-  /// Get the pointer to the Endpoint PCI Express Extended Capability Structure
-  /// and configure the Max Snoop and Max No-Snoop Latency for the endpoint
+  /// Configure the Max Snoop and Max No-Snoop Latency for the endpoint
   ///
-  LtrExtendedCapOffset = PcieFindExtendedCapId (EndPointBus,
-                           EndPointDevice,
-                           EndPointFunction,
-                           R_PCH_PCIE_LTRECH_CID);
   if (LtrExtendedCapOffset != 0) {
     Data32 = *LtrOverrideVal;
     ///
@@ -1154,6 +1183,8 @@ PcieEndPointPm (
   UINT8       FunctionIndex;
   UINT32      DeviceCapabilities2;
   UINT16      EndPointL1SubStateCapOffset;
+  UINT16      EndPointExtL1SubStateCapOffset;
+  UINT16      EndPointLtrCapOffset;
   UINT32      EndPointL1Substates;
   UINT8       EndPointL1sCommonModeRestoreTime;
   UINT8       EndPointL1sTpowerOnScale;
@@ -1161,7 +1192,6 @@ PcieEndPointPm (
   UINT8       EndPointL1SubStateCapMask;
   PCH_SERIES  PchSeries;
   BOOLEAN     DownstreamPort;
-  UINT16      PcieEndCapOffset;
   UINT16      PcieEndDeviceType;
 
   PchSeries = GetPchSeries ();
@@ -1211,6 +1241,15 @@ PcieEndPointPm (
       EndPointL1sTpowerOnValue          = 0;
       EndPointL1Substates               = 0;
 
+      ///
+      /// Get both extended capabilities needed below with a single walk of the list
+      ///
+      EndPointExtL1SubStateCapOffset    = 0;
+      EndPointLtrCapOffset              = 0;
+      if ((RootL1SubstateExtCapOffset != 0) || (Operation == SetAspm)) {
+        PcieFindPmExtendedCapIds (EndPointBase, &EndPointExtL1SubStateCapOffset, &EndPointLtrCapOffset);
+      }
+
       if (RootL1SubstateExtCapOffset != 0) {
         ///
         /// Get the endpoint supports L1 Substates Capabilities
@@ -1230,12 +1269,7 @@ PcieEndPointPm (
           );
 
         if (EndPointL1SubStateCapOffset == 0) {
-          EndPointL1SubStateCapOffset = PcieFindExtendedCapId (
-                                          EndPointBus,
-                                          DeviceIndex,
-                                          FunctionIndex,
-                                          V_PCIE_EX_L1S_CID
-                                          );
+          EndPointL1SubStateCapOffset = EndPointExtL1SubStateCapOffset;
         }
         if (EndPointL1SubStateCapOffset != 0) {
           EndPointL1Substates   = MmioRead32 (EndPointBase + EndPointL1SubStateCapOffset + R_PCIE_EX_L1SCAP_OFFSET);
@@ -1363,9 +1397,8 @@ PcieEndPointPm (
             // Check if current device is a downstream port
             //
             DownstreamPort = FALSE;
-            PcieEndCapOffset = PcieFindCapId (EndPointBus, DeviceIndex, FunctionIndex, EFI_PCI_CAPABILITY_ID_PCIEXP);
-            if ((MmioRead8 (EndPointBase + R_PCI_BCC_OFFSET) == PCI_CLASS_BRIDGE) && (PcieEndCapOffset != 0)) {
-              PcieEndDeviceType = (MmioRead16 (EndPointBase + PcieEndCapOffset + R_PCIE_XCAP_OFFSET) & B_PCIE_XCAP_DT) >> N_PCIE_XCAP_DT;
+            if (MmioRead8 (EndPointBase + R_PCI_BCC_OFFSET) == PCI_CLASS_BRIDGE) {
+              PcieEndDeviceType = (MmioRead16 (EndPointBase + EndPointPcieCapOffset + R_PCIE_XCAP_OFFSET) & B_PCIE_XCAP_DT) >> N_PCIE_XCAP_DT;
               if (PcieEndDeviceType == 0x06) {
                 DownstreamPort = TRUE;
               }
@@ -1392,9 +1425,7 @@ PcieEndPointPm (
         ///
         ConfigureLtr (
           RootPortConfig,
-          EndPointBus,
-          DeviceIndex,
-          FunctionIndex,
+          EndPointLtrCapOffset,
           EndPointBase,
           EndPointPcieCapOffset,
           DeviceCapabilities2,
@@ -1665,6 +1665,53 @@ Exit:
   return Status;
 }
 
+/**
+  Check the HS400 DLL values programmed in PEI from the platform saved tuning data.
+  The device must already be in HS400 mode. A single read of the tuning blocks
+  is issued; it is the same pass criteria the Rx/Tx tuning uses for each DLL step.
+
+  @param[in] EmmcInfo                    A pointer to EMMC_INFO structure
+  @param[in] BlockIo                     A pointer to EFI_BLOCK_IO_PROTOCOL structure
+
+  @retval EFI_SUCCESS                    Tuning blocks read back without error.
+  @retval EFI_OUT_OF_RESOURCES           The request could not be completed due to a lack of resources.
+  @retval EFI_DEVICE_ERROR               Hardware Error
+  @retval EFI_NO_MEDIA                   No media
+  @retval EFI_MEDIA_CHANGED              Media Change
+  @retval EFI_BAD_BUFFER_SIZE            Buffer size is bad
+  @retval EFI_CRC_ERROR                  Command or Data CRC Error
+**/
+EFI_STATUS
+EmmcHs400DllDataCheck (
+  IN EMMC_INFO                      *EmmcInfo,
+  IN EFI_BLOCK_IO_PROTOCOL          *BlockIo
+  )
+{
+  EFI_STATUS      Status;
+  UINT32          TuningPatternSize;
+  UINT8           *Buffer;
+
+  DEBUG ((DEBUG_INFO, "EmmcHs400DllDataCheck() Start\n"));
+
+  TuningPatternSize = BlockIo->Media->BlockSize * EMMC_HS400_TUNING_PATTERN_BLOCKS_NUMBER;
+  Buffer = (VOID *) AllocateZeroPool (TuningPatternSize);
+  if (Buffer == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = BlockIo->ReadBlocks (
+                      BlockIo,
+                      BlockIo->Media->MediaId,
+                      EmmcInfo->Lba,
+                      TuningPatternSize,
+                      Buffer
+                      );
+
+  FreePool (Buffer);
+  DEBUG ((DEBUG_INFO, "EmmcHs400DllDataCheck() End, Status = %r\n", Status));
+  return Status;
+}
+
 /**
   Configure eMMC in HS400 Mode
 
@@ -1698,6 +1745,7 @@ ConfigureEmmcHs400Mode (
   UINTN                         EmmcBaseAddress;
   UINTN                         EmmcPciBaseAddress;
   ModeStatus =  EFI_SUCCESS;
+  BlockIo    =  NULL;
 
   DEBUG ((DEBUG_INFO, "ConfigureEmmcHs400Mode() Start\n"));
   EmmcTuningData->Hs400DataValid = FALSE;
@@ -1737,28 +1785,48 @@ ConfigureEmmcHs400Mode (
   DEBUG ((DEBUG_INFO, "Tx Data Delay Control 1 (824h) = 0x%08x\n", MmioRead32 (EmmcBaseAddress + R_PCH_SCS_DEV_MEM_TX_DATA_DLL_CNTL1)));
   DEBUG ((DEBUG_INFO, "Rx Strobe Delay Control (830h) = 0x%08x\n", MmioRead32 (EmmcBaseAddress + R_PCH_SCS_DEV_MEM_RX_STROBE_DLL_CNTL)));
 
+  //
+  // Handle Platform Emmc Info Protocol for Efi Block Io Protocol
+  //
+  Status = gBS->HandleProtocol (
+                  EmmcInfo->PartitionHandle,
+                  &gEfiBlockIoProtocolGuid,
+                  (VOID**) &BlockIo
+                  );
+
   if (mPchConfigHob->Scs.ScsEmmcHs400TuningRequired == FALSE) {
     if (mPchConfigHob->Scs.ScsEmmcHs400DllDataValid == TRUE) {
       DEBUG ((DEBUG_INFO, "ConfigureEmmcHs400Mode: SCS eMMC 5.0 HS400 Tuning Not Required, set device to HS400 mode\n"));
       Status = EmmcModeSelection (EmmcInfo, EmmcBaseAddress, Hs400);
       if (EFI_ERROR (Status)) {
         DEBUG ((DEBUG_ERROR, "ConfigureEmmcHs400Mode: eMMC HS400 Mode Selection Failed!\n"));
+        return Status;
+      }
+      //
+      // The saved DLL values belong to whichever part was tuned last. Validate them with
+      // one read of the tuning blocks and only fall back to the full Rx/Tx tuning
+      // sequence when that read fails, e.g. after the eMMC device was replaced.
+      //
+      if (BlockIo == NULL) {
+        return EFI_SUCCESS;
+      }
+      Status = EmmcHs400DllDataCheck (EmmcInfo, BlockIo);
+      if (!EFI_ERROR (Status)) {
+        return Status;
+      }
+      DEBUG ((DEBUG_WARN, "ConfigureEmmcHs400Mode: Saved HS400 DLL Data Check Failed (%r), Re-tuning\n", Status));
+      Status = EmmcModeSelection (EmmcInfo, EmmcBaseAddress, Hs200);
+      if (EFI_ERROR (Status)) {
+        DEBUG ((DEBUG_ERROR, "ConfigureEmmcHs400Mode: eMMC HS200 Mode Selection Failed!\n"));
+        return Status;
       }
-      return Status;
     } else {
       DEBUG ((DEBUG_INFO, "ConfigureEmmcHs400Mode: SCS eMMC 5.0 HS400 Mode Selection Not Required.\n"));
       return EFI_ABORTED;
     }
   }
-  //
-  // Handle Platform Emmc Info Protocol for Efi Block Io Protocol
-  //
-  Status = gBS->HandleProtocol (
-                  EmmcInfo->PartitionHandle,
-                  &gEfiBlockIoProtocolGuid,
-                  (VOID**) &BlockIo
-                  );
-  if (EFI_ERROR (Status)) {
+
+  if (BlockIo == NULL) {
     DEBUG ((DEBUG_ERROR, "ConfigureEmmcHs400Mode: BlockIo: Platform Emmc Info Protocol Handle Not Found!\n"));
     EmmcHostHs400Disabled (EmmcBaseAddress);
     return Status;
@@ -921,6 +921,17 @@ PchSmiRecordInsert (
   OUT EFI_HANDLE                        *DispatchHandle
   );
 
+/**
+  Add the top level PMC SMI_STS bit of a record to the summary the dispatcher
+  uses to skip SMIs that none of the registered sources can claim.
+
+  @param[in] Record                     Record inserted into the callback database.
+**/
+VOID
+PchSmmIndexRecord (
+  IN DATABASE_RECORD                    *Record
+  );
+
 extern PCH_SMM_SOURCE_DESC mSrcDescSerialIrq;
 
 /**
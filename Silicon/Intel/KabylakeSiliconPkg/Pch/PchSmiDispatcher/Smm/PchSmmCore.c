@@ -20,6 +20,13 @@ GLOBAL_REMOVE_IF_UNREFERENCED UINT16                mAcpiBaseAddr;
 GLOBAL_REMOVE_IF_UNREFERENCED UINT16                mTcoBaseAddr;
 GLOBAL_REMOVE_IF_UNREFERENCED BOOLEAN               mReadyToLock;
 
+//
+// Top level PMC SMI_STS bits of the records in the callback database, see
+// PchSmmIndexRecord ().
+//
+GLOBAL_REMOVE_IF_UNREFERENCED UINT32                mSmiStsRecordMask;
+GLOBAL_REMOVE_IF_UNREFERENCED BOOLEAN               mSmiStsRecordUnindexed;
+
 GLOBAL_REMOVE_IF_UNREFERENCED PRIVATE_DATA          mPrivateData = {
   {
     NULL,
@@ -551,6 +558,7 @@ PchSmmCoreRegister (
   /// After ensuring the source of event is not null, we will insert the record into the database
   ///
   InsertTailList (&mPrivateData.CallbackDataBase, &Record->Link);
+  PchSmmIndexRecord (Record);
 
   if (Record->ClearSource == NULL) {
     ///
@@ -733,6 +741,38 @@ ClearPendingSmiStatus (
   }
 }
 
+/**
+  Add the top level PMC SMI_STS bit of a record to the summary the dispatcher
+  uses to skip SMIs that none of the registered sources can claim.
+
+  A record that is not gated by a PMC SMI_STS bit makes the dispatcher walk the
+  database on every SMI. Bits are never removed on unregister, the summary is
+  a superset of the registered sources.
+
+  @param[in] Record                     Record inserted into the callback database.
+**/
+VOID
+PchSmmIndexRecord (
+  IN DATABASE_RECORD                    *Record
+  )
+{
+  CONST PCH_SMM_BIT_DESC                *TopLevel;
+
+  TopLevel = &Record->SrcDesc.PmcSmiSts;
+  if (IS_BIT_DESC_NULL (*TopLevel)) {
+    TopLevel = &Record->SrcDesc.Sts[0];
+  }
+
+  if (!IS_BIT_DESC_NULL (*TopLevel) &&
+      (TopLevel->Reg.Type == ACPI_ADDR_TYPE) &&
+      (TopLevel->Reg.Data.acpi == R_PCH_SMI_STS) &&
+      (TopLevel->Bit < 32)) {
+    mSmiStsRecordMask |= (1u << TopLevel->Bit);
+  } else {
+    mSmiStsRecordUnindexed = TRUE;
+  }
+}
+
 /**
   The callback function to handle subsequent SMIs.  This callback will be called by SmmCoreDispatcher.
 
@@ -815,6 +855,16 @@ PchSmmCoreDispatcher (
       SmiEnValue  = IoRead32 ((UINTN) (mAcpiBaseAddr + R_PCH_SMI_EN));
       SmiStsValue = IoRead32 ((UINTN) (mAcpiBaseAddr + R_PCH_SMI_STS));
 
+      ///
+      /// None of the registered sources has its top level SMI_STS bit set,
+      /// so no record can claim this SMI. Skip the database walk.
+      ///
+      if (!mSmiStsRecordUnindexed && ((SmiStsValue & mSmiStsRecordMask) == 0)) {
+        ClearPendingSmiStatus (SmiStsValue);
+        EosSet = PchSmmSetAndCheckEos ();
+        continue;
+      }
+
       while (!IsNull (&mPrivateData.CallbackDataBase, LinkInDb)) {
         RecordInDb = DATABASE_RECORD_FROM_LINK (LinkInDb);
 
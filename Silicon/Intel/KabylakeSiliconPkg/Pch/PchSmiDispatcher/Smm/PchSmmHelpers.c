@@ -185,9 +185,13 @@ SourceIsActive (
   for (DescIndex = 0; DescIndex < NUM_EN_BITS; DescIndex++) {
     if (!IS_BIT_DESC_NULL (Src->En[DescIndex])) {
       if ((Src->En[DescIndex].Reg.Type == ACPI_ADDR_TYPE) &&
-          (Src->En[DescIndex].Reg.Data.acpi == R_PCH_SMI_EN) &&
-          ((SmiEnValue & (1u << Src->En[DescIndex].Bit)) == 0)) {
-        return FALSE;
+          (Src->En[DescIndex].Reg.Data.acpi == R_PCH_SMI_EN)) {
+        ///
+        /// Resolved from the value cached by the dispatcher, no need to read it again.
+        ///
+        if ((SmiEnValue & (1u << Src->En[DescIndex].Bit)) == 0) {
+          return FALSE;
+        }
       } else if (ReadBitDesc (&Src->En[DescIndex]) == 0) {
         return FALSE;
       }
@@ -200,9 +204,13 @@ SourceIsActive (
   for (DescIndex = 0; DescIndex < NUM_STS_BITS; DescIndex++) {
     if (!IS_BIT_DESC_NULL (Src->Sts[DescIndex])) {
       if ((Src->Sts[DescIndex].Reg.Type == ACPI_ADDR_TYPE) &&
-          (Src->Sts[DescIndex].Reg.Data.acpi == R_PCH_SMI_STS) &&
-          ((SmiStsValue & (1u << Src->Sts[DescIndex].Bit)) == 0)) {
-        return FALSE;
+          (Src->Sts[DescIndex].Reg.Data.acpi == R_PCH_SMI_STS)) {
+        ///
+        /// Resolved from the value cached by the dispatcher, no need to read it again.
+        ///
+        if ((SmiStsValue & (1u << Src->Sts[DescIndex].Bit)) == 0) {
+          return FALSE;
+        }
       } else if (ReadBitDesc (&Src->Sts[DescIndex]) == 0) {
         return FALSE;
       }
@@ -1890,6 +1890,132 @@ MtrrSetMemoryAttributeInMtrrSettings (
            );
 }
 
+/**
+  This function attempts to set the attributes into MTRR setting buffer for multiple memory ranges.
+
+  If MtrrSetting is NULL, the ranges are applied to a shadow copy of the MTRRs
+  first. Only the MTRRs whose value changed are then written, all within one
+  cache disable and flush window, instead of one window per range.
+
+  @param[in, out]  MtrrSetting  MTRR setting buffer to be set, or NULL to set the MTRRs.
+  @param[in]       Scratch      A temporary scratch buffer. Not used by this implementation.
+  @param[in, out]  ScratchSize  Size of the scratch buffer. Not used by this implementation.
+  @param[in]       Ranges       Pointer to an array of MTRR_MEMORY_RANGE.
+                                When range overlap happens, the last one takes higher priority.
+  @param[in]       RangeCount   Count of MTRR_MEMORY_RANGE.
+
+  @retval RETURN_SUCCESS            The attributes were set for all the memory ranges.
+  @retval RETURN_INVALID_PARAMETER  Length in any range is zero.
+  @retval RETURN_UNSUPPORTED        The processor does not support one or more bytes of the
+                                    memory resource range specified by BaseAddress and Length in any range.
+  @retval RETURN_UNSUPPORTED        The bit mask of attributes is not support for the memory resource
+                                    range specified by BaseAddress and Length in any range.
+  @retval RETURN_OUT_OF_RESOURCES   There are not enough system resources to modify the attributes of
+                                    the memory resource ranges.
+                                    When an error is returned the MTRRs are not modified.
+
+**/
+RETURN_STATUS
+EFIAPI
+MtrrSetMemoryAttributesInMtrrSettings (
+  IN OUT MTRR_SETTINGS           *MtrrSetting,
+  IN     VOID                    *Scratch,
+  IN OUT UINTN                   *ScratchSize,
+  IN     CONST MTRR_MEMORY_RANGE *Ranges,
+  IN     UINTN                   RangeCount
+  )
+{
+  RETURN_STATUS             Status;
+  MTRR_SETTINGS             OriginalSettings;
+  MTRR_SETTINGS             WorkingSettings;
+  MTRR_CONTEXT              MtrrContext;
+  BOOLEAN                   MtrrContextValid;
+  UINT32                    VariableMtrrCount;
+  UINTN                     Index;
+
+  if (!IsMtrrSupported ()) {
+    return RETURN_UNSUPPORTED;
+  }
+
+  if (MtrrSetting != NULL) {
+    for (Index = 0; Index < RangeCount; Index++) {
+      Status = MtrrSetMemoryAttributeInMtrrSettings (
+                 MtrrSetting,
+                 Ranges[Index].BaseAddress,
+                 Ranges[Index].Length,
+                 Ranges[Index].Type
+                 );
+      if (RETURN_ERROR (Status)) {
+        return Status;
+      }
+    }
+    return RETURN_SUCCESS;
+  }
+
+  //
+  // Every MTRR access is a message bus access, so read all of them once
+  // and compute the final settings against the shadow copy.
+  //
+  ZeroMem (&OriginalSettings, sizeof (OriginalSettings));
+  MtrrGetAllMtrrs (&OriginalSettings);
+  CopyMem (&WorkingSettings, &OriginalSettings, sizeof (WorkingSettings));
+  for (Index = 0; Index < RangeCount; Index++) {
+    DEBUG((DEBUG_CACHE, "MtrrSetMemoryAttributes() %a:%016lx-%016lx\n", mMtrrMemoryCacheTypeShortName[Ranges[Index].Type], Ranges[Index].BaseAddress, Ranges[Index].Length));
+    Status = MtrrSetMemoryAttributeWorker (
+               &WorkingSettings,
+               Ranges[Index].BaseAddress,
+               Ranges[Index].Length,
+               Ranges[Index].Type
+               );
+    if (RETURN_ERROR (Status)) {
+      return Status;
+    }
+  }
+
+  //
+  // Write only the MTRRs that have been modified
+  //
+  MtrrContextValid = FALSE;
+  for (Index = 0; Index < MTRR_NUMBER_OF_FIXED_MTRR; Index++) {
+    if (WorkingSettings.Fixed.Mtrr[Index] != OriginalSettings.Fixed.Mtrr[Index]) {
+      if (!MtrrContextValid) {
+        PreMtrrChange (&MtrrContext);
+        MtrrContextValid = TRUE;
+      }
+      MtrrRegisterWrite (
+        mMtrrLibFixedMtrrTable[Index].Msr,
+        WorkingSettings.Fixed.Mtrr[Index]
+        );
+    }
+  }
+
+  VariableMtrrCount = GetVariableMtrrCountWorker ();
+  for (Index = 0; Index < VariableMtrrCount; Index++) {
+    if (WorkingSettings.Variables.Mtrr[Index].Base != OriginalSettings.Variables.Mtrr[Index].Base ||
+        WorkingSettings.Variables.Mtrr[Index].Mask != OriginalSettings.Variables.Mtrr[Index].Mask    ) {
+      if (!MtrrContextValid) {
+        PreMtrrChange (&MtrrContext);
+        MtrrContextValid = TRUE;
+      }
+      MtrrRegisterWrite (
+        QUARK_NC_HOST_BRIDGE_IA32_MTRR_PHYSBASE0 + (UINT32)(Index << 1),
+        WorkingSettings.Variables.Mtrr[Index].Base
+        );
+      MtrrRegisterWrite (
+        QUARK_NC_HOST_BRIDGE_IA32_MTRR_PHYSBASE0 + (UINT32)(Index << 1) + 1,
+        WorkingSettings.Variables.Mtrr[Index].Mask
+        );
+    }
+  }
+  if (MtrrContextValid) {
+    PostMtrrChange (&MtrrContext);
+  }
+
+  MtrrDebugPrintAllMtrrsWorker (NULL);
+
+  return RETURN_SUCCESS;
+}
+
 /**
   Worker function setting variable MTRRs
 
@@ -2368,6 +2368,50 @@ static void memory_test(
   LEAVEFN();
 }
 
+// Verify timings restored on fast boot with a quick HTE check of one
+// cache line per enabled rank (basic write/read and victim-aggressor
+// patterns) instead of the training sweeps and full memory test.
+// On failure boot mode is switched to bmCold, so that the remaining
+// steps perform full training.
+static void verify_timings(
+  MRCParams_t *mrc_params)
+{
+  uint8_t channel_i; // channel counter
+  uint8_t rank_i; // rank counter
+  uint32_t address; // target address for HTE checks
+  uint32_t result = 0;
+
+  ENTERFN();
+
+  for (channel_i = 0; channel_i < NUM_CHANNELS; channel_i++)
+  {
+    if (mrc_params->channel_enables & (1 << channel_i))
+    {
+      for (rank_i = 0; rank_i < NUM_RANKS; rank_i++)
+      {
+        if (mrc_params->rank_enables & (1 << rank_i))
+        {
+          address = get_addr(mrc_params, channel_i, rank_i);
+
+          mrc_params->hte_setup = 1;
+          result |= check_rw_coarse(mrc_params, address);
+          mrc_params->hte_setup = 1;
+          result |= check_bls_ex(mrc_params, address);
+        }
+      }
+    }
+  }
+  select_memory_manager(mrc_params);
+
+  DPF(D_INFO, "Timings verification result %x\n", result);
+  if (result & 0xFF)
+  {
+    // restored values do not work anymore, train again
+    mrc_params->boot_mode = bmCold;
+  }
+  LEAVEFN();
+}
+
 
 // Force same timings as with backup settings
 static void static_timings(
@@ -2415,22 +2459,23 @@ void MemInit(
     { 0x0400, bmCold|bmFast            , perform_jedec_init       }, //5  perform JEDEC initialisation of DRAMs
     { 0x0105, bmCold|bmFast            , set_ddr_init_complete    }, //6
     { 0x0106,        bmFast|bmWarm|bmS3, restore_timings          }, //7
-    { 0x0106, bmCold                   , default_timings          }, //8
-    { 0x0500, bmCold                   , rcvn_cal                 }, //9  perform RCVN_CAL algorithm
-    { 0x0600, bmCold                   , wr_level                 }, //10  perform WR_LEVEL algorithm
-    { 0x0120, bmCold                   , prog_page_ctrl           }, //11
-    { 0x0700, bmCold                   , rd_train                 }, //12  perform RD_TRAIN algorithm
-    { 0x0800, bmCold                   , wr_train                 }, //13  perform WR_TRAIN algorithm
-    { 0x010B, bmCold                   , store_timings            }, //14
-    { 0x010C, bmCold|bmFast|bmWarm|bmS3, enable_scrambling        }, //15
-    { 0x010D, bmCold|bmFast|bmWarm|bmS3, prog_ddr_control         }, //16
-    { 0x010E, bmCold|bmFast|bmWarm|bmS3, prog_dra_drb             }, //17
-    { 0x010F,               bmWarm|bmS3, perform_wake             }, //18
-    { 0x0110, bmCold|bmFast|bmWarm|bmS3, change_refresh_period    }, //19
-    { 0x0111, bmCold|bmFast|bmWarm|bmS3, set_auto_refresh         }, //20
-    { 0x0112, bmCold|bmFast|bmWarm|bmS3, ecc_enable               }, //21
-    { 0x0113, bmCold|bmFast            , memory_test              }, //22
-    { 0x0114, bmCold|bmFast|bmWarm|bmS3, lock_registers           }  //23 set init done
+    { 0x0107,        bmFast            , verify_timings           }, //8  may fall back to bmCold
+    { 0x0106, bmCold                   , default_timings          }, //9
+    { 0x0500, bmCold                   , rcvn_cal                 }, //10  perform RCVN_CAL algorithm
+    { 0x0600, bmCold                   , wr_level                 }, //11  perform WR_LEVEL algorithm
+    { 0x0120, bmCold                   , prog_page_ctrl           }, //12
+    { 0x0700, bmCold                   , rd_train                 }, //13  perform RD_TRAIN algorithm
+    { 0x0800, bmCold                   , wr_train                 }, //14  perform WR_TRAIN algorithm
+    { 0x010B, bmCold                   , store_timings            }, //15
+    { 0x010C, bmCold|bmFast|bmWarm|bmS3, enable_scrambling        }, //16
+    { 0x010D, bmCold|bmFast|bmWarm|bmS3, prog_ddr_control         }, //17
+    { 0x010E, bmCold|bmFast|bmWarm|bmS3, prog_dra_drb             }, //18
+    { 0x010F,               bmWarm|bmS3, perform_wake             }, //19
+    { 0x0110, bmCold|bmFast|bmWarm|bmS3, change_refresh_period    }, //20
+    { 0x0111, bmCold|bmFast|bmWarm|bmS3, set_auto_refresh         }, //21
+    { 0x0112, bmCold|bmFast|bmWarm|bmS3, ecc_enable               }, //22
+    { 0x0113, bmCold                   , memory_test              }, //23
+    { 0x0114, bmCold|bmFast|bmWarm|bmS3, lock_registers           }  //24 set init done
   };
 
   uint32_t i;
@@ -2456,7 +2501,7 @@ void MemInit(
     uint64_t my_tsc;
 
 #ifdef MRC_SV
-    if (mrc_params->menu_after_mrc && i > 14)
+    if (mrc_params->menu_after_mrc && i > 15)
     {
       uint8_t ch;
 
@@ -40,6 +40,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/DevicePathLib.h>
 #include <Library/S3IoLib.h>
 #include <Library/QNCAccessLib.h>
+#include <Library/SmiHandlerLatencyLib.h>
 
 #include <Uefi/UefiBaseType.h>
 #endif
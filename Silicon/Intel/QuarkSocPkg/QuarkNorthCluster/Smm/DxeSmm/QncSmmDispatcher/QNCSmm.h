@@ -183,6 +183,34 @@ typedef struct {
 //
 // 31 bytes, I think
 //
+
+//
+// The ACPI and GPE registers the registered sources take their enable and
+// status bits from. Each register is listed once, no matter how many sources
+// use it, and is read once per dispatcher pass into Value.
+//
+#define QNC_SMM_MAX_SNAPSHOT_REGS     16
+#define QNC_SMM_NO_SNAPSHOT           0xFF
+
+typedef struct {
+  ADDR_TYPE             Type;
+  UINT8                 SizeInBytes;
+  UINT16                Offset;
+  UINT32                Value;
+} QNC_SMM_REG_SNAPSHOT;
+
+//
+// Precomputed test of a source against the snapshot: each Index names a
+// snapshot register and Mask holds all the bits of the source in it, which
+// must all be set. ReadLive is set when some bits are not in a snapshot
+// register and have to be read from hardware.
+//
+typedef struct {
+  UINT8                 Count;
+  BOOLEAN               ReadLive;
+  UINT8                 Index[NUM_EN_BITS + NUM_STS_BITS];
+  UINT32                Mask[NUM_EN_BITS + NUM_STS_BITS];
+} QNC_SMM_SOURCE_CHECK;
 #define NULL_SOURCE_DESC_INITIALIZER \
   { \
     QNC_SMM_NO_FLAGS, \
@@ -387,6 +415,7 @@ struct _DATABASE_RECORD {
   // Status and Enable bit description
   //
   QNC_SMM_SOURCE_DESC   SrcDesc;
+  QNC_SMM_SOURCE_CHECK  SrcCheck;
 
   //
   // Callback function
@@ -463,6 +463,8 @@ Returns:
     break;
   };
 
+  QNCSmmIndexSource (&Record->SrcDesc, &Record->SrcCheck);
+
   if (Record->ClearSource == NULL) {
     //
     // Clear the SMI associated w/ the source using the default function
@@ -597,6 +599,7 @@ QNCSmmCoreDispatcher (
 
   EFI_STATUS          Status;
   UINT32              NewValue;
+  UINT64              LatencyStart;
 
   QNC_SMM_SOURCE_DESC ActiveSource = NULL_SOURCE_DESC_INITIALIZER;
 
@@ -635,6 +638,11 @@ QNCSmmCoreDispatcher (
       //
       ResetListSearch = FALSE;
 
+      //
+      // Read the status and enable registers once for the whole pass
+      //
+      QNCSmmTakeSnapshot ();
+
       LinkInDb = GetFirstNode (&mPrivateData.CallbackDataBase);
 
       while ((!IsNull (&mPrivateData.CallbackDataBase, LinkInDb)) && (ResetListSearch == FALSE)) {
@@ -649,7 +657,7 @@ QNCSmmCoreDispatcher (
         //
         // look for the first active source
         //
-        if (!SourceIsActive (&RecordInDb->SrcDesc)) {
+        if (!SourceIsActive (&RecordInDb->SrcDesc, &RecordInDb->SrcCheck)) {
           //
           // Didn't find the source yet, keep looking
           //
@@ -731,12 +739,14 @@ QNCSmmCoreDispatcher (
 
                 ASSERT (RecordToExhaust->Callback != NULL);
 
+                LatencyStart = SmiHandlerLatencyStart ();
                 RecordToExhaust->Callback (
                                    (EFI_HANDLE) & RecordToExhaust->Link,
                                    RecordToExhaust->CallbackContext,
                                    CommunicationBuffer,
                                    &BufferSize
                                    );
+                SmiHandlerLatencyStop ((VOID *) (UINTN) RecordToExhaust->Callback, LatencyStart);
 
                 ChildWasDispatched = TRUE;
                 if (RecordToExhaust->ProtocolType == SxType) {
@@ -142,83 +142,249 @@ Returns:
   return (BOOLEAN) (CompareEnables (Src1, Src2) && CompareStatuses (Src1, Src2));
 }
 
-BOOLEAN
-SourceIsActive (
-  CONST IN QNC_SMM_SOURCE_DESC *Src
+//
+// Registers listed by QNCSmmIndexSource (), and the SCI_EN value read with them.
+//
+STATIC QNC_SMM_REG_SNAPSHOT  mSnapshot[QNC_SMM_MAX_SNAPSHOT_REGS];
+STATIC UINTN                 mSnapshotCount = 0;
+STATIC BOOLEAN               mSnapshotSciEn = FALSE;
+
+UINT8
+QNCSmmFindSnapshotRegister (
+  CONST IN QNC_SMM_BIT_DESC *BitDesc
   )
 /*++
 
 Routine Description:
 
-  GC_TODO: Add function description
+  Find the snapshot register that holds a bit, adding it to the list if it is
+  not there yet.
 
 Arguments:
 
-  Src - GC_TODO: add argument description
+  BitDesc - The bit description to find the register of.
 
 Returns:
 
-  GC_TODO: add return values
+  The index of the register in the snapshot list, or QNC_SMM_NO_SNAPSHOT if
+  the bit has to be read from hardware.
 
 --*/
 {
-  BOOLEAN IsActive;
-  UINTN   loopvar;
+  UINT16  Offset;
+  UINTN   Index;
 
-  BOOLEAN SciEn;
+  if (BitDesc->Reg.Type == ACPI_ADDR_TYPE) {
+    Offset = (UINT16) BitDesc->Reg.Data.acpi;
+  } else if (BitDesc->Reg.Type == GPE_ADDR_TYPE) {
+    Offset = (UINT16) BitDesc->Reg.Data.gpe;
+  } else {
+    return QNC_SMM_NO_SNAPSHOT;
+  }
 
-  IsActive  = TRUE;
+  if ((BitDesc->SizeInBytes != 1) && (BitDesc->SizeInBytes != 2) && (BitDesc->SizeInBytes != 4)) {
+    return QNC_SMM_NO_SNAPSHOT;
+  }
 
-  SciEn     = QNCSmmGetSciEn ();
+  for (Index = 0; Index < mSnapshotCount; Index++) {
+    if ((mSnapshot[Index].Type == BitDesc->Reg.Type) &&
+        (mSnapshot[Index].Offset == Offset) &&
+        (mSnapshot[Index].SizeInBytes == BitDesc->SizeInBytes)) {
+      return (UINT8) Index;
+    }
+  }
 
-  if ((Src->Flags & QNC_SMM_SCI_EN_DEPENDENT) && (SciEn)) {
-    //
-    // This source is dependent on SciEn, and SciEn == 1.  An ACPI OS is present,
-    // so we shouldn't do anything w/ this source until SciEn == 0.
-    //
-    IsActive = FALSE;
+  if (mSnapshotCount == QNC_SMM_MAX_SNAPSHOT_REGS) {
+    return QNC_SMM_NO_SNAPSHOT;
+  }
+
+  mSnapshot[mSnapshotCount].Type        = BitDesc->Reg.Type;
+  mSnapshot[mSnapshotCount].SizeInBytes = BitDesc->SizeInBytes;
+  mSnapshot[mSnapshotCount].Offset      = Offset;
+  mSnapshot[mSnapshotCount].Value       = 0;
+  mSnapshotCount++;
+
+  return (UINT8) (mSnapshotCount - 1);
+}
+
+VOID
+QNCSmmIndexSource (
+  CONST IN QNC_SMM_SOURCE_DESC  *Src,
+  OUT      QNC_SMM_SOURCE_CHECK *Check
+  )
+/*++
+
+Routine Description:
+
+  Add the registers of a source to the snapshot list and precompute the
+  test SourceIsActive () does against the snapshot.
+
+Arguments:
+
+  Src   - The source description of a record being registered.
+  Check - Receives the precomputed test of the source.
+
+Returns:
+
+  None
+
+--*/
+{
+  CONST QNC_SMM_BIT_DESC  *BitDesc;
+  UINTN                   loopvar;
+  UINTN                   CheckIndex;
+  UINT8                   RegIndex;
+
+  ZeroMem (Check, sizeof (QNC_SMM_SOURCE_CHECK));
+
+  for (loopvar = 0; loopvar < NUM_EN_BITS + NUM_STS_BITS; loopvar++) {
+    if (loopvar < NUM_EN_BITS) {
+      BitDesc = &Src->En[loopvar];
+    } else {
+      BitDesc = &Src->Sts[loopvar - NUM_EN_BITS];
+    }
+
+    if (IS_BIT_DESC_NULL (*BitDesc)) {
+      continue;
+    }
+
+    RegIndex = QNCSmmFindSnapshotRegister (BitDesc);
+    if (RegIndex == QNC_SMM_NO_SNAPSHOT) {
+      Check->ReadLive = TRUE;
+      continue;
+    }
 
-  } else {
     //
-    // Read each bit desc from hardware and make sure it's a one
+    // Bits of the source that share a register are tested with one mask
     //
-    for (loopvar = 0; loopvar < NUM_EN_BITS; loopvar++) {
+    for (CheckIndex = 0; CheckIndex < Check->Count; CheckIndex++) {
+      if (Check->Index[CheckIndex] == RegIndex) {
+        break;
+      }
+    }
+    if (CheckIndex == Check->Count) {
+      Check->Index[CheckIndex] = RegIndex;
+      Check->Mask[CheckIndex]  = 0;
+      Check->Count++;
+    }
+    Check->Mask[CheckIndex] |= (UINT32) LShiftU64 (BIT_ZERO, BitDesc->Bit);
+  }
+}
 
-      if (!IS_BIT_DESC_NULL (Src->En[loopvar])) {
+VOID
+QNCSmmTakeSnapshot (
+  VOID
+  )
+/*++
 
-        if (ReadBitDesc (&Src->En[loopvar]) == 0) {
-          IsActive = FALSE;
-          break;
-          //
-          // out of for loop
-          //
-        }
+Routine Description:
 
-      }
+  Read SCI_EN and every register in the snapshot list once.
+
+Arguments:
+
+  None
+
+Returns:
+
+  None
+
+--*/
+{
+  UINT16  AcpiBase;
+  UINT16  GpeBase;
+  UINT16  Port;
+  UINTN   Index;
+
+  mSnapshotSciEn = QNCSmmGetSciEn ();
+
+  AcpiBase = PcdGet16 (PcdPm1blkIoBaseAddress);
+  GpeBase  = (UINT16)(LpcPciCfg32 (R_QNC_LPC_GPE0BLK) & 0xFFFF);
+
+  for (Index = 0; Index < mSnapshotCount; Index++) {
+    if (mSnapshot[Index].Type == ACPI_ADDR_TYPE) {
+      Port = AcpiBase + mSnapshot[Index].Offset;
+    } else {
+      Port = GpeBase + mSnapshot[Index].Offset;
     }
 
-    if (IsActive) {
-      //
-      // Read each bit desc from hardware and make sure it's a one
-      //
-      for (loopvar = 0; loopvar < NUM_STS_BITS; loopvar++) {
+    switch (mSnapshot[Index].SizeInBytes) {
+    case 1:
+      mSnapshot[Index].Value = IoRead8 (Port);
+      break;
+    case 2:
+      mSnapshot[Index].Value = IoRead16 (Port);
+      break;
+    default:
+      mSnapshot[Index].Value = IoRead32 (Port);
+      break;
+    }
+  }
+}
 
-        if (!IS_BIT_DESC_NULL (Src->Sts[loopvar])) {
+BOOLEAN
+SourceIsActive (
+  CONST IN QNC_SMM_SOURCE_DESC  *Src,
+  CONST IN QNC_SMM_SOURCE_CHECK *Check
+  )
+/*++
+
+Routine Description:
 
-          if (ReadBitDesc (&Src->Sts[loopvar]) == 0) {
-            IsActive = FALSE;
-            break;
-            //
-            // out of for loop
-            //
-          }
+  Check whether all the enable and status bits of a source are set, using
+  the values read by the last QNCSmmTakeSnapshot ().
 
-        }
-      }
+Arguments:
+
+  Src   - The source description to check.
+  Check - The precomputed test of the source from QNCSmmIndexSource ().
+
+Returns:
+
+  TRUE if the source is active.
+
+--*/
+{
+  UINTN   loopvar;
+
+  if ((Src->Flags & QNC_SMM_SCI_EN_DEPENDENT) && (mSnapshotSciEn)) {
+    //
+    // This source is dependent on SciEn, and SciEn == 1.  An ACPI OS is present,
+    // so we shouldn't do anything w/ this source until SciEn == 0.
+    //
+    return FALSE;
+  }
+
+  for (loopvar = 0; loopvar < Check->Count; loopvar++) {
+    if ((mSnapshot[Check->Index[loopvar]].Value & Check->Mask[loopvar]) != Check->Mask[loopvar]) {
+      return FALSE;
+    }
+  }
+
+  if (!Check->ReadLive) {
+    return TRUE;
+  }
+
+  //
+  // Read the bits that are not in the snapshot from hardware
+  //
+  for (loopvar = 0; loopvar < NUM_EN_BITS; loopvar++) {
+    if (!IS_BIT_DESC_NULL (Src->En[loopvar]) &&
+        (QNCSmmFindSnapshotRegister (&Src->En[loopvar]) == QNC_SMM_NO_SNAPSHOT) &&
+        (ReadBitDesc (&Src->En[loopvar]) == 0)) {
+      return FALSE;
+    }
+  }
+
+  for (loopvar = 0; loopvar < NUM_STS_BITS; loopvar++) {
+    if (!IS_BIT_DESC_NULL (Src->Sts[loopvar]) &&
+        (QNCSmmFindSnapshotRegister (&Src->Sts[loopvar]) == QNC_SMM_NO_SNAPSHOT) &&
+        (ReadBitDesc (&Src->Sts[loopvar]) == 0)) {
+      return FALSE;
     }
   }
 
-  return IsActive;
+  return TRUE;
 }
 
 VOID
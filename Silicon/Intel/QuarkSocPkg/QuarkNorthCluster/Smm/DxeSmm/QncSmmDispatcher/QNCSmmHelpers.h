@@ -111,23 +111,71 @@ Returns:
 --*/
 ;
 
+VOID
+QNCSmmIndexSource (
+  CONST IN QNC_SMM_SOURCE_DESC  *Src,
+  OUT      QNC_SMM_SOURCE_CHECK *Check
+  )
+/*++
+
+Routine Description:
+
+  Add the registers of a source to the snapshot list and precompute the
+  test SourceIsActive () does against the snapshot.
+
+Arguments:
+
+  Src   - The source description of a record being registered.
+  Check - Receives the precomputed test of the source.
+
+Returns:
+
+  None
+
+--*/
+;
+
+VOID
+QNCSmmTakeSnapshot (
+  VOID
+  )
+/*++
+
+Routine Description:
+
+  Read SCI_EN and every register in the snapshot list once.
+
+Arguments:
+
+  None
+
+Returns:
+
+  None
+
+--*/
+;
+
 BOOLEAN
 SourceIsActive (
-  CONST IN QNC_SMM_SOURCE_DESC *Src
+  CONST IN QNC_SMM_SOURCE_DESC  *Src,
+  CONST IN QNC_SMM_SOURCE_CHECK *Check
   )
 /*++
 
 Routine Description:
 
-  GC_TODO: Add function description
+  Check whether all the enable and status bits of a source are set, using
+  the values read by the last QNCSmmTakeSnapshot ().
 
 Arguments:
 
-  Src - GC_TODO: add argument description
+  Src   - The source description to check.
+  Check - The precomputed test of the source from QNCSmmIndexSource ().
 
 Returns:
 
-  GC_TODO: add return values
+  TRUE if the source is active.
 
 --*/
 ;
@@ -463,13 +463,16 @@ Returns:
 
 --*/
 {
-  EFI_STATUS  Status;
-  UINT16      BiosCtlSave;
-  UINT32      SmiEnSave;
+  EFI_STATUS    Status;
+  UINT16        BiosCtlSave;
+  UINT32        SmiEnSave;
+  SPI_INSTANCE  *SpiInstance;
 
   BiosCtlSave = 0;
   SmiEnSave   = 0;
 
+  SpiInstance = SPI_INSTANCE_FROM_SPIPROTOCOL (This);
+
   //
   // Check if the parameters are valid.
   //
@@ -477,9 +480,18 @@ Returns:
     return EFI_INVALID_PARAMETER;
   }
   //
-  // Make sure it's safe to program the command.
+  // Reads of the BIOS region need neither the SPI interface nor write access,
+  // serve them before touching SMIs and the BIOS Ctrl register.
+  //
+  if (SpiReadMemoryMapped (This, OpcodeIndex, Address, DataByteCount, Buffer, SpiRegionType)) {
+    return EFI_SUCCESS;
+  }
+  //
+  // Make sure it's safe to program the command. Every cycle issued by this
+  // instance is waited for before SendSpiCmd returns, so only poll when the
+  // last one did not complete cleanly.
   //
-  if (!WaitForSpiCycleComplete (This, FALSE)) {
+  if (!SpiInstance->CycleIdle && !WaitForSpiCycleComplete (This, FALSE)) {
     return EFI_DEVICE_ERROR;
   }
 
@@ -614,14 +626,70 @@ Returns:
     // Linear Address)
     //
     *HardwareSpiAddress = SpiRegionOffset;
+    *BaseAddress        = 0;
+    *LimitAddress       = MAX_UINTN;
   } else {
     //
     // Otherwise address is relative to BIOS image
     //
     *HardwareSpiAddress = SpiRegionOffset + SpiInstance->SpiInitTable.BiosStartOffset;
+    *BaseAddress        = SpiInstance->SpiInitTable.BiosStartOffset;
+    *LimitAddress       = SpiInstance->SpiInitTable.BiosStartOffset + SpiInstance->SpiInitTable.BiosSize - 1;
   }
 }
 
+BOOLEAN
+SpiReadMemoryMapped (
+  IN     EFI_SPI_PROTOCOL   *This,
+  IN     UINT8              OpcodeIndex,
+  IN     UINTN              Address,
+  IN     UINT32             DataByteCount,
+  OUT    UINT8              *Buffer,
+  IN     SPI_REGION_TYPE    SpiRegionType
+  )
+/*++
+
+Routine Description:
+
+  Serve a read of the BIOS region from the memory mapped flash window. The
+  BIOS image is decoded at the top of the 4GB address space, so no SPI cycle
+  is needed and the host prefetch and cache settings apply to the copy.
+
+Arguments:
+
+  This              Pointer to the EFI_SPI_PROTOCOL instance.
+  OpcodeIndex       Index of the command in the OpCode Menu.
+  Address           Offset from the start of the BIOS Image.
+  DataByteCount     Number of bytes to read.
+  Buffer            Data read from the flash.
+  SpiRegionType     SPI Region type.
+
+Returns:
+
+  TRUE              The data was copied from the memory mapped window.
+  FALSE             The request is not a read lying within the BIOS region,
+                    it has to be sent to the SPI interface.
+
+--*/
+{
+  SPI_INSTANCE  *SpiInstance;
+  UINTN         SpiBiosSize;
+
+  SpiInstance = SPI_INSTANCE_FROM_SPIPROTOCOL (This);
+  SpiBiosSize = SpiInstance->SpiInitTable.BiosSize;
+
+  if (SpiRegionType != EnumSpiRegionBios ||
+      SpiInstance->SpiInitTable.OpcodeMenu[OpcodeIndex].Type != EnumSpiOpcodeRead ||
+      SpiBiosSize == 0 ||
+      Address > SpiBiosSize ||
+      DataByteCount > SpiBiosSize - Address) {
+    return FALSE;
+  }
+
+  CopyMem (Buffer, (UINT8 *) (Address + (UINT32) (~(SpiBiosSize - 1))), DataByteCount);
+  return TRUE;
+}
+
 EFI_STATUS
 SendSpiCmd (
   IN     EFI_SPI_PROTOCOL   *This,
@@ -686,6 +754,7 @@ Returns:
   UINTN         BaseAddress;
   UINTN         LimitAddress;
   UINT32        SpiDataCount;
+  UINT32        Boundary;
   UINT8         OpCode;
   UINTN         PchRootComplexBar;
 
@@ -706,13 +775,7 @@ Returns:
   //
   // Have direct access to BIOS region in Descriptor mode,
   //
-  if (SpiInstance->SpiInitTable.OpcodeMenu[OpcodeIndex].Type == EnumSpiOpcodeRead &&
-      SpiRegionType == EnumSpiRegionBios) {
-    CopyMem (
-      Buffer,
-      (UINT8 *) ((HardwareSpiAddr - BaseAddress) + (UINT32) (~(SpiBiosSize - 1))),
-      DataByteCount
-      );
+  if (SpiReadMemoryMapped (This, OpcodeIndex, Address, DataByteCount, Buffer, SpiRegionType)) {
     return EFI_SUCCESS;
   }
   //
@@ -723,16 +786,17 @@ Returns:
     DataByteCount = 0;
   }
 
+  //
+  // Trim at 4KB boundary per operation, as the PCH SPI controller requires, and
+  // at 256 byte boundary for write operation, as some SPI chips require.
+  // Reads are not cut at page boundaries so that every data cycle can carry
+  // the full 64 bytes.
+  //
+  Boundary = ShiftOut ? BIT8 : BIT12;
+
   do {
-    //
-    // Trim at 256 byte boundary per operation,
-    // - PCH SPI controller requires trimming at 4KB boundary
-    // - Some SPI chips require trimming at 256 byte boundary for write operation
-    // - Trimming has limited performance impact as we can read / write atmost 64 byte
-    //   per operation
-    //
-    if (HardwareSpiAddr + DataByteCount > ((HardwareSpiAddr + BIT8) &~(BIT8 - 1))) {
-      SpiDataCount = (((UINT32) (HardwareSpiAddr) + BIT8) &~(BIT8 - 1)) - (UINT32) (HardwareSpiAddr);
+    if (HardwareSpiAddr + DataByteCount > ((HardwareSpiAddr + Boundary) &~(Boundary - 1))) {
+      SpiDataCount = (((UINT32) (HardwareSpiAddr) + Boundary) &~(Boundary - 1)) - (UINT32) (HardwareSpiAddr);
     } else {
       SpiDataCount = DataByteCount;
     }
@@ -747,13 +811,17 @@ Returns:
       SpiDataCount = SpiDataCount &~0x07;
     }
     //
-    // If shifts data out, load data into the SPI data buffer.
+    // If shifts data out, load data into the SPI data buffer a DWORD at a time,
+    // then read it back once to flush the posted writes.
     //
     if (ShiftOut) {
-      for (Index = 0; Index < SpiDataCount; Index++) {
+      for (Index = 0; Index + sizeof (UINT32) <= SpiDataCount; Index += sizeof (UINT32)) {
+        MmioWrite32 (PchRootComplexBar + R_QNC_RCRB_SPID0 + Index, ReadUnaligned32 ((UINT32 *) (Buffer + Index)));
+      }
+      for (; Index < SpiDataCount; Index++) {
         MmioWrite8 (PchRootComplexBar + R_QNC_RCRB_SPID0 + Index, Buffer[Index]);
-        MmioRead8 (PchRootComplexBar + R_QNC_RCRB_SPID0 + Index);
       }
+      MmioRead8 (PchRootComplexBar + R_QNC_RCRB_SPID0);
     }
 
     MmioWrite32 (
@@ -774,6 +842,7 @@ Returns:
     //
     // Initialte the SPI cycle
     //
+    SpiInstance->CycleIdle = FALSE;
     if (DataCycle) {
       MmioWrite16 (
         (PchRootComplexBar + R_QNC_RCRB_SPIC),
@@ -801,11 +870,15 @@ Returns:
     if (!WaitForSpiCycleComplete (This, TRUE)) {
       return EFI_DEVICE_ERROR;
     }
+    SpiInstance->CycleIdle = TRUE;
     //
     // If shifts data in, get data from the SPI data buffer.
     //
     if (!ShiftOut) {
-      for (Index = 0; Index < SpiDataCount; Index++) {
+      for (Index = 0; Index + sizeof (UINT32) <= SpiDataCount; Index += sizeof (UINT32)) {
+        WriteUnaligned32 ((UINT32 *) (Buffer + Index), MmioRead32 (PchRootComplexBar + R_QNC_RCRB_SPID0 + Index));
+      }
+      for (; Index < SpiDataCount; Index++) {
         Buffer[Index] = MmioRead8 (PchRootComplexBar + R_QNC_RCRB_SPID0 + Index);
       }
     }
@@ -15,6 +15,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/DebugLib.h>
 #include <Library/PcdLib.h>
 #include <Library/BaseMemoryLib.h>
+#include <Library/BaseLib.h>
 #include <Library/IntelQNCLib.h>
 #include <Library/QNCAccessLib.h>
 #include <Uefi/UefiBaseType.h>
@@ -63,6 +64,7 @@ typedef struct {
   SPI_INIT_TABLE    SpiInitTable;
   UINTN             PchRootComplexBar;
   BOOLEAN           InitDone; // Set to TRUE on SpiProtocolInit SUCCESS.
+  BOOLEAN           CycleIdle; // Set to TRUE when the last SPI cycle of this instance completed.
   SPI_INIT_INFO     InitInfo;
 } SPI_INSTANCE;
 
@@ -198,6 +200,32 @@ Returns:
 --*/
 ;
 
+BOOLEAN
+SpiReadMemoryMapped (
+  IN     EFI_SPI_PROTOCOL   *This,
+  IN     UINT8              OpcodeIndex,
+  IN     UINTN              Address,
+  IN     UINT32             DataByteCount,
+  OUT    UINT8              *Buffer,
+  IN     SPI_REGION_TYPE    SpiRegionType
+  )
+/*++
+Routine Description:
+  Serve a read of the BIOS region from the memory mapped flash window.
+Arguments:
+  This              Pointer to the EFI_SPI_PROTOCOL instance.
+  OpcodeIndex       Index of the command in the OpCode Menu.
+  Address           Offset from the start of the BIOS Image.
+  DataByteCount     Number of bytes to read.
+  Buffer            Data read from the flash.
+  SpiRegionType     SPI Region type.
+Returns:
+  TRUE              The data was copied from the memory mapped window.
+  FALSE             The request is not a read lying within the BIOS region,
+                    it has to be sent to the SPI interface.
+--*/
+;
+
 EFI_STATUS
 SendSpiCmd (
   IN     EFI_SPI_PROTOCOL   *This,
@@ -95,6 +95,8 @@ typedef enum {
 #define  MMIO_HOSTCTL2                            0x3E
 #define  MMIO_CAP                                 0x40
 #define  MMIO_MCCAP                               0x48
+#define  MMIO_ADMAERRSTS                          0x54
+#define  MMIO_ADMAADR                             0x58
 #define  MMIO_SLTINTSTS                           0xFC
 #define  MMIO_CTRLRVER                            0xFE
 #define  MMIO_SRST                                0x1FC
@@ -305,10 +307,19 @@ typedef struct {
   UINT32  HostVersion:         8;
   UINT32  BusWidth4:           1;  // 4 bit width
   UINT32  BusWidth8:           1;  // 8 bit width
-  UINT32  Reserved1:           14;
+  UINT32  Adma2Support:        1;  // ADMA2 supported, see SD_HOST_ADMA2_MAX_TRANSFER_SIZE
+  UINT32  Reserved1:           13;
   UINT32  BoundarySize;
 }HOST_CAPABILITY;
 
+//
+// With ADMA2 the host walks a descriptor table itself, so a single SendCommand
+// may move up to SD_HOST_ADMA2_MAX_TRANSFER_SIZE bytes from any buffer aligned
+// on SD_HOST_ADMA2_ADDRESS_ALIGN without the BoundarySize restrictions of SDMA.
+//
+#define SD_HOST_ADMA2_MAX_TRANSFER_SIZE           SIZE_4MB
+#define SD_HOST_ADMA2_ADDRESS_ALIGN               4
+
 
 //
 // Interface structure for the SD HOST I/O Protocol
@@ -33,6 +33,7 @@ EFI_SD_HOST_IO_PROTOCOL  mSDHostIo = {
     0, // Reserved0
     0, // BusWidth4
     0, // BusWidth8
+    0, // Adma2Support
     0, // Reserved1
     0, // Reserved1
     (512 * 1024) //BoundarySize
@@ -369,6 +370,86 @@ HostLEDEnable (
   return EFI_SUCCESS;
 }
 
+/**
+  Select the DMA engine used by the next data transfer and, for ADMA2, build the
+  descriptor table covering the whole buffer.
+
+  @param  SDHostData            A pointer to the SDHOST_DATA instance.
+  @param  Buffer                Contains the data read from / write to the device.
+  @param  BufferSize            The size of the buffer.
+  @param  UseAdma2              TRUE to set up ADMA2, FALSE to set up SDMA.
+
+**/
+VOID
+SetupDma (
+  IN  SDHOST_DATA                *SDHostData,
+  IN  UINT8                      *Buffer,
+  IN  UINT32                     BufferSize,
+  IN  BOOLEAN                    UseAdma2
+  )
+{
+  EFI_PCI_IO_PROTOCOL    *PciIo;
+  SD_ADMA2_DESC          *Desc;
+  UINT32                 Length;
+  UINT32                 Data;
+
+  PciIo = SDHostData->PciIo;
+
+  if (UseAdma2) {
+    Desc = SDHostData->Adma2Desc;
+    ZeroMem (Desc, ADMA2_DESC_COUNT * sizeof (SD_ADMA2_DESC));
+    do {
+      Length = MIN (BufferSize, ADMA2_MAX_DESC_LENGTH);
+      Desc->Valid   = 1;
+      Desc->Act     = ADMA2_ACT_TRAN;
+      Desc->Length  = Length;
+      Desc->Address = (UINT32)(UINTN)Buffer;
+      Buffer     += Length;
+      BufferSize -= Length;
+      Desc++;
+    } while (BufferSize > 0);
+    (Desc - 1)->End = 1;
+
+    Data = (UINT32)(UINTN)SDHostData->Adma2Desc;
+    PciIo->Mem.Write (
+                 PciIo,
+                 EfiPciIoWidthUint32,
+                 0,
+                 (UINT64)MMIO_ADMAADR,
+                 1,
+                 &Data
+                 );
+  } else {
+    PciIo->Mem.Write (
+                 PciIo,
+                 EfiPciIoWidthUint32,
+                 0,
+                 (UINT64)MMIO_DMAADR,
+                 1,
+                 &Buffer
+                 );
+  }
+
+  PciIo->Mem.Read (
+               PciIo,
+               EfiPciIoWidthUint8,
+               0,
+               (UINT64)MMIO_HOSTCTL,
+               1,
+               &Data
+               );
+  Data &= ~HOSTCTL_DMA_SEL_MASK;
+  Data |= UseAdma2 ? HOSTCTL_DMA_SEL_ADMA2 : HOSTCTL_DMA_SEL_SDMA;
+  PciIo->Mem.Write (
+               PciIo,
+               EfiPciIoWidthUint8,
+               0,
+               (UINT64)MMIO_HOSTCTL,
+               1,
+               &Data
+               );
+}
+
 
 /**
   The main function used to send the command to the card inserted into the SD host slot.
@@ -445,6 +526,7 @@ SendCommand (
   UINT8                 Index;
   INTN                  TimeOut2;
   BOOLEAN               AutoCMD12Enable = FALSE;
+  BOOLEAN               UseAdma2;
 
 
   Status             = EFI_SUCCESS;
@@ -453,6 +535,7 @@ SendCommand (
   PciIo              = SDHostData->PciIo;
   AutoCMD12Enable    =  (CommandIndex & AUTO_CMD12_ENABLE) ? TRUE : FALSE;
   CommandIndex       = CommandIndex & CMD_INDEX_MASK;
+  UseAdma2           = (BOOLEAN)(This->HostCapability.Adma2Support && (Buffer != NULL));
 
   if (Buffer != NULL && DataType == NoData) {
     Status = EFI_INVALID_PARAMETER;
@@ -460,7 +543,17 @@ SendCommand (
     goto Exit;
   }
 
-  if (((UINTN)Buffer & (This->HostCapability.BoundarySize - 1)) != (UINTN)NULL) {
+  if (UseAdma2) {
+    //
+    // ADMA2 takes the buffer as is, no need to bounce it to a BoundarySize aligned one
+    //
+    if ((((UINTN)Buffer & (SD_HOST_ADMA2_ADDRESS_ALIGN - 1)) != 0) ||
+        (BufferSize == 0) || (BufferSize > SD_HOST_ADMA2_MAX_TRANSFER_SIZE)) {
+      Status = EFI_INVALID_PARAMETER;
+      DEBUG ((EFI_D_ERROR, "SendCommand: invalid parameter \r\n"));
+      goto Exit;
+    }
+  } else if (((UINTN)Buffer & (This->HostCapability.BoundarySize - 1)) != (UINTN)NULL) {
     Status = EFI_INVALID_PARAMETER;
     DEBUG ((EFI_D_ERROR, "SendCommand: invalid parameter \r\n"));
     goto Exit;
@@ -516,14 +609,7 @@ SendCommand (
 
 
   if (Buffer != NULL) {
-     PciIo->Mem.Write (
-                  PciIo,
-                  EfiPciIoWidthUint32,
-                  0,
-                  (UINT64)MMIO_DMAADR,
-                  1,
-                  &Buffer
-                  );
+     SetupDma (SDHostData, Buffer, BufferSize, UseAdma2);
 
      PciIo->Mem.Read (
                   PciIo,
@@ -1665,6 +1751,18 @@ SDControllerStart (
   DEBUG ((EFI_D_INFO, "SdHostDriverBindingStart: BlockLength 0x%x \r\n", SDHostData->BlockLength));
   SDHostData->IsAutoStopCmd  = TRUE;
 
+  //
+  // BIT19 - ADMA2 Support. The table is only handed to the 32-bit ADMA2 engine,
+  // IA32 pool memory is always below 4GB.
+  //
+  if ((Data & BIT19) != 0) {
+    SDHostData->Adma2Desc = AllocateZeroPool (ADMA2_DESC_COUNT * sizeof (SD_ADMA2_DESC));
+    if (SDHostData->Adma2Desc != NULL) {
+      SDHostData->SDHostIo.HostCapability.Adma2Support = TRUE;
+    }
+  }
+  DEBUG ((EFI_D_INFO, "SdHostDriverBindingStart: Adma2Support %d \r\n", SDHostData->SDHostIo.HostCapability.Adma2Support));
+
   Status = gBS->InstallProtocolInterface (
                   &Controller,
                   &gEfiSDHostIoProtocolGuid,
@@ -1698,6 +1796,9 @@ SDControllerStart (
 Exit:
   if (EFI_ERROR (Status)) {
     if (SDHostData != NULL) {
+      if (SDHostData->Adma2Desc != NULL) {
+        FreePool (SDHostData->Adma2Desc);
+      }
       FreePool (SDHostData);
     }
   }
@@ -1768,6 +1869,9 @@ SDControllerStop (
 
   FreeUnicodeStringTable (SDHostData->ControllerNameTable);
 
+  if (SDHostData->Adma2Desc != NULL) {
+    FreePool (SDHostData->Adma2Desc);
+  }
   FreePool (SDHostData);
 
   gBS->CloseProtocol (
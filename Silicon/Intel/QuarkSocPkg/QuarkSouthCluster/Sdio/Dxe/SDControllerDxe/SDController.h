@@ -52,8 +52,33 @@ typedef struct {
   UINT8 BaseCode;
 } PCI_CLASSC;
 
+//
+// ADMA2 32-bit address descriptor
+//
+typedef struct {
+  UINT32  Valid:               1;
+  UINT32  End:                 1;
+  UINT32  Int:                 1;
+  UINT32  Reserved0:           1;
+  UINT32  Act:                 2;  // 2 - Transfer data
+  UINT32  Reserved1:           10;
+  UINT32  Length:              16; // 0 means 65536 bytes, never used by this driver
+  UINT32  Address;
+} SD_ADMA2_DESC;
+
 #pragma pack()
 
+#define ADMA2_ACT_TRAN           2
+#define ADMA2_MAX_DESC_LENGTH    SIZE_32KB
+#define ADMA2_DESC_COUNT         (SD_HOST_ADMA2_MAX_TRANSFER_SIZE / ADMA2_MAX_DESC_LENGTH)
+
+//
+// Host Control register DMA Select field
+//
+#define HOSTCTL_DMA_SEL_MASK     (BIT4 | BIT3)
+#define HOSTCTL_DMA_SEL_SDMA     0
+#define HOSTCTL_DMA_SEL_ADMA2    BIT4
+
 
 typedef struct {
   UINTN                      Signature;
@@ -64,6 +89,7 @@ typedef struct {
   UINT32                     CurrentClockInKHz;
   UINT32                     BlockLength;
   EFI_UNICODE_STRING_TABLE   *ControllerNameTable;
+  SD_ADMA2_DESC              *Adma2Desc;
 }SDHOST_DATA;
 
 #define SDHOST_DATA_FROM_THIS(a) \
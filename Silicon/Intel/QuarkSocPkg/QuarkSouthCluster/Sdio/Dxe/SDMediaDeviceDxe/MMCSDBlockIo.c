@@ -73,6 +73,9 @@ MMCSDBlockReadBlocks (
   UINT32                      RemainingLength;
   UINT32                      TransferLength;
   UINT8                       *BufferPointer;
+  UINT8                       *DmaBuffer;
+  UINT32                      MaxTransferLength;
+  BOOLEAN                     DirectDma;
   BOOLEAN                     SectorAddressing;
   UINTN                       TotalBlock;
 
@@ -132,10 +135,23 @@ MMCSDBlockReadBlocks (
     BufferPointer   = Buffer;
     RemainingLength = (UINT32)BufferSize;
 
+    //
+    // With ADMA2 the host transfers straight from/to the caller buffer, several MB
+    // per command; otherwise bounce through AlignedBuffer one BoundarySize at a time.
+    //
+    DirectDma = (BOOLEAN)(SDHostIo->HostCapability.Adma2Support &&
+                          (((UINTN)Buffer & (SD_HOST_ADMA2_ADDRESS_ALIGN - 1)) == 0));
+    if (DirectDma) {
+      MaxTransferLength = SD_HOST_ADMA2_MAX_TRANSFER_SIZE;
+    } else {
+      MaxTransferLength = SDHostIo->HostCapability.BoundarySize;
+    }
+
     while (RemainingLength > 0) {
+    DmaBuffer = DirectDma ? BufferPointer : CardData->AlignedBuffer;
     if ((BufferSize > CardData->BlockIoMedia.BlockSize)) {
-      if (RemainingLength > SDHostIo->HostCapability.BoundarySize) {
-        TransferLength = SDHostIo->HostCapability.BoundarySize;
+      if (RemainingLength > MaxTransferLength) {
+        TransferLength = MaxTransferLength;
       } else {
         TransferLength = RemainingLength;
       }
@@ -177,7 +193,7 @@ MMCSDBlockReadBlocks (
                  READ_MULTIPLE_BLOCK,
                  Address,
                  InData,
-                 CardData->AlignedBuffer,
+                 DmaBuffer,
                  TransferLength,
                  ResponseR1,
                  TIMEOUT_DATA,
@@ -200,7 +216,7 @@ MMCSDBlockReadBlocks (
                  READ_SINGLE_BLOCK,
                  Address,
                  InData,
-                 CardData->AlignedBuffer,
+                 DmaBuffer,
                  (UINT32)TransferLength,
                  ResponseR1,
                  TIMEOUT_DATA,
@@ -211,7 +227,9 @@ MMCSDBlockReadBlocks (
         break;
       }
     }
+    if (!DirectDma) {
       CopyMem (BufferPointer, CardData->AlignedBuffer, TransferLength);
+    }
 
     if (SectorAddressing) {
         //
@@ -303,6 +321,9 @@ MMCSDBlockWriteBlocks (
   UINT32                      RemainingLength;
   UINT32                      TransferLength;
   UINT8                       *BufferPointer;
+  UINT8                       *DmaBuffer;
+  UINT32                      MaxTransferLength;
+  BOOLEAN                     DirectDma;
   BOOLEAN                     SectorAddressing;
 
   DEBUG((EFI_D_INFO, "Write(LBA=%08lx, Buffer=%08x, Size=%08x)\n", LBA, Buffer, BufferSize));
@@ -354,10 +375,23 @@ MMCSDBlockWriteBlocks (
     BufferPointer   = Buffer;
     RemainingLength = (UINT32)BufferSize;
 
+    //
+    // With ADMA2 the host transfers straight from/to the caller buffer, several MB
+    // per command; otherwise bounce through AlignedBuffer one BoundarySize at a time.
+    //
+    DirectDma = (BOOLEAN)(SDHostIo->HostCapability.Adma2Support &&
+                          (((UINTN)Buffer & (SD_HOST_ADMA2_ADDRESS_ALIGN - 1)) == 0));
+    if (DirectDma) {
+      MaxTransferLength = SD_HOST_ADMA2_MAX_TRANSFER_SIZE;
+    } else {
+      MaxTransferLength = SDHostIo->HostCapability.BoundarySize;
+    }
+
     while (RemainingLength > 0) {
+    DmaBuffer = DirectDma ? BufferPointer : CardData->AlignedBuffer;
     if ((BufferSize > CardData->BlockIoMedia.BlockSize) ) {
-      if (RemainingLength > SDHostIo->HostCapability.BoundarySize) {
-        TransferLength = SDHostIo->HostCapability.BoundarySize;
+      if (RemainingLength > MaxTransferLength) {
+        TransferLength = MaxTransferLength;
       } else {
         TransferLength = RemainingLength;
       }
@@ -396,14 +430,16 @@ MMCSDBlockWriteBlocks (
         }
       }
 
-      CopyMem (CardData->AlignedBuffer, BufferPointer, TransferLength);
+      if (!DirectDma) {
+        CopyMem (CardData->AlignedBuffer, BufferPointer, TransferLength);
+      }
 
       Status = SendCommand (
                  CardData,
                  WRITE_MULTIPLE_BLOCK,
                  Address,
                  OutData,
-                 CardData->AlignedBuffer,
+                 DmaBuffer,
                  (UINT32)TransferLength,
                  ResponseR1,
                  TIMEOUT_DATA,
@@ -420,14 +456,16 @@ MMCSDBlockWriteBlocks (
         TransferLength = RemainingLength;
       }
 
-      CopyMem (CardData->AlignedBuffer, BufferPointer, TransferLength);
+      if (!DirectDma) {
+        CopyMem (CardData->AlignedBuffer, BufferPointer, TransferLength);
+      }
 
       Status = SendCommand (
                  CardData,
                  WRITE_BLOCK,
                  Address,
                  OutData,
-                 CardData->AlignedBuffer,
+                 DmaBuffer,
                  (UINT32)TransferLength,
                  ResponseR1,
                  TIMEOUT_DATA,
@@ -68,6 +68,11 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #define TD_NO_DELAY           0x7
 
+//
+// A TD buffer may cross at most one 4K page boundary
+//
+#define TD_MAX_BUFFER_SIZE    0x2000
+
 #define TD_INT                0x1
 #define TD_CTL                0x2
 #define TD_BLK                0x3
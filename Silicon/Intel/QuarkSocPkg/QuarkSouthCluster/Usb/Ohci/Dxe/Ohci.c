@@ -72,6 +72,7 @@ OhciReset (
     }
   }
   OhciFreeIntTransferMemory (Ohc);
+  OhciFreeBulkEdList (Ohc);
   Status = OhciInitializeInterruptList (Ohc);
   OhciSetFrameInterval (Ohc, FRAME_INTERVAL, 0x2edf);
   if ((Attributes &  EFI_USB_HC_RESET_GLOBAL) != 0) {
@@ -559,7 +560,7 @@ FREE_TD_BUFF:
   while (HeadTd) {
     DataTd = HeadTd;
     HeadTd = (TD_DESCRIPTOR *)(UINTN)(HeadTd->NextTDPointer);
-    UsbHcFreeMem(Ohc->MemPool, DataTd, sizeof(TD_DESCRIPTOR));
+    OhciFreeTD (Ohc, DataTd);
   }
 
 UNMAP_SETUP_BUFF:
@@ -568,7 +569,7 @@ UNMAP_SETUP_BUFF:
   }
 
 FREE_ED_BUFF:
-  UsbHcFreeMem(Ohc->MemPool, Ed, sizeof(ED_DESCRIPTOR));
+  OhciFreeED (Ohc, Ed);
 
 CTRL_EXIT:
   return Status;
@@ -629,16 +630,16 @@ OhciBulkTransfer(
   )
 {
   USB_OHCI_HC_DEV                *Ohc;
-  ED_DESCRIPTOR                  *HeadEd;
   ED_DESCRIPTOR                  *Ed;
   UINT32                         DataPidDir;
+  UINT8                          EdDir;
   TD_DESCRIPTOR                  *HeadTd;
   TD_DESCRIPTOR                  *DataTd;
-  TD_DESCRIPTOR                  *EmptyTd;
+  TD_DESCRIPTOR                  *TailTd;
   EFI_STATUS                     Status;
   UINT8                          EndPointNum;
   UINTN                          TimeCount;
-  OHCI_ED_RESULT                 EdResult;
+  UINT32                         ErrorCode;
 
   EFI_PCI_IO_PROTOCOL_OPERATION  MapOp;
   VOID                           *Mapping;
@@ -646,7 +647,7 @@ OhciBulkTransfer(
   EFI_PHYSICAL_ADDRESS           MapPyhAddr;
   UINTN                          LeftLength;
   UINTN                          ActualSendLength;
-  BOOLEAN                        FirstTD;
+  UINTN                          TransferredLength;
 
   Mapping = NULL;
   MapLength = 0;
@@ -665,71 +666,43 @@ OhciBulkTransfer(
 
   if ((EndPointAddress & 0x80) != 0) {
     DataPidDir = TD_IN_PID;
+    EdDir = ED_IN_DIR;
     MapOp = EfiPciIoOperationBusMasterWrite;
   } else {
     DataPidDir = TD_OUT_PID;
+    EdDir = ED_OUT_DIR;
     MapOp = EfiPciIoOperationBusMasterRead;
   }
 
   EndPointNum = (EndPointAddress & 0xF);
-  EdResult.NextToggle = *DataToggle;
-
-  Status = OhciSetHcControl (Ohc, BULK_ENABLE, 0);
-  if (EFI_ERROR(Status)) {
-    DEBUG ((EFI_D_INFO, "OhciControlTransfer: fail to disable BULK_ENABLE\r\n"));
-    *TransferResult = EFI_USB_ERR_SYSTEM;
-    return EFI_DEVICE_ERROR;
-  }
-  Status = OhciSetHcCommandStatus (Ohc, BULK_LIST_FILLED, 0);
-  if (EFI_ERROR(Status)) {
-    DEBUG ((EFI_D_INFO, "OhciControlTransfer: fail to disable BULK_LIST_FILLED\r\n"));
-    *TransferResult = EFI_USB_ERR_SYSTEM;
-    return EFI_DEVICE_ERROR;
-  }
-  gBS->Stall(20 * 1000);
 
-  OhciSetMemoryPointer (Ohc, HC_BULK_HEAD, NULL);
-
-  Ed = OhciCreateED (Ohc);
+  Ed = OhciGetBulkEd (Ohc, DeviceAddress, EndPointNum, EdDir);
   if (Ed == NULL) {
     return EFI_OUT_OF_RESOURCES;
   }
-  OhciSetEDField (Ed, ED_SKIP, 1);
-  OhciSetEDField (Ed, ED_FUNC_ADD, DeviceAddress);
-  OhciSetEDField (Ed, ED_ENDPT_NUM, EndPointNum);
-  OhciSetEDField (Ed, ED_DIR, ED_FROM_TD_DIR);
-  OhciSetEDField (Ed, ED_SPEED, HI_SPEED);
-  OhciSetEDField (Ed, ED_FORMAT | ED_HALTED | ED_DTTOGGLE, 0);
-  OhciSetEDField (Ed, ED_MAX_PACKET, MaxPacketLength);
-  OhciSetEDField (Ed, ED_PDATA, 0);
-  OhciSetEDField (Ed, ED_ZERO, 0);
-  OhciSetEDField (Ed, ED_TDHEAD_PTR, 0);
-  OhciSetEDField (Ed, ED_TDTAIL_PTR, 0);
-  OhciSetEDField (Ed, ED_NEXT_EDPTR, 0);
-  HeadEd = OhciAttachEDToList (Ohc, BULK_LIST, Ed, NULL);
 
-  if(Data != NULL) {
-    MapLength = *DataLength;
-    Status = Ohc->PciIo->Map (Ohc->PciIo, MapOp, (UINT8 *)Data, &MapLength, &MapPyhAddr, &Mapping);
-    if (EFI_ERROR(Status)) {
-      DEBUG ((EFI_D_INFO, "OhciBulkTransfer: Fail to Map Data Buffer for Bulk\r\n"));
-      goto FREE_ED_BUFF;
-    }
+  MapLength = *DataLength;
+  Status = Ohc->PciIo->Map (Ohc->PciIo, MapOp, (UINT8 *)Data, &MapLength, &MapPyhAddr, &Mapping);
+  if (EFI_ERROR(Status)) {
+    DEBUG ((EFI_D_INFO, "OhciBulkTransfer: Fail to Map Data Buffer for Bulk\r\n"));
+    return Status;
   }
+
   //
-  //Data Stage
+  // The ED is idle, so the dummy TD at its tail becomes the first TD of this
+  // transfer and a fresh dummy TD goes behind the last data TD. Each data TD
+  // covers as many whole packets as fit in its two pages.
   //
+  HeadTd = (TD_DESCRIPTOR *)(UINTN)(Ed->TdTailPointer);
+  DataTd = HeadTd;
   LeftLength = MapLength;
-  ActualSendLength = MapLength;
-  HeadTd = NULL;
-  FirstTD = TRUE;
   while (LeftLength > 0) {
-    ActualSendLength = LeftLength;
-    if (LeftLength > MaxPacketLength) {
-      ActualSendLength = MaxPacketLength;
+    ActualSendLength = MIN (LeftLength, TD_MAX_BUFFER_SIZE - ((UINTN)MapPyhAddr & (EFI_PAGE_SIZE - 1)));
+    if (ActualSendLength < LeftLength) {
+      ActualSendLength -= ActualSendLength % MaxPacketLength;
     }
-    DataTd = OhciCreateTD (Ohc);
-    if (DataTd == NULL) {
+    TailTd = OhciCreateTD (Ohc);
+    if (TailTd == NULL) {
       DEBUG ((EFI_D_INFO, "OhciBulkTransfer: Fail to allocate buffer for Data Stage TD\r\n"));
       Status = EFI_OUT_OF_RESOURCES;
       goto FREE_OHCI_TDBUFF;
@@ -738,112 +711,114 @@ OhciBulkTransfer(
     OhciSetTDField (DataTd, TD_BUFFER_ROUND, 1);
     OhciSetTDField (DataTd, TD_DIR_PID, DataPidDir);
     OhciSetTDField (DataTd, TD_DELAY_INT, TD_NO_DELAY);
-    OhciSetTDField (DataTd, TD_DT_TOGGLE, *DataToggle);
+    OhciSetTDField (DataTd, TD_DT_TOGGLE, 0);
     OhciSetTDField (DataTd, TD_ERROR_CNT, 0);
     OhciSetTDField (DataTd, TD_COND_CODE, TD_TOBE_PROCESSED);
     OhciSetTDField (DataTd, TD_CURR_BUFFER_PTR, (UINT32) MapPyhAddr);
     OhciSetTDField (DataTd, TD_BUFFER_END_PTR, (UINT32)(MapPyhAddr + ActualSendLength - 1));
-    OhciSetTDField (DataTd, TD_NEXT_PTR, 0);
+    OhciSetTDField (DataTd, TD_NEXT_PTR, (UINT32)(UINTN)TailTd);
     DataTd->ActualSendLength = (UINT32)ActualSendLength;
     DataTd->DataBuffer = (UINT32)MapPyhAddr;
-    DataTd->NextTDPointer = 0;
-    if (FirstTD) {
-      HeadTd = DataTd;
-      FirstTD = FALSE;
-    } else {
-      OhciLinkTD (HeadTd, DataTd);
-    }
-    *DataToggle ^= 1;
+    DataTd->NextTDPointer = (UINT32)(UINTN)TailTd;
+    DataTd = TailTd;
     MapPyhAddr += ActualSendLength;
     LeftLength -= ActualSendLength;
   }
+  TailTd = DataTd;
+
   //
-  // Empty Stage
+  // The data toggle is carried in the ED, the TDs take it from there.
   //
-  EmptyTd = OhciCreateTD (Ohc);
-  if (EmptyTd == NULL) {
-    Status = EFI_OUT_OF_RESOURCES;
-    DEBUG ((EFI_D_INFO, "OhciBulkTransfer: Fail to allocate buffer for Empty TD\r\n"));
-    goto FREE_OHCI_TDBUFF;
-  }
-  OhciSetTDField (EmptyTd, TD_PDATA, 0);
-  OhciSetTDField (EmptyTd, TD_BUFFER_ROUND, 0);
-  OhciSetTDField (EmptyTd, TD_DIR_PID, 0);
-  OhciSetTDField (EmptyTd, TD_DELAY_INT, 0);
-  //OhciSetTDField (EmptyTd, TD_DT_TOGGLE, CurrentToggle);
-  EmptyTd->Word0.DataToggle = 0;
-  OhciSetTDField (EmptyTd, TD_ERROR_CNT, 0);
-  OhciSetTDField (EmptyTd, TD_COND_CODE, 0);
-  OhciSetTDField (EmptyTd, TD_CURR_BUFFER_PTR, 0);
-  OhciSetTDField (EmptyTd, TD_BUFFER_END_PTR, 0);
-  OhciSetTDField (EmptyTd, TD_NEXT_PTR, 0);
-  EmptyTd->ActualSendLength = 0;
-  EmptyTd->DataBuffer = 0;
-  EmptyTd->NextTDPointer = 0;
-  OhciLinkTD (HeadTd, EmptyTd);
-  Ed->TdTailPointer = (UINT32)(UINTN)EmptyTd;
-  OhciAttachTDListToED (Ed, HeadTd);
-
+  OhciSetEDField (Ed, ED_FUNC_ADD, DeviceAddress);
+  OhciSetEDField (Ed, ED_MAX_PACKET, MaxPacketLength);
+  OhciSetEDField (Ed, ED_DTTOGGLE, *DataToggle);
+  OhciSetEDField (Ed, ED_TDTAIL_PTR, (UINT32)(UINTN)TailTd);
   OhciSetEDField (Ed, ED_SKIP, 0);
+
   Status = OhciSetHcCommandStatus (Ohc, BULK_LIST_FILLED, 1);
   if (EFI_ERROR(Status)) {
-    *TransferResult = EFI_USB_ERR_SYSTEM;
-    Status = EFI_DEVICE_ERROR;
-    DEBUG ((EFI_D_INFO, "OhciControlTransfer: Fail to enable BULK_LIST_FILLED\r\n"));
-    goto FREE_OHCI_TDBUFF;
-  }
-  Status = OhciSetHcControl (Ohc, BULK_ENABLE, 1);
-  if (EFI_ERROR(Status)) {
-    *TransferResult = EFI_USB_ERR_SYSTEM;
-    Status = EFI_DEVICE_ERROR;
-    DEBUG ((EFI_D_INFO, "OhciControlTransfer: Fail to enable BULK_ENABLE\r\n"));
-    goto FREE_OHCI_TDBUFF;
+    DEBUG ((EFI_D_INFO, "OhciBulkTransfer: Fail to enable BULK_LIST_FILLED\r\n"));
   }
-  gBS->Stall(20 * 1000);
 
+  ErrorCode = TD_TOBE_PROCESSED;
   TimeCount = 0;
-  Status = CheckIfDone (Ohc, BULK_LIST, Ed, HeadTd, &EdResult);
-  while (Status == EFI_NOT_READY && TimeCount <= TimeOut) {
+  while (TRUE) {
+    if (Ed->Word2.Halted != 0) {
+      for (DataTd = HeadTd; DataTd != TailTd; DataTd = (TD_DESCRIPTOR *)(UINTN)(DataTd->NextTDPointer)) {
+        if (DataTd->Word0.ConditionCode != TD_NO_ERROR) {
+          ErrorCode = DataTd->Word0.ConditionCode;
+          break;
+        }
+      }
+      break;
+    }
+    if (TD_PTR (Ed->Word2.TdHeadPointer) == TailTd) {
+      ErrorCode = TD_NO_ERROR;
+      break;
+    }
+    if (TimeCount > TimeOut) {
+      break;
+    }
     gBS->Stall (1000);
     TimeCount++;
-    Status = CheckIfDone (Ohc, BULK_LIST, Ed, HeadTd, &EdResult);
   }
 
-  *TransferResult = ConvertErrorCode (EdResult.ErrorCode);
+  OhciSetEDField (Ed, ED_SKIP, 1);
+  *DataToggle = (UINT8) OhciGetEDField (Ed, ED_DTTOGGLE);
+  *TransferResult = ConvertErrorCode (ErrorCode);
 
-  if (EdResult.ErrorCode != TD_NO_ERROR) {
-    if (EdResult.ErrorCode == TD_TOBE_PROCESSED) {
+  if (ErrorCode != TD_NO_ERROR) {
+    if (ErrorCode == TD_TOBE_PROCESSED) {
       DEBUG ((EFI_D_INFO, "Bulk pipe timeout, > %d mS\r\n", TimeOut));
+      Status = EFI_TIMEOUT;
     } else {
       DEBUG ((EFI_D_INFO, "Bulk pipe broken\r\n"));
-      *DataToggle = EdResult.NextToggle;
+      Status = EFI_DEVICE_ERROR;
     }
+    //
+    // Let the controller see the skip bit before the unfinished TDs are
+    // taken off the ED, this also clears the halt.
+    //
+    gBS->Stall (1000);
+    OhciSetEDField (Ed, ED_HALTED, 0);
+    OhciSetEDField (Ed, ED_TDHEAD_PTR, (UINT32)(UINTN)TailTd);
     *DataLength = 0;
   } else {
+    TransferredLength = 0;
+    for (DataTd = HeadTd; DataTd != TailTd; DataTd = (TD_DESCRIPTOR *)(UINTN)(DataTd->NextTDPointer)) {
+      if (DataTd->CurrBufferPointer != 0) {
+        TransferredLength += DataTd->CurrBufferPointer - DataTd->DataBuffer;
+        break;
+      }
+      TransferredLength += DataTd->ActualSendLength;
+    }
+    *DataLength = TransferredLength;
+    Status = EFI_SUCCESS;
     DEBUG ((EFI_D_INFO, "Bulk transfer successed\r\n"));
   }
-  //*DataToggle = (UINT8) OhciGetEDField (Ed, ED_DTTOGGLE);
 
 FREE_OHCI_TDBUFF:
-  OhciSetEDField (Ed, ED_SKIP, 1);
-  if (HeadEd == Ed) {
-    OhciSetMemoryPointer (Ohc, HC_BULK_HEAD, NULL);
-  }else {
-    HeadEd->NextED = Ed->NextED;
+  //
+  // Free the TDs of this transfer, which leaves the ED with only its new
+  // dummy TD. On allocation failure HeadTd is still the ED's dummy TD and
+  // only the TDs behind it are freed.
+  //
+  if (Status == EFI_OUT_OF_RESOURCES) {
+    DataTd = (TD_DESCRIPTOR *)(UINTN)(HeadTd->NextTDPointer);
+    ZeroMem (HeadTd, sizeof (TD_DESCRIPTOR));
+    HeadTd = DataTd;
+    TailTd = NULL;
   }
-  while (HeadTd) {
+  while (HeadTd != NULL && HeadTd != TailTd) {
     DataTd = HeadTd;
     HeadTd = (TD_DESCRIPTOR *)(UINTN)(HeadTd->NextTDPointer);
-    UsbHcFreeMem(Ohc->MemPool, DataTd, sizeof(TD_DESCRIPTOR));
+    OhciFreeTD (Ohc, DataTd);
   }
 
   if(Mapping != NULL) {
     Ohc->PciIo->Unmap(Ohc->PciIo, Mapping);
   }
 
-FREE_ED_BUFF:
-  UsbHcFreeMem(Ohc->MemPool, Ed, sizeof(ED_DESCRIPTOR));
-
   return Status;
 }
 /**
@@ -1118,7 +1093,7 @@ FREE_OHCI_TDBUFF:
   while (HeadTd) {
     DataTd = HeadTd;
     HeadTd = (TD_DESCRIPTOR *)(UINTN)(HeadTd->NextTDPointer);
-    UsbHcFreeMem(Ohc->MemPool, DataTd, sizeof(TD_DESCRIPTOR));
+    OhciFreeTD (Ohc, DataTd);
   }
 
 //FREE_OHCI_EDBUFF:
@@ -1127,7 +1102,7 @@ FREE_OHCI_TDBUFF:
       HeadEd = (ED_DESCRIPTOR *)(UINTN)(HeadEd->NextED);
     }
   HeadEd->NextED = Ed->NextED;
-    UsbHcFreeMem(Ohc->MemPool, Ed, sizeof(ED_DESCRIPTOR));
+    OhciFreeED (Ohc, Ed);
   }
 
 UNMAP_OHCI_XBUFF:
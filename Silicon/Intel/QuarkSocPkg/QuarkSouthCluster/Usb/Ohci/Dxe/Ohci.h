@@ -71,6 +71,17 @@ struct _USB_OHCI_HC_DEV {
   ED_DESCRIPTOR             *IntervalList[6][32];
   INTERRUPT_CONTEXT_ENTRY   *InterruptContextList;
   VOID                      *MemPool;
+  //
+  // TDs and EDs are recycled through these free lists instead of
+  // being returned to MemPool after every transfer.
+  //
+  TD_DESCRIPTOR             *FreeTdList;
+  ED_DESCRIPTOR             *FreeEdList;
+  //
+  // Bulk EDs stay on the bulk list for the life of the controller,
+  // one per endpoint, each ending in a dummy TD.
+  //
+  ED_DESCRIPTOR             *BulkEdList;
 
   UINT32                    ToggleFlag;
 
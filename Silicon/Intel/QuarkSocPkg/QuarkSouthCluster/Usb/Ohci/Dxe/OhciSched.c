@@ -77,7 +77,7 @@ OhciFreeInterruptContextEntry (
   while (Entry->DataTd) {
     Td = Entry->DataTd;
     Entry->DataTd = (TD_DESCRIPTOR *)(UINTN)(Entry->DataTd->NextTDPointer);
-    UsbHcFreeMem(Ohc->MemPool, Td, sizeof(TD_DESCRIPTOR));
+    OhciFreeTD (Ohc, Td);
   }
   FreePool(Entry);
   return EFI_SUCCESS;
@@ -28,6 +28,19 @@ OhciCreateTD (
   )
 {
   TD_DESCRIPTOR           *Td;
+  EFI_TPL                 OriginalTPL;
+
+  OriginalTPL = gBS->RaiseTPL (TPL_NOTIFY);
+  Td = Ohc->FreeTdList;
+  if (Td != NULL) {
+    Ohc->FreeTdList = (TD_DESCRIPTOR *)(UINTN)(Td->NextTDPointer);
+  }
+  gBS->RestoreTPL (OriginalTPL);
+
+  if (Td != NULL) {
+    ZeroMem (Td, sizeof (TD_DESCRIPTOR));
+    return Td;
+  }
 
   Td = UsbHcAllocateMem(Ohc->MemPool, sizeof(TD_DESCRIPTOR));
   if (Td == NULL) {
@@ -59,10 +72,16 @@ OhciFreeTD (
   IN TD_DESCRIPTOR        *Td
   )
 {
+  EFI_TPL                 OriginalTPL;
+
   if (Td == NULL) {
     return EFI_SUCCESS;
   }
-  UsbHcFreeMem(Ohc->MemPool, Td, sizeof(TD_DESCRIPTOR));
+
+  OriginalTPL = gBS->RaiseTPL (TPL_NOTIFY);
+  Td->NextTDPointer = (UINT32)(UINTN)Ohc->FreeTdList;
+  Ohc->FreeTdList = Td;
+  gBS->RestoreTPL (OriginalTPL);
 
   return EFI_SUCCESS;
 }
@@ -83,10 +102,23 @@ OhciCreateED (
   )
 {
   ED_DESCRIPTOR   *Ed;
-  Ed = UsbHcAllocateMem(Ohc->MemPool, sizeof (ED_DESCRIPTOR));
-  if (Ed == NULL) {
-    DEBUG ((EFI_D_INFO, "STV allocate ED fail !\r\n"));
-    return NULL;
+  EFI_TPL         OriginalTPL;
+
+  OriginalTPL = gBS->RaiseTPL (TPL_NOTIFY);
+  Ed = Ohc->FreeEdList;
+  if (Ed != NULL) {
+    Ohc->FreeEdList = (ED_DESCRIPTOR *)(UINTN)(Ed->NextED);
+  }
+  gBS->RestoreTPL (OriginalTPL);
+
+  if (Ed != NULL) {
+    ZeroMem (Ed, sizeof (ED_DESCRIPTOR));
+  } else {
+    Ed = UsbHcAllocateMem(Ohc->MemPool, sizeof (ED_DESCRIPTOR));
+    if (Ed == NULL) {
+      DEBUG ((EFI_D_INFO, "STV allocate ED fail !\r\n"));
+      return NULL;
+    }
   }
   Ed->Word0.Skip = 1;
   Ed->TdTailPointer = 0;
@@ -113,10 +145,16 @@ OhciFreeED (
   IN ED_DESCRIPTOR        *Ed
   )
 {
+  EFI_TPL                 OriginalTPL;
+
   if (Ed == NULL) {
     return EFI_SUCCESS;
   }
-  UsbHcFreeMem(Ohc->MemPool, Ed, sizeof(ED_DESCRIPTOR));
+
+  OriginalTPL = gBS->RaiseTPL (TPL_NOTIFY);
+  Ed->NextED = (UINT32)(UINTN)Ohc->FreeEdList;
+  Ohc->FreeEdList = Ed;
+  gBS->RestoreTPL (OriginalTPL);
 
   return EFI_SUCCESS;
 }
@@ -159,6 +197,105 @@ OhciFreeAllTDFromED (
   return EFI_SUCCESS;
 }
 
+/**
+
+  Find the bulk ED of an endpoint, creating it and appending it
+  to the bulk list on first use
+
+  @Param  Ohc                   UHC private data
+  @Param  DeviceAddress         Device address of the endpoint
+  @Param  EndPointNum           End point num of the endpoint
+  @Param  EdDir                 ED_IN_DIR or ED_OUT_DIR
+
+  @retval                       ED of the endpoint, NULL if out of resources
+
+**/
+ED_DESCRIPTOR *
+OhciGetBulkEd (
+  IN USB_OHCI_HC_DEV     *Ohc,
+  IN UINT8               DeviceAddress,
+  IN UINT8               EndPointNum,
+  IN UINT8               EdDir
+  )
+{
+  ED_DESCRIPTOR           *Ed;
+  ED_DESCRIPTOR           *LastEd;
+  TD_DESCRIPTOR           *DummyTd;
+
+  LastEd = NULL;
+  for (Ed = Ohc->BulkEdList; Ed != NULL; Ed = (ED_DESCRIPTOR *)(UINTN)(Ed->NextED)) {
+    if (Ed->Word0.FunctionAddress == DeviceAddress && Ed->Word0.EndPointNum == EndPointNum &&
+        Ed->Word0.Direction == EdDir) {
+      return Ed;
+    }
+    LastEd = Ed;
+  }
+
+  Ed = OhciCreateED (Ohc);
+  if (Ed == NULL) {
+    return NULL;
+  }
+  DummyTd = OhciCreateTD (Ohc);
+  if (DummyTd == NULL) {
+    OhciFreeED (Ohc, Ed);
+    return NULL;
+  }
+
+  OhciSetEDField (Ed, ED_SKIP, 1);
+  OhciSetEDField (Ed, ED_FUNC_ADD, DeviceAddress);
+  OhciSetEDField (Ed, ED_ENDPT_NUM, EndPointNum);
+  OhciSetEDField (Ed, ED_DIR, EdDir);
+  OhciSetEDField (Ed, ED_SPEED, HI_SPEED);
+  OhciSetEDField (Ed, ED_FORMAT | ED_HALTED | ED_DTTOGGLE, 0);
+  OhciSetEDField (Ed, ED_PDATA, 0);
+  OhciSetEDField (Ed, ED_ZERO, 0);
+  OhciSetEDField (Ed, ED_TDHEAD_PTR, (UINT32)(UINTN)DummyTd);
+  OhciSetEDField (Ed, ED_TDTAIL_PTR, (UINT32)(UINTN)DummyTd);
+  OhciSetEDField (Ed, ED_NEXT_EDPTR, 0);
+
+  if (LastEd == NULL) {
+    //
+    // HcBulkHeadED is only changed with the bulk list disabled.
+    //
+    OhciSetHcControl (Ohc, BULK_ENABLE, 0);
+    gBS->Stall (1000);
+    OhciSetMemoryPointer (Ohc, HC_BULK_HEAD, Ed);
+    OhciSetHcControl (Ohc, BULK_ENABLE, 1);
+    Ohc->BulkEdList = Ed;
+  } else {
+    //
+    // An ED may be linked at the end of a live list at any time.
+    //
+    LastEd->NextED = (UINT32)(UINTN)Ed;
+  }
+
+  return Ed;
+}
+
+/**
+
+  Free all bulk EDs and their TDs. The bulk list must not be in
+  use by the host controller.
+
+  @Param  Ohc                   UHC private data
+
+**/
+VOID
+OhciFreeBulkEdList (
+  IN USB_OHCI_HC_DEV     *Ohc
+  )
+{
+  ED_DESCRIPTOR           *Ed;
+
+  while (Ohc->BulkEdList != NULL) {
+    Ed = Ohc->BulkEdList;
+    Ohc->BulkEdList = (ED_DESCRIPTOR *)(UINTN)(Ed->NextED);
+    OhciFreeAllTDFromED (Ohc, Ed);
+    OhciFreeTD (Ohc, (TD_DESCRIPTOR *)(UINTN)(Ed->TdTailPointer));
+    OhciFreeED (Ohc, Ed);
+  }
+}
+
 /**
 
   Find a working ED match the requirement
@@ -97,6 +97,40 @@ OhciFreeAllTDFromED (
   IN ED_DESCRIPTOR        *Ed
   );
 
+/**
+
+  Find the bulk ED of an endpoint, creating it and appending it
+  to the bulk list on first use
+
+  @Param  Ohc                   UHC private data
+  @Param  DeviceAddress         Device address of the endpoint
+  @Param  EndPointNum           End point num of the endpoint
+  @Param  EdDir                 ED_IN_DIR or ED_OUT_DIR
+
+  @retval                       ED of the endpoint, NULL if out of resources
+
+**/
+ED_DESCRIPTOR *
+OhciGetBulkEd (
+  IN USB_OHCI_HC_DEV     *Ohc,
+  IN UINT8               DeviceAddress,
+  IN UINT8               EndPointNum,
+  IN UINT8               EdDir
+  );
+
+/**
+
+  Free all bulk EDs and their TDs. The bulk list must not be in
+  use by the host controller.
+
+  @Param  Ohc                   UHC private data
+
+**/
+VOID
+OhciFreeBulkEdList (
+  IN USB_OHCI_HC_DEV     *Ohc
+  );
+
 /**
 
   Find a working ED match the requirement
@@ -272,6 +272,29 @@ typedef struct {
 
 FIT_TABLE_CONTEXT   gFitTableContext = {0};
 
+//
+// Index of all the FFS files of a buffer, sorted by name, so that the FV
+// headers and FFS files are only walked once no matter how many GUIDs are
+// looked up in the buffer.
+//
+typedef struct {
+  EFI_GUID                    Name;
+  UINT32                      Order;    // Position in the FV walk, first match wins
+  UINT8                       *FileData;
+  UINT32                      FileSize;
+  EFI_FIRMWARE_VOLUME_HEADER  *FvHeader;
+} FFS_FILE_INDEX_ENTRY;
+
+typedef struct {
+  UINT8                       *Buffer;
+  UINT32                      BufferSize;
+  UINT32                      Count;
+  UINT32                      MaxCount;
+  FFS_FILE_INDEX_ENTRY        *Entry;
+} FFS_FILE_INDEX;
+
+FFS_FILE_INDEX      gFfsFileIndex = {0};
+
 unsigned int
 xtoi (
   char  *str
@@ -494,6 +517,10 @@ Returns:
   fseek (FpIn, 0, SEEK_END);
   *FileSize = ftell (FpIn);
   //
+  // A new buffer may reuse the address of a freed one, drop the FFS index.
+  //
+  gFfsFileIndex.Buffer = NULL;
+  //
   // Read the contents of input file to memory buffer
   //
   if (FileBufferRaw != NULL) {
@@ -601,108 +628,237 @@ FindNextFvHeader (
   return NULL;
 }
 
-UINT8  *
-FindFileFromFvByGuid (
+int
+CompareFfsFileIndexEntry (
+  IN CONST VOID  *Left,
+  IN CONST VOID  *Right
+  )
+/*++
+
+Routine Description:
+
+  qsort()/bsearch() callback ordering FFS_FILE_INDEX_ENTRY by name, then by walk order
+
+--*/
+{
+  CONST FFS_FILE_INDEX_ENTRY  *LeftEntry;
+  CONST FFS_FILE_INDEX_ENTRY  *RightEntry;
+  int                         Result;
+
+  LeftEntry  = (CONST FFS_FILE_INDEX_ENTRY *)Left;
+  RightEntry = (CONST FFS_FILE_INDEX_ENTRY *)Right;
+  Result = memcmp (&LeftEntry->Name, &RightEntry->Name, sizeof (EFI_GUID));
+  if (Result != 0) {
+    return Result;
+  }
+  if (LeftEntry->Order != RightEntry->Order) {
+    return (LeftEntry->Order < RightEntry->Order) ? -1 : 1;
+  }
+  return 0;
+}
+
+int
+CompareFfsFileIndexName (
+  IN CONST VOID  *Key,
+  IN CONST VOID  *Entry
+  )
+/*++
+
+Routine Description:
+
+  bsearch() callback comparing a GUID with the name of an FFS_FILE_INDEX_ENTRY
+
+--*/
+{
+  return memcmp (Key, &((CONST FFS_FILE_INDEX_ENTRY *)Entry)->Name, sizeof (EFI_GUID));
+}
+
+STATUS
+BuildFfsFileIndex (
   IN UINT8     *FvBuffer,
-  IN UINT32    FvSize,
-  IN EFI_GUID  *Guid,
-  OUT UINT32   *FileSize
+  IN UINT32    FvSize
   )
 /*++
 
 Routine Description:
 
-  Find File with GUID in an FV
+  Walk all the FVs in a buffer once, and index their FFS files by name.
+  The index of the previous buffer is dropped.
 
 Arguments:
 
   FvBuffer       - FV binary buffer
   FvSize         - FV size
-  Guid           - File GUID value to be searched
-  FileSize       - Guid File size
 
 Returns:
 
-  FileLocation   - Guid File location.
-  NULL           - Guid File is not found.
+  STATUS_SUCCESS - The buffer is indexed
+  STATUS_ERROR   - No sufficient memory
 
 --*/
 {
   EFI_FIRMWARE_VOLUME_HEADER  *FvHeader;
   EFI_FFS_FILE_HEADER         *FileHeader;
   UINT64                      FvLength;
-  EFI_GUID                    *TempGuid;
-  UINT8                       *FixPoint;
+  FFS_FILE_INDEX_ENTRY        *Entry;
   UINTN                       Offset;
   UINTN                       FileLength;
   UINTN                       FileOccupiedSize;
 
-  //
-  // Find the FFS file
-  //
+  gFfsFileIndex.Buffer     = NULL;
+  gFfsFileIndex.BufferSize = 0;
+  gFfsFileIndex.Count      = 0;
+
   FvHeader = (EFI_FIRMWARE_VOLUME_HEADER *)FindNextFvHeader (FvBuffer, FvSize);
-  if (NULL == FvHeader) {
-    return NULL;
-  }
-  while (TRUE) {
+  while (FvHeader != NULL) {
     FvLength         = FvHeader->FvLength;
-
-    //
-    // Prepare to walk the FV image
-    //
-    InitializeFvLib (FvHeader, (UINT32)FvLength);
-
     FileHeader       = (EFI_FFS_FILE_HEADER *)((UINTN)FvHeader + FvHeader->HeaderLength);
     Offset           = (UINTN) FileHeader - (UINTN) FvHeader;
 
     while (Offset < FvLength) {
-      TempGuid = (EFI_GUID *)&(FileHeader->Name);
       FileLength = (*(UINT32 *)(FileHeader->Size)) & 0x00FFFFFF;
       FileOccupiedSize = GETOCCUPIEDSIZE(FileLength, 8);
-      if ((CompareGuid (TempGuid, Guid)) == 0) {
-        //
-        // Good! Find it.
-        //
-        FixPoint = ((UINT8 *)FileHeader + sizeof(EFI_FFS_FILE_HEADER));
-        //
-        // Find the position of file module, the offset
-        // between the position and the end of FvRecovery.fv file
-        // should not exceed 128kB to prevent reset vector from
-        // outside legacy E and F segment
-        //
-        if ((UINTN)FvHeader + FvLength - (UINTN)FixPoint > 0x20000) {
-  //        printf ("WARNING: The position of file module is not in E and F segment!\n");
-  //        return NULL;
-        }
-        *FileSize = FileLength - sizeof(EFI_FFS_FILE_HEADER);
-  #if (PI_SPECIFICATION_VERSION < 0x00010000)
-        if (FileHeader->Attributes & FFS_ATTRIB_TAIL_PRESENT) {
-          *FileSize -= sizeof(EFI_FFS_FILE_TAIL);
+
+      if (gFfsFileIndex.Count == gFfsFileIndex.MaxCount) {
+        Entry = (FFS_FILE_INDEX_ENTRY *) realloc (
+                                           gFfsFileIndex.Entry,
+                                           (gFfsFileIndex.MaxCount + 0x100) * sizeof (FFS_FILE_INDEX_ENTRY)
+                                           );
+        if (Entry == NULL) {
+          Error (NULL, 0, 0, "No sufficient memory to allocate!", NULL);
+          gFfsFileIndex.Count = 0;
+          return STATUS_ERROR;
         }
-  #endif
-        return FixPoint;
+        gFfsFileIndex.Entry     = Entry;
+        gFfsFileIndex.MaxCount += 0x100;
+      }
+      Entry = &gFfsFileIndex.Entry[gFfsFileIndex.Count];
+      memcpy (&Entry->Name, &FileHeader->Name, sizeof (EFI_GUID));
+      Entry->Order    = gFfsFileIndex.Count;
+      Entry->FileData = (UINT8 *)FileHeader + sizeof(EFI_FFS_FILE_HEADER);
+      Entry->FileSize = (UINT32)(FileLength - sizeof(EFI_FFS_FILE_HEADER));
+#if (PI_SPECIFICATION_VERSION < 0x00010000)
+      if (FileHeader->Attributes & FFS_ATTRIB_TAIL_PRESENT) {
+        Entry->FileSize -= sizeof(EFI_FFS_FILE_TAIL);
       }
+#endif
+      Entry->FvHeader = FvHeader;
+      gFfsFileIndex.Count++;
+
       FileHeader = (EFI_FFS_FILE_HEADER *)((UINTN)FileHeader + FileOccupiedSize);
       Offset = (UINTN) FileHeader - (UINTN) FvHeader;
     }
 
     //
-    // Not found, check next FV
+    // Next FV
     //
     if ((UINTN)FvBuffer + FvSize > (UINTN)FvHeader + FvLength) {
       FvHeader = (EFI_FIRMWARE_VOLUME_HEADER *)FindNextFvHeader ((UINT8 *)FvHeader + (UINTN)FvLength, (UINTN)FvBuffer + FvSize - ((UINTN)FvHeader + (UINTN)FvLength));
-      if (FvHeader == NULL) {
-        break;
-      }
     } else {
-      break;
+      FvHeader = NULL;
     }
   }
 
+  if (gFfsFileIndex.Count != 0) {
+    qsort (gFfsFileIndex.Entry, gFfsFileIndex.Count, sizeof (FFS_FILE_INDEX_ENTRY), CompareFfsFileIndexEntry);
+  }
+  gFfsFileIndex.Buffer     = FvBuffer;
+  gFfsFileIndex.BufferSize = FvSize;
+  return STATUS_SUCCESS;
+}
+
+FFS_FILE_INDEX_ENTRY *
+FindFfsFileIndexEntry (
+  IN UINT8     *FvBuffer,
+  IN UINT32    FvSize,
+  IN EFI_GUID  *Guid
+  )
+/*++
+
+Routine Description:
+
+  Find the first FFS file with GUID in the FVs of a buffer, indexing the
+  buffer if it is not the one indexed last.
+
+Arguments:
+
+  FvBuffer       - FV binary buffer
+  FvSize         - FV size
+  Guid           - File GUID value to be searched
+
+Returns:
+
+  Entry          - The index entry of the file.
+  NULL           - Guid File is not found.
+
+--*/
+{
+  FFS_FILE_INDEX_ENTRY        *Entry;
+
+  if ((gFfsFileIndex.Buffer != FvBuffer) || (gFfsFileIndex.BufferSize != FvSize)) {
+    if (BuildFfsFileIndex (FvBuffer, FvSize) != STATUS_SUCCESS) {
+      return NULL;
+    }
+  }
+  if (gFfsFileIndex.Count == 0) {
+    return NULL;
+  }
+
+  Entry = (FFS_FILE_INDEX_ENTRY *) bsearch (
+                                     Guid,
+                                     gFfsFileIndex.Entry,
+                                     gFfsFileIndex.Count,
+                                     sizeof (FFS_FILE_INDEX_ENTRY),
+                                     CompareFfsFileIndexName
+                                     );
+  if (Entry == NULL) {
+    return NULL;
+  }
   //
-  // Not found
+  // Return the first one in the FV walk, as the linear search did.
   //
-  return NULL;
+  while ((Entry > gFfsFileIndex.Entry) && (CompareFfsFileIndexName (Guid, Entry - 1) == 0)) {
+    Entry--;
+  }
+  return Entry;
+}
+
+UINT8  *
+FindFileFromFvByGuid (
+  IN UINT8     *FvBuffer,
+  IN UINT32    FvSize,
+  IN EFI_GUID  *Guid,
+  OUT UINT32   *FileSize
+  )
+/*++
+
+Routine Description:
+
+  Find File with GUID in an FV
+
+Arguments:
+
+  FvBuffer       - FV binary buffer
+  FvSize         - FV size
+  Guid           - File GUID value to be searched
+  FileSize       - Guid File size
+
+Returns:
+
+  FileLocation   - Guid File location.
+  NULL           - Guid File is not found.
+
+--*/
+{
+  FFS_FILE_INDEX_ENTRY        *Entry;
+
+  Entry = FindFfsFileIndexEntry (FvBuffer, FvSize, Guid);
+  if (Entry == NULL) {
+    return NULL;
+  }
+
+  *FileSize = Entry->FileSize;
+  return Entry->FileData;
 }
 
 BOOLEAN
@@ -2938,47 +3094,30 @@ Returns:
 
 --*/
 {
-  UINT8                         *FileBuffer = NULL;
-  UINT32                        FvRecoveryFileSize =0;
+  FFS_FILE_INDEX_ENTRY          *Entry;
   EFI_GUID                      VTFGuid = EFI_FFS_VOLUME_TOP_FILE_GUID;
-  UINT32                        FvLength;
-  UINT32                        FileLength;
 
   *FvRecovery = NULL;
-  FileBuffer = FindNextFvHeader (FdBuffer, FdFileSize);
-  if (FileBuffer == NULL) {
-    return 0;
-  }
-
-  while ((UINTN)FileBuffer < (UINTN)FdBuffer + FdFileSize) {
-    FvLength         = (UINT32)((EFI_FIRMWARE_VOLUME_HEADER *)FileBuffer)->FvLength;
-
-    if (FindFileFromFvByGuid (FileBuffer, FvLength, &VTFGuid, &FileLength) != NULL) {
-      //
-      // Found the VTF
-      //
-      FvRecoveryFileSize = FvLength;
-      *FvRecovery = FileBuffer;
-    }
-
-    //
-    // Next fv
-    //
-    FileBuffer = (UINT8 *)FileBuffer + FvLength;
-    if ((UINTN)FileBuffer >= (UINTN)FdBuffer + FdFileSize) {
-      break;
-    }
-    FileBuffer = FindNextFvHeader (FileBuffer, (UINTN)FdBuffer + FdFileSize - (UINTN)FileBuffer);
-    if (FileBuffer == NULL) {
-      break;
-    }
 
+  //
+  // Use the index of the whole FD rather than searching each FV on its own,
+  // so that the FD index built for the other lookups is not thrown away.
+  //
+  Entry = FindFfsFileIndexEntry (FdBuffer, FdFileSize, &VTFGuid);
+  if (Entry == NULL) {
+    return 0;
   }
 
   //
-  // Return
+  // Entries with the same name are sorted by walk order, the FvRecovery is the
+  // last FV that holds a VTF.
   //
-  return FvRecoveryFileSize;
+  while ((Entry + 1 < gFfsFileIndex.Entry + gFfsFileIndex.Count) && (CompareFfsFileIndexName (&VTFGuid, Entry + 1) == 0)) {
+    Entry++;
+  }
+
+  *FvRecovery = (UINT8 *)Entry->FvHeader;
+  return (UINT32)Entry->FvHeader->FvLength;
 }
 
 UINT32
@@ -37,10 +37,17 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #define MAIN_HDR_MAGIC        0xB105B002
 
+//
+// The image is streamed from the file in chunks of this size. Each chunk is
+// compared with the device, programmed only if it differs and read back.
+//
+#define FUPDATE_CHUNK_SIZE    SIZE_64KB
+
 STATIC EFI_DEVICE_PATH_FROM_TEXT_PROTOCOL  *EfiDevicePathFromTextProtocol;
 STATIC MARVELL_SPI_MASTER_PROTOCOL         *SpiMasterProtocol;
 STATIC MARVELL_SPI_FLASH_PROTOCOL          *SpiFlashProtocol;
 STATIC EFI_BLOCK_IO_PROTOCOL               *BlkIo;
+STATIC SPI_DEVICE                          *SpiFlash;
 
 STATIC CONST CHAR16 gShellFUpdateFileName[] = L"ShellCommands";
 STATIC EFI_HANDLE gShellFUpdateHiiHandle = NULL;
@@ -79,9 +86,12 @@ typedef struct {              // Bytes
 typedef
 EFI_STATUS
 (EFIAPI *FLASH_COMMAND) (
-  UINT64           FileSize,
-  UINTN            *FileBuffer,
-  EFI_LBA          Offset
+  UINT64           ImageOffset,
+  UINTN            ChunkSize,
+  UINT8            *ChunkBuffer,
+  UINT8            *VerifyBuffer,
+  EFI_LBA          Offset,
+  BOOLEAN          *Programmed
 );
 
 STATIC
@@ -260,12 +270,18 @@ ListSupportedDevices (
 STATIC
 EFI_STATUS
 CheckImageHeader (
-  IN OUT UINTN *ImageHeader
+  IN OUT UINTN *ImageHeader,
+  IN     UINTN  BufferSize
   )
 {
   MV_FIRMWARE_IMAGE_HEADER *Header;
   UINT32 HeaderLength, Checksum, ChecksumBackup;
 
+  if (BufferSize < sizeof (MV_FIRMWARE_IMAGE_HEADER)) {
+    Print (L"%s: Image too small\n", CMD_NAME_STRING);
+    return EFI_DEVICE_ERROR;
+  }
+
   Header = (MV_FIRMWARE_IMAGE_HEADER *)ImageHeader;
   HeaderLength = Header->PrologSize;
   ChecksumBackup = Header->PrologChecksum;
@@ -276,6 +292,12 @@ CheckImageHeader (
     return EFI_DEVICE_ERROR;
   }
 
+  // The whole prolog has to be in the first chunk of the image
+  if (HeaderLength > BufferSize || HeaderLength % sizeof (UINT32) != 0) {
+    Print (L"%s: Bad Image prolog size 0x%x\n", CMD_NAME_STRING, HeaderLength);
+    return EFI_DEVICE_ERROR;
+  }
+
   // The checksum field is discarded from calculation
   Header->PrologChecksum = 0;
 
@@ -296,16 +318,12 @@ EFI_STATUS
 PrepareFirmwareImage (
   IN LIST_ENTRY             *CheckPackage,
   IN OUT SHELL_FILE_HANDLE  *FileHandle,
-  IN OUT UINTN              **FileBuffer,
-  IN OUT UINT64             *FileSize,
-  IN UINT64                 Alignment
+  IN OUT UINT64             *FileSize
   )
 {
   CONST CHAR16         *FileStr;
   EFI_STATUS           Status;
   UINT64               OpenMode;
-  UINTN                *Buffer;
-  UINTN                AlignedFileSize;
 
   // Parse string from commandline
   FileStr = ShellCommandLineGetRawValue (CheckPackage, 1);
@@ -332,63 +350,57 @@ PrepareFirmwareImage (
   Status = FileHandleGetSize (*FileHandle, FileSize);
     if (EFI_ERROR (Status)) {
       Print (L"%s: Cannot get Image file size\n", CMD_NAME_STRING);
+      ShellCloseFile (FileHandle);
+      return EFI_DEVICE_ERROR;
     }
 
-  // Allocate aligned buffer in case of updating firmware in a BlockDevice
-  if (Alignment > 0) {
-    AlignedFileSize = *FileSize + (Alignment - (*FileSize % Alignment));
-  } else {
-    AlignedFileSize = *FileSize;
-  }
-
-  // Read Image header into buffer
-  Buffer = AllocateZeroPool (AlignedFileSize);
-  if (Buffer == NULL) {
-    Print (L"%s: Fail to allocate buffer\n", CMD_NAME_STRING);
-    ShellCloseFile (FileHandle);
-    return EFI_OUT_OF_RESOURCES;
-  }
-
-  Status = FileHandleRead (*FileHandle, (UINTN *)FileSize, Buffer);
-  if (EFI_ERROR (Status)) {
-    Print (L"%s: Cannot read Image file header\n", CMD_NAME_STRING);
-    ShellCloseFile (FileHandle);
-    FreePool (Buffer);
-    return EFI_DEVICE_ERROR;
-  }
-
-  *FileBuffer = Buffer;
-  *FileSize = AlignedFileSize;
-
   return EFI_SUCCESS;
 }
 
 /**
-  Update firmware image in the block device.
+  Update one chunk of the firmware image in the block device.
 
-  @param[in]   FileSize            Size of the file to be flashed
-  @param[in]  *FileBuffer          Pointer to the file in memory
-  @param[in]   Offset              First logical block to be updated.
+  @param[in]   ImageOffset         Offset of the chunk in the image, in bytes
+  @param[in]   ChunkSize           Size of the chunk, a multiple of the block size
+  @param[in]  *ChunkBuffer         The chunk read from the file
+  @param[in]  *VerifyBuffer        Scratch buffer of ChunkSize bytes
+  @param[in]   Offset              First logical block of the image.
+  @param[out] *Programmed          FALSE if the device already held the chunk
 
 **/
 STATIC
 EFI_STATUS
 EFIAPI
 ProgramBlockDevice (
-  IN UINT64      FileSize,
-  IN UINTN      *FileBuffer,
-  IN EFI_LBA     Offset
+  IN UINT64      ImageOffset,
+  IN UINTN       ChunkSize,
+  IN UINT8      *ChunkBuffer,
+  IN UINT8      *VerifyBuffer,
+  IN EFI_LBA     Offset,
+  OUT BOOLEAN   *Programmed
   )
 {
   EFI_STATUS     Status;
+  EFI_LBA        Lba;
 
-  Print (L"Updating image in BlockDevice\n");
+  Lba = Offset + DivU64x32 (ImageOffset, BlkIo->Media->BlockSize);
+  *Programmed = FALSE;
+
+  Status = BlkIo->ReadBlocks (BlkIo,
+                    BlkIo->Media->MediaId,
+                    Lba,
+                    ChunkSize,
+                    VerifyBuffer);
+  if (!EFI_ERROR (Status) &&
+      CompareMem (VerifyBuffer, ChunkBuffer, ChunkSize) == 0) {
+    return EFI_SUCCESS;
+  }
 
   Status = BlkIo->WriteBlocks (BlkIo,
                     BlkIo->Media->MediaId,
-                    Offset,
-                    FileSize,
-                    FileBuffer);
+                    Lba,
+                    ChunkSize,
+                    ChunkBuffer);
   if (EFI_ERROR (Status)) {
     Print (L"%s: Cannot write to device (Status: %r)\n",
       CMD_NAME_STRING,
@@ -403,30 +415,38 @@ ProgramBlockDevice (
       Status);
     return Status;
   }
+  *Programmed = TRUE;
+
+  Status = BlkIo->ReadBlocks (BlkIo,
+                    BlkIo->Media->MediaId,
+                    Lba,
+                    ChunkSize,
+                    VerifyBuffer);
+  if (EFI_ERROR (Status)) {
+    Print (L"%s: Cannot read back from device (Status: %r)\n",
+      CMD_NAME_STRING,
+      Status);
+    return Status;
+  }
+
+  if (CompareMem (VerifyBuffer, ChunkBuffer, ChunkSize) != 0) {
+    Print (L"%s: Verification failed at LBA 0x%lx\n", CMD_NAME_STRING, Lba);
+    return EFI_DEVICE_ERROR;
+  }
 
   return EFI_SUCCESS;
 }
 
-
 /**
-  Update firmware image in the SPI flash.
-
-  @param[in]   FileSize            Size of the file to be flashed
-  @param[in]  *FileBuffer          Pointer to the file in memory
-  @param[in]   Offset              First logical block to be updated.
-                                   Irrelevant for SPI.
+  Locate, set up and probe the SPI flash for the firmware update.
 
 **/
 STATIC
 EFI_STATUS
-EFIAPI
-ProgramSpiFlash (
-  IN UINT64      FileSize,
-  IN UINTN      *FileBuffer,
-  IN EFI_LBA     Offset
+PrepareSpiFlash (
+  VOID
   )
 {
-  SPI_DEVICE    *SpiFlash;
   EFI_STATUS     Status;
 
   // Locate SPI protocols
@@ -460,26 +480,201 @@ ProgramSpiFlash (
   Status = SpiFlashProbe (SpiFlash);
   if (EFI_ERROR (Status)) {
     Print (L"%s: Error while performing SPI flash probe\n", CMD_NAME_STRING);
-    goto FlashProbeError;
+    SpiMasterProtocol->FreeDevice (SpiFlash);
+    SpiFlash = NULL;
+    return Status;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Update one chunk of the firmware image in the SPI flash.
+
+  @param[in]   ImageOffset         Offset of the chunk in the image, in bytes
+  @param[in]   ChunkSize           Size of the chunk
+  @param[in]  *ChunkBuffer         The chunk read from the file
+  @param[in]  *VerifyBuffer        Scratch buffer of ChunkSize bytes
+  @param[in]   Offset              First logical block to be updated.
+                                   Irrelevant for SPI.
+  @param[out] *Programmed          FALSE if the flash already held the chunk
+
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+ProgramSpiFlash (
+  IN UINT64      ImageOffset,
+  IN UINTN       ChunkSize,
+  IN UINT8      *ChunkBuffer,
+  IN UINT8      *VerifyBuffer,
+  IN EFI_LBA     Offset,
+  OUT BOOLEAN   *Programmed
+  )
+{
+  EFI_STATUS     Status;
+
+  *Programmed = FALSE;
+
+  Status = SpiFlashProtocol->Read (SpiFlash,
+                               (UINT32)ImageOffset,
+                               ChunkSize,
+                               VerifyBuffer);
+  if (!EFI_ERROR (Status) &&
+      CompareMem (VerifyBuffer, ChunkBuffer, ChunkSize) == 0) {
+    return EFI_SUCCESS;
   }
 
-  // Update firmware image in flash at offset 0x0
-  Status = SpiFlashProtocol->Update (SpiFlash,
-                               0x0,
-                               FileSize,
-                               (UINT8 *)FileBuffer);
+  // Update firmware image in flash, the image starts at offset 0x0
+  Status = SpiFlashProtocol->UpdateWithProgress (SpiFlash,
+                               (UINT32)ImageOffset,
+                               ChunkSize,
+                               ChunkBuffer,
+                               NULL,
+                               0,
+                               0);
   if (EFI_ERROR (Status)) {
     Print (L"%s: Error while performing flash update\n", CMD_NAME_STRING);
-    goto FlashProbeError;
+    return Status;
+  }
+  *Programmed = TRUE;
+
+  Status = SpiFlashProtocol->Read (SpiFlash,
+                               (UINT32)ImageOffset,
+                               ChunkSize,
+                               VerifyBuffer);
+  if (EFI_ERROR (Status)) {
+    Print (L"%s: Error while reading back flash\n", CMD_NAME_STRING);
+    return Status;
   }
 
-  // Release resources
-  SpiMasterProtocol->FreeDevice (SpiFlash);
+  if (CompareMem (VerifyBuffer, ChunkBuffer, ChunkSize) != 0) {
+    Print (L"%s: Verification failed at offset 0x%lx\n", CMD_NAME_STRING, ImageOffset);
+    return EFI_DEVICE_ERROR;
+  }
 
   return EFI_SUCCESS;
+}
+
+/**
+  Stream the firmware image from the file to the selected device.
 
-FlashProbeError:
-  SpiMasterProtocol->FreeDevice (SpiFlash);
+  The file is read once, chunk by chunk. Every chunk is compared with the
+  device contents first and only programmed if it differs, then read back
+  and verified. Running the same command again after an interrupted update
+  therefore resumes at the first chunk that was not verified.
+
+  @param[in]   FileHandle          Handle of the image file
+  @param[in]   FileSize            Size of the image file
+  @param[in]   FlashCommand        Firmware update command of the device
+  @param[in]   Alignment           Block size of the device, 0 for SPI
+  @param[in]   Offset              First logical block to be updated.
+
+**/
+STATIC
+EFI_STATUS
+StreamFirmwareImage (
+  IN SHELL_FILE_HANDLE      FileHandle,
+  IN UINT64                 FileSize,
+  IN FLASH_COMMAND          FlashCommand,
+  IN UINT64                 Alignment,
+  IN EFI_LBA                Offset
+  )
+{
+  EFI_STATUS           Status;
+  UINT8                *ChunkBuffer;
+  UINT8                *VerifyBuffer;
+  UINT64               ImageOffset;
+  UINTN                ChunkSize;
+  UINTN                ReadSize;
+  UINTN                ProgramSize;
+  UINTN                ProgrammedCount;
+  UINTN                SkippedCount;
+  BOOLEAN              Programmed;
+
+  ChunkSize = FUPDATE_CHUNK_SIZE;
+  if (Alignment > 0 && ChunkSize % Alignment != 0) {
+    ChunkSize = (UINTN)Alignment;
+  }
+  // SPI chunks have to start on an erase sector boundary
+  if (SpiFlash != NULL && SpiFlash->Info->SectorSize > ChunkSize) {
+    ChunkSize = SpiFlash->Info->SectorSize;
+  }
+
+  ChunkBuffer = AllocatePool (ChunkSize);
+  VerifyBuffer = AllocatePool (ChunkSize);
+  if (ChunkBuffer == NULL || VerifyBuffer == NULL) {
+    Print (L"%s: Fail to allocate buffer\n", CMD_NAME_STRING);
+    Status = EFI_OUT_OF_RESOURCES;
+    goto Exit;
+  }
+
+  ProgrammedCount = 0;
+  SkippedCount = 0;
+  Status = EFI_SUCCESS;
+
+  for (ImageOffset = 0; ImageOffset < FileSize; ImageOffset += ChunkSize) {
+    ReadSize = (UINTN)MIN (FileSize - ImageOffset, ChunkSize);
+
+    // Pad the last chunk of a block device image with zeros
+    ZeroMem (ChunkBuffer, ChunkSize);
+    Status = FileHandleRead (FileHandle, &ReadSize, ChunkBuffer);
+    if (EFI_ERROR (Status) || ReadSize != MIN (FileSize - ImageOffset, ChunkSize)) {
+      Print (L"%s: Cannot read Image file\n", CMD_NAME_STRING);
+      Status = EFI_DEVICE_ERROR;
+      break;
+    }
+
+    // Check image checksum and magic before anything is programmed
+    if (ImageOffset == 0) {
+      Status = CheckImageHeader ((UINTN *)ChunkBuffer, ReadSize);
+      if (EFI_ERROR (Status)) {
+        break;
+      }
+    }
+
+    ProgramSize = ReadSize;
+    if (Alignment > 0 && ProgramSize % Alignment != 0) {
+      ProgramSize += (UINTN)(Alignment - (ProgramSize % Alignment));
+    }
+
+    Print (L"   \rUpdating, %d%%", (UINTN)DivU64x64Remainder (MultU64x32 (ImageOffset, 100), FileSize, NULL));
+
+    Status = FlashCommand (ImageOffset,
+               ProgramSize,
+               ChunkBuffer,
+               VerifyBuffer,
+               Offset,
+               &Programmed);
+    if (EFI_ERROR (Status)) {
+      Print (L"\n%s: Update stopped at image offset 0x%lx, run the command again to resume\n",
+        CMD_NAME_STRING,
+        ImageOffset);
+      break;
+    }
+
+    if (Programmed) {
+      ProgrammedCount++;
+    } else {
+      SkippedCount++;
+    }
+  }
+
+  if (!EFI_ERROR (Status)) {
+    Print (L"   \rUpdating, 100%%\n");
+    Print (L"%s: %d chunks programmed, %d chunks already up to date\n",
+      CMD_NAME_STRING,
+      ProgrammedCount,
+      SkippedCount);
+  }
+
+Exit:
+  if (ChunkBuffer != NULL) {
+    FreePool (ChunkBuffer);
+  }
+  if (VerifyBuffer != NULL) {
+    FreePool (VerifyBuffer);
+  }
 
   return Status;
 }
@@ -515,6 +710,10 @@ SelectDevice (
   //
   DeviceName = ShellCommandLineGetRawValue (CheckPackage, 2);
   if (DeviceName == NULL || StrnCmp(DeviceName, L"spi", 4) == 0) {
+    Status = PrepareSpiFlash ();
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
     *FlashCommand = ProgramSpiFlash;
     *Alignment = 0;
     *Offset = 0;
@@ -628,6 +827,9 @@ FUpdateUsage (
          "     fupdate flash.bin -p VenHw(0D51905B-B77E-452A-A2C0-ECA0CC8D514A,000078F20000000000)/SD(0x0)\n"
          " * List supported devices\n"
          "     fupdate list\n"
+         "Chunks of the device that already hold the image are verified and\n"
+         "skipped, so an interrupted update is resumed by running the same\n"
+         "command again.\n"
   );
 }
 
@@ -645,11 +847,10 @@ ShellCommandRunFUpdate (
   EFI_LBA            Offset;
   UINT64             Alignment;
   UINT64             FileSize;
-  UINTN              *FileBuffer;
   CHAR16             *ProblemParam;
   EFI_STATUS         Status;
 
-  FileBuffer = NULL;
+  SpiFlash = NULL;
 
   // Parse command line
   Status = ShellInitialize ();
@@ -681,30 +882,26 @@ ShellCommandRunFUpdate (
     return SHELL_ABORTED;
   }
 
-  // Prepare local file to be burned into flash
-  Status = PrepareFirmwareImage (CheckPackage,
-             &FileHandle,
-             &FileBuffer,
-             &FileSize,
-             Alignment);
+  // Open local file to be burned into flash
+  Status = PrepareFirmwareImage (CheckPackage, &FileHandle, &FileSize);
   if (EFI_ERROR (Status)) {
-    return SHELL_ABORTED;
-  }
-
-  // Check image checksum and magic
-  Status = CheckImageHeader (FileBuffer);
-  if (EFI_ERROR(Status)) {
-    goto HeaderError;
+    goto FileError;
   }
 
   // Update firmware image
-  Status = FlashCommand (FileSize, FileBuffer, Offset);
+  Status = StreamFirmwareImage (FileHandle,
+             FileSize,
+             FlashCommand,
+             Alignment,
+             Offset);
+  ShellCloseFile (&FileHandle);
   if (EFI_ERROR (Status)) {
-    goto HeaderError;
+    goto FileError;
   }
 
-  FreePool (FileBuffer);
-  ShellCloseFile (&FileHandle);
+  if (SpiFlash != NULL) {
+    SpiMasterProtocol->FreeDevice (SpiFlash);
+  }
 
   Print (L"%s: Update %d bytes at offset 0x%x succeeded!\n",
     CMD_NAME_STRING,
@@ -713,9 +910,10 @@ ShellCommandRunFUpdate (
 
   return EFI_SUCCESS;
 
-HeaderError:
-  FreePool (FileBuffer);
-  ShellCloseFile (&FileHandle);
+FileError:
+  if (SpiFlash != NULL) {
+    SpiMasterProtocol->FreeDevice (SpiFlash);
+  }
 
   return SHELL_ABORTED;
 }
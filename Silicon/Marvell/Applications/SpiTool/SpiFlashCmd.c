@@ -19,6 +19,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/ShellCEntryLib.h>
 #include <Library/HiiLib.h>
 #include <Library/FileHandleLib.h>
+#include <Library/TimerLib.h>
 
 #include <Protocol/Spi.h>
 #include <Protocol/SpiFlash.h>
@@ -33,6 +34,13 @@ BOOLEAN InitFlag = 1;
 
 STATIC SPI_DEVICE *mSlave;
 
+//
+// readfile/verifyfile move data through a buffer of this size only
+//
+#define SF_FILE_CHUNK_SIZE   SIZE_64KB
+
+STATIC CONST UINTN mBenchChunkSize[] = { SIZE_4KB, SIZE_64KB, SIZE_1MB };
+
 STATIC CONST SHELL_PARAM_ITEM ParamList[] = {
   {L"read", TypeFlag},
   {L"readfile", TypeFlag},
@@ -41,6 +49,8 @@ STATIC CONST SHELL_PARAM_ITEM ParamList[] = {
   {L"erase", TypeFlag},
   {L"update", TypeFlag},
   {L"updatefile", TypeFlag},
+  {L"verifyfile", TypeFlag},
+  {L"bench", TypeFlag},
   {L"probe", TypeFlag},
   {L"help", TypeFlag},
   {NULL , TypeMax}
@@ -55,6 +65,8 @@ typedef enum {
   ERASE       = 32,
   UPDATE      = 64,
   UPDATE_FILE = 128,
+  VERIFY_FILE = 256,
+  BENCH       = 512,
 } Flags;
 
 /**
@@ -79,12 +91,13 @@ SfUsage (
 {
   Print (L"\nBasic SPI command\n"
          "sf [probe | read | readfile | write | writefile | erase |"
-         "update | updatefile]"
-         "[<Address> | <FilePath>] <Offset> <Length>\n\n"
+         "update | updatefile | verifyfile | bench]"
+         "[<Address> | <FilePath>] <Offset> <Length> [<Mode>]\n\n"
          "Length   - Number of bytes to send\n"
          "Address  - Address in RAM to store/load data\n"
          "FilePath - Path to file to read/write data from/to\n"
          "Offset   - Offset from beginning of SPI flash to store/load data\n"
+         "Mode     - SPI mode (0-3) used by bench, PcdSpiFlashMode by default\n"
          "Examples:\n"
          "Check if there is response from SPI flash\n"
          "  sf probe\n"
@@ -102,6 +115,11 @@ SfUsage (
          "  sf readfile fs2:file.bin 0x0 0x3000 \n"
          "Update data in SPI flash at 0x3000000 from file Linux.efi\n"
          "  sf updatefile Linux.efi 0x3000000\n"
+         "Compare SPI flash at 0x0 with file fs2:flash-image.bin\n"
+         "  sf verifyfile fs2:flash-image.bin 0x0\n"
+         "Measure read/program/erase speed on 0x100000 bytes at 0x3000000 in SPI mode 3\n"
+         "(the sector aligned region is erased and programmed, then restored)\n"
+         "  sf bench 0x3000000 0x100000 3\n"
   );
 }
 
@@ -158,6 +176,252 @@ FlashProbe (
   return SHELL_SUCCESS;
 }
 
+STATIC
+UINT64
+SfElapsedUs (
+  IN UINT64 Start
+  )
+{
+  UINT64 StartValue;
+  UINT64 EndValue;
+  UINT64 Ticks;
+
+  GetPerformanceCounterProperties (&StartValue, &EndValue);
+  if (StartValue > EndValue) {
+    Ticks = Start - GetPerformanceCounter ();
+  } else {
+    Ticks = GetPerformanceCounter () - Start;
+  }
+
+  return MAX (DivU64x32 (GetTimeInNanoSecond (Ticks), 1000), 1);
+}
+
+STATIC
+VOID
+SfPrintSpeed (
+  IN CONST CHAR16 *Operation,
+  IN UINTN        ChunkSize,
+  IN UINTN        ByteCount,
+  IN UINT64       ElapsedUs
+  )
+{
+  Print (L"sf: %-7s chunk %7d: %8ld KB/s (%d bytes in %ld us)\n",
+    Operation,
+    ChunkSize,
+    DivU64x64Remainder (MultU64x32 (ByteCount, 1000000 / SIZE_1KB), ElapsedUs, NULL),
+    ByteCount,
+    ElapsedUs);
+}
+
+/**
+  Copy ByteCount bytes of flash at Offset into a file, SF_FILE_CHUNK_SIZE
+  bytes at a time.
+**/
+STATIC
+EFI_STATUS
+SfReadFile (
+  IN SHELL_FILE_HANDLE FileHandle,
+  IN UINT32            Offset,
+  IN UINTN             ByteCount
+  )
+{
+  EFI_STATUS Status;
+  UINT8      *Buffer;
+  UINTN      Chunk;
+  UINTN      Written;
+
+  Buffer = AllocatePool (SF_FILE_CHUNK_SIZE);
+  if (Buffer == NULL) {
+    Print (L"sf: Cannot allocate memory\n");
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = EFI_SUCCESS;
+  while (ByteCount > 0) {
+    Chunk = MIN (ByteCount, SF_FILE_CHUNK_SIZE);
+    Status = SpiFlashProtocol->Read (mSlave, Offset, Chunk, Buffer);
+    if (EFI_ERROR (Status)) {
+      Print (L"sf: Error while performing spi transfer\n");
+      break;
+    }
+
+    Written = Chunk;
+    Status = FileHandleWrite (FileHandle, &Written, Buffer);
+    if (EFI_ERROR (Status) || (Written != Chunk)) {
+      Print (L"sf: Error while writing into file\n");
+      Status = EFI_DEVICE_ERROR;
+      break;
+    }
+
+    Offset += Chunk;
+    ByteCount -= Chunk;
+  }
+
+  FreePool (Buffer);
+  return Status;
+}
+
+/**
+  Compare the flash content at Offset with a file, SF_FILE_CHUNK_SIZE bytes
+  at a time, and report the first mismatching flash offset.
+**/
+STATIC
+EFI_STATUS
+SfVerifyFile (
+  IN SHELL_FILE_HANDLE FileHandle,
+  IN UINT32            Offset
+  )
+{
+  EFI_STATUS Status;
+  UINT64     FileSize;
+  UINT8      *FileBuffer;
+  UINT8      *FlashBuffer;
+  UINTN      Chunk;
+  UINTN      Index;
+  UINTN      Read;
+
+  Status = FileHandleGetSize (FileHandle, &FileSize);
+  if (EFI_ERROR (Status)) {
+    Print (L"sf: Cannot get file size\n");
+    return Status;
+  }
+
+  FileBuffer = AllocatePool (SF_FILE_CHUNK_SIZE);
+  FlashBuffer = AllocatePool (SF_FILE_CHUNK_SIZE);
+  if ((FileBuffer == NULL) || (FlashBuffer == NULL)) {
+    Print (L"sf: Cannot allocate memory\n");
+    Status = EFI_OUT_OF_RESOURCES;
+    goto Exit;
+  }
+
+  while (FileSize > 0) {
+    Chunk = (UINTN)MIN (FileSize, SF_FILE_CHUNK_SIZE);
+    Read = Chunk;
+    Status = FileHandleRead (FileHandle, &Read, FileBuffer);
+    if (EFI_ERROR (Status) || (Read != Chunk)) {
+      Print (L"sf: Read from file error\n");
+      Status = EFI_DEVICE_ERROR;
+      goto Exit;
+    }
+
+    Status = SpiFlashProtocol->Read (mSlave, Offset, Chunk, FlashBuffer);
+    if (EFI_ERROR (Status)) {
+      Print (L"sf: Error while performing spi transfer\n");
+      goto Exit;
+    }
+
+    if (CompareMem (FileBuffer, FlashBuffer, Chunk) != 0) {
+      for (Index = 0; FileBuffer[Index] == FlashBuffer[Index]; Index++);
+      Print (L"sf: Verify failed at offset 0x%x: flash 0x%02x, file 0x%02x\n",
+        Offset + Index, FlashBuffer[Index], FileBuffer[Index]);
+      Status = EFI_CRC_ERROR;
+      goto Exit;
+    }
+
+    Offset += Chunk;
+    FileSize -= Chunk;
+  }
+
+Exit:
+  if (FileBuffer != NULL) {
+    FreePool (FileBuffer);
+  }
+  if (FlashBuffer != NULL) {
+    FreePool (FlashBuffer);
+  }
+  return Status;
+}
+
+/**
+  Measure read, erase and program throughput of a sector aligned flash region
+  for each chunk size. The program passes write back the original content of
+  the region, so it is left as found.
+**/
+STATIC
+EFI_STATUS
+SfBench (
+  IN UINT32 Offset,
+  IN UINTN  ByteCount
+  )
+{
+  EFI_STATUS Status;
+  UINT8      *Original;
+  UINT64     Start;
+  UINTN      ChunkSize;
+  UINTN      Done;
+  UINTN      Chunk;
+  UINTN      Index;
+  UINT32     SectorSize;
+
+  SectorSize = mSlave->Info->SectorSize;
+  if ((ByteCount == 0) || (Offset % SectorSize) != 0 || (ByteCount % SectorSize) != 0) {
+    Print (L"sf: Bench region must be a multiple of the 0x%x sector size\n", SectorSize);
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Original = AllocatePool (ByteCount);
+  if (Original == NULL) {
+    Print (L"sf: Cannot allocate memory\n");
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Print (L"sf: Bench 0x%x bytes at offset 0x%x, SPI mode %d, page 0x%x, sector 0x%x\n",
+    ByteCount, Offset, mSlave->Mode, mSlave->Info->PageSize, SectorSize);
+
+  for (Index = 0; Index <= ARRAY_SIZE (mBenchChunkSize); Index++) {
+    ChunkSize = (Index == 0) ? mSlave->Info->PageSize : mBenchChunkSize[Index - 1];
+    Start = GetPerformanceCounter ();
+    for (Done = 0; Done < ByteCount; Done += Chunk) {
+      Chunk = MIN (ByteCount - Done, ChunkSize);
+      Status = SpiFlashProtocol->Read (mSlave, Offset + Done, Chunk, Original + Done);
+      if (EFI_ERROR (Status)) {
+        goto Error;
+      }
+    }
+    SfPrintSpeed (L"read", ChunkSize, ByteCount, SfElapsedUs (Start));
+  }
+
+  Start = GetPerformanceCounter ();
+  for (Done = 0; Done < ByteCount; Done += SectorSize) {
+    Status = SpiFlashProtocol->Erase (mSlave, Offset + Done, SectorSize);
+    if (EFI_ERROR (Status)) {
+      goto Error;
+    }
+  }
+  SfPrintSpeed (L"erase", SectorSize, ByteCount, SfElapsedUs (Start));
+
+  for (Index = 0; Index <= ARRAY_SIZE (mBenchChunkSize); Index++) {
+    ChunkSize = (Index == 0) ? mSlave->Info->PageSize : mBenchChunkSize[Index - 1];
+    if (Index != 0) {
+      Status = SpiFlashProtocol->Erase (mSlave, Offset, ByteCount);
+      if (EFI_ERROR (Status)) {
+        goto Error;
+      }
+    }
+    Start = GetPerformanceCounter ();
+    for (Done = 0; Done < ByteCount; Done += Chunk) {
+      Chunk = MIN (ByteCount - Done, ChunkSize);
+      Status = SpiFlashProtocol->Write (mSlave, Offset + Done, Chunk, Original + Done);
+      if (EFI_ERROR (Status)) {
+        goto Error;
+      }
+    }
+    SfPrintSpeed (L"program", ChunkSize, ByteCount, SfElapsedUs (Start));
+  }
+
+  FreePool (Original);
+  return EFI_SUCCESS;
+
+Error:
+  Print (L"sf: Error while performing spi transfer\n");
+  //
+  // Try to put the original content back before giving up
+  //
+  SpiFlashProtocol->Update (mSlave, Offset, ByteCount, Original);
+  FreePool (Original);
+  return Status;
+}
+
 SHELL_STATUS
 EFIAPI
 ShellCommandRunSpiFlash (
@@ -174,9 +438,9 @@ EFI_STATUS              Status;
   UINT8                 *Buffer = NULL, *FileBuffer = NULL;
   CHAR16                *ProblemParam, *FilePath;
   CONST CHAR16          *AddressStr = NULL, *OffsetStr = NULL;
-  CONST CHAR16          *LengthStr = NULL, *FileStr = NULL;
+  CONST CHAR16          *LengthStr = NULL, *FileStr = NULL, *ModeStr = NULL;
   BOOLEAN               AddrFlag = FALSE, LengthFlag = TRUE, FileFlag = FALSE;
-  UINT8                 Flag = 0, CheckFlag = 0;
+  UINT16                Flag = 0, CheckFlag = 0;
   UINT8                 Mode, Cs;
 
   Status = gBS->LocateProtocol (
@@ -227,6 +491,8 @@ EFI_STATUS              Status;
   Flag |= (ShellCommandLineGetFlag (CheckPackage, L"erase") << 5);
   Flag |= (ShellCommandLineGetFlag (CheckPackage, L"update") << 6);
   Flag |= (ShellCommandLineGetFlag (CheckPackage, L"updatefile") << 7);
+  Flag |= (ShellCommandLineGetFlag (CheckPackage, L"verifyfile") << 8);
+  Flag |= (ShellCommandLineGetFlag (CheckPackage, L"bench") << 9);
 
   if (InitFlag && !(Flag & PROBE)) {
     Print (L"Please run sf probe\n");
@@ -287,11 +553,17 @@ EFI_STATUS              Status;
     break;
   case WRITE_FILE:
   case UPDATE_FILE:
+  case VERIFY_FILE:
     FileStr = ShellCommandLineGetRawValue (CheckPackage, 1);
     OffsetStr = ShellCommandLineGetRawValue (CheckPackage, 2);
     LengthFlag = FALSE;
     FileFlag = TRUE;
     break;
+  case BENCH:
+    OffsetStr = ShellCommandLineGetRawValue (CheckPackage, 1);
+    LengthStr = ShellCommandLineGetRawValue (CheckPackage, 2);
+    ModeStr = ShellCommandLineGetRawValue (CheckPackage, 3);
+    break;
   }
 
   // Read address parameter
@@ -351,6 +623,23 @@ EFI_STATUS              Status;
       return SHELL_ABORTED;
     }
 
+    // Stream through a bounded buffer instead of loading the whole image
+    if (Flag & (READ_FILE | VERIFY_FILE)) {
+      if (Flag & READ_FILE) {
+        Status = SfReadFile (FileHandle, (UINT32)Offset, ByteCount);
+      } else {
+        Status = SfVerifyFile (FileHandle, (UINT32)Offset);
+      }
+      ShellCloseFile (&FileHandle);
+      if (EFI_ERROR (Status)) {
+        return SHELL_ABORTED;
+      }
+      if (Flag & VERIFY_FILE) {
+        Print (L"sf: Verify OK at offset 0x%x\n", Offset);
+      }
+      return EFI_SUCCESS;
+    }
+
     // Get file size in order to check correctness at the end of transfer
     if (Flag & (WRITE_FILE | UPDATE_FILE)) {
       Status = FileHandleGetSize (FileHandle, &FileSize);
@@ -379,6 +668,23 @@ EFI_STATUS              Status;
     }
   }
 
+  if (Flag & BENCH) {
+    if (ModeStr != NULL) {
+      I = ShellStrToUintn (ModeStr);
+      if (I > SPI_MODE3) {
+        Print (L"sf: Wrong mode parameter %s!\n", ModeStr);
+        return SHELL_ABORTED;
+      }
+      mSlave->Mode = (SPI_MODE)I;
+      mSlave = SpiMasterProtocol->SetupDevice (SpiMasterProtocol, mSlave, Cs, mSlave->Mode);
+    }
+    Status = SfBench ((UINT32)Offset, ByteCount);
+    // Go back to the configured mode for the following commands
+    mSlave->Mode = Mode;
+    mSlave = SpiMasterProtocol->SetupDevice (SpiMasterProtocol, mSlave, Cs, Mode);
+    return EFI_ERROR (Status) ? SHELL_ABORTED : SHELL_SUCCESS;
+  }
+
   Buffer = (UINT8 *)(UINTN)Address;
   if (FileFlag) {
     Buffer = FileBuffer;
@@ -386,7 +692,6 @@ EFI_STATUS              Status;
 
   switch (Flag) {
   case READ:
-  case READ_FILE:
     Status = SpiFlashProtocol->Read (mSlave, Offset, ByteCount, Buffer);
     break;
   case ERASE:
@@ -423,13 +728,6 @@ EFI_STATUS              Status;
   case READ:
     Print (L"sf: Read %d bytes from offset 0x%x\n", ByteCount, Offset);
     break;
-  case READ_FILE:
-    Status = FileHandleWrite (FileHandle, &ByteCount, FileBuffer);
-    if (EFI_ERROR(Status)) {
-      Print (L"sf: Error while writing into file\n");
-      goto Error_Free_Buffer;
-    }
-    break;
   }
 
   if (FileFlag) {
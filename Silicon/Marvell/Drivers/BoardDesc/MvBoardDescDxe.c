@@ -11,11 +11,42 @@ MV_BOARD_DESC *mBoardDescInstance;
 STATIC MV_BOARD_GPIO_DESCRIPTION *mGpioDescription;
 STATIC MV_BOARD_PCIE_DESCRIPTION *mPcieDescription;
 
+/*
+ * Descriptions built once from the PCDs and shared by all callers.
+ * The BoardDesc*Get functions hand out pool copies of these, which
+ * the caller releases with BoardDescFree.
+ */
+STATIC MV_BOARD_AHCI_DESC   *mAhciDesc;
+STATIC MV_BOARD_COMPHY_DESC *mComPhyDesc;
+STATIC MV_BOARD_I2C_DESC    *mI2cDesc;
+STATIC MV_BOARD_MDIO_DESC   *mMdioDesc;
+STATIC MV_BOARD_PP2_DESC    *mPp2Desc;
+STATIC MV_BOARD_UTMI_DESC   *mUtmiDesc;
+STATIC MV_BOARD_XHCI_DESC   *mXhciDesc;
+STATIC UINTN mAhciDescSize, mComPhyDescSize, mI2cDescSize, mMdioDescSize;
+STATIC UINTN mPp2DescSize, mUtmiDescSize, mXhciDescSize;
+
 STATIC
 EFI_STATUS
-MvBoardDescComPhyGet (
-  IN MARVELL_BOARD_DESC_PROTOCOL  *This,
-  IN OUT MV_BOARD_COMPHY_DESC    **ComPhyDesc
+MvBoardDescCopy (
+  IN VOID CONST *Desc,
+  IN UINTN      DescSize,
+  OUT VOID      **Copy
+  )
+{
+  *Copy = AllocateCopyPool (DescSize, Desc);
+  if (*Copy == NULL) {
+    DEBUG ((DEBUG_ERROR, "%a: Cannot allocate memory\n", __FUNCTION__));
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+MvBoardDescComPhyBuild (
+  VOID
   )
 {
   UINT8 *ComPhyDeviceEnabled;
@@ -69,11 +100,52 @@ MvBoardDescComPhyGet (
 
   BoardDesc->ComPhyDevCount = ComPhyIndex;
 
-  *ComPhyDesc = BoardDesc;
+  mComPhyDesc = BoardDesc;
+  mComPhyDescSize = ComPhyDeviceTableSize * sizeof (MV_BOARD_COMPHY_DESC);
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+MvComPhyDescriptionGet (
+  IN MARVELL_BOARD_DESC_PROTOCOL  *This,
+  IN OUT MV_BOARD_COMPHY_DESC CONST **ComPhyDescription
+  )
+{
+  EFI_STATUS Status;
+
+  if (mComPhyDesc == NULL) {
+    Status = MvBoardDescComPhyBuild ();
+    if (EFI_ERROR (Status) || mComPhyDesc == NULL) {
+      return Status;
+    }
+  }
+
+  *ComPhyDescription = mComPhyDesc;
 
   return EFI_SUCCESS;
 }
 
+STATIC
+EFI_STATUS
+MvBoardDescComPhyGet (
+  IN MARVELL_BOARD_DESC_PROTOCOL  *This,
+  IN OUT MV_BOARD_COMPHY_DESC      **ComPhyDesc
+  )
+{
+  MV_BOARD_COMPHY_DESC CONST *Desc;
+  EFI_STATUS Status;
+
+  Desc = NULL;
+  Status = MvComPhyDescriptionGet (This, &Desc);
+  if (EFI_ERROR (Status) || Desc == NULL) {
+    return Status;
+  }
+
+  return MvBoardDescCopy (Desc, mComPhyDescSize, (VOID **)ComPhyDesc);
+}
+
 STATIC
 EFI_STATUS
 MvBoardGpioDescriptionGet (
@@ -123,9 +195,8 @@ MvBoardGpioDescriptionGet (
 
 STATIC
 EFI_STATUS
-MvBoardDescI2cGet (
-  IN MARVELL_BOARD_DESC_PROTOCOL  *This,
-  IN OUT MV_BOARD_I2C_DESC       **I2cDesc
+MvBoardDescI2cBuild (
+  VOID
   )
 {
   UINT8 *I2cDeviceEnabled;
@@ -181,16 +252,56 @@ MvBoardDescI2cGet (
 
   BoardDesc->I2cDevCount = I2cIndex;
 
-  *I2cDesc = BoardDesc;
+  mI2cDesc = BoardDesc;
+  mI2cDescSize = I2cDeviceEnabledSize * sizeof (MV_BOARD_I2C_DESC);
 
   return EFI_SUCCESS;
 }
 
 STATIC
 EFI_STATUS
-MvBoardDescMdioGet (
+MvI2cDescriptionGet (
   IN MARVELL_BOARD_DESC_PROTOCOL  *This,
-  IN OUT MV_BOARD_MDIO_DESC      **MdioDesc
+  IN OUT MV_BOARD_I2C_DESC CONST **I2cDescription
+  )
+{
+  EFI_STATUS Status;
+
+  if (mI2cDesc == NULL) {
+    Status = MvBoardDescI2cBuild ();
+    if (EFI_ERROR (Status) || mI2cDesc == NULL) {
+      return Status;
+    }
+  }
+
+  *I2cDescription = mI2cDesc;
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+MvBoardDescI2cGet (
+  IN MARVELL_BOARD_DESC_PROTOCOL  *This,
+  IN OUT MV_BOARD_I2C_DESC      **I2cDesc
+  )
+{
+  MV_BOARD_I2C_DESC CONST *Desc;
+  EFI_STATUS Status;
+
+  Desc = NULL;
+  Status = MvI2cDescriptionGet (This, &Desc);
+  if (EFI_ERROR (Status) || Desc == NULL) {
+    return Status;
+  }
+
+  return MvBoardDescCopy (Desc, mI2cDescSize, (VOID **)I2cDesc);
+}
+
+STATIC
+EFI_STATUS
+MvBoardDescMdioBuild (
+  VOID
   )
 {
   MV_BOARD_MDIO_DESC *BoardDesc;
@@ -216,16 +327,56 @@ MvBoardDescMdioGet (
   }
 
   BoardDesc->MdioDevCount = MdioCount;
-  *MdioDesc = BoardDesc;
+  mMdioDesc = BoardDesc;
+  mMdioDescSize = MdioCount * sizeof (MV_BOARD_MDIO_DESC);
 
   return EFI_SUCCESS;
 }
 
 STATIC
 EFI_STATUS
-MvBoardDescAhciGet (
+MvMdioDescriptionGet (
   IN MARVELL_BOARD_DESC_PROTOCOL  *This,
-  IN OUT MV_BOARD_AHCI_DESC      **AhciDesc
+  IN OUT MV_BOARD_MDIO_DESC CONST **MdioDescription
+  )
+{
+  EFI_STATUS Status;
+
+  if (mMdioDesc == NULL) {
+    Status = MvBoardDescMdioBuild ();
+    if (EFI_ERROR (Status) || mMdioDesc == NULL) {
+      return Status;
+    }
+  }
+
+  *MdioDescription = mMdioDesc;
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+MvBoardDescMdioGet (
+  IN MARVELL_BOARD_DESC_PROTOCOL  *This,
+  IN OUT MV_BOARD_MDIO_DESC      **MdioDesc
+  )
+{
+  MV_BOARD_MDIO_DESC CONST *Desc;
+  EFI_STATUS Status;
+
+  Desc = NULL;
+  Status = MvMdioDescriptionGet (This, &Desc);
+  if (EFI_ERROR (Status) || Desc == NULL) {
+    return Status;
+  }
+
+  return MvBoardDescCopy (Desc, mMdioDescSize, (VOID **)MdioDesc);
+}
+
+STATIC
+EFI_STATUS
+MvBoardDescAhciBuild (
+  VOID
   )
 {
   UINT8 *AhciDeviceEnabled;
@@ -279,11 +430,52 @@ MvBoardDescAhciGet (
 
   BoardDesc->AhciDevCount = AhciIndex;
 
-  *AhciDesc = BoardDesc;
+  mAhciDesc = BoardDesc;
+  mAhciDescSize = AhciDeviceTableSize * sizeof (MV_BOARD_AHCI_DESC);
 
   return EFI_SUCCESS;
 }
 
+STATIC
+EFI_STATUS
+MvAhciDescriptionGet (
+  IN MARVELL_BOARD_DESC_PROTOCOL  *This,
+  IN OUT MV_BOARD_AHCI_DESC CONST **AhciDescription
+  )
+{
+  EFI_STATUS Status;
+
+  if (mAhciDesc == NULL) {
+    Status = MvBoardDescAhciBuild ();
+    if (EFI_ERROR (Status) || mAhciDesc == NULL) {
+      return Status;
+    }
+  }
+
+  *AhciDescription = mAhciDesc;
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+MvBoardDescAhciGet (
+  IN MARVELL_BOARD_DESC_PROTOCOL  *This,
+  IN OUT MV_BOARD_AHCI_DESC      **AhciDesc
+  )
+{
+  MV_BOARD_AHCI_DESC CONST *Desc;
+  EFI_STATUS Status;
+
+  Desc = NULL;
+  Status = MvAhciDescriptionGet (This, &Desc);
+  if (EFI_ERROR (Status) || Desc == NULL) {
+    return Status;
+  }
+
+  return MvBoardDescCopy (Desc, mAhciDescSize, (VOID **)AhciDesc);
+}
+
 STATIC
 EFI_STATUS
 MvBoardDescSdMmcGet (
@@ -357,9 +549,8 @@ MvBoardDescSdMmcGet (
 
 STATIC
 EFI_STATUS
-MvBoardDescXhciGet (
-  IN MARVELL_BOARD_DESC_PROTOCOL  *This,
-  IN OUT MV_BOARD_XHCI_DESC      **XhciDesc
+MvBoardDescXhciBuild (
+  VOID
   )
 {
   UINT8 *XhciDeviceEnabled;
@@ -413,11 +604,52 @@ MvBoardDescXhciGet (
 
   BoardDesc->XhciDevCount = XhciIndex;
 
-  *XhciDesc = BoardDesc;
+  mXhciDesc = BoardDesc;
+  mXhciDescSize = XhciDeviceTableSize * sizeof (MV_BOARD_XHCI_DESC);
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+MvXhciDescriptionGet (
+  IN MARVELL_BOARD_DESC_PROTOCOL  *This,
+  IN OUT MV_BOARD_XHCI_DESC CONST **XhciDescription
+  )
+{
+  EFI_STATUS Status;
+
+  if (mXhciDesc == NULL) {
+    Status = MvBoardDescXhciBuild ();
+    if (EFI_ERROR (Status) || mXhciDesc == NULL) {
+      return Status;
+    }
+  }
+
+  *XhciDescription = mXhciDesc;
 
   return EFI_SUCCESS;
 }
 
+STATIC
+EFI_STATUS
+MvBoardDescXhciGet (
+  IN MARVELL_BOARD_DESC_PROTOCOL  *This,
+  IN OUT MV_BOARD_XHCI_DESC      **XhciDesc
+  )
+{
+  MV_BOARD_XHCI_DESC CONST *Desc;
+  EFI_STATUS Status;
+
+  Desc = NULL;
+  Status = MvXhciDescriptionGet (This, &Desc);
+  if (EFI_ERROR (Status) || Desc == NULL) {
+    return Status;
+  }
+
+  return MvBoardDescCopy (Desc, mXhciDescSize, (VOID **)XhciDesc);
+}
+
 /**
   Return the description of PCIE controllers used on the platform.
 
@@ -504,9 +736,8 @@ MvBoardPcieDescriptionGet (
 
 STATIC
 EFI_STATUS
-MvBoardDescPp2Get (
-  IN MARVELL_BOARD_DESC_PROTOCOL  *This,
-  IN OUT MV_BOARD_PP2_DESC       **Pp2Desc
+MvBoardDescPp2Build (
+  VOID
   )
 {
   UINT8 *Pp2DeviceEnabled;
@@ -559,16 +790,56 @@ MvBoardDescPp2Get (
 
   BoardDesc->Pp2DevCount = Pp2Index;
 
-  *Pp2Desc = BoardDesc;
+  mPp2Desc = BoardDesc;
+  mPp2DescSize = Pp2DeviceTableSize * sizeof (MV_BOARD_PP2_DESC);
 
   return EFI_SUCCESS;
 }
 
 STATIC
 EFI_STATUS
-MvBoardDescUtmiGet (
+MvPp2DescriptionGet (
   IN MARVELL_BOARD_DESC_PROTOCOL  *This,
-  IN OUT MV_BOARD_UTMI_DESC      **UtmiDesc
+  IN OUT MV_BOARD_PP2_DESC CONST **Pp2Description
+  )
+{
+  EFI_STATUS Status;
+
+  if (mPp2Desc == NULL) {
+    Status = MvBoardDescPp2Build ();
+    if (EFI_ERROR (Status) || mPp2Desc == NULL) {
+      return Status;
+    }
+  }
+
+  *Pp2Description = mPp2Desc;
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+MvBoardDescPp2Get (
+  IN MARVELL_BOARD_DESC_PROTOCOL  *This,
+  IN OUT MV_BOARD_PP2_DESC      **Pp2Desc
+  )
+{
+  MV_BOARD_PP2_DESC CONST *Desc;
+  EFI_STATUS Status;
+
+  Desc = NULL;
+  Status = MvPp2DescriptionGet (This, &Desc);
+  if (EFI_ERROR (Status) || Desc == NULL) {
+    return Status;
+  }
+
+  return MvBoardDescCopy (Desc, mPp2DescSize, (VOID **)Pp2Desc);
+}
+
+STATIC
+EFI_STATUS
+MvBoardDescUtmiBuild (
+  VOID
   )
 {
   UINT8 *UtmiDeviceEnabled, *XhciDeviceEnabled, *UtmiPortType;
@@ -637,8 +908,9 @@ MvBoardDescUtmiGet (
     if (!XhciDeviceEnabled[Index]) {
       DEBUG ((DEBUG_ERROR,
              "%a: Disabled Xhci controller %d\n",
-             Index,
-             __FUNCTION__));
+             __FUNCTION__,
+             Index));
+      FreePool (BoardDesc);
       return EFI_INVALID_PARAMETER;
     }
 
@@ -649,11 +921,52 @@ MvBoardDescUtmiGet (
 
   BoardDesc->UtmiDevCount = UtmiIndex;
 
-  *UtmiDesc = BoardDesc;
+  mUtmiDesc = BoardDesc;
+  mUtmiDescSize = UtmiDeviceTableSize * sizeof (MV_BOARD_UTMI_DESC);
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+MvUtmiDescriptionGet (
+  IN MARVELL_BOARD_DESC_PROTOCOL  *This,
+  IN OUT MV_BOARD_UTMI_DESC CONST **UtmiDescription
+  )
+{
+  EFI_STATUS Status;
+
+  if (mUtmiDesc == NULL) {
+    Status = MvBoardDescUtmiBuild ();
+    if (EFI_ERROR (Status) || mUtmiDesc == NULL) {
+      return Status;
+    }
+  }
+
+  *UtmiDescription = mUtmiDesc;
 
   return EFI_SUCCESS;
 }
 
+STATIC
+EFI_STATUS
+MvBoardDescUtmiGet (
+  IN MARVELL_BOARD_DESC_PROTOCOL  *This,
+  IN OUT MV_BOARD_UTMI_DESC      **UtmiDesc
+  )
+{
+  MV_BOARD_UTMI_DESC CONST *Desc;
+  EFI_STATUS Status;
+
+  Desc = NULL;
+  Status = MvUtmiDescriptionGet (This, &Desc);
+  if (EFI_ERROR (Status) || Desc == NULL) {
+    return Status;
+  }
+
+  return MvBoardDescCopy (Desc, mUtmiDescSize, (VOID **)UtmiDesc);
+}
+
 STATIC
 VOID
 MvBoardDescFree (
@@ -680,6 +993,13 @@ MvBoardDescInitProtocol (
   BoardDescProtocol->BoardDescFree = MvBoardDescFree;
   BoardDescProtocol->GpioDescriptionGet = MvBoardGpioDescriptionGet;
   BoardDescProtocol->PcieDescriptionGet = MvBoardPcieDescriptionGet;
+  BoardDescProtocol->AhciDescriptionGet = MvAhciDescriptionGet;
+  BoardDescProtocol->ComPhyDescriptionGet = MvComPhyDescriptionGet;
+  BoardDescProtocol->I2cDescriptionGet = MvI2cDescriptionGet;
+  BoardDescProtocol->MdioDescriptionGet = MvMdioDescriptionGet;
+  BoardDescProtocol->Pp2DescriptionGet = MvPp2DescriptionGet;
+  BoardDescProtocol->UtmiDescriptionGet = MvUtmiDescriptionGet;
+  BoardDescProtocol->XhciDescriptionGet = MvXhciDescriptionGet;
 
   return EFI_SUCCESS;
 }
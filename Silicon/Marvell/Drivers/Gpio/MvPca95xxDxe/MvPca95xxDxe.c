@@ -115,6 +115,11 @@ MvPca95xxGetI2c (
   EFI_HANDLE  *HandleBuffer;
   EFI_STATUS   Status;
 
+  if (mPca95xxInstance->State[ControllerIndex].I2cIo != NULL) {
+    *I2cIo = mPca95xxInstance->State[ControllerIndex].I2cIo;
+    return EFI_SUCCESS;
+  }
+
   I2cBus = mPca95xxInstance->GpioExpanders[ControllerIndex].I2cBus;
   I2cAddress = mPca95xxInstance->GpioExpanders[ControllerIndex].I2cAddress;
 
@@ -143,6 +148,7 @@ MvPca95xxGetI2c (
       return Status;
     }
     if ((*I2cIo)->DeviceIndex == I2C_DEVICE_INDEX (I2cBus, I2cAddress)) {
+      mPca95xxInstance->State[ControllerIndex].I2cIo = *I2cIo;
       gBS->FreePool (HandleBuffer);
       return EFI_SUCCESS;
     }
@@ -218,18 +224,42 @@ MvPca95xxWriteRegs (
   return MvPca95xxI2cTransfer (I2cIo, Reg, &RegVal, I2C_FLAG_NORESTART);
 }
 
+/**
+
+Routine Description:
+
+  Makes sure the register shadow of a bank is populated, reading the current
+  output and direction registers from the device on first use.
+
+Arguments:
+
+  ControllerIndex - index of controller
+  Bank - which bank of 8 pins
+  State - pointer to the controller state
+
+Returns:
+
+  EFI_SUCCESS      - shadow registers are valid
+  EFI_DEVICE_ERROR - the device could not be accessed
+**/
 STATIC
 EFI_STATUS
-MvPca95xxSetOutputValue (
-  IN UINTN               ControllerIndex,
-  IN UINTN               GpioPin,
-  IN EMBEDDED_GPIO_MODE  Mode
+MvPca95xxLoadBank (
+  IN  UINTN           ControllerIndex,
+  IN  UINTN           Bank,
+  OUT PCA95XX_STATE **State
   )
 {
   EFI_I2C_IO_PROTOCOL *I2cIo;
+  PCA95XX_STATE *Pca;
   EFI_STATUS Status;
-  UINT8 RegVal;
-  UINTN Bank;
+
+  Pca = &mPca95xxInstance->State[ControllerIndex];
+  *State = Pca;
+
+  if (Pca->ShadowValid & (1 << Bank)) {
+    return EFI_SUCCESS;
+  }
 
   Status = MvPca95xxGetI2c (ControllerIndex, &I2cIo);
   if (EFI_ERROR (Status)) {
@@ -237,71 +267,132 @@ MvPca95xxSetOutputValue (
     return EFI_DEVICE_ERROR;
   }
 
-  Bank = GpioPin / PCA95XX_BANK_SIZE;
-
-  Status = MvPca95xxReadRegs (I2cIo, PCA95XX_OUTPUT_REG + Bank, &RegVal);
+  Status = MvPca95xxReadRegs (I2cIo,
+             PCA95XX_OUTPUT_REG + Bank,
+             &Pca->Output[Bank]);
+  if (!EFI_ERROR (Status)) {
+    Status = MvPca95xxReadRegs (I2cIo,
+               PCA95XX_DIRECTION_REG + Bank,
+               &Pca->Direction[Bank]);
+  }
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "%a: fail to read device register\n", __FUNCTION__));
     return EFI_DEVICE_ERROR;
   }
 
-  if (Mode == GPIO_MODE_OUTPUT_1) {
-    RegVal |= (1 << (GpioPin % PCA95XX_BANK_SIZE));
-  } else {
-    RegVal &= ~(1 << (GpioPin % PCA95XX_BANK_SIZE));
-  }
-
-  Status = MvPca95xxWriteRegs (I2cIo, PCA95XX_OUTPUT_REG + Bank, RegVal);
-  if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_ERROR, "%a: fail to write device register\n", __FUNCTION__));
-    return EFI_DEVICE_ERROR;
-  }
+  Pca->ShadowValid |= 1 << Bank;
 
   return EFI_SUCCESS;
 }
 
+/**
+
+Routine Description:
+
+  Updates the output and direction registers of one bank, writing each
+  register at most once and only if its value actually changes.
+
+Arguments:
+
+  ControllerIndex - index of controller
+  Bank - which bank of 8 pins
+  OutputMask - pins whose output level is updated
+  OutputValue - new output levels
+  DirectionMask - pins whose direction is updated
+  DirectionValue - new directions, set bits are inputs
+
+Returns:
+
+  EFI_SUCCESS      - registers updated
+  EFI_DEVICE_ERROR - the device could not be accessed
+**/
 STATIC
 EFI_STATUS
-MvPca95xxSetDirection (
-  IN UINTN              ControllerIndex,
-  IN UINTN              GpioPin,
-  IN EMBEDDED_GPIO_MODE Mode
+MvPca95xxUpdateBank (
+  IN UINTN ControllerIndex,
+  IN UINTN Bank,
+  IN UINT8 OutputMask,
+  IN UINT8 OutputValue,
+  IN UINT8 DirectionMask,
+  IN UINT8 DirectionValue
   )
 {
-  EFI_I2C_IO_PROTOCOL *I2cIo;
+  PCA95XX_STATE *Pca;
   EFI_STATUS Status;
   UINT8 RegVal;
-  UINTN Bank;
-
-  Status = MvPca95xxGetI2c (ControllerIndex, &I2cIo);
-  if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_ERROR, "%a: fail to get I2C protocol\n", __FUNCTION__));
-    return Status;
-  }
 
-  Bank = GpioPin / PCA95XX_BANK_SIZE;
-
-  Status = MvPca95xxReadRegs (I2cIo, PCA95XX_DIRECTION_REG + Bank, &RegVal);
+  Status = MvPca95xxLoadBank (ControllerIndex, Bank, &Pca);
   if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_ERROR, "%a: fail to read device register\n", __FUNCTION__));
     return Status;
   }
 
-  if (Mode == GPIO_MODE_INPUT) {
-    RegVal |= (1 << (GpioPin % PCA95XX_BANK_SIZE));
-  } else {
-    RegVal &= ~(1 << (GpioPin % PCA95XX_BANK_SIZE));
+  /* Update the levels first, so that pins turned into outputs do not glitch */
+  RegVal = (Pca->Output[Bank] & ~OutputMask) | (OutputValue & OutputMask);
+  if (RegVal != Pca->Output[Bank]) {
+    Status = MvPca95xxWriteRegs (Pca->I2cIo, PCA95XX_OUTPUT_REG + Bank, RegVal);
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "%a: fail to write device register\n", __FUNCTION__));
+      return EFI_DEVICE_ERROR;
+    }
+    Pca->Output[Bank] = RegVal;
   }
 
-  Status = MvPca95xxWriteRegs (I2cIo, PCA95XX_DIRECTION_REG + Bank, RegVal);
-  if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_ERROR, "%a: fail to write device register\n", __FUNCTION__));
-    return Status;
+  RegVal = (Pca->Direction[Bank] & ~DirectionMask) |
+           (DirectionValue & DirectionMask);
+  if (RegVal != Pca->Direction[Bank]) {
+    Status = MvPca95xxWriteRegs (Pca->I2cIo,
+               PCA95XX_DIRECTION_REG + Bank,
+               RegVal);
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "%a: fail to write device register\n", __FUNCTION__));
+      return EFI_DEVICE_ERROR;
+    }
+    Pca->Direction[Bank] = RegVal;
   }
 
   return EFI_SUCCESS;
 }
 
+STATIC
+EFI_STATUS
+MvPca95xxSetOutputValue (
+  IN UINTN               ControllerIndex,
+  IN UINTN               GpioPin,
+  IN EMBEDDED_GPIO_MODE  Mode
+  )
+{
+  UINT8 Bit;
+
+  Bit = 1 << (GpioPin % PCA95XX_BANK_SIZE);
+
+  return MvPca95xxUpdateBank (ControllerIndex,
+           GpioPin / PCA95XX_BANK_SIZE,
+           Bit,
+           (Mode == GPIO_MODE_OUTPUT_1) ? Bit : 0,
+           0,
+           0);
+}
+
+STATIC
+EFI_STATUS
+MvPca95xxSetDirection (
+  IN UINTN              ControllerIndex,
+  IN UINTN              GpioPin,
+  IN EMBEDDED_GPIO_MODE Mode
+  )
+{
+  UINT8 Bit;
+
+  Bit = 1 << (GpioPin % PCA95XX_BANK_SIZE);
+
+  return MvPca95xxUpdateBank (ControllerIndex,
+           GpioPin / PCA95XX_BANK_SIZE,
+           0,
+           0,
+           Bit,
+           (Mode == GPIO_MODE_INPUT) ? Bit : 0);
+}
+
 STATIC
 EFI_STATUS
 MvPca95xxReadMode (
@@ -310,31 +401,24 @@ MvPca95xxReadMode (
   OUT EMBEDDED_GPIO_MODE *Mode
   )
 {
-  EFI_I2C_IO_PROTOCOL *I2cIo;
+  PCA95XX_STATE *Pca;
   EFI_STATUS Status;
   UINT8 RegVal;
   UINTN Bank;
 
   ASSERT_EFI_ERROR (MvPca95xxValidate (ControllerIndex, GpioPin));
 
-  Status = MvPca95xxGetI2c (ControllerIndex, &I2cIo);
-  if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_ERROR, "%a: fail to get I2C protocol\n", __FUNCTION__));
-    return Status;
-  }
-
   Bank = GpioPin / PCA95XX_BANK_SIZE;
 
-  Status = MvPca95xxReadRegs (I2cIo, PCA95XX_DIRECTION_REG + Bank, &RegVal);
+  Status = MvPca95xxLoadBank (ControllerIndex, Bank, &Pca);
   if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_ERROR, "%a: fail to read device register\n", __FUNCTION__));
     return Status;
   }
 
-  if (RegVal & (1 << (GpioPin % PCA95XX_BANK_SIZE))) {
+  if (Pca->Direction[Bank] & (1 << (GpioPin % PCA95XX_BANK_SIZE))) {
     *Mode = GPIO_MODE_INPUT;
   } else {
-    Status = MvPca95xxReadRegs (I2cIo, PCA95XX_INPUT_REG + Bank, &RegVal);
+    Status = MvPca95xxReadRegs (Pca->I2cIo, PCA95XX_INPUT_REG + Bank, &RegVal);
     if (EFI_ERROR (Status)) {
       DEBUG ((DEBUG_ERROR, "%a: fail to read device register\n", __FUNCTION__));
       return Status;
@@ -545,6 +629,71 @@ MvPca95xxSetPull (
   return EFI_UNSUPPORTED;
 }
 
+/**
+
+Routine Description:
+
+  Drives several pins of one controller as outputs, with at most one write
+  per bank and register
+
+Arguments:
+
+  This  - pointer to protocol
+  ControllerIndex - index of controller
+  PinMask - pins to update
+  Values - output levels of the pins
+
+Returns:
+
+  EFI_SUCCESS           - pins set as requested
+  EFI_INVALID_PARAMETER - controller index or pin mask is out of range
+  EFI_DEVICE_ERROR      - the device could not be accessed
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MvPca95xxSetOutputs (
+  IN MARVELL_GPIO_EXPANDER_PROTOCOL *This,
+  IN UINTN                           ControllerIndex,
+  IN UINT64                          PinMask,
+  IN UINT64                          Values
+  )
+{
+  EFI_STATUS Status;
+  UINTN PinCount;
+  UINTN Bank;
+  UINT8 Mask;
+
+  if (ControllerIndex >= mPca95xxInstance->GpioExpanderCount) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  PinCount =
+    mPca95xxPinCount[mPca95xxInstance->GpioExpanders[ControllerIndex].ChipId];
+  if (RShiftU64 (PinMask, PinCount) != 0) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  for (Bank = 0; Bank * PCA95XX_BANK_SIZE < PinCount; Bank++) {
+    Mask = (UINT8)RShiftU64 (PinMask, Bank * PCA95XX_BANK_SIZE);
+    if (Mask == 0) {
+      continue;
+    }
+
+    Status = MvPca95xxUpdateBank (ControllerIndex,
+               Bank,
+               Mask,
+               (UINT8)RShiftU64 (Values, Bank * PCA95XX_BANK_SIZE),
+               Mask,
+               0);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
 STATIC
 VOID
 MvPca95xxInitProtocol (
@@ -615,11 +764,25 @@ MvPca95xxEntryPoint (
   mPca95xxInstance->Signature = PCA95XX_GPIO_SIGNATURE;
   mPca95xxInstance->GpioExpanders = GpioDescription->GpioExpanders;
   mPca95xxInstance->GpioExpanderCount = GpioDescription->GpioExpanderCount;
+  mPca95xxInstance->ExpanderProtocol.SetOutputs = MvPca95xxSetOutputs;
+
+  mPca95xxInstance->State = AllocateZeroPool (
+                              mPca95xxInstance->GpioExpanderCount *
+                              sizeof (PCA95XX_STATE));
+  if (mPca95xxInstance->State == NULL) {
+    DEBUG ((DEBUG_ERROR,
+      "%a: Fail to allocate controller state\n",
+      __FUNCTION__));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto ErrStateAlloc;
+  }
 
   Status = gBS->InstallMultipleProtocolInterfaces (
                   &(mPca95xxInstance->ControllerHandle),
                   &gEmbeddedGpioProtocolGuid,
                   &(mPca95xxInstance->GpioProtocol),
+                  &gMarvellGpioExpanderProtocolGuid,
+                  &(mPca95xxInstance->ExpanderProtocol),
                   &gEfiDevicePathProtocolGuid,
                   (EFI_DEVICE_PATH_PROTOCOL *)Pca95xxDevicePath,
                   NULL);
@@ -630,6 +793,9 @@ MvPca95xxEntryPoint (
   return EFI_SUCCESS;
 
 ErrInstallProtocols:
+  gBS->FreePool (mPca95xxInstance->State);
+
+ErrStateAlloc:
   gBS->FreePool (mPca95xxInstance);
 
 ErrPca95xxInstanceAlloc:
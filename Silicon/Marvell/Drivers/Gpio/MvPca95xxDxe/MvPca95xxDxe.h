@@ -9,6 +9,7 @@
 #define __MV_PCA953X_H__
 
 #include <Library/ArmadaBoardDescLib.h>
+#include <Library/BaseLib.h>
 #include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
 #include <Library/DevicePathLib.h>
@@ -20,6 +21,8 @@
 #include <Library/UefiLib.h>
 
 #include <Protocol/BoardDesc.h>
+#include <Protocol/I2cIo.h>
+#include <Protocol/MvGpioExpander.h>
 #include <Protocol/MvI2c.h>
 
 #include <Uefi/UefiBaseType.h>
@@ -31,6 +34,7 @@
 #define PCA95XX_DIRECTION_REG    0x6
 
 #define PCA95XX_BANK_SIZE        8
+#define PCA95XX_MAX_BANKS        5
 #define PCA95XX_OPERATION_COUNT  2
 #define PCA95XX_OPERATION_LENGTH 1
 
@@ -48,10 +52,24 @@ typedef enum {
   PCA9557_PIN_COUNT = 16,
 } PCA95XX_PIN_COUNT;
 
+/*
+ * Shadow copies of the output and direction registers, so that pin updates
+ * do not need to read the device back first. A bank is loaded from the
+ * device the first time it is touched.
+ */
+typedef struct {
+  EFI_I2C_IO_PROTOCOL *I2cIo;
+  UINT8                Output[PCA95XX_MAX_BANKS];
+  UINT8                Direction[PCA95XX_MAX_BANKS];
+  UINT8                ShadowValid;
+} PCA95XX_STATE;
+
 typedef struct {
   EMBEDDED_GPIO      GpioProtocol;
+  MARVELL_GPIO_EXPANDER_PROTOCOL ExpanderProtocol;
   MV_GPIO_EXPANDER  *GpioExpanders;
   UINTN              GpioExpanderCount;
+  PCA95XX_STATE     *State;
   UINTN              Signature;
   EFI_HANDLE         ControllerHandle;
 } PCA95XX;
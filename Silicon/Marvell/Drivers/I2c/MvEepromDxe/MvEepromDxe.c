@@ -88,6 +88,38 @@ out:
   return Status;
 }
 
+/*
+ * After a page write the EEPROM does not acknowledge its address until the
+ * internal write cycle is over. Poll for that rather than waiting for the
+ * worst case write cycle time.
+ */
+STATIC
+EFI_STATUS
+MvEepromWaitWriteCycle (
+  IN EEPROM_CONTEXT *EepromContext
+  )
+{
+  EFI_I2C_REQUEST_PACKET Probe;
+  EFI_STATUS Status;
+  UINTN Retries;
+
+  Probe.OperationCount = 1;
+  Probe.Operation[0].Flags = 0;
+  Probe.Operation[0].LengthInBytes = 0;
+  Probe.Operation[0].Buffer = NULL;
+
+  for (Retries = 0; Retries < EEPROM_WRITE_CYCLE_TIMEOUT / EEPROM_ACK_POLL_DELAY; Retries++) {
+    Status = EepromContext->I2cIo->QueueRequest(EepromContext->I2cIo, 0, NULL, &Probe, NULL);
+    if (!EFI_ERROR(Status)) {
+      return EFI_SUCCESS;
+    }
+    gBS->Stall (EEPROM_ACK_POLL_DELAY);
+  }
+
+  DEBUG((DEBUG_ERROR, "MvEepromTransfer: timeout waiting for write cycle\n"));
+  return EFI_TIMEOUT;
+}
+
 EFI_STATUS
 EFIAPI
 MvEepromTransfer (
@@ -125,7 +157,14 @@ MvEepromTransfer (
 
   while (Length > 0) {
     CurrentAddress = Address + Transmitted;
-    BufferLength = (Length <= MAX_BUFFER_LENGTH ? Length : MAX_BUFFER_LENGTH);
+    if (Operation == EEPROM_READ) {
+      /* Sequential reads are not bounded by pages, do it all at once */
+      BufferLength = Length;
+    } else {
+      /* Writes must not cross a page boundary, or they wrap around */
+      BufferLength = EEPROM_PAGE_SIZE - (CurrentAddress % EEPROM_PAGE_SIZE);
+      BufferLength = MIN (BufferLength, Length);
+    }
     RequestPacket->Operation[0].Buffer[0] = (CurrentAddress >> 8) & 0xff;
     RequestPacket->Operation[0].Buffer[1] = CurrentAddress & 0xff;
     RequestPacket->Operation[1].LengthInBytes = BufferLength;
@@ -135,6 +174,12 @@ MvEepromTransfer (
       DEBUG((DEBUG_ERROR, "MvEepromTransfer: error %d during transmission\n", Status));
       break;
     }
+    if (Operation != EEPROM_READ) {
+      Status = MvEepromWaitWriteCycle (EepromContext);
+      if (EFI_ERROR(Status)) {
+        break;
+      }
+    }
     Length -= BufferLength;
     Transmitted += BufferLength;
   }
@@ -12,7 +12,15 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #define EEPROM_SIGNATURE          SIGNATURE_32 ('E', 'E', 'P', 'R')
 
-#define MAX_BUFFER_LENGTH 64
+/*
+ * Smallest page size of the 2-byte addressed (24C32 and up) parts; writing a
+ * smaller chunk than the actual page size is always safe.
+ */
+#define EEPROM_PAGE_SIZE 32
+
+/* Worst case write cycle time and ACK polling interval, in us */
+#define EEPROM_WRITE_CYCLE_TIMEOUT 10000
+#define EEPROM_ACK_POLL_DELAY      100
 
 #define I2C_GUID \
   { \
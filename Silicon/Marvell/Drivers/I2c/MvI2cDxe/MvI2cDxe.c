@@ -16,6 +16,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/IoLib.h>
 #include <Library/DebugLib.h>
 #include <Library/PcdLib.h>
+#include <Library/TimerLib.h>
 #include <Library/UefiLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/UefiBootServicesTableLib.h>
@@ -193,7 +194,7 @@ MvI2cInitialise (
 {
   MARVELL_BOARD_DESC_PROTOCOL *BoardDescProtocol;
   EFI_EVENT EndOfDxeEvent;
-  MV_BOARD_I2C_DESC *Desc;
+  MV_BOARD_I2C_DESC CONST *Desc;
   EFI_STATUS Status;
   UINTN Index;
 
@@ -205,7 +206,7 @@ MvI2cInitialise (
     return Status;
   }
 
-  Status = BoardDescProtocol->BoardDescI2cGet (BoardDescProtocol, &Desc);
+  Status = BoardDescProtocol->I2cDescriptionGet (BoardDescProtocol, &Desc);
   if (EFI_ERROR (Status)) {
     return Status;
   }
@@ -221,8 +222,6 @@ MvI2cInitialise (
       return Status;
   }
 
-  BoardDescProtocol->BoardDescFree (Desc);
-
   Status = gBS->CreateEventEx (EVT_NOTIFY_SIGNAL,
                   TPL_CALLBACK,
                   OnEndOfDxe,
@@ -272,7 +271,11 @@ MvI2cClearIflg (
   MvI2cControlClear(I2cMasterContext, I2C_CONTROL_IFLG);
 }
 
-/* Timeout is given in us */
+/*
+ * Timeout is given in us. The register is polled against a performance
+ * counter deadline rather than in 10 us sleeps, as a byte takes less than
+ * that on the wire in fast mode plus. Returns non-zero on timeout.
+ */
 STATIC
 UINTN
 MvI2cPollCtrl (
@@ -280,11 +283,13 @@ MvI2cPollCtrl (
   IN UINTN Timeout,
   IN UINT32 Mask)
 {
-  Timeout /= 10;
+  UINT64 Deadline;
+
+  Deadline = GetTimeInNanoSecond (GetPerformanceCounter ()) +
+             MultU64x32 (Timeout, 1000);
   while (!(I2C_READ(I2cMasterContext, I2C_CONTROL) & Mask)) {
-    gBS->Stall(10);
-    if (--Timeout == 0)
-      return (Timeout);
+    if (GetTimeInNanoSecond (GetPerformanceCounter ()) > Deadline)
+      return (1);
   }
   return (0);
 }
@@ -333,7 +338,6 @@ MvI2cLockedStart (
   }
 
   I2C_WRITE(I2cMasterContext, I2C_DATA, Slave);
-  gBS->Stall(I2C_OPERATION_TIMEOUT);
   MvI2cClearIflg(I2cMasterContext);
 
   if (MvI2cPollCtrl(I2cMasterContext, Timeout, I2C_CONTROL_IFLG)) {
@@ -345,7 +349,7 @@ MvI2cLockedStart (
   I2cStatus = I2C_READ(I2cMasterContext, I2C_STATUS);
   if (I2cStatus != (ReadAccess ?
       I2C_STATUS_ADDR_R_ACK : I2C_STATUS_ADDR_W_ACK)) {
-    DEBUG((DEBUG_ERROR, "MvI2cDxe: no ACK (I2cStatus: %02x) after sending Slave address\n",
+    DEBUG((DEBUG_INFO, "MvI2cDxe: no ACK (I2cStatus: %02x) after sending Slave address\n",
         I2cStatus));
     return EFI_NO_RESPONSE;
   }
@@ -363,7 +367,7 @@ MvI2cCalBaudRate (
   UINT32 clk
   )
 {
-  UINT32 cur, diff, diff0, baud;
+  UINT32 cur, diff, diff0, baud, max;
   UINTN m, n, m0, n0;
 
   /* Read initial m0, n0 values from register */
@@ -372,11 +376,19 @@ MvI2cCalBaudRate (
   n0 = I2C_N_FROM_BAUD(baud);
   /* Calculate baud rate. */
   diff0 = 0xffffffff;
+  max = MIN (target, I2C_MAX_BAUD_RATE);
 
+  /*
+   * Pick the closest rate that does not exceed the requested one, so that
+   * devices specified for a given bus speed never get clocked faster.
+   */
   for (n = 0; n < 8; n++) {
     for (m = 0; m < 16; m++) {
       cur = I2C_BAUD_RATE_RAW(clk,m,n);
-      diff = ABSSUB(target, cur);
+      if (cur > max) {
+        continue;
+      }
+      diff = ABSSUB(max, cur);
       if (diff < diff0) {
         m0 = m;
         n0 = n;
@@ -425,10 +437,8 @@ MvI2cRepeatedStart (
 {
   EFI_STATUS Status;
 
-  EfiAcquireLock (&I2cMasterContext->Lock);
   Status = MvI2cLockedStart(I2cMasterContext, I2C_STATUS_RPTD_START, Slave,
       Timeout);
-  EfiReleaseLock (&I2cMasterContext->Lock);
 
   if (EFI_ERROR(Status)) {
     MvI2cStop(I2cMasterContext);
@@ -449,9 +459,7 @@ MvI2cStart (
 {
   EFI_STATUS Status;
 
-  EfiAcquireLock (&I2cMasterContext->Lock);
   Status = MvI2cLockedStart(I2cMasterContext, I2C_STATUS_START, Slave, Timeout);
-  EfiReleaseLock (&I2cMasterContext->Lock);
 
   if (EFI_ERROR(Status)) {
     MvI2cStop(I2cMasterContext);
@@ -465,11 +473,24 @@ MvI2cStop (
   IN I2C_MASTER_CONTEXT *I2cMasterContext
   )
 {
-  EfiAcquireLock (&I2cMasterContext->Lock);
+  UINT64 Deadline;
+
+  /*
+   * The STOP condition goes out once IFLG is cleared, and the controller
+   * drops the STOP bit when it is done, so wait for that instead of a
+   * fixed delay.
+   */
   MvI2cControlSet(I2cMasterContext, I2C_CONTROL_STOP);
-  gBS->Stall(I2C_OPERATION_TIMEOUT);
-  MvI2cClearIflg(I2cMasterContext);
-  EfiReleaseLock (&I2cMasterContext->Lock);
+  MvI2cControlClear(I2cMasterContext, I2C_CONTROL_IFLG);
+
+  Deadline = GetTimeInNanoSecond (GetPerformanceCounter ()) +
+             MultU64x32 (I2C_OPERATION_TIMEOUT, 1000);
+  while (I2C_READ(I2cMasterContext, I2C_CONTROL) & I2C_CONTROL_STOP) {
+    if (GetTimeInNanoSecond (GetPerformanceCounter ()) > Deadline) {
+      DEBUG((DEBUG_ERROR, "MvI2cDxe: Timeout sending STOP condition\n"));
+      break;
+    }
+  }
 
   return EFI_SUCCESS;
 }
@@ -489,7 +510,6 @@ MvI2cRead (
   UINTN LastByte;
   EFI_STATUS Status;
 
-  EfiAcquireLock (&I2cMasterContext->Lock);
   *read = 0;
   while (*read < Length) {
     /*
@@ -502,7 +522,6 @@ MvI2cRead (
     else
       MvI2cControlSet(I2cMasterContext, I2C_CONTROL_ACK);
 
-    gBS->Stall (I2C_OPERATION_TIMEOUT);
     MvI2cClearIflg(I2cMasterContext);
 
     if (MvI2cPollCtrl(I2cMasterContext, delay, I2C_CONTROL_IFLG)) {
@@ -524,7 +543,6 @@ MvI2cRead (
   }
   Status = EFI_SUCCESS;
 out:
-  EfiReleaseLock (&I2cMasterContext->Lock);
   return (Status);
 }
 
@@ -541,7 +559,6 @@ MvI2cWrite (
   UINT32 status;
   EFI_STATUS Status;
 
-  EfiAcquireLock (&I2cMasterContext->Lock);
   *Sent = 0;
   while (*Sent < Length) {
     I2C_WRITE(I2cMasterContext, I2C_DATA, *Buf++);
@@ -563,13 +580,16 @@ MvI2cWrite (
   }
   Status = EFI_SUCCESS;
 out:
-  EfiReleaseLock (&I2cMasterContext->Lock);
   return (Status);
 }
 
 /*
  * MvI2cStartRequest should be called only by I2cHost.
  * I2C device drivers ought to use EFI_I2C_IO_PROTOCOL instead.
+ *
+ * The whole packet is issued under a single acquisition of the controller
+ * lock, so multi-operation transfers (e.g. EEPROM address write followed by
+ * a data read) run back to back without other requests interleaving.
  */
 STATIC
 EFI_STATUS
@@ -584,6 +604,7 @@ MvI2cStartRequest (
   UINTN Count;
   UINTN ReadMode;
   UINTN Transmitted;
+  UINTN LastRead;
   I2C_MASTER_CONTEXT *I2cMasterContext = I2C_SC_FROM_MASTER(This);
   EFI_I2C_OPERATION *Operation;
   EFI_STATUS Status = EFI_SUCCESS;
@@ -591,6 +612,8 @@ MvI2cStartRequest (
   ASSERT (RequestPacket != NULL);
   ASSERT (I2cMasterContext != NULL);
 
+  EfiAcquireLock (&I2cMasterContext->Lock);
+
   for (Count = 0; Count < RequestPacket->OperationCount; Count++) {
     Operation = &RequestPacket->Operation[Count];
     ReadMode = Operation->Flags & I2C_FLAG_READ;
@@ -616,11 +639,18 @@ MvI2cStartRequest (
      * proceed to read or write section.
      */
     if (ReadMode) {
+      /*
+       * The last byte is NACKed whenever a (repeated) START or STOP follows,
+       * per I2C specs.
+       */
+      LastRead = (Count == RequestPacket->OperationCount - 1) ||
+                 !(RequestPacket->Operation[Count + 1].Flags &
+                   I2C_FLAG_NORESTART);
       Status = MvI2cRead (I2cMasterContext,
                  Operation->Buffer,
                  Operation->LengthInBytes,
                  &Transmitted,
-                 Count == 1,
+                 LastRead,
                  I2C_TRANSFER_TIMEOUT);
       Operation->LengthInBytes = Transmitted;
     } else {
@@ -647,11 +677,15 @@ MvI2cStartRequest (
     }
   }
 
+  EfiReleaseLock (&I2cMasterContext->Lock);
+
   if (I2cStatus != NULL)
-    *I2cStatus = EFI_SUCCESS;
-  if (Event != NULL)
+    *I2cStatus = Status;
+  if (Event != NULL) {
     gBS->SignalEvent(Event);
-  return EFI_SUCCESS;
+    return EFI_SUCCESS;
+  }
+  return Status;
 }
 
 STATIC CONST EFI_GUID DevGuid = I2C_GUID;
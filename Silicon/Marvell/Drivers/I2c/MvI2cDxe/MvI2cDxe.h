@@ -38,6 +38,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define I2C_BAUD_RATE_RAW(C,M,N)  ((C)/((10*(M+1))<<(N+1)))
 #define I2C_M_FROM_BAUD(baud)     (((baud) >> 3) & 0xf)
 #define I2C_N_FROM_BAUD(baud)     ((baud) & 0x7)
+#define I2C_MAX_BAUD_RATE         1000000 /* fast mode plus */
 
 #define I2C_SOFT_RESET    0x1c
 #define I2C_TRANSFER_TIMEOUT 10000
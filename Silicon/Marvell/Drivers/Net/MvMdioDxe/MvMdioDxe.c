@@ -189,7 +189,7 @@ MvMdioDxeInitialise (
   )
 {
   MARVELL_BOARD_DESC_PROTOCOL *BoardDescProtocol;
-  MV_BOARD_MDIO_DESC *MdioBoardDesc;
+  MV_BOARD_MDIO_DESC CONST *MdioBoardDesc;
   UINT8 Index;
   MARVELL_MDIO_PROTOCOL *Mdio;
   EFI_STATUS Status;
@@ -203,7 +203,7 @@ MvMdioDxeInitialise (
     return Status;
   }
 
-  Status = BoardDescProtocol->BoardDescMdioGet (BoardDescProtocol,
+  Status = BoardDescProtocol->MdioDescriptionGet (BoardDescProtocol,
                                 &MdioBoardDesc);
   if (EFI_ERROR (Status)) {
     return Status;
@@ -242,7 +242,5 @@ MvMdioDxeInitialise (
     return Status;
   }
 
-  BoardDescProtocol->BoardDescFree (MdioBoardDesc);
-
   return EFI_SUCCESS;
 }
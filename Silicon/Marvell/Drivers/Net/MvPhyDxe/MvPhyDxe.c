@@ -306,8 +306,6 @@ MvPhyInit1512 (
     IN OUT PHY_DEVICE *PhyDev
     )
 {
-  EFI_STATUS Status;
-
   if (PhyDev->Connection == PHY_CONNECTION_SGMII) {
     /* Select page 0xff and update configuration registers according to
      * Marvell Release Notes - Alaska 88E1510/88E1518/88E1512 Rev A0,
@@ -340,17 +338,6 @@ MvPhyInit1512 (
 
   MvPhyM88e1111sConfig (PhyDev);
 
-  /* autonegotiation on startup is not always required */
-  if (!PcdGetBool (PcdPhyStartupAutoneg))
-    return EFI_SUCCESS;
-
-  Status = MvPhyConfigureAutonegotiation (PhyDev);
-  if (EFI_ERROR (Status)) {
-    return Status;
-  }
-
-  MvPhyParseStatus (PhyDev);
-
   return EFI_SUCCESS;
 }
 
@@ -368,28 +355,28 @@ MvPhyInit1112 (
   IN OUT PHY_DEVICE              *PhyDevice
   )
 {
-  EFI_STATUS Status;
-
   MvPhyM88e1111sConfig (PhyDevice);
 
-  if (PcdGetBool (PcdPhyStartupAutoneg)) {
-    Status = MvPhyConfigureAutonegotiation (PhyDevice);
-    if (EFI_ERROR (Status)) {
-      return Status;
-    }
-
-    MvPhyParseStatus (PhyDevice);
-  }
-
   return EFI_SUCCESS;
 }
 
+/**
+  Allocate the PHY device structure of a PHY and configure the PHY, without
+  waiting for its auto-negotiation to complete.
+
+  @param[in]      Snp             Marvell PHY protocol instance.
+  @param[in]      PhyIndex        Index of the PHY in the board PCDs.
+  @param[in]      PhyConnection   Connection type of the PHY.
+  @param[out]    *OutPhyDev       Allocated PHY device structure.
+
+**/
+STATIC
 EFI_STATUS
-MvPhyInit (
+MvPhyConfigure (
   IN CONST MARVELL_PHY_PROTOCOL *Snp,
   IN UINT32 PhyIndex,
   IN PHY_CONNECTION PhyConnection,
-  IN OUT PHY_DEVICE **OutPhyDev
+  OUT PHY_DEVICE **OutPhyDev
   )
 {
   EFI_STATUS Status;
@@ -428,6 +415,9 @@ MvPhyInit (
 
   /* perform setup common for all PHYs */
   PhyDev = AllocateZeroPool (sizeof (PHY_DEVICE));
+  if (PhyDev == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
   PhyDev->Addr = PhySmiAddresses[PhyIndex];
   PhyDev->Connection = PhyConnection;
   PhyDev->MdioIndex = MdioIndex;
@@ -441,6 +431,152 @@ MvPhyInit (
   return MvPhyDevices[PhyId].DevInit (Snp, PhyDev);
 }
 
+EFI_STATUS
+MvPhyInit (
+  IN CONST MARVELL_PHY_PROTOCOL *Snp,
+  IN UINT32 PhyIndex,
+  IN PHY_CONNECTION PhyConnection,
+  IN OUT PHY_DEVICE **OutPhyDev
+  )
+{
+  EFI_STATUS Status;
+
+  Status = MvPhyConfigure (Snp, PhyIndex, PhyConnection, OutPhyDev);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  /* autonegotiation on startup is not always required */
+  if (!PcdGetBool (PcdPhyStartupAutoneg))
+    return EFI_SUCCESS;
+
+  Status = MvPhyConfigureAutonegotiation (*OutPhyDev);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  MvPhyParseStatus (*OutPhyDev);
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Initialize a set of PHYs, waiting for their auto-negotiation in parallel.
+
+  All PHYs are configured first, which restarts auto-negotiation on each of
+  them. The ones still negotiating are then polled in turn against a single
+  shared timeout, instead of one timeout per PHY.
+
+  @param[in]      This            Marvell PHY protocol instance.
+  @param[in]      PhyCount        Number of PHYs to initialize.
+  @param[in]     *PhyIndexes      Indexes of the PHYs in the board PCDs.
+  @param[in]     *PhyConnections  Connection types of the PHYs.
+  @param[out]   **PhyDevs         Allocated PHY device structures.
+  @param[out]    *PhyStatuses     Initialization status of every PHY.
+
+**/
+EFI_STATUS
+EFIAPI
+MvPhyInitMultiple (
+  IN CONST MARVELL_PHY_PROTOCOL *This,
+  IN UINTN PhyCount,
+  IN UINT32 *PhyIndexes,
+  IN PHY_CONNECTION *PhyConnections,
+  OUT PHY_DEVICE **PhyDevs,
+  OUT EFI_STATUS *PhyStatuses
+  )
+{
+  BOOLEAN *Negotiating;
+  UINTN NegotiatingCount;
+  UINTN Index;
+  UINTN Elapsed;
+  UINT32 Data;
+
+  if ((PhyCount == 0) || (PhyIndexes == NULL) || (PhyConnections == NULL) ||
+      (PhyDevs == NULL) || (PhyStatuses == NULL)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Negotiating = AllocateZeroPool (PhyCount * sizeof (BOOLEAN));
+  if (Negotiating == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  for (Index = 0; Index < PhyCount; Index++) {
+    PhyDevs[Index] = NULL;
+    PhyStatuses[Index] = MvPhyConfigure (This,
+                           PhyIndexes[Index],
+                           PhyConnections[Index],
+                           &PhyDevs[Index]);
+  }
+
+  /* autonegotiation on startup is not always required */
+  if (!PcdGetBool (PcdPhyStartupAutoneg)) {
+    FreePool (Negotiating);
+    return EFI_SUCCESS;
+  }
+
+  /* PHYs which are done or unable to negotiate are handled right away */
+  NegotiatingCount = 0;
+  for (Index = 0; Index < PhyCount; Index++) {
+    if (EFI_ERROR (PhyStatuses[Index])) {
+      continue;
+    }
+
+    Mdio->Read (Mdio, PhyDevs[Index]->Addr, PhyDevs[Index]->MdioIndex, MII_BMSR, &Data);
+    if ((Data & BMSR_ANEGCAPABLE) && !(Data & BMSR_ANEGCOMPLETE)) {
+      Negotiating[Index] = TRUE;
+      NegotiatingCount++;
+    } else {
+      MvPhyConfigureAutonegotiation (PhyDevs[Index]);
+      MvPhyParseStatus (PhyDevs[Index]);
+    }
+  }
+
+  if (NegotiatingCount > 0) {
+    DEBUG ((DEBUG_INFO,
+      "%a: Waiting for auto negotiation on %d PHYs...\n",
+      __FUNCTION__,
+      NegotiatingCount));
+  }
+
+  /* Poll the remaining PHYs round-robin, 1 ms per round */
+  for (Elapsed = 0;
+       (NegotiatingCount > 0) && (Elapsed <= PHY_AUTONEGOTIATE_TIMEOUT);
+       Elapsed++) {
+    for (Index = 0; Index < PhyCount; Index++) {
+      if (!Negotiating[Index]) {
+        continue;
+      }
+
+      Mdio->Read (Mdio, PhyDevs[Index]->Addr, PhyDevs[Index]->MdioIndex, MII_BMSR, &Data);
+      if (Data & BMSR_ANEGCOMPLETE) {
+        Negotiating[Index] = FALSE;
+        NegotiatingCount--;
+        PhyDevs[Index]->LinkUp = TRUE;
+        DEBUG ((DEBUG_INFO, "%a: PHY#%d link up\n", __FUNCTION__, PhyIndexes[Index]));
+        MvPhyParseStatus (PhyDevs[Index]);
+      }
+    }
+
+    if (NegotiatingCount > 0) {
+      gBS->Stall (1000);  /* 1 ms */
+    }
+  }
+
+  for (Index = 0; Index < PhyCount; Index++) {
+    if (Negotiating[Index]) {
+      DEBUG ((DEBUG_ERROR, "%a: PHY#%d Timeout\n", __FUNCTION__, PhyIndexes[Index]));
+      PhyDevs[Index]->LinkUp = FALSE;
+      PhyStatuses[Index] = EFI_TIMEOUT;
+    }
+  }
+
+  FreePool (Negotiating);
+
+  return EFI_SUCCESS;
+}
+
 EFI_STATUS
 MvPhyStatus (
   IN CONST MARVELL_PHY_PROTOCOL *This,
@@ -475,6 +611,7 @@ MvPhyDxeInitialise (
   Phy = AllocateZeroPool (sizeof (MARVELL_PHY_PROTOCOL));
   Phy->Status = MvPhyStatus;
   Phy->Init = MvPhyInit;
+  Phy->InitMultiple = MvPhyInitMultiple;
 
   Status = gBS->InstallMultipleProtocolInterfaces (
                   &Handle,
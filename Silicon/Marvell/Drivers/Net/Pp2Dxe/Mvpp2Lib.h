@@ -594,6 +594,37 @@ Mvpp2BmPoolPut (
   Mvpp2Write(Priv, MVPP2_BM_PHY_RLS_REG(Pool), (UINT32)BufPhysAddr);
 }
 
+/*
+ * Release a batch of buffers to BM. The high address bits register
+ * is only rewritten when it differs from the previously released buffer.
+ */
+STATIC
+inline
+VOID
+Mvpp2BmPoolPutMultiple (
+  IN MVPP2_SHARED *Priv,
+  IN INT32 *Pools,
+  IN UINT64 *BufPhysAddrs,
+  IN UINT64 *BufVirtAddrs,
+  IN UINTN Count
+  )
+{
+  UINT32 Val;
+  UINT32 LastVal = 0;
+  UINTN Index;
+
+  for (Index = 0; Index < Count; Index++) {
+    Val = (Upper32Bits(BufVirtAddrs[Index]) & MVPP22_ADDR_HIGH_MASK) << MVPP22_BM_VIRT_HIGH_RLS_OFFST;
+    Val |= (Upper32Bits(BufPhysAddrs[Index]) & MVPP22_ADDR_HIGH_MASK) << MVPP22_BM_PHY_HIGH_RLS_OFFSET;
+    if (Index == 0 || Val != LastVal) {
+      Mvpp2Write(Priv, MVPP22_BM_PHY_VIRT_HIGH_RLS_REG, Val);
+      LastVal = Val;
+    }
+    Mvpp2Write(Priv, MVPP2_BM_VIRT_RLS_REG, (UINT32)BufVirtAddrs[Index]);
+    Mvpp2Write(Priv, MVPP2_BM_PHY_RLS_REG(Pools[Index]), (UINT32)BufPhysAddrs[Index]);
+  }
+}
+
 STATIC
 inline
 VOID
@@ -18,10 +18,15 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 //
 // NonDiscoverable devices registration
 //
+// Only the MMIO resources are published here. The board specific bring-up
+// returned by NonDiscoverableDeviceInitializerGet () is run by
+// NonDiscoverablePciDeviceDxe when the device is first connected, so
+// controllers that are never connected are never powered up.
+//
 STATIC
 EFI_STATUS
 NonDiscoverableInitXhci (
-  IN MV_BOARD_XHCI_DESC *Desc
+  IN MV_BOARD_XHCI_DESC CONST *Desc
   )
 {
   EFI_STATUS Status;
@@ -52,7 +57,7 @@ NonDiscoverableInitXhci (
 STATIC
 EFI_STATUS
 NonDiscoverableInitAhci (
-  IN MV_BOARD_AHCI_DESC *Desc
+  IN MV_BOARD_AHCI_DESC CONST *Desc
   )
 {
   EFI_STATUS Status;
@@ -123,8 +128,8 @@ NonDiscoverableEntryPoint (
 {
   MARVELL_BOARD_DESC_PROTOCOL *BoardDescProtocol;
   MV_BOARD_SDMMC_DESC *SdMmcBoardDesc;
-  MV_BOARD_AHCI_DESC *AhciBoardDesc;
-  MV_BOARD_XHCI_DESC *XhciBoardDesc;
+  MV_BOARD_AHCI_DESC CONST *AhciBoardDesc;
+  MV_BOARD_XHCI_DESC CONST *XhciBoardDesc;
   EFI_STATUS Status;
 
   /* Obtain list of available controllers */
@@ -136,7 +141,7 @@ NonDiscoverableEntryPoint (
   }
 
   /* Xhci */
-  Status = BoardDescProtocol->BoardDescXhciGet (BoardDescProtocol,
+  Status = BoardDescProtocol->XhciDescriptionGet (BoardDescProtocol,
                                 &XhciBoardDesc);
   if (EFI_ERROR (Status)) {
     return Status;
@@ -145,10 +150,9 @@ NonDiscoverableEntryPoint (
   if (EFI_ERROR(Status)) {
     return Status;
   }
-  BoardDescProtocol->BoardDescFree (XhciBoardDesc);
 
   /* Ahci */
-  Status = BoardDescProtocol->BoardDescAhciGet (BoardDescProtocol,
+  Status = BoardDescProtocol->AhciDescriptionGet (BoardDescProtocol,
                                 &AhciBoardDesc);
   if (EFI_ERROR (Status)) {
     return Status;
@@ -157,7 +161,6 @@ NonDiscoverableEntryPoint (
   if (EFI_ERROR(Status)) {
     return Status;
   }
-  BoardDescProtocol->BoardDescFree (AhciBoardDesc);
 
   /* SdMmc */
   Status = BoardDescProtocol->BoardDescSdMmcGet (BoardDescProtocol,
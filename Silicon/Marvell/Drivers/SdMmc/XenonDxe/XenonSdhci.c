@@ -268,7 +268,7 @@ EmmcPhyEnableDll (
 {
   UINT32 Var;
   UINT16 SlotState;
-  UINT8 Retry;
+  UINT32 Retry;
 
   XenonHcRwMmio (PciIo, SD_BAR_INDEX, EMMC_PHY_DLL_CONTROL, TRUE, SDHC_REG_SIZE_4B, &Var);
   if (Var & DLL_ENABLE) {
@@ -290,20 +290,25 @@ EmmcPhyEnableDll (
   Var |= DLL_UPDATE;
   XenonHcRwMmio (PciIo, SD_BAR_INDEX, EMMC_PHY_DLL_CONTROL, FALSE, SDHC_REG_SIZE_4B, &Var);
 
-  // Wait max 32 ms for the DLL to lock
-  Retry = 32;
-  do {
+  //
+  // Wait max 32 ms for the DLL to lock. With DLL_FAST_LOCK this normally
+  // takes a few microseconds, so poll finely and don't stall once locked.
+  //
+  Retry = DLL_LOCK_POLL_RETRY;
+  for (;;) {
     XenonHcRwMmio (PciIo, SD_BAR_INDEX, XENON_SLOT_EXT_PRESENT_STATE, TRUE, SDHC_REG_SIZE_2B, &SlotState);
+    if (SlotState & DLL_LOCK_STATE) {
+      break;
+    }
 
     if (Retry == 0) {
       DEBUG ((DEBUG_ERROR, "SD/MMC: Fail to lock DLL\n"));
       return EFI_TIMEOUT;
     }
 
-    gBS->Stall (1000);
+    gBS->Stall (DLL_LOCK_POLL_INTERVAL_US);
     Retry--;
-
-  } while (!(SlotState & DLL_LOCK_STATE));
+  }
 
   return EFI_SUCCESS;
 }
@@ -207,6 +207,8 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #define XENON_SLOT_EXT_PRESENT_STATE  0x014C
 #define DLL_LOCK_STATE                0x1
+#define DLL_LOCK_POLL_INTERVAL_US     10
+#define DLL_LOCK_POLL_RETRY           (32000 / DLL_LOCK_POLL_INTERVAL_US)
 
 #define XENON_SLOT_DLL_CUR_DLY_VAL    0x0150
 
@@ -872,6 +872,15 @@ MvFvbEraseBlocks (
         return EFI_DEVICE_ERROR;
       }
 
+      // Update shadow buffer
+      if (!FlashInstance->IsMemoryMapped) {
+        BlockAddress = GET_DATA_OFFSET (FlashInstance->RegionBaseAddress,
+                         FlashInstance->StartLba + StartingLba,
+                         FlashInstance->Media.BlockSize);
+
+        SetMem ((VOID *)BlockAddress, FlashInstance->Media.BlockSize, 0xFF);
+      }
+
       // Move to the next Lba
       StartingLba++;
       NumOfLba--;
@@ -229,7 +229,10 @@ MvSpiFlashRead (
     }
     SpiFlashFormatAddress (ReadAddr, Slave->AddrSize, Cmd);
     // Program proper read address and read data
-    Status = MvSpiFlashReadCmd (Slave, Cmd, Slave->AddrSize + 2, Buf, Length);
+    Status = MvSpiFlashReadCmd (Slave, Cmd, Slave->AddrSize + 2, Buf, ReadLength);
+    if (EFI_ERROR (Status)) {
+      break;
+    }
 
     Offset += ReadLength;
     Length -= ReadLength;
@@ -280,6 +283,26 @@ MvSpiFlashWrite (
   return EFI_SUCCESS;
 }
 
+STATIC
+UINTN
+MvSpiFlashEraseSize (
+  IN SPI_DEVICE *Slave
+  )
+{
+  if (Slave->Info->Flags & NOR_FLASH_ERASE_4K) {
+    return SIZE_4KB;
+  } else if (Slave->Info->Flags & NOR_FLASH_ERASE_32K) {
+    return SIZE_32KB;
+  }
+  return Slave->Info->SectorSize;
+}
+
+/*
+ * Update ToUpdate bytes at the beginning of a sector, preserving the rest of
+ * the sector. The sector is compared with the new data one erase unit at a
+ * time, and only the units that differ are erased and written again, so that
+ * an update of an image that barely changed costs little more than reading it.
+ */
 STATIC
 EFI_STATUS
 MvSpiFlashUpdateBlock (
@@ -292,6 +315,7 @@ MvSpiFlashUpdateBlock (
   )
 {
   EFI_STATUS Status;
+  UINTN UnitSize, UnitOffset, NewLength;
 
   // Read backup
   Status = MvSpiFlashRead (Slave, Offset, EraseSize, TmpBuf);
@@ -300,27 +324,42 @@ MvSpiFlashUpdateBlock (
       return Status;
     }
 
-  // Erase entire sector
-  Status = MvSpiFlashErase (Slave, Offset, EraseSize);
-  if (EFI_ERROR (Status)) {
+  UnitSize = MvSpiFlashEraseSize (Slave);
+  if (EraseSize % UnitSize) {
+    UnitSize = EraseSize;
+  }
+
+  for (UnitOffset = 0; UnitOffset < ToUpdate; UnitOffset += UnitSize) {
+    NewLength = MIN (ToUpdate - UnitOffset, UnitSize);
+
+    // Leave the unit alone if it already holds the new data
+    if (CompareMem (&TmpBuf[UnitOffset], &Buf[UnitOffset], NewLength) == 0) {
+      continue;
+    }
+
+    // Erase the unit
+    Status = MvSpiFlashErase (Slave, Offset + UnitOffset, UnitSize);
+    if (EFI_ERROR (Status)) {
       DEBUG((DEBUG_ERROR, "SpiFlash: Update: Error while erasing block\n"));
       return Status;
     }
 
-  // Write new data
-  MvSpiFlashWrite (Slave, Offset, ToUpdate, Buf);
-  if (EFI_ERROR (Status)) {
+    // Write new data
+    Status = MvSpiFlashWrite (Slave, Offset + UnitOffset, NewLength,
+      &Buf[UnitOffset]);
+    if (EFI_ERROR (Status)) {
       DEBUG((DEBUG_ERROR, "SpiFlash: Update: Error while writing new data\n"));
       return Status;
     }
 
-  // Write backup
-  if (ToUpdate != EraseSize) {
-    Status = MvSpiFlashWrite (Slave, Offset + ToUpdate, EraseSize - ToUpdate,
-      &TmpBuf[ToUpdate]);
-    if (EFI_ERROR (Status)) {
-      DEBUG((DEBUG_ERROR, "SpiFlash: Update: Error while writing backup\n"));
-      return Status;
+    // Write backup
+    if (NewLength != UnitSize) {
+      Status = MvSpiFlashWrite (Slave, Offset + UnitOffset + NewLength,
+        UnitSize - NewLength, &TmpBuf[UnitOffset + NewLength]);
+      if (EFI_ERROR (Status)) {
+        DEBUG((DEBUG_ERROR, "SpiFlash: Update: Error while writing backup\n"));
+        return Status;
+      }
     }
   }
 
@@ -388,7 +427,7 @@ MvSpiFlashUpdateWithProgress (
   UINT8 *TmpBuf;
 
   SectorSize = Slave->Info->SectorSize;
-  SectorNum = (ByteCount / SectorSize) + 1;
+  SectorNum = (ByteCount + SectorSize - 1) / SectorSize;
   ToUpdate = SectorSize;
 
   TmpBuf = (UINT8 *)AllocateZeroPool (SectorSize);
@@ -405,7 +444,7 @@ MvSpiFlashUpdateWithProgress (
 
     // In the last chunk update only an actual number of remaining bytes.
     if (Index + 1 == SectorNum) {
-      ToUpdate = ByteCount % SectorSize;
+      ToUpdate = ByteCount - Index * SectorSize;
     }
 
     Status = MvSpiFlashUpdateBlock (Slave,
@@ -416,6 +455,7 @@ MvSpiFlashUpdateWithProgress (
                SectorSize);
     if (EFI_ERROR (Status)) {
       DEBUG ((DEBUG_ERROR, "%a: Error while updating\n", __FUNCTION__));
+      FreePool (TmpBuf);
       return Status;
     }
   }
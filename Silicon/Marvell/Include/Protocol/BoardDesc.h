@@ -98,6 +98,74 @@ EFI_STATUS
   IN OUT MV_BOARD_UTMI_DESC      **UtmiDesc
   );
 
+/**
+  Return the description of controllers of one type used on the platform.
+
+  The *DescriptionGet functions below return a table that is built once and
+  shared by all callers. It must not be modified or passed to BoardDescFree.
+  The BoardDesc*Get functions return a pool copy of the same table, which the
+  caller releases with BoardDescFree.
+
+  @param[in]      *This                 Pointer to board description protocol.
+  @param[in out] **Description          Array containing controllers'
+                                        description.
+
+  @retval EFI_SUCCESS                   The data were obtained successfully.
+  @retval EFI_NOT_FOUND                 None of the controllers is used.
+  @retval EFI_INVALID_PARAMETER         Description wrongly defined.
+  @retval EFI_OUT_OF_RESOURCES          Lack of resources.
+  @retval Other                         Return error status.
+
+**/
+typedef
+EFI_STATUS
+(EFIAPI *MV_BOARD_AHCI_DESCRIPTION_GET) (
+  IN MARVELL_BOARD_DESC_PROTOCOL  *This,
+  IN OUT MV_BOARD_AHCI_DESC CONST **AhciDescription
+  );
+
+typedef
+EFI_STATUS
+(EFIAPI *MV_BOARD_COMPHY_DESCRIPTION_GET) (
+  IN MARVELL_BOARD_DESC_PROTOCOL  *This,
+  IN OUT MV_BOARD_COMPHY_DESC CONST **ComPhyDescription
+  );
+
+typedef
+EFI_STATUS
+(EFIAPI *MV_BOARD_I2C_DESCRIPTION_GET) (
+  IN MARVELL_BOARD_DESC_PROTOCOL  *This,
+  IN OUT MV_BOARD_I2C_DESC CONST **I2cDescription
+  );
+
+typedef
+EFI_STATUS
+(EFIAPI *MV_BOARD_MDIO_DESCRIPTION_GET) (
+  IN MARVELL_BOARD_DESC_PROTOCOL  *This,
+  IN OUT MV_BOARD_MDIO_DESC CONST **MdioDescription
+  );
+
+typedef
+EFI_STATUS
+(EFIAPI *MV_BOARD_PP2_DESCRIPTION_GET) (
+  IN MARVELL_BOARD_DESC_PROTOCOL  *This,
+  IN OUT MV_BOARD_PP2_DESC CONST **Pp2Description
+  );
+
+typedef
+EFI_STATUS
+(EFIAPI *MV_BOARD_UTMI_DESCRIPTION_GET) (
+  IN MARVELL_BOARD_DESC_PROTOCOL  *This,
+  IN OUT MV_BOARD_UTMI_DESC CONST **UtmiDescription
+  );
+
+typedef
+EFI_STATUS
+(EFIAPI *MV_BOARD_XHCI_DESCRIPTION_GET) (
+  IN MARVELL_BOARD_DESC_PROTOCOL  *This,
+  IN OUT MV_BOARD_XHCI_DESC CONST **XhciDescription
+  );
+
 typedef
 VOID
 (EFIAPI *MV_BOARD_DESC_FREE) (
@@ -116,6 +184,13 @@ struct _MARVELL_BOARD_DESC_PROTOCOL {
   MV_BOARD_DESC_FREE             BoardDescFree;
   MV_BOARD_GPIO_DESCRIPTION_GET  GpioDescriptionGet;
   MV_BOARD_PCIE_DESCRIPTION_GET  PcieDescriptionGet;
+  MV_BOARD_AHCI_DESCRIPTION_GET    AhciDescriptionGet;
+  MV_BOARD_COMPHY_DESCRIPTION_GET  ComPhyDescriptionGet;
+  MV_BOARD_I2C_DESCRIPTION_GET     I2cDescriptionGet;
+  MV_BOARD_MDIO_DESCRIPTION_GET    MdioDescriptionGet;
+  MV_BOARD_PP2_DESCRIPTION_GET     Pp2DescriptionGet;
+  MV_BOARD_UTMI_DESCRIPTION_GET    UtmiDescriptionGet;
+  MV_BOARD_XHCI_DESCRIPTION_GET    XhciDescriptionGet;
 };
 
 #endif // __MARVELL_BOARD_DESC_PROTOCOL_H__
@@ -0,0 +1,49 @@
+/**
+*
+*  Copyright (c) 2018, Marvell International Ltd. All rights reserved.
+*
+*  SPDX-License-Identifier: BSD-2-Clause-Patent
+*
+**/
+
+#ifndef __MARVELL_GPIO_EXPANDER_H__
+#define __MARVELL_GPIO_EXPANDER_H__
+
+#define MARVELL_GPIO_EXPANDER_PROTOCOL_GUID { 0x306138ce, 0xfb04, 0x4e1a, { 0x9c, 0xac, 0x75, 0x0b, 0x6b, 0x22, 0x00, 0x6a }}
+
+typedef struct _MARVELL_GPIO_EXPANDER_PROTOCOL MARVELL_GPIO_EXPANDER_PROTOCOL;
+
+/**
+  Drive several pins of one I/O expander as outputs at once.
+
+  All pins selected in PinMask are configured as outputs driving the
+  corresponding bit of Values. Changes are applied with at most one register
+  write per bank, and registers that already hold the requested value are
+  not written at all.
+
+  @param[in]  This              Pointer to the protocol instance.
+  @param[in]  ControllerIndex   Index of the expander, as in GPIO_PORT ().
+  @param[in]  PinMask           Bit mask of the pins to update.
+  @param[in]  Values            Output levels, one bit per pin.
+
+  @retval EFI_SUCCESS           The pins were updated.
+  @retval EFI_INVALID_PARAMETER ControllerIndex or PinMask is out of range.
+  @retval EFI_DEVICE_ERROR      An I2C transfer failed.
+
+**/
+typedef
+EFI_STATUS
+(EFIAPI *MV_GPIO_EXPANDER_SET_OUTPUTS) (
+  IN MARVELL_GPIO_EXPANDER_PROTOCOL *This,
+  IN UINTN                           ControllerIndex,
+  IN UINT64                          PinMask,
+  IN UINT64                          Values
+  );
+
+struct _MARVELL_GPIO_EXPANDER_PROTOCOL {
+  MV_GPIO_EXPANDER_SET_OUTPUTS SetOutputs;
+};
+
+extern EFI_GUID gMarvellGpioExpanderProtocolGuid;
+
+#endif // __MARVELL_GPIO_EXPANDER_H__
@@ -69,9 +69,28 @@ EFI_STATUS
   IN OUT PHY_DEVICE **PhyDev
   );
 
+/*
+ * MARVELL_PHY_INIT_MULTIPLE performs MARVELL_PHY_INIT on PhyCount PHYs at once.
+ * Auto-negotiation is started on all of them before any is waited for, so the
+ * whole set completes within a single auto-negotiation timeout. PhyDevs[] and
+ * PhyStatuses[] receive, per PHY, the allocated PHY_DEVICE (NULL on failure)
+ * and the status MARVELL_PHY_INIT would have returned for it.
+ */
+typedef
+EFI_STATUS
+(EFIAPI *MARVELL_PHY_INIT_MULTIPLE) (
+  IN CONST MARVELL_PHY_PROTOCOL *This,
+  IN UINTN PhyCount,
+  IN UINT32 *PhyIndexes,
+  IN PHY_CONNECTION *PhyConnections,
+  OUT PHY_DEVICE **PhyDevs,
+  OUT EFI_STATUS *PhyStatuses
+  );
+
 struct _MARVELL_PHY_PROTOCOL {
   MARVELL_PHY_STATUS Status;
   MARVELL_PHY_INIT Init;
+  MARVELL_PHY_INIT_MULTIPLE InitMultiple;
 };
 
 extern EFI_GUID gMarvellPhyProtocolGuid;
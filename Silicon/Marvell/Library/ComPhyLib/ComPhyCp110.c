@@ -118,47 +118,85 @@ ComPhySmc (
   return EFI_SUCCESS;
 }
 
+/*
+ * SATA lanes are brought up in two passes. ComPhySataPowerOn only kicks
+ * the PHY, the PLL lock is checked by ComPhySataPllLockWait once every
+ * lane of the chip has been started, so the lock times of several SATA
+ * lanes overlap instead of adding up.
+ */
 STATIC
-UINTN
-ComPhySataPowerUp (
+EFI_STATUS
+ComPhySataPowerOn (
   IN UINTN ChipId,
   IN UINT32 Lane,
-  IN EFI_PHYSICAL_ADDRESS HpipeBase,
   IN EFI_PHYSICAL_ADDRESS ComPhyBase,
-  IN MV_BOARD_AHCI_DESC *Desc
+  IN OUT MV_BOARD_AHCI_DESC CONST **Desc
   )
 {
+  MARVELL_BOARD_DESC_PROTOCOL *BoardDescProtocol;
   EFI_STATUS Status;
 
-  DEBUG ((DEBUG_INFO, "ComPhySata: Initialize SATA PHYs\n"));
+  DEBUG ((DEBUG_INFO, "ComPhySata: Initialize SATA PHY on lane %d\n", Lane));
+
+  /* The MAC side is shared by all SATA lanes, power it down only once */
+  if (*Desc == NULL) {
+    Status = gBS->LocateProtocol (&gMarvellBoardDescProtocolGuid,
+                    NULL,
+                    (VOID **)&BoardDescProtocol);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
 
-  DEBUG((DEBUG_INFO, "ComPhySataPowerUp: stage: MAC configuration - power down ComPhy\n"));
+    Status = BoardDescProtocol->AhciDescriptionGet (BoardDescProtocol, Desc);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
 
-  ComPhySataMacPowerDown (Desc[ChipId].SoC->AhciBaseAddress);
+    DEBUG((DEBUG_INFO, "ComPhySataPowerOn: stage: MAC configuration - power down ComPhy\n"));
 
-  Status = ComPhySmc (MV_SMC_ID_COMPHY_POWER_ON,
-             ComPhyBase,
-             Lane,
-             COMPHY_FW_FORMAT (COMPHY_SATA_MODE,
-               Desc[ChipId].SoC->AhciId,
-               COMPHY_SPEED_DEFAULT));
-  if (EFI_ERROR (Status)) {
-    return Status;
+    ComPhySataMacPowerDown ((*Desc)[ChipId].SoC->AhciBaseAddress);
   }
 
+  return ComPhySmc (MV_SMC_ID_COMPHY_POWER_ON,
+           ComPhyBase,
+           Lane,
+           COMPHY_FW_FORMAT (COMPHY_SATA_MODE,
+             (*Desc)[ChipId].SoC->AhciId,
+             COMPHY_SPEED_DEFAULT));
+}
+
+STATIC
+VOID
+ComPhySataPllLockWait (
+  IN UINTN ChipId,
+  IN EFI_PHYSICAL_ADDRESS ComPhyBase,
+  IN COMPHY_MAP *SerdesMap,
+  IN UINT32 LanesCount,
+  IN UINT32 SataLanes,
+  IN MV_BOARD_AHCI_DESC CONST *Desc
+  )
+{
+  EFI_STATUS Status;
+  UINT32 Lane;
+
   ComPhySataPhyPowerUp (Desc[ChipId].SoC->AhciBaseAddress);
 
-  Status = ComPhySmc (MV_SMC_ID_COMPHY_PLL_LOCK,
-             ComPhyBase,
-             Lane,
-             COMPHY_FW_FORMAT (COMPHY_SATA_MODE,
-               Desc[ChipId].SoC->AhciId,
-               COMPHY_SPEED_DEFAULT));
-  if (EFI_ERROR (Status)) {
-    return Status;
-  }
+  for (Lane = 0; Lane < LanesCount; Lane++) {
+    if ((SataLanes & (1 << Lane)) == 0) {
+      continue;
+    }
 
-  return Status;
+    Status = ComPhySmc (MV_SMC_ID_COMPHY_PLL_LOCK,
+               ComPhyBase,
+               Lane,
+               COMPHY_FW_FORMAT (COMPHY_SATA_MODE,
+                 Desc[ChipId].SoC->AhciId,
+                 COMPHY_SPEED_DEFAULT));
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "Failed to lock PLL of SATA Lane %d with Status = 0x%x\n", Lane, Status));
+      SerdesMap[Lane].Type = COMPHY_TYPE_UNCONNECTED;
+    }
+  }
 }
 
 VOID
@@ -168,18 +206,19 @@ ComPhyCp110Init (
 {
   EFI_STATUS Status;
   COMPHY_MAP *PtrComPhyMap, *SerdesMap;
-  EFI_PHYSICAL_ADDRESS ComPhyBaseAddr, HpipeBaseAddr;
-  MARVELL_BOARD_DESC_PROTOCOL *BoardDescProtocol;
-  MV_BOARD_AHCI_DESC *AhciBoardDesc;
+  EFI_PHYSICAL_ADDRESS ComPhyBaseAddr;
+  MV_BOARD_AHCI_DESC CONST *AhciBoardDesc;
   UINT32 ComPhyMaxCount, Lane;
   UINT32 PcieWidth = 0;
+  UINT32 SataLanes;
   UINT8 ChipId;
 
   ComPhyMaxCount = PtrChipCfg->LanesCount;
   ComPhyBaseAddr = PtrChipCfg->ComPhyBaseAddr;
-  HpipeBaseAddr = PtrChipCfg->Hpipe3BaseAddr;
   SerdesMap = PtrChipCfg->MapData;
   ChipId = PtrChipCfg->ChipId;
+  AhciBoardDesc = NULL;
+  SataLanes = 0;
 
   /* Check if the first 4 Lanes configured as By-4 */
   for (Lane = 0, PtrComPhyMap = SerdesMap; Lane < 4; Lane++, PtrComPhyMap++) {
@@ -218,27 +257,13 @@ ComPhyCp110Init (
     case COMPHY_TYPE_SATA1:
     case COMPHY_TYPE_SATA2:
     case COMPHY_TYPE_SATA3:
-      /* Obtain AHCI board description */
-      Status = gBS->LocateProtocol (&gMarvellBoardDescProtocolGuid,
-                      NULL,
-                      (VOID **)&BoardDescProtocol);
-      if (EFI_ERROR (Status)) {
-        break;
-      }
-
-      Status = BoardDescProtocol->BoardDescAhciGet (BoardDescProtocol,
-                                    &AhciBoardDesc);
-      if (EFI_ERROR (Status)) {
-        break;
-      }
-
-      Status = ComPhySataPowerUp (ChipId,
+      Status = ComPhySataPowerOn (ChipId,
                  Lane,
-                 HpipeBaseAddr,
                  ComPhyBaseAddr,
-                 AhciBoardDesc);
-
-      BoardDescProtocol->BoardDescFree (AhciBoardDesc);
+                 &AhciBoardDesc);
+      if (!EFI_ERROR (Status)) {
+        SataLanes |= 1 << Lane;
+      }
       break;
     case COMPHY_TYPE_USB3_HOST0:
     case COMPHY_TYPE_USB3_HOST1:
@@ -285,4 +310,13 @@ ComPhyCp110Init (
       PtrComPhyMap->Type = COMPHY_TYPE_UNCONNECTED;
     }
   }
+
+  if (SataLanes != 0) {
+    ComPhySataPllLockWait (ChipId,
+      ComPhyBaseAddr,
+      SerdesMap,
+      ComPhyMaxCount,
+      SataLanes,
+      AhciBoardDesc);
+  }
 }
@@ -128,7 +128,7 @@ VOID
 InitComPhyConfig (
   IN  OUT  CHIP_COMPHY_CONFIG *ChipConfig,
   IN  OUT  PCD_LANE_MAP       *LaneData,
-  IN       MV_BOARD_COMPHY_DESC *Desc
+  IN       MV_BOARD_COMPHY_DESC CONST *Desc
   )
 {
   ChipConfig->ChipType = Desc->SoC->ComPhyChipType;
@@ -165,7 +165,7 @@ MvComPhyInit (
   EFI_STATUS Status;
   CHIP_COMPHY_CONFIG *ChipConfig, *PtrChipCfg;
   MARVELL_BOARD_DESC_PROTOCOL *BoardDescProtocol;
-  MV_BOARD_COMPHY_DESC *ComPhyBoardDesc;
+  MV_BOARD_COMPHY_DESC CONST *ComPhyBoardDesc;
   PCD_LANE_MAP *LaneData;
   UINT32 Lane, MaxComphyCount;
   UINTN Index;
@@ -178,7 +178,7 @@ MvComPhyInit (
     return Status;
   }
 
-  Status = BoardDescProtocol->BoardDescComPhyGet (BoardDescProtocol,
+  Status = BoardDescProtocol->ComPhyDescriptionGet (BoardDescProtocol,
                                 &ComPhyBoardDesc);
   if (EFI_ERROR (Status)) {
     return Status;
@@ -188,7 +188,6 @@ MvComPhyInit (
                                  sizeof (CHIP_COMPHY_CONFIG));
   if (ChipConfig == NULL) {
     DEBUG ((DEBUG_ERROR, "%a: Cannot allocate memory\n", __FUNCTION__));
-    BoardDescProtocol->BoardDescFree (ComPhyBoardDesc);
     return EFI_OUT_OF_RESOURCES;
   }
 
@@ -196,7 +195,6 @@ MvComPhyInit (
                                sizeof (PCD_LANE_MAP));
   if (ChipConfig == NULL) {
     DEBUG ((DEBUG_ERROR, "%a: Cannot allocate memory\n", __FUNCTION__));
-    BoardDescProtocol->BoardDescFree (ComPhyBoardDesc);
     FreePool (ChipConfig);
     return EFI_OUT_OF_RESOURCES;
   }
@@ -235,7 +233,6 @@ MvComPhyInit (
     PtrChipCfg->Init (PtrChipCfg);
   }
 
-  BoardDescProtocol->BoardDescFree (ComPhyBoardDesc);
   FreePool (ChipConfig);
   FreePool (LaneData);
 
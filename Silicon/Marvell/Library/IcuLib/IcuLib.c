@@ -132,20 +132,10 @@ STATIC CONST ICU_CONFIG IcuInitialConfig = {
   .Rei =        { IrqMapRei, ARRAY_SIZE (IrqMapRei) },
 };
 
-STATIC
-VOID
-IcuClearIrq (
-  IN UINTN IcuBase,
-  IN UINTN Nr
-)
-{
-  MmioWrite32 (IcuBase + ICU_INT_CFG (Nr), 0);
-}
-
 STATIC
 VOID
 IcuSetIrq (
-  IN UINTN           IcuBase,
+  IN UINT32          *IntCfg,
   IN CONST ICU_IRQ  *Irq,
   IN UINTN           SpiBase,
   IN ICU_GROUP       Group
@@ -153,11 +143,13 @@ IcuSetIrq (
 {
   UINT32 IcuInt;
 
+  ASSERT (Irq->IcuId < MAX_ICU_IRQS);
+
   IcuInt  = (Irq->SpiId + SpiBase) | (1 << ICU_INT_ENABLE_OFFSET);
   IcuInt |= Irq->IrqType << ICU_IS_EDGE_OFFSET;
   IcuInt |= Group << ICU_GROUP_OFFSET;
 
-  MmioWrite32 (IcuBase + ICU_INT_CFG (Irq->IcuId), IcuInt);
+  IntCfg[Irq->IcuId] = IcuInt;
 }
 
 STATIC
@@ -171,6 +163,7 @@ IcuConfigure (
   UINTN IcuBase, Index, SpiOffset, SpiBase;
   CONST ICU_IRQ *Irq;
   ICU_MSI *Msi;
+  UINT32 IntCfg[MAX_ICU_IRQS];
 
   /* Get ICU registers base address */
   IcuBase = ICU_REG_BASE (CpIndex);
@@ -191,25 +184,30 @@ IcuConfigure (
     MmioWrite32 (IcuBase + ICU_CLR_SPI_AH (Msi->Group), Msi->ClrSpiAddr >> 32);
   }
 
-  /* Mask all ICU interrupts */
-  for (Index = 0; Index < MAX_ICU_IRQS; Index++) {
-    IcuClearIrq (IcuBase, Index);
-  }
+  /*
+   * Build the complete interrupt line configuration first, with all lines not
+   * in the maps masked, so that every ICU_INT_CFG register is written once.
+   */
+  ZeroMem (IntCfg, sizeof (IntCfg));
 
-  /* Configure the ICU interrupt lines */
   Irq = Config->NonSecure.Map;
   for (Index = 0; Index < Config->NonSecure.Size; Index++, Irq++) {
-    IcuSetIrq (IcuBase, Irq, SpiBase + SpiOffset, IcuGroupNsr);
+    IcuSetIrq (IntCfg, Irq, SpiBase + SpiOffset, IcuGroupNsr);
   }
 
   Irq = Config->Sei.Map;
   for (Index = 0; Index < Config->Sei.Size; Index++, Irq++) {
-    IcuSetIrq (IcuBase, Irq, SpiBase, IcuGroupSei);
+    IcuSetIrq (IntCfg, Irq, SpiBase, IcuGroupSei);
   }
 
   Irq = Config->Rei.Map;
   for (Index = 0; Index < Config->Rei.Size; Index++, Irq++) {
-    IcuSetIrq (IcuBase, Irq, SpiBase, IcuGroupRei);
+    IcuSetIrq (IntCfg, Irq, SpiBase, IcuGroupRei);
+  }
+
+  /* Configure the ICU interrupt lines */
+  for (Index = 0; Index < MAX_ICU_IRQS; Index++) {
+    MmioWrite32 (IcuBase + ICU_INT_CFG (Index), IntCfg[Index]);
   }
 }
 
@@ -7,6 +7,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #include <Library/ArmLib.h>
 #include <Library/ArmPlatformLib.h>
+#include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
 #include <Library/PcdLib.h>
 #include <Library/MemoryAllocationLib.h>
@@ -69,7 +70,17 @@ SetRegisterValue (
         CtrlMask |= MPP_PIN_VAL(PinIndex, 0xf);
       }
     }
-    MmioAndThenOr32 (BaseAddr + 4 * i * Sign, ~CtrlMask, CtrlVal);
+
+    /*
+     * The register image is complete, so each control register is accessed
+     * once: a plain write when all its pins are given, no access at all when
+     * none is, and a read-modify-write only for partially described ones.
+     */
+    if (CtrlMask == MAX_UINT32) {
+      MmioWrite32 (BaseAddr + 4 * i * Sign, CtrlVal);
+    } else if (CtrlMask != 0) {
+      MmioAndThenOr32 (BaseAddr + 4 * i * Sign, ~CtrlMask, CtrlVal);
+    }
   }
 }
 
@@ -89,6 +100,14 @@ PcdToMppRegs (
     return 0;
   }
 
+  if (PinCount > MPP_MAX_REGS * MPP_PINS_PER_REG) {
+    DEBUG ((DEBUG_ERROR, "%a: Too many MPP pins (%d)\n", __FUNCTION__, PinCount));
+    PinCount = MPP_MAX_REGS * MPP_PINS_PER_REG;
+  }
+
+  /* Pins not described by the PCD groups are left untouched */
+  SetMem (MppRegPcdTmp, MPP_MAX_REGS * MPP_PINS_PER_REG, 0xff);
+
   PcdGroupCount = PinCount / PCD_PINS_PER_GROUP;
   if ((PinCount % PCD_PINS_PER_GROUP) != 0) {
     PcdGroupCount += 1;
@@ -101,7 +120,7 @@ PcdToMppRegs (
 
   /* Fill temporary table with data from PCD groups in HW format */
   for (i = 0; i < PcdGroupCount; i++) {
-    for (j = 0; j < PCD_PINS_PER_GROUP; j++) {
+    for (j = 0; (j < PCD_PINS_PER_GROUP) && (PCD_PINS_PER_GROUP * i + j < PinCount); j++) {
       k = (PCD_PINS_PER_GROUP * i + j) / MPP_PINS_PER_REG;
       l = (PCD_PINS_PER_GROUP * i + j) % MPP_PINS_PER_REG;
       MppRegPcdTmp[k][l] = (UINT8)MppRegPcd[i][j];
@@ -275,7 +275,7 @@ UtmiPhyInit (
   )
 {
   MARVELL_BOARD_DESC_PROTOCOL *BoardDescProtocol;
-  MV_BOARD_UTMI_DESC *BoardDesc;
+  MV_BOARD_UTMI_DESC CONST *BoardDesc;
   UTMI_PHY_DATA UtmiData;
   EFI_STATUS Status;
   UINTN Index;
@@ -288,7 +288,7 @@ UtmiPhyInit (
     return Status;
   }
 
-  Status = BoardDescProtocol->BoardDescUtmiGet (BoardDescProtocol, &BoardDesc);
+  Status = BoardDescProtocol->UtmiDescriptionGet (BoardDescProtocol, &BoardDesc);
   if (EFI_ERROR (Status)) {
     return Status;
   }
@@ -317,7 +317,5 @@ UtmiPhyInit (
     Cp110UtmiPhyInit (&UtmiData);
   }
 
-  BoardDescProtocol->BoardDescFree (BoardDesc);
-
   return EFI_SUCCESS;
 }
@@ -31,6 +31,10 @@ STATIC CONST EFI_I2C_CONTROLLER_CAPABILITIES mI2cControllerCapabilities = {
 /**
   Function to set i2c bus frequency
 
+  The divider closest to, but not faster than, the requested frequency is
+  selected, so speeds above 400 kHz are granted as far as the I2c input clock
+  allows. The frequency actually set is returned in BusClockHertz.
+
   @param   This            Pointer to I2c master protocol
   @param   BusClockHertz   value to be set
 
@@ -56,6 +60,8 @@ SetBusFrequency (
 
   I2cInitialize (I2cBase, I2cClock, *BusClockHertz);
 
+  *BusClockHertz = I2cGetBusFrequency (I2cBase, I2cClock);
+
   return EFI_SUCCESS;
 }
 
@@ -43,6 +43,20 @@ I2cInitialize (
   IN UINT64 Speed
   );
 
+/**
+  Get the I2c bus frequency the controller is currently programmed for
+
+  @param[in] Base         Base Address of I2c controller's registers
+  @param[in] I2cBusClock  Input clock to I2c controller
+
+  @return  Bus frequency in Hz, or 0 if the divider setting is not known
+**/
+UINT64
+I2cGetBusFrequency (
+  IN UINTN  Base,
+  IN UINT64 I2cBusClock
+  );
+
 /**
   Transfer data to/from I2c slave device
 
@@ -189,6 +189,70 @@ I2cInitialize (
   return EFI_SUCCESS;
 }
 
+/**
+  Get the I2c bus frequency the controller is currently programmed for
+
+  @param[in] Base         Base Address of I2c controller's registers
+  @param[in] I2cBusClock  Input clock to I2c controller
+
+  @return  Bus frequency in Hz, or 0 if the divider setting is not known
+**/
+UINT64
+I2cGetBusFrequency (
+  IN UINTN   Base,
+  IN UINT64  I2cBusClock
+  )
+{
+  I2C_REGS                       *Regs;
+  UINT8                          Ibfd;
+  CONST I2C_CLOCK_DIVISOR_PAIR   *ClockDivisorPair;
+  UINT32                         ClockDivisorPairSize;
+  UINT32                         Index;
+
+  Regs = (I2C_REGS *)Base;
+  Ibfd = MmioRead8 ((UINTN)&Regs->Ibfd);
+
+  if (MmioRead8 ((UINTN)&Regs->Ibdbg) & I2C_IBDBG_GLFLT_EN) {
+    ClockDivisorPair = mI2cClockDivisorGlitchEnabled;
+    ClockDivisorPairSize = ARRAY_SIZE (mI2cClockDivisorGlitchEnabled);
+  } else {
+    ClockDivisorPair = mI2cClockDivisorGlitchDisabled;
+    ClockDivisorPairSize = ARRAY_SIZE (mI2cClockDivisorGlitchDisabled);
+  }
+
+  for (Index = 0; Index < ClockDivisorPairSize; Index++) {
+    if (ClockDivisorPair[Index].Ibfd == Ibfd) {
+      return I2cBusClock / ClockDivisorPair[Index].Divisor;
+    }
+  }
+
+  return 0;
+}
+
+/**
+  Compute the deadline for a bus operation that starts now
+
+  @return  Deadline in nanoseconds on the performance counter time base
+**/
+STATIC
+UINT64
+I2cGetDeadline (
+  VOID
+  )
+{
+  return GetTimeInNanoSecond (GetPerformanceCounter ()) +
+         (I2C_TIMEOUT_US * 1000ULL);
+}
+
+STATIC
+BOOLEAN
+I2cDeadlinePassed (
+  IN  UINT64  Deadline
+  )
+{
+  return GetTimeInNanoSecond (GetPerformanceCounter ()) > Deadline;
+}
+
 STATIC
 EFI_STATUS
 I2cBusTestBusBusy (
@@ -196,10 +260,11 @@ I2cBusTestBusBusy (
   IN  BOOLEAN   TestBusy
   )
 {
-  UINT32  Index;
+  UINT64  Deadline;
   UINT8   Reg;
 
-  for (Index = 0; Index < I2C_NUM_RETRIES; Index++) {
+  Deadline = I2cGetDeadline ();
+  for (;;) {
     Reg = MmioRead8 ((UINTN)&Regs->Ibsr);
 
     if (Reg & I2C_IBSR_IBAL) {
@@ -215,11 +280,9 @@ I2cBusTestBusBusy (
       break;
     }
 
-    MicroSecondDelay (1);
-  }
-
-  if (Index == I2C_NUM_RETRIES) {
-    return EFI_TIMEOUT;
+    if (I2cDeadlinePassed (Deadline)) {
+      return EFI_TIMEOUT;
+    }
   }
 
   return EFI_SUCCESS;
@@ -232,10 +295,11 @@ I2cTransferComplete (
   IN  BOOLEAN   TestRxAck
 )
 {
-  UINT32     Index;
+  UINT64     Deadline;
   UINT8      Reg;
 
-  for (Index = 0; Index < I2C_NUM_RETRIES; Index++) {
+  Deadline = I2cGetDeadline ();
+  for (;;) {
     Reg = MmioRead8 ((UINTN)&Regs->Ibsr);
 
     if (Reg & I2C_IBSR_IBIF) {
@@ -244,11 +308,9 @@ I2cTransferComplete (
       break;
     }
 
-    MicroSecondDelay (1);
-  }
-
-  if (Index == I2C_NUM_RETRIES) {
-    return EFI_TIMEOUT;
+    if (I2cDeadlinePassed (Deadline)) {
+      return EFI_TIMEOUT;
+    }
   }
 
   if (TestRxAck && (Reg & I2C_IBSR_RXAK)) {
@@ -322,17 +384,20 @@ EFI_STATUS
 I2cWrite (
   IN  I2C_REGS           *Regs,
   IN  UINT32             SlaveAddress,
-  IN  EFI_I2C_OPERATION  *Operation
+  IN  EFI_I2C_OPERATION  *Operation,
+  IN  BOOLEAN            SendAddress
 )
 {
   EFI_STATUS Status;
   UINTN      Index;
 
-  // Write Slave Address
-  MmioWrite8 ((UINTN)&Regs->Ibdr, (SlaveAddress << BIT0) & (UINT8)(~BIT0));
-  Status = I2cTransferComplete (Regs, I2C_BUS_TEST_RX_ACK);
-  if (EFI_ERROR (Status)) {
-    return Status;
+  if (SendAddress) {
+    // Write Slave Address
+    MmioWrite8 ((UINTN)&Regs->Ibdr, (SlaveAddress << BIT0) & (UINT8)(~BIT0));
+    Status = I2cTransferComplete (Regs, I2C_BUS_TEST_RX_ACK);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
   }
 
   // Write Data
@@ -426,6 +491,7 @@ I2cBusXfer (
   EFI_I2C_OPERATION  *Operation;
   EFI_STATUS         Status;
   BOOLEAN            IsLastOperation;
+  BOOLEAN            Continue;
 
   Regs = (I2C_REGS *)Base;
   IsLastOperation = FALSE;
@@ -446,8 +512,14 @@ I2cBusXfer (
     if (Index == (RequestPacket->OperationCount - 1)) {
       IsLastOperation = TRUE;
     }
+    // A write flagged NORESTART that follows a write extends the same
+    // message, so its data goes out without a new START and slave address
+    Continue = (Index != 0) &&
+               (Operation->Flags & I2C_FLAG_NORESTART) &&
+               !(Operation->Flags & I2C_FLAG_READ) &&
+               !(Operation[-1].Flags & I2C_FLAG_READ);
     // Send repeat start after first transmit/recieve
-    if (Index) {
+    if (Index && !Continue) {
       MmioOr8 ((UINTN)&Regs->Ibcr, I2C_IBCR_RSTA);
       Status = I2cBusTestBusBusy (Regs, I2C_BUS_TEST_BUSY);
       if (EFI_ERROR (Status)) {
@@ -458,7 +530,7 @@ I2cBusXfer (
     if (Operation->Flags & I2C_FLAG_READ) {
       Status = I2cRead (Regs, SlaveAddress, Operation, IsLastOperation);
     } else {
-      Status = I2cWrite (Regs, SlaveAddress, Operation);
+      Status = I2cWrite (Regs, SlaveAddress, Operation, !Continue);
     }
     if (EFI_ERROR (Status)) {
       goto ErrorExit;
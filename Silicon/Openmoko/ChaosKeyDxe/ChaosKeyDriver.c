@@ -77,6 +77,99 @@ FindEndpoint (
 }
 
 
+/**
+  Read one packet of random data from the bulk IN endpoint.
+
+  @param[in]      ChaosKey        The device to read from.
+  @param[out]     Buffer          Buffer of at least EndpointSize bytes.
+  @param[in, out] Size            On output, the number of bytes received.
+
+  @retval EFI_SUCCESS             Data was received.
+  @retval EFI_NOT_READY           The transfer timed out.
+  @retval EFI_DEVICE_ERROR        The transfer failed.
+**/
+STATIC
+EFI_STATUS
+ReadPacket (
+  IN      CHAOSKEY_DEV  *ChaosKey,
+  OUT     UINT8         *Buffer,
+  OUT     UINTN         *Size
+  )
+{
+  EFI_STATUS        Status;
+  UINT32            Result;
+
+  *Size = ChaosKey->EndpointSize;
+
+  Status = ChaosKey->UsbIo->UsbBulkTransfer (ChaosKey->UsbIo,
+                                             ChaosKey->EndpointAddress,
+                                             Buffer,
+                                             Size,
+                                             CHAOSKEY_TIMEOUT,
+                                             &Result);
+
+  if (Status == EFI_TIMEOUT) {
+    DEBUG ((DEBUG_ERROR, "Bulk transfer timed out, USB status == %d\n",
+      Result));
+    return EFI_NOT_READY;
+  } else if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR,
+      "Bulk transfer failed, Status == %r, USB status == %d\n",
+      Status, Result));
+    return EFI_DEVICE_ERROR;
+  }
+  return EFI_SUCCESS;
+}
+
+
+/**
+  Timer callback that tops up the entropy pool by one packet, so that most
+  GetRNG () calls are served from memory instead of waiting for the USB
+  round trip.
+
+  UsbIo has no asynchronous bulk transfer, so this is the closest we can get
+  to keeping a transfer outstanding.
+**/
+STATIC
+VOID
+EFIAPI
+RefillPool (
+  IN  EFI_EVENT   Event,
+  IN  VOID        *Context
+  )
+{
+  CHAOSKEY_DEV      *ChaosKey;
+  UINTN             Size;
+
+  ChaosKey = Context;
+
+  //
+  // GetRNG () is running below us and owns the pool.
+  //
+  if (ChaosKey->PoolBusy) {
+    return;
+  }
+
+  if (ChaosKey->PoolCount == 0) {
+    ChaosKey->PoolStart = 0;
+  } else if (ChaosKey->PoolStart + ChaosKey->PoolCount +
+             ChaosKey->EndpointSize > CHAOSKEY_POOL_SIZE) {
+    if (ChaosKey->PoolCount + ChaosKey->EndpointSize > CHAOSKEY_POOL_SIZE) {
+      return;
+    }
+    CopyMem (ChaosKey->Pool, &ChaosKey->Pool[ChaosKey->PoolStart],
+      ChaosKey->PoolCount);
+    ChaosKey->PoolStart = 0;
+  }
+
+  if (!EFI_ERROR (ReadPacket (ChaosKey,
+                    &ChaosKey->Pool[ChaosKey->PoolStart + ChaosKey->PoolCount],
+                    &Size))) {
+    ChaosKey->PoolCount += Size;
+  }
+}
+
+
 /**
   Returns information about the random number generation implementation.
 
@@ -175,7 +268,6 @@ GetRNG (
   UINT8             Buffer[CHAOSKEY_MAX_EP_SIZE];
   UINT8             *OutPointer;
   UINTN             OutSize;
-  UINT32            Result;
 
   if (Algorithm != NULL && !CompareGuid (Algorithm, &gEfiRngAlgorithmRaw)) {
     return EFI_UNSUPPORTED;
@@ -183,6 +275,26 @@ GetRNG (
 
   ChaosKey = CHAOSKEY_DEV_FROM_THIS (This);
 
+  //
+  // Keep the refill timer off the pool and the endpoint while we use them.
+  //
+  ChaosKey->PoolBusy = TRUE;
+
+  //
+  // Serve what we can from the prefetched entropy first. Each byte is handed
+  // out only once.
+  //
+  OutSize = MIN (ChaosKey->PoolCount, ValueLength);
+  if (OutSize > 0) {
+    CopyMem (Value, &ChaosKey->Pool[ChaosKey->PoolStart], OutSize);
+    ZeroMem (&ChaosKey->Pool[ChaosKey->PoolStart], OutSize);
+    ChaosKey->PoolStart += OutSize;
+    ChaosKey->PoolCount -= OutSize;
+    Value += OutSize;
+    ValueLength -= OutSize;
+  }
+
+  Status = EFI_SUCCESS;
   while (ValueLength > 0) {
     //
     // If more data is requested than the endpoint can deliver in a single
@@ -193,35 +305,23 @@ GetRNG (
     } else {
       OutPointer = Buffer;
     }
-    OutSize = ChaosKey->EndpointSize;
-
-    Status = ChaosKey->UsbIo->UsbBulkTransfer (ChaosKey->UsbIo,
-                                               ChaosKey->EndpointAddress,
-                                               OutPointer,
-                                               &OutSize,
-                                               CHAOSKEY_TIMEOUT,
-                                               &Result);
-
-    if (Status == EFI_TIMEOUT) {
-      DEBUG ((DEBUG_ERROR, "Bulk transfer timed out, USB status == %d\n",
-        Result));
-      return EFI_NOT_READY;
-    } else if (EFI_ERROR (Status)) {
-      DEBUG ((DEBUG_ERROR,
-        "Bulk transfer failed, Status == %r, USB status == %d\n",
-        Status, Result));
-      return EFI_DEVICE_ERROR;
+
+    Status = ReadPacket (ChaosKey, OutPointer, &OutSize);
+    if (EFI_ERROR (Status)) {
+      break;
     }
 
     OutSize = MIN (OutSize, ValueLength);
 
-    if (Value != Buffer) {
+    if (OutPointer == Buffer) {
       gBS->CopyMem (Value, Buffer, OutSize);
     }
     Value += OutSize;
     ValueLength -= OutSize;
   }
-  return EFI_SUCCESS;
+
+  ChaosKey->PoolBusy = FALSE;
+  return Status;
 }
 
 
@@ -234,10 +334,8 @@ ChaosKeyInit (
   EFI_STATUS                Status;
   CHAOSKEY_DEV              *ChaosKey;
 
-  Status  = gBS->AllocatePool (EfiBootServicesData,
-                               sizeof (CHAOSKEY_DEV),
-                               (VOID **) &ChaosKey);
-  if (EFI_ERROR (Status)) {
+  ChaosKey = AllocateZeroPool (sizeof (CHAOSKEY_DEV));
+  if (ChaosKey == NULL) {
     return EFI_OUT_OF_RESOURCES;
   }
 
@@ -269,6 +367,21 @@ ChaosKeyInit (
   //
   ASSERT (ChaosKey->EndpointSize <= CHAOSKEY_MAX_EP_SIZE);
 
+  //
+  // Start prefetching entropy right away. Failing to do so is not fatal,
+  // GetRNG () then simply reads everything synchronously.
+  //
+  Status = gBS->CreateEvent (EVT_TIMER | EVT_NOTIFY_SIGNAL, TPL_CALLBACK,
+                  RefillPool, ChaosKey, &ChaosKey->RefillEvent);
+  if (!EFI_ERROR (Status)) {
+    Status = gBS->SetTimer (ChaosKey->RefillEvent, TimerPeriodic,
+                    CHAOSKEY_REFILL_PERIOD);
+    if (EFI_ERROR (Status)) {
+      gBS->CloseEvent (ChaosKey->RefillEvent);
+      ChaosKey->RefillEvent = NULL;
+    }
+  }
+
   Status = gBS->InstallProtocolInterface (&ControllerHandle,
                                           &gEfiRngProtocolGuid,
                                           EFI_NATIVE_INTERFACE,
@@ -277,11 +390,16 @@ ChaosKeyInit (
     DEBUG ((DEBUG_ERROR,
       "Failed to install RNG protocol interface (Status == %r)\n",
     Status));
-    goto ErrorCloseProtocol;
+    goto ErrorCloseEvent;
   }
 
   return EFI_SUCCESS;
 
+ErrorCloseEvent:
+  if (ChaosKey->RefillEvent != NULL) {
+    gBS->CloseEvent (ChaosKey->RefillEvent);
+  }
+
 ErrorCloseProtocol:
   gBS->CloseProtocol (ControllerHandle, &gEfiUsbIoProtocolGuid,
          DriverBindingHandle, ControllerHandle);
@@ -320,6 +438,10 @@ ChaosKeyRelease (
     return Status;
   }
 
+  if (ChaosKey->RefillEvent != NULL) {
+    gBS->CloseEvent (ChaosKey->RefillEvent);
+  }
+
   Status = gBS->CloseProtocol (ControllerHandle,
                                &gEfiUsbIoProtocolGuid,
                                DriverBindingHandle,
@@ -329,6 +451,7 @@ ChaosKeyRelease (
     return Status;
   }
 
+  ZeroMem (ChaosKey->Pool, sizeof (ChaosKey->Pool));
   gBS->FreePool (ChaosKey);
 
   return EFI_SUCCESS;
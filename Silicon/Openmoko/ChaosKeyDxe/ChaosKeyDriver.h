@@ -24,6 +24,12 @@
 #define CHAOSKEY_TIMEOUT        10 // ms
 #define CHAOSKEY_MAX_EP_SIZE    64 // max EP size for full-speed devices
 
+//
+// Entropy fetched ahead of GetRNG () calls, one transfer per timer tick
+//
+#define CHAOSKEY_POOL_SIZE      (4 * CHAOSKEY_MAX_EP_SIZE)
+#define CHAOSKEY_REFILL_PERIOD  EFI_TIMER_PERIOD_MILLISECONDS (20)
+
 #define CHAOSKEY_DEV_SIGNATURE  SIGNATURE_32('c','h','k','e')
 
 typedef struct {
@@ -32,6 +38,11 @@ typedef struct {
   UINT16                        EndpointSize;
   EFI_USB_IO_PROTOCOL           *UsbIo;
   EFI_RNG_PROTOCOL              Rng;
+  EFI_EVENT                     RefillEvent;
+  BOOLEAN                       PoolBusy;
+  UINTN                         PoolStart;
+  UINTN                         PoolCount;
+  UINT8                         Pool[CHAOSKEY_POOL_SIZE];
 } CHAOSKEY_DEV;
 
 #define CHAOSKEY_DEV_FROM_THIS(a) \
@@ -50,6 +50,9 @@ STATIC CONST CSDC_DEFINITION mN25qCSDCDefTable[] = {
   // Read Operations
   { SPINOR_OP_READ_4B,  TRUE,  TRUE,  FALSE, FALSE, CS_CFG_MBM_SINGLE,
                         CSDC_TRP_SINGLE },
+  { SPINOR_OP_READ_1_1_4_4B,
+                        TRUE,  TRUE,  TRUE,  FALSE, CS_CFG_MBM_QUAD,
+                        CSDC_TRP_SINGLE },
   // Write Operations
   { SPINOR_OP_PP,       TRUE,  FALSE, FALSE, TRUE,  CS_CFG_MBM_SINGLE,
                         CSDC_TRP_SINGLE },
@@ -107,7 +110,9 @@ STATIC CONST NOR_FLASH_INSTANCE mNorFlashInstanceTemplate = {
       { sizeof (EFI_DEVICE_PATH_PROTOCOL), 0 }
     }
   }, // DevicePath
-  0 // Flags
+  0, // Flags
+  SPINOR_OP_READ_4B, // ReadOpcode
+  CS_CFG_MBM_SINGLE // CsCfgMbm
 };
 
 EFI_STATUS
@@ -147,6 +152,10 @@ NorFlashCreateInstance (
   CopyGuid (&Instance->DevicePath.Vendor.Guid, &gEfiCallerIdGuid);
   Instance->DevicePath.Index = (UINT8)Index;
 
+  if (FixedPcdGetBool (PcdFip006DxeQuadRead)) {
+    Instance->ReadOpcode = SPINOR_OP_READ_1_1_4_4B;
+  }
+
   NorFlashReset (Instance);
 
   NorFlashReadID (Instance, JedecId);
@@ -157,9 +166,9 @@ NorFlashCreateInstance (
 
   NorFlashPrintInfo (FlashInfo);
 
-  Instance->Flags = 0;
+  Instance->Flags &= NOR_FLASH_READ_MODE;
   if (FlashInfo->Flags & NOR_FLASH_WRITE_FSR) {
-    Instance->Flags = NOR_FLASH_POLL_FSR;
+    Instance->Flags |= NOR_FLASH_POLL_FSR;
   }
 
   Instance->ShadowBuffer = AllocateRuntimePool (BlockSize);
@@ -181,6 +190,26 @@ FreeInstance:
   return Status;
 }
 
+STATIC
+VOID
+NorFlashSetHostMbm (
+  IN  NOR_FLASH_INSTANCE    *Instance,
+  IN  UINT8                 Mbm
+  )
+{
+  FIP006_CS_CFG             CsCfg;
+
+  if (Instance->CsCfgMbm == Mbm) {
+    return;
+  }
+  CsCfg.Raw = MmioRead32 (Instance->HostRegisterBaseAddress +
+                          FIP006_REG_CS_CFG);
+  CsCfg.Reg.MBM = Mbm;
+  MmioWrite32 (Instance->HostRegisterBaseAddress + FIP006_REG_CS_CFG,
+               CsCfg.Raw);
+  Instance->CsCfgMbm = Mbm;
+}
+
 STATIC
 EFI_STATUS
 NorFlashSetHostCSDC (
@@ -192,6 +221,17 @@ NorFlashSetHostCSDC (
   EFI_PHYSICAL_ADDRESS      Dst;
   UINTN                     Index;
 
+  //
+  // Any other command leaves the array read mode. The data phase of the
+  // register, erase and program commands, as well as the raw opcodes written
+  // with the null write sequence, goes out in multi-bit mode, which must
+  // therefore be single bit for them.
+  //
+  if ((Instance->Flags & NOR_FLASH_READ_MODE) != 0) {
+    Instance->Flags &= ~NOR_FLASH_READ_MODE;
+    NorFlashSetHostMbm (Instance, CS_CFG_MBM_SINGLE);
+  }
+
   Dst = Instance->HostRegisterBaseAddress
         + (ReadWrite ? FIP006_REG_CS_WR : FIP006_REG_CS_RD);
   for (Index = 0; Index < ARRAY_SIZE (mFip006NullCmdSeq); Index++) {
@@ -288,6 +328,37 @@ NorFlashSetHostCommand (
   return EFI_SUCCESS;
 }
 
+/**
+  Put the sequencer in array read mode, so that the flash can be read with
+  plain memory accesses to the region.
+
+  The sequencer is only reprogrammed if another command was issued since the
+  last time, so back to back reads cost nothing beyond the copy itself.
+
+  @param[in]  Instance  NOR flash instance.
+
+**/
+STATIC
+VOID
+NorFlashSetReadMode (
+  IN  NOR_FLASH_INSTANCE    *Instance
+  )
+{
+  CONST CSDC_DEFINITION     *Cmd;
+
+  if ((Instance->Flags & NOR_FLASH_READ_MODE) != 0) {
+    return;
+  }
+
+  Cmd = NorFlashGetCmdDef (Instance, Instance->ReadOpcode);
+  ASSERT (Cmd != NULL);
+
+  NorFlashSetHostCommand (Instance, Cmd->Code);
+  NorFlashSetHostCSDC (Instance, TRUE, mFip006NullCmdSeq);
+  NorFlashSetHostMbm (Instance, Cmd->CscfgMbm);
+  Instance->Flags |= NOR_FLASH_READ_MODE;
+}
+
 STATIC
 UINT8
 NorFlashReadStatusRegister (
@@ -458,8 +529,26 @@ NorFlashEraseSingleBlock (
   return EFI_SUCCESS;
 }
 
+STATIC
+BOOLEAN
+NorFlashIsErased (
+  IN CONST UINT32           *Data,
+  IN UINTN                  Words
+  )
+{
+  while (Words-- > 0) {
+    if (*Data++ != MAX_UINT32) {
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
+
 /**
  * This function unlock and erase an entire NOR Flash block.
+ *
+ * The erase is skipped if the block reads back as blank already, which is
+ * much cheaper than a sector erase cycle.
  **/
 EFI_STATUS
 NorFlashUnlockAndEraseSingleBlock (
@@ -473,6 +562,12 @@ NorFlashUnlockAndEraseSingleBlock (
 
   NorFlashLock (&Lock);
 
+  NorFlashSetReadMode (Instance);
+  if (NorFlashIsErased ((UINT32 *)BlockAddress, Instance->BlockSize / 4)) {
+    NorFlashUnlock (&Lock);
+    return EFI_SUCCESS;
+  }
+
   Index = 0;
   // The block erase might fail a first time (SW bug ?). Retry it ...
   do {
@@ -524,6 +619,80 @@ NorFlashWriteSingleWord (
   return Status;
 }
 
+/**
+  Program up to a page of data with a single page program command.
+
+  The page program sequence is set up as continuous, so that the sequential
+  writes to the page are sent as the data phase of one command rather than as
+  one command each. The page is read back afterwards: if it does not match,
+  page programming is disabled for the instance and the caller must fall back
+  to word programming.
+
+  @param[in]  Instance     NOR flash instance.
+  @param[in]  PageAddress  Address of the page, aligned to NOR_FLASH_PAGE_SIZE.
+  @param[in]  Data         Data to program.
+  @param[in]  Words        Number of 32-bit words to program.
+
+  @retval EFI_SUCCESS       The page was programmed.
+  @retval EFI_DEVICE_ERROR  The page was not or not correctly programmed.
+
+**/
+STATIC
+EFI_STATUS
+NorFlashWritePage (
+  IN NOR_FLASH_INSTANCE     *Instance,
+  IN UINTN                  PageAddress,
+  IN CONST UINT32           *Data,
+  IN UINTN                  Words
+  )
+{
+  CONST CSDC_DEFINITION     *Cmd;
+  UINT16                    CSDC[ARRAY_SIZE (mFip006NullCmdSeq)];
+  UINTN                     Index;
+
+  DEBUG ((DEBUG_BLKIO, "NorFlashWritePage(PageAddress=0x%08x, Words=%d)\n",
+    PageAddress, Words));
+
+  ASSERT ((PageAddress % NOR_FLASH_PAGE_SIZE) == 0);
+  ASSERT (Words <= NOR_FLASH_PAGE_SIZE / 4);
+
+  if (EFI_ERROR (NorFlashEnableWrite (Instance))) {
+    return EFI_DEVICE_ERROR;
+  }
+
+  Cmd = NorFlashGetCmdDef (Instance, SPINOR_OP_PP);
+  GenCSDC (
+      Cmd->Code,
+      Cmd->AddrAccess,
+      Cmd->AddrMode4Byte,
+      Cmd->HighZ,
+      Cmd->CsdcTrp,
+      CSDC
+      );
+  // Keep the transfer going after the last address byte
+  CSDC[3] |= CSDC (0, CSDC_CONT_CONTINUOUS, 0, 0);
+  NorFlashSetHostCSDC (Instance, Cmd->ReadWrite, CSDC);
+
+  for (Index = 0; Index < Words; Index++) {
+    MmioWrite32 (PageAddress + (Index * 4), Data[Index]);
+  }
+  MemoryFence ();
+  NorFlashWaitProgramErase (Instance);
+
+  NorFlashDisableWrite (Instance);
+  NorFlashSetHostCSDC (Instance, TRUE, mFip006NullCmdSeq);
+
+  NorFlashSetReadMode (Instance);
+  if (CompareMem ((VOID *)PageAddress, Data, Words * 4) != 0) {
+    DEBUG ((DEBUG_WARN,
+      "%a: page program at 0x%08x did not verify, using word programming\n",
+      __FUNCTION__, PageAddress));
+    Instance->Flags |= NOR_FLASH_NO_PAGE_PROG;
+    return EFI_DEVICE_ERROR;
+  }
+  return EFI_SUCCESS;
+}
+
 STATIC
 EFI_STATUS
 NorFlashWriteFullBlock (
@@ -536,6 +705,8 @@ NorFlashWriteFullBlock (
   EFI_STATUS              Status;
   UINTN                   WordAddress;
   UINT32                  WordIndex;
+  UINT32                  PageWords;
+  UINT32                  Index;
   UINTN                   BlockAddress;
   NOR_FLASH_LOCK_CONTEXT  Lock;
 
@@ -558,12 +729,45 @@ NorFlashWriteFullBlock (
     goto EXIT;
   }
 
-  for (WordIndex=0;
-       WordIndex < BlockSizeInWords;
-       WordIndex++, DataBuffer++, WordAddress += 4) {
-    Status = NorFlashWriteSingleWord (Instance, WordAddress, *DataBuffer);
-    if (EFI_ERROR (Status)) {
-      goto EXIT;
+  //
+  // Program the block a page at a time. The words that are still blank are
+  // left alone: the block has just been erased.
+  //
+  for (WordIndex = 0; WordIndex < BlockSizeInWords; WordIndex += PageWords) {
+    WordAddress = BlockAddress + (WordIndex * 4);
+    PageWords = MIN (NOR_FLASH_PAGE_SIZE / 4, BlockSizeInWords - WordIndex);
+    if (NorFlashIsErased (&DataBuffer[WordIndex], PageWords)) {
+      continue;
+    }
+
+    if ((Instance->Flags & NOR_FLASH_NO_PAGE_PROG) == 0) {
+      Status = NorFlashWritePage (Instance, WordAddress,
+                 &DataBuffer[WordIndex], PageWords);
+      if (!EFI_ERROR (Status)) {
+        continue;
+      }
+      if ((Instance->Flags & NOR_FLASH_NO_PAGE_PROG) == 0) {
+        goto EXIT;
+      }
+      //
+      // The page may have been programmed in part, start the block over with
+      // word programming. The erase is not skipped as the block is no longer
+      // blank.
+      //
+      NorFlashUnlock (&Lock);
+      return NorFlashWriteFullBlock (Instance, Lba, DataBuffer,
+               BlockSizeInWords);
+    }
+
+    for (Index = 0; Index < PageWords; Index++, WordAddress += 4) {
+      if (DataBuffer[WordIndex + Index] == MAX_UINT32) {
+        continue;
+      }
+      Status = NorFlashWriteSingleWord (Instance, WordAddress,
+                 DataBuffer[WordIndex + Index]);
+      if (EFI_ERROR (Status)) {
+        goto EXIT;
+      }
     }
   }
 
@@ -698,8 +902,7 @@ NorFlashReadBlocks (
                                         Instance->BlockSize);
 
   // Put the device into Read Array mode
-  NorFlashSetHostCommand (Instance, SPINOR_OP_READ_4B);
-  NorFlashSetHostCSDC (Instance, TRUE, mFip006NullCmdSeq);
+  NorFlashSetReadMode (Instance);
 
   // Readout the data
   CopyMem(Buffer, (UINTN *)StartAddress, BufferSizeInBytes);
@@ -740,8 +943,7 @@ NorFlashRead (
                                         Instance->BlockSize);
 
   // Put the device into Read Array mode
-  NorFlashSetHostCommand (Instance, SPINOR_OP_READ_4B);
-  NorFlashSetHostCSDC (Instance, TRUE, mFip006NullCmdSeq);
+  NorFlashSetReadMode (Instance);
 
   // Readout the data
   CopyMem (Buffer, (UINTN *)(StartAddress + Offset), BufferSizeInBytes);
@@ -976,6 +1178,8 @@ NorFlashReset (
   CsCfg.Reg.SRAM = CS_CFG_SRAM_RW;
   MmioWrite32 (Instance->HostRegisterBaseAddress + FIP006_REG_CS_CFG,
                CsCfg.Raw);
+  Instance->CsCfgMbm = CS_CFG_MBM_SINGLE;
+  Instance->Flags &= ~NOR_FLASH_READ_MODE;
   NorFlashSetHostCommand (Instance, SPINOR_OP_READ_4B);
   NorFlashSetHostCSDC (Instance, TRUE, mFip006NullCmdSeq);
   return EFI_SUCCESS;
@@ -28,6 +28,8 @@
 
 #define NOR_FLASH_ERASE_RETRY                     10
 
+#define NOR_FLASH_PAGE_SIZE                       256
+
 #define GET_NOR_BLOCK_ADDRESS(BaseAddr, Lba, LbaSize) \
                                       ((BaseAddr) + (UINTN)((Lba) * (LbaSize)))
 
@@ -105,6 +107,11 @@ struct _NOR_FLASH_INSTANCE {
 
   UINT32                              Flags;
 #define NOR_FLASH_POLL_FSR      BIT0
+#define NOR_FLASH_READ_MODE     BIT1    // Sequencer set up for array reads
+#define NOR_FLASH_NO_PAGE_PROG  BIT2    // Page program bursts did not verify
+
+  UINT8                               ReadOpcode;
+  UINT8                               CsCfgMbm;
 };
 
 typedef struct {
@@ -466,6 +466,7 @@ NetsecPollPhyStatus (
   )
 {
   EFI_SIMPLE_NETWORK_PROTOCOL   *Snp;
+  NETSEC_DRIVER                 *LanDriver;
 
   Snp = (EFI_SIMPLE_NETWORK_PROTOCOL *)Context;
   if (Snp == NULL) {
@@ -473,6 +474,22 @@ NetsecPollPhyStatus (
     return;
   }
 
+  LanDriver = INSTANCE_FROM_SNP_THIS (Snp);
+
+  //
+  // Don't compete with the data path for the MDIO bus while frames are
+  // moving, but never skip more than a bounded number of polls in a row.
+  //
+  if (LanDriver->TrafficSeen &&
+      LanDriver->PhyPollSkipped < NETSEC_PHY_STATUS_MAX_SKIP) {
+    LanDriver->TrafficSeen = FALSE;
+    LanDriver->PhyPollSkipped++;
+    return;
+  }
+
+  LanDriver->TrafficSeen = FALSE;
+  LanDriver->PhyPollSkipped = 0;
+
   NetsecUpdateLink (Snp);
 }
 
@@ -695,7 +712,6 @@ SnpTransmit (
 
   ogma_tx_pkt_ctrl_t  tx_pkt_ctrl;
   ogma_frag_info_t    scat_info;
-  ogma_uint16         tx_avail_num;
   ogma_err_t          ogma_err;
   UINT16              Proto;
   pfdep_pkt_handle_t  pkt_handle;
@@ -737,23 +753,37 @@ SnpTransmit (
   // Find the LanDriver structure
   LanDriver = INSTANCE_FROM_SNP_THIS (Snp);
 
-  ogma_err = ogma_clear_desc_ring_irq_status (LanDriver->Handle,
-                                              OGMA_DESC_RING_ID_NRM_TX,
-                                              OGMA_CH_IRQ_REG_EMPTY);
-  if (ogma_err != OGMA_ERR_OK) {
-    DEBUG ((DEBUG_ERROR,
-      "NETSEC: ogma_clear_desc_ring_irq_status failed with error code: %d\n",
-      (INT32)ogma_err));
-    ReturnUnlock (EFI_DEVICE_ERROR);
-  }
+  //
+  // Only reclaim completed descriptors when the ring is running short of
+  // free slots, so that the cost of cleaning the ring is amortized over
+  // many frames rather than paid on every Transmit() call.
+  //
+  if (ogma_get_tx_avail_num (LanDriver->Handle,
+                             OGMA_DESC_RING_ID_NRM_TX) < SCAT_NUM) {
+    ogma_err = ogma_clear_desc_ring_irq_status (LanDriver->Handle,
+                                                OGMA_DESC_RING_ID_NRM_TX,
+                                                OGMA_CH_IRQ_REG_EMPTY);
+    if (ogma_err != OGMA_ERR_OK) {
+      DEBUG ((DEBUG_ERROR,
+        "NETSEC: ogma_clear_desc_ring_irq_status failed with error code: %d\n",
+        (INT32)ogma_err));
+      ReturnUnlock (EFI_DEVICE_ERROR);
+    }
 
-  ogma_err = ogma_clean_tx_desc_ring (LanDriver->Handle,
-                                      OGMA_DESC_RING_ID_NRM_TX);
-  if (ogma_err != OGMA_ERR_OK) {
-    DEBUG ((DEBUG_ERROR,
-      "NETSEC: ogma_clean_tx_desc_ring failed with error code: %d\n",
-      (INT32)ogma_err));
-    ReturnUnlock (EFI_DEVICE_ERROR);
+    ogma_err = ogma_clean_tx_desc_ring (LanDriver->Handle,
+                                        OGMA_DESC_RING_ID_NRM_TX);
+    if (ogma_err != OGMA_ERR_OK) {
+      DEBUG ((DEBUG_ERROR,
+        "NETSEC: ogma_clean_tx_desc_ring failed with error code: %d\n",
+        (INT32)ogma_err));
+      ReturnUnlock (EFI_DEVICE_ERROR);
+    }
+
+    // Let the caller recycle buffers via GetStatus() and try again
+    if (ogma_get_tx_avail_num (LanDriver->Handle,
+                               OGMA_DESC_RING_ID_NRM_TX) < SCAT_NUM) {
+      ReturnUnlock (EFI_NOT_READY);
+    }
   }
 
   // Ensure header is correct size if non-zero
@@ -795,12 +825,6 @@ SnpTransmit (
   tx_pkt_ctrl.pass_through_flag     = OGMA_TRUE;
   tx_pkt_ctrl.target_desc_ring_id   = OGMA_DESC_RING_ID_GMAC;
 
-  // check empty slot
-  do {
-    tx_avail_num = ogma_get_tx_avail_num (LanDriver->Handle,
-                                          OGMA_DESC_RING_ID_NRM_TX);
-  } while (tx_avail_num < SCAT_NUM);
-
   // send
   ogma_err = ogma_set_tx_pkt_data (LanDriver->Handle,
                                    OGMA_DESC_RING_ID_NRM_TX,
@@ -824,6 +848,8 @@ SnpTransmit (
   //
   InsertTailList (&LanDriver->TxBufferList, &pkt_handle->Link);
 
+  LanDriver->TrafficSeen = TRUE;
+
   gBS->RestoreTPL (SavedTpl);
   return EFI_SUCCESS;
 
@@ -886,7 +912,18 @@ SnpReceive (
   // Find the LanDriver structure
   LanDriver = INSTANCE_FROM_SNP_THIS (Snp);
 
-  if (ogma_get_rx_num (LanDriver->Handle, OGMA_DESC_RING_ID_NRM_RX) > 0) {
+  //
+  // Sample the hardware RX packet counter only once the previously reported
+  // batch of completed descriptors has been consumed.
+  //
+  if (LanDriver->RxPending == 0) {
+    LanDriver->RxPending = ogma_get_rx_num (LanDriver->Handle,
+                                            OGMA_DESC_RING_ID_NRM_RX);
+  }
+
+  if (LanDriver->RxPending > 0) {
+
+    LanDriver->RxPending--;
 
     ogma_err = ogma_get_rx_pkt_data (LanDriver->Handle,
                                     OGMA_DESC_RING_ID_NRM_RX,
@@ -915,14 +952,21 @@ SnpReceive (
     *HdrSize = LanDriver->SnpMode.MediaHeaderSize;
   }
 
-  ogma_clear_desc_ring_irq_status (LanDriver->Handle,
-                                   OGMA_DESC_RING_ID_NRM_TX,
-                                   OGMA_CH_IRQ_REG_EMPTY);
+  LanDriver->TrafficSeen = TRUE;
+
+  //
+  // Reclaim TX descriptors once per RX batch rather than once per frame.
+  //
+  if (LanDriver->RxPending == 0) {
+    ogma_clear_desc_ring_irq_status (LanDriver->Handle,
+                                     OGMA_DESC_RING_ID_NRM_TX,
+                                     OGMA_CH_IRQ_REG_EMPTY);
 
-  ogma_clean_tx_desc_ring (LanDriver->Handle, OGMA_DESC_RING_ID_NRM_TX);
+    ogma_clean_tx_desc_ring (LanDriver->Handle, OGMA_DESC_RING_ID_NRM_TX);
 
-  ogma_enable_top_irq (LanDriver->Handle,
-                       OGMA_TOP_IRQ_REG_NRM_TX | OGMA_TOP_IRQ_REG_NRM_RX);
+    ogma_enable_top_irq (LanDriver->Handle,
+                         OGMA_TOP_IRQ_REG_NRM_TX | OGMA_TOP_IRQ_REG_NRM_RX);
+  }
 
   Status = EFI_SUCCESS;
 
@@ -1114,7 +1158,7 @@ NetsecInit (
   SnpMode->MacAddressChangeable = TRUE;
 
   // We can only transmit one packet at a time
-  SnpMode->MultipleTxSupported = FALSE;
+  SnpMode->MultipleTxSupported = TRUE;
 
   // MediaPresent checks for cable connection and partner link
   SnpMode->MediaPresentSupported = TRUE;
@@ -64,6 +64,13 @@ typedef struct {
 
   EFI_EVENT                         PhyStatusEvent;
 
+  // Completed RX descriptors not yet handed out by Receive()
+  UINT16                            RxPending;
+
+  // Set by the data path, consumed by the PHY status poll
+  BOOLEAN                           TrafficSeen;
+  UINT32                            PhyPollSkipped;
+
   NON_DISCOVERABLE_DEVICE           *Dev;
 } NETSEC_DRIVER;
 
@@ -107,4 +114,11 @@ NetsecRelease (
 
 #define  NETSEC_PHY_STATUS_POLL_INTERVAL     (EFI_TIMER_PERIOD_MILLISECONDS (1000))
 
+//
+// Number of consecutive PHY status polls that may be skipped while frames
+// are flowing. A moving data path implies the link is up, so there is no
+// point in holding the MDIO bus for the full link status read.
+//
+#define  NETSEC_PHY_STATUS_MAX_SKIP          5
+
 #endif
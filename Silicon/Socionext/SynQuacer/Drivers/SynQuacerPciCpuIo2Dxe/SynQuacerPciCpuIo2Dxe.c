@@ -379,6 +379,178 @@ TranslateIoAddress (
   return EFI_INVALID_PARAMETER;
 }
 
+/**
+  Performs the reads of an I/O port request on its translated address.
+
+  Each width and access type has its own loop so that the transfer of a
+  Count > 1 request does not go through the width dispatch per element.
+
+  @param[in]  Width    Signifies the width of the I/O operation.
+  @param[in]  Address  The translated base address of the I/O operation.
+  @param[in]  Count    The number of I/O operations to perform.
+  @param[out] Buffer   The destination buffer to store the results.
+
+**/
+STATIC
+VOID
+IoPortRead (
+  IN  EFI_CPU_IO_PROTOCOL_WIDTH  Width,
+  IN  UINTN                      Address,
+  IN  UINTN                      Count,
+  OUT VOID                       *Buffer
+  )
+{
+  UINT8   *Uint8Buffer;
+  UINT16  *Uint16Buffer;
+  UINT32  *Uint32Buffer;
+
+  Uint8Buffer  = Buffer;
+  Uint16Buffer = Buffer;
+  Uint32Buffer = Buffer;
+
+  switch (Width) {
+  case EfiCpuIoWidthUint8:
+    for (; Count > 0; Address++, Count--) {
+      *Uint8Buffer++ = MmioRead8 (Address);
+    }
+    break;
+  case EfiCpuIoWidthUint16:
+    for (; Count > 0; Address += sizeof (UINT16), Count--) {
+      *Uint16Buffer++ = MmioRead16 (Address);
+    }
+    break;
+  case EfiCpuIoWidthUint32:
+    for (; Count > 0; Address += sizeof (UINT32), Count--) {
+      *Uint32Buffer++ = MmioRead32 (Address);
+    }
+    break;
+  case EfiCpuIoWidthFifoUint8:
+    for (; Count > 0; Count--) {
+      *Uint8Buffer++ = MmioRead8 (Address);
+    }
+    break;
+  case EfiCpuIoWidthFifoUint16:
+    for (; Count > 0; Count--) {
+      *Uint16Buffer++ = MmioRead16 (Address);
+    }
+    break;
+  case EfiCpuIoWidthFifoUint32:
+    for (; Count > 0; Count--) {
+      *Uint32Buffer++ = MmioRead32 (Address);
+    }
+    break;
+  //
+  // A fill read leaves the value of the last register read in the first
+  // element of Buffer.
+  //
+  case EfiCpuIoWidthFillUint8:
+    for (; Count > 0; Address++, Count--) {
+      *Uint8Buffer = MmioRead8 (Address);
+    }
+    break;
+  case EfiCpuIoWidthFillUint16:
+    for (; Count > 0; Address += sizeof (UINT16), Count--) {
+      *Uint16Buffer = MmioRead16 (Address);
+    }
+    break;
+  case EfiCpuIoWidthFillUint32:
+    for (; Count > 0; Address += sizeof (UINT32), Count--) {
+      *Uint32Buffer = MmioRead32 (Address);
+    }
+    break;
+  default:
+    //
+    // 64-bit widths were rejected by CpuIoCheckParameter ()
+    //
+    ASSERT (FALSE);
+    break;
+  }
+}
+
+/**
+  Performs the writes of an I/O port request on its translated address.
+
+  Each width and access type has its own loop so that the transfer of a
+  Count > 1 request does not go through the width dispatch per element.
+
+  @param[in]  Width    Signifies the width of the I/O operation.
+  @param[in]  Address  The translated base address of the I/O operation.
+  @param[in]  Count    The number of I/O operations to perform.
+  @param[in]  Buffer   The source buffer from which to write data.
+
+**/
+STATIC
+VOID
+IoPortWrite (
+  IN  EFI_CPU_IO_PROTOCOL_WIDTH  Width,
+  IN  UINTN                      Address,
+  IN  UINTN                      Count,
+  IN  VOID                       *Buffer
+  )
+{
+  UINT8   *Uint8Buffer;
+  UINT16  *Uint16Buffer;
+  UINT32  *Uint32Buffer;
+
+  Uint8Buffer  = Buffer;
+  Uint16Buffer = Buffer;
+  Uint32Buffer = Buffer;
+
+  switch (Width) {
+  case EfiCpuIoWidthUint8:
+    for (; Count > 0; Address++, Count--) {
+      MmioWrite8 (Address, *Uint8Buffer++);
+    }
+    break;
+  case EfiCpuIoWidthUint16:
+    for (; Count > 0; Address += sizeof (UINT16), Count--) {
+      MmioWrite16 (Address, *Uint16Buffer++);
+    }
+    break;
+  case EfiCpuIoWidthUint32:
+    for (; Count > 0; Address += sizeof (UINT32), Count--) {
+      MmioWrite32 (Address, *Uint32Buffer++);
+    }
+    break;
+  case EfiCpuIoWidthFifoUint8:
+    for (; Count > 0; Count--) {
+      MmioWrite8 (Address, *Uint8Buffer++);
+    }
+    break;
+  case EfiCpuIoWidthFifoUint16:
+    for (; Count > 0; Count--) {
+      MmioWrite16 (Address, *Uint16Buffer++);
+    }
+    break;
+  case EfiCpuIoWidthFifoUint32:
+    for (; Count > 0; Count--) {
+      MmioWrite32 (Address, *Uint32Buffer++);
+    }
+    break;
+  case EfiCpuIoWidthFillUint8:
+    for (; Count > 0; Address++, Count--) {
+      MmioWrite8 (Address, *Uint8Buffer);
+    }
+    break;
+  case EfiCpuIoWidthFillUint16:
+    for (; Count > 0; Address += sizeof (UINT16), Count--) {
+      MmioWrite16 (Address, *Uint16Buffer);
+    }
+    break;
+  case EfiCpuIoWidthFillUint32:
+    for (; Count > 0; Address += sizeof (UINT32), Count--) {
+      MmioWrite32 (Address, *Uint32Buffer);
+    }
+    break;
+  default:
+    //
+    // 64-bit widths were rejected by CpuIoCheckParameter ()
+    //
+    ASSERT (FALSE);
+    break;
+  }
+}
+
 /**
   Reads I/O registers.
 
@@ -430,10 +602,6 @@ CpuIoServiceRead (
   )
 {
   EFI_STATUS                 Status;
-  UINT8                      InStride;
-  UINT8                      OutStride;
-  EFI_CPU_IO_PROTOCOL_WIDTH  OperationWidth;
-  UINT8                      *Uint8Buffer;
 
   Status = CpuIoCheckParameter (FALSE, Width, Address, Count, Buffer);
   if (EFI_ERROR (Status)) {
@@ -445,23 +613,7 @@ CpuIoServiceRead (
     return Status;
   }
 
-  //
-  // Select loop based on the width of the transfer
-  //
-  InStride = mInStride[Width];
-  OutStride = mOutStride[Width];
-  OperationWidth = (EFI_CPU_IO_PROTOCOL_WIDTH)(Width & 0x03);
-
-  for (Uint8Buffer = Buffer; Count > 0;
-       Address += InStride, Uint8Buffer += OutStride, Count--) {
-    if (OperationWidth == EfiCpuIoWidthUint8) {
-      *Uint8Buffer = MmioRead8 ((UINTN)Address);
-    } else if (OperationWidth == EfiCpuIoWidthUint16) {
-      *((UINT16 *)Uint8Buffer) = MmioRead16 ((UINTN)Address);
-    } else if (OperationWidth == EfiCpuIoWidthUint32) {
-      *((UINT32 *)Uint8Buffer) = MmioRead32 ((UINTN)Address);
-    }
-  }
+  IoPortRead (Width, (UINTN)Address, Count, Buffer);
 
   return EFI_SUCCESS;
 }
@@ -517,10 +669,6 @@ CpuIoServiceWrite (
   )
 {
   EFI_STATUS                 Status;
-  UINT8                      InStride;
-  UINT8                      OutStride;
-  EFI_CPU_IO_PROTOCOL_WIDTH  OperationWidth;
-  UINT8                      *Uint8Buffer;
 
   //
   // Make sure the parameters are valid
@@ -535,23 +683,7 @@ CpuIoServiceWrite (
     return Status;
   }
 
-  //
-  // Select loop based on the width of the transfer
-  //
-  InStride = mInStride[Width];
-  OutStride = mOutStride[Width];
-  OperationWidth = (EFI_CPU_IO_PROTOCOL_WIDTH)(Width & 0x03);
-
-  for (Uint8Buffer = (UINT8 *)Buffer; Count > 0;
-       Address += InStride, Uint8Buffer += OutStride, Count--) {
-    if (OperationWidth == EfiCpuIoWidthUint8) {
-      MmioWrite8 ((UINTN)Address, *Uint8Buffer);
-    } else if (OperationWidth == EfiCpuIoWidthUint16) {
-      MmioWrite16 ((UINTN)Address, *((UINT16 *)Uint8Buffer));
-    } else if (OperationWidth == EfiCpuIoWidthUint32) {
-      MmioWrite32 ((UINTN)Address, *((UINT32 *)Uint8Buffer));
-    }
-  }
+  IoPortWrite (Width, (UINTN)Address, Count, Buffer);
 
   return EFI_SUCCESS;
 }
@@ -252,8 +252,8 @@ DriverStart (
   // Mac address is changeable as it is loaded from erasable memory
   SnpMode->MacAddressChangeable = TRUE;
 
-  // Can only transmit one packet at a time
-  SnpMode->MultipleTxSupported = FALSE;
+  // Several frames can be outstanding on the transmit ring
+  SnpMode->MultipleTxSupported = TRUE;
 
   // MediaPresent checks for cable connection and partner link
   SnpMode->MediaPresentSupported = TRUE;
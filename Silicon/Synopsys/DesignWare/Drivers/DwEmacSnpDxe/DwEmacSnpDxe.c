@@ -21,6 +21,52 @@
 #include <Library/NetLib.h>
 #include <Library/DmaLib.h>
 
+/**
+  Release the transmit descriptors the DMA is done with, unmap their
+  segments and move the frames' buffers to the recycled transmit buffer list.
+
+  @param  Snp     The driver instance.
+  @param  Force   Release all outstanding descriptors, used once the
+                  transmit DMA has been stopped.
+
+**/
+STATIC
+VOID
+SnpTxReclaim (
+  IN  SIMPLE_NETWORK_DRIVER   *Snp,
+  IN  BOOLEAN                 Force
+  )
+{
+  VOID      *Mapping;
+  VOID      *TxBuffer;
+  UINT64    *Tmp;
+
+  while (!EFI_ERROR (EmacTxReclaimDescriptor (&Snp->MacDriver, Force,
+                       &Mapping, &TxBuffer))) {
+    if (Mapping != NULL) {
+      DmaUnmap (Mapping);
+    }
+    if (TxBuffer == NULL) {
+      continue;
+    }
+
+    if (Snp->RecycledTxBufCount == Snp->MaxRecycledTxBuf) {
+      Tmp = AllocatePool (sizeof (UINT64) * (Snp->MaxRecycledTxBuf + SNP_TX_BUFFER_INCREASE));
+      if (Tmp == NULL) {
+        DEBUG ((DEBUG_ERROR, "%a (): failed to grow recycled buffer list\n", __FUNCTION__));
+        continue;
+      }
+      CopyMem (Tmp, Snp->RecycledTxBuf, sizeof (UINT64) * Snp->RecycledTxBufCount);
+      FreePool (Snp->RecycledTxBuf);
+      Snp->RecycledTxBuf = Tmp;
+      Snp->MaxRecycledTxBuf += SNP_TX_BUFFER_INCREASE;
+    }
+
+    Snp->RecycledTxBuf[Snp->RecycledTxBufCount] = (UINT64)(UINTN)TxBuffer;
+    Snp->RecycledTxBufCount++;
+  }
+}
+
 /**
   Change the state of a network interface from "stopped" to "started."
 
@@ -109,6 +155,9 @@ SnpStop (
 
   // Stop the Tx and Rx
   EmacStopTxRx (Snp->MacBase);
+  if (Snp->SnpMode.State == EfiSimpleNetworkInitialized) {
+    SnpTxReclaim (Snp, TRUE);
+  }
   // Change the state
   switch (Snp->SnpMode.State) {
     case EfiSimpleNetworkStarted:
@@ -320,6 +369,7 @@ SnpShutdown (
   }
 
   EmacStopTxRx (Snp->MacBase);
+  SnpTxReclaim (Snp, TRUE);
 
   Snp->SnpMode.State = EfiSimpleNetworkStopped;
 
@@ -434,6 +484,7 @@ SnpReceiveFilters (
 {
   UINT32                  ReceiveFilterSetting;
   SIMPLE_NETWORK_DRIVER   *Snp;
+  UINTN                   Count;
 
   Snp = INSTANCE_FROM_SNP_THIS (This);
 
@@ -459,7 +510,33 @@ SnpReceiveFilters (
   // Same bits that are set in Enable/Disable parameters, then bits in the Disable parameter takes precedance
   ReceiveFilterSetting = (Snp->SnpMode.ReceiveFilterSetting | Enable) & (~Disable);
 
-  EmacRxFilters (ReceiveFilterSetting, ResetMCastFilter, MCastFilterCnt, MCastFilter, Snp->MacBase);
+  //
+  // A new multicast list replaces the current one. Without one, the current
+  // list is kept so that other filter bits can be changed on their own.
+  //
+  if (ResetMCastFilter) {
+    Snp->SnpMode.MCastFilterCount = 0;
+  } else if (MCastFilterCnt != 0) {
+    if ((MCastFilterCnt > Snp->SnpMode.MaxMCastFilterCount) ||
+        (MCastFilter == NULL)) {
+      return EFI_INVALID_PARAMETER;
+    }
+
+    for (Count = 0; Count < MCastFilterCnt; Count++) {
+      if ((MCastFilter[Count].Addr[0] & 0x01) == 0) {
+        return EFI_INVALID_PARAMETER;
+      }
+    }
+
+    CopyMem (Snp->SnpMode.MCastFilter, MCastFilter,
+      MCastFilterCnt * sizeof (EFI_MAC_ADDRESS));
+    Snp->SnpMode.MCastFilterCount = (UINT32)MCastFilterCnt;
+  }
+
+  EmacRxFilters (ReceiveFilterSetting, ResetMCastFilter,
+    Snp->SnpMode.MCastFilterCount, Snp->SnpMode.MCastFilter, Snp->MacBase);
+
+  Snp->SnpMode.ReceiveFilterSetting = ReceiveFilterSetting;
 
   return EFI_SUCCESS;
 }
@@ -835,6 +912,12 @@ SnpGetStatus (
     Snp->SnpMode.MediaPresent = TRUE;
   }
 
+  // Move completed frames to the recycled transmit buffer list
+  if (!EFI_ERROR (EfiAcquireLockOrFail (&Snp->Lock))) {
+    SnpTxReclaim (Snp, FALSE);
+    EfiReleaseLock (&Snp->Lock);
+  }
+
   // TxBuff
   if (TxBuff != NULL) {
     // Get a recycled buf from Snp->RecycledTxBuf
@@ -921,41 +1004,29 @@ SnpTransmit (
   )
 {
   SIMPLE_NETWORK_DRIVER      *Snp;
-  UINT32                     DescNum;
-  DESIGNWARE_HW_DESCRIPTOR   *TxDescriptor;
-  DESIGNWARE_HW_DESCRIPTOR   *TxDescriptorMap;
   UINT8                      *EthernetPacket;
-  UINT64                     *Tmp;
   EFI_STATUS                 Status;
-  UINTN                      BufferSizeBuf;
-  EFI_PHYSICAL_ADDRESS       TxBufferAddrMap;
+  EMAC_TX_SEGMENT            Segments[TX_MAX_SEGMENTS];
+  UINTN                      SegmentCount;
+  UINTN                      Offset;
+  UINTN                      MapSize;
 
-  BufferSizeBuf = ETH_BUFSIZE;
   EthernetPacket = Data;
 
-  Snp = INSTANCE_FROM_SNP_THIS (This);
-
-  if (EFI_ERROR (EfiAcquireLockOrFail (&Snp->Lock))) {
-    return EFI_ACCESS_DENIED;
-  }
-
-  if ((Snp->MaxRecycledTxBuf + SNP_TX_BUFFER_INCREASE) >= SNP_MAX_TX_BUFFER_NUM) {
-    return EFI_NOT_READY;
-  }
-
   // Check preliminaries
   if ((This == NULL) || (Data == NULL)) {
     return EFI_INVALID_PARAMETER;
   }
+
+  Snp = INSTANCE_FROM_SNP_THIS (This);
+
   if (Snp->SnpMode.State != EfiSimpleNetworkInitialized) {
     return EFI_NOT_STARTED;
   }
 
-  Snp->MacDriver.TxCurrentDescriptorNum = Snp->MacDriver.TxNextDescriptorNum;
-  DescNum = Snp->MacDriver.TxCurrentDescriptorNum;
-
-  TxDescriptor = Snp->MacDriver.TxdescRing[DescNum];
-  TxDescriptorMap = (VOID *)(UINTN)Snp->MacDriver.TxdescRingMap[DescNum].AddrMap;
+  if ((Snp->MaxRecycledTxBuf + SNP_TX_BUFFER_INCREASE) >= SNP_MAX_TX_BUFFER_NUM) {
+    return EFI_NOT_READY;
+  }
 
   // Ensure header is correct size if non-zero
   if (HdrSize) {
@@ -992,52 +1063,55 @@ SnpTransmit (
     EthernetPacket[12] = (*Protocol & 0xFF00) >> 8;
   }
 
-  CopyMem ((VOID *)(UINTN)TxDescriptor->Addr, EthernetPacket, BuffSize);
-
-  Status = DmaMap (MapOperationBusMasterRead, (VOID *)(UINTN)TxDescriptor->Addr,
-             &BufferSizeBuf, &TxBufferAddrMap, &Snp->MappingTxbuf);
-  if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_ERROR, "%a () for Txbuffer: %r\n", __FUNCTION__, Status));
-    return Status;
+  if (EFI_ERROR (EfiAcquireLockOrFail (&Snp->Lock))) {
+    return EFI_ACCESS_DENIED;
   }
-  TxDescriptorMap->Addr = TxBufferAddrMap;
-
-  TxDescriptor->Tdes1 = (BuffSize << TDES1_SIZE1SHFT) &
-                         TDES1_SIZE1MASK;
 
-  TxDescriptor->Tdes0 |= (TDES0_TXFIRST |
-                          TDES0_TXLAST |
-                          TDES0_OWN);
-
-  // Increase descriptor number
-  DescNum++;
+  // Make room on the ring by releasing the frames that have gone out
+  SnpTxReclaim (Snp, FALSE);
+
+  //
+  // Transmit straight from the caller's buffer. The frame is split across
+  // chained descriptors where it exceeds the per-descriptor segment size,
+  // or where DmaMap () can only map part of the buffer in one go.
+  //
+  SegmentCount = 0;
+  for (Offset = 0; Offset < BuffSize; Offset += MapSize) {
+    if (SegmentCount == TX_MAX_SEGMENTS) {
+      Status = EFI_INVALID_PARAMETER;
+      goto UnmapSegments;
+    }
 
-  if (DescNum >= CONFIG_TX_DESCR_NUM) {
-    DescNum = 0;
+    MapSize = MIN (BuffSize - Offset, TX_MAX_SEGMENT_SIZE);
+    Status = DmaMap (MapOperationBusMasterRead, EthernetPacket + Offset,
+               &MapSize, &Segments[SegmentCount].AddrMap,
+               &Segments[SegmentCount].Mapping);
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "%a () for Txbuffer: %r\n", __FUNCTION__, Status));
+      goto UnmapSegments;
+    }
+    Segments[SegmentCount].Length = (UINT32)MapSize;
+    SegmentCount++;
   }
 
-  Snp->MacDriver.TxNextDescriptorNum = DescNum;
-
-  if (Snp->RecycledTxBufCount < Snp->MaxRecycledTxBuf) {
-    Snp->RecycledTxBuf[Snp->RecycledTxBufCount] = (UINT64)(UINTN)Data;
-    Snp->RecycledTxBufCount ++;
-  } else {
-    Tmp = AllocatePool (sizeof (UINT64) * (Snp->MaxRecycledTxBuf + SNP_TX_BUFFER_INCREASE));
-    if (Tmp == NULL) {
-      return EFI_DEVICE_ERROR;
-    }
-    CopyMem (Tmp, Snp->RecycledTxBuf, sizeof (UINT64) * Snp->RecycledTxBufCount);
-    FreePool (Snp->RecycledTxBuf);
-    Snp->RecycledTxBuf = Tmp;
-    Snp->MaxRecycledTxBuf += SNP_TX_BUFFER_INCREASE;
+  Status = EmacTxQueueFrame (&Snp->MacDriver, Segments, SegmentCount, Data);
+  if (EFI_ERROR (Status)) {
+    goto UnmapSegments;
   }
 
   // Start the transmission
   EmacDmaStart (Snp->MacBase);
 
-  DmaUnmap (Snp->MappingTxbuf);
   EfiReleaseLock (&Snp->Lock);
   return EFI_SUCCESS;
+
+UnmapSegments:
+  while (SegmentCount > 0) {
+    SegmentCount--;
+    DmaUnmap (Segments[SegmentCount].Mapping);
+  }
+  EfiReleaseLock (&Snp->Lock);
+  return Status;
 }
 
 /**
@@ -66,9 +66,6 @@ typedef struct {
   // Current number of recycled buffer pointers in RecycledTxBuf
   UINT32                                 RecycledTxBufCount;
 
-  // For TX buffer DmaUnmap
-  VOID                                   *MappingTxbuf;
-
 } SIMPLE_NETWORK_DRIVER;
 
 extern EFI_COMPONENT_NAME_PROTOCOL       gSnpComponentName;
@@ -16,10 +16,12 @@
 #include "EmacDxeUtil.h"
 #include "PhyDxeUtil.h"
 
+#include <Library/BaseLib.h>
 #include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
 #include <Library/IoLib.h>
 #include <Library/MemoryAllocationLib.h>
+#include <Library/PcdLib.h>
 
 VOID
 EFIAPI
@@ -159,6 +161,12 @@ EmacDmaInit (
   EmacSetupTxdesc (EmacDriver, MacBaseAddress);
   EmacSetupRxdesc (EmacDriver, MacBaseAddress);
 
+  // Use the transmit checksum offload engine if the MAC implements one.
+  // It requires transmit store and forward mode, which is set below.
+  EmacDriver->TxChecksumOffload = (MmioRead32 (MacBaseAddress +
+                                     DW_EMAC_DMAGRP_HW_FEATURE_OFST) &
+                                   DW_EMAC_DMAGRP_HW_FEATURE_TXCOESEL_SET_MSK) != 0;
+
   // 9. Program the following fields to initialize the mode of operation in Register 6 (Operation Mode
   // Register):
   // � Receive and Transmit Store And Forward�
@@ -232,12 +240,16 @@ EmacSetupTxdesc (
 
   for (Index = 0; Index < CONFIG_TX_DESCR_NUM; Index++) {
     TxDescriptor = (VOID *)(UINTN)EmacDriver->TxdescRingMap[Index].AddrMap;
-    TxDescriptor->Addr = (UINT32)(UINTN)&EmacDriver->TxBuffer[Index * CONFIG_ETH_BUFSIZE];
-    if (Index < 9) {
+    TxDescriptor->Addr = 0;
+    if (Index < CONFIG_TX_DESCR_NUM - 1) {
       TxDescriptor->AddrNext = (UINT32)(UINTN)EmacDriver->TxdescRingMap[Index + 1].AddrMap;
     }
     TxDescriptor->Tdes0 = TDES0_TXCHAIN;
     TxDescriptor->Tdes1 = 0;
+
+    EmacDriver->TxBufNum[Index].AddrMap = 0;
+    EmacDriver->TxBufNum[Index].Mapping = NULL;
+    EmacDriver->TxBufAddr[Index] = NULL;
   }
 
   // Correcting the last pointer of the chain
@@ -251,6 +263,8 @@ EmacSetupTxdesc (
   // Initialize the descriptor number
   EmacDriver->TxCurrentDescriptorNum = 0;
   EmacDriver->TxNextDescriptorNum = 0;
+  EmacDriver->TxDirtyDescriptorNum = 0;
+  EmacDriver->TxQueuedDescriptors = 0;
 
   return EFI_SUCCESS;
 }
@@ -269,7 +283,7 @@ EmacSetupRxdesc (
   for (Index = 0; Index < CONFIG_RX_DESCR_NUM; Index++) {
     RxDescriptor = (VOID *)(UINTN)EmacDriver->RxdescRingMap[Index].AddrMap;
     RxDescriptor->Addr = EmacDriver->RxBufNum[Index].AddrMap;
-    if (Index < 9) {
+    if (Index < CONFIG_RX_DESCR_NUM - 1) {
       RxDescriptor->AddrNext = (UINT32)(UINTN)EmacDriver->RxdescRingMap[Index + 1].AddrMap;
     }
     RxDescriptor->Tdes0 = RDES0_OWN;
@@ -292,6 +306,136 @@ EmacSetupRxdesc (
 }
 
 
+/**
+  Place a frame made of one or more DMA mapped segments on the transmit ring.
+
+  Each segment takes one chained descriptor. The first descriptor is only
+  handed to the DMA once all the following ones have been filled in, so the
+  engine never sees a partially built frame.
+
+  @param EmacDriver     The EMAC driver instance.
+  @param Segments       The DMA mapped segments making up the frame.
+  @param SegmentCount   The number of entries in Segments.
+  @param TxBuffer       The caller's buffer, handed back by
+                        EmacTxReclaimDescriptor () once the frame is sent.
+
+  @retval EFI_SUCCESS    The frame was queued.
+  @retval EFI_NOT_READY  There are not enough free descriptors on the ring.
+
+**/
+EFI_STATUS
+EFIAPI
+EmacTxQueueFrame (
+  IN  EMAC_DRIVER       *EmacDriver,
+  IN  EMAC_TX_SEGMENT   *Segments,
+  IN  UINTN             SegmentCount,
+  IN  VOID              *TxBuffer
+  )
+{
+  DESIGNWARE_HW_DESCRIPTOR   *TxDescriptor;
+  UINT32                     First;
+  UINT32                     Index;
+  UINT32                     Tdes0;
+  UINTN                      Count;
+
+  if ((SegmentCount == 0) ||
+      (SegmentCount > CONFIG_TX_DESCR_NUM - EmacDriver->TxQueuedDescriptors)) {
+    return EFI_NOT_READY;
+  }
+
+  First = EmacDriver->TxNextDescriptorNum;
+  Index = First;
+
+  for (Count = 0; Count < SegmentCount; Count++) {
+    TxDescriptor = EmacDriver->TxdescRing[Index];
+    TxDescriptor->Addr = (UINT32)Segments[Count].AddrMap;
+    TxDescriptor->Tdes1 = (Segments[Count].Length << TDES1_SIZE1SHFT) &
+                          TDES1_SIZE1MASK;
+
+    Tdes0 = TDES0_TXCHAIN;
+    if (Count == 0) {
+      Tdes0 |= TDES0_TXFIRST;
+      if (EmacDriver->TxChecksumOffload) {
+        Tdes0 |= TDES0_TXCIC_FULL;
+      }
+    } else {
+      Tdes0 |= TDES0_OWN;
+    }
+    if (Count == SegmentCount - 1) {
+      Tdes0 |= TDES0_TXLAST | TDES0_TXINT;
+    }
+    TxDescriptor->Tdes0 = Tdes0;
+
+    EmacDriver->TxBufNum[Index].AddrMap = Segments[Count].AddrMap;
+    EmacDriver->TxBufNum[Index].Mapping = Segments[Count].Mapping;
+    EmacDriver->TxBufAddr[Index] = (Count == SegmentCount - 1) ? TxBuffer : NULL;
+
+    Index = (Index + 1) % CONFIG_TX_DESCR_NUM;
+  }
+
+  // Hand the whole chain over to the DMA
+  MemoryFence ();
+  EmacDriver->TxdescRing[First]->Tdes0 |= TDES0_OWN;
+
+  EmacDriver->TxCurrentDescriptorNum = First;
+  EmacDriver->TxNextDescriptorNum = Index;
+  EmacDriver->TxQueuedDescriptors += (UINT32)SegmentCount;
+
+  return EFI_SUCCESS;
+}
+
+
+/**
+  Release the oldest transmit descriptor once the DMA is done with it.
+
+  @param EmacDriver     The EMAC driver instance.
+  @param Force          Release the descriptor even if the DMA still owns it.
+                        Only valid once the transmit DMA has been stopped.
+  @param Mapping        The DMA mapping of the segment the descriptor held.
+  @param TxBuffer       The caller's buffer if the descriptor was the last
+                        one of a frame, NULL otherwise.
+
+  @retval EFI_SUCCESS    A descriptor was released.
+  @retval EFI_NOT_READY  The ring is empty or the oldest descriptor is still
+                         owned by the DMA.
+
+**/
+EFI_STATUS
+EFIAPI
+EmacTxReclaimDescriptor (
+  IN  EMAC_DRIVER   *EmacDriver,
+  IN  BOOLEAN       Force,
+  OUT VOID          **Mapping,
+  OUT VOID          **TxBuffer
+  )
+{
+  DESIGNWARE_HW_DESCRIPTOR   *TxDescriptor;
+  UINT32                     Index;
+
+  if (EmacDriver->TxQueuedDescriptors == 0) {
+    return EFI_NOT_READY;
+  }
+
+  Index = EmacDriver->TxDirtyDescriptorNum;
+  TxDescriptor = EmacDriver->TxdescRing[Index];
+  if (!Force && (TxDescriptor->Tdes0 & TDES0_OWN)) {
+    return EFI_NOT_READY;
+  }
+
+  TxDescriptor->Tdes0 = TDES0_TXCHAIN;
+
+  *Mapping = EmacDriver->TxBufNum[Index].Mapping;
+  *TxBuffer = EmacDriver->TxBufAddr[Index];
+  EmacDriver->TxBufNum[Index].Mapping = NULL;
+  EmacDriver->TxBufAddr[Index] = NULL;
+
+  EmacDriver->TxDirtyDescriptorNum = (Index + 1) % CONFIG_TX_DESCR_NUM;
+  EmacDriver->TxQueuedDescriptors--;
+
+  return EFI_SUCCESS;
+}
+
+
 VOID
 EFIAPI
 EmacStartTransmission (
@@ -322,24 +466,22 @@ EmacRxFilters (
   UINT32  Count;
   UINT32  HashReg;
   UINT32  HashBit;
-  UINT32  Reg;
   UINT32  Val;
-
-  // If reset then clear the filter registers
-  if (Reset) {
-    for (Count = 0; Count < NumMfilter; Count++)
-    {
-      MmioWrite32 (MacBaseAddress + HASH_TABLE_REG(Count), 0x00000000);
-    }
-  }
+  UINT32  HashTable[HASH_TABLE_REG_NUM];
 
   // Set MacFilter to the reset value of the  DW_EMAC_GMACGRP_MAC_FRAME_FILTER register.
   MacFilter =  DW_EMAC_GMACGRP_MAC_FRAME_FILTER_RESET;
 
+  //
+  // The hash table is rebuilt from the complete list on every call, so that
+  // addresses dropped from the list stop matching. If reset, or if no list
+  // is given, the table is left empty.
+  //
+  ZeroMem (HashTable, sizeof (HashTable));
+
   if (ReceiveFilterSetting & EFI_SIMPLE_NETWORK_RECEIVE_MULTICAST) {
     MacFilter |=  DW_EMAC_GMACGRP_MAC_FRAME_FILTER_HMC_SET_MSK;
 
-    // Set the hash tables
     if ((NumMfilter > 0) && (!Reset)) {
       // Go through each filter address and set appropriate bits on hash table
       for (Count = 0; Count < NumMfilter; Count++) {
@@ -347,21 +489,29 @@ EmacRxFilters (
         Crc = GenEtherCrc32 (&Mfilter[Count], 6);
         // reserve CRC + take upper 8 bit = take lower 8 bit and reverse it
         Val = BitReverse(Crc & 0xff);
+        // A 64 bin table only uses the upper 6 bits of the reversed CRC
+        if (PcdGet32 (PcdDwEmacMulticastHashBins) == 64) {
+          Val >>= 2;
+        }
         // The most significant bits determines the register to be used (Hash Table Register X),
         // and the least significant five bits determine the bit within the register.
         // For example, a hash value of 8b'10111111 selects Bit 31 of the Hash Table Register 5.
         HashReg = (Val >> 5);
         HashBit = (Val & 0x1f);
-
-        Reg = MmioRead32 (MacBaseAddress + HASH_TABLE_REG(HashReg));
-        // set 1 to HashBit of HashReg
-        // for example, set 1 to bit 31 to Reg 5 as in above example
-        Reg |= (1 << HashBit);
-        MmioWrite32(MacBaseAddress + HASH_TABLE_REG(HashReg), Reg);
+        HashTable[HashReg] |= (1 << HashBit);
       }
     }
   }
 
+  if (PcdGet32 (PcdDwEmacMulticastHashBins) == 64) {
+    MmioWrite32 (MacBaseAddress + DW_EMAC_GMACGRP_HASH_TABLE_LOW_OFST, HashTable[0]);
+    MmioWrite32 (MacBaseAddress + DW_EMAC_GMACGRP_HASH_TABLE_HIGH_OFST, HashTable[1]);
+  } else {
+    for (Count = 0; Count < HASH_TABLE_REG_NUM; Count++) {
+      MmioWrite32 (MacBaseAddress + HASH_TABLE_REG(Count), HashTable[Count]);
+    }
+  }
+
   if ((ReceiveFilterSetting & EFI_SIMPLE_NETWORK_RECEIVE_BROADCAST) == 0) {
     MacFilter |=  DW_EMAC_GMACGRP_MAC_FRAME_FILTER_DBF_SET_MSK;
   }
@@ -22,14 +22,18 @@
 // Most common CRC32 Polynomial for little endian machines
 #define CRC_POLYNOMIAL                                            0xEDB88320
 #define HASH_TABLE_REG(n)                                         0x500 + (0x4 * n)
+#define HASH_TABLE_REG_NUM                                        8
 #define RX_MAX_PACKET                                             1600
 
 #define CONFIG_ETH_BUFSIZE                                         2048
 #define CONFIG_TX_DESCR_NUM                                        10
 #define CONFIG_RX_DESCR_NUM                                        10
-#define TX_TOTAL_BUFSIZE                                           (CONFIG_ETH_BUFSIZE * CONFIG_TX_DESCR_NUM)
 #define RX_TOTAL_BUFSIZE                                           (CONFIG_ETH_BUFSIZE * CONFIG_RX_DESCR_NUM)
 
+// Maximum number of chained descriptors used for a single transmit frame
+#define TX_MAX_SEGMENTS                                            4
+#define TX_MAX_SEGMENT_SIZE                                        CONFIG_ETH_BUFSIZE
+
 // DMA status error bit
 #define RX_DMA_WRITE_DATA_TRANSFER_ERROR                           0x0
 #define TX_DMA_READ_DATA_TRANSFER_ERROR                            0x3
@@ -44,6 +48,7 @@
 #define TDES0_TXLAST                                               BIT29
 #define TDES0_TXFIRST                                              BIT28
 #define TDES0_TXCRCDIS                                             BIT27
+#define TDES0_TXCIC_FULL                                           (BIT23 | BIT22)
 #define TDES0_TXRINGEND                                            BIT21
 #define TDES0_TXCHAIN                                              BIT20
 
@@ -140,10 +145,14 @@
 #define DW_EMAC_GMACGRP_GMII_DATA_GD_GET(value)                     (((value) & 0x0000ffff) >> 0)
 #define DW_EMAC_DMAGRP_OPERATION_MODE_FTF_GET(value)                (((value) & 0x00100000) >> 20)
 
+#define DW_EMAC_DMAGRP_HW_FEATURE_TXCOESEL_SET_MSK                  0x00010000
+
 // DW emac registers offset
 
 #define DW_EMAC_GMACGRP_MAC_CONFIGURATION_OFST                       0x000
 #define DW_EMAC_GMACGRP_MAC_FRAME_FILTER_OFST                        0x004
+#define DW_EMAC_GMACGRP_HASH_TABLE_HIGH_OFST                         0x008
+#define DW_EMAC_GMACGRP_HASH_TABLE_LOW_OFST                          0x00c
 #define DW_EMAC_GMACGRP_GMII_ADDRESS_OFST                            0x010
 #define DW_EMAC_GMACGRP_GMII_DATA_OFST                               0x014
 #define DW_EMAC_GMACGRP_FLOW_CONTROL_OFST                            0x018
@@ -241,16 +250,29 @@ typedef struct {
   void                        *Mapping;
 } MAP_INFO;
 
+typedef struct {
+  EFI_PHYSICAL_ADDRESS        AddrMap;
+  UINT32                      Length;
+  VOID                        *Mapping;
+} EMAC_TX_SEGMENT;
+
 typedef struct {
   DESIGNWARE_HW_DESCRIPTOR    *TxdescRing[CONFIG_TX_DESCR_NUM];
   DESIGNWARE_HW_DESCRIPTOR    *RxdescRing[CONFIG_RX_DESCR_NUM];
-  CHAR8                       TxBuffer[TX_TOTAL_BUFSIZE];
   CHAR8                       RxBuffer[RX_TOTAL_BUFSIZE];
   MAP_INFO                    TxdescRingMap[CONFIG_TX_DESCR_NUM ];
   MAP_INFO                    RxdescRingMap[CONFIG_RX_DESCR_NUM ];
   MAP_INFO                    RxBufNum[CONFIG_TX_DESCR_NUM];
+  // Mapping of the segment each TX descriptor points to
+  MAP_INFO                    TxBufNum[CONFIG_TX_DESCR_NUM];
+  // Caller buffer, recorded on the last descriptor of each frame
+  VOID                        *TxBufAddr[CONFIG_TX_DESCR_NUM];
   UINT32                      TxCurrentDescriptorNum;
   UINT32                      TxNextDescriptorNum;
+  // Oldest descriptor not yet reclaimed, and the number in flight
+  UINT32                      TxDirtyDescriptorNum;
+  UINT32                      TxQueuedDescriptors;
+  BOOLEAN                     TxChecksumOffload;
   UINT32                      RxCurrentDescriptorNum;
   UINT32                      RxNextDescriptorNum;
 } EMAC_DRIVER;
@@ -297,6 +319,24 @@ EmacSetupRxdesc (
   IN  UINTN                   MacBaseAddress
   );
 
+EFI_STATUS
+EFIAPI
+EmacTxQueueFrame (
+  IN  EMAC_DRIVER             *EmacDriver,
+  IN  EMAC_TX_SEGMENT         *Segments,
+  IN  UINTN                   SegmentCount,
+  IN  VOID                    *TxBuffer
+  );
+
+EFI_STATUS
+EFIAPI
+EmacTxReclaimDescriptor (
+  IN  EMAC_DRIVER             *EmacDriver,
+  IN  BOOLEAN                 Force,
+  OUT VOID                    **Mapping,
+  OUT VOID                    **TxBuffer
+  );
+
 VOID
 EFIAPI
 EmacStartTransmission (
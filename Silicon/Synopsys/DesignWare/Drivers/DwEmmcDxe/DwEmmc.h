@@ -122,6 +122,7 @@
 
 #define DWEMMC_FIFO_TWMARK(x)                   (x & 0xfff)
 #define DWEMMC_FIFO_RWMARK(x)                   ((x & 0x1ff) << 16)
+#define DWEMMC_GET_FIFO_RWMARK(x)               (((x) >> 16) & 0xfff)
 #define DWEMMC_DMA_BURST_SIZE(x)                ((x & 0x7) << 28)
 
 #define DWEMMC_CARD_RD_THR(x)                   ((x & 0xfff) << 16)
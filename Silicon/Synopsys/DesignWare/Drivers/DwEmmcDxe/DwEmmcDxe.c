@@ -30,7 +30,6 @@
 #define DWEMMC_DESC_PAGE                1
 #define DWEMMC_BLOCK_SIZE               512
 #define DWEMMC_DMA_BUF_SIZE             (512 * 8)
-#define DWEMMC_MAX_DESC_PAGES           512
 
 typedef struct {
   UINT32                        Des0;
@@ -39,8 +38,11 @@ typedef struct {
   UINT32                        Des3;
 } DWEMMC_IDMAC_DESCRIPTOR;
 
+#define DWEMMC_DESC_PER_PAGE            (EFI_PAGE_SIZE / sizeof (DWEMMC_IDMAC_DESCRIPTOR))
+
 EFI_MMC_HOST_PROTOCOL     *gpMmcHost;
 DWEMMC_IDMAC_DESCRIPTOR   *gpIdmacDesc;
+STATIC UINTN              mIdmacDescPages;
 EFI_GUID mDwEmmcDevicePathGuid = EFI_CALLER_ID_GUID;
 STATIC UINT32 mDwEmmcCommand;
 STATIC UINT32 mDwEmmcArgument;
@@ -424,9 +426,16 @@ DwEmmcAdjustFifoThreshold (
   UINT32 BlkDepthInFifo, FifoThreshold, FifoWidth, FifoDepth;
   UINT32 BlkSize = DWEMMC_BLOCK_SIZE, Idx = 0, RxWatermark = 1, TxWatermark, TxWatermarkInvers;
 
-  /* Skip FIFO adjustment if we do not have platform FIFO depth info */
+  /*
+   * Without platform FIFO depth info, derive it from the RX watermark,
+   * which resets to FIFO_DEPTH - 1. This must run before FIFOTH is
+   * programmed for the first time.
+   */
   FifoDepth = PcdGet32 (PcdDwEmmcDxeFifoDepth);
   if (!FifoDepth) {
+    FifoDepth = DWEMMC_GET_FIFO_RWMARK (MmioRead32 (DWEMMC_FIFOTH)) + 1;
+  }
+  if (FifoDepth < 2) {
     return;
   }
 
@@ -449,10 +458,55 @@ DwEmmcAdjustFifoThreshold (
     Idx--;
   }
 
+  /*
+   * The IDMAC issues bursts of MSIZE, so have the FIFO request service
+   * exactly when a full burst is available to read.
+   */
   RxWatermark = BurstSize[Idx] - 1;
   FifoThreshold = DWEMMC_DMA_BURST_SIZE (Idx) | DWEMMC_FIFO_TWMARK (TxWatermark)
            | DWEMMC_FIFO_RWMARK (RxWatermark);
   MmioWrite32 (DWEMMC_FIFOTH, FifoThreshold);
+  DEBUG ((DEBUG_INFO, "%a: FIFO depth %u, burst %u, FIFOTH 0x%x\n",
+    __FUNCTION__, FifoDepth, BurstSize[Idx], FifoThreshold));
+}
+
+/*
+ * Make sure the descriptor chain can describe Length bytes in one go,
+ * growing it if needed. The IDMAC only takes 32-bit addresses.
+ */
+STATIC
+EFI_STATUS
+DwEmmcReserveDescriptors (
+  IN UINTN                      Length,
+  OUT UINTN                     *DescPages
+  )
+{
+  EFI_PHYSICAL_ADDRESS  Address;
+  EFI_STATUS            Status;
+  UINTN                 Count, Pages;
+
+  Count = (Length + DWEMMC_DMA_BUF_SIZE - 1) / DWEMMC_DMA_BUF_SIZE;
+  Pages = (Count + DWEMMC_DESC_PER_PAGE - 1) / DWEMMC_DESC_PER_PAGE;
+  *DescPages = Pages;
+  if (Pages <= mIdmacDescPages) {
+    return EFI_SUCCESS;
+  }
+
+  Address = MAX_UINT32;
+  Status = gBS->AllocatePages (AllocateMaxAddress, EfiBootServicesData,
+                  Pages, &Address);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a: no room for %Lu descriptor pages\n",
+      __FUNCTION__, (UINT64)Pages));
+    return Status;
+  }
+
+  if (gpIdmacDesc != NULL) {
+    gBS->FreePages ((UINTN)gpIdmacDesc, mIdmacDescPages);
+  }
+  gpIdmacDesc = (DWEMMC_IDMAC_DESCRIPTOR *)(UINTN)Address;
+  mIdmacDescPages = Pages;
+  return EFI_SUCCESS;
 }
 
 EFI_STATUS
@@ -520,14 +574,19 @@ DwEmmcReadBlockData (
   )
 {
   EFI_STATUS  Status;
-  UINT32      DescPages, CountPerPage, Count;
+  UINTN       DescPages;
   EFI_TPL     Tpl;
 
+  if ((UINTN)Buffer + Length - 1 > MAX_UINT32) {
+    return EFI_UNSUPPORTED;
+  }
+
   Tpl = gBS->RaiseTPL (TPL_NOTIFY);
 
-  CountPerPage = EFI_PAGE_SIZE / 16;
-  Count = (Length + DWEMMC_DMA_BUF_SIZE - 1) / DWEMMC_DMA_BUF_SIZE;
-  DescPages = (Count + CountPerPage - 1) / CountPerPage;
+  Status = DwEmmcReserveDescriptors (Length, &DescPages);
+  if (EFI_ERROR (Status)) {
+    goto out;
+  }
 
   InvalidateDataCacheRange (Buffer, Length);
 
@@ -544,6 +603,8 @@ DwEmmcReadBlockData (
     DEBUG ((DEBUG_ERROR, "Failed to read data, mDwEmmcCommand:%x, mDwEmmcArgument:%x, Status:%r\n", mDwEmmcCommand, mDwEmmcArgument, Status));
     goto out;
   }
+  // Drop any lines speculatively fetched while the transfer was running
+  InvalidateDataCacheRange (Buffer, Length);
 out:
   // Restore Tpl
   gBS->RestoreTPL (Tpl);
@@ -559,14 +620,19 @@ DwEmmcWriteBlockData (
   )
 {
   EFI_STATUS  Status;
-  UINT32      DescPages, CountPerPage, Count;
+  UINTN       DescPages;
   EFI_TPL     Tpl;
 
+  if ((UINTN)Buffer + Length - 1 > MAX_UINT32) {
+    return EFI_UNSUPPORTED;
+  }
+
   Tpl = gBS->RaiseTPL (TPL_NOTIFY);
 
-  CountPerPage = EFI_PAGE_SIZE / 16;
-  Count = (Length + DWEMMC_DMA_BUF_SIZE - 1) / DWEMMC_DMA_BUF_SIZE;
-  DescPages = (Count + CountPerPage - 1) / CountPerPage;
+  Status = DwEmmcReserveDescriptors (Length, &DescPages);
+  if (EFI_ERROR (Status)) {
+    goto out;
+  }
 
   WriteBackDataCacheRange (Buffer, Length);
 
@@ -670,6 +736,7 @@ DwEmmcDxeInitialize (
 {
   EFI_STATUS    Status;
   EFI_HANDLE    Handle;
+  UINTN         DescPages;
 
   if (!FixedPcdGetBool (PcdDwPermitObsoleteDrivers)) {
     ASSERT (FALSE);
@@ -679,8 +746,10 @@ DwEmmcDxeInitialize (
   Handle = NULL;
 
   DwEmmcAdjustFifoThreshold ();
-  gpIdmacDesc = (DWEMMC_IDMAC_DESCRIPTOR *)AllocatePages (DWEMMC_MAX_DESC_PAGES);
-  if (gpIdmacDesc == NULL) {
+  // Start with one page of descriptors (1 MB of data), grown on demand
+  Status = DwEmmcReserveDescriptors (DWEMMC_DESC_PER_PAGE * DWEMMC_DMA_BUF_SIZE,
+             &DescPages);
+  if (EFI_ERROR (Status)) {
     return EFI_BUFFER_TOO_SMALL;
   }
 
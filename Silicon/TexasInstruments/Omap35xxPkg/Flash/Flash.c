@@ -9,7 +9,7 @@
 #include "Flash.h"
 
 NAND_PART_INFO_TABLE gNandPartInfoTable[1] = {
-  { 0x2C, 0xBA, 17, 11 }
+  { 0x2C, 0xBA, 17, 11, TRUE }
 };
 
 NAND_FLASH_INFO *gNandFlashInfo = NULL;
@@ -164,6 +164,7 @@ NandDetectPart (
     if (gNandPartInfoTable[Index].ManufactureId == PartInfo[0] && gNandPartInfoTable[Index].DeviceId == PartInfo[1]) {
       gNandFlashInfo->BlockAddressStart = gNandPartInfoTable[Index].BlockAddressStart;
       gNandFlashInfo->PageAddressStart = gNandPartInfoTable[Index].PageAddressStart;
+      gNandFlashInfo->CacheRead = gNandPartInfoTable[Index].CacheRead;
       Found = TRUE;
       break;
     }
@@ -274,33 +275,12 @@ NandCalculateEcc (
 }
 
 EFI_STATUS
-NandReadPage (
-  IN  UINTN                         BlockIndex,
-  IN  UINTN                         PageIndex,
-  OUT VOID                          *Buffer,
-  OUT UINT8                         *SpareBuffer
-)
+NandWaitReady (
+  VOID
+  )
 {
-  UINTN      Address;
-  UINTN      Index;
-  UINTN      NumMainAreaWords = (gNandFlashInfo->PageSize/2);
-  UINTN      NumSpareAreaWords = (gNandFlashInfo->SparePageSize/2);
-  UINT16     *MainAreaWordBuffer = Buffer;
-  UINT16     *SpareAreaWordBuffer = (UINT16 *)SpareBuffer;
   UINTN      Timeout = MAX_RETRY_COUNT;
 
-  //Generate device address in bytes to access specific block and page index
-  Address = GetActualPageAddressInBytes(BlockIndex, PageIndex);
-
-  //Send READ command
-  NandSendCommand(PAGE_READ_CMD);
-
-  //Send 5 Address cycles to access specific device address
-  NandSendAddressCycles(Address);
-
-  //Send READ CONFIRM command
-  NandSendCommand(PAGE_READ_CONFIRM_CMD);
-
   //Poll till device is busy.
   while (Timeout) {
     if ((NandReadStatus() & NAND_READY) == NAND_READY) {
@@ -310,26 +290,73 @@ NandReadPage (
   }
 
   if (Timeout == 0) {
-    DEBUG ((EFI_D_ERROR, "Read page timed out.\n"));
     return EFI_TIMEOUT;
   }
 
-  //Reissue READ command
+  //Reissue READ command, the status command switched the device to status output.
   NandSendCommand(PAGE_READ_CMD);
 
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+NandDrainPrefetchFifo (
+  OUT UINT8                         *Destination,
+  IN  UINTN                         Length
+  )
+{
+  UINTN      Index;
+  UINTN      Available;
+  UINTN      Timeout = MAX_RETRY_COUNT;
+
+  while (Length > 0) {
+    Available = FIFOPOINTER (MmioRead32 (GPMC_PREFETCH_STATUS)) & ~(sizeof (UINT32) - 1);
+    if (Available == 0) {
+      if (--Timeout == 0) {
+        return EFI_TIMEOUT;
+      }
+      continue;
+    }
+    Timeout = MAX_RETRY_COUNT;
+
+    Available = MIN (Available, Length);
+    for (Index = 0; Index < Available; Index += sizeof (UINT32)) {
+      WriteUnaligned32 ((UINT32 *)(Destination + Index), MmioRead32 (GPMC_CS0_BASE));
+    }
+    Destination += Available;
+    Length -= Available;
+  }
+
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+NandReadPageData (
+  OUT VOID                          *Buffer,
+  OUT UINT8                         *SpareBuffer
+  )
+{
+  EFI_STATUS Status;
+
   //Enable ECC engine.
   NandEnableEcc();
 
-  //Read data into the buffer.
-  for (Index = 0; Index < NumMainAreaWords; Index++) {
-    *MainAreaWordBuffer++ = MmioRead16(GPMC_NAND_DATA_0);
-  }
+  //Let the GPMC prefetch engine clock the main and spare area out of the
+  //device while the FIFO is drained a word at a time.
+  MmioWrite32 (GPMC_PREFETCH_CONFIG2, TRANSFERCOUNT (gNandFlashInfo->PageSize + gNandFlashInfo->SparePageSize));
+  MmioWrite32 (GPMC_PREFETCH_CONFIG1, ENGINECSSELECTOR_0 | FIFOTHRESHOLD (GPMC_PREFETCH_FIFO_SIZE / 2) | ENABLEENGINE | ACCESSMODE_READ);
+  MmioWrite32 (GPMC_PREFETCH_CONTROL, STARTENGINE);
 
-  //Read spare area into the buffer.
-  for (Index = 0; Index < NumSpareAreaWords; Index++) {
-    *SpareAreaWordBuffer++ = MmioRead16(GPMC_NAND_DATA_0);
+  //Read data and spare area into the buffers.
+  Status = NandDrainPrefetchFifo (Buffer, gNandFlashInfo->PageSize);
+  if (!EFI_ERROR (Status)) {
+    Status = NandDrainPrefetchFifo (SpareBuffer, gNandFlashInfo->SparePageSize);
   }
 
+  //Stop the prefetch engine.
+  MmioWrite32 (GPMC_PREFETCH_CONTROL, 0);
+  MmioWrite32 (GPMC_PREFETCH_CONFIG1, 0);
+
   //Calculate ECC.
   NandCalculateEcc();
 
@@ -339,6 +366,86 @@ NandReadPage (
   //Perform ECC correction.
   //Need to implement..
 
+  return Status;
+}
+
+EFI_STATUS
+NandReadPage (
+  IN  UINTN                         BlockIndex,
+  IN  UINTN                         PageIndex,
+  OUT VOID                          *Buffer,
+  OUT UINT8                         *SpareBuffer
+)
+{
+  UINTN      Address;
+  EFI_STATUS Status;
+
+  //Generate device address in bytes to access specific block and page index
+  Address = GetActualPageAddressInBytes(BlockIndex, PageIndex);
+
+  //Send READ command
+  NandSendCommand(PAGE_READ_CMD);
+
+  //Send 5 Address cycles to access specific device address
+  NandSendAddressCycles(Address);
+
+  //Send READ CONFIRM command
+  NandSendCommand(PAGE_READ_CONFIRM_CMD);
+
+  Status = NandWaitReady ();
+  if (EFI_ERROR (Status)) {
+    DEBUG ((EFI_D_ERROR, "Read page timed out.\n"));
+    return Status;
+  }
+
+  return NandReadPageData (Buffer, SpareBuffer);
+}
+
+EFI_STATUS
+NandReadBlockCached (
+  IN  UINTN                         BlockIndex,
+  OUT VOID                          *Buffer,
+  OUT UINT8                         *SpareBuffer
+  )
+{
+  UINTN      PageIndex;
+  EFI_STATUS Status;
+
+  //Load the first page into the data register
+  NandSendCommand(PAGE_READ_CMD);
+  NandSendAddressCycles(GetActualPageAddressInBytes(BlockIndex, 0));
+  NandSendCommand(PAGE_READ_CONFIRM_CMD);
+
+  Status = NandWaitReady ();
+  if (EFI_ERROR (Status)) {
+    DEBUG ((EFI_D_ERROR, "Read page timed out.\n"));
+    return Status;
+  }
+
+  //Each READ CACHE command moves the page just read from the array into the
+  //cache register and starts reading the next one, so the array access of a
+  //page overlaps with the transfer of the previous one. READ CACHE END moves
+  //the last page without starting another array read.
+  for (PageIndex = 0; PageIndex < gNandFlashInfo->NumPagesPerBlock; PageIndex++) {
+    if (PageIndex + 1 < gNandFlashInfo->NumPagesPerBlock) {
+      NandSendCommand(READ_CACHE_SEQUENTIAL_CMD);
+    } else {
+      NandSendCommand(READ_CACHE_END_CMD);
+    }
+
+    Status = NandWaitReady ();
+    if (EFI_ERROR (Status)) {
+      DEBUG ((EFI_D_ERROR, "Cache read timed out.\n"));
+      return Status;
+    }
+
+    Status = NandReadPageData (Buffer, SpareBuffer);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+    Buffer = ((UINT8 *)Buffer + gNandFlashInfo->PageSize);
+  }
+
   return EFI_SUCCESS;
 }
 
@@ -487,6 +594,15 @@ NandReadBlock (
   EFI_STATUS Status = EFI_SUCCESS;
 
   for (BlockIndex = StartBlockIndex; BlockIndex <= EndBlockIndex; BlockIndex++) {
+    if (gNandFlashInfo->CacheRead) {
+      Status = NandReadBlockCached(BlockIndex, Buffer, SpareBuffer);
+      if (EFI_ERROR(Status)) {
+        return Status;
+      }
+      Buffer = ((UINT8 *)Buffer + gNandFlashInfo->BlockSize);
+      continue;
+    }
+
     //For each block read number of pages
     for (PageIndex = 0; PageIndex < gNandFlashInfo->NumPagesPerBlock; PageIndex++) {
       Status = NandReadPage(BlockIndex, PageIndex, Buffer, SpareBuffer);
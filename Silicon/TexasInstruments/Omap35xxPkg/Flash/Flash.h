@@ -59,6 +59,8 @@
 
 #define PAGE_READ_CMD            0x00
 #define PAGE_READ_CONFIRM_CMD    0x30
+#define READ_CACHE_SEQUENTIAL_CMD 0x31
+#define READ_CACHE_END_CMD       0x3F
 
 #define BLOCK_ERASE_CMD          0x60
 #define BLOCK_ERASE_CONFIRM_CMD  0xD0
@@ -83,6 +85,7 @@ typedef struct {
   UINT8 DeviceId;
   UINT8 BlockAddressStart; //Start of the Block address in actual NAND
   UINT8 PageAddressStart;  //Start of the Page address in actual NAND
+  BOOLEAN CacheRead;       //Part supports READ CACHE SEQUENTIAL/END
 } NAND_PART_INFO_TABLE;
 
 typedef struct {
@@ -95,6 +98,7 @@ typedef struct {
   UINT32    NumPagesPerBlock;
   UINT8     BlockAddressStart; //Start of the Block address in actual NAND
   UINT8     PageAddressStart;  //Start of the Page address in actual NAND
+  BOOLEAN   CacheRead;         //Part supports READ CACHE SEQUENTIAL/END
 } NAND_FLASH_INFO;
 
 #endif //FLASH_H
@@ -74,6 +74,26 @@
 #define GPMC_NAND_ADDRESS_0   (GPMC_BASE + 0x80)
 #define GPMC_NAND_DATA_0      (GPMC_BASE + 0x84)
 
+//CS0 memory region, BASEADDRESS in GPMC_CONFIG7_0. The prefetch FIFO is read here.
+#define GPMC_CS0_BASE         (BASEADDRESS << 24)
+
+#define GPMC_PREFETCH_CONFIG1 (GPMC_BASE + 0x1E0)
+#define ACCESSMODE_READ       (0x0UL << 0)
+#define ENABLEENGINE          BIT7
+#define FIFOTHRESHOLD(x)      (((x) & 0x7FUL) << 8)
+#define ENGINECSSELECTOR_0    (0x0UL << 24)
+
+#define GPMC_PREFETCH_CONFIG2 (GPMC_BASE + 0x1E4)
+#define TRANSFERCOUNT(x)      ((x) & 0x3FFFUL)
+
+#define GPMC_PREFETCH_CONTROL (GPMC_BASE + 0x1EC)
+#define STARTENGINE           BIT0
+
+#define GPMC_PREFETCH_STATUS  (GPMC_BASE + 0x1F0)
+#define FIFOPOINTER(x)        (((x) >> 24) & 0x7FUL)
+
+#define GPMC_PREFETCH_FIFO_SIZE 64
+
 #define GPMC_ECC_CONFIG       (GPMC_BASE + 0x1F4)
 #define ECCENABLE             BIT0
 #define ECCDISABLE            (0x0UL << 0)